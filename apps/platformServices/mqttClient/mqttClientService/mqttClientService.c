@@ -112,25 +112,12 @@ static le_mem_PoolRef_t PasswordPoolRef = NULL;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Message memory pool.
+ * Message memory pool.  A message holds its topic and payload, so that a received message takes a
+ * single allocation.
  */
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t MessagePoolRef = NULL;
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Topic memory pool.
- */
-//--------------------------------------------------------------------------------------------------
-static le_mem_PoolRef_t TopicPoolRef = NULL;
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Payload memory pool.
- */
-//--------------------------------------------------------------------------------------------------
-static le_mem_PoolRef_t PayloadPoolRef = NULL;
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Represents a message which has been received from the MQTT broker.
@@ -140,10 +127,9 @@ typedef struct mqtt_Message
 {
     // Safe reference to mqtt_Session
     mqtt_SessionRef_t sessionRef;
-    char* topicPtr;
-    size_t topicLength;
-    uint8_t* payloadPtr;
     size_t payloadLength;
+    char topic[MQTT_MAX_TOPIC_LENGTH + 1];
+    uint8_t payload[MQTT_MAX_PAYLOAD_LENGTH];
 } mqtt_Message;
 
 
@@ -842,31 +828,41 @@ static int MessageArrivedHandler
     if (s == NULL)
     {
         LE_WARN("Session doesn't exist");
-        return true;
     }
+    else
+    {
+        // When topicLen is 0 the topic is a normal C string, otherwise it may contain embedded
+        // nulls and topicLen gives its length
+        const size_t topicLength = (topicLen == 0) ? strlen(topicNamePtr) : (size_t)topicLen;
+        const size_t payloadLength = messagePtr->payloadlen;
 
-    mqtt_Message* storedMsgPtr = le_mem_ForceAlloc(MessagePoolRef);
-    LE_ASSERT(storedMsgPtr);
-    memset(storedMsgPtr, 0, sizeof(*storedMsgPtr));
-
-    LE_DEBUG("MessageArrivedHandler called for topic=%s. Storing session=0x%p", topicNamePtr, contextPtr);
-    storedMsgPtr->sessionRef = contextPtr;
+        if (topicLength > MQTT_MAX_TOPIC_LENGTH || payloadLength > MQTT_MAX_PAYLOAD_LENGTH)
+        {
+            LE_WARN(
+                "Message arrived from broker, but it is too large to deliver using Legato IPC - "
+                "topicLength=%zu, payloadLength=%zu",
+                topicLength,
+                payloadLength);
+        }
+        else
+        {
+            LE_DEBUG("MessageArrivedHandler called for topic=%s. Storing session=0x%p",
+                     topicNamePtr, contextPtr);
 
-    // When topicLen is 0 it means that the topic contains embedded nulls and can't be treated as a
-    // normal C string
-    storedMsgPtr->topicLength = (topicLen == 0) ? (strlen(topicNamePtr) + 1) : topicLen;
-    storedMsgPtr->topicPtr = le_mem_ForceAlloc(TopicPoolRef);
-    LE_ASSERT(storedMsgPtr->topicPtr);
-    memset(storedMsgPtr->topicPtr, 0, sizeof(MQTT_MAX_TOPIC_LENGTH));
-    memcpy(storedMsgPtr->topicPtr, topicNamePtr, storedMsgPtr->topicLength);
+            mqtt_Message* storedMsgPtr = le_mem_ForceAlloc(MessagePoolRef);
+            storedMsgPtr->sessionRef = contextPtr;
+            memcpy(storedMsgPtr->topic, topicNamePtr, topicLength);
+            storedMsgPtr->topic[topicLength] = '\0';
+            storedMsgPtr->payloadLength = payloadLength;
+            memcpy(storedMsgPtr->payload, messagePtr->payload, payloadLength);
 
-    storedMsgPtr->payloadLength = messagePtr->payloadlen;
-    storedMsgPtr->payloadPtr = le_mem_ForceAlloc(PayloadPoolRef);
-    LE_ASSERT(storedMsgPtr->payloadPtr);
-    memset(storedMsgPtr->payloadPtr, 0, sizeof(MQTT_MAX_PAYLOAD_LENGTH));
-    memcpy(storedMsgPtr->payloadPtr, messagePtr->payload, storedMsgPtr->payloadLength);
+            le_event_Report(ReceiveThreadEventId, &storedMsgPtr, sizeof(mqtt_Message*));
+        }
+    }
 
-    le_event_Report(ReceiveThreadEventId, &storedMsgPtr, sizeof(mqtt_Message*));
+    // The message has been copied, or dropped: the paho library leaves it to be freed here
+    MQTTClient_freeMessage(&messagePtr);
+    MQTTClient_free(topicNamePtr);
 
     return true;
 }
@@ -889,28 +885,14 @@ static void MessageReceivedEventHandler
     if (s == NULL)
     {
         LE_WARN("Session lookup failed for session=0x%p", storedMsgPtr->sessionRef);
-        return;
     }
-
-    if (s->messageArrivedHandler != NULL)
+    else if (s->messageArrivedHandler != NULL)
     {
-        if (storedMsgPtr->topicLength <= MQTT_MAX_TOPIC_LENGTH &&
-            storedMsgPtr->payloadLength <= MQTT_MAX_PAYLOAD_LENGTH)
-        {
-            s->messageArrivedHandler(
-                storedMsgPtr->topicPtr,
-                storedMsgPtr->payloadPtr,
-                storedMsgPtr->payloadLength,
-                s->messageArrivedHandlerContextPtr);
-        }
-        else
-        {
-            LE_WARN(
-                "Message arrived from broker, but it is too large to deliver using Legato IPC - "
-                "topicLength=%zu, payloadLength=%zu",
-                storedMsgPtr->topicLength,
-                storedMsgPtr->payloadLength);
-        }
+        s->messageArrivedHandler(
+            storedMsgPtr->topic,
+            storedMsgPtr->payload,
+            storedMsgPtr->payloadLength,
+            s->messageArrivedHandlerContextPtr);
     }
     else
     {
@@ -918,8 +900,6 @@ static void MessageReceivedEventHandler
             "Message has arrived, but no handler is registered to receive the notification");
     }
 
-    le_mem_Release(storedMsgPtr->topicPtr);
-    le_mem_Release(storedMsgPtr->payloadPtr);
     le_mem_Release(storedMsgPtr);
 }
 
@@ -965,8 +945,6 @@ COMPONENT_INIT
     UsernamePoolRef = le_mem_CreatePool("MQTT username pool", MQTT_MAX_USERNAME_LENGTH);
     PasswordPoolRef = le_mem_CreatePool("MQTT password pool", MQTT_MAX_PASSWORD_LENGTH);
     MessagePoolRef = le_mem_CreatePool("MQTT message pool", sizeof(mqtt_Message));
-    TopicPoolRef = le_mem_CreatePool("MQTT topic pool", MQTT_MAX_TOPIC_LENGTH);
-    PayloadPoolRef = le_mem_CreatePool("MQTT payload pool", MQTT_MAX_PAYLOAD_LENGTH);
 
     // MessageHandlerRefMap is created with size (MQTT_SESSION_MAX * 2) since each MQTT session
     // may have 2 handlers, i.e. 1 message arrived handler and 1 connection lost handler
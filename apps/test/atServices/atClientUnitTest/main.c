@@ -193,6 +193,19 @@ static void* AtClient
               == LE_NOT_FOUND);
     LE_ASSERT(le_atClient_Delete(cmdRef) == LE_OK);
 
+    // Check the priority and the statistics of the command queue
+    uint32_t depth, maxDepth, commandCount, averageWaitMs, maxWaitMs;
+    cmdRef = le_atClient_Create();
+    LE_ASSERT(le_atClient_SetPriority(cmdRef, LE_ATCLIENT_PRIORITY_HIGH + 1) == LE_BAD_PARAMETER);
+    LE_ASSERT_OK(le_atClient_SetPriority(cmdRef, LE_ATCLIENT_PRIORITY_HIGH));
+    LE_ASSERT(le_atClient_Delete(cmdRef) == LE_OK);
+    LE_ASSERT_OK(le_atClient_GetQueueStats(devRef, &depth, &maxDepth, &commandCount,
+                                           &averageWaitMs, &maxWaitMs));
+    LE_ASSERT(depth == 0);
+    LE_ASSERT(maxDepth >= 1);
+    LE_ASSERT(commandCount == 2);
+    LE_ASSERT(averageWaitMs <= maxWaitMs);
+
     // Try to stop the device
     LE_ASSERT_OK(le_atClient_Stop(devRef));
     LE_ASSERT(le_atClient_Stop(devRef) == LE_FAULT);
@@ -1137,5 +1137,8 @@ void AtServer
         i++;
     }
 
+    // AT commands names are not case sensitive: "AT+ABCD" already exists
+    LE_ASSERT(le_atServer_Create("at+Abcd") == atCmdCreation[6].cmdRef);
+
     le_sem_Post(sharedDataPtr->semRef);
 }
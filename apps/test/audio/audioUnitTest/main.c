@@ -587,6 +587,7 @@ void Testle_audio_Connector
  * API tested:
  * - le_audio_PlaySamples
  * - le_audio_AddMediaHandler
+ * - le_audio_GetUnderrunCount
  * - le_audio_Stop
  *
  * Exit if failed
@@ -633,6 +634,9 @@ void Testle_audio_PlaySamples
     // Release buffer in pa_pcm_simu
     pa_pcmSimu_ReleaseData();
 
+    uint32_t underrunCount;
+    LE_ASSERT(le_audio_GetUnderrunCount(playbackStreamRef, &underrunCount) == LE_OK);
+
     // Stop
     LE_ASSERT(le_audio_Stop(playbackStreamRef) == LE_OK);
 
@@ -781,6 +785,10 @@ void Testle_audio_CaptureSamples
         LE_ASSERT(read(Pipefd[0],receivedPcmFramesPtr+i,10) == 10);
     }
 
+    // Underruns are only counted for player streams
+    uint32_t underrunCount;
+    LE_ASSERT(le_audio_GetUnderrunCount(captureStreamRef, &underrunCount) == LE_BAD_PARAMETER);
+
     // All the expected data are received: stop the recoding
     LE_ASSERT(le_audio_Stop(captureStreamRef) == LE_OK);
 
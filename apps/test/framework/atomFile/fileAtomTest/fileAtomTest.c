@@ -1139,6 +1139,53 @@ void TestAccessMode
 }
 
 
+static void TestBatch
+(
+    const char* filePath1,
+    const char* filePath2
+)
+{
+    // Commit two files together.
+    le_atomFile_BatchRef_t batchRef = le_atomFile_BeginBatch();
+
+    int fd = le_atomFile_Create(filePath1, LE_FLOCK_WRITE, LE_FLOCK_REPLACE_IF_EXIST, S_IRWXU);
+    LE_ASSERT(fd > 0);
+    WriteString(fd, NUM_WRITE);
+    LE_ASSERT_OK(le_atomFile_AddToBatch(batchRef, fd));
+
+    FILE* file = le_atomFile_CreateStream(filePath2,
+                                          LE_FLOCK_WRITE,
+                                          LE_FLOCK_REPLACE_IF_EXIST,
+                                          S_IRWXU,
+                                          NULL);
+    LE_ASSERT(file != NULL);
+    WriteStringStream(file, NUM_WRITE / 2);
+    LE_ASSERT_OK(le_atomFile_AddStreamToBatch(batchRef, file));
+
+    LE_ASSERT_OK(le_atomFile_CommitBatch(batchRef));
+
+    IfNumStringWritten(NUM_WRITE, filePath1);
+    IfNumStringWritten(NUM_WRITE / 2, filePath2);
+
+    // Cancelled batches leave both files untouched.
+    batchRef = le_atomFile_BeginBatch();
+
+    fd = le_atomFile_Open(filePath1, LE_FLOCK_APPEND);
+    LE_ASSERT(fd > 0);
+    WriteString(fd, NUM_WRITE);
+    LE_ASSERT_OK(le_atomFile_AddToBatch(batchRef, fd));
+
+    fd = le_atomFile_Create(filePath2, LE_FLOCK_WRITE, LE_FLOCK_REPLACE_IF_EXIST, S_IRWXU);
+    LE_ASSERT(fd > 0);
+    LE_ASSERT_OK(le_atomFile_AddToBatch(batchRef, fd));
+
+    le_atomFile_CancelBatch(batchRef);
+
+    IfNumStringWritten(NUM_WRITE, filePath1);
+    IfNumStringWritten(NUM_WRITE / 2, filePath2);
+}
+
+
 COMPONENT_INIT
 {
 
@@ -1169,6 +1216,12 @@ COMPONENT_INIT
         TestMultiProcessAccess(TestFileList[i][2]);
         LE_INFO("======== Multi process test done ========");
 
+        LE_INFO("======== Starting batch test for files: %s, %s ========",
+                TestFileList[i][1],
+                TestFileList[i][2]);
+        TestBatch(TestFileList[i][1], TestFileList[i][2]);
+        LE_INFO("======== Batch test done ========");
+
         int j = 0;
         for (j = 0; j < 3; j++)
         {
@@ -0,0 +1,222 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Times node lookups in the config tree: first in a single, very wide, stem node, then down a
+ *  deep path.  The lookups in the wide node are where the config tree's child index
+ *  (LE_CONFIG_CFGTREE_CHILD_INDEX) should make a difference.
+ *
+ *  Usage: configLookupBench [width [depth [rounds]]]
+ *
+ *  Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+
+
+
+
+/// Name of the tree the benchmark is run in.  It's deleted again afterwards.
+#define TREE_NAME "configLookupBench"
+
+/// Default number of children of the wide node.
+#define DEFAULT_WIDTH 1000
+
+/// Default number of levels of the deep path.
+#define DEFAULT_DEPTH 32
+
+/// Default number of times to look up every node.
+#define DEFAULT_ROUNDS 10
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Read an optional numeric argument.
+ *
+ *  @return The argument's value, or the default if it wasn't given.
+ */
+//--------------------------------------------------------------------------------------------------
+static int GetNumArg
+(
+    size_t index,       ///< [IN] Index of the argument.
+    int defaultValue    ///< [IN] Value to use if the argument isn't there.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const char* argPtr = le_arg_GetArg(index);
+
+    if (argPtr == NULL)
+    {
+        return defaultValue;
+    }
+
+    int value = atoi(argPtr);
+
+    LE_FATAL_IF(value <= 0, "Argument '%s' must be a positive number.", argPtr);
+
+    return value;
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Report how long a number of lookups took.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Report
+(
+    const char* namePtr,        ///< [IN] What was looked up.
+    le_clk_Time_t startTime,    ///< [IN] When the lookups started.
+    int count                   ///< [IN] Number of lookups made.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+    double elapsedUs = (elapsed.sec * 1000000.0) + elapsed.usec;
+
+    printf("%s: %d lookups in %.0f us, %.2f us per lookup.\n",
+           namePtr,
+           count,
+           elapsedUs,
+           elapsedUs / count);
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Fill the tree with a wide node, /wide, with width children n0 .. n<width - 1>, and a deep path
+ *  /deep/l/l/.../l/leaf.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Populate
+(
+    int width,  ///< [IN] Number of children of the wide node.
+    int depth   ///< [IN] Number of levels of the deep path.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_cfg_IteratorRef_t iterRef = le_cfg_CreateWriteTxn(TREE_NAME ":/wide");
+    char name[LE_CFG_NAME_LEN_BYTES];
+    int i;
+
+    for (i = 0; i < width; i++)
+    {
+        snprintf(name, sizeof(name), "n%d", i);
+        le_cfg_SetInt(iterRef, name, i);
+    }
+
+    le_cfg_GoToNode(iterRef, "/deep");
+
+    for (i = 0; i < depth; i++)
+    {
+        le_cfg_GoToNode(iterRef, "l");
+    }
+
+    le_cfg_SetBool(iterRef, "leaf", true);
+    le_cfg_CommitTxn(iterRef);
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Look up every child of the wide node, rounds times over, checking each value as we go.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TimeWideLookups
+(
+    int width,  ///< [IN] Number of children of the wide node.
+    int rounds  ///< [IN] Number of times to look up each child.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_cfg_IteratorRef_t iterRef = le_cfg_CreateReadTxn(TREE_NAME ":/wide");
+    char name[LE_CFG_NAME_LEN_BYTES];
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+    int round;
+    int i;
+
+    for (round = 0; round < rounds; round++)
+    {
+        for (i = 0; i < width; i++)
+        {
+            snprintf(name, sizeof(name), "n%d", i);
+
+            int value = le_cfg_GetInt(iterRef, name, -1);
+            LE_FATAL_IF(value != i, "Expected %d in /wide/%s, got %d.", i, name, value);
+        }
+    }
+
+    Report("Wide node", startTime, width * rounds);
+    le_cfg_CancelTxn(iterRef);
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Look up the leaf at the end of the deep path, by its full path, rounds times over.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TimeDeepLookups
+(
+    int depth,  ///< [IN] Number of levels of the deep path.
+    int rounds  ///< [IN] Number of times to look up the leaf.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char path[LE_CFG_STR_LEN_BYTES] = "/deep";
+    int i;
+
+    for (i = 0; i < depth; i++)
+    {
+        LE_FATAL_IF(le_utf8_Append(path, "/l", sizeof(path), NULL) != LE_OK,
+                    "Depth %d is too deep.",
+                    depth);
+    }
+
+    LE_FATAL_IF(le_utf8_Append(path, "/leaf", sizeof(path), NULL) != LE_OK,
+                "Depth %d is too deep.",
+                depth);
+
+    le_cfg_IteratorRef_t iterRef = le_cfg_CreateReadTxn(TREE_NAME ":/");
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < rounds; i++)
+    {
+        LE_FATAL_IF(le_cfg_GetBool(iterRef, path, false) != true, "Couldn't read %s.", path);
+    }
+
+    Report("Deep path", startTime, rounds);
+    le_cfg_CancelTxn(iterRef);
+}
+
+
+
+
+COMPONENT_INIT
+{
+    int width = GetNumArg(0, DEFAULT_WIDTH);
+    int depth = GetNumArg(1, DEFAULT_DEPTH);
+    int rounds = GetNumArg(2, DEFAULT_ROUNDS);
+
+    printf("Width %d, depth %d, %d rounds.\n", width, depth, rounds);
+
+    le_cfgAdmin_DeleteTree(TREE_NAME);
+    Populate(width, depth);
+
+    TimeWideLookups(width, rounds);
+    TimeDeepLookups(depth, rounds * width);
+
+    le_cfgAdmin_DeleteTree(TREE_NAME);
+
+    exit(EXIT_SUCCESS);
+}
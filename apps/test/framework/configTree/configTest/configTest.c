@@ -899,6 +899,55 @@ static void CallbackTest()
 
 
 
+static le_cfg_CoalescedChangeHandlerRef_t CoalescedHandlerRef = NULL;
+static le_sem_Ref_t CoalescedCallbackSemaphore;
+static char CoalescedPaths[LE_CFG_CHANGE_LIST_LEN_BYTES] = "";
+
+static void CoalescedCallbackFunction
+(
+    const char* changedPathsPtr,
+    void* contextPtr
+)
+{
+    LE_INFO("------- Coalesced Callback Called: %s", changedPathsPtr);
+    LE_ASSERT(le_utf8_Copy(CoalescedPaths, changedPathsPtr, sizeof(CoalescedPaths), NULL)
+              == LE_OK);
+    le_cfg_RemoveCoalescedChangeHandler(CoalescedHandlerRef);
+    le_sem_Post(CoalescedCallbackSemaphore);
+}
+
+
+
+
+static void CoalescedCallbackTest()
+{
+    static char pathBuffer[LE_CFG_STR_LEN_BYTES] = "";
+    le_clk_Time_t timeToWait = {5, 0};
+    LE_ASSERT(snprintf(pathBuffer, LE_CFG_STR_LEN_BYTES, "/%s/coalesced", TestRootDir)
+              <= LE_CFG_STR_LEN_BYTES);
+
+    LE_INFO("------- Coalesced Callback Test ----------------------------");
+
+    CoalescedHandlerRef = le_cfg_AddCoalescedChangeHandler(pathBuffer,
+                                                           0,
+                                                           CoalescedCallbackFunction,
+                                                           NULL);
+
+    le_cfg_IteratorRef_t iterRef = le_cfg_CreateWriteTxn(pathBuffer);
+
+    le_cfg_SetString(iterRef, "valueA", "aNewValue");
+    le_cfg_SetString(iterRef, "valueB", "bNewValue");
+    le_cfg_CommitTxn(iterRef);
+    LE_ASSERT_OK(le_sem_WaitWithTimeOut(CoalescedCallbackSemaphore, timeToWait));
+
+    // Both changes arrive in the one notification.
+    LE_ASSERT(strstr(CoalescedPaths, "/coalesced/valueA") != NULL);
+    LE_ASSERT(strstr(CoalescedPaths, "/coalesced/valueB") != NULL);
+    LE_ASSERT(strchr(CoalescedPaths, '\n') != NULL);
+}
+
+
+
 static void IncTestCount
 (
     void
@@ -1040,6 +1089,7 @@ COMPONENT_INIT
     SetEmptySemaphore = le_sem_Create("SetEmptySemaphore", 0);
     CallbackSemaphore = le_sem_Create("CallbackSemaphore", 0);
     RootCallbackSemaphore = le_sem_Create("RootCallbackSemaphore", 0);
+    CoalescedCallbackSemaphore = le_sem_Create("CoalescedCallbackSemaphore", 0);
 
 
     if (le_arg_NumArgs() == 1)
@@ -1068,6 +1118,7 @@ COMPONENT_INIT
     TestSetEmptyTest();
 
     CallbackTest();
+    CoalescedCallbackTest();
     BinaryTest();
 
     // overwrite a large string with a small string and vice-versa
@@ -0,0 +1,187 @@
+ /**
+  * This module is a benchmark for queueing functions to another thread's Event Queue in the
+  * legato runtime library (liblegato.so).
+  *
+  * Several producer threads queue functions to one consumer thread as fast as they can, using
+  * le_event_QueueFunctionToThread().  The test checks that every function is called exactly once
+  * and that the functions from each producer are called in the order they were queued, then
+  * reports the throughput.
+  *
+  * Copyright (C) Sierra Wireless Inc.
+  */
+
+#include "legato.h"
+
+/// Number of threads queueing functions to the consumer.
+#define NUM_PRODUCERS           4
+
+/// Number of functions queued by each producer.
+#define QUEUES_PER_PRODUCER     100000
+
+/// Total number of functions the consumer expects to be called.
+#define TOTAL_QUEUES            (NUM_PRODUCERS * QUEUES_PER_PRODUCER)
+
+/// Thread that all the functions are queued to.
+static le_thread_Ref_t ConsumerThread;
+
+/// Posted by the consumer once its event loop is about to run, and once all functions are called.
+static le_sem_Ref_t ConsumerSem;
+
+/// Posted by the main thread to release all the producers at once.
+static le_sem_Ref_t StartSem;
+
+/// Next sequence number expected from each producer.  Only accessed by the consumer.
+static size_t NextSequence[NUM_PRODUCERS];
+
+/// Number of functions called so far.  Only accessed by the consumer.
+static size_t CallCount;
+
+/// Number of functions that were called out of order.  Only accessed by the consumer.
+static size_t OutOfOrderCount;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function queued to the consumer thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Consume
+(
+    void* producerPtr,      ///< [IN] Index of the producer that queued this function.
+    void* sequencePtr       ///< [IN] Sequence number of this function within its producer.
+)
+{
+    size_t producer = (size_t)producerPtr;
+    size_t sequence = (size_t)sequencePtr;
+
+    if (sequence != NextSequence[producer])
+    {
+        OutOfOrderCount++;
+    }
+    NextSequence[producer] = sequence + 1;
+
+    if (++CallCount == TOTAL_QUEUES)
+    {
+        le_sem_Post(ConsumerSem);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the consumer thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* ConsumerMain
+(
+    void* contextPtr    ///< [IN] Not used.
+)
+{
+    le_sem_Post(ConsumerSem);
+
+    le_event_RunLoop();
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of a producer thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* ProducerMain
+(
+    void* contextPtr    ///< [IN] Index of this producer.
+)
+{
+    size_t i;
+
+    le_sem_Wait(StartSem);
+
+    for (i = 0; i < QUEUES_PER_PRODUCER; i++)
+    {
+        le_event_QueueFunctionToThread(ConsumerThread, Consume, contextPtr, (void*)i);
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run the benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EventQueueBenchmark
+(
+    void
+)
+{
+    le_thread_Ref_t producers[NUM_PRODUCERS];
+    size_t i;
+
+    ConsumerSem = le_sem_Create("ConsumerSem", 0);
+    StartSem = le_sem_Create("StartSem", 0);
+
+    ConsumerThread = le_thread_Create("Consumer", ConsumerMain, NULL);
+    le_thread_Start(ConsumerThread);
+    le_sem_Wait(ConsumerSem);
+
+    for (i = 0; i < NUM_PRODUCERS; i++)
+    {
+        char name[16];
+
+        snprintf(name, sizeof(name), "Producer%" PRIuS, i);
+        producers[i] = le_thread_Create(name, ProducerMain, (void*)i);
+        le_thread_SetJoinable(producers[i]);
+        le_thread_Start(producers[i]);
+    }
+
+    LE_TEST_INFO("Queueing %d functions from each of %d threads", QUEUES_PER_PRODUCER,
+                 NUM_PRODUCERS);
+
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < NUM_PRODUCERS; i++)
+    {
+        le_sem_Post(StartSem);
+    }
+
+    for (i = 0; i < NUM_PRODUCERS; i++)
+    {
+        LE_TEST_OK(le_thread_Join(producers[i], NULL) == LE_OK, "Join producer %" PRIuS, i);
+    }
+
+    le_clk_Time_t queuedTime = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    le_sem_Wait(ConsumerSem);
+
+    le_clk_Time_t calledTime = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    LE_TEST_OK(CallCount == TOTAL_QUEUES, "All %d queued functions called", TOTAL_QUEUES);
+    LE_TEST_OK(OutOfOrderCount == 0, "Functions from each producer called in order");
+    for (i = 0; i < NUM_PRODUCERS; i++)
+    {
+        LE_TEST_OK(NextSequence[i] == QUEUES_PER_PRODUCER,
+                   "All functions from producer %" PRIuS " called", i);
+    }
+
+    uint64_t calledUs = (uint64_t)calledTime.sec * 1000000 + calledTime.usec;
+    LE_TEST_INFO("Queued in %ld.%06ld s, all called in %ld.%06ld s",
+                 queuedTime.sec, queuedTime.usec, calledTime.sec, calledTime.usec);
+    if (calledUs > 0)
+    {
+        LE_TEST_INFO("Throughput: %" PRIu64 " queued functions per second",
+                     (uint64_t)TOTAL_QUEUES * 1000000 / calledUs);
+    }
+}
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(2 + 2 * NUM_PRODUCERS);
+
+    EventQueueBenchmark();
+
+    LE_TEST_EXIT;
+}
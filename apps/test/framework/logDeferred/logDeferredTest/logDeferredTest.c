@@ -0,0 +1,393 @@
+/**
+ * Unit tests for deferred logging (logDeferred.c).
+ *
+ * The following is a list of the test cases:
+ *
+ * - A thread's ring wrapping around many times without losing or garbling messages
+ * - Logging from the child after fork(): the parent's waiting messages are logged once, by the
+ *   parent, and the child's by the child, reusing the forking thread's ring
+ *
+ * The log messages are captured by redirecting standard error to a file, which is where the
+ * framework writes the log when not running on a target.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "logDeferred.h"
+
+#include <sys/wait.h>
+
+#if LE_CONFIG_LOG_DEFERRED
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File the log is captured in.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CAPTURE_FILE        "/tmp/testFwLogDeferred.log"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of messages logged by the wrap-around test: enough for a few dozen trips around the ring.
+ */
+//--------------------------------------------------------------------------------------------------
+#define WRAP_COUNT          (LE_CONFIG_LOG_DEFERRED_RING_BYTES / 8)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of messages logged between flushes by the wrap-around test, few enough to fit in the
+ * ring whatever the length of their padding.
+ */
+//--------------------------------------------------------------------------------------------------
+#define WRAP_BURST          (LE_CONFIG_LOG_DEFERRED_RING_BYTES / 512)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of messages logged on each side of the fork.
+ */
+//--------------------------------------------------------------------------------------------------
+#define FORK_COUNT          5
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Padding logged with the wrap-around messages.  Each message logs a different length of it, so
+ * that the records come in many sizes and end at many places in the ring.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char Padding[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Standard error, while it is redirected to the capture file.
+ */
+//--------------------------------------------------------------------------------------------------
+static int SavedStderr = -1;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts capturing the log.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartCapture
+(
+    void
+)
+{
+    // Messages logged before now go out first.
+    logDefer_Flush();
+
+    int fd = open(CAPTURE_FILE, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, S_IRUSR | S_IWUSR);
+    LE_ASSERT(fd >= 0);
+
+    SavedStderr = dup(STDERR_FILENO);
+    LE_ASSERT(SavedStderr >= 0);
+    LE_ASSERT(dup2(fd, STDERR_FILENO) == STDERR_FILENO);
+    close(fd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops capturing the log, once everything logged so far has been written.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StopCapture
+(
+    void
+)
+{
+    logDefer_Flush();
+
+    LE_ASSERT(dup2(SavedStderr, STDERR_FILENO) == STDERR_FILENO);
+    close(SavedStderr);
+    SavedStderr = -1;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the user message part of a captured log line.
+ *
+ * @return The message, or NULL if the line is not a log message.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* GetMessage
+(
+    const char* linePtr     ///< [IN] The log line.
+)
+{
+    const char* msgPtr = strrchr(linePtr, '|');
+
+    return ((msgPtr != NULL) && (msgPtr[1] == ' ')) ? msgPtr + 2 : NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Logs the wrap-around test's messages.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* WrapThreadMain
+(
+    void* contextPtr    ///< Not used.
+)
+{
+    LE_UNUSED(contextPtr);
+
+    int i;
+
+    for (i = 0; i < WRAP_COUNT; i++)
+    {
+        LE_INFO("wrap %d %s", i, Padding + (i % (sizeof(Padding) - 1)));
+
+        if ((i % WRAP_BURST) == (WRAP_BURST - 1))
+        {
+            logDefer_Flush();
+        }
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests that messages come out whole and in order as a thread's ring wraps around.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestWrapAround
+(
+    void
+)
+{
+    LE_TEST_INFO("***** Ring wrap-around");
+
+    StartCapture();
+
+    le_thread_Ref_t threadRef = le_thread_Create("wrapper", WrapThreadMain, NULL);
+    le_thread_SetJoinable(threadRef);
+    le_thread_Start(threadRef);
+    le_thread_Join(threadRef, NULL);
+
+    StopCapture();
+
+    FILE* filePtr = fopen(CAPTURE_FILE, "r");
+    LE_TEST_ASSERT(filePtr != NULL, "log captured");
+
+    char line[512];
+    int count = 0;
+    int badCount = 0;
+    int droppedCount = 0;
+
+    while (fgets(line, sizeof(line), filePtr) != NULL)
+    {
+        const char* msgPtr = GetMessage(line);
+        int num;
+        char padding[sizeof(Padding)];
+
+        if (msgPtr == NULL)
+        {
+            continue;
+        }
+
+        if (strstr(msgPtr, "were dropped") != NULL)
+        {
+            droppedCount++;
+        }
+        else if (sscanf(msgPtr, "wrap %d %63s", &num, padding) == 2)
+        {
+            if (   (num != count)
+                || (strcmp(padding, Padding + (num % (sizeof(Padding) - 1))) != 0))
+            {
+                badCount++;
+            }
+            count++;
+        }
+    }
+
+    fclose(filePtr);
+
+    LE_TEST_OK(count == WRAP_COUNT, "%d of %d messages logged", count, WRAP_COUNT);
+    LE_TEST_OK(badCount == 0, "messages whole and in order (%d bad)", badCount);
+    LE_TEST_OK(droppedCount == 0, "no messages dropped");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the number of rings allocated in this process.
+ *
+ * @return The number of rings, or -1 if the ring pool can't be found.
+ */
+//--------------------------------------------------------------------------------------------------
+static int GetRingCount
+(
+    void
+)
+{
+#if LE_CONFIG_MEM_POOL_NAMES_ENABLED
+    le_mem_PoolRef_t poolRef = _le_mem_FindPool("framework", "LogRings");
+
+    if (poolRef != NULL)
+    {
+        le_mem_PoolStats_t stats;
+
+        le_mem_GetStats(poolRef, &stats);
+        return (int)stats.numBlocksInUse;
+    }
+#endif
+
+    return -1;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Child side of the fork test.  Logs its own messages and exits with 0 if no new ring was needed
+ * for them, 1 if one was.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunForkChild
+(
+    void
+)
+{
+    int ringCount = GetRingCount();
+    int i;
+
+    for (i = 0; i < FORK_COUNT; i++)
+    {
+        LE_INFO("child %d", i);
+    }
+
+    logDefer_Flush();
+
+    _exit((GetRingCount() <= ringCount) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests logging across fork().
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestFork
+(
+    void
+)
+{
+    int i;
+
+    LE_TEST_INFO("***** fork()");
+
+    StartCapture();
+
+    // Leave these waiting in this thread's ring when forking.
+    for (i = 0; i < FORK_COUNT; i++)
+    {
+        LE_INFO("parent %d", i);
+    }
+
+    pid_t pid = fork();
+    LE_ASSERT(pid >= 0);
+
+    if (pid == 0)
+    {
+        RunForkChild();
+    }
+
+    int status;
+    LE_ASSERT(waitpid(pid, &status, 0) == pid);
+
+    for (i = 0; i < FORK_COUNT; i++)
+    {
+        LE_INFO("parent after %d", i);
+    }
+
+    StopCapture();
+
+    LE_TEST_OK(WIFEXITED(status) && (WEXITSTATUS(status) == EXIT_SUCCESS),
+               "child reused the forking thread's ring");
+
+    FILE* filePtr = fopen(CAPTURE_FILE, "r");
+    LE_TEST_ASSERT(filePtr != NULL, "log captured");
+
+    char line[512];
+    int parentCount[FORK_COUNT] = { 0 };
+    int childCount[FORK_COUNT] = { 0 };
+    int afterCount = 0;
+    int wrongPidCount = 0;
+    char parentPid[32];
+    char childPid[32];
+
+    snprintf(parentPid, sizeof(parentPid), "[%d]", (int)getpid());
+    snprintf(childPid, sizeof(childPid), "[%d]", (int)pid);
+
+    while (fgets(line, sizeof(line), filePtr) != NULL)
+    {
+        const char* msgPtr = GetMessage(line);
+        int num;
+
+        if (msgPtr == NULL)
+        {
+            continue;
+        }
+
+        if (sscanf(msgPtr, "parent after %d", &num) == 1)
+        {
+            afterCount++;
+        }
+        else if ((sscanf(msgPtr, "parent %d", &num) == 1) && (num >= 0) && (num < FORK_COUNT))
+        {
+            parentCount[num]++;
+            wrongPidCount += (strstr(line, parentPid) == NULL);
+        }
+        else if ((sscanf(msgPtr, "child %d", &num) == 1) && (num >= 0) && (num < FORK_COUNT))
+        {
+            childCount[num]++;
+            wrongPidCount += (strstr(line, childPid) == NULL);
+        }
+    }
+
+    fclose(filePtr);
+
+    bool parentOnce = true;
+    bool childOnce = true;
+
+    for (i = 0; i < FORK_COUNT; i++)
+    {
+        parentOnce = parentOnce && (parentCount[i] == 1);
+        childOnce = childOnce && (childCount[i] == 1);
+    }
+
+    LE_TEST_OK(parentOnce, "messages waiting at the fork logged once");
+    LE_TEST_OK(childOnce, "child's messages logged once");
+    LE_TEST_OK(wrongPidCount == 0, "each message logged by the process that logged it");
+    LE_TEST_OK(afterCount == FORK_COUNT, "parent still logging after the fork");
+}
+
+#endif /* end LE_CONFIG_LOG_DEFERRED */
+
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(LE_TEST_NO_PLAN);
+
+#if LE_CONFIG_LOG_DEFERRED
+    TestWrapAround();
+    TestFork();
+
+    unlink(CAPTURE_FILE);
+#else
+    LE_TEST_INFO("Deferred logging is not enabled (LE_CONFIG_LOG_DEFERRED).");
+#endif
+
+    LE_TEST_EXIT;
+}
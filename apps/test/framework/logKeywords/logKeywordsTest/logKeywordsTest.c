@@ -0,0 +1,103 @@
+/**
+ * Unit tests for statically defined trace keywords (le_log_RegTraceKeywords()).
+ *
+ * The following is a list of the test cases:
+ *
+ * - Registering allocates nothing
+ * - Looking up a registered keyword at runtime gives the static keyword's reference
+ * - A keyword enabled before its static definition was registered stays enabled
+ * - Registering the same table again changes nothing
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The test's statically defined trace keywords.
+ */
+//--------------------------------------------------------------------------------------------------
+enum { TRACE_ALPHA, TRACE_BETA, TRACE_EARLY };
+
+static le_log_TraceKeyword_t Traces[] =
+{
+    [TRACE_ALPHA] = LE_LOG_TRACE_KEYWORD_INIT("alpha"),
+    [TRACE_BETA] = LE_LOG_TRACE_KEYWORD_INIT("beta"),
+    [TRACE_EARLY] = LE_LOG_TRACE_KEYWORD_INIT("early"),
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the number of trace keywords the framework has allocated in this process.
+ *
+ * @return The number of keywords, or -1 if the keyword pool can't be found.
+ */
+//--------------------------------------------------------------------------------------------------
+static int GetKeywordCount
+(
+    void
+)
+{
+#if LE_CONFIG_MEM_POOL_NAMES_ENABLED
+    le_mem_PoolRef_t poolRef = _le_mem_FindPool("framework", "TraceKeys");
+
+    if (poolRef != NULL)
+    {
+        le_mem_PoolStats_t stats;
+
+        le_mem_GetStats(poolRef, &stats);
+        return (int)stats.numBlocksInUse;
+    }
+#endif
+
+    return -1;
+}
+
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(LE_TEST_NO_PLAN);
+
+    // A keyword looked up, and enabled, before the component registers its static definition.
+    // The reference points to the keyword's enabled flag, which is what the log control sets.
+    le_log_TraceRef_t earlyRef = le_log_GetTraceRef("early");
+    LE_TEST_ASSERT(earlyRef != NULL, "runtime keyword created");
+    *((bool*)earlyRef) = true;
+
+    int keywordCount = GetKeywordCount();
+
+    LE_TEST_INFO("***** Registration");
+
+    le_log_RegTraceKeywords(Traces, NUM_ARRAY_MEMBERS(Traces));
+
+    LE_TEST_OK(GetKeywordCount() == keywordCount, "registering allocates nothing");
+    LE_TEST_OK(le_log_GetTraceRef("alpha") == LE_LOG_TRACE_REF(Traces[TRACE_ALPHA]),
+               "runtime lookup finds the static keyword");
+    LE_TEST_OK(le_log_GetTraceRef("beta") == LE_LOG_TRACE_REF(Traces[TRACE_BETA]),
+               "runtime lookup finds every static keyword");
+    LE_TEST_OK(GetKeywordCount() == keywordCount, "runtime lookup allocates nothing");
+    LE_TEST_OK(!LE_IS_TRACE_ENABLED(LE_LOG_TRACE_REF(Traces[TRACE_ALPHA])),
+               "static keyword starts disabled");
+    LE_TEST_OK(LE_IS_TRACE_ENABLED(LE_LOG_TRACE_REF(Traces[TRACE_EARLY])),
+               "keyword enabled before registering stays enabled");
+
+    LE_TEST_INFO("***** Registering again");
+
+    le_log_RegTraceKeywords(Traces, NUM_ARRAY_MEMBERS(Traces));
+    le_log_RegTraceKeywords(Traces, 0);
+
+    LE_TEST_OK(GetKeywordCount() == keywordCount, "registering again allocates nothing");
+    LE_TEST_OK(le_log_GetTraceRef("alpha") == LE_LOG_TRACE_REF(Traces[TRACE_ALPHA]),
+               "static keyword still found");
+    LE_TEST_OK(LE_IS_TRACE_ENABLED(LE_LOG_TRACE_REF(Traces[TRACE_EARLY])),
+               "enabled keyword still enabled");
+
+    // A keyword that isn't in the list is searched for to the end, which must still be reached.
+    LE_TEST_OK(le_log_GetTraceRef("other") != NULL, "unregistered keyword created");
+    LE_TEST_OK((keywordCount < 0) || (GetKeywordCount() == keywordCount + 1),
+               "unregistered keyword allocated once");
+
+    LE_TEST_EXIT;
+}
@@ -0,0 +1,210 @@
+/**
+ * Unit tests for log rate limiting (log_SetRateLimit()).
+ *
+ * A burst of messages is logged past the rate limit, and nothing after it.  The summary of the
+ * messages suppressed must still be logged, by the summary timer, within two summary intervals.
+ *
+ * The log messages are captured by redirecting standard error to a file, which is where the
+ * framework writes the log when not running on a target.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "logDeferred.h"
+#include "logPlatform.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File the log is captured in.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CAPTURE_FILE        "/tmp/testFwLogRateLimit.log"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of messages logged, and how many of them the rate limit lets through.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LOGGED_COUNT        10
+#define BURST               2
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * How often the captured log is checked for the summary, and for how long.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHECK_INTERVAL_MS   250
+#define CHECK_TIMEOUT_MS    ((2 * LE_CONFIG_LOG_RATE_LIMIT_SUMMARY_SEC + 1) * 1000)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Standard error, while it is redirected to the capture file.
+ */
+//--------------------------------------------------------------------------------------------------
+static int SavedStderr = -1;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time spent waiting for the summary so far.
+ */
+//--------------------------------------------------------------------------------------------------
+static int WaitedMs;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts capturing the log.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartCapture
+(
+    void
+)
+{
+    // Messages logged before now go out first.
+    logDefer_Flush();
+
+    int fd = open(CAPTURE_FILE, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, S_IRUSR | S_IWUSR);
+    LE_ASSERT(fd >= 0);
+
+    SavedStderr = dup(STDERR_FILENO);
+    LE_ASSERT(SavedStderr >= 0);
+    LE_ASSERT(dup2(fd, STDERR_FILENO) == STDERR_FILENO);
+    close(fd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops capturing the log, once everything logged so far has been written.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StopCapture
+(
+    void
+)
+{
+    logDefer_Flush();
+
+    LE_ASSERT(dup2(SavedStderr, STDERR_FILENO) == STDERR_FILENO);
+    close(SavedStderr);
+    SavedStderr = -1;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counts the messages and summaries in the captured log.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CountCaptured
+(
+    int* loggedCountPtr,            ///< [OUT] Number of the test's messages.
+    int* summaryCountPtr,           ///< [OUT] Number of summaries.
+    unsigned int* suppressedPtr     ///< [OUT] Number of messages the last summary reported.
+)
+{
+    FILE* filePtr = fopen(CAPTURE_FILE, "r");
+    char line[512];
+
+    *loggedCountPtr = 0;
+    *summaryCountPtr = 0;
+    *suppressedPtr = 0;
+
+    if (filePtr == NULL)
+    {
+        return;
+    }
+
+    while (fgets(line, sizeof(line), filePtr) != NULL)
+    {
+        const char* msgPtr = strrchr(line, '|');
+        int num;
+
+        if ((msgPtr == NULL) || (msgPtr[1] != ' '))
+        {
+            continue;
+        }
+        msgPtr += 2;
+
+        if (sscanf(msgPtr, "limited %d", &num) == 1)
+        {
+            (*loggedCountPtr)++;
+        }
+        else if (sscanf(msgPtr, "%u messages suppressed", suppressedPtr) == 1)
+        {
+            (*summaryCountPtr)++;
+        }
+    }
+
+    fclose(filePtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks the captured log for the summary, and finishes the test once it is there or the wait
+ * is over.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckTimerExpiryHandler
+(
+    le_timer_Ref_t timerRef     ///< The check timer.
+)
+{
+    int loggedCount;
+    int summaryCount;
+    unsigned int suppressed;
+
+    logDefer_Flush();
+    CountCaptured(&loggedCount, &summaryCount, &suppressed);
+
+    WaitedMs += CHECK_INTERVAL_MS;
+    if ((summaryCount == 0) && (WaitedMs < CHECK_TIMEOUT_MS))
+    {
+        return;
+    }
+
+    le_timer_Stop(timerRef);
+
+    // Nothing is logged to the capture file after this.
+    log_SetRateLimit(STRINGIZE(LE_COMPONENT_NAME), 0, 0, 1);
+    StopCapture();
+    unlink(CAPTURE_FILE);
+
+    LE_TEST_OK(loggedCount == BURST, "%d of %d messages let through", loggedCount, LOGGED_COUNT);
+    LE_TEST_OK(summaryCount == 1, "summary logged without another message (after %d ms)",
+               WaitedMs);
+    LE_TEST_OK(suppressed == LOGGED_COUNT - BURST, "%u messages reported suppressed", suppressed);
+
+    LE_TEST_EXIT;
+}
+
+
+COMPONENT_INIT
+{
+    int i;
+
+    LE_TEST_PLAN(3);
+
+    StartCapture();
+
+    // One message a second lets the burst through, and no more, as they're logged at once.
+    log_SetRateLimit(STRINGIZE(LE_COMPONENT_NAME), 1, BURST, 1);
+
+    for (i = 0; i < LOGGED_COUNT; i++)
+    {
+        LE_INFO("limited %d", i);
+    }
+
+    le_timer_Ref_t timerRef = le_timer_Create("CheckSummary");
+    le_timer_SetMsInterval(timerRef, CHECK_INTERVAL_MS);
+    le_timer_SetRepeat(timerRef, 0);
+    le_timer_SetHandler(timerRef, CheckTimerExpiryHandler);
+    le_timer_Start(timerRef);
+}
@@ -0,0 +1,321 @@
+/**
+ * Unit tests for the Log Control Daemon's persistent log store (logStore.c).
+ *
+ * The following is a list of the test cases:
+ *
+ * - Appending records and reading them back
+ * - Filtering queries by process, PID and component
+ * - Time range queries
+ * - Segment rotation and deletion of the oldest segments
+ *
+ * The store is built with LOG_STORE_DIR, LOG_STORE_SEGMENT_KB and LOG_STORE_MAX_SEGMENTS set by
+ * this component's cflags.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "logStore.h"
+
+#include <dirent.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of records appended by the rotation test.  Enough to fill more than twice as many
+ * segments as the store keeps.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ROTATION_RECORDS    2000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * What a query found.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    size_t  count;              ///< Number of records found.
+    char    firstMsg[64];       ///< Message of the first record found.
+    char    lastMsg[64];        ///< Message of the last record found.
+    int64_t firstSec;           ///< Time of the first record found.
+    int64_t lastSec;            ///< Time of the last record found.
+    bool    inOrder;            ///< true if the records were found oldest first.
+    bool    consecutive;        ///< true if the rotation records found were numbered 1 apart.
+    long    lastNum;            ///< Number of the last rotation record found, or -1.
+}
+QueryResult_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record handler that fills in a QueryResult_t.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CollectRecord
+(
+    const logStore_Record_t*    recordPtr,  ///< [IN] The record.
+    void*                       contextPtr  ///< [IN] The QueryResult_t.
+)
+{
+    QueryResult_t* resultPtr = contextPtr;
+    char msg[64];
+    size_t len = (recordPtr->msgLen < sizeof(msg) - 1) ? recordPtr->msgLen : sizeof(msg) - 1;
+    int64_t sec = recordPtr->timestamp.tv_sec;
+
+    memcpy(msg, recordPtr->msgPtr, len);
+    msg[len] = '\0';
+
+    if (resultPtr->count == 0)
+    {
+        le_utf8_Copy(resultPtr->firstMsg, msg, sizeof(resultPtr->firstMsg), NULL);
+        resultPtr->firstSec = sec;
+    }
+    else if (sec < resultPtr->lastSec)
+    {
+        resultPtr->inOrder = false;
+    }
+
+    long num;
+    if (sscanf(msg, "rotate %ld", &num) == 1)
+    {
+        if ((resultPtr->lastNum >= 0) && (num != resultPtr->lastNum + 1))
+        {
+            resultPtr->consecutive = false;
+        }
+        resultPtr->lastNum = num;
+    }
+
+    le_utf8_Copy(resultPtr->lastMsg, msg, sizeof(resultPtr->lastMsg), NULL);
+    resultPtr->lastSec = sec;
+    resultPtr->count++;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Runs a query.
+ *
+ * @return The number of records found.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t Query
+(
+    const char*     procNamePtr,    ///< [IN] Process name or PID, or "*".
+    const char*     compNamePtr,    ///< [IN] Component name, or "*".
+    int64_t         fromTime,       ///< [IN] Start of the time range.
+    int64_t         toTime,         ///< [IN] End of the time range.
+    size_t          maxRecords,     ///< [IN] Maximum number of records.
+    QueryResult_t*  resultPtr       ///< [OUT] What was found.
+)
+{
+    logStore_Query_t query =
+        {
+            .procNamePtr = procNamePtr,
+            .compNamePtr = compNamePtr,
+            .fromTime = fromTime,
+            .toTime = toTime,
+            .maxRecords = maxRecords
+        };
+
+    memset(resultPtr, 0, sizeof(*resultPtr));
+    resultPtr->inOrder = true;
+    resultPtr->consecutive = true;
+    resultPtr->lastNum = -1;
+
+    size_t count = logStore_Query(&query, CollectRecord, resultPtr);
+    LE_ASSERT(count == resultPtr->count);
+
+    return count;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Waits for the wall clock to move on to the next second, so records appended before and after
+ * have different times.
+ *
+ * @return The new time.
+ */
+//--------------------------------------------------------------------------------------------------
+static int64_t WaitNextSecond
+(
+    void
+)
+{
+    time_t start = time(NULL);
+    time_t now;
+
+    while ((now = time(NULL)) == start)
+    {
+        usleep(10000);
+    }
+
+    return now;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests appending records, reading them back, and filtering by names.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestAppend
+(
+    void
+)
+{
+    QueryResult_t result;
+
+    LE_TEST_INFO("***** Append and query");
+
+    logStore_Append(LE_LOG_INFO, 1234, "procA", "compA", "first\n");
+    logStore_Append(LE_LOG_ERR, 1234, "procA", "compA", "second");
+    logStore_Append(LE_LOG_WARN, 5678, "procB", "compB", "third\n\n");
+
+    LE_TEST_OK(Query("*", "*", 0, INT64_MAX, 100, &result) == 3, "all records found");
+    LE_TEST_OK(strcmp(result.firstMsg, "first") == 0, "oldest first, trailing newline dropped");
+    LE_TEST_OK(strcmp(result.lastMsg, "third") == 0, "newest last, trailing newlines dropped");
+    LE_TEST_OK(result.inOrder, "records in time order");
+
+    LE_TEST_OK(Query("procA", "*", 0, INT64_MAX, 100, &result) == 2, "match by process name");
+    LE_TEST_OK(Query("5678", "*", 0, INT64_MAX, 100, &result) == 1, "match by PID");
+    LE_TEST_OK(strcmp(result.firstMsg, "third") == 0, "right record for PID");
+    LE_TEST_OK(Query("*", "compB", 0, INT64_MAX, 100, &result) == 1, "match by component");
+    LE_TEST_OK(Query("procA", "compB", 0, INT64_MAX, 100, &result) == 0,
+               "process and component must both match");
+    LE_TEST_OK(Query("*", "noSuchComp", 0, INT64_MAX, 100, &result) == 0, "unknown component");
+    LE_TEST_OK(Query("*", "*", 0, INT64_MAX, 2, &result) == 2, "stops at the maximum");
+    LE_TEST_OK(strcmp(result.lastMsg, "second") == 0, "maximum keeps the oldest records");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests time range queries.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestTimeRange
+(
+    void
+)
+{
+    QueryResult_t result;
+
+    LE_TEST_INFO("***** Time range queries");
+
+    LE_TEST_ASSERT(Query("*", "*", 0, INT64_MAX, 100, &result) > 0, "store has records");
+    int64_t first = result.firstSec;
+    int64_t before = result.lastSec;
+
+    int64_t later = WaitNextSecond();
+    logStore_Append(LE_LOG_INFO, 1234, "procA", "compA", "later");
+
+    LE_TEST_OK(Query("*", "*", later, INT64_MAX, 100, &result) == 1, "from a time");
+    LE_TEST_OK(strcmp(result.firstMsg, "later") == 0, "right record from a time");
+    LE_TEST_OK(Query("*", "*", 0, before, 100, &result) == 3, "up to a time");
+    LE_TEST_OK(strcmp(result.lastMsg, "third") == 0, "right records up to a time");
+    LE_TEST_OK(Query("*", "*", first, later, 100, &result) == 4, "inclusive range");
+    LE_TEST_OK(Query("*", "*", later + 1, INT64_MAX, 100, &result) == 0, "range after the last");
+    LE_TEST_OK(Query("*", "*", 0, first - 1, 100, &result) == 0, "range before the first");
+    LE_TEST_OK(Query("*", "*", later, before, 100, &result) == 0, "empty range");
+
+    // No end time is INT64_MAX; it must not be taken for a time in the past.
+    LE_TEST_OK(Query("*", "*", INT64_MIN, INT64_MAX, 100, &result) == 4, "unbounded range");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counts the segment files in the store directory.
+ *
+ * @return The number of segment files.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CountSegments
+(
+    void
+)
+{
+    DIR* dirPtr = opendir(LOG_STORE_DIR);
+    struct dirent* entryPtr;
+    int count = 0;
+
+    LE_ASSERT(dirPtr != NULL);
+
+    while ((entryPtr = readdir(dirPtr)) != NULL)
+    {
+        if (strncmp(entryPtr->d_name, "seg-", 4) == 0)
+        {
+            count++;
+        }
+    }
+    closedir(dirPtr);
+
+    return count;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests that the store moves on to new segments as they fill up, and deletes the oldest.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestRotation
+(
+    void
+)
+{
+    QueryResult_t result;
+    char msg[200];
+    int i;
+
+    LE_TEST_INFO("***** Segment rotation");
+
+    // Pad the messages, so each segment only holds a few hundred records.
+    memset(msg, '.', sizeof(msg) - 1);
+    msg[sizeof(msg) - 1] = '\0';
+
+    for (i = 0; i < ROTATION_RECORDS; i++)
+    {
+        char num[16];
+        int len = snprintf(num, sizeof(num), "rotate %d ", i);
+        memcpy(msg, num, len);
+
+        logStore_Append(LE_LOG_DEBUG, 42, "procR", "compR", msg);
+    }
+
+    LE_TEST_OK(logStore_IsEnabled(), "store still open");
+    LE_TEST_OK(access(LOG_STORE_DIR "/seg-00000000.lgs", F_OK) != 0, "oldest segment deleted");
+    int segCount = CountSegments();
+    LE_TEST_OK(segCount == LOG_STORE_MAX_SEGMENTS, "%d segments kept", segCount);
+
+    size_t count = Query("*", "*", 0, INT64_MAX, SIZE_MAX, &result);
+    LE_TEST_OK((count > 0) && (count < ROTATION_RECORDS), "%" PRIuS " records kept", count);
+    LE_TEST_OK(result.lastNum == ROTATION_RECORDS - 1, "newest record kept");
+    LE_TEST_OK(result.consecutive, "no records missing between the kept segments");
+    LE_TEST_OK(result.inOrder, "records in time order across segments");
+    LE_TEST_OK(Query("procA", "*", 0, INT64_MAX, SIZE_MAX, &result) == 0,
+               "records of the deleted segments gone");
+    LE_TEST_OK(Query("procR", "compR", 0, INT64_MAX, SIZE_MAX, &result) == count,
+               "kept segments' names found");
+}
+
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(LE_TEST_NO_PLAN);
+
+    le_dir_RemoveRecursive(LOG_STORE_DIR);
+
+    logStore_Init();
+    LE_TEST_ASSERT(logStore_IsEnabled(), "store opened in " LOG_STORE_DIR);
+
+    TestAppend();
+    TestTimeRange();
+    TestRotation();
+
+    le_dir_RemoveRecursive(LOG_STORE_DIR);
+
+    LE_TEST_EXIT;
+}
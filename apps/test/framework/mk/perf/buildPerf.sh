@@ -0,0 +1,95 @@
+#!/bin/bash
+#
+# Build tool performance benchmark.  Generates a synthetic system (see genSystem.sh) and times:
+#
+#   mksysCold   - mksys building the system from an empty working directory.
+#   mksysNoop   - mksys run again with nothing changed.
+#   mksysModel  - mksys -n: parsing, modelling and build script generation only (no ninja).
+#   ifgenCold   - ifgen --gen-all for every interface of the system, into an empty directory.
+#   ifgenParse  - ifgen --hash for every interface: parsing only, which is what every run of
+#                 ifgen pays before generating anything.
+#
+# Times are wall-clock seconds.  One line of results is appended to RESULTS_FILE, so runs of
+# different releases (or before and after a change) on the same host can be compared.
+#
+# Copyright (C) Sierra Wireless Inc.
+
+if [ $# -ne 6 ]
+then
+    echo "Usage: $(basename $0) TARGET WORK_DIR RESULTS_FILE NUM_APPS NUM_COMPONENTS" \
+         "NUM_INTERFACES" >&2
+    exit 1
+fi
+
+target=$1
+workDir=$2
+resultsFile=$3
+numApps=$4
+numComps=$5
+numIfs=$6
+
+set -e
+
+scriptDir=$(cd "$(dirname "$0")" && pwd)
+srcDir="$workDir/src"
+buildDir="$workDir/build"
+
+"$scriptDir/genSystem.sh" "$srcDir" "$numApps" "$numComps" "$numIfs"
+
+# Run a command, print how long it took in seconds.
+TimeCmd()
+{
+    local start=$(date +%s.%N)
+
+    "$@" > "$workDir/lastCmd.log" 2>&1 || {
+        cat "$workDir/lastCmd.log" >&2
+        echo "Failed: $*" >&2
+        return 1
+    }
+
+    echo "$start $(date +%s.%N)" | awk '{ printf "%.3f", $2 - $1 }'
+}
+
+mksysCmd=(mksys "$srcDir/perf.sdef" -t "$target" -j "${LEGATO_JOBS:-$(nproc)}"
+          -i "$srcDir/interfaces" -s "$srcDir/components"
+          -w "$buildDir" -o "$buildDir")
+
+rm -rf "$buildDir"
+mksysCold=$(TimeCmd "${mksysCmd[@]}")
+mksysNoop=$(TimeCmd "${mksysCmd[@]}")
+mksysModel=$(TimeCmd "${mksysCmd[@]}" -n)
+
+IfgenAll()
+{
+    local api
+
+    for api in "$srcDir"/interfaces/*.api
+    do
+        ifgen "$@" "$api" > /dev/null
+    done
+}
+
+rm -rf "$workDir/ifgen"
+mkdir -p "$workDir/ifgen"
+ifgenCold=$(TimeCmd IfgenAll --gen-all --output-dir "$workDir/ifgen")
+ifgenParse=$(TimeCmd IfgenAll --hash)
+
+version=$(cat "$LEGATO_ROOT/version" 2>/dev/null || echo unknown)
+header="version,target,apps,components,interfaces,mksysCold,mksysNoop,mksysModel,ifgenCold,ifgenParse"
+result="$version,$target,$numApps,$numComps,$numIfs,$mksysCold,$mksysNoop,$mksysModel,$ifgenCold,$ifgenParse"
+
+mkdir -p "$(dirname "$resultsFile")"
+if ! [ -s "$resultsFile" ]
+then
+    echo "$header" > "$resultsFile"
+fi
+echo "$result" >> "$resultsFile"
+
+echo "Build tool performance ($numApps apps x $numComps components x $numIfs interfaces," \
+     "target $target, Legato $version):"
+echo "  mksys cold build:         $mksysCold s"
+echo "  mksys no-op build:        $mksysNoop s"
+echo "  mksys model/script only:  $mksysModel s"
+echo "  ifgen all files:          $ifgenCold s"
+echo "  ifgen parse only:         $ifgenParse s"
+echo "Results appended to $resultsFile"
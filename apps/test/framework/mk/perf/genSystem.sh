@@ -0,0 +1,211 @@
+#!/bin/bash
+#
+# Generates a synthetic system for the build tool performance benchmark: N apps, each with one
+# executable made of M components, where every component serves K interfaces and is a client of
+# the K interfaces served by the next component in the app.
+#
+# The generated files only depend on N, M and K, so builds of the same system by different
+# releases of the tools can be compared.
+#
+# Copyright (C) Sierra Wireless Inc.
+
+if [ $# -ne 4 ]
+then
+    echo "Usage: $(basename $0) OUTPUT_DIR NUM_APPS NUM_COMPONENTS NUM_INTERFACES" >&2
+    exit 1
+fi
+
+outDir=$1
+numApps=$2
+numComps=$3
+numIfs=$4
+
+for count in $numApps $numComps $numIfs
+do
+    if ! [[ $count =~ ^[1-9][0-9]*$ ]]
+    then
+        echo "Counts must be positive integers, got '$count'." >&2
+        exit 1
+    fi
+done
+
+set -e
+
+rm -rf "$outDir"
+mkdir -p "$outDir/interfaces" "$outDir/components" "$outDir/apps"
+
+# Interfaces.  Definitions, types and a few parameter kinds give ifgen some work besides the
+# functions themselves.
+for ((k = 0; k < numIfs; k++))
+do
+    cat > "$outDir/interfaces/perfIf$k.api" <<EOF
+//--------------------------------------------------------------------------------------------------
+/**
+ * Interface $k of the build tool performance benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+
+DEFINE NAME_LEN = 31;
+DEFINE NAME_LEN_BYTES = NAME_LEN + 1;
+DEFINE DATA_LEN = 16;
+
+ENUM State
+{
+    STATE_IDLE,
+    STATE_BUSY,
+    STATE_DONE
+};
+
+BITMASK Flags
+{
+    FLAG_READ,
+    FLAG_WRITE,
+    FLAG_SYNC
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the name of an item.
+ */
+//--------------------------------------------------------------------------------------------------
+FUNCTION le_result_t SetName
+(
+    uint32 id IN,
+    string name[NAME_LEN] IN
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the name and data of an item.
+ */
+//--------------------------------------------------------------------------------------------------
+FUNCTION le_result_t Get
+(
+    uint32 id IN,
+    string name[NAME_LEN] OUT,
+    uint8 data[DATA_LEN] OUT
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether an item exists.
+ */
+//--------------------------------------------------------------------------------------------------
+FUNCTION bool Exists
+(
+    uint32 id IN
+);
+EOF
+done
+
+for ((i = 0; i < numApps; i++))
+do
+    app="perfApp$i"
+    comps=""
+    bindings=""
+
+    for ((j = 0; j < numComps; j++))
+    do
+        comp="${app}Comp$j"
+        next="${app}Comp$(( (j + 1) % numComps ))"
+        compDir="$outDir/components/$comp"
+        provides=""
+        requires=""
+
+        mkdir -p "$compDir"
+
+        {
+            echo '#include "legato.h"'
+            echo '#include "interfaces.h"'
+            echo
+            echo
+            echo 'COMPONENT_INIT'
+            echo '{'
+            echo '}'
+        } > "$compDir/$comp.c"
+
+        for ((k = 0; k < numIfs; k++))
+        do
+            provides+="        srv$k = perfIf$k.api"$'\n'
+            requires+="        req$k = perfIf$k.api"$'\n'
+            bindings+="    perfExe.$comp.req$k -> perfExe.$next.srv$k"$'\n'
+
+            cat >> "$compDir/$comp.c" <<EOF
+
+
+le_result_t srv${k}_SetName(uint32_t id, const char* name)
+{
+    LE_DEBUG("%" PRIu32 ": %s", id, name);
+    return LE_OK;
+}
+
+
+le_result_t srv${k}_Get(uint32_t id, char* name, size_t nameSize, uint8_t* dataPtr,
+    size_t* dataSizePtr)
+{
+    LE_UNUSED(dataPtr);
+    *dataSizePtr = 0;
+    return le_utf8_Copy(name, "$comp", nameSize, NULL);
+}
+
+
+bool srv${k}_Exists(uint32_t id)
+{
+    return (id == $k);
+}
+EOF
+        done
+
+        cat > "$compDir/Component.cdef" <<EOF
+sources:
+{
+    $comp.c
+}
+
+provides:
+{
+    api:
+    {
+$provides    }
+}
+
+requires:
+{
+    api:
+    {
+$requires    }
+}
+EOF
+
+        comps+=" $comp"
+    done
+
+    cat > "$outDir/apps/$app.adef" <<EOF
+executables:
+{
+    perfExe = ($comps )
+}
+
+processes:
+{
+    run:
+    {
+        (perfExe)
+    }
+}
+
+bindings:
+{
+$bindings}
+EOF
+done
+
+{
+    echo 'apps:'
+    echo '{'
+    for ((i = 0; i < numApps; i++))
+    do
+        echo "    apps/perfApp$i"
+    done
+    echo '}'
+} > "$outDir/perf.sdef"
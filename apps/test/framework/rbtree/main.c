@@ -8,6 +8,8 @@
   * - Adding nodes
   * - Finding a node
   * - Traversing the tree
+  * - Lower/upper bound search
+  * - Augmented tree (order statistics) and its cost
   *
   * Copyright (C) Sierra Wireless Inc.
   */
@@ -233,11 +235,239 @@ void RbtreeScaleTest
     LE_TEST_INFO("***** Red-Black Tree test done.");
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Node of the order-statistics tree: an integer key and the number of nodes in its subtree.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_rbtree_Node_t link;
+    int key;
+    size_t count;
+}
+Rank_t;
+
+#define RANK_OF(linkPtr)   CONTAINER_OF((linkPtr), Rank_t, link)
+#define COUNT_OF(linkPtr)  ((linkPtr) != NULL ? RANK_OF(linkPtr)->count : 0)
+
+#define MAX_RANK_TREE_SIZE 20000
+
+static Rank_t RankItems[MAX_RANK_TREE_SIZE];
+
+static int CompareInt(const void* a, const void* b)
+{
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+
+    return (x > y) - (x < y);
+}
+
+static void UpdateCount
+(
+    le_rbtree_Node_t* linkPtr,
+    le_rbtree_Node_t* leftPtr,
+    le_rbtree_Node_t* rightPtr
+)
+{
+    RANK_OF(linkPtr)->count = 1 + COUNT_OF(leftPtr) + COUNT_OF(rightPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the n-th smallest node (from 0) by walking down the subtree counts.
+ */
+//--------------------------------------------------------------------------------------------------
+static Rank_t* Select
+(
+    le_rbtree_Tree_t* treePtr,
+    size_t n
+)
+{
+    le_rbtree_Node_t* linkPtr = le_rbtree_GetRoot(treePtr);
+
+    while (linkPtr != NULL)
+    {
+        size_t leftCount = COUNT_OF(le_rbtree_GetLeftChild(linkPtr));
+
+        if (n < leftCount)
+        {
+            linkPtr = le_rbtree_GetLeftChild(linkPtr);
+        }
+        else if (n == leftCount)
+        {
+            return RANK_OF(linkPtr);
+        }
+        else
+        {
+            n -= leftCount + 1;
+            linkPtr = le_rbtree_GetRightChild(linkPtr);
+        }
+    }
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that selecting each rank gives the nodes in order.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool CheckRanks
+(
+    le_rbtree_Tree_t* treePtr
+)
+{
+    le_rbtree_Node_t* linkPtr;
+    size_t rank = 0;
+
+    if (COUNT_OF(le_rbtree_GetRoot(treePtr)) != le_rbtree_Size(treePtr))
+    {
+        return false;
+    }
+    for (linkPtr = le_rbtree_GetFirst(treePtr);
+         linkPtr != NULL;
+         linkPtr = le_rbtree_GetNext(treePtr, linkPtr), rank++)
+    {
+        if (Select(treePtr, rank) != RANK_OF(linkPtr))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test lower and upper bound search on a tree holding the even keys.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RbtreeBoundTest
+(
+    void
+)
+{
+    le_rbtree_Tree_t tree;
+    int i;
+    bool ok = true;
+
+    le_rbtree_InitTree(&tree, CompareInt);
+    for (i = 0; i < 100; i++)
+    {
+        RankItems[i].key = i * 2;
+        le_rbtree_InitNode(&RankItems[i].link, &RankItems[i].key);
+        le_rbtree_Insert(&tree, &RankItems[i].link);
+    }
+
+    for (i = -1; i < 200; i++)
+    {
+        le_rbtree_Node_t* lowerPtr = le_rbtree_LowerBound(&tree, &i);
+        le_rbtree_Node_t* upperPtr = le_rbtree_UpperBound(&tree, &i);
+        int lower = (i < 0) ? 0 : ((i + 1) / 2) * 2;
+        int upper = (i < 0) ? 0 : (i / 2 + 1) * 2;
+
+        ok = ok && (lower < 200 ? (lowerPtr != NULL && RANK_OF(lowerPtr)->key == lower)
+                                : lowerPtr == NULL);
+        ok = ok && (upper < 200 ? (upperPtr != NULL && RANK_OF(upperPtr)->key == upper)
+                                : upperPtr == NULL);
+    }
+    LE_TEST_OK(ok, "lower and upper bounds");
+
+    int low = 31;
+    int high = 61;
+    int count = 0;
+    le_rbtree_Node_t* linkPtr;
+    for (linkPtr = le_rbtree_LowerBound(&tree, &low);
+         linkPtr != NULL && RANK_OF(linkPtr)->key < high;
+         linkPtr = le_rbtree_GetNext(&tree, linkPtr))
+    {
+        count++;
+    }
+    LE_TEST_OK(count == 15, "range [%d, %d) holds %d keys", low, high, count);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fill a tree with keys in a scrambled order, then remove every other one, and return the time
+ * taken in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t FillAndThin
+(
+    le_rbtree_Tree_t* treePtr,
+    size_t size
+)
+{
+    le_clk_Time_t start = le_clk_GetRelativeTime();
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        // 7919 is prime, so this visits every key once.
+        RankItems[i].key = (int)((i * 7919) % size);
+        le_rbtree_InitNode(&RankItems[i].link, &RankItems[i].key);
+        le_rbtree_Insert(treePtr, &RankItems[i].link);
+    }
+    for (i = 0; i < size; i += 2)
+    {
+        le_rbtree_Remove(treePtr, &RankItems[i].link);
+    }
+
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    return (uint64_t)elapsed.sec * 1000000 + elapsed.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test an order-statistics tree, and compare its cost with a plain tree.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RbtreeAugmentTest
+(
+    void
+)
+{
+    le_rbtree_Tree_t tree;
+    size_t i;
+
+    LE_TEST_INFO("***** Starting augmented Red-Black Tree test.");
+
+    le_rbtree_InitTree(&tree, CompareInt);
+    le_rbtree_SetAugmentFunc(&tree, UpdateCount);
+
+    uint64_t augmentedUs = FillAndThin(&tree, MAX_RANK_TREE_SIZE);
+    LE_TEST_OK(le_rbtree_Size(&tree) == MAX_RANK_TREE_SIZE / 2, "augmented tree size");
+    LE_TEST_OK(CheckRanks(&tree), "subtree counts after insertions and removals");
+
+    Rank_t* medianPtr = Select(&tree, MAX_RANK_TREE_SIZE / 4);
+    LE_TEST_OK(medianPtr != NULL, "median found");
+
+    // Change a node's contribution without changing its key.
+    medianPtr->count = 0;
+    le_rbtree_UpdateAugment(&tree, &medianPtr->link);
+    LE_TEST_OK(CheckRanks(&tree), "subtree counts after an update");
+
+    for (i = 1; i < MAX_RANK_TREE_SIZE; i += 2)
+    {
+        le_rbtree_Remove(&tree, &RankItems[i].link);
+    }
+    LE_TEST_OK(le_rbtree_GetRoot(&tree) == NULL, "augmented tree emptied");
+
+    le_rbtree_InitTree(&tree, CompareInt);
+    uint64_t plainUs = FillAndThin(&tree, MAX_RANK_TREE_SIZE);
+
+    LE_TEST_INFO("%d insertions and %d removals: %" PRIu64 " us plain, %" PRIu64 " us augmented",
+                 MAX_RANK_TREE_SIZE, MAX_RANK_TREE_SIZE / 2, plainUs, augmentedUs);
+
+    LE_TEST_INFO("***** Augmented Red-Black Tree test done.");
+}
+
 COMPONENT_INIT
 {
     LE_TEST_PLAN(LE_TEST_NO_PLAN);
 
     RbtreeScaleTest();
+    RbtreeBoundTest();
+    RbtreeAugmentTest();
 
     LE_TEST_EXIT;
 }
@@ -33,6 +33,9 @@
   *
   *  - Encoding/decoding of unicode code points into/from utf-8 data
   *
+  *  - Counting, checking and copying long strings at all alignments, with a multi-byte character
+  *    at each position, and timing of these operations on typical strings.
+  *
   * Copyright (C) Sierra Wireless Inc.
   */
 
@@ -311,6 +314,84 @@ static void TestEncodeDecodeCodePoint(void)
 }
 
 
+static void TestLongStrings(void)
+{
+    // 'é' is a two byte character.
+    const char* typicalStrs[] = { "Hello, world",
+                                  "/legato/systems/current/apps/modemService/read-only/bin",
+                                  "Caf\xC3\xA9 cr\xC3\xA8me br\xC3\xBBl\xC3\xA9" "e" };
+    char srcBuffer[80];
+    char destBuffer[80];
+    size_t offset;
+    size_t length;
+    size_t multiBytePos;
+    size_t numBytesCopied;
+    size_t i;
+
+    // ASCII strings, optionally with one two-byte character, at every alignment and length.
+    for (offset = 0; offset < 8; offset++)
+    {
+        for (length = 0; length < 40; length++)
+        {
+            for (multiBytePos = 0; multiBytePos <= length; multiBytePos++)
+            {
+                char* strPtr = srcBuffer + offset;
+                bool hasMultiByte = (multiBytePos + 1 < length);
+
+                memset(strPtr, 'x', length);
+                strPtr[length] = '\0';
+                if (hasMultiByte)
+                {
+                    strPtr[multiBytePos] = TWO_CHAR_BYTE;
+                    strPtr[multiBytePos + 1] = CONT_BYTE;
+                }
+
+                LE_ASSERT(le_utf8_NumChars(strPtr) == (ssize_t)(length - hasMultiByte));
+                LE_ASSERT(le_utf8_IsFormatCorrect(strPtr));
+                LE_ASSERT(le_utf8_Copy(destBuffer, strPtr, sizeof(destBuffer), &numBytesCopied)
+                          == LE_OK);
+                LE_ASSERT((numBytesCopied == length) && (strcmp(destBuffer, strPtr) == 0));
+
+                // Truncate in the middle of the string: only whole characters are copied.
+                LE_ASSERT(le_utf8_Copy(destBuffer, strPtr, length / 2 + 1, &numBytesCopied)
+                          == (length > length / 2 ? LE_OVERFLOW : LE_OK));
+                LE_ASSERT(numBytesCopied ==
+                          ((hasMultiByte && multiBytePos == length / 2 - 1) ?
+                                length / 2 - 1 : length / 2));
+                LE_ASSERT(strncmp(destBuffer, strPtr, numBytesCopied) == 0);
+                LE_ASSERT(destBuffer[numBytesCopied] == '\0');
+
+                // A continuation byte without a lead byte is an error.
+                if (hasMultiByte)
+                {
+                    strPtr[multiBytePos] = 'x';
+                    LE_ASSERT(le_utf8_NumChars(strPtr) == LE_FORMAT_ERROR);
+                    LE_ASSERT(!le_utf8_IsFormatCorrect(strPtr));
+                }
+            }
+        }
+    }
+
+    // Time the operations on typical strings.
+    for (i = 0; i < NUM_ARRAY_MEMBERS(typicalStrs); i++)
+    {
+        le_clk_Time_t start = le_clk_GetRelativeTime();
+        int iteration;
+
+        for (iteration = 0; iteration < 100000; iteration++)
+        {
+            LE_ASSERT(le_utf8_NumChars(typicalStrs[i]) > 0);
+            LE_ASSERT(le_utf8_IsFormatCorrect(typicalStrs[i]));
+            LE_ASSERT(le_utf8_Copy(destBuffer, typicalStrs[i], sizeof(destBuffer), NULL) == LE_OK);
+        }
+
+        le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), start);
+        printf("100000 count/check/copy of '%s': %ld.%06ld s\n", typicalStrs[i],
+               (long)elapsed.sec, (long)elapsed.usec);
+    }
+}
+
+
 COMPONENT_INIT
 {
     size_t numBytesCopied;
@@ -640,6 +721,10 @@ COMPONENT_INIT
     TestEncodeDecodeCodePoint();
     printf("Completed testing encode/decode\n");
 
+    printf("Testing long strings\n");
+    TestLongStrings();
+    printf("Completed testing long strings\n");
+
     printf("*** Unit Test for le_utf8 module passed. ***\n");
     printf("\n");
 
@@ -16,6 +16,7 @@
 #include "pa_ecall.h"
 #include "pa_ecall_simu.h"
 #include "mdmCfgEntries.h"
+#include "asn1Msd.h"
 
 
 //--------------------------------------------------------------------------------------------------
@@ -927,6 +928,80 @@ static void Testle_ecall_LoadMsd
     le_ecall_Delete(testECallRef);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test: Encode an MSD with the pre-encoded vehicle fields template, and measure the encoding time.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_ecall_MsdTemplate
+(
+    void
+)
+{
+    msd_t       msd;
+    uint8_t     firstMsd[LE_ECALL_MSD_MAX_LEN] = {0};
+    uint8_t     otherMsd[LE_ECALL_MSD_MAX_LEN] = {0};
+    uint8_t     templateMsd[LE_ECALL_MSD_MAX_LEN] = {0};
+    int32_t     firstLen, otherLen, templateLen;
+    int         i;
+
+    LE_INFO("Start Testle_ecall_MsdTemplate");
+
+    memset(&msd, 0, sizeof(msd));
+    msd.version = 2;
+    msd.msdMsg.msdStruct.messageIdentifier = 1;
+    msd.msdMsg.msdStruct.control.automaticActivation = true;
+    msd.msdMsg.msdStruct.control.positionCanBeTrusted = true;
+    msd.msdMsg.msdStruct.control.vehType = MSD_VEHICLE_PASSENGER_M1;
+    memcpy(&msd.msdMsg.msdStruct.vehIdentificationNumber, "WM9VDSVDSYA123456",
+           sizeof(msd.msdMsg.msdStruct.vehIdentificationNumber));
+    msd.msdMsg.msdStruct.vehPropulsionStorageType.gasolineTankPresent = true;
+    msd.msdMsg.msdStruct.vehPropulsionStorageType.electricEnergyStorage = true;
+    msd.msdMsg.msdStruct.timestamp = 1367878452;
+    msd.msdMsg.msdStruct.vehLocation.latitude = 48898064;
+    msd.msdMsg.msdStruct.vehLocation.longitude = 2218092;
+    msd.msdMsg.msdStruct.vehDirection = 45;
+    msd.msdMsg.msdStruct.recentVehLocationN1Pres = true;
+    msd.msdMsg.msdStruct.recentVehLocationN1.latitudeDelta = 511;
+    msd.msdMsg.msdStruct.recentVehLocationN1.longitudeDelta = -512;
+
+    LE_ASSERT_OK(msd_EncodeVehicleTemplate(&msd));
+    LE_ASSERT((firstLen = msd_EncodeMsdMessage(&msd, firstMsd)) > 0);
+
+    // Changing a static field encodes the template again
+    msd.msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent = true;
+    LE_ASSERT((otherLen = msd_EncodeMsdMessage(&msd, otherMsd)) > 0);
+    LE_ASSERT((otherLen != firstLen) || (0 != memcmp(firstMsd, otherMsd, firstLen)));
+
+    // Back to the first static fields: the MSD is encoded as the first time
+    msd.msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent = false;
+    LE_ASSERT((templateLen = msd_EncodeMsdMessage(&msd, templateMsd)) == firstLen);
+    LE_ASSERT(0 == memcmp(firstMsd, templateMsd, firstLen));
+
+    // Only the dynamic fields differ between two MSD encoded with the template
+    msd.msdMsg.msdStruct.timestamp++;
+    LE_ASSERT((templateLen = msd_EncodeMsdMessage(&msd, templateMsd)) == firstLen);
+    LE_ASSERT(0 != memcmp(firstMsd, templateMsd, firstLen));
+
+    // An invalid VIN is still rejected
+    msd.msdMsg.msdStruct.vehIdentificationNumber.isowmi[0] = 'I';
+    LE_ASSERT(LE_FAULT == msd_EncodeMsdMessage(&msd, templateMsd));
+    memcpy(&msd.msdMsg.msdStruct.vehIdentificationNumber, "WM9VDSVDSYA123456",
+           sizeof(msd.msdMsg.msdStruct.vehIdentificationNumber));
+
+    // Encoding latency
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+    for (i = 0; i < 10000; i++)
+    {
+        msd.msdMsg.msdStruct.timestamp++;
+        LE_ASSERT(msd_EncodeMsdMessage(&msd, templateMsd) == firstLen);
+    }
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+    LE_INFO("MSD encoding: %d ns per MSD",
+            (int)(((uint64_t)duration.sec * 1000000000 + duration.usec * 1000) / i));
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Test: Create and start a manual eCall.
@@ -1073,6 +1148,8 @@ COMPONENT_INIT
     Testle_ecall_EraGlonassSettings();
     LE_INFO("======== LoadMsd Test  ========");
     Testle_ecall_LoadMsd();
+    LE_INFO("======== MsdTemplate Test  ========");
+    Testle_ecall_MsdTemplate();
     LE_INFO("======== StartManual Test  ========");
     Testle_ecall_StartManual();
     LE_INFO("======== StartTest Test  ========");
@@ -1611,6 +1611,79 @@ static le_result_t TestDecodePdu
     return LE_OK;
 }
 
+/**
+ * Messages reassembled by smsPdu_DecodeBatch()
+ */
+static int ConcatMessageCount;
+static smsPdu_ConcatMessage_t LastConcatMessage;
+
+static void ConcatHandler
+(
+    const smsPdu_ConcatMessage_t* messagePtr,
+    void* contextPtr
+)
+{
+    ConcatMessageCount++;
+    LastConcatMessage = *messagePtr;
+}
+
+static void FillPdu
+(
+    const PduReceived_t* receivedPtr,
+    pa_sms_Pdu_t* pduPtr
+)
+{
+    memset(pduPtr, 0, sizeof(pa_sms_Pdu_t));
+    pduPtr->protocol = receivedPtr->proto;
+    memcpy(pduPtr->data, receivedPtr->data, receivedPtr->length);
+    pduPtr->dataLen = receivedPtr->length;
+}
+
+static le_result_t TestDecodeBatch
+(
+    void
+)
+{
+    pa_sms_Pdu_t pdu[3];
+    pa_sms_Message_t message[3];
+    le_result_t result[3];
+
+    ConcatMessageCount = 0;
+
+    // Second part of a two parts message alone: nothing to reassemble yet
+    FillPdu(&PduReceivedDb[5], &pdu[0]);
+    LE_ASSERT_OK(smsPdu_DecodeBatch(pdu, 1, true, message, result, ConcatHandler, NULL));
+    LE_ASSERT(LE_UNSUPPORTED == result[0]);
+    LE_ASSERT(0 == ConcatMessageCount);
+
+    // Both parts, with the second one already cached, and a single part message
+    FillPdu(&PduReceivedDb[4], &pdu[0]);
+    FillPdu(&PduReceivedDb[5], &pdu[1]);
+    FillPdu(&PduReceivedDb[0], &pdu[2]);
+    LE_ASSERT_OK(smsPdu_DecodeBatch(pdu, 3, true, message, result, ConcatHandler, NULL));
+    LE_ASSERT(LE_UNSUPPORTED == result[0]);
+    LE_ASSERT(LE_UNSUPPORTED == result[1]);
+    LE_ASSERT_OK(result[2]);
+    LE_ASSERT(PA_SMS_DELIVER == message[2].type);
+    LE_ASSERT(PduReceivedDb[0].expected.message.smsDeliver.dataLen == message[2].smsDeliver.dataLen);
+
+    LE_ASSERT(1 == ConcatMessageCount);
+    LE_ASSERT(0 == strcmp(LastConcatMessage.oa, "Orange"));
+    LE_ASSERT(LE_SMS_FORMAT_TEXT == LastConcatMessage.format);
+    LE_ASSERT(0x0D == LastConcatMessage.ref);
+    LE_ASSERT(2 == LastConcatMessage.segmentCount);
+    LE_ASSERT(161 == LastConcatMessage.dataLen);
+    LE_ASSERT(0 == memcmp(LastConcatMessage.data, "Orange:Profitez", 15));
+    LE_ASSERT(0 == memcmp(&LastConcatMessage.data[153], "uscrite ", 8));
+
+    // The reassembled segments are no longer cached
+    LE_ASSERT_OK(smsPdu_DecodeBatch(pdu, 1, true, message, result, ConcatHandler, NULL));
+    LE_ASSERT(LE_UNSUPPORTED == result[0]);
+    LE_ASSERT(1 == ConcatMessageCount);
+
+    return LE_OK;
+}
+
 static le_result_t TestEncodePdu
 (
     void
@@ -2114,5 +2187,8 @@ void testle_sms_SmsPduTest
     LE_INFO("Test DecodePdu started");
     LE_ASSERT_OK(TestDecodePdu());
 
+    LE_INFO("Test DecodeBatch started");
+    LE_ASSERT_OK(TestDecodeBatch());
+
     LE_INFO("smsPduTest SUCCESS");
 }
@@ -541,6 +541,28 @@ static void testle_port_SetCommandMode
     LE_INFO("AtServer device reference is %p", deviceRef);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Testing of le_port_GetLineCounters() API.
+ */
+//--------------------------------------------------------------------------------------------------
+static void testle_port_GetLineCounters
+(
+    void
+)
+{
+    uint32_t rxCount, txCount, overrunCount, frameErrCount, parityErrCount;
+
+    LE_ASSERT(LE_BAD_PARAMETER == le_port_GetLineCounters(NULL, &rxCount, &txCount,
+                                                          &overrunCount, &frameErrCount,
+                                                          &parityErrCount));
+
+    // The test device only has unix socket links.
+    LE_ASSERT(LE_UNSUPPORTED == le_port_GetLineCounters(DeviceRef, &rxCount, &txCount,
+                                                        &overrunCount, &frameErrCount,
+                                                        &parityErrCount));
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Testing of le_port_Release() API.
@@ -584,6 +606,9 @@ static void* UnitTestInit
     LE_INFO("======== Test for le_port_SetCommandMode() API ========");
     testle_port_SetCommandMode();
 
+    LE_INFO("======== Test for le_port_GetLineCounters() API ========");
+    testle_port_GetLineCounters();
+
     LE_INFO("======== Test for le_port_Release() API ========");
     testle_port_Release();
 
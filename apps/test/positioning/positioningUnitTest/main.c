@@ -15,6 +15,13 @@
 //--------------------------------------------------------------------------------------------------
 static le_pos_MovementHandlerRef_t  NavigationHandlerRef;
 static le_pos_MovementHandlerRef_t  FiftyNavigationHandlerRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch Handler Reference
+ */
+//--------------------------------------------------------------------------------------------------
+static le_pos_BatchHandlerRef_t     BatchHandlerRef;
 //--------------------------------------------------------------------------------------------------
 /**
  * Server Service Reference
@@ -116,6 +123,7 @@ static le_sem_Ref_t                 ThreadSemaphore;
 static le_sem_Ref_t                 InitSemaphore;
 static le_clk_Time_t                TimeToWait = { 5, 0 };
 static le_thread_Ref_t              NavigationThreadRef;
+static le_thread_Ref_t              BatchThreadRef;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -1028,6 +1036,124 @@ static void Testle_pos_RemoveMovementHandler
     le_thread_Cancel(NavigationThreadRef);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler function for batches of position fixes.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void BatchHandler
+(
+    uint32_t firstSeq,
+    uint32_t count,
+    void* contextPtr
+)
+{
+    le_pos_Fix_t fixes[LE_POS_BATCH_MAX_FIXES];
+    size_t fixesSize = LE_POS_BATCH_MAX_FIXES;
+
+    LE_ASSERT(2 == count);
+
+    // test for NULL pointers
+    LE_ASSERT(LE_BAD_PARAMETER == le_pos_GetFixes(firstSeq, NULL, &fixesSize));
+    LE_ASSERT(LE_BAD_PARAMETER == le_pos_GetFixes(firstSeq, fixes, NULL));
+
+    // test for Normal Behaviour
+    LE_ASSERT_OK(le_pos_GetFixes(firstSeq, fixes, &fixesSize));
+    LE_ASSERT(2 == fixesSize);
+    LE_ASSERT(firstSeq == fixes[0].seq);
+    LE_ASSERT((firstSeq + 1) == fixes[1].seq);
+
+    // Only the last fix
+    fixesSize = LE_POS_BATCH_MAX_FIXES;
+    LE_ASSERT_OK(le_pos_GetFixes(firstSeq + 1, fixes, &fixesSize));
+    LE_ASSERT(1 == fixesSize);
+    LE_ASSERT((firstSeq + 1) == fixes[0].seq);
+
+    // No fix yet
+    fixesSize = LE_POS_BATCH_MAX_FIXES;
+    LE_ASSERT(LE_NOT_FOUND == le_pos_GetFixes(firstSeq + 2, fixes, &fixesSize));
+    LE_ASSERT(0 == fixesSize);
+
+    le_sem_Post(ThreadSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test: Add Batch Handler
+ *
+*/
+//--------------------------------------------------------------------------------------------------
+static void* BatchThread
+(
+    void* context
+)
+{
+    // test for NULL
+    LE_ASSERT(NULL == le_pos_AddBatchHandler(2, 0, NULL, NULL));
+
+    // test for invalid parameters
+    LE_ASSERT(NULL == le_pos_AddBatchHandler(0, 0, BatchHandler, NULL));
+    LE_ASSERT(NULL == le_pos_AddBatchHandler(LE_POS_BATCH_MAX_FIXES + 1, 0, BatchHandler, NULL));
+
+    // test for Normal Behaviour: report the fixes two by two
+    BatchHandlerRef = le_pos_AddBatchHandler(2, 0, BatchHandler, NULL);
+    LE_ASSERT(NULL != BatchHandlerRef);
+
+    le_sem_Post(ThreadSemaphore);
+    le_event_RunLoop();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test: this function handles the remove batch handler
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemoveBatchHandler
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    le_pos_RemoveBatchHandler(BatchHandlerRef);
+    BatchHandlerRef = NULL;
+
+    // Semaphore is used to synchronize the task execution with the core test
+    le_sem_Post(ThreadSemaphore);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tested API: le_pos_AddBatchHandler(), le_pos_GetFixes(), le_pos_RemoveBatchHandler()
+ *
+ * Verify that the fixes are reported by batches
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_pos_BatchHandler
+(
+    void
+)
+{
+    BatchThreadRef = le_thread_Create("BatchThread", BatchThread, NULL);
+    le_thread_Start(BatchThreadRef);
+
+    // Wait that the task has started before continuing the test
+    SynchTest();
+
+    // The handler is called once every two fixes
+    le_gnssSimu_ReportEvent();
+    LE_ASSERT(LE_TIMEOUT == le_sem_WaitWithTimeOut(ThreadSemaphore, (le_clk_Time_t){ 1, 0 }));
+    le_gnssSimu_ReportEvent();
+    SynchTest();
+
+    le_event_QueueFunctionToThread(BatchThreadRef, RemoveBatchHandler, NULL, NULL);
+    SynchTest();
+
+    le_thread_Cancel(BatchThreadRef);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * UnitTestInit thread: this function initializes the test and runs an eventLoop
@@ -1041,6 +1167,7 @@ static void* UnitTestInit
 {
     Testle_pos_AddMovementHandler();
     Testle_pos_RemoveMovementHandler();
+    Testle_pos_BatchHandler();
     le_sem_Post(InitSemaphore);
     le_event_RunLoop();
 }
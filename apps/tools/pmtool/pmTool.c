@@ -91,6 +91,7 @@ static void PrintHelp
                 pmtool bootReason timer\n\
                 pmtool bootReason adc <adcNum>\n\
                 pmtool query\n\
+                pmtool stats\n\
             \n\
             DESCRIPTION:\n\
                 pmtool help\n\
@@ -127,6 +128,10 @@ static void PrintHelp
             \n\
                 pmtool query\n\
                   - Query the current ultra-low power manager firmware version.\n\
+            \n\
+                pmtool stats\n\
+                  - Print, for each wakeup source, the client pid, whether it is held, the\n\
+                    number of times it has been acquired and the total time it has been held.\n\
             \n\
                 For all bootReason subcommands, the exit code of the program is 0 if the given\n\
                 boot source was the reason the system booted or 2 otherwise.\n\
@@ -309,6 +314,37 @@ static void QueryVersion
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print the statistics of all wakeup sources.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrintStats
+(
+    void
+)
+{
+    char name[LE_PM_WAKEUP_SOURCE_NAME_LEN + 1];
+    int32_t pid;
+    bool isHeld;
+    uint32_t acquireCount;
+    uint64_t heldTimeMs;
+    uint32_t index = 0;
+
+    printf("%-8s %-4s %10s %14s  %s\n", "PID", "HELD", "ACQUIRED", "HELD TIME (ms)", "NAME");
+
+    while (le_pm_GetWakeupSourceStats(index, name, sizeof(name), &pid, &isHeld, &acquireCount,
+                                      &heldTimeMs) != LE_OUT_OF_RANGE)
+    {
+        printf("%-8" PRId32 " %-4s %10" PRIu32 " %14" PRIu64 "  %s\n",
+               pid, isHeld ? "yes" : "no", acquireCount, heldTimeMs, name);
+        index++;
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initiate shutdown of MDM.
@@ -710,6 +746,10 @@ static void SetCommandHandler
     {
         CommandHandler = QueryVersion;
     }
+    else if (strcmp(argPtr, "stats") == 0)
+    {
+        CommandHandler = PrintStats;
+    }
     else
     {
         fprintf(stderr, "Unknown command: %s.\n", argPtr);
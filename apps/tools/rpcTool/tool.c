@@ -154,8 +154,8 @@ static void HandleHelpRequest
         "            for the specified system.\n"
         "\n"
         "    rpctool get link <systemName>\n"
-        "            Retrieves the link-name, link-parameters, and status\n"
-        "            for the specified system-name.\n"
+        "            Retrieves the link-name, link-parameters, status, message\n"
+        "            counters, and health for the specified system-name.\n"
         "\n"
         "    rpctool reset link <systemName>\n"
         "            Resets the RPC link for the specifed system-name.\n"
@@ -726,6 +726,43 @@ COMPONENT_INIT
                                strBuffer,
                                linkName,
                                parameters);
+
+                        uint32_t messages;
+                        uint32_t writes;
+                        uint64_t bytes;
+                        if (le_rpc_GetSystemLinkCounters(SystemNameArg,
+                                                         &messages,
+                                                         &writes,
+                                                         &bytes) == LE_OK)
+                        {
+                            printf("    Messages Sent: %" PRIu32 " in %" PRIu32 " writes"
+                                   " (%" PRIu64 " bytes)\n",
+                                   messages,
+                                   writes,
+                                   bytes);
+                        }
+
+                        uint8_t score;
+                        uint32_t roundTripTime;
+                        uint32_t keepAliveTimeout;
+                        uint32_t keepAlivesSent;
+                        uint32_t keepAlivesSkipped;
+                        if (le_rpc_GetSystemLinkHealth(SystemNameArg,
+                                                       &score,
+                                                       &roundTripTime,
+                                                       &keepAliveTimeout,
+                                                       &keepAlivesSent,
+                                                       &keepAlivesSkipped) == LE_OK)
+                        {
+                            printf("    Health: %" PRIu8 "/100, Round-Trip Time: %" PRIu32 " ms,"
+                                   " Keep-Alive Time-out: %" PRIu32 " ms\n"
+                                   "    Keep-Alives Sent: %" PRIu32 " (%" PRIu32 " skipped)\n",
+                                   score,
+                                   roundTripTime,
+                                   keepAliveTimeout,
+                                   keepAlivesSent,
+                                   keepAlivesSkipped);
+                        }
                         printf("\n================================================"
                                "================================================\n");
                     }
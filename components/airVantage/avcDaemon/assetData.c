@@ -70,6 +70,18 @@
 #define MAX_CBOR_BUFFER_NUMBYTES 1024
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * zlib window size (as a power of two) and memory level used to compress time series.  A 1 KiB
+ * window covers a whole MAX_CBOR_BUFFER_NUMBYTES stream, so this compresses as well as the
+ * default 32 KiB window, with about 12 KiB of compressor state instead of more than 256 KiB
+ * allocated and initialized on each push.
+ */
+//--------------------------------------------------------------------------------------------------
+#define TIME_SERIES_DEFLATE_WINDOW_BITS 10
+#define TIME_SERIES_DEFLATE_MEM_LEVEL   4
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Checks the return value from the tinyCBOR encoder and returns from function if an error is found.
@@ -121,6 +133,20 @@ typedef enum
 AccessBitMask_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key of an instance in InstanceIndex, or of a field in FieldIndex.  The key is stored in the
+ * instance or field it indexes.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const void* parentPtr;      ///< Asset data block of an instance, or instance of a field
+    int id;                     ///< Instance id or field id
+}
+ResourceKey_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Data associated with an asset with a particular id
@@ -153,6 +179,9 @@ typedef struct le_avdata_AssetInstance
     AssetData_t* assetDataPtr;   ///< Back reference to asset data containing this instance
     le_dls_List_t fieldList;     ///< List of fields for this instance
     le_dls_Link_t link;          ///< For adding to the asset instance list
+    ResourceKey_t indexKey;      ///< Key of this instance in InstanceIndex
+    bool isNotifyPending;        ///< Is this instance in NotifyPendingList?
+    le_dls_Link_t notifyLink;    ///< For adding to NotifyPendingList
 }
 InstanceData_t;
 
@@ -183,6 +212,10 @@ typedef struct
     CborEncoder streamRef;          ///< CBOR encoded stream reference.
     CborEncoder mapRef;             ///< CBOR encoded map reference.
     CborEncoder sampleRef;          ///< CBOR encoded sample data reference.
+
+    CborEncoder emptyStreamRef;     ///< Stream reference right after the header was encoded.
+    CborEncoder emptyMapRef;        ///< Map reference right after the header was encoded.
+    CborEncoder emptySampleRef;     ///< Sample data reference right after the header was encoded.
 #endif
 }
 TimeSeriesData_t;
@@ -201,6 +234,7 @@ typedef struct
     DataTypes_t type;
     AccessBitMask_t access;
     bool isObserve;
+    bool isNotifyPending;        ///< Has the value changed since the last notification?
     pa_avc_LWM2MOperationDataRef_t readCallBackOpRef;
     uint8_t tokenLength;
     uint8_t token[8];
@@ -215,6 +249,7 @@ typedef struct
     TimeSeriesData_t* timeSeriesPtr;
 
     le_dls_Link_t link;          ///< For adding to the field list
+    ResourceKey_t indexKey;      ///< Key of this field in FieldIndex
 }
 FieldData_t;
 
@@ -327,6 +362,24 @@ static le_hashmap_Ref_t AssetMap = NULL;
 static le_hashmap_Ref_t AssetMapByName = NULL;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps (asset data block, instanceId) to an instance, so that LWM2M paths can be resolved
+ * without walking the instance lists.  Initialized in assetData_Init().
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t InstanceIndex = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps (instance, fieldId) to a field, so that LWM2M paths can be resolved without walking the
+ * field lists.  Initialized in assetData_Init().
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t FieldIndex = NULL;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Used to delay reporting REG_UPDATE, so that we don't generate too much message traffic.
@@ -335,6 +388,32 @@ static le_hashmap_Ref_t AssetMapByName = NULL;
 static le_timer_Ref_t RegUpdateTimerRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum period between observe notifications, in milliseconds.  Resource changes made within
+ * this period are coalesced, and sent in a single notification per instance.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NOTIFY_MIN_PERIOD_MS    1000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Used to delay sending observe notifications, so that changes to several resources of an object
+ * can be reported together.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_timer_Ref_t NotifyTimerRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Instances with resource changes waiting for NotifyTimerRef to expire.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t NotifyPendingList = LE_DLS_LIST_INIT;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Time series data memory pool.  Initialized in assetData_Init().
@@ -394,14 +473,9 @@ static bool IsRegUpdatePending = false;
  * Declare this function here, until the QMI functions are moved out of this file.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t WriteNotifyObjectToTLV
+static void NotifyTimerHandler
 (
-    assetData_AssetDataRef_t assetRef,          ///< [IN] Asset to use
-    int instanceId,                             ///< [IN] Instance that has a changed resource
-    int fieldId,                                ///< [IN] The resource which changed
-    uint8_t* bufPtr,                            ///< [OUT] Buffer for writing the TLV list
-    size_t bufNumBytes,                         ///< [IN] Size of buffer
-    size_t* numBytesWrittenPtr                  ///< [OUT] # bytes written to buffer.
+    le_timer_Ref_t timerRef    ///< This timer has expired
 );
 
 //--------------------------------------------------------------------------------------------------
@@ -562,6 +636,7 @@ static void InitDefaultFieldData
 )
 {
     fieldDataPtr->isObserve = false;
+    fieldDataPtr->isNotifyPending = false;
     fieldDataPtr->readCallBackOpRef = NULL;
 
     fieldDataPtr->timeSeriesPtr = NULL;
@@ -591,6 +666,58 @@ static void InitDefaultFieldData
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hash function for the keys of InstanceIndex and FieldIndex.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t HashResourceKey
+(
+    const void* keyPtr
+)
+{
+    const ResourceKey_t* resourceKeyPtr = keyPtr;
+
+    return ((size_t)resourceKeyPtr->parentPtr >> 3) * 31 + (size_t)resourceKeyPtr->id;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Equality function for the keys of InstanceIndex and FieldIndex.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool EqualsResourceKey
+(
+    const void* firstKeyPtr,
+    const void* secondKeyPtr
+)
+{
+    const ResourceKey_t* firstPtr = firstKeyPtr;
+    const ResourceKey_t* secondPtr = secondKeyPtr;
+
+    return (firstPtr->parentPtr == secondPtr->parentPtr) && (firstPtr->id == secondPtr->id);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a field of an instance to the FieldIndex.  The field id must already be set.
+ */
+//--------------------------------------------------------------------------------------------------
+static void IndexField
+(
+    InstanceData_t* assetInstPtr,
+    FieldData_t* fieldDataPtr
+)
+{
+    fieldDataPtr->indexKey.parentPtr = assetInstPtr;
+    fieldDataPtr->indexKey.id = fieldDataPtr->fieldId;
+
+    le_hashmap_Put(FieldIndex, &fieldDataPtr->indexKey, fieldDataPtr);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Read field model from configDB, and fill in field data block
@@ -719,6 +846,7 @@ static le_result_t CreateInstanceFromModel
 
         // Field read okay; add it to the list.
         le_dls_Queue(&assetInstPtr->fieldList, &fieldDataPtr->link);
+        IndexField(assetInstPtr, fieldDataPtr);
 
     } while ( le_cfg_GoToNextSibling(assetCfg) == LE_OK );
 
@@ -802,6 +930,7 @@ static void AddFieldFromData
     InitDefaultFieldData(fieldDataPtr);
 
     le_dls_Queue(&assetInstPtr->fieldList, &fieldDataPtr->link);
+    IndexField(assetInstPtr, fieldDataPtr);
 }
 
 
@@ -1127,28 +1256,16 @@ static le_result_t GetInstanceFromAssetData
     InstanceData_t** instanceDataPtrPtr   ///< [OUT]
 )
 {
-    InstanceData_t* assetInstancePtr;
-    le_dls_Link_t* linkPtr;
+    ResourceKey_t key = { .parentPtr = assetDataPtr, .id = instanceId };
+    InstanceData_t* assetInstancePtr = le_hashmap_Get(InstanceIndex, &key);
 
-    // Get the start of the instance list
-    linkPtr = le_dls_Peek(&assetDataPtr->instanceList);
-
-    // Loop through the asset instances
-    while ( linkPtr != NULL )
+    if ( assetInstancePtr == NULL )
     {
-        assetInstancePtr = CONTAINER_OF(linkPtr, InstanceData_t, link);
-        //LE_PRINT_VALUE("%i", assetInstancePtr->instanceId);
-
-        if ( assetInstancePtr->instanceId == instanceId )
-        {
-            *instanceDataPtrPtr = assetInstancePtr;
-            return LE_OK;
-        }
-
-        linkPtr = le_dls_PeekNext(&assetDataPtr->instanceList, linkPtr);
+        return LE_NOT_FOUND;
     }
 
-    return LE_NOT_FOUND;
+    *instanceDataPtrPtr = assetInstancePtr;
+    return LE_OK;
 }
 
 
@@ -1168,28 +1285,16 @@ static le_result_t GetFieldFromInstance
     FieldData_t** fieldDataPtrPtr   ///< [OUT]
 )
 {
-    FieldData_t* fieldDataPtr;
-    le_dls_Link_t* fieldLinkPtr;
-
-    // Get the start of the field list
-    fieldLinkPtr = le_dls_Peek(&instanceDataPtr->fieldList);
+    ResourceKey_t key = { .parentPtr = instanceDataPtr, .id = fieldId };
+    FieldData_t* fieldDataPtr = le_hashmap_Get(FieldIndex, &key);
 
-    // Loop through the fields
-    while ( fieldLinkPtr != NULL )
+    if ( fieldDataPtr == NULL )
     {
-        fieldDataPtr = CONTAINER_OF(fieldLinkPtr, FieldData_t, link);
-        //LE_PRINT_VALUE("%i", fieldDataPtr->fieldId);
-
-        if ( fieldDataPtr->fieldId == fieldId )
-        {
-            *fieldDataPtrPtr = fieldDataPtr;
-            return LE_OK;
-        }
-
-        fieldLinkPtr = le_dls_PeekNext(&instanceDataPtr->fieldList, fieldLinkPtr);
+        return LE_NOT_FOUND;
     }
 
-    return LE_NOT_FOUND;
+    *fieldDataPtrPtr = fieldDataPtr;
+    return LE_OK;
 }
 
 
@@ -1414,6 +1519,12 @@ static le_result_t StartTimeSeries
     fieldDataPtr->timeSeriesPtr->factor = factor;
     fieldDataPtr->timeSeriesPtr->timeStampFactor = timeStampFactor;
 
+    // Remember where the samples start, so that the time series can be restarted after a push
+    // without encoding the header again.
+    fieldDataPtr->timeSeriesPtr->emptyStreamRef = fieldDataPtr->timeSeriesPtr->streamRef;
+    fieldDataPtr->timeSeriesPtr->emptyMapRef = fieldDataPtr->timeSeriesPtr->mapRef;
+    fieldDataPtr->timeSeriesPtr->emptySampleRef = fieldDataPtr->timeSeriesPtr->sampleRef;
+
     return result;
 
 #else
@@ -1470,6 +1581,28 @@ static le_result_t StopTimeSeries
 }
 
 
+#if FEATURE_TIMESERIES
+//--------------------------------------------------------------------------------------------------
+/**
+ * Discard the samples of a time series, keeping its buffer and its header.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RestartTimeSeries
+(
+    TimeSeriesData_t* timeSeriesPtr             ///< [IN] Time series to restart
+)
+{
+    timeSeriesPtr->streamRef = timeSeriesPtr->emptyStreamRef;
+    timeSeriesPtr->mapRef = timeSeriesPtr->emptyMapRef;
+    timeSeriesPtr->sampleRef = timeSeriesPtr->emptySampleRef;
+
+    timeSeriesPtr->numElements = 0;
+    timeSeriesPtr->prevTimeStamp = 0;
+    timeSeriesPtr->prevFloatValue = 0;
+}
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Compress the accumulated CBOR encoded time series data and send it to server.
@@ -1500,9 +1633,7 @@ static le_result_t PushTimeSeries
     z_stream defstream;
     pa_avc_LWM2MOperationDataRef_t opRef;
     CborError err;
-
-    double dataFactor;
-    double timeStampFactor;
+    int zResult;
 
     result = GetFieldFromInstance(instanceRef, fieldId, &fieldDataPtr);
     if ( result != LE_OK )
@@ -1524,10 +1655,6 @@ static le_result_t PushTimeSeries
         return LE_UNAVAILABLE;
     }
 
-    // Remember the factors used.
-    dataFactor = fieldDataPtr->timeSeriesPtr->factor;
-    timeStampFactor = fieldDataPtr->timeSeriesPtr->timeStampFactor;
-
     // Close the map i.e done with entering in to sample array.
     err = cbor_encoder_close_container_checked(&fieldDataPtr->timeSeriesPtr->mapRef,
                                                &fieldDataPtr->timeSeriesPtr->sampleRef);
@@ -1557,10 +1684,26 @@ static le_result_t PushTimeSeries
     defstream.avail_out = (uInt)sizeof(compressedBuf);
     defstream.next_out = (Bytef *)compressedBuf;
 
-    deflateInit(&defstream, Z_BEST_COMPRESSION);
-    deflate(&defstream, Z_FINISH);
+    if (deflateInit2(&defstream,
+                     Z_BEST_COMPRESSION,
+                     Z_DEFLATED,
+                     TIME_SERIES_DEFLATE_WINDOW_BITS,
+                     TIME_SERIES_DEFLATE_MEM_LEVEL,
+                     Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        LE_ERROR("Failed to initialize compression.");
+        return LE_FAULT;
+    }
+
+    zResult = deflate(&defstream, Z_FINISH);
     deflateEnd(&defstream);
 
+    if (zResult != Z_STREAM_END)
+    {
+        LE_ERROR("Failed to compress time series (%d).", zResult);
+        return LE_FAULT;
+    }
+
     compressBufLength = defstream.total_out;
 
     //LE_DEBUG("Compressed size is: %lu\n", compressBufLength);
@@ -1578,16 +1721,14 @@ static le_result_t PushTimeSeries
 
     pa_avc_NotifyChange(opRef, compressedBuf, compressBufLength);
 
-    // Stop time series.
-    result = StopTimeSeries(instanceRef, fieldId);
-
-    // Restart time series if asked.
-    if (result == LE_OK && isRestartTimeSeries)
+    // Restart time series if asked, otherwise stop it.
+    if (isRestartTimeSeries)
     {
-        result = StartTimeSeries(instanceRef, fieldId, dataFactor, timeStampFactor);
+        RestartTimeSeries(fieldDataPtr->timeSeriesPtr);
+        return LE_OK;
     }
 
-    return result;
+    return StopTimeSeries(instanceRef, fieldId);
 
 #else
     LE_ERROR("Time series not supported.");
@@ -2094,6 +2235,37 @@ static le_result_t GetInt
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue an observe notification for a changed field.  The notification is sent when
+ * NotifyTimerRef expires, together with those of any other fields of the instance that change
+ * in the meantime.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueNotification
+(
+    InstanceData_t* instancePtr,    ///< [IN] Instance containing the changed field
+    FieldData_t* fieldDataPtr       ///< [IN] The changed field
+)
+{
+    fieldDataPtr->isNotifyPending = true;
+
+    if (!instancePtr->isNotifyPending)
+    {
+        instancePtr->isNotifyPending = true;
+        instancePtr->notifyLink = LE_DLS_LINK_INIT;
+        le_dls_Queue(&NotifyPendingList, &instancePtr->notifyLink);
+    }
+
+    // Don't restart a running timer, so that a steady stream of changes is still reported once
+    // per period.
+    if (!le_timer_IsRunning(NotifyTimerRef))
+    {
+        le_timer_Start(NotifyTimerRef);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get the float value for the specified field
@@ -2163,7 +2335,6 @@ static le_result_t SetInt
     uint8_t valueData[256+1];  // +1 for null byte, if storing a string
     size_t bytesWritten;
     int prevValue;
-    pa_avc_LWM2MOperationDataRef_t opRef;
 
     result = GetFieldFromInstance(instanceRef, fieldId, &fieldDataPtr);
 
@@ -2203,47 +2374,17 @@ static le_result_t SetInt
     }
 
     // If time series is enabled add the data to time series history and get out. If time series is
-    // not enabled send the observe notification right away.
+    // not enabled queue the observe notification.
     if (fieldDataPtr->timeSeriesPtr != NULL)
     {
         return TimeSeriesAddEntry(fieldDataPtr, utcMilliSec);
     }
 
-    // Notify the server if observe is enabled and the value is changed.
-    // The server sends notify on entire object, so we need to send the TLV of entire
-    // object but include only the resource that changed.
+    // Queue a notification if observe is enabled and the value is changed.  Changes made within
+    // the notification period are sent together, in one notification per instance.
     if (fieldDataPtr->isObserve && prevValue != value && isClient == true)
     {
-        assetData_AssetDataRef_t assetRef;
-        result = assetData_GetAssetRefById(instanceRef->assetDataPtr->appName,
-                                           instanceRef->assetDataPtr->assetId,
-                                           &assetRef);
-
-        if ( result == LE_OK)
-        {
-            result = WriteNotifyObjectToTLV(assetRef,
-                                            instanceRef->instanceId,
-                                            fieldId,
-                                            valueData,
-                                            sizeof(valueData),
-                                            &bytesWritten);
-            if ( result != LE_OK )
-            {
-                LE_ERROR("Failed to send lwm2m notification.");
-                return LE_FAULT;
-            }
-
-            opRef = pa_avc_CreateOpData(instanceRef->assetDataPtr->appName,
-                                        instanceRef->assetDataPtr->assetId,
-                                        -1,
-                                        -1,
-                                        PA_AVC_OPTYPE_NOTIFY,
-                                        TLV_ENCODING,
-                                        fieldDataPtr->token,
-                                        fieldDataPtr->tokenLength);
-
-            pa_avc_NotifyChange(opRef, valueData, bytesWritten);
-        }
+        QueueNotification(instanceRef, fieldDataPtr);
     }
 
     return LE_OK;
@@ -2278,7 +2419,6 @@ static le_result_t SetFloat
     uint8_t valueData[256+1];  // +1 for null byte, if storing a string
     size_t bytesWritten;
     float prevValue;
-    pa_avc_LWM2MOperationDataRef_t opRef;
 
     result = GetFieldFromInstance(instanceRef, fieldId, &fieldDataPtr);
     if ( result != LE_OK )
@@ -2317,47 +2457,17 @@ static le_result_t SetFloat
     }
 
     // If time series is enabled add the data to time series history and get out. If time series is
-    // not enabled send the observe notification right away.
+    // not enabled queue the observe notification.
     if (fieldDataPtr->timeSeriesPtr != NULL)
     {
         return TimeSeriesAddEntry(fieldDataPtr, utcMilliSec);
     }
 
-    // Notify the server if observe is enabled and the value is changed.
-    // The server sends notify on entire object, so we need to send the TLV of entire
-    // object but include only the resource that changed.
+    // Queue a notification if observe is enabled and the value is changed.  Changes made within
+    // the notification period are sent together, in one notification per instance.
     if (fieldDataPtr->isObserve && prevValue != value && isClient == true)
     {
-        assetData_AssetDataRef_t assetRef;
-        result = assetData_GetAssetRefById(instanceRef->assetDataPtr->appName,
-                                           instanceRef->assetDataPtr->assetId,
-                                           &assetRef);
-
-        if ( result == LE_OK)
-        {
-            result = WriteNotifyObjectToTLV(assetRef,
-                                            instanceRef->instanceId,
-                                            fieldId,
-                                            valueData,
-                                            sizeof(valueData),
-                                            &bytesWritten);
-            if ( result != LE_OK )
-            {
-                LE_ERROR("Failed to send lwm2m notification.");
-                return LE_FAULT;
-            }
-
-            opRef = pa_avc_CreateOpData(instanceRef->assetDataPtr->appName,
-                                        instanceRef->assetDataPtr->assetId,
-                                        -1,
-                                        -1,
-                                        PA_AVC_OPTYPE_NOTIFY,
-                                        TLV_ENCODING,
-                                        fieldDataPtr->token,
-                                        fieldDataPtr->tokenLength);
-
-            pa_avc_NotifyChange(opRef, valueData, bytesWritten);
-        }
+        QueueNotification(instanceRef, fieldDataPtr);
     }
 
     return LE_OK;
@@ -2433,7 +2543,6 @@ static le_result_t SetBool
     uint8_t valueData[256+1];  // +1 for null byte, if storing a string
     size_t bytesWritten;
     bool prevValue;
-    pa_avc_LWM2MOperationDataRef_t opRef;
 
     result = GetFieldFromInstance(instanceRef, fieldId, &fieldDataPtr);
     if ( result != LE_OK )
@@ -2472,47 +2581,17 @@ static le_result_t SetBool
     }
 
     // If time series is enabled add the data to time series history and get out. If time series is
-    // not enabled send the observe notification right away.
+    // not enabled queue the observe notification.
     if (fieldDataPtr->timeSeriesPtr != NULL)
     {
         return TimeSeriesAddEntry(fieldDataPtr, utcMilliSec);
     }
 
-    // Notify the server if observe is enabled and the value is changed.
-    // The server sends notify on entire object, so we need to send the TLV of entire
-    // object but include only the resource that changed.
+    // Queue a notification if observe is enabled and the value is changed.  Changes made within
+    // the notification period are sent together, in one notification per instance.
     if (fieldDataPtr->isObserve && prevValue != value && isClient == true)
     {
-        assetData_AssetDataRef_t assetRef;
-        result = assetData_GetAssetRefById(instanceRef->assetDataPtr->appName,
-                                           instanceRef->assetDataPtr->assetId,
-                                           &assetRef);
-
-        if ( result == LE_OK)
-        {
-            result = WriteNotifyObjectToTLV(assetRef,
-                                            instanceRef->instanceId,
-                                            fieldId,
-                                            valueData,
-                                            sizeof(valueData),
-                                            &bytesWritten);
-            if ( result != LE_OK )
-            {
-                LE_ERROR("Failed to send lwm2m notification.");
-                return LE_FAULT;
-            }
-
-            opRef = pa_avc_CreateOpData(instanceRef->assetDataPtr->appName,
-                                        instanceRef->assetDataPtr->assetId,
-                                        -1,
-                                        -1,
-                                        PA_AVC_OPTYPE_NOTIFY,
-                                        TLV_ENCODING,
-                                        fieldDataPtr->token,
-                                        fieldDataPtr->tokenLength);
-
-            pa_avc_NotifyChange(opRef, valueData, bytesWritten);
-        }
+        QueueNotification(instanceRef, fieldDataPtr);
     }
 
     return LE_OK;
@@ -2591,7 +2670,6 @@ static le_result_t SetString
     uint8_t valueData[256+1];  // +1 for null byte, if storing a string
     size_t bytesWritten;
     char prevStr[STRING_VALUE_NUMBYTES];
-    pa_avc_LWM2MOperationDataRef_t opRef;
 
     result = GetFieldFromInstance(instanceRef, fieldId, &fieldDataPtr);
     if ( result != LE_OK )
@@ -2630,47 +2708,17 @@ static le_result_t SetString
     }
 
     // If time series is enabled add the data to time series history and get out. If time series is
-    // not enabled send the observe notification right away.
+    // not enabled queue the observe notification.
     if (fieldDataPtr->timeSeriesPtr != NULL)
     {
         return TimeSeriesAddEntry(fieldDataPtr, utcMilliSec);
     }
 
-    // Notify the server if observe is enabled and the value is changed.
-    // The server sends notify on entire object, so we need to send the TLV of entire
-    // object but include only the resource that changed.
+    // Queue a notification if observe is enabled and the value is changed.  Changes made within
+    // the notification period are sent together, in one notification per instance.
     if (fieldDataPtr->isObserve && strcmp(prevStr, strPtr) != 0 && isClient == true)
     {
-        assetData_AssetDataRef_t assetRef;
-        result = assetData_GetAssetRefById(instanceRef->assetDataPtr->appName,
-                                           instanceRef->assetDataPtr->assetId,
-                                           &assetRef);
-
-        if ( result == LE_OK)
-        {
-            result = WriteNotifyObjectToTLV(assetRef,
-                                            instanceRef->instanceId,
-                                            fieldId,
-                                            valueData,
-                                            sizeof(valueData),
-                                            &bytesWritten);
-            if ( result != LE_OK )
-            {
-                LE_ERROR("Failed to send lwm2m notification.");
-                return LE_FAULT;
-            }
-
-            opRef = pa_avc_CreateOpData(instanceRef->assetDataPtr->appName,
-                                        instanceRef->assetDataPtr->assetId,
-                                        -1,
-                                        -1,
-                                        PA_AVC_OPTYPE_NOTIFY,
-                                        TLV_ENCODING,
-                                        fieldDataPtr->token,
-                                        fieldDataPtr->tokenLength);
-
-            pa_avc_NotifyChange(opRef, valueData, bytesWritten);
-        }
+        QueueNotification(instanceRef, fieldDataPtr);
     }
 
     return result;
@@ -3070,10 +3118,15 @@ le_result_t assetData_CreateInstanceById
 
     // Add back reference from instance data to the asset containing the instance
     assetInstPtr->assetDataPtr = assetDataPtr;
+    assetInstPtr->isNotifyPending = false;
 
 
     le_dls_Queue(&assetDataPtr->instanceList, &assetInstPtr->link);
 
+    assetInstPtr->indexKey.parentPtr = assetDataPtr;
+    assetInstPtr->indexKey.id = assetInstPtr->instanceId;
+    le_hashmap_Put(InstanceIndex, &assetInstPtr->indexKey, assetInstPtr);
+
     // todo: For now, for testing, print it out; add trace support later.
     if ( 0 )
         PrintAssetMap();
@@ -3205,13 +3258,21 @@ void assetData_DeleteInstance
 
         // Release the field.
         LE_DEBUG("Deleting field %s", fieldDataPtr->name);
+        le_hashmap_Remove(FieldIndex, &fieldDataPtr->indexKey);
         le_mem_Release(fieldDataPtr);
 
         linkPtr = le_dls_Pop(&instanceRef->fieldList);
     }
 
+    // Drop any notification that hasn't been sent yet.
+    if (instanceRef->isNotifyPending)
+    {
+        le_dls_Remove(&NotifyPendingList, &instanceRef->notifyLink);
+    }
+
     // Remove the instance from the asset instance list
     le_dls_Remove(&instanceRef->assetDataPtr->instanceList, &instanceRef->link);
+    le_hashmap_Remove(InstanceIndex, &instanceRef->indexKey);
 
     // Lastly, release the instance data.
     le_mem_Release(instanceRef);
@@ -4552,6 +4613,10 @@ le_result_t assetData_Init
                                        le_hashmap_HashString,
                                        le_hashmap_EqualsString);
 
+    // Create the indexes that resolve (asset, instanceId) and (instance, fieldId).
+    InstanceIndex = le_hashmap_Create("Instance Index", 31, HashResourceKey, EqualsResourceKey);
+    FieldIndex = le_hashmap_Create("Field Index", 127, HashResourceKey, EqualsResourceKey);
+
 
     // Use a timer to delay reporting instance creation events to the modem for 15 seconds after
     // the last creation event. This allows us to aggregate multiple registration updates together.
@@ -4563,6 +4628,11 @@ le_result_t assetData_Init
     le_timer_SetInterval(RegUpdateTimerRef, timerInterval);
     le_timer_SetHandler(RegUpdateTimerRef, RegUpdateTimerHandler);
 
+    // Use a timer to coalesce observe notifications of resources that change together.
+    NotifyTimerRef = le_timer_Create("Notify timer");
+    le_timer_SetMsInterval(NotifyTimerRef, NOTIFY_MIN_PERIOD_MS);
+    le_timer_SetHandler(NotifyTimerRef, NotifyTimerHandler);
+
     // Pre-load the /lwm2m/9 object into the AssetMap; don't actually need to use the assetRef here.
     assetData_AssetDataRef_t lwm2mAssetRef;
 
@@ -5074,51 +5144,128 @@ le_result_t assetData_WriteObjectToTLV
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Write TLV for an object but include only the instance/resource which changed. This type of
- *  response is needed as the server sends notify on entire object, but we need to notify changes
- *  at resource level.
+ * Send an observe notification for the changed fields of an instance.  The server sends observe on
+ * the entire object, so the notification is the TLV of the object, but includes only the instance
+ * and the resources which changed.
  *
- *  @return:
- *      - LE_OK on success
- *      - LE_FAULT on error
+ * Fields observed with different tokens are sent in separate notifications, as are fields that
+ * don't fit in a single notification.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t WriteNotifyObjectToTLV
+static void SendInstanceNotification
 (
-    assetData_AssetDataRef_t assetRef,          ///< [IN] Asset to use
-    int instanceId,                             ///< [IN] Instance that has a changed resource
-    int fieldId,                                ///< [IN] The resource which changed
-    uint8_t* bufPtr,                            ///< [OUT] Buffer for writing the TLV list
-    size_t bufNumBytes,                         ///< [IN] Size of buffer
-    size_t* numBytesWrittenPtr                  ///< [OUT] # bytes written to buffer.
+    InstanceData_t* instancePtr     ///< [IN] Instance that has changed resources
 )
 {
-    le_result_t result = LE_OK;
-    InstanceData_t* instancePtr;
+    uint8_t fieldsBuffer[256-6];  // leave enough space for maximum header size of 6 bytes
+    uint8_t valueData[256];
+    size_t fieldsNumBytes;
+    size_t numBytesWritten;
+    le_dls_Link_t* linkPtr;
+    FieldData_t* fieldDataPtr;
+    FieldData_t* firstFieldPtr;
+    pa_avc_LWM2MOperationDataRef_t opRef;
 
-    LE_DEBUG("instanceId = %d", instanceId);
-    LE_DEBUG("fieldId = %d", fieldId);
+    do
+    {
+        firstFieldPtr = NULL;
+        fieldsNumBytes = 0;
 
-    result = GetInstanceFromAssetData(assetRef, instanceId, &instancePtr);
+        linkPtr = le_dls_Peek(&instancePtr->fieldList);
 
-    if (result != LE_OK)
-    {
-        LE_ERROR("Error reading instance reference result = %d.", result);
-        return LE_FAULT;
+        while ( linkPtr != NULL )
+        {
+            fieldDataPtr = CONTAINER_OF(linkPtr, FieldData_t, link);
+            linkPtr = le_dls_PeekNext(&instancePtr->fieldList, linkPtr);
+
+            if ( !fieldDataPtr->isNotifyPending )
+            {
+                continue;
+            }
+
+            if ( (firstFieldPtr != NULL)
+                 && ( (fieldDataPtr->tokenLength != firstFieldPtr->tokenLength)
+                      || (memcmp(fieldDataPtr->token,
+                                 firstFieldPtr->token,
+                                 firstFieldPtr->tokenLength) != 0) ) )
+            {
+                continue;
+            }
+
+            if ( WriteFieldTLV(instancePtr,
+                               fieldDataPtr,
+                               fieldsBuffer + fieldsNumBytes,
+                               sizeof(fieldsBuffer) - fieldsNumBytes,
+                               &numBytesWritten) != LE_OK )
+            {
+                // Leave it for the next notification, unless it doesn't fit in one on its own.
+                if ( firstFieldPtr == NULL )
+                {
+                    LE_ERROR("Failed to send lwm2m notification: oiid=%i, rid=%i",
+                             instancePtr->instanceId,
+                             fieldDataPtr->fieldId);
+                    fieldDataPtr->isNotifyPending = false;
+                }
+                continue;
+            }
+
+            fieldDataPtr->isNotifyPending = false;
+            fieldsNumBytes += numBytesWritten;
+
+            if ( firstFieldPtr == NULL )
+            {
+                firstFieldPtr = fieldDataPtr;
+            }
+        }
+
+        if ( firstFieldPtr != NULL )
+        {
+            WriteTLVHeader(TLV_TYPE_OBJ_INST,
+                           instancePtr->instanceId,
+                           fieldsNumBytes,
+                           valueData,
+                           sizeof(valueData),
+                           &numBytesWritten);
+
+            memcpy(valueData + numBytesWritten, fieldsBuffer, fieldsNumBytes);
+
+            opRef = pa_avc_CreateOpData(instancePtr->assetDataPtr->appName,
+                                        instancePtr->assetDataPtr->assetId,
+                                        -1,
+                                        -1,
+                                        PA_AVC_OPTYPE_NOTIFY,
+                                        TLV_ENCODING,
+                                        firstFieldPtr->token,
+                                        firstFieldPtr->tokenLength);
+
+            pa_avc_NotifyChange(opRef, valueData, numBytesWritten + fieldsNumBytes);
+        }
     }
+    while ( firstFieldPtr != NULL );
+}
 
-    result = WriteInstanceToTLV(instancePtr,
-                                fieldId,
-                                bufPtr,
-                                bufNumBytes,
-                                numBytesWrittenPtr);
-    if (result != LE_OK)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler function for NotifyTimerRef expiry.  Sends the notifications queued since the timer was
+ * started.
+ */
+//--------------------------------------------------------------------------------------------------
+static void NotifyTimerHandler
+(
+    le_timer_Ref_t timerRef    ///< This timer has expired
+)
+{
+    le_dls_Link_t* linkPtr;
+    InstanceData_t* instancePtr;
+
+    while ( (linkPtr = le_dls_Pop(&NotifyPendingList)) != NULL )
     {
-        LE_ERROR("Error while setting asset instance result = %d.", result);
-        return LE_FAULT;
-    }
+        instancePtr = CONTAINER_OF(linkPtr, InstanceData_t, notifyLink);
+        instancePtr->isNotifyPending = false;
 
-    return LE_OK;
+        SendInstanceNotification(instancePtr);
+    }
 }
 
 
@@ -5388,6 +5535,7 @@ le_result_t assetData_SetObserve
             LE_DEBUG("Setting observe on resource %d", fieldDataPtr->fieldId);
 
             fieldDataPtr->isObserve = isObserve;
+            fieldDataPtr->isNotifyPending = false;
 
             if (isObserve && (tokenLength > 0))
             {
@@ -480,6 +480,12 @@ LE_SHARED le_result_t pa_avc_RegistrationUpdate
  *  - LE_AVC_DOWNLOAD_FAILED, if there was an error, and the download was stopped
  * Note that handlerRef will be cleared after download complete or failed.
  *
+ * The download is carried out by the platform, which owns the transfer: if the link drops, or
+ * the device restarts, during the download, the platform should resume it from the data already
+ * received (e.g. with ranged requests) rather than start over, and only report
+ * LE_AVC_DOWNLOAD_FAILED when it gives up.  After a restart, the status of the resumed download
+ * is reported to the handler given to pa_avc_AddURIDownloadStatusHandler().
+ *
  * @return
  *      - LE_OK on success
  *      - LE_FAULT on error
@@ -518,6 +524,9 @@ LE_SHARED le_result_t pa_avc_AddURIDownloadStatusHandler
 /**
  * Read the image file from the modem.
  *
+ * The file descriptor is read sequentially, as a stream, by the update daemon, so it can be a
+ * pipe fed by the platform as the image is read.
+ *
  * @return
  *      - LE_OK on success
  *      - LE_FAULT on failure
@@ -5,6 +5,9 @@
  * database's system tree.  The caller of this API must be have privileges to read the configuration
  * system tree.
  *
+ * Each iterator reads a local copy of the configuration it covers, (see cfgSubtree.h,) when it is
+ * created, so reading the settings of an app doesn't take a request to the Config Tree per setting.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
@@ -12,6 +15,7 @@
 #include "appCfg.h"
 #include "interfaces.h"
 #include "limit.h"
+#include "cfgSubtree.h"
 
 
 //--------------------------------------------------------------------------------------------------
@@ -139,7 +143,11 @@ IterType_t;
 typedef struct appCfg_Iter_Ref
 {
     IterType_t type;
-    le_cfg_IteratorRef_t cfgIter;
+    cfgSubtree_NodeRef_t rootRef;           ///< Copy of the config read, if this iterator owns it.
+    struct appCfg_Iter_Ref* ownerPtr;       ///< Iterator that owns the copy, if another one does.
+    cfgSubtree_NodeRef_t listRef;           ///< Node whose children are iterated over.
+    cfgSubtree_NodeRef_t currentRef;        ///< Node the iterator is at, NULL if there is none.
+    char appName[LIMIT_MAX_APP_NAME_BYTES]; ///< Name of the app found by appCfg_FindApp().
     bool atFirst;
 }
 AppsIter_t;
@@ -206,6 +214,92 @@ static void CheckFor
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a new iterator.
+ *
+ * @return
+ *      The iterator, positioned at the listRef node.
+ */
+//--------------------------------------------------------------------------------------------------
+static AppsIter_t* NewIter
+(
+    IterType_t type,                        ///< [IN] Type of the iterator.
+    cfgSubtree_NodeRef_t rootRef,           ///< [IN] Copy of the config it owns, or NULL.
+    AppsIter_t* ownerPtr,                   ///< [IN] Iterator owning the copy it reads, or NULL.
+    cfgSubtree_NodeRef_t listRef            ///< [IN] Node whose children it iterates over.
+)
+{
+    AppsIter_t* iterPtr = le_mem_ForceAlloc(AppIterPool);
+
+    iterPtr->type = type;
+    iterPtr->rootRef = rootRef;
+    iterPtr->ownerPtr = ownerPtr;
+    iterPtr->listRef = listRef;
+    iterPtr->currentRef = listRef;
+    iterPtr->appName[0] = '\0';
+    iterPtr->atFirst = true;
+
+    if (ownerPtr != NULL)
+    {
+        le_mem_AddRef(ownerPtr);
+    }
+
+    return iterPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor for the iterators.  Frees the copy of the config the iterator owns, or lets go of the
+ * iterator that owns the copy it reads.
+ */
+//--------------------------------------------------------------------------------------------------
+static void IterDestructor
+(
+    void* objPtr                            ///< [IN] The iterator being freed.
+)
+{
+    AppsIter_t* iterPtr = objPtr;
+
+    if (iterPtr->rootRef != NULL)
+    {
+        cfgSubtree_Delete(iterPtr->rootRef);
+    }
+
+    if (iterPtr->ownerPtr != NULL)
+    {
+        le_mem_Release(iterPtr->ownerPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a copy of the config of all apps, or of one app.
+ *
+ * @return
+ *      The copy, or NULL if there is no such config.
+ */
+//--------------------------------------------------------------------------------------------------
+static cfgSubtree_NodeRef_t ReadAppsConfig
+(
+    const char* appName                     ///< [IN] Name of the app, or "" for all apps.
+)
+{
+    cfgSubtree_NodeRef_t rootRef = NULL;
+    le_cfg_IteratorRef_t cfgIter = le_cfg_CreateReadTxn(CFG_APPS_LIST);
+
+    le_result_t result = cfgSubtree_Read(cfgIter, appName, &rootRef);
+
+    le_cfg_CancelTxn(cfgIter);
+
+    LE_ERROR_IF(result == LE_FORMAT_ERROR, "Could not read the config of apps '%s'.", appName);
+
+    return (result == LE_OK) ? rootRef : NULL;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Calls user's change handler when the config changes.
@@ -268,7 +362,8 @@ LE_SHARED void appCfg_DeleteChangeHandler
  * Creates an iterator that can be used to iterate over the list of apps.
  *
  * @note
- *      Iterators have a time out and must be deleted before the timeout expires.
+ *      The iterator reads a copy of the apps' configuration when it is created, and doesn't see
+ *      later changes to it.
  *
  * @return
  *      Reference to the iterator.
@@ -279,13 +374,9 @@ LE_SHARED appCfg_Iter_t appCfg_CreateAppsIter
     void
 )
 {
-    AppsIter_t* iterPtr = le_mem_ForceAlloc(AppIterPool);
-
-    iterPtr->type = ITER_TYPE_APP;
-    iterPtr->cfgIter = le_cfg_CreateReadTxn(CFG_APPS_LIST);
-    iterPtr->atFirst = true;
+    cfgSubtree_NodeRef_t rootRef = ReadAppsConfig("");
 
-    return iterPtr;
+    return NewIter(ITER_TYPE_APP, rootRef, NULL, rootRef);
 }
 
 
@@ -295,7 +386,8 @@ LE_SHARED appCfg_Iter_t appCfg_CreateAppsIter
  * the given app.
  *
  * @note
- *      Iterators have a time out and must be deleted before the timeout expires.
+ *      The iterator reads a copy of the apps' configuration when it is created, and doesn't see
+ *      later changes to it.
  *
  * @return
  *      Reference to the iterator, or NULL if the app was not found.
@@ -306,11 +398,17 @@ LE_SHARED appCfg_Iter_t appCfg_FindApp
     const char* appName         ///< [IN] Name of the app to find.
 )
 {
-    AppsIter_t* iterPtr = appCfg_CreateAppsIter();
+    cfgSubtree_NodeRef_t rootRef = ReadAppsConfig(appName);
+
+    if (rootRef == NULL)
+    {
+        return NULL;
+    }
 
-    le_cfg_GoToNode(iterPtr->cfgIter, appName);
+    AppsIter_t* iterPtr = NewIter(ITER_TYPE_APP, rootRef, NULL, rootRef);
 
-    if (le_cfg_NodeExists(iterPtr->cfgIter, "") == false)
+    // The copy is of the app's own node, which has no name of its own.
+    if (le_utf8_Copy(iterPtr->appName, appName, sizeof(iterPtr->appName), NULL) != LE_OK)
     {
         appCfg_DeleteIter(iterPtr);
         return NULL;
@@ -339,12 +437,17 @@ LE_SHARED le_result_t appCfg_GetAppName
 {
     CheckFor(appIterRef, ITER_TYPE_APP);
 
-    if (le_cfg_NodeExists(appIterRef->cfgIter, "") == false)
+    if (appIterRef->currentRef == NULL)
     {
         return LE_NOT_FOUND;
     }
 
-    return le_cfg_GetNodeName(appIterRef->cfgIter, "", bufPtr, bufSize);
+    if (appIterRef->currentRef == appIterRef->rootRef)
+    {
+        return le_utf8_Copy(bufPtr, appIterRef->appName, bufSize, NULL);
+    }
+
+    return cfgSubtree_GetNodeName(appIterRef->currentRef, "", bufPtr, bufSize);
 }
 
 
@@ -363,7 +466,12 @@ LE_SHARED size_t appCfg_GetSecStoreLimit
 {
     CheckFor(appIterRef, ITER_TYPE_APP);
 
-    return le_cfg_GetInt(appIterRef->cfgIter, CFG_LIMIT_SEC_STORE, DEFAULT_LIMIT_SEC_STORE);
+    if (appIterRef->currentRef == NULL)
+    {
+        return DEFAULT_LIMIT_SEC_STORE;
+    }
+
+    return cfgSubtree_GetInt(appIterRef->currentRef, CFG_LIMIT_SEC_STORE, DEFAULT_LIMIT_SEC_STORE);
 }
 
 
@@ -386,12 +494,12 @@ LE_SHARED le_result_t appCfg_GetVersion
 {
     CheckFor(appIterRef, ITER_TYPE_APP);
 
-    if (le_cfg_NodeExists(appIterRef->cfgIter, "") == false)
+    if (appIterRef->currentRef == NULL)
     {
         return LE_NOT_FOUND;
     }
 
-    return le_cfg_GetString(appIterRef->cfgIter, CFG_APP_VERSION, bufPtr, bufSize, "");
+    return cfgSubtree_GetString(appIterRef->currentRef, CFG_APP_VERSION, bufPtr, bufSize, "");
 }
 
 
@@ -410,9 +518,8 @@ LE_SHARED appCfg_StartMode_t appCfg_GetStartMode
 {
     CheckFor(appIterRef, ITER_TYPE_APP);
 
-    bool startManual = le_cfg_GetBool(appIterRef->cfgIter, CFG_APP_START_MANUAL, false);
-
-    if (startManual)
+    if (   (appIterRef->currentRef != NULL)
+        && (cfgSubtree_GetBool(appIterRef->currentRef, CFG_APP_START_MANUAL, false)))
     {
         return APPCFG_START_MODE_MANUAL;
     }
@@ -436,17 +543,17 @@ LE_SHARED appCfg_Iter_t appCfg_CreateAppProcIter
 {
     CheckFor(appIterRef, ITER_TYPE_APP);
 
-    char pathStr[LE_CFG_STR_LEN_BYTES] = "";
-    le_cfg_GetPath(appIterRef->cfgIter, "", pathStr, sizeof(pathStr));
+    // The process iterator reads the same copy of the config as the app iterator, so it keeps
+    // the iterator that owns the copy.
+    AppsIter_t* ownerPtr = (appIterRef->ownerPtr != NULL) ? appIterRef->ownerPtr : appIterRef;
+    cfgSubtree_NodeRef_t procsRef = NULL;
 
-    AppsIter_t* iterPtr = le_mem_ForceAlloc(AppIterPool);
-
-    iterPtr->type = ITER_TYPE_PROC;
-    iterPtr->cfgIter = le_cfg_CreateReadTxn(pathStr);
-    le_cfg_GoToNode(iterPtr->cfgIter, CFG_PROCS_LIST);
-    iterPtr->atFirst = true;
+    if (appIterRef->currentRef != NULL)
+    {
+        procsRef = cfgSubtree_GetNode(appIterRef->currentRef, CFG_PROCS_LIST);
+    }
 
-    return iterPtr;
+    return NewIter(ITER_TYPE_PROC, NULL, ownerPtr, procsRef);
 }
 
 
@@ -469,12 +576,12 @@ LE_SHARED le_result_t appCfg_GetProcName
 {
     CheckFor(procIterRef, ITER_TYPE_PROC);
 
-    if (le_cfg_NodeExists(procIterRef->cfgIter, "") == false)
+    if (procIterRef->currentRef == NULL)
     {
         return LE_NOT_FOUND;
     }
 
-    return le_cfg_GetNodeName(procIterRef->cfgIter, "", bufPtr, bufSize);
+    return cfgSubtree_GetNodeName(procIterRef->currentRef, "", bufPtr, bufSize);
 }
 
 
@@ -497,12 +604,12 @@ LE_SHARED le_result_t appCfg_GetProcExecName
 {
     CheckFor(procIterRef, ITER_TYPE_PROC);
 
-    if (le_cfg_NodeExists(procIterRef->cfgIter, "") == false)
+    if (procIterRef->currentRef == NULL)
     {
         return LE_NOT_FOUND;
     }
 
-    return le_cfg_GetString(procIterRef->cfgIter, CFG_PROC_EXEC_NAME, bufPtr, bufSize, "");
+    return cfgSubtree_GetString(procIterRef->currentRef, CFG_PROC_EXEC_NAME, bufPtr, bufSize, "");
 }
 
 
@@ -521,12 +628,17 @@ LE_SHARED appCfg_FaultAction_t appCfg_GetProcFaultAction
 {
     CheckFor(procIterRef, ITER_TYPE_PROC);
 
+    if (procIterRef->currentRef == NULL)
+    {
+        return APPCFG_FAULT_ACTION_IGNORE;
+    }
+
     char faultActionStr[LIMIT_MAX_FAULT_ACTION_NAME_BYTES];
-    le_result_t result = le_cfg_GetString(procIterRef->cfgIter,
-                                          CFG_NODE_FAULT_ACTION,
-                                          faultActionStr,
-                                          sizeof(faultActionStr),
-                                          "");
+    le_result_t result = cfgSubtree_GetString(procIterRef->currentRef,
+                                              CFG_NODE_FAULT_ACTION,
+                                              faultActionStr,
+                                              sizeof(faultActionStr),
+                                              "");
 
     if (result != LE_OK)
     {
@@ -580,23 +692,29 @@ LE_SHARED le_result_t appCfg_GetNextItem
     appCfg_Iter_t iter          ///< [IN] Apps iterator
 )
 {
-    le_result_t result;
+    cfgSubtree_NodeRef_t nextRef = NULL;
 
-    if (iter->atFirst)
-    {
-        result = le_cfg_GoToFirstChild(iter->cfgIter);
-        iter->atFirst = false;
-    }
-    else
+    if (iter->currentRef != NULL)
     {
-        result = le_cfg_GoToNextSibling(iter->cfgIter);
+        if (iter->atFirst)
+        {
+            nextRef = cfgSubtree_GetFirstChild(iter->currentRef);
+        }
+        else
+        {
+            nextRef = cfgSubtree_GetNextSibling(iter->currentRef);
+        }
     }
 
-    if (result != LE_OK)
+    iter->atFirst = false;
+
+    if (nextRef == NULL)
     {
         return LE_NOT_FOUND;
     }
 
+    iter->currentRef = nextRef;
+
     return LE_OK;
 }
 
@@ -611,6 +729,7 @@ LE_SHARED void appCfg_ResetIter
     appCfg_Iter_t iter          ///< [IN] Iterator
 )
 {
+    iter->currentRef = iter->listRef;
     iter->atFirst = true;
 }
 
@@ -625,8 +744,6 @@ LE_SHARED void appCfg_DeleteIter
     appCfg_Iter_t iter          ///< [IN] Iterator
 )
 {
-    le_cfg_CancelTxn(iter->cfgIter);
-
     le_mem_Release(iter);
 }
 
@@ -639,4 +756,5 @@ LE_SHARED void appCfg_DeleteIter
 COMPONENT_INIT
 {
     AppIterPool = le_mem_InitStaticPool(AppsIter, HIGH_APPS_ITER, sizeof(AppsIter_t));
+    le_mem_SetDestructor(AppIterPool, IterDestructor);
 }
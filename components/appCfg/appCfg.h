@@ -93,7 +93,8 @@ void appCfg_DeleteChangeHandler
  * Creates an iterator that can be used to iterate over the list of apps.
  *
  * @note
- *      Iterators have a time out and must be deleted before the timeout expires.
+ *      The iterator reads a copy of the apps' configuration when it is created, and doesn't see
+ *      later changes to it.
  *
  * @return
  *      Reference to the iterator.
@@ -111,7 +112,8 @@ appCfg_Iter_t appCfg_CreateAppsIter
  * the given app.
  *
  * @note
- *      Iterators have a time out and must be deleted before the timeout expires.
+ *      The iterator reads a copy of the apps' configuration when it is created, and doesn't see
+ *      later changes to it.
  *
  * @return
  *      Reference to the iterator, or NULL if the app was not found.
@@ -268,6 +268,22 @@ Unsolicited_t;
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Command queue statistics structure
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t        depth;              ///< Commands waiting or being sent
+    uint32_t        maxDepth;           ///< Largest depth of the queue
+    uint32_t        commandCount;       ///< Commands sent
+    uint64_t        totalWaitMs;        ///< Time the commands sent waited in the queue (ms)
+    uint32_t        maxWaitMs;          ///< Longest time a command sent waited in the queue (ms)
+}
+QueueStats_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Interface context structure
@@ -281,7 +297,8 @@ typedef struct DeviceContext
     Device_t        device;             ///< data of the connected device
     RxParser_t      rxParser;           ///< Rx buffer parser context
     le_timer_Ref_t  timerRef;           ///< command timer
-    le_dls_List_t   atCommandList;      ///< List of command waiting for execution
+    le_dls_List_t   atCommandList;      ///< List of command waiting for execution, by priority
+    QueueStats_t    queueStats;         ///< Statistics of atCommandList
     le_dls_List_t   unsolicitedList;    ///< unsolicited command list
     le_sem_Ref_t    waitingSemaphore;   ///< semaphore used for synchronization
     le_atClient_DeviceRef_t ref;        ///< reference of the device context
@@ -306,6 +323,8 @@ typedef struct AtCmd
     size_t                 textSize;                            ///< size of text to send
     DeviceContext_t*       interfacePtr;                        ///< interface to send the command
     uint32_t               timeout;                             ///< command timeout (in ms)
+    le_atClient_Priority_t priority;                            ///< priority in the queue
+    le_clk_Time_t          queuedTime;                          ///< when the command was queued
     le_atClient_CmdRef_t   ref;                                 ///< command reference
     le_dls_List_t          responseList;                        ///< Responses list
     uint32_t               intermediateIndex;                   ///< current index for intermediate
@@ -319,6 +338,14 @@ typedef struct AtCmd
 AtCmd_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the command queue statistics of the devices, which are updated by the device
+ * threads.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mutex_Ref_t QueueStatsMutex;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Pool for device context
@@ -528,6 +555,9 @@ static bool GetNextEvent
 /**
  * This function must be called to read and send event to the Rx parser
  *
+ * Only the first character matters to the starting state, which parses the buffer one character
+ * at a time. The other states only act on line ends and prompts: the buffer is searched for these
+ * with memchr(), and the characters in between are skipped, left in place in the buffer.
  */
 //--------------------------------------------------------------------------------------------------
 static void ParseRxBuffer
@@ -535,13 +565,53 @@ static void ParseRxBuffer
     RxParserPtr_t rxParserPtr
 )
 {
+    RxData_t* rxDataPtr = &rxParserPtr->rxData;
+    const uint8_t* endPtr = &rxDataPtr->buffer[rxDataPtr->endBuffer];
+    const uint8_t* lfPtr = NULL;
+    const uint8_t* promptPtr = NULL;
     RxEvent_t event;
 
-    for (;rxParserPtr->rxData.idx < rxParserPtr->rxData.endBuffer;)
+    while (rxDataPtr->idx < rxDataPtr->endBuffer)
     {
-        if (GetNextEvent(rxParserPtr, &event))
+        if (rxParserPtr->curState == StartingState)
+        {
+            if (GetNextEvent(rxParserPtr, &event))
+            {
+                (rxParserPtr->curState)(rxParserPtr,event);
+            }
+            continue;
+        }
+
+        const uint8_t* curPtr = &rxDataPtr->buffer[rxDataPtr->idx];
+
+        // Each search runs again only once the parser has gone past what it found.
+        if ((lfPtr == NULL) || (lfPtr < curPtr))
         {
-            (rxParserPtr->curState)(rxParserPtr,event);
+            lfPtr = memchr(curPtr, '\n', endPtr - curPtr);
+            lfPtr = lfPtr ? lfPtr : endPtr;
+        }
+        if ((promptPtr == NULL) || (promptPtr < curPtr))
+        {
+            promptPtr = memchr(curPtr, '>', endPtr - curPtr);
+            promptPtr = promptPtr ? promptPtr : endPtr;
+        }
+
+        if (promptPtr < lfPtr)
+        {
+            rxDataPtr->idx = promptPtr - rxDataPtr->buffer + 1;
+            (rxParserPtr->curState)(rxParserPtr,PARSER_PROMPT);
+        }
+        else if (lfPtr < endPtr)
+        {
+            rxDataPtr->idx = lfPtr - rxDataPtr->buffer + 1;
+            if ((lfPtr > rxDataPtr->buffer) && (lfPtr[-1] == '\r'))
+            {
+                (rxParserPtr->curState)(rxParserPtr,PARSER_CRLF);
+            }
+        }
+        else
+        {
+            rxDataPtr->idx = rxDataPtr->endBuffer;
         }
     }
 }
@@ -559,16 +629,15 @@ static void ResetRxBuffer
 {
     if (rxParserPtr->curState == ProcessingState)
     {
-        size_t idx,sizeToCopy;
+        size_t sizeToCopy;
         sizeToCopy = rxParserPtr->rxData.endBuffer-rxParserPtr->rxData.idxLastCrLf+2;
 
         LE_DEBUG("%d sizeToCopy %zd from %d",
                             rxParserPtr->rxData.idx,sizeToCopy,rxParserPtr->rxData.idxLastCrLf-2);
 
-        for (idx = 0; idx < sizeToCopy; idx++) {
-            rxParserPtr->rxData.buffer[idx] =
-                                rxParserPtr->rxData.buffer[idx+rxParserPtr->rxData.idxLastCrLf-2];
-        }
+        memmove(rxParserPtr->rxData.buffer,
+                &rxParserPtr->rxData.buffer[rxParserPtr->rxData.idxLastCrLf-2],
+                sizeToCopy);
 
         rxParserPtr->rxData.idxLastCrLf = 2;
         rxParserPtr->rxData.endBuffer = sizeToCopy;
@@ -772,6 +841,100 @@ static void UpdateTransitionManager
     clientStatePtr->lastEvent   = input;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to queue a command on its device, after the commands of the same or
+ * higher priority. It must be called from the device thread.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueCommand
+(
+    DeviceContext_t* interfacePtr,
+    AtCmd_t*         cmdPtr
+)
+{
+    le_dls_List_t* listPtr = &interfacePtr->atCommandList;
+    le_dls_Link_t* linkPtr = le_dls_Peek(listPtr);
+
+    // The command at the head of the queue is being sent if the client is in the sending state:
+    // it can't be overtaken.
+    if ((linkPtr != NULL) && (interfacePtr->clientState.curState == SendingState))
+    {
+        linkPtr = le_dls_PeekNext(listPtr, linkPtr);
+    }
+
+    while ((linkPtr != NULL) &&
+           (CONTAINER_OF(linkPtr, AtCmd_t, link)->priority >= cmdPtr->priority))
+    {
+        linkPtr = le_dls_PeekNext(listPtr, linkPtr);
+    }
+
+    if (linkPtr != NULL)
+    {
+        le_dls_AddBefore(listPtr, linkPtr, &cmdPtr->link);
+    }
+    else
+    {
+        le_dls_Queue(listPtr, &cmdPtr->link);
+    }
+
+    le_mutex_Lock(QueueStatsMutex);
+    interfacePtr->queueStats.depth++;
+    if (interfacePtr->queueStats.depth > interfacePtr->queueStats.maxDepth)
+    {
+        interfacePtr->queueStats.maxDepth = interfacePtr->queueStats.depth;
+    }
+    le_mutex_Unlock(QueueStatsMutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to remove the command at the head of the queue of a device. It must be
+ * called from the device thread.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void PopCommand
+(
+    DeviceContext_t* interfacePtr
+)
+{
+    if (le_dls_Pop(&interfacePtr->atCommandList) != NULL)
+    {
+        le_mutex_Lock(QueueStatsMutex);
+        interfacePtr->queueStats.depth--;
+        le_mutex_Unlock(QueueStatsMutex);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to account for the time a command waited in the queue, when it is sent.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void UpdateWaitStats
+(
+    DeviceContext_t* interfacePtr,
+    AtCmd_t*         cmdPtr
+)
+{
+    le_clk_Time_t waitTime = le_clk_Sub(le_clk_GetRelativeTime(), cmdPtr->queuedTime);
+    uint32_t waitMs = (uint32_t)(waitTime.sec * 1000 + waitTime.usec / 1000);
+
+    le_mutex_Lock(QueueStatsMutex);
+    interfacePtr->queueStats.commandCount++;
+    interfacePtr->queueStats.totalWaitMs += waitMs;
+    if (waitMs > interfacePtr->queueStats.maxWaitMs)
+    {
+        interfacePtr->queueStats.maxWaitMs = waitMs;
+    }
+    le_mutex_Unlock(QueueStatsMutex);
+
+    LE_DEBUG("Command %s waited %"PRIu32" ms", cmdPtr->cmd, waitMs);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function must be called to stop the timer of a command
@@ -801,7 +964,7 @@ static void TimerHandler
 
     LE_ERROR("Timeout when sending %s, timeout = %d",  atCmdPtr->cmd, atCmdPtr->timeout);
     atCmdPtr->result = LE_TIMEOUT;
-    le_dls_Pop(&atCmdPtr->interfacePtr->atCommandList);
+    PopCommand(atCmdPtr->interfacePtr);
     le_sem_Post(atCmdPtr->endSem);
     ClientStatePtr_t clientStatePtr = &atCmdPtr->interfacePtr->clientState;
 
@@ -862,8 +1025,9 @@ static bool CheckResponse
 
     le_dls_Link_t* linkPtr = le_dls_Peek(responseListPtr);
 
+    // The received line is not terminated: it is a view into the Rx buffer.
     LE_DEBUG("Command: %s, size: %zu", cmdNamePtr, strlen(cmdNamePtr));
-    LE_DEBUG("Received response: %s, size: %zu", receivedRspPtr, lineSize);
+    LE_DEBUG("Received response: %.*s, size: %zu", (int)lineSize, receivedRspPtr, lineSize);
 
     if (strncmp(cmdNamePtr, receivedRspPtr, strlen(cmdNamePtr)) == 0)
     {
@@ -877,25 +1041,26 @@ static bool CheckResponse
         RspString_t* currStringPtr = CONTAINER_OF(linkPtr,
                                                   RspString_t,
                                                   link);
-        LE_DEBUG("Item: %s, size: %zu", currStringPtr->line, strlen(currStringPtr->line));
+        size_t patternSize = strlen(currStringPtr->line);
 
-        if ((strlen(currStringPtr->line) == 0) ||
-           ((lineSize >= strlen(currStringPtr->line)) &&
-           (strncmp(currStringPtr->line, receivedRspPtr, strlen(currStringPtr->line)) == 0)))
+        LE_DEBUG("Item: %s, size: %zu", currStringPtr->line, patternSize);
+
+        if ((patternSize == 0) ||
+           ((lineSize >= patternSize) &&
+           (memcmp(currStringPtr->line, receivedRspPtr, patternSize) == 0)))
         {
             LE_DEBUG("Rsp matched, size: %zu", lineSize);
 
-            RspString_t* newStringPtr = le_mem_ForceAlloc(RspStringPool);
-            memset(newStringPtr, 0, sizeof(RspString_t));
-
-            if(lineSize>LE_ATDEFS_RESPONSE_MAX_BYTES)
+            // Only the lines matched are copied out of the Rx buffer.
+            if (lineSize >= LE_ATDEFS_RESPONSE_MAX_BYTES)
             {
                 LE_ERROR("String too long");
-                le_mem_Release(newStringPtr);
                 return false;
             }
 
-            strncpy(newStringPtr->line, receivedRspPtr, lineSize);
+            RspString_t* newStringPtr = le_mem_ForceAlloc(RspStringPool);
+            memcpy(newStringPtr->line, receivedRspPtr, lineSize);
+            newStringPtr->line[lineSize] = '\0';
             newStringPtr->link = LE_DLS_LINK_INIT;
             le_dls_Queue(resultListPtr, &(newStringPtr->link));
             return true;
@@ -968,7 +1133,7 @@ static void SendingState
             {
                 LE_DEBUG("Final command found");
 
-                le_dls_Pop(&interfacePtr->atCommandList);
+                PopCommand(interfacePtr);
 
                 cmdPtr->result = LE_OK;
                 StopTimer(cmdPtr);
@@ -1025,6 +1190,8 @@ static void WaitingState
 
             AtCmd_t* cmdPtr = CONTAINER_OF(linkPtr, AtCmd_t, link);
 
+            UpdateWaitStats(interfacePtr, cmdPtr);
+
             if (cmdPtr->timeout > 0)
             {
                 StartTimer(cmdPtr);
@@ -1203,7 +1370,8 @@ static void ReleaseRspStringList
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function is to send a new AT command
+ * This function is to queue a new AT command on its device, and send it if the device is idle.
+ * It is called in the device thread.
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -1214,11 +1382,19 @@ static void SendCommand
 )
 {
     DeviceContext_t* interfacePtr = param1Ptr;
+    AtCmd_t* cmdPtr = param2Ptr;
 
     if (interfacePtr)
     {
         ClientState_t* clientState = &interfacePtr->clientState;
-        (clientState->curState)(clientState,EVENT_SENDCMD);
+
+        QueueCommand(interfacePtr, cmdPtr);
+
+        // Otherwise, the command is sent when the commands before it are done.
+        if (clientState->curState == WaitingState)
+        {
+            (clientState->curState)(clientState,EVENT_SENDCMD);
+        }
     }
 }
 
@@ -1371,6 +1547,7 @@ le_atClient_CmdRef_t le_atClient_Create
     cmdPtr->expectResponseList              = LE_DLS_LIST_INIT;
     cmdPtr->textSize                        = 0;
     cmdPtr->timeout                         = LE_ATDEFS_COMMAND_DEFAULT_TIMEOUT;
+    cmdPtr->priority                        = LE_ATCLIENT_PRIORITY_NORMAL;
     cmdPtr->interfacePtr                    = NULL;
     cmdPtr->ref                             = le_ref_CreateRef(CmdRefMap, cmdPtr);
     cmdPtr->intermediateIndex               = 0;
@@ -1687,6 +1864,44 @@ le_result_t le_atClient_SetTimeout
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to set the priority of the AT command in the queue of its device.
+ *
+ * @return
+ *      - LE_BAD_PARAMETER when the priority is invalid
+ *      - LE_OK when function succeed
+ *
+ * @note If the AT Command reference is invalid, a fatal error occurs,
+ *       the function won't return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atClient_SetPriority
+(
+    le_atClient_CmdRef_t cmdRef,
+        ///< [IN] AT Command
+
+    le_atClient_Priority_t priority
+        ///< [IN] Priority of the command
+)
+{
+    AtCmd_t* cmdPtr = le_ref_Lookup(CmdRefMap, cmdRef);
+    if (cmdPtr == NULL)
+    {
+        LE_KILL_CLIENT("Invalid reference (%p) provided!", cmdRef);
+        return LE_BAD_PARAMETER;
+    }
+
+    if ((priority < LE_ATCLIENT_PRIORITY_LOW) || (priority > LE_ATCLIENT_PRIORITY_HIGH))
+    {
+        LE_ERROR("Invalid priority %d", priority);
+        return LE_BAD_PARAMETER;
+    }
+
+    cmdPtr->priority = priority;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function must be called to send an AT Command and wait for response.
@@ -1735,14 +1950,15 @@ le_result_t le_atClient_Send
     }
 
     cmdPtr->endSem = le_sem_Create("ResultSignal",0);
-    le_dls_Queue(&cmdPtr->interfacePtr->atCommandList, &cmdPtr->link);
+    cmdPtr->queuedTime = le_clk_GetRelativeTime();
 
     ReleaseRspStringList(&cmdPtr->responseList);
 
+    // The queue of the device is only modified by the device thread.
     le_event_QueueFunctionToThread(cmdPtr->interfacePtr->threadRef,
                                                 SendCommand,
                                                 (void*) cmdPtr->interfacePtr,
-                                                (void*) NULL);
+                                                (void*) cmdPtr);
 
     le_sem_Wait(cmdPtr->endSem);
 
@@ -1752,6 +1968,64 @@ le_result_t le_atClient_Send
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to get the statistics of the command queue of a device.
+ *
+ * @return
+ *      - LE_FAULT when function failed
+ *      - LE_OK when function succeed
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atClient_GetQueueStats
+(
+    le_atClient_DeviceRef_t devRef,
+        ///< [IN] Device
+
+    uint32_t* depthPtr,
+        ///< [OUT] Number of commands waiting or being sent
+
+    uint32_t* maxDepthPtr,
+        ///< [OUT] Largest number of commands waiting or being sent
+
+    uint32_t* commandCountPtr,
+        ///< [OUT] Number of commands sent
+
+    uint32_t* averageWaitMsPtr,
+        ///< [OUT] Average time the commands sent waited in the queue (ms)
+
+    uint32_t* maxWaitMsPtr
+        ///< [OUT] Longest time a command sent waited in the queue (ms)
+)
+{
+    DeviceContext_t* interfacePtr = le_ref_Lookup(DevicesRefMap, devRef);
+
+    if (interfacePtr == NULL)
+    {
+        LE_ERROR("Invalid device");
+        return LE_FAULT;
+    }
+
+    if ((depthPtr == NULL) || (maxDepthPtr == NULL) || (commandCountPtr == NULL) ||
+        (averageWaitMsPtr == NULL) || (maxWaitMsPtr == NULL))
+    {
+        LE_KILL_CLIENT("Invalid output pointer provided!");
+        return LE_FAULT;
+    }
+
+    le_mutex_Lock(QueueStatsMutex);
+    *depthPtr = interfacePtr->queueStats.depth;
+    *maxDepthPtr = interfacePtr->queueStats.maxDepth;
+    *commandCountPtr = interfacePtr->queueStats.commandCount;
+    *averageWaitMsPtr = interfacePtr->queueStats.commandCount ?
+        (uint32_t)(interfacePtr->queueStats.totalWaitMs / interfacePtr->queueStats.commandCount) :
+        0;
+    *maxWaitMsPtr = interfacePtr->queueStats.maxWaitMs;
+    le_mutex_Unlock(QueueStatsMutex);
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function is used to get the first intermediate response.
@@ -2228,6 +2502,8 @@ le_result_t le_atClient_Stop
 //--------------------------------------------------------------------------------------------------
 COMPONENT_INIT
 {
+    QueueStatsMutex = le_mutex_CreateNonRecursive("AtClientQueueStats");
+
     // Device pool allocation
     DevicesPool = le_mem_CreatePool("AtClientDevicesPool",sizeof(DeviceContext_t));
     le_mem_ExpandPool(DevicesPool,DEVICE_POOL_SIZE);
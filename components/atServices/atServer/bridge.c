@@ -28,6 +28,13 @@
 //--------------------------------------------------------------------------------------------------
 #define AT_CLIENT_TIMEOUT 5*60*1000
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of bytes relayed at once in data mode
+ */
+//--------------------------------------------------------------------------------------------------
+#define DATA_MODE_CHUNK_SIZE    4096
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Responses codes definition
@@ -52,6 +59,44 @@
 // Data structures.
 //--------------------------------------------------------------------------------------------------
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Data mode path structure: data relayed in one direction.
+ *
+ *  The data go through a pipe, so that they are moved in the kernel with splice(). When a file
+ *  descriptor can't be spliced, the pipe is closed and the data are copied through buf instead.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int      inFd;                          ///< File descriptor the data are read from
+    int      outFd;                         ///< File descriptor the data are written to
+    int      pipeFd[2];                     ///< Pipe the data go through, -1 when copying
+    char     buf[DATA_MODE_CHUNK_SIZE];     ///< Buffer the data are copied through
+    size_t   offset;                        ///< Offset of the pending data in buf
+    size_t   pendingSize;                   ///< Number of bytes read and not written yet
+    uint64_t byteCount;                     ///< Number of bytes relayed since the bridge opened
+}
+DataPath_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Data mode structure.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_atServer_DeviceRef_t deviceRef;      ///< Device in data mode, NULL in command mode
+    int                     deviceFd;       ///< Copy of the device file descriptor
+    int                     deviceFlags;    ///< Device file status flags to restore
+    int                     modemFlags;     ///< Modem file status flags to restore
+    le_fdMonitor_Ref_t      deviceMonitor;  ///< Device monitor
+    le_fdMonitor_Ref_t      modemMonitor;   ///< Modem monitor
+    DataPath_t              toModem;        ///< Data from the device to the modem
+    DataPath_t              fromModem;      ///< Data from the modem to the device
+}
+DataMode_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Bridge context structure.
@@ -69,6 +114,10 @@ typedef struct
                                                                     ///< handler refenrece
     le_sem_Ref_t                                semRef;             ///< semaphore reference
     le_msg_SessionRef_t                         sessionRef;         ///< session reference
+    int                                         modemFd;            ///< modem file descriptor
+    bool                                        cmdInProgress;      ///< AT command sent to the
+                                                                    ///< modem
+    DataMode_t                                  dataMode;           ///< data mode context
 }
 BridgeCtx_t;
 
@@ -176,6 +225,13 @@ static char const* const AllRspCode[] =
 //--------------------------------------------------------------------------------------------------
 const char ErrorString[] = "ERROR";
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Final response of the modem when it switches to data mode.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char ConnectString[] = "CONNECT";
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Final response string to send to the AT command client
@@ -183,6 +239,494 @@ const char ErrorString[] = "ERROR";
 //--------------------------------------------------------------------------------------------------
 char AtClientFinalResponse[LE_ATDEFS_RESPONSE_MAX_BYTES];
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * AT client unsolicited handler
+ * All unsolicited coming from the AT client are sent to the hosts
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void UnsolicitedResponseHandler
+(
+    const char* unsolicitedRsp,
+    void* contextPtr
+)
+{
+    BridgeCtx_t* bridgeCtxPtr = contextPtr;
+
+    if (NULL == bridgeCtxPtr)
+    {
+        LE_ERROR("Bad parameter");
+        return;
+    }
+
+    le_dls_Link_t* linkPtr = le_dls_Peek(&bridgeCtxPtr->devicesList);
+
+
+    while (NULL != linkPtr)
+    {
+        DeviceLink_t* devLinkPtr = CONTAINER_OF(linkPtr,
+                                   DeviceLink_t,
+                                   link);
+
+        if (LE_OK != le_atServer_SendUnsolicitedResponse(unsolicitedRsp,
+                                                         LE_ATSERVER_SPECIFIC_DEVICE,
+                                                         devLinkPtr->deviceRef))
+        {
+            LE_ERROR("Error during sending unsol on %p", devLinkPtr->deviceRef);
+        }
+
+        linkPtr = le_dls_PeekNext(&bridgeCtxPtr->devicesList,linkPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the AT client on the modem. The AT client is given a copy of the modem file descriptor, so
+ * that the bridge can still use the modem in data mode.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to start the AT client.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t StartAtClient
+(
+    BridgeCtx_t* bridgePtr
+)
+{
+    int fd = dup(bridgePtr->modemFd);
+
+    if (-1 == fd)
+    {
+        LE_ERROR("Unable to duplicate modem fd: %m");
+        return LE_FAULT;
+    }
+
+    // fd now belongs to AT command client
+    bridgePtr->atClientRef = le_atClient_Start(fd);
+
+    if (NULL == bridgePtr->atClientRef)
+    {
+        LE_ERROR("ATClient error");
+        return LE_FAULT;
+    }
+
+    // Subscribe to all unsolicited responses
+    bridgePtr->unsolHandlerRef = le_atClient_AddUnsolicitedResponseHandler(
+                                                                        "",
+                                                                        bridgePtr->atClientRef,
+                                                                        UnsolicitedResponseHandler,
+                                                                        bridgePtr,
+                                                                        1);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stop the AT client on the modem.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StopAtClient
+(
+    BridgeCtx_t* bridgePtr
+)
+{
+    if (bridgePtr->unsolHandlerRef)
+    {
+        le_atClient_RemoveUnsolicitedResponseHandler(bridgePtr->unsolHandlerRef);
+        bridgePtr->unsolHandlerRef = NULL;
+    }
+
+    if (bridgePtr->atClientRef)
+    {
+        le_atClient_Stop(bridgePtr->atClientRef);
+        bridgePtr->atClientRef = NULL;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close the pipe of a data path: its data are then copied.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseDataPipe
+(
+    DataPath_t* pathPtr
+)
+{
+    if (-1 != pathPtr->pipeFd[0])
+    {
+        close(pathPtr->pipeFd[0]);
+        close(pathPtr->pipeFd[1]);
+        pathPtr->pipeFd[0] = -1;
+        pathPtr->pipeFd[1] = -1;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize a data path. The byte count is kept from a data mode session to the next.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitDataPath
+(
+    DataPath_t* pathPtr,
+    int         inFd,
+    int         outFd
+)
+{
+    pathPtr->inFd = inFd;
+    pathPtr->outFd = outFd;
+    pathPtr->offset = 0;
+    pathPtr->pendingSize = 0;
+
+    if (-1 == pipe2(pathPtr->pipeFd, O_NONBLOCK | O_CLOEXEC))
+    {
+        LE_WARN("Unable to create pipe (%m), data will be copied");
+        pathPtr->pipeFd[0] = -1;
+        pathPtr->pipeFd[1] = -1;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the data available on the input of a data path. Nothing is read while data are pending.
+ *
+ * @return
+ *      - LE_OK            The data available, if any, were read.
+ *      - LE_CLOSED        The input file descriptor was hung up.
+ *      - LE_FAULT         The function failed to read.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FillDataPath
+(
+    DataPath_t* pathPtr
+)
+{
+    ssize_t size;
+
+    if (pathPtr->pendingSize > 0)
+    {
+        return LE_OK;
+    }
+
+    do
+    {
+        if (-1 != pathPtr->pipeFd[0])
+        {
+            size = splice(pathPtr->inFd, NULL, pathPtr->pipeFd[1], NULL, sizeof(pathPtr->buf),
+                          SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        }
+        else
+        {
+            size = read(pathPtr->inFd, pathPtr->buf, sizeof(pathPtr->buf));
+        }
+    }
+    while ((-1 == size) && (EINTR == errno));
+
+    if (-1 == size)
+    {
+        if ((EINVAL == errno) && (-1 != pathPtr->pipeFd[0]))
+        {
+            LE_INFO("fd %d can't be spliced, data will be copied", pathPtr->inFd);
+            CloseDataPipe(pathPtr);
+            return FillDataPath(pathPtr);
+        }
+
+        if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+        {
+            return LE_OK;
+        }
+
+        LE_ERROR("Unable to read fd %d: %m", pathPtr->inFd);
+        return LE_FAULT;
+    }
+
+    if (0 == size)
+    {
+        return LE_CLOSED;
+    }
+
+    pathPtr->offset = 0;
+    pathPtr->pendingSize = size;
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the pending data of a data path to its output.
+ *
+ * @return
+ *      - LE_OK            All the pending data were written.
+ *      - LE_WOULD_BLOCK   The output can't take more data for now.
+ *      - LE_FAULT         The function failed to write.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FlushDataPath
+(
+    DataPath_t* pathPtr
+)
+{
+    while (pathPtr->pendingSize > 0)
+    {
+        ssize_t size;
+
+        if (-1 != pathPtr->pipeFd[0])
+        {
+            size = splice(pathPtr->pipeFd[0], NULL, pathPtr->outFd, NULL, pathPtr->pendingSize,
+                          SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        }
+        else
+        {
+            size = write(pathPtr->outFd, pathPtr->buf + pathPtr->offset, pathPtr->pendingSize);
+        }
+
+        if (-1 == size)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+            {
+                return LE_WOULD_BLOCK;
+            }
+
+            if ((EINVAL == errno) && (-1 != pathPtr->pipeFd[0]))
+            {
+                // Take the pending data out of the pipe, and copy them from now on
+                LE_INFO("fd %d can't be spliced, data will be copied", pathPtr->outFd);
+                if (read(pathPtr->pipeFd[0], pathPtr->buf, pathPtr->pendingSize) !=
+                    (ssize_t)pathPtr->pendingSize)
+                {
+                    LE_ERROR("Unable to read pipe: %m");
+                    return LE_FAULT;
+                }
+                pathPtr->offset = 0;
+                CloseDataPipe(pathPtr);
+                continue;
+            }
+
+            LE_ERROR("Unable to write fd %d: %m", pathPtr->outFd);
+            return LE_FAULT;
+        }
+
+        pathPtr->offset += size;
+        pathPtr->pendingSize -= size;
+        pathPtr->byteCount += size;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the resources of data mode, and give the device file descriptors back in their initial
+ * state.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseDataMode
+(
+    BridgeCtx_t* bridgePtr
+)
+{
+    DataMode_t* dataPtr = &bridgePtr->dataMode;
+
+    if (dataPtr->deviceMonitor)
+    {
+        le_fdMonitor_Delete(dataPtr->deviceMonitor);
+        dataPtr->deviceMonitor = NULL;
+    }
+
+    if (dataPtr->modemMonitor)
+    {
+        le_fdMonitor_Delete(dataPtr->modemMonitor);
+        dataPtr->modemMonitor = NULL;
+    }
+
+    CloseDataPipe(&dataPtr->toModem);
+    CloseDataPipe(&dataPtr->fromModem);
+
+    if (-1 != dataPtr->deviceFd)
+    {
+        // The file status flags are shared with the device file descriptor of the server
+        fcntl(dataPtr->deviceFd, F_SETFL, dataPtr->deviceFlags);
+        fcntl(bridgePtr->modemFd, F_SETFL, dataPtr->modemFlags);
+        close(dataPtr->deviceFd);
+        dataPtr->deviceFd = -1;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Leave data mode: the modem is given back to the AT client, and the device to the AT server.
+ * This function is called in the main thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndDataMode
+(
+    BridgeCtx_t* bridgePtr
+)
+{
+    DataMode_t* dataPtr = &bridgePtr->dataMode;
+    le_atServer_DeviceRef_t deviceRef = dataPtr->deviceRef;
+
+    if (NULL == deviceRef)
+    {
+        return;
+    }
+
+    ReleaseDataMode(bridgePtr);
+
+    LE_INFO("Device %p back in command mode, %"PRIu64" bytes sent to the modem, %"PRIu64
+            " bytes received", deviceRef, dataPtr->toModem.byteCount,
+            dataPtr->fromModem.byteCount);
+
+    if (LE_OK != StartAtClient(bridgePtr))
+    {
+        LE_ERROR("Unable to restart the AT client");
+    }
+
+    le_mutex_Lock(BridgeMutexRef);
+    dataPtr->deviceRef = NULL;
+    le_mutex_Unlock(BridgeMutexRef);
+
+    if (LE_OK != le_atServer_Resume(deviceRef))
+    {
+        LE_ERROR("Unable to resume device %p", deviceRef);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Data mode handler, called when the device or the modem can be read or written.
+ * The data read on one side are written to the other side. When the other side can't take more
+ * data, the reading stops until it can.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DataModeHandler
+(
+    int   fd,
+    short events
+)
+{
+    BridgeCtx_t* bridgePtr = le_fdMonitor_GetContextPtr();
+    DataMode_t*  dataPtr = &bridgePtr->dataMode;
+    bool         isModem = (fd == bridgePtr->modemFd);
+
+    DataPath_t*        rxPathPtr = isModem ? &dataPtr->fromModem : &dataPtr->toModem;
+    DataPath_t*        txPathPtr = isModem ? &dataPtr->toModem : &dataPtr->fromModem;
+    le_fdMonitor_Ref_t monitorRef = isModem ? dataPtr->modemMonitor : dataPtr->deviceMonitor;
+    le_fdMonitor_Ref_t peerMonitorRef = isModem ? dataPtr->deviceMonitor : dataPtr->modemMonitor;
+    le_result_t        result;
+
+    if (events & POLLOUT)
+    {
+        result = FlushDataPath(txPathPtr);
+        if (LE_OK == result)
+        {
+            le_fdMonitor_Disable(monitorRef, POLLOUT);
+            le_fdMonitor_Enable(peerMonitorRef, POLLIN);
+        }
+        else if (LE_WOULD_BLOCK != result)
+        {
+            EndDataMode(bridgePtr);
+            return;
+        }
+    }
+
+    if (events & POLLIN)
+    {
+        result = FillDataPath(rxPathPtr);
+        if (LE_OK == result)
+        {
+            result = FlushDataPath(rxPathPtr);
+        }
+
+        if (LE_WOULD_BLOCK == result)
+        {
+            le_fdMonitor_Disable(monitorRef, POLLIN);
+            le_fdMonitor_Enable(peerMonitorRef, POLLOUT);
+        }
+        else if (LE_OK != result)
+        {
+            LE_INFO("%s closed", isModem ? "Modem" : "Device");
+            EndDataMode(bridgePtr);
+        }
+    }
+    else if (events & (POLLHUP | POLLERR | POLLRDHUP))
+    {
+        LE_INFO("%s hung up", isModem ? "Modem" : "Device");
+        EndDataMode(bridgePtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enter data mode: the AT client stops using the modem, and the AT server stops using the device.
+ * This function is called in the main thread.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_FAULT         The function failed to enter data mode.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t BeginDataMode
+(
+    BridgeCtx_t*            bridgePtr,
+    le_atServer_DeviceRef_t deviceRef,
+    int                     deviceFd
+)
+{
+    DataMode_t* dataPtr = &bridgePtr->dataMode;
+
+    // The device fd is still registered in the event loop by the server, use a copy of it
+    dataPtr->deviceFd = dup(deviceFd);
+    if (-1 == dataPtr->deviceFd)
+    {
+        LE_ERROR("Unable to duplicate device fd: %m");
+        return LE_FAULT;
+    }
+
+    dataPtr->deviceFlags = fcntl(dataPtr->deviceFd, F_GETFL);
+    dataPtr->modemFlags = fcntl(bridgePtr->modemFd, F_GETFL);
+    if ((-1 == dataPtr->deviceFlags) || (-1 == dataPtr->modemFlags) ||
+        (-1 == fcntl(dataPtr->deviceFd, F_SETFL, dataPtr->deviceFlags | O_NONBLOCK)) ||
+        (-1 == fcntl(bridgePtr->modemFd, F_SETFL, dataPtr->modemFlags | O_NONBLOCK)))
+    {
+        LE_ERROR("Unable to set fd flags: %m");
+        ReleaseDataMode(bridgePtr);
+        return LE_FAULT;
+    }
+
+    InitDataPath(&dataPtr->toModem, dataPtr->deviceFd, bridgePtr->modemFd);
+    InitDataPath(&dataPtr->fromModem, bridgePtr->modemFd, dataPtr->deviceFd);
+
+    dataPtr->deviceMonitor = le_fdMonitor_Create("BridgeDeviceData", dataPtr->deviceFd,
+                                                 DataModeHandler, POLLIN);
+    dataPtr->modemMonitor = le_fdMonitor_Create("BridgeModemData", bridgePtr->modemFd,
+                                                DataModeHandler, POLLIN);
+    le_fdMonitor_SetContextPtr(dataPtr->deviceMonitor, bridgePtr);
+    le_fdMonitor_SetContextPtr(dataPtr->modemMonitor, bridgePtr);
+
+    if (LE_OK != le_atServer_Suspend(deviceRef))
+    {
+        LE_ERROR("Unable to suspend device %p", deviceRef);
+        ReleaseDataMode(bridgePtr);
+        return LE_FAULT;
+    }
+
+    StopAtClient(bridgePtr);
+
+    LE_INFO("Device %p in data mode", deviceRef);
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function is the destructor for ModemCmdDesc_t struct
@@ -250,16 +794,19 @@ static void BridgePoolDestructor
         le_ref_DeleteRef(BridgesRefMap, bridgePtr->bridgeRef);
     }
 
-    // Remove AT client unsolicited handler
-    if (bridgePtr->unsolHandlerRef)
+    // Leave data mode
+    if (bridgePtr->dataMode.deviceRef)
     {
-        le_atClient_RemoveUnsolicitedResponseHandler(bridgePtr->unsolHandlerRef);
+        ReleaseDataMode(bridgePtr);
+        le_atServer_Resume(bridgePtr->dataMode.deviceRef);
     }
 
-    // Close AT commands client
-    if (bridgePtr->atClientRef)
+    // Remove AT client unsolicited handler and close AT commands client
+    StopAtClient(bridgePtr);
+
+    if (-1 != bridgePtr->modemFd)
     {
-        le_atClient_Stop(bridgePtr->atClientRef);
+        close(bridgePtr->modemFd);
     }
 
     if (bridgePtr->semRef)
@@ -418,6 +965,15 @@ static void TreatResponse
 
         LE_DEBUG("finalRsp = %s", (finalRsp == LE_ATSERVER_OK) ? "ok": "error");
 
+        // The modem switched to data mode: the device that sent the command follows once the
+        // final response is sent. The command is not processing anymore at this point, so get
+        // its bridge and device now.
+        le_atServer_BridgeRef_t bridgeRef = NULL;
+        le_atServer_DeviceRef_t deviceRef = NULL;
+        bool connect = (0 == strncmp(rsp, ConnectString, sizeof(ConnectString) - 1)) &&
+                       (LE_OK == le_atServer_GetBridgeRef(atServerCmdRef, &bridgeRef)) &&
+                       (LE_OK == le_atServer_GetDevice(atServerCmdRef, &deviceRef));
+
         if (LE_OK != le_atServer_SendFinalResultCode(atServerCmdRef,
                                                      finalRsp,
                                                      rsp,
@@ -428,6 +984,11 @@ static void TreatResponse
             return;
         }
 
+        if (connect && (LE_OK != le_atServer_StartBridgeDataMode(bridgeRef, deviceRef)))
+        {
+            LE_ERROR("Unable to switch device %p to data mode", deviceRef);
+        }
+
         // "ERROR" final response could mean that the AT command doesn't exist => delete it in this
         // case
         if (0 == strncmp(rsp, ErrorString, sizeof(ErrorString)))
@@ -471,6 +1032,18 @@ static void SendAtCommand
         return;
     }
 
+    // The modem is not available for AT commands in data mode
+    if (bridgePtr->dataMode.deviceRef)
+    {
+        LE_ERROR("Bridge in data mode");
+        le_event_QueueFunctionToThread(bridgePtr->mainThreadRef,
+                                       TreatCommandError,
+                                       modemCmdDescRef,
+                                       NULL);
+        le_mutex_Unlock(BridgeMutexRef);
+        return;
+    }
+
     LE_DEBUG("AT command to be sent to the modem: %s", modemCmdDescPtr->cmd);
 
     // At this point, modemCmdDescPtr and bridgePtr are available , make a local copy for
@@ -480,6 +1053,7 @@ static void SendAtCommand
     le_thread_Ref_t mainThreadRef = bridgePtr->mainThreadRef;
     char   atClientCmd[LE_ATDEFS_COMMAND_MAX_BYTES] = {0};
     snprintf(atClientCmd, LE_ATDEFS_COMMAND_MAX_BYTES, "%s", modemCmdDescPtr->cmd);
+    bridgePtr->cmdInProgress = true;
     le_mutex_Unlock(BridgeMutexRef);
 
     // Send AT command to the modem
@@ -498,6 +1072,10 @@ static void SendAtCommand
 
     modemCmdDescPtr = le_ref_Lookup(ModemCmdRefMap, modemCmdDescRef);
     bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
+    if (bridgePtr)
+    {
+        bridgePtr->cmdInProgress = false;
+    }
     if (( NULL == modemCmdDescPtr ) || ( NULL == bridgePtr ))
     {
         LE_ERROR("bridge resources are not found");
@@ -839,47 +1417,6 @@ static void AtCmdHandler
                                    bridgeRef);
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * AT client unsolicited handler
- * All unsolicited coming from the AT client are sent to the hosts
- *
- */
-//--------------------------------------------------------------------------------------------------
-static void UnsolicitedResponseHandler
-(
-    const char* unsolicitedRsp,
-    void* contextPtr
-)
-{
-    BridgeCtx_t* bridgeCtxPtr = contextPtr;
-
-    if (NULL == bridgeCtxPtr)
-    {
-        LE_ERROR("Bad parameter");
-        return;
-    }
-
-    le_dls_Link_t* linkPtr = le_dls_Peek(&bridgeCtxPtr->devicesList);
-
-
-    while (NULL != linkPtr)
-    {
-        DeviceLink_t* devLinkPtr = CONTAINER_OF(linkPtr,
-                                   DeviceLink_t,
-                                   link);
-
-        if (LE_OK != le_atServer_SendUnsolicitedResponse(unsolicitedRsp,
-                                                         LE_ATSERVER_SPECIFIC_DEVICE,
-                                                         devLinkPtr->deviceRef))
-        {
-            LE_ERROR("Error during sending unsol on %p", devLinkPtr->deviceRef);
-        }
-
-        linkPtr = le_dls_PeekNext(&bridgeCtxPtr->devicesList,linkPtr);
-    }
-}
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Thread used for the bridge
@@ -1042,6 +1579,8 @@ le_atServer_BridgeRef_t bridge_Open
 
     bridgeCtxPtr->bridgeRef = le_ref_CreateRef(BridgesRefMap, bridgeCtxPtr);
     bridgeCtxPtr->devicesList = LE_DLS_LIST_INIT;
+    bridgeCtxPtr->modemFd = -1;
+    bridgeCtxPtr->dataMode.deviceFd = -1;
 
     bridgeCtxPtr->threadRef = le_thread_Create(name, BridgeThread, bridgeCtxPtr);
 
@@ -1070,25 +1609,15 @@ le_atServer_BridgeRef_t bridge_Open
 
     bridgeCtxPtr->mainThreadRef = le_thread_GetCurrent();
 
-    // Create the bridge with the AT client
-    // fd now belongs to AT command client
-    bridgeCtxPtr->atClientRef = le_atClient_Start(fd);
+    // Create the bridge with the AT client. The bridge keeps fd for data mode.
+    bridgeCtxPtr->modemFd = fd;
 
-    if (NULL == bridgeCtxPtr->atClientRef)
+    if (LE_OK != StartAtClient(bridgeCtxPtr))
     {
-        LE_ERROR("ATClient error");
         le_mem_Release(bridgeCtxPtr);
         return NULL;
     }
 
-    // Subscribe to all unsolicited responses
-    bridgeCtxPtr->unsolHandlerRef = le_atClient_AddUnsolicitedResponseHandler(
-                                                                        "",
-                                                                        bridgeCtxPtr->atClientRef,
-                                                                        UnsolicitedResponseHandler,
-                                                                        bridgeCtxPtr,
-                                                                        1);
-
     threadNumber++;
     bridgeCtxPtr->sessionRef = le_atServer_GetClientSessionRef();
 
@@ -1209,6 +1738,11 @@ le_result_t bridge_RemoveDevice
 
         if (devLinkPtr->deviceRef == deviceRef)
         {
+            if (bridgePtr->dataMode.deviceRef == deviceRef)
+            {
+                EndDataMode(bridgePtr);
+            }
+
             le_dls_Remove(&bridgePtr->devicesList, linkPtr);
             le_mem_Release(devLinkPtr);
             return LE_OK;
@@ -1330,3 +1864,129 @@ le_result_t bridge_ReleaseModemCmd
     le_mutex_Unlock(BridgeMutexRef);
     return LE_OK;
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Switch a bridged device to data mode
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid, or the device is not in the bridge.
+ *      - LE_BUSY          A device is already in data mode, or an AT command is in progress.
+ *      - LE_FAULT         The function failed to switch the device to data mode.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_StartDataMode
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef,
+    int                     deviceFd
+)
+{
+    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
+
+    if (NULL == bridgePtr)
+    {
+        LE_ERROR("No bridge device is found");
+        return LE_BAD_PARAMETER;
+    }
+
+    le_dls_Link_t* linkPtr = le_dls_Peek(&bridgePtr->devicesList);
+
+    while ((NULL != linkPtr) &&
+           (CONTAINER_OF(linkPtr, DeviceLink_t, link)->deviceRef != deviceRef))
+    {
+        linkPtr = le_dls_PeekNext(&bridgePtr->devicesList, linkPtr);
+    }
+
+    if (NULL == linkPtr)
+    {
+        LE_ERROR("Device %p not bridged", deviceRef);
+        return LE_BAD_PARAMETER;
+    }
+
+    le_mutex_Lock(BridgeMutexRef);
+    if (bridgePtr->dataMode.deviceRef || bridgePtr->cmdInProgress)
+    {
+        le_mutex_Unlock(BridgeMutexRef);
+        return LE_BUSY;
+    }
+    bridgePtr->dataMode.deviceRef = deviceRef;
+    le_mutex_Unlock(BridgeMutexRef);
+
+    if (LE_OK != BeginDataMode(bridgePtr, deviceRef, deviceFd))
+    {
+        le_mutex_Lock(BridgeMutexRef);
+        bridgePtr->dataMode.deviceRef = NULL;
+        le_mutex_Unlock(BridgeMutexRef);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Switch the device in data mode on a bridge back to command mode
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid.
+ *      - LE_NOT_FOUND     The device, or any device if deviceRef is NULL, is not in data mode on
+ *                         the bridge.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_StopDataMode
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef
+)
+{
+    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
+
+    if (NULL == bridgePtr)
+    {
+        LE_ERROR("No bridge device is found");
+        return LE_BAD_PARAMETER;
+    }
+
+    if ((NULL == bridgePtr->dataMode.deviceRef) ||
+        (deviceRef && (deviceRef != bridgePtr->dataMode.deviceRef)))
+    {
+        return LE_NOT_FOUND;
+    }
+
+    EndDataMode(bridgePtr);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of bytes relayed in data mode on a bridge
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_GetDataStats
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    uint64_t*               toModemBytesPtr,
+    uint64_t*               fromModemBytesPtr
+)
+{
+    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
+
+    if ((NULL == bridgePtr) || (NULL == toModemBytesPtr) || (NULL == fromModemBytesPtr))
+    {
+        LE_ERROR("Bad parameter");
+        return LE_BAD_PARAMETER;
+    }
+
+    *toModemBytesPtr = bridgePtr->dataMode.toModem.byteCount;
+    *fromModemBytesPtr = bridgePtr->dataMode.fromModem.byteCount;
+
+    return LE_OK;
+}
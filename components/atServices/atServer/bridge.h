@@ -135,4 +135,55 @@ le_result_t bridge_ReleaseModemCmd
     void* descRefPtr
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Switch a bridged device to data mode
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid, or the device is not in the bridge.
+ *      - LE_BUSY          A device is already in data mode, or an AT command is in progress.
+ *      - LE_FAULT         The function failed to switch the device to data mode.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_StartDataMode
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef,
+    int                     deviceFd
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Switch the device in data mode on a bridge back to command mode
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid.
+ *      - LE_NOT_FOUND     The device, or any device if deviceRef is NULL, is not in data mode on
+ *                         the bridge.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_StopDataMode
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    le_atServer_DeviceRef_t deviceRef
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of bytes relayed in data mode on a bridge
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t bridge_GetDataStats
+(
+    le_atServer_BridgeRef_t bridgeRef,
+    uint64_t*               toModemBytesPtr,
+    uint64_t*               fromModemBytesPtr
+);
+
 #endif //LEGATO_LE_BRIDGE_INCLUDE_GUARD
@@ -36,6 +36,13 @@
 //--------------------------------------------------------------------------------------------------
 #define CMD_STRING_TYPICAL_BYTES 32
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * AT command trie nodes pool size
+ */
+//--------------------------------------------------------------------------------------------------
+#define CMD_TRIE_POOL_SIZE   (4 * CMD_POOL_SIZE)
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Command parameters pool size
@@ -254,13 +261,6 @@ static le_ref_MapRef_t DevicesRefMap;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t   SubscribedCmdRefMap;
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Map for AT commands
- */
-//--------------------------------------------------------------------------------------------------
-static le_hashmap_Ref_t   CmdHashMap;
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Error codes current mode
@@ -719,6 +719,24 @@ typedef struct
 }
 DeviceContext_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * AT command trie node.
+ *
+ * The AT commands are stored in a prefix trie, keyed on the upper case characters of their names,
+ * so that commands are looked up regardless of case, and the longest command starting a basic
+ * format command line is found in a single pass.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct CmdTrieNode
+{
+    char                    key;                                    ///< upper case character
+    ATCmdSubscribed_t*      cmdPtr;                                 ///< cmd ending on this node
+    struct CmdTrieNode*     childPtr;                               ///< first node of next char
+    struct CmdTrieNode*     siblingPtr;                             ///< next node of same char
+}
+CmdTrieNode_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Info for registering commands
@@ -767,6 +785,22 @@ LE_MEM_DEFINE_STATIC_POOL(AtServerCommandsPool,
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t  AtCommandsPool;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static pool for AT command trie nodes
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(AtServerCmdTrieNodes,
+                          CMD_TRIE_POOL_SIZE,
+                          sizeof(CmdTrieNode_t));
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for AT command trie nodes
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t  CmdTrieNodePool;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Static pool for AT command strings
@@ -884,18 +918,10 @@ static le_ref_MapRef_t   SubscribedCmdRefMap;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Static hashmap for AT commands
+ * Root of the AT commands trie
  */
 //--------------------------------------------------------------------------------------------------
-LE_HASHMAP_DEFINE_STATIC(CmdHashMap, CMD_POOL_SIZE);
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Map for AT commands
- */
-//--------------------------------------------------------------------------------------------------
-static le_hashmap_Ref_t   CmdHashMap;
+static CmdTrieNode_t CmdTrieRoot;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -1042,6 +1068,159 @@ CmdParserFunc_t CmdParserTab[PARSE_MAX][PARSE_MAX] =
                          }
 };
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the child of a trie node for a character, regardless of case.
+ *
+ * @return
+ *      - Address of the link to the child, which points to NULL if there is no such child.
+ */
+//--------------------------------------------------------------------------------------------------
+static CmdTrieNode_t** FindCmdTrieChild
+(
+    CmdTrieNode_t* nodePtr,
+    char           key
+)
+{
+    CmdTrieNode_t** linkPtr = &nodePtr->childPtr;
+
+    key = toupper((unsigned char)key);
+    while ((*linkPtr != NULL) && ((*linkPtr)->key != key))
+    {
+        linkPtr = &(*linkPtr)->siblingPtr;
+    }
+
+    return linkPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add an AT command to the trie.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AddCmdToTrie
+(
+    const char*        namePtr,
+    ATCmdSubscribed_t* cmdPtr
+)
+{
+    CmdTrieNode_t* nodePtr = &CmdTrieRoot;
+
+    for (; *namePtr != '\0'; namePtr++)
+    {
+        CmdTrieNode_t** linkPtr = FindCmdTrieChild(nodePtr, *namePtr);
+
+        if (*linkPtr == NULL)
+        {
+            *linkPtr = le_mem_ForceAlloc(CmdTrieNodePool);
+            memset(*linkPtr, 0, sizeof(CmdTrieNode_t));
+            (*linkPtr)->key = toupper((unsigned char)*namePtr);
+        }
+
+        nodePtr = *linkPtr;
+    }
+
+    nodePtr->cmdPtr = cmdPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove an AT command from the trie below a node, and release the nodes left unused.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemoveCmdFromTrie
+(
+    CmdTrieNode_t* nodePtr,
+    const char*    namePtr
+)
+{
+    CmdTrieNode_t** linkPtr = FindCmdTrieChild(nodePtr, *namePtr);
+    CmdTrieNode_t*  childPtr = *linkPtr;
+
+    if (childPtr == NULL)
+    {
+        return;
+    }
+
+    if (namePtr[1] == '\0')
+    {
+        childPtr->cmdPtr = NULL;
+    }
+    else
+    {
+        RemoveCmdFromTrie(childPtr, namePtr + 1);
+    }
+
+    if ((childPtr->cmdPtr == NULL) && (childPtr->childPtr == NULL))
+    {
+        *linkPtr = childPtr->siblingPtr;
+        le_mem_Release(childPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get an AT command from its name, regardless of case.
+ *
+ * @return
+ *      - The AT command.
+ *      - NULL if the command doesn't exist.
+ */
+//--------------------------------------------------------------------------------------------------
+static ATCmdSubscribed_t* GetCmdFromTrie
+(
+    const char* namePtr
+)
+{
+    CmdTrieNode_t* nodePtr = &CmdTrieRoot;
+
+    for (; (*namePtr != '\0') && (nodePtr != NULL); namePtr++)
+    {
+        nodePtr = *FindCmdTrieChild(nodePtr, *namePtr);
+    }
+
+    return (nodePtr != NULL) ? nodePtr->cmdPtr : NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the longest AT command that starts a string, regardless of case.
+ *
+ * @return
+ *      - The AT command, whose name length is returned in lenPtr.
+ *      - NULL if no command longer than minLen starts the string.
+ */
+//--------------------------------------------------------------------------------------------------
+static ATCmdSubscribed_t* GetLongestCmdFromTrie
+(
+    const char* strPtr,     ///< [IN] String starting with the command
+    size_t      strLen,     ///< [IN] String length
+    size_t      minLen,     ///< [IN] Length the command name must exceed
+    size_t*     lenPtr      ///< [OUT] Command name length
+)
+{
+    CmdTrieNode_t*     nodePtr = &CmdTrieRoot;
+    ATCmdSubscribed_t* cmdPtr = NULL;
+    size_t             i;
+
+    for (i = 0; i < strLen; i++)
+    {
+        nodePtr = *FindCmdTrieChild(nodePtr, strPtr[i]);
+        if (nodePtr == NULL)
+        {
+            break;
+        }
+
+        if ((nodePtr->cmdPtr != NULL) && (i + 1 > minLen))
+        {
+            cmdPtr = nodePtr->cmdPtr;
+            *lenPtr = i + 1;
+        }
+    }
+
+    return cmdPtr;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function is the destructor for ATCmdSubscribed_t struct
@@ -1058,8 +1237,8 @@ static void AtCmdPoolDestructor
 
     LE_DEBUG("AT command destructor for '%s'", cmdPtr->cmdName);
 
-    // cleanup the hashmap
-    le_hashmap_Remove(CmdHashMap, cmdPtr->cmdName);
+    // cleanup the trie
+    RemoveCmdFromTrie(&CmdTrieRoot, cmdPtr->cmdName);
     le_mem_Release(cmdPtr->cmdName);
 
     // cleanup ParamList dls pool
@@ -1490,8 +1669,7 @@ static le_result_t CreateModemCommand
         return LE_FAULT;
     }
 
-    cmdParserPtr->currentCmdPtr = le_hashmap_Get(CmdHashMap,
-                                                 atCmdPtr);
+    cmdParserPtr->currentCmdPtr = GetCmdFromTrie(atCmdPtr);
 
     if ( cmdParserPtr->currentCmdPtr == NULL )
     {
@@ -1536,7 +1714,7 @@ static le_result_t GetAtCmdContext
 
     if (cmdParserPtr->currentCmdPtr == NULL)
     {
-        cmdParserPtr->currentCmdPtr = le_hashmap_Get(CmdHashMap, cmdParserPtr->currentAtCmdPtr);
+        cmdParserPtr->currentCmdPtr = GetCmdFromTrie(cmdParserPtr->currentAtCmdPtr);
 
         if ( cmdParserPtr->currentCmdPtr == NULL )
         {
@@ -2000,30 +2178,22 @@ static le_result_t ParseBasic
     }
 
     uint32_t len = cmdParserPtr->currentCharPtr-cmdParserPtr->currentAtCmdPtr+1;
-#if !MK_CONFIG_DISABLE_AT_BRIDGE
-    char* initialPosPtr = cmdParserPtr->currentCharPtr;
-#endif
-    char atCmd[len];
-    memset(atCmd,0,len);
-    strncpy(atCmd, cmdParserPtr->currentAtCmdPtr, len-1);
+    size_t cmdLen = 0;
 
-    while (strlen(atCmd) > 2)
-    {
-        cmdParserPtr->currentCmdPtr = le_hashmap_Get(CmdHashMap, atCmd);
+    // Find the longest command (other than "AT") the basic format command line starts with
+    cmdParserPtr->currentCmdPtr = GetLongestCmdFromTrie(cmdParserPtr->currentAtCmdPtr,
+                                                        len-1,
+                                                        2,
+                                                        &cmdLen);
 
-        if ( cmdParserPtr->currentCmdPtr == NULL )
-        {
-            atCmd[strlen(atCmd)-1] = '\0';
-            cmdParserPtr->currentCharPtr--;
-        }
-        else
-        {
-            BasicCmdFound(cmdParserPtr);
+    if ( cmdParserPtr->currentCmdPtr != NULL )
+    {
+        BasicCmdFound(cmdParserPtr);
 
-            cmdParserPtr->currentCharPtr--;
+        // Put the index on the last character of the command
+        cmdParserPtr->currentCharPtr = cmdParserPtr->currentAtCmdPtr + cmdLen - 1;
 
-            return LE_OK;
-        }
+        return LE_OK;
     }
 
 #if !MK_CONFIG_DISABLE_AT_BRIDGE
@@ -2031,9 +2201,8 @@ static le_result_t ParseBasic
 
     if ( devPtr->bridgeRef )
     {
-        //Reset the pointer to its initial value
-        cmdParserPtr->currentCharPtr = initialPosPtr;
-
+        char atCmd[len];
+        memset(atCmd,0,len);
         strncpy(atCmd, cmdParserPtr->currentAtCmdPtr, len-1);
 
         if (( CreateModemCommand(cmdParserPtr,
@@ -3008,6 +3177,14 @@ static le_result_t CloseServer
 
     LE_DEBUG("Stopping device %"PRIi32"", devPtr->device.fd);
 
+#if !MK_CONFIG_DISABLE_AT_BRIDGE
+    // Leave data mode while the device is still open
+    if (devPtr->bridgeRef)
+    {
+        bridge_StopDataMode(devPtr->bridgeRef, devRef);
+    }
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+
     le_dev_DeleteFdMonitoring(&devPtr->device);
 
 #if LE_CONFIG_LINUX
@@ -3394,7 +3571,7 @@ le_atServer_CmdRef_t le_atServer_Create
 )
 {
     // Search if the command already exists
-    ATCmdSubscribed_t* cmdPtr = le_hashmap_Get(CmdHashMap, namePtr);
+    ATCmdSubscribed_t* cmdPtr = GetCmdFromTrie(namePtr);
 
     // if the command exists return its reference
     if (cmdPtr)
@@ -3421,7 +3598,7 @@ le_atServer_CmdRef_t le_atServer_Create
 
     cmdPtr->cmdRef = le_ref_CreateRef(SubscribedCmdRefMap, cmdPtr);
 
-    le_hashmap_Put(CmdHashMap, cmdPtr->cmdName, cmdPtr);
+    AddCmdToTrie(cmdPtr->cmdName, cmdPtr);
 
     cmdPtr->availableDevice = LE_ATSERVER_ALL_DEVICES;
     cmdPtr->paramList = LE_DLS_LIST_INIT;
@@ -3486,35 +3663,19 @@ le_result_t le_atServer_Delete
  * handler.
  */
 //--------------------------------------------------------------------------------------------------
-static bool CallCmdRegistrationHandler
+static void CallCmdRegistrationHandler
 (
-    const void* keyPtr,
-    const void* valuePtr,
-    void* contextPtr
+    const ATCmdSubscribed_t* cmdPtr,
+    CmdRegHandlerInfo_t*     handlerInfoPtr
 )
 {
-    if (valuePtr == NULL)
-    {
-        LE_WARN("AT command '%s' is not properly created", (char*)keyPtr);
-        return true;
-    }
-
-    const ATCmdSubscribed_t* cmdPtr = valuePtr;
     if (!cmdPtr->handlerFunc)
     {
-        LE_WARN("AT command '%s' does not have a handler", (char*)keyPtr);
-        return true;
-    }
-
-    if (contextPtr == NULL)
-    {
-        LE_ERROR("No command registration handler found for AT command '%s'", (char*)keyPtr);
-        return true;
+        LE_WARN("AT command '%s' does not have a handler", cmdPtr->cmdName);
+        return;
     }
 
-    CmdRegHandlerInfo_t* handlerInfoPtr = (CmdRegHandlerInfo_t*)contextPtr;
     (*handlerInfoPtr->clientHandlerFunc)(cmdPtr->cmdRef, handlerInfoPtr->contextPtr);
-    return true;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -3553,7 +3714,11 @@ LE_SHARED le_atServer_CmdRegistrationHandlerRef_t le_atServer_AddCmdRegistration
     CmdRegHandlerInfo_t handlerInfo;
     handlerInfo.clientHandlerFunc = handlerPtr;
     handlerInfo.contextPtr = contextPtr;
-    le_hashmap_ForEach(CmdHashMap, CallCmdRegistrationHandler, &handlerInfo);
+    le_ref_IterRef_t iter = le_ref_GetIterator(SubscribedCmdRefMap);
+    while (LE_OK == le_ref_NextNode(iter))
+    {
+        CallCmdRegistrationHandler(le_ref_GetValue(iter), &handlerInfo);
+    }
 
     return (le_atServer_CmdRegistrationHandlerRef_t)(handlerRef);
 }
@@ -4208,6 +4373,106 @@ le_result_t le_atServer_RemoveDeviceFromBridge
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function switches a bridged device to data mode: the data received on the device are sent
+ * as is to the modem, and the data received from the modem are sent as is to the device.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The device or the bridge is invalid, or the device is not bridged.
+ *      - LE_BUSY          A device is already in data mode, or an AT command is in progress on
+ *                         the bridge.
+ *      - LE_FAULT         The function failed to switch the device to data mode.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_StartBridgeDataMode
+(
+    le_atServer_BridgeRef_t bridgeRef,
+        ///< [IN] Bridge reference
+
+    le_atServer_DeviceRef_t deviceRef
+        ///< [IN] Device to switch to data mode
+)
+{
+#if MK_CONFIG_DISABLE_AT_BRIDGE
+    return LE_BAD_PARAMETER;
+#else /* !MK_CONFIG_DISABLE_AT_BRIDGE */
+    DeviceContext_t* devPtr = le_ref_Lookup(DevicesRefMap, deviceRef);
+
+    if (devPtr == NULL)
+    {
+        LE_ERROR("Bad device reference");
+        return LE_BAD_PARAMETER;
+    }
+
+    if (devPtr->bridgeRef != bridgeRef)
+    {
+        LE_ERROR("Device not bridged");
+        return LE_BAD_PARAMETER;
+    }
+
+    if (devPtr->suspended)
+    {
+        LE_ERROR("Device already suspended");
+        return LE_BUSY;
+    }
+
+    return bridge_StartDataMode(bridgeRef, deviceRef, devPtr->device.fd);
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function switches the device in data mode on a bridge back to command mode.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid.
+ *      - LE_NOT_FOUND     No device is in data mode on the bridge.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_StopBridgeDataMode
+(
+    le_atServer_BridgeRef_t bridgeRef
+        ///< [IN] Bridge reference
+)
+{
+#if MK_CONFIG_DISABLE_AT_BRIDGE
+    return LE_BAD_PARAMETER;
+#else /* !MK_CONFIG_DISABLE_AT_BRIDGE */
+    return bridge_StopDataMode(bridgeRef, NULL);
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function gets the number of bytes relayed in data mode since the bridge was opened.
+ *
+ * @return
+ *      - LE_OK            The function succeeded.
+ *      - LE_BAD_PARAMETER The bridge is invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atServer_GetBridgeDataStats
+(
+    le_atServer_BridgeRef_t bridgeRef,
+        ///< [IN] Bridge reference
+
+    uint64_t* toModemBytesPtr,
+        ///< [OUT] Bytes sent from the devices to the modem
+
+    uint64_t* fromModemBytesPtr
+        ///< [OUT] Bytes sent from the modem to the devices
+)
+{
+#if MK_CONFIG_DISABLE_AT_BRIDGE
+    return LE_BAD_PARAMETER;
+#else /* !MK_CONFIG_DISABLE_AT_BRIDGE */
+    return bridge_GetDataStats(bridgeRef, toModemBytesPtr, fromModemBytesPtr);
+#endif /* end !MK_CONFIG_DISABLE_AT_BRIDGE */
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function enables verbose error codes on the selected device
@@ -4449,10 +4714,9 @@ COMPONENT_INIT
                                            sizeof(ATCmdSubscribed_t));
     le_mem_SetDestructor(AtCommandsPool,AtCmdPoolDestructor);
     SubscribedCmdRefMap = le_ref_InitStaticMap(SubscribedCmdRefMap, CMD_POOL_SIZE);
-    CmdHashMap = le_hashmap_InitStatic(CmdHashMap,
-                                    CMD_POOL_SIZE,
-                                    le_hashmap_HashString,
-                                       le_hashmap_EqualsString);
+    CmdTrieNodePool = le_mem_InitStaticPool(AtServerCmdTrieNodes,
+                                            CMD_TRIE_POOL_SIZE,
+                                            sizeof(CmdTrieNode_t));
 
     // AT command strings pool allocation
     AtCommandStringsPool = le_mem_InitStaticPool(AtServerCommandStringsPool,
@@ -2822,6 +2822,47 @@ le_result_t le_audio_Flush
     return le_media_Flush(streamPtr);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of playback underruns of a player stream, i.e. the number of periods of the
+ * audio driver which could not be filled in time with the samples of the pipe, since the stream
+ * was opened.
+ *
+ * @return LE_BAD_PARAMETER The stream is not a player stream.
+ * @return LE_OK            Function succeeded.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_audio_GetUnderrunCount
+(
+    le_audio_StreamRef_t streamRef,
+        ///< [IN]
+        ///< Audio stream reference.
+
+    uint32_t* countPtr
+        ///< [OUT]
+        ///< Number of underruns.
+)
+{
+    le_audio_Stream_t* streamPtr = le_ref_Lookup(AudioStreamRefMap, streamRef);
+
+    if (streamPtr == NULL)
+    {
+        LE_KILL_CLIENT("Invalid reference (%p) provided!", streamRef);
+        return LE_FAULT;
+    }
+
+    if (streamPtr->audioInterface != LE_AUDIO_IF_DSP_FRONTEND_FILE_PLAY)
+    {
+        LE_ERROR("Not a player stream");
+        return LE_BAD_PARAMETER;
+    }
+
+    *countPtr = streamPtr->underrunCount;
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Play a file on a playback stream.
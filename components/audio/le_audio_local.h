@@ -172,6 +172,10 @@ typedef struct le_audio_MediaThreadContext
     CloseMediaFunc_t                 closeFunc;          ///< Close function for play/capture
                                                          ///< in WAV/AMR format
     le_audio_Codec_t                 codecParams;        ///< Codec parameters
+    uint32_t                         prefetchSize;       ///< Bytes of the played file to read
+                                                         ///< ahead (0 if not a regular file)
+    off_t                            prefetchEnd;        ///< End of the file range already
+                                                         ///< requested to be read ahead
 }
 le_audio_MediaThreadContext_t;
 
@@ -208,6 +212,8 @@ typedef struct le_audio_Stream {
     pa_audio_Params_t   PaParams;                      ///< PA Parameters
     bool echoCancellerEnabled;                         ///< Store the status of echo canceller
     bool noiseSuppressorEnabled;                       ///< Store the status of noise suppressor
+    uint32_t            underrunCount;                 ///< Playback periods the client did not
+                                                       ///  fill in time
 }
 le_audio_Stream_t;
 
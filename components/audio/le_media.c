@@ -57,6 +57,14 @@
 //--------------------------------------------------------------------------------------------------
 #define NO_MORE_SAMPLES_INFINITE_TIMEOUT -1
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Amount of audio, in milliseconds, buffered ahead of the playback when playing a file: the pipe
+ * to the PCM thread is sized to hold it, and the file is read ahead by at least as much.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MEDIA_PREFETCH_MS   500
+
 //--------------------------------------------------------------------------------------------------
 // Data structures.
 //--------------------------------------------------------------------------------------------------
@@ -423,7 +431,9 @@ static le_result_t PlayTone
     uint32_t*                      bufferLenPtr  ///< [OUT] Length of the buffer
 )
 {
-    double   d1, d2;
+    double   w1, w2;
+    double   k1, k2;
+    double   y1, y1Prev, y2, y2Prev;
     uint32_t i;
 
     DtmfParams_t*  dtmfParamsPtr = (DtmfParams_t*) mediaCtxPtr->codecParams;
@@ -493,19 +503,34 @@ static le_result_t PlayTone
         amp1 = DTMF_AMPLITUDE;
         amp2 = DTMF_AMPLITUDE;
 
-        d1 = 1.0f * freq1 / dtmfParamsPtr->sampleRate;
-        d2 = 1.0f * freq2 / dtmfParamsPtr->sampleRate;
-
-        for (i = dtmfParamsPtr->currentSampleCount;
+        w1 = 2 * PI * freq1 / dtmfParamsPtr->sampleRate;
+        w2 = 2 * PI * freq2 / dtmfParamsPtr->sampleRate;
+
+        // The tones are produced by recursive oscillators:
+        //   A.sin((n+1)w) = 2.cos(w).A.sin(nw) - A.sin((n-1)w)
+        // so that the sine is only computed to seed them, once per call.
+        i = dtmfParamsPtr->currentSampleCount;
+        k1 = 2 * cos(w1);
+        k2 = 2 * cos(w2);
+        y1 = SAMPLE_SCALE * amp1 / 100.0f * sin(w1 * i);
+        y1Prev = SAMPLE_SCALE * amp1 / 100.0f * sin(w1 * ((double)i - 1));
+        y2 = SAMPLE_SCALE * amp2 / 100.0f * sin(w2 * i);
+        y2Prev = SAMPLE_SCALE * amp2 / 100.0f * sin(w2 * ((double)i - 1));
+
+        for (;
              // Play max sampleRate (1s) of DTMF and continue at next call
              (i < sampleOneSecond) && (i < samplesCount);
              i++)
         {
-            int16_t s1, s2;
+            double y1Next = k1 * y1 - y1Prev;
+            double y2Next = k2 * y2 - y2Prev;
+
+            *(dataPtr++) = SaturateAdd16((int16_t)y1, (int16_t)y2);
 
-            s1 = (int16_t)(SAMPLE_SCALE * amp1 / 100.0f * sin(2 * PI * d1 * i));
-            s2 = (int16_t)(SAMPLE_SCALE * amp2 / 100.0f * sin(2 * PI * d2 * i));
-            *(dataPtr++) = SaturateAdd16(s1, s2);
+            y1Prev = y1;
+            y1 = y1Next;
+            y2Prev = y2;
+            y2 = y2Next;
         }
 
         // Save the current sample count. If the whole DTMF is played, reset to 0
@@ -760,7 +785,7 @@ static le_result_t InitPlayWavFile
         return LE_FAULT;
     }
 
-    mediaCtxPtr->bufferSize = PIPE_BUF/4;
+    mediaCtxPtr->bufferSize = PIPE_BUF;
 
     return LE_OK;
 }
@@ -846,6 +871,81 @@ static void DestroyMediaThread
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set up the read ahead of a played file: size the pipe to the PCM thread to hold
+ * MEDIA_PREFETCH_MS of samples, and tell the kernel the file is read sequentially.
+ *
+ * Read ahead is only an optimization: any failure (e.g. the application passed a pipe or a socket
+ * instead of a file) is ignored.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitPlayPrefetch
+(
+    le_audio_MediaThreadContext_t* mediaCtxPtr,       ///< [IN] Media thread context
+    le_audio_SamplePcmConfig_t*    samplePcmConfigPtr ///< [IN] Sample configuration
+)
+{
+    uint64_t prefetchSize = (uint64_t) samplePcmConfigPtr->sampleRate *
+                            samplePcmConfigPtr->channelsCount *
+                            (samplePcmConfigPtr->bitsPerSample / 8) *
+                            MEDIA_PREFETCH_MS / 1000;
+
+    if (prefetchSize > INT32_MAX)
+    {
+        prefetchSize = INT32_MAX;
+    }
+
+#ifdef F_SETPIPE_SZ
+    int pipeSize = fcntl(mediaCtxPtr->fd_pipe_input, F_GETPIPE_SZ);
+
+    if ((pipeSize >= 0) && (pipeSize < (int) prefetchSize))
+    {
+        // May fail if the size is above /proc/sys/fs/pipe-max-size: keep the default one.
+        if (fcntl(mediaCtxPtr->fd_pipe_input, F_SETPIPE_SZ, (int) prefetchSize) < 0)
+        {
+            LE_WARN("Cannot set pipe size to %d bytes (%m)", (int) prefetchSize);
+        }
+    }
+#endif
+
+    if (posix_fadvise(mediaCtxPtr->fd_arg, 0, 0, POSIX_FADV_SEQUENTIAL) == 0)
+    {
+        mediaCtxPtr->prefetchSize = prefetchSize;
+        mediaCtxPtr->prefetchEnd = 0;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Keep at least prefetchSize bytes of the played file requested ahead of the current read
+ * position, so the kernel fetches them asynchronously while the media thread decodes.
+ * The window is advanced by whole prefetchSize steps to keep the number of hints low.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrefetchFile
+(
+    le_audio_MediaThreadContext_t* mediaCtxPtr  ///< [IN] Media thread context
+)
+{
+    off_t pos = lseek(mediaCtxPtr->fd_in, 0, SEEK_CUR);
+
+    if (pos < 0)
+    {
+        mediaCtxPtr->prefetchSize = 0;
+        return;
+    }
+
+    if ((pos + (off_t) mediaCtxPtr->prefetchSize) > mediaCtxPtr->prefetchEnd)
+    {
+        off_t start = (mediaCtxPtr->prefetchEnd > pos) ? mediaCtxPtr->prefetchEnd : pos;
+        off_t end = pos + (2 * (off_t) mediaCtxPtr->prefetchSize);
+
+        posix_fadvise(mediaCtxPtr->fd_in, start, end - start, POSIX_FADV_WILLNEED);
+        mediaCtxPtr->prefetchEnd = end;
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Media thread.
@@ -872,6 +972,11 @@ static void* MediaThread
 
     while (1)
     {
+        if (mediaCtxPtr->prefetchSize)
+        {
+            PrefetchFile(mediaCtxPtr);
+        }
+
         memset(outBuffer,0,mediaCtxPtr->bufferSize);
 
         /* read/decode the packet */
@@ -1456,6 +1561,8 @@ static le_result_t GetPlaybackFrames
             case 0:
                 // timeout: no data read
                 LE_DEBUG("No data read");
+                // the period is sent short (or as silence): the client didn't keep up
+                streamPtr->underrunCount++;
                 if (!amount)
                 {
                     // no more samples available at this point:
@@ -1763,6 +1870,8 @@ le_result_t le_media_Open
                 streamPtr->mediaThreadContextPtr = mediaCtxPtr;
                 streamPtr->fd =mediaCtxPtr->fd_pipe_output;
 
+                InitPlayPrefetch(mediaCtxPtr, samplePcmConfigPtr);
+
                 LE_DEBUG("Pipe created, fd_pipe_input.%d fd_pipe_output.%d fd_arg.%d",
                             mediaCtxPtr->fd_pipe_input,
                             mediaCtxPtr->fd_pipe_output,
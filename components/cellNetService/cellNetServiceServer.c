@@ -72,6 +72,16 @@ static le_event_Id_t CellNetStateEvent;
 //--------------------------------------------------------------------------------------------------
 static le_cellnet_State_t CurrentState = LE_CELLNET_REG_UNKNOWN;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Whether a SIM card is present in the selected slot, as last read from the modem.  It is only
+ * valid if IsSimPresenceKnown is true, and is forgotten on every SIM state event, so that network
+ * registration events don't need to query the SIM state.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSimPresent = false;
+static bool IsSimPresenceKnown = false;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * List of cellular network state strings
@@ -191,6 +201,26 @@ static void LoadSimFromSecStore
     LE_DEBUG("Load SIM information is done");
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a SIM card is present in the selected slot.  The modem is only queried if the
+ * SIM state has changed since the last check.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool CheckSimPresent
+(
+    void
+)
+{
+    if (!IsSimPresenceKnown)
+    {
+        IsSimPresent = le_sim_IsPresent(le_sim_GetSelectedCard());
+        IsSimPresenceKnown = true;
+    }
+
+    return IsSimPresent;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Translate MRC states to CellNet states
@@ -201,10 +231,8 @@ static le_cellnet_State_t TranslateToCellNetState
     le_mrc_NetRegState_t state
 )
 {
-    le_sim_Id_t simSelected = le_sim_GetSelectedCard();
-
     // Check if the SIM card is present
-    if (!le_sim_IsPresent(simSelected))
+    if (!CheckSimPresent())
     {
         // SIM card absent
         return LE_CELLNET_SIM_ABSENT;
@@ -252,14 +280,22 @@ static le_cellnet_State_t TranslateToCellNetState
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Report connection state event to the registered applications
+ * Report connection state event to the registered applications.  Unless forced, the event is only
+ * reported if the state has changed since the last one.
  */
 //--------------------------------------------------------------------------------------------------
 static void ReportCellNetStateEvent
 (
-    le_cellnet_State_t state
+    le_cellnet_State_t state,
+    bool               force
 )
 {
+    if ((!force) && (state == CurrentState))
+    {
+        LE_DEBUG("Cellular network state %d (%s) unchanged", state, cellNetStateStr[state]);
+        return;
+    }
+
     LE_DEBUG("Report cellular network state %d (%s)", state, cellNetStateStr[state]);
 
     // Update current network cell state
@@ -271,17 +307,23 @@ static void ReportCellNetStateEvent
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Send connection state event
+ * Read the network registration state and send connection state event
  */
 //--------------------------------------------------------------------------------------------------
 static void GetAndSendCellNetStateEvent
 (
-    void
+    bool force      ///< [IN] Report the state even if it hasn't changed.
 )
 {
     le_mrc_NetRegState_t state        = LE_MRC_REG_UNKNOWN;
     le_cellnet_State_t   cellNetState = LE_CELLNET_REG_UNKNOWN;
 
+    if (force)
+    {
+        // The SIM card may have been changed without any SIM state event
+        IsSimPresenceKnown = false;
+    }
+
     // Retrieve network registration state
     if (LE_OK == le_mrc_GetNetRegState(&state))
     {
@@ -296,7 +338,7 @@ static void GetAndSendCellNetStateEvent
              state, cellNetState, cellNetStateStr[cellNetState]);
 
     // Send the state event to applications
-    ReportCellNetStateEvent(cellNetState);
+    ReportCellNetStateEvent(cellNetState, force);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -336,7 +378,7 @@ static void StartCellNetTimerHandler
             }
 
             // Notify the applications even if the SIM is absent
-            GetAndSendCellNetStateEvent();
+            GetAndSendCellNetStateEvent(true);
         }
         else
         {
@@ -373,7 +415,7 @@ static void StartCellularNetwork
         }
 
         // Notify the applications even if the SIM is absent
-        GetAndSendCellNetStateEvent();
+        GetAndSendCellNetStateEvent(true);
     }
     else
     {
@@ -518,17 +560,20 @@ static void SimStateHandler
     void*           contextPtr
 )
 {
+    // The SIM presence will be read again when needed
+    IsSimPresenceKnown = false;
+
     if (LE_SIM_INSERTED == simState)
     {
         // SIM card inserted: load the configuration and notify the applications
         LoadSimFromSecStore(simId);
-        GetAndSendCellNetStateEvent();
+        GetAndSendCellNetStateEvent(false);
     }
 
     if ((LE_SIM_ABSENT == simState) || (LE_SIM_POWER_DOWN == simState))
     {
         // SIM card removed or powered down: notify the applications
-        GetAndSendCellNetStateEvent();
+        GetAndSendCellNetStateEvent(false);
     }
 }
 
@@ -548,8 +593,8 @@ static void MrcNetRegHandler
     LE_DEBUG("MRC network state %d translated to Cellular network state %d (%s)",
              state, cellNetState, cellNetStateStr[cellNetState]);
 
-    // Send the state event to applications
-    ReportCellNetStateEvent(cellNetState);
+    // Send the state event to applications, if it has changed
+    ReportCellNetStateEvent(cellNetState, false);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -748,7 +793,7 @@ le_result_t le_cellnet_SetSimPinCode
 
             // New SIM pincode is taken into account
             LoadSimFromSecStore(simId);
-            GetAndSendCellNetStateEvent();
+            GetAndSendCellNetStateEvent(false);
         }
         else
         {
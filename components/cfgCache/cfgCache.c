@@ -0,0 +1,232 @@
+//--------------------------------------------------------------------------------------------------
+/** @file cfgCache.c
+ *
+ * Cached, read-only, copies of config tree subtrees.  Each path read gets an entry, which keeps
+ * the path's change handler registered for the life of the process, and the copy of the subtree
+ * while it is current.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "cfgCache.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expected number of paths cached by a process.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CACHE_SIZE_ESTIMATE     31
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A cached path.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char path[LE_CFG_STR_LEN_BYTES];            ///< Path, as given to cfgCache_Read().
+    le_cfg_ChangeHandlerRef_t handlerRef;       ///< Change handler registered on the path.
+    bool isCurrent;                             ///< Whether the result below is up to date.
+    le_result_t result;                         ///< Result of the last read.
+    cfgSubtree_NodeRef_t rootRef;               ///< Copy read, if the result is LE_OK.
+}
+Entry_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for the cache entries.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t EntryPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Cache entries, by path.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t EntryMap;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drop an entry's copy.  The entry itself stays, so that its change handler isn't registered
+ * again when the path is next read.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DropCopy
+(
+    Entry_t* entryPtr                           ///< [IN] The entry.
+)
+{
+    if (entryPtr->rootRef != NULL)
+    {
+        cfgSubtree_Delete(entryPtr->rootRef);
+        entryPtr->rootRef = NULL;
+    }
+
+    entryPtr->isCurrent = false;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when something at or under a cached path changes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ChangeHandler
+(
+    void* contextPtr                            ///< [IN] The entry for the path.
+)
+{
+    Entry_t* entryPtr = contextPtr;
+
+    LE_DEBUG("'%s' changed.", entryPtr->path);
+
+    DropCopy(entryPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a path is another one, or one of its ancestors.
+ *
+ * @return
+ *      True if it is.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSameOrAncestor
+(
+    const char* ancestorPtr,                    ///< [IN] The possible ancestor.
+    const char* pathPtr                         ///< [IN] The path.
+)
+{
+    size_t length = strlen(ancestorPtr);
+
+    if (strncmp(ancestorPtr, pathPtr, length) != 0)
+    {
+        return false;
+    }
+
+    return (pathPtr[length] == '\0') ||
+           (pathPtr[length] == '/') ||
+           ((length > 0) && ((ancestorPtr[length - 1] == '/') || (ancestorPtr[length - 1] == ':')));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the cached copy of a node and all of its children, reading it from the Config Tree if there
+ * is none.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the node doesn't exist.
+ *      LE_FORMAT_ERROR if the subtree couldn't be parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgCache_Read
+(
+    const char* pathPtr,                ///< [IN]  Absolute path to the node, optionally prefixed
+                                        ///<       with a tree name ("tree:/path").
+    cfgSubtree_NodeRef_t* rootRefPtr    ///< [OUT] Root of the copy.  Owned by the cache: don't
+                                        ///<       delete it, nor keep it past the return to the
+                                        ///<       event loop.
+)
+{
+    Entry_t* entryPtr = le_hashmap_Get(EntryMap, pathPtr);
+
+    if (entryPtr == NULL)
+    {
+        entryPtr = le_mem_ForceAlloc(EntryPool);
+        memset(entryPtr, 0, sizeof(*entryPtr));
+
+        LE_FATAL_IF(le_utf8_Copy(entryPtr->path, pathPtr, sizeof(entryPtr->path), NULL) != LE_OK,
+                    "Config path '%s' is too long.", pathPtr);
+
+        // Register for changes before reading, so that no change made after the read can be
+        // missed.
+        entryPtr->handlerRef = le_cfg_AddChangeHandler(entryPtr->path, ChangeHandler, entryPtr);
+
+        le_hashmap_Put(EntryMap, entryPtr->path, entryPtr);
+    }
+
+    if (!entryPtr->isCurrent)
+    {
+        le_cfg_IteratorRef_t iterRef = le_cfg_CreateReadTxn(entryPtr->path);
+
+        entryPtr->result = cfgSubtree_Read(iterRef, "", &entryPtr->rootRef);
+
+        le_cfg_CancelTxn(iterRef);
+
+        if (entryPtr->result != LE_OK)
+        {
+            entryPtr->rootRef = NULL;
+        }
+
+        // A node that doesn't exist is cached too: creating it triggers the handler.  Parse
+        // errors are not, so that they are retried.
+        entryPtr->isCurrent = (entryPtr->result != LE_FORMAT_ERROR);
+    }
+
+    *rootRefPtr = entryPtr->rootRef;
+
+    return entryPtr->result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drop the cached copies that a change to a node affects: the node's own, its ancestors' and its
+ * descendants'.  Call this after committing a change that must be read back right away.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void cfgCache_Invalidate
+(
+    const char* pathPtr                 ///< [IN] Path to the changed node, as given to
+                                        ///<      cfgCache_Read().
+)
+{
+    le_hashmap_It_Ref_t iterRef = le_hashmap_GetIterator(EntryMap);
+
+    while (le_hashmap_NextNode(iterRef) == LE_OK)
+    {
+        Entry_t* entryPtr = le_hashmap_GetValue(iterRef);
+
+        if (IsSameOrAncestor(entryPtr->path, pathPtr) || IsSameOrAncestor(pathPtr, entryPtr->path))
+        {
+            DropCopy(entryPtr);
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the component's pools and map.
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT_ONCE
+{
+    EntryPool = le_mem_CreatePool("cfgCacheEntries", sizeof(Entry_t));
+    EntryMap = le_hashmap_Create("cfgCache",
+                                 CACHE_SIZE_ESTIMATE,
+                                 le_hashmap_HashString,
+                                 le_hashmap_EqualsString);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Component initialization function, (nothing to do.)
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+}
@@ -0,0 +1,65 @@
+//--------------------------------------------------------------------------------------------------
+/** @file cfgCache.h
+ *
+ * Cached, read-only, copies of config tree subtrees.
+ *
+ * cfgCache_Read() returns a local copy (see cfgSubtree.h) of a node and everything under it.  The
+ * first call for a path reads the copy from the Config Tree and registers a change handler on the
+ * path.  Later calls return the same copy without going back to the Config Tree, until the handler
+ * reports that something under the path changed.  The copy is then dropped, and the next call
+ * reads a fresh one.  Values that don't change therefore cost a local lookup to read, however
+ * often they are read.
+ *
+ * Change notifications are delivered by the event loop of the thread that first read the path, so:
+ *  - the cache must only be used by that thread;
+ *  - copies returned by cfgCache_Read() may be deleted as soon as the thread returns to its event
+ *    loop, and must be read again rather than kept;
+ *  - a change committed by the caller itself isn't seen until its notification is delivered,
+ *    unless the caller calls cfgCache_Invalidate() after committing it.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_CFG_CACHE_INCLUDE_GUARD
+#define LEGATO_CFG_CACHE_INCLUDE_GUARD
+
+#include "interfaces.h"
+#include "cfgSubtree.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the cached copy of a node and all of its children, reading it from the Config Tree if there
+ * is none.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the node doesn't exist.
+ *      LE_FORMAT_ERROR if the subtree couldn't be parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgCache_Read
+(
+    const char* pathPtr,                ///< [IN]  Absolute path to the node, optionally prefixed
+                                        ///<       with a tree name ("tree:/path").
+    cfgSubtree_NodeRef_t* rootRefPtr    ///< [OUT] Root of the copy.  Owned by the cache: don't
+                                        ///<       delete it, nor keep it past the return to the
+                                        ///<       event loop.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drop the cached copies that a change to a node affects: the node's own, its ancestors' and its
+ * descendants'.  Call this after committing a change that must be read back right away.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void cfgCache_Invalidate
+(
+    const char* pathPtr                 ///< [IN] Path to the changed node, as given to
+                                        ///<      cfgCache_Read().
+);
+
+
+#endif // LEGATO_CFG_CACHE_INCLUDE_GUARD
@@ -0,0 +1,771 @@
+//--------------------------------------------------------------------------------------------------
+/** @file cfgSubtree.c
+ *
+ * Local, read-only, copies of config tree subtrees.  A copy is parsed from the config tree's text
+ * format, (see le_cfg_GetSubtree(),) into a tree of nodes whose names and values point into a
+ * single buffer holding the unescaped text.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "cfgSubtree.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A node of a subtree copy.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct cfgSubtree_Node
+{
+    struct cfgSubtree_Node* parentPtr;          ///< Parent node, NULL for the root.
+    struct cfgSubtree_Node* firstChildPtr;      ///< First child, if this is a stem.
+    struct cfgSubtree_Node* nextSiblingPtr;     ///< Next child of the same parent.
+    const char* namePtr;                        ///< The node's name.
+    const char* valuePtr;                       ///< The node's value, NULL if it has none.
+    le_cfg_nodeType_t type;                     ///< The node's type.
+    char* bufferPtr;                            ///< Root only: the buffer the strings are in.
+}
+Node_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Position of the parser in the text being parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char* nextPtr;                              ///< Next character to parse.
+    char* endPtr;                               ///< End of the text.
+}
+Parser_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for the nodes of all subtree copies.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t NodePool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a new node.
+ *
+ * @return
+ *      The node, with no value, children or siblings.
+ */
+//--------------------------------------------------------------------------------------------------
+static Node_t* NewNode
+(
+    Node_t* parentPtr,                          ///< [IN] Parent node, NULL for a root.
+    const char* namePtr                         ///< [IN] The node's name.
+)
+{
+    Node_t* nodePtr = le_mem_ForceAlloc(NodePool);
+
+    memset(nodePtr, 0, sizeof(*nodePtr));
+    nodePtr->parentPtr = parentPtr;
+    nodePtr->namePtr = namePtr;
+    nodePtr->type = LE_CFG_TYPE_EMPTY;
+
+    return nodePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Free a node and all of its descendants.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeleteNode
+(
+    Node_t* nodePtr                             ///< [IN] The node.
+)
+{
+    Node_t* childPtr = nodePtr->firstChildPtr;
+
+    while (childPtr != NULL)
+    {
+        Node_t* nextPtr = childPtr->nextSiblingPtr;
+
+        DeleteNode(childPtr);
+        childPtr = nextPtr;
+    }
+
+    le_mem_Release(nodePtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Skip over white space.
+ *
+ * @return
+ *      True if there is more text after the white space.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool SkipWhiteSpace
+(
+    Parser_t* parserPtr                         ///< [IN] The parser.
+)
+{
+    while (   (parserPtr->nextPtr < parserPtr->endPtr)
+           && (isspace((unsigned char)*parserPtr->nextPtr)))
+    {
+        parserPtr->nextPtr++;
+    }
+
+    return (parserPtr->nextPtr < parserPtr->endPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a literal up to its terminating character.  The literal is unescaped and null terminated
+ * in place.
+ *
+ * @return
+ *      The literal, or NULL if the text ends before the terminating character.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* ReadLiteral
+(
+    Parser_t* parserPtr,                        ///< [IN] The parser, just past the opening
+                                                ///<      character.
+    char terminal                               ///< [IN] The terminating character.
+)
+{
+    char* startPtr = parserPtr->nextPtr;
+    char* writePtr = startPtr;
+
+    while (parserPtr->nextPtr < parserPtr->endPtr)
+    {
+        char next = *parserPtr->nextPtr++;
+
+        if (next == terminal)
+        {
+            *writePtr = '\0';
+            return startPtr;
+        }
+
+        if (next == '\\')
+        {
+            if (parserPtr->nextPtr >= parserPtr->endPtr)
+            {
+                break;
+            }
+
+            next = *parserPtr->nextPtr++;
+        }
+
+        *writePtr++ = next;
+    }
+
+    LE_ERROR("Missing '%c' at the end of a literal.", terminal);
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse a node's value.  If the value is a collection, parse its child nodes too.
+ *
+ * @return
+ *      LE_OK if successful, LE_FORMAT_ERROR if the text is malformed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ParseValue
+(
+    Parser_t* parserPtr,                        ///< [IN] The parser.
+    Node_t* nodePtr                             ///< [IN] The node the value is for.
+)
+{
+    if (!SkipWhiteSpace(parserPtr))
+    {
+        LE_ERROR("Unexpected end of subtree.");
+        return LE_FORMAT_ERROR;
+    }
+
+    switch (*parserPtr->nextPtr++)
+    {
+        case '~':
+            nodePtr->type = LE_CFG_TYPE_EMPTY;
+            return LE_OK;
+
+        case '!':
+            if (parserPtr->nextPtr < parserPtr->endPtr)
+            {
+                char next = *parserPtr->nextPtr++;
+
+                if ((next == 't') || (next == 'f'))
+                {
+                    nodePtr->type = LE_CFG_TYPE_BOOL;
+                    nodePtr->valuePtr = (next == 't') ? "t" : "f";
+                    return LE_OK;
+                }
+            }
+            LE_ERROR("Bad bool value.");
+            return LE_FORMAT_ERROR;
+
+        case '[':
+            nodePtr->type = LE_CFG_TYPE_INT;
+            nodePtr->valuePtr = ReadLiteral(parserPtr, ']');
+            break;
+
+        case '(':
+            nodePtr->type = LE_CFG_TYPE_FLOAT;
+            nodePtr->valuePtr = ReadLiteral(parserPtr, ')');
+            break;
+
+        case '"':
+            nodePtr->type = LE_CFG_TYPE_STRING;
+            nodePtr->valuePtr = ReadLiteral(parserPtr, '"');
+            break;
+
+        case '{':
+            {
+                Node_t* lastChildPtr = NULL;
+
+                while (SkipWhiteSpace(parserPtr))
+                {
+                    char next = *parserPtr->nextPtr++;
+
+                    if (next == '}')
+                    {
+                        // A collection with no children is just an empty node.
+                        nodePtr->type = (lastChildPtr == NULL) ? LE_CFG_TYPE_EMPTY
+                                                               : LE_CFG_TYPE_STEM;
+                        return LE_OK;
+                    }
+
+                    const char* namePtr = (next == '"') ? ReadLiteral(parserPtr, '"') : NULL;
+
+                    if (namePtr == NULL)
+                    {
+                        LE_ERROR("Expected a node name.");
+                        return LE_FORMAT_ERROR;
+                    }
+
+                    Node_t* childPtr = NewNode(nodePtr, namePtr);
+
+                    if (lastChildPtr == NULL)
+                    {
+                        nodePtr->firstChildPtr = childPtr;
+                    }
+                    else
+                    {
+                        lastChildPtr->nextSiblingPtr = childPtr;
+                    }
+                    lastChildPtr = childPtr;
+
+                    if (ParseValue(parserPtr, childPtr) != LE_OK)
+                    {
+                        return LE_FORMAT_ERROR;
+                    }
+                }
+
+                LE_ERROR("Missing '}'.");
+                return LE_FORMAT_ERROR;
+            }
+
+        default:
+            LE_ERROR("Unexpected character in subtree.");
+            return LE_FORMAT_ERROR;
+    }
+
+    return (nodePtr->valuePtr != NULL) ? LE_OK : LE_FORMAT_ERROR;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build a subtree copy from a buffer holding the serialized subtree.  The copy takes ownership of
+ * the buffer, which is freed along with it (or right away, if the buffer can't be parsed).
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FORMAT_ERROR if the data couldn't be parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ParseBuffer
+(
+    char* bufferPtr,                            ///< [IN]  Buffer allocated with malloc().
+    size_t dataSize,                            ///< [IN]  Size of the serialized subtree.
+    cfgSubtree_NodeRef_t* rootRefPtr            ///< [OUT] Root of the copy.
+)
+{
+    Parser_t parser = { .nextPtr = bufferPtr, .endPtr = bufferPtr + dataSize };
+    Node_t* rootPtr = NewNode(NULL, "");
+
+    rootPtr->bufferPtr = bufferPtr;
+
+    if (   (ParseValue(&parser, rootPtr) != LE_OK)
+        || (SkipWhiteSpace(&parser)))
+    {
+        LE_ERROR("Malformed subtree.");
+        cfgSubtree_Delete(rootPtr);
+        return LE_FORMAT_ERROR;
+    }
+
+    *rootRefPtr = rootPtr;
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a copy of a node and all of its children.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the node doesn't exist.
+ *      LE_FORMAT_ERROR if the subtree couldn't be parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_Read
+(
+    le_cfg_IteratorRef_t iterRef,       ///< [IN]  Iterator to read with.
+    const char* pathPtr,                ///< [IN]  Path to the node, relative to the iterator.
+    cfgSubtree_NodeRef_t* rootRefPtr    ///< [OUT] Root of the copy.  Free with cfgSubtree_Delete().
+)
+{
+    char* bufferPtr = NULL;
+    size_t bufferSize = 0;
+    size_t dataSize = 0;
+    le_result_t result;
+
+    // Read the subtree a piece at a time, until it has all been read.
+    do
+    {
+        if (bufferSize - dataSize < LE_CFG_BULK_LEN)
+        {
+            bufferSize += LE_CFG_BULK_LEN;
+            bufferPtr = realloc(bufferPtr, bufferSize);
+            LE_FATAL_IF(bufferPtr == NULL, "Out of memory reading config subtree '%s'.", pathPtr);
+        }
+
+        size_t pieceSize = LE_CFG_BULK_LEN;
+
+        result = le_cfg_GetSubtree(iterRef,
+                                   pathPtr,
+                                   dataSize,
+                                   (uint8_t*)bufferPtr + dataSize,
+                                   &pieceSize);
+
+        if ((result == LE_OK) || (result == LE_OVERFLOW))
+        {
+            dataSize += pieceSize;
+        }
+    }
+    while (result == LE_OVERFLOW);
+
+    if (result != LE_OK)
+    {
+        free(bufferPtr);
+        return (result == LE_NOT_FOUND) ? LE_NOT_FOUND : LE_FORMAT_ERROR;
+    }
+
+    return ParseBuffer(bufferPtr, dataSize, rootRefPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Replace a node and all of its children with a subtree serialized in the config tree's text
+ * format.  The iterator must be for a write transaction.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the node couldn't be created.
+ *      LE_FORMAT_ERROR if the data couldn't be parsed.  The node is left empty.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_Write
+(
+    le_cfg_IteratorRef_t iterRef,       ///< [IN] Write iterator to write with.
+    const char* pathPtr,                ///< [IN] Path to the node, relative to the iterator.
+    const char* dataPtr,                ///< [IN] The serialized subtree.
+    size_t dataSize                     ///< [IN] Size of the serialized subtree.
+)
+{
+    size_t offset = 0;
+    bool more;
+    le_result_t result;
+
+    // Send the subtree a piece at a time; the config tree writes it when the last one arrives.
+    do
+    {
+        size_t pieceSize = dataSize - offset;
+        more = (pieceSize > LE_CFG_BULK_LEN);
+
+        if (more)
+        {
+            pieceSize = LE_CFG_BULK_LEN;
+        }
+
+        result = le_cfg_SetSubtree(iterRef,
+                                   pathPtr,
+                                   offset,
+                                   more,
+                                   (const uint8_t*)dataPtr + offset,
+                                   pieceSize);
+        offset += pieceSize;
+    }
+    while (more && (result == LE_OK));
+
+    LE_ERROR_IF(result == LE_OUT_OF_RANGE, "Config subtree '%s' pieces out of order.", pathPtr);
+
+    return (result == LE_OUT_OF_RANGE) ? LE_FORMAT_ERROR : result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build a subtree copy from a subtree serialized in the config tree's text format.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FORMAT_ERROR if the data couldn't be parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_Parse
+(
+    const char* dataPtr,                ///< [IN]  The serialized subtree.
+    size_t dataSize,                    ///< [IN]  Size of the serialized subtree.
+    cfgSubtree_NodeRef_t* rootRefPtr    ///< [OUT] Root of the copy.  Free with cfgSubtree_Delete().
+)
+{
+    char* bufferPtr = malloc(dataSize + 1);
+
+    LE_FATAL_IF(bufferPtr == NULL, "Out of memory parsing config subtree.");
+    memcpy(bufferPtr, dataPtr, dataSize);
+
+    return ParseBuffer(bufferPtr, dataSize, rootRefPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Free a subtree copy.  All references to its nodes become invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void cfgSubtree_Delete
+(
+    cfgSubtree_NodeRef_t rootRef        ///< [IN] Root of the copy.
+)
+{
+    LE_FATAL_IF((rootRef == NULL) || (rootRef->parentPtr != NULL),
+                "Config subtree reference must be the root of a copy.");
+
+    char* bufferPtr = rootRef->bufferPtr;
+
+    DeleteNode(rootRef);
+    free(bufferPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find a node of a subtree copy.
+ *
+ * @return
+ *      The node, or NULL if there is no node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED cfgSubtree_NodeRef_t cfgSubtree_GetNode
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr                 ///< [IN] Path to the node.
+)
+{
+    LE_FATAL_IF(nodeRef == NULL, "Config subtree node reference can not be NULL.");
+
+    if (pathPtr[0] == '/')
+    {
+        while (nodeRef->parentPtr != NULL)
+        {
+            nodeRef = nodeRef->parentPtr;
+        }
+    }
+
+    while ((nodeRef != NULL) && (*pathPtr != '\0'))
+    {
+        const char* endPtr = strchr(pathPtr, '/');
+        size_t nameLen = (endPtr != NULL) ? (size_t)(endPtr - pathPtr) : strlen(pathPtr);
+
+        if ((nameLen == 2) && (strncmp(pathPtr, "..", 2) == 0))
+        {
+            nodeRef = nodeRef->parentPtr;
+        }
+        else if ((nameLen != 0) && ((nameLen != 1) || (pathPtr[0] != '.')))
+        {
+            Node_t* childPtr = nodeRef->firstChildPtr;
+
+            while (   (childPtr != NULL)
+                   && (   (strncmp(childPtr->namePtr, pathPtr, nameLen) != 0)
+                       || (childPtr->namePtr[nameLen] != '\0')))
+            {
+                childPtr = childPtr->nextSiblingPtr;
+            }
+
+            nodeRef = childPtr;
+        }
+
+        pathPtr += nameLen;
+
+        if (*pathPtr == '/')
+        {
+            pathPtr++;
+        }
+    }
+
+    return nodeRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a node's first child.
+ *
+ * @return
+ *      The child, or NULL if the node isn't a stem.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED cfgSubtree_NodeRef_t cfgSubtree_GetFirstChild
+(
+    cfgSubtree_NodeRef_t nodeRef        ///< [IN] The node.
+)
+{
+    LE_FATAL_IF(nodeRef == NULL, "Config subtree node reference can not be NULL.");
+
+    return nodeRef->firstChildPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a node's next sibling.
+ *
+ * @return
+ *      The sibling, or NULL if the node is its parent's last child.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED cfgSubtree_NodeRef_t cfgSubtree_GetNextSibling
+(
+    cfgSubtree_NodeRef_t nodeRef        ///< [IN] The node.
+)
+{
+    LE_FATAL_IF(nodeRef == NULL, "Config subtree node reference can not be NULL.");
+
+    return nodeRef->nextSiblingPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the type of a node.
+ *
+ * @return
+ *      The node's type, or LE_CFG_TYPE_DOESNT_EXIST if there is no node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_cfg_nodeType_t cfgSubtree_GetNodeType
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr                 ///< [IN] Path to the node.
+)
+{
+    nodeRef = cfgSubtree_GetNode(nodeRef, pathPtr);
+
+    return (nodeRef != NULL) ? nodeRef->type : LE_CFG_TYPE_DOESNT_EXIST;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a node exists.
+ *
+ * @return
+ *      True if there is a node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool cfgSubtree_NodeExists
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr                 ///< [IN] Path to the node.
+)
+{
+    return (cfgSubtree_GetNode(nodeRef, pathPtr) != NULL);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the name of a node.  The root of a copy has an empty name.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the buffer was not big enough for the name.
+ *      LE_NOT_FOUND if there is no node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_GetNodeName
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN]  Node to start from.
+    const char* pathPtr,                ///< [IN]  Path to the node.
+    char* bufPtr,                       ///< [OUT] Buffer to store the name.
+    size_t bufSize                      ///< [IN]  Size of the buffer.
+)
+{
+    nodeRef = cfgSubtree_GetNode(nodeRef, pathPtr);
+
+    if (nodeRef == NULL)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    return le_utf8_Copy(bufPtr, nodeRef->namePtr, bufSize, NULL);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as a string.  If the node is empty, is a stem, or doesn't exist, the default
+ * value is returned.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the buffer was not big enough for the value.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_GetString
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN]  Node to start from.
+    const char* pathPtr,                ///< [IN]  Path to the node.
+    char* bufPtr,                       ///< [OUT] Buffer to store the value.
+    size_t bufSize,                     ///< [IN]  Size of the buffer.
+    const char* defaultPtr              ///< [IN]  Default value.
+)
+{
+    nodeRef = cfgSubtree_GetNode(nodeRef, pathPtr);
+
+    if ((nodeRef == NULL) || (nodeRef->valuePtr == NULL))
+    {
+        return le_utf8_Copy(bufPtr, defaultPtr, bufSize, NULL);
+    }
+
+    return le_utf8_Copy(bufPtr, nodeRef->valuePtr, bufSize, NULL);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as an integer.  Float values are rounded.
+ *
+ * @return
+ *      The value, or the default value if the node isn't an int or a float.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED int32_t cfgSubtree_GetInt
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr,                ///< [IN] Path to the node.
+    int32_t defaultValue                ///< [IN] Default value.
+)
+{
+    nodeRef = cfgSubtree_GetNode(nodeRef, pathPtr);
+
+    if ((nodeRef != NULL) && (nodeRef->type == LE_CFG_TYPE_INT))
+    {
+        return atoi(nodeRef->valuePtr);
+    }
+
+    if ((nodeRef != NULL) && (nodeRef->type == LE_CFG_TYPE_FLOAT))
+    {
+        double value = atof(nodeRef->valuePtr);
+
+        return (int32_t)(value >= 0.0 ? value + 0.5 : value - 0.5);
+    }
+
+    return defaultValue;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as a floating point number.
+ *
+ * @return
+ *      The value, or the default value if the node isn't an int or a float.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED double cfgSubtree_GetFloat
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr,                ///< [IN] Path to the node.
+    double defaultValue                 ///< [IN] Default value.
+)
+{
+    nodeRef = cfgSubtree_GetNode(nodeRef, pathPtr);
+
+    if (   (nodeRef != NULL)
+        && ((nodeRef->type == LE_CFG_TYPE_INT) || (nodeRef->type == LE_CFG_TYPE_FLOAT)))
+    {
+        return atof(nodeRef->valuePtr);
+    }
+
+    return defaultValue;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as a boolean.
+ *
+ * @return
+ *      The value, or the default value if the node isn't a bool.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool cfgSubtree_GetBool
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr,                ///< [IN] Path to the node.
+    bool defaultValue                   ///< [IN] Default value.
+)
+{
+    nodeRef = cfgSubtree_GetNode(nodeRef, pathPtr);
+
+    if ((nodeRef != NULL) && (nodeRef->type == LE_CFG_TYPE_BOOL))
+    {
+        return (strcmp(nodeRef->valuePtr, "f") != 0);
+    }
+
+    return defaultValue;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Subtree copy initialization function.
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT_ONCE
+{
+    NodePool = le_mem_CreatePool("cfgSubtreeNodes", sizeof(Node_t));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Component initialization function, (nothing to do.)
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+}
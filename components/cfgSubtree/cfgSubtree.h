@@ -0,0 +1,264 @@
+//--------------------------------------------------------------------------------------------------
+/** @file cfgSubtree.h
+ *
+ * Local, read-only, copies of config tree subtrees.
+ *
+ * Reading a subtree with cfgSubtree_Read() fetches the node and everything under it from the
+ * config tree with le_cfg_GetSubtree(), usually in a single request, after which any number of
+ * values can be read from it without going back to the Config Tree.  The functions for reading
+ * the copy work like their le_cfg counterparts: paths are relative to the node given, ("" is the
+ * node itself, ".." its parent,) or absolute from the root of the copy.
+ *
+ * The copy doesn't change when the config tree does.
+ *
+ * cfgSubtree_Write() goes the other way, replacing a node in the config tree with a serialized
+ * subtree, sent in as many le_cfg_SetSubtree() requests as it takes.
+ *
+ * This component doesn't connect to the le_cfg service itself; the component that includes it
+ * must do so before calling these functions.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_CFG_SUBTREE_INCLUDE_GUARD
+#define LEGATO_CFG_SUBTREE_INCLUDE_GUARD
+
+#include "interfaces.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a node of a subtree copy.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct cfgSubtree_Node* cfgSubtree_NodeRef_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a copy of a node and all of its children.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the node doesn't exist.
+ *      LE_FORMAT_ERROR if the subtree couldn't be parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_Read
+(
+    le_cfg_IteratorRef_t iterRef,       ///< [IN]  Iterator to read with.
+    const char* pathPtr,                ///< [IN]  Path to the node, relative to the iterator.
+    cfgSubtree_NodeRef_t* rootRefPtr    ///< [OUT] Root of the copy.  Free with cfgSubtree_Delete().
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Replace a node and all of its children with a subtree serialized in the config tree's text
+ * format.  The iterator must be for a write transaction.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the node couldn't be created.
+ *      LE_FORMAT_ERROR if the data couldn't be parsed.  The node is left empty.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_Write
+(
+    le_cfg_IteratorRef_t iterRef,       ///< [IN] Write iterator to write with.
+    const char* pathPtr,                ///< [IN] Path to the node, relative to the iterator.
+    const char* dataPtr,                ///< [IN] The serialized subtree.
+    size_t dataSize                     ///< [IN] Size of the serialized subtree.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build a subtree copy from a subtree serialized in the config tree's text format.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FORMAT_ERROR if the data couldn't be parsed.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_Parse
+(
+    const char* dataPtr,                ///< [IN]  The serialized subtree.
+    size_t dataSize,                    ///< [IN]  Size of the serialized subtree.
+    cfgSubtree_NodeRef_t* rootRefPtr    ///< [OUT] Root of the copy.  Free with cfgSubtree_Delete().
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Free a subtree copy.  All references to its nodes become invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void cfgSubtree_Delete
+(
+    cfgSubtree_NodeRef_t rootRef        ///< [IN] Root of the copy.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find a node of a subtree copy.
+ *
+ * @return
+ *      The node, or NULL if there is no node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED cfgSubtree_NodeRef_t cfgSubtree_GetNode
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr                 ///< [IN] Path to the node.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a node's first child.
+ *
+ * @return
+ *      The child, or NULL if the node isn't a stem.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED cfgSubtree_NodeRef_t cfgSubtree_GetFirstChild
+(
+    cfgSubtree_NodeRef_t nodeRef        ///< [IN] The node.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a node's next sibling.
+ *
+ * @return
+ *      The sibling, or NULL if the node is its parent's last child.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED cfgSubtree_NodeRef_t cfgSubtree_GetNextSibling
+(
+    cfgSubtree_NodeRef_t nodeRef        ///< [IN] The node.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the type of a node.
+ *
+ * @return
+ *      The node's type, or LE_CFG_TYPE_DOESNT_EXIST if there is no node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_cfg_nodeType_t cfgSubtree_GetNodeType
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr                 ///< [IN] Path to the node.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a node exists.
+ *
+ * @return
+ *      True if there is a node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool cfgSubtree_NodeExists
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr                 ///< [IN] Path to the node.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the name of a node.  The root of a copy has an empty name.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the buffer was not big enough for the name.
+ *      LE_NOT_FOUND if there is no node at that path.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_GetNodeName
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN]  Node to start from.
+    const char* pathPtr,                ///< [IN]  Path to the node.
+    char* bufPtr,                       ///< [OUT] Buffer to store the name.
+    size_t bufSize                      ///< [IN]  Size of the buffer.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as a string.  If the node is empty, is a stem, or doesn't exist, the default
+ * value is returned.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the buffer was not big enough for the value.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t cfgSubtree_GetString
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN]  Node to start from.
+    const char* pathPtr,                ///< [IN]  Path to the node.
+    char* bufPtr,                       ///< [OUT] Buffer to store the value.
+    size_t bufSize,                     ///< [IN]  Size of the buffer.
+    const char* defaultPtr              ///< [IN]  Default value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as an integer.  Float values are rounded.
+ *
+ * @return
+ *      The value, or the default value if the node isn't an int or a float.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED int32_t cfgSubtree_GetInt
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr,                ///< [IN] Path to the node.
+    int32_t defaultValue                ///< [IN] Default value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as a floating point number.
+ *
+ * @return
+ *      The value, or the default value if the node isn't an int or a float.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED double cfgSubtree_GetFloat
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr,                ///< [IN] Path to the node.
+    double defaultValue                 ///< [IN] Default value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value as a boolean.
+ *
+ * @return
+ *      The value, or the default value if the node isn't a bool.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool cfgSubtree_GetBool
+(
+    cfgSubtree_NodeRef_t nodeRef,       ///< [IN] Node to start from.
+    const char* pathPtr,                ///< [IN] Path to the node.
+    bool defaultValue                   ///< [IN] Default value.
+);
+
+
+#endif // LEGATO_CFG_SUBTREE_INCLUDE_GUARD
@@ -99,6 +99,23 @@
 #define RETRY_TECH_BACKOFF_INIT 1                // init backoff: 1 sec
 #define RETRY_TECH_BACKOFF_MAX (60 * 60 * 6)     // max backoff: 6 hrs
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delay before trying the next technology when one fails, as long as the technologies of the
+ * list haven't all been tried.  The backoff above only applies once they have all failed.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RETRY_TECH_FAILOVER_DELAY_MS 100
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of buckets of the technology setup time histograms, and upper bound of each bucket but
+ * the last one, in seconds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SETUP_TIME_BUCKETS_NB 6
+static const uint32_t SetupTimeBucketsSec[SETUP_TIME_BUCKETS_NB - 1] = {1, 2, 5, 10, 30};
+
 //--------------------------------------------------------------------------------------------------
 // Data structures
 //--------------------------------------------------------------------------------------------------
@@ -117,6 +134,19 @@ typedef struct
 }
 DcsConnStateData_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time taken by a technology to bring up the data connection
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_clk_Time_t startTime;                            ///< Start of the ongoing attempt
+    bool          isStarting;                           ///< True if an attempt is ongoing
+    uint32_t      histogram[SETUP_TIME_BUCKETS_NB];     ///< Number of setups per duration bucket
+}
+TechSetupTime_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Declaration of functions
@@ -193,6 +223,13 @@ static bool DefaultRouteStatus = true;
 static le_timer_Ref_t RetryTechTimer = NULL;
 static uint16_t RetryTechBackoffCurrent;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Setup time statistics of each technology
+ */
+//--------------------------------------------------------------------------------------------------
+static TechSetupTime_t TechSetupTime[LE_DATA_MAX];
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Event for sending command to Process command handler
@@ -1022,6 +1059,47 @@ static void ResetDataChannel
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the time taken by a technology to bring up the data connection, and log the histogram
+ * of its setup times.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RecordSetupTime
+(
+    le_data_Technology_t technology     ///< [IN] Technology now connected
+)
+{
+    TechSetupTime_t* setupPtr;
+    le_clk_Time_t duration;
+    int bucket;
+
+    if ((technology >= LE_DATA_MAX) || (!TechSetupTime[technology].isStarting))
+    {
+        return;
+    }
+
+    setupPtr = &TechSetupTime[technology];
+    setupPtr->isStarting = false;
+    duration = le_clk_Sub(le_clk_GetRelativeTime(), setupPtr->startTime);
+
+    for (bucket = 0; bucket < SETUP_TIME_BUCKETS_NB - 1; bucket++)
+    {
+        if (duration.sec < SetupTimeBucketsSec[bucket])
+        {
+            break;
+        }
+    }
+    setupPtr->histogram[bucket]++;
+
+    LE_INFO("Technology %d connected in %ld.%03ld sec; setup times <1s:%" PRIu32 " <2s:%" PRIu32
+            " <5s:%" PRIu32 " <10s:%" PRIu32 " <30s:%" PRIu32 " >=30s:%" PRIu32, technology,
+            (long)duration.sec, (long)(duration.usec / 1000), setupPtr->histogram[0],
+            setupPtr->histogram[1], setupPtr->histogram[2], setupPtr->histogram[3],
+            setupPtr->histogram[4], setupPtr->histogram[5]);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Update status of the given technology with the given connection state in the input argument
@@ -1044,10 +1122,16 @@ static void UpdateTechnologyStatus
     // Case: connected
     if (connected)
     {
+        RecordSetupTime(technology);
         ResetRetryTechBackoff();
         return;
     }
 
+    if (technology < LE_DATA_MAX)
+    {
+        TechSetupTime[technology].isStarting = false;
+    }
+
     // Case: not connected
     if (RequestCount == 0)
     {
@@ -1066,7 +1150,16 @@ static void UpdateTechnologyStatus
         return;
     }
 
-    if ((LE_OK != le_timer_SetContextPtr(RetryTechTimer, (void*)((intptr_t)technology))) ||
+    // Fail over to the next technology without waiting, unless they have all been tried
+    le_clk_Time_t retryInterval = {RetryTechBackoffCurrent, 0};
+    if (!dcsTechRank_IsLastTech(technology))
+    {
+        retryInterval.sec = 0;
+        retryInterval.usec = RETRY_TECH_FAILOVER_DELAY_MS * 1000;
+    }
+
+    if ((LE_OK != le_timer_SetInterval(RetryTechTimer, retryInterval)) ||
+        (LE_OK != le_timer_SetContextPtr(RetryTechTimer, (void*)((intptr_t)technology))) ||
         (LE_OK != le_timer_Start(RetryTechTimer)))
     {
         LE_ERROR("Failed to start RetryTechTimer to retry connecting");
@@ -1077,7 +1170,8 @@ static void UpdateTechnologyStatus
         return;
     }
 
-    LE_INFO("Technology retry to connect will happen after %d sec", RetryTechBackoffCurrent);
+    LE_INFO("Technology retry to connect will happen after %ld.%03ld sec",
+            (long)retryInterval.sec, (long)(retryInterval.usec / 1000));
 }
 
 
@@ -1143,6 +1237,11 @@ static void TryStartTechSession
     }
 
     LE_INFO("Successfully initiated data channel %s of technology %d", DataChannelName, technology);
+    if (technology < LE_DATA_MAX)
+    {
+        TechSetupTime[technology].startTime = le_clk_GetRelativeTime();
+        TechSetupTime[technology].isStarting = true;
+    }
     LE_DEBUG("Request reference %p", DataChannelReqRef);
 }
 
@@ -1253,7 +1352,11 @@ static void RetryTechTimerHandler
         return;
     }
 
-    IncreaseRetryTechBackoff();
+    // Back off once all the technologies have been tried
+    if (dcsTechRank_IsLastTech(technology))
+    {
+        IncreaseRetryTechBackoff();
+    }
 
     // Retry connecting over the next technology
     TryStartTechSession(dcsTechRank_GetNextTech(technology));
@@ -320,6 +320,36 @@ static void IncrementTechRanks
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a technology is the last one of the list, i.e. if a connection attempt with each
+ * technology has been made when it fails.
+ *
+ * @return
+ *      - true if the technology is the last one of the list, or is not in the list
+ *      - false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+bool dcsTechRank_IsLastTech
+(
+    le_data_Technology_t technology     ///< [IN] Technology to find in the list
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&TechList);
+
+    while (linkPtr)
+    {
+        if (CONTAINER_OF(linkPtr, TechRecord_t, link)->tech == technology)
+        {
+            return (le_dls_PeekNext(&TechList, linkPtr) == NULL);
+        }
+        linkPtr = le_dls_PeekNext(&TechList, linkPtr);
+    }
+
+    return true;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get the next technology to use after the one given as an input
@@ -21,6 +21,7 @@ void dcs_ChannelSetChannelName(const char *channelName);
 
 void dcsTechRank_Init(void);
 le_data_Technology_t dcsTechRank_GetNextTech(le_data_Technology_t technology);
+bool dcsTechRank_IsLastTech(le_data_Technology_t technology);
 le_result_t dcsTechRank_SelectDataChannel(le_data_Technology_t technology);
 le_dcs_Technology_t dcsTechRank_ConvertToDcsTechEnum(le_data_Technology_t leDataTech);
 
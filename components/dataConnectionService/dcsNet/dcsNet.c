@@ -541,6 +541,42 @@ le_result_t net_GetLeaseAddresses
     return result;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether the given default GW is already the one installed in the system, so that the
+ * route table is not rewritten for nothing, e.g. when a channel reconnects over the same
+ * interface.
+ *
+ * @return
+ *      - true if the system default GW is the given address on the given interface
+ *      - false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsDefaultGwInstalled
+(
+    const pa_dcs_DefaultGwBackup_t* currentPtr, ///< [IN] Default GW configs of the system
+    le_result_t currentResult,                  ///< [IN] Result of retrieving them
+    const char* intfPtr,                        ///< [IN] Interface of the default GW
+    const char* gwAddrPtr,                      ///< [IN] Address of the default GW
+    bool isIpv6                                 ///< [IN] IPv6 or not
+)
+{
+    if (currentResult != LE_OK)
+    {
+        return false;
+    }
+
+    if (isIpv6)
+    {
+        return ((0 == strcmp(currentPtr->defaultV6GW, gwAddrPtr)) &&
+                (0 == strcmp(currentPtr->defaultV6Interface, intfPtr)));
+    }
+
+    return ((0 == strcmp(currentPtr->defaultV4GW, gwAddrPtr)) &&
+            (0 == strcmp(currentPtr->defaultV4Interface, intfPtr)));
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Backup default GW config in the system
@@ -728,6 +764,8 @@ le_result_t net_SetDefaultGW
     char *channelName, v4GwAddr[PA_DCS_IPV4_ADDR_MAX_BYTES], v6GwAddr[PA_DCS_IPV6_ADDR_MAX_BYTES];
     char appName[LE_DCS_APPNAME_MAX_LEN] = {0};
     DcsDefaultGwConfigDb_t* defGwConfigDbPtr;
+    pa_dcs_DefaultGwBackup_t currentGw;
+    le_result_t currentV4Ret = LE_FAULT, currentV6Ret = LE_FAULT;
     bool isRecent;
     pid_t pid = 0;
     uid_t uid = 0;
@@ -783,10 +821,22 @@ le_result_t net_SetDefaultGW
         LE_WARN("Another app made a newer default GW configs backup");
     }
 
+    // Retrieve the present default GWs once, to leave alone those already set as requested
+    memset(&currentGw, 0x0, sizeof(currentGw));
+    pa_dcs_GetDefaultGateway(&currentGw, &currentV4Ret, &currentV6Ret);
+
     // Seek to set IPv6 default GW address
     if (strlen(v6GwAddr) > 0)
     {
-        v6Ret = pa_dcs_SetDefaultGateway(intf, v6GwAddr, true);
+        if (IsDefaultGwInstalled(&currentGw, currentV6Ret, intf, v6GwAddr, true))
+        {
+            LE_DEBUG("IPv6 default GW %s on interface %s already set", v6GwAddr, intf);
+            v6Ret = LE_OK;
+        }
+        else
+        {
+            v6Ret = pa_dcs_SetDefaultGateway(intf, v6GwAddr, true);
+        }
         if (v6Ret != LE_OK)
         {
             LE_ERROR("Failed to set IPv6 default GW for channel %s of technology %s", channelName,
@@ -802,7 +852,15 @@ le_result_t net_SetDefaultGW
     // Seek to set IPv4 default GW address
     if (strlen(v4GwAddr) > 0)
     {
-        v4Ret = pa_dcs_SetDefaultGateway(intf, v4GwAddr, false);
+        if (IsDefaultGwInstalled(&currentGw, currentV4Ret, intf, v4GwAddr, false))
+        {
+            LE_DEBUG("IPv4 default GW %s on interface %s already set", v4GwAddr, intf);
+            v4Ret = LE_OK;
+        }
+        else
+        {
+            v4Ret = pa_dcs_SetDefaultGateway(intf, v4GwAddr, false);
+        }
         if (v4Ret != LE_OK)
         {
             LE_ERROR("Failed to set IPv4 default GW for channel %s of technology %s", channelName,
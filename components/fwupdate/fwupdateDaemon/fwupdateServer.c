@@ -128,9 +128,15 @@ le_result_t le_fwupdate_Download
 
     SetWakeLock();
 
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
     // Pass the fd to the PA layer, which will handle the details.
     le_result_t result = pa_fwupdate_Download(fd);
 
+    le_clk_Time_t duration = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+    LE_INFO("Download ended after %ld.%03ld s: %s",
+            (long)duration.sec, (long)(duration.usec / 1000), LE_RESULT_TXT(result));
+
     ReleaseWakeLock();
 
     return result;
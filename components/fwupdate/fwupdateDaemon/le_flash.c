@@ -64,6 +64,9 @@ typedef struct
     le_dualsys_System_t     systemMask;    ///< System owning the partion, (modem, lk or linux)
     pa_flash_Info_t*        mtdInfo;       ///< Global MTD information
     pa_flash_EccStats_t     statsAtOpen;   ///< ECC stats and bad block at open time
+    uint64_t                writtenBytes;  ///< Data written since the partition was opened
+    le_clk_Time_t           eraseTime;     ///< Time spent erasing blocks before writing them
+    le_clk_Time_t           writeTime;     ///< Time spent writing blocks, erases included
 }
 Partition_t;
 
@@ -479,6 +482,32 @@ static le_result_t CloseUbiVolume
     return res;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Log the throughput of the writes made to a partition since it was opened.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogWriteThroughput
+(
+    Partition_t* partPtr    ///< [IN] Partition descriptor
+)
+{
+    uint64_t writeUs = (uint64_t)partPtr->writeTime.sec * 1000000 + partPtr->writeTime.usec;
+    uint64_t eraseUs = (uint64_t)partPtr->eraseTime.sec * 1000000 + partPtr->eraseTime.usec;
+
+    if ((0 == partPtr->writtenBytes) || (0 == writeUs))
+    {
+        return;
+    }
+
+    // Bytes per microsecond is MB/s: keep 2 decimals
+    LE_INFO("Partition "%s" MTD%d: %"PRIu64" bytes written in %"PRIu64" ms (erase %"PRIu64
+            " ms), %"PRIu64".%02"PRIu64" MB/s",
+            partPtr->partitionName, partPtr->mtdNum, partPtr->writtenBytes,
+            writeUs / 1000, eraseUs / 1000,
+            partPtr->writtenBytes / writeUs, ((partPtr->writtenBytes * 100) / writeUs) % 100);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Close the partiton. If an UBI volume is currently open, it will close it also and adjust UBI
@@ -506,6 +535,8 @@ static le_result_t Close
         (void)CloseUbiVolume(partPtr);
     }
 
+    LogWriteThroughput(partPtr);
+
     res = pa_flash_Close(partPtr->desc);
     if (LE_OK == res)
     {
@@ -1183,6 +1214,8 @@ le_result_t le_flash_Write
 )
 {
     Partition_t *partPtr = GetPartitionFromRef(partitionRef);
+    le_clk_Time_t startTime;
+    le_clk_Time_t eraseEndTime;
     le_result_t res;
 
     if ((NULL == partPtr) || !(partPtr->isWrite) || (NULL == writeData))
@@ -1190,6 +1223,8 @@ le_result_t le_flash_Write
         return LE_BAD_PARAMETER;
     }
 
+    startTime = le_clk_GetRelativeTime();
+
     if (partPtr->isUbi)
     {
         if (-1 == partPtr->ubiVolume)
@@ -1217,6 +1252,9 @@ le_result_t le_flash_Write
                      partPtr->partitionName, partPtr->mtdNum, blockIndex);
             return LE_FAULT;
         }
+        eraseEndTime = le_clk_GetRelativeTime();
+        partPtr->eraseTime = le_clk_Add(partPtr->eraseTime,
+                                        le_clk_Sub(eraseEndTime, startTime));
         res = pa_flash_WriteAtBlock( partPtr->desc, blockIndex, (uint8_t*)writeData, writeDataSize);
         if (LE_OK != res)
         {
@@ -1225,6 +1263,13 @@ le_result_t le_flash_Write
             res = LE_FAULT;
         }
     }
+
+    if (LE_OK == res)
+    {
+        partPtr->writtenBytes += writeDataSize;
+        partPtr->writeTime = le_clk_Add(partPtr->writeTime,
+                                        le_clk_Sub(le_clk_GetRelativeTime(), startTime));
+    }
     return res;
 }
 
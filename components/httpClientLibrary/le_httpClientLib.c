@@ -120,6 +120,8 @@ typedef struct
                                                    ///< or explicit name of the remote server
     uint16_t            port;                      ///< HTTP server port numeric number (0-65535)
     bool                isSecure;                  ///< True if the session is secure
+    bool                isRemoteClosed;            ///< True if the server closed the connection
+                                                   ///< since the session was started
     char                credential[CRED_MAX_LEN];  ///< "Login:Password to be used during connection
     le_httpCommand_t    command;                   ///< Command of current HTTP request
     le_result_t         result;                    ///< Result of current HTTP request
@@ -835,6 +837,7 @@ static void HttpClientStateMachine
         LE_INFO("Connection closed by remote server");
 
         le_socket_Disconnect(socketRef);
+        contextPtr->isRemoteClosed = true;
 
         if (contextPtr->eventCb)
         {
@@ -1031,6 +1034,41 @@ static void HttpClientStateMachine
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reconnect to the server if it closed the connection since the last request.
+ *
+ * HTTP/1.1 connections are kept alive between the requests of a session, but servers close idle
+ * connections after a while.  Rather than failing the next request, open a new connection: for a
+ * secure session, the TLS session of the previous connection is resumed by the socket library.
+ *
+ * @return
+ *  - LE_OK            Connection is open
+ *  - Any error code returned by le_socket_Connect()
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReconnectIfClosed
+(
+    HttpSessionCtx_t* contextPtr    ///< [IN] HTTP session context pointer
+)
+{
+    le_result_t status;
+
+    if (!contextPtr->isRemoteClosed)
+    {
+        return LE_OK;
+    }
+
+    LE_INFO("Reopening connection closed by remote server");
+    status = le_socket_Connect(contextPtr->socketRef);
+    if (LE_OK == status)
+    {
+        contextPtr->isRemoteClosed = false;
+    }
+
+    return status;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -1333,6 +1371,7 @@ le_result_t le_httpClient_Start
         return LE_BAD_PARAMETER;
     }
 
+    contextPtr->isRemoteClosed = false;
     return le_socket_Connect(contextPtr->socketRef);
 }
 
@@ -1359,6 +1398,7 @@ le_result_t le_httpClient_Stop
     }
 
     contextPtr->state = STATE_IDLE;
+    contextPtr->isRemoteClosed = false;
     return le_socket_Disconnect(contextPtr->socketRef);
 }
 
@@ -1401,6 +1441,13 @@ le_result_t le_httpClient_SendRequest
         return LE_BUSY;
     }
 
+    status = ReconnectIfClosed(contextPtr);
+    if (LE_OK != status)
+    {
+        LE_ERROR("Unable to reopen connection");
+        return status;
+    }
+
     status = BuildAndSendRequest(contextPtr, command, requestUriPtr);
     if (LE_OK != status)
     {
@@ -1681,6 +1728,13 @@ void le_httpClient_SendRequestAsync
         goto end;
     }
 
+    status = ReconnectIfClosed(contextPtr);
+    if (LE_OK != status)
+    {
+        LE_ERROR("Unable to reopen connection");
+        goto end;
+    }
+
     status = BuildAndSendRequest(contextPtr, command, requestUriPtr);
     if (LE_OK != status)
     {
@@ -0,0 +1,436 @@
+/**
+ * @file apnTable.c
+ *
+ * Indexed table of the default APNs of the MCC/MNC APN database.
+ *
+ * The table is stored with le_fs as:
+ *
+ *      header | entries sorted by MCC/MNC | NUL-terminated APN strings
+ *
+ * The header records the size and modification time of the JSON file it was compiled from, so a
+ * new APN database (e.g., installed by a system update) is detected and compiled again.  Only the
+ * first "default" entry of each MCC/MNC is kept, as when scanning the JSON file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include <legato.h>
+#include <interfaces.h>
+#include "jansson.h"
+#include "apnTable.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Table location in le_fs
+ */
+//--------------------------------------------------------------------------------------------------
+#define APN_TABLE_PATH      "/modemService/apnTable"
+#define APN_TABLE_TMP_PATH  "/modemService/apnTable.tmp"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Table magic and format version
+ */
+//--------------------------------------------------------------------------------------------------
+#define APN_TABLE_MAGIC     0x41504e54  // "APNT"
+#define APN_TABLE_VERSION   1
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Table header
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;         ///< APN_TABLE_MAGIC
+    uint32_t version;       ///< APN_TABLE_VERSION
+    uint64_t sourceSize;    ///< Size of the JSON file
+    int64_t  sourceMtime;   ///< Modification time of the JSON file
+    uint32_t entryCount;    ///< Number of entries
+    uint32_t stringsSize;   ///< Size of the APN string area
+}
+TableHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Table entry
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char     mcc[LE_MRC_MCC_BYTES];     ///< MCC
+    char     mnc[LE_MRC_MNC_BYTES];     ///< MNC
+    uint32_t apnOffset;                 ///< Offset of the APN in the string area
+}
+TableEntry_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mapped table
+ */
+//--------------------------------------------------------------------------------------------------
+static le_fs_MappingRef_t TableMapping;
+static const TableHeader_t* TableHeaderPtr;
+static const TableEntry_t* TableEntriesPtr;
+static const char* TableStringsPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the MCC, MNC and APN of a JSON APN entry.
+ *
+ * @return true if the entry is a default APN with a valid MCC, MNC and APN.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool GetDefaultEntry
+(
+    json_t*      dataPtr,   ///< [IN]  JSON entry
+    const char** mccPtrPtr, ///< [OUT] MCC
+    const char** mncPtrPtr, ///< [OUT] MNC
+    const char** apnPtrPtr  ///< [OUT] APN
+)
+{
+    const char* typePtr;
+
+    if (!json_is_object(dataPtr))
+    {
+        return false;
+    }
+
+    // No type set for this carrier means "default"
+    typePtr = json_string_value(json_object_get(dataPtr, "@type"));
+    if ((NULL != typePtr) && (NULL == strstr(typePtr, "default")))
+    {
+        return false;
+    }
+
+    *mccPtrPtr = json_string_value(json_object_get(dataPtr, "@mcc"));
+    *mncPtrPtr = json_string_value(json_object_get(dataPtr, "@mnc"));
+    *apnPtrPtr = json_string_value(json_object_get(dataPtr, "@apn"));
+
+    return ((NULL != *mccPtrPtr) && (strlen(*mccPtrPtr) < LE_MRC_MCC_BYTES) &&
+            (NULL != *mncPtrPtr) && (strlen(*mncPtrPtr) < LE_MRC_MNC_BYTES) &&
+            (NULL != *apnPtrPtr) && (strlen(*apnPtrPtr) < LE_MDC_APN_NAME_MAX_BYTES));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare the MCC/MNC of two table entries.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareKey
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    const TableEntry_t* entryAPtr = aPtr;
+    const TableEntry_t* entryBPtr = bPtr;
+    int diff = strcmp(entryAPtr->mcc, entryBPtr->mcc);
+
+    return (0 != diff) ? diff : strcmp(entryAPtr->mnc, entryBPtr->mnc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare two table entries, keeping entries of the same MCC/MNC in the order of the JSON file.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareEntry
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    int diff = CompareKey(aPtr, bPtr);
+
+    if (0 == diff)
+    {
+        // APN strings are stored in the order of the JSON file.
+        uint32_t offsetA = ((const TableEntry_t*)aPtr)->apnOffset;
+        uint32_t offsetB = ((const TableEntry_t*)bPtr)->apnOffset;
+        diff = (offsetA > offsetB) - (offsetA < offsetB);
+    }
+
+    return diff;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compile the JSON APN database into a table and store it with le_fs.
+ *
+ * @return LE_OK on success, LE_FAULT otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t BuildTable
+(
+    const char*        apnFilePtr,  ///< [IN] APN database (JSON)
+    const struct stat* statPtr      ///< [IN] Attributes of the APN database
+)
+{
+    le_result_t result = LE_FAULT;
+    json_t *root, *apnArray;
+    json_error_t error;
+    TableHeader_t header = { 0 };
+    TableEntry_t* entriesPtr = NULL;
+    char* stringsPtr = NULL;
+    size_t i, count = 0, stringsSize = 0;
+    const char *mccPtr, *mncPtr, *apnPtr;
+    le_fs_FileRef_t fileRef;
+
+    root = json_load_file(apnFilePtr, 0, &error);
+    if (NULL == root)
+    {
+        LE_WARN("Document not parsed successfully (error '%s')", error.text);
+        return LE_FAULT;
+    }
+
+    apnArray = json_object_get(json_object_get(root, "apns"), "apn");
+    if (!json_is_array(apnArray))
+    {
+        LE_WARN("apns is not an array");
+        goto end;
+    }
+
+    // First pass: size the table.
+    for (i = 0; i < json_array_size(apnArray); i++)
+    {
+        if (GetDefaultEntry(json_array_get(apnArray, i), &mccPtr, &mncPtr, &apnPtr))
+        {
+            count++;
+            stringsSize += strlen(apnPtr) + 1;
+        }
+    }
+
+    entriesPtr = calloc(count ? count : 1, sizeof(TableEntry_t));
+    stringsPtr = malloc(stringsSize ? stringsSize : 1);
+    if ((NULL == entriesPtr) || (NULL == stringsPtr))
+    {
+        LE_ERROR("Not enough memory for %zu APN entries", count);
+        goto end;
+    }
+
+    // Second pass: fill the entries and strings.
+    count = 0;
+    stringsSize = 0;
+    for (i = 0; i < json_array_size(apnArray); i++)
+    {
+        if (GetDefaultEntry(json_array_get(apnArray, i), &mccPtr, &mncPtr, &apnPtr))
+        {
+            TableEntry_t* entryPtr = &entriesPtr[count++];
+
+            le_utf8_Copy(entryPtr->mcc, mccPtr, sizeof(entryPtr->mcc), NULL);
+            le_utf8_Copy(entryPtr->mnc, mncPtr, sizeof(entryPtr->mnc), NULL);
+            entryPtr->apnOffset = stringsSize;
+            strcpy(stringsPtr + stringsSize, apnPtr);
+            stringsSize += strlen(apnPtr) + 1;
+        }
+    }
+
+    // Sort, then keep only the first entry of each MCC/MNC.
+    qsort(entriesPtr, count, sizeof(TableEntry_t), CompareEntry);
+    if (count > 1)
+    {
+        size_t kept = 1;
+        for (i = 1; i < count; i++)
+        {
+            if (0 != CompareKey(&entriesPtr[kept - 1], &entriesPtr[i]))
+            {
+                entriesPtr[kept++] = entriesPtr[i];
+            }
+        }
+        count = kept;
+    }
+
+    header.magic = APN_TABLE_MAGIC;
+    header.version = APN_TABLE_VERSION;
+    header.sourceSize = statPtr->st_size;
+    header.sourceMtime = statPtr->st_mtime;
+    header.entryCount = count;
+    header.stringsSize = stringsSize;
+
+    // Write a temporary file, then move it over the table, so the table is never seen half
+    // written.
+    if (LE_OK != le_fs_Open(APN_TABLE_TMP_PATH, LE_FS_WRONLY | LE_FS_CREAT | LE_FS_TRUNC,
+                            &fileRef))
+    {
+        LE_ERROR("Failed to create %s", APN_TABLE_TMP_PATH);
+        goto end;
+    }
+
+    result = le_fs_Write(fileRef, (const uint8_t*)&header, sizeof(header));
+    if (LE_OK == result)
+    {
+        result = le_fs_Write(fileRef, (const uint8_t*)entriesPtr, count * sizeof(TableEntry_t));
+    }
+    if (LE_OK == result)
+    {
+        result = le_fs_Write(fileRef, (const uint8_t*)stringsPtr, stringsSize);
+    }
+    if (LE_OK != le_fs_Close(fileRef))
+    {
+        result = LE_FAULT;
+    }
+    if (LE_OK == result)
+    {
+        result = le_fs_Move(APN_TABLE_TMP_PATH, APN_TABLE_PATH);
+    }
+
+    if (LE_OK == result)
+    {
+        LE_INFO("Compiled %zu default APNs from %s", count, apnFilePtr);
+    }
+    else
+    {
+        LE_ERROR("Failed to write %s: %s", APN_TABLE_PATH, LE_RESULT_TXT(result));
+        le_fs_Delete(APN_TABLE_TMP_PATH);
+        result = LE_FAULT;
+    }
+
+end:
+    free(entriesPtr);
+    free(stringsPtr);
+    json_decref(root);
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the mapped table.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UnmapTable
+(
+    void
+)
+{
+    if (NULL != TableMapping)
+    {
+        le_fs_Unmap(TableMapping);
+        TableMapping = NULL;
+    }
+    TableHeaderPtr = NULL;
+    TableEntriesPtr = NULL;
+    TableStringsPtr = NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map the table, if it was compiled from the current APN database.
+ *
+ * @return LE_OK on success, LE_NOT_FOUND if the table is missing or out of date.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t MapTable
+(
+    const struct stat* statPtr      ///< [IN] Attributes of the APN database
+)
+{
+    const uint8_t* dataPtr;
+    size_t size;
+    const TableHeader_t* headerPtr;
+
+    if (LE_OK != le_fs_MapReadOnly(APN_TABLE_PATH, LE_FS_ACCESS_RANDOM,
+                                   &TableMapping, &dataPtr, &size))
+    {
+        TableMapping = NULL;
+        return LE_NOT_FOUND;
+    }
+
+    headerPtr = (const TableHeader_t*)dataPtr;
+
+    if (   (size < sizeof(TableHeader_t))
+        || (APN_TABLE_MAGIC != headerPtr->magic)
+        || (APN_TABLE_VERSION != headerPtr->version)
+        || ((uint64_t)statPtr->st_size != headerPtr->sourceSize)
+        || ((int64_t)statPtr->st_mtime != headerPtr->sourceMtime)
+        || (size != sizeof(TableHeader_t)
+                    + (size_t)headerPtr->entryCount * sizeof(TableEntry_t)
+                    + headerPtr->stringsSize)
+        || ((headerPtr->stringsSize > 0) && ('\0' != dataPtr[size - 1]))
+       )
+    {
+        UnmapTable();
+        return LE_NOT_FOUND;
+    }
+
+    TableHeaderPtr = headerPtr;
+    TableEntriesPtr = (const TableEntry_t*)(dataPtr + sizeof(TableHeader_t));
+    TableStringsPtr = (const char*)(TableEntriesPtr + headerPtr->entryCount);
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up the default APN of a MCC/MNC.
+ *
+ * The APN database is a JSON file of several megabytes.  Instead of parsing it for every lookup,
+ * its default APNs are compiled once into a table sorted by MCC/MNC, which is stored with le_fs
+ * and mapped into memory.  The table is compiled again whenever the JSON file changes.
+ *
+ * @return
+ *      - LE_OK         An APN was found
+ *      - LE_NOT_FOUND  There is no default APN for this MCC/MNC
+ *      - LE_OVERFLOW   The APN buffer is too small
+ *      - LE_FAULT      The table could not be compiled or mapped
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t apnTable_FindWithMccMnc
+(
+    const char* apnFilePtr, ///< [IN]  APN database (JSON)
+    const char* mccPtr,     ///< [IN]  MCC
+    const char* mncPtr,     ///< [IN]  MNC
+    char*       apnPtr,     ///< [OUT] APN for MCC/MNC
+    size_t      apnSize     ///< [IN]  Size of the APN buffer
+)
+{
+    struct stat st;
+    TableEntry_t key = { 0 };
+    const TableEntry_t* entryPtr;
+
+    if (0 != stat(apnFilePtr, &st))
+    {
+        LE_WARN("Cannot access %s: %m", apnFilePtr);
+        return LE_FAULT;
+    }
+
+    // Check that the mapped table is still up to date.
+    if (   (NULL != TableHeaderPtr)
+        && (   ((uint64_t)st.st_size != TableHeaderPtr->sourceSize)
+            || ((int64_t)st.st_mtime != TableHeaderPtr->sourceMtime)))
+    {
+        UnmapTable();
+    }
+
+    if (NULL == TableHeaderPtr)
+    {
+        if (LE_OK != MapTable(&st))
+        {
+            if ((LE_OK != BuildTable(apnFilePtr, &st)) || (LE_OK != MapTable(&st)))
+            {
+                return LE_FAULT;
+            }
+        }
+    }
+
+    if (   (LE_OK != le_utf8_Copy(key.mcc, mccPtr, sizeof(key.mcc), NULL))
+        || (LE_OK != le_utf8_Copy(key.mnc, mncPtr, sizeof(key.mnc), NULL)))
+    {
+        return LE_NOT_FOUND;
+    }
+
+    entryPtr = bsearch(&key, TableEntriesPtr, TableHeaderPtr->entryCount, sizeof(TableEntry_t),
+                       CompareKey);
+    if ((NULL == entryPtr) || (entryPtr->apnOffset >= TableHeaderPtr->stringsSize))
+    {
+        return LE_NOT_FOUND;
+    }
+
+    if (LE_OK != le_utf8_Copy(apnPtr, TableStringsPtr + entryPtr->apnOffset, apnSize, NULL))
+    {
+        LE_WARN("APN buffer is too small");
+        return LE_OVERFLOW;
+    }
+
+    LE_INFO("Got APN '%s' for MCC/MNC [%s/%s]", apnPtr, mccPtr, mncPtr);
+    return LE_OK;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file apnTable.h
+ *
+ * Indexed table of the default APNs of the MCC/MNC APN database.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef _APNTABLE_H
+#define _APNTABLE_H
+
+#include <legato.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up the default APN of a MCC/MNC.
+ *
+ * The APN database is a JSON file of several megabytes.  Instead of parsing it for every lookup,
+ * its default APNs are compiled once into a table sorted by MCC/MNC, which is stored with le_fs
+ * and mapped into memory.  The table is compiled again whenever the JSON file changes.
+ *
+ * @return
+ *      - LE_OK         An APN was found
+ *      - LE_NOT_FOUND  There is no default APN for this MCC/MNC
+ *      - LE_OVERFLOW   The APN buffer is too small
+ *      - LE_FAULT      The table could not be compiled or mapped
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t apnTable_FindWithMccMnc
+(
+    const char* apnFilePtr, ///< [IN]  APN database (JSON)
+    const char* mccPtr,     ///< [IN]  MCC
+    const char* mncPtr,     ///< [IN]  MNC
+    char*       apnPtr,     ///< [OUT] APN for MCC/MNC
+    size_t      apnSize     ///< [IN]  Size of the APN buffer
+);
+
+#endif // _APNTABLE_H
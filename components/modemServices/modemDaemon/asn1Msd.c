@@ -25,6 +25,37 @@ static const uint8_t PrintableAsciiCodes[33] =
     0x4D,0x4E,0x50,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5A
 };
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length in bytes of the encoded static vehicle fields: 17 VIN characters of 6 bits, and
+ * up to 15 bits for the propulsion storage type.
+ */
+//--------------------------------------------------------------------------------------------------
+#define VEHICLE_TEMPLATE_MAX_LEN    16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pre-encoded static vehicle fields of the MSD, with the values they were encoded from.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool                               isValid;    ///< true if the template has been encoded
+    uint8_t                            version;    ///< MSD version
+    msd_Vin_t                          vin;        ///< Vehicle identification number
+    msd_VehiclePropulsionStorageType_t propulsion; ///< Vehicle propulsion storage type
+    uint16_t                           bitLen;     ///< Encoded length in bits
+    uint8_t                            bits[VEHICLE_TEMPLATE_MAX_LEN]; ///< Encoded fields
+}
+VehicleTemplate_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Template of the static vehicle fields, copied into each encoded MSD.
+ */
+//--------------------------------------------------------------------------------------------------
+static VehicleTemplate_t VehicleTemplate;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function checks the validity of the Vehicle Identification Number.
@@ -187,6 +218,233 @@ static uint16_t PutTwoBytes
    return (msgOffset + elmtLen);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function encodes the vehicle identification number and the vehicle propulsion storage type
+ * of the MSD, from offset 0 of the output buffer.
+ *
+ * @return the encoded length in bits on success
+ * @return LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static int32_t EncodeVehicleFields
+(
+    msd_t*      msdDataPtr, ///< [IN] MSD data
+    uint8_t*    outDataPtr  ///< [OUT] encoded fields
+)
+{
+    uint8_t off = 0;
+    uint16_t offset = 0;
+    int i;
+
+    /* Vehicle identification Number */
+    if (!IsVinValid(msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber))
+    {
+        LE_ERROR("Cannot encode Vehicle Identification Number!");
+        return LE_FAULT;
+    }
+
+    /* Each character is coded within 6 bits according to translation table */
+    /* isowmi */
+    for (i=0;i<3;i++)
+    {
+        uint8_t* ptr = (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isowmi;
+        int8_t tmp = GetAsciiCode (ptr[i]);
+        /* check if character is authorized */
+        if (tmp <0)
+        {
+            LE_ERROR("Unable to get ASCII code for isowmi");
+            return LE_FAULT;
+        }
+        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
+    }
+
+    /* isovdsvds */
+    for (i=0;i<6;i++)
+    {
+        uint8_t* ptr = (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isovds;
+        int8_t tmp = GetAsciiCode (ptr[i]);
+        /* check if character is authorized */
+        if (tmp <0)
+        {
+            LE_ERROR("Unable to get ASCII code for isovds");
+            return LE_FAULT;
+        }
+        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
+    }
+
+    /* isovisModelyear */
+    for (i=0;i<1;i++)
+    {
+        uint8_t* ptr =
+            (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isovisModelyear;
+        int8_t tmp = GetAsciiCode (ptr[i]);
+        /* check if character is authorized */
+        if (tmp <0)
+        {
+            LE_ERROR("Unable to get ASCII code for isovisModelyear");
+            return LE_FAULT;
+        }
+        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
+    }
+
+    /* isovisSeqPlant */
+    for (i=0;i<7;i++)
+    {
+        uint8_t* ptr =
+            (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isovisSeqPlant;
+        int8_t tmp = GetAsciiCode (ptr[i]);
+        /* check if character is authorized */
+        if (tmp <0)
+        {
+            LE_ERROR("Unable to get ASCII code for isovisSeqPlant");
+            return LE_FAULT;
+        }
+        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
+    }
+
+    /* VehiclePropulsionStorageType */
+    /* Extension bit */
+    offset = PutBits(offset, 1, &off, outDataPtr);
+
+    offset = PutBits(offset, 1
+             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.gasolineTankPresent
+             , outDataPtr);
+    offset = PutBits(offset, 1
+             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent
+             , outDataPtr);
+    offset = PutBits(offset, 1
+    , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.compressedNaturalGas
+    , outDataPtr);
+    offset = PutBits(offset, 1
+             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.liquidPropaneGas
+             , outDataPtr);
+    offset = PutBits(offset, 1
+    , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.electricEnergyStorage
+    , outDataPtr);
+    offset = PutBits(offset, 1
+             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.hydrogenStorage
+             , outDataPtr);
+    if (msdDataPtr->version == 2)
+    {
+        offset = PutBits(offset, 1
+                 , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.otherStorage
+                 , outDataPtr);
+    }
+
+    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.gasolineTankPresent )
+    {
+        offset = PutBits(offset, 1
+        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.gasolineTankPresent
+        , outDataPtr);
+    }
+    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent )
+    {
+        offset = PutBits(offset, 1
+        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent
+        , outDataPtr);
+    }
+    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.compressedNaturalGas )
+    {
+        offset = PutBits(offset, 1
+        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.compressedNaturalGas
+        , outDataPtr);
+    }
+    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.liquidPropaneGas )
+    {
+        offset = PutBits(offset, 1
+        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.liquidPropaneGas
+        , outDataPtr);
+    }
+    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.electricEnergyStorage )
+    {
+        offset = PutBits(offset, 1
+        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.electricEnergyStorage
+        , outDataPtr);
+    }
+    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.hydrogenStorage )
+    {
+        offset = PutBits(offset, 1
+        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.hydrogenStorage
+        , outDataPtr);
+    }
+    if (msdDataPtr->version == 2)
+    {
+       if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.otherStorage )
+       {
+           offset = PutBits(offset, 1
+           , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.otherStorage
+           , outDataPtr);
+       }
+    }
+
+    return offset;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function checks whether the vehicle template matches the static fields of an MSD.
+ *
+ * @return true if the template can be used to encode the MSD, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsVehicleTemplateValid
+(
+    const msd_t* msdDataPtr ///< [IN] MSD data
+)
+{
+    return VehicleTemplate.isValid &&
+           (VehicleTemplate.version == msdDataPtr->version) &&
+           (0 == memcmp(&VehicleTemplate.vin,
+                        &msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber,
+                        sizeof(VehicleTemplate.vin))) &&
+           (0 == memcmp(&VehicleTemplate.propulsion,
+                        &msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType,
+                        sizeof(VehicleTemplate.propulsion)));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function pre-encodes the static vehicle fields of the MSD (vehicle identification number
+ * and propulsion storage type) into the template used by msd_EncodeMsdMessage(). This is done
+ * when the eCall settings are loaded, so that only the fields which change from one MSD to the
+ * other are encoded when an eCall is started.
+ *
+ * @return LE_OK on success
+ * @return LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msd_EncodeVehicleTemplate
+(
+    msd_t*      msdDataPtr  ///< [IN] MSD data
+)
+{
+    int32_t bitLen;
+
+    if (IsVehicleTemplateValid(msdDataPtr))
+    {
+        return LE_OK;
+    }
+
+    VehicleTemplate.isValid = false;
+    memset(VehicleTemplate.bits, 0, sizeof(VehicleTemplate.bits));
+
+    bitLen = EncodeVehicleFields(msdDataPtr, VehicleTemplate.bits);
+    if (LE_FAULT == bitLen)
+    {
+        return LE_FAULT;
+    }
+
+    VehicleTemplate.version = msdDataPtr->version;
+    VehicleTemplate.vin = msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber;
+    VehicleTemplate.propulsion = msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType;
+    VehicleTemplate.bitLen = bitLen;
+    VehicleTemplate.isValid = true;
+
+    LE_DEBUG("MSD vehicle template encoded on %d bits", bitLen);
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function encodes the MSD message optional data from the elements of the MSD data structure
@@ -341,145 +599,21 @@ int32_t msd_EncodeMsdMessage
         offset = PutBits(offset, 4, &tmp , outDataPtr);
     }
 
-    /* Vehicle identification Number */
-    if (!IsVinValid(msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber))
-    {
-        LE_ERROR("Cannot encode Vehicle Identification Number!");
-        return LE_FAULT;
-    }
-
-    /* Each character is coded within 6 bits according to translation table */
-    /* isowmi */
-    for (i=0;i<3;i++)
-    {
-        uint8_t* ptr = (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isowmi;
-        int8_t tmp = GetAsciiCode (ptr[i]);
-        /* check if character is authorized */
-        if (tmp <0)
-        {
-            LE_ERROR("Unable to get ASCII code for isowmi");
-            return LE_FAULT;
-        }
-        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
-    }
-
-    /* isovdsvds */
-    for (i=0;i<6;i++)
-    {
-        uint8_t* ptr = (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isovds;
-        int8_t tmp = GetAsciiCode (ptr[i]);
-        /* check if character is authorized */
-        if (tmp <0)
-        {
-            LE_ERROR("Unable to get ASCII code for isovds");
-            return LE_FAULT;
-        }
-        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
-    }
-
-    /* isovisModelyear */
-    for (i=0;i<1;i++)
-    {
-        uint8_t* ptr =
-            (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isovisModelyear;
-        int8_t tmp = GetAsciiCode (ptr[i]);
-        /* check if character is authorized */
-        if (tmp <0)
-        {
-            LE_ERROR("Unable to get ASCII code for isovisModelyear");
-            return LE_FAULT;
-        }
-        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
-    }
-
-    /* isovisSeqPlant */
-    for (i=0;i<7;i++)
+    /* Vehicle identification Number and VehiclePropulsionStorageType, from the template */
+    if (!IsVehicleTemplateValid(msdDataPtr))
     {
-        uint8_t* ptr =
-            (uint8_t*) msdDataPtr->msdMsg.msdStruct.vehIdentificationNumber.isovisSeqPlant;
-        int8_t tmp = GetAsciiCode (ptr[i]);
-        /* check if character is authorized */
-        if (tmp <0)
+        if (LE_OK != msd_EncodeVehicleTemplate(msdDataPtr))
         {
-            LE_ERROR("Unable to get ASCII code for isovisSeqPlant");
             return LE_FAULT;
         }
-        offset = PutBits(offset, 6, (uint8_t*) &tmp, outDataPtr);
     }
-
-    /* VehiclePropulsionStorageType */
-    /* Extension bit */
-    offset = PutBits(offset, 1, &off, outDataPtr);
-
-    offset = PutBits(offset, 1
-             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.gasolineTankPresent
-             , outDataPtr);
-    offset = PutBits(offset, 1
-             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent
-             , outDataPtr);
-    offset = PutBits(offset, 1
-    , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.compressedNaturalGas
-    , outDataPtr);
-    offset = PutBits(offset, 1
-             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.liquidPropaneGas
-             , outDataPtr);
-    offset = PutBits(offset, 1
-    , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.electricEnergyStorage
-    , outDataPtr);
-    offset = PutBits(offset, 1
-             , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.hydrogenStorage
-             , outDataPtr);
-    if (msdDataPtr->version == 2)
+    for (i = 0; i < VehicleTemplate.bitLen; i += 8)
     {
-        offset = PutBits(offset, 1
-                 , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.otherStorage
-                 , outDataPtr);
-    }
+        uint16_t len = ((VehicleTemplate.bitLen - i) < 8 ? (VehicleTemplate.bitLen - i) : 8);
+        // PutBits() takes the least significant bits of a partial byte
+        uint8_t tmp = VehicleTemplate.bits[i / 8] >> (8 - len);
 
-    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.gasolineTankPresent )
-    {
-        offset = PutBits(offset, 1
-        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.gasolineTankPresent
-        , outDataPtr);
-    }
-    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent )
-    {
-        offset = PutBits(offset, 1
-        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.dieselTankPresent
-        , outDataPtr);
-    }
-    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.compressedNaturalGas )
-    {
-        offset = PutBits(offset, 1
-        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.compressedNaturalGas
-        , outDataPtr);
-    }
-    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.liquidPropaneGas )
-    {
-        offset = PutBits(offset, 1
-        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.liquidPropaneGas
-        , outDataPtr);
-    }
-    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.electricEnergyStorage )
-    {
-        offset = PutBits(offset, 1
-        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.electricEnergyStorage
-        , outDataPtr);
-    }
-    if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.hydrogenStorage )
-    {
-        offset = PutBits(offset, 1
-        , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.hydrogenStorage
-        , outDataPtr);
-    }
-    if (msdDataPtr->version == 2)
-    {
-       if ( msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.otherStorage )
-       {
-           offset = PutBits(offset, 1
-           , (uint8_t*)&msdDataPtr->msdMsg.msdStruct.vehPropulsionStorageType.otherStorage
-           , outDataPtr);
-       }
+        offset = PutBits(offset, len, &tmp, outDataPtr);
     }
 
     /* Timestamp ( 32 bits ==> 4 * 8 bits ==> to check order ) */
@@ -336,6 +336,21 @@ int32_t msd_EncodeOptionalDataForEraGlonass
                                               ///  calling function must be minimum 140 Bytes)
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function pre-encodes the static vehicle fields of the MSD (vehicle identification number
+ * and propulsion storage type) into the template used by msd_EncodeMsdMessage(). The template is
+ * encoded again by msd_EncodeMsdMessage() if these fields change.
+ *
+ * @return LE_OK on success
+ * @return LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msd_EncodeVehicleTemplate
+(
+    msd_t*      msdDataPtr  ///< [IN] MSD data
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function encodes the MSD message from the elements of the MSD data structure
@@ -12,9 +12,72 @@
 #include "interfaces.h"
 #include "pa_adc.h"
 
+#if LE_CONFIG_SENSOR_SAMPLE_CACHE_MS > 0
 //--------------------------------------------------------------------------------------------------
 /**
- * Read values from the ADC channels
+ * Number of ADC channels whose last reading is kept.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ADC_CACHE_SIZE      8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Last reading of an ADC channel.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char            name[LE_ADC_ADC_NAME_MAX_BYTES];    ///< ADC name, empty if the entry is unused
+    int32_t         value;                              ///< Last value read
+    le_clk_Time_t   time;                               ///< Time the value was read
+}
+AdcReading_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Last readings of the ADC channels.
+ */
+//--------------------------------------------------------------------------------------------------
+static AdcReading_t AdcCache[ADC_CACHE_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Index of the next entry of AdcCache to replace when a new channel is read.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t AdcCacheNext;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the cache entry of an ADC channel.
+ *
+ * @return The entry, or NULL if the channel has not been read recently.
+ */
+//--------------------------------------------------------------------------------------------------
+static AdcReading_t* FindAdcReading
+(
+    const char* adcNamePtr      ///< [IN] Name of the ADC.
+)
+{
+    size_t i;
+
+    for (i = 0; i < ADC_CACHE_SIZE; i++)
+    {
+        if (0 == strcmp(AdcCache[i].name, adcNamePtr))
+        {
+            return &AdcCache[i];
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read values from the ADC channels.  The value read by the last call for a channel is returned
+ * again for LE_CONFIG_SENSOR_SAMPLE_CACHE_MS milliseconds, so that clients polling the same
+ * channel share a single PA request.
  *
  * @return
  *      - LE_OK            The function succeeded.
@@ -37,6 +100,46 @@ le_result_t le_adc_ReadValue
         LE_KILL_CLIENT("Parameters pointer are NULL!!");
         return LE_FAULT;
     }
+
+#if LE_CONFIG_SENSOR_SAMPLE_CACHE_MS > 0
+    if ('\0' == adcNamePtr[0])
+    {
+        return pa_adc_ReadValue(adcNamePtr, adcValuePtr);
+    }
+
+    AdcReading_t* readingPtr = FindAdcReading(adcNamePtr);
+    if (NULL != readingPtr)
+    {
+        le_clk_Time_t age = le_clk_Sub(le_clk_GetRelativeTime(), readingPtr->time);
+
+        if (((age.sec * 1000) + (age.usec / 1000)) < LE_CONFIG_SENSOR_SAMPLE_CACHE_MS)
+        {
+            *adcValuePtr = readingPtr->value;
+            return LE_OK;
+        }
+    }
+
+    le_result_t result = pa_adc_ReadValue(adcNamePtr, adcValuePtr);
+    if (LE_OK != result)
+    {
+        if (NULL != readingPtr)
+        {
+            readingPtr->name[0] = '\0';
+        }
+        return result;
+    }
+
+    if (NULL == readingPtr)
+    {
+        readingPtr = &AdcCache[AdcCacheNext];
+        AdcCacheNext = (AdcCacheNext + 1) % ADC_CACHE_SIZE;
+        le_utf8_Copy(readingPtr->name, adcNamePtr, sizeof(readingPtr->name), NULL);
+    }
+    readingPtr->value = *adcValuePtr;
+    readingPtr->time = le_clk_GetRelativeTime();
+    return LE_OK;
+#else
     return pa_adc_ReadValue(adcNamePtr, adcValuePtr);
+#endif
 }
 
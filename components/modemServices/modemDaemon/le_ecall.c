@@ -1508,7 +1508,17 @@ static le_result_t LoadECallSettings
 
     le_cfg_CancelTxn(eCallCfg);
 
-    return GetPropulsionType();
+    le_result_t result = GetPropulsionType();
+
+    // Pre-encode the static vehicle fields, so that they are not encoded when the eCall starts
+    if ((LE_OK == result) &&
+        ('\0' != eCallPtr->msd.msdMsg.msdStruct.vehIdentificationNumber.isowmi[0]))
+    {
+        LE_WARN_IF(LE_OK != msd_EncodeVehicleTemplate(&eCallPtr->msd),
+                   "Unable to pre-encode the MSD vehicle fields");
+    }
+
+    return result;
 }
 
 //--------------------------------------------------------------------------------------------------
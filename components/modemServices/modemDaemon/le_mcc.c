@@ -31,6 +31,14 @@
 //--------------------------------------------------------------------------------------------------
 #define MCC_MAX_SESSION 5
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of modem call identifiers indexed by CallIdIndex.  Calls with a greater identifier are
+ * looked up in CallList.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MCC_CALL_ID_INDEX_SIZE  32
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Define the maximum size of various profile related fields.
@@ -259,6 +267,15 @@ le_dls_List_t  SessionCtxList;
 //--------------------------------------------------------------------------------------------------
 le_dls_List_t  CallList;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calls in progress, indexed by modem call identifier, so that call event indications don't need
+ * to search CallList.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mcc_Call_t* CallIdIndex[MCC_CALL_ID_INDEX_SIZE];
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Wakeup source to keep system awake during phone calls.
@@ -268,6 +285,60 @@ le_dls_List_t  CallList;
 static le_pm_WakeupSourceRef_t WakeupSource = NULL;
 #define CALL_WAKEUP_SOURCE_NAME "call"
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a modem call identifier is in the range of CallIdIndex.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static inline bool IsIndexedCallId
+(
+    int16_t id
+)
+{
+    return ((id >= 0) && (id < MCC_CALL_ID_INDEX_SIZE));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mark a call as in progress with a given modem call identifier.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetCallInProgress
+(
+    le_mcc_Call_t*  callPtr,
+    int16_t         id
+)
+{
+    callPtr->callId = id;
+    callPtr->inProgress = true;
+
+    if (IsIndexedCallId(id))
+    {
+        CallIdIndex[id] = callPtr;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mark a call as not in progress anymore.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ClearCallInProgress
+(
+    le_mcc_Call_t*  callPtr
+)
+{
+    callPtr->inProgress = false;
+
+    if ((IsIndexedCallId(callPtr->callId)) && (CallIdIndex[callPtr->callId] == callPtr))
+    {
+        CallIdIndex[callPtr->callId] = NULL;
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Call destructor.
@@ -281,9 +352,10 @@ static void CallDestructor
 {
     le_mcc_Call_t *callPtr = (le_mcc_Call_t*)objPtr;
 
-    // Remove from the list
+    // Remove from the list and the index
     if (callPtr)
     {
+        ClearCallInProgress(callPtr);
         le_dls_Remove(&CallList, &callPtr->link);
     }
 }
@@ -302,7 +374,15 @@ static le_mcc_Call_t* GetCallObject
 {
     le_dls_Link_t* linkPtr = NULL;
 
-    if (id != -1)
+    if (IsIndexedCallId(id))
+    {
+        if (NULL != CallIdIndex[id])
+        {
+            LE_DEBUG("callId found in callPtr %p", CallIdIndex[id]);
+            return CallIdIndex[id];
+        }
+    }
+    else if (id != -1)
     {
         linkPtr = le_dls_Peek(&CallList);
 
@@ -850,8 +930,7 @@ static void NewCallEventHandler
             newCall = true;
         }
 
-        callPtr->callId = dataPtr->callId;
-        callPtr->inProgress = true;
+        SetCallInProgress(callPtr, dataPtr->callId);
         callPtr->lastEvent = callPtr->event;
         callPtr->event = dataPtr->event;
     }
@@ -885,7 +964,7 @@ static void NewCallEventHandler
             {
                 le_pm_Relax(WakeupSource);
             }
-            callPtr->inProgress = false;
+            ClearCallInProgress(callPtr);
 
             // Only update the termination reason when LE_MCC_EVENT_TERMINATED
             // event is received to always save the last call termination reason.
@@ -1262,8 +1341,7 @@ le_result_t le_mcc_Start
 
     if ( res == LE_OK )
     {
-        callPtr->callId = (int16_t)callId;
-        callPtr->inProgress = true;
+        SetCallInProgress(callPtr, (int16_t)callId);
     }
 
     return res;
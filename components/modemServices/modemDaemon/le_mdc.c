@@ -16,6 +16,9 @@
 #ifndef MK_CONFIG_MODEMSERVICE_NO_JANSSON
 #include "jansson.h"
 #endif
+#if LE_CONFIG_LINUX
+#include "apnTable.h"
+#endif
 #include "mdmCfgEntries.h"
 #include "pa_mdc.h"
 #include "le_ms_local.h"
@@ -61,6 +64,14 @@ CmdType_t;
 //--------------------------------------------------------------------------------------------------
 #define MDC_ASYNC_HDLRS_MAX 20
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum time between two saves of the data counters read by le_mdc_GetBytesCounters(), in
+ * seconds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MDC_DATA_COUNTERS_SAVE_INTERVAL 60
+
 //--------------------------------------------------------------------------------------------------
 // Data structures.
 //--------------------------------------------------------------------------------------------------
@@ -106,6 +117,16 @@ CmdRequest_t;
 //--------------------------------------------------------------------------------------------------
 static pa_mdc_PktStatistics_t DataStatistics;
 
+#if LE_CONFIG_ENABLE_CONFIG_TREE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timer used to save the data counters once per MDC_DATA_COUNTERS_SAVE_INTERVAL at most, however
+ * often le_mdc_GetBytesCounters() is called.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_timer_Ref_t DataCountersSaveTimer;
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * MT-PDP change handler counter
@@ -440,6 +461,16 @@ static le_result_t FindApnWithMccMncFromFile
     json_error_t error;
     int i;
 
+#if LE_CONFIG_LINUX
+    // Use the compiled table if possible: it avoids parsing the whole database.
+    result = apnTable_FindWithMccMnc(apnFilePtr, mccPtr, mncPtr, mccMncApnPtr, mccMncApnSize);
+    if (LE_FAULT != result)
+    {
+        return (LE_OVERFLOW == result) ? LE_FAULT : result;
+    }
+    LE_WARN("APN table unavailable, scanning %s", apnFilePtr);
+#endif
+
     root = json_load_file(apnFilePtr, 0, &error);
     if (NULL == root)
     {
@@ -963,6 +994,55 @@ static le_result_t SetDataCounters
 #endif
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the data counters: the saved counters plus the platform adaptor's counters.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_FAULT for all other errors
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadDataCounters
+(
+    uint64_t* rxBytesPtr,   ///< Received bytes
+    uint64_t* txBytesPtr    ///< Transmitted bytes
+)
+{
+    pa_mdc_PktStatistics_t data;
+    le_result_t result = pa_mdc_GetDataFlowStatistics(&data);
+    if (LE_OK != result)
+    {
+        return result;
+    }
+
+    *rxBytesPtr = DataStatistics.receivedBytesCount + data.receivedBytesCount;
+    *txBytesPtr = DataStatistics.transmittedBytesCount + data.transmittedBytesCount;
+    LE_DEBUG("Received and transmitted bytes: rx=%"PRIu64", tx=%"PRIu64, *rxBytesPtr, *txBytesPtr);
+
+    return LE_OK;
+}
+
+#if LE_CONFIG_ENABLE_CONFIG_TREE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Save the current data counters, after le_mdc_GetBytesCounters() has been called.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DataCountersSaveTimerHandler
+(
+    le_timer_Ref_t timerRef     ///< Timer that expired
+)
+{
+    uint64_t rxBytes, txBytes;
+
+    if (LE_OK == ReadDataCounters(&rxBytes, &txBytes))
+    {
+        SetDataCounters(rxBytes, txBytes);
+    }
+}
+#endif
+
 // =============================================
 //  MODULE/COMPONENT FUNCTIONS
 // =============================================
@@ -1027,6 +1107,11 @@ void le_mdc_Init
         pa_mdc_StopDataFlowStatistics();
     }
     GetDataCounters(&DataStatistics.receivedBytesCount, &DataStatistics.transmittedBytesCount);
+#if LE_CONFIG_ENABLE_CONFIG_TREE
+    DataCountersSaveTimer = le_timer_Create("MdcDataCountersSave");
+    le_timer_SetMsInterval(DataCountersSaveTimer, MDC_DATA_COUNTERS_SAVE_INTERVAL * 1000);
+    le_timer_SetHandler(DataCountersSaveTimer, DataCountersSaveTimerHandler);
+#endif
 
     /* MT-PDP management */
     // Create an event Id for MT-PDP notification
@@ -1383,7 +1468,10 @@ le_result_t le_mdc_StopSession
     }
 
     // Store data counters
-    le_mdc_GetBytesCounters(&rxBytes, &txBytes);
+    if (LE_OK == ReadDataCounters(&rxBytes, &txBytes))
+    {
+        SetDataCounters(rxBytes, txBytes);
+    }
 
     result = pa_mdc_StopSession(profilePtr->profileIndex);
     if (LE_OK != result)
@@ -2077,18 +2165,20 @@ le_result_t le_mdc_GetBytesCounters
         return LE_FAULT;
     }
 
-    pa_mdc_PktStatistics_t data;
-    le_result_t result = pa_mdc_GetDataFlowStatistics(&data);
+    le_result_t result = ReadDataCounters(rxBytes, txBytes);
     if (LE_OK != result)
     {
         return result;
     }
 
-    *rxBytes = DataStatistics.receivedBytesCount + data.receivedBytesCount;
-    *txBytes = DataStatistics.transmittedBytesCount + data.transmittedBytesCount;
-    LE_DEBUG("Received and transmitted bytes: rx=%"PRIu64", tx=%"PRIu64, *rxBytes, *txBytes);
-
-    SetDataCounters(*rxBytes, *txBytes);
+#if LE_CONFIG_ENABLE_CONFIG_TREE
+    // Save the counters later rather than on every call, so that polling them doesn't write the
+    // configuration tree each time.
+    if (!le_timer_IsRunning(DataCountersSaveTimer))
+    {
+        le_timer_Start(DataCountersSaveTimer);
+    }
+#endif
 
     return LE_OK;
 }
@@ -2115,6 +2205,9 @@ le_result_t le_mdc_ResetBytesCounter
         DataStatistics.receivedBytesCount = 0;
         DataStatistics.transmittedBytesCount = 0;
         SetDataCounters(DataStatistics.receivedBytesCount, DataStatistics.transmittedBytesCount);
+#if LE_CONFIG_ENABLE_CONFIG_TREE
+        le_timer_Stop(DataCountersSaveTimer);
+#endif
         return LE_OK;
     }
 
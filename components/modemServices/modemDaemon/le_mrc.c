@@ -92,6 +92,14 @@
 //--------------------------------------------------------------------------------------------------
 #define MRC_MAX_SCAN    10
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of cellular network scan results we expect to have at one time: one per Scan
+ * Information List object, plus the cached one.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MRC_MAX_SCANRESULT  (MRC_MAX_SCANLIST + 1)
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Maximum number of Signal Metrics objects we expect to have at one time.
@@ -348,6 +356,20 @@ typedef struct
     le_dls_Link_t link;
 } PlmnInfoSafeRef_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Result of a cellular network scan.  Results are reference counted, so that a recent result can
+ * be handed to several clients instead of scanning again.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_mrc_RatBitMask_t ratMask;             // Radio Access Technologies scanned
+    le_clk_Time_t       time;                // Relative time of the scan
+    le_dls_List_t       paScanInfoList;      // list of pa_mrc_ScanInformation_t
+} ScanResult_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * List Scan Information structure.
@@ -357,7 +379,7 @@ typedef struct
 typedef struct
 {
     le_msg_SessionRef_t sessionRef;          // Message session reference
-    le_dls_List_t       paScanInfoList;      // list of pa_mrc_ScanInformation_t
+    ScanResult_t*       resultPtr;           // Scan result, shared with other lists
     le_dls_List_t       safeRefScanInfoList; // list of ScanInfoSafeRef_t
     le_dls_Link_t       *currentLink;        // link for iterator
 } ScanInfoList_t;
@@ -533,6 +555,30 @@ LE_MEM_DEFINE_STATIC_POOL(ScanInformationList,
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t  ScanInformationListPool;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static pool for cellular network scan results
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(ScanResult,
+                          MRC_MAX_SCANRESULT,
+                          sizeof(ScanResult_t));
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory Pool for cellular network scan results.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t  ScanResultPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Most recent cellular network scan result, reused for the scans requested within
+ * LE_CONFIG_MRC_SCAN_CACHE_FRESHNESS seconds.  Protected by RegisteringNetworkMutex.
+ */
+//--------------------------------------------------------------------------------------------------
+static ScanResult_t* CachedScanResultPtr = NULL;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Static memory pool for listed information structure safe reference.
@@ -629,6 +675,13 @@ static le_ref_MapRef_t PlmnInformationRefMap;
 //--------------------------------------------------------------------------------------------------
 static le_event_Id_t RatChangeId;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of RAT changes reported by the platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t RatChangeCount = 0;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Event ID for New Packet Switched change notification.
@@ -847,6 +900,82 @@ static void DeleteSafeRefList
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor of a cellular network scan result, called when the last Scan Information List object
+ * using it is deleted and the result is no longer cached.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ScanResultDestructor
+(
+    void* objPtr
+)
+{
+    ScanResult_t* scanResultPtr = (ScanResult_t*)objPtr;
+
+    pa_mrc_DeleteScanInformation(&(scanResultPtr->paScanInfoList));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the result of a cellular network scan.  The cached result of a previous scan of the same
+ * Radio Access Technologies is returned if it is more recent than
+ * LE_CONFIG_MRC_SCAN_CACHE_FRESHNESS seconds, otherwise a new scan is performed.
+ *
+ * As scans are serialized by RegisteringNetworkMutex, the clients requesting a scan while another
+ * one is running get the result of the running scan.
+ *
+ * @return
+ *      Scan result, to be released by the caller. NULL if the scan failed.
+ */
+//--------------------------------------------------------------------------------------------------
+static ScanResult_t* GetPlmnScanResult
+(
+    le_mrc_RatBitMask_t ratMask ///< [IN] Radio Access Technology bitmask
+)
+{
+    ScanResult_t* scanResultPtr;
+
+    LOCK();
+
+    if ((CachedScanResultPtr) && (CachedScanResultPtr->ratMask == ratMask) &&
+        (le_clk_Sub(le_clk_GetRelativeTime(), CachedScanResultPtr->time).sec <
+         LE_CONFIG_MRC_SCAN_CACHE_FRESHNESS))
+    {
+        LE_DEBUG("Reusing cellular network scan result of RAT mask 0x%X", (unsigned int)ratMask);
+        le_mem_AddRef(CachedScanResultPtr);
+        UNLOCK();
+        return CachedScanResultPtr;
+    }
+
+    scanResultPtr = le_mem_ForceAlloc(ScanResultPool);
+    scanResultPtr->ratMask = ratMask;
+    scanResultPtr->paScanInfoList = LE_DLS_LIST_INIT;
+
+    if (LE_OK != pa_mrc_PerformNetworkScan(ratMask, PA_MRC_SCAN_PLMN,
+                                           &(scanResultPtr->paScanInfoList)))
+    {
+        le_mem_Release(scanResultPtr);
+        UNLOCK();
+        return NULL;
+    }
+    scanResultPtr->time = le_clk_GetRelativeTime();
+
+    if (LE_CONFIG_MRC_SCAN_CACHE_FRESHNESS > 0)
+    {
+        if (CachedScanResultPtr)
+        {
+            le_mem_Release(CachedScanResultPtr);
+        }
+        le_mem_AddRef(scanResultPtr);
+        CachedScanResultPtr = scanResultPtr;
+    }
+
+    UNLOCK();
+    return scanResultPtr;
+}
+
 #if LE_CONFIG_ENABLE_PCI_SCAN
 //--------------------------------------------------------------------------------------------------
 /**
@@ -950,6 +1079,8 @@ static void RatChangeHandler
 {
     LE_DEBUG("Handler Function called with RAT %d", *ratPtr);
 
+    RatChangeCount++;
+
     // Notify all the registered client's handlers
     le_event_ReportWithRefCounting(RatChangeId, ratPtr);
 }
@@ -1101,6 +1232,22 @@ le_result_t le_mrc_TestMccMnc
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of Radio Access Technology changes reported so far, so that other modules can
+ * tell whether a value that depends on the RAT in use is still valid.
+ *
+ * @return The number of RAT changes.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t le_mrc_GetRatChangeCount
+(
+    void
+)
+{
+    return RatChangeCount;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Handler to process an asynchronous command
@@ -1152,23 +1299,20 @@ static void ProcessMrcCommandEventHandler
 
         ScanInfoList_t* newScanInformationListPtr = NULL;
         le_mrc_ScanInformationListRef_t scanInformationListRef = NULL;
+        ScanResult_t* scanResultPtr = GetPlmnScanResult(ratMask);
 
-        newScanInformationListPtr = le_mem_ForceAlloc(ScanInformationListPool);
-        newScanInformationListPtr->paScanInfoList = LE_DLS_LIST_INIT;
-        newScanInformationListPtr->safeRefScanInfoList = LE_DLS_LIST_INIT;
-        newScanInformationListPtr->currentLink = NULL;
-
-        LOCK();
-        res = pa_mrc_PerformNetworkScan(ratMask, ((CmdRequest_t*) msgCommand)->scan.type,
-                                        &(newScanInformationListPtr->paScanInfoList));
-        UNLOCK();
-
-        if (LE_OK != res)
+        if (NULL == scanResultPtr)
         {
-            le_mem_Release(newScanInformationListPtr);
+            res = LE_FAULT;
         }
         else
         {
+            res = LE_OK;
+            newScanInformationListPtr = le_mem_ForceAlloc(ScanInformationListPool);
+            newScanInformationListPtr->resultPtr = scanResultPtr;
+            newScanInformationListPtr->safeRefScanInfoList = LE_DLS_LIST_INIT;
+            newScanInformationListPtr->currentLink = NULL;
+
             // Store message session reference.
             newScanInformationListPtr->sessionRef = cmdRequest->sessionRef;
 
@@ -1998,6 +2142,9 @@ void le_mrc_Init
                                                     MRC_MAX_SCANLIST,
                                                     sizeof(ScanInfoList_t));
 
+    ScanResultPool = le_mem_InitStaticPool(ScanResult, MRC_MAX_SCANRESULT, sizeof(ScanResult_t));
+    le_mem_SetDestructor(ScanResultPool, ScanResultDestructor);
+
     ScanInformationSafeRefPool = le_mem_InitStaticPool(ScanInformationSafeRef,
                                                        MRC_MAX_SCAN,
                                                        sizeof(ScanInfoSafeRef_t));
@@ -3609,27 +3756,20 @@ le_mrc_ScanInformationListRef_t le_mrc_PerformCellularNetworkScan
     le_mrc_RatBitMask_t ratMask ///< [IN] Radio Access Technology bitmask
 )
 {
-    le_result_t result;
     ScanInfoList_t* newScanInformationListPtr = NULL;
+    ScanResult_t* scanResultPtr = GetPlmnScanResult(ratMask);
 
-    newScanInformationListPtr = le_mem_ForceAlloc(ScanInformationListPool);
-    newScanInformationListPtr->paScanInfoList = LE_DLS_LIST_INIT;
-    newScanInformationListPtr->safeRefScanInfoList = LE_DLS_LIST_INIT;
-    newScanInformationListPtr->currentLink = NULL;
-
-    LOCK();
-    result = pa_mrc_PerformNetworkScan(ratMask,
-                                       PA_MRC_SCAN_PLMN,
-                                       &(newScanInformationListPtr->paScanInfoList));
-    UNLOCK();
-
-    if (result != LE_OK)
+    if (NULL == scanResultPtr)
     {
         LE_ERROR("Network scan error");
-        le_mem_Release(newScanInformationListPtr);
         return NULL;
     }
 
+    newScanInformationListPtr = le_mem_ForceAlloc(ScanInformationListPool);
+    newScanInformationListPtr->resultPtr = scanResultPtr;
+    newScanInformationListPtr->safeRefScanInfoList = LE_DLS_LIST_INIT;
+    newScanInformationListPtr->currentLink = NULL;
+
     // Store message session reference.
     newScanInformationListPtr->sessionRef = le_mrc_GetClientSessionRef();
 
@@ -3734,7 +3874,7 @@ le_mrc_ScanInformationRef_t le_mrc_GetFirstCellularNetworkScan
         return NULL;
     }
 
-    linkPtr = le_dls_Peek(&(scanInformationListPtr->paScanInfoList));
+    linkPtr = le_dls_Peek(&(scanInformationListPtr->resultPtr->paScanInfoList));
     if (linkPtr != NULL)
     {
         nodePtr = CONTAINER_OF(linkPtr, pa_mrc_ScanInformation_t, link);
@@ -3783,7 +3923,7 @@ le_mrc_ScanInformationRef_t le_mrc_GetNextCellularNetworkScan
         return NULL;
     }
 
-    linkPtr = le_dls_PeekNext(&(scanInformationListPtr->paScanInfoList),
+    linkPtr = le_dls_PeekNext(&(scanInformationListPtr->resultPtr->paScanInfoList),
                                 scanInformationListPtr->currentLink);
     if (linkPtr != NULL)
     {
@@ -3829,7 +3969,9 @@ void le_mrc_DeleteCellularNetworkScan
     }
 
     scanInformationListPtr->currentLink = NULL;
-    pa_mrc_DeleteScanInformation(&(scanInformationListPtr->paScanInfoList));
+
+    // The scan result is deleted once no list nor the cache uses it
+    le_mem_Release(scanInformationListPtr->resultPtr);
 
     // Delete the safe Reference list.
     DeleteSafeRefList(&(scanInformationListPtr->safeRefScanInfoList));
@@ -38,4 +38,17 @@ le_result_t le_mrc_TestMccMnc
     const char*   mncPtr       ///< [IN] Mobile Network Code
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of Radio Access Technology changes reported so far, so that other modules can
+ * tell whether a value that depends on the RAT in use is still valid.
+ *
+ * @return The number of RAT changes.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t le_mrc_GetRatChangeCount
+(
+    void
+);
+
 #endif // LEGATO_MRC_LOCAL_INCLUDE_GUARD
@@ -67,6 +67,9 @@ typedef struct le_sim_Obj
     bool             isReacheable;               ///< SIM is reachable when its state is inserted,
                                                  ///< ready or blocked
     Subscription_t   subscription;               ///< Subscription type
+    le_sim_States_t  state;                      ///< Last known SIM state
+    bool             isStateCached;              ///< true if 'state' holds the last known state
+    le_clk_Time_t    stateTime;                  ///< Time at which 'state' was last updated
 }
 Sim_t;
 
@@ -298,6 +301,40 @@ LE_MEM_DEFINE_STATIC_POOL(FPLMNOperator,
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t FPLMNOperatorPool;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store the last known state of a SIM card.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CacheSimState
+(
+    Sim_t*          simPtr,     ///< [IN,OUT] The SIM structure
+    le_sim_States_t state       ///< [IN] SIM state
+)
+{
+    simPtr->state = state;
+    simPtr->stateTime = le_clk_GetRelativeTime();
+    simPtr->isStateCached = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forget the last known state of all SIM cards, after an operation that may have changed it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InvalidateSimStates
+(
+    void
+)
+{
+    int i;
+
+    for (i = 0; i < LE_SIM_ID_MAX; i++)
+    {
+        SimList[i].isStateCached = false;
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Check if the APDU response notifies a correct execution of the APDU command with a normal ending.
@@ -400,6 +437,7 @@ static le_result_t LocalSwap
     }
 
     // Send the APDU request to swap SIM profile and check response.
+    InvalidateSimStates();
     status = pa_sim_SendApdu(channel, swapApduReqPtr, swapApduLen, resp, &lenResp);
     if (LE_OK != status)
     {
@@ -553,6 +591,55 @@ static void FirstLayerIccidChangeHandler
 }
 #endif
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the state of a SIM card.  The state reported by the last SIM state event, or read by the
+ * last call, is used for LE_CONFIG_SIM_STATE_CACHE_MS milliseconds; it is read from the PA
+ * otherwise.  This way, the clients polling the state of the SIM card, and all the functions
+ * needing it, share a single PA request.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_NOT_FOUND if unable to select the SIM card
+ *      - LE_FAULT if the state cannot be read
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetSimState
+(
+    le_sim_Id_t      simId,     ///< [IN] The SIM identifier
+    le_sim_States_t* statePtr   ///< [OUT] SIM state
+)
+{
+    Sim_t* simPtr = &SimList[(LE_SIM_UNSPECIFIED == simId) ? SelectedCard : simId];
+
+    if (SelectSIMCard(simId) != LE_OK)
+    {
+        return LE_NOT_FOUND;
+    }
+
+#if LE_CONFIG_SIM_STATE_CACHE_MS > 0
+    if (simPtr->isStateCached)
+    {
+        le_clk_Time_t age = le_clk_Sub(le_clk_GetRelativeTime(), simPtr->stateTime);
+
+        if (((age.sec * 1000) + (age.usec / 1000)) < LE_CONFIG_SIM_STATE_CACHE_MS)
+        {
+            *statePtr = simPtr->state;
+            return LE_OK;
+        }
+    }
+#endif
+
+    if (LE_OK != pa_sim_GetState(statePtr))
+    {
+        simPtr->isStateCached = false;
+        return LE_FAULT;
+    }
+
+    CacheSimState(simPtr, *statePtr);
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get the SIM card EID and store it in the SIM structure.
@@ -960,6 +1047,11 @@ static void NewSimStateHandler
         LE_INFO("NewSimStateHandler: Current Selected SIM ID=%d", SelectedCard);
     }
 
+    if (eventPtr->simId < LE_SIM_ID_MAX)
+    {
+        CacheSimState(&SimList[eventPtr->simId], eventPtr->state);
+    }
+
     //Update the SIM information for current SIM
     if ( eventPtr->simId == SelectedCard )
     {
@@ -1047,6 +1139,9 @@ static void SimToolkitHandler
             case LE_SIM_STAGE_END_WITH_SUCCESS:
                 LE_INFO("Update SIM Card information after a refresh");
 
+                // The refresh may have reset the SIM card
+                InvalidateSimStates();
+
                 // Discard old SIM card information and perform a new read.
                 GetSimCardInformation(&SimList[eventPtr->simId], LE_SIM_ABSENT);
                 GetSimCardInformation(&SimList[eventPtr->simId], LE_SIM_READY);
@@ -1365,6 +1460,7 @@ le_result_t le_sim_Init
         SimList[i].isPresent = false;
         SimList[i].isReacheable = false;
         SimList[i].subscription = UNKNOWN_SUBSCRIPTION;
+        SimList[i].isStateCached = false;
     }
 
     // Create FPLMN list pool
@@ -1430,6 +1526,7 @@ le_result_t le_sim_Init
         LE_CRIT("Unable to get the initial card state");
         return LE_FAULT;
     }
+    CacheSimState(&SimList[SelectedCard], state);
 
     GetSimCardInformation(&SimList[SelectedCard], state);
 
@@ -1715,12 +1812,7 @@ bool le_sim_IsPresent
 
     simPtr = GetSimContext(simId);
 
-    if (SelectSIMCard(simId) != LE_OK)
-    {
-        return false;
-    }
-
-    if (pa_sim_GetState(&state) == LE_OK)
+    if (GetSimState(simId, &state) == LE_OK)
     {
         if ((state != LE_SIM_ABSENT) &&
            (state != LE_SIM_STATE_UNKNOWN) &&
@@ -1761,12 +1853,13 @@ bool le_sim_IsReady
 {
     le_sim_States_t  state;
 
-    if (SelectSIMCard(simId) != LE_OK)
+    if (simId >= LE_SIM_ID_MAX)
     {
+        LE_ERROR("Invalid simId (%d) provided!", simId);
         return false;
     }
 
-    if (pa_sim_GetState(&state) == LE_OK)
+    if (GetSimState(simId, &state) == LE_OK)
     {
         if(state == LE_SIM_READY)
         {
@@ -1838,6 +1931,7 @@ le_result_t le_sim_EnterPIN
 
     // Enter PIN
     le_utf8_Copy(pinloc, pinPtr, sizeof(pinloc), NULL);
+    InvalidateSimStates();
     if(pa_sim_EnterPIN(PA_SIM_PIN,pinloc) != LE_OK)
     {
         LE_ERROR("Failed to enter PIN.%s sim identifier.%d", pinPtr, simPtr->simId);
@@ -2186,6 +2280,7 @@ le_result_t le_sim_Unblock
     // Unblock card
     le_utf8_Copy(pukloc, pukPtr, sizeof(pukloc), NULL);
     le_utf8_Copy(newpinloc, newpinPtr, sizeof(newpinloc), NULL);
+    InvalidateSimStates();
     if(pa_sim_EnterPUK(PA_SIM_PUK,pukloc, newpinloc) != LE_OK)
     {
         LE_ERROR("Failed to unblock sim identifier.%d", simPtr->simId);
@@ -2210,12 +2305,13 @@ le_sim_States_t le_sim_GetState
 {
     le_sim_States_t state;
 
-    if (SelectSIMCard(simId) != LE_OK)
+    if (simId >= LE_SIM_ID_MAX)
     {
+        LE_ERROR("Invalid simId (%d) provided!", simId);
         return LE_SIM_STATE_UNKNOWN;
     }
 
-    if (pa_sim_GetState(&state) == LE_OK)
+    if (GetSimState(simId, &state) == LE_OK)
     {
         return state;
     }
@@ -3027,6 +3123,7 @@ le_result_t le_sim_Reset
         return LE_FAULT;
     }
 
+    InvalidateSimStates();
     if (LE_OK != pa_sim_Reset())
     {
         LE_ERROR("Not able to reset the SIM");
@@ -3448,5 +3545,6 @@ le_result_t le_sim_SetPower
         return LE_FAULT;
     }
 
+    InvalidateSimStates();
     return pa_sim_SetPower(power);
 }
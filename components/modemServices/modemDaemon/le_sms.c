@@ -33,6 +33,7 @@
 #include "time.h"
 #include "mdmCfgEntries.h"
 #include "le_ms_local.h"
+#include "le_mrc_local.h"
 #include "watchdogChain.h"
 
 
@@ -490,6 +491,17 @@ static le_sms_MsgStats_t MessageStats;
 //--------------------------------------------------------------------------------------------------
 static bool StatusReportActivation = false;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport layer protocol for sending messages, as worked out by GetProtocol(), and the RAT change
+ * count when it was.  It is kept until the Radio Access Technology changes, so that sending a burst
+ * of messages doesn't query the modem again for each one.
+ */
+//--------------------------------------------------------------------------------------------------
+static pa_sms_Protocol_t SendProtocol;
+static uint32_t SendProtocolRatChangeCount;
+static bool IsSendProtocolKnown = false;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * list of session context.
@@ -1864,6 +1876,14 @@ static le_result_t GetProtocol
     pa_sms_Protocol_t* protocolPtr
 )
 {
+    uint32_t ratChangeCount = le_mrc_GetRatChangeCount();
+
+    if (IsSendProtocolKnown && (SendProtocolRatChangeCount == ratChangeCount))
+    {
+        *protocolPtr = SendProtocol;
+        return LE_OK;
+    }
+
     le_mrc_Rat_t rat;
     if (LE_OK != le_mrc_GetRadioAccessTechInUse(&rat))
     {
@@ -1909,6 +1929,11 @@ static le_result_t GetProtocol
             *protocolPtr = PA_SMS_PROTOCOL_GSM;
         }
     }
+
+    SendProtocol = *protocolPtr;
+    SendProtocolRatChangeCount = ratChangeCount;
+    IsSendProtocolKnown = true;
+
     return LE_OK;
 }
 
@@ -48,6 +48,9 @@ typedef struct
     le_temp_SensorRef_t     ref;                             ///< Sensor reference
     char                    thresholdEvent[LE_TEMP_THRESHOLD_NAME_MAX_BYTES];
                                                              ///< Threshold event
+    bool                    isTempCached;                    ///< true if 'temperature' is valid
+    int32_t                 temperature;                     ///< Last temperature read
+    le_clk_Time_t           tempTime;                        ///< Time 'temperature' was read
 } SensorCtx_t;
 
 //--------------------------------------------------------------------------------------------------
@@ -238,6 +241,9 @@ static void PaTemperatureThresholdHandler
         return;
     }
 
+    // The temperature has crossed a threshold since it was last read.
+    sensorCtxPtr->isTempCached = false;
+
     ThresholdReport_t* tempEventPtr = le_mem_ForceAlloc(ThresholdReportPool);
 
     tempEventPtr->ref = sensorCtxPtr->ref;
@@ -498,6 +504,7 @@ le_temp_SensorRef_t le_temp_Request
     else
     {
         currentPtr = le_mem_ForceAlloc(SensorPool);
+        currentPtr->isTempCached = false;
 
         if (LE_OK == pa_temp_Request(sensorPtr,
                             (le_temp_Handle_t)currentPtr,
@@ -562,7 +569,9 @@ le_result_t le_temp_GetSensorName
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the temperature in degree Celsius.
+ * Get the temperature in degree Celsius.  The temperature read by the last call is returned again
+ * for LE_CONFIG_SENSOR_SAMPLE_CACHE_MS milliseconds, so that clients polling the same sensor
+ * share a single PA request.
  *
  * @return
  *      - LE_OK            The function succeeded.
@@ -591,7 +600,30 @@ le_result_t le_temp_GetTemperature
         return LE_FAULT;
     }
 
-    return pa_temp_GetTemperature(sensorCtxPtr->paHandle, temperaturePtr);
+#if LE_CONFIG_SENSOR_SAMPLE_CACHE_MS > 0
+    if (sensorCtxPtr->isTempCached)
+    {
+        le_clk_Time_t age = le_clk_Sub(le_clk_GetRelativeTime(), sensorCtxPtr->tempTime);
+
+        if (((age.sec * 1000) + (age.usec / 1000)) < LE_CONFIG_SENSOR_SAMPLE_CACHE_MS)
+        {
+            *temperaturePtr = sensorCtxPtr->temperature;
+            return LE_OK;
+        }
+    }
+#endif
+
+    le_result_t result = pa_temp_GetTemperature(sensorCtxPtr->paHandle, temperaturePtr);
+    if (LE_OK != result)
+    {
+        sensorCtxPtr->isTempCached = false;
+        return result;
+    }
+
+    sensorCtxPtr->temperature = *temperaturePtr;
+    sensorCtxPtr->tempTime = le_clk_GetRelativeTime();
+    sensorCtxPtr->isTempCached = true;
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
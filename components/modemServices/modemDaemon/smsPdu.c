@@ -92,6 +92,72 @@ static const char *DtmfChars = "D1234567890*#ABC";
 #define TYPE_OF_ADDRESS_UNKNOWN         0x81
 #define TYPE_OF_ADDRESS_INTERNATIONAL   0x91
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Information Element Identifiers of concatenated short messages in the TP User Data Header
+ * (cf. 3GPP TS 23.040 sections 9.2.3.24.1 and 9.2.3.24.8)
+ */
+//--------------------------------------------------------------------------------------------------
+#define UDH_IEI_CONCAT_8BITS_REF    0x00
+#define UDH_IEI_CONCAT_16BITS_REF   0x08
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Concatenation information of a short message.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint16_t ref;       ///< Concatenated short message reference number
+    uint8_t  maxNum;    ///< Number of short messages in the concatenated message, 0 if none
+    uint8_t  seqNum;    ///< Sequence number of the short message
+}
+ConcatInfo_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Segment of a concatenated message, in the reassembly cache.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t       link;                       ///< Link in SegmentList
+    uint8_t             pdu[LE_SMS_PDU_MAX_BYTES];  ///< PDU the segment was decoded from
+    uint32_t            pduLen;                     ///< PDU length
+    ConcatInfo_t        concat;                     ///< Concatenation information
+    pa_sms_SmsDeliver_t deliver;                    ///< Decoded segment
+}
+ConcatSegment_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static pool for the segments of the reassembly cache
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(ConcatSegments, SMSPDU_CONCAT_MAX_SEGMENTS, sizeof(ConcatSegment_t));
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for the segments of the reassembly cache
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ConcatSegmentPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reassembly cache: segments of the concatenated messages not complete yet, least recently seen
+ * first.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t SegmentList = LE_DLS_LIST_INIT;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Last reassembled message, passed to the smsPdu_DecodeBatch() handler
+ */
+//--------------------------------------------------------------------------------------------------
+static smsPdu_ConcatMessage_t ConcatMessage;
+
 /****************************************************************************
  * This lookup table converts from ISO-8859-1 8-bit ASCII to the
  * 7 bit "default alphabet" as defined in ETSI GSM 03.38
@@ -998,7 +1064,7 @@ static le_result_t DecodeUserDataField
     uint8_t*          posPtr,       ///< [INOUT] Position in PDU
     smsPdu_Encoding_t encoding,     ///< [IN] Encoding
     uint8_t           tpUdl,        ///< [IN] TP User Data Length
-    uint8_t           tpUdhl,       ///< [IN] TP User Data Header Length
+    uint8_t           tpUdhl,       ///< [IN] TP User Data Header size, TP-UDHL included (0 if none)
     pa_sms_Message_t* smsPtr        ///< [OUT] Buffer to store decoded data
 )
 {
@@ -1055,10 +1121,11 @@ static le_result_t DecodeUserDataField
                 LE_ERROR("the message length %d is <= 0 ",messageLen);
                 return LE_FAULT;
             }
-            *posPtr -= ((tpUdhl * 8) + 6) / 7; // translate the pos in 7bits char unit
+            *posPtr -= tpUdhl; // go back to the start of TP-UD
             *formatPtr = LE_SMS_FORMAT_TEXT;
+            // The user data header is followed by fill bits up to the next septet boundary
             size = Convert7BitsTo8Bits(&dataPtr[*posPtr],
-                                           0,
+                                           ((tpUdhl * 8) + 6) / 7,
                                            messageLen,
                                            destDataPtr,
                                            destDataSize);
@@ -1160,6 +1227,71 @@ static le_result_t DecodeAddressField
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode the concatenation information of a TP User Data Header
+ *
+ * @return LE_OK            Function succeed
+ * @return LE_NOT_FOUND     The header has no concatenation information
+ * @return LE_FAULT         The concatenation information is invalid
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t DecodeConcatHeader
+(
+    const uint8_t* udhPtr,      ///< [IN] TP User Data Header, after TP-UDHL
+    uint8_t        udhLen,      ///< [IN] TP User Data Header Length
+    ConcatInfo_t*  concatPtr    ///< [OUT] Concatenation information
+)
+{
+    int pos = 0;
+
+    while ((pos + 2) <= udhLen)
+    {
+        uint8_t iei = udhPtr[pos];
+        uint8_t ieLen = udhPtr[pos + 1];
+        const uint8_t* iePtr = &udhPtr[pos + 2];
+
+        if ((pos + 2 + ieLen) > udhLen)
+        {
+            break;
+        }
+
+        if ((UDH_IEI_CONCAT_8BITS_REF == iei) && (3 == ieLen))
+        {
+            concatPtr->ref = iePtr[0];
+            concatPtr->maxNum = iePtr[1];
+            concatPtr->seqNum = iePtr[2];
+        }
+        else if ((UDH_IEI_CONCAT_16BITS_REF == iei) && (4 == ieLen))
+        {
+            concatPtr->ref = (iePtr[0] << 8) | iePtr[1];
+            concatPtr->maxNum = iePtr[2];
+            concatPtr->seqNum = iePtr[3];
+        }
+        else
+        {
+            pos += 2 + ieLen;
+            continue;
+        }
+
+        LE_DEBUG("Concatenated SMS ref %u, part %u/%u",
+                 concatPtr->ref, concatPtr->seqNum, concatPtr->maxNum);
+
+        if ((0 == concatPtr->maxNum) ||
+            (0 == concatPtr->seqNum) ||
+            (concatPtr->seqNum > concatPtr->maxNum))
+        {
+            LE_ERROR("Invalid concatenation information");
+            concatPtr->maxNum = 0;
+            return LE_FAULT;
+        }
+
+        return LE_OK;
+    }
+
+    return LE_NOT_FOUND;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Decode a SMS-DELIVER PDU
@@ -1169,7 +1301,9 @@ static le_result_t DecodePduDeliver
 (
     const uint8_t*    dataPtr,  ///< [IN] PDU data to decode
     uint8_t           initPos,  ///< [IN] Initial position in PDU
-    pa_sms_Message_t* smsPtr    ///< [OUT] Buffer to store decoded data
+    pa_sms_Message_t* smsPtr,   ///< [OUT] Buffer to store decoded data
+    ConcatInfo_t*     concatPtr ///< [OUT] Concatenation information, NULL if segments of
+                                ///<       concatenated messages must not be decoded
 )
 {
     le_result_t result;
@@ -1233,9 +1367,23 @@ static le_result_t DecodePduDeliver
 
     if (tpUdhl)
     {
-        LE_WARN("Multi part SMS are not available yet");
         DumpPdu("TP-UDH", &dataPtr[pos-1], tpUdhl+1);
-        return LE_UNSUPPORTED;
+
+        if (NULL == concatPtr)
+        {
+            LE_WARN("Multi part SMS are only decoded by smsPdu_DecodeBatch()");
+            return LE_UNSUPPORTED;
+        }
+
+        if (LE_OK != DecodeConcatHeader(&dataPtr[pos], tpUdhl, concatPtr))
+        {
+            LE_WARN("User data header not supported");
+            return LE_UNSUPPORTED;
+        }
+
+        // Skip the header, and count it with TP-UDHL in the user data
+        pos += tpUdhl;
+        tpUdhl++;
     }
 
     result = DecodeUserDataField(dataPtr, &pos, encoding, tpUdl, tpUdhl, smsPtr);
@@ -1639,7 +1787,9 @@ static le_result_t DecodeMessageGsm
     const uint8_t*    dataPtr,  ///< [IN] PDU data to decode
     size_t            dataSize, ///< [IN] PDU data size
     bool              smscInfo, ///< [IN] Indicates if PDU starts with SMSC information
-    pa_sms_Message_t* smsPtr    ///< [OUT] Buffer to store decoded data
+    pa_sms_Message_t* smsPtr,   ///< [OUT] Buffer to store decoded data
+    ConcatInfo_t*     concatPtr ///< [OUT] Concatenation information, NULL if segments of
+                                ///<       concatenated messages must not be decoded
 )
 {
     le_result_t result;
@@ -1648,6 +1798,11 @@ static le_result_t DecodeMessageGsm
 
     memset(smsPtr, 0, sizeof(pa_sms_Message_t));
 
+    if (concatPtr)
+    {
+        memset(concatPtr, 0, sizeof(ConcatInfo_t));
+    }
+
 #ifdef LE_CONFIG_MDM_HAS_SMSC_INFORMATION
     if (smscInfo)
     {
@@ -1668,7 +1823,7 @@ static le_result_t DecodeMessageGsm
         case TP_MTI_SMS_DELIVER:
             smsPtr->type = PA_SMS_DELIVER;
             smsPtr->smsDeliver.option = PA_SMS_OPTIONMASK_NO_OPTION;
-            result = DecodePduDeliver(dataPtr, pos, smsPtr);
+            result = DecodePduDeliver(dataPtr, pos, smsPtr, concatPtr);
             break;
 
         case TP_MTI_SMS_SUBMIT:
@@ -2746,6 +2901,181 @@ static le_result_t EncodeMessageCdma
     return result;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether two segments belong to the same concatenated message
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSameConcatMessage
+(
+    const ConcatSegment_t* firstPtr,    ///< [IN] First segment
+    const ConcatSegment_t* secondPtr    ///< [IN] Second segment
+)
+{
+    return (firstPtr->concat.ref == secondPtr->concat.ref) &&
+           (firstPtr->concat.maxNum == secondPtr->concat.maxNum) &&
+           (0 == strcmp(firstPtr->deliver.oa, secondPtr->deliver.oa));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for a PDU in the reassembly cache
+ *
+ * @return The segment decoded from this PDU, or NULL if the PDU is not in the cache
+ */
+//--------------------------------------------------------------------------------------------------
+static ConcatSegment_t* FindCachedPdu
+(
+    const pa_sms_Pdu_t* pduPtr  ///< [IN] PDU to look for
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&SegmentList);
+
+    while (linkPtr)
+    {
+        ConcatSegment_t* segmentPtr = CONTAINER_OF(linkPtr, ConcatSegment_t, link);
+
+        if ((segmentPtr->pduLen == pduPtr->dataLen) &&
+            (0 == memcmp(segmentPtr->pdu, pduPtr->data, pduPtr->dataLen)))
+        {
+            return segmentPtr;
+        }
+
+        linkPtr = le_dls_PeekNext(&SegmentList, linkPtr);
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a decoded segment to the reassembly cache. It replaces any other copy of the same segment,
+ * and the least recently seen segment is dropped if the cache is full.
+ *
+ * @return The cached segment
+ */
+//--------------------------------------------------------------------------------------------------
+static ConcatSegment_t* AddSegment
+(
+    const pa_sms_Pdu_t*        pduPtr,      ///< [IN] PDU the segment was decoded from
+    const ConcatInfo_t*        concatPtr,   ///< [IN] Concatenation information
+    const pa_sms_SmsDeliver_t* deliverPtr   ///< [IN] Decoded segment
+)
+{
+    ConcatSegment_t* segmentPtr = NULL;
+    le_dls_Link_t* linkPtr = le_dls_Peek(&SegmentList);
+
+    while (linkPtr)
+    {
+        ConcatSegment_t* cachedPtr = CONTAINER_OF(linkPtr, ConcatSegment_t, link);
+
+        if ((cachedPtr->concat.ref == concatPtr->ref) &&
+            (cachedPtr->concat.maxNum == concatPtr->maxNum) &&
+            (cachedPtr->concat.seqNum == concatPtr->seqNum) &&
+            (0 == strcmp(cachedPtr->deliver.oa, deliverPtr->oa)))
+        {
+            le_dls_Remove(&SegmentList, &cachedPtr->link);
+            segmentPtr = cachedPtr;
+            break;
+        }
+
+        linkPtr = le_dls_PeekNext(&SegmentList, linkPtr);
+    }
+
+    if (NULL == segmentPtr)
+    {
+        segmentPtr = le_mem_TryAlloc(ConcatSegmentPool);
+    }
+
+    if (NULL == segmentPtr)
+    {
+        segmentPtr = CONTAINER_OF(le_dls_Pop(&SegmentList), ConcatSegment_t, link);
+        LE_WARN("Reassembly cache full, drop part %u/%u of message %u",
+                segmentPtr->concat.seqNum, segmentPtr->concat.maxNum, segmentPtr->concat.ref);
+    }
+
+    memcpy(segmentPtr->pdu, pduPtr->data, pduPtr->dataLen);
+    segmentPtr->pduLen = pduPtr->dataLen;
+    segmentPtr->concat = *concatPtr;
+    segmentPtr->deliver = *deliverPtr;
+    segmentPtr->link = LE_DLS_LINK_INIT;
+    le_dls_Queue(&SegmentList, &segmentPtr->link);
+
+    return segmentPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reassemble the concatenated message of a segment into ConcatMessage, if all its segments are in
+ * the reassembly cache. The segments of a reassembled message are removed from the cache.
+ *
+ * @return true if the message was reassembled
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ReassembleMessage
+(
+    const ConcatSegment_t* refSegmentPtr    ///< [IN] One of the segments of the message
+)
+{
+    ConcatSegment_t* segmentPtr[SMSPDU_CONCAT_MAX_SEGMENTS] = { NULL };
+    uint8_t maxNum = refSegmentPtr->concat.maxNum;
+    uint8_t count = 0;
+    uint8_t i;
+
+    if (maxNum > SMSPDU_CONCAT_MAX_SEGMENTS)
+    {
+        LE_WARN("Message %u has too many parts (%u)", refSegmentPtr->concat.ref, maxNum);
+        return false;
+    }
+
+    le_dls_Link_t* linkPtr = le_dls_Peek(&SegmentList);
+
+    while (linkPtr)
+    {
+        ConcatSegment_t* cachedPtr = CONTAINER_OF(linkPtr, ConcatSegment_t, link);
+        uint8_t index = cachedPtr->concat.seqNum - 1;
+
+        if (IsSameConcatMessage(cachedPtr, refSegmentPtr) && (NULL == segmentPtr[index]))
+        {
+            segmentPtr[index] = cachedPtr;
+            count++;
+        }
+
+        linkPtr = le_dls_PeekNext(&SegmentList, linkPtr);
+    }
+
+    if (count < maxNum)
+    {
+        return false;
+    }
+
+    memset(&ConcatMessage, 0, sizeof(ConcatMessage));
+    le_utf8_Copy(ConcatMessage.oa, refSegmentPtr->deliver.oa, sizeof(ConcatMessage.oa), NULL);
+    le_utf8_Copy(ConcatMessage.scts, segmentPtr[0]->deliver.scts, sizeof(ConcatMessage.scts), NULL);
+    ConcatMessage.format = segmentPtr[0]->deliver.format;
+    ConcatMessage.ref = refSegmentPtr->concat.ref;
+    ConcatMessage.segmentCount = maxNum;
+
+    for (i = 0; i < maxNum; i++)
+    {
+        size_t dataLen = min(segmentPtr[i]->deliver.dataLen, sizeof(segmentPtr[i]->deliver.data));
+
+        memcpy(&ConcatMessage.data[ConcatMessage.dataLen], segmentPtr[i]->deliver.data, dataLen);
+        ConcatMessage.dataLen += dataLen;
+    }
+
+    for (i = 0; i < maxNum; i++)
+    {
+        le_dls_Remove(&SegmentList, &segmentPtr[i]->link);
+        le_mem_Release(segmentPtr[i]);
+    }
+
+    LE_DEBUG("Message %u reassembled from %u parts, %zu bytes",
+             ConcatMessage.ref, ConcatMessage.segmentCount, ConcatMessage.dataLen);
+
+    return true;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initialize the module.
@@ -2766,6 +3096,10 @@ le_result_t smsPdu_Initialize
     ((void)TraceRef);
 #endif
 
+    ConcatSegmentPool = le_mem_InitStaticPool(ConcatSegments,
+                                              SMSPDU_CONCAT_MAX_SEGMENTS,
+                                              sizeof(ConcatSegment_t));
+
     return LE_OK;
 }
 
@@ -2797,7 +3131,7 @@ le_result_t smsPdu_Decode
 
     if (protocol == PA_SMS_PROTOCOL_GSM)
     {
-        result = DecodeMessageGsm(dataPtr, dataSize, smscInfo, smsPtr);
+        result = DecodeMessageGsm(dataPtr, dataSize, smscInfo, smsPtr, NULL);
     }
     else if (protocol == PA_SMS_PROTOCOL_GW_CB)
     {
@@ -2821,6 +3155,102 @@ le_result_t smsPdu_Decode
     return result;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode a list of PDUs.
+ *
+ * Each PDU is decoded as smsPdu_Decode() does. In addition, the segments of concatenated GSM
+ * SMS-DELIVER messages are kept in a reassembly cache, keyed by originating address and
+ * concatenation reference, and handlerPtr is called with the whole message as soon as all its
+ * segments are known, whether they came in this list or in previous ones. A segment already in the
+ * cache is not decoded again.
+ *
+ * The segments themselves are reported as LE_UNSUPPORTED in resultPtr, like smsPdu_Decode() does.
+ *
+ * @return LE_OK            Function succeed
+ * @return LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsPdu_DecodeBatch
+(
+    const pa_sms_Pdu_t*        pduPtr,      ///< [IN] PDUs to decode
+    size_t                     pduCount,    ///< [IN] Number of PDUs
+    bool                       smscInfo,    ///< [IN] indicates if PDUs start with SMSC information
+    pa_sms_Message_t*          smsPtr,      ///< [OUT] Decoded messages, one per PDU
+    le_result_t*               resultPtr,   ///< [OUT] Decoding results, one per PDU
+    smsPdu_ConcatHandlerFunc_t handlerPtr,  ///< [IN] Handler for reassembled messages
+    void*                      contextPtr   ///< [IN] Context passed to handlerPtr
+)
+{
+    size_t i;
+
+    if ((pduCount > 0) && ((NULL == pduPtr) || (NULL == smsPtr) || (NULL == resultPtr)))
+    {
+        LE_ERROR("Invalid parameter");
+        return LE_BAD_PARAMETER;
+    }
+
+    for (i = 0; i < pduCount; i++)
+    {
+        const pa_sms_Pdu_t* currentPduPtr = &pduPtr[i];
+        ConcatSegment_t* segmentPtr;
+        ConcatInfo_t concat;
+
+        if ((PA_SMS_PROTOCOL_GSM != currentPduPtr->protocol) ||
+            (currentPduPtr->dataLen > LE_SMS_PDU_MAX_BYTES))
+        {
+            resultPtr[i] = smsPdu_Decode(currentPduPtr->protocol,
+                                         currentPduPtr->data,
+                                         min(currentPduPtr->dataLen, LE_SMS_PDU_MAX_BYTES),
+                                         smscInfo,
+                                         &smsPtr[i]);
+            continue;
+        }
+
+        segmentPtr = FindCachedPdu(currentPduPtr);
+        if (segmentPtr)
+        {
+            // Segment already decoded: just keep it longer in the cache
+            le_dls_Remove(&SegmentList, &segmentPtr->link);
+            le_dls_Queue(&SegmentList, &segmentPtr->link);
+            memset(&smsPtr[i], 0, sizeof(pa_sms_Message_t));
+            smsPtr[i].type = PA_SMS_UNSUPPORTED;
+            resultPtr[i] = LE_UNSUPPORTED;
+            continue;
+        }
+
+        if (IS_TRACE_ENABLED)
+        {
+            DumpPdu("PDU to decode", currentPduPtr->data, currentPduPtr->dataLen);
+        }
+
+        resultPtr[i] = DecodeMessageGsm(currentPduPtr->data,
+                                        currentPduPtr->dataLen,
+                                        smscInfo,
+                                        &smsPtr[i],
+                                        &concat);
+
+        if ((LE_OK == resultPtr[i]) && (concat.maxNum > 0))
+        {
+            segmentPtr = AddSegment(currentPduPtr, &concat, &smsPtr[i].smsDeliver);
+
+            if (ReassembleMessage(segmentPtr) && (NULL != handlerPtr))
+            {
+                handlerPtr(&ConcatMessage, contextPtr);
+            }
+
+            resultPtr[i] = LE_UNSUPPORTED;
+        }
+
+        if (LE_OK != resultPtr[i])
+        {
+            smsPtr[i].type = PA_SMS_UNSUPPORTED;
+        }
+    }
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Encode the content of messagePtr in PDU format.
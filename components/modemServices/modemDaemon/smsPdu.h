@@ -43,6 +43,50 @@ typedef struct
 }
 smsPdu_DataToEncode_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of segments of concatenated messages kept by the reassembly cache, which is also
+ * the maximum number of segments of a message that can be reassembled.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SMSPDU_CONCAT_MAX_SEGMENTS  16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum user data size of a reassembled message.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SMSPDU_CONCAT_MAX_BYTES     (SMSPDU_CONCAT_MAX_SEGMENTS * LE_SMS_TEXT_MAX_BYTES)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Concatenated SMS-DELIVER message, reassembled from its segments.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char            oa[LE_MDMDEFS_PHONE_NUM_MAX_BYTES]; ///< Originating address
+    char            scts[LE_SMS_TIMESTAMP_MAX_BYTES];   ///< Time stamp of the first segment
+    le_sms_Format_t format;                             ///< User data format
+    uint16_t        ref;                                ///< Concatenation reference
+    uint8_t         segmentCount;                       ///< Number of segments
+    uint8_t         data[SMSPDU_CONCAT_MAX_BYTES];      ///< User data of all the segments
+    size_t          dataLen;                            ///< User data length
+}
+smsPdu_ConcatMessage_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for handler functions called when all the segments of a concatenated message have
+ * been decoded.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*smsPdu_ConcatHandlerFunc_t)
+(
+    const smsPdu_ConcatMessage_t* messagePtr,   ///< [IN] Reassembled message
+    void*                         contextPtr    ///< [IN] Context given to smsPdu_DecodeBatch()
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initialize the module.
@@ -73,6 +117,33 @@ le_result_t smsPdu_Decode
     pa_sms_Message_t* smsPtr    ///< [OUT] Buffer to store decoded data
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode a list of PDUs.
+ *
+ * Each PDU is decoded as smsPdu_Decode() does. In addition, the segments of concatenated GSM
+ * SMS-DELIVER messages are kept in a reassembly cache, keyed by originating address and
+ * concatenation reference, and handlerPtr is called with the whole message as soon as all its
+ * segments are known, whether they came in this list or in previous ones. A segment already in the
+ * cache is not decoded again.
+ *
+ * The segments themselves are reported as LE_UNSUPPORTED in resultPtr, like smsPdu_Decode() does.
+ *
+ * @return LE_OK            Function succeed
+ * @return LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t smsPdu_DecodeBatch
+(
+    const pa_sms_Pdu_t*        pduPtr,      ///< [IN] PDUs to decode
+    size_t                     pduCount,    ///< [IN] Number of PDUs
+    bool                       smscInfo,    ///< [IN] indicates if PDUs start with SMSC information
+    pa_sms_Message_t*          smsPtr,      ///< [OUT] Decoded messages, one per PDU
+    le_result_t*               resultPtr,   ///< [OUT] Decoding results, one per PDU
+    smsPdu_ConcatHandlerFunc_t handlerPtr,  ///< [IN] Handler for reassembled messages
+    void*                      contextPtr   ///< [IN] Context passed to handlerPtr
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Encode the content of messagePtr in PDU format.
@@ -18,6 +18,7 @@
 
 #ifdef LE_CONFIG_LINUX
 #include <arpa/inet.h>
+#include <netinet/tcp.h>
 #endif
 
 //--------------------------------------------------------------------------------------------------
@@ -41,6 +42,30 @@
 //--------------------------------------------------------------------------------------------------
 #define NETWORK_SOCKET_IP6ADDR_STRLEN_MAX            49
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * TCP keep-alive probing of an idle link: seconds of silence before the first probe, seconds
+ * between probes, and number of unanswered probes before the connection is dropped.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NETWORK_SOCKET_KEEPALIVE_IDLE_SECS           10
+#define NETWORK_SOCKET_KEEPALIVE_INTERVAL_SECS       5
+#define NETWORK_SOCKET_KEEPALIVE_PROBE_COUNT         3
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Longest time (in milliseconds) sent data may remain unacknowledged before the connection is
+ * dropped.  Matches the RPC Proxy's own Keep-Alive time-out, so a link stalled by loss is reported
+ * no later than an unanswered KEEPALIVE-Request would be.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifdef LE_CONFIG_RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL
+#define NETWORK_SOCKET_USER_TIMEOUT_MS \
+            (LE_CONFIG_RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL * 1000)
+#else
+#define NETWORK_SOCKET_USER_TIMEOUT_MS               30000
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Reference to File descriptor monitor object.
@@ -170,6 +195,63 @@ COMPONENT_INIT
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to set the TCP options of a link socket.
+ *
+ * RPC messages are small and latency sensitive, so Nagle's algorithm is disabled.  Keep-alive
+ * probing and a user time-out make the kernel fail the connection (reported as POLLERR) when the
+ * far side stops answering, rather than leaving the RPC Proxy to notice only on its next
+ * KEEPALIVE-Request.  Failures are not fatal; the link simply falls back to the defaults.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetLinkOptions
+(
+    int fd  ///< [IN] Socket file descriptor
+)
+{
+    int value = 1;
+
+    if (setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value)) < 0)
+    {
+        LE_WARN("Unable to set TCP_NODELAY, fd [%d], errno [%d]", fd, errno);
+    }
+
+    if (setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &value, sizeof(value)) < 0)
+    {
+        LE_WARN("Unable to set SO_KEEPALIVE, fd [%d], errno [%d]", fd, errno);
+        return;
+    }
+
+#ifdef TCP_KEEPIDLE
+    value = NETWORK_SOCKET_KEEPALIVE_IDLE_SECS;
+    if (setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &value, sizeof(value)) < 0)
+    {
+        LE_WARN("Unable to set TCP_KEEPIDLE, fd [%d], errno [%d]", fd, errno);
+    }
+
+    value = NETWORK_SOCKET_KEEPALIVE_INTERVAL_SECS;
+    if (setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL, &value, sizeof(value)) < 0)
+    {
+        LE_WARN("Unable to set TCP_KEEPINTVL, fd [%d], errno [%d]", fd, errno);
+    }
+
+    value = NETWORK_SOCKET_KEEPALIVE_PROBE_COUNT;
+    if (setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &value, sizeof(value)) < 0)
+    {
+        LE_WARN("Unable to set TCP_KEEPCNT, fd [%d], errno [%d]", fd, errno);
+    }
+#endif
+
+#ifdef TCP_USER_TIMEOUT
+    unsigned int timeoutMs = NETWORK_SOCKET_USER_TIMEOUT_MS;
+    if (setsockopt(fd, IPPROTO_TCP, TCP_USER_TIMEOUT, &timeoutMs, sizeof(timeoutMs)) < 0)
+    {
+        LE_WARN("Unable to set TCP_USER_TIMEOUT, fd [%d], errno [%d]", fd, errno);
+    }
+#endif
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Callback function to receive events on a connection and pass them onto the RPC Proxy
@@ -264,6 +346,10 @@ static void ConnectionRecvHandler(void* handle, short events)
     {
         LE_ERROR("Failed to accept client connection. Errno %d", errno);
     }
+    else
+    {
+        SetLinkOptions(clientFd);
+    }
 
     LE_INFO("Accepting Client socket connection, fd [%d]", clientFd);
     connectionRecordPtr = le_mem_AssertAlloc(HandleRecordPoolRef);
@@ -448,6 +534,8 @@ LE_SHARED void* le_comm_Create
         *resultPtr = LE_FAULT;
         return (connectionRecordPtr);
     }
+#else
+    SetLinkOptions(connectionRecordPtr->fd);
 #endif
 
     LE_INFO("Created AF_INET Socket, fd %d", connectionRecordPtr->fd);
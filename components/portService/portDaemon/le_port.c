@@ -14,9 +14,11 @@
 #include "interfaces.h"
 
 #if LE_CONFIG_LINUX
+#   include <sys/ioctl.h>
 #   include <sys/socket.h>
 #   include <sys/types.h>
 #   include <sys/un.h>
+#   include <linux/serial.h>
 #endif
 
 #include "le_port_local.h"
@@ -105,6 +107,13 @@
 //--------------------------------------------------------------------------------------------------
 #define OPEN_TYPE_MAX_BYTES      20
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of flow control string.
+ */
+//--------------------------------------------------------------------------------------------------
+#define FLOW_CONTROL_MAX_BYTES   10
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Maximum number of clients
@@ -151,6 +160,8 @@ typedef struct
     char path[PATH_MAX_BYTES];                                      ///< Path name.
     char openingType[OPEN_TYPE_MAX_BYTES];                          ///< Device opening type.
     char possibleMode[MAX_POSSIBLE_MODES][POSSIBLE_MODE_MAX_BYTES]; ///< Possible mode name.
+    bool hwFlowControl;                                             ///< Use RTS/CTS flow control
+                                                                    ///< on the serial link.
 }
 LinkInformation_t;
 
@@ -760,6 +771,61 @@ static void OpeningTypeEventHandler
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * FlowControl string parsing event function.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FlowControlEventHandler
+(
+    le_json_Event_t event     ///< [IN] JSON event.
+)
+{
+    switch (event)
+    {
+        case LE_JSON_STRING:
+        {
+            const char* flowControl = le_json_GetString();
+
+            // Get the instance config pointer from the list.
+            InstanceConfiguration_t* instanceConfigPtr = GetCurrentInstance();
+
+            LE_ASSERT(instanceConfigPtr != NULL);
+
+            if (0 == strncmp(flowControl, "hardware", FLOW_CONTROL_MAX_BYTES))
+            {
+                instanceConfigPtr->linkInfo[instanceConfigPtr->linkCounter]->hwFlowControl = true;
+            }
+            else if (0 == strncmp(flowControl, "none", FLOW_CONTROL_MAX_BYTES))
+            {
+                instanceConfigPtr->linkInfo[instanceConfigPtr->linkCounter]->hwFlowControl = false;
+            }
+            else
+            {
+                LE_ERROR("flowControl is not set properly!");
+                CleanJsonConfig();
+                break;
+            }
+            le_json_SetEventHandler(DeviceEventHandler);
+            break;
+        }
+
+        case LE_JSON_ARRAY_START:
+        case LE_JSON_ARRAY_END:
+        case LE_JSON_OBJECT_MEMBER:
+        case LE_JSON_OBJECT_START:
+        case LE_JSON_OBJECT_END:
+        case LE_JSON_NUMBER:
+        case LE_JSON_TRUE:
+        case LE_JSON_FALSE:
+        case LE_JSON_NULL:
+        case LE_JSON_DOC_END:
+            LE_ERROR("JSON file not created in proper order");
+            CleanJsonConfig();
+            break;
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * PossibleMode string parsing event function.
@@ -866,6 +932,7 @@ static void DeviceEventHandler
                 instanceConfigPtr->linkInfo[instanceConfigPtr->linkCounter]->dataModeFd = -1;
                 instanceConfigPtr->linkInfo[instanceConfigPtr->linkCounter]->atModeSockFd = -1;
                 instanceConfigPtr->linkInfo[instanceConfigPtr->linkCounter]->dataModeSockFd = -1;
+                instanceConfigPtr->linkInfo[instanceConfigPtr->linkCounter]->hwFlowControl = false;
 
                 // Initialize the counter before parsing of new link.
                 PossibleModeNumber = 0;
@@ -887,6 +954,10 @@ static void DeviceEventHandler
             {
                 le_json_SetEventHandler(OpeningTypeEventHandler);
             }
+            else if (0 == strcmp(memberName, "flowControl"))
+            {
+                le_json_SetEventHandler(FlowControlEventHandler);
+            }
             else if (0 == strcmp(memberName, "possibleMode"))
             {
                 le_json_SetEventHandler(PossibleModeEventHandler);
@@ -927,7 +998,8 @@ static void DeviceEventHandler
 //--------------------------------------------------------------------------------------------------
 static int32_t OpenSerialDevice
 (
-    char* deviceName  ///< [IN] Device name.
+    char* deviceName,   ///< [IN] Device name.
+    bool hwFlowControl  ///< [IN] Enable RTS/CTS flow control.
 )
 {
     int32_t fd;
@@ -951,6 +1023,17 @@ static int32_t OpenSerialDevice
         le_tty_Close(fd);
         return -1;
     }
+
+    // With high baud rates, the peer must be held off while the reader is behind, or the UART
+    // drops characters.
+    if (hwFlowControl && (LE_OK != le_tty_SetFlowControl(fd, LE_TTY_FLOW_CONTROL_HARDWARE)))
+    {
+        LE_ERROR("Failed to configure TTY hardware flow control");
+        le_tty_Close(fd);
+        return -1;
+    }
+#else
+    LE_UNUSED(hwFlowControl);
 #endif
     return fd;
 }
@@ -1367,7 +1450,8 @@ static le_result_t OpenInstanceLinks
                         if (instanceConfigPtr->linkInfo[i]->fd == -1)
                         {
                             instanceConfigPtr->linkInfo[i]->fd = OpenSerialDevice(
-                                instanceConfigPtr->linkInfo[i]->path);
+                                instanceConfigPtr->linkInfo[i]->path,
+                                instanceConfigPtr->linkInfo[i]->hwFlowControl);
                         }
                         if (-1 == instanceConfigPtr->linkInfo[i]->fd)
                         {
@@ -1800,7 +1884,9 @@ le_result_t le_port_SetDataMode
                 if (-1 == instanceConfigPtr->linkInfo[i]->dataModeFd)
                 {
                     instanceConfigPtr->linkInfo[i]->dataModeFd =
-                                       OpenSerialDevice(instanceConfigPtr->linkInfo[i]->path);
+                                       OpenSerialDevice(instanceConfigPtr->linkInfo[i]->path,
+                                                        instanceConfigPtr->linkInfo[i]
+                                                            ->hwFlowControl);
                 }
 
                 if (-1 != instanceConfigPtr->linkInfo[i]->dataModeFd)
@@ -1945,7 +2031,9 @@ le_result_t le_port_SetCommandMode
                     if (0 == strcmp(instanceConfigPtr->linkInfo[i]->openingType, "serialLink"))
                     {
                         instanceConfigPtr->linkInfo[i]->fd =
-                                           OpenSerialDevice(instanceConfigPtr->linkInfo[i]->path);
+                                           OpenSerialDevice(instanceConfigPtr->linkInfo[i]->path,
+                                                            instanceConfigPtr->linkInfo[i]
+                                                                ->hwFlowControl);
 
                         if (-1 == instanceConfigPtr->linkInfo[i]->fd)
                         {
@@ -2220,6 +2308,82 @@ le_result_t le_port_GetPortReference
     return LE_FAULT;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function gets the line counters of the serial link of a device, as counted by the UART
+ * driver since it was loaded.
+ *
+ * @return
+ *      - LE_OK            Function succeeded.
+ *      - LE_FAULT         Function failed.
+ *      - LE_BAD_PARAMETER Invalid parameter.
+ *      - LE_UNSUPPORTED   The device has no opened serial link, or the driver does not count.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_port_GetLineCounters
+(
+    le_port_DeviceRef_t devRef,     ///< [IN] Device reference.
+    uint32_t* rxCountPtr,           ///< [OUT] Number of characters received.
+    uint32_t* txCountPtr,           ///< [OUT] Number of characters transmitted.
+    uint32_t* overrunCountPtr,      ///< [OUT] Number of characters lost by overruns.
+    uint32_t* frameErrCountPtr,     ///< [OUT] Number of framing errors.
+    uint32_t* parityErrCountPtr     ///< [OUT] Number of parity errors.
+)
+{
+    if ((NULL == rxCountPtr) || (NULL == txCountPtr) || (NULL == overrunCountPtr) ||
+        (NULL == frameErrCountPtr) || (NULL == parityErrCountPtr))
+    {
+        LE_ERROR("Output pointer is NULL!");
+        return LE_BAD_PARAMETER;
+    }
+
+    OpenedInstanceCtx_t* openedInstanceCtxPtr = le_ref_Lookup(DeviceRefMap, devRef);
+    if (NULL == openedInstanceCtxPtr)
+    {
+        LE_ERROR("devRef is invalid!");
+        return LE_BAD_PARAMETER;
+    }
+
+    InstanceConfiguration_t* instanceConfigPtr = openedInstanceCtxPtr->instanceConfigPtr;
+    if (NULL == instanceConfigPtr)
+    {
+        LE_ERROR("instanceConfigPtr is NULL!");
+        return LE_FAULT;
+    }
+
+#if LE_CONFIG_LINUX
+    int i;
+
+    for (i = 0; i < (instanceConfigPtr->linkCounter); i++)
+    {
+        LinkInformation_t* linkPtr = instanceConfigPtr->linkInfo[i];
+        int fd = (-1 != linkPtr->dataModeFd) ? linkPtr->dataModeFd : linkPtr->fd;
+        struct serial_icounter_struct icount;
+
+        if ((0 != strcmp(linkPtr->openingType, "serialLink")) || (-1 == fd))
+        {
+            continue;
+        }
+
+        memset(&icount, 0, sizeof(icount));
+        if (-1 == ioctl(fd, TIOCGICOUNT, &icount))
+        {
+            LE_DEBUG("Failed to get line counters of '%s': %m", linkPtr->path);
+            return (ENOTTY == errno || EINVAL == errno) ? LE_UNSUPPORTED : LE_FAULT;
+        }
+
+        *rxCountPtr = icount.rx;
+        *txCountPtr = icount.tx;
+        *overrunCountPtr = icount.overrun + icount.buf_overrun;
+        *frameErrCountPtr = icount.frame;
+        *parityErrCountPtr = icount.parity;
+        return LE_OK;
+    }
+#endif
+
+    return LE_UNSUPPORTED;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Close session event handler of port service.
@@ -306,11 +306,13 @@ static le_dls_List_t PositionHandlerList = LE_DLS_LIST_INIT;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Memory Pool for position samples.
+ * Last position sample reported by the PA.
  *
+ * Published samples are never modified: position handlers and le_gnss_GetLastSampleRef() take a
+ * reference on the sample instead of copying it, and a new report replaces the pointer.
  */
 //--------------------------------------------------------------------------------------------------
-static le_gnss_PositionSample_t   LastPositionSample;
+static le_gnss_PositionSample_t*  LastPositionSamplePtr = NULL;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -691,33 +693,76 @@ static void PositionSampleDestructor
     void* obj
 )
 {
-    le_gnss_PositionSample_t *positionSampleNodePtr;
-    le_dls_Link_t   *linkPtr;
+    le_gnss_PositionSample_t *positionSampleNodePtr = obj;
 
     LE_FATAL_IF((NULL == obj), "Position Sample Object does not exist!");
 
-    linkPtr = le_dls_Peek(&PositionSampleList);
-    if (linkPtr != NULL)
+    // Every sample is queued on the list when it is published.
+    le_dls_Remove(&PositionSampleList, &positionSampleNodePtr->link);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make a position sample the last position sample, releasing the previous one.  Requests that
+ * still refer to the previous sample keep it alive until they are released.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PublishPositionSample
+(
+    le_gnss_PositionSample_t* positionSampleNodePtr     ///< [IN] The new sample (reference given).
+)
+{
+    positionSampleNodePtr->link = LE_DLS_LINK_INIT;
+    le_dls_Queue(&PositionSampleList, &positionSampleNodePtr->link);
+
+    if (NULL != LastPositionSamplePtr)
     {
-        do
-        {
-            // Get the node from the list
-            positionSampleNodePtr = (le_gnss_PositionSample_t*)
-                                    CONTAINER_OF(linkPtr, le_gnss_PositionSample_t, link);
-            // Check the node.
-            if (positionSampleNodePtr == (le_gnss_PositionSample_t*)obj)
-            {
-                // Remove the node.
-                le_dls_Remove(&PositionSampleList, linkPtr);
-                linkPtr=NULL;
-            }
-            else
-            {
-                // Move to the next node.
-                linkPtr = le_dls_PeekNext(&PositionSampleList, linkPtr);
-            }
-        } while (linkPtr != NULL);
+        le_mem_Release(LastPositionSamplePtr);
     }
+    LastPositionSamplePtr = positionSampleNodePtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Replace the last position sample by an empty one, with no position fix.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResetLastPositionSample
+(
+    void
+)
+{
+    le_gnss_PositionSample_t* positionSampleNodePtr = le_mem_ForceAlloc(PositionSamplePoolRef);
+
+    memset(positionSampleNodePtr, 0, sizeof(*positionSampleNodePtr));
+    positionSampleNodePtr->fixState = LE_GNSS_STATE_FIX_NO_POS;
+
+    PublishPositionSample(positionSampleNodePtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a position sample request, and its safe reference, for the last position sample.
+ *
+ * @return The safe reference of the request.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_gnss_SampleRef_t CreateLastSampleRequest
+(
+    le_msg_SessionRef_t sessionRef      ///< [IN] Session of the client the request is for.
+)
+{
+    le_gnss_PositionSampleRequest_t* positionSampleRequestNodePtr =
+               (le_gnss_PositionSampleRequest_t*)le_mem_ForceAlloc(PositionSampleRequestPoolRef);
+
+    le_mem_AddRef(LastPositionSamplePtr);
+    positionSampleRequestNodePtr->positionSampleNodePtr = LastPositionSamplePtr;
+    positionSampleRequestNodePtr->sessionRef = sessionRef;
+    positionSampleRequestNodePtr->link = LE_DLS_LINK_INIT;
+    positionSampleRequestNodePtr->positionSampleRef =
+               le_ref_CreateRef(PositionSampleMap, positionSampleRequestNodePtr);
+
+    return positionSampleRequestNodePtr->positionSampleRef;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1156,9 +1201,8 @@ static void PaPositionHandler
 {
 
     le_gnss_PositionHandler_t*  positionHandlerNodePtr;
+    le_gnss_PositionSample_t*   positionSampleNodePtr;
     le_dls_Link_t*              linkPtr;
-    le_gnss_PositionSampleRequest_t*    positionSampleRequestNodePtr=NULL;
-    uint8_t i;
 
     if (NULL == positionPtr)
     {
@@ -1168,8 +1212,11 @@ static void PaPositionHandler
 
     LE_DEBUG("Handler Function called with PA position %p", positionPtr);
 
-    // Get the position sample data from the PA position data report
-    GetPosSampleData(&LastPositionSample, positionPtr);
+    // Parse the PA position data report once, into a new sample shared by all the handlers and
+    // by le_gnss_GetLastSampleRef() until the next report.
+    positionSampleNodePtr = (le_gnss_PositionSample_t*)le_mem_ForceAlloc(PositionSamplePoolRef);
+    GetPosSampleData(positionSampleNodePtr, positionPtr);
+    PublishPositionSample(positionSampleNodePtr);
 
     if(!NumOfPositionHandlers)
     {
@@ -1178,62 +1225,28 @@ static void PaPositionHandler
         return;
     }
 
+    // Call Handler(s)
     linkPtr = le_dls_Peek(&PositionHandlerList);
-    if (NULL != linkPtr)
+    while (NULL != linkPtr)
     {
-        // Create the position request sample node.
-        positionSampleRequestNodePtr =
-                 (le_gnss_PositionSampleRequest_t*)le_mem_ForceAlloc(PositionSampleRequestPoolRef);
+        // Get the node from the list
+        positionHandlerNodePtr =
+            (le_gnss_PositionHandler_t*)CONTAINER_OF(linkPtr, le_gnss_PositionHandler_t, link);
 
-        // Create the position sample node.
-        positionSampleRequestNodePtr->positionSampleNodePtr =
-                 (le_gnss_PositionSample_t*)le_mem_ForceAlloc(PositionSamplePoolRef);
+        LE_DEBUG("Report sample %p to the corresponding handler (handler %p)",
+                 positionSampleNodePtr, positionHandlerNodePtr->handlerFuncPtr);
 
-        // Add reference for each subscribe handler.
-        for(i=0 ; i<NumOfPositionHandlers-1 ; i++)
-        {
-            le_mem_AddRef((void *)positionSampleRequestNodePtr);
-            le_mem_AddRef((void *)positionSampleRequestNodePtr->positionSampleNodePtr);
-        }
-
-        // Copy the position sample to the position sample node
-        memcpy(positionSampleRequestNodePtr->positionSampleNodePtr, &LastPositionSample,
-                     sizeof(le_gnss_PositionSample_t));
+        // Create a request, with its own safe reference, for the client's handler
+        le_gnss_SampleRef_t safePositionSampleRef =
+            CreateLastSampleRequest(positionHandlerNodePtr->sessionRef);
 
-        // Add the node to the queue of the list by passing in the node's link.
-        positionSampleRequestNodePtr->positionSampleNodePtr->link = LE_DLS_LINK_INIT;
-        le_dls_Queue(&PositionSampleList, &(positionSampleRequestNodePtr->
-                                                positionSampleNodePtr->link));
-
-        // Call Handler(s)
-        do
+        if(safePositionSampleRef != NULL)
         {
-            // Get the node from the list
-            positionHandlerNodePtr =
-                (le_gnss_PositionHandler_t*)CONTAINER_OF(linkPtr, le_gnss_PositionHandler_t, link);
-
-            LE_DEBUG("Report sample %p to the corresponding handler (handler %p)",
-                     positionSampleRequestNodePtr->positionSampleNodePtr,
-                     positionHandlerNodePtr->handlerFuncPtr);
-
-            // Create a safe reference and call the client's handler
-            le_gnss_SampleRef_t safePositionSampleRef = le_ref_CreateRef(PositionSampleMap,
-                                                           positionSampleRequestNodePtr);
-
-            // Store message session reference which will be useful for close session handler
-            positionSampleRequestNodePtr->sessionRef = positionHandlerNodePtr->sessionRef;
-
-            // Store safereference which will be useful for close session handler
-            positionSampleRequestNodePtr->positionSampleRef = safePositionSampleRef;
-
-            if(safePositionSampleRef != NULL)
-            {
-                positionHandlerNodePtr->handlerFuncPtr(safePositionSampleRef,
-                                                   positionHandlerNodePtr->handlerContextPtr);
-            }
-            // Move to the next node.
-            linkPtr = le_dls_PeekNext(&PositionHandlerList, linkPtr);
-        } while (NULL != linkPtr);
+            positionHandlerNodePtr->handlerFuncPtr(safePositionSampleRef,
+                                               positionHandlerNodePtr->handlerContextPtr);
+        }
+        // Move to the next node.
+        linkPtr = le_dls_PeekNext(&PositionHandlerList, linkPtr);
     }
 
     le_mem_Release(positionPtr);
@@ -1465,8 +1478,7 @@ le_result_t gnss_Init
     PaHandlerRef = NULL;
 
     // Initialize last Position sample
-    memset(&LastPositionSample, 0, sizeof(LastPositionSample));
-    LastPositionSample.fixState = LE_GNSS_STATE_FIX_NO_POS;
+    ResetLastPositionSample();
 
     // Subscribe to PA position Data handler
     if ((PaHandlerRef=pa_gnss_AddPositionDataHandler(PaPositionHandler)) == NULL)
@@ -3058,31 +3070,9 @@ le_gnss_SampleRef_t le_gnss_GetLastSampleRef
     void
 )
 {
-    le_gnss_PositionSampleRequest_t*   positionSampleRequestNodePtr=NULL;
-
-    // Create the position sample node.
-    positionSampleRequestNodePtr =
-               (le_gnss_PositionSampleRequest_t*)le_mem_ForceAlloc(PositionSampleRequestPoolRef);
-    positionSampleRequestNodePtr->positionSampleNodePtr =
-               (le_gnss_PositionSample_t*)le_mem_ForceAlloc(PositionSamplePoolRef);
-
-    // Copy the position sample to the position sample node
-    memcpy(positionSampleRequestNodePtr->positionSampleNodePtr, &LastPositionSample,
-           sizeof(le_gnss_PositionSample_t));
-
-    // Add the node to the queue of the list by passing in the node's link.
-    positionSampleRequestNodePtr->positionSampleNodePtr->link = LE_DLS_LINK_INIT;
-    le_dls_Queue(&PositionSampleList, &(positionSampleRequestNodePtr->positionSampleNodePtr->link));
-
-    LE_DEBUG("Get sample %p", positionSampleRequestNodePtr->positionSampleNodePtr);
-
-    positionSampleRequestNodePtr->sessionRef = le_gnss_GetClientSessionRef();
-
-    le_gnss_SampleRef_t reqRef = le_ref_CreateRef(PositionSampleMap, positionSampleRequestNodePtr);
-    positionSampleRequestNodePtr->positionSampleRef = reqRef;
+    LE_DEBUG("Get sample %p", LastPositionSamplePtr);
 
-    // Create a safe reference and call the client's handler
-    return reqRef;
+    return CreateLastSampleRequest(le_gnss_GetClientSessionRef());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -3573,8 +3563,7 @@ le_result_t le_gnss_Stop
             if (LE_OK == result)
             {
                 // Initialize last Position sample
-                memset(&LastPositionSample, 0, sizeof(LastPositionSample));
-                LastPositionSample.fixState = LE_GNSS_STATE_FIX_NO_POS;
+                ResetLastPositionSample();
 
                 GnssState = LE_GNSS_STATE_READY;
             }
@@ -39,6 +39,12 @@
 /// Expected number of sample handlers
 #define HIGH_POS_SAMPLE_HANDLER_COUNT   1
 
+/// Expected number of batch handlers
+#define HIGH_POS_BATCH_HANDLER_COUNT    1
+
+/// Number of fixes in the fix ring, must be a power of 2 for the sequence numbers to wrap around
+#define FIX_RING_SIZE                   LE_POS_BATCH_MAX_FIXES
+
 #define CHECK_VALIDITY(_par_,_max_) (((_par_) == (_max_))? false : true)
 
 //--------------------------------------------------------------------------------------------------
@@ -167,6 +173,27 @@ typedef struct le_pos_SampleHandler
 }
 le_pos_SampleHandler_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch Handler structure.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_pos_BatchHandlerFunc_t handlerFuncPtr;       ///< The handler function address.
+    void*                     handlerContextPtr;    ///< The handler function context.
+    uint32_t                  maxFixes;             ///< Number of fixes to report at once, 0 if
+                                                    ///  only the delay applies.
+    uint32_t                  nextSeq;              ///< Sequence number of the first fix not
+                                                    ///  reported yet.
+    le_timer_Ref_t            timerRef;             ///< Delay timer, NULL if only maxFixes
+                                                    ///  applies.
+    le_msg_SessionRef_t       sessionRef;           ///< Store message session reference.
+    le_dls_Link_t             link;                 ///< Object node link
+}
+BatchHandler_t;
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -215,6 +242,47 @@ typedef struct
 }
 PositionParam_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of reference positions whose horizontal move is kept by the motion filter for a fix.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MOTION_REF_CACHE_SIZE   4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Horizontal move from a reference position, i.e. the position last reported to a handler.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int32_t  latitude;              ///< Latitude of the reference position.
+    int32_t  longitude;             ///< Longitude of the reference position.
+    uint32_t move;                  ///< Horizontal move from the reference position, in meters.
+    uint32_t notBeyondMagnitude;    ///< Smallest horizontal magnitude found not to be exceeded.
+}
+MotionRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Motion filter, shared by all the handlers for one fix.
+ *
+ * Handlers which were last notified at the same fix have the same reference position, so the
+ * horizontal move is only computed once for them.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    double      latRad;                         ///< Latitude of the fix, in radians.
+    double      longRad;                        ///< Longitude of the fix, in radians.
+    double      cosLat;                         ///< Cosine of the latitude of the fix.
+    MotionRef_t refs[MOTION_REF_CACHE_SIZE];    ///< Moves already computed for this fix.
+    uint32_t    refCount;                       ///< Number of moves already computed.
+}
+MotionFilter_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Static safe Reference Map for service activation requests.
@@ -347,10 +415,60 @@ LE_MEM_DEFINE_STATIC_POOL(PosCtrlHandler,
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t PosCtrlHandlerPoolRef;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create and initialize the batch handlers list.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t BatchHandlerList = LE_DLS_LIST_INIT;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Define static pool for batch handlers
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(PosBatchHandler,
+                          HIGH_POS_BATCH_HANDLER_COUNT,
+                          sizeof(BatchHandler_t));
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory Pool for batch handlers.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t BatchHandlerPoolRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ring of the last position fixes, shared by all the batch handlers. The fix with sequence number
+ * seq is stored at index (seq % FIX_RING_SIZE).
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_pos_Fix_t FixRing[FIX_RING_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sequence number of the next position fix to store in the fix ring.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t NextFixSeq;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of position fixes in the fix ring.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t FixCount;
+
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Number of Handler functions that own position samples.
+ * Number of Handler functions that own position samples, movement and batch handlers included.
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -512,16 +630,43 @@ static uint32_t CalculateAcquisitionRate
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Calculate the distance in meters between two fix points (use Haversine formula).
+ * Convert a latitude or a longitude in radians.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+#define PI 3.14159265
+#define TO_RADIANS(_val_)   (((double)(_val_))/1000000.0*PI/180)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the motion filter for a new fix.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitMotionFilter
+(
+    MotionFilter_t*        filterPtr,   ///< [OUT] The motion filter.
+    const PositionParam_t* posParamPtr  ///< [IN]  The position of the fix.
+)
+{
+    filterPtr->latRad = TO_RADIANS(posParamPtr->latitude);
+    filterPtr->longRad = TO_RADIANS(posParamPtr->longitude);
+    filterPtr->cosLat = cos(filterPtr->latRad);
+    filterPtr->refCount = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calculate the distance in meters between a reference position and the fix of the motion filter
+ * (use Haversine formula).
  *
  */
 //--------------------------------------------------------------------------------------------------
 static uint32_t ComputeDistance
 (
-    uint32_t latitude1,
-    uint32_t longitude1,
-    uint32_t latitude2,
-    uint32_t longitude2
+    const MotionFilter_t* filterPtr,
+    int32_t latitude1,
+    int32_t longitude1
 )
 {
     // Haversine formula:
@@ -529,22 +674,57 @@ static uint32_t ComputeDistance
     // c = 2.atan2(√a, √(1−a))
     // distance = R.c.1000 (in meters)
     // where φ is latitude, λ is longitude, R is earth’s radius (mean radius = 6,371km)
-    #define PI 3.14159265
-
     double R = 6371; // km
-    double dLat = ((double)latitude2-(double)latitude1)/1000000.0*PI/180;
-    double dLon = ((double)longitude2-(double)longitude1)/1000000.0*PI/180;
-    double lat1 = ((double)latitude1)/1000000.0*PI/180;
-    double lat2 = ((double)latitude2)/1000000.0*PI/180;
+    double lat1 = TO_RADIANS(latitude1);
+    double dLat = filterPtr->latRad - lat1;
+    double dLon = filterPtr->longRad - TO_RADIANS(longitude1);
     double a, c;
 
-    a = sin(dLat/2) * sin(dLat/2) + sin(dLon/2) * sin(dLon/2) * cos(lat1) * cos(lat2);
+    a = sin(dLat/2) * sin(dLat/2) + sin(dLon/2) * sin(dLon/2) * cos(lat1) * filterPtr->cosLat;
     c = 2 * atan2(sqrt(a), sqrt(1-a));
 
     LE_DEBUG("Computed distance is %e meters (double)", (double)(R * c * 1000));
     return (uint32_t)(R * c * 1000);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the horizontal move from a reference position to the fix of the motion filter, computing it
+ * only if it is not known yet for this fix.
+ *
+ * @return The horizontal move entry.
+ */
+//--------------------------------------------------------------------------------------------------
+static MotionRef_t* GetMotionRef
+(
+    MotionFilter_t* filterPtr,
+    int32_t latitude,
+    int32_t longitude
+)
+{
+    MotionRef_t* refPtr;
+    uint32_t i;
+
+    for (i = 0; (i < filterPtr->refCount) && (i < MOTION_REF_CACHE_SIZE); i++)
+    {
+        refPtr = &filterPtr->refs[i];
+        if ((refPtr->latitude == latitude) && (refPtr->longitude == longitude))
+        {
+            return refPtr;
+        }
+    }
+
+    refPtr = &filterPtr->refs[filterPtr->refCount % MOTION_REF_CACHE_SIZE];
+    filterPtr->refCount++;
+
+    refPtr->latitude = latitude;
+    refPtr->longitude = longitude;
+    refPtr->move = ComputeDistance(filterPtr, latitude, longitude);
+    refPtr->notBeyondMagnitude = UINT32_MAX;
+
+    return refPtr;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Verify if the covered distance is beyond the magnitude.
@@ -718,6 +898,7 @@ static le_result_t ComputeMove
   le_pos_SampleHandler_t *posSampleHandlerNodePtr,  ///< [IN]  The handler reference.
   const PositionParam_t  *posParamPtr,              ///< [IN]  The position structure for the move
                                                     ///        calculation.
+  MotionFilter_t         *filterPtr,                ///< [INOUT] The motion filter of the fix.
   bool                   *hflagPtr,                 ///< [OUT] True if the horizontal distance is
                                                     ///        beyond the magnitude.
   bool                   *vflagPtr                  ///< [OUT] True if the vertical distance is
@@ -763,14 +944,9 @@ static le_result_t ComputeMove
         posSampleHandlerNodePtr->lastAlt = posParamPtr->altitude;
     }
 
-    uint32_t horizontalMove = ComputeDistance(posSampleHandlerNodePtr->lastLat,
-                                              posSampleHandlerNodePtr->lastLong,
-                                              posParamPtr->latitude,
-                                              posParamPtr->longitude);
-
     uint32_t verticalMove = abs(posParamPtr->altitude - posSampleHandlerNodePtr->lastAlt);
 
-    LE_DEBUG("horizontalMove.%"PRIu32", verticalMove.%"PRIu32, horizontalMove, verticalMove);
+    LE_DEBUG("verticalMove.%"PRIu32, verticalMove);
 
     if (INT32_MAX == posParamPtr->vAccuracy)
     {
@@ -784,16 +960,36 @@ static le_result_t ComputeMove
                                    posParamPtr->vAccuracy/10);
     }
 
-    if (INT32_MAX == posParamPtr->hAccuracy)
+    if ((INT32_MAX == posParamPtr->hAccuracy) ||
+        (0 == posSampleHandlerNodePtr->horizontalMagnitude))
     {
         *hflagPtr = false;
     }
     else
     {
-        // Accuracy is in meters with 2 decimal places
-        *hflagPtr = IsBeyondMagnitude(posSampleHandlerNodePtr->horizontalMagnitude,
-                                   horizontalMove,
-                                   posParamPtr->hAccuracy/100);
+        MotionRef_t* refPtr = GetMotionRef(filterPtr,
+                                           posSampleHandlerNodePtr->lastLat,
+                                           posSampleHandlerNodePtr->lastLong);
+
+        LE_DEBUG("horizontalMove.%"PRIu32, refPtr->move);
+
+        // The handlers are sorted by horizontal magnitude: a magnitude not exceeded from this
+        // reference position is not exceeded by the larger ones either.
+        if (posSampleHandlerNodePtr->horizontalMagnitude >= refPtr->notBeyondMagnitude)
+        {
+            *hflagPtr = false;
+        }
+        else
+        {
+            // Accuracy is in meters with 2 decimal places
+            *hflagPtr = IsBeyondMagnitude(posSampleHandlerNodePtr->horizontalMagnitude,
+                                          refPtr->move,
+                                          posParamPtr->hAccuracy/100);
+            if (!*hflagPtr)
+            {
+                refPtr->notBeyondMagnitude = posSampleHandlerNodePtr->horizontalMagnitude;
+            }
+        }
     }
     LE_DEBUG("Vertical IsBeyondMagnitude.%d", *vflagPtr);
     LE_DEBUG("Horizontal IsBeyondMagnitude.%d", *hflagPtr);
@@ -802,25 +998,17 @@ static le_result_t ComputeMove
 
 //--------------------------------------------------------------------------------------------------
 /**
- * The main position Sample Handler.
+ * Fill a position sample from a GNSS position sample.
  *
  */
 //--------------------------------------------------------------------------------------------------
-static void PosSampleHandlerfunc
+static void FillSample
 (
-    le_gnss_SampleRef_t positionSampleRef,
-    void* contextPtr
+    le_gnss_SampleRef_t    positionSampleRef,   ///< [IN]  The GNSS position sample.
+    const PositionParam_t* posParamPtr,         ///< [IN]  The location already retrieved.
+    le_pos_Sample_t*       samplePtr            ///< [OUT] The position sample.
 )
 {
-    le_result_t result;
-    // Location parameters
-    bool        locationValid = false;
-    int32_t     latitude;
-    int32_t     longitude;
-    int32_t     hAccuracy;
-    bool        altitudeValid = false;
-    int32_t     altitude;
-    int32_t     vAccuracy;
     // Horizontal speed
     uint32_t hSpeed;
     uint32_t hSpeedAccuracy;
@@ -843,10 +1031,246 @@ static void PosSampleHandlerfunc
     uint8_t leapSeconds = UINT8_MAX;
     int32_t currentLeapSec = 0, nextLeapSec = 0;
     uint64_t gpsTimeMs = 0, nextEventMs = 0;
-    PositionParam_t posParam;
     // the position fix state
     le_gnss_FixState_t gnssState;
 
+    samplePtr->latitudeValid = CHECK_VALIDITY(posParamPtr->latitude,INT32_MAX);
+    samplePtr->latitude = posParamPtr->latitude;
+
+    samplePtr->longitudeValid = CHECK_VALIDITY(posParamPtr->longitude,INT32_MAX);
+    samplePtr->longitude = posParamPtr->longitude;
+
+    samplePtr->hAccuracyValid = CHECK_VALIDITY(posParamPtr->hAccuracy,INT32_MAX);
+    samplePtr->hAccuracy = posParamPtr->hAccuracy;
+
+    samplePtr->altitudeValid = CHECK_VALIDITY(posParamPtr->altitude,INT32_MAX);
+    samplePtr->altitude = posParamPtr->altitude;
+
+    samplePtr->vAccuracyValid = CHECK_VALIDITY(posParamPtr->vAccuracy,INT32_MAX);
+    samplePtr->vAccuracy = posParamPtr->vAccuracy;
+
+    // Get horizontal speed
+    le_gnss_GetHorizontalSpeed(positionSampleRef, &hSpeed, &hSpeedAccuracy);
+    samplePtr->hSpeedValid = CHECK_VALIDITY(hSpeed,UINT32_MAX);
+    samplePtr->hSpeed = hSpeed;
+    samplePtr->hSpeedAccuracyValid = CHECK_VALIDITY(hSpeedAccuracy,UINT32_MAX);
+    samplePtr->hSpeedAccuracy = hSpeedAccuracy;
+
+    // Get vertical speed
+    le_gnss_GetVerticalSpeed(positionSampleRef, &vSpeed, &vSpeedAccuracy);
+    samplePtr->vSpeedValid = CHECK_VALIDITY(vSpeed,INT32_MAX);
+    samplePtr->vSpeed = vSpeed;
+    samplePtr->vSpeedAccuracyValid = CHECK_VALIDITY(vSpeedAccuracy,INT32_MAX);
+    samplePtr->vSpeedAccuracy = vSpeedAccuracy;
+
+    // Heading not supported by GNSS engine
+    samplePtr->headingValid = false;
+    samplePtr->heading = UINT32_MAX;
+    samplePtr->headingAccuracyValid = false;
+    samplePtr->headingAccuracy = UINT32_MAX;
+
+    // Get direction
+    le_gnss_GetDirection(positionSampleRef, &direction, &directionAccuracy);
+
+    samplePtr->directionValid = CHECK_VALIDITY(direction,UINT32_MAX);
+    samplePtr->direction = direction;
+    samplePtr->directionAccuracyValid = CHECK_VALIDITY(directionAccuracy,UINT32_MAX);
+    samplePtr->directionAccuracy = directionAccuracy;
+
+    // Get UTC time
+    if (LE_OK == le_gnss_GetDate(positionSampleRef, &year, &month, &day))
+    {
+        samplePtr->dateValid = true;
+    }
+    else
+    {
+        samplePtr->dateValid = false;
+    }
+    samplePtr->year = year;
+    samplePtr->month = month;
+    samplePtr->day = day;
+
+    if (LE_OK == le_gnss_GetTime(positionSampleRef, &hours, &minutes, &seconds, &milliseconds))
+    {
+        samplePtr->timeValid = true;
+    }
+    else
+    {
+        samplePtr->timeValid = false;
+    }
+    samplePtr->hours = hours;
+    samplePtr->minutes = minutes;
+    samplePtr->seconds = seconds;
+    samplePtr->milliseconds = milliseconds;
+
+    // Get UTC leap seconds in advance
+    if (LE_OK == le_gnss_GetLeapSeconds(&gpsTimeMs, &currentLeapSec, &nextEventMs, &nextLeapSec))
+    {
+       //currentLeapSec is in millisecond and need to be traslated to second
+       leapSeconds = (uint8_t) (currentLeapSec / 1000);
+       samplePtr->leapSecondsValid = true;
+    }
+    else
+    {
+        samplePtr->leapSecondsValid = false;
+    }
+    samplePtr->leapSeconds = leapSeconds;
+
+    // Get position fix state
+    if (LE_OK != le_gnss_GetPositionState(positionSampleRef, &gnssState))
+    {
+        samplePtr->fixState = LE_POS_STATE_UNKNOWN;
+        LE_ERROR("Failed to get a position fix");
+    }
+    else
+    {
+        samplePtr->fixState = (le_pos_FixState_t)gnssState;
+    }
+
+    samplePtr->link = LE_DLS_LINK_INIT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store a position sample in the fix ring, converted in the resolutions of the sample_Get*()
+ * functions.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void StoreFix
+(
+    const le_pos_Sample_t* samplePtr    ///< [IN] The position sample.
+)
+{
+    le_pos_Fix_t* fixPtr = &FixRing[NextFixSeq % FIX_RING_SIZE];
+
+    fixPtr->seq = NextFixSeq;
+    fixPtr->fixState = samplePtr->fixState;
+    fixPtr->latitude = samplePtr->latitudeValid ? samplePtr->latitude : INT32_MAX;
+    fixPtr->longitude = samplePtr->longitudeValid ? samplePtr->longitude : INT32_MAX;
+    fixPtr->hAccuracy = samplePtr->hAccuracyValid ?
+                        ConvertDistance(samplePtr->hAccuracy, H_ACCURACY) : INT32_MAX;
+    fixPtr->altitude = samplePtr->altitudeValid ?
+                       ConvertDistance(samplePtr->altitude, ALTITUDE) : INT32_MAX;
+    fixPtr->vAccuracy = samplePtr->vAccuracyValid ?
+                        ConvertDistance(samplePtr->vAccuracy, V_ACCURACY) : INT32_MAX;
+    fixPtr->hSpeed = samplePtr->hSpeedValid ? samplePtr->hSpeed/100 : UINT32_MAX;
+    fixPtr->vSpeed = samplePtr->vSpeedValid ? samplePtr->vSpeed/100 : INT32_MAX;
+    fixPtr->direction = samplePtr->directionValid ? samplePtr->direction/10 : UINT32_MAX;
+
+    if (samplePtr->dateValid)
+    {
+        fixPtr->year = samplePtr->year;
+        fixPtr->month = samplePtr->month;
+        fixPtr->day = samplePtr->day;
+    }
+    else
+    {
+        fixPtr->year = 0;
+        fixPtr->month = 0;
+        fixPtr->day = 0;
+    }
+
+    if (samplePtr->timeValid)
+    {
+        fixPtr->hours = samplePtr->hours;
+        fixPtr->minutes = samplePtr->minutes;
+        fixPtr->seconds = samplePtr->seconds;
+        fixPtr->milliseconds = samplePtr->milliseconds;
+    }
+    else
+    {
+        fixPtr->hours = 0;
+        fixPtr->minutes = 0;
+        fixPtr->seconds = 0;
+        fixPtr->milliseconds = 0;
+    }
+
+    NextFixSeq++;
+    if (FixCount < FIX_RING_SIZE)
+    {
+        FixCount++;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report the new fixes of the fix ring to a batch handler, if any.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportBatch
+(
+    BatchHandler_t* batchHandlerPtr     ///< [IN] The batch handler.
+)
+{
+    uint32_t count = NextFixSeq - batchHandlerPtr->nextSeq;
+
+    if (0 == count)
+    {
+        return;
+    }
+
+    if (count > FIX_RING_SIZE)
+    {
+        LE_WARN("%"PRIu32" fixes lost for batch handler %p",
+                count - FIX_RING_SIZE, batchHandlerPtr->handlerFuncPtr);
+        count = FIX_RING_SIZE;
+    }
+
+    uint32_t firstSeq = NextFixSeq - count;
+    batchHandlerPtr->nextSeq = NextFixSeq;
+
+    if (batchHandlerPtr->timerRef)
+    {
+        le_timer_Restart(batchHandlerPtr->timerRef);
+    }
+
+    LE_DEBUG("Report fixes %"PRIu32" to %"PRIu32" (handler %p)",
+             firstSeq, NextFixSeq - 1, batchHandlerPtr->handlerFuncPtr);
+
+    batchHandlerPtr->handlerFuncPtr(firstSeq, count, batchHandlerPtr->handlerContextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch handler's delay timer handler.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void BatchTimerHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    ReportBatch((BatchHandler_t*)le_timer_GetContextPtr(timerRef));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The main position Sample Handler.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void PosSampleHandlerfunc
+(
+    le_gnss_SampleRef_t positionSampleRef,
+    void* contextPtr
+)
+{
+    le_result_t result;
+    // Location parameters
+    bool        locationValid = false;
+    int32_t     latitude;
+    int32_t     longitude;
+    int32_t     hAccuracy;
+    bool        altitudeValid = false;
+    int32_t     altitude;
+    int32_t     vAccuracy;
+    PositionParam_t posParam;
+    MotionFilter_t  filter;
+    le_pos_Sample_t sample;
+
     // Positioning sample parameters
     le_pos_SampleHandler_t* posSampleHandlerNodePtr;
     le_dls_Link_t*          linkPtr;
@@ -899,6 +1323,38 @@ static void PosSampleHandlerfunc
         LE_DEBUG("Altitude unknown [%"PRIi32",%"PRIi32"]", altitude, vAccuracy);
     }
 
+    posParam.latitude = latitude;
+    posParam.longitude = longitude;
+    posParam.altitude = altitude;
+    posParam.vAccuracy = vAccuracy;
+    posParam.hAccuracy = hAccuracy;
+    posParam.locationValid = locationValid;
+    posParam.altitudeValid = altitudeValid;
+
+    // Retrieve the sample once, for all the handlers
+    FillSample(positionSampleRef, &posParam, &sample);
+
+    // Batched fixes
+    if (le_dls_NumLinks(&BatchHandlerList))
+    {
+        StoreFix(&sample);
+
+        linkPtr = le_dls_Peek(&BatchHandlerList);
+        while (NULL != linkPtr)
+        {
+            BatchHandler_t* batchHandlerPtr = CONTAINER_OF(linkPtr, BatchHandler_t, link);
+
+            // The handler may remove itself
+            linkPtr = le_dls_PeekNext(&BatchHandlerList, linkPtr);
+
+            if ((0 != batchHandlerPtr->maxFixes) &&
+                ((NextFixSeq - batchHandlerPtr->nextSeq) >= batchHandlerPtr->maxFixes))
+            {
+                ReportBatch(batchHandlerPtr);
+            }
+        }
+    }
+
     // Positioning sample
     linkPtr = le_dls_Peek(&PosSampleHandlerList);
 
@@ -909,13 +1365,8 @@ static void PosSampleHandlerfunc
         return;
     }
 
-    posParam.latitude = latitude;
-    posParam.longitude = longitude;
-    posParam.altitude = altitude;
-    posParam.vAccuracy = vAccuracy;
-    posParam.hAccuracy = hAccuracy;
-    posParam.locationValid = locationValid;
-    posParam.altitudeValid = altitudeValid;
+    // Evaluate the move of all the handlers from the same motion filter
+    InitMotionFilter(&filter, &posParam);
 
     do
     {
@@ -925,7 +1376,7 @@ static void PosSampleHandlerfunc
                                                                         le_pos_SampleHandler_t,
                                                                         link);
 
-        if (LE_FAULT == ComputeMove(posSampleHandlerNodePtr, &posParam, &hflag, &vflag))
+        if (LE_FAULT == ComputeMove(posSampleHandlerNodePtr, &posParam, &filter, &hflag, &vflag))
         {
             // Release provided Position sample reference
             le_gnss_ReleaseSampleRef(positionSampleRef);
@@ -946,112 +1397,7 @@ static void PosSampleHandlerfunc
             posSampleRequestPtr = le_mem_ForceAlloc(PosSampleRequestPoolRef);
             posSampleRequestPtr->posSampleNodePtr
                                 = (le_pos_Sample_t*)le_mem_ForceAlloc(PosSamplePoolRef);
-            posSampleRequestPtr->posSampleNodePtr->latitudeValid
-                                = CHECK_VALIDITY(latitude,INT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->latitude = latitude;
-
-            posSampleRequestPtr->posSampleNodePtr->longitudeValid
-                                = CHECK_VALIDITY(longitude,INT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->longitude = longitude;
-
-            posSampleRequestPtr->posSampleNodePtr->hAccuracyValid
-                                = CHECK_VALIDITY(hAccuracy,INT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->hAccuracy = hAccuracy;
-
-            posSampleRequestPtr->posSampleNodePtr->altitudeValid
-                                = CHECK_VALIDITY(altitude,INT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->altitude = altitude;
-
-            posSampleRequestPtr->posSampleNodePtr->vAccuracyValid
-                                = CHECK_VALIDITY(vAccuracy,INT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->vAccuracy = vAccuracy;
-
-            // Get horizontal speed
-            le_gnss_GetHorizontalSpeed(positionSampleRef, &hSpeed, &hSpeedAccuracy);
-            posSampleRequestPtr->posSampleNodePtr->hSpeedValid
-                                    = CHECK_VALIDITY(hSpeed,UINT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->hSpeed = hSpeed;
-            posSampleRequestPtr->posSampleNodePtr->hSpeedAccuracyValid =
-                                                CHECK_VALIDITY(hSpeedAccuracy,UINT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->hSpeedAccuracy = hSpeedAccuracy;
-
-            // Get vertical speed
-            le_gnss_GetVerticalSpeed(positionSampleRef, &vSpeed, &vSpeedAccuracy);
-            posSampleRequestPtr->posSampleNodePtr->vSpeedValid
-                                = CHECK_VALIDITY(vSpeed,INT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->vSpeed = vSpeed;
-            posSampleRequestPtr->posSampleNodePtr->vSpeedAccuracyValid =
-                                                CHECK_VALIDITY(vSpeedAccuracy,INT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->vSpeedAccuracy = vSpeedAccuracy;
-
-            // Heading not supported by GNSS engine
-            posSampleRequestPtr->posSampleNodePtr->headingValid = false;
-            posSampleRequestPtr->posSampleNodePtr->heading = UINT32_MAX;
-            posSampleRequestPtr->posSampleNodePtr->headingAccuracyValid = false;
-            posSampleRequestPtr->posSampleNodePtr->headingAccuracy = UINT32_MAX;
-
-            // Get direction
-            le_gnss_GetDirection(positionSampleRef, &direction, &directionAccuracy);
-
-            posSampleRequestPtr->posSampleNodePtr->directionValid
-                                = CHECK_VALIDITY(direction,UINT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->direction = direction;
-            posSampleRequestPtr->posSampleNodePtr->directionAccuracyValid =
-                                            CHECK_VALIDITY(directionAccuracy,UINT32_MAX);
-            posSampleRequestPtr->posSampleNodePtr->directionAccuracy = directionAccuracy;
-
-            // Get UTC time
-            if (LE_OK == le_gnss_GetDate(positionSampleRef, &year, &month, &day))
-            {
-                posSampleRequestPtr->posSampleNodePtr->dateValid = true;
-            }
-            else
-            {
-                posSampleRequestPtr->posSampleNodePtr->dateValid = false;
-            }
-            posSampleRequestPtr->posSampleNodePtr->year = year;
-            posSampleRequestPtr->posSampleNodePtr->month = month;
-            posSampleRequestPtr->posSampleNodePtr->day = day;
-
-            if (LE_OK == le_gnss_GetTime(positionSampleRef, &hours, &minutes, &seconds,
-                                         &milliseconds))
-            {
-                posSampleRequestPtr->posSampleNodePtr->timeValid = true;
-            }
-            else
-            {
-                posSampleRequestPtr->posSampleNodePtr->timeValid = false;
-            }
-            posSampleRequestPtr->posSampleNodePtr->hours = hours;
-            posSampleRequestPtr->posSampleNodePtr->minutes = minutes;
-            posSampleRequestPtr->posSampleNodePtr->seconds = seconds;
-            posSampleRequestPtr->posSampleNodePtr->milliseconds = milliseconds;
-
-            // Get UTC leap seconds in advance
-            if (LE_OK == le_gnss_GetLeapSeconds(&gpsTimeMs, &currentLeapSec, &nextEventMs, &nextLeapSec))
-            {
-               //currentLeapSec is in millisecond and need to be traslated to second
-               leapSeconds = (uint8_t) (currentLeapSec / 1000);
-               posSampleRequestPtr->posSampleNodePtr->leapSecondsValid = true;
-            }
-            else
-            {
-                posSampleRequestPtr->posSampleNodePtr->leapSecondsValid = false;
-            }
-            posSampleRequestPtr->posSampleNodePtr->leapSeconds = leapSeconds;
-
-            // Get position fix state
-            if (LE_OK != le_gnss_GetPositionState(positionSampleRef, &gnssState))
-            {
-                posSampleRequestPtr->posSampleNodePtr->fixState = LE_POS_STATE_UNKNOWN;
-                LE_ERROR("Failed to get a position fix");
-            }
-            else
-            {
-                posSampleRequestPtr->posSampleNodePtr->fixState = (le_pos_FixState_t)gnssState;
-            }
-
-            posSampleRequestPtr->posSampleNodePtr->link = LE_DLS_LINK_INIT;
+            *posSampleRequestPtr->posSampleNodePtr = sample;
 
             // Add the node to the queue of the list by passing in the node's link.
             le_dls_Queue(&PosSampleList, &(posSampleRequestPtr->posSampleNodePtr->link));
@@ -1221,6 +1567,19 @@ static void PosCloseSessionEventHandler
         // Get the next value in the reference mpa
         result = le_ref_NextNode(iterRef);
     }
+
+    // Remove the batch handlers of the client session that has been closed.
+    le_dls_Link_t* linkPtr = le_dls_Peek(&BatchHandlerList);
+    while (NULL != linkPtr)
+    {
+        BatchHandler_t* batchHandlerPtr = CONTAINER_OF(linkPtr, BatchHandler_t, link);
+        linkPtr = le_dls_PeekNext(&BatchHandlerList, linkPtr);
+
+        if (batchHandlerPtr->sessionRef == sessionRef)
+        {
+            le_pos_RemoveBatchHandler((le_pos_BatchHandlerRef_t)batchHandlerPtr);
+        }
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1261,6 +1620,11 @@ COMPONENT_INIT
                                                     sizeof(le_pos_SampleHandler_t));
     le_mem_SetDestructor(PosSampleHandlerPoolRef, PosSampleHandlerDestructor);
 
+    // Create a pool for batch handler objects
+    BatchHandlerPoolRef = le_mem_InitStaticPool(PosBatchHandler,
+                                                HIGH_POS_BATCH_HANDLER_COUNT,
+                                                sizeof(BatchHandler_t));
+
     // Create the reference HashMap for positioning sample
     PosSampleMap = le_ref_InitStaticMap(PosSampleMap, POSITIONING_SAMPLE_MAX);
 
@@ -1461,7 +1825,23 @@ le_pos_MovementHandlerRef_t le_pos_AddMovementHandler
         }
     }
 
-    le_dls_Queue(&PosSampleHandlerList, &(posSampleHandlerNodePtr->link));
+    // Keep the handlers sorted by horizontal magnitude, for the motion filter
+    le_dls_Link_t* linkPtr = le_dls_Peek(&PosSampleHandlerList);
+    while ((NULL != linkPtr) &&
+           (CONTAINER_OF(linkPtr, le_pos_SampleHandler_t, link)->horizontalMagnitude <=
+            horizontalMagnitude))
+    {
+        linkPtr = le_dls_PeekNext(&PosSampleHandlerList, linkPtr);
+    }
+
+    if (NULL == linkPtr)
+    {
+        le_dls_Queue(&PosSampleHandlerList, &(posSampleHandlerNodePtr->link));
+    }
+    else
+    {
+        le_dls_AddBefore(&PosSampleHandlerList, linkPtr, &(posSampleHandlerNodePtr->link));
+    }
     NumOfHandlers++;
 
     return (le_pos_MovementHandlerRef_t)posSampleHandlerNodePtr;
@@ -1514,6 +1894,171 @@ void le_pos_RemoveMovementHandler
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to register a handler for batches of position fixes.
+ *
+ * @return A handler reference, which is only needed for later removal of the handler, or NULL if
+ *         the parameters are invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+le_pos_BatchHandlerRef_t le_pos_AddBatchHandler
+(
+    uint32_t                  maxFixes,     ///< [IN] The number of fixes to report at once.
+    uint32_t                  maxDelay,     ///< [IN] The maximum delay in milliseconds before
+                                            ///       reporting new fixes.
+    le_pos_BatchHandlerFunc_t handlerPtr,   ///< [IN] The handler function.
+    void*                     contextPtr    ///< [IN] The context pointer.
+)
+{
+    BatchHandler_t* batchHandlerPtr;
+
+    if (NULL == handlerPtr)
+    {
+        LE_KILL_CLIENT("handlerPtr pointer is NULL!");
+        return NULL;
+    }
+
+    if (((0 == maxFixes) && (0 == maxDelay)) || (maxFixes > LE_POS_BATCH_MAX_FIXES))
+    {
+        LE_ERROR("Invalid batch parameters: %"PRIu32" fixes, %"PRIu32" ms", maxFixes, maxDelay);
+        return NULL;
+    }
+
+    // Start acquisition
+    if (0 == NumOfHandlers)
+    {
+        if (NULL == (GnssHandlerRef=le_gnss_AddPositionHandler(PosSampleHandlerfunc, NULL)))
+        {
+            LE_ERROR("Failed to add PA GNSS's handler!");
+            return NULL;
+        }
+    }
+
+    batchHandlerPtr = le_mem_ForceAlloc(BatchHandlerPoolRef);
+    batchHandlerPtr->link = LE_DLS_LINK_INIT;
+    batchHandlerPtr->handlerFuncPtr = handlerPtr;
+    batchHandlerPtr->handlerContextPtr = contextPtr;
+    batchHandlerPtr->maxFixes = maxFixes;
+    batchHandlerPtr->nextSeq = NextFixSeq;
+    batchHandlerPtr->sessionRef = le_pos_GetClientSessionRef();
+    batchHandlerPtr->timerRef = NULL;
+
+    if (maxDelay)
+    {
+        batchHandlerPtr->timerRef = le_timer_Create("PosBatchTimer");
+        le_timer_SetMsInterval(batchHandlerPtr->timerRef, maxDelay);
+        le_timer_SetRepeat(batchHandlerPtr->timerRef, 0);
+        le_timer_SetContextPtr(batchHandlerPtr->timerRef, batchHandlerPtr);
+        le_timer_SetHandler(batchHandlerPtr->timerRef, BatchTimerHandler);
+        le_timer_Start(batchHandlerPtr->timerRef);
+    }
+
+    le_dls_Queue(&BatchHandlerList, &(batchHandlerPtr->link));
+    NumOfHandlers++;
+
+    return (le_pos_BatchHandlerRef_t)batchHandlerPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to remove a handler for batches of position fixes.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_pos_RemoveBatchHandler
+(
+    le_pos_BatchHandlerRef_t handlerRef ///< [IN] The handler reference.
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&BatchHandlerList);
+
+    while (NULL != linkPtr)
+    {
+        BatchHandler_t* batchHandlerPtr = CONTAINER_OF(linkPtr, BatchHandler_t, link);
+
+        if ((le_pos_BatchHandlerRef_t)batchHandlerPtr == handlerRef)
+        {
+            le_dls_Remove(&BatchHandlerList, linkPtr);
+            if (batchHandlerPtr->timerRef)
+            {
+                le_timer_Delete(batchHandlerPtr->timerRef);
+            }
+            le_mem_Release(batchHandlerPtr);
+
+            NumOfHandlers--;
+            if (0 == NumOfHandlers)
+            {
+                le_gnss_RemovePositionHandler(GnssHandlerRef);
+                GnssHandlerRef = NULL;
+            }
+            return;
+        }
+
+        linkPtr = le_dls_PeekNext(&BatchHandlerList, linkPtr);
+    }
+
+    LE_ERROR("Invalid batch handler reference %p", handlerRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the position fixes kept for batched delivery, starting with a given sequence number.
+ *
+ * @return LE_OK            Function succeeded.
+ * @return LE_OUT_OF_RANGE  Some of the requested fixes are lost, the first fix returned is the
+ *                          oldest one kept.
+ * @return LE_NOT_FOUND     No fix with a sequence number greater than or equal to firstSeq.
+ * @return LE_BAD_PARAMETER Invalid parameter.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_pos_GetFixes
+(
+    uint32_t      firstSeq,     ///< [IN] Sequence number of the first fix to get.
+    le_pos_Fix_t* fixesPtr,     ///< [OUT] Position fixes, oldest first.
+    size_t*       fixesSizePtr  ///< [INOUT] Number of entries in fixesPtr, then number of fixes.
+)
+{
+    le_result_t result = LE_OK;
+    uint32_t count;
+    uint32_t startSeq;
+    uint32_t i;
+
+    if ((NULL == fixesPtr) || (NULL == fixesSizePtr))
+    {
+        LE_KILL_CLIENT("fixesPtr or fixesSizePtr is NULL!");
+        return LE_BAD_PARAMETER;
+    }
+
+    // Number of fixes from firstSeq to the last one, with the sequence numbers wrapping around
+    count = NextFixSeq - firstSeq;
+    if ((0 == count) || (count > INT32_MAX))
+    {
+        *fixesSizePtr = 0;
+        return LE_NOT_FOUND;
+    }
+
+    if (count > FixCount)
+    {
+        count = FixCount;
+        result = LE_OUT_OF_RANGE;
+    }
+
+    startSeq = NextFixSeq - count;
+
+    if (count > *fixesSizePtr)
+    {
+        count = *fixesSizePtr;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        fixesPtr[i] = FixRing[(startSeq + i) % FIX_RING_SIZE];
+    }
+    *fixesSizePtr = count;
+
+    return result;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get the position sample's 2D location (latitude, longitude,
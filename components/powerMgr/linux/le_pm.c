@@ -34,6 +34,14 @@
 //--------------------------------------------------------------------------------------------------
 #define LEGATO_TAG_PREFIX   "legato"
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Name of the kernel wakeup source held while any Legato wakeup source is held.  It uses the
+ * Legato prefix, so that it is released at startup like the others.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KERNEL_WS_NAME      LEGATO_TAG_PREFIX "_powerMgr"
+
 ///@{
 //--------------------------------------------------------------------------------------------------
 /**
@@ -84,6 +92,9 @@ typedef struct
     pid_t         pid;      // client pid of wakeup source owner
     void          *wsref;   // back-pointer to safe reference
     bool          isRef;     // true if reference counted, false if not
+    uint32_t      acquireCount;     // number of times the wakeup source has been acquired
+    uint64_t      heldTimeMs;       // total time the wakeup source has been held, when released
+    le_clk_Time_t heldSince;        // time the wakeup source was acquired, when taken
 }
 WakeupSource_t;
 #define PM_WAKEUP_SOURCE_COOKIE 0xa1f6337b
@@ -118,8 +129,11 @@ static struct
     le_mem_PoolRef_t    cpool;   // memory pool for client records
     le_hashmap_Ref_t    clients; // table of client records
     bool                isFull;  // le_pm_StayAwke() fails with LE_NO_MEMORY
+    uint32_t            held;    // number of wakeup sources taken
+    bool                isLocked;   // true if the kernel wakeup source is held
+    le_timer_Ref_t      relaxTimer; // timer releasing the kernel wakeup source
 }
-PowerManager = {-1, -1, NULL, NULL, NULL, NULL, NULL, false};
+PowerManager = {-1, -1, NULL, NULL, NULL, NULL, NULL, false, 0, false, NULL};
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -217,6 +231,172 @@ static inline Client_t *to_Client_t
 #endif
 #undef DEBUG
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Acquire the kernel wakeup source, if it isn't held already
+ *
+ * @return
+ *     - LE_OK          if the kernel wakeup source is held
+ *     - LE_NO_MEMORY   if the wakeup sources limit is reached
+ *     - LE_FAULT       for other errors
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LockKernel
+(
+    void
+)
+{
+    // Cancel a pending release
+    le_timer_Stop(PowerManager.relaxTimer);
+
+    if (PowerManager.isLocked)
+    {
+        return LE_OK;
+    }
+
+    // Write to /sys/power/wake_lock
+    if (0 > write(PowerManager.wl, KERNEL_WS_NAME, sizeof(KERNEL_WS_NAME) - 1))
+    {
+        if (ENOSPC == errno)
+        {
+            LE_ERROR("Too many wakeup source: Cannot acquire '%s'.", KERNEL_WS_NAME);
+            PowerManager.isFull = true;
+            return LE_NO_MEMORY;
+        }
+        else if (EBADF == errno)
+        {
+            LE_FATAL("Error acquiring wakeup source '%s'. Invalid file descriptor %d.",
+                     KERNEL_WS_NAME, PowerManager.wl);
+        }
+        else
+        {
+            LE_CRIT("Error acquiring wakeup source '%s': %m", KERNEL_WS_NAME);
+            return LE_FAULT;
+        }
+    }
+
+    PowerManager.isLocked = true;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the kernel wakeup source, if it is held
+ */
+//--------------------------------------------------------------------------------------------------
+static void UnlockKernel
+(
+    void
+)
+{
+    if (!PowerManager.isLocked)
+    {
+        return;
+    }
+
+    // Write to /sys/power/wake_unlock
+    if (0 > write(PowerManager.wu, KERNEL_WS_NAME, sizeof(KERNEL_WS_NAME) - 1))
+    {
+        if (EBADF == errno)
+        {
+            LE_FATAL("Error releasing wakeup source '%s'. Invalid file descriptor %d.",
+                     KERNEL_WS_NAME, PowerManager.wu);
+        }
+
+        // EINVAL means that it is not locked anymore, which is what we want.
+        LE_ERROR_IF(EINVAL != errno, "Error releasing wakeup source '%s': %m", KERNEL_WS_NAME);
+    }
+
+    PowerManager.isLocked = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release timer expiry handler: release the kernel wakeup source if no wakeup source has been
+ * acquired since the last one was released
+ */
+//--------------------------------------------------------------------------------------------------
+static void RelaxTimerHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    if (0 == PowerManager.held)
+    {
+        UnlockKernel();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the time elapsed since a given time, in milliseconds
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetElapsedMs
+(
+    le_clk_Time_t since
+)
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), since);
+
+    return ((uint64_t)elapsed.sec * 1000) + (elapsed.usec / 1000);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Account for a wakeup source going from released to taken
+ *
+ * @return
+ *     - LE_OK          if the kernel wakeup source is held
+ *     - LE_NO_MEMORY   if the wakeup sources limit is reached
+ *     - LE_FAULT       for other errors
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Hold
+(
+    WakeupSource_t *ws
+)
+{
+    le_result_t result = LockKernel();
+
+    if (LE_OK != result)
+    {
+        return result;
+    }
+
+    PowerManager.held++;
+    ws->acquireCount++;
+    ws->heldSince = le_clk_GetRelativeTime();
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Account for a wakeup source going from taken to released.  The kernel wakeup source is released
+ * after a delay once no wakeup source is taken anymore.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Unhold
+(
+    WakeupSource_t *ws
+)
+{
+    ws->heldTimeMs += GetElapsedMs(ws->heldSince);
+
+    if (0 == --PowerManager.held)
+    {
+        if (0 == LE_CONFIG_POWER_MGR_RELAX_DELAY_MS)
+        {
+            UnlockKernel();
+        }
+        else
+        {
+            le_timer_Restart(PowerManager.relaxTimer);
+        }
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Client connect callback
@@ -398,6 +578,11 @@ COMPONENT_INIT
         LE_FATAL("Failed to create client hashmap");
     }
 
+    // Create the timer releasing the kernel wakeup source
+    PowerManager.relaxTimer = le_timer_Create("RelaxTimer");
+    le_timer_SetMsInterval(PowerManager.relaxTimer, LE_CONFIG_POWER_MGR_RELAX_DELAY_MS);
+    le_timer_SetHandler(PowerManager.relaxTimer, RelaxTimerHandler);
+
     // Register client connect/disconnect handlers
     le_msg_AddServiceOpenHandler(le_pm_GetServiceRef(), OnClientConnect, NULL);
     le_msg_AddServiceCloseHandler(le_pm_GetServiceRef(), OnClientDisconnect, NULL);
@@ -497,6 +682,8 @@ le_pm_WakeupSourceRef_t le_pm_NewWakeupSource
     ws->taken = 0;
     ws->pid = cl->pid;
     ws->isRef = (opts & LE_PM_REF_COUNT ? true : false);
+    ws->acquireCount = 0;
+    ws->heldTimeMs = 0;
 
     ws->wsref = le_ref_CreateRef(PowerManager.refs, ws);
 
@@ -561,28 +748,14 @@ le_result_t le_pm_StayAwake
         return LE_OK;
     }
 
-    // Write to /sys/power/wake_lock
-    if (0 > write(PowerManager.wl, entry->name, strlen(entry->name)))
+    le_result_t result = Hold(entry);
+    if (LE_OK != result)
     {
-        if (ENOSPC == errno)
-        {
-            LE_ERROR("Too many wakeup source: Cannot acquire '%s'.", entry->name);
-            PowerManager.isFull = true;
-            return LE_NO_MEMORY;
-        }
-        else if (EBADF == errno)
-        {
-            LE_FATAL("Error acquiring wakeup source '%s'. Invalid file descriptor %d.",
-                     entry->name, PowerManager.wl);
-        }
-        else
-        {
-            LE_CRIT("Error acquiring wakeup source '%s': %m", entry->name);
-            return LE_FAULT;
-        }
+        LE_ERROR("Cannot acquire wakeup source '%s'.", entry->name);
+        entry->taken = 0;
     }
 
-    return LE_OK;
+    return result;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -643,25 +816,7 @@ le_result_t le_pm_Relax
         entry->taken = 0;
     }
 
-    // write to /sys/power/wake_unlock
-    if (0 > write(PowerManager.wu, entry->name, strlen(entry->name)))
-    {
-        if (EINVAL == errno)
-        {
-            LE_ERROR("Wakeup source '%s' is not locked.", entry->name);
-            return LE_NOT_FOUND;
-        }
-        else if (EBADF == errno)
-        {
-            LE_FATAL("Error releasing wakeup source '%s'. Invalid file descriptor %d.",
-                     entry->name, PowerManager.wu);
-        }
-        else
-        {
-            LE_CRIT("Error releasing wakeup source '%s': %m", entry->name);
-            return LE_FAULT;
-        }
-    }
+    Unhold(entry);
 
     return LE_OK;
 }
@@ -745,3 +900,52 @@ le_result_t le_pm_ForceRelaxAndDestroyAllWakeupSource
 
     return LE_OK;
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the statistics of a wakeup source.  Wakeup sources are numbered from 0, in no particular
+ * order; the numbering changes when wakeup sources are created or deleted.
+ *
+ * @return
+ *     - LE_OK              on success
+ *     - LE_OUT_OF_RANGE    if there is no wakeup source with this index
+ *     - LE_OVERFLOW        if the name didn't fit in the buffer (it is truncated)
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_pm_GetWakeupSourceStats
+(
+    uint32_t index,             ///< [IN] Index of the wakeup source.
+    char *name,                 ///< [OUT] Full name of the wakeup source.
+    size_t nameSize,            ///< [IN] Size of the name buffer.
+    int32_t *pidPtr,            ///< [OUT] Process ID of the client owning it.
+    bool *isHeldPtr,            ///< [OUT] Whether the wakeup source is held now.
+    uint32_t *acquireCountPtr,  ///< [OUT] Number of times it went from released to held.
+    uint64_t *heldTimeMsPtr     ///< [OUT] Total time it has been held (ms).
+)
+{
+    WakeupSource_t *ws;
+    le_hashmap_It_Ref_t iter;
+
+    iter = le_hashmap_GetIterator(PowerManager.locks);
+    do
+    {
+        if (LE_OK != le_hashmap_NextNode(iter))
+        {
+            return LE_OUT_OF_RANGE;
+        }
+    }
+    while (index-- > 0);
+
+    ws = (WakeupSource_t*)le_hashmap_GetValue(iter);
+
+    *pidPtr = ws->pid;
+    *isHeldPtr = (ws->taken > 0);
+    *acquireCountPtr = ws->acquireCount;
+    *heldTimeMsPtr = ws->heldTimeMs;
+    if (ws->taken)
+    {
+        *heldTimeMsPtr += GetElapsedMs(ws->heldSince);
+    }
+
+    return le_utf8_Copy(name, ws->name, nameSize, NULL);
+}
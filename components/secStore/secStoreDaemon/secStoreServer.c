@@ -30,6 +30,10 @@
 #   include "appCfg.h"
 #endif
 
+#if (LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0) && LE_CONFIG_LINUX
+#   include <sys/mman.h>
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Number of bytes in secure storage path buffer.
@@ -78,6 +82,55 @@
 //--------------------------------------------------------------------------------------------------
 #define MS_WDOG_INTERVAL 8
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of buffers holding the items written or read through a file descriptor.  It is only
+ * created when first needed, as most systems never use these functions.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t BlobPool = NULL;
+
+#if LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Largest item kept in the item cache.  Larger items are always read from secure storage.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CACHE_ITEM_MAX_BYTES 512
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * An item of secure storage kept in memory, in clear, so that reading it again does not cost a
+ * decryption in the platform adaptor.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char     path[SECSTORE_MAX_PATH_BYTES];     ///< Path of the item, empty if the entry is free.
+    uint8_t  data[CACHE_ITEM_MAX_BYTES];        ///< Content of the item.
+    size_t   size;                              ///< Size of the item.
+    uint32_t lastUse;                           ///< Value of CacheUseCount when last used.
+}
+CachedItem_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Cache of the most recently used items.  It is locked in RAM so that the items never reach the
+ * swap, and its entries are wiped as soon as they are evicted.
+ */
+//--------------------------------------------------------------------------------------------------
+static CachedItem_t ItemCache[LE_CONFIG_SECSTORE_CACHE_ENTRIES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counter of the item cache accesses, to find the least recently used entry.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t CacheUseCount = 0;
+
+#endif /* end LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0 */
+
 #if LE_CONFIG_SOTA
 
 //--------------------------------------------------------------------------------------------------
@@ -781,6 +834,143 @@ static bool IsValidName
     return true;
 }
 
+#if LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wipe an entry of the item cache.  The writes go through a volatile pointer so that they are not
+ * optimized away.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WipeCachedItem
+(
+    CachedItem_t* itemPtr           ///< [IN] Entry to wipe.
+)
+{
+    volatile uint8_t* bytePtr = (volatile uint8_t*)itemPtr;
+    size_t i;
+
+    for (i = 0; i < sizeof(CachedItem_t); i++)
+    {
+        bytePtr[i] = 0;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find an item in the item cache.
+ *
+ * @return
+ *      The cache entry of the item.
+ *      NULL if the item is not cached.
+ */
+//--------------------------------------------------------------------------------------------------
+static CachedItem_t* FindCachedItem
+(
+    const char* path                ///< [IN] Path of the item.
+)
+{
+    int i;
+
+    for (i = 0; i < LE_CONFIG_SECSTORE_CACHE_ENTRIES; i++)
+    {
+        if ((ItemCache[i].path[0] != '\0') && (strcmp(ItemCache[i].path, path) == 0))
+        {
+            ItemCache[i].lastUse = ++CacheUseCount;
+            return &ItemCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Put an item in the item cache, evicting the least recently used one if the cache is full.
+ * Items too large for the cache are only removed from it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CacheItem
+(
+    const char* path,               ///< [IN] Path of the item.
+    const uint8_t* bufPtr,          ///< [IN] Content of the item.
+    size_t size                     ///< [IN] Size of the item.
+)
+{
+    CachedItem_t* itemPtr = FindCachedItem(path);
+    int i;
+
+    if ((size > CACHE_ITEM_MAX_BYTES) || (strlen(path) >= sizeof(itemPtr->path)))
+    {
+        if (itemPtr)
+        {
+            WipeCachedItem(itemPtr);
+        }
+        return;
+    }
+
+    if (!itemPtr)
+    {
+        itemPtr = &ItemCache[0];
+        for (i = 0; i < LE_CONFIG_SECSTORE_CACHE_ENTRIES; i++)
+        {
+            if (ItemCache[i].path[0] == '\0')
+            {
+                itemPtr = &ItemCache[i];
+                break;
+            }
+            if (ItemCache[i].lastUse < itemPtr->lastUse)
+            {
+                itemPtr = &ItemCache[i];
+            }
+        }
+        WipeCachedItem(itemPtr);
+        le_utf8_Copy(itemPtr->path, path, sizeof(itemPtr->path), NULL);
+    }
+
+    memcpy(itemPtr->data, bufPtr, size);
+    if (size < itemPtr->size)
+    {
+        memset(itemPtr->data + size, 0, itemPtr->size - size);
+    }
+    itemPtr->size = size;
+    itemPtr->lastUse = ++CacheUseCount;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove an item, or all the items under a path, from the item cache.  All the items are removed
+ * if the path is NULL.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UncacheItems
+(
+    const char* path                ///< [IN] Path of the item or of the directory, or NULL.
+)
+{
+    size_t pathLen = (path ? strlen(path) : 0);
+    int i;
+
+    for (i = 0; i < LE_CONFIG_SECSTORE_CACHE_ENTRIES; i++)
+    {
+        const char* itemPath = ItemCache[i].path;
+
+        if ((itemPath[0] != '\0') &&
+            ((path == NULL) ||
+             ((strncmp(itemPath, path, pathLen) == 0) &&
+              ((itemPath[pathLen] == '\0') || (itemPath[pathLen] == '/')))))
+        {
+            WipeCachedItem(&ItemCache[i]);
+        }
+    }
+}
+
+#else /* LE_CONFIG_SECSTORE_CACHE_ENTRIES == 0 */
+
+#define UncacheItems(path)
+
+#endif /* end LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0 */
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Prepare for a read or write operation, including constructing the path and initializing the
@@ -908,6 +1098,17 @@ static le_result_t Write
     // Write the item to the secure storage.
     result = pa_secStore_Write(path, bufPtr, bufNumElements);
 
+#if LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0
+    if (result == LE_OK)
+    {
+        CacheItem(path, bufPtr, bufNumElements);
+    }
+    else
+#endif
+    {
+        UncacheItems(path);
+    }
+
     if (result == LE_BAD_PARAMETER)
     {
         return LE_FAULT;
@@ -998,8 +1199,34 @@ static le_result_t Read
         return result;
     }
 
-    // Read the item from the secure storage.
-    result = pa_secStore_Read(path, bufPtr, bufNumElementsPtr);
+#if LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0
+    CachedItem_t* itemPtr = FindCachedItem(path);
+    if (itemPtr)
+    {
+        if (*bufNumElementsPtr < itemPtr->size)
+        {
+            result = LE_OVERFLOW;
+        }
+        else
+        {
+            memcpy(bufPtr, itemPtr->data, itemPtr->size);
+            *bufNumElementsPtr = itemPtr->size;
+            result = LE_OK;
+        }
+    }
+    else
+#endif
+    {
+        // Read the item from the secure storage.
+        result = pa_secStore_Read(path, bufPtr, bufNumElementsPtr);
+
+#if LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0
+        if (result == LE_OK)
+        {
+            CacheItem(path, bufPtr, *bufNumElementsPtr);
+        }
+#endif
+    }
 
     // If there is an error, make sure that the buffer is empty.
     if ( (LE_OK != result) && (bufNumElementsPtr > 0) )
@@ -1086,6 +1313,7 @@ le_result_t Delete
     }
 
     // Delete the item from the secure storage.
+    UncacheItems(path);
     return pa_secStore_Delete(path);
 }
 
@@ -1131,6 +1359,270 @@ le_result_t secStoreGlobal_Delete
 
 #endif /* end !MK_CONFIG_SECSTORE_DISABLE_GLOBAL_ACCESS */
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a buffer to hold an item written or read through a file descriptor.
+ *
+ * @return
+ *      The buffer, of LE_SECSTORE_MAX_BLOB_SIZE bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t* GetBlobBuffer
+(
+    void
+)
+{
+    if (BlobPool == NULL)
+    {
+        BlobPool = le_mem_CreatePool("SecStoreBlobPool", LE_SECSTORE_MAX_BLOB_SIZE);
+    }
+
+    return le_mem_ForceAlloc(BlobPool);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wipe and release a buffer obtained from GetBlobBuffer().
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseBlobBuffer
+(
+    uint8_t* bufPtr,                ///< [IN] Buffer to release.
+    size_t usedSize                 ///< [IN] Number of bytes of the buffer used.
+)
+{
+    volatile uint8_t* bytePtr = bufPtr;
+    size_t i;
+
+    for (i = 0; i < usedSize; i++)
+    {
+        bytePtr[i] = 0;
+    }
+
+    le_mem_Release(bufPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes an item to secure storage from the content of a file.  The file descriptor is closed.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the content is larger than LE_SECSTORE_MAX_BLOB_SIZE.
+ *      LE_NO_MEMORY if there is not enough memory to store the item.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteFromFile
+(
+    bool isGlobal,                  ///< [IN] Is this an operation is the global domain?
+    const char* name,               ///< [IN] Name of the secure storage item.
+    int fd                          ///< [IN] File to read the item from.
+)
+{
+    le_result_t result = LE_OK;
+    uint8_t*    bufPtr;
+    size_t      size = 0;
+    ssize_t     readSize;
+
+    if (fd < 0)
+    {
+        LE_KILL_CLIENT("Invalid file descriptor.");
+        return LE_FAULT;
+    }
+
+    // A pipe still open for writing must not block the daemon.
+    le_fd_Fcntl(fd, F_SETFL, le_fd_Fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    bufPtr = GetBlobBuffer();
+
+    do
+    {
+        readSize = le_fd_Read(fd, bufPtr + size, LE_SECSTORE_MAX_BLOB_SIZE - size);
+        if (readSize > 0)
+        {
+            size += readSize;
+        }
+    }
+    while (((readSize > 0) && (size < LE_SECSTORE_MAX_BLOB_SIZE)) ||
+           ((readSize < 0) && (errno == EINTR)));
+
+    if (readSize < 0)
+    {
+        LE_ERROR("Could not read the item content. %m.");
+        result = LE_FAULT;
+    }
+    else if (size == LE_SECSTORE_MAX_BLOB_SIZE)
+    {
+        // Tell an item of the maximum size from a larger one.
+        uint8_t extraByte;
+
+        if (le_fd_Read(fd, &extraByte, 1) > 0)
+        {
+            result = LE_OVERFLOW;
+        }
+    }
+
+    le_fd_Close(fd);
+
+    if (result == LE_OK)
+    {
+        result = Write(isGlobal, name, bufPtr, size);
+    }
+
+    ReleaseBlobBuffer(bufPtr, size);
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes an item to secure storage from the content of a file.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the content is larger than LE_SECSTORE_MAX_BLOB_SIZE.
+ *      LE_NO_MEMORY if there is not enough memory to store the item.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_secStore_WriteFromFile
+(
+    const char* name,               ///< [IN] Name of the secure storage item.
+    int fd                          ///< [IN] File to read the item from.
+)
+{
+    return WriteFromFile(false, name, fd);
+}
+
+#if !MK_CONFIG_SECSTORE_DISABLE_GLOBAL_ACCESS
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes an item to secure storage from the content of a file.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the content is larger than LE_SECSTORE_MAX_BLOB_SIZE.
+ *      LE_NO_MEMORY if there is not enough memory to store the item.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t secStoreGlobal_WriteFromFile
+(
+    const char* name,               ///< [IN] Name of the secure storage item.
+    int fd                          ///< [IN] File to read the item from.
+)
+{
+    return WriteFromFile(true, name, fd);
+}
+
+#endif /* end !MK_CONFIG_SECSTORE_DISABLE_GLOBAL_ACCESS */
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads an item from secure storage into a file.  The file descriptor is closed.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the item is larger than LE_SECSTORE_MAX_BLOB_SIZE.
+ *      LE_NOT_FOUND if the item does not exist.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadToFile
+(
+    bool isGlobal,                  ///< [IN] Is this an operation is the global domain?
+    const char* name,               ///< [IN] Name of the secure storage item.
+    int fd                          ///< [IN] File to write the item to.
+)
+{
+    le_result_t result;
+    uint8_t*    bufPtr;
+    size_t      size = LE_SECSTORE_MAX_BLOB_SIZE;
+    size_t      written = 0;
+
+    if (fd < 0)
+    {
+        LE_KILL_CLIENT("Invalid file descriptor.");
+        return LE_FAULT;
+    }
+
+    bufPtr = GetBlobBuffer();
+
+    result = Read(isGlobal, name, bufPtr, &size);
+
+    while ((result == LE_OK) && (written < size))
+    {
+        ssize_t writeSize = le_fd_Write(fd, bufPtr + written, size - written);
+
+        if (writeSize > 0)
+        {
+            written += writeSize;
+        }
+        else if ((writeSize < 0) && (errno != EINTR))
+        {
+            LE_ERROR("Could not write the item content. %m.");
+            result = LE_FAULT;
+        }
+    }
+
+    le_fd_Close(fd);
+    ReleaseBlobBuffer(bufPtr, size);
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads an item from secure storage into a file.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the item is larger than LE_SECSTORE_MAX_BLOB_SIZE.
+ *      LE_NOT_FOUND if the item does not exist.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_secStore_ReadToFile
+(
+    const char* name,               ///< [IN] Name of the secure storage item.
+    int fd                          ///< [IN] File to write the item to.
+)
+{
+    return ReadToFile(false, name, fd);
+}
+
+#if !MK_CONFIG_SECSTORE_DISABLE_GLOBAL_ACCESS
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads an item from secure storage into a file.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the item is larger than LE_SECSTORE_MAX_BLOB_SIZE.
+ *      LE_NOT_FOUND if the item does not exist.
+ *      LE_UNAVAILABLE if the secure storage is currently unavailable.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t secStoreGlobal_ReadToFile
+(
+    const char* name,               ///< [IN] Name of the secure storage item.
+    int fd                          ///< [IN] File to write the item to.
+)
+{
+    return ReadToFile(true, name, fd);
+}
+
+#endif /* end !MK_CONFIG_SECSTORE_DISABLE_GLOBAL_ACCESS */
+
 #if !MK_CONFIG_SECSTORE_DISABLE_ADMIN
 
 //--------------------------------------------------------------------------------------------------
@@ -1538,6 +2030,7 @@ le_result_t secStoreAdmin_Write
     }
 
     // Write the item to the secure storage.
+    UncacheItems(path);
     return pa_secStore_Write(path, bufPtr, bufNumElements);
 }
 
@@ -1608,6 +2101,7 @@ le_result_t secStoreAdmin_CopyMetaTo
         ///< Destination path of meta file copy.
 )
 {
+    UncacheItems(path);
     return pa_secStore_CopyMetaTo(path);
 }
 
@@ -1642,6 +2136,7 @@ le_result_t secStoreAdmin_Delete
     }
 
     // Delete the item from the secure storage.
+    UncacheItems(path);
     return pa_secStore_Delete(path);
 }
 
@@ -1751,6 +2246,9 @@ static void SecStoreUpdate
     void
 )
 {
+    // The content of the secure storage may have changed under the item cache.
+    UncacheItems(NULL);
+
     // First rebuild meta hash in PA level.
     pa_secStore_ReInitSecStorage();
 
@@ -1854,6 +2352,14 @@ COMPONENT_INIT
     le_instStat_AddAppUninstallEventHandler(AppUninstallHandler, NULL);
 #endif /* end LE_CONFIG_SOTA */
 
+#if (LE_CONFIG_SECSTORE_CACHE_ENTRIES > 0) && LE_CONFIG_LINUX
+    // Keep the items in clear out of the swap.
+    if (mlock(ItemCache, sizeof(ItemCache)) != 0)
+    {
+        LE_WARN("Could not lock the item cache in memory. %m.");
+    }
+#endif
+
     // Try to kick a couple of times before each timeout.
     le_clk_Time_t watchdogInterval = { .sec = MS_WDOG_INTERVAL };
     le_wdogChain_Init(1);
@@ -0,0 +1,1030 @@
+/**
+ * @file sharedMemoryComm.c
+ *
+ * This file provides a Shared Memory implementation of the RPC Communication API (le_comm.h).
+ * It links two RPC Proxies running on the same device, such as co-located systems or a loopback
+ * test set-up, without going through the network stack.
+ *
+ * The link's only argument is a channel name.  The server side (built with SOCKET_SERVER defined,
+ * as for networkSocket) listens on an abstract Unix domain socket of that name.  For each client
+ * it accepts, it creates a shared memory region holding one single-producer, single-consumer byte
+ * ring per direction, plus one eventfd per direction, and passes them all to the client.  From
+ * then on, sent data is copied straight into the peer's ring and the eventfd is rung as a
+ * doorbell.  The Unix domain socket is only kept open to detect the peer going away.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+
+#include "legato.h"
+#include "interfaces.h"
+#include "le_comm.h"
+#include "unixSocket.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+
+#ifndef MFD_CLOEXEC
+#include <sys/syscall.h>
+
+#define MFD_CLOEXEC 0x0001U
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * memfd_create() for C libraries that predate it.
+ */
+//--------------------------------------------------------------------------------------------------
+static int memfd_create(const char* namePtr, unsigned int flags)
+{
+    return syscall(__NR_memfd_create, namePtr, flags);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of outstanding (pending) client connections
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHARED_MEMORY_MAX_CONNECT_REQUEST_BACKLOG    10
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of Handle records
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHARED_MEMORY_HANDLE_RECORD_MAX              10
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum channel name length, which is limited by the size of a Unix domain socket address less
+ * the leading null character of an abstract address and the "le_comm." prefix.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHARED_MEMORY_CHANNEL_NAME_STRLEN_MAX        90
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of each direction's ring, in bytes.  Must be a power of two.  A send that doesn't fit in
+ * the space left fails with LE_NO_MEMORY, like a send on a full non-blocking socket.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHARED_MEMORY_RING_SIZE                      (256 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Assumed cache line size.  The read and write indexes of a ring are kept on separate cache lines
+ * so that the two sides don't keep taking the line from each other.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHARED_MEMORY_CACHE_LINE_BYTES               64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File descriptors passed from the server to a client: the shared memory region, the doorbell
+ * of the server to client ring, and the doorbell of the client to server ring.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHARED_MEMORY_FD_REGION                      0
+#define SHARED_MEMORY_FD_TO_CLIENT                   1
+#define SHARED_MEMORY_FD_TO_SERVER                   2
+#define SHARED_MEMORY_FD_COUNT                       3
+
+static_assert((SHARED_MEMORY_RING_SIZE & (SHARED_MEMORY_RING_SIZE - 1)) == 0,
+              "Ring size must be a power of two");
+static_assert(SHARED_MEMORY_FD_COUNT <= UNIXSOCKET_MAX_FDS, "Too many fds to pass");
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Single-producer, single-consumer byte ring.  The indexes run freely and are masked when used,
+ * so the ring is empty when they are equal, and holds (writeIndex - readIndex) bytes otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t readIndex;     ///< Next byte to read; only written by the consumer
+    uint8_t readPad[SHARED_MEMORY_CACHE_LINE_BYTES - sizeof(uint32_t)];
+    uint32_t writeIndex;    ///< Next byte to write; only written by the producer
+    uint8_t writePad[SHARED_MEMORY_CACHE_LINE_BYTES - sizeof(uint32_t)];
+    uint8_t data[SHARED_MEMORY_RING_SIZE];
+}
+Ring_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Layout of the shared memory region of a connection.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    Ring_t toClient;        ///< Written by the server, read by the client
+    Ring_t toServer;        ///< Written by the client, read by the server
+}
+Region_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handle-Record Structure - Defines the data of a Shared Memory channel.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct HandleRecord
+{
+    int socketFd;                           ///< Listening socket, or connection socket
+    bool isListening;                       ///< Identifies if this is a listening server socket
+    struct HandleRecord* parentRecordPtr;   ///< Parent (listening) record [connections only]
+    le_fdMonitor_Ref_t socketMonitorRef;    ///< Monitors the socket for connections or hang-ups
+    Region_t* regionPtr;                    ///< Shared memory region, or NULL if not connected
+    Ring_t* sendRingPtr;                    ///< Ring written by this side
+    Ring_t* recvRingPtr;                    ///< Ring read by this side
+    int sendEventFd;                        ///< Doorbell rung after writing to sendRingPtr
+    int recvEventFd;                        ///< Doorbell rung by the peer on writing recvRingPtr
+    le_fdMonitor_Ref_t doorbellMonitorRef;  ///< Monitors recvEventFd
+    le_mutex_Ref_t sendMutexRef;            ///< Keeps the producer side single, across threads
+}
+HandleRecord_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This pool is used to allocate memory for the Handle record.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(HandleRecordPool,
+                          SHARED_MEMORY_HANDLE_RECORD_MAX,
+                          sizeof(HandleRecord_t));
+
+static le_mem_PoolRef_t HandleRecordPoolRef = NULL;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registered Asynchronous Receive Callback Handler function
+ */
+//--------------------------------------------------------------------------------------------------
+static le_comm_CallbackHandlerFunc_t AsyncReceiveHandlerFuncPtr = NULL;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registered Asynchronous Connection Callback Handler function
+ */
+//--------------------------------------------------------------------------------------------------
+static le_comm_CallbackHandlerFunc_t AsyncConnectionHandlerFuncPtr = NULL;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Abstract Unix domain socket address of the channel, and its length.
+ */
+//--------------------------------------------------------------------------------------------------
+static struct sockaddr_un ChannelAddress;
+static socklen_t ChannelAddressLen;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to initialize the RPC Communication implementation.
+ *
+ * @note If the initialization failed, it is a fatal error, the function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef RPC_PROXY_LOCAL_SERVICE
+__attribute__((constructor))
+#endif
+static void sharedMemoryInitialize(void)
+{
+    if (HandleRecordPoolRef == NULL)
+    {
+        // NOTE: Must be performed once.
+        HandleRecordPoolRef = le_mem_InitStaticPool(HandleRecordPool,
+                                                    SHARED_MEMORY_HANDLE_RECORD_MAX,
+                                                    sizeof(HandleRecord_t));
+    }
+
+    LE_INFO("RPC Shared Memory Init done");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to initialize the RPC Communication implementation.
+ *
+ * @note If the initialization failed, it is a fatal error, the function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to allocate and initialize a Handle record.
+ */
+//--------------------------------------------------------------------------------------------------
+static HandleRecord_t* NewHandleRecord
+(
+    int socketFd    ///< [IN] Socket file descriptor
+)
+{
+    HandleRecord_t* recordPtr = le_mem_AssertAlloc(HandleRecordPoolRef);
+
+    recordPtr->socketFd = socketFd;
+    recordPtr->isListening = false;
+    recordPtr->parentRecordPtr = NULL;
+    recordPtr->socketMonitorRef = NULL;
+    recordPtr->regionPtr = NULL;
+    recordPtr->sendRingPtr = NULL;
+    recordPtr->recvRingPtr = NULL;
+    recordPtr->sendEventFd = -1;
+    recordPtr->recvEventFd = -1;
+    recordPtr->doorbellMonitorRef = NULL;
+    recordPtr->sendMutexRef = le_mutex_CreateNonRecursive("sharedMemorySend");
+
+    return recordPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to release the shared memory channel of a Handle record, leaving its socket alone.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseChannel
+(
+    HandleRecord_t* recordPtr   ///< [IN] Handle record
+)
+{
+    if (recordPtr->doorbellMonitorRef != NULL)
+    {
+        le_fdMonitor_Delete(recordPtr->doorbellMonitorRef);
+        recordPtr->doorbellMonitorRef = NULL;
+    }
+
+    if (recordPtr->regionPtr != NULL)
+    {
+        munmap(recordPtr->regionPtr, sizeof(Region_t));
+        recordPtr->regionPtr = NULL;
+        recordPtr->sendRingPtr = NULL;
+        recordPtr->recvRingPtr = NULL;
+    }
+
+    if (recordPtr->sendEventFd >= 0)
+    {
+        close(recordPtr->sendEventFd);
+        recordPtr->sendEventFd = -1;
+    }
+
+    if (recordPtr->recvEventFd >= 0)
+    {
+        close(recordPtr->recvEventFd);
+        recordPtr->recvEventFd = -1;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to map a connection's shared memory region.
+ *
+ * @return
+ *      - Pointer to the region, if successful.
+ *      - NULL, otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static Region_t* MapRegion
+(
+    int regionFd    ///< [IN] Shared memory file descriptor
+)
+{
+    void* regionPtr = mmap(NULL, sizeof(Region_t), PROT_READ | PROT_WRITE, MAP_SHARED, regionFd, 0);
+    if (regionPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map shared memory region, errno [%d]", errno);
+        return NULL;
+    }
+
+    return regionPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callback function for a connection's socket.  Nothing but the hand-over of the channel is ever
+ * sent on it, so any event means that the peer has gone away.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HangUpHandler
+(
+    int fd,         ///< [IN] Socket file descriptor
+    short events    ///< [IN] Event bit-mask
+)
+{
+    LE_UNUSED(fd);
+
+    HandleRecord_t* recordPtr = le_fdMonitor_GetContextPtr();
+
+    // Notify the RPC Proxy
+    AsyncReceiveHandlerFuncPtr(recordPtr, (events & ~POLLIN) | POLLRDHUP);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callback function for a connection's doorbell.  Clears the doorbell, then lets the RPC Proxy
+ * read everything in the ring, including anything written after the doorbell was cleared.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DoorbellHandler
+(
+    int fd,         ///< [IN] Doorbell file descriptor
+    short events    ///< [IN] Event bit-mask
+)
+{
+    HandleRecord_t* recordPtr = le_fdMonitor_GetContextPtr();
+    uint64_t count;
+
+    if (events & POLLIN)
+    {
+        // Non-blocking, so this only fails if the doorbell was already clear.
+        if (read(fd, &count, sizeof(count)) < 0)
+        {
+            LE_DEBUG("Doorbell already clear, fd [%d], errno [%d]", fd, errno);
+        }
+    }
+
+    // Notify the RPC Proxy
+    AsyncReceiveHandlerFuncPtr(recordPtr, events);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callback function to accept connections on the server side, and pass them onto the RPC Proxy
+ */
+//--------------------------------------------------------------------------------------------------
+static void AcceptHandler
+(
+    int fd,         ///< [IN] Listening socket file descriptor
+    short events    ///< [IN] Event bit-mask
+)
+{
+    HandleRecord_t* parentRecordPtr = le_fdMonitor_GetContextPtr();
+
+    if (!(events & POLLIN))
+    {
+        LE_ERROR("Unexpected fd event(s): 0x%hX", events);
+        return;
+    }
+
+    int clientFd = accept4(fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (clientFd < 0)
+    {
+        LE_ERROR("Failed to accept client connection, errno [%d]", errno);
+        return;
+    }
+
+    HandleRecord_t* recordPtr = NewHandleRecord(clientFd);
+    recordPtr->parentRecordPtr = parentRecordPtr;
+
+    // Create the channel: a zero-filled region, which is a pair of empty rings, and the doorbells.
+    int fds[SHARED_MEMORY_FD_COUNT];
+
+    fds[SHARED_MEMORY_FD_REGION] = memfd_create("le_comm", MFD_CLOEXEC);
+    fds[SHARED_MEMORY_FD_TO_CLIENT] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    fds[SHARED_MEMORY_FD_TO_SERVER] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    recordPtr->sendEventFd = fds[SHARED_MEMORY_FD_TO_CLIENT];
+    recordPtr->recvEventFd = fds[SHARED_MEMORY_FD_TO_SERVER];
+
+    le_result_t result = LE_FAULT;
+
+    if ((fds[SHARED_MEMORY_FD_REGION] < 0) ||
+        (recordPtr->sendEventFd < 0) ||
+        (recordPtr->recvEventFd < 0))
+    {
+        LE_ERROR("Failed to create shared memory channel, errno [%d]", errno);
+    }
+    else if (ftruncate(fds[SHARED_MEMORY_FD_REGION], sizeof(Region_t)) != 0)
+    {
+        LE_ERROR("Failed to size shared memory region, errno [%d]", errno);
+    }
+    else if ((recordPtr->regionPtr = MapRegion(fds[SHARED_MEMORY_FD_REGION])) != NULL)
+    {
+        recordPtr->sendRingPtr = &recordPtr->regionPtr->toClient;
+        recordPtr->recvRingPtr = &recordPtr->regionPtr->toServer;
+
+        // Hand the channel over to the client.  The fds are duplicated into the client.
+        char hello = 'X';
+        result = unixSocket_SendMsgFds(clientFd, &hello, sizeof(hello), fds, SHARED_MEMORY_FD_COUNT);
+    }
+
+    // The mapping keeps the region alive.
+    if (fds[SHARED_MEMORY_FD_REGION] >= 0)
+    {
+        close(fds[SHARED_MEMORY_FD_REGION]);
+    }
+
+    if (result != LE_OK)
+    {
+        LE_ERROR("Unable to set up shared memory channel, fd [%d], result [%d]",
+                 clientFd,
+                 result);
+
+        CloseChannel(recordPtr);
+        close(clientFd);
+        le_mutex_Delete(recordPtr->sendMutexRef);
+        le_mem_Release(recordPtr);
+        return;
+    }
+
+    LE_INFO("Accepted Client connection, fd [%d]", clientFd);
+
+    if (AsyncConnectionHandlerFuncPtr != NULL)
+    {
+        // Notify the RPC Proxy of the Client connection
+        AsyncConnectionHandlerFuncPtr(recordPtr, events);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callback function to receive the channel from the server on the client side, and pass the
+ * connection onto the RPC Proxy
+ */
+//--------------------------------------------------------------------------------------------------
+static void HandOverHandler
+(
+    int fd,         ///< [IN] Connection socket file descriptor
+    short events    ///< [IN] Event bit-mask
+)
+{
+    HandleRecord_t* recordPtr = le_fdMonitor_GetContextPtr();
+    short connectionEvents = POLLOUT;
+
+    if (events & POLLIN)
+    {
+        char hello;
+        size_t helloSize = sizeof(hello);
+        int fds[SHARED_MEMORY_FD_COUNT];
+        size_t fdCount = SHARED_MEMORY_FD_COUNT;
+        struct stat regionStat;
+
+        le_result_t result = unixSocket_ReceiveMsgFds(fd, &hello, &helloSize, fds, &fdCount);
+
+        if (result == LE_WOULD_BLOCK)
+        {
+            return;
+        }
+
+        if ((result != LE_OK) || (fdCount != SHARED_MEMORY_FD_COUNT))
+        {
+            LE_ERROR("Failed to receive shared memory channel, result [%d], fds [%" PRIuS "]",
+                     result,
+                     fdCount);
+
+            for (size_t i = 0; i < fdCount; i++)
+            {
+                close(fds[i]);
+            }
+            connectionEvents = POLLERR;
+        }
+        else
+        {
+            recordPtr->sendEventFd = fds[SHARED_MEMORY_FD_TO_SERVER];
+            recordPtr->recvEventFd = fds[SHARED_MEMORY_FD_TO_CLIENT];
+
+            if ((fstat(fds[SHARED_MEMORY_FD_REGION], &regionStat) != 0) ||
+                (regionStat.st_size < (off_t)sizeof(Region_t)))
+            {
+                LE_ERROR("Shared memory region is too small");
+            }
+            else
+            {
+                recordPtr->regionPtr = MapRegion(fds[SHARED_MEMORY_FD_REGION]);
+            }
+
+            close(fds[SHARED_MEMORY_FD_REGION]);
+
+            if (recordPtr->regionPtr == NULL)
+            {
+                CloseChannel(recordPtr);
+                connectionEvents = POLLERR;
+            }
+            else
+            {
+                recordPtr->sendRingPtr = &recordPtr->regionPtr->toServer;
+                recordPtr->recvRingPtr = &recordPtr->regionPtr->toClient;
+            }
+        }
+    }
+    else
+    {
+        LE_INFO("Connection closed by the server, events [0x%hX]", events);
+        connectionEvents = POLLERR;
+    }
+
+    // The socket won't be needed for anything but hang-ups, which are monitored from when the
+    // receive handler is registered.
+    le_fdMonitor_Disable(recordPtr->socketMonitorRef, POLLIN);
+
+    LE_INFO("Notifying RPC Proxy channel is connected, fd [%d], events [0x%hX]",
+            recordPtr->socketFd,
+            connectionEvents);
+
+    // Set the parent record to ourself
+    recordPtr->parentRecordPtr = recordPtr;
+
+    if (AsyncConnectionHandlerFuncPtr != NULL)
+    {
+        // Notify the RPC Proxy of the connection
+        AsyncConnectionHandlerFuncPtr(recordPtr, connectionEvents);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to Parse Command Line Arguments
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ParseCommandLineArgs
+(
+    const int argc,
+    const char* argv[]
+)
+{
+    if (argc != 1)
+    {
+        LE_INFO("Invalid Command Line Argument, argc = [%d]", argc);
+        return LE_BAD_PARAMETER;
+    }
+
+    if ((argv[0][0] == '\0') ||
+        (strlen(argv[0]) > SHARED_MEMORY_CHANNEL_NAME_STRLEN_MAX))
+    {
+        LE_INFO("Invalid channel name [%s]", argv[0]);
+        return LE_BAD_PARAMETER;
+    }
+
+    // The address is abstract (starts with a null character), so nothing appears in, or has to be
+    // cleaned up from, the file system.
+    memset(&ChannelAddress, 0, sizeof(ChannelAddress));
+    ChannelAddress.sun_family = AF_UNIX;
+
+    int nameLen = snprintf(ChannelAddress.sun_path + 1,
+                           sizeof(ChannelAddress.sun_path) - 1,
+                           "le_comm.%s",
+                           argv[0]);
+
+    ChannelAddressLen = offsetof(struct sockaddr_un, sun_path) + 1 + nameLen;
+
+    LE_INFO("Setting Shared Memory channel [%s]", argv[0]);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Creating a RPC Shared Memory Communication Channel
+ *
+ * Return Code values:
+ *      - LE_OK if successfully,
+ *      - otherwise failure
+ *
+ * @return
+ *      Opaque handle to the Communication Channel.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void* le_comm_Create
+(
+    const int argc,         ///< [IN] Number of strings pointed to by argv.
+    const char *argv[],     ///< [IN] Pointer to an array of character strings.
+    le_result_t* resultPtr  ///< [OUT] Return Code
+)
+{
+    // Verify result pointer is valid
+    if (resultPtr == NULL)
+    {
+        LE_ERROR("resultPtr is NULL");
+        return NULL;
+    }
+
+    // Check if Communication Globals need initialization
+    sharedMemoryInitialize();
+
+    // Parse the Command Line arguments to extract the channel name
+    *resultPtr = ParseCommandLineArgs(argc, argv);
+    if (*resultPtr != LE_OK)
+    {
+        return NULL;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        LE_WARN("Failed to create AF_UNIX socket, errno [%d]", errno);
+        *resultPtr = LE_FAULT;
+        return NULL;
+    }
+
+#ifdef SOCKET_SERVER
+    if (bind(fd, (struct sockaddr*)&ChannelAddress, ChannelAddressLen) != 0)
+    {
+        LE_WARN("Failed to bind socket, fd [%d], errno [%d]", fd, errno);
+        close(fd);
+        *resultPtr = (errno == EADDRINUSE) ? LE_DUPLICATE : LE_FAULT;
+        return NULL;
+    }
+#endif
+
+    LE_INFO("Created AF_UNIX Socket, fd [%d]", fd);
+
+    return NewHandleRecord(fd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Registering a Callback Handler function to monitor events on the specific handle
+ *
+ * @return
+ *      - LE_OK if successfully.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_comm_RegisterHandleMonitor
+(
+    void* handle,
+    le_comm_CallbackHandlerFunc_t handlerFunc,
+    short events
+)
+{
+    char monitorName[32];
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+
+    if (!(events & POLLIN))
+    {
+        // Store the Asynchronous Connection callback function
+        AsyncConnectionHandlerFuncPtr = handlerFunc;
+        return LE_OK;
+    }
+
+    if (recordPtr->regionPtr == NULL)
+    {
+        LE_ERROR("Channel is not connected, fd [%d]", recordPtr->socketFd);
+        return LE_FAULT;
+    }
+
+    // Store the Asynchronous Receive callback function
+    AsyncReceiveHandlerFuncPtr = handlerFunc;
+
+    LE_INFO("Registering Asynchronous Receive callback on fd [%d]", recordPtr->socketFd);
+
+    if (recordPtr->socketMonitorRef != NULL)
+    {
+        // Delete the hand-over monitor
+        le_fdMonitor_Delete(recordPtr->socketMonitorRef);
+        recordPtr->socketMonitorRef = NULL;
+    }
+
+    snprintf(monitorName, sizeof(monitorName), "shmDoorbell-%d", recordPtr->socketFd);
+    recordPtr->doorbellMonitorRef = le_fdMonitor_Create(monitorName,
+                                                        recordPtr->recvEventFd,
+                                                        DoorbellHandler,
+                                                        POLLIN);
+    le_fdMonitor_SetContextPtr(recordPtr->doorbellMonitorRef, recordPtr);
+
+    snprintf(monitorName, sizeof(monitorName), "shmSocket-%d", recordPtr->socketFd);
+    recordPtr->socketMonitorRef = le_fdMonitor_Create(monitorName,
+                                                      recordPtr->socketFd,
+                                                      HangUpHandler,
+                                                      POLLRDHUP);
+    le_fdMonitor_SetContextPtr(recordPtr->socketMonitorRef, recordPtr);
+
+    // Anything the peer wrote before the doorbell was being monitored is picked up by it.
+    if (recordPtr->recvRingPtr->writeIndex != recordPtr->recvRingPtr->readIndex)
+    {
+        uint64_t one = 1;
+
+        if (write(recordPtr->recvEventFd, &one, sizeof(one)) < 0)
+        {
+            LE_WARN("Unable to ring doorbell, fd [%d], errno [%d]", recordPtr->recvEventFd, errno);
+        }
+    }
+
+    LE_INFO("Successfully registered handle_monitor callback, events [0x%x]", events);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Deleting RPC Shared Memory Communication Channel
+ *
+ * @return
+ *      - LE_OK if successfully.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_comm_Delete (void* handle)
+{
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+
+    LE_INFO("Deleting AF_UNIX socket, fd [%d]", recordPtr->socketFd);
+
+    if (recordPtr->socketMonitorRef != NULL)
+    {
+        le_fdMonitor_Delete(recordPtr->socketMonitorRef);
+        recordPtr->socketMonitorRef = NULL;
+    }
+
+    CloseChannel(recordPtr);
+
+    if (recordPtr->socketFd >= 0)
+    {
+        shutdown(recordPtr->socketFd, SHUT_RDWR);
+        close(recordPtr->socketFd);
+        recordPtr->socketFd = -1;
+    }
+
+    le_mutex_Delete(recordPtr->sendMutexRef);
+    le_mem_Release(recordPtr);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Connecting RPC Shared Memory Communication Channel
+ *
+ * @return
+ *      - LE_IN_PROGRESS if pending on asynchronous connection,
+ *      - LE_NOT_FOUND if the server isn't listening,
+ *      - otherwise failure
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_comm_Connect (void* handle)
+{
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+    char monitorName[32];
+
+    LE_INFO("Connecting AF_UNIX socket, fd [%d]", recordPtr->socketFd);
+
+#ifdef SOCKET_SERVER
+    // Flag as a listening socket
+    recordPtr->isListening = true;
+
+    if (listen(recordPtr->socketFd, SHARED_MEMORY_MAX_CONNECT_REQUEST_BACKLOG) != 0)
+    {
+        LE_WARN("Server socket listen() call failed with errno %d", errno);
+        return LE_FAULT;
+    }
+
+    snprintf(monitorName, sizeof(monitorName), "shmListen-%d", recordPtr->socketFd);
+    recordPtr->socketMonitorRef = le_fdMonitor_Create(monitorName,
+                                                      recordPtr->socketFd,
+                                                      AcceptHandler,
+                                                      POLLIN);
+#else
+    int result;
+
+    do
+    {
+        result = connect(recordPtr->socketFd,
+                         (struct sockaddr*)&ChannelAddress,
+                         ChannelAddressLen);
+    }
+    while ((result != 0) && (errno == EINTR));
+
+    if (result != 0)
+    {
+        switch (errno)
+        {
+            case EACCES:
+                return LE_NOT_PERMITTED;
+
+            case ECONNREFUSED:
+            case ENOENT:
+            case EAGAIN:
+                return LE_NOT_FOUND;
+
+            default:
+                LE_ERROR("Connect failed with errno %d", errno);
+                return LE_FAULT;
+        }
+    }
+
+    // The server hands the channel over as soon as it accepts the connection.
+    snprintf(monitorName, sizeof(monitorName), "shmConnect-%d", recordPtr->socketFd);
+    recordPtr->socketMonitorRef = le_fdMonitor_Create(monitorName,
+                                                      recordPtr->socketFd,
+                                                      HandOverHandler,
+                                                      POLLIN);
+#endif
+
+    le_fdMonitor_SetContextPtr(recordPtr->socketMonitorRef, recordPtr);
+
+    return LE_IN_PROGRESS;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Disconnecting RPC Shared Memory Communication Channel
+ *
+ * @return
+ *      - LE_OK if successfully.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_comm_Disconnect (void* handle)
+{
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+
+    if (recordPtr->socketMonitorRef != NULL)
+    {
+        le_fdMonitor_Delete(recordPtr->socketMonitorRef);
+        recordPtr->socketMonitorRef = NULL;
+    }
+
+    CloseChannel(recordPtr);
+
+    close(recordPtr->socketFd);
+    recordPtr->socketFd = -1;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Sending Data over RPC Shared Memory Communication Channel
+ *
+ * The data is either all written to the ring, or not at all, so the peer never sees part of a
+ * send.
+ *
+ * @return
+ *      - LE_OK if successfully.
+ *      - LE_NO_MEMORY if there isn't room in the ring right now.
+ *      - LE_COMM_ERROR if the channel isn't connected.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_comm_Send (void* handle, const void* buf, size_t len)
+{
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+    Ring_t* ringPtr = recordPtr->sendRingPtr;
+
+    if (ringPtr == NULL)
+    {
+        return LE_COMM_ERROR;
+    }
+
+    le_mutex_Lock(recordPtr->sendMutexRef);
+
+    uint32_t writeIndex = ringPtr->writeIndex;
+    uint32_t readIndex = __atomic_load_n(&ringPtr->readIndex, __ATOMIC_ACQUIRE);
+    uint32_t freeSize = SHARED_MEMORY_RING_SIZE - (writeIndex - readIndex);
+
+    if ((freeSize > SHARED_MEMORY_RING_SIZE) || (len > freeSize))
+    {
+        le_mutex_Unlock(recordPtr->sendMutexRef);
+        return (freeSize > SHARED_MEMORY_RING_SIZE) ? LE_FAULT : LE_NO_MEMORY;
+    }
+
+    // Copy in up to two pieces, if the data wraps around the end of the ring.
+    uint32_t offset = writeIndex & (SHARED_MEMORY_RING_SIZE - 1);
+    size_t firstSize = SHARED_MEMORY_RING_SIZE - offset;
+
+    if (firstSize > len)
+    {
+        firstSize = len;
+    }
+
+    memcpy(ringPtr->data + offset, buf, firstSize);
+    memcpy(ringPtr->data, (const uint8_t*)buf + firstSize, len - firstSize);
+
+    // Publish the data before ringing the doorbell.
+    __atomic_store_n(&ringPtr->writeIndex, writeIndex + len, __ATOMIC_RELEASE);
+
+    le_mutex_Unlock(recordPtr->sendMutexRef);
+
+    // Always ring: the peer may have just found the ring empty, after clearing its doorbell.  A
+    // full doorbell counter (EAGAIN) is already rung.
+    uint64_t one = 1;
+
+    if ((write(recordPtr->sendEventFd, &one, sizeof(one)) < 0) && (errno != EAGAIN))
+    {
+        LE_WARN("Unable to ring doorbell, fd [%d], errno [%d]", recordPtr->sendEventFd, errno);
+        return LE_COMM_ERROR;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for Receiving Data over RPC Shared Memory Communication Channel
+ *
+ * @return
+ *      - LE_OK if successfully.  *len is set to zero if there is nothing to receive.
+ *      - LE_CLOSED if the channel isn't connected.
+ *      - LE_FAULT if the ring has been corrupted.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_comm_Receive (void* handle, void* buf, size_t* len)
+{
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+    Ring_t* ringPtr = recordPtr->recvRingPtr;
+
+    if (ringPtr == NULL)
+    {
+        return LE_CLOSED;
+    }
+
+    uint32_t readIndex = ringPtr->readIndex;
+    uint32_t writeIndex = __atomic_load_n(&ringPtr->writeIndex, __ATOMIC_ACQUIRE);
+    uint32_t usedSize = writeIndex - readIndex;
+
+    if (usedSize > SHARED_MEMORY_RING_SIZE)
+    {
+        LE_ERROR("Corrupted ring, read index [%" PRIu32 "], write index [%" PRIu32 "]",
+                 readIndex,
+                 writeIndex);
+        return LE_FAULT;
+    }
+
+    size_t size = (*len < usedSize) ? *len : usedSize;
+
+    // Copy out up to two pieces, if the data wraps around the end of the ring.
+    uint32_t offset = readIndex & (SHARED_MEMORY_RING_SIZE - 1);
+    size_t firstSize = SHARED_MEMORY_RING_SIZE - offset;
+
+    if (firstSize > size)
+    {
+        firstSize = size;
+    }
+
+    memcpy(buf, ringPtr->data + offset, firstSize);
+    memcpy((uint8_t*)buf + firstSize, ringPtr->data, size - firstSize);
+
+    // Hand the space back to the producer only once the data has been copied out.
+    __atomic_store_n(&ringPtr->readIndex, readIndex + size, __ATOMIC_RELEASE);
+
+    *len = size;
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get Support Functions
+ */
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to retrieve an ID for the specified handle.
+ * NOTE:  For logging or display purposes only.
+ *
+ * @return
+ *      - Non-zero integer, if successful.
+ *      - Negative one (-1), otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED int le_comm_GetId
+(
+    void* handle
+)
+{
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+    if (recordPtr == NULL)
+    {
+        return -1;
+    }
+
+    return recordPtr->socketFd;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to retrieve the Parent Handle.
+ * NOTE:  For asynchronous connections only.
+ *
+ * @return
+ *      - Parent (Listening) handle, if successfully.
+ *      - NULL, otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void* le_comm_GetParentHandle
+(
+    void* handle
+)
+{
+    HandleRecord_t* recordPtr = (HandleRecord_t*) handle;
+    if (recordPtr == NULL)
+    {
+        return NULL;
+    }
+
+    return (recordPtr->parentRecordPtr);
+}
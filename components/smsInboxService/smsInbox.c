@@ -15,6 +15,11 @@
  * store the message identifier contained in the application mailbox. It is updated each time is new
  * SMS is received.
  *
+ * The message lists of the mailboxes, and the read and deletion states of the messages, are indexed
+ * in memory, so that browsing a mailbox or checking the state of a message doesn't need to decode
+ * the files. A message file is only rewritten when its state actually changes, and the files are
+ * written in compact form.
+ *
  *  Copyright (C) Sierra Wireless Inc.
  */
 // -------------------------------------------------------------------------------------------------
@@ -139,8 +144,7 @@ typedef uint32_t MessageId_t;
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
-    json_t* jsonObjPtr;
-    json_t* jsonArrayPtr;
+    MessageId_t msgId[MAX_MBOX_SIZE];   ///< Snapshot of the messages in the box
     uint32_t currentMessageIndex;
     uint32_t maxIndex;
 }
@@ -185,10 +189,29 @@ typedef struct
     char *    namePtr;                  ///< App name
     uint32_t inboxSize;                 ///< Max messages in the inbox
     uint32_t msgCount;                  ///< Number message
-
+    MessageId_t msgId[MAX_MBOX_SIZE];   ///< Messages in the inbox, oldest first
+    bool isIndexed;                     ///< msgId and msgCount are loaded from the config file
+    struct stat cfgStat;                ///< Config file status when msgId was loaded or saved
 }
 MboxCtx_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Message index entry.
+ *
+ * The read and deletion states of each message are kept in memory, one bit per message box (the
+ * bit index is the index of the box in Apps), so that browsing and checking a message box don't
+ * need to decode the message files.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    MessageId_t msgId;                  ///< Message identifier
+    uint32_t    unreadMask;             ///< Message boxes for which the message is unread
+    uint32_t    deletedMask;            ///< Message boxes which deleted the message
+}
+MsgIndex_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * message box session structure.
@@ -334,6 +357,22 @@ static le_mem_PoolRef_t SmsInboxHandlerPoolRef;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t ActivationRequestRefMap;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory Pool for the message index entries.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t MsgIndexPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Message index, giving the MsgIndex_t of a message from its identifier.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t MsgIndexMap;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Add a boolean value of a key in a Jason object
@@ -421,41 +460,6 @@ static le_result_t AddIntegerKeyInJsonObject
     }
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Add a string value of a key in a Jason object
- *
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t AddStringKeyInJsonObject
-(
-    json_t *jsonObjPtr, ///<[IN] json object
-    const char* key,    ///<[IN] Key to be added
-    char* string        ///<[IN] String to be added
-)
-{
-    json_t * jsonStrPtr = json_string(string);
-    int ret = -1;
-
-    if (jsonStrPtr)
-    {
-        ret = json_object_set_new(jsonObjPtr, key, jsonStrPtr);
-    }
-    else
-    {
-        LE_ERROR("Error during set of the key %s", key);
-    }
-
-    if (ret == 0)
-    {
-        return LE_OK;
-    }
-    else
-    {
-        return LE_FAULT;
-    }
-}
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Get the SMSInbox directory path length
@@ -671,7 +675,7 @@ static le_result_t ModifyMsgEntry
 
     if ( res == LE_OK )
     {
-        if (json_dump_file(jsonRootPtr, path, JSON_INDENT(1) | JSON_PRESERVE_ORDER) < 0)
+        if (json_dump_file(jsonRootPtr, path, JSON_COMPACT | JSON_PRESERVE_ORDER) < 0)
         {
             LE_ERROR("Json error");
             res = LE_FAULT;
@@ -801,174 +805,378 @@ static le_result_t ReadJsonObj
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Read Application's config file
+ * Get the bit of a message box in the masks of the message index
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t GetMsgListFromMbox
+static uint32_t GetMboxMask
 (
-    char* pathPtr,              ///<[IN] Application's config file path
-    json_t **jsonRootObjPtr,    ///<[OUT] json root object
-    json_t **jsonArrayPtr       ///<[OUT] messages in box list
+    const MboxCtx_t* appsPtr    ///<[IN] application config
 )
 {
-    json_error_t error;
-    *jsonRootObjPtr = json_load_file(pathPtr, 0, &error);
+    return ((uint32_t)1) << (appsPtr - Apps);
+}
 
-    if ( !(*jsonRootObjPtr) )
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the status of an application's config file
+ *
+ * The status is zeroed if the file doesn't exist.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetMboxCfgStat
+(
+    MboxCtx_t* appsPtr,         ///<[IN] application config
+    struct stat* statPtr        ///<[OUT] config file status
+)
+{
+    uint32_t pathLen = GetSMSInboxConfigPathLen(appsPtr->namePtr);
+    char path[pathLen];
+    GetSMSInboxConfigPath(appsPtr->namePtr, path, pathLen);
+
+    if (stat(path, statPtr) != 0)
     {
-        // File doesn't exist, create objects
-        *jsonRootObjPtr = json_object();
+        memset(statPtr, 0, sizeof(struct stat));
+    }
+}
 
-        if ( !(*jsonRootObjPtr) )
-        {
-            LE_ERROR("Json error");
-            return LE_FAULT;
-        }
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load the message list of a message box from the application's config file
+ *
+ * The list is only read if the config file changed since it was last loaded or saved.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LoadMboxIndex
+(
+    MboxCtx_t* appsPtr          ///<[IN] application config
+)
+{
+    struct stat cfgStat;
+
+    GetMboxCfgStat(appsPtr, &cfgStat);
+
+    if ( appsPtr->isIndexed &&
+         (cfgStat.st_ino == appsPtr->cfgStat.st_ino) &&
+         (cfgStat.st_size == appsPtr->cfgStat.st_size) &&
+         (cfgStat.st_mtim.tv_sec == appsPtr->cfgStat.st_mtim.tv_sec) &&
+         (cfgStat.st_mtim.tv_nsec == appsPtr->cfgStat.st_mtim.tv_nsec) )
+    {
+        return LE_OK;
     }
 
-    *jsonArrayPtr = json_object_get(*jsonRootObjPtr, JSON_MSGINBOX);
+    uint32_t pathLen = GetSMSInboxConfigPathLen(appsPtr->namePtr);
+    char path[pathLen];
+    GetSMSInboxConfigPath(appsPtr->namePtr, path, pathLen);
+    json_error_t error;
+
+    appsPtr->msgCount = 0;
 
-    if ( !(*jsonArrayPtr) )
+    // If the file doesn't exist, the message box is empty
+    json_t* jsonRootObjPtr = json_load_file(path, 0, &error);
+    json_t* jsonArrayPtr = json_object_get(jsonRootObjPtr, JSON_MSGINBOX);
+    size_t size = json_array_size(jsonArrayPtr);
+    size_t i;
+
+    LE_DEBUG("Load path %s, array Size %zu", path, size);
+
+    // Keep the most recent messages if the file lists too many
+    for (i = (size > MAX_MBOX_SIZE) ? (size - MAX_MBOX_SIZE) : 0; i < size; i++)
     {
-        // Array doesn't exist, create it
-        *jsonArrayPtr = json_array();
+        MessageId_t messageId = json_integer_value(json_array_get(jsonArrayPtr, i));
 
-        if (!(*jsonArrayPtr))
+        if (messageId)
         {
-            json_decref(*jsonRootObjPtr);
-            LE_ERROR("Json error");
-            return LE_FAULT;
+            appsPtr->msgId[appsPtr->msgCount++] = messageId;
         }
-
-        if ( json_object_set(*jsonRootObjPtr, JSON_MSGINBOX, *jsonArrayPtr) < 0 )
+        else
         {
-            json_decref(*jsonRootObjPtr);
             LE_ERROR("Json error");
-            return LE_FAULT;
         }
     }
 
+    if (jsonRootObjPtr)
+    {
+        json_decref(jsonRootObjPtr);
+    }
+
+    appsPtr->cfgStat = cfgStat;
+    appsPtr->isIndexed = true;
+
     return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Remove a message from the application's cfg file
+ * Save the message list of a message box in the application's config file
  *
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t DeleteMsgInAppCfg
+static le_result_t SaveMboxIndex
 (
-    char *appNamePtr,               ///<[IN] application name
-    MessageId_t deleteMessageId     ///<[IN] message to delete
+    MboxCtx_t* appsPtr          ///<[IN] application config
+)
+{
+    uint32_t pathLen = GetSMSInboxConfigPathLen(appsPtr->namePtr);
+    char path[pathLen];
+    GetSMSInboxConfigPath(appsPtr->namePtr, path, pathLen);
+    json_t* jsonRootObjPtr = json_object();
+    json_t* jsonArrayPtr = json_array();
+    le_result_t res = LE_OK;
+    uint32_t i;
+
+    if ( (!jsonRootObjPtr) || (!jsonArrayPtr) ||
+         (json_object_set(jsonRootObjPtr, JSON_MSGINBOX, jsonArrayPtr) < 0) )
+    {
+        LE_ERROR("Json error");
+        res = LE_FAULT;
+    }
+
+    for (i = 0; (res == LE_OK) && (i < appsPtr->msgCount); i++)
+    {
+        res = AddIntegerKeyInJsonObject(jsonArrayPtr, NULL, appsPtr->msgId[i]);
+    }
+
+    if ( (res == LE_OK) &&
+         (json_dump_file(jsonRootObjPtr, path, JSON_COMPACT | JSON_PRESERVE_ORDER) < 0) )
+    {
+        LE_ERROR("Json_dump_file error");
+        res = LE_FAULT;
+    }
+
+    if (jsonArrayPtr)
+    {
+        json_decref(jsonArrayPtr);
+    }
+
+    if (jsonRootObjPtr)
+    {
+        json_decref(jsonRootObjPtr);
+    }
+
+    // Don't read back what was just written
+    GetMboxCfgStat(appsPtr, &appsPtr->cfgStat);
+
+    return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the index entry of a message, reading the message file if the message isn't indexed yet
+ *
+ * @return
+ *      - Index entry of the message
+ *      - NULL if the message doesn't exist or can't be decoded
+ */
+//--------------------------------------------------------------------------------------------------
+static MsgIndex_t* GetMsgIndex
+(
+    MessageId_t messageId       ///<[IN] Message identifier
 )
 {
-    uint32_t pathLen = GetSMSInboxConfigPathLen(appNamePtr);
+    MsgIndex_t* msgIndexPtr = le_hashmap_Get(MsgIndexMap, &messageId);
+
+    if (msgIndexPtr)
+    {
+        return msgIndexPtr;
+    }
+
+    uint16_t pathLen = GetSMSInboxMessagePathLen();
     char path[pathLen];
     memset(path, 0, pathLen);
-    GetSMSInboxConfigPath(appNamePtr, path, pathLen);
-    json_t *jsonObjPtr;
-    json_t *jsonArrayPtr;
+    json_error_t error;
 
-    LE_DEBUG("DeleteMessageId %d, path %s",deleteMessageId, path);
+    GetSMSInboxMessagePath(messageId, path, pathLen);
+
+    json_t* jsonRootPtr = json_load_file(path, JSON_REJECT_DUPLICATES, &error);
 
-    if (GetMsgListFromMbox(path, &jsonObjPtr, &jsonArrayPtr) != LE_OK)
+    if ( jsonRootPtr == NULL )
     {
-       LE_ERROR("No message");
-       return LE_FAULT;
+        LE_DEBUG("Json decoder error %s, path %s", error.text, path);
+        return NULL;
     }
 
+    json_t* jsonUnreadPtr = json_object_get(jsonRootPtr, JSON_ISUNREAD);
+    json_t* jsonDeletedPtr = json_object_get(jsonRootPtr, JSON_ISDELETED);
     int i;
-    MessageId_t messageId;
 
-    for (i=0; i < json_array_size(jsonArrayPtr); i++)
-    {
-        json_t * jsonIntegerPtr = json_array_get(jsonArrayPtr, i);
+    msgIndexPtr = le_mem_ForceAlloc(MsgIndexPool);
+    msgIndexPtr->msgId = messageId;
+    msgIndexPtr->unreadMask = 0;
+    msgIndexPtr->deletedMask = 0;
 
-        if (jsonIntegerPtr)
+    for (i = 0; i < MAX_APPS; i++)
+    {
+        if ( Apps[i].namePtr && (strlen(Apps[i].namePtr) != 0) )
         {
-            messageId = json_integer_value(jsonIntegerPtr);
+            if (json_is_true(json_object_get(jsonUnreadPtr, Apps[i].namePtr)))
+            {
+                msgIndexPtr->unreadMask |= GetMboxMask(&Apps[i]);
+            }
 
-            if (messageId == deleteMessageId)
+            // A message box without a valid deletion state can't use the message
+            if (!json_is_false(json_object_get(jsonDeletedPtr, Apps[i].namePtr)))
             {
-                LE_DEBUG("Remove %d", (int) messageId);
-                json_array_remove(jsonArrayPtr, i);
+                msgIndexPtr->deletedMask |= GetMboxMask(&Apps[i]);
             }
         }
-        else
-        {
-            LE_ERROR("Json error");
-        }
     }
 
-    le_result_t res = LE_OK;
-    if ( json_dump_file(jsonObjPtr, path, JSON_INDENT(1) | JSON_PRESERVE_ORDER) < 0 )
-    {
-        res = LE_FAULT;
-        LE_ERROR("Json_dump_file error");
-    }
+    json_decref(jsonRootPtr);
 
-    json_decref(jsonObjPtr);
+    le_hashmap_Put(MsgIndexMap, &msgIndexPtr->msgId, msgIndexPtr);
 
-    return res;
+    return msgIndexPtr;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Check if a message belongs to a message box
+ * Remove a message from the message index
  *
  */
 //--------------------------------------------------------------------------------------------------
+static void RemoveMsgIndex
+(
+    MessageId_t messageId       ///<[IN] Message identifier
+)
+{
+    MsgIndex_t* msgIndexPtr = le_hashmap_Remove(MsgIndexMap, &messageId);
 
-static le_result_t CheckMessageIdInMbox
+    if (msgIndexPtr)
+    {
+        le_mem_Release(msgIndexPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Update the read or deletion state of a message for a message box
+ *
+ * The message file is only written if the state changes.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t UpdateMsgFlag
 (
-    char* mboxName,
-    MessageId_t messageId
+    MessageId_t messageId,      ///<[IN] Message identifier
+    MboxCtx_t* appsPtr,         ///<[IN] application config
+    char* flagKeyPtr,           ///<[IN] State to update (JSON_ISUNREAD or JSON_ISDELETED)
+    bool value                  ///<[IN] New value of the state
 )
 {
-    json_t *jsonRootObjPtr;
-    json_t *jsonArrayPtr;
-    uint32_t pathLen = GetSMSInboxConfigPathLen(mboxName);
-    char path[pathLen];
-    GetSMSInboxConfigPath(mboxName, path, pathLen);
+    MsgIndex_t* msgIndexPtr = GetMsgIndex(messageId);
 
-    if ( GetMsgListFromMbox(path, &jsonRootObjPtr, &jsonArrayPtr) != LE_OK )
+    if (NULL == msgIndexPtr)
     {
-        LE_ERROR("Error in GetMsgListFromMbox");
+        LE_ERROR("Message %08x not found", (int) messageId);
         return LE_FAULT;
     }
 
-    int i = 0;
+    uint32_t* maskPtr = (0 == strcmp(flagKeyPtr, JSON_ISUNREAD)) ? &msgIndexPtr->unreadMask :
+                                                                   &msgIndexPtr->deletedMask;
+    uint32_t mboxMask = GetMboxMask(appsPtr);
 
-    while (i < json_array_size(jsonArrayPtr))
+    if (((*maskPtr & mboxMask) != 0) == value)
     {
-        json_t * jsonIntegerPtr = json_array_get(jsonArrayPtr, i);
-        MessageId_t msgId = 0;
+        return LE_OK;
+    }
 
-        if (jsonIntegerPtr)
+    EntryDesc_t modif;
+    modif.type = DESC_BOOL;
+    modif.uVal.boolVal = value;
+    char* key[2] = {flagKeyPtr, appsPtr->namePtr};
+
+    if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    if (value)
+    {
+        *maskPtr |= mboxMask;
+    }
+    else
+    {
+        *maskPtr &= ~mboxMask;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a message from the application's cfg file
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t DeleteMsgInAppCfg
+(
+    MboxCtx_t* appsPtr,             ///<[IN] application config
+    MessageId_t deleteMessageId     ///<[IN] message to delete
+)
+{
+    LE_DEBUG("DeleteMessageId %d, mbox %s", deleteMessageId, appsPtr->namePtr);
+
+    if (LoadMboxIndex(appsPtr) != LE_OK)
+    {
+       LE_ERROR("No message");
+       return LE_FAULT;
+    }
+
+    uint32_t i;
+    uint32_t count = 0;
+
+    for (i = 0; i < appsPtr->msgCount; i++)
+    {
+        if (appsPtr->msgId[i] == deleteMessageId)
         {
-            msgId = json_integer_value(jsonIntegerPtr);
+            LE_DEBUG("Remove %d", (int) deleteMessageId);
         }
         else
         {
-            LE_ERROR("Json error");
-            json_decref(jsonRootObjPtr);
-            return LE_FAULT;
+            appsPtr->msgId[count++] = appsPtr->msgId[i];
         }
+    }
+
+    if (count == appsPtr->msgCount)
+    {
+        return LE_OK;
+    }
+
+    appsPtr->msgCount = count;
 
-        LE_DEBUG("MessageId %d, msgId %d, i %d", messageId, msgId, i);
-        if (msgId == messageId)
+    return SaveMboxIndex(appsPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a message belongs to a message box
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+
+static le_result_t CheckMessageIdInMbox
+(
+    MboxCtx_t* appsPtr,
+    MessageId_t messageId
+)
+{
+    if (LoadMboxIndex(appsPtr) != LE_OK)
+    {
+        LE_ERROR("Error in LoadMboxIndex");
+        return LE_FAULT;
+    }
+
+    uint32_t i;
+
+    for (i = 0; i < appsPtr->msgCount; i++)
+    {
+        if (appsPtr->msgId[i] == messageId)
         {
-            json_decref(jsonRootObjPtr);
             return LE_OK;
         }
-
-        i++;
     }
 
     LE_ERROR("Bad msg id or mbox name");
-    json_decref(jsonRootObjPtr);
     return LE_FAULT;
 }
 
@@ -980,7 +1188,7 @@ static le_result_t CheckMessageIdInMbox
 //--------------------------------------------------------------------------------------------------
 static le_result_t DecodeMsgEntry
 (
-    char* mboxName,                      ///<[IN] mbox name
+    MboxCtx_t* appsPtr,                  ///<[IN] mbox config
     MessageId_t messageId,               ///<[IN] Message identifier to decode
     char* keyPtr[],                      ///<[IN] Key to retrieve
     uint8_t nbKey,                       ///<[IN] Number of elements in keyPtr
@@ -999,8 +1207,8 @@ static le_result_t DecodeMsgEntry
 
     if ( jsonRootPtr == NULL )
     {
-        LE_ERROR("Json decoder error %s mboxName %s", error.text, mboxName);
-        DeleteMsgInAppCfg(mboxName, messageId);
+        LE_ERROR("Json decoder error %s mboxName %s", error.text, appsPtr->namePtr);
+        DeleteMsgInAppCfg(appsPtr, messageId);
         return LE_FAULT;
     }
 
@@ -1011,35 +1219,6 @@ static le_result_t DecodeMsgEntry
     return res;
 }
 
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Check if an application requested the deletion of a message
- *
- */
-//--------------------------------------------------------------------------------------------------
-static bool IsDeleted
-(
-    MessageId_t messageId,  ///<[IN] Message identifier
-    char* appNamePtr        ///<[IN] Application name
-)
-{
-    EntryDesc_t decode;
-    decode.type = DESC_BOOL;
-    char* key[2] = {JSON_ISDELETED, appNamePtr};
-
-    if (DecodeMsgEntry(appNamePtr, messageId, key, 2, &decode) == LE_OK)
-    {
-        LE_DEBUG("Decode.uVal.boolVal %d", decode.uVal.boolVal);
-        return decode.uVal.boolVal;
-    }
-    else
-    {
-        // if error, delete the message
-        return true;
-    }
-}
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Perform the deleteion
@@ -1051,14 +1230,16 @@ static void PerformDeletion
     MessageId_t messageId   ///<[IN] Message identifier
 )
 {
+    MsgIndex_t* msgIndexPtr = GetMsgIndex(messageId);
     int i;
     bool deleted = true;
 
-    for (i=0; i < MAX_APPS; i++)
+    // If the message can't be decoded, delete it
+    for (i=0; (msgIndexPtr != NULL) && (i < MAX_APPS); i++)
     {
         if ( Apps[i].namePtr && (strlen(Apps[i].namePtr) != 0) )
         {
-            deleted &= IsDeleted(messageId, Apps[i].namePtr);
+            deleted &= ((msgIndexPtr->deletedMask & GetMboxMask(&Apps[i])) != 0);
         }
     }
 
@@ -1073,6 +1254,8 @@ static void PerformDeletion
 
         LE_DEBUG("Delete messageId %d, path %s",messageId, path);
         unlink(path);
+
+        RemoveMsgIndex(messageId);
     }
 }
 
@@ -1088,88 +1271,44 @@ static le_result_t AddMsgInAppCfg
     MessageId_t messageId     ///<[IN] message to add
 )
 {
-    uint32_t pathLen = GetSMSInboxConfigPathLen(appsPtr->namePtr);
-    char path[pathLen];
-    GetSMSInboxConfigPath(appsPtr->namePtr, path, pathLen);
-    json_t* jsonMsgIdPtr = NULL;
-    json_t* jsonPtr;
-    json_t* jsonArrayPtr;
-
-    if ( GetMsgListFromMbox (path, &jsonPtr, &jsonArrayPtr) != LE_OK )
+    if ( LoadMboxIndex(appsPtr) != LE_OK )
     {
-        LE_ERROR("Message %s not found", path);
+        LE_ERROR("Message box %s not found", appsPtr->namePtr);
         return LE_FAULT;
     }
-    LE_DEBUG("Add messageId %d, path %s, array Size %zu", messageId,
-                                                          path,
-                                                          json_array_size(jsonArrayPtr) );
+    LE_DEBUG("Add messageId %d, mbox %s, array Size %d", messageId,
+                                                         appsPtr->namePtr,
+                                                         appsPtr->msgCount);
 
-    if ( json_array_size(jsonArrayPtr) == appsPtr->inboxSize )
+    // Delete the older entries to make room for the new one
+    while ( (appsPtr->msgCount > 0) &&
+            ((appsPtr->msgCount >= appsPtr->inboxSize) || (appsPtr->msgCount >= MAX_MBOX_SIZE)) )
     {
-        // delete older entry
-        jsonMsgIdPtr = json_array_get(jsonArrayPtr, 0);
-        MessageId_t messageId = 0;
-
-        if (jsonMsgIdPtr)
-        {
-            messageId = json_integer_value(jsonMsgIdPtr);
-        }
+        MessageId_t oldestMessageId = appsPtr->msgId[0];
 
-        if (messageId != 0)
-        {
-            json_array_remove(jsonArrayPtr, 0);
-
-            EntryDesc_t modif;
-            modif.type = DESC_BOOL;
-            modif.uVal.boolVal = true;
-            char* key[2]={JSON_ISDELETED, appsPtr->namePtr};
-
-            if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
-            {
-                LE_ERROR("Can't modify entry %08x, path %s", (int) messageId, path);
-            }
+        appsPtr->msgCount--;
+        memmove(&appsPtr->msgId[0], &appsPtr->msgId[1], appsPtr->msgCount * sizeof(MessageId_t));
 
-            PerformDeletion(messageId);
-        }
-        else
+        if (UpdateMsgFlag(oldestMessageId, appsPtr, JSON_ISDELETED, true) != LE_OK)
         {
-            json_decref(jsonPtr);
-            LE_ERROR("Json error");
-            return LE_FAULT;
+            LE_ERROR("Can't modify entry %08x, mbox %s", (int) oldestMessageId, appsPtr->namePtr);
         }
-    }
 
-    if (AddIntegerKeyInJsonObject(jsonArrayPtr, NULL, messageId) != LE_OK)
-    {
-        json_decref(jsonPtr);
-        LE_ERROR("Json error");
-        return LE_FAULT;
+        PerformDeletion(oldestMessageId);
     }
 
-    if ( json_dump_file(jsonPtr, path, JSON_INDENT(1) | JSON_PRESERVE_ORDER) < 0 )
-    {
-        json_decref(jsonPtr);
-        LE_ERROR("Json error");
-        return LE_FAULT;
-    }
-
-    json_decref(jsonPtr);
+    appsPtr->msgId[appsPtr->msgCount++] = messageId;
 
-    // Use for the first initialization
-    if (jsonArrayPtr->refcount > 0)
-    {
-        json_decref(jsonArrayPtr);
-    }
-
-    return LE_OK;
+    return SaveMboxIndex(appsPtr);
 }
 
 
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Encode Json file
  *
+ * The entry is streamed straight to the file rather than built up as a tree of json objects and
+ * then dumped.
  */
 //--------------------------------------------------------------------------------------------------
 static le_result_t EncodeMsgEntry
@@ -1178,45 +1317,47 @@ static le_result_t EncodeMsgEntry
     le_sms_MsgRef_t msgRef  ///<[IN] SMS to be encoding
 )
 {
-    json_t *jsonRootPtr = json_object();
+    char buffer[512];
+    le_json_Writer_t writer;
 
-    if (!jsonRootPtr)
-    {
-        LE_ERROR("Json error");
-        return LE_FAULT;
-    }
+    le_json_InitWriter(&writer, fd, buffer, sizeof(buffer));
+    le_json_StartObject(&writer);
 
     // Add imsi in json file
-    AddStringKeyInJsonObject(jsonRootPtr, JSON_IMSI, SimImsi);
+    le_json_WriteMember(&writer, JSON_IMSI);
+    le_json_WriteString(&writer, SimImsi);
 
     // Add sms format in json file
     le_sms_Format_t format = le_sms_GetFormat(msgRef);
-    AddIntegerKeyInJsonObject(jsonRootPtr, JSON_FORMAT, (int) format);
+    le_json_WriteMember(&writer, JSON_FORMAT);
+    le_json_WriteInt(&writer, (int) format);
 
     // Unread by default for all applications
-    json_t *jsonUnreadPtr = json_object();
+    le_json_WriteMember(&writer, JSON_ISUNREAD);
+    le_json_StartObject(&writer);
     int i;
     for (i=0; i < MAX_APPS; i++)
     {
         if ( Apps[i].namePtr && (strlen(Apps[i].namePtr) != 0) )
         {
-            AddBooleanKeyInJsonObject(jsonUnreadPtr, Apps[i].namePtr, true);
+            le_json_WriteMember(&writer, Apps[i].namePtr);
+            le_json_WriteBool(&writer, true);
         }
     }
-
-    json_object_set_new(jsonRootPtr, JSON_ISUNREAD, jsonUnreadPtr);
+    le_json_EndObject(&writer);
 
     // Undeleted by default for all applications
-    json_t *jsonDeletePtr = json_object();
+    le_json_WriteMember(&writer, JSON_ISDELETED);
+    le_json_StartObject(&writer);
     for (i=0; i < MAX_APPS; i++)
     {
         if ( Apps[i].namePtr && (strlen(Apps[i].namePtr) != 0) )
         {
-            AddBooleanKeyInJsonObject(jsonDeletePtr, Apps[i].namePtr, false);
+            le_json_WriteMember(&writer, Apps[i].namePtr);
+            le_json_WriteBool(&writer, false);
         }
     }
-
-    json_object_set_new(jsonRootPtr, JSON_ISDELETED, jsonDeletePtr);
+    le_json_EndObject(&writer);
 
     switch ( format )
     {
@@ -1236,7 +1377,8 @@ static le_result_t EncodeMsgEntry
             else
             {
                 LE_DEBUG("Tel num: %s", tel);
-                AddStringKeyInJsonObject(jsonRootPtr, JSON_SENDERTEL, tel);
+                le_json_WriteMember(&writer, JSON_SENDERTEL);
+                le_json_WriteString(&writer, tel);
             }
 
             // Add timestamp
@@ -1250,14 +1392,14 @@ static le_result_t EncodeMsgEntry
             else
             {
                 LE_DEBUG("Timestamp: %s", timeStamp);
-                AddStringKeyInJsonObject(jsonRootPtr, JSON_TIMESTAMP, timeStamp);
+                le_json_WriteMember(&writer, JSON_TIMESTAMP);
+                le_json_WriteString(&writer, timeStamp);
             }
 
-            size_t len = le_sms_GetUserdataLen(msgRef);
-            AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, len);
+            size_t msgLen = le_sms_GetUserdataLen(msgRef);
 
             // Add a character for last '\0'
-            len++;
+            size_t len = msgLen + 1;
 
             uint8_t bin[len];
             memset(bin, 0, len);
@@ -1279,29 +1421,34 @@ static le_result_t EncodeMsgEntry
                 jsonKey = JSON_BIN;
             }
 
+            // The payload is fetched before the length is written, so that a length of 0 can be
+            // written instead if it can't be fetched.
+            le_json_WriteMember(&writer, JSON_MSGLEN);
+
             if (result != LE_OK)
             {
                 LE_ERROR("Unable to get payload %d", result);
-                AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, 0);
+                le_json_WriteInt(&writer, 0);
             }
             else
             {
+                le_json_WriteUint(&writer, msgLen);
+
                 // Convert payload in string: json supports only utf-8 characters.
                 // Some extended-ASCII characters can be sent by SMS (such as character with accent)
                 // and can't be convert directly in utf-8. A convertion in string solves this issue.
                 strLen = le_hex_BinaryToString(bin, len, string, strLen);
-                AddStringKeyInJsonObject(jsonRootPtr, jsonKey, string);
-
+                le_json_WriteMember(&writer, jsonKey);
+                le_json_WriteString(&writer, string);
             }
         }
         break;
 
         case LE_SMS_FORMAT_PDU:
         {
-            size_t len = le_sms_GetPDULen(msgRef);
-            AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, len);
+            size_t pduLen = le_sms_GetPDULen(msgRef);
             // Add a character for last '\0'
-            len++;
+            size_t len = pduLen + 1;
             uint8_t pdu[len];
             memset(pdu, 0, len);
             int32_t strLen = 2*len + 1;
@@ -1311,16 +1458,21 @@ static le_result_t EncodeMsgEntry
             // Add pdu
             le_result_t result = le_sms_GetPDU(msgRef, pdu, &len);
 
+            le_json_WriteMember(&writer, JSON_MSGLEN);
+
             if (result != LE_OK)
             {
                 LE_ERROR("Unable to get pdu %d", result);
-                AddIntegerKeyInJsonObject(jsonRootPtr, JSON_MSGLEN, 0);
+                le_json_WriteInt(&writer, 0);
             }
             else
             {
+                le_json_WriteUint(&writer, pduLen);
+
                 // Convert pdu in string
                 strLen = le_hex_BinaryToString(pdu, len, string, strLen);
-                AddStringKeyInJsonObject(jsonRootPtr, JSON_PDU, string);
+                le_json_WriteMember(&writer, JSON_PDU);
+                le_json_WriteString(&writer, string);
                 LE_DEBUG("PDU format OK");
             }
         }
@@ -1330,32 +1482,14 @@ static le_result_t EncodeMsgEntry
             LE_ERROR("Bad format %d", format);
     }
 
-    // Write json file in the file system
-    char* jsondumpStr = json_dumps( (const json_t *) jsonRootPtr,
-                                    JSON_INDENT(1) | JSON_PRESERVE_ORDER);
-    if (!jsondumpStr)
-    {
-        LE_ERROR("JsondumpStr is NULL");
-        return LE_FAULT;
-    }
-
-    char* restJsondumpStr = jsondumpStr;
-    ssize_t writeSize = strlen(jsondumpStr);
-    ssize_t writtenSize;
+    le_json_EndObject(&writer);
 
-    do
+    // Write the rest of the json file in the file system
+    if (le_json_FinishWriter(&writer) != LE_OK)
     {
-        writtenSize = write( fd, restJsondumpStr, writeSize );
-        if (writtenSize > 0)
-        {
-            writeSize -= writtenSize;
-            restJsondumpStr += writtenSize;
-        }
+        LE_ERROR("Unable to write json file");
+        return LE_FAULT;
     }
-    while ((writeSize > 0) && ((writtenSize >= 0) || (EINTR == errno)));
-
-    free(jsondumpStr);
-    json_decref(jsonRootPtr);
 
     return LE_OK;
 }
@@ -1389,6 +1523,9 @@ static le_result_t CreateMsgEntry
 
     LE_DEBUG("New entry: %s", path);
 
+    // Forget anything indexed under this identifier before
+    RemoveMsgIndex(NextMessageId);
+
     int i;
 
     // For all the applications
@@ -1817,6 +1954,11 @@ COMPONENT_INIT
     SmsInboxHandlerPoolRef = le_mem_CreatePool("SmsInboxHandlerPoolRef", sizeof(ClientRequest_t));
     le_mem_ExpandPool(SmsInboxHandlerPoolRef, MAX_APPS);
 
+    // Create the message index
+    MsgIndexPool = le_mem_CreatePool("MsgIndexPool", sizeof(MsgIndex_t));
+    MsgIndexMap = le_hashmap_Create("MsgIndexMap", MAX_MBOX_SIZE,
+                                    le_hashmap_HashUInt32, le_hashmap_EqualsUInt32);
+
     // Retrieve the smsInbox settings from the configuration tree
     LoadInboxSettings();
 
@@ -2040,25 +2182,21 @@ void SmsInbox_DeleteMsg
         return;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return;
     }
 
     MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t modif;
-    modif.type = DESC_BOOL;
-    modif.uVal.boolVal = true;
-    char* key[2]={JSON_ISDELETED, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
 
-    if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
+    if (UpdateMsgFlag(messageId, clientRequestPtr->mboxSessionPtr->mboxCtxPtr, JSON_ISDELETED, true)
+        != LE_OK)
     {
-        LE_ERROR("ModifyMsgEntry error");
+        LE_ERROR("UpdateMsgFlag error");
     }
 
-    if (DeleteMsgInAppCfg(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId)
-                          != LE_OK)
+    if (DeleteMsgInAppCfg(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, messageId) != LE_OK)
     {
         LE_ERROR("DeleteMsgInAppCfg error");
     }
@@ -2111,7 +2249,7 @@ le_result_t SmsInbox_GetImsi
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
@@ -2133,7 +2271,7 @@ le_result_t SmsInbox_GetImsi
     decode.uVal.str.lenStr = imsiNumElements;
     char* key[1] = {JSON_IMSI};
 
-    if ((res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr,
+    if ((res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr,
                               messageId, key, 1, &decode)) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
@@ -2178,7 +2316,7 @@ le_sms_Format_t SmsInbox_GetFormat
         return 0;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return 0;
@@ -2189,7 +2327,7 @@ le_sms_Format_t SmsInbox_GetFormat
     decode.type = DESC_INT;
     char* key[1] = {JSON_FORMAT};
 
-    if (DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 1,
+    if (DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, messageId, key, 1,
                       &decode) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
@@ -2243,7 +2381,7 @@ le_result_t SmsInbox_GetSenderTel
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
@@ -2258,7 +2396,7 @@ le_result_t SmsInbox_GetSenderTel
     memset(telPtr, 0, telNumElements);
     char* key[1] = {JSON_SENDERTEL};
 
-    if ((res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key,
+    if ((res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, messageId, key,
                               1, &decode)) == LE_OK)
     {
         SmsInbox_MarkRead(sessionRef, msgId);
@@ -2313,7 +2451,7 @@ le_result_t SmsInbox_GetTimeStamp
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
@@ -2328,7 +2466,7 @@ le_result_t SmsInbox_GetTimeStamp
     char* key[1] = {JSON_TIMESTAMP};
     le_result_t res;
 
-    if ( (res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId,
+    if ( (res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, messageId,
                                key, 1, &decode)) == LE_OK )
     {
         SmsInbox_MarkRead(sessionRef, msgId);
@@ -2370,7 +2508,7 @@ size_t SmsInbox_GetMsgLen
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
@@ -2383,7 +2521,7 @@ size_t SmsInbox_GetMsgLen
     char* key[1] = {JSON_MSGLEN};
     le_result_t res;
 
-    if ( (res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr,
+    if ( (res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr,
                                 messageId,
                                 key,
                                 1,
@@ -2442,7 +2580,7 @@ le_result_t SmsInbox_GetText
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
@@ -2461,7 +2599,7 @@ le_result_t SmsInbox_GetText
     decode.uVal.str.lenStr = len;
     char* key[1] = {JSON_TEXT};
 
-    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 1,
+    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, messageId, key, 1,
                          &decode);
 
     if ( res == LE_OK )
@@ -2529,7 +2667,7 @@ le_result_t SmsInbox_GetBinary
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
@@ -2548,7 +2686,7 @@ le_result_t SmsInbox_GetBinary
     decode.uVal.str.lenStr = len;
     char* key[1] = {JSON_BIN};
 
-    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId,
+    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, messageId,
                          key, 1, &decode);
 
     if ( res == LE_OK )
@@ -2624,7 +2762,7 @@ le_result_t SmsInbox_GetPdu
         return 0;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return 0;
@@ -2643,7 +2781,7 @@ le_result_t SmsInbox_GetPdu
     decode.uVal.str.lenStr = len;
     char* key[1] = {JSON_PDU};
 
-    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 1,
+    res = DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, messageId, key, 1,
                          &decode);
 
     if ( res == LE_OK )
@@ -2698,75 +2836,32 @@ uint32_t SmsInbox_GetFirst
         return 0;
     }
 
-    uint32_t pathLen = GetSMSInboxConfigPathLen(clientRequestPtr->
-                                                mboxSessionPtr->mboxCtxPtr->namePtr);
-    char path[pathLen];
-    memset(path, 0, pathLen);
-    GetSMSInboxConfigPath(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, path, pathLen);
-    le_result_t res = LE_OK;
-    MessageId_t messageId=0;
+    MboxCtx_t* mboxCtxPtr = clientRequestPtr->mboxSessionPtr->mboxCtxPtr;
+    BrowseCtx_t* browseCtxPtr = &clientRequestPtr->mboxSessionPtr->browseCtx;
 
-    if ( GetMsgListFromMbox(path,
-                        &clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr,
-                        &clientRequestPtr->mboxSessionPtr->browseCtx.jsonArrayPtr) != LE_OK )
+    memset(browseCtxPtr, 0, sizeof(BrowseCtx_t));
+
+    if ( LoadMboxIndex(mboxCtxPtr) != LE_OK )
     {
-        LE_ERROR("Error in GetMsgListFromMbox");
+        LE_ERROR("Error in LoadMboxIndex");
         return 0;
     }
 
-    clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex =
-                      json_array_size(clientRequestPtr->mboxSessionPtr->browseCtx.jsonArrayPtr);
-
-    LE_DEBUG("MaxIndex %d", clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex);
-
-    if ( clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex > 0 )
-    {
-        json_t * jsonIntegerPtr =
-                 json_array_get(clientRequestPtr->mboxSessionPtr->browseCtx.jsonArrayPtr, 0);
+    // Browse a copy of the message list, which may change before the end of the browsing
+    memcpy(browseCtxPtr->msgId, mboxCtxPtr->msgId, mboxCtxPtr->msgCount * sizeof(MessageId_t));
+    browseCtxPtr->maxIndex = mboxCtxPtr->msgCount;
 
-        if (jsonIntegerPtr)
-        {
-            messageId = json_integer_value(jsonIntegerPtr);
-        }
-        else
-        {
-            LE_ERROR("Json error");
-            res = LE_FAULT;
-        }
+    LE_DEBUG("MaxIndex %d", browseCtxPtr->maxIndex);
 
-        if (messageId)
-        {
-            clientRequestPtr->mboxSessionPtr->browseCtx.currentMessageIndex = 1;
-        }
-        else
-        {
-            LE_ERROR("Json error");
-            res = LE_FAULT;
-        }
-    }
-    else
+    if ( browseCtxPtr->maxIndex == 0 )
     {
-        res = LE_FAULT;
         LE_DEBUG("Empty mbox");
-    }
-
-    if (res == LE_FAULT)
-    {
-        if (clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr)
-        {
-            json_decref(clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr);
-        }
-
-        memset(&clientRequestPtr->mboxSessionPtr->browseCtx, 0, sizeof(BrowseCtx_t));
-
         return 0;
     }
-    else
-    {
-        return messageId;
-    }
 
-    return 0;
+    browseCtxPtr->currentMessageIndex = 1;
+
+    return browseCtxPtr->msgId[0];
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -2794,58 +2889,31 @@ uint32_t SmsInbox_GetNext
         return LE_BAD_PARAMETER;
     }
 
-    while(clientRequestPtr->mboxSessionPtr->browseCtx.maxIndex !=
-          clientRequestPtr->mboxSessionPtr->browseCtx.currentMessageIndex)
-    {
-        LE_DEBUG("CurrentIndex %d, maxIndex %d", clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.currentMessageIndex,
-                                                 clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.maxIndex);
-
-        json_t * jsonIntegerPtr = json_array_get(clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.jsonArrayPtr,
-                                                 clientRequestPtr->
-                                                 mboxSessionPtr->browseCtx.currentMessageIndex);
-
-        if (jsonIntegerPtr)
-        {
-            MessageId_t messageId = json_integer_value(jsonIntegerPtr);
+    BrowseCtx_t* browseCtxPtr = &clientRequestPtr->mboxSessionPtr->browseCtx;
+    uint32_t mboxMask = GetMboxMask(clientRequestPtr->mboxSessionPtr->mboxCtxPtr);
 
-            if (messageId > 0)
-            {
-                clientRequestPtr->mboxSessionPtr->browseCtx.currentMessageIndex++;
+    while (browseCtxPtr->currentMessageIndex < browseCtxPtr->maxIndex)
+    {
+        LE_DEBUG("CurrentIndex %d, maxIndex %d", browseCtxPtr->currentMessageIndex,
+                                                 browseCtxPtr->maxIndex);
 
-                // Check if the message exist (it may be deleted since the GetFirst call)
-                uint16_t pathLen = GetSMSInboxMessagePathLen();
-                char path[pathLen];
-                memset(path, 0, pathLen);
-                GetSMSInboxMessagePath(messageId, path, pathLen);
-                int32_t fd = open(path, O_RDWR);
+        MessageId_t messageId = browseCtxPtr->msgId[browseCtxPtr->currentMessageIndex];
+        browseCtxPtr->currentMessageIndex++;
 
-                if (fd >= 0)
-                {
-                    // message is still existing
-                    close(fd);
-                    return messageId;
-                }
+        // Check if the message exist (it may be deleted since the GetFirst call)
+        MsgIndex_t* msgIndexPtr = GetMsgIndex(messageId);
 
-                // else continue the parsing
-            }
-            else
-            {
-                LE_ERROR("Json error");
-            }
-        }
-        else
+        if ( msgIndexPtr && ((msgIndexPtr->deletedMask & mboxMask) == 0) )
         {
-            LE_ERROR("Json error");
+            return messageId;
         }
+
+        // else continue the parsing
     }
 
-    // Parsing end => free the memory
+    // Parsing end
     LE_DEBUG("No more messages");
-    json_decref(clientRequestPtr->mboxSessionPtr->browseCtx.jsonObjPtr);
-    memset(&clientRequestPtr->mboxSessionPtr->browseCtx, 0, sizeof(BrowseCtx_t));
+    memset(browseCtxPtr, 0, sizeof(BrowseCtx_t));
 
     return 0;
 }
@@ -2886,25 +2954,22 @@ bool SmsInbox_IsUnread
         return LE_BAD_PARAMETER;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return LE_BAD_PARAMETER;
     }
 
-    MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t decode;
-    decode.type = DESC_BOOL;
-    char* key[] = {JSON_ISUNREAD, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
+    MsgIndex_t* msgIndexPtr = GetMsgIndex((MessageId_t) msgId);
 
-    if (DecodeMsgEntry(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, messageId, key, 2,
-                       &decode) == LE_OK)
+    if (msgIndexPtr)
     {
-        return decode.uVal.boolVal;
+        return ((msgIndexPtr->unreadMask &
+                 GetMboxMask(clientRequestPtr->mboxSessionPtr->mboxCtxPtr)) != 0);
     }
     else
     {
-        LE_ERROR("Error in DecodeMsgEntry");
+        LE_ERROR("Error in GetMsgIndex");
         return false;
     }
 }
@@ -2941,21 +3006,18 @@ void SmsInbox_MarkRead
         return;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return;
     }
 
     MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t modif;
-    modif.type = DESC_BOOL;
-    modif.uVal.boolVal = false;
-    char* key[2]={JSON_ISUNREAD, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
 
-    if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
+    if (UpdateMsgFlag(messageId, clientRequestPtr->mboxSessionPtr->mboxCtxPtr, JSON_ISUNREAD, false)
+        != LE_OK)
     {
-        LE_ERROR("Error in ModifyMsgEntry");
+        LE_ERROR("Error in UpdateMsgFlag");
     }
 }
 
@@ -2991,21 +3053,18 @@ void SmsInbox_MarkUnread
         return;
     }
 
-    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr, msgId) != LE_OK)
+    if (CheckMessageIdInMbox(clientRequestPtr->mboxSessionPtr->mboxCtxPtr, msgId) != LE_OK)
     {
         LE_ERROR("Message not included into the mbox");
         return;
     }
 
     MessageId_t messageId = (MessageId_t) msgId;
-    EntryDesc_t modif;
-    modif.type = DESC_BOOL;
-    modif.uVal.boolVal = true;
-    char* key[2]={JSON_ISUNREAD, clientRequestPtr->mboxSessionPtr->mboxCtxPtr->namePtr};
 
-    if (ModifyMsgEntry(messageId, key, 2, &modif) != LE_OK)
+    if (UpdateMsgFlag(messageId, clientRequestPtr->mboxSessionPtr->mboxCtxPtr, JSON_ISUNREAD, true)
+        != LE_OK)
     {
-        LE_ERROR("Error in ModifyMsgEntry");
+        LE_ERROR("Error in UpdateMsgFlag");
     }
 }
 
@@ -20,6 +20,13 @@
 //--------------------------------------------------------------------------------------------------
 #define ADDR_MAX_LEN    46
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the buffer used to gather small buffers into a single write to a secure socket
+ */
+//--------------------------------------------------------------------------------------------------
+#define SECURE_GATHER_BUFFER_LEN    512
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Socket context
@@ -34,6 +41,7 @@ typedef struct
     char               srcAddr[ADDR_MAX_LEN];  ///< Source IP address
     SocketType_t       type;                   ///< Socket type (TCP, UDP)
     uint32_t           timeout;                ///< Communication timeout in milliseconds
+    uint32_t           connectTime;            ///< Duration of the last connection in milliseconds
     bool               isSecure;               ///< True if the socket uses a certificate
     bool               isMonitoring;           ///< True if the socket is being monitored
     le_fdMonitor_Ref_t monitorRef;             ///< Reference to the monitor object
@@ -273,6 +281,123 @@ static void ReadMoreAsyncData
     SocketEventsHandler(contextPtr->fd, contextPtr->events);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write several buffers to a secure socket.  Buffers smaller than the gather buffer are copied
+ * together, so that small buffers are not each sent in their own TLS record.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SecureWriteVector
+(
+    SocketCtx_t*        contextPtr,  ///< [IN] Socket context pointer
+    const struct iovec* iovPtr,      ///< [IN] Buffers to be sent
+    int                 iovCount     ///< [IN] Number of buffers
+)
+{
+    char        buffer[SECURE_GATHER_BUFFER_LEN];
+    size_t      used = 0;
+    le_result_t status;
+    int         i;
+
+    for (i = 0; i < iovCount; i++)
+    {
+        if (iovPtr[i].iov_len > sizeof(buffer) - used)
+        {
+            if (used)
+            {
+                status = secSocket_Write(contextPtr->secureCtxPtr, buffer, used);
+                if (LE_OK != status)
+                {
+                    return status;
+                }
+                used = 0;
+            }
+
+            if (iovPtr[i].iov_len > sizeof(buffer))
+            {
+                status = secSocket_Write(contextPtr->secureCtxPtr, iovPtr[i].iov_base,
+                                         iovPtr[i].iov_len);
+                if (LE_OK != status)
+                {
+                    return status;
+                }
+                continue;
+            }
+        }
+
+        memcpy(buffer + used, iovPtr[i].iov_base, iovPtr[i].iov_len);
+        used += iovPtr[i].iov_len;
+    }
+
+    if (used)
+    {
+        return secSocket_Write(contextPtr->secureCtxPtr, buffer, used);
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read from a secure socket into several buffers.  After the first read, which can block up to
+ * the socket timeout, reading goes on as long as decrypted data is available.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SecureReadVector
+(
+    SocketCtx_t*        contextPtr,  ///< [IN] Socket context pointer
+    const struct iovec* iovPtr,      ///< [IN] Read buffers
+    int                 iovCount,    ///< [IN] Number of buffers
+    size_t*             lenPtr       ///< [OUT] Data size read
+)
+{
+    size_t      offset = 0;
+    size_t      length;
+    le_result_t status;
+    int         i = 0;
+
+    *lenPtr = 0;
+    while (i < iovCount)
+    {
+        length = iovPtr[i].iov_len - offset;
+        if (0 == length)
+        {
+            i++;
+            offset = 0;
+            continue;
+        }
+
+        status = secSocket_Read(contextPtr->secureCtxPtr, (char*)iovPtr[i].iov_base + offset,
+                                &length, contextPtr->timeout);
+        if (LE_OK != status)
+        {
+            // Report the data already read, the error will be raised again on next read
+            return (*lenPtr) ? LE_OK : status;
+        }
+
+        *lenPtr += length;
+        offset += length;
+
+        if ((0 == length) || (!secSocket_IsDataAvailable(contextPtr->secureCtxPtr)))
+        {
+            break;
+        }
+    }
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -338,6 +463,7 @@ le_socket_Ref_t le_socket_Create
     contextPtr->type    = type;
     contextPtr->fd      = -1;
     contextPtr->timeout = COMM_TIMEOUT_DEFAULT_MS;
+    contextPtr->connectTime = 0;
     contextPtr->isMonitoring = false;
 
     return contextPtr->reference;
@@ -462,6 +588,8 @@ le_result_t le_socket_Connect
 )
 {
     le_result_t status;
+    le_clk_Time_t startTime;
+    le_clk_Time_t duration;
     SocketCtx_t *contextPtr = (SocketCtx_t *)le_ref_Lookup(SocketRefMap, ref);
     if (contextPtr == NULL)
     {
@@ -469,6 +597,7 @@ le_result_t le_socket_Connect
         return LE_BAD_PARAMETER;
     }
 
+    startTime = le_clk_GetRelativeTime();
     if (contextPtr->isSecure)
     {
         status = secSocket_Connect(contextPtr->secureCtxPtr, contextPtr->host,
@@ -496,6 +625,12 @@ le_result_t le_socket_Connect
     {
         LE_ERROR("Unable to connect");
     }
+    else
+    {
+        duration = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+        contextPtr->connectTime = (uint32_t)(duration.sec * 1000 + duration.usec / 1000);
+        LE_DEBUG("Connected in %" PRIu32 " ms", contextPtr->connectTime);
+    }
 
     return status;
 }
@@ -668,6 +803,141 @@ le_result_t le_socket_Read
     return status;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the data of several buffers through the socket, as if they were a single buffer.  This
+ * avoids copying a protocol header and its payload together, or sending them separately.
+ *
+ * @note For a secure socket, small buffers are gathered so that they are sent in one TLS record.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_socket_SendVector
+(
+    le_socket_Ref_t      ref,        ///< [IN] Socket context reference
+    const struct iovec*  iovPtr,     ///< [IN] Buffers to be sent
+    int                  iovCount    ///< [IN] Number of buffers
+)
+{
+    le_result_t status;
+    SocketCtx_t *contextPtr = (SocketCtx_t *)le_ref_Lookup(SocketRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    if ((!iovPtr) || (iovCount < 0))
+    {
+        LE_ERROR("Wrong parameter: %p, %d", iovPtr, iovCount);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (contextPtr->fd == -1)
+    {
+        LE_ERROR("Socket not connected");
+        return LE_FAULT;
+    }
+
+    if (contextPtr->isMonitoring)
+    {
+        // Enable POLLOUT event just before sending data. Thus, when writing is possible again,
+        // an event is raised.
+        le_fdMonitor_Enable(contextPtr->monitorRef, POLLOUT);
+    }
+
+    if (contextPtr->isSecure)
+    {
+        status = SecureWriteVector(contextPtr, iovPtr, iovCount);
+    }
+    else
+    {
+        status = netSocket_WriteVector(contextPtr->fd, iovPtr, iovCount);
+    }
+
+    return status;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read data from the socket into several buffers, filled one after the other, in a blocking way
+ * until data is received or defined timeout value is reached.
+ *
+ * @note All the data already received is read, up to the size of the buffers: for a secure socket,
+ *       the data of several TLS records can be read at once.  When called from the socket event
+ *       handler, this spares the additional events needed to read the data with le_socket_Read().
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_FAULT         Internal error
+ *  - LE_WOULD_BLOCK   Would have blocked if non-blocking behaviour was not requested
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_socket_ReadVector
+(
+    le_socket_Ref_t      ref,        ///< [IN] Socket context reference
+    const struct iovec*  iovPtr,     ///< [IN] Read buffers
+    int                  iovCount,   ///< [IN] Number of buffers
+    size_t*              lenPtr      ///< [OUT] Data size read
+)
+{
+    le_result_t status;
+    SocketCtx_t *contextPtr = (SocketCtx_t *)le_ref_Lookup(SocketRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    if ((!iovPtr) || (iovCount < 0) || (!lenPtr))
+    {
+        LE_ERROR("Wrong parameter: %p, %d, %p", iovPtr, iovCount, lenPtr);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (contextPtr->fd == -1)
+    {
+        LE_ERROR("Socket not connected");
+        return LE_FAULT;
+    }
+
+    // Disable FD Monitor if it exists to avoid two different threads selecting the
+    // same file descriptor
+    if (contextPtr->monitorRef)
+    {
+        le_fdMonitor_Disable(contextPtr->monitorRef, POLLIN);
+    }
+
+    if (contextPtr->isSecure)
+    {
+        status = SecureReadVector(contextPtr, iovPtr, iovCount, lenPtr);
+    }
+    else
+    {
+        status = netSocket_ReadVector(contextPtr->fd, iovPtr, iovCount, lenPtr,
+                                      contextPtr->timeout);
+    }
+
+    if ((status != LE_OK) && (status != LE_WOULD_BLOCK))
+    {
+        LE_ERROR("Read failed. Status: %d", status);
+    }
+
+    // Re-enable fdMonitor
+    if (contextPtr->monitorRef)
+    {
+        le_fdMonitor_Enable(contextPtr->monitorRef, POLLIN);
+    }
+
+    return status;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set the socket communication timeout. This timeout specifies the interval that the read API
@@ -698,6 +968,33 @@ le_result_t le_socket_SetTimeout
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the time taken by the last successful connection of the socket.  For a secure socket, this
+ * includes the TLS handshake, which is much shorter when a cached TLS session is resumed.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_socket_GetConnectTime
+(
+    le_socket_Ref_t  ref,               ///< [IN] Socket context reference
+    uint32_t*        connectTimePtr     ///< [OUT] Connection time in milliseconds
+)
+{
+    SocketCtx_t *contextPtr = (SocketCtx_t *)le_ref_Lookup(SocketRefMap, ref);
+    if ((contextPtr == NULL) || (connectTimePtr == NULL))
+    {
+        LE_ERROR("Invalid parameter: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    *connectTimePtr = contextPtr->connectTime;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Enable or disable monitoring on the socket file descriptor. By default, monitoring is disabled.
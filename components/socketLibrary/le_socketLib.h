@@ -113,6 +113,7 @@
 #include "legato.h"
 #include "interfaces.h"
 #include "common.h"
+#include <sys/uio.h>
 
 //--------------------------------------------------------------------------------------------------
 // Symbol and Enum definitions
@@ -294,6 +295,51 @@ LE_SHARED le_result_t le_socket_Read
     size_t*          dataLenPtr  ///< [INOUT] Input: size of the buffer. Output: data size read
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the data of several buffers through the socket, as if they were a single buffer.  This
+ * avoids copying a protocol header and its payload together, or sending them separately.
+ *
+ * @note For a secure socket, small buffers are gathered so that they are sent in one TLS record.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_socket_SendVector
+(
+    le_socket_Ref_t      ref,        ///< [IN] Socket context reference
+    const struct iovec*  iovPtr,     ///< [IN] Buffers to be sent
+    int                  iovCount    ///< [IN] Number of buffers
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read data from the socket into several buffers, filled one after the other, in a blocking way
+ * until data is received or defined timeout value is reached.
+ *
+ * @note All the data already received is read, up to the size of the buffers: for a secure socket,
+ *       the data of several TLS records can be read at once.  When called from the socket event
+ *       handler, this spares the additional events needed to read the data with le_socket_Read().
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_FAULT         Internal error
+ *  - LE_WOULD_BLOCK   Would have blocked if non-blocking behaviour was not requested
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_socket_ReadVector
+(
+    le_socket_Ref_t      ref,        ///< [IN] Socket context reference
+    const struct iovec*  iovPtr,     ///< [IN] Read buffers
+    int                  iovCount,   ///< [IN] Number of buffers
+    size_t*              lenPtr      ///< [OUT] Data size read
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set the socket communication timeout. This timeout specifies the interval that the read API
@@ -313,6 +359,22 @@ LE_SHARED le_result_t le_socket_SetTimeout
     uint32_t         timeout    ///< [IN] Timeout in milliseconds
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the time taken by the last successful connection of the socket.  For a secure socket, this
+ * includes the TLS handshake, which is much shorter when a cached TLS session is resumed.
+ *
+ * @return
+ *  - LE_OK            Function success
+ *  - LE_BAD_PARAMETER Invalid parameter
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_socket_GetConnectTime
+(
+    le_socket_Ref_t  ref,               ///< [IN] Socket context reference
+    uint32_t*        connectTimePtr     ///< [OUT] Connection time in milliseconds
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Enable or disable monitoring on the socket file descriptor. By default, monitoring is disabled.
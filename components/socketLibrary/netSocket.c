@@ -188,6 +188,70 @@ le_result_t netSocket_Write
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write to the socket file descriptor the data of several buffers in a blocking way, with as few
+ * system calls as possible.
+ *
+ * @return
+ *  - LE_OK            The function succeeded
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_WriteVector
+(
+    int                 fd,          ///< [IN] Socket file descriptor
+    const struct iovec* iovPtr,      ///< [IN] Buffers to be sent
+    int                 iovCount     ///< [IN] Number of buffers
+)
+{
+    ssize_t count;
+    le_result_t status;
+
+    if ((!iovPtr) || (fd < 0) || (iovCount < 0) || (iovCount > IOV_MAX))
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    while (iovCount > 0)
+    {
+        count = writev(fd, iovPtr, iovCount);
+        if (-1 == count && (EINTR == errno))
+        {
+            continue;
+        }
+        else if (count < 0)
+        {
+            LE_ERROR("Write failed: %d, %s", errno, LE_ERRNO_TXT(errno));
+            return LE_FAULT;
+        }
+
+        // Skip the buffers that were completely sent
+        while ((iovCount > 0) && ((size_t)count >= iovPtr->iov_len))
+        {
+            count -= iovPtr->iov_len;
+            iovPtr++;
+            iovCount--;
+        }
+
+        // Finish sending a partially sent buffer before going on with the next ones
+        if ((iovCount > 0) && (count > 0))
+        {
+            status = netSocket_Write(fd, (char*)iovPtr->iov_base + count, iovPtr->iov_len - count);
+            if (LE_OK != status)
+            {
+                return status;
+            }
+            iovPtr++;
+            iovCount--;
+        }
+    }
+
+    LE_DEBUG("Vector write done successfully on fd: %d", fd);
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Read data from the socket file descriptor in a blocking way. If the timeout is zero, then the
@@ -256,3 +320,68 @@ le_result_t netSocket_Read
     LE_INFO("Read size: %zu", *bufLenPtr);
     return LE_OK;
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read data from the socket file descriptor into several buffers, filled one after the other, in
+ * a blocking way.  If the timeout is zero, then the API returns immediately.
+ *
+ * @return
+ *  - LE_OK            The function succeeded
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ *  - LE_TIMEOUT       Timeout during execution
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_ReadVector
+(
+    int                 fd,          ///< [IN] Socket file descriptor
+    const struct iovec* iovPtr,      ///< [IN] Read buffers
+    int                 iovCount,    ///< [IN] Number of buffers
+    size_t*             lenPtr,      ///< [OUT] Data size read
+    uint32_t            timeout      ///< [IN] Read timeout in milliseconds.
+)
+{
+    fd_set set;
+    int rv;
+    ssize_t count;
+    struct timeval time = {.tv_sec = timeout / 1000, .tv_usec = (timeout % 1000) * 1000};
+
+    if ((!iovPtr) || (!lenPtr) || (fd < 0) || (iovCount < 0) || (iovCount > IOV_MAX))
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    do
+    {
+       FD_ZERO(&set);
+       FD_SET(fd, &set);
+       rv = select(fd + 1, &set, NULL, NULL, &time);
+    }
+    while (rv == -1 && errno == EINTR);
+
+    if (rv == 0)
+    {
+        return LE_TIMEOUT;
+    }
+    else if (rv < 0)
+    {
+        return LE_FAULT;
+    }
+
+    do
+    {
+       count = readv(fd, iovPtr, iovCount);
+    }
+    while (count == -1 && errno == EINTR);
+
+    if (count < 0)
+    {
+        LE_ERROR("Read failed: %d, %s", errno, LE_ERRNO_TXT(errno));
+        return LE_FAULT;
+    }
+
+    *lenPtr = count;
+    LE_DEBUG("Vector read size: %zu", *lenPtr);
+    return LE_OK;
+}
@@ -14,6 +14,7 @@
 #include "legato.h"
 #include "interfaces.h"
 #include "common.h"
+#include <sys/uio.h>
 
 
 //--------------------------------------------------------------------------------------------------
@@ -95,4 +96,43 @@ le_result_t netSocket_Read
     uint32_t timeout      ///< [IN] Read timeout in milliseconds.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write to the socket file descriptor the data of several buffers in a blocking way, with as few
+ * system calls as possible.
+ *
+ * @return
+ *  - LE_OK            The function succeeded
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_WriteVector
+(
+    int                 fd,          ///< [IN] Socket file descriptor
+    const struct iovec* iovPtr,      ///< [IN] Buffers to be sent
+    int                 iovCount     ///< [IN] Number of buffers
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read data from the socket file descriptor into several buffers, filled one after the other, in
+ * a blocking way.  If the timeout is zero, then the API returns immediately.
+ *
+ * @return
+ *  - LE_OK            The function succeeded
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ *  - LE_TIMEOUT       Timeout during execution
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_ReadVector
+(
+    int                 fd,          ///< [IN] Socket file descriptor
+    const struct iovec* iovPtr,      ///< [IN] Read buffers
+    int                 iovCount,    ///< [IN] Number of buffers
+    size_t*             lenPtr,      ///< [OUT] Data size read
+    uint32_t            timeout      ///< [IN] Read timeout in milliseconds.
+);
+
 #endif /* LE_NET_SOCKET_LIB_H */
@@ -41,6 +41,26 @@
 //--------------------------------------------------------------------------------------------------
 #define MBEDTLS_SSL_CONNECT_TIMEOUT (3 * 10000)
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a TLS session cache key: "<host>:<port>"
+ */
+//--------------------------------------------------------------------------------------------------
+#define SESSION_NAME_LEN            (HOST_ADDR_LEN + 7)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS session cache entry
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char                name[SESSION_NAME_LEN]; ///< Server name and port, empty if entry is unused
+    mbedtls_ssl_session session;                ///< Session negotiated with the server
+    uint32_t            lastUse;                ///< Value of SessionUseCount at the last use
+}
+SessionCacheEntry_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * MbedTLS global context
@@ -63,6 +83,21 @@ MbedtlsCtx_t;
 static le_mem_PoolRef_t SocketCtxPoolRef = NULL;
 LE_MEM_DEFINE_STATIC_POOL(SocketCtxPool, MAX_SOCKET_NB, sizeof(MbedtlsCtx_t));
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS sessions negotiated by all the sockets of the process, offered for resumption when
+ * connecting again to the same server.  The least recently used entry is replaced when full.
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t SessionCache[LE_CONFIG_SOCKET_LIB_TLS_SESSION_CACHE_MAX];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of uses of the TLS session cache, used to find the least recently used entry.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t SessionUseCount = 0;
+
 //--------------------------------------------------------------------------------------------------
 // Static functions
 //--------------------------------------------------------------------------------------------------
@@ -175,6 +210,72 @@ static int ReadFromStream
     return r;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for the cached TLS session of a server.
+ *
+ * @return
+ *  - Cache entry of the server
+ *  - NULL if no session is cached for this server
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t* FindSession
+(
+    const char* namePtr     ///< [IN] Server name and port
+)
+{
+    int i;
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(SessionCache); i++)
+    {
+        if (0 == strcmp(SessionCache[i].name, namePtr))
+        {
+            SessionCache[i].lastUse = ++SessionUseCount;
+            return &SessionCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Save the session negotiated with a server in the TLS session cache.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SaveSession
+(
+    const char*                namePtr,     ///< [IN] Server name and port
+    const mbedtls_ssl_context* sslCtxPtr    ///< [IN] SSL context after a successful handshake
+)
+{
+    int i;
+    SessionCacheEntry_t* entryPtr = FindSession(namePtr);
+
+    if (!entryPtr)
+    {
+        // Use the least recently used entry, unused entries being the oldest ones
+        entryPtr = &SessionCache[0];
+        for (i = 1; i < NUM_ARRAY_MEMBERS(SessionCache); i++)
+        {
+            if (SessionCache[i].lastUse < entryPtr->lastUse)
+            {
+                entryPtr = &SessionCache[i];
+            }
+        }
+        entryPtr->lastUse = ++SessionUseCount;
+    }
+
+    mbedtls_ssl_session_free(&(entryPtr->session));
+    if (mbedtls_ssl_get_session(sslCtxPtr, &(entryPtr->session)) != 0)
+    {
+        entryPtr->name[0] = '\0';
+        entryPtr->lastUse = 0;
+        return;
+    }
+    le_utf8_Copy(entryPtr->name, namePtr, sizeof(entryPtr->name), NULL);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -288,8 +389,10 @@ le_result_t secSocket_Connect
 )
 {
     char             portBuffer[6] = {0};
+    char             sessionName[SESSION_NAME_LEN];
     int              ret;
     MbedtlsCtx_t    *contextPtr = (MbedtlsCtx_t *) ctxPtr;
+    SessionCacheEntry_t *entryPtr;
 
     LE_ASSERT(contextPtr != NULL);
     LE_ASSERT(hostPtr != NULL);
@@ -358,6 +461,16 @@ le_result_t secSocket_Connect
         return LE_FAULT;
     }
 
+    // Offer the session of a previous connection to this server, to skip the full handshake if
+    // the server still knows it
+    snprintf(sessionName, sizeof(sessionName), "%s:%s", hostPtr, portBuffer);
+    entryPtr = FindSession(sessionName);
+    if ((entryPtr) &&
+        ((ret = mbedtls_ssl_set_session(&(contextPtr->sslCtx), &(entryPtr->session))) != 0))
+    {
+        LE_WARN("Unable to resume previous session: mbedtls_ssl_set_session returned %d", ret);
+    }
+
     mbedtls_ssl_set_bio(&(contextPtr->sslCtx), &(contextPtr->sock),
                         mbedtls_net_send, NULL, mbedtls_net_recv_timeout);
 
@@ -394,6 +507,9 @@ le_result_t secSocket_Connect
         }
     }
 
+    // Keep the negotiated session for the next connections to this server
+    SaveSession(sessionName, &(contextPtr->sslCtx));
+
     return LE_OK;
 }
 
@@ -415,6 +531,10 @@ le_result_t secSocket_Disconnect
     LE_ASSERT(contextPtr != NULL);
 
     mbedtls_net_free(&(contextPtr->sock));
+
+    // Reset the SSL context so that it can be set up again on the next connection
+    mbedtls_ssl_free(&(contextPtr->sslCtx));
+    mbedtls_ssl_init(&(contextPtr->sslCtx));
     return LE_OK;
 }
 
@@ -45,6 +45,19 @@
 //--------------------------------------------------------------------------------------------------
 #define PORT_STR_LEN                6
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS session cache entry
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char         name[HOST_ADDR_LEN + PORT_STR_LEN + 1]; ///< Server name and port, empty if unused
+    SSL_SESSION* sessionPtr;                             ///< Session negotiated with the server
+    uint32_t     lastUse;                                ///< Value of SessionUseCount at last use
+}
+SessionCacheEntry_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * OpenSSL global context
@@ -77,6 +90,21 @@ LE_MEM_DEFINE_STATIC_POOL(SocketCtxPool, MAX_SOCKET_NB, sizeof(OpensslCtx_t));
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t SocketCtxPoolRef = NULL;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS sessions negotiated by all the sockets of the process, offered for resumption when
+ * connecting again to the same server.  The least recently used entry is replaced when full.
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t SessionCache[LE_CONFIG_SOCKET_LIB_TLS_SESSION_CACHE_MAX];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of uses of the TLS session cache, used to find the least recently used entry.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t SessionUseCount = 0;
+
 //--------------------------------------------------------------------------------------------------
 // Static functions
 //--------------------------------------------------------------------------------------------------
@@ -112,6 +140,76 @@ static OpensslCtx_t* GetContext
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for the cached TLS session of a server.
+ *
+ * @return
+ *  - Cache entry of the server
+ *  - NULL if no session is cached for this server
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionCacheEntry_t* FindSession
+(
+    const char* namePtr     ///< [IN] Server name and port
+)
+{
+    int i;
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(SessionCache); i++)
+    {
+        if ((SessionCache[i].sessionPtr) && (0 == strcmp(SessionCache[i].name, namePtr)))
+        {
+            SessionCache[i].lastUse = ++SessionUseCount;
+            return &SessionCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Save the session negotiated with a server in the TLS session cache.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SaveSession
+(
+    const char* namePtr,    ///< [IN] Server name and port
+    SSL*        sslPtr      ///< [IN] SSL connection after a successful handshake
+)
+{
+    int i;
+    SessionCacheEntry_t* entryPtr = FindSession(namePtr);
+
+    if (!entryPtr)
+    {
+        // Use the least recently used entry, unused entries being the oldest ones
+        entryPtr = &SessionCache[0];
+        for (i = 1; i < NUM_ARRAY_MEMBERS(SessionCache); i++)
+        {
+            if (SessionCache[i].lastUse < entryPtr->lastUse)
+            {
+                entryPtr = &SessionCache[i];
+            }
+        }
+        entryPtr->lastUse = ++SessionUseCount;
+    }
+
+    if (entryPtr->sessionPtr)
+    {
+        SSL_SESSION_free(entryPtr->sessionPtr);
+    }
+    entryPtr->sessionPtr = SSL_get1_session(sslPtr);
+    if (!entryPtr->sessionPtr)
+    {
+        entryPtr->name[0] = '\0';
+        entryPtr->lastUse = 0;
+        return;
+    }
+    le_utf8_Copy(entryPtr->name, namePtr, sizeof(entryPtr->name), NULL);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -164,6 +262,7 @@ le_result_t secSocket_Init
 
     // Set the magic number
     contextPtr->magicNb = OPENSSL_MAGIC_NUMBER;
+    contextPtr->bioPtr = NULL;
 
     // Initialize OpenSSL library and setup SSL pointers
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
@@ -304,6 +403,7 @@ le_result_t secSocket_Connect
     BIO* bioPtr = NULL;
     char hostAndPort[HOST_ADDR_LEN + PORT_STR_LEN + 1];
     le_result_t status = LE_FAULT;
+    SessionCacheEntry_t* entryPtr;
     unsigned long code;
 
     if ((!ctxPtr) || (!hostPtr) || (!fdPtr))
@@ -325,6 +425,13 @@ le_result_t secSocket_Connect
     // Clear the current thread's OpenSSL error queue
     ERR_clear_error();
 
+    // Release the BIO of the previous connection, if any
+    if (contextPtr->bioPtr)
+    {
+        BIO_free_all(contextPtr->bioPtr);
+        contextPtr->bioPtr = NULL;
+    }
+
     // Setting up the BIO abstraction layer
     bioPtr = BIO_new_ssl_connect(contextPtr->sslCtxPtr);
     if (!bioPtr)
@@ -344,6 +451,14 @@ le_result_t secSocket_Connect
     // the handshake and successful completion
     SSL_set_mode(sslPtr, SSL_MODE_AUTO_RETRY);
 
+    // Offer the session of a previous connection to this server, to skip the full handshake if
+    // the server still knows it
+    entryPtr = FindSession(hostAndPort);
+    if ((entryPtr) && (SSL_set_session(sslPtr, entryPtr->sessionPtr) != 1))
+    {
+        LE_WARN("Unable to resume previous session");
+    }
+
     BIO_set_conn_hostname(bioPtr, hostAndPort);
 
     // Attempt to connect the supplied BIO and perform the handshake.
@@ -359,6 +474,10 @@ le_result_t secSocket_Connect
     BIO_get_fd(bioPtr, fdPtr);
     BIO_socket_nbio(*fdPtr, 1);
 
+    // Keep the negotiated session for the next connections to this server
+    LE_DEBUG("TLS session %s", SSL_session_reused(sslPtr) ? "resumed" : "negotiated");
+    SaveSession(hostAndPort, sslPtr);
+
     contextPtr->bioPtr = bioPtr;
     return LE_OK;
 
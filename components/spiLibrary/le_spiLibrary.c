@@ -13,6 +13,44 @@
 #include <linux/types.h>
 #include <linux/spi/spidev.h>
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch of transfers queued to the worker thread by le_spiLib_TransferAsync().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int fd;                                     ///< open file descriptor of SPI port
+    const le_spiLib_Transfer_t* transfersPtr;   ///< transfers to perform
+    size_t count;                               ///< number of transfers
+    le_spiLib_TransferHandlerFunc_t handlerPtr; ///< completion handler
+    void* contextPtr;                           ///< context passed to the handler
+    le_thread_Ref_t clientThread;               ///< thread to call the handler on
+    le_result_t result;                         ///< result of the transfers
+}
+AsyncTransfer_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of the batches queued to the worker thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t AsyncTransferPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Worker thread performing the asynchronous transfers, created when first needed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_thread_Ref_t WorkerThread;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the creation of the worker thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mutex_Ref_t WorkerMutex;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Configures the SPI bus for use with a specific device.
@@ -331,7 +369,169 @@ le_result_t le_spiLib_ReadHD
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a batch of SPI transfers in a single system call.  The device stays selected between
+ * the transfers unless their csChange is set.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_OUT_OF_RANGE if there are no transfers or more than LE_SPILIB_MAX_TRANSFERS
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_spiLib_Transfer
+(
+    int fd,                                     ///< [in] open file descriptor of SPI port
+    const le_spiLib_Transfer_t* transfersPtr,   ///< [in] transfers to perform, in order
+    size_t count                                ///< [in] number of transfers
+)
+{
+    struct spi_ioc_transfer tr[LE_SPILIB_MAX_TRANSFERS];
+    int transferResult;
+
+    if ((count == 0) || (count > LE_SPILIB_MAX_TRANSFERS))
+    {
+        LE_ERROR("Invalid number of transfers: %zu", count);
+        return LE_OUT_OF_RANGE;
+    }
+
+    memset(tr, 0, count * sizeof(tr[0]));
+    for (size_t i = 0; i < count; i++)
+    {
+        tr[i].tx_buf = (unsigned long)transfersPtr[i].writeData;
+        tr[i].rx_buf = (unsigned long)transfersPtr[i].readData;
+        tr[i].len = transfersPtr[i].length;
+        tr[i].cs_change = transfersPtr[i].csChange;
+    }
+
+    LE_DEBUG("Transferring %zu messages", count);
+
+    transferResult = ioctl(fd, SPI_IOC_MESSAGE(count), tr);
+    if (transferResult < 0)
+    {
+        LE_ERROR("Transfer failed with error %d : %d (%m)", transferResult, errno);
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("Successful transmission of %d bytes", transferResult);
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calls the completion handler of a batch of transfers, on the thread that submitted them.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompleteTransfer
+(
+    void* param1Ptr,    ///< [in] batch of transfers
+    void* param2Ptr     ///< [in] unused
+)
+{
+    AsyncTransfer_t* asyncPtr = param1Ptr;
+
+    LE_UNUSED(param2Ptr);
+
+    asyncPtr->handlerPtr(asyncPtr->result, asyncPtr->transfersPtr, asyncPtr->count,
+                         asyncPtr->contextPtr);
+    le_mem_Release(asyncPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a batch of transfers on the worker thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunTransfer
+(
+    void* param1Ptr,    ///< [in] batch of transfers
+    void* param2Ptr     ///< [in] unused
+)
+{
+    AsyncTransfer_t* asyncPtr = param1Ptr;
+
+    LE_UNUSED(param2Ptr);
+
+    asyncPtr->result = le_spiLib_Transfer(asyncPtr->fd, asyncPtr->transfersPtr, asyncPtr->count);
+    le_event_QueueFunctionToThread(asyncPtr->clientThread, CompleteTransfer, asyncPtr, NULL);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the worker thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* WorkerThreadMain
+(
+    void* contextPtr    ///< [in] unused
+)
+{
+    LE_UNUSED(contextPtr);
+
+    le_event_RunLoop();
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queues a batch of SPI transfers to be performed by a worker thread, as le_spiLib_Transfer()
+ * does.  The handler is then called on the calling thread, which must run an event loop.  The
+ * transfers and their buffers must stay valid until the handler is called.
+ *
+ * @return
+ *      - LE_OK if the transfers are queued
+ *      - LE_OUT_OF_RANGE if there are no transfers or more than LE_SPILIB_MAX_TRANSFERS
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_spiLib_TransferAsync
+(
+    int fd,                                     ///< [in] open file descriptor of SPI port
+    const le_spiLib_Transfer_t* transfersPtr,   ///< [in] transfers to perform, in order
+    size_t count,                               ///< [in] number of transfers
+    le_spiLib_TransferHandlerFunc_t handlerPtr, ///< [in] completion handler
+    void* contextPtr                            ///< [in] context passed to the handler
+)
+{
+    AsyncTransfer_t* asyncPtr;
+
+    if ((count == 0) || (count > LE_SPILIB_MAX_TRANSFERS))
+    {
+        LE_ERROR("Invalid number of transfers: %zu", count);
+        return LE_OUT_OF_RANGE;
+    }
+    LE_ASSERT(handlerPtr != NULL);
+
+    le_mutex_Lock(WorkerMutex);
+    if (WorkerThread == NULL)
+    {
+        WorkerThread = le_thread_Create("spiLibWorker", WorkerThreadMain, NULL);
+        le_thread_Start(WorkerThread);
+    }
+    le_mutex_Unlock(WorkerMutex);
+
+    asyncPtr = le_mem_ForceAlloc(AsyncTransferPool);
+    asyncPtr->fd = fd;
+    asyncPtr->transfersPtr = transfersPtr;
+    asyncPtr->count = count;
+    asyncPtr->handlerPtr = handlerPtr;
+    asyncPtr->contextPtr = contextPtr;
+    asyncPtr->clientThread = le_thread_GetCurrent();
+    asyncPtr->result = LE_FAULT;
+
+    le_event_QueueFunctionToThread(WorkerThread, RunTransfer, asyncPtr, NULL);
+    return LE_OK;
+}
+
+
 COMPONENT_INIT
 {
     LE_DEBUG("spiLibrary initializing");
+
+    AsyncTransferPool = le_mem_CreatePool("SpiLibAsyncTransfer", sizeof(AsyncTransfer_t));
+    WorkerMutex = le_mutex_CreateNonRecursive("SpiLibWorker");
 }
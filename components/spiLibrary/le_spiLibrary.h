@@ -8,6 +8,43 @@
 #ifndef LE_SPI_LIBRARY_H
 #define LE_SPI_LIBRARY_H
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of transfers submitted at once by le_spiLib_Transfer().
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_SPILIB_MAX_TRANSFERS 32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * One transfer of a batch submitted by le_spiLib_Transfer().  Either buffer may be NULL for a
+ * half duplex transfer.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const uint8_t* writeData;   ///< Data sent to the slave, or NULL to send zeros.
+    uint8_t* readData;          ///< Buffer for the data received from the slave, or NULL.
+    size_t length;              ///< Number of bytes of the transfer.
+    bool csChange;              ///< Deselect the device after this transfer, before the next
+                                ///< one (for the last transfer: leave it selected).
+}
+le_spiLib_Transfer_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler called, on the thread that submitted them, when a batch of transfers submitted by
+ * le_spiLib_TransferAsync() completes.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_spiLib_TransferHandlerFunc_t)
+(
+    le_result_t result,                         ///< [in] Result of the transfers.
+    const le_spiLib_Transfer_t* transfersPtr,   ///< [in] Transfers, as submitted.
+    size_t count,                               ///< [in] Number of transfers.
+    void* contextPtr                            ///< [in] Context given at submission.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Configures the SPI bus for use with a specific device.
@@ -100,4 +137,42 @@ LE_SHARED le_result_t le_spiLib_ReadHD
     size_t* readDataLength    ///< [in/out] number of bytes in rx message
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a batch of SPI transfers in a single system call.  The device stays selected between
+ * the transfers unless their csChange is set.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_OUT_OF_RANGE if there are no transfers or more than LE_SPILIB_MAX_TRANSFERS
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_spiLib_Transfer
+(
+    int fd,                                     ///< [in] open file descriptor of SPI port
+    const le_spiLib_Transfer_t* transfersPtr,   ///< [in] transfers to perform, in order
+    size_t count                                ///< [in] number of transfers
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queues a batch of SPI transfers to be performed by a worker thread, as le_spiLib_Transfer()
+ * does.  The handler is then called on the calling thread, which must run an event loop.  The
+ * transfers and their buffers must stay valid until the handler is called.
+ *
+ * @return
+ *      - LE_OK if the transfers are queued
+ *      - LE_OUT_OF_RANGE if there are no transfers or more than LE_SPILIB_MAX_TRANSFERS
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_spiLib_TransferAsync
+(
+    int fd,                                     ///< [in] open file descriptor of SPI port
+    const le_spiLib_Transfer_t* transfersPtr,   ///< [in] transfers to perform, in order
+    size_t count,                               ///< [in] number of transfers
+    le_spiLib_TransferHandlerFunc_t handlerPtr, ///< [in] completion handler
+    void* contextPtr                            ///< [in] context passed to the handler
+);
+
 #endif  // LE_SPI_LIBRARY_H
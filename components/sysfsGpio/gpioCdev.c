@@ -0,0 +1,845 @@
+/**
+ * @file gpioCdev.c
+ *
+ * GPIO bank API implementation, using the GPIO character device interface of the Linux kernel.
+ *
+ * Unlike the per-pin services, which open, write and close sysfs files for each operation, a bank
+ * holds the file descriptor of a line request on the character device for as long as it exists.
+ * All the pins of the bank are read or written with a single ioctl on that file descriptor, and
+ * edge events are read from it along with the kernel timestamp of each event.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "gpioCdev.h"
+
+#ifdef __has_include
+#   if __has_include(<linux/gpio.h>)
+#       include <linux/gpio.h>
+#   endif
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * GPIO controllers have paths like /sys/class/gpio/gpiochip42/ (for the controller implementing
+ * GPIOs starting at #42).  The name of their character device is found in their device directory.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SYSFS_GPIO_PATH           "/sys/class/gpio"
+#define DEV_PATH                  "/dev"
+#define GPIOCHIP_PREFIX           "gpiochip"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Name of the consumer of the lines requested by banks, as shown by the kernel.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CONSUMER_NAME             "gpioService"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a GPIO controller name.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_CHIP_NAME_BYTES       32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expected number of simultaneous banks.
+ */
+//--------------------------------------------------------------------------------------------------
+#define BANK_POOL_SIZE            4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A bank of pins.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_gpioBank_BankRef_t ref;                          ///< Safe reference to the bank
+    le_msg_SessionRef_t sessionRef;                     ///< Session of the client owning the bank
+    int fd;                                             ///< File descriptor of the line request
+    uint32_t pins[LE_GPIOBANK_MAX_PINS];                ///< GPIO numbers of the pins
+    uint32_t offsets[LE_GPIOBANK_MAX_PINS];             ///< Offsets of the pins in the controller
+    size_t numPins;                                     ///< Number of pins in the bank
+    bool isOutput;                                      ///< Are the pins outputs?
+    le_gpioBank_Polarity_t polarity;                    ///< Polarity of the pins
+    le_gpioBank_ChangeEventHandlerRef_t handlerRef;     ///< Safe reference to the change handler
+    le_gpioBank_ChangeHandlerFunc_t handlerPtr;         ///< Change handler, if registered
+    void* contextPtr;                                   ///< Client context of the change handler
+    le_fdMonitor_Ref_t fdMonitor;                       ///< Monitor of the edge events
+    le_dls_Link_t link;                                 ///< Link in the list of banks
+}
+Bank_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of banks, list of the existing banks and safe references to banks and change handlers.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t BankPool;
+static le_dls_List_t BankList = LE_DLS_LIST_INIT;
+static le_ref_MapRef_t BankRefMap;
+static le_ref_MapRef_t HandlerRefMap;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Whether banks can be requested with the GPIO design of the platform.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSupported = false;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read an unsigned integer from a sysfs file.
+ *
+ * @return
+ * - LE_OK if the value was read
+ * - LE_FAULT if it could not be
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadSysfsUint
+(
+    const char* path,       ///< [IN] Path of the sysfs file
+    uint32_t* valuePtr      ///< [OUT] Value read
+)
+{
+    FILE* fp = NULL;
+    unsigned int value;
+    int count;
+
+    do
+    {
+        fp = fopen(path, "r");
+    }
+    while ((fp == NULL) && (errno == EINTR));
+
+    if (!fp)
+    {
+        return LE_FAULT;
+    }
+
+    count = fscanf(fp, "%u", &value);
+    fclose(fp);
+
+    if (count != 1)
+    {
+        LE_ERROR("Unable to read a number from %s", path);
+        return LE_FAULT;
+    }
+
+    *valuePtr = value;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the character device name of a GPIO controller, from its device directory in sysfs.
+ *
+ * @return
+ * - LE_OK if the name was found
+ * - LE_NOT_FOUND if it was not
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FindChipDevName
+(
+    const char* sysfsChipName,  ///< [IN] Name of the controller in /sys/class/gpio
+    char* devNamePtr,           ///< [OUT] Name of the character device in /dev
+    size_t devNameSize          ///< [IN] Size of the name buffer
+)
+{
+    char path[128];
+    DIR* dir;
+    struct dirent* entryPtr;
+    le_result_t result = LE_NOT_FOUND;
+
+    snprintf(path, sizeof(path), "%s/%s/device", SYSFS_GPIO_PATH, sysfsChipName);
+    dir = opendir(path);
+    if (!dir)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    while ((entryPtr = readdir(dir)) != NULL)
+    {
+        if (strncmp(entryPtr->d_name, GPIOCHIP_PREFIX, sizeof(GPIOCHIP_PREFIX) - 1) == 0)
+        {
+            result = le_utf8_Copy(devNamePtr, entryPtr->d_name, devNameSize, NULL);
+            break;
+        }
+    }
+    closedir(dir);
+
+    return (result == LE_OK) ? LE_OK : LE_NOT_FOUND;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the GPIO controller of a pin, and the offset of the pin in that controller.
+ *
+ * @return
+ * - LE_OK if the controller was found
+ * - LE_NOT_FOUND if it was not
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FindChip
+(
+    uint32_t pin,               ///< [IN] GPIO number
+    char* devNamePtr,           ///< [OUT] Name of the character device of the controller
+    size_t devNameSize,         ///< [IN] Size of the name buffer
+    uint32_t* offsetPtr         ///< [OUT] Offset of the pin in the controller
+)
+{
+    char path[128];
+    DIR* dir;
+    struct dirent* entryPtr;
+    uint32_t base;
+    uint32_t ngpio;
+    le_result_t result = LE_NOT_FOUND;
+
+    dir = opendir(SYSFS_GPIO_PATH);
+    if (!dir)
+    {
+        LE_ERROR("Unable to open %s: %m", SYSFS_GPIO_PATH);
+        return LE_NOT_FOUND;
+    }
+
+    while ((entryPtr = readdir(dir)) != NULL)
+    {
+        if (strncmp(entryPtr->d_name, GPIOCHIP_PREFIX, sizeof(GPIOCHIP_PREFIX) - 1) != 0)
+        {
+            continue;
+        }
+
+        snprintf(path, sizeof(path), "%s/%s/base", SYSFS_GPIO_PATH, entryPtr->d_name);
+        if (ReadSysfsUint(path, &base) != LE_OK)
+        {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s/ngpio", SYSFS_GPIO_PATH, entryPtr->d_name);
+        if (ReadSysfsUint(path, &ngpio) != LE_OK)
+        {
+            continue;
+        }
+
+        if ((pin >= base) && (pin < base + ngpio))
+        {
+            *offsetPtr = pin - base;
+            result = FindChipDevName(entryPtr->d_name, devNamePtr, devNameSize);
+            break;
+        }
+    }
+    closedir(dir);
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Request the lines of a bank from the character device of their controller.
+ *
+ * @return
+ * - File descriptor of the line request
+ * - -1 on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static int RequestLines
+(
+    const char* devName,        ///< [IN] Name of the character device of the controller
+    const Bank_t* bankPtr,      ///< [IN] Bank to request the lines of
+    uint64_t values             ///< [IN] Initial values of output lines
+)
+{
+#ifdef GPIO_V2_GET_LINE_IOCTL
+    char path[64];
+    struct gpio_v2_line_request request;
+    size_t i;
+    int chipFd;
+
+    memset(&request, 0, sizeof(request));
+    for (i = 0; i < bankPtr->numPins; i++)
+    {
+        request.offsets[i] = bankPtr->offsets[i];
+    }
+    request.num_lines = bankPtr->numPins;
+    le_utf8_Copy(request.consumer, CONSUMER_NAME, sizeof(request.consumer), NULL);
+
+    request.config.flags = bankPtr->isOutput ? GPIO_V2_LINE_FLAG_OUTPUT : GPIO_V2_LINE_FLAG_INPUT;
+    if (bankPtr->polarity == LE_GPIOBANK_ACTIVE_LOW)
+    {
+        request.config.flags |= GPIO_V2_LINE_FLAG_ACTIVE_LOW;
+    }
+    if (bankPtr->isOutput)
+    {
+        request.config.num_attrs = 1;
+        request.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+        request.config.attrs[0].attr.values = values;
+        request.config.attrs[0].mask = (bankPtr->numPins == 64) ?
+                                       UINT64_MAX : ((1ULL << bankPtr->numPins) - 1);
+    }
+
+    snprintf(path, sizeof(path), "%s/%s", DEV_PATH, devName);
+    chipFd = open(path, O_RDONLY | O_CLOEXEC);
+    if (chipFd == -1)
+    {
+        LE_ERROR("Unable to open %s: %m", path);
+        return -1;
+    }
+
+    if (ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request) == -1)
+    {
+        LE_WARN("Unable to request %zu lines of %s: %m", bankPtr->numPins, path);
+        request.fd = -1;
+    }
+    close(chipFd);
+
+    return request.fd;
+#else
+    LE_WARN("GPIO character device interface v2 not available");
+    return -1;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the values of the lines of a bank.
+ *
+ * @return
+ * - LE_OK on success
+ * - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetLineValues
+(
+    const Bank_t* bankPtr,      ///< [IN] Bank to read
+    uint64_t* valuesPtr         ///< [OUT] Values of the lines
+)
+{
+#ifdef GPIO_V2_GET_LINE_IOCTL
+    struct gpio_v2_line_values lineValues =
+    {
+        .bits = 0,
+        .mask = (bankPtr->numPins == 64) ? UINT64_MAX : ((1ULL << bankPtr->numPins) - 1)
+    };
+
+    if (ioctl(bankPtr->fd, GPIO_V2_LINE_GET_VALUES_IOCTL, &lineValues) == -1)
+    {
+        LE_ERROR("Unable to get the values of bank %p: %m", bankPtr->ref);
+        return LE_FAULT;
+    }
+
+    *valuesPtr = lineValues.bits;
+    return LE_OK;
+#else
+    return LE_FAULT;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the values of some of the lines of a bank.
+ *
+ * @return
+ * - LE_OK on success
+ * - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SetLineValues
+(
+    const Bank_t* bankPtr,      ///< [IN] Bank to write
+    uint64_t mask,              ///< [IN] Lines to set
+    uint64_t values             ///< [IN] Values of the lines
+)
+{
+#ifdef GPIO_V2_GET_LINE_IOCTL
+    struct gpio_v2_line_values lineValues = { .bits = values, .mask = mask };
+
+    if (ioctl(bankPtr->fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &lineValues) == -1)
+    {
+        LE_ERROR("Unable to set the values of bank %p: %m", bankPtr->ref);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+#else
+    return LE_FAULT;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the edge detection of the lines of an input bank.
+ *
+ * @return
+ * - LE_OK on success
+ * - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SetLineEdge
+(
+    const Bank_t* bankPtr,      ///< [IN] Bank to configure
+    le_gpioBank_Edge_t edge     ///< [IN] Edge(s) to detect
+)
+{
+#ifdef GPIO_V2_GET_LINE_IOCTL
+    struct gpio_v2_line_config config;
+
+    memset(&config, 0, sizeof(config));
+    config.flags = GPIO_V2_LINE_FLAG_INPUT;
+    if (bankPtr->polarity == LE_GPIOBANK_ACTIVE_LOW)
+    {
+        config.flags |= GPIO_V2_LINE_FLAG_ACTIVE_LOW;
+    }
+    if ((edge == LE_GPIOBANK_EDGE_RISING) || (edge == LE_GPIOBANK_EDGE_BOTH))
+    {
+        config.flags |= GPIO_V2_LINE_FLAG_EDGE_RISING;
+    }
+    if ((edge == LE_GPIOBANK_EDGE_FALLING) || (edge == LE_GPIOBANK_EDGE_BOTH))
+    {
+        config.flags |= GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    }
+
+    if (ioctl(bankPtr->fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) == -1)
+    {
+        LE_ERROR("Unable to set the edge detection of bank %p: %m", bankPtr->ref);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+#else
+    return LE_FAULT;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when edge events are available on the line request of a bank.  Each event is passed
+ * to the change handler of the bank, with the pin it happened on and its kernel timestamp.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EdgeEventHandler
+(
+    int fd,         ///< [IN] File descriptor of the line request
+    short events    ///< [IN] Events detected on the file descriptor
+)
+{
+    Bank_t* bankPtr = le_fdMonitor_GetContextPtr();
+
+    if (events & (POLLERR | POLLHUP))
+    {
+        // These can't be disabled, so stop monitoring the line request altogether.
+        LE_ERROR("Error on the line request of bank %p", bankPtr->ref);
+        le_fdMonitor_Delete(bankPtr->fdMonitor);
+        bankPtr->fdMonitor = NULL;
+        return;
+    }
+
+#ifdef GPIO_V2_GET_LINE_IOCTL
+    struct gpio_v2_line_event lineEvents[16];
+    ssize_t bytes;
+    size_t i;
+    size_t pinIdx;
+
+    bytes = read(fd, lineEvents, sizeof(lineEvents));
+    if (bytes < 0)
+    {
+        LE_WARN_IF(errno != EAGAIN, "Unable to read the events of bank %p: %m", bankPtr->ref);
+        return;
+    }
+
+    for (i = 0; i < (size_t)bytes / sizeof(lineEvents[0]); i++)
+    {
+        // With v2 of the interface, edges are reported as the kernel applied the polarity.
+        const bool state = (lineEvents[i].id == GPIO_V2_LINE_EVENT_RISING_EDGE);
+
+        for (pinIdx = 0; pinIdx < bankPtr->numPins; pinIdx++)
+        {
+            if (bankPtr->offsets[pinIdx] == lineEvents[i].offset)
+            {
+                break;
+            }
+        }
+
+        if ((pinIdx < bankPtr->numPins) && (bankPtr->handlerPtr != NULL))
+        {
+            bankPtr->handlerPtr(bankPtr->pins[pinIdx],
+                                state,
+                                lineEvents[i].timestamp_ns,
+                                bankPtr->contextPtr);
+        }
+    }
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove the change handler of a bank, if any.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemoveChangeHandler
+(
+    Bank_t* bankPtr             ///< [IN] Bank to remove the change handler from
+)
+{
+    if (bankPtr->fdMonitor != NULL)
+    {
+        le_fdMonitor_Delete(bankPtr->fdMonitor);
+        bankPtr->fdMonitor = NULL;
+        SetLineEdge(bankPtr, LE_GPIOBANK_EDGE_NONE);
+    }
+
+    if (bankPtr->handlerRef != NULL)
+    {
+        le_ref_DeleteRef(HandlerRefMap, bankPtr->handlerRef);
+        bankPtr->handlerRef = NULL;
+    }
+
+    bankPtr->handlerPtr = NULL;
+    bankPtr->contextPtr = NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release a bank and its lines.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseBank
+(
+    Bank_t* bankPtr             ///< [IN] Bank to release
+)
+{
+    LE_INFO("Releasing bank %p of %zu pins", bankPtr->ref, bankPtr->numPins);
+
+    RemoveChangeHandler(bankPtr);
+    close(bankPtr->fd);
+
+    le_ref_DeleteRef(BankRefMap, bankPtr->ref);
+    le_dls_Remove(&BankList, &bankPtr->link);
+    le_mem_Release(bankPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up a bank owned by the current client.  The client is killed if it doesn't own the bank.
+ *
+ * @return
+ * - Bank
+ * - NULL if the reference is invalid
+ */
+//--------------------------------------------------------------------------------------------------
+static Bank_t* LookupBank
+(
+    le_gpioBank_BankRef_t bankRef   ///< [IN] Reference to the bank
+)
+{
+    Bank_t* bankPtr = le_ref_Lookup(BankRefMap, bankRef);
+
+    if ((bankPtr == NULL) || (bankPtr->sessionRef != le_gpioBank_GetClientSessionRef()))
+    {
+        LE_KILL_CLIENT("Invalid bank reference %p", bankRef);
+        return NULL;
+    }
+
+    return bankPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the banks of a client when its session closes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SessionCloseHandler
+(
+    le_msg_SessionRef_t  sessionRef,  ///<[IN] Client session reference.
+    void*                contextPtr   ///<[IN] Client context pointer.
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&BankList);
+
+    while (linkPtr != NULL)
+    {
+        Bank_t* bankPtr = CONTAINER_OF(linkPtr, Bank_t, link);
+        linkPtr = le_dls_PeekNext(&BankList, linkPtr);
+
+        if (bankPtr->sessionRef == sessionRef)
+        {
+            ReleaseBank(bankPtr);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Request a bank of pins.
+ *
+ * @return
+ *      - Reference to the bank.
+ *      - NULL if a pin is not available, is already in use, or if the pins don't all belong to
+ *        the same GPIO controller.
+ */
+//--------------------------------------------------------------------------------------------------
+le_gpioBank_BankRef_t le_gpioBank_Request
+(
+    const uint32_t* pinsPtr,            ///< [IN] GPIO numbers of the pins.
+    size_t pinsSize,                    ///< [IN]
+    bool isOutput,                      ///< [IN] true to request output pins.
+    le_gpioBank_Polarity_t polarity,    ///< [IN] Active-high or active-low.
+    uint64_t values                     ///< [IN] Initial values to drive, for output pins.
+)
+{
+    char bankChip[MAX_CHIP_NAME_BYTES] = "";
+    char pinChip[MAX_CHIP_NAME_BYTES];
+    char cfgPath[64];
+    Bank_t* bankPtr;
+    size_t i;
+
+    if (!IsSupported)
+    {
+        LE_WARN("GPIO banks are not supported with this GPIO design");
+        return NULL;
+    }
+
+    if ((pinsSize == 0) || (pinsSize > LE_GPIOBANK_MAX_PINS))
+    {
+        LE_WARN("Invalid number of pins %zu", pinsSize);
+        return NULL;
+    }
+
+    bankPtr = le_mem_ForceAlloc(BankPool);
+    memset(bankPtr, 0, sizeof(*bankPtr));
+    bankPtr->fd = -1;
+    bankPtr->numPins = pinsSize;
+    bankPtr->isOutput = isOutput;
+    bankPtr->polarity = polarity;
+    bankPtr->link = LE_DLS_LINK_INIT;
+
+    for (i = 0; i < pinsSize; i++)
+    {
+        // The same pins as those of the per-pin services are available to banks.
+        snprintf(cfgPath, sizeof(cfgPath), "gpioService:/pins/disabled/%" PRIu32, pinsPtr[i]);
+        if ((pinsPtr[i] > INT_MAX) || !gpioSysfs_IsPinAvailable((int)pinsPtr[i]) ||
+            le_cfg_QuickGetBool(cfgPath, false))
+        {
+            LE_WARN("GPIO %" PRIu32 " is not available", pinsPtr[i]);
+            goto error;
+        }
+
+        if (FindChip(pinsPtr[i], pinChip, sizeof(pinChip), &bankPtr->offsets[i]) != LE_OK)
+        {
+            LE_WARN("Unable to find the GPIO controller of GPIO %" PRIu32, pinsPtr[i]);
+            goto error;
+        }
+
+        if (i == 0)
+        {
+            le_utf8_Copy(bankChip, pinChip, sizeof(bankChip), NULL);
+        }
+        else if (strcmp(bankChip, pinChip) != 0)
+        {
+            LE_WARN("GPIO %" PRIu32 " belongs to %s, not %s", pinsPtr[i], pinChip, bankChip);
+            goto error;
+        }
+
+        bankPtr->pins[i] = pinsPtr[i];
+    }
+
+    // Lines already in use, e.g. exported in sysfs for a per-pin service, can't be requested.
+    bankPtr->fd = RequestLines(bankChip, bankPtr, values);
+    if (bankPtr->fd == -1)
+    {
+        goto error;
+    }
+
+    bankPtr->sessionRef = le_gpioBank_GetClientSessionRef();
+    bankPtr->ref = le_ref_CreateRef(BankRefMap, bankPtr);
+    le_dls_Queue(&BankList, &bankPtr->link);
+
+    LE_INFO("Assigning bank %p of %zu pins of %s", bankPtr->ref, pinsSize, bankChip);
+    return bankPtr->ref;
+
+error:
+    le_mem_Release(bankPtr);
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the values of all the pins of a bank.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_FAULT on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_gpioBank_Read
+(
+    le_gpioBank_BankRef_t bank,         ///< [IN] Bank to read.
+    uint64_t* valuesPtr                 ///< [OUT] Values of the pins.
+)
+{
+    Bank_t* bankPtr = LookupBank(bank);
+
+    if (bankPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    return GetLineValues(bankPtr, valuesPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the values of some or all of the pins of an output bank.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_FAULT on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_gpioBank_Write
+(
+    le_gpioBank_BankRef_t bank,         ///< [IN] Bank to write.
+    uint64_t mask,                      ///< [IN] Pins to set.
+    uint64_t values                     ///< [IN] Values to drive.
+)
+{
+    Bank_t* bankPtr = LookupBank(bank);
+
+    if (bankPtr == NULL)
+    {
+        return LE_FAULT;
+    }
+
+    if (!bankPtr->isOutput)
+    {
+        LE_ERROR("Attempt to write input bank %p", bank);
+        return LE_FAULT;
+    }
+
+    if (bankPtr->numPins < 64)
+    {
+        mask &= (1ULL << bankPtr->numPins) - 1;
+    }
+
+    return SetLineValues(bankPtr, mask, values);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release a bank, freeing its pins.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_gpioBank_Release
+(
+    le_gpioBank_BankRef_t bank          ///< [IN] Bank to release.
+)
+{
+    Bank_t* bankPtr = LookupBank(bank);
+
+    if (bankPtr != NULL)
+    {
+        ReleaseBank(bankPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Register a callback function to be called when a pin of an input bank changes state.
+ *
+ * @return
+ *      - Reference to the handler.
+ *      - NULL on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_gpioBank_ChangeEventHandlerRef_t le_gpioBank_AddChangeEventHandler
+(
+    le_gpioBank_BankRef_t bank,                 ///< [IN] Bank to monitor.
+    le_gpioBank_Edge_t trigger,                 ///< [IN] Change(s) that should trigger the callback.
+    le_gpioBank_ChangeHandlerFunc_t handlerPtr, ///< [IN] The callback function.
+    void* contextPtr                            ///< [IN] Client context.
+)
+{
+    char monitorName[32];
+    Bank_t* bankPtr = LookupBank(bank);
+
+    if (bankPtr == NULL)
+    {
+        return NULL;
+    }
+
+    if (bankPtr->isOutput)
+    {
+        LE_ERROR("Attempt to monitor output bank %p", bank);
+        return NULL;
+    }
+
+    if (bankPtr->handlerPtr != NULL)
+    {
+        LE_KILL_CLIENT("Only one change handler can be registered per bank");
+        return NULL;
+    }
+
+    if (SetLineEdge(bankPtr, trigger) != LE_OK)
+    {
+        return NULL;
+    }
+
+    bankPtr->handlerPtr = handlerPtr;
+    bankPtr->contextPtr = contextPtr;
+    bankPtr->handlerRef = le_ref_CreateRef(HandlerRefMap, bankPtr);
+
+    snprintf(monitorName, sizeof(monitorName), "GpioBank%p", bank);
+    bankPtr->fdMonitor = le_fdMonitor_Create(monitorName, bankPtr->fd, EdgeEventHandler, POLLIN);
+    le_fdMonitor_SetContextPtr(bankPtr->fdMonitor, bankPtr);
+
+    return bankPtr->handlerRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove the change callback function of a bank.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_gpioBank_RemoveChangeEventHandler
+(
+    le_gpioBank_ChangeEventHandlerRef_t handlerRef  ///< [IN] Reference to the handler.
+)
+{
+    Bank_t* bankPtr = le_ref_Lookup(HandlerRefMap, handlerRef);
+
+    if ((bankPtr == NULL) || (LookupBank(bankPtr->ref) == NULL))
+    {
+        LE_WARN("Invalid change handler reference %p", handlerRef);
+        return;
+    }
+
+    RemoveChangeHandler(bankPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the GPIO bank service.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioCdev_Initialize
+(
+    gpioSysfs_Design_t gpioDesign    ///< [IN] Current GPIO design for sysfs
+)
+{
+    BankPool = le_mem_CreatePool("GpioBankPool", sizeof(Bank_t));
+    le_mem_ExpandPool(BankPool, BANK_POOL_SIZE);
+    BankRefMap = le_ref_CreateMap("GpioBankRefMap", BANK_POOL_SIZE);
+    HandlerRefMap = le_ref_CreateMap("GpioBankHandlerRefMap", BANK_POOL_SIZE);
+
+    le_msg_AddServiceCloseHandler(le_gpioBank_GetServiceRef(), SessionCloseHandler, NULL);
+
+#ifdef GPIO_V2_GET_LINE_IOCTL
+    IsSupported = (gpioDesign == SYSFS_GPIO_DESIGN_V1);
+#endif
+    LE_INFO("GPIO banks %ssupported", IsSupported ? "" : "not ");
+}
@@ -0,0 +1,30 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Definitions of the functions of the GPIO bank service, which uses the GPIO character device
+ * interface presented by the Linux kernel
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef GPIOCDEV_INTERFACE_H_INCLUDE_GUARD
+#define GPIOCDEV_INTERFACE_H_INCLUDE_GUARD
+
+
+#include "legato.h"
+#include "gpioSysfs.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the GPIO bank service.  Banks can only be requested with the legacy GPIO design,
+ * as the GPIO numbers of the V2 design are aliases that the character device doesn't know.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioCdev_Initialize
+(
+    gpioSysfs_Design_t gpioDesign    ///< [IN] Current GPIO design for sysfs
+);
+
+
+#endif // GPIOCDEV_INTERFACE_H_INCLUDE_GUARD
@@ -14,6 +14,14 @@
 #include "legato.h"
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Max and Min Pin Numbers
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIOSYSFS_MAX_PIN_NUMBER 64
+#define GPIOSYSFS_MIN_PIN_NUMBER 1
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Reference to a GPIO object.
@@ -283,9 +291,8 @@ le_result_t gpioSysfs_Deactivate
 void* gpioSysfs_SetChangeCallback
 (
     gpioSysfs_GpioRef_t gpioRef,                  ///< [IN] GPIO object reference
-    le_fdMonitor_HandlerFunc_t fdMonFunc,         ///< [IN] The fd monitor function
     gpioSysfs_EdgeSensivityMode_t edge,           ///< [IN] Change(s) that should trigger the callback
-    le_gpioPin2_ChangeCallbackFunc_t handlerPtr,  ///< [IN] The change callback
+    gpioSysfs_ChangeCallbackFunc_t handlerPtr,    ///< [IN] The change callback
     void* contextPtr,                             ///< [IN] A context pointer
     int32_t sampleMs                              ///< [IN] If not interrupt capable, sample this often (ms).
 );
@@ -391,19 +398,6 @@ bool gpioSysfs_IsInput
     gpioSysfs_GpioRef_t gpioRef         ///< [IN] GPIO object reference
 );
 
-//--------------------------------------------------------------------------------------------------
-/**
- * This function will be called when there is a state change on a GPIO
- *
- */
-//--------------------------------------------------------------------------------------------------
-void gpioSysfs_InputMonitorHandlerFunc
-(
-    const gpioSysfs_GpioRef_t gpioRefPtr,
-    int fd,
-    short events
-);
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Function to be called when the client-server session opens. This allows the relationship
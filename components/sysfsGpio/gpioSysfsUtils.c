@@ -23,14 +23,6 @@
 #define SYSFS_GPIO_ALIAS_PREFIX   "/v2/alias_"
 #define SYSFS_GPIO_ALIASES_PATH   "/v2/aliases_exported/"
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Max and Min Pin Numbers
- */
-//--------------------------------------------------------------------------------------------------
-#define MAX_PIN_NUMBER 64
-#define MIN_PIN_NUMBER 1
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Static absolute path to export, unexport and GPIO pin entries
@@ -596,6 +588,61 @@ le_result_t gpioSysfs_SetPolarity
     return WriteSysGpioSignalAttr(path, attr);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function will be called when there is a state change on a GPIO. The GPIO is the context
+ * of the fd monitor, so a single handler serves all the pins.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InputMonitorHandler
+(
+    int fd,
+    short events
+)
+{
+    const gpioSysfs_GpioRef_t gpioRef = le_fdMonitor_GetContextPtr();
+
+    //We're reading a single character
+    char buf[1];
+
+    LE_DEBUG("Input handler called for %s", gpioRef->gpioName);
+
+    // Make sure the pin is in use and this isn't a spurious interrupt
+    if (!gpioRef->inUse)
+    {
+        LE_WARN("Spurious interrupt handled - ignoring");
+        return;
+    }
+
+    // Seek to the start of the file - this is required to prevent
+    // repeated triggers - see https://www.kernel.org/doc/Documentation/gpio/sysfs.txt
+    LE_DEBUG("Seek to start of file %d", fd);
+    lseek(fd, 0, SEEK_SET);
+
+    if (read(fd, buf, 1) != 1)
+    {
+        LE_ERROR("Unable to read value for GPIO %s", gpioRef->gpioName);
+        return;
+    }
+
+    LE_DEBUG("Read value %c from value file for callback", buf[0]);
+
+    // Look up the callback function
+    gpioSysfs_ChangeCallbackFunc_t handlerPtr = (gpioSysfs_ChangeCallbackFunc_t)gpioRef->handlerPtr;
+
+    if (handlerPtr != NULL)
+    {
+        LE_DEBUG("Calling change callback for %s", gpioRef->gpioName);
+        handlerPtr(buf[0]=='1', gpioRef->callbackContextPtr);
+    }
+    else
+    {
+        LE_WARN("No callback registered for pin %s", gpioRef->gpioName);
+    }
+
+    return;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set a change callback on a particular pin
@@ -606,7 +653,6 @@ le_result_t gpioSysfs_SetPolarity
 void* gpioSysfs_SetChangeCallback
 (
     gpioSysfs_GpioRef_t gpioRef,                  ///< [IN] GPIO object reference
-    le_fdMonitor_HandlerFunc_t fdMonFunc,         ///< [IN] The fd monitor function
     gpioSysfs_EdgeSensivityMode_t edge,           ///< [IN] Edge detection mode.
     gpioSysfs_ChangeCallbackFunc_t handlerPtr,    ///< [IN]
     void* contextPtr,                             ///< [IN]
@@ -681,7 +727,9 @@ void* gpioSysfs_SetChangeCallback
     }
 
     LE_DEBUG("Setting up file monitor for fd %d and pin %s", monFd, gpioRef->gpioName);
-    gpioRef->fdMonitor = le_fdMonitor_Create (gpioRef->gpioName, monFd, fdMonFunc, POLLPRI);
+    gpioRef->fdMonitor = le_fdMonitor_Create (gpioRef->gpioName, monFd, InputMonitorHandler,
+                                              POLLPRI);
+    le_fdMonitor_SetContextPtr(gpioRef->fdMonitor, gpioRef);
 
     return gpioRef;
 }
@@ -1066,61 +1114,6 @@ le_result_t gpioSysfs_SetEdgeSense
     return SetEdgeSense(gpioRef, edge);
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * This function will be called when there is a state change on a GPIO
- *
- */
-//--------------------------------------------------------------------------------------------------
-void gpioSysfs_InputMonitorHandlerFunc
-(
-    const gpioSysfs_GpioRef_t gpioRef,
-    int fd,
-    short events
-)
-{
-    //We're reading a single character
-    char buf[1];
-
-    LE_DEBUG("Input handler called for %s", gpioRef->gpioName);
-
-    // Make sure the pin is in use and this isn't a spurious interrupt
-    if (!gpioRef->inUse)
-    {
-        LE_WARN("Spurious interrupt handled - ignoring");
-        return;
-    }
-
-    // Seek to the start of the file - this is required to prevent
-    // repeated triggers - see https://www.kernel.org/doc/Documentation/gpio/sysfs.txt
-    LE_DEBUG("Seek to start of file %d", fd);
-    lseek(fd, 0, SEEK_SET);
-
-    if (read(fd, buf, 1) != 1)
-    {
-        LE_ERROR("Unable to read value for GPIO %s", gpioRef->gpioName);
-        return;
-    }
-
-    LE_DEBUG("Read value %c from value file for callback", buf[0]);
-
-    // Look up the callback function
-    gpioSysfs_ChangeCallbackFunc_t handlerPtr = (gpioSysfs_ChangeCallbackFunc_t)gpioRef->handlerPtr;
-
-    if (handlerPtr != NULL)
-    {
-        LE_DEBUG("Calling change callback for %s", gpioRef->gpioName);
-        handlerPtr(buf[0]=='1', gpioRef->callbackContextPtr);
-    }
-    else
-    {
-        LE_WARN("No callback registered for pin %s", gpioRef->gpioName);
-    }
-
-    return;
-}
-
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Function will be called when the client-server session opens. This allows the relationship
@@ -1246,7 +1239,7 @@ bool gpioSysfs_IsPinAvailable
     uint32_t index;
     uint32_t bitInMask;
 
-    if ((pinNum < MIN_PIN_NUMBER) || (pinNum > MAX_PIN_NUMBER))
+    if ((pinNum < GPIOSYSFS_MIN_PIN_NUMBER) || (pinNum > GPIOSYSFS_MAX_PIN_NUMBER))
     {
         LE_WARN("Pin number %d is out of range", pinNum);
         return false;
@@ -51,6 +51,39 @@ static ni_IteratorRef_t GetIteratorFromRef
 
 
 
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write the next chunk of an export.  If there's more to write, the rest is queued up for after any
+ *  other pending work, otherwise the export is finished and the reply sent.
+ */
+// -------------------------------------------------------------------------------------------------
+static void ContinueExport
+(
+    void* exportPtr,  ///< [IN] The export being written.
+    void* commandPtr  ///< [IN] Reference used to reply to the export request.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_ExportRef_t exportRef = exportPtr;
+    le_cfgAdmin_ServerCmdRef_t commandRef = commandPtr;
+
+    le_result_t result = tdb_ContinueExport(exportRef, LE_CONFIG_CFGTREE_EXPORT_CHUNK_NODES);
+
+    if (result == LE_IN_PROGRESS)
+    {
+        le_event_QueueFunction(ContinueExport, exportRef, commandRef);
+        return;
+    }
+
+    tdb_EndExport(exportRef);
+
+    le_cfgAdmin_ExportTreeRespond(commandRef, (result == LE_OK) ? LE_OK : LE_FAULT);
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Read a subset of the configuration tree from the given filePath. That tree then overwrites the
@@ -60,6 +93,9 @@ static ni_IteratorRef_t GetIteratorFromRef
  *  you to create an iterator on a given node. Import a sub-tree, and then examine the contents of
  *  the import before deciding to commit the new data.
  *
+ *  The file can either be in the text format written by le_cfgAdmin_ExportTree(), or be a tree
+ *  image as generated by mksys --binary-config.
+ *
  *  \b Responds \b With:
  *
  *  Responds with one of the following values:
@@ -101,6 +137,28 @@ void le_cfgAdmin_ImportTree
     }
     else
     {
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+        // Tree images, (as generated by mksys --binary-config,) are copied in without parsing.
+        switch (tdb_ReadTreeImage(nodeRef, filePathPtr))
+        {
+            case LE_OK:
+                le_cfgAdmin_ImportTreeRespond(commandRef, LE_OK);
+                return;
+
+            case LE_NOT_FOUND:
+                // This is a text file, parse it below.
+                break;
+
+            case LE_FORMAT_ERROR:
+                le_cfgAdmin_ImportTreeRespond(commandRef, LE_FORMAT_ERROR);
+                return;
+
+            default:
+                le_cfgAdmin_ImportTreeRespond(commandRef, LE_FAULT);
+                return;
+        }
+#endif
+
         // Open the requested file.
         LE_DEBUG("Opening file '%s'.", filePathPtr);
 
@@ -146,7 +204,8 @@ void le_cfgAdmin_ImportTree
  *  Take a node given from nodePath and stream it and it's children to the file given by filePath.
  *
  *  This function uses the iterator's read transaction, and takes a snapshot of the current state of
- *  the tree.  The data write happens immediately.
+ *  the tree.  The snapshot is written out a chunk at a time, so that other requests are handled
+ *  while a large tree is exported, and the reply is sent once it's all been written.
  *
  *  \b Responds \b With:
  *
@@ -197,16 +256,9 @@ void le_cfgAdmin_ExportTree
 
     LE_DEBUG("Exporting config data.");
 
-    le_result_t result = LE_OK;
-
-    if (tdb_WriteTreeNode(ni_GetNode(iteratorRef, nodePathPtr), filePtr) != LE_OK)
-    {
-        result = LE_FAULT;
-    }
-
-    fclose(filePtr);
-
-    le_cfgAdmin_ExportTreeRespond(commandRef, result);
+    // The export is written from a copy of the node, a chunk at a time, and the reply is sent once
+    // it's done.
+    ContinueExport(tdb_StartExport(ni_GetNode(iteratorRef, nodePathPtr), filePtr), commandRef);
 }
 
 
@@ -744,6 +744,73 @@ void le_cfg_RemoveChangeHandler
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Register a call back on a given node object.  Once registered, this function is called at most
+ *  once per commit (or once per hold-off time) with the list of changed paths at or below the node.
+ *
+ *  @return A handle to the event registration.
+ */
+// -------------------------------------------------------------------------------------------------
+le_cfg_CoalescedChangeHandlerRef_t le_cfg_AddCoalescedChangeHandler
+(
+    const char* newPathPtr,                          ///< [IN] Path to the object to watch.
+    uint32_t holdOffMs,                              ///< [IN] Time to gather changes for, 0 to
+                                                     ///<      notify at the end of each commit.
+    le_cfg_CoalescedChangeHandlerFunc_t handlerPtr,  ///< [IN] Function to call back.
+    void* contextPtr                                 ///< [IN] Context to give the function when
+                                                     ///<      called.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tu_UserRef_t userRef = tu_GetCurrentConfigUserInfo();
+    le_cfg_CoalescedChangeHandlerRef_t handlerRef = NULL;
+
+    if (userRef != NULL)
+    {
+        tdb_TreeRef_t treeRef = tu_GetRequestedTree(userRef, TU_TREE_READ, newPathPtr);
+
+        if (treeRef != NULL)
+        {
+            handlerRef = tdb_AddCoalescedChangeHandler(treeRef,
+                                                       le_cfg_GetClientSessionRef(),
+                                                       newPathPtr,
+                                                       holdOffMs,
+                                                       handlerPtr,
+                                                       contextPtr);
+        }
+    }
+
+    if (handlerRef == NULL)
+    {
+        tu_TerminateConfigClient(le_cfg_GetClientSessionRef(),
+                                 "Change handler registration failed.");
+    }
+
+    return handlerRef;
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function removes a coalesced change handler.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_cfg_RemoveCoalescedChangeHandler
+(
+    le_cfg_CoalescedChangeHandlerRef_t handlerRef  ///< [IN] Previously registered handler to
+                                                   ///<      remove.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_RemoveCoalescedChangeHandler(handlerRef, le_cfg_GetClientSessionRef());
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 //  Transactional reading/writing, creation/deletion.
 // -------------------------------------------------------------------------------------------------
@@ -1373,6 +1440,339 @@ void le_cfg_SetBool
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Check whether an iterator's bulk transfer is the one a request carries on with.
+ *
+ *  @return true if the request is for the next piece of the iterator's transfer.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool IsBulkInProgress
+(
+    const ni_Bulk_t* bulkPtr,  ///< [IN] The iterator's bulk transfer.
+    const char* pathPtr,       ///< [IN] Path given by the request.
+    bool isWrite,              ///< [IN] true for le_cfg_SetSubtree(), false for
+                               ///<      le_cfg_GetSubtree().
+    uint32_t offset            ///< [IN] Offset given by the request.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    return    (offset != 0)
+           && (bulkPtr->pathPtr != NULL)
+           && (bulkPtr->isWrite == isWrite)
+           && (strcmp(bulkPtr->pathPtr, pathPtr) == 0);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Start a new bulk transfer on an iterator, replacing the one in progress.
+ */
+// -------------------------------------------------------------------------------------------------
+static void StartBulk
+(
+    ni_IteratorRef_t iteratorRef,  ///< [IN] Iterator to start the transfer on.
+    const char* pathPtr,           ///< [IN] Path of the node being transferred.
+    bool isWrite                   ///< [IN] true for le_cfg_SetSubtree(), false for
+                                   ///<      le_cfg_GetSubtree().
+)
+// -------------------------------------------------------------------------------------------------
+{
+    ni_DropBulk(iteratorRef);
+
+    ni_Bulk_t* bulkPtr = ni_GetBulk(iteratorRef);
+
+    bulkPtr->pathPtr = strdup(pathPtr);
+    LE_ASSERT(bulkPtr->pathPtr != NULL);
+    bulkPtr->isWrite = isWrite;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Serialize a subtree into the iterator's bulk transfer, replacing what was there.
+ *
+ *  @return LE_OK if the subtree was serialized, LE_NOT_FOUND if the node doesn't exist.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t SerializeBulk
+(
+    ni_IteratorRef_t iteratorRef,  ///< [IN] Iterator to read with.
+    const char* pathPtr            ///< [IN] Path to the node to serialize.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    ni_DropBulk(iteratorRef);
+
+    if (ni_NodeExists(iteratorRef, pathPtr) == false)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    StartBulk(iteratorRef, pathPtr, false);
+
+    ni_Bulk_t* bulkPtr = ni_GetBulk(iteratorRef);
+    FILE* filePtr = open_memstream(&bulkPtr->dataPtr, &bulkPtr->size);
+
+    LE_FATAL_IF(filePtr == NULL, "Could not open a memory stream, %m.");
+
+    le_result_t result = tdb_WriteTreeNode(ni_GetNode(iteratorRef, pathPtr), filePtr);
+
+    fclose(filePtr);
+
+    if (result != LE_OK)
+    {
+        ni_DropBulk(iteratorRef);
+    }
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a node and all of its children in one go, serialized in the config tree's text format.
+ *  Subtrees too large for the client's buffer are returned in pieces, starting at the given offset.
+ *  The serialized subtree is kept with the iterator until its last piece has been read, so each
+ *  iterator can be reading its own subtree at the same time.
+ *
+ *  Valid for both read and write transactions.
+ *
+ *  If the path is empty, the iterator's current node will be read.
+ *
+ *  \b Responds \b With:
+ *
+ *  This function will respond with one of the following values:
+ *
+ *          - LE_OK             - The data holds the (rest of the) subtree.
+ *          - LE_OVERFLOW       - The data is full, and there is more of the subtree to read.
+ *          - LE_NOT_FOUND      - The node doesn't exist.
+ *          - LE_OUT_OF_RANGE   - The offset is past the end of the subtree.
+ */
+// -------------------------------------------------------------------------------------------------
+void le_cfg_GetSubtree
+(
+    le_cfg_ServerCmdRef_t commandRef,  ///< [IN] Reference used to generate a reply for this
+                                       ///<      request.
+    le_cfg_IteratorRef_t externalRef,  ///< [IN] Iterator to use as a basis for the transaction.
+    const char* pathPtr,               ///< [IN] Absolute or relative path to read from.
+    uint32_t offset,                   ///< [IN] Offset into the serialized subtree to read from.
+    size_t maxData                     ///< [IN] Maximum size of the data to return.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_DEBUG("** Reading the subtree of the iterator's <%p> current node, from offset %" PRIu32 ".",
+             externalRef,
+             offset);
+    LE_DEBUG_IF((pathPtr != NULL) && (strlen(pathPtr) != 0), "** Offset by \"%s\"", pathPtr);
+
+    ni_IteratorRef_t iteratorRef = GetIteratorFromRef(externalRef);
+    le_result_t result = LE_NOT_FOUND;
+
+    if (   (NULL == pathPtr)
+        || (NULL == iteratorRef)
+        || (true == CheckPathForSpecifier(pathPtr)))
+    {
+        le_cfg_GetSubtreeRespond(commandRef, result, NULL, 0);
+        return;
+    }
+
+    // Carry on with the iterator's subtree if this is the next piece of it, otherwise start afresh.
+    ni_Bulk_t* bulkPtr = ni_GetBulk(iteratorRef);
+
+    if (IsBulkInProgress(bulkPtr, pathPtr, false, offset))
+    {
+        result = LE_OK;
+    }
+    else
+    {
+        result = SerializeBulk(iteratorRef, pathPtr);
+    }
+
+    if (result != LE_OK)
+    {
+        le_cfg_GetSubtreeRespond(commandRef, result, NULL, 0);
+        return;
+    }
+
+    if (offset > bulkPtr->size)
+    {
+        ni_DropBulk(iteratorRef);
+        le_cfg_GetSubtreeRespond(commandRef, LE_OUT_OF_RANGE, NULL, 0);
+        return;
+    }
+
+    size_t count = bulkPtr->size - offset;
+
+    if (count > maxData)
+    {
+        count = maxData;
+        result = LE_OVERFLOW;
+    }
+
+    le_cfg_GetSubtreeRespond(commandRef,
+                             result,
+                             (const uint8_t*)bulkPtr->dataPtr + offset,
+                             count);
+
+    if (result == LE_OK)
+    {
+        ni_DropBulk(iteratorRef);
+    }
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Replace a node and all of its children with the subtree serialized in an iterator's bulk
+ *  transfer.
+ *
+ *  @return LE_OK if the subtree was written, LE_FORMAT_ERROR if it couldn't be parsed, (the node is
+ *          left empty,) or LE_NOT_FOUND if the node couldn't be created.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t WriteBulk
+(
+    ni_IteratorRef_t iteratorRef,  ///< [IN] Iterator to write with.
+    const char* pathPtr,           ///< [IN] Path to the node to replace.
+    const ni_Bulk_t* bulkPtr       ///< [IN] The serialized subtree.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_NodeRef_t nodeRef = ni_TryCreateNode(iteratorRef, pathPtr);
+
+    if (nodeRef == NULL)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    le_result_t result = LE_FORMAT_ERROR;
+    FILE* filePtr = NULL;
+
+    if (bulkPtr->size > 0)
+    {
+        filePtr = fmemopen(bulkPtr->dataPtr, bulkPtr->size, "r");
+    }
+
+    if (   (filePtr != NULL)
+        && (tdb_ReadTreeNode(nodeRef, filePtr)))
+    {
+        result = LE_OK;
+    }
+    else
+    {
+        tdb_SetEmpty(nodeRef);
+    }
+
+    if (filePtr != NULL)
+    {
+        fclose(filePtr);
+    }
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Replace a node and all of its children with a subtree serialized in the config tree's text
+ *  format.  Only valid during a write transaction.
+ *
+ *  Subtrees too large for one request are sent in pieces.  Each piece is added to the iterator's
+ *  bulk transfer, and the subtree is written when the last piece arrives.
+ *
+ *  If the path is empty, the iterator's current node will be replaced.
+ *
+ *  \b Responds \b With:
+ *
+ *  This function will respond with one of the following values:
+ *
+ *          - LE_OK             - The subtree was written, or the piece was received.
+ *          - LE_FORMAT_ERROR   - The data couldn't be parsed.  The node is left empty.
+ *          - LE_NOT_FOUND      - The node couldn't be created.
+ *          - LE_OUT_OF_RANGE   - The offset isn't the number of bytes received so far.
+ */
+// -------------------------------------------------------------------------------------------------
+void le_cfg_SetSubtree
+(
+    le_cfg_ServerCmdRef_t commandRef,  ///< [IN] Reference used to generate a reply for this
+                                       ///<      request.
+    le_cfg_IteratorRef_t externalRef,  ///< [IN] Iterator to use as a basis for the transaction.
+    const char* pathPtr,               ///< [IN] Full or relative path to the node to replace.
+    uint32_t offset,                   ///< [IN] Offset of this piece in the serialized subtree.
+    bool more,                         ///< [IN] true if more pieces follow this one.
+    const uint8_t* dataPtr,            ///< [IN] This piece of the serialized subtree.
+    size_t dataSize                    ///< [IN] Size of this piece.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_DEBUG("** Replacing the subtree of the iterator's <%p> current node, "
+             "%" PRIuS " bytes at offset %" PRIu32 ".",
+             externalRef,
+             dataSize,
+             offset);
+    LE_DEBUG_IF((pathPtr != NULL) && (strlen(pathPtr) != 0), "** Offset by \"%s\"", pathPtr);
+
+    ni_IteratorRef_t iteratorRef = GetWriteIteratorFromRef(externalRef);
+
+    if (   (NULL == pathPtr)
+        || (NULL == iteratorRef)
+        || (true == CheckPathForSpecifier(pathPtr)))
+    {
+        le_cfg_SetSubtreeRespond(commandRef, LE_NOT_FOUND);
+        return;
+    }
+
+    // Add this piece to the iterator's transfer, which the first piece starts afresh.
+    ni_Bulk_t* bulkPtr = ni_GetBulk(iteratorRef);
+
+    if (offset == 0)
+    {
+        StartBulk(iteratorRef, pathPtr, true);
+    }
+    else if (   (IsBulkInProgress(bulkPtr, pathPtr, true, offset) == false)
+             || (offset != bulkPtr->size))
+    {
+        ni_DropBulk(iteratorRef);
+        le_cfg_SetSubtreeRespond(commandRef, LE_OUT_OF_RANGE);
+        return;
+    }
+
+    if (dataSize > 0)
+    {
+        char* newDataPtr = realloc(bulkPtr->dataPtr, bulkPtr->size + dataSize);
+        LE_ASSERT(newDataPtr != NULL);
+
+        memcpy(newDataPtr + bulkPtr->size, dataPtr, dataSize);
+        bulkPtr->dataPtr = newDataPtr;
+        bulkPtr->size += dataSize;
+    }
+
+    le_result_t result = LE_OK;
+
+    if (!more)
+    {
+        result = WriteBulk(iteratorRef, pathPtr, bulkPtr);
+        ni_DropBulk(iteratorRef);
+    }
+
+    le_cfg_SetSubtreeRespond(commandRef, result);
+}
+
+
+
+
+
 
 // -------------------------------------------------------------------------------------------------
 //  Basic reading/writing, creation/deletion.
@@ -17,58 +17,83 @@
 
 
 /// This value is stored in the string header block so that the access functions can make sure that
-/// the string is valid.
+/// the string is valid.  The text of strings with this value is stored in a list of segments.
 #define HEADER_MAGIC 0xdca00acd
 
 
+/// Header value of strings whose text is short enough to be stored in the header block itself.
+#define INLINE_MAGIC 0xdca00ace
 
 
-/// This macro will use the HEADER_MAGIC value to perform a sanity check on a string object supplied
-/// to this API.
+
+
+/// This macro will use the header magic values to perform a sanity check on a string object
+/// supplied to this API.
 #define VALIDATE_HEADER(strPtr) \
     LE_FATAL_IF((strPtr) == NULL, "Trying to access a NULL dynamic string."); \
-    LE_FATAL_IF((strPtr)->head.magic != HEADER_MAGIC, "Corrupted dynamic string detected.");
+    LE_FATAL_IF(   ((strPtr)->head.magic != HEADER_MAGIC) \
+                && ((strPtr)->head.magic != INLINE_MAGIC), \
+                "Corrupted dynamic string detected.");
+
+
+/// Is the string's text stored in its header block?
+#define IS_INLINE(strPtr) ((strPtr)->head.magic == INLINE_MAGIC)
+
+
+
+
+/// Define how big the text in a segment is.
+#define SEGMENT_SIZE (size_t)32
 
 
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Node that represents the head of a dynamic string.
+ *  Strings are made up of pool-allocated segments.  The SEGMENT_SIZE should be tuned for optimal
+ *  efficiency.
  */
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
-    int32_t magic;       ///< Safety value.  If this isn't set to HEADER_MAGIC then the string is
-                         ///<   invalid.
-    le_sls_List_t list;  ///< The list of the segments that this string is made up of.
-
-    // TODO: Other quick access stats as needed.  Like byte and char counts.
+    char value[SEGMENT_SIZE];  ///< Buffer to hold the actual text of the string.  Each buffer is
+                               ///<   expected to be NULL terminated.
+    le_sls_Link_t link;        ///< Link to the next node in the chain.
 }
-HeadNode_t;
+BodyNode_t;
 
 
 
 
-/// Define how big the text in a segment is.
-#define SEGMENT_SIZE (size_t)32
+/// How much text can be stored in a header block, including the terminating NULL.  The header uses
+/// the whole of the block that a segment would.
+#define INLINE_SIZE (sizeof(BodyNode_t) - (2 * sizeof(uint32_t)))
 
 
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Strings are made up of pool-allocated segments.  The SEGMENT_SIZE should be tuned for optimal
- *  efficiency.
+ *  Node that represents the head of a dynamic string.
+ *
+ *  Most strings in a tree, node names especially, are short.  Those are kept in the header block,
+ *  so that they need only the one block, and segments are only chained on for longer strings.
  */
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
-    char value[SEGMENT_SIZE];  ///< Buffer to hold the actual text of the string.  Each buffer is
-                               ///<   expected to be NULL terminated.
-    le_sls_Link_t link;        ///< Link to the next node in the chain.
+    uint32_t magic;            ///< Safety value.  HEADER_MAGIC if the text is in segments,
+                               ///<   INLINE_MAGIC if it's in the header.  If this isn't set to
+                               ///<   either the string is invalid.
+    uint32_t internCount;      ///< If non-zero, the string is interned and this is the number of
+                               ///<   references to it.  Interned strings are read only.
+    union
+    {
+        le_sls_List_t list;        ///< The list of the segments that this string is made up of.
+        char text[INLINE_SIZE];    ///< The text of an inline string.
+    };
 }
-BodyNode_t;
+HeadNode_t;
 
 
 
@@ -105,6 +130,14 @@ LE_MEM_DEFINE_STATIC_POOL(dynamicStringPool,
                           sizeof(Dstr_t));
 
 
+/// Define static memory for the table of interned strings.
+LE_HASHMAP_DEFINE_STATIC(InternTable, LE_CONFIG_CFGTREE_MAX_INTERNED_STRINGS);
+
+/// Table of the interned strings, keyed by their text.  Only strings that are stored inline are
+/// interned, so their text can be used as the key.
+static le_hashmap_Ref_t InternTableRef = NULL;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Create a new, blank segment ready to be inserted into a string.
@@ -279,6 +312,77 @@ static void FreeAnyAfter
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Make sure that a string is one that may be modified.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ValidateWritable
+(
+    dstr_Ref_t strRef  ///< [IN] The string about to be modified.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    VALIDATE_HEADER(strRef);
+    LE_FATAL_IF(strRef->head.internCount != 0, "Trying to modify an interned dynamic string.");
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Switch a string over to inline storage, freeing any segments it had.  The string is left empty.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MakeInline
+(
+    dstr_Ref_t strRef  ///< [IN] The string to update.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (!IS_INLINE(strRef))
+    {
+        dstr_Ref_t segmentRef = FirstSegmentRef(strRef);
+
+        while (segmentRef != NULL)
+        {
+            dstr_Ref_t nextSegmentRef = NextSegmentRef(strRef, segmentRef);
+
+            le_mem_Release(segmentRef);
+            segmentRef = nextSegmentRef;
+        }
+
+        strRef->head.magic = INLINE_MAGIC;
+    }
+
+    strRef->head.text[0] = '\0';
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Switch a string over to segment storage.  If the string was stored inline, it's left empty.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MakeSegmented
+(
+    dstr_Ref_t strRef  ///< [IN] The string to update.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (IS_INLINE(strRef))
+    {
+        strRef->head.magic = HEADER_MAGIC;
+        strRef->head.list = LE_SLS_LIST_INIT;
+    }
+}
+
+
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Init the dynamic string API and the internal memory resources it depends on.
@@ -296,6 +400,11 @@ void dstr_Init
                                                  LE_CONFIG_CFGTREE_MAX_DSTRING_POOL_SIZE,
                                                  sizeof(Dstr_t));
     le_mem_SetNumObjsToForce(DynamicStringPoolRef, 100);    // Grow in chunks of 100 blocks.
+
+    InternTableRef = le_hashmap_InitStatic(InternTable,
+                                           LE_CONFIG_CFGTREE_MAX_INTERNED_STRINGS,
+                                           le_hashmap_HashString,
+                                           le_hashmap_EqualsString);
 }
 
 
@@ -314,8 +423,9 @@ dstr_Ref_t dstr_New
 {
     dstr_Ref_t newHeadRef = le_mem_ForceAlloc(DynamicStringPoolRef);
 
-    newHeadRef->head.magic = HEADER_MAGIC;
-    newHeadRef->head.list = LE_SLS_LIST_INIT;
+    newHeadRef->head.magic = INLINE_MAGIC;
+    newHeadRef->head.internCount = 0;
+    newHeadRef->head.text[0] = '\0';
 
     return newHeadRef;
 }
@@ -345,7 +455,8 @@ dstr_Ref_t dstr_NewFromCstr
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Create a new dynamic string that is a copy of a pre-existing one.
+ *  Create a new dynamic string that is a copy of a pre-existing one.  If the original is interned,
+ *  then it's shared rather than copied.
  */
 //--------------------------------------------------------------------------------------------------
 dstr_Ref_t dstr_NewFromDstr
@@ -354,6 +465,14 @@ dstr_Ref_t dstr_NewFromDstr
 )
 //--------------------------------------------------------------------------------------------------
 {
+    VALIDATE_HEADER(originalStrPtr);
+
+    if (originalStrPtr->head.internCount != 0)
+    {
+        originalStrPtr->head.internCount++;
+        return originalStrPtr;
+    }
+
     dstr_Ref_t newStringRef = dstr_New();
 
     dstr_Copy(newStringRef, originalStrPtr);
@@ -373,16 +492,21 @@ void dstr_Release
 )
 //--------------------------------------------------------------------------------------------------
 {
-    dstr_Ref_t segmentRef = FirstSegmentRef(strRef);
+    VALIDATE_HEADER(strRef);
 
-    while (segmentRef != NULL)
+    if (strRef->head.internCount != 0)
     {
-        dstr_Ref_t nextSegmentRef = NextSegmentRef(strRef, segmentRef);
+        strRef->head.internCount--;
 
-        le_mem_Release(segmentRef);
-        segmentRef = nextSegmentRef;
+        if (strRef->head.internCount != 0)
+        {
+            return;
+        }
+
+        le_hashmap_Remove(InternTableRef, strRef->head.text);
     }
 
+    MakeInline(strRef);
     le_mem_Release(strRef);
 }
 
@@ -414,6 +538,13 @@ le_result_t dstr_CopyToCstr
         *totalCopied = 0;
     }
 
+    VALIDATE_HEADER(sourceStrRef);
+
+    if (IS_INLINE(sourceStrRef))
+    {
+        return le_utf8_Copy(destStrPtr, sourceStrRef->head.text, destStrMax, totalCopied);
+    }
+
     for (segmentRef = FirstSegmentRef(sourceStrRef);
          segmentRef != NULL;
          segmentRef = NextSegmentRef(sourceStrRef, segmentRef))
@@ -460,6 +591,20 @@ void dstr_CopyFromCstr
 )
 //--------------------------------------------------------------------------------------------------
 {
+    ValidateWritable(destStrRef);
+
+    // Short strings are kept inline, in which case any segments the string had are freed.
+    size_t length = strlen(sourceStrPtr);
+
+    if (length < INLINE_SIZE)
+    {
+        MakeInline(destStrRef);
+        memcpy(destStrRef->head.text, sourceStrPtr, length + 1);
+        return;
+    }
+
+    MakeSegmented(destStrRef);
+
     le_result_t result;
     dstr_Ref_t destSegmentRef = NewOrFirstSegmentRef(destStrRef);
 
@@ -500,6 +645,17 @@ void dstr_Copy
 )
 //--------------------------------------------------------------------------------------------------
 {
+    VALIDATE_HEADER(sourceStrPtr);
+
+    if (IS_INLINE(sourceStrPtr))
+    {
+        dstr_CopyFromCstr(destStrPtr, sourceStrPtr->head.text);
+        return;
+    }
+
+    ValidateWritable(destStrPtr);
+    MakeSegmented(destStrPtr);
+
     dstr_Ref_t sourceSegmentRef = FirstSegmentRef(sourceStrPtr);
     dstr_Ref_t destSegmentRef = NewOrFirstSegmentRef(destStrPtr);
 
@@ -541,6 +697,13 @@ bool dstr_IsNullOrEmpty
     }
 
     // Also, consider the string empty if the first character is NULL.
+    VALIDATE_HEADER(strRef);
+
+    if (IS_INLINE(strRef))
+    {
+        return strRef->head.text[0] == '\0';
+    }
+
     dstr_Ref_t segmentRef = FirstSegmentRef(strRef);
     return (segmentRef == NULL) || (segmentRef->body.value[0] == '\0');
 }
@@ -564,6 +727,15 @@ size_t dstr_NumChars
     dstr_Ref_t segmentRef = NULL;
     size_t count = 0;
 
+    VALIDATE_HEADER(strRef);
+
+    if (IS_INLINE(strRef))
+    {
+        ssize_t localCount = le_utf8_NumChars(strRef->head.text);
+
+        return (localCount == LE_FORMAT_ERROR) ? 0 : localCount;
+    }
+
     for (segmentRef = FirstSegmentRef(strRef);
          segmentRef != NULL;
          segmentRef = NextSegmentRef(strRef, segmentRef))
@@ -600,6 +772,13 @@ size_t dstr_NumBytes
     dstr_Ref_t segmentRef = NULL;
     size_t count = 0;
 
+    VALIDATE_HEADER(strRef);
+
+    if (IS_INLINE(strRef))
+    {
+        return le_utf8_NumBytes(strRef->head.text);
+    }
+
     for (segmentRef = FirstSegmentRef(strRef);
          segmentRef != NULL;
          segmentRef = NextSegmentRef(strRef, segmentRef))
@@ -609,3 +788,80 @@ size_t dstr_NumBytes
 
     return count;
 }
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Get an interned copy of a string.  Interned strings are shared: every call for the same text
+ *  returns the same reference, so interned strings can be compared by reference instead of by
+ *  text.  They are read only, and are released with dstr_Release() like any other string.
+ *
+ *  Only strings short enough to be stored inline are interned.  For longer strings a new string is
+ *  returned, as if by dstr_NewFromCstr().
+ *
+ *  @return A reference to the string.
+ */
+//--------------------------------------------------------------------------------------------------
+dstr_Ref_t dstr_Intern
+(
+    const char* strPtr  ///< [IN] The text of the string.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (strlen(strPtr) >= INLINE_SIZE)
+    {
+        return dstr_NewFromCstr(strPtr);
+    }
+
+    dstr_Ref_t strRef = le_hashmap_Get(InternTableRef, strPtr);
+
+    if (strRef != NULL)
+    {
+        strRef->head.internCount++;
+        return strRef;
+    }
+
+    strRef = dstr_NewFromCstr(strPtr);
+    strRef->head.internCount = 1;
+    le_hashmap_Put(InternTableRef, strRef->head.text, strRef);
+
+    return strRef;
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Look for the interned copy of a string, without creating one.  The text doesn't have to be null
+ *  terminated.
+ *
+ *  @return LE_OK if the interned string was found.
+ *          LE_NOT_FOUND if the text is short enough to be interned, but hasn't been.
+ *          LE_OVERFLOW if the text is too long to be interned.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t dstr_FindInterned
+(
+    const char* strPtr,     ///< [IN]  The text of the string.
+    size_t numBytes,        ///< [IN]  Length of the text, in bytes.
+    dstr_Ref_t* strRefPtr   ///< [OUT] The interned string, if found.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char text[INLINE_SIZE];
+
+    if (numBytes >= sizeof(text))
+    {
+        return LE_OVERFLOW;
+    }
+
+    memcpy(text, strPtr, numBytes);
+    text[numBytes] = '\0';
+
+    *strRefPtr = le_hashmap_Get(InternTableRef, text);
+
+    return (*strRefPtr != NULL) ? LE_OK : LE_NOT_FOUND;
+}
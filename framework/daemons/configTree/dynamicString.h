@@ -67,7 +67,8 @@ dstr_Ref_t dstr_NewFromCstr
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Create a new dynamic string that is a copy of a pre-existing one.
+ *  Create a new dynamic string that is a copy of a pre-existing one.  If the original is interned,
+ *  then it's shared rather than copied.
  */
 //--------------------------------------------------------------------------------------------------
 dstr_Ref_t dstr_NewFromDstr
@@ -186,4 +187,44 @@ size_t dstr_NumBytes
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Get an interned copy of a string.  Interned strings are shared: every call for the same text
+ *  returns the same reference, so interned strings can be compared by reference instead of by
+ *  text.  They are read only, and are released with dstr_Release() like any other string.
+ *
+ *  Only strings short enough to be stored inline are interned.  For longer strings a new string is
+ *  returned, as if by dstr_NewFromCstr().
+ *
+ *  @return A reference to the string.
+ */
+//--------------------------------------------------------------------------------------------------
+dstr_Ref_t dstr_Intern
+(
+    const char* strPtr  ///< [IN] The text of the string.
+);
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Look for the interned copy of a string, without creating one.  The text doesn't have to be null
+ *  terminated.
+ *
+ *  @return LE_OK if the interned string was found.
+ *          LE_NOT_FOUND if the text is short enough to be interned, but hasn't been.
+ *          LE_OVERFLOW if the text is too long to be interned.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t dstr_FindInterned
+(
+    const char* strPtr,     ///< [IN]  The text of the string.
+    size_t numBytes,        ///< [IN]  Length of the text, in bytes.
+    dstr_Ref_t* strRefPtr   ///< [OUT] The interned string, if found.
+);
+
+
+
+
 #endif
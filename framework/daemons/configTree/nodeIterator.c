@@ -60,6 +60,8 @@ typedef struct Iterator
     le_pathIter_Ref_t pathIterRef;   ///< Path to the iterator's current node.
     tdb_NodeRef_t currentNodeRef;    ///< The current node itself.
 
+    ni_Bulk_t bulk;                  ///< Subtree being passed to or from the client in pieces.
+
 
     le_cfg_IteratorRef_t reference;  ///< A safe reference to this iterator object.  This can be
                                      ///<  NULL if the iterator was created without a safe
@@ -209,6 +211,56 @@ static le_result_t CloneAndAppendPath
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Used to move the readers of a tree onto a snapshot of it, before a commit.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct SnapshotInfo
+{
+    tdb_TreeRef_t treeRef;      ///< The tree about to be committed to.
+    tdb_TreeRef_t snapshotRef;  ///< The snapshot to move its readers onto.
+}
+SnapshotInfo_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Called for each active iterator before a commit.  If the iterator is reading the tree being
+ *  committed to, it is moved onto the snapshot, at the same path.
+ */
+//--------------------------------------------------------------------------------------------------
+static void OnIteratorSnapshot
+(
+    ni_ConstIteratorRef_t constIteratorRef,  ///< [IN] The iterator pointer.
+    void* contextPtr                         ///< [IN] The SnapshotInfo_t for the commit.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    ni_IteratorRef_t iteratorRef = (ni_IteratorRef_t)constIteratorRef;
+    SnapshotInfo_t* infoPtr = (SnapshotInfo_t*)contextPtr;
+
+    if (   (iteratorRef->type != NI_READ)
+        || (iteratorRef->treeRef != infoPtr->treeRef))
+    {
+        return;
+    }
+
+    tdb_UnregisterIterator(iteratorRef->treeRef, iteratorRef);
+    tdb_ReleaseTree(iteratorRef->treeRef);
+
+    iteratorRef->treeRef = infoPtr->snapshotRef;
+    tdb_RegisterIterator(iteratorRef->treeRef, iteratorRef);
+
+    iteratorRef->currentNodeRef = tdb_GetNode(tdb_GetRootNode(iteratorRef->treeRef),
+                                              iteratorRef->pathIterRef);
+}
+
+
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Init the node iterator subsystem and get it ready for use by the other subsystems in this
@@ -253,7 +305,7 @@ ni_IteratorRef_t ni_CreateIterator
     // Allocate the object and setup it's initial properties.
     ni_IteratorRef_t iteratorRef = le_mem_ForceAlloc(IteratorPoolRef);
 
-    iteratorRef->creationTime = le_clk_GetRelativeTime();
+    iteratorRef->creationTime = le_clk_GetCoarseRelativeTime();
     iteratorRef->sessionRef = sessionRef;
     iteratorRef->userRef = userRef;
     iteratorRef->treeRef = treeRef;
@@ -261,6 +313,7 @@ ni_IteratorRef_t ni_CreateIterator
     iteratorRef->reference = NULL;
     iteratorRef->isClosed = false;
     iteratorRef->isTerminated = false;
+    memset(&iteratorRef->bulk, 0, sizeof(iteratorRef->bulk));
 
     // Setup the timeout timer for this transaction, if it's been configured.
     time_t configTimeout = ic_GetTransactionTimeout();
@@ -384,6 +437,18 @@ void ni_Commit
 {
     if (iteratorRef->type == NI_WRITE)
     {
+        // Rather than have the commit wait for the tree's readers, give them a snapshot of the
+        // tree as it is now, so that they carry on seeing the last committed revision.
+        tdb_TreeRef_t treeRef = tdb_GetOriginalTree(iteratorRef->treeRef);
+
+        if (tdb_HasActiveReaders(treeRef))
+        {
+            SnapshotInfo_t info = { treeRef, tdb_SnapshotTree(treeRef) };
+
+            ni_ForEachIter(OnIteratorSnapshot, &info);
+            tdb_ReleaseTree(info.snapshotRef);
+        }
+
         tdb_MergeTree(iteratorRef->treeRef);
     }
 }
@@ -420,9 +485,10 @@ void ni_Release
     // Release the rest of the iterator's resources.
     LE_DEBUG("Releasing iterator, <%p> with a lifetime of %" PRId32 " seconds.",
              iteratorRef,
-             (uint32_t)(le_clk_GetRelativeTime().sec - iteratorRef->creationTime.sec));
+             (uint32_t)(le_clk_GetCoarseRelativeTime().sec - iteratorRef->creationTime.sec));
 
     ni_Close(iteratorRef);
+    ni_DropBulk(iteratorRef);
     tdb_UnregisterIterator(iteratorRef->treeRef, iteratorRef);
 
     le_pathIter_Delete(iteratorRef->pathIterRef);
@@ -570,6 +636,47 @@ tdb_TreeRef_t ni_GetTree
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Get the subtree the iterator is passing to or from its client in pieces.
+ *
+ *  @return The iterator's bulk transfer, whose pathPtr is NULL if none is in progress.
+ */
+//--------------------------------------------------------------------------------------------------
+ni_Bulk_t* ni_GetBulk
+(
+    ni_IteratorRef_t iteratorRef  ///< [IN] The iterator object to read.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(iteratorRef != NULL);
+    return &iteratorRef->bulk;
+}
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Free the subtree the iterator is passing to or from its client, if there is one.
+ */
+//--------------------------------------------------------------------------------------------------
+void ni_DropBulk
+(
+    ni_IteratorRef_t iteratorRef  ///< [IN] The iterator object to update.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(iteratorRef != NULL);
+
+    free(iteratorRef->bulk.pathPtr);
+    free(iteratorRef->bulk.dataPtr);
+    memset(&iteratorRef->bulk, 0, sizeof(iteratorRef->bulk));
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  This function will find all iterators that have active safe refs.  For each found
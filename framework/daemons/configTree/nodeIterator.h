@@ -57,6 +57,25 @@ ni_IteratorType_t;
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  A serialized subtree being passed to or from a client in pieces, by le_cfg_GetSubtree() or
+ *  le_cfg_SetSubtree().  Each iterator has one of these, so transfers on different iterators don't
+ *  get in each other's way.
+ */
+// -------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char* pathPtr;  ///< Path the subtree is read from or written to, or NULL if there's none.
+    char* dataPtr;  ///< The serialized subtree, (or as much of it as has been received so far.)
+    size_t size;    ///< Number of bytes in dataPtr.
+    bool isWrite;   ///< true if the pieces are coming from the client, false if going to it.
+}
+ni_Bulk_t;
+
+
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Init the node iterator subsystem and get it ready for use by the other subsystems in this
@@ -236,6 +255,35 @@ tdb_TreeRef_t ni_GetTree
 
 
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Get the subtree the iterator is passing to or from its client in pieces.
+ *
+ *  @return The iterator's bulk transfer, whose pathPtr is NULL if none is in progress.
+ */
+//--------------------------------------------------------------------------------------------------
+ni_Bulk_t* ni_GetBulk
+(
+    ni_IteratorRef_t iteratorRef  ///< [IN] The iterator object to read.
+);
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Free the subtree the iterator is passing to or from its client, if there is one.
+ */
+//--------------------------------------------------------------------------------------------------
+void ni_DropBulk
+(
+    ni_IteratorRef_t iteratorRef  ///< [IN] The iterator object to update.
+);
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  This function will find all iterators that have active safe refs.  For each found
@@ -48,12 +48,6 @@ typedef struct UpdateRequest
         }
         createTxn;                               ///< Create new transaction info.
 
-        struct
-        {
-            ni_IteratorRef_t iteratorRef;        ///< Ptr to the iterator to commit.
-        }
-        commitTxn;
-
         struct
         {
             ni_IteratorRef_t iteratorRef;        ///< Ptr to the iterator to commit.
@@ -179,7 +173,7 @@ static void QueueRequest
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Queue a create transaction request.
+ *  Queue a create write transaction request.
  */
 // -------------------------------------------------------------------------------------------------
 static void QueueCreateTxnRequest
@@ -188,13 +182,15 @@ static void QueueCreateTxnRequest
     tdb_TreeRef_t treeRef,             ///< [IN] The tree we're working on.
     le_msg_SessionRef_t sessionRef,    ///< [IN] The user session this request occured on.
     le_cfg_ServerCmdRef_t commandRef,  ///< [IN] Context for this request.
-    ni_IteratorType_t iteratorType,    ///< [IN] The kind of iterator to create.
     const char* basePathPtr            ///< [IN] The initial path for the iterator.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    RequestType_t type = iteratorType == NI_READ ? RQ_CREATE_READ_TXN : RQ_CREATE_WRITE_TXN;
-    UpdateRequest_t* requestPtr = NewRequestBlock(type, userRef, treeRef, sessionRef, commandRef);
+    UpdateRequest_t* requestPtr = NewRequestBlock(RQ_CREATE_WRITE_TXN,
+                                                  userRef,
+                                                  treeRef,
+                                                  sessionRef,
+                                                  commandRef);
 
     LE_ASSERT(le_utf8_Copy(requestPtr->data.createTxn.pathPtr,
                            basePathPtr,
@@ -298,30 +294,6 @@ static void ProcessRequestQueue
                                               requestPtr->data.createTxn.pathPtr);
                     break;
 
-                case RQ_COMMIT_WRITE_TXN:
-                    LE_DEBUG("Committing deferred write txn for user %u (%s) on tree '%s'.",
-                             tu_GetUserId(requestPtr->userRef),
-                             tu_GetUserName(requestPtr->userRef),
-                             tdb_GetTreeName(requestPtr->treeRef));
-
-                    rq_HandleCommitTxnRequest(requestPtr->commandRef,
-                                              requestPtr->data.commitTxn.iteratorRef);
-                    break;
-
-               case RQ_CREATE_READ_TXN:
-                    LE_DEBUG("Starting deferred read txn for user %u (%s) on tree '%s'.",
-                             tu_GetUserId(requestPtr->userRef),
-                             tu_GetUserName(requestPtr->userRef),
-                             tdb_GetTreeName(requestPtr->treeRef));
-
-                    rq_HandleCreateTxnRequest(requestPtr->userRef,
-                                              requestPtr->treeRef,
-                                              requestPtr->sessionRef,
-                                              requestPtr->commandRef,
-                                              NI_READ,
-                                              requestPtr->data.createTxn.pathPtr);
-                    break;
-
                 case RQ_DELETE_TXN:
                     LE_DEBUG("Handling deferred iterator delete for user %u (%s) on tree '%s'.",
                              tu_GetUserId(requestPtr->userRef),
@@ -442,9 +414,9 @@ static bool CanQuickSet
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // If there are active readers or writers on the tree then a quick write should be defered.
-    if (   (tdb_HasActiveReaders(treeRef) == false)
-        && (tdb_GetActiveWriteIter(treeRef) == NULL))
+    // If there is an active writer on the tree then a quick write should be defered.  Active
+    // readers don't matter, the commit moves them onto a snapshot of the tree.
+    if (tdb_GetActiveWriteIter(treeRef) == NULL)
     {
         return true;
     }
@@ -543,18 +515,12 @@ void rq_HandleCreateTxnRequest
 )
 //--------------------------------------------------------------------------------------------------
 {
-    ni_IteratorRef_t writeIteratorRef = tdb_GetActiveWriteIter(treeRef);
-
-    if (   (iterType == NI_READ)
-        && (writeIteratorRef != NULL)
-        && (ni_IsClosed(writeIteratorRef)))
-    {
-        QueueCreateTxnRequest(userRef, treeRef, sessionRef, commandRef, iterType, pathPtr);
-    }
-    else if (   (iterType == NI_WRITE)
-             && (writeIteratorRef != NULL))
+    // Only one write transaction can be open on a tree at a time.  Read transactions never have
+    // to wait, they see the tree as of the last commit.
+    if (   (iterType == NI_WRITE)
+        && (tdb_GetActiveWriteIter(treeRef) != NULL))
     {
-        QueueCreateTxnRequest(userRef, treeRef, sessionRef, commandRef, iterType, pathPtr);
+        QueueCreateTxnRequest(userRef, treeRef, sessionRef, commandRef, pathPtr);
     }
     else
     {
@@ -585,7 +551,7 @@ void rq_HandleCreateTxnRequest
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Attempt to commit an outstanding write transaction.
+ *  Commit an outstanding write transaction.
  */
 // -------------------------------------------------------------------------------------------------
 void rq_HandleCommitTxnRequest
@@ -595,34 +561,21 @@ void rq_HandleCommitTxnRequest
 )
 //--------------------------------------------------------------------------------------------------
 {
-    if (ni_IsWriteable(iteratorRef) == false)
-    {
-        // Kill the iterator but do not try to comit it.
-        ni_Release(iteratorRef);
+    le_sls_List_t* requestQueue = tdb_GetRequestQueue(ni_GetTree(iteratorRef));
 
-        le_cfg_CommitTxnRespond(commandRef);
-        ProcessRequestQueue(tdb_GetRequestQueue(ni_GetTree(iteratorRef)), NULL);
-    }
-    else if (tdb_HasActiveReaders(ni_GetTree(iteratorRef)) == false)
+    // The commit doesn't have to wait for the tree's readers, they are moved onto a snapshot of the
+    // tree as it was before the commit.
+    if (ni_IsWriteable(iteratorRef))
     {
         ni_Close(iteratorRef);
         ni_Commit(iteratorRef);
-        ni_Release(iteratorRef);
-
-        le_cfg_CommitTxnRespond(commandRef);
-        ProcessRequestQueue(tdb_GetRequestQueue(ni_GetTree(iteratorRef)), NULL);
     }
-    else
-    {
-        UpdateRequest_t* requestPtr = NewRequestBlock(RQ_COMMIT_WRITE_TXN,
-                                                      ni_GetUser(iteratorRef),
-                                                      ni_GetTree(iteratorRef),
-                                                      ni_GetSession(iteratorRef),
-                                                      commandRef);
 
-        requestPtr->data.commitTxn.iteratorRef = iteratorRef;
-        QueueRequest(tdb_GetRequestQueue(ni_GetTree(iteratorRef)), requestPtr);
-    }
+    // Kill the iterator.  (A read iterator is just released, there's nothing to commit.)
+    ni_Release(iteratorRef);
+
+    le_cfg_CommitTxnRespond(commandRef);
+    ProcessRequestQueue(requestQueue, NULL);
 }
 
 
@@ -26,8 +26,6 @@ typedef enum
     RQ_INVALID,
 
     RQ_CREATE_WRITE_TXN,
-    RQ_COMMIT_WRITE_TXN,
-    RQ_CREATE_READ_TXN,
     RQ_DELETE_TXN,
 
     RQ_DELETE_NODE,
@@ -89,7 +87,7 @@ void rq_HandleCreateTxnRequest
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Attempt to commit an outstanding write transaction.
+ *  Commit an outstanding write transaction.
  */
 // -------------------------------------------------------------------------------------------------
 void rq_HandleCommitTxnRequest
@@ -133,6 +133,12 @@
 #include "treeUser.h"
 #include "nodeIterator.h"
 #include "sysPaths.h"
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+#include "treeImage.h"
+#endif
+#if LE_CONFIG_CFGTREE_JOURNAL
+#include "treeJournal.h"
+#endif
 
 
 
@@ -158,6 +164,9 @@ typedef struct Registration
                                                ///<   also include the tree name.
     bool triggered;                            ///< Has this registration been triggered for
                                                ///<   callback?
+    bool childTriggered;                       ///< Have any of the watched node's children been
+                                               ///<   triggered, during the current merge?
+    size_t coalescedCount;                     ///< Number of coalesced handlers in the list.
 
     union
     {
@@ -189,9 +198,25 @@ typedef struct Handler
 
     le_msg_SessionRef_t sessionRef;         ///< Session that this handler was registered on.
 
-    le_cfg_ChangeHandlerFunc_t handlerPtr;  ///< Function to call back.
+    bool isCoalesced;                       ///< Is this a coalesced change handler?
+
+    union
+    {
+        le_cfg_ChangeHandlerFunc_t handlerPtr;                    ///< Function to call back.
+        le_cfg_CoalescedChangeHandlerFunc_t coalescedHandlerPtr;  ///< Function to call back, if
+                                                                  ///<   the handler is coalesced.
+    };
     void* contextPtr;                       ///< Context to give the function when called.
 
+    dstr_Ref_t changesRef;                  ///< Coalesced handlers only: the newline separated
+                                            ///<   paths changed since the last notification, or
+                                            ///<   NULL if there are none.
+    bool changesOverflowed;                 ///< Did the changed paths overflow the list?  If so
+                                            ///<   the list only holds the registration path.
+    le_timer_Ref_t holdOffTimer;            ///< Coalesced handlers only: runs while changes are
+                                            ///<   being gathered.  NULL if changes are notified
+                                            ///<   at the end of each commit.
+
     Registration_t* registrationPtr;        ///< The registration object this handler is attached
                                             ///<   to.
 
@@ -222,6 +247,59 @@ CleanUpContext_t;
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Path of the node being merged, used to find the update handlers to call.  It lives on the stack
+ *  and node names are appended and removed in place, so firing the handlers doesn't allocate.
+ *
+ *  The path is the same as a registration path, "tree:" for the root and "tree:/a/b" below it.
+ */
+// -------------------------------------------------------------------------------------------------
+typedef struct CallbackPath
+{
+    char text[CFG_MAX_PATH_SIZE];  ///< The path text.
+    size_t length;                 ///< Length of the path, or CFG_MAX_PATH_SIZE if a name couldn't
+                                   ///<   fit and the path is not valid.
+}
+CallbackPath_t;
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Where a write of a node to a file is up to, so that the write can be done a few nodes at a time.
+ */
+// -------------------------------------------------------------------------------------------------
+typedef struct WriteCursor
+{
+    FILE* filePtr;          ///< The file being written to.
+    tdb_NodeRef_t rootRef;  ///< The node being written.
+    tdb_NodeRef_t nextRef;  ///< The next node to write, the root or one of its descendants.
+    bool isDone;            ///< Has the whole node been written?
+}
+WriteCursor_t;
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  An export of a node to a file, written a few nodes at a time.
+ */
+// -------------------------------------------------------------------------------------------------
+typedef struct tdb_Export
+{
+    WriteCursor_t cursor;   ///< Where the export is up to.
+    tdb_NodeRef_t copyRef;  ///< Private copy of the node being exported, or NULL if the node was
+                            ///<   written out in one go.
+    le_result_t result;     ///< Result of the export, if it was written out in one go.
+}
+Export_t;
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Flags that can be set on a node to allow the code to keep track of the various changes as
@@ -271,6 +349,17 @@ typedef struct Node
         le_dls_List_t children;      ///< The linked list of children belonging to this node.
     }
     info;                            ///< The actual inforation that this node stores.
+
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    timg_ImageRef_t imageRef;        ///< If non-NULL, this is a stem loaded from a tree image
+                                     ///<   whose children haven't been created yet.  The node
+                                     ///<   holds a reference to the image.
+    uint32_t imageRecord;            ///< The node's record in imageRef.
+#endif
+
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    bool isChildIndexed;             ///< Are this node's children in the ChildIndex?
+#endif
 }
 Node_t;
 
@@ -291,6 +380,14 @@ typedef struct Tree
     struct Tree* originalTreeRef;         ///< If non-NULL then this points back to the original
                                           ///<   tree this one is shadowing.
 
+    struct Tree* snapshotOfRef;           ///< If non-NULL then this is a read only snapshot of
+                                          ///<   that tree, as it was before a commit.  The readers
+                                          ///<   that were active at the time carry on with it.
+                                          ///<   (A reference is held on the tree.)
+    le_dls_Link_t snapshotLink;           ///< Link in the snapshotList of that tree.
+    le_dls_List_t snapshotList;           ///< The snapshots of this tree.  They share the tree's
+                                          ///<   nodes until a commit is about to change them.
+
     char name[MAX_TREE_NAME_BYTES];       ///< The name of this tree.
 
     int revisionId;                       ///< The current revision,
@@ -307,6 +404,15 @@ typedef struct Tree
 
     le_sls_List_t requestList;            ///< Each tree maintains it's own list of pending
                                           ///<   requests.
+
+#if LE_CONFIG_CFGTREE_JOURNAL
+    le_timer_Ref_t compactTimerRef;       ///< Timer that compacts the tree's journal once commits
+                                          ///<   have stopped for a while.  NULL until the first
+                                          ///<   commit is journaled.
+    bool needsFullSave;                   ///< If true, the next commit must rewrite the tree file,
+                                          ///<   (the file couldn't be loaded, so a journal
+                                          ///<   against it would never be replayed.)
+#endif
 }
 Tree_t;
 
@@ -338,6 +444,15 @@ LE_MEM_DEFINE_STATIC_POOL(nodePool, LE_CONFIG_CFGTREE_MAX_NODE_POOL_SIZE, sizeof
 static le_mem_PoolRef_t NodePoolRef = NULL;
 
 
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+/// Index of the children of wide stem nodes.  It is keyed by the child nodes themselves, hashed and
+/// compared by their parent node and name hash, so a child can be looked up with a key node that
+/// only has those two fields filled in.  Each indexed node has its isChildIndexed flag set, and all
+/// of its children are in the index.
+static le_flatmap_Ref_t ChildIndexRef = NULL;
+#endif
+
+
 /// Define static memory for collection of configuration trees managed by the system
 LE_HASHMAP_DEFINE_STATIC(TreeCollection, LE_CONFIG_CFGTREE_MAX_TREE_POOL_SIZE);
 
@@ -377,6 +492,13 @@ LE_MEM_DEFINE_STATIC_POOL(RegistrationPool, LE_CONFIG_CFGTREE_MAX_HANDLER_POOL_S
 /// Pool to handle the node handler registration objects.
 static le_mem_PoolRef_t RegistrationPool = NULL;
 
+/// Number of coalesced change handlers currently registered.  While there are none, merges don't
+/// need to look for the registrations on the parents of the changed nodes.
+static size_t CoalescedHandlerCount = 0;
+
+/// Scratch buffer used to build up the changed path lists of the coalesced change handlers.
+static char ChangeListBuffer[LE_CFG_CHANGE_LIST_LEN_BYTES];
+
 
 /// Define static pool for binary data buffers
 LE_MEM_DEFINE_STATIC_POOL(BinaryData, LE_CONFIG_CFGTREE_MAX_BINARY_DATA_POOL_SIZE,
@@ -394,6 +516,13 @@ LE_MEM_DEFINE_STATIC_POOL(EncodedString, LE_CONFIG_CFGTREE_MAX_ENCODED_STRING_PO
 le_mem_PoolRef_t EncodedStringPool = NULL;
 
 
+/// Define static pool for exports.  There can be at most one per iterator.
+LE_MEM_DEFINE_STATIC_POOL(Export, LE_CONFIG_CFGTREE_MAX_ITERATOR_POOL_SIZE, sizeof(Export_t));
+
+/// Pool for the exports in progress.
+static le_mem_PoolRef_t ExportPool = NULL;
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Clear all flags from the given node.
@@ -445,6 +574,23 @@ static void SetShadowFlag
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Clear the shadow flag from this node.
+ */
+// -------------------------------------------------------------------------------------------------
+static void ClearShadowFlag
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to update.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    nodeRef->flags &= ~NODE_IS_SHADOW;
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Check to see if this node has been modified.
@@ -547,6 +693,61 @@ static void ClearDeletedFlag
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the name string of a node.  If this is a shadow node, then its name may be NULL.  The reason
+ *  that the name may be NULL is because the client never changed the name of the node.  So, we
+ *  just get the name from the original node, saving memory.  However, nodes like the root node of a
+ *  tree also do not have names.
+ *
+ *  @return The node's name, or NULL if it has none.
+ */
+// -------------------------------------------------------------------------------------------------
+static dstr_Ref_t GetNameRef
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to read.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (   (IsShadow(nodeRef))
+        && (nodeRef->nameRef == NULL)
+        && (nodeRef->shadowRef != NULL))
+    {
+        return nodeRef->shadowRef->nameRef;
+    }
+
+    return nodeRef->nameRef;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Replace the name string of a node.  Names are interned, so that nodes with the same short name
+ *  share one string and can be matched by reference.  The name hash is left to the caller.
+ */
+// -------------------------------------------------------------------------------------------------
+static void SetNameRef
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] The node to update.
+    const char* namePtr     ///< [IN] The new name.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    dstr_Ref_t newNameRef = dstr_Intern(namePtr);
+
+    if (nodeRef->nameRef != NULL)
+    {
+        dstr_Release(nodeRef->nameRef);
+    }
+
+    nodeRef->nameRef = newNameRef;
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Allocate a new node and fill out it's default information.
@@ -571,6 +772,13 @@ static tdb_NodeRef_t NewNode
     newNodeRef->nameHash = 0;
     newNodeRef->siblingList = LE_DLS_LINK_INIT;
     memset(&newNodeRef->info, 0, sizeof(newNodeRef->info));
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    newNodeRef->imageRef = NULL;
+    newNodeRef->imageRecord = 0;
+#endif
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    newNodeRef->isChildIndexed = false;
+#endif
 
     return newNodeRef;
 }
@@ -578,6 +786,156 @@ static tdb_NodeRef_t NewNode
 
 
 
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Hash a key of the child index: a node's parent and name hash.
+ *
+ *  @return The hash.
+ */
+// -------------------------------------------------------------------------------------------------
+static size_t HashChildKey
+(
+    const void* keyPtr  ///< [IN] The node to hash.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    const Node_t* nodePtr = keyPtr;
+
+    return nodePtr->nameHash ^ le_hashmap_HashVoidPointer(nodePtr->parentRef);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Compare two keys of the child index.
+ *
+ *  @return True if both nodes have the same parent and name hash.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool EqualsChildKey
+(
+    const void* firstKeyPtr,  ///< [IN] The first node to compare.
+    const void* secondKeyPtr  ///< [IN] The second node to compare.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    const Node_t* firstPtr = firstKeyPtr;
+    const Node_t* secondPtr = secondKeyPtr;
+
+    return    (firstPtr->parentRef == secondPtr->parentRef)
+           && (firstPtr->nameHash == secondPtr->nameHash);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Remove all of a node's children from the child index.
+ */
+// -------------------------------------------------------------------------------------------------
+static void DropChildIndex
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node whose children are indexed.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&nodeRef->info.children);
+
+    while (linkPtr != NULL)
+    {
+        le_flatmap_Remove(ChildIndexRef, CONTAINER_OF(linkPtr, Node_t, siblingList));
+        linkPtr = le_dls_PeekNext(&nodeRef->info.children, linkPtr);
+    }
+
+    nodeRef->isChildIndexed = false;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Add a node to the child index, if its parent's children are indexed.  This must be called once
+ *  the node is in its parent's list of children and has its name hash, and again after each
+ *  change of name hash.
+ *
+ *  Two children with the same name hash can't both be in the index.  If that happens, the parent's
+ *  children are simply searched through again.
+ */
+// -------------------------------------------------------------------------------------------------
+static void AddToChildIndex
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to add.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (   (nodeRef->parentRef != NULL)
+        && (nodeRef->parentRef->isChildIndexed)
+        && (le_flatmap_Put(ChildIndexRef, nodeRef, nodeRef) != NULL))
+    {
+        LE_DEBUG("Name hash collision, no longer indexing the children of node <%p>.",
+                 nodeRef->parentRef);
+        DropChildIndex(nodeRef->parentRef);
+    }
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Remove a node from the child index, (if it's there.)  This must be called before the node is
+ *  taken out of its parent's list of children, and before each change of name hash.
+ */
+// -------------------------------------------------------------------------------------------------
+static void RemoveFromChildIndex
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to remove.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (   (nodeRef->parentRef != NULL)
+        && (nodeRef->parentRef->isChildIndexed))
+    {
+        le_flatmap_Remove(ChildIndexRef, nodeRef);
+    }
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Start indexing a stem node's children.
+ */
+// -------------------------------------------------------------------------------------------------
+static void BuildChildIndex
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node whose children are to be indexed.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_DEBUG("Indexing the children of node <%p>.", nodeRef);
+    nodeRef->isChildIndexed = true;
+
+    le_dls_Link_t* linkPtr = le_dls_Peek(&nodeRef->info.children);
+
+    while (   (linkPtr != NULL)
+           && (nodeRef->isChildIndexed))
+    {
+        AddToChildIndex(CONTAINER_OF(linkPtr, Node_t, siblingList));
+        linkPtr = le_dls_PeekNext(&nodeRef->info.children, linkPtr);
+    }
+}
+#endif
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  The node destructor function.  This will take care of freeing a node's string values and any
@@ -597,6 +955,15 @@ static void NodeDestructor
         dstr_Release(nodeRef->nameRef);
     }
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    // Children that are still in a tree image don't need to be created just to be freed.
+    if (nodeRef->imageRef != NULL)
+    {
+        le_mem_Release(nodeRef->imageRef);
+        nodeRef->imageRef = NULL;
+    }
+#endif
+
     switch (nodeRef->type)
     {
         case LE_CFG_TYPE_EMPTY:
@@ -616,14 +983,16 @@ static void NodeDestructor
 
         case LE_CFG_TYPE_STEM:
             {
-                tdb_NodeRef_t childRef = tdb_GetFirstChildNode(nodeRef);
+                // Only the children that exist need freeing, the children of a shadow node that
+                // haven't been shadowed yet aren't created just to be freed.
+                le_dls_Link_t* linkPtr = le_dls_Peek(&nodeRef->info.children);
 
-                while (childRef != NULL)
+                while (linkPtr != NULL)
                 {
-                    tdb_NodeRef_t nextChildRef = tdb_GetNextSiblingNode(childRef);
+                    le_dls_Link_t* nextLinkPtr = le_dls_PeekNext(&nodeRef->info.children, linkPtr);
 
-                    le_mem_Release(childRef);
-                    childRef = nextChildRef;
+                    le_mem_Release(CONTAINER_OF(linkPtr, Node_t, siblingList));
+                    linkPtr = nextLinkPtr;
                 }
             }
             break;
@@ -635,6 +1004,9 @@ static void NodeDestructor
         LE_ASSERT(le_dls_IsEmpty(&nodeRef->parentRef->info.children) == false);
         LE_ASSERT(le_dls_IsInList(&nodeRef->parentRef->info.children, &nodeRef->siblingList));
 
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+        RemoveFromChildIndex(nodeRef);
+#endif
         le_dls_Remove(&nodeRef->parentRef->info.children, &nodeRef->siblingList);
     }
 }
@@ -663,9 +1035,12 @@ static tdb_NodeRef_t NewShadowNode
     // new path that didn't exist in the original tree.
     if (nodeRef != NULL)
     {
+        // Whether a node has been modified is only tracked within a transaction, so the shadow
+        // starts out unmodified, even if the original was cleared by the last merge.
         newShadowRef->type = nodeRef->type;
-        newShadowRef->flags = nodeRef->flags;
+        newShadowRef->flags = nodeRef->flags & ~NODE_IS_MODIFIED;
         newShadowRef->shadowRef = nodeRef;
+        newShadowRef->nameHash = nodeRef->nameHash;
 
         // Now, if the parent node, (if there is a parent node,) is marked as deleted, then do the
         // same with this new node.
@@ -683,50 +1058,28 @@ static tdb_NodeRef_t NewShadowNode
 
 
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
 // -------------------------------------------------------------------------------------------------
 /**
- *  Create a new node and insert it into the given node's children collection.
+ *  Check that a node name read from a tree image is one that tdb_SetNodeName() would accept.
+ *  (Duplicates aren't checked for, as images are only ever written from valid trees.)
  *
- *  @return The newly create node, already inserted into the supplied node's child collection.
+ *  @return True if the name is valid.
  */
 // -------------------------------------------------------------------------------------------------
-static tdb_NodeRef_t NewChildNode
+static bool IsValidImageName
 (
-    tdb_NodeRef_t nodeRef  ///< [IN] The node to be given with a new child.
+    const char* namePtr  ///< [IN] The name to check.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // If the node is currently empty, then turn it into a stem.
-    if (nodeRef->type == LE_CFG_TYPE_EMPTY)
-    {
-        nodeRef->type = LE_CFG_TYPE_STEM;
-    }
-
-    LE_ASSERT(nodeRef->type == LE_CFG_TYPE_STEM);
-
-    // Create a new node.  Then set it's parent to the given node
-    tdb_NodeRef_t newRef = NewNode();
-
-    newRef->parentRef = nodeRef;
-    newRef->type = LE_CFG_TYPE_EMPTY;
-
-    // Get the new node to inheret the parent's shadow and deletion flags.
-    if (IsShadow(nodeRef))
-    {
-        SetShadowFlag(newRef);
-        SetDeletedFlag(newRef);
-    }
-
-    if (IsDeleted(nodeRef))
-    {
-        SetDeletedFlag(newRef);
-    }
-
-    // Now make sure to add the new child node to the end of the parents collection.
-    le_dls_Queue(&nodeRef->info.children, &newRef->siblingList);
-
-    // Finally return the newly created node to the caller.
-    return newRef;
+    return    (namePtr != NULL)
+           && (strcmp(namePtr, "") != 0)
+           && (strcmp(namePtr, ".") != 0)
+           && (strcmp(namePtr, "..") != 0)
+           && (strchr(namePtr, '/') == NULL)
+           && (strchr(namePtr, ':') == NULL)
+           && (strlen(namePtr) <= LE_CFG_NAME_LEN);
 }
 
 
@@ -734,33 +1087,198 @@ static tdb_NodeRef_t NewChildNode
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Called to shadow a node's collection of children.
+ *  If a stem node was loaded from a tree image and its children haven't been created yet, create
+ *  them now from the image's records.  Child stems are left unexpanded in turn, so only the part
+ *  of the tree that is actually visited ever gets allocated.
+ *
+ *  Damaged records are logged and skipped.
  */
 // -------------------------------------------------------------------------------------------------
-static void ShadowChildren
+static void MaterializeChildren
 (
-    tdb_NodeRef_t shadowParentRef  ///< [IN] The node we're shadowing the children of.
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to expand.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // If the parent node isn't a stem then there isn't much else to do here.
-    if (shadowParentRef->type != LE_CFG_TYPE_STEM)
-    {
-        return;
-    }
+    timg_ImageRef_t imageRef = nodeRef->imageRef;
 
-    // Does this node have any children currently?  If yes, then we don't need to do anything else.
-    if (le_dls_IsEmpty(&shadowParentRef->info.children) == false)
+    if (imageRef == NULL)
     {
         return;
     }
 
-    // Has this node been modified?  If so, then the shadow children may have been cleared from
-    // this collection.
-    if (IsModified(shadowParentRef) == true)
-    {
-        return;
-    }
+    nodeRef->imageRef = NULL;
+
+    uint32_t firstChild;
+    uint32_t count;
+
+    if (timg_GetChildren(imageRef, nodeRef->imageRecord, &firstChild, &count) == LE_OK)
+    {
+        uint32_t record;
+
+        for (record = firstChild; record < (firstChild + count); record++)
+        {
+            const char* namePtr = timg_GetName(imageRef, record);
+            le_cfg_nodeType_t type = timg_GetType(imageRef, record);
+            const char* valuePtr = NULL;
+
+            if (   (type != LE_CFG_TYPE_EMPTY)
+                && (type != LE_CFG_TYPE_STEM))
+            {
+                valuePtr = timg_GetValue(imageRef, record);
+            }
+
+            if (   (IsValidImageName(namePtr) == false)
+                || (type == LE_CFG_TYPE_DOESNT_EXIST)
+                || (   (valuePtr == NULL)
+                    && (type != LE_CFG_TYPE_EMPTY)
+                    && (type != LE_CFG_TYPE_STEM)))
+            {
+                LE_ERROR("Skipping damaged config tree image record %" PRIu32 ".", record);
+                continue;
+            }
+
+            // This is always a node of the original tree, so there are no flags to inherit.
+            tdb_NodeRef_t childRef = NewNode();
+
+            childRef->parentRef = nodeRef;
+            childRef->nameRef = dstr_Intern(namePtr);
+            childRef->nameHash = le_hashmap_HashString(namePtr);
+            childRef->type = type;
+
+            if (type == LE_CFG_TYPE_STEM)
+            {
+                childRef->info.children = LE_DLS_LIST_INIT;
+                childRef->imageRef = imageRef;
+                childRef->imageRecord = record;
+                le_mem_AddRef(imageRef);
+            }
+            else if (valuePtr != NULL)
+            {
+                childRef->info.valueRef = dstr_NewFromCstr(valuePtr);
+            }
+
+            le_dls_Queue(&nodeRef->info.children, &childRef->siblingList);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+            AddToChildIndex(childRef);
+#endif
+        }
+    }
+
+    le_mem_Release(imageRef);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Drop a node's unexpanded tree image children, if it has any, without creating them.
+ */
+// -------------------------------------------------------------------------------------------------
+static void DropImageChildren
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to update.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (nodeRef->imageRef != NULL)
+    {
+        le_mem_Release(nodeRef->imageRef);
+        nodeRef->imageRef = NULL;
+    }
+}
+#endif
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Create a new node and insert it into the given node's children collection.
+ *
+ *  @return The newly create node, already inserted into the supplied node's child collection.
+ */
+// -------------------------------------------------------------------------------------------------
+static tdb_NodeRef_t NewChildNode
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to be given with a new child.
+)
+// -------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    // New children go after any that are still in the tree image.
+    MaterializeChildren(nodeRef);
+#endif
+
+    // If the node is currently empty, then turn it into a stem.
+    if (nodeRef->type == LE_CFG_TYPE_EMPTY)
+    {
+        nodeRef->type = LE_CFG_TYPE_STEM;
+    }
+
+    LE_ASSERT(nodeRef->type == LE_CFG_TYPE_STEM);
+
+    // Create a new node.  Then set it's parent to the given node
+    tdb_NodeRef_t newRef = NewNode();
+
+    newRef->parentRef = nodeRef;
+    newRef->type = LE_CFG_TYPE_EMPTY;
+
+    // Get the new node to inheret the parent's shadow and deletion flags.
+    if (IsShadow(nodeRef))
+    {
+        SetShadowFlag(newRef);
+        SetDeletedFlag(newRef);
+    }
+
+    if (IsDeleted(nodeRef))
+    {
+        SetDeletedFlag(newRef);
+    }
+
+    // Now make sure to add the new child node to the end of the parents collection.
+    le_dls_Queue(&nodeRef->info.children, &newRef->siblingList);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    AddToChildIndex(newRef);
+#endif
+
+    // Finally return the newly created node to the caller.
+    return newRef;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Called to shadow a node's collection of children.
+ */
+// -------------------------------------------------------------------------------------------------
+static void ShadowChildren
+(
+    tdb_NodeRef_t shadowParentRef  ///< [IN] The node we're shadowing the children of.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    // If the parent node isn't a stem then there isn't much else to do here.
+    if (shadowParentRef->type != LE_CFG_TYPE_STEM)
+    {
+        return;
+    }
+
+    // Does this node have any children currently?  If yes, then we don't need to do anything else.
+    if (le_dls_IsEmpty(&shadowParentRef->info.children) == false)
+    {
+        return;
+    }
+
+    // Has this node been modified?  If so, then the shadow children may have been cleared from
+    // this collection.
+    if (IsModified(shadowParentRef) == true)
+    {
+        return;
+    }
 
     // This node has no shadow children.  So what we do now is check the original node... Does it
     // have any children?  If it does, we simply recreate the whole collection now.  (We do not
@@ -784,6 +1302,9 @@ static void ShadowChildren
         newShadowRef->parentRef = shadowParentRef;
 
         le_dls_Queue(&shadowParentRef->info.children, &newShadowRef->siblingList);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+        AddToChildIndex(newShadowRef);
+#endif
 
         originalChildRef = tdb_GetNextSiblingNode(originalChildRef);
     }
@@ -819,62 +1340,164 @@ static tdb_NodeRef_t GetRootParentNode
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Called to look for a named child in a given node's child collection.
+ *  Check whether a node's name matches a name that isn't null terminated.  Short names are all
+ *  interned, so if the name has been looked up in the intern table, only the references need to be
+ *  compared.
+ *
+ *  @return True if the names are the same.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool NameMatches
+(
+    tdb_NodeRef_t nodeRef,       ///< [IN] The node to check.
+    dstr_Ref_t internedNameRef,  ///< [IN] The interned name, or NULL if the name is too long to be
+                                 ///<      interned.
+    const char* namePtr,         ///< [IN] The name we're searching for.
+    size_t nameLength            ///< [IN] Length of that name in bytes.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (internedNameRef != NULL)
+    {
+        return GetNameRef(nodeRef) == internedNameRef;
+    }
+
+    char nodeName[LE_CFG_NAME_LEN_BYTES] = "";
+
+    tdb_GetNodeName(nodeRef, nodeName, sizeof(nodeName));
+
+    return (strncmp(nodeName, namePtr, nameLength) == 0) && (nodeName[nameLength] == '\0');
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Called to look for a named child in a given node's child collection.  The name doesn't have to
+ *  be null terminated, so that path segments can be looked up without being copied out of the
+ *  path.
  *
  *  @return Reference to the found child node, or NULL if a node was not found.
  */
 // -------------------------------------------------------------------------------------------------
-static tdb_NodeRef_t GetNamedChild
+static tdb_NodeRef_t FindNamedChild
 (
     tdb_NodeRef_t nodeRef,  ///< [IN] The node to search.
-    const char* nameRef     ///< [IN] The name we're searching for.
+    const char* nameRef,    ///< [IN] The name we're searching for.
+    size_t nameLength       ///< [IN] Length of that name in bytes.
 )
 // -------------------------------------------------------------------------------------------------
 {
     // Is this one of the "special" names?
-    if (strcmp(nameRef, ".") == 0)
+    if ((nameLength == 1) && (nameRef[0] == '.'))
     {
         return nodeRef;
     }
 
-    if (strcmp(nameRef, "..") == 0)
+    if ((nameLength == 2) && (nameRef[0] == '.') && (nameRef[1] == '.'))
     {
         return nodeRef->parentRef;
     }
 
+    // Names too long to be a node's name can't match any.
+    if (nameLength >= LE_CFG_NAME_LEN_BYTES)
+    {
+        return NULL;
+    }
+
     // If the current node isn't a stem, then this node can't have any children.
     if (nodeRef->type != LE_CFG_TYPE_STEM)
     {
         return NULL;
     }
 
-    // Search the child list for a node with the given name.
+    // Search the child list for a node with the given name.  (Getting the first child also creates
+    // the children of a node that are still in a tree image.)
     tdb_NodeRef_t currentRef = tdb_GetFirstChildNode(nodeRef);
-    char currentNameRef[LE_CFG_NAME_LEN_BYTES] = "";
-    size_t stringHash = le_hashmap_HashString(nameRef);
+
+    // Short names are interned, so if a short name isn't in the intern table then no node has it.
+    // Otherwise the interned name can be matched by reference.
+    dstr_Ref_t internedNameRef = NULL;
+
+    if (dstr_FindInterned(nameRef, nameLength, &internedNameRef) == LE_NOT_FOUND)
+    {
+        return NULL;
+    }
+
+    // Same hash as le_hashmap_HashString() gives the null terminated name.
+    size_t stringHash = le_hashmap_HashBytes(nameRef, nameLength);
     size_t nodeHash;
 
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    // If the children are indexed, the only candidate is the one with the same name hash.
+    if (nodeRef->isChildIndexed)
+    {
+        Node_t key = { .parentRef = nodeRef, .nameHash = stringHash };
+
+        currentRef = le_flatmap_Get(ChildIndexRef, &key);
+
+        if (   (currentRef != NULL)
+            && (!NameMatches(currentRef, internedNameRef, nameRef, nameLength)))
+        {
+            currentRef = NULL;
+        }
+
+        return currentRef;
+    }
+
+    size_t searchCount = 0;
+#endif
+
     while (currentRef != NULL)
     {
         nodeHash = tdb_GetNodeNameHash(currentRef);
 
         // if the hash doesn't match, the name is different. If the hash matches, there is
         // a small possibility of collision, and the string comparison is required.
-        if (stringHash == nodeHash)
+        if (   (stringHash == nodeHash)
+            && (NameMatches(currentRef, internedNameRef, nameRef, nameLength)))
         {
-            tdb_GetNodeName(currentRef, currentNameRef, sizeof(currentNameRef));
-
-            if (strncmp(currentNameRef, nameRef, sizeof(currentNameRef)) == 0)
-            {
-                return currentRef;
-            }
+            break;
         }
 
         currentRef = tdb_GetNextSiblingNode(currentRef);
+
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+        searchCount++;
+#endif
+    }
+
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    // If this turned out to be a long search, index the children so later ones won't be.
+    if (searchCount >= LE_CONFIG_CFGTREE_CHILD_INDEX_THRESHOLD)
+    {
+        BuildChildIndex(nodeRef);
     }
+#endif
+
+    // Return the node found, or NULL if there wasn't one.
+    return currentRef;
+}
 
-    // Looks like there was no node to return.
-    return NULL;
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Called to look for a named child in a given node's child collection.
+ *
+ *  @return Reference to the found child node, or NULL if a node was not found.
+ */
+// -------------------------------------------------------------------------------------------------
+static tdb_NodeRef_t GetNamedChild
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] The node to search.
+    const char* nameRef     ///< [IN] The name we're searching for.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    return FindNamedChild(nodeRef, nameRef, strlen(nameRef));
 }
 
 
@@ -987,6 +1610,65 @@ static bool IsStringType
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Make a deep copy of a node and its children.  Stems that are still in a tree image are copied
+ *  as they are, so the copy shares the image rather than creating the children.
+ *
+ *  @return The new copy, which has no parent.
+ */
+// -------------------------------------------------------------------------------------------------
+static tdb_NodeRef_t CopyNode
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] The node to copy.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_NodeRef_t copyRef = NewNode();
+
+    copyRef->type = nodeRef->type;
+    copyRef->nameHash = nodeRef->nameHash;
+
+    if (nodeRef->nameRef != NULL)
+    {
+        copyRef->nameRef = dstr_NewFromDstr(nodeRef->nameRef);
+    }
+
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    if (nodeRef->imageRef != NULL)
+    {
+        le_mem_AddRef(nodeRef->imageRef);
+        copyRef->imageRef = nodeRef->imageRef;
+        copyRef->imageRecord = nodeRef->imageRecord;
+    }
+#endif
+
+    if (nodeRef->type == LE_CFG_TYPE_STEM)
+    {
+        le_dls_Link_t* linkPtr = le_dls_Peek(&nodeRef->info.children);
+
+        while (linkPtr != NULL)
+        {
+            tdb_NodeRef_t childCopyRef = CopyNode(CONTAINER_OF(linkPtr, Node_t, siblingList));
+
+            childCopyRef->parentRef = copyRef;
+            le_dls_Queue(&copyRef->info.children, &childCopyRef->siblingList);
+
+            linkPtr = le_dls_PeekNext(&nodeRef->info.children, linkPtr);
+        }
+    }
+    else if (   (IsStringType(nodeRef))
+             && (nodeRef->info.valueRef != NULL))
+    {
+        copyRef->info.valueRef = dstr_NewFromDstr(nodeRef->info.valueRef);
+    }
+
+    return copyRef;
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  This function will copy a string value from an original tree node into a node that has shadowed
@@ -1024,124 +1706,77 @@ static void PropagateValue
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Merge a shadow node with the original it represents.
+ *  Stop a node of a snapshot from reading through to the node of the tree that it shadows.  The
+ *  snapshot node gets its own name and value, and shadows of the children it doesn't have yet.
+ *
+ *  A deep detach does the same for all of the node's descendants and drops their links to the
+ *  tree, for when the tree's node is about to be deleted or cleared.  Otherwise the link is kept,
+ *  so that the next commit can still find the snapshot's nodes that shadow the node's children.
+ *
+ *  Snapshot nodes are changed in place and never freed, as readers may be sitting on them.
  */
 // -------------------------------------------------------------------------------------------------
-static void MergeNode
+static void DetachSnapshotNode
 (
-    tdb_NodeRef_t nodeRef  ///< [IN] The shadow node to merge.
+    tdb_NodeRef_t nodeRef,  ///< [IN] The snapshot node to detach.
+    bool isDeep             ///< [IN] Detach the node's descendants and drop the links as well?
 )
 // -------------------------------------------------------------------------------------------------
 {
-    LE_ASSERT(nodeRef != NULL);
+    tdb_NodeRef_t originalRef = nodeRef->shadowRef;
 
-    // If this shadow node for some reason doesn't have a ref check for an original version of it in
-    // the original tree.  This shadow node may have been destroyed and re-created loosing this
-    // link.
-    if (nodeRef->shadowRef == NULL)
+    // If the link has already been dropped, then so have the links of the descendants.
+    if (originalRef == NULL)
     {
-        tdb_NodeRef_t shadowedParentRef = tdb_GetNodeParent(nodeRef)->shadowRef;
+        return;
+    }
 
-        if (shadowedParentRef != NULL)
+    if (IsShadow(nodeRef))
+    {
+        if (   (nodeRef->nameRef == NULL)
+            && (originalRef->nameRef != NULL))
         {
-            char name[LE_CFG_NAME_LEN_BYTES] = "";
-
-            tdb_GetNodeName(nodeRef, name, sizeof(name));
-            nodeRef->shadowRef = GetNamedChild(shadowedParentRef, name);
+            nodeRef->nameRef = dstr_NewFromDstr(originalRef->nameRef);
         }
-    }
 
-    // If this node has been marked as deleted, then simply drop the original node and move on.
-    if (IsDeleted(nodeRef))
-    {
-        if (   (nodeRef->shadowRef != NULL)
-            && (tdb_GetNodeParent(nodeRef->shadowRef) != NULL))
+        if (nodeRef->type != LE_CFG_TYPE_STEM)
         {
-            le_mem_Release(nodeRef->shadowRef);
+            PropagateValue(nodeRef);
         }
-        else
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+        else if (   (isDeep)
+                 && (le_dls_IsEmpty(&nodeRef->info.children))
+                 && (originalRef->imageRef != NULL))
         {
-            // We delete every node but the root node.  Since this is the root node, we just need
-            // to clear it out.
-            tdb_SetEmpty(nodeRef->shadowRef);
-        }
-
-        return;
-    }
-
-    // If the original node doesn't exist, create it now.
-    tdb_NodeRef_t originalRef = nodeRef->shadowRef;
-
-    if (originalRef == NULL)
-    {
-        LE_ASSERT(nodeRef->parentRef != NULL);
-        LE_ASSERT(nodeRef->parentRef->shadowRef != NULL);
-
-        nodeRef->shadowRef = originalRef = NewChildNode(nodeRef->parentRef->shadowRef);
-    }
-
-    ClearModifiedFlag(originalRef);
-
-    // If the name has been changed, then copy it over now.
-    if (dstr_IsNullOrEmpty(nodeRef->nameRef) == false)
-    {
-        if (originalRef->nameRef != NULL)
-        {
-            dstr_Copy(originalRef->nameRef, nodeRef->nameRef);
+            // Share the children that are still in a tree image, rather than create them.
+            le_mem_AddRef(originalRef->imageRef);
+            nodeRef->imageRef = originalRef->imageRef;
+            nodeRef->imageRecord = originalRef->imageRecord;
         }
+#endif
         else
         {
-            originalRef->nameRef = dstr_NewFromDstr(nodeRef->nameRef);
+            tdb_GetFirstChildNode(nodeRef);
         }
-        originalRef->nameHash = nodeRef->nameHash;
-    }
-
-    // Check the types of the original and the shadow nodes.  If the new node has been cleared,
-    // then clear out the original node.  If the types have changed, then clear out the original so
-    // that we can properly populate it again.
-    le_cfg_nodeType_t nodeType = tdb_GetNodeType(nodeRef);
-
-    // If the nodeRef->type is LE_CFG_TYPE_EMPTY, tdb_GetNodeType will return node type of
-    // original node, which is incorrect. nodeType should be LE_CFG_TYPE_EMPTY.
-    if(nodeRef->type == LE_CFG_TYPE_EMPTY)
-    {
-      nodeType = LE_CFG_TYPE_EMPTY;
-    }
 
-    if (   (nodeType == LE_CFG_TYPE_EMPTY)
-        || (nodeType != originalRef->type))
-    {
-        tdb_SetEmpty(originalRef);
+        ClearShadowFlag(nodeRef);
     }
 
-    // Ok, we know that the node hasn't been deleted.  Check to see if it's considered empty and
-    // that it isn't a stem.  If not, then copy over the string value.
-    if (   (nodeType != LE_CFG_TYPE_EMPTY)
-        && (nodeType != LE_CFG_TYPE_STEM))
+    if (isDeep)
     {
-        if (nodeRef->info.valueRef != NULL)
+        if (nodeRef->type == LE_CFG_TYPE_STEM)
         {
-            if (originalRef->info.valueRef != NULL)
-            {
-                dstr_Copy(originalRef->info.valueRef, nodeRef->info.valueRef);
-            }
-            else
+            le_dls_Link_t* linkPtr = le_dls_Peek(&nodeRef->info.children);
+
+            while (linkPtr != NULL)
             {
-                originalRef->info.valueRef = dstr_NewFromDstr(nodeRef->info.valueRef);
+                DetachSnapshotNode(CONTAINER_OF(linkPtr, Node_t, siblingList), true);
+                linkPtr = le_dls_PeekNext(&nodeRef->info.children, linkPtr);
             }
-
-            // Propigate over the type as that may have changed, like going from an int value to a
-            // bool value.
-
-            originalRef->type = nodeRef->type;
         }
-    }
-
-    // Now at this point, if both the original and the shadow node are stems, we'll let the function
-    // InternalMergeTree take care of the children, (if any.)
 
-    // If the original has been cleared out, we can still just rely on InternalMergeTree to
-    // propigate over the new nodes.
+        nodeRef->shadowRef = NULL;
+    }
 }
 
 
@@ -1149,151 +1784,132 @@ static void MergeNode
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Called to fire any callbacks registered on the given node path.  If nothing is registered on the
- *  given path, nothing happens.
+ *  Called before a shadow node is merged, to detach the nodes of a snapshot from the parts of the
+ *  original tree that the merge is going to change.  Only the nodes that the write transaction has
+ *  shadowed are visited, so a snapshot only ends up with its own copies of the paths that commits
+ *  change while it's in use.
  */
 // -------------------------------------------------------------------------------------------------
-static void TriggerCallbacks
+static void FreezeNode
 (
-    le_pathIter_Ref_t pathRef  ///< [IN] The path to search for callback registrations.
+    tdb_NodeRef_t nodeRef,         ///< [IN] The shadow node about to be merged.
+    tdb_NodeRef_t originalRef,     ///< [IN] The original node it's going to be merged into.
+    tdb_NodeRef_t snapshotNodeRef  ///< [IN] The snapshot node that may be shadowing the original.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // Read the path out of the buffer.
-    char pathBuffer[CFG_MAX_PATH_SIZE] = { 0 };
-    if (le_pathIter_GetPath(pathRef, pathBuffer, sizeof(pathBuffer)) != LE_OK)
+    if (   (snapshotNodeRef == NULL)
+        || (snapshotNodeRef->shadowRef != originalRef))
     {
-        LE_ERROR("Callback path buffer overflow.");
         return;
     }
 
-    // Try to find a registration object for this path.  If one is found, flag it for calling once
-    // the merge is complete.
-    Registration_t* foundRegistrationPtr = le_hashmap_Get(HandlerRegistrationMap, pathBuffer);
-
-    if (foundRegistrationPtr != NULL)
+    if (IsDeleted(nodeRef))
     {
-        foundRegistrationPtr->triggered = true;
+        DetachSnapshotNode(snapshotNodeRef, true);
+        return;
     }
-}
 
+    if (IsModified(nodeRef))
+    {
+        // A rename changes the whole branch's path, and the branch of an original node that the
+        // merge clears is freed.  (See MergeNode() for when the original is cleared.)
+        le_cfg_nodeType_t nodeType = (nodeRef->type == LE_CFG_TYPE_EMPTY) ? LE_CFG_TYPE_EMPTY
+                                                                          : tdb_GetNodeType(nodeRef);
 
+        if (   (dstr_IsNullOrEmpty(nodeRef->nameRef) == false)
+            || (nodeType == LE_CFG_TYPE_EMPTY)
+            || (nodeType != originalRef->type))
+        {
+            DetachSnapshotNode(snapshotNodeRef, true);
+            return;
+        }
 
+        DetachSnapshotNode(snapshotNodeRef, false);
+    }
 
+    if (nodeRef->type != LE_CFG_TYPE_STEM)
+    {
+        return;
+    }
 
-// -------------------------------------------------------------------------------------------------
-/**
- *  Go through all of the registered event callbacks, and fire the call backs for each of the
- *  registrations that has been makred as triggered.
- *
- *  Once this is done, the triggered flag is cleared for next time.
- */
-// -------------------------------------------------------------------------------------------------
-static void FireTriggeredCallbacks
-(
-    void
-)
-// -------------------------------------------------------------------------------------------------
-{
-    // Go through the registration map.
-    le_hashmap_It_Ref_t handlerIterRef = le_hashmap_GetIterator(HandlerRegistrationMap);
+    // Find the original and the snapshot node for each of the children that the transaction has
+    // shadowed, the same way that MergeNode() finds the original.
+    le_dls_Link_t* linkPtr = le_dls_Peek(&nodeRef->info.children);
+    char name[LE_CFG_NAME_LEN_BYTES] = "";
 
-    while (le_hashmap_NextNode(handlerIterRef) == LE_OK)
+    while (linkPtr != NULL)
     {
-        // For each registration, check to see if it was triggered.
-        Registration_t* registrationPtr = (Registration_t*)le_hashmap_GetValue(handlerIterRef);
+        tdb_NodeRef_t childRef = CONTAINER_OF(linkPtr, Node_t, siblingList);
+        tdb_NodeRef_t originalChildRef = childRef->shadowRef;
 
-        if (registrationPtr->triggered)
+        if (originalChildRef == NULL)
         {
-            // This registration has been triggered, so call all of the handlers attached to it.
-            le_dls_Link_t* linkPtr = le_dls_Peek(&registrationPtr->handlerList);
-
-            while (linkPtr != NULL)
-            {
-                Handler_t* handlerObjectPtr = CONTAINER_OF(linkPtr, Handler_t, link);
-
-                handlerObjectPtr->handlerPtr(handlerObjectPtr->contextPtr);
-                linkPtr = le_dls_PeekNext(&registrationPtr->handlerList, linkPtr);
-            }
+            tdb_GetNodeName(childRef, name, sizeof(name));
+            originalChildRef = GetNamedChild(originalRef, name);
+        }
 
-            // Now that that's done, clear the triggered flag.
-            registrationPtr->triggered = false;
+        if (originalChildRef != NULL)
+        {
+            tdb_GetNodeName(originalChildRef, name, sizeof(name));
+            FreezeNode(childRef, originalChildRef, GetNamedChild(snapshotNodeRef, name));
+        }
+        else if (IsDeleted(childRef) == false)
+        {
+            // The merge is going to add a new child to the original.
+            DetachSnapshotNode(snapshotNodeRef, false);
         }
+
+        linkPtr = le_dls_PeekNext(&nodeRef->info.children, linkPtr);
     }
 }
 
 
 
 
+#if LE_CONFIG_CFGTREE_JOURNAL
 // -------------------------------------------------------------------------------------------------
 /**
- *  Check the given node to see if it was renamed.
+ *  Journal operation codes.  A commit's journal entry holds one operation for each node that the
+ *  merge changed, in the order they were changed:
  *
- *  @return True if the node was renamed within this transaction.  False if not.
+ *  - JOURNAL_OP_SET, path, new name, type, has value, [value]: Create the node if needed, then
+ *    give it the name, type and value it has after the merge.
+ *  - JOURNAL_OP_DELETE, path: Delete the node.
+ *
+ *  A path is a count of names, followed by the names from the root node down to the node.  For a
+ *  renamed node, it is the path before the rename.
  */
 // -------------------------------------------------------------------------------------------------
-static bool WasRenamed
-(
-    tdb_NodeRef_t nodeRef  ///< [IN] Check this node to see if it was renamed in this transaction.
-)
-// -------------------------------------------------------------------------------------------------
-{
-    if (IsModified(nodeRef) == false)
-    {
-        // The node wasn't even modified, so it can not have been renamed.
-        return false;
-    }
-
-    if (nodeRef->shadowRef == NULL)
-    {
-        // If the node doesn't have a shadow reference, then most likely this is a new node and not
-        // a rename of an existing one.
-        return false;
-    }
-
-    if (nodeRef->nameRef == NULL)
-    {
-        // The shadow node does not have a local copy of a name, so it can not have been renamed.
-        // It must have been modified for other reasons.
-        return false;
-    }
-
-    // Looks like the node has a new name.
-    return true;
-}
+#define JOURNAL_OP_SET      1
+#define JOURNAL_OP_DELETE   2
 
 
 
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Check the original non-shadow node to see if it will need to be cleared during the merge.
+ *  Get the number of names in the path from the root node to a node.
  *
- *  @return True if the merge will clear out the original value.  False if not.
+ *  @return The depth of the node, 0 for the root.
  */
 // -------------------------------------------------------------------------------------------------
-static bool OriginalToBeCleared
+static uint32_t GetNodeDepth
 (
-    tdb_NodeRef_t nodeRef  ///< [IN] The shadow node to check.
+    tdb_NodeRef_t nodeRef  ///< [IN] The node, or NULL.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    le_cfg_nodeType_t nodeType = tdb_GetNodeType(nodeRef);
-
-    // If the nodeRef->type is LE_CFG_TYPE_EMPTY, tdb_GetNodeType will return node type of
-    // original node, which is incorrect. nodeType should be LE_CFG_TYPE_EMPTY.
-    if(nodeRef->type == LE_CFG_TYPE_EMPTY)
-    {
-      nodeType = LE_CFG_TYPE_EMPTY;
-    }
+    uint32_t depth = 0;
 
-    if (   (nodeType == LE_CFG_TYPE_EMPTY)
-        || (nodeType != tdb_GetNodeType(nodeRef->shadowRef)))
+    while (   (nodeRef != NULL)
+           && (nodeRef->parentRef != NULL))
     {
-        return true;
+        depth++;
+        nodeRef = nodeRef->parentRef;
     }
 
-    return false;
+    return depth;
 }
 
 
@@ -1301,27 +1917,27 @@ static bool OriginalToBeCleared
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Append the name of a node onto the end of a path object.
+ *  Put the names on the path from the root node down to a node into the journal entry.
  */
 // -------------------------------------------------------------------------------------------------
-static void AppendNodeName
+static void JournalPutNames
 (
-    le_pathIter_Ref_t pathRef,  ///< [IN] The path we're appending to.
-    tdb_NodeRef_t nodeRef       ///< [IN] The node we're appending.
+    tdb_NodeRef_t nodeRef  ///< [IN] The node.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    char nodeName[LE_CFG_NAME_LEN_BYTES] = "";
+    if (   (nodeRef == NULL)
+        || (nodeRef->parentRef == NULL))
+    {
+        return;
+    }
 
-    LE_ASSERT(tdb_GetNodeName(nodeRef, nodeName, sizeof(nodeName)) == LE_OK);
-    le_result_t result = le_pathIter_Append(pathRef, nodeName);
+    char name[LE_CFG_NAME_LEN_BYTES] = "";
 
-    LE_WARN_IF(result != LE_OK,
-               "Could not append node '%s' onto the update callback tracking path.  "
-               "Reason: %d, '%s'.",
-               nodeName,
-               result,
-               LE_RESULT_TXT(result));
+    JournalPutNames(nodeRef->parentRef);
+
+    tdb_GetNodeName(nodeRef, name, sizeof(name));
+    tjnl_PutString(name);
 }
 
 
@@ -1329,21 +1945,25 @@ static void AppendNodeName
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Create a new config path for the tree name given.
- *
- *  @return A new config path, rooted on the given tree.
+ *  Put the path to a node of the original tree into the journal entry.
  */
 // -------------------------------------------------------------------------------------------------
-static le_pathIter_Ref_t CreateBasePath
+static void JournalPutPath
 (
-    const char* treeNamePtr  ///< [IN] The tree name to use for the new path object.
+    tdb_NodeRef_t parentRef,  ///< [IN] The node's parent, or NULL for the root node.
+    const char* namePtr       ///< [IN] The node's name, (ignored for the root node.)
 )
 // -------------------------------------------------------------------------------------------------
 {
-    char basePath[CFG_MAX_PATH_SIZE] = { 0 };
+    if (parentRef == NULL)
+    {
+        tjnl_PutUint32(0);
+        return;
+    }
 
-    snprintf(basePath, sizeof(basePath), "%s:/", treeNamePtr);
-    return le_pathIter_CreateForUnix(basePath);
+    tjnl_PutUint32(GetNodeDepth(parentRef) + 1);
+    JournalPutNames(parentRef);
+    tjnl_PutString(namePtr);
 }
 
 
@@ -1351,23 +1971,22 @@ static le_pathIter_Ref_t CreateBasePath
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Generate a config path to the given node.
+ *  Record the deletion of a node of the original tree in the journal entry.  Called just before
+ *  the node is deleted.
  */
 // -------------------------------------------------------------------------------------------------
-static void GeneratePath
+static void JournalDeleteNode
 (
-    le_pathIter_Ref_t pathRef,  ///< [IN] The path object we're updating.
-    tdb_NodeRef_t nodeRef       ///< [IN] The node we're creating a path for.
+    tdb_NodeRef_t originalRef  ///< [IN] The node being deleted.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    if (nodeRef == NULL)
-    {
-        return;
-    }
+    char name[LE_CFG_NAME_LEN_BYTES] = "";
+
+    tdb_GetNodeName(originalRef, name, sizeof(name));
 
-    GeneratePath(pathRef, nodeRef->parentRef);
-    AppendNodeName(pathRef, nodeRef);
+    tjnl_PutUint32(JOURNAL_OP_DELETE);
+    JournalPutPath(originalRef->parentRef, name);
 }
 
 
@@ -1375,213 +1994,193 @@ static void GeneratePath
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Trigger callbacks for this node and all of it's children.
+ *  Record the new state of a merged node of the original tree in the journal entry.
  */
 // -------------------------------------------------------------------------------------------------
-static void FireAllChildren
+static void JournalSetNode
 (
-    le_pathIter_Ref_t pathRef,  ///< [IN] Path to the parent of the current node.
-    tdb_NodeRef_t nodeRef       ///< [IN] Node and any children to merge.
+    tdb_NodeRef_t originalRef,  ///< [IN] The node, after the merge.
+    const char* oldNamePtr      ///< [IN] The node's name before the merge.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // Add this node to the path we're using to find registered callbacks.
-    AppendNodeName(pathRef, nodeRef);
+    char name[LE_CFG_NAME_LEN_BYTES] = "";
 
-    // If the node is a stem then traverse it's children and try to trigger callbacks for them.  If
-    // there are no callbacks registered for those nodes, then nothing will happen.
-    if (nodeRef->type == LE_CFG_TYPE_STEM)
+    tdb_GetNodeName(originalRef, name, sizeof(name));
+
+    tjnl_PutUint32(JOURNAL_OP_SET);
+    JournalPutPath(originalRef->parentRef, oldNamePtr);
+    tjnl_PutString(name);
+    tjnl_PutUint32(originalRef->type);
+
+    if (   (originalRef->type != LE_CFG_TYPE_EMPTY)
+        && (originalRef->type != LE_CFG_TYPE_STEM)
+        && (originalRef->info.valueRef != NULL))
     {
-        tdb_NodeRef_t childRef = tdb_GetFirstChildNode(nodeRef);
+        char* stringBuffer = le_mem_ForceAlloc(EncodedStringPool);
 
-        while (childRef != NULL)
-        {
-            FireAllChildren(pathRef, childRef);
-            childRef = tdb_GetNextSiblingNode(childRef);
-        }
-    }
+        dstr_CopyToCstr(stringBuffer, TDB_MAX_ENCODED_SIZE, originalRef->info.valueRef, NULL);
 
-    // Like with the children, try to do the same for this node.  Then remove this node from the
-    // tracking path.
-    TriggerCallbacks(pathRef);
-    le_pathIter_Truncate(pathRef);
+        tjnl_PutUint32(true);
+        tjnl_PutString(stringBuffer);
+
+        le_mem_Release(stringBuffer);
+    }
+    else
+    {
+        tjnl_PutUint32(false);
+    }
 }
+#endif
 
 
 
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Check a given shadow node and the original node it's shadowing.  If the original has children
- *  that will be lost because of a merge, then we need to fire callbacks for those nodes that are
- *  about to go away.
- *
- *  The algorithm employed by this function is as follows:
- *
- *      1. Check the original node for the given shadow node.  If it exists and is a stem node,
- *         mark all of the children as deleted.  (This is done with the expectation that the
- *         original tree does not have nodes with the deleted flag set.)
- *
- *      2. Go through the shadow collection, and any shadow children that have links to the original
- *         nodes, clear the deleted flag.  These nodes are still considered "live."
- *
- *      3. Travers the original children one more time.  For any node that is still marked as
- *         deleted we queue up an event handler.  As this node has been removed from the colection
- *         and will be removed as part of the final merge.  The delete flag is also cleared at this
- *         step to ensure that there are no external side effects.
+ *  Merge a shadow node with the original it represents.
  */
 // -------------------------------------------------------------------------------------------------
-static void FireLostChildren
+static void MergeNode
 (
-    le_pathIter_Ref_t pathRef,   ///< [IN] Path to the parent of the current node.
-    tdb_NodeRef_t shadowNodeRef  ///< [IN] Node and any children to merge.
+    tdb_NodeRef_t nodeRef  ///< [IN] The shadow node to merge.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // Is the original a stem?  If no, then done.
-    tdb_NodeRef_t originalRef = shadowNodeRef->shadowRef;
+    LE_ASSERT(nodeRef != NULL);
 
-    if (originalRef->type != LE_CFG_TYPE_STEM)
+    // If this shadow node for some reason doesn't have a ref check for an original version of it in
+    // the original tree.  This shadow node may have been destroyed and re-created loosing this
+    // link.
+    if (nodeRef->shadowRef == NULL)
     {
-        return;
-    }
-
-    // Mark all originals deleted.
-    tdb_NodeRef_t originalChildRef = tdb_GetFirstChildNode(originalRef);
+        tdb_NodeRef_t shadowedParentRef = tdb_GetNodeParent(nodeRef)->shadowRef;
 
-    while (originalChildRef != NULL)
-    {
-        // Children in the original tree shouldn't currently be marked as deleted.
-        LE_ASSERT(IsDeleted(originalChildRef) == false);
+        if (shadowedParentRef != NULL)
+        {
+            char name[LE_CFG_NAME_LEN_BYTES] = "";
 
-        SetDeletedFlag(originalChildRef);
-        originalChildRef = tdb_GetNextSiblingNode(originalChildRef);
+            tdb_GetNodeName(nodeRef, name, sizeof(name));
+            nodeRef->shadowRef = GetNamedChild(shadowedParentRef, name);
+        }
     }
 
-    // Follow through all of the shadow links and unmark deletions.
-    if (shadowNodeRef->type == LE_CFG_TYPE_STEM)
+    // If this node has been marked as deleted, then simply drop the original node and move on.
+    if (IsDeleted(nodeRef))
     {
-        tdb_NodeRef_t shadowChildRef = tdb_GetFirstChildNode(shadowNodeRef);
-
-        while (shadowChildRef != NULL)
+#if LE_CONFIG_CFGTREE_JOURNAL
+        if (nodeRef->shadowRef != NULL)
         {
-            if (shadowChildRef->shadowRef != NULL)
-            {
-                ClearDeletedFlag(shadowChildRef->shadowRef);
-            }
-
-            shadowChildRef = tdb_GetNextSiblingNode(shadowChildRef);
+            JournalDeleteNode(nodeRef->shadowRef);
         }
-    }
-
-    // Fire on all original nodes still marked.  But also take care to clear the deleted flags here
-    // in order to leave everything as it was.
-    originalChildRef = tdb_GetFirstChildNode(originalRef);
+#endif
 
-    while (originalChildRef != NULL)
-    {
-        if (IsDeleted(originalChildRef) == true)
+        if (   (nodeRef->shadowRef != NULL)
+            && (tdb_GetNodeParent(nodeRef->shadowRef) != NULL))
         {
-            FireAllChildren(pathRef, originalChildRef);
-            ClearDeletedFlag(originalChildRef);
+            le_mem_Release(nodeRef->shadowRef);
+        }
+        else
+        {
+            // We delete every node but the root node.  Since this is the root node, we just need
+            // to clear it out.
+            tdb_SetEmpty(nodeRef->shadowRef);
         }
 
-        originalChildRef = tdb_GetNextSiblingNode(originalChildRef);
+        return;
     }
-}
 
+    // If the original node doesn't exist, create it now.
+    tdb_NodeRef_t originalRef = nodeRef->shadowRef;
 
+    if (originalRef == NULL)
+    {
+        LE_ASSERT(nodeRef->parentRef != NULL);
+        LE_ASSERT(nodeRef->parentRef->shadowRef != NULL);
 
+        nodeRef->shadowRef = originalRef = NewChildNode(nodeRef->parentRef->shadowRef);
+    }
 
-// -------------------------------------------------------------------------------------------------
-/**
- *  Recursive function to merge a collection of shadow nodes with the original tree.
- *
- *  @return True if the given node or any if it's children have been modified.  False if not.
- */
-// -------------------------------------------------------------------------------------------------
-static bool InternalMergeTree
-(
-    const char* treeNamePtr,    ///< [IN] The name of the tree we're merging.
-    le_pathIter_Ref_t pathRef,  ///< [IN] Path to the parent of hte current node.
-    tdb_NodeRef_t nodeRef,      ///< [IN] Node and any children to merge.
-    bool forceFire              ///< [IN] Should update handlers be fired for this node and all it's
-                                ///<      children, regardless of wether or not this node has been
-                                ///<      directly modified?
-)
-// -------------------------------------------------------------------------------------------------
-{
-    bool isModified = IsModified(nodeRef);
-    bool renamed = WasRenamed(nodeRef);
+    ClearModifiedFlag(originalRef);
 
-    // If this node was renamed, then all children also need to be triggered as well.
-    forceFire = renamed || forceFire;
+#if LE_CONFIG_CFGTREE_JOURNAL
+    // A new node has no name of its own yet, it'll get the shadow node's name below.
+    char oldName[LE_CFG_NAME_LEN_BYTES] = "";
 
-    // If this node has been renamed, marked as deleted or set empty, then all of the children need
-    // notifications fired on the original nodes.
-    if (   (renamed == true)
-        || (IsDeleted(nodeRef) == true)
-        || (OriginalToBeCleared(nodeRef) == true))
-    {
-        le_pathIter_Ref_t originalPathRef = CreateBasePath(treeNamePtr);
+    tdb_GetNodeName((originalRef->nameRef != NULL) ? originalRef : nodeRef,
+                    oldName,
+                    sizeof(oldName));
+#endif
 
-        if (nodeRef->shadowRef != NULL)
+    // If the name has been changed, then copy it over now.
+    if (dstr_IsNullOrEmpty(nodeRef->nameRef) == false)
+    {
+        if (originalRef->nameRef != NULL)
         {
-            GeneratePath(originalPathRef, nodeRef->shadowRef->parentRef);
-            FireAllChildren(originalPathRef, nodeRef->shadowRef);
+            dstr_Release(originalRef->nameRef);
         }
 
-        le_pathIter_Delete(originalPathRef);
+        // Names are interned, so this shares the name rather than copying it.
+        originalRef->nameRef = dstr_NewFromDstr(nodeRef->nameRef);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+        RemoveFromChildIndex(originalRef);
+#endif
+        originalRef->nameHash = nodeRef->nameHash;
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+        AddToChildIndex(originalRef);
+#endif
     }
-    else if (   (isModified == true)
-             && (nodeRef->type == LE_CFG_TYPE_STEM))
-    {
-        le_pathIter_Ref_t originalPathRef = CreateBasePath(treeNamePtr);
 
-        GeneratePath(originalPathRef, nodeRef->shadowRef);
-        FireLostChildren(originalPathRef, nodeRef);
+    // Check the types of the original and the shadow nodes.  If the new node has been cleared,
+    // then clear out the original node.  If the types have changed, then clear out the original so
+    // that we can properly populate it again.
+    le_cfg_nodeType_t nodeType = tdb_GetNodeType(nodeRef);
 
-        le_pathIter_Delete(originalPathRef);
+    // If the nodeRef->type is LE_CFG_TYPE_EMPTY, tdb_GetNodeType will return node type of
+    // original node, which is incorrect. nodeType should be LE_CFG_TYPE_EMPTY.
+    if(nodeRef->type == LE_CFG_TYPE_EMPTY)
+    {
+      nodeType = LE_CFG_TYPE_EMPTY;
     }
 
-    AppendNodeName(pathRef, nodeRef);
-
-    // IF this node is modified, mearge it.  If this node is a stem, then merge it's children.  Keep
-    // track of whether any of those children have been modified as well.
-    if (isModified)
+    if (   (nodeType == LE_CFG_TYPE_EMPTY)
+        || (nodeType != originalRef->type))
     {
-        MergeNode(nodeRef);
+        tdb_SetEmpty(originalRef);
     }
 
-    if (   (nodeRef->type == LE_CFG_TYPE_STEM)
-        && (IsDeleted(nodeRef) == false))
+    // Ok, we know that the node hasn't been deleted.  Check to see if it's considered empty and
+    // that it isn't a stem.  If not, then copy over the string value.
+    if (   (nodeType != LE_CFG_TYPE_EMPTY)
+        && (nodeType != LE_CFG_TYPE_STEM))
     {
-        nodeRef = tdb_GetFirstChildNode(nodeRef);
-
-        while (nodeRef != NULL)
+        if (nodeRef->info.valueRef != NULL)
         {
-            tdb_NodeRef_t nextNodeRef = tdb_GetNextSiblingNode(nodeRef);
+            if (originalRef->info.valueRef != NULL)
+            {
+                dstr_Copy(originalRef->info.valueRef, nodeRef->info.valueRef);
+            }
+            else
+            {
+                originalRef->info.valueRef = dstr_NewFromDstr(nodeRef->info.valueRef);
+            }
 
-            isModified = InternalMergeTree(treeNamePtr, pathRef, nodeRef, forceFire) || isModified;
-            nodeRef = nextNodeRef;
+            // Propigate over the type as that may have changed, like going from an int value to a
+            // bool value.
+
+            originalRef->type = nodeRef->type;
         }
     }
 
-    // If this node, or any of it's children have been modified.  Try to fire any callbacks that may
-    // be registered.
-    if (isModified || forceFire)
-    {
-        TriggerCallbacks(pathRef);
-    }
+#if LE_CONFIG_CFGTREE_JOURNAL
+    JournalSetNode(originalRef, oldName);
+#endif
 
-    // Now remove this node from the tracking path and let our caller know if any modifications have
-    // happened at this level or lower.
-    if (le_pathIter_GoToEnd(pathRef) == LE_OK)
-    {
-        le_pathIter_Truncate(pathRef);
-    }
+    // Now at this point, if both the original and the shadow node are stems, we'll let the function
+    // InternalMergeTree take care of the children, (if any.)
 
-    return isModified;
+    // If the original has been cleared out, we can still just rely on InternalMergeTree to
+    // propigate over the new nodes.
 }
 
 
@@ -1589,31 +2188,30 @@ static bool InternalMergeTree
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Create a new tree object and set it to default values.
- *
- *  @return A ref to the newly created tree object.
+ *  Deliver the changes gathered for a coalesced change handler, and start gathering again.
  */
 // -------------------------------------------------------------------------------------------------
-tdb_TreeRef_t NewTree
+static void NotifyChanges
 (
-    const char* treeNameRef,   ///< [IN] The name of the new tree.
-    tdb_NodeRef_t rootNodeRef  ///< [IN] The root node of this new tree.
+    Handler_t* handlerObjectPtr  ///< [IN] The coalesced handler to notify.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    tdb_TreeRef_t treeRef = le_mem_ForceAlloc(TreePoolRef);
+    if (handlerObjectPtr->changesRef == NULL)
+    {
+        return;
+    }
 
-    LE_ASSERT(le_utf8_Copy(treeRef->name, treeNameRef, MAX_TREE_NAME_BYTES, NULL) == LE_OK);
+    dstr_CopyToCstr(ChangeListBuffer,
+                    sizeof(ChangeListBuffer),
+                    handlerObjectPtr->changesRef,
+                    NULL);
 
-    treeRef->isDeletePending = false;
-    treeRef->originalTreeRef = NULL;
-    treeRef->revisionId = 0;
-    treeRef->rootNodeRef = (rootNodeRef != NULL) ? rootNodeRef : NewNode();
-    treeRef->activeReadCount = 0;
-    treeRef->activeWriteIterRef = NULL;
-    treeRef->requestList = LE_SLS_LIST_INIT;
+    dstr_Release(handlerObjectPtr->changesRef);
+    handlerObjectPtr->changesRef = NULL;
+    handlerObjectPtr->changesOverflowed = false;
 
-    return treeRef;
+    handlerObjectPtr->coalescedHandlerPtr(ChangeListBuffer, handlerObjectPtr->contextPtr);
 }
 
 
@@ -1621,25 +2219,16 @@ tdb_TreeRef_t NewTree
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Destructor called when a tree object is to be freed from memory.
+ *  Called when a coalesced change handler's hold-off time is up.
  */
 // -------------------------------------------------------------------------------------------------
-static void TreeDestructor
+static void OnHoldOffExpired
 (
-    void* objectPtr  ///< The memory object to destruct.
+    le_timer_Ref_t timerRef  ///< [IN] The handler's hold-off timer.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    tdb_TreeRef_t treeRef = (tdb_TreeRef_t)objectPtr;
-
-    // Kill the root node.
-    le_mem_Release(treeRef->rootNodeRef);
-    treeRef->rootNodeRef = NULL;
-
-    // Sanity check, is the tree actually ready to clean up?
-    LE_ASSERT(treeRef->activeReadCount == 0);
-    LE_ASSERT(treeRef->activeWriteIterRef == NULL);
-    LE_ASSERT(le_sls_IsEmpty(&treeRef->requestList) == true);
+    NotifyChanges(le_timer_GetContextPtr(timerRef));
 }
 
 
@@ -1647,40 +2236,85 @@ static void TreeDestructor
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Create a path to a tree file with the given revision id.
- *
- *  @return A stringBuffer backed string containing the full path to the tree file.
+ *  Add a path to the list of changes gathered for a coalesced change handler, unless it's already
+ *  there.  If the list would overflow, it's replaced with just the registration path.
  */
 // -------------------------------------------------------------------------------------------------
-static void GetTreePath
+static void AddChangedPath
 (
-    const char* treeNameRef,  ///< [IN] The name of the tree we're generating a name for.
-    int revisionId,           ///< [IN] Generate a name based on the tree revision.
-    char* pathBuffer,         ///< [IN] Buffer to hold the new path.
-    size_t pathSize           ///< [IN] Size of the path buffer.
+    Handler_t* handlerObjectPtr,  ///< [IN] The coalesced handler.
+    const char* pathPtr           ///< [IN] The changed path.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // paper    --> rock       1 -> 2
-    // rock     --> scissors   2 -> 3
-    // scissors --> paper      3 -> 1
+    if (handlerObjectPtr->changesOverflowed)
+    {
+        return;
+    }
 
-    static const char* revNames[] = { "paper", "rock", "scissors" };
-    int printSize;
+    size_t pathLen = strlen(pathPtr);
+    size_t listLen = 0;
 
-    LE_ASSERT((revisionId >= 1) && (revisionId <= 3));
+    ChangeListBuffer[0] = '\0';
 
-    printSize = snprintf(pathBuffer,
-                         pathSize,
-                         "%s/%s.%s",
-                         CFG_TREE_PATH,
-                         treeNameRef,
-                         revNames[revisionId - 1]);
+    if (handlerObjectPtr->changesRef != NULL)
+    {
+        dstr_CopyToCstr(ChangeListBuffer,
+                        sizeof(ChangeListBuffer),
+                        handlerObjectPtr->changesRef,
+                        &listLen);
 
-    if (printSize >= pathSize)
+        // Look for the path among the lines already in the list.
+        const char* linePtr = ChangeListBuffer;
+
+        while (linePtr != NULL)
+        {
+            if (   (strncmp(linePtr, pathPtr, pathLen) == 0)
+                && ((linePtr[pathLen] == '\n') || (linePtr[pathLen] == '\0')))
+            {
+                return;
+            }
+
+            linePtr = strchr(linePtr, '\n');
+
+            if (linePtr != NULL)
+            {
+                linePtr++;
+            }
+        }
+    }
+
+    if ((listLen + 1 + pathLen) < sizeof(ChangeListBuffer))
     {
-       LE_ERROR("Unable to store config tree path in buffer");
-       pathBuffer[0] = '\0';
+        if (listLen > 0)
+        {
+            ChangeListBuffer[listLen++] = '\n';
+        }
+
+        memcpy(&ChangeListBuffer[listLen], pathPtr, pathLen + 1);
+    }
+    else
+    {
+        le_utf8_Copy(ChangeListBuffer,
+                     handlerObjectPtr->registrationPtr->registrationPath,
+                     sizeof(ChangeListBuffer),
+                     NULL);
+        handlerObjectPtr->changesOverflowed = true;
+    }
+
+    if (handlerObjectPtr->changesRef == NULL)
+    {
+        handlerObjectPtr->changesRef = dstr_NewFromCstr(ChangeListBuffer);
+    }
+    else
+    {
+        dstr_CopyFromCstr(handlerObjectPtr->changesRef, ChangeListBuffer);
+    }
+
+    if (   (handlerObjectPtr->holdOffTimer != NULL)
+        && (le_timer_IsRunning(handlerObjectPtr->holdOffTimer) == false))
+    {
+        le_timer_Start(handlerObjectPtr->holdOffTimer);
     }
 }
 
@@ -1689,110 +2323,183 @@ static void GetTreePath
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Check to see if a configTree file at the given revision already exists in the filesystem.
- *
- *  @note If the tree file exists, but is empty, then it is invalid and will be deleted.
+ *  Called to fire any callbacks registered on the given node path.  If nothing is registered on the
+ *  given path, nothing happens.
  *
- *  @return True if the named file exists, false otherwise.
+ *  The coalesced handlers registered on the node's parent also get the node's path added to their
+ *  lists of changes.
  */
 // -------------------------------------------------------------------------------------------------
-static bool TreeFileExists
+static void TriggerCallbacks
 (
-    const char* treeNameRef,  ///< [IN] Name of the tree to check.
-    int revisionId            ///< [IN] The revision of the tree to check against.
+    const CallbackPath_t* pathPtr  ///< [IN] The path to search for callback registrations.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    char fullPath[LE_CFG_STR_LEN_BYTES] = "";
-    GetTreePath(treeNameRef, revisionId, fullPath, sizeof(fullPath));
-
-    // Make sure this part was successful.
-    if (fullPath[0] == '\0')
+    if (pathPtr->length >= CFG_MAX_PATH_SIZE)
     {
-        return false;
+        LE_ERROR("Callback path buffer overflow.");
+        return;
     }
 
-    // stat() the file to see if it exists and get its size.
-    struct stat s;
-    if (stat(fullPath, &s) == -1)
+    const char* pathBuffer = pathPtr->text;
+
+    // Try to find a registration object for this path.  If one is found, flag it for calling once
+    // the merge is complete.
+    Registration_t* foundRegistrationPtr = le_hashmap_Get(HandlerRegistrationMap, pathBuffer);
+
+    if (foundRegistrationPtr != NULL)
     {
-        LE_DEBUG("Can't stat file '%s' (%m).", fullPath);
-        return false;
+        foundRegistrationPtr->triggered = true;
     }
 
-    // Make sure it's a regular file.
-    if (!S_ISREG(s.st_mode))
+    if (CoalescedHandlerCount == 0)
     {
-        LE_FATAL("Object at '%s' is not a regular file.", fullPath);
+        return;
     }
 
-    // If it's zero size, delete it and report that it doesn't exist.
-    if (s.st_size == 0)
+    // Strip the last name off of the path to get the parent's path.  The root node has no parent.
+    char parentBuffer[CFG_MAX_PATH_SIZE];
+    le_utf8_Copy(parentBuffer, pathBuffer, sizeof(parentBuffer), NULL);
+
+    char* treeEndPtr = strchr(parentBuffer, ':');
+    char* lastSlashPtr = strrchr(parentBuffer, '/');
+
+    if (   (treeEndPtr == NULL)
+        || (lastSlashPtr == NULL)
+        || (lastSlashPtr <= treeEndPtr)
+        || (lastSlashPtr[1] == '\0'))
     {
-        if (unlink(fullPath) == -1)
-        {
-            LE_FATAL("Failed to unlink empty file '%s' (%m).", fullPath);
-        }
+        return;
+    }
 
-        return false;
+    *lastSlashPtr = '\0';
+
+    Registration_t* parentRegistrationPtr = le_hashmap_Get(HandlerRegistrationMap, parentBuffer);
+
+    if (   (parentRegistrationPtr == NULL)
+        || (parentRegistrationPtr->coalescedCount == 0))
+    {
+        return;
     }
 
-    // NOTE: The Config Tree generally runs as root, so permissions should be irrelevant.
+    parentRegistrationPtr->childTriggered = true;
 
-    return true;
+    le_dls_Link_t* linkPtr = le_dls_Peek(&parentRegistrationPtr->handlerList);
+
+    while (linkPtr != NULL)
+    {
+        Handler_t* handlerObjectPtr = CONTAINER_OF(linkPtr, Handler_t, link);
+
+        if (handlerObjectPtr->isCoalesced)
+        {
+            AddChangedPath(handlerObjectPtr, pathBuffer);
+        }
+
+        linkPtr = le_dls_PeekNext(&parentRegistrationPtr->handlerList, linkPtr);
+    }
 }
 
 
 
 
+
 // -------------------------------------------------------------------------------------------------
 /**
- * Check the filesystem and get the current "valid" version of the file and update the tree object
- * with that version number.
+ *  Go through all of the registered event callbacks, and fire the call backs for each of the
+ *  registrations that has been makred as triggered.  Coalesced handlers are given the list of
+ *  changes gathered for them, unless they're holding off to gather more.
  *
- * If there are two files for a given tree, we use the older one.  The idea being, if there are
- * two versions of the same file in the filesystem then there was a system failure during a save
- * operation.  So we abandon the newer (probably incomplete) file and go with the older file;
- * unless the size of the older file is zero, which can happen if deletion of that file is
- * interrupted.
+ *  Once this is done, the triggered flag is cleared for next time.
  */
 // -------------------------------------------------------------------------------------------------
-static void UpdateRevision
+static void FireTriggeredCallbacks
 (
-    tdb_TreeRef_t treeRef  ///< [IN] Update the revision for this tree object.
+    void
 )
 // -------------------------------------------------------------------------------------------------
 {
-    int newRevision = 0;
+    // Go through the registration map.
+    le_hashmap_It_Ref_t handlerIterRef = le_hashmap_GetIterator(HandlerRegistrationMap);
 
-    if (TreeFileExists(treeRef->name, 1))
+    while (le_hashmap_NextNode(handlerIterRef) == LE_OK)
     {
-        if (TreeFileExists(treeRef->name, 3))
-        {
-            newRevision = 3;
-        }
-        else
+        // For each registration, check to see if it was triggered.
+        Registration_t* registrationPtr = (Registration_t*)le_hashmap_GetValue(handlerIterRef);
+
+        if (registrationPtr->triggered)
         {
-            newRevision = 1;
+            // This registration has been triggered, so call all of the handlers attached to it.
+            le_dls_Link_t* linkPtr = le_dls_Peek(&registrationPtr->handlerList);
+
+            while (linkPtr != NULL)
+            {
+                Handler_t* handlerObjectPtr = CONTAINER_OF(linkPtr, Handler_t, link);
+                linkPtr = le_dls_PeekNext(&registrationPtr->handlerList, linkPtr);
+
+                if (handlerObjectPtr->isCoalesced == false)
+                {
+                    handlerObjectPtr->handlerPtr(handlerObjectPtr->contextPtr);
+                    continue;
+                }
+
+                // If none of the children were changed, the node itself was.
+                if (registrationPtr->childTriggered == false)
+                {
+                    AddChangedPath(handlerObjectPtr, registrationPtr->registrationPath);
+                }
+
+                if (handlerObjectPtr->holdOffTimer == NULL)
+                {
+                    NotifyChanges(handlerObjectPtr);
+                }
+            }
+
+            // Now that that's done, clear the triggered flags.
+            registrationPtr->triggered = false;
+            registrationPtr->childTriggered = false;
         }
     }
-    else if (TreeFileExists(treeRef->name, 3))
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Check the given node to see if it was renamed.
+ *
+ *  @return True if the node was renamed within this transaction.  False if not.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool WasRenamed
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] Check this node to see if it was renamed in this transaction.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (IsModified(nodeRef) == false)
     {
-        if (TreeFileExists(treeRef->name, 2))
-        {
-            newRevision = 2;
-        }
-        else
-        {
-            newRevision = 3;
-        }
+        // The node wasn't even modified, so it can not have been renamed.
+        return false;
     }
-    else if (TreeFileExists(treeRef->name, 2))
+
+    if (nodeRef->shadowRef == NULL)
     {
-        newRevision = 2;
+        // If the node doesn't have a shadow reference, then most likely this is a new node and not
+        // a rename of an existing one.
+        return false;
     }
 
-    treeRef->revisionId = newRevision;
+    if (nodeRef->nameRef == NULL)
+    {
+        // The shadow node does not have a local copy of a name, so it can not have been renamed.
+        // It must have been modified for other reasons.
+        return false;
+    }
+
+    // Looks like the node has a new name.
+    return true;
 }
 
 
@@ -1800,19 +2507,33 @@ static void UpdateRevision
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Peek into the input stream one character ahead.
+ *  Check the original non-shadow node to see if it will need to be cleared during the merge.
+ *
+ *  @return True if the merge will clear out the original value.  False if not.
  */
 // -------------------------------------------------------------------------------------------------
-static signed char PeekChar
+static bool OriginalToBeCleared
 (
-    FILE* filePtr  ///< [IN] The file stream to peek into.
+    tdb_NodeRef_t nodeRef  ///< [IN] The shadow node to check.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    int next = fgetc(filePtr);
-    ungetc(next, filePtr);
+    le_cfg_nodeType_t nodeType = tdb_GetNodeType(nodeRef);
 
-    return next;
+    // If the nodeRef->type is LE_CFG_TYPE_EMPTY, tdb_GetNodeType will return node type of
+    // original node, which is incorrect. nodeType should be LE_CFG_TYPE_EMPTY.
+    if(nodeRef->type == LE_CFG_TYPE_EMPTY)
+    {
+      nodeType = LE_CFG_TYPE_EMPTY;
+    }
+
+    if (   (nodeType == LE_CFG_TYPE_EMPTY)
+        || (nodeType != tdb_GetNodeType(nodeRef->shadowRef)))
+    {
+        return true;
+    }
+
+    return false;
 }
 
 
@@ -1820,104 +2541,99 @@ static signed char PeekChar
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Skip any whitespace encountered in the input stream.  Stop skipping once we hit a valid token.
+ *  Append the name of a node onto the end of a callback path.  The root node has no name, so
+ *  appending it leaves the path as it is.
  *
- *  @return LE_OK if the whitespace is skiped and there is still more file to read.
- *          LE_OUT_OF_RANGE if the end of the file is hit.
+ *  @return The length of the path before the append, to be given to RemoveNodeName().
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t SkipWhiteSpace
+static size_t AppendNodeName
 (
-    FILE* filePtr  ///< [IN] The file stream to seek through.
+    CallbackPath_t* pathPtr,  ///< [IN] The path we're appending to.
+    tdb_NodeRef_t nodeRef     ///< [IN] The node we're appending.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    bool done = false;
-    bool isEof = false;
+    size_t oldLength = pathPtr->length;
+    char nodeName[LE_CFG_NAME_LEN_BYTES] = "";
 
-    while (done == false)
+    LE_ASSERT(tdb_GetNodeName(nodeRef, nodeName, sizeof(nodeName)) == LE_OK);
+
+    if (   (nodeName[0] == '\0')
+        || (oldLength >= CFG_MAX_PATH_SIZE))
     {
-        switch (PeekChar(filePtr))
-        {
-            case '\n':
-            case '\r':
-            case '\t':
-            case ' ':
-                // Eat the character.
-                fgetc(filePtr);
-                break;
+        return oldLength;
+    }
 
-            case EOF:
-                done = true;
-                isEof = true;
-                break;
+    size_t nameLength = strlen(nodeName);
 
-            default:
-                done = true;
-                break;
-        }
+    if (oldLength + 1 + nameLength >= CFG_MAX_PATH_SIZE)
+    {
+        LE_WARN("Could not append node '%s' onto the update callback tracking path.  "
+                "Reason: %d, '%s'.",
+                nodeName,
+                LE_OVERFLOW,
+                LE_RESULT_TXT(LE_OVERFLOW));
+
+        pathPtr->length = CFG_MAX_PATH_SIZE;
+        return oldLength;
     }
 
-    return isEof == true ? LE_OUT_OF_RANGE : LE_OK;
+    pathPtr->text[oldLength] = '/';
+    memcpy(pathPtr->text + oldLength + 1, nodeName, nameLength + 1);
+    pathPtr->length = oldLength + 1 + nameLength;
+
+    return oldLength;
 }
 
 
+
+
 // -------------------------------------------------------------------------------------------------
 /**
- *  Skip to the next occurence of the given character.
- *
- *  @return LE_OK if the character is found.
- *          LE_OUT_OF_RANGE if the end of the file is hit.
+ *  Remove the node name appended to a callback path by AppendNodeName().
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t SkipToNextChar
+static void RemoveNodeName
 (
-    FILE* filePtr,          ///< [IN] The file stream to seek through.
-    signed char nextChar    ///< [IN]  The character we're searching for.
+    CallbackPath_t* pathPtr,  ///< [IN] The path we're updating.
+    size_t oldLength          ///< [IN] The length returned by AppendNodeName().
 )
+// -------------------------------------------------------------------------------------------------
 {
-    int next;
+    pathPtr->length = oldLength;
 
-    while ((next = fgetc(filePtr)) != nextChar)
+    if (oldLength < CFG_MAX_PATH_SIZE)
     {
-        if (next == EOF)
-        {
-            return LE_OUT_OF_RANGE;
-        }
+        pathPtr->text[oldLength] = '\0';
     }
-
-    return LE_OK;
 }
 
 
+
+
 // -------------------------------------------------------------------------------------------------
 /**
- *  Read a boolean literal from the input file.
- *
- *  @return LE_OK if the literal could be read.
- *          LE_FORMAT_ERROR if the literal could not be read.
+ *  Start a callback path at the root of the named tree.
  */
 // -------------------------------------------------------------------------------------------------
-static bool ReadBoolToken
+static void InitBasePath
 (
-    FILE* filePtr,     ///< [IN]  The file we're reading from.
-    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
-    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
+    CallbackPath_t* pathPtr,  ///< [OUT] The path to initialize.
+    const char* treeNamePtr   ///< [IN] The tree name to use for the path.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    int next = fgetc(filePtr);
-
-    if (   (next == 't')
-        || (next == 'f'))
+    if (le_utf8_Copy(pathPtr->text, treeNamePtr, sizeof(pathPtr->text) - 1, NULL) != LE_OK)
     {
-        stringPtr[0] = next;
-        stringPtr[1] = 0;
-
-        return LE_OK;
+        LE_ERROR("Tree name '%s' is too long for a callback path.", treeNamePtr);
+        pathPtr->length = CFG_MAX_PATH_SIZE;
+        return;
     }
 
-    return LE_FORMAT_ERROR;
+    pathPtr->length = strlen(pathPtr->text);
+    pathPtr->text[pathPtr->length++] = ':';
+    pathPtr->text[pathPtr->length] = '\0';
 }
 
 
@@ -1925,102 +2641,60 @@ static bool ReadBoolToken
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Read a textual literal from the input file, the read is terminated successfuly if the terminal
- *  character is found.
- *
- *  @return LE_OK if the string is read from the file.
- *          LE_FORMAT_ERROR if the text fails to be read from the file.
- *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
+ *  Generate a config path to the given node.
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t ReadTextLiteral
+static void GeneratePath
 (
-    FILE* filePtr,        ///< [IN]  The file we're reading from.
-    char* stringPtr,      ///< [OUT] String buffer to hold the token we've read.
-    size_t stringSize,    ///< [IN]  How big is the supplied string buffer?
-    signed char terminal  ///< [IN]  The terminal character we're searching for.
+    CallbackPath_t* pathPtr,  ///< [IN] The path we're updating.
+    tdb_NodeRef_t nodeRef     ///< [IN] The node we're creating a path for.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    int next;
-    size_t count = 0;
+    if (nodeRef == NULL)
+    {
+        return;
+    }
 
-    char* oldPtr = stringPtr;
-
-    while ((next = fgetc(filePtr)) != terminal)
-    {
-        if (next == EOF)
-        {
-            LE_ERROR("Missing end specifier, ']' in int value.");
-            return LE_FORMAT_ERROR;
-        }
-
-        if (next == '\\')
-        {
-            next = fgetc(filePtr);
-
-            if (next == EOF)
-            {
-                LE_ERROR("Unexpected EOF after finding \\ character.");
-                return LE_FORMAT_ERROR;
-            }
-        }
-
-        if (count >= (stringSize - 1))
-        {
-            // truncate the string to the buffer size
-            *stringPtr = 0;
-
-            LE_ERROR("String literal is too large.  (%" PRIdS "/%" PRIdS ")",
-                     strlen(oldPtr),
-                     stringSize);
-            // move the file pointer to the terminal character (e.g. closing quote)
-            if (LE_OK == SkipToNextChar(filePtr, terminal))
-            {
-                return LE_OVERFLOW;
-            }
-            else
-            {
-                return LE_FORMAT_ERROR;
-            }
-        }
-
-        *stringPtr = next;
-
-        ++stringPtr;
-        ++count;
-    }
-
-    *stringPtr = 0;
-
-    return LE_OK;
-}
+    GeneratePath(pathPtr, nodeRef->parentRef);
+    AppendNodeName(pathPtr, nodeRef);
+}
 
 
 
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Read an integer token string from the file.
- *
- *  @return LE_OK if the string is read from the file.
- *          LE_FORMAT_ERROR if the text fails to be read from the file.
- *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
+ *  Trigger callbacks for this node and all of it's children.
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t ReadIntToken
+static void FireAllChildren
 (
-    FILE* filePtr,     ///< [IN]  The file we're reading from.
-    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
-    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
+    CallbackPath_t* pathPtr,  ///< [IN] Path to the parent of the current node.
+    tdb_NodeRef_t nodeRef     ///< [IN] Node and any children to merge.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    le_result_t result = ReadTextLiteral(filePtr, stringPtr, stringSize, ']');
+    // Add this node to the path we're using to find registered callbacks.
+    size_t parentLength = AppendNodeName(pathPtr, nodeRef);
 
-    // TODO: Validate the int string.
+    // If the node is a stem then traverse it's children and try to trigger callbacks for them.  If
+    // there are no callbacks registered for those nodes, then nothing will happen.
+    if (nodeRef->type == LE_CFG_TYPE_STEM)
+    {
+        tdb_NodeRef_t childRef = tdb_GetFirstChildNode(nodeRef);
 
-    return result;
+        while (childRef != NULL)
+        {
+            FireAllChildren(pathPtr, childRef);
+            childRef = tdb_GetNextSiblingNode(childRef);
+        }
+    }
+
+    // Like with the children, try to do the same for this node.  Then remove this node from the
+    // tracking path.
+    TriggerCallbacks(pathPtr);
+    RemoveNodeName(pathPtr, parentLength);
 }
 
 
@@ -2028,53 +2702,82 @@ static le_result_t ReadIntToken
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Read a floating point token string from the file.
+ *  Check a given shadow node and the original node it's shadowing.  If the original has children
+ *  that will be lost because of a merge, then we need to fire callbacks for those nodes that are
+ *  about to go away.
  *
- *  @return LE_OK if the string is read from the file.
- *          LE_FORMAT_ERROR if the text fails to be read from the file.
- *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
+ *  The algorithm employed by this function is as follows:
+ *
+ *      1. Check the original node for the given shadow node.  If it exists and is a stem node,
+ *         mark all of the children as deleted.  (This is done with the expectation that the
+ *         original tree does not have nodes with the deleted flag set.)
+ *
+ *      2. Go through the shadow collection, and any shadow children that have links to the original
+ *         nodes, clear the deleted flag.  These nodes are still considered "live."
+ *
+ *      3. Travers the original children one more time.  For any node that is still marked as
+ *         deleted we queue up an event handler.  As this node has been removed from the colection
+ *         and will be removed as part of the final merge.  The delete flag is also cleared at this
+ *         step to ensure that there are no external side effects.
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t ReadFloatToken
+static void FireLostChildren
 (
-    FILE* filePtr,     ///< [IN]  The file we're reading from.
-    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
-    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
+    CallbackPath_t* pathPtr,     ///< [IN] Path to the parent of the current node.
+    tdb_NodeRef_t shadowNodeRef  ///< [IN] Node and any children to merge.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    le_result_t result = ReadTextLiteral(filePtr, stringPtr, stringSize, ')');
+    // Is the original a stem?  If no, then done.
+    tdb_NodeRef_t originalRef = shadowNodeRef->shadowRef;
 
-    // TODO: Validate the float string.
+    if (originalRef->type != LE_CFG_TYPE_STEM)
+    {
+        return;
+    }
 
-    return result;
-}
+    // Mark all originals deleted.
+    tdb_NodeRef_t originalChildRef = tdb_GetFirstChildNode(originalRef);
 
+    while (originalChildRef != NULL)
+    {
+        // Children in the original tree shouldn't currently be marked as deleted.
+        LE_ASSERT(IsDeleted(originalChildRef) == false);
 
+        SetDeletedFlag(originalChildRef);
+        originalChildRef = tdb_GetNextSiblingNode(originalChildRef);
+    }
 
+    // Follow through all of the shadow links and unmark deletions.
+    if (shadowNodeRef->type == LE_CFG_TYPE_STEM)
+    {
+        tdb_NodeRef_t shadowChildRef = tdb_GetFirstChildNode(shadowNodeRef);
 
-// -------------------------------------------------------------------------------------------------
-/**
- *  Read a string from the config tree file.
- *
- *  @return LE_OK if the string is read from the file.
- *          LE_FORMAT_ERROR if the text fails to be read from the file.
- *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
- */
-// -------------------------------------------------------------------------------------------------
-static le_result_t ReadStringToken
-(
-    FILE* filePtr,     ///< [IN]  The file we're reading from.
-    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
-    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
-)
-// -------------------------------------------------------------------------------------------------
-{
-    le_result_t result = ReadTextLiteral(filePtr, stringPtr, stringSize, '"');
+        while (shadowChildRef != NULL)
+        {
+            if (shadowChildRef->shadowRef != NULL)
+            {
+                ClearDeletedFlag(shadowChildRef->shadowRef);
+            }
 
-    // TODO: Validate the literal string.
+            shadowChildRef = tdb_GetNextSiblingNode(shadowChildRef);
+        }
+    }
 
-    return result;
+    // Fire on all original nodes still marked.  But also take care to clear the deleted flags here
+    // in order to leave everything as it was.
+    originalChildRef = tdb_GetFirstChildNode(originalRef);
+
+    while (originalChildRef != NULL)
+    {
+        if (IsDeleted(originalChildRef) == true)
+        {
+            FireAllChildren(pathPtr, originalChildRef);
+            ClearDeletedFlag(originalChildRef);
+        }
+
+        originalChildRef = tdb_GetNextSiblingNode(originalChildRef);
+    }
 }
 
 
@@ -2082,69 +2785,101 @@ static le_result_t ReadStringToken
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Read a token from the input stream.
+ *  Recursive function to merge a collection of shadow nodes with the original tree.
  *
- *  @return LE_OK if a token could be read.  LE_OUT_OF_RANGE if the end of the stream is reached
- *          before a token could be finished.
+ *  @return True if the given node or any if it's children have been modified.  False if not.
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t ReadToken
+static bool InternalMergeTree
 (
-    FILE* filePtr,         ///< [IN]  The file we're reading from.
-    char* stringPtr,       ///< [OUT] String buffer to hold the token we've read.
-    size_t stringSize,     ///< [IN]  How big is the supplied string buffer?
-    TokenType_t* typePtr   ///< [OUT] The type of token read from the file.
+    const char* treeNamePtr,    ///< [IN] The name of the tree we're merging.
+    CallbackPath_t* pathPtr,    ///< [IN] Path to the parent of hte current node.
+    tdb_NodeRef_t nodeRef,      ///< [IN] Node and any children to merge.
+    bool forceFire              ///< [IN] Should update handlers be fired for this node and all it's
+                                ///<      children, regardless of wether or not this node has been
+                                ///<      directly modified?
 )
 // -------------------------------------------------------------------------------------------------
 {
-    *stringPtr = 0;
-
-    if (SkipWhiteSpace(filePtr) != LE_OK)
-    {
-        return LE_OUT_OF_RANGE;
-    }
+    bool isModified = IsModified(nodeRef);
+    bool renamed = WasRenamed(nodeRef);
 
-    int next;
+    // If this node was renamed, then all children also need to be triggered as well.
+    forceFire = renamed || forceFire;
 
-    while ((next = fgetc(filePtr)) != EOF)
+    // If this node has been renamed, marked as deleted or set empty, then all of the children need
+    // notifications fired on the original nodes.
+    if (   (renamed == true)
+        || (IsDeleted(nodeRef) == true)
+        || (OriginalToBeCleared(nodeRef) == true))
     {
-        switch (next)
+        if (nodeRef->shadowRef != NULL)
         {
-            case '~':
-                *typePtr = TT_EMPTY_VALUE;
-                return LE_OK;
+            CallbackPath_t originalPath;
 
-            case '!':
-                *typePtr = TT_BOOL_VALUE;
-                return ReadBoolToken(filePtr, stringPtr, stringSize);
+            InitBasePath(&originalPath, treeNamePtr);
+            GeneratePath(&originalPath, nodeRef->shadowRef->parentRef);
+            FireAllChildren(&originalPath, nodeRef->shadowRef);
+        }
+    }
+    else if (   (isModified == true)
+             && (nodeRef->type == LE_CFG_TYPE_STEM))
+    {
+        CallbackPath_t originalPath;
 
-            case '[':
-                *typePtr = TT_INT_VALUE;
-                return ReadIntToken(filePtr, stringPtr, stringSize);
+        InitBasePath(&originalPath, treeNamePtr);
+        GeneratePath(&originalPath, nodeRef->shadowRef);
+        FireLostChildren(&originalPath, nodeRef);
+    }
 
-            case '(':
-                *typePtr = TT_FLOAT_VALUE;
-                return ReadFloatToken(filePtr, stringPtr, stringSize);
+    size_t parentLength = AppendNodeName(pathPtr, nodeRef);
 
-            case '\"':
-                *typePtr = TT_STRING_VALUE;
-                return ReadStringToken(filePtr, stringPtr, stringSize);
+    // IF this node is modified, mearge it.  If this node is a stem, then merge it's children.  Keep
+    // track of whether any of those children have been modified as well.
+    if (isModified)
+    {
+        MergeNode(nodeRef);
+    }
 
-            case '{':
-                *typePtr = TT_OPEN_GROUP;
-                return LE_OK;
+    if (   (nodeRef->type == LE_CFG_TYPE_STEM)
+        && (IsDeleted(nodeRef) == false))
+    {
+        // Children are only shadowed once the transaction visits them, so if this node's children
+        // were never shadowed then nothing below it has changed.  Unless callbacks have to be fired
+        // for the whole branch, walk only the children that exist in the shadow tree rather than
+        // shadowing the rest of the original branch just to find that out.
+        if (forceFire)
+        {
+            nodeRef = tdb_GetFirstChildNode(nodeRef);
+        }
+        else
+        {
+            le_dls_Link_t* linkPtr = le_dls_Peek(&nodeRef->info.children);
 
-            case '}':
-                *typePtr = TT_CLOSE_GROUP;
-                return LE_OK;
+            nodeRef = (linkPtr == NULL) ? NULL : CONTAINER_OF(linkPtr, Node_t, siblingList);
+        }
 
-            default:
-                LE_ERROR("Unexpected character in input stream.");
-                return LE_FORMAT_ERROR;
+        while (nodeRef != NULL)
+        {
+            tdb_NodeRef_t nextNodeRef = tdb_GetNextSiblingNode(nodeRef);
+
+            isModified = InternalMergeTree(treeNamePtr, pathPtr, nodeRef, forceFire) || isModified;
+            nodeRef = nextNodeRef;
         }
     }
 
-    return LE_OUT_OF_RANGE;
+    // If this node, or any of it's children have been modified.  Try to fire any callbacks that may
+    // be registered.
+    if (isModified || forceFire)
+    {
+        TriggerCallbacks(pathPtr);
+    }
+
+    // Now remove this node from the tracking path and let our caller know if any modifications have
+    // happened at this level or lower.
+    RemoveNodeName(pathPtr, parentLength);
+
+    return isModified;
 }
 
 
@@ -2152,238 +2887,1824 @@ static le_result_t ReadToken
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Write data to the output stream.  This function will record any faults to the system log.
+ *  Create a new tree object and set it to default values.
  *
- *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ *  @return A ref to the newly created tree object.
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t WriteFile
+tdb_TreeRef_t NewTree
 (
-    FILE* filePtr,        ///< [IN] The file being written to.
+    const char* treeNameRef,   ///< [IN] The name of the new tree.
+    tdb_NodeRef_t rootNodeRef  ///< [IN] The root node of this new tree.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_TreeRef_t treeRef = le_mem_ForceAlloc(TreePoolRef);
+
+    LE_ASSERT(le_utf8_Copy(treeRef->name, treeNameRef, MAX_TREE_NAME_BYTES, NULL) == LE_OK);
+
+    treeRef->isDeletePending = false;
+    treeRef->originalTreeRef = NULL;
+    treeRef->snapshotOfRef = NULL;
+    treeRef->snapshotLink = LE_DLS_LINK_INIT;
+    treeRef->snapshotList = LE_DLS_LIST_INIT;
+    treeRef->revisionId = 0;
+    treeRef->rootNodeRef = (rootNodeRef != NULL) ? rootNodeRef : NewNode();
+    treeRef->activeReadCount = 0;
+    treeRef->activeWriteIterRef = NULL;
+    treeRef->requestList = LE_SLS_LIST_INIT;
+#if LE_CONFIG_CFGTREE_JOURNAL
+    treeRef->compactTimerRef = NULL;
+    treeRef->needsFullSave = false;
+#endif
+
+    return treeRef;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Destructor called when a tree object is to be freed from memory.
+ */
+// -------------------------------------------------------------------------------------------------
+static void TreeDestructor
+(
+    void* objectPtr  ///< The memory object to destruct.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_TreeRef_t treeRef = (tdb_TreeRef_t)objectPtr;
+
+    // Kill the root node.
+    le_mem_Release(treeRef->rootNodeRef);
+    treeRef->rootNodeRef = NULL;
+
+#if LE_CONFIG_CFGTREE_JOURNAL
+    if (treeRef->compactTimerRef != NULL)
+    {
+        le_timer_Delete(treeRef->compactTimerRef);
+        treeRef->compactTimerRef = NULL;
+    }
+#endif
+
+    if (treeRef->snapshotOfRef != NULL)
+    {
+        le_dls_Remove(&treeRef->snapshotOfRef->snapshotList, &treeRef->snapshotLink);
+        le_mem_Release(treeRef->snapshotOfRef);
+        treeRef->snapshotOfRef = NULL;
+    }
+
+    // Sanity check, is the tree actually ready to clean up?
+    LE_ASSERT(treeRef->activeReadCount == 0);
+    LE_ASSERT(treeRef->activeWriteIterRef == NULL);
+    LE_ASSERT(le_sls_IsEmpty(&treeRef->requestList) == true);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Create a path to a tree file with the given revision id.
+ *
+ *  @return A stringBuffer backed string containing the full path to the tree file.
+ */
+// -------------------------------------------------------------------------------------------------
+static void GetTreePath
+(
+    const char* treeNameRef,  ///< [IN] The name of the tree we're generating a name for.
+    int revisionId,           ///< [IN] Generate a name based on the tree revision.
+    char* pathBuffer,         ///< [IN] Buffer to hold the new path.
+    size_t pathSize           ///< [IN] Size of the path buffer.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    // paper    --> rock       1 -> 2
+    // rock     --> scissors   2 -> 3
+    // scissors --> paper      3 -> 1
+
+    static const char* revNames[] = { "paper", "rock", "scissors" };
+    int printSize;
+
+    LE_ASSERT((revisionId >= 1) && (revisionId <= 3));
+
+    printSize = snprintf(pathBuffer,
+                         pathSize,
+                         "%s/%s.%s",
+                         CFG_TREE_PATH,
+                         treeNameRef,
+                         revNames[revisionId - 1]);
+
+    if (printSize >= pathSize)
+    {
+       LE_ERROR("Unable to store config tree path in buffer");
+       pathBuffer[0] = '\0';
+    }
+}
+
+
+
+
+#if LE_CONFIG_CFGTREE_JOURNAL
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Create a path to a tree's journal file.
+ */
+// -------------------------------------------------------------------------------------------------
+static void GetJournalPath
+(
+    const char* treeNameRef,  ///< [IN] The name of the tree we're generating a name for.
+    char* pathBuffer,         ///< [IN] Buffer to hold the new path.
+    size_t pathSize           ///< [IN] Size of the path buffer.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    int printSize = snprintf(pathBuffer, pathSize, "%s/%s.journal", CFG_TREE_PATH, treeNameRef);
+
+    if (printSize >= pathSize)
+    {
+       LE_ERROR("Unable to store config tree journal path in buffer");
+       pathBuffer[0] = '\0';
+    }
+}
+#endif
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Check to see if a configTree file at the given revision already exists in the filesystem.
+ *
+ *  @note If the tree file exists, but is empty, then it is invalid and will be deleted.
+ *
+ *  @return True if the named file exists, false otherwise.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool TreeFileExists
+(
+    const char* treeNameRef,  ///< [IN] Name of the tree to check.
+    int revisionId            ///< [IN] The revision of the tree to check against.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    char fullPath[LE_CFG_STR_LEN_BYTES] = "";
+    GetTreePath(treeNameRef, revisionId, fullPath, sizeof(fullPath));
+
+    // Make sure this part was successful.
+    if (fullPath[0] == '\0')
+    {
+        return false;
+    }
+
+    // stat() the file to see if it exists and get its size.
+    struct stat s;
+    if (stat(fullPath, &s) == -1)
+    {
+        LE_DEBUG("Can't stat file '%s' (%m).", fullPath);
+        return false;
+    }
+
+    // Make sure it's a regular file.
+    if (!S_ISREG(s.st_mode))
+    {
+        LE_FATAL("Object at '%s' is not a regular file.", fullPath);
+    }
+
+    // If it's zero size, delete it and report that it doesn't exist.
+    if (s.st_size == 0)
+    {
+        if (unlink(fullPath) == -1)
+        {
+            LE_FATAL("Failed to unlink empty file '%s' (%m).", fullPath);
+        }
+
+        return false;
+    }
+
+    // NOTE: The Config Tree generally runs as root, so permissions should be irrelevant.
+
+    return true;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Check the filesystem and get the current "valid" version of the file and update the tree object
+ * with that version number.
+ *
+ * If there are two files for a given tree, we use the older one.  The idea being, if there are
+ * two versions of the same file in the filesystem then there was a system failure during a save
+ * operation.  So we abandon the newer (probably incomplete) file and go with the older file;
+ * unless the size of the older file is zero, which can happen if deletion of that file is
+ * interrupted.
+ */
+// -------------------------------------------------------------------------------------------------
+static void UpdateRevision
+(
+    tdb_TreeRef_t treeRef  ///< [IN] Update the revision for this tree object.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    int newRevision = 0;
+
+    if (TreeFileExists(treeRef->name, 1))
+    {
+        if (TreeFileExists(treeRef->name, 3))
+        {
+            newRevision = 3;
+        }
+        else
+        {
+            newRevision = 1;
+        }
+    }
+    else if (TreeFileExists(treeRef->name, 3))
+    {
+        if (TreeFileExists(treeRef->name, 2))
+        {
+            newRevision = 2;
+        }
+        else
+        {
+            newRevision = 3;
+        }
+    }
+    else if (TreeFileExists(treeRef->name, 2))
+    {
+        newRevision = 2;
+    }
+
+    treeRef->revisionId = newRevision;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Peek into the input stream one character ahead.
+ */
+// -------------------------------------------------------------------------------------------------
+static signed char PeekChar
+(
+    FILE* filePtr  ///< [IN] The file stream to peek into.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    int next = fgetc(filePtr);
+    ungetc(next, filePtr);
+
+    return next;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Skip any whitespace encountered in the input stream.  Stop skipping once we hit a valid token.
+ *
+ *  @return LE_OK if the whitespace is skiped and there is still more file to read.
+ *          LE_OUT_OF_RANGE if the end of the file is hit.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t SkipWhiteSpace
+(
+    FILE* filePtr  ///< [IN] The file stream to seek through.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    bool done = false;
+    bool isEof = false;
+
+    while (done == false)
+    {
+        switch (PeekChar(filePtr))
+        {
+            case '\n':
+            case '\r':
+            case '\t':
+            case ' ':
+                // Eat the character.
+                fgetc(filePtr);
+                break;
+
+            case EOF:
+                done = true;
+                isEof = true;
+                break;
+
+            default:
+                done = true;
+                break;
+        }
+    }
+
+    return isEof == true ? LE_OUT_OF_RANGE : LE_OK;
+}
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Skip to the next occurence of the given character.
+ *
+ *  @return LE_OK if the character is found.
+ *          LE_OUT_OF_RANGE if the end of the file is hit.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t SkipToNextChar
+(
+    FILE* filePtr,          ///< [IN] The file stream to seek through.
+    signed char nextChar    ///< [IN]  The character we're searching for.
+)
+{
+    int next;
+
+    while ((next = fgetc(filePtr)) != nextChar)
+    {
+        if (next == EOF)
+        {
+            return LE_OUT_OF_RANGE;
+        }
+    }
+
+    return LE_OK;
+}
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a boolean literal from the input file.
+ *
+ *  @return LE_OK if the literal could be read.
+ *          LE_FORMAT_ERROR if the literal could not be read.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool ReadBoolToken
+(
+    FILE* filePtr,     ///< [IN]  The file we're reading from.
+    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
+    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
+)
+// -------------------------------------------------------------------------------------------------
+{
+    int next = fgetc(filePtr);
+
+    if (   (next == 't')
+        || (next == 'f'))
+    {
+        stringPtr[0] = next;
+        stringPtr[1] = 0;
+
+        return LE_OK;
+    }
+
+    return LE_FORMAT_ERROR;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a textual literal from the input file, the read is terminated successfuly if the terminal
+ *  character is found.
+ *
+ *  @return LE_OK if the string is read from the file.
+ *          LE_FORMAT_ERROR if the text fails to be read from the file.
+ *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t ReadTextLiteral
+(
+    FILE* filePtr,        ///< [IN]  The file we're reading from.
+    char* stringPtr,      ///< [OUT] String buffer to hold the token we've read.
+    size_t stringSize,    ///< [IN]  How big is the supplied string buffer?
+    signed char terminal  ///< [IN]  The terminal character we're searching for.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    int next;
+    size_t count = 0;
+
+    char* oldPtr = stringPtr;
+
+    while ((next = fgetc(filePtr)) != terminal)
+    {
+        if (next == EOF)
+        {
+            LE_ERROR("Missing end specifier, ']' in int value.");
+            return LE_FORMAT_ERROR;
+        }
+
+        if (next == '\\')
+        {
+            next = fgetc(filePtr);
+
+            if (next == EOF)
+            {
+                LE_ERROR("Unexpected EOF after finding \\ character.");
+                return LE_FORMAT_ERROR;
+            }
+        }
+
+        if (count >= (stringSize - 1))
+        {
+            // truncate the string to the buffer size
+            *stringPtr = 0;
+
+            LE_ERROR("String literal is too large.  (%" PRIdS "/%" PRIdS ")",
+                     strlen(oldPtr),
+                     stringSize);
+            // move the file pointer to the terminal character (e.g. closing quote)
+            if (LE_OK == SkipToNextChar(filePtr, terminal))
+            {
+                return LE_OVERFLOW;
+            }
+            else
+            {
+                return LE_FORMAT_ERROR;
+            }
+        }
+
+        *stringPtr = next;
+
+        ++stringPtr;
+        ++count;
+    }
+
+    *stringPtr = 0;
+
+    return LE_OK;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read an integer token string from the file.
+ *
+ *  @return LE_OK if the string is read from the file.
+ *          LE_FORMAT_ERROR if the text fails to be read from the file.
+ *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t ReadIntToken
+(
+    FILE* filePtr,     ///< [IN]  The file we're reading from.
+    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
+    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_result_t result = ReadTextLiteral(filePtr, stringPtr, stringSize, ']');
+
+    // TODO: Validate the int string.
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a floating point token string from the file.
+ *
+ *  @return LE_OK if the string is read from the file.
+ *          LE_FORMAT_ERROR if the text fails to be read from the file.
+ *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t ReadFloatToken
+(
+    FILE* filePtr,     ///< [IN]  The file we're reading from.
+    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
+    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_result_t result = ReadTextLiteral(filePtr, stringPtr, stringSize, ')');
+
+    // TODO: Validate the float string.
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a string from the config tree file.
+ *
+ *  @return LE_OK if the string is read from the file.
+ *          LE_FORMAT_ERROR if the text fails to be read from the file.
+ *          LE_OVERFLOW if the text doesn't fit in provided buffer (truncated).
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t ReadStringToken
+(
+    FILE* filePtr,     ///< [IN]  The file we're reading from.
+    char* stringPtr,   ///< [OUT] String buffer to hold the token we've read.
+    size_t stringSize  ///< [IN]  How big is the supplied string buffer?
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_result_t result = ReadTextLiteral(filePtr, stringPtr, stringSize, '"');
+
+    // TODO: Validate the literal string.
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a token from the input stream.
+ *
+ *  @return LE_OK if a token could be read.  LE_OUT_OF_RANGE if the end of the stream is reached
+ *          before a token could be finished.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t ReadToken
+(
+    FILE* filePtr,         ///< [IN]  The file we're reading from.
+    char* stringPtr,       ///< [OUT] String buffer to hold the token we've read.
+    size_t stringSize,     ///< [IN]  How big is the supplied string buffer?
+    TokenType_t* typePtr   ///< [OUT] The type of token read from the file.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    *stringPtr = 0;
+
+    if (SkipWhiteSpace(filePtr) != LE_OK)
+    {
+        return LE_OUT_OF_RANGE;
+    }
+
+    int next;
+
+    while ((next = fgetc(filePtr)) != EOF)
+    {
+        switch (next)
+        {
+            case '~':
+                *typePtr = TT_EMPTY_VALUE;
+                return LE_OK;
+
+            case '!':
+                *typePtr = TT_BOOL_VALUE;
+                return ReadBoolToken(filePtr, stringPtr, stringSize);
+
+            case '[':
+                *typePtr = TT_INT_VALUE;
+                return ReadIntToken(filePtr, stringPtr, stringSize);
+
+            case '(':
+                *typePtr = TT_FLOAT_VALUE;
+                return ReadFloatToken(filePtr, stringPtr, stringSize);
+
+            case '\"':
+                *typePtr = TT_STRING_VALUE;
+                return ReadStringToken(filePtr, stringPtr, stringSize);
+
+            case '{':
+                *typePtr = TT_OPEN_GROUP;
+                return LE_OK;
+
+            case '}':
+                *typePtr = TT_CLOSE_GROUP;
+                return LE_OK;
+
+            default:
+                LE_ERROR("Unexpected character in input stream.");
+                return LE_FORMAT_ERROR;
+        }
+    }
+
+    return LE_OUT_OF_RANGE;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write data to the output stream.  This function will record any faults to the system log.
+ *
+ *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t WriteFile
+(
+    FILE* filePtr,        ///< [IN] The file being written to.
     const void* dataPtr,  ///< [IN] The data being written to the file.
     size_t dataSize       ///< [IN] The amount of data being written.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    ssize_t written = fwrite(dataPtr, 1, dataSize, filePtr);
+    ssize_t written = fwrite(dataPtr, 1, dataSize, filePtr);
+
+    if (ferror(filePtr) != 0)
+    {
+        LE_EMERG("Failed to write to config tree file.");
+        return LE_IO_ERROR;
+    }
+
+    if (written < dataSize)
+    {
+        LE_EMERG("Data truncated while writing to configuration file.");
+        return LE_IO_ERROR;
+    }
+
+    return LE_OK;
+}
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write a string token to the output stream.  This function will write the string and escape all
+ *  control characters as it does so.
+ *
+ *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t WriteStringValue
+(
+    FILE* filePtr,         ///< [IN] The file to write to.
+    char startChar,        ///< [IN] The delimiter to use.
+    char endChar,          ///< [IN] The closing delimiter to use.
+    const char* stringPtr  ///< [IN] The actual string to write.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_result_t result = LE_OK;
+
+    result = WriteFile(filePtr, &startChar, 1);
+
+    while (   (*stringPtr != 0)
+           && (result == LE_OK))
+    {
+        if (   (*stringPtr == '\"')
+            || (*stringPtr == '\\'))
+        {
+            result = WriteFile(filePtr, "\\", 1);
+        }
+
+        if (result == LE_OK)
+        {
+            result = WriteFile(filePtr, stringPtr, 1);
+        }
+
+        stringPtr++;
+    }
+
+    if (result == LE_OK)
+    {
+        char strBuffer[2] = { endChar, ' ' };
+        result = WriteFile(filePtr, strBuffer, sizeof(strBuffer));
+    }
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a node value from the given file.  If the value is a collection, then read in those nodes
+ *  too.
+ *
+ *  @return LE_OK if the read is successful.
+ *          LE_FORMAT_ERROR if parse errors are encountered.
+ *          LE_NOT_FOUND if the end of file is reached.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t InternalReadNode
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] The node we're reading a value for.
+    FILE* filePtr,          ///< [IN] The file we're reading the value from.
+    size_t pathLen          ///< [IN] The length of the path including nodeRef.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    char* stringBuffer = le_mem_ForceAlloc(EncodedStringPool);
+    size_t stringBufferSize = TDB_MAX_ENCODED_SIZE;
+    le_result_t result = LE_OK;
+
+    TokenType_t tokenType;
+
+    // Try to read this node's value.
+    result = ReadToken(filePtr, stringBuffer, stringBufferSize, &tokenType);
+    if ((result != LE_OK) && (result != LE_OVERFLOW))
+    {
+        LE_ERROR("Unexpected EOF or bad token in file.");
+        result = LE_FORMAT_ERROR;
+        goto cleanup;
+    }
+    // if result is OVERFLOW (i.e. string is truncated), we still should be able
+    // to proceed with parsing the rest of the file.
+    result = LE_OK;
+
+    tdb_SetEmpty(nodeRef);
+
+    switch (tokenType)
+    {
+        case TT_BOOL_VALUE:
+            tdb_SetValueAsString(nodeRef, stringBuffer);
+            nodeRef->type = LE_CFG_TYPE_BOOL;
+            break;
+
+        case TT_INT_VALUE:
+            tdb_SetValueAsString(nodeRef, stringBuffer);
+            nodeRef->type = LE_CFG_TYPE_INT;
+            break;
+
+        case TT_FLOAT_VALUE:
+            tdb_SetValueAsString(nodeRef, stringBuffer);
+            nodeRef->type = LE_CFG_TYPE_FLOAT;
+            break;
+
+        case TT_STRING_VALUE:
+            tdb_SetValueAsString(nodeRef, stringBuffer);
+            break;
+
+        case TT_EMPTY_VALUE:
+            // The node has already been cleared, so there's nothing left to do but make sure that
+            // the node exists.
+            ClearDeletedFlag(nodeRef);
+            break;
+
+        case TT_OPEN_GROUP:
+            while (tokenType != TT_CLOSE_GROUP)
+            {
+                if (ReadToken(filePtr, stringBuffer, stringBufferSize, &tokenType) != LE_OK)
+                {
+                    LE_ERROR("Unexpected EOF or bad token in file while looking for '}'.");
+                    result = LE_FORMAT_ERROR;
+                    goto cleanup;
+                }
+
+                if (tokenType == TT_STRING_VALUE)
+                {
+                    size_t strLen = le_utf8_NumBytes(stringBuffer);
+                    size_t newPathLen = pathLen + 1 + strLen;
+
+                    if (newPathLen > LE_CFG_STR_LEN)
+                    {
+                        LE_ERROR("New path length for node '%s' is too long.  %" PRIuS
+                                 " of %" PRIuS " bytes.",
+                                 stringBuffer,
+                                 strLen,
+                                 (size_t)LE_CFG_STR_LEN);
+
+                        result = LE_FORMAT_ERROR;
+                        goto cleanup;
+                    }
+
+                    tdb_NodeRef_t childRef = GetNamedChild(nodeRef, stringBuffer);
+
+                    if (childRef == NULL)
+                    {
+                        childRef = NewChildNode(nodeRef);
+                        if (tdb_SetNodeName(childRef, stringBuffer) != LE_OK)
+                        {
+                            LE_ERROR("Bad node name, '%s'.", stringBuffer);
+                            result = LE_FORMAT_ERROR;
+                            goto cleanup;
+                        }
+
+                        LE_DEBUG("New node, %s", stringBuffer);
+                    }
+
+                    tdb_EnsureExists(childRef);
+
+                    result = InternalReadNode(childRef, filePtr, newPathLen);
+
+                    if (result != LE_OK)
+                    {
+                        goto cleanup;
+                    }
+                }
+                else if (tokenType == TT_CLOSE_GROUP)
+                {
+                    break;
+                }
+                else
+                {
+                    LE_ERROR("Unexpected token in found while looking for '}'.");
+                    result = LE_FORMAT_ERROR;
+                    goto cleanup;
+                }
+            }
+            break;
+
+        case TT_CLOSE_GROUP:
+        default:
+            LE_ERROR("Unexpected token found.");
+            result = LE_FORMAT_ERROR;
+            goto cleanup;
+    }
+
+    if (IsShadow(nodeRef) == false)
+    {
+        ClearModifiedFlag(nodeRef);
+    }
+    else
+    {
+        SetModifiedFlag(nodeRef);
+    }
+
+    tdb_EnsureExists(nodeRef);
+
+cleanup:
+    le_mem_Release(stringBuffer);
+    return result;
+}
+
+
+
+
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Copy a node record from a tree image into a node, along with all of the record's children.
+ *  Unlike the nodes of a tree that was loaded from an image, the copied nodes are all created
+ *  up-front, so the node can safely be a shadow node.
+ *
+ *  @return LE_OK if the record was copied.
+ *          LE_FORMAT_ERROR if the image is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t InternalReadImageNode
+(
+    tdb_NodeRef_t nodeRef,      ///< [IN] The node we're reading a value for.
+    timg_ImageRef_t imageRef,   ///< [IN] The image we're reading from.
+    uint32_t record,            ///< [IN] The node's record in the image.
+    size_t pathLen              ///< [IN] The length of the path including nodeRef.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_cfg_nodeType_t type = timg_GetType(imageRef, record);
+
+    tdb_SetEmpty(nodeRef);
+
+    switch (type)
+    {
+        case LE_CFG_TYPE_STRING:
+        case LE_CFG_TYPE_BOOL:
+        case LE_CFG_TYPE_INT:
+        case LE_CFG_TYPE_FLOAT:
+        {
+            const char* valuePtr = timg_GetValue(imageRef, record);
+
+            if (valuePtr == NULL)
+            {
+                return LE_FORMAT_ERROR;
+            }
+
+            tdb_SetValueAsString(nodeRef, valuePtr);
+            nodeRef->type = type;
+            break;
+        }
+
+        case LE_CFG_TYPE_EMPTY:
+            ClearDeletedFlag(nodeRef);
+            break;
+
+        case LE_CFG_TYPE_STEM:
+        {
+            uint32_t firstChild;
+            uint32_t count;
+            uint32_t child;
+
+            if (timg_GetChildren(imageRef, record, &firstChild, &count) != LE_OK)
+            {
+                return LE_FORMAT_ERROR;
+            }
+
+            for (child = firstChild; child < (firstChild + count); child++)
+            {
+                const char* namePtr = timg_GetName(imageRef, child);
+
+                if (namePtr == NULL)
+                {
+                    return LE_FORMAT_ERROR;
+                }
+
+                size_t newPathLen = pathLen + 1 + strlen(namePtr);
+
+                if (newPathLen > LE_CFG_STR_LEN)
+                {
+                    LE_ERROR("New path length for node '%s' is too long.", namePtr);
+                    return LE_FORMAT_ERROR;
+                }
+
+                tdb_NodeRef_t childRef = NewChildNode(nodeRef);
+
+                if (tdb_SetNodeName(childRef, namePtr) != LE_OK)
+                {
+                    LE_ERROR("Bad node name, '%s'.", namePtr);
+                    return LE_FORMAT_ERROR;
+                }
+
+                tdb_EnsureExists(childRef);
+
+                le_result_t result = InternalReadImageNode(childRef, imageRef, child, newPathLen);
+
+                if (result != LE_OK)
+                {
+                    return result;
+                }
+            }
+            break;
+        }
+
+        default:
+            return LE_FORMAT_ERROR;
+    }
+
+    if (IsShadow(nodeRef) == false)
+    {
+        ClearModifiedFlag(nodeRef);
+    }
+    else
+    {
+        SetModifiedFlag(nodeRef);
+    }
+
+    tdb_EnsureExists(nodeRef);
+
+    return LE_OK;
+}
+#endif
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write a node's value to a file.  Stems only have their opening brace written, their children and
+ *  closing brace are written by WriteNodes().
+ *
+ *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t WriteNodeValue
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] The node being written.
+    FILE* filePtr,          ///< [IN] The file being written to.
+    char* stringBuffer      ///< [IN] Scratch buffer of TDB_MAX_ENCODED_SIZE bytes.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    // If there is no node to write, or if the node is marked as having been deleted...  Then write
+    // a blank node.
+    if (   (nodeRef == NULL)
+        || (IsDeleted(nodeRef) == true))
+    {
+        return WriteFile(filePtr, "~ ", 2);
+    }
+
+    // Get the node's value as a string.
+    le_result_t result = LE_OK;
+
+    tdb_GetValueAsString(nodeRef, stringBuffer, TDB_MAX_ENCODED_SIZE, "");
+
+    // Now, depending on the type of node, write out any required format information.
+    switch (nodeRef->type)
+    {
+        case LE_CFG_TYPE_EMPTY:
+        case LE_CFG_TYPE_DOESNT_EXIST:
+            result = WriteFile(filePtr, "~ ", 2);
+            break;
+
+        case LE_CFG_TYPE_BOOL:
+            {
+                const char boolBuffer[3] = { '!', stringBuffer[0], ' ' };
+                result = WriteFile(filePtr, boolBuffer, sizeof(boolBuffer));
+            }
+            break;
+
+        case LE_CFG_TYPE_STRING:
+            result = WriteStringValue(filePtr, '\"', '\"', stringBuffer);
+            break;
+
+        case LE_CFG_TYPE_INT:
+            result = WriteStringValue(filePtr, '[', ']', stringBuffer);
+            break;
+
+        case LE_CFG_TYPE_FLOAT:
+            result = WriteStringValue(filePtr, '(', ')', stringBuffer);
+            break;
+
+        // Looks like this node is a collection, its child nodes follow.
+        case LE_CFG_TYPE_STEM:
+            result = WriteFile(filePtr, "{ ", 2);
+            break;
+    }
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Serialize nodes of a tree to a file, carrying on from where the cursor was left.  The nodes are
+ *  walked through their parent and sibling links rather than by recursion, so that a write can be
+ *  split up and resumed later.
+ *
+ *  @return LE_OK if the whole node has been written, LE_IN_PROGRESS if there is more to write, or
+ *          LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t WriteNodes
+(
+    WriteCursor_t* cursorPtr,  ///< [IN] Where the write is up to.  Updated as nodes are written.
+    size_t maxNodes            ///< [IN] The most nodes to write before returning.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    char* stringBuffer = le_mem_ForceAlloc(EncodedStringPool);
+    le_result_t result = LE_OK;
+
+    while (   (cursorPtr->isDone == false)
+           && (maxNodes > 0)
+           && (result == LE_OK))
+    {
+        tdb_NodeRef_t nodeRef = cursorPtr->nextRef;
+
+        maxNodes--;
+
+        // Everything but the node being written is preceded by its name.
+        if (nodeRef != cursorPtr->rootRef)
+        {
+            tdb_GetNodeName(nodeRef, stringBuffer, TDB_MAX_ENCODED_SIZE);
+            result = WriteStringValue(cursorPtr->filePtr, '\"', '\"', stringBuffer);
+        }
+
+        if (result == LE_OK)
+        {
+            result = WriteNodeValue(nodeRef, cursorPtr->filePtr, stringBuffer);
+        }
+
+        // If this is a stem with children, the first child is next.
+        if (   (result == LE_OK)
+            && (nodeRef != NULL)
+            && (IsDeleted(nodeRef) == false)
+            && (nodeRef->type == LE_CFG_TYPE_STEM))
+        {
+            tdb_NodeRef_t childRef = tdb_GetFirstActiveChildNode(nodeRef);
+
+            if (childRef != NULL)
+            {
+                cursorPtr->nextRef = childRef;
+                continue;
+            }
+
+            result = WriteFile(cursorPtr->filePtr, "} ", 2);
+        }
+
+        // Otherwise move on to the node's next sibling, closing off any stems that have been
+        // finished on the way.
+        while (result == LE_OK)
+        {
+            if (nodeRef == cursorPtr->rootRef)
+            {
+                cursorPtr->isDone = true;
+                break;
+            }
+
+            tdb_NodeRef_t siblingRef = tdb_GetNextActiveSiblingNode(nodeRef);
+
+            if (siblingRef != NULL)
+            {
+                cursorPtr->nextRef = siblingRef;
+                break;
+            }
+
+            nodeRef = nodeRef->parentRef;
+            result = WriteFile(cursorPtr->filePtr, "} ", 2);
+        }
+    }
+
+    le_mem_Release(stringBuffer);
+
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
+    return cursorPtr->isDone ? LE_OK : LE_IN_PROGRESS;
+}
+
+
+
+
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Copy a node record and all of its descendants from one tree image into an image being written.
+ */
+// -------------------------------------------------------------------------------------------------
+static void CopyImageRecord
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The image being written.
+    uint32_t destRecord,         ///< [IN] The record to fill in.
+    const char* namePtr,         ///< [IN] The node's name.
+    timg_ImageRef_t imageRef,    ///< [IN] The image to copy from.
+    uint32_t srcRecord           ///< [IN] The record to copy.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_cfg_nodeType_t type = timg_GetType(imageRef, srcRecord);
+    uint32_t srcFirstChild;
+    uint32_t count;
+
+    if (   (type == LE_CFG_TYPE_STEM)
+        && (timg_GetChildren(imageRef, srcRecord, &srcFirstChild, &count) == LE_OK))
+    {
+        uint32_t destFirstChild = timg_AddRecords(writerRef, count);
+        uint32_t i;
+
+        timg_SetStem(writerRef, destRecord, namePtr, destFirstChild, count);
+
+        for (i = 0; i < count; i++)
+        {
+            const char* childNamePtr = timg_GetName(imageRef, srcFirstChild + i);
+
+            // A damaged name is written as an empty one, which will be skipped on the next load.
+            CopyImageRecord(writerRef,
+                            destFirstChild + i,
+                            (childNamePtr != NULL) ? childNamePtr : "",
+                            imageRef,
+                            srcFirstChild + i);
+        }
+    }
+    else
+    {
+        timg_SetLeaf(writerRef, destRecord, namePtr, type, timg_GetValue(imageRef, srcRecord));
+    }
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Add a tree node and its active children to an image being written.  Parts of the tree that are
+ *  still in the tree image it was loaded from are copied straight from that image.
+ */
+// -------------------------------------------------------------------------------------------------
+static void InternalWriteImageNode
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The image being written.
+    uint32_t record,             ///< [IN] The record to fill in.
+    const char* namePtr,         ///< [IN] The node's name.
+    tdb_NodeRef_t nodeRef        ///< [IN] The node being written.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (nodeRef->imageRef != NULL)
+    {
+        CopyImageRecord(writerRef, record, namePtr, nodeRef->imageRef, nodeRef->imageRecord);
+        return;
+    }
+
+    le_cfg_nodeType_t type = tdb_GetNodeType(nodeRef);
+
+    if (type == LE_CFG_TYPE_STEM)
+    {
+        uint32_t count = 0;
+        tdb_NodeRef_t childRef = tdb_GetFirstActiveChildNode(nodeRef);
+
+        while (childRef != NULL)
+        {
+            count++;
+            childRef = tdb_GetNextActiveSiblingNode(childRef);
+        }
+
+        uint32_t firstChild = timg_AddRecords(writerRef, count);
+        char childName[LE_CFG_NAME_LEN_BYTES] = "";
+
+        timg_SetStem(writerRef, record, namePtr, firstChild, count);
+
+        childRef = tdb_GetFirstActiveChildNode(nodeRef);
+
+        while (childRef != NULL)
+        {
+            tdb_GetNodeName(childRef, childName, sizeof(childName));
+            InternalWriteImageNode(writerRef, firstChild++, childName, childRef);
+
+            childRef = tdb_GetNextActiveSiblingNode(childRef);
+        }
+    }
+    else if (   (type == LE_CFG_TYPE_EMPTY)
+             || (type == LE_CFG_TYPE_DOESNT_EXIST))
+    {
+        timg_SetLeaf(writerRef, record, namePtr, LE_CFG_TYPE_EMPTY, NULL);
+    }
+    else
+    {
+        char* stringBuffer = le_mem_ForceAlloc(EncodedStringPool);
+
+        tdb_GetValueAsString(nodeRef, stringBuffer, TDB_MAX_ENCODED_SIZE, "");
+        timg_SetLeaf(writerRef, record, namePtr, type, stringBuffer);
+
+        le_mem_Release(stringBuffer);
+    }
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Serialize a tree to a file in the filesystem, as a tree image.
+ *
+ *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t WriteTreeImage
+(
+    tdb_NodeRef_t rootRef,  ///< [IN] The root node of the tree being written.
+    FILE* filePtr           ///< [IN] The file being written to.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    timg_WriterRef_t writerRef = timg_CreateWriter();
+
+    InternalWriteImageNode(writerRef, 0, "", rootRef);
+
+    le_result_t result = timg_Write(writerRef, filePtr);
+
+    timg_DeleteWriter(writerRef);
+    return result;
+}
+#endif
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Calculate the number of bytes required to store a node path, including seperators and a trailing
+ *  NULL.
+ *
+ *  @return The amount of bytes required to store the whole path string.
+ */
+// -------------------------------------------------------------------------------------------------
+static size_t ComputePathLength
+(
+    tdb_NodeRef_t nodeRef  ///< [IN] Compute a path for this node.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    size_t pathLen = 0;
+    char nodeName[LE_CFG_NAME_LEN_BYTES] = "";
 
-    if (ferror(filePtr) != 0)
+    while (nodeRef != NULL)
     {
-        LE_EMERG("Failed to write to config tree file.");
-        return LE_IO_ERROR;
+        LE_ASSERT(tdb_GetNodeName(nodeRef, nodeName, sizeof(nodeName)) == LE_OK);
+
+        // Add this path segment's length to our running total, along with the required path
+        // seperator.
+        pathLen += 1 + le_utf8_NumBytes(nodeName);
+        nodeRef = tdb_GetNodeParent(nodeRef);
     }
 
-    if (written < dataSize)
+    // Don't forget to include a spot for the trailing NULL.
+    return pathLen + 1;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Bump up the version id of this tree.
+ */
+// -------------------------------------------------------------------------------------------------
+static void IncrementRevision
+(
+    tdb_TreeRef_t treeRef  ///< [IN] Increment the revision of this tree.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    treeRef->revisionId++;
+
+    if (treeRef->revisionId > 3)
     {
-        LE_EMERG("Data truncated while writing to configuration file.");
-        return LE_IO_ERROR;
+        treeRef->revisionId = 1;
     }
+}
 
-    return LE_OK;
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Call this function to delete a tree file from the filesystem.
+ */
+// -------------------------------------------------------------------------------------------------
+static void DeleteTreeFile
+(
+    const char* filePathPtr  ///< Path to the tree file in question.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_DEBUG("** Deleting tree file, '%s'.", filePathPtr);
+
+    if (unlink(filePathPtr) != 0)
+    {
+        LE_ERROR("File delete failure, '%s', reason '%m'.", filePathPtr);
+    }
 }
 
 
 
+
 // -------------------------------------------------------------------------------------------------
 /**
- *  Write a string token to the output stream.  This function will write the string and escape all
- *  control characters as it does so.
+ *  Write a tree to the next revision of its tree file, then delete the old revision.  If the tree
+ *  can't be written, the tree keeps its old revision.
  *
- *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ *  @return LE_OK if the tree was written, or an error code if not.
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t WriteStringValue
+static le_result_t SaveTree
 (
-    FILE* filePtr,         ///< [IN] The file to write to.
-    char startChar,        ///< [IN] The delimiter to use.
-    char endChar,          ///< [IN] The closing delimiter to use.
-    const char* stringPtr  ///< [IN] The actual string to write.
+    tdb_TreeRef_t treeRef  ///< [IN] The tree to write.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    le_result_t result = LE_OK;
+    // Increment revision of the tree and open a tree file for writing.
+    int oldId = treeRef->revisionId;
 
-    result = WriteFile(filePtr, &startChar, 1);
+    IncrementRevision(treeRef);
 
-    while (   (*stringPtr != 0)
-           && (result == LE_OK))
+    char filePath[LE_CFG_STR_LEN_BYTES] = "";
+    GetTreePath(treeRef->name, treeRef->revisionId, filePath, sizeof(filePath));
+
+    LE_DEBUG("Attempting to serialize the tree to '%s'.", filePath);
+
+    FILE* filePtr = NULL;
+
+    filePtr = fopen(filePath, "w+");
+
+    if (!filePtr && (EROFS == errno))
     {
-        if (   (*stringPtr == '\"')
-            || (*stringPtr == '\\'))
+        // In case we are R/O for the config tree, we discard the update to flash
+        treeRef->revisionId = oldId;
+        return LE_NOT_PERMITTED;
+    }
+
+    if (!filePtr)
+    {
+        LE_EMERG("Failed to open config file '%s' (%m).", filePath);
+        LE_EMERG("Changes have been merged in memory, however they could not be committed to the "
+                 "filesystem!!");
+        treeRef->revisionId = oldId;
+        return LE_IO_ERROR;
+    }
+
+    // We have a tree file to write to, so stream the new tree to it then close the output file.
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    le_result_t writeResult = WriteTreeImage(treeRef->rootNodeRef, filePtr);
+#else
+    le_result_t writeResult = tdb_WriteTreeNode(treeRef->rootNodeRef, filePtr);
+#endif
+
+    int retVal = fclose(filePtr);
+    LE_EMERG_IF(retVal == EOF,
+                "An error occurred while closing the tree file: %s", LE_ERRNO_TXT(errno));
+
+    // Finally remove the old version of the tree file, if there is one.
+    if (writeResult == LE_OK)
+    {
+        if (   (oldId != 0)
+            && (TreeFileExists(treeRef->name, oldId)))
         {
-            result = WriteFile(filePtr, "\\", 1);
+            GetTreePath(treeRef->name, oldId, filePath, sizeof(filePath));
+            DeleteTreeFile(filePath);
         }
 
-        if (result == LE_OK)
+#if LE_CONFIG_CFGTREE_JOURNAL
+        // The new tree file includes everything that was in the journal.
+        GetJournalPath(treeRef->name, filePath, sizeof(filePath));
+        tjnl_Delete(filePath);
+
+        if (treeRef->compactTimerRef != NULL)
         {
-            result = WriteFile(filePtr, stringPtr, 1);
+            le_timer_Stop(treeRef->compactTimerRef);
         }
 
-        stringPtr++;
+        treeRef->needsFullSave = false;
+#endif
+    }
+    else
+    {
+        // The write failed, delete the new file we attempted to create.
+        LE_EMERG("The attempt to write to the config tree file, '%s,' failed.", filePath);
+        DeleteTreeFile(filePath);
+        treeRef->revisionId = oldId;
     }
 
-    if (result == LE_OK)
+    return writeResult;
+}
+
+
+
+
+#if LE_CONFIG_CFGTREE_JOURNAL
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Called when commits to a tree have stopped for a while, to fold its journal into a new tree
+ *  file.
+ */
+// -------------------------------------------------------------------------------------------------
+static void OnCompactTimerExpired
+(
+    le_timer_Ref_t timerRef  ///< [IN] The tree's compaction timer.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_TreeRef_t treeRef = le_timer_GetContextPtr(timerRef);
+
+    LE_DEBUG("Compacting the journal of configuration tree '%s'.", treeRef->name);
+    SaveTree(treeRef);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append the changes recorded during a merge to the tree's journal, instead of rewriting the whole
+ *  tree file.  The journal is compacted once commits stop for LE_CONFIG_CFGTREE_JOURNAL_COMPACT_DELAY
+ *  seconds.
+ *
+ *  @return True if the changes have been dealt with, false if the tree file needs to be rewritten.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool AppendToJournal
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree that was merged into.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    // Nothing changed, so there's nothing to write.
+    if (tjnl_IsEntryEmpty())
     {
-        char strBuffer[2] = { endChar, ' ' };
-        result = WriteFile(filePtr, strBuffer, sizeof(strBuffer));
+        return true;
     }
 
-    return result;
+    // There needs to be a tree file for the journal to apply to.
+    if (   (treeRef->revisionId == 0)
+        || (treeRef->needsFullSave))
+    {
+        tjnl_DiscardEntry();
+        return false;
+    }
+
+    char basePath[LE_CFG_STR_LEN_BYTES] = "";
+    char journalPath[LE_CFG_STR_LEN_BYTES] = "";
+
+    GetTreePath(treeRef->name, treeRef->revisionId, basePath, sizeof(basePath));
+    GetJournalPath(treeRef->name, journalPath, sizeof(journalPath));
+
+    le_result_t result = tjnl_AppendEntry(journalPath, basePath);
+
+    if (result == LE_OVERFLOW)
+    {
+        LE_DEBUG("Journal of configuration tree '%s' is full, compacting it.", treeRef->name);
+        return false;
+    }
+
+    if (result != LE_OK)
+    {
+        // Fall back to rewriting the tree file, which will report any problems.
+        return false;
+    }
+
+    if (treeRef->compactTimerRef == NULL)
+    {
+        treeRef->compactTimerRef = le_timer_Create("Journal Compaction");
+
+        LE_ASSERT(le_timer_SetMsInterval(treeRef->compactTimerRef,
+                                         LE_CONFIG_CFGTREE_JOURNAL_COMPACT_DELAY * 1000) == LE_OK);
+        LE_ASSERT(le_timer_SetHandler(treeRef->compactTimerRef, OnCompactTimerExpired) == LE_OK);
+        LE_ASSERT(le_timer_SetContextPtr(treeRef->compactTimerRef, treeRef) == LE_OK);
+
+        // There's no hurry, compaction can wait until the system is awake anyway.
+        LE_ASSERT(le_timer_SetWakeup(treeRef->compactTimerRef, false) == LE_OK);
+    }
+
+    le_timer_Restart(treeRef->compactTimerRef);
+
+    return true;
 }
+#endif
 
 
 
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Read a node value from the given file.  If the value is a collection, then read in those nodes
- *  too.
+ *  Read a tree file into a tree.  If the file can't be read, the tree is left empty.
  *
- *  @return LE_OK if the read is successful.
- *          LE_FORMAT_ERROR if parse errors are encountered.
- *          LE_NOT_FOUND if the end of file is reached.
+ *  @return LE_OK if the tree was read.
+ *          LE_UNSUPPORTED if the tree was read, but the file is in an older format and should be
+ *              rewritten.
+ *          LE_FAULT if the file couldn't be read.
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t InternalReadNode
+static le_result_t ReadTreeFile
 (
-    tdb_NodeRef_t nodeRef,  ///< [IN] The node we're reading a value for.
-    FILE* filePtr,          ///< [IN] The file we're reading the value from.
-    size_t pathLen          ///< [IN] The length of the path including nodeRef.
+    tdb_TreeRef_t treeRef,  ///< [IN] The tree to read into.
+    const char* pathPtr     ///< [IN] Path to the tree file.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    char* stringBuffer = le_mem_ForceAlloc(EncodedStringPool);
-    size_t stringBufferSize = TDB_MAX_ENCODED_SIZE;
+    tdb_EnsureExists(treeRef->rootNodeRef);
+
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    timg_ImageRef_t imageRef = NULL;
+
+    switch (timg_Open(pathPtr, &imageRef))
+    {
+        case LE_OK:
+            // Only the root is created now, the rest of the tree is created from the image as it
+            // is visited.
+            if (timg_GetType(imageRef, 0) == LE_CFG_TYPE_STEM)
+            {
+                treeRef->rootNodeRef->type = LE_CFG_TYPE_STEM;
+                treeRef->rootNodeRef->info.children = LE_DLS_LIST_INIT;
+                treeRef->rootNodeRef->imageRef = imageRef;
+                treeRef->rootNodeRef->imageRecord = 0;
+            }
+            else
+            {
+                le_mem_Release(imageRef);
+            }
+            return LE_OK;
+
+        case LE_NOT_FOUND:
+            // This is a tree in the text format, read it below.
+            break;
+
+        case LE_FORMAT_ERROR:
+            LE_ERROR("Could not parse configuration tree file: %s.", pathPtr);
+            return LE_FAULT;
+
+        default:
+            return LE_FAULT;
+    }
+#endif
+
+    FILE* fileRef;
+
+    fileRef = fopen(pathPtr, "r");
+
+    if (!fileRef)
+    {
+        LE_ERROR("Could not open configuration tree file: %s, reason: %s",
+                 pathPtr,
+                 LE_ERRNO_TXT(errno));
+        return LE_FAULT;
+    }
+
     le_result_t result = LE_OK;
 
-    TokenType_t tokenType;
+    if (tdb_ReadTreeNode(treeRef->rootNodeRef, fileRef) == false)
+    {
+        LE_ERROR("Could not parse configuration tree file: %s.", pathPtr);
+        le_mem_Release(treeRef->rootNodeRef);
+        treeRef->rootNodeRef = NewNode();
+        result = LE_FAULT;
+    }
 
-    // Try to read this node's value.
-    result = ReadToken(filePtr, stringBuffer, stringBufferSize, &tokenType);
-    if ((result != LE_OK) && (result != LE_OVERFLOW))
+    fclose(fileRef);
+
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    // Migrate the tree to the binary format, so that it is mapped on the next load.
+    if (result == LE_OK)
     {
-        LE_ERROR("Unexpected EOF or bad token in file.");
-        result = LE_FORMAT_ERROR;
-        goto cleanup;
+        LE_INFO("Converting configuration tree '%s' to the binary format.", treeRef->name);
+        result = LE_UNSUPPORTED;
     }
-    // if result is OVERFLOW (i.e. string is truncated), we still should be able
-    // to proceed with parsing the rest of the file.
-    result = LE_OK;
+#endif
 
-    tdb_SetEmpty(nodeRef);
+    return result;
+}
 
-    switch (tokenType)
+
+
+
+#if LE_CONFIG_CFGTREE_JOURNAL
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a path from a journal entry and find the node of the original tree that it leads to.
+ *
+ *  @return True if the path was read, false if the entry is damaged.  (*nodeRefPtr is NULL if the
+ *          node doesn't exist.)
+ */
+// -------------------------------------------------------------------------------------------------
+static bool JournalGetNode
+(
+    tjnl_Entry_t* entryPtr,     ///< [IN]  The journal entry.
+    tdb_NodeRef_t rootRef,      ///< [IN]  The root node of the tree.
+    bool create,                ///< [IN]  Create the node, and its parents, if they don't exist?
+    tdb_NodeRef_t* nodeRefPtr   ///< [OUT] The node.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_NodeRef_t nodeRef = rootRef;
+    uint32_t count;
+    uint32_t i;
+
+    if (tjnl_GetUint32(entryPtr, &count) == false)
     {
-        case TT_BOOL_VALUE:
-            tdb_SetValueAsString(nodeRef, stringBuffer);
-            nodeRef->type = LE_CFG_TYPE_BOOL;
-            break;
+        return false;
+    }
 
-        case TT_INT_VALUE:
-            tdb_SetValueAsString(nodeRef, stringBuffer);
-            nodeRef->type = LE_CFG_TYPE_INT;
-            break;
+    for (i = 0; i < count; i++)
+    {
+        const char* namePtr;
+
+        if (tjnl_GetString(entryPtr, &namePtr) == false)
+        {
+            return false;
+        }
+
+        // Keep reading the path even if the node isn't there, so that the next operation can be
+        // found.
+        if (nodeRef == NULL)
+        {
+            continue;
+        }
 
-        case TT_FLOAT_VALUE:
-            tdb_SetValueAsString(nodeRef, stringBuffer);
-            nodeRef->type = LE_CFG_TYPE_FLOAT;
-            break;
+        tdb_NodeRef_t childRef = GetNamedChild(nodeRef, namePtr);
 
-        case TT_STRING_VALUE:
-            tdb_SetValueAsString(nodeRef, stringBuffer);
-            break;
+        if (   (childRef == NULL)
+            && (create == true))
+        {
+            // Only stems can have children.
+            if (nodeRef->type != LE_CFG_TYPE_STEM)
+            {
+                tdb_SetEmpty(nodeRef);
+            }
 
-        case TT_EMPTY_VALUE:
-            // The node has already been cleared, so there's nothing left to do but make sure that
-            // the node exists.
-            ClearDeletedFlag(nodeRef);
-            break;
+            childRef = NewChildNode(nodeRef);
 
-        case TT_OPEN_GROUP:
-            while (tokenType != TT_CLOSE_GROUP)
+            if (tdb_SetNodeName(childRef, namePtr) != LE_OK)
             {
-                if (ReadToken(filePtr, stringBuffer, stringBufferSize, &tokenType) != LE_OK)
-                {
-                    LE_ERROR("Unexpected EOF or bad token in file while looking for '}'.");
-                    result = LE_FORMAT_ERROR;
-                    goto cleanup;
-                }
+                LE_ERROR("Bad node name in config tree journal, '%s'.", namePtr);
+                le_mem_Release(childRef);
+                return false;
+            }
+        }
 
-                if (tokenType == TT_STRING_VALUE)
-                {
-                    size_t strLen = le_utf8_NumBytes(stringBuffer);
-                    size_t newPathLen = pathLen + 1 + strLen;
+        nodeRef = childRef;
+    }
 
-                    if (newPathLen > LE_CFG_STR_LEN)
-                    {
-                        LE_ERROR("New path length for node '%s' is too long.  %" PRIuS
-                                 " of %" PRIuS " bytes.",
-                                 stringBuffer,
-                                 strLen,
-                                 (size_t)LE_CFG_STR_LEN);
+    *nodeRefPtr = nodeRef;
+    return true;
+}
 
-                        result = LE_FORMAT_ERROR;
-                        goto cleanup;
-                    }
 
-                    tdb_NodeRef_t childRef = GetNamedChild(nodeRef, stringBuffer);
 
-                    if (childRef == NULL)
-                    {
-                        childRef = NewChildNode(nodeRef);
-                        if (tdb_SetNodeName(childRef, stringBuffer) != LE_OK)
-                        {
-                            LE_ERROR("Bad node name, '%s'.", stringBuffer);
-                            result = LE_FORMAT_ERROR;
-                            goto cleanup;
-                        }
 
-                        LE_DEBUG("New node, %s", stringBuffer);
-                    }
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Apply a journal entry, (one commit's worth of changes,) to the original tree.  This repeats
+ *  what MergeNode() did to each node during the commit.
+ *
+ *  @return True if the entry was applied, false if it is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+static bool ReplayJournalEntry
+(
+    tjnl_Entry_t* entryPtr,  ///< [IN] The journal entry.
+    void* contextPtr         ///< [IN] The tree being loaded.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_TreeRef_t treeRef = contextPtr;
 
-                    tdb_EnsureExists(childRef);
+    while (entryPtr->size > 0)
+    {
+        tdb_NodeRef_t nodeRef = NULL;
+        uint32_t op;
 
-                    result = InternalReadNode(childRef, filePtr, newPathLen);
+        if (tjnl_GetUint32(entryPtr, &op) == false)
+        {
+            goto damaged;
+        }
 
-                    if (result != LE_OK)
-                    {
-                        goto cleanup;
-                    }
-                }
-                else if (tokenType == TT_CLOSE_GROUP)
+        if (op == JOURNAL_OP_DELETE)
+        {
+            if (JournalGetNode(entryPtr, treeRef->rootNodeRef, false, &nodeRef) == false)
+            {
+                goto damaged;
+            }
+
+            if (nodeRef == NULL)
+            {
+                continue;
+            }
+
+            // The root node can't be deleted, only cleared.
+            if (nodeRef->parentRef == NULL)
+            {
+                tdb_SetEmpty(nodeRef);
+                ClearModifiedFlag(nodeRef);
+            }
+            else
+            {
+                le_mem_Release(nodeRef);
+            }
+        }
+        else if (op == JOURNAL_OP_SET)
+        {
+            const char* namePtr;
+            const char* valuePtr = NULL;
+            uint32_t type;
+            uint32_t hasValue;
+
+            if (   (JournalGetNode(entryPtr, treeRef->rootNodeRef, true, &nodeRef) == false)
+                || (nodeRef == NULL)
+                || (tjnl_GetString(entryPtr, &namePtr) == false)
+                || (tjnl_GetUint32(entryPtr, &type) == false)
+                || (type > LE_CFG_TYPE_STEM)
+                || (tjnl_GetUint32(entryPtr, &hasValue) == false)
+                || (   (hasValue)
+                    && (tjnl_GetString(entryPtr, &valuePtr) == false)))
+            {
+                goto damaged;
+            }
+
+            // Apply any rename.
+            if (   (nodeRef->parentRef != NULL)
+                && (nodeRef->nameRef != NULL)
+                && (namePtr[0] != '\0'))
+            {
+                SetNameRef(nodeRef, namePtr);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+                RemoveFromChildIndex(nodeRef);
+#endif
+                nodeRef->nameHash = le_hashmap_HashString(namePtr);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+                AddToChildIndex(nodeRef);
+#endif
+            }
+
+            if (   (type == LE_CFG_TYPE_EMPTY)
+                || (type != nodeRef->type))
+            {
+                tdb_SetEmpty(nodeRef);
+            }
+
+            if (valuePtr != NULL)
+            {
+                if (nodeRef->info.valueRef != NULL)
                 {
-                    break;
+                    dstr_CopyFromCstr(nodeRef->info.valueRef, valuePtr);
                 }
                 else
                 {
-                    LE_ERROR("Unexpected token in found while looking for '}'.");
-                    result = LE_FORMAT_ERROR;
-                    goto cleanup;
+                    nodeRef->info.valueRef = dstr_NewFromCstr(valuePtr);
                 }
-            }
-            break;
 
-        case TT_CLOSE_GROUP:
-        default:
-            LE_ERROR("Unexpected token found.");
-            result = LE_FORMAT_ERROR;
-            goto cleanup;
-    }
+                nodeRef->type = type;
+            }
 
-    if (IsShadow(nodeRef) == false)
-    {
-        ClearModifiedFlag(nodeRef);
-    }
-    else
-    {
-        SetModifiedFlag(nodeRef);
+            ClearModifiedFlag(nodeRef);
+        }
+        else
+        {
+            goto damaged;
+        }
     }
 
-    tdb_EnsureExists(nodeRef);
+    return true;
 
-cleanup:
-    le_mem_Release(stringBuffer);
-    return result;
+damaged:
+    LE_ERROR("Damaged entry in journal of configuration tree '%s'.", treeRef->name);
+    return false;
 }
 
 
@@ -2391,124 +4712,160 @@ cleanup:
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Serialize a tree node and it's children to a file in the filesystem.
+ *  Replay a tree's journal onto the tree just read from the given tree file.  A journal that
+ *  doesn't apply to the tree file is deleted.
  *
- *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ *  @return True if any commits were replayed, (so the tree should be compacted.)
  */
 // -------------------------------------------------------------------------------------------------
-static le_result_t InternalWriteNode
+static bool ReplayJournal
 (
-    tdb_NodeRef_t nodeRef,  ///< [IN] The node being written.
-    FILE* filePtr           ///< [IN] The file being written to.
+    tdb_TreeRef_t treeRef,    ///< [IN] The tree.
+    const char* basePathPtr   ///< [IN] Path to the tree file that was read.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // If there is no node to write, or if the node is marked as having been deleted...  Then write
-    // a blank node.
-    if (   (nodeRef == NULL)
-        || (IsDeleted(nodeRef) == true))
+    char journalPath[LE_CFG_STR_LEN_BYTES] = "";
+    size_t count = 0;
+
+    GetJournalPath(treeRef->name, journalPath, sizeof(journalPath));
+
+    le_result_t result = tjnl_Replay(journalPath, basePathPtr, ReplayJournalEntry, treeRef, &count);
+
+    if (   (result == LE_OK)
+        && (count > 0))
     {
-        return WriteFile(filePtr, "~ ", 2);
+        LE_INFO("Replayed %" PRIuS " journaled commits onto configuration tree '%s'.",
+                count,
+                treeRef->name);
+        return true;
     }
 
-    // Get the node's value as a string.
-    char* stringBuffer = le_mem_ForceAlloc(EncodedStringPool);
-    size_t stringBufferSize = TDB_MAX_ENCODED_SIZE;
-    le_result_t result = LE_OK;
+    // An empty, stale or damaged journal is of no further use.  If the journal couldn't be read
+    // though, leave it in place for next time.
+    if (   (result == LE_OK)
+        || (result == LE_FORMAT_ERROR))
+    {
+        tjnl_Delete(journalPath);
+    }
 
-    tdb_GetValueAsString(nodeRef, stringBuffer, stringBufferSize, "");
+    return false;
+}
+#endif
 
-    // Now, depending on the type of node, write out any required format information.
-    switch (nodeRef->type)
-    {
-        case LE_CFG_TYPE_EMPTY:
-        case LE_CFG_TYPE_DOESNT_EXIST:
-            result = WriteFile(filePtr, "~ ", 2);
-            break;
 
-        case LE_CFG_TYPE_BOOL:
-            {
-                const char boolBuffer[3] = { '!', stringBuffer[0], ' ' };
-                result = WriteFile(filePtr, boolBuffer, sizeof(boolBuffer));
-            }
-            break;
 
-        case LE_CFG_TYPE_STRING:
-            result = WriteStringValue(filePtr, '\"', '\"', stringBuffer);
-            break;
 
-        case LE_CFG_TYPE_INT:
-            result = WriteStringValue(filePtr, '[', ']', stringBuffer);
-            break;
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Attempt to load a configuration tree from a config file.  This function will look for the latest
+ *  valid version of the config file and load that one.
+ */
+// -------------------------------------------------------------------------------------------------
+static void LoadTree
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree object to load from the filesystem.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    // If we don't know the revision then hunt it out from the filesystem.
+    if (treeRef->revisionId == 0)
+    {
+        UpdateRevision(treeRef);
+    }
 
-        case LE_CFG_TYPE_FLOAT:
-            result = WriteStringValue(filePtr, '(', ')', stringBuffer);
-            break;
+    // If this tree has no root, create it now.
+    if (treeRef->rootNodeRef == NULL)
+    {
+        treeRef->rootNodeRef = NewNode();
+    }
 
-        // Looks like this node is a collection, so write out it's child nodes now.
-        case LE_CFG_TYPE_STEM:
-            if ((result = WriteFile(filePtr, "{ ", 2)) == LE_OK)
-            {
-                tdb_NodeRef_t childRef = tdb_GetFirstActiveChildNode(nodeRef);
+    // Ok, if we found a valid revision of the tree in the fs, try to load it now.
+    if (treeRef->revisionId != 0)
+    {
+        char pathPtr[LE_CFG_STR_LEN_BYTES] = "";
+        GetTreePath(treeRef->name, treeRef->revisionId, pathPtr, sizeof(pathPtr));
 
-                while (   (childRef != NULL)
-                       && (result == LE_OK))
-                {
-                    tdb_GetNodeName(childRef, stringBuffer, stringBufferSize);
-                    result = WriteStringValue(filePtr, '\"', '\"', stringBuffer);
+        LE_DEBUG("** Loading configuration tree from '%s'.", pathPtr);
 
-                    if (result == LE_OK)
-                    {
-                        result = InternalWriteNode(childRef, filePtr);
-                    }
+        le_result_t result = ReadTreeFile(treeRef, pathPtr);
+        bool needsSave = (result == LE_UNSUPPORTED);
 
-                    childRef = tdb_GetNextActiveSiblingNode(childRef);
-                }
+#if LE_CONFIG_CFGTREE_JOURNAL
+        // Bring the tree up to date from its journal, then fold the journal into a new tree file.
+        if (result == LE_FAULT)
+        {
+            treeRef->needsFullSave = true;
+        }
+        else if (ReplayJournal(treeRef, pathPtr))
+        {
+            needsSave = true;
+        }
+#endif
 
-                if (result == LE_OK)
-                {
-                    result = WriteFile(filePtr, "} ", 2);
-                }
-            }
-            break;
+        if (needsSave)
+        {
+            SaveTree(treeRef);
+        }
     }
+#if LE_CONFIG_CFGTREE_JOURNAL
+    else
+    {
+        // Any journal left behind belonged to a tree that has since been deleted.
+        char journalPath[LE_CFG_STR_LEN_BYTES] = "";
 
-    le_mem_Release(stringBuffer);
-    return result;
+        GetJournalPath(treeRef->name, journalPath, sizeof(journalPath));
+        tjnl_Delete(journalPath);
+    }
+#endif
 }
 
 
 
-
 // -------------------------------------------------------------------------------------------------
 /**
- *  Calculate the number of bytes required to store a node path, including seperators and a trailing
- *  NULL.
- *
- *  @return The amount of bytes required to store the whole path string.
+ *  Removes the handler object from the given registration object.  This function will also free the
+ *  memory that the handler object had used.
  */
 // -------------------------------------------------------------------------------------------------
-static size_t ComputePathLength
+static void RemoveHandler
 (
-    tdb_NodeRef_t nodeRef  ///< [IN] Compute a path for this node.
+    Registration_t* registrationPtr,  ///< [IN] The registration object to remove the link from.
+    Handler_t* handlerPtr             ///< [IN] The handler object we're removing.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    size_t pathLen = 0;
-    char nodeName[LE_CFG_NAME_LEN_BYTES] = "";
+    // Kill the ref, and remove the object from the registration list.
+    le_ref_DeleteRef(HandlerSafeRefMap, handlerPtr->safeRef);
+    le_dls_Remove(&registrationPtr->handlerList, &handlerPtr->link);
 
-    while (nodeRef != NULL)
+    // Drop any changes that a coalesced handler hasn't been notified of yet.
+    if (handlerPtr->isCoalesced)
     {
-        LE_ASSERT(tdb_GetNodeName(nodeRef, nodeName, sizeof(nodeName)) == LE_OK);
+        if (handlerPtr->holdOffTimer != NULL)
+        {
+            le_timer_Delete(handlerPtr->holdOffTimer);
+            handlerPtr->holdOffTimer = NULL;
+        }
 
-        // Add this path segment's length to our running total, along with the required path
-        // seperator.
-        pathLen += 1 + le_utf8_NumBytes(nodeName);
-        nodeRef = tdb_GetNodeParent(nodeRef);
+        if (handlerPtr->changesRef != NULL)
+        {
+            dstr_Release(handlerPtr->changesRef);
+            handlerPtr->changesRef = NULL;
+        }
+
+        registrationPtr->coalescedCount--;
+        CoalescedHandlerCount--;
     }
 
-    // Don't forget to include a spot for the trailing NULL.
-    return pathLen + 1;
+    // Clear out the link data, just to be safe.
+    handlerPtr->link = LE_DLS_LINK_INIT;
+    handlerPtr->sessionRef = NULL;
+    handlerPtr->registrationPtr = NULL;
+    handlerPtr->safeRef = NULL;
+
+    // Finally kill the object.
+    le_mem_Release(handlerPtr);
 }
 
 
@@ -2516,21 +4873,101 @@ static size_t ComputePathLength
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Bump up the version id of this tree.
+ *  Create a handler object for a node path, and add it to the path's registration object (which is
+ *  created if needed).  The caller fills in the function to call back.
+ *
+ *  @return The new handler object, or NULL if the path is bad.
  */
 // -------------------------------------------------------------------------------------------------
-static void IncrementRevision
+static Handler_t* NewHandler
 (
-    tdb_TreeRef_t treeRef  ///< [IN] Increment the revision of this tree.
+    tdb_TreeRef_t treeRef,           ///< [IN] The tree to register the handler on.
+    le_msg_SessionRef_t sessionRef,  ///< [IN] The session that the request came in on.
+    const char* pathPtr              ///< [IN] Path of the node to watch.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    treeRef->revisionId++;
+    le_pathIter_Ref_t pathIterRef = NULL;
+    char newPathBuffer[CFG_MAX_PATH_SIZE] = { 0 };
 
-    if (treeRef->revisionId > 3)
+    // Check to see if the tree was specified in the request.  If it wasn't then add the user's tree
+    // to the path now.
+    if (tp_PathHasTreeSpecifier(pathPtr))
     {
-        treeRef->revisionId = 1;
+        pathIterRef = le_pathIter_CreateForUnix(pathPtr);
+    }
+    else
+    {
+        if (pathPtr[0] != '/')
+        {
+            snprintf(newPathBuffer, sizeof(newPathBuffer), "%s:/%s", treeRef->name, pathPtr);
+        }
+        else
+        {
+            snprintf(newPathBuffer, sizeof(newPathBuffer), "%s:%s", treeRef->name, pathPtr);
+        }
+        pathIterRef = le_pathIter_CreateForUnix(newPathBuffer);
+    }
+
+    // Get the normalized path out of the iterator object.  If the tree specifier got removed for
+    // any reason during the normalization, or if the internal path exceeded our buffer then return
+    // failure now.
+    le_result_t result = le_pathIter_GetPath(pathIterRef, newPathBuffer, sizeof(newPathBuffer));
+    le_pathIter_Delete(pathIterRef);
+
+    if (result != LE_OK)
+    {
+        LE_ERROR("Change registration path error, %d: '%s'.", result, LE_RESULT_TXT(result));
+        return NULL;
+    }
+
+    if (tp_PathHasTreeSpecifier(newPathBuffer) == false)
+    {
+        LE_ERROR("Failed to set tree for event registration.");
+        return NULL;
+    }
+
+    // Find the registration object for the given node, if it currently exists.
+    Registration_t* foundRegistrationPtr = le_hashmap_Get(HandlerRegistrationMap, newPathBuffer);
+
+    if (foundRegistrationPtr == NULL)
+    {
+        // Looks like a registration object hasn't been created yet.  So, do so now and add it to
+        // our map.
+        foundRegistrationPtr = le_mem_ForceAlloc(RegistrationPool);
+
+        foundRegistrationPtr->triggered = false;
+        foundRegistrationPtr->childTriggered = false;
+        foundRegistrationPtr->coalescedCount = 0;
+
+        foundRegistrationPtr->handlerList = LE_DLS_LIST_INIT;
+        le_utf8_Copy(foundRegistrationPtr->registrationPath,
+                     newPathBuffer,
+                     sizeof(foundRegistrationPtr->registrationPath),
+                     NULL);
+
+        le_hashmap_Put(HandlerRegistrationMap,
+                       foundRegistrationPtr->registrationPath,
+                       foundRegistrationPtr);
     }
+
+    // Add this handler to the registration object to keep track of it for later.
+    Handler_t* handlerObjectPtr = le_mem_ForceAlloc(HandlerPool);
+
+    handlerObjectPtr->link = LE_DLS_LINK_INIT;
+    handlerObjectPtr->sessionRef = sessionRef;
+    handlerObjectPtr->isCoalesced = false;
+    handlerObjectPtr->handlerPtr = NULL;
+    handlerObjectPtr->contextPtr = NULL;
+    handlerObjectPtr->changesRef = NULL;
+    handlerObjectPtr->changesOverflowed = false;
+    handlerObjectPtr->holdOffTimer = NULL;
+    handlerObjectPtr->registrationPtr = foundRegistrationPtr;
+    handlerObjectPtr->safeRef = le_ref_CreateRef(HandlerSafeRefMap, handlerObjectPtr);
+
+    le_dls_Queue(&foundRegistrationPtr->handlerList, &handlerObjectPtr->link);
+
+    return handlerObjectPtr;
 }
 
 
@@ -2538,89 +4975,58 @@ static void IncrementRevision
 
 // -------------------------------------------------------------------------------------------------
 /**
- *  Attempt to load a configuration tree from a config file.  This function will look for the latest
- *  valid version of the config file and load that one.
+ *  Look up a handler object by its safe reference, making sure it belongs to the given session and
+ *  is of the expected kind.
+ *
+ *  @return The handler object, or NULL if not found.
  */
 // -------------------------------------------------------------------------------------------------
-static void LoadTree
+static Handler_t* LookupHandler
 (
-    tdb_TreeRef_t treeRef  ///< [IN] The tree object to load from the filesystem.
+    void* handlerRef,                ///< [IN] The handler's safe reference.
+    le_msg_SessionRef_t sessionRef,  ///< [IN] The session of the user making this request.
+    bool isCoalesced                 ///< [IN] Is a coalesced handler expected?
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // If we don't know the revision then hunt it out from the filesystem.
-    if (treeRef->revisionId == 0)
-    {
-        UpdateRevision(treeRef);
-    }
+    Handler_t* handlerObjectPtr = le_ref_Lookup(HandlerSafeRefMap, handlerRef);
 
-    // If this tree has no root, create it now.
-    if (treeRef->rootNodeRef == NULL)
+    if (   (handlerObjectPtr == NULL)
+        || (handlerObjectPtr->sessionRef != sessionRef)
+        || (handlerObjectPtr->isCoalesced != isCoalesced))
     {
-        treeRef->rootNodeRef = NewNode();
+        return NULL;
     }
 
-    // Ok, if we found a valid revision of the tree in the fs, try to load it now.
-    if (treeRef->revisionId != 0)
-    {
-        char pathPtr[LE_CFG_STR_LEN_BYTES] = "";
-        GetTreePath(treeRef->name, treeRef->revisionId, pathPtr, sizeof(pathPtr));
-
-        LE_DEBUG("** Loading configuration tree from '%s'.", pathPtr);
-
-        FILE* fileRef;
-
-        fileRef = fopen(pathPtr, "r");
-
-        tdb_EnsureExists(treeRef->rootNodeRef);
-
-        if (!fileRef)
-        {
-            LE_ERROR("Could not open configuration tree file: %s, reason: %s",
-                     pathPtr,
-                     LE_ERRNO_TXT(errno));
-        }
-        else
-        {
-            if (tdb_ReadTreeNode(treeRef->rootNodeRef, fileRef) == false)
-            {
-                LE_ERROR("Could not parse configuration tree file: %s.", pathPtr);
-                le_mem_Release(treeRef->rootNodeRef);
-                treeRef->rootNodeRef = NewNode();
-            }
-
-            fclose(fileRef);
-        }
-    }
+    return handlerObjectPtr;
 }
 
 
 
+
 // -------------------------------------------------------------------------------------------------
 /**
- *  Removes the handler object from the given registration object.  This function will also free the
- *  memory that the handler object had used.
+ *  Remove a handler object from its registration object and free it.  If that leaves the
+ *  registration object empty, it is freed as well.
  */
 // -------------------------------------------------------------------------------------------------
-static void RemoveHandler
+static void DeleteHandler
 (
-    Registration_t* registrationPtr,  ///< [IN] The registration object to remove the link from.
-    Handler_t* handlerPtr             ///< [IN] The handler object we're removing.
+    Handler_t* handlerObjectPtr  ///< [IN] The handler object to delete.
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // Kill the ref, and remove the object from the registration list.
-    le_ref_DeleteRef(HandlerSafeRefMap, handlerPtr->safeRef);
-    le_dls_Remove(&registrationPtr->handlerList, &handlerPtr->link);
+    Registration_t* registrationPtr = handlerObjectPtr->registrationPtr;
 
-    // Clear out the link data, just to be safe.
-    handlerPtr->link = LE_DLS_LINK_INIT;
-    handlerPtr->sessionRef = NULL;
-    handlerPtr->registrationPtr = NULL;
-    handlerPtr->safeRef = NULL;
+    // Remove the handler object from the registration object's list.
+    RemoveHandler(registrationPtr, handlerObjectPtr);
 
-    // Finally kill the object.
-    le_mem_Release(handlerPtr);
+    // If there are no more handlers in this registration object, kill the object.
+    if (le_dls_IsEmpty(&registrationPtr->handlerList))
+    {
+        le_hashmap_Remove(HandlerRegistrationMap, registrationPtr->registrationPath);
+        le_mem_Release(registrationPtr);
+    }
 }
 
 
@@ -2682,28 +5088,6 @@ static bool OnHandlerRegistrationCleanup
 
 
 
-// -------------------------------------------------------------------------------------------------
-/**
- *  Call this function to delete a tree file from the filesystem.
- */
-// -------------------------------------------------------------------------------------------------
-static void DeleteTreeFile
-(
-    const char* filePathPtr  ///< Path to the tree file in question.
-)
-// -------------------------------------------------------------------------------------------------
-{
-    LE_DEBUG("** Deleting tree file, '%s'.", filePathPtr);
-
-    if (unlink(filePathPtr) != 0)
-    {
-        LE_ERROR("File delete failure, '%s', reason '%m'.", filePathPtr);
-    }
-}
-
-
-
-
 // -------------------------------------------------------------------------------------------------
 /**
  *  Find the root node represented by the path ref.
@@ -2754,6 +5138,18 @@ void tdb_Init
     le_mem_SetDestructor(NodePoolRef, NodeDestructor);
     le_mem_SetNumObjsToForce(NodePoolRef, 50);    // Grow in chunks of 50 blocks.
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    timg_Init();
+#endif
+
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    ChildIndexRef = le_flatmap_Create("configChildIndex",
+                                      LE_CONFIG_CFGTREE_CHILD_INDEX_THRESHOLD,
+                                      HashChildKey,
+                                      EqualsChildKey);
+    le_flatmap_SetGrowable(ChildIndexRef, true);
+#endif
+
     TreePoolRef = le_mem_InitStaticPool(treePool, LE_CONFIG_CFGTREE_MAX_TREE_POOL_SIZE,
                                         sizeof(Tree_t));
     le_mem_SetDestructor(TreePoolRef, TreeDestructor);
@@ -2783,6 +5179,9 @@ void tdb_Init
     EncodedStringPool = le_mem_InitStaticPool(EncodedString,
                                               LE_CONFIG_CFGTREE_MAX_ENCODED_STRING_POOL_SIZE,
                                               TDB_MAX_ENCODED_SIZE);
+    ExportPool = le_mem_InitStaticPool(Export,
+                                       LE_CONFIG_CFGTREE_MAX_ITERATOR_POOL_SIZE,
+                                       sizeof(Export_t));
 
     // Preload the system tree.
     tdb_GetTree("system");
@@ -2860,6 +5259,13 @@ void tdb_DeleteTree
             }
         }
 
+#if LE_CONFIG_CFGTREE_JOURNAL
+        char journalPath[LE_CFG_STR_LEN_BYTES] = "";
+
+        GetJournalPath(treeRef->name, journalPath, sizeof(journalPath));
+        tjnl_Delete(journalPath);
+#endif
+
         LE_ASSERT(le_hashmap_Remove(TreeCollectionRef, treeRef->name) == treeRef);
         le_mem_Release(treeRef);
     }
@@ -2918,6 +5324,68 @@ tdb_TreeRef_t tdb_ShadowTree
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Create a read only snapshot of a tree, as it is now.  Read iterators can be moved onto the
+ *  snapshot before a commit, so that they carry on seeing the tree as it was when their
+ *  transactions started.
+ *
+ *  The snapshot starts out as a shadow of the tree, so taking one doesn't copy anything.  Each
+ *  commit to the tree first gives the snapshot its own copies of the nodes it is about to change.
+ *
+ *  The snapshot is freed once the caller, and every iterator registered on it, have released it
+ *  with tdb_ReleaseTree().
+ *
+ *  @return The new snapshot of the tree.
+ */
+// -------------------------------------------------------------------------------------------------
+tdb_TreeRef_t tdb_SnapshotTree
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree to snapshot.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(treeRef->originalTreeRef == NULL);
+    LE_ASSERT(treeRef->snapshotOfRef == NULL);
+
+    tdb_TreeRef_t snapshotRef = NewTree(treeRef->name, NewShadowNode(treeRef->rootNodeRef));
+
+    le_mem_AddRef(treeRef);
+    snapshotRef->snapshotOfRef = treeRef;
+    le_dls_Queue(&treeRef->snapshotList, &snapshotRef->snapshotLink);
+
+    return snapshotRef;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the tree that a shadow tree was created from.
+ *
+ *  @return The original tree, or the tree itself if it isn't a shadow tree.
+ */
+// -------------------------------------------------------------------------------------------------
+tdb_TreeRef_t tdb_GetOriginalTree
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree object to read.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(treeRef != NULL);
+
+    if (treeRef->originalTreeRef != NULL)
+    {
+        return treeRef->originalTreeRef;
+    }
+
+    return treeRef;
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Called to create a new tree that shadows an existing one.
@@ -3033,12 +5501,19 @@ void tdb_RegisterIterator
 
     if (ni_IsWriteable(iteratorRef))
     {
+        LE_ASSERT(treeRef->snapshotOfRef == NULL);
         LE_ASSERT(treeRef->activeWriteIterRef == NULL);
         treeRef->activeWriteIterRef = iteratorRef;
         LE_ASSERT(treeRef->activeWriteIterRef != NULL);
     }
     else
     {
+        // Each reader on a snapshot holds a reference to it, released by tdb_ReleaseTree().
+        if (treeRef->snapshotOfRef != NULL)
+        {
+            le_mem_AddRef(treeRef);
+        }
+
         treeRef->activeReadCount++;
     }
 }
@@ -3112,6 +5587,11 @@ le_sls_List_t* tdb_GetRequestQueue
         return &treeRef->originalTreeRef->requestList;
     }
 
+    if (treeRef->snapshotOfRef != NULL)
+    {
+        return &treeRef->snapshotOfRef->requestList;
+    }
+
     return &treeRef->requestList;
 }
 
@@ -3130,69 +5610,39 @@ void tdb_MergeTree
 )
 // -------------------------------------------------------------------------------------------------
 {
-    // Get our shadow tree's root node and merge it's changes into the real tree.  Create a path
-    // iterator to track the merge and allow for update handlers to be called.
+    // Get our shadow tree's root node and merge it's changes into the real tree.  Track the path
+    // of the merge on the stack to allow for update handlers to be called.
     tdb_NodeRef_t nodeRef = shadowTreeRef->rootNodeRef;
-    le_pathIter_Ref_t pathRef = CreateBasePath(shadowTreeRef->originalTreeRef->name);
-
-    InternalMergeTree(shadowTreeRef->originalTreeRef->name, pathRef, nodeRef, false);
-    le_pathIter_Delete(pathRef);
-
-    // Now, go through and call the triggered callbacks.
-    FireTriggeredCallbacks();
+    CallbackPath_t path;
 
-    // Now increment revision of the tree and open a tree file for writing.
+    // First keep the tree's snapshots from seeing the changes.
     tdb_TreeRef_t originalTreeRef = shadowTreeRef->originalTreeRef;
-    int oldId = originalTreeRef->revisionId;
-
-    IncrementRevision(originalTreeRef);
-
-    char filePath[LE_CFG_STR_LEN_BYTES] = "";
-    GetTreePath(originalTreeRef->name, originalTreeRef->revisionId, filePath, sizeof(filePath));
-
-    LE_DEBUG("Changes merged, now attempting to serialize the tree to '%s'.", filePath);
-
-    FILE* filePtr = NULL;
-
-    filePtr = fopen(filePath, "w+");
+    le_dls_Link_t* linkPtr = le_dls_Peek(&originalTreeRef->snapshotList);
 
-    if (!filePtr && (EROFS == errno))
+    while (linkPtr != NULL)
     {
-        // In case we are R/O for the config tree, we discard the update to flash
-        return;
-    }
+        tdb_TreeRef_t snapshotRef = CONTAINER_OF(linkPtr, Tree_t, snapshotLink);
 
-    if (!filePtr)
-    {
-        LE_EMERG("Failed to open config file '%s' (%m).", filePath);
-        LE_EMERG("Changes have been merged in memory, however they could not be committed to the "
-                 "filesystem!!");
-        return;
+        FreezeNode(nodeRef, originalTreeRef->rootNodeRef, snapshotRef->rootNodeRef);
+        linkPtr = le_dls_PeekNext(&originalTreeRef->snapshotList, linkPtr);
     }
 
-    // We have a tree file to write to, so stream the new tree to it then close the output file.
-    le_result_t writeResult = tdb_WriteTreeNode(originalTreeRef->rootNodeRef, filePtr);
+    InitBasePath(&path, shadowTreeRef->originalTreeRef->name);
+    InternalMergeTree(shadowTreeRef->originalTreeRef->name, &path, nodeRef, false);
 
-    int retVal = fclose(filePtr);
-    LE_EMERG_IF(retVal == EOF,
-                "An error occurred while closing the tree file: %s", LE_ERRNO_TXT(errno));
+    // Now, go through and call the triggered callbacks.
+    FireTriggeredCallbacks();
 
-    // Finally remove the old version of the tree file, if there is one.
-    if (writeResult == LE_OK)
-    {
-        if (   (oldId != 0)
-            && (TreeFileExists(originalTreeRef->name, oldId)))
-        {
-            GetTreePath(originalTreeRef->name, oldId, filePath, sizeof(filePath));
-            DeleteTreeFile(filePath);
-        }
-    }
-    else
+#if LE_CONFIG_CFGTREE_JOURNAL
+    // Usually only the changes need to be written.
+    if (AppendToJournal(shadowTreeRef->originalTreeRef))
     {
-        // The write failed, delete the new file we attempted to create.
-        LE_EMERG("The attempt to write to the config tree file, '%s,' failed.", filePath);
-        DeleteTreeFile(filePath);
+        return;
     }
+#endif
+
+    // Now write the tree out to the filesystem.
+    SaveTree(shadowTreeRef->originalTreeRef);
 }
 
 
@@ -3211,7 +5661,8 @@ void tdb_ReleaseTree
 {
     LE_ASSERT(treeRef != NULL);
 
-    if (treeRef->originalTreeRef != NULL)
+    if (   (treeRef->originalTreeRef != NULL)
+        || (treeRef->snapshotOfRef != NULL))
     {
         le_mem_Release(treeRef);
     }
@@ -3281,6 +5732,67 @@ bool tdb_ReadTreeNode
 
 
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a configuration tree node's contents from a tree image file, such as the ones that mksys
+ *  generates with the --binary-config option.  The image's records are copied straight into the
+ *  node, without any of the text parsing done by tdb_ReadTreeNode().
+ *
+ *  @return LE_OK if the read is successful.
+ *          LE_NOT_FOUND if the file isn't a tree image, (it should be read with tdb_ReadTreeNode.)
+ *          LE_FORMAT_ERROR if the image is damaged.
+ *          LE_IO_ERROR if the file couldn't be read.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tdb_ReadTreeImage
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] The node to write the new data to.
+    const char* pathPtr     ///< [IN] Path to the file to read from.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(nodeRef != NULL);
+    LE_ASSERT(pathPtr != NULL);
+
+    timg_ImageRef_t imageRef = NULL;
+    le_result_t result = timg_Open(pathPtr, &imageRef);
+
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
+    // Clear out any contents that the node may have, and make sure that it isn't marked as deleted.
+    tdb_SetEmpty(nodeRef);
+    tdb_EnsureExists(nodeRef);
+
+    size_t pathLen = ComputePathLength(nodeRef);
+
+    if (pathLen >= LE_CFG_STR_LEN)
+    {
+        result = LE_FORMAT_ERROR;
+    }
+    else
+    {
+        result = InternalReadImageNode(nodeRef, imageRef, 0, pathLen);
+    }
+
+    if (result != LE_OK)
+    {
+        LE_ERROR("Could not import configuration tree image: %s.", pathPtr);
+        tdb_SetEmpty(nodeRef);
+    }
+
+    le_mem_Release(imageRef);
+
+    return result;
+}
+#endif
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Serialize a tree node and it's children to a file in the filesystem.
@@ -3295,8 +5807,107 @@ le_result_t tdb_WriteTreeNode
 )
 // -------------------------------------------------------------------------------------------------
 {
+    WriteCursor_t cursor = { .filePtr = filePtr, .rootRef = nodeRef, .nextRef = nodeRef };
+
     // Write the data, then close up the file.
-    return InternalWriteNode(nodeRef, filePtr);
+    return WriteNodes(&cursor, SIZE_MAX);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Start exporting a tree node and it's children to a file, in the same format as
+ *  tdb_WriteTreeNode().  The export is written a few nodes at a time by tdb_ContinueExport(), from
+ *  a private copy of the node, so the tree can go on being read and committed to in between.
+ *
+ *  Nodes of a write transaction's shadow tree, and nodes of a snapshot that still share the tree's
+ *  nodes, can't be copied, those are written out straight away.
+ *
+ *  The export takes over the file, which is closed by tdb_EndExport().
+ *
+ *  @return The export, to be finished with tdb_EndExport().
+ */
+// -------------------------------------------------------------------------------------------------
+tdb_ExportRef_t tdb_StartExport
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] Export the contents of this node.
+    FILE* filePtr           ///< [IN] The file to write to.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    tdb_ExportRef_t exportRef = le_mem_ForceAlloc(ExportPool);
+
+    exportRef->copyRef = NULL;
+    exportRef->result = LE_IN_PROGRESS;
+
+    if (   (nodeRef != NULL)
+        && (IsShadow(nodeRef) == false)
+        && (nodeRef->shadowRef == NULL)
+        && (IsDeleted(nodeRef) == false))
+    {
+        exportRef->copyRef = CopyNode(nodeRef);
+        nodeRef = exportRef->copyRef;
+    }
+
+    exportRef->cursor = (WriteCursor_t){ .filePtr = filePtr, .rootRef = nodeRef, .nextRef = nodeRef };
+
+    if (exportRef->copyRef == NULL)
+    {
+        exportRef->result = WriteNodes(&exportRef->cursor, SIZE_MAX);
+    }
+
+    return exportRef;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write some more of an export.
+ *
+ *  @return LE_OK if the export has been completely written, LE_IN_PROGRESS if there is more to
+ *          write, or LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tdb_ContinueExport
+(
+    tdb_ExportRef_t exportRef,  ///< [IN] The export to continue.
+    size_t maxNodes             ///< [IN] The most nodes to write this time.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (exportRef->result == LE_IN_PROGRESS)
+    {
+        exportRef->result = WriteNodes(&exportRef->cursor, maxNodes);
+    }
+
+    return exportRef->result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Finish with an export, whether or not it has been completely written, and close its file.
+ */
+// -------------------------------------------------------------------------------------------------
+void tdb_EndExport
+(
+    tdb_ExportRef_t exportRef  ///< [IN] The export to free.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (exportRef->copyRef != NULL)
+    {
+        le_mem_Release(exportRef->copyRef);
+    }
+
+    fclose(exportRef->cursor.filePtr);
+    le_mem_Release(exportRef);
 }
 
 
@@ -3325,25 +5936,29 @@ tdb_NodeRef_t tdb_GetNode
 
     // Now start moving along the path, moving the current node along as we go.  The called function
     // also deals with . and .. names in the path as well, returning the current and parent nodes
-    // respectivly.
-    char nameRef[LE_CFG_NAME_LEN_BYTES] = "";
+    // respectivly.  The segments are looked up in place, without being copied out of the path.
+    char path[CFG_MAX_PATH_SIZE] = "";
 
-    le_result_t result = le_pathIter_GoToStart(nodePathRef);
-
-    while (   (result != LE_NOT_FOUND)
-           && (currentRef != NULL))
+    if (le_pathIter_GetPath(nodePathRef, path, sizeof(path)) != LE_OK)
     {
-        result = le_pathIter_GetCurrentNode(nodePathRef, nameRef, sizeof(nameRef));
+        LE_ERROR("Path overflow.");
+        return NULL;
+    }
+
+    const char* cursorPtr = path;
+    tp_Segment_t segment;
 
-        if (result == LE_OVERFLOW)
+    while (   (currentRef != NULL)
+           && (tp_NextSegment(&cursorPtr, &segment)))
+    {
+        if (segment.length >= LE_CFG_NAME_LEN_BYTES)
         {
             LE_ERROR("Path segment overflow on path.");
             currentRef = NULL;
         }
-        else if (result == LE_OK)
+        else
         {
-            currentRef = GetNamedChild(currentRef, nameRef);
-            result = le_pathIter_GoToNext(nodePathRef);
+            currentRef = FindNamedChild(currentRef, segment.namePtr, segment.length);
         }
     }
 
@@ -3376,39 +5991,41 @@ tdb_NodeRef_t tdb_CreateNodePath
 
     // Now start moving along the path, moving the current node along as we go.  The called function
     // also deals with . and .. names in the path as well, returning the current and parent nodes
-    // respectivly.
-    char nameRef[LE_CFG_NAME_LEN_BYTES] = "";
+    // respectivly.  A segment is only copied out of the path when a node has to be created for it.
+    char path[CFG_MAX_PATH_SIZE] = "";
 
-    le_result_t result = le_pathIter_GoToStart(nodePathRef);
-
-    while (   (result != LE_NOT_FOUND)
-           && (currentRef != NULL))
+    if (le_pathIter_GetPath(nodePathRef, path, sizeof(path)) != LE_OK)
     {
-        result = le_pathIter_GetCurrentNode(nodePathRef, nameRef, sizeof(nameRef));
+        LE_ERROR("Path overflow.");
+        return NULL;
+    }
 
-        if (result == LE_OK)
+    const char* cursorPtr = path;
+    tp_Segment_t segment;
+
+    while (   (currentRef != NULL)
+           && (tp_NextSegment(&cursorPtr, &segment)))
+    {
+        if (segment.length >= LE_CFG_NAME_LEN_BYTES)
+        {
+            LE_ERROR("Path segment overflow on path.");
+            currentRef = NULL;
+        }
+        else
         {
-            tdb_NodeRef_t childRef = GetNamedChild(currentRef, nameRef);
+            tdb_NodeRef_t childRef = FindNamedChild(currentRef, segment.namePtr, segment.length);
 
             if (childRef == NULL)
             {
+                char nameRef[LE_CFG_NAME_LEN_BYTES];
+
+                memcpy(nameRef, segment.namePtr, segment.length);
+                nameRef[segment.length] = '\0';
+
                 childRef = CreateNamedChild(currentRef, nameRef);
             }
 
             currentRef = childRef;
-            result = le_pathIter_GoToNext(nodePathRef);
-        }
-        else if (result == LE_OVERFLOW)
-        {
-            LE_ERROR("Path segment overflow on path.");
-            currentRef = NULL;
-        }
-        else
-        {
-            LE_ERROR("Unexpected error with path segment, '%s': %d.",
-                     LE_RESULT_TXT(result),
-                     result);
-            currentRef = NULL;
         }
     }
 
@@ -3461,18 +6078,7 @@ le_result_t tdb_GetNodeName
 
     stringPtr[0] = 0;
 
-    // Get the name pointer from the ndoe.  However if this is a shadow node, then this name may be
-    // NULL.  The reason that the name may be NULL is because the client never changed the name of
-    // the node.  So, we just get the name from the original node, saving memory.  However, nodes
-    // like the root node of a tree also do not have names.
-    dstr_Ref_t nameRef = nodeRef->nameRef;
-
-    if (   (IsShadow(nodeRef))
-        && (nodeRef->nameRef == NULL)
-        && (nodeRef->shadowRef != NULL))
-    {
-        nameRef = nodeRef->shadowRef->nameRef;
-    }
+    dstr_Ref_t nameRef = GetNameRef(nodeRef);
 
     // If the node has a name, copy it into the user buffer now.
     if (nameRef != NULL)
@@ -3561,15 +6167,14 @@ le_result_t tdb_SetNodeName
 
     // Copy over the new name.  Note that we don't care if this node is a shadow node.  Coping over
     // the name is taken care of as part of the merge process.
-    if (nodeRef->nameRef == NULL)
-    {
-        nodeRef->nameRef = dstr_NewFromCstr(stringPtr);
-    }
-    else
-    {
-        dstr_CopyFromCstr(nodeRef->nameRef, stringPtr);
-    }
+    SetNameRef(nodeRef, stringPtr);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    RemoveFromChildIndex(nodeRef);
+#endif
     nodeRef->nameHash = le_hashmap_HashString(stringPtr);
+#if LE_CONFIG_CFGTREE_CHILD_INDEX
+    AddToChildIndex(nodeRef);
+#endif
 
     // If this is a shadow node and this is the change that modified it, then try to get it's
     // children now.  This is done so that later when this node is merged the merge code doesn't end
@@ -3618,6 +6223,15 @@ le_cfg_nodeType_t tdb_GetNodeType
         return LE_CFG_TYPE_DOESNT_EXIST;
     }
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    // Stems are only written to tree images if they have children, so there's no need to create
+    // them just to find out.
+    if (nodeRef->imageRef != NULL)
+    {
+        return LE_CFG_TYPE_STEM;
+    }
+#endif
+
     // If the node is a stem but has no children, then treat the node as empty.
     if (   (nodeRef->type == LE_CFG_TYPE_STEM)
         && (tdb_GetFirstActiveChildNode(nodeRef) == NULL))
@@ -3693,6 +6307,10 @@ void tdb_SetEmpty
         return;
     }
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    DropImageChildren(nodeRef);
+#endif
+
     // If this is a stem node, then go through and clear out the children.
     if (nodeRef->type == LE_CFG_TYPE_STEM)
     {
@@ -3805,6 +6423,10 @@ tdb_NodeRef_t tdb_GetFirstChildNode
 {
     LE_ASSERT(nodeRef != NULL);
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+    MaterializeChildren(nodeRef);
+#endif
+
     // Is this the type of node that has children?
     if (   (   (nodeRef->type != LE_CFG_TYPE_STEM)
             || (le_dls_IsEmpty(&nodeRef->info.children) == true))
@@ -4256,81 +6878,94 @@ le_cfg_ChangeHandlerRef_t tdb_AddChangeHandler
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_pathIter_Ref_t pathIterRef = NULL;
-    char newPathBuffer[CFG_MAX_PATH_SIZE] = { 0 };
+    Handler_t* handlerObjectPtr = NewHandler(treeRef, sessionRef, pathPtr);
 
-    // Check to see if the tree was specified in the request.  If it wasn't then add the user's tree
-    // to the path now.
-    if (tp_PathHasTreeSpecifier(pathPtr))
-    {
-        pathIterRef = le_pathIter_CreateForUnix(pathPtr);
-    }
-    else
+    if (handlerObjectPtr == NULL)
     {
-        if (pathPtr[0] != '/')
-        {
-            snprintf(newPathBuffer, sizeof(newPathBuffer), "%s:/%s", treeRef->name, pathPtr);
-        }
-        else
-        {
-            snprintf(newPathBuffer, sizeof(newPathBuffer), "%s:%s", treeRef->name, pathPtr);
-        }
-        pathIterRef = le_pathIter_CreateForUnix(newPathBuffer);
+        return NULL;
     }
 
-    // Get the normalized path out of the iterator object.  If the tree specifier got removed for
-    // any reason during the normalization, or if the internal path exceeded our buffer then return
-    // failure now.
-    le_result_t result = le_pathIter_GetPath(pathIterRef, newPathBuffer, sizeof(newPathBuffer));
-    le_pathIter_Delete(pathIterRef);
+    handlerObjectPtr->handlerPtr = handlerPtr;
+    handlerObjectPtr->contextPtr = contextPtr;
 
-    if (result != LE_OK)
-    {
-        LE_ERROR("Change registration path error, %d: '%s'.", result, LE_RESULT_TXT(result));
-        return NULL;
-    }
+    return handlerObjectPtr->safeRef;
+}
 
-    if (tp_PathHasTreeSpecifier(newPathBuffer) == false)
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Deregisters a handler function that was registered using tdb_AddChangeHandler().
+ */
+//--------------------------------------------------------------------------------------------------
+void tdb_RemoveChangeHandler
+(
+    le_cfg_ChangeHandlerRef_t handlerRef,  ///< [IN] Reference returned by tdb_AddChangeHandler().
+    le_msg_SessionRef_t sessionRef         ///< [IN] The session of the user making this request.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // Simply look up the handler object in the safe ref map, then make sure that the object was
+    // found and belongs to the user session.
+    Handler_t* handlerObjectPtr = LookupHandler(handlerRef, sessionRef, false);
+
+    if (handlerObjectPtr != NULL)
     {
-        LE_ERROR("Failed to set tree for event registration.");
-        return NULL;
+        DeleteHandler(handlerObjectPtr);
     }
+}
 
-    // Find the registration object for the given node, if it currently exists.
-    Registration_t* foundRegistrationPtr = le_hashmap_Get(HandlerRegistrationMap, newPathBuffer);
 
-    if (foundRegistrationPtr == NULL)
-    {
-        // Looks like a registration object hasn't been created yet.  So, do so now and add it to
-        // our map.
-        foundRegistrationPtr = le_mem_ForceAlloc(RegistrationPool);
 
-        foundRegistrationPtr->triggered = false;
 
-        foundRegistrationPtr->handlerList = LE_DLS_LIST_INIT;
-        le_utf8_Copy(foundRegistrationPtr->registrationPath,
-                     newPathBuffer,
-                     sizeof(foundRegistrationPtr->registrationPath),
-                     NULL);
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Registers a handler function to be called with the list of changed paths when a node at or
+ *  below a given path changes.  See le_cfg_AddCoalescedChangeHandler().
+ *
+ *  @return A new safe ref backed object, or NULL if the creation failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_cfg_CoalescedChangeHandlerRef_t tdb_AddCoalescedChangeHandler
+(
+    tdb_TreeRef_t treeRef,                           ///< [IN] The tree to register the handler on.
+    le_msg_SessionRef_t sessionRef,                  ///< [IN] The session that the request came in
+                                                     ///<      on.
+    const char* pathPtr,                             ///< [IN] Path of the node to watch.
+    uint32_t holdOffMs,                              ///< [IN] Time to gather changes for before
+                                                     ///<      calling back, 0 to call back at the
+                                                     ///<      end of each commit.
+    le_cfg_CoalescedChangeHandlerFunc_t handlerPtr,  ///< [IN] Function to call back.
+    void* contextPtr                                 ///< [IN] Opaque value to pass to the function
+                                                     ///<      when called.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Handler_t* handlerObjectPtr = NewHandler(treeRef, sessionRef, pathPtr);
 
-        le_hashmap_Put(HandlerRegistrationMap,
-                       foundRegistrationPtr->registrationPath,
-                       foundRegistrationPtr);
+    if (handlerObjectPtr == NULL)
+    {
+        return NULL;
     }
 
-    // Add this handler to the registration object to keep track of it for later.
-    Handler_t* handlerObjectPtr = le_mem_ForceAlloc(HandlerPool);
-
-    handlerObjectPtr->link = LE_DLS_LINK_INIT;
-    handlerObjectPtr->sessionRef = sessionRef;
-    handlerObjectPtr->handlerPtr = handlerPtr;
+    handlerObjectPtr->isCoalesced = true;
+    handlerObjectPtr->coalescedHandlerPtr = handlerPtr;
     handlerObjectPtr->contextPtr = contextPtr;
-    handlerObjectPtr->registrationPtr = foundRegistrationPtr;
-    handlerObjectPtr->safeRef = le_ref_CreateRef(HandlerSafeRefMap, handlerObjectPtr);
 
-    le_dls_Queue(&foundRegistrationPtr->handlerList, &handlerObjectPtr->link);
+    if (holdOffMs > 0)
+    {
+        handlerObjectPtr->holdOffTimer = le_timer_Create("cfgHoldOff");
 
-    return handlerObjectPtr->safeRef;
+        LE_ASSERT_OK(le_timer_SetMsInterval(handlerObjectPtr->holdOffTimer, holdOffMs));
+        LE_ASSERT_OK(le_timer_SetContextPtr(handlerObjectPtr->holdOffTimer, handlerObjectPtr));
+        LE_ASSERT_OK(le_timer_SetHandler(handlerObjectPtr->holdOffTimer, OnHoldOffExpired));
+    }
+
+    handlerObjectPtr->registrationPtr->coalescedCount++;
+    CoalescedHandlerCount++;
+
+    return (le_cfg_CoalescedChangeHandlerRef_t)handlerObjectPtr->safeRef;
 }
 
 
@@ -4338,34 +6973,24 @@ le_cfg_ChangeHandlerRef_t tdb_AddChangeHandler
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Deregisters a handler function that was registered using tdb_AddChangeHandler().
+ *  Deregisters a handler function that was registered using tdb_AddCoalescedChangeHandler().  Any
+ *  changes the handler hasn't been notified of yet are dropped.
  */
 //--------------------------------------------------------------------------------------------------
-void tdb_RemoveChangeHandler
+void tdb_RemoveCoalescedChangeHandler
 (
-    le_cfg_ChangeHandlerRef_t handlerRef,  ///< [IN] Reference returned by tdb_AddChangeHandler().
-    le_msg_SessionRef_t sessionRef         ///< [IN] The session of the user making this request.
+    le_cfg_CoalescedChangeHandlerRef_t handlerRef,  ///< [IN] Reference returned by
+                                                    ///<      tdb_AddCoalescedChangeHandler().
+    le_msg_SessionRef_t sessionRef                  ///< [IN] The session of the user making this
+                                                    ///<      request.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Simply look up the handler object in the safe ref map, then make sure that the object was
-    // found and belongs to the user session.
-    Handler_t* handlerObjectPtr = le_ref_Lookup(HandlerSafeRefMap, handlerRef);
+    Handler_t* handlerObjectPtr = LookupHandler(handlerRef, sessionRef, true);
 
-    if (   (handlerObjectPtr != NULL)
-        && (handlerObjectPtr->sessionRef == sessionRef))
+    if (handlerObjectPtr != NULL)
     {
-        Registration_t* registrationPtr = handlerObjectPtr->registrationPtr;
-
-        // Remove the handler object from the registration object's list.
-        RemoveHandler(registrationPtr, handlerObjectPtr);
-
-        // If there are no more handlers in this registration object, kill the object.
-        if (le_dls_IsEmpty(&registrationPtr->handlerList))
-        {
-            le_hashmap_Remove(HandlerRegistrationMap, registrationPtr->registrationPath);
-            le_mem_Release(registrationPtr);
-        }
+        DeleteHandler(handlerObjectPtr);
     }
 }
 
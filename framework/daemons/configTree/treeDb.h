@@ -45,6 +45,10 @@ typedef struct Tree* tdb_TreeRef_t;
 typedef struct Node* tdb_NodeRef_t;
 
 
+/// Reference to an export of a node that is being written a few nodes at a time.
+typedef struct tdb_Export* tdb_ExportRef_t;
+
+
 /// Forward declaration.  See @ref nodeIterator.h for details.
 typedef struct Iterator* ni_IteratorRef_t;
 
@@ -127,6 +131,41 @@ tdb_TreeRef_t tdb_ShadowTree
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Create a read only snapshot of a tree, as it is now.  Read iterators can be moved onto the
+ *  snapshot before a commit, so that they carry on seeing the tree as it was when their
+ *  transactions started.  Only the nodes that later commits change are copied into the snapshot.
+ *
+ *  The snapshot is freed once the caller, and every iterator registered on it, have released it
+ *  with tdb_ReleaseTree().
+ *
+ *  @return The new snapshot of the tree.
+ */
+// -------------------------------------------------------------------------------------------------
+tdb_TreeRef_t tdb_SnapshotTree
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree to snapshot.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the tree that a shadow tree was created from.
+ *
+ *  @return The original tree, or the tree itself if it isn't a shadow tree.
+ */
+// -------------------------------------------------------------------------------------------------
+tdb_TreeRef_t tdb_GetOriginalTree
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree object to read.
+);
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Called to create a new tree that shadows an existing one.
@@ -276,6 +315,26 @@ bool tdb_ReadTreeNode
 
 
 
+#if LE_CONFIG_CFGTREE_BINARY_FORMAT
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a configuration tree node's contents from a tree image file.
+ *
+ *  @return LE_OK if the read is successful.
+ *          LE_NOT_FOUND if the file isn't a tree image, (it should be read with tdb_ReadTreeNode.)
+ *          LE_FORMAT_ERROR if the image is damaged.
+ *          LE_IO_ERROR if the file couldn't be read.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tdb_ReadTreeImage
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] The node to write the new data to.
+    const char* pathPtr     ///< [IN] Path to the file to read from.
+);
+#endif
+
+
+
 
 // -------------------------------------------------------------------------------------------------
 /**
@@ -293,6 +352,58 @@ le_result_t tdb_WriteTreeNode
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Start exporting a tree node and it's children to a file, in the same format as
+ *  tdb_WriteTreeNode().  The export is written a few nodes at a time by tdb_ContinueExport(), from
+ *  a private copy of the node, so the tree can go on being read and committed to in between.
+ *
+ *  Nodes of a write transaction's shadow tree can't be copied, those are written out straight away.
+ *
+ *  The export takes over the file, which is closed by tdb_EndExport().
+ *
+ *  @return The export, to be finished with tdb_EndExport().
+ */
+// -------------------------------------------------------------------------------------------------
+tdb_ExportRef_t tdb_StartExport
+(
+    tdb_NodeRef_t nodeRef,  ///< [IN] Export the contents of this node.
+    FILE* filePtr           ///< [IN] The file to write to.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write some more of an export.
+ *
+ *  @return LE_OK if the export has been completely written, LE_IN_PROGRESS if there is more to
+ *          write, or LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tdb_ContinueExport
+(
+    tdb_ExportRef_t exportRef,  ///< [IN] The export to continue.
+    size_t maxNodes             ///< [IN] The most nodes to write this time.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Finish with an export, whether or not it has been completely written, and close its file.
+ */
+// -------------------------------------------------------------------------------------------------
+void tdb_EndExport
+(
+    tdb_ExportRef_t exportRef  ///< [IN] The export to free.
+);
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Given a base node and a path, find another node in the tree.
@@ -687,6 +798,48 @@ void tdb_RemoveChangeHandler
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Registers a handler function to be called with the list of changed paths when a node at or
+ *  below a given path changes.  See le_cfg_AddCoalescedChangeHandler().
+ *
+ *  @return A new safe ref backed object, or NULL if the creation failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_cfg_CoalescedChangeHandlerRef_t tdb_AddCoalescedChangeHandler
+(
+    tdb_TreeRef_t treeRef,                           ///< [IN] The tree to register the handler on.
+    le_msg_SessionRef_t sessionRef,                  ///< [IN] The session that the request came in
+                                                     ///<      on.
+    const char* pathPtr,                             ///< [IN] Path of the node to watch.
+    uint32_t holdOffMs,                              ///< [IN] Time to gather changes for before
+                                                     ///<      calling back, 0 to call back at the
+                                                     ///<      end of each commit.
+    le_cfg_CoalescedChangeHandlerFunc_t handlerPtr,  ///< [IN] Function to call back.
+    void* contextPtr                                 ///< [IN] Opaque value to pass to the function
+                                                     ///<      when called.
+);
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Deregisters a handler function that was registered using tdb_AddCoalescedChangeHandler().  Any
+ *  changes the handler hasn't been notified of yet are dropped.
+ */
+//--------------------------------------------------------------------------------------------------
+void tdb_RemoveCoalescedChangeHandler
+(
+    le_cfg_CoalescedChangeHandlerRef_t handlerRef,  ///< [IN] Reference returned by
+                                                    ///<      tdb_AddCoalescedChangeHandler().
+    le_msg_SessionRef_t sessionRef                  ///< [IN] The session of the user making this
+                                                    ///<      request.
+);
+
+
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Clean out any event handlers registered on the given session.
@@ -0,0 +1,958 @@
+// -------------------------------------------------------------------------------------------------
+/**
+ *  @file treeImage.c
+ *
+ *  Implementation of the binary, memory mapped on-disk format for configuration trees.
+ *
+ *  The file layout is:
+ *
+ * @verbatim
+
+    +--------+-------------------------+-------------------------+------------------+
+    | Header | Node Records            | String Table            | String Data      |
+    |        | (recordCount * 16 bytes) | (stringCount * 8 bytes) | (stringDataSize) |
+    +--------+-------------------------+-------------------------+------------------+
+
+@endverbatim
+ *
+ *  All fields are 32-bit unsigned integers in the byte order of the device that wrote the file.
+ *  (The magic number doubles as a byte order check.)  The String Table holds the offset and
+ *  length of each string in the String Data, and each string is followed by a null terminator.
+ *
+ *  The children of a stem always come after the stem in the Node Records, so a damaged file can't
+ *  make a node its own ancestor.  Every record and string index is checked before it is used.
+ *
+ *  Copyright (C) Sierra Wireless Inc.
+ *
+ */
+// -------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "treeImage.h"
+
+#include <sys/mman.h>
+
+
+
+
+/// Identifies a tree image file ("LCTG" when read as bytes on a little-endian device).
+#define IMAGE_MAGIC     0x4754434CU
+
+/// Version of the file layout.
+#define IMAGE_VERSION   1U
+
+/// String index used for "no value".
+#define NO_STRING       UINT32_MAX
+
+/// Initial number of slots in the writer's string intern table.  Must be a power of two.
+#define INITIAL_INTERN_SLOTS 256
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Node types, as stored in the file.  (These are kept separate from le_cfg_nodeType_t so that the
+ * file format doesn't change if that API enumeration does.)
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    RECORD_EMPTY  = 0,  ///< Node without any value.
+    RECORD_STRING = 1,  ///< UTF-8 text string.
+    RECORD_BOOL   = 2,  ///< Boolean value.
+    RECORD_INT    = 3,  ///< Signed integer.
+    RECORD_FLOAT  = 4,  ///< Floating point number.
+    RECORD_STEM   = 5   ///< Node with children.
+}
+RecordType_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File header.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;             ///< IMAGE_MAGIC.
+    uint32_t version;           ///< IMAGE_VERSION.
+    uint32_t fileSize;          ///< Size of the whole file, in bytes.
+    uint32_t recordCount;       ///< Number of node records (at least 1, for the root).
+    uint32_t stringCount;       ///< Number of entries in the string table.
+    uint32_t stringDataSize;    ///< Size of the string data, in bytes.
+}
+Header_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Node record.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t name;      ///< String index of the node's name.
+    uint32_t type;      ///< RecordType_t.
+    uint32_t value;     ///< String index of the value, or for a stem, the first child's record.
+    uint32_t count;     ///< Number of children of a stem; 0 otherwise.
+}
+Record_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * String table entry.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t offset;    ///< Offset of the string in the string data.
+    uint32_t length;    ///< Length of the string, not including the null terminator.
+}
+String_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A mapped tree image.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct Image
+{
+    void* basePtr;              ///< Start of the mapping.
+    size_t size;                ///< Size of the mapping.
+    const Record_t* records;    ///< The node records.
+    uint32_t recordCount;       ///< Number of node records.
+    const String_t* strings;    ///< The string table.
+    uint32_t stringCount;       ///< Number of entries in the string table.
+    const char* stringData;     ///< The string data.
+    uint32_t stringDataSize;    ///< Size of the string data, in bytes.
+}
+Image_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A tree image writer.  The tables are grown with realloc() as the image is built.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct Writer
+{
+    Record_t* records;          ///< The node records.
+    uint32_t recordCount;       ///< Number of node records allocated.
+    uint32_t recordCapacity;    ///< Number of node records that fit in the buffer.
+
+    String_t* strings;          ///< The string table.
+    uint32_t stringCount;       ///< Number of strings interned.
+    uint32_t stringCapacity;    ///< Number of entries that fit in the buffer.
+
+    char* stringData;           ///< The string data.
+    size_t stringDataSize;      ///< Number of bytes of string data.
+    size_t stringDataCapacity;  ///< Number of bytes that fit in the buffer.
+
+    uint32_t* internSlots;      ///< Open addressing hash table of string index + 1 (0 = free).
+    uint32_t internSlotCount;   ///< Number of slots in the table (a power of two).
+}
+Writer_t;
+
+
+
+
+/// Define static pool for tree images.
+LE_MEM_DEFINE_STATIC_POOL(ImagePool, LE_CONFIG_CFGTREE_MAX_TREE_POOL_SIZE, sizeof(Image_t));
+
+/// Pool from which Image objects are allocated.
+static le_mem_PoolRef_t ImagePoolRef = NULL;
+
+/// Define static pool for tree image writers.
+LE_MEM_DEFINE_STATIC_POOL(WriterPool, 1, sizeof(Writer_t));
+
+/// Pool from which Writer objects are allocated.
+static le_mem_PoolRef_t WriterPoolRef = NULL;
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Destructor called when the last reference to an image is released.  Unmaps the file.
+ */
+// -------------------------------------------------------------------------------------------------
+static void ImageDestructor
+(
+    void* objectPtr  ///< [IN] The image being freed.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    Image_t* imagePtr = objectPtr;
+
+    if (munmap(imagePtr->basePtr, imagePtr->size) != 0)
+    {
+        LE_ERROR("Failed to unmap config tree image (%m).");
+    }
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get a node record.
+ *
+ *  @return The record, or NULL if the index is out of range.
+ */
+// -------------------------------------------------------------------------------------------------
+static const Record_t* GetRecord
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t recordIndex        ///< [IN] The record index.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (recordIndex >= imageRef->recordCount)
+    {
+        LE_ERROR("Config tree image record %" PRIu32 " out of range.", recordIndex);
+        return NULL;
+    }
+
+    return &imageRef->records[recordIndex];
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get a string from the string table.
+ *
+ *  @return The string, or NULL if the index is out of range or the string is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+static const char* GetString
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t stringIndex        ///< [IN] The string index.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (stringIndex >= imageRef->stringCount)
+    {
+        LE_ERROR("Config tree image string %" PRIu32 " out of range.", stringIndex);
+        return NULL;
+    }
+
+    const String_t* stringPtr = &imageRef->strings[stringIndex];
+    uint64_t end = (uint64_t)stringPtr->offset + stringPtr->length;
+
+    if (   (end >= imageRef->stringDataSize)
+        || (imageRef->stringData[end] != '\0'))
+    {
+        LE_ERROR("Config tree image string %" PRIu32 " is damaged.", stringIndex);
+        return NULL;
+    }
+
+    return &imageRef->stringData[stringPtr->offset];
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Make sure that there's room for count more items in a writer's growable array.
+ */
+// -------------------------------------------------------------------------------------------------
+static void Reserve
+(
+    void** bufferPtrPtr,    ///< [IN/OUT] The array.
+    size_t* capacityPtr,    ///< [IN/OUT] Number of items that fit in the array.
+    size_t used,            ///< [IN]     Number of items in use.
+    size_t count,           ///< [IN]     Number of items to make room for.
+    size_t itemSize         ///< [IN]     Size of an item.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if ((used + count) <= *capacityPtr)
+    {
+        return;
+    }
+
+    size_t newCapacity = (*capacityPtr == 0) ? 64 : *capacityPtr;
+
+    while (newCapacity < (used + count))
+    {
+        newCapacity *= 2;
+    }
+
+    void* newBufferPtr = realloc(*bufferPtrPtr, newCapacity * itemSize);
+    LE_FATAL_IF(newBufferPtr == NULL, "Out of memory building config tree image.");
+
+    *bufferPtrPtr = newBufferPtr;
+    *capacityPtr = newCapacity;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Insert a string index into the intern table.  The table must have a free slot.
+ */
+// -------------------------------------------------------------------------------------------------
+static void InsertInternSlot
+(
+    Writer_t* writerPtr,    ///< [IN] The writer.
+    uint32_t stringIndex    ///< [IN] The string to insert.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    uint32_t mask = writerPtr->internSlotCount - 1;
+    uint32_t slot = le_hashmap_HashString(
+                        &writerPtr->stringData[writerPtr->strings[stringIndex].offset]) & mask;
+
+    while (writerPtr->internSlots[slot] != 0)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    writerPtr->internSlots[slot] = stringIndex + 1;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the index of a string in a writer's string table, adding the string if it isn't already
+ *  there.
+ *
+ *  @return The string's index.
+ */
+// -------------------------------------------------------------------------------------------------
+static uint32_t InternString
+(
+    Writer_t* writerPtr,    ///< [IN] The writer.
+    const char* stringPtr   ///< [IN] The string.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    uint32_t mask = writerPtr->internSlotCount - 1;
+    uint32_t slot = le_hashmap_HashString(stringPtr) & mask;
+
+    // Look for the string.
+    while (writerPtr->internSlots[slot] != 0)
+    {
+        uint32_t index = writerPtr->internSlots[slot] - 1;
+
+        if (strcmp(&writerPtr->stringData[writerPtr->strings[index].offset], stringPtr) == 0)
+        {
+            return index;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    // It's a new one, so add it to the string data and the string table.
+    size_t length = strlen(stringPtr);
+
+    LE_FATAL_IF((writerPtr->stringDataSize + length + 1) > UINT32_MAX,
+                "Config tree image too large.");
+
+    size_t capacity = writerPtr->stringDataCapacity;
+    Reserve((void**)&writerPtr->stringData, &capacity, writerPtr->stringDataSize, length + 1, 1);
+    writerPtr->stringDataCapacity = capacity;
+
+    capacity = writerPtr->stringCapacity;
+    Reserve((void**)&writerPtr->strings,
+            &capacity,
+            writerPtr->stringCount,
+            1,
+            sizeof(String_t));
+    writerPtr->stringCapacity = capacity;
+
+    uint32_t index = writerPtr->stringCount++;
+
+    writerPtr->strings[index].offset = writerPtr->stringDataSize;
+    writerPtr->strings[index].length = length;
+    memcpy(&writerPtr->stringData[writerPtr->stringDataSize], stringPtr, length + 1);
+    writerPtr->stringDataSize += length + 1;
+
+    // Keep the intern table no more than half full, so that probe sequences stay short.
+    if ((writerPtr->stringCount * 2) > writerPtr->internSlotCount)
+    {
+        uint32_t i;
+
+        writerPtr->internSlotCount *= 2;
+        free(writerPtr->internSlots);
+        writerPtr->internSlots = calloc(writerPtr->internSlotCount, sizeof(uint32_t));
+        LE_FATAL_IF(writerPtr->internSlots == NULL, "Out of memory building config tree image.");
+
+        for (i = 0; i < writerPtr->stringCount; i++)
+        {
+            InsertInternSlot(writerPtr, i);
+        }
+    }
+    else
+    {
+        writerPtr->internSlots[slot] = index + 1;
+    }
+
+    return index;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write data to the output stream.  This function will record any faults to the system log.
+ *
+ *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t WriteFile
+(
+    FILE* filePtr,        ///< [IN] The file being written to.
+    const void* dataPtr,  ///< [IN] The data being written to the file.
+    size_t dataSize       ///< [IN] The amount of data being written.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (dataSize == 0)
+    {
+        return LE_OK;
+    }
+
+    if (fwrite(dataPtr, dataSize, 1, filePtr) != 1)
+    {
+        LE_EMERG("Failed to write to config tree image file.");
+        return LE_IO_ERROR;
+    }
+
+    return LE_OK;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Initialize the tree image subsystem.
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_Init
+(
+    void
+)
+// -------------------------------------------------------------------------------------------------
+{
+    ImagePoolRef = le_mem_InitStaticPool(ImagePool,
+                                         LE_CONFIG_CFGTREE_MAX_TREE_POOL_SIZE,
+                                         sizeof(Image_t));
+    le_mem_SetDestructor(ImagePoolRef, ImageDestructor);
+
+    WriterPoolRef = le_mem_InitStaticPool(WriterPool, 1, sizeof(Writer_t));
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Open a tree image file and map it into memory.
+ *
+ *  @return LE_OK if the image was opened.
+ *          LE_NOT_FOUND if the file isn't a tree image (it may be a tree in the text format).
+ *          LE_FORMAT_ERROR if the file is a tree image, but it is damaged or of an unknown version.
+ *          LE_IO_ERROR if the file can't be read.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t timg_Open
+(
+    const char* pathPtr,            ///< [IN]  Path to the file.
+    timg_ImageRef_t* imageRefPtr    ///< [OUT] The image, on success.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_result_t result = LE_OK;
+    Header_t header;
+    struct stat st;
+
+    int fd = open(pathPtr, O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1)
+    {
+        LE_ERROR("Could not open configuration tree file: %s (%m).", pathPtr);
+        return LE_IO_ERROR;
+    }
+
+    // Read just the header first, so that text files don't get mapped.
+    ssize_t bytesRead = pread(fd, &header, sizeof(header), 0);
+
+    if (bytesRead < 0)
+    {
+        LE_ERROR("Could not read configuration tree file: %s (%m).", pathPtr);
+        result = LE_IO_ERROR;
+        goto cleanup;
+    }
+
+    if (   (bytesRead < sizeof(header))
+        || (header.magic != IMAGE_MAGIC))
+    {
+        result = LE_NOT_FOUND;
+        goto cleanup;
+    }
+
+    if (header.version != IMAGE_VERSION)
+    {
+        LE_ERROR("Configuration tree file %s has unsupported version %" PRIu32 ".",
+                 pathPtr,
+                 header.version);
+        result = LE_FORMAT_ERROR;
+        goto cleanup;
+    }
+
+    uint64_t expectedSize =   sizeof(Header_t)
+                            + ((uint64_t)header.recordCount * sizeof(Record_t))
+                            + ((uint64_t)header.stringCount * sizeof(String_t))
+                            + header.stringDataSize;
+
+    if (   (fstat(fd, &st) != 0)
+        || (st.st_size != header.fileSize)
+        || (expectedSize != header.fileSize)
+        || (header.recordCount == 0))
+    {
+        LE_ERROR("Configuration tree file %s is truncated or damaged.", pathPtr);
+        result = LE_FORMAT_ERROR;
+        goto cleanup;
+    }
+
+    void* basePtr = mmap(NULL, header.fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (basePtr == MAP_FAILED)
+    {
+        LE_ERROR("Could not map configuration tree file: %s (%m).", pathPtr);
+        result = LE_IO_ERROR;
+        goto cleanup;
+    }
+
+    Image_t* imagePtr = le_mem_ForceAlloc(ImagePoolRef);
+
+    imagePtr->basePtr = basePtr;
+    imagePtr->size = header.fileSize;
+    imagePtr->records = (const Record_t*)((const uint8_t*)basePtr + sizeof(Header_t));
+    imagePtr->recordCount = header.recordCount;
+    imagePtr->strings = (const String_t*)(imagePtr->records + header.recordCount);
+    imagePtr->stringCount = header.stringCount;
+    imagePtr->stringData = (const char*)(imagePtr->strings + header.stringCount);
+    imagePtr->stringDataSize = header.stringDataSize;
+
+    *imageRefPtr = imagePtr;
+
+cleanup:
+    // The mapping stays valid after the file is closed.
+    close(fd);
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the type of a node record.  A stem record always has at least one child.
+ *
+ *  @return The node's type, or LE_CFG_TYPE_DOESNT_EXIST if the record is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+le_cfg_nodeType_t timg_GetType
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t recordIndex        ///< [IN] The node's record.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    const Record_t* recordPtr = GetRecord(imageRef, recordIndex);
+
+    if (recordPtr == NULL)
+    {
+        return LE_CFG_TYPE_DOESNT_EXIST;
+    }
+
+    switch (recordPtr->type)
+    {
+        case RECORD_EMPTY:
+            return LE_CFG_TYPE_EMPTY;
+
+        case RECORD_STRING:
+            return LE_CFG_TYPE_STRING;
+
+        case RECORD_BOOL:
+            return LE_CFG_TYPE_BOOL;
+
+        case RECORD_INT:
+            return LE_CFG_TYPE_INT;
+
+        case RECORD_FLOAT:
+            return LE_CFG_TYPE_FLOAT;
+
+        case RECORD_STEM:
+            if (recordPtr->count > 0)
+            {
+                return LE_CFG_TYPE_STEM;
+            }
+            break;
+    }
+
+    LE_ERROR("Config tree image record %" PRIu32 " is damaged.", recordIndex);
+    return LE_CFG_TYPE_DOESNT_EXIST;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the name of a node record.
+ *
+ *  @return The name (which stays valid as long as the image is), or NULL if the record is
+ *          damaged.  The root node's name is empty.
+ */
+// -------------------------------------------------------------------------------------------------
+const char* timg_GetName
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t recordIndex        ///< [IN] The node's record.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    const Record_t* recordPtr = GetRecord(imageRef, recordIndex);
+
+    if (recordPtr == NULL)
+    {
+        return NULL;
+    }
+
+    return GetString(imageRef, recordPtr->name);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the value of a string, bool, int or float node record, in the same string form that the
+ *  Tree DB keeps it in.
+ *
+ *  @return The value (which stays valid as long as the image is), or NULL if the record isn't a
+ *          value or is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+const char* timg_GetValue
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t recordIndex        ///< [IN] The node's record.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    const Record_t* recordPtr = GetRecord(imageRef, recordIndex);
+
+    if (   (recordPtr == NULL)
+        || (recordPtr->type == RECORD_EMPTY)
+        || (recordPtr->type == RECORD_STEM))
+    {
+        return NULL;
+    }
+
+    return GetString(imageRef, recordPtr->value);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the records of the children of a stem node record.
+ *
+ *  @return LE_OK if successful, or LE_FORMAT_ERROR if the record isn't a stem or is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t timg_GetChildren
+(
+    timg_ImageRef_t imageRef,   ///< [IN]  The image.
+    uint32_t recordIndex,       ///< [IN]  The node's record.
+    uint32_t* firstChildPtr,    ///< [OUT] The first child's record.
+    uint32_t* countPtr          ///< [OUT] The number of children.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    const Record_t* recordPtr = GetRecord(imageRef, recordIndex);
+
+    if (   (recordPtr == NULL)
+        || (recordPtr->type != RECORD_STEM)
+        || (recordPtr->count == 0)
+        || (recordPtr->value <= recordIndex)
+        || (((uint64_t)recordPtr->value + recordPtr->count) > imageRef->recordCount))
+    {
+        LE_ERROR("Config tree image record %" PRIu32 " is not a valid stem.", recordIndex);
+        return LE_FORMAT_ERROR;
+    }
+
+    *firstChildPtr = recordPtr->value;
+    *countPtr = recordPtr->count;
+
+    return LE_OK;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Create a writer for a new tree image.  Record 0, the root node, is already allocated.
+ *
+ *  @return The new writer.
+ */
+// -------------------------------------------------------------------------------------------------
+timg_WriterRef_t timg_CreateWriter
+(
+    void
+)
+// -------------------------------------------------------------------------------------------------
+{
+    Writer_t* writerPtr = le_mem_ForceAlloc(WriterPoolRef);
+
+    memset(writerPtr, 0, sizeof(*writerPtr));
+
+    writerPtr->internSlotCount = INITIAL_INTERN_SLOTS;
+    writerPtr->internSlots = calloc(writerPtr->internSlotCount, sizeof(uint32_t));
+    LE_FATAL_IF(writerPtr->internSlots == NULL, "Out of memory building config tree image.");
+
+    // Allocate the root's record.
+    timg_AddRecords(writerPtr, 1);
+    timg_SetLeaf(writerPtr, 0, "", LE_CFG_TYPE_EMPTY, NULL);
+
+    return writerPtr;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Allocate a run of consecutive records, for the children of a stem.
+ *
+ *  @return The index of the first record in the run.
+ */
+// -------------------------------------------------------------------------------------------------
+uint32_t timg_AddRecords
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    uint32_t count               ///< [IN] Number of records to allocate.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_FATAL_IF(((uint64_t)writerRef->recordCount + count) > (UINT32_MAX / sizeof(Record_t)),
+                "Config tree image too large.");
+
+    size_t capacity = writerRef->recordCapacity;
+    Reserve((void**)&writerRef->records,
+            &capacity,
+            writerRef->recordCount,
+            count,
+            sizeof(Record_t));
+    writerRef->recordCapacity = capacity;
+
+    uint32_t firstIndex = writerRef->recordCount;
+
+    memset(&writerRef->records[firstIndex], 0, count * sizeof(Record_t));
+    writerRef->recordCount += count;
+
+    return firstIndex;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fill in the record of an empty, string, bool, int or float node.
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_SetLeaf
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    uint32_t recordIndex,        ///< [IN] The record to fill in.
+    const char* namePtr,         ///< [IN] The node's name ("" for the root).
+    le_cfg_nodeType_t type,      ///< [IN] The node's type.
+    const char* valuePtr         ///< [IN] The node's value, in string form (ignored if empty).
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(recordIndex < writerRef->recordCount);
+
+    Record_t* recordPtr = &writerRef->records[recordIndex];
+
+    switch (type)
+    {
+        case LE_CFG_TYPE_STRING:
+            recordPtr->type = RECORD_STRING;
+            break;
+
+        case LE_CFG_TYPE_BOOL:
+            recordPtr->type = RECORD_BOOL;
+            break;
+
+        case LE_CFG_TYPE_INT:
+            recordPtr->type = RECORD_INT;
+            break;
+
+        case LE_CFG_TYPE_FLOAT:
+            recordPtr->type = RECORD_FLOAT;
+            break;
+
+        default:
+            recordPtr->type = RECORD_EMPTY;
+            break;
+    }
+
+    recordPtr->name = InternString(writerRef, namePtr);
+    recordPtr->count = 0;
+
+    if (   (recordPtr->type == RECORD_EMPTY)
+        || (valuePtr == NULL))
+    {
+        recordPtr->type = RECORD_EMPTY;
+        recordPtr->value = NO_STRING;
+    }
+    else
+    {
+        recordPtr->value = InternString(writerRef, valuePtr);
+    }
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fill in the record of a stem node.  Its children must have been allocated with
+ *  timg_AddRecords().
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_SetStem
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    uint32_t recordIndex,        ///< [IN] The record to fill in.
+    const char* namePtr,         ///< [IN] The node's name ("" for the root).
+    uint32_t firstChild,         ///< [IN] The first child's record.
+    uint32_t count               ///< [IN] The number of children (must not be 0).
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(recordIndex < firstChild);
+    LE_ASSERT(count > 0);
+    LE_ASSERT(((uint64_t)firstChild + count) <= writerRef->recordCount);
+
+    Record_t* recordPtr = &writerRef->records[recordIndex];
+
+    recordPtr->name = InternString(writerRef, namePtr);
+    recordPtr->type = RECORD_STEM;
+    recordPtr->value = firstChild;
+    recordPtr->count = count;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write the image to a file.
+ *
+ *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t timg_Write
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    FILE* filePtr                ///< [IN] The file to write to.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    Header_t header;
+
+    uint64_t fileSize =   sizeof(Header_t)
+                        + ((uint64_t)writerRef->recordCount * sizeof(Record_t))
+                        + ((uint64_t)writerRef->stringCount * sizeof(String_t))
+                        + writerRef->stringDataSize;
+
+    if (fileSize > UINT32_MAX)
+    {
+        LE_EMERG("Config tree image too large (%" PRIu64 " bytes).", fileSize);
+        return LE_IO_ERROR;
+    }
+
+    header.magic = IMAGE_MAGIC;
+    header.version = IMAGE_VERSION;
+    header.fileSize = fileSize;
+    header.recordCount = writerRef->recordCount;
+    header.stringCount = writerRef->stringCount;
+    header.stringDataSize = writerRef->stringDataSize;
+
+    le_result_t result = WriteFile(filePtr, &header, sizeof(header));
+
+    if (result == LE_OK)
+    {
+        result = WriteFile(filePtr,
+                           writerRef->records,
+                           writerRef->recordCount * sizeof(Record_t));
+    }
+
+    if (result == LE_OK)
+    {
+        result = WriteFile(filePtr,
+                           writerRef->strings,
+                           writerRef->stringCount * sizeof(String_t));
+    }
+
+    if (result == LE_OK)
+    {
+        result = WriteFile(filePtr, writerRef->stringData, writerRef->stringDataSize);
+    }
+
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Delete a writer, freeing its memory.
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_DeleteWriter
+(
+    timg_WriterRef_t writerRef  ///< [IN] The writer.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    free(writerRef->records);
+    free(writerRef->strings);
+    free(writerRef->stringData);
+    free(writerRef->internSlots);
+
+    le_mem_Release(writerRef);
+}
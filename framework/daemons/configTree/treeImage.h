@@ -0,0 +1,241 @@
+// -------------------------------------------------------------------------------------------------
+/**
+ *  @file treeImage.h
+ *
+ *  Binary, memory mapped on-disk format for configuration trees ("tree images").
+ *
+ *  A tree image holds a table of node records followed by a table of strings.  Each node record
+ *  refers to its name and value by index into the string table, so every distinct string is
+ *  stored only once no matter how many nodes use it.  The children of a stem node are stored as
+ *  a contiguous run of records, so a stem's record only needs the index of its first child and the
+ *  number of children.  Record 0 is the root node.
+ *
+ *  Images are opened by mapping the file into memory, so opening one doesn't read its contents.
+ *  The Tree DB creates the nodes of a stem only when they are first needed, straight from the
+ *  mapped records (see treeDb.c).
+ *
+ *  Image objects are reference counted with le_mem_AddRef() and le_mem_Release().  The file is
+ *  unmapped when the last reference is released.
+ *
+ *  Images are written with a Writer: records are allocated in runs with timg_AddRecords() and then
+ *  filled in with timg_SetLeaf() or timg_SetStem(), in any order.  timg_Write() then streams the
+ *  whole image out to a file.
+ *
+ *  Copyright (C) Sierra Wireless Inc.
+ *
+ */
+// -------------------------------------------------------------------------------------------------
+
+#ifndef CFG_TREE_IMAGE_INCLUDE_GUARD
+#define CFG_TREE_IMAGE_INCLUDE_GUARD
+
+
+/// Reference to a mapped tree image.
+typedef struct Image* timg_ImageRef_t;
+
+
+/// Reference to a tree image writer.
+typedef struct Writer* timg_WriterRef_t;
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Initialize the tree image subsystem.
+ *
+ *  This function should be called once at start-up before any other tree image functions are
+ *  called.
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_Init
+(
+    void
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Open a tree image file and map it into memory.
+ *
+ *  @return LE_OK if the image was opened.
+ *          LE_NOT_FOUND if the file isn't a tree image (it may be a tree in the text format).
+ *          LE_FORMAT_ERROR if the file is a tree image, but it is damaged or of an unknown version.
+ *          LE_IO_ERROR if the file can't be read.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t timg_Open
+(
+    const char* pathPtr,            ///< [IN]  Path to the file.
+    timg_ImageRef_t* imageRefPtr    ///< [OUT] The image, on success.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the type of a node record.  A stem record always has at least one child.
+ *
+ *  @return The node's type, or LE_CFG_TYPE_DOESNT_EXIST if the record is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+le_cfg_nodeType_t timg_GetType
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t recordIndex        ///< [IN] The node's record.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the name of a node record.
+ *
+ *  @return The name (which stays valid as long as the image is), or NULL if the record is
+ *          damaged.  The root node's name is empty.
+ */
+// -------------------------------------------------------------------------------------------------
+const char* timg_GetName
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t recordIndex        ///< [IN] The node's record.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the value of a string, bool, int or float node record, in the same string form that the
+ *  Tree DB keeps it in.
+ *
+ *  @return The value (which stays valid as long as the image is), or NULL if the record isn't a
+ *          value or is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+const char* timg_GetValue
+(
+    timg_ImageRef_t imageRef,   ///< [IN] The image.
+    uint32_t recordIndex        ///< [IN] The node's record.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the records of the children of a stem node record.  The children's records are
+ *  *firstChildPtr to *firstChildPtr + *countPtr - 1.
+ *
+ *  @return LE_OK if successful, or LE_FORMAT_ERROR if the record isn't a stem or is damaged.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t timg_GetChildren
+(
+    timg_ImageRef_t imageRef,   ///< [IN]  The image.
+    uint32_t recordIndex,       ///< [IN]  The node's record.
+    uint32_t* firstChildPtr,    ///< [OUT] The first child's record.
+    uint32_t* countPtr          ///< [OUT] The number of children.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Create a writer for a new tree image.  Record 0, the root node, is already allocated.
+ *
+ *  @return The new writer.
+ */
+// -------------------------------------------------------------------------------------------------
+timg_WriterRef_t timg_CreateWriter
+(
+    void
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Allocate a run of consecutive records, for the children of a stem.
+ *
+ *  @return The index of the first record in the run.
+ */
+// -------------------------------------------------------------------------------------------------
+uint32_t timg_AddRecords
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    uint32_t count               ///< [IN] Number of records to allocate.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fill in the record of an empty, string, bool, int or float node.
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_SetLeaf
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    uint32_t recordIndex,        ///< [IN] The record to fill in.
+    const char* namePtr,         ///< [IN] The node's name ("" for the root).
+    le_cfg_nodeType_t type,      ///< [IN] The node's type.
+    const char* valuePtr         ///< [IN] The node's value, in string form (ignored if empty).
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fill in the record of a stem node.  Its children must have been allocated with
+ *  timg_AddRecords().
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_SetStem
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    uint32_t recordIndex,        ///< [IN] The record to fill in.
+    const char* namePtr,         ///< [IN] The node's name ("" for the root).
+    uint32_t firstChild,         ///< [IN] The first child's record.
+    uint32_t count               ///< [IN] The number of children (must not be 0).
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Write the image to a file.
+ *
+ *  @return LE_OK if the write succeeded, LE_IO_ERROR if the write failed.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t timg_Write
+(
+    timg_WriterRef_t writerRef,  ///< [IN] The writer.
+    FILE* filePtr                ///< [IN] The file to write to.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Delete a writer, freeing its memory.
+ */
+// -------------------------------------------------------------------------------------------------
+void timg_DeleteWriter
+(
+    timg_WriterRef_t writerRef  ///< [IN] The writer.
+);
+
+
+#endif
@@ -0,0 +1,544 @@
+// -------------------------------------------------------------------------------------------------
+/**
+ *  @file treeJournal.c
+ *
+ *  Implementation of the append-only configuration tree journals.
+ *
+ *  A journal file is a header followed by a sequence of entries:
+ *
+ * @verbatim
+
+    +--------+---------------------------------+---------------------------------+----
+    | Header | Length | CRC32 | Entry data ... | Length | CRC32 | Entry data ... | ...
+    +--------+---------------------------------+---------------------------------+----
+
+@endverbatim
+ *
+ *  The header identifies the tree file that the journal applies to by its inode number, size and
+ *  modification time.  (A tree file is never modified in place, every revision is a new file.)
+ *
+ *  Entries are appended with a single write, and the journal is truncated back if the write fails
+ *  part way through.  A write torn by a power failure fails its CRC check on replay.
+ *
+ *  Copyright (C) Sierra Wireless Inc.
+ *
+ */
+// -------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "treeJournal.h"
+
+#include <sys/uio.h>
+
+
+
+
+/// Identifies a tree journal file ("LCTJ" when read as bytes on a little-endian device).
+#define JOURNAL_MAGIC     0x4A54434CU
+
+/// Version of the journal layout.
+#define JOURNAL_VERSION   1U
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Journal file header.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;           ///< JOURNAL_MAGIC.
+    uint32_t version;         ///< JOURNAL_VERSION.
+    uint64_t baseInode;       ///< Inode number of the tree file the journal applies to.
+    uint64_t baseSize;        ///< Size of that tree file.
+    int64_t baseMtimeSec;     ///< Modification time of that tree file (seconds).
+    int64_t baseMtimeNsec;    ///< Modification time of that tree file (nanoseconds).
+}
+Header_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header written in front of each entry.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t length;  ///< Size of the entry data, in bytes.
+    uint32_t crc;     ///< CRC32 of the entry data.
+}
+EntryHeader_t;
+
+
+
+
+/// The entry under construction.  (The Config Tree is single threaded, so one is enough.)
+static uint8_t* EntryBufferPtr = NULL;
+
+/// Number of bytes in the entry under construction.
+static size_t EntrySize = 0;
+
+/// Number of bytes that fit in EntryBufferPtr.
+static size_t EntryCapacity = 0;
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append bytes to the entry under construction.
+ */
+// -------------------------------------------------------------------------------------------------
+static void PutBytes
+(
+    const void* dataPtr,  ///< [IN] The bytes to append.
+    size_t size           ///< [IN] Number of bytes.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if ((EntrySize + size) > EntryCapacity)
+    {
+        size_t newCapacity = (EntryCapacity == 0) ? 256 : EntryCapacity;
+
+        while (newCapacity < (EntrySize + size))
+        {
+            newCapacity *= 2;
+        }
+
+        uint8_t* newBufferPtr = realloc(EntryBufferPtr, newCapacity);
+        LE_FATAL_IF(newBufferPtr == NULL, "Out of memory building config tree journal entry.");
+
+        EntryBufferPtr = newBufferPtr;
+        EntryCapacity = newCapacity;
+    }
+
+    memcpy(EntryBufferPtr + EntrySize, dataPtr, size);
+    EntrySize += size;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fill in a journal header for a tree file.
+ *
+ *  @return LE_OK if successful, LE_NOT_FOUND if the tree file doesn't exist.
+ */
+// -------------------------------------------------------------------------------------------------
+static le_result_t GetBaseHeader
+(
+    const char* basePathPtr,  ///< [IN]  Path to the tree file.
+    Header_t* headerPtr       ///< [OUT] The header.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    struct stat st;
+
+    if (stat(basePathPtr, &st) != 0)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    memset(headerPtr, 0, sizeof(*headerPtr));
+    headerPtr->magic = JOURNAL_MAGIC;
+    headerPtr->version = JOURNAL_VERSION;
+    headerPtr->baseInode = st.st_ino;
+    headerPtr->baseSize = st.st_size;
+    headerPtr->baseMtimeSec = st.st_mtim.tv_sec;
+    headerPtr->baseMtimeNsec = st.st_mtim.tv_nsec;
+
+    return LE_OK;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append a 32-bit value to the entry under construction.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_PutUint32
+(
+    uint32_t value  ///< [IN] The value to append.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    PutBytes(&value, sizeof(value));
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append a null terminated string to the entry under construction.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_PutString
+(
+    const char* stringPtr  ///< [IN] The string to append.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    PutBytes(stringPtr, strlen(stringPtr) + 1);
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Check whether anything has been put into the entry under construction.
+ *
+ *  @return True if the entry is empty.
+ */
+// -------------------------------------------------------------------------------------------------
+bool tjnl_IsEntryEmpty
+(
+    void
+)
+// -------------------------------------------------------------------------------------------------
+{
+    return EntrySize == 0;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Throw away the entry under construction.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_DiscardEntry
+(
+    void
+)
+// -------------------------------------------------------------------------------------------------
+{
+    EntrySize = 0;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append the entry under construction to a journal, then start a new, empty, entry.  If the
+ *  journal doesn't exist yet, or was written against a different tree file, it is (re)started.
+ *
+ *  @return LE_OK if the entry was appended.
+ *          LE_OVERFLOW if the entry doesn't fit within LE_CONFIG_CFGTREE_JOURNAL_MAX_SIZE.  (The
+ *              tree should be compacted instead.)
+ *          LE_NOT_PERMITTED if the file system is read-only.
+ *          LE_IO_ERROR if the journal couldn't be written.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tjnl_AppendEntry
+(
+    const char* journalPathPtr,  ///< [IN] Path to the journal file.
+    const char* basePathPtr      ///< [IN] Path to the tree file the journal applies to.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_result_t result = LE_OK;
+    Header_t baseHeader;
+    Header_t header;
+    EntryHeader_t entryHeader;
+    struct stat st;
+    int fd = -1;
+
+    if (GetBaseHeader(basePathPtr, &baseHeader) != LE_OK)
+    {
+        LE_ERROR("Config tree file '%s' not found for journal.", basePathPtr);
+        result = LE_IO_ERROR;
+        goto cleanup;
+    }
+
+    fd = open(journalPathPtr, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+    if (fd == -1)
+    {
+        if (errno != EROFS)
+        {
+            LE_ERROR("Failed to open config tree journal '%s' (%m).", journalPathPtr);
+        }
+
+        result = (errno == EROFS) ? LE_NOT_PERMITTED : LE_IO_ERROR;
+        goto cleanup;
+    }
+
+    if (fstat(fd, &st) != 0)
+    {
+        LE_ERROR("Failed to stat config tree journal '%s' (%m).", journalPathPtr);
+        result = LE_IO_ERROR;
+        goto cleanup;
+    }
+
+    off_t endOffset = st.st_size;
+
+    // Start the journal over if it's new, or if it belongs to an older revision of the tree.
+    if (   (endOffset < (off_t)sizeof(header))
+        || (pread(fd, &header, sizeof(header), 0) != sizeof(header))
+        || (memcmp(&header, &baseHeader, sizeof(header)) != 0))
+    {
+        if (   (ftruncate(fd, 0) != 0)
+            || (pwrite(fd, &baseHeader, sizeof(baseHeader), 0) != sizeof(baseHeader)))
+        {
+            LE_ERROR("Failed to start config tree journal '%s' (%m).", journalPathPtr);
+            result = LE_IO_ERROR;
+            goto cleanup;
+        }
+
+        endOffset = sizeof(baseHeader);
+    }
+
+    if (((size_t)endOffset + sizeof(entryHeader) + EntrySize) > LE_CONFIG_CFGTREE_JOURNAL_MAX_SIZE)
+    {
+        result = LE_OVERFLOW;
+        goto cleanup;
+    }
+
+    entryHeader.length = EntrySize;
+    entryHeader.crc = le_crc_Crc32(EntryBufferPtr, EntrySize, LE_CRC_START_CRC32);
+
+    struct iovec iov[2] =
+    {
+        { .iov_base = &entryHeader,   .iov_len = sizeof(entryHeader) },
+        { .iov_base = EntryBufferPtr, .iov_len = EntrySize }
+    };
+
+    if (pwritev(fd, iov, 2, endOffset) != (ssize_t)(sizeof(entryHeader) + EntrySize))
+    {
+        LE_ERROR("Failed to write to config tree journal '%s' (%m).", journalPathPtr);
+
+        // Don't leave part of an entry behind.
+        if (ftruncate(fd, endOffset) != 0)
+        {
+            LE_ERROR("Failed to truncate config tree journal '%s' (%m).", journalPathPtr);
+        }
+
+        result = LE_IO_ERROR;
+    }
+
+cleanup:
+    if ((fd != -1) && (close(fd) != 0))
+    {
+        LE_ERROR("Failed to close config tree journal '%s' (%m).", journalPathPtr);
+        result = LE_IO_ERROR;
+    }
+
+    tjnl_DiscardEntry();
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Replay the entries of a journal, if it applies to the given tree file.  Replay stops at the
+ *  first entry that is torn or damaged.
+ *
+ *  @return LE_OK if the journal was replayed (*countPtr holds the number of entries replayed).
+ *          LE_NOT_FOUND if there is no journal.
+ *          LE_FORMAT_ERROR if the journal is damaged or applies to another tree file.
+ *          LE_IO_ERROR if the journal couldn't be read.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tjnl_Replay
+(
+    const char* journalPathPtr,  ///< [IN]  Path to the journal file.
+    const char* basePathPtr,     ///< [IN]  Path to the tree file the journal should apply to.
+    tjnl_ReplayFunc_t func,      ///< [IN]  Function to call for each entry.
+    void* contextPtr,            ///< [IN]  Passed to func.
+    size_t* countPtr             ///< [OUT] Number of entries replayed.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    le_result_t result = LE_OK;
+    uint8_t* bufferPtr = NULL;
+    Header_t baseHeader;
+    struct stat st;
+
+    *countPtr = 0;
+
+    int fd = open(journalPathPtr, O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1)
+    {
+        if (errno == ENOENT)
+        {
+            return LE_NOT_FOUND;
+        }
+
+        LE_ERROR("Failed to open config tree journal '%s' (%m).", journalPathPtr);
+        return LE_IO_ERROR;
+    }
+
+    if (fstat(fd, &st) != 0)
+    {
+        LE_ERROR("Failed to stat config tree journal '%s' (%m).", journalPathPtr);
+        result = LE_IO_ERROR;
+        goto cleanup;
+    }
+
+    // A journal is never allowed to grow past the maximum size, so anything larger is damaged.
+    if (   (st.st_size < (off_t)sizeof(Header_t))
+        || (st.st_size > LE_CONFIG_CFGTREE_JOURNAL_MAX_SIZE)
+        || (GetBaseHeader(basePathPtr, &baseHeader) != LE_OK))
+    {
+        result = LE_FORMAT_ERROR;
+        goto cleanup;
+    }
+
+    bufferPtr = malloc(st.st_size);
+    LE_FATAL_IF(bufferPtr == NULL, "Out of memory reading config tree journal.");
+
+    if (pread(fd, bufferPtr, st.st_size, 0) != st.st_size)
+    {
+        LE_ERROR("Failed to read config tree journal '%s' (%m).", journalPathPtr);
+        result = LE_IO_ERROR;
+        goto cleanup;
+    }
+
+    if (memcmp(bufferPtr, &baseHeader, sizeof(baseHeader)) != 0)
+    {
+        LE_WARN("Config tree journal '%s' does not apply to '%s', ignoring it.",
+                journalPathPtr,
+                basePathPtr);
+        result = LE_FORMAT_ERROR;
+        goto cleanup;
+    }
+
+    size_t offset = sizeof(Header_t);
+
+    while (offset < (size_t)st.st_size)
+    {
+        EntryHeader_t entryHeader;
+        size_t remaining = st.st_size - offset;
+
+        if (remaining < sizeof(entryHeader))
+        {
+            LE_WARN("Dropping torn entry at end of config tree journal '%s'.", journalPathPtr);
+            break;
+        }
+
+        memcpy(&entryHeader, bufferPtr + offset, sizeof(entryHeader));
+        offset += sizeof(entryHeader);
+        remaining -= sizeof(entryHeader);
+
+        if (   (entryHeader.length > remaining)
+            || (le_crc_Crc32(bufferPtr + offset, entryHeader.length, LE_CRC_START_CRC32)
+                != entryHeader.crc))
+        {
+            LE_WARN("Dropping torn entry at end of config tree journal '%s'.", journalPathPtr);
+            break;
+        }
+
+        tjnl_Entry_t entry = { .dataPtr = bufferPtr + offset, .size = entryHeader.length };
+
+        (*countPtr)++;
+
+        if (func(&entry, contextPtr) == false)
+        {
+            break;
+        }
+
+        offset += entryHeader.length;
+    }
+
+cleanup:
+    free(bufferPtr);
+    close(fd);
+    return result;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a 32-bit value from a journal entry.
+ *
+ *  @return True if successful, false if the entry is too short.
+ */
+// -------------------------------------------------------------------------------------------------
+bool tjnl_GetUint32
+(
+    tjnl_Entry_t* entryPtr,  ///< [IN]  The entry.
+    uint32_t* valuePtr       ///< [OUT] The value read.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (entryPtr->size < sizeof(*valuePtr))
+    {
+        return false;
+    }
+
+    memcpy(valuePtr, entryPtr->dataPtr, sizeof(*valuePtr));
+    entryPtr->dataPtr += sizeof(*valuePtr);
+    entryPtr->size -= sizeof(*valuePtr);
+
+    return true;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a null terminated string from a journal entry.
+ *
+ *  @return True if successful, false if the entry doesn't hold a complete string.
+ */
+// -------------------------------------------------------------------------------------------------
+bool tjnl_GetString
+(
+    tjnl_Entry_t* entryPtr,     ///< [IN]  The entry.
+    const char** stringPtrPtr   ///< [OUT] The string, valid for the rest of the replay.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    const uint8_t* endPtr = memchr(entryPtr->dataPtr, '\0', entryPtr->size);
+
+    if (endPtr == NULL)
+    {
+        return false;
+    }
+
+    size_t length = (endPtr - entryPtr->dataPtr) + 1;
+
+    *stringPtrPtr = (const char*)entryPtr->dataPtr;
+    entryPtr->dataPtr += length;
+    entryPtr->size -= length;
+
+    return true;
+}
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Delete a journal file, if there is one.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_Delete
+(
+    const char* journalPathPtr  ///< [IN] Path to the journal file.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    if (   (unlink(journalPathPtr) != 0)
+        && (errno != ENOENT))
+    {
+        LE_ERROR("Failed to delete config tree journal '%s' (%m).", journalPathPtr);
+    }
+}
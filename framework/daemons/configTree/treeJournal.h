@@ -0,0 +1,202 @@
+// -------------------------------------------------------------------------------------------------
+/**
+ *  @file treeJournal.h
+ *
+ *  Append-only journals of committed changes to configuration trees.
+ *
+ *  Rather than rewriting a whole tree file on every commit, the Tree DB records the changes made by
+ *  each commit as one journal entry, and appends it to the tree's journal file.  The journal is
+ *  folded back into the tree file (compacted) when it grows too large, after a quiet period, and
+ *  whenever the tree is loaded.
+ *
+ *  The journal module only deals with entries as opaque byte strings: it frames each one with its
+ *  length and CRC so that an entry torn by a power failure is detected and dropped on replay, and
+ *  it ties the journal to the tree file it applies to, so a journal left behind by an older
+ *  revision of the tree is never replayed onto a newer one.  The contents of the entries are
+ *  defined by the Tree DB (see treeDb.c).
+ *
+ *  An entry is built up with tjnl_PutUint32() and tjnl_PutString(), then written with
+ *  tjnl_AppendEntry().  Only one entry can be under construction at a time.
+ *
+ *  Copyright (C) Sierra Wireless Inc.
+ *
+ */
+// -------------------------------------------------------------------------------------------------
+
+#ifndef CFG_TREE_JOURNAL_INCLUDE_GUARD
+#define CFG_TREE_JOURNAL_INCLUDE_GUARD
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  An entry read back from a journal.  The tjnl_Get functions consume its contents in order.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const uint8_t* dataPtr;  ///< Next unread byte of the entry.
+    size_t size;             ///< Number of unread bytes left in the entry.
+}
+tjnl_Entry_t;
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Function called for each intact entry found in a journal, oldest first.
+ *
+ *  @return True to carry on with the next entry, false to stop the replay.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef bool (*tjnl_ReplayFunc_t)
+(
+    tjnl_Entry_t* entryPtr,  ///< [IN] The entry.
+    void* contextPtr         ///< [IN] Context given to tjnl_Replay().
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append a 32-bit value to the entry under construction.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_PutUint32
+(
+    uint32_t value  ///< [IN] The value to append.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append a null terminated string to the entry under construction.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_PutString
+(
+    const char* stringPtr  ///< [IN] The string to append.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Check whether anything has been put into the entry under construction.
+ *
+ *  @return True if the entry is empty.
+ */
+// -------------------------------------------------------------------------------------------------
+bool tjnl_IsEntryEmpty
+(
+    void
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Throw away the entry under construction.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_DiscardEntry
+(
+    void
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Append the entry under construction to a journal, then start a new, empty, entry.  If the
+ *  journal doesn't exist yet, or was written against a different tree file, it is (re)started.
+ *
+ *  @return LE_OK if the entry was appended.
+ *          LE_OVERFLOW if the entry doesn't fit within LE_CONFIG_CFGTREE_JOURNAL_MAX_SIZE.  (The
+ *              tree should be compacted instead.)
+ *          LE_NOT_PERMITTED if the file system is read-only.
+ *          LE_IO_ERROR if the journal couldn't be written.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tjnl_AppendEntry
+(
+    const char* journalPathPtr,  ///< [IN] Path to the journal file.
+    const char* basePathPtr      ///< [IN] Path to the tree file the journal applies to.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Replay the entries of a journal, if it applies to the given tree file.  Replay stops at the
+ *  first entry that is torn or damaged.
+ *
+ *  @return LE_OK if the journal was replayed (*countPtr holds the number of entries replayed).
+ *          LE_NOT_FOUND if there is no journal.
+ *          LE_FORMAT_ERROR if the journal is damaged or applies to another tree file.
+ *          LE_IO_ERROR if the journal couldn't be read.
+ */
+// -------------------------------------------------------------------------------------------------
+le_result_t tjnl_Replay
+(
+    const char* journalPathPtr,  ///< [IN]  Path to the journal file.
+    const char* basePathPtr,     ///< [IN]  Path to the tree file the journal should apply to.
+    tjnl_ReplayFunc_t func,      ///< [IN]  Function to call for each entry.
+    void* contextPtr,            ///< [IN]  Passed to func.
+    size_t* countPtr             ///< [OUT] Number of entries replayed.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a 32-bit value from a journal entry.
+ *
+ *  @return True if successful, false if the entry is too short.
+ */
+// -------------------------------------------------------------------------------------------------
+bool tjnl_GetUint32
+(
+    tjnl_Entry_t* entryPtr,  ///< [IN]  The entry.
+    uint32_t* valuePtr       ///< [OUT] The value read.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Read a null terminated string from a journal entry.
+ *
+ *  @return True if successful, false if the entry doesn't hold a complete string.
+ */
+// -------------------------------------------------------------------------------------------------
+bool tjnl_GetString
+(
+    tjnl_Entry_t* entryPtr,     ///< [IN]  The entry.
+    const char** stringPtrPtr   ///< [OUT] The string, valid for the rest of the replay.
+);
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Delete a journal file, if there is one.
+ */
+// -------------------------------------------------------------------------------------------------
+void tjnl_Delete
+(
+    const char* journalPathPtr  ///< [IN] Path to the journal file.
+);
+
+
+#endif
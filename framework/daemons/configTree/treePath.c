@@ -101,3 +101,49 @@ const char* tp_GetPathOnly
 
     return ++posPtr;
 }
+
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Get the next segment of a path, skipping separators.  Nothing is allocated or copied: the
+ *  segment points into the path string.
+ *
+ *  @return True if a segment was found, false if the end of the path was reached.
+ */
+//--------------------------------------------------------------------------------------------------
+bool tp_NextSegment
+(
+    const char** cursorPtrPtr,  ///< [IN/OUT] Where to start looking in the path.  Moved past the
+                                ///<          segment found.
+    tp_Segment_t* segmentPtr    ///< [OUT] The segment found.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const char* startPtr = *cursorPtrPtr;
+
+    while (*startPtr == '/')
+    {
+        startPtr++;
+    }
+
+    if (*startPtr == '\0')
+    {
+        *cursorPtrPtr = startPtr;
+        return false;
+    }
+
+    const char* endPtr = strchr(startPtr, '/');
+
+    if (endPtr == NULL)
+    {
+        endPtr = startPtr + strlen(startPtr);
+    }
+
+    segmentPtr->namePtr = startPtr;
+    segmentPtr->length = endPtr - startPtr;
+    *cursorPtrPtr = endPtr;
+
+    return true;
+}
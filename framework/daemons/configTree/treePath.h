@@ -32,6 +32,21 @@
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  A segment (node name) of a path: a view into the path string, which is not copied.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char* namePtr;  ///< First character of the segment, within the path string.
+    size_t length;        ///< Length of the segment in bytes.  It isn't null terminated.
+}
+tp_Segment_t;
+
+
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Check a path and see if there is a tree name embedded.
@@ -78,4 +93,32 @@ const char* tp_GetPathOnly
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Get the next segment of a path, skipping separators.  Nothing is allocated or copied: the
+ *  segment points into the path string.
+ *
+ *  @code
+ *      const char* cursorPtr = pathPtr;
+ *      tp_Segment_t segment;
+ *
+ *      while (tp_NextSegment(&cursorPtr, &segment))
+ *      {
+ *          ...
+ *      }
+ *  @endcode
+ *
+ *  @return True if a segment was found, false if the end of the path was reached.
+ */
+//--------------------------------------------------------------------------------------------------
+bool tp_NextSegment
+(
+    const char** cursorPtrPtr,  ///< [IN/OUT] Where to start looking in the path.  Moved past the
+                                ///<          segment found.
+    tp_Segment_t* segmentPtr    ///< [OUT] The segment found.
+);
+
+
+
+
 #endif
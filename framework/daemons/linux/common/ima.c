@@ -51,45 +51,183 @@
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Verify a file IMA signature against provided public certificate path
+ * Maximum number of file verifications run at the same time.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_VERIFY_JOBS   8
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A file verification in progress (an evmctl process).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    pid_t pid;                                  ///< PID of the evmctl process.
+    char filePath[LIMIT_MAX_PATH_BYTES];        ///< File being verified.
+    char certPath[LIMIT_MAX_PATH_BYTES];        ///< Certificate it is verified against.
+}
+VerifyJob_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File verifications in progress, oldest first.
+ */
+//--------------------------------------------------------------------------------------------------
+static VerifyJob_t VerifyJobs[MAX_VERIFY_JOBS];
+static size_t VerifyJobCount = 0;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of file verifications to run at the same time: one per online CPU, up to
+ * MAX_VERIFY_JOBS.  0 until it has been worked out.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t VerifyJobLimit = 0;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wait for the oldest file verification in progress to finish.
  *
  * @return
- *      - LE_OK on success
+ *      - LE_OK if the file was verified successfully
  *      - LE_FAULT otherwise
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t VerifyFile
+static le_result_t WaitOldestVerifyJob
+(
+    void
+)
+{
+    VerifyJob_t* jobPtr = &VerifyJobs[0];
+    le_result_t result = LE_OK;
+    int status;
+    pid_t pid;
+
+    do
+    {
+        pid = waitpid(jobPtr->pid, &status, 0);
+    }
+    while ((pid == -1) && (errno == EINTR));
+
+    if ((pid == -1) || !WIFEXITED(status) || (0 != WEXITSTATUS(status)))
+    {
+        LE_ERROR("Failed to verify file '%s' with certificate '%s', exitCode: %d",
+                 jobPtr->filePath, jobPtr->certPath, (pid == -1) ? -1 : WEXITSTATUS(status));
+        result = LE_FAULT;
+    }
+    else
+    {
+        LE_DEBUG("Verified file: '%s' successfully", jobPtr->filePath);
+    }
+
+    VerifyJobCount--;
+    memmove(&VerifyJobs[0], &VerifyJobs[1], VerifyJobCount * sizeof(VerifyJobs[0]));
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start verifying a file IMA signature against provided public certificate path, without waiting
+ * for the result.  If as many verifications as there are CPUs are already in progress, the
+ * oldest is waited for first.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_FAULT if the verification couldn't be started, or an earlier one failed
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t StartVerifyFile
 (
     const char * filePath,
     const char * certPath
 )
 {
-    char cmd[MAX_CMD_BYTES] = "";
+    le_result_t result = LE_OK;
 
-    snprintf(cmd, sizeof(cmd), "%s ima_verify %s -k %s ", EVMCTL_PATH, filePath, certPath);
+    if (VerifyJobLimit == 0)
+    {
+        long cpuCount = sysconf(_SC_NPROCESSORS_ONLN);
 
-    LE_DEBUG("Verify file command: %s", cmd);
+        VerifyJobLimit = (cpuCount < 1) ? 1 :
+                         (cpuCount > MAX_VERIFY_JOBS) ? MAX_VERIFY_JOBS : (size_t)cpuCount;
+    }
+
+    if (VerifyJobCount >= VerifyJobLimit)
+    {
+        result = WaitOldestVerifyJob();
+    }
 
-    int exitCode = system(cmd);
+    VerifyJob_t* jobPtr = &VerifyJobs[VerifyJobCount];
 
-    if (WIFEXITED(exitCode) && (0 == WEXITSTATUS(exitCode)))
+    if (   (LE_OK != le_utf8_Copy(jobPtr->filePath, filePath, sizeof(jobPtr->filePath), NULL))
+        || (LE_OK != le_utf8_Copy(jobPtr->certPath, certPath, sizeof(jobPtr->certPath), NULL)))
     {
-        LE_DEBUG("Verified file: '%s' successfully", filePath);
-        return LE_OK;
+        LE_ERROR("Path '%s' or '%s' is too long.", filePath, certPath);
+        return LE_FAULT;
     }
-    else
+
+    LE_DEBUG("Verify file command: %s ima_verify %s -k %s", EVMCTL_PATH, filePath, certPath);
+
+    pid_t pid = fork();
+
+    if (pid == 0)
     {
-        LE_ERROR("Failed to verify file '%s' with certificate '%s', exitCode: %d",
-                 filePath, certPath, WEXITSTATUS(exitCode));
+        execl(EVMCTL_PATH, EVMCTL_PATH, "ima_verify", filePath, "-k", certPath, (char*)NULL);
+        _exit(127);
+    }
+
+    if (pid == -1)
+    {
+        LE_ERROR("Failed to fork to verify file '%s'. %m.", filePath);
         return LE_FAULT;
     }
+
+    jobPtr->pid = pid;
+    VerifyJobCount++;
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wait for all the file verifications in progress to finish.
+ *
+ * @return
+ *      - LE_OK if all the files were verified successfully
+ *      - LE_FAULT otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WaitVerifyFiles
+(
+    void
+)
+{
+    le_result_t result = LE_OK;
+
+    while (VerifyJobCount > 0)
+    {
+        if (LE_OK != WaitOldestVerifyJob())
+        {
+            result = LE_FAULT;
+        }
+    }
+
+    return result;
 }
 
 
 //--------------------------------------------------------------------------------------------------
 /**
  * Recursively traverse the directory and verify each file IMA signature against provided public
- * certificate path
+ * certificate path.  The files are verified in parallel, one per CPU.
  *
  * @return
  *      - LE_OK on success
@@ -117,8 +255,9 @@ static le_result_t VerifyDir
     }
 
     // Traverse through the directory tree.
+    le_result_t result = LE_OK;
     FTSENT* entPtr;
-    while (NULL != (entPtr = fts_read(ftsPtr)))
+    while ((LE_OK == result) && (NULL != (entPtr = fts_read(ftsPtr))))
     {
         LE_DEBUG("Filename: %s, filePath: %s, rootPath: %s, fts_info: %d", entPtr->fts_name,
                                 entPtr->fts_accpath,
@@ -134,14 +273,7 @@ static le_result_t VerifyDir
             case FTS_F:
                 if (0 != strcmp(entPtr->fts_name, PUB_CERT_NAME ))
                 {
-                    if (LE_OK != VerifyFile(entPtr->fts_accpath, certPath))
-                    {
-                        LE_CRIT("Failed to verify file '%s' with public certificate '%s'",
-                                entPtr->fts_accpath,
-                                certPath);
-                        fts_close(ftsPtr);
-                        return LE_FAULT;
-                    }
+                    result = StartVerifyFile(entPtr->fts_accpath, certPath);
                 }
                 break;
         }
@@ -150,7 +282,17 @@ static le_result_t VerifyDir
 
     fts_close(ftsPtr);
 
-    return LE_OK;
+    if (LE_OK != WaitVerifyFiles())
+    {
+        result = LE_FAULT;
+    }
+
+    if (LE_OK != result)
+    {
+        LE_CRIT("Failed to verify files in '%s' with public certificate '%s'", dirPath, certPath);
+    }
+
+    return result;
 }
 
 
@@ -237,7 +379,54 @@ le_result_t ima_VerifyFile
     const char * certPath
 )
 {
-    return VerifyFile(filePath, certPath);
+    if (LE_OK != StartVerifyFile(filePath, certPath))
+    {
+        WaitVerifyFiles();
+        return LE_FAULT;
+    }
+
+    return WaitVerifyFiles();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start verifying a file IMA signature against provided public certificate path, without waiting
+ * for the result, so that several files can be verified in parallel.  ima_WaitVerifyFiles() must
+ * be called afterwards, even if this fails.
+ *
+ * NOTE: Caller should make sure that ima is enabled before calling this function.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_FAULT if the verification couldn't be started, or an earlier one failed
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t ima_StartVerifyFile
+(
+    const char * filePath,
+    const char * certPath
+)
+{
+    return StartVerifyFile(filePath, certPath);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wait for the verifications started by ima_StartVerifyFile() to finish.
+ *
+ * @return
+ *      - LE_OK if all the files were verified successfully
+ *      - LE_FAULT otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t ima_WaitVerifyFiles
+(
+    void
+)
+{
+    return WaitVerifyFiles();
 }
 
 
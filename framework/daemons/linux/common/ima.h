@@ -84,10 +84,45 @@ le_result_t  ima_VerifyFile
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start verifying a file IMA signature against provided public certificate path, without waiting
+ * for the result, so that several files can be verified in parallel.  ima_WaitVerifyFiles() must
+ * be called afterwards, even if this fails.
+ *
+ * NOTE: Caller should make sure that ima is enabled before calling this function.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_FAULT if the verification couldn't be started, or an earlier one failed
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t ima_StartVerifyFile
+(
+    const char * filePath,
+    const char * certPath
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wait for the verifications started by ima_StartVerifyFile() to finish.
+ *
+ * @return
+ *      - LE_OK if all the files were verified successfully
+ *      - LE_FAULT otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t ima_WaitVerifyFiles
+(
+    void
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Recursively traverse the directory and verify each file IMA signature against provided public
- * certificate path
+ * certificate path.  The files are verified in parallel.
  *
  * NOTE: Caller should make sure that ima is enabled before calling this function.
  *
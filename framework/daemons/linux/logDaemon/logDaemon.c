@@ -21,6 +21,14 @@
  * For more details on how the log daemon and the log control tool communicate see the help file for
  * the log control tool.
  *
+ * If the log store is enabled, the log daemon also keeps the messages that pass through it (the
+ * standard output and standard error of app processes) in a persistent, indexed binary store,
+ * which the log control tool can query by time range and process/component.  See logStore.h.
+ *
+ * A log control tool can also subscribe to those messages as they arrive, with a filter (process,
+ * component, level, keyword and regular expression) that the log daemon evaluates once per message,
+ * so that only matching messages are sent to it.
+ *
  * On startup the log daemon reads a configuration file and populates its list of commands from the
  * file ensuring that registered components will receive the initialized configuration from the
  * file.
@@ -65,12 +73,15 @@
 #include "legato.h"
 
 #include "logDaemon.h"
+#include "logStore.h"
 
 #include "fileDescriptor.h"
 #include "limit.h"
 #include "linux/logPlatform.h"
 #include "log.h"
 
+#include <regex.h>
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Maximum number of processes that we expect to see.  Used to set the hashmap and pool sizes.
@@ -111,22 +122,37 @@ static le_hashmap_Ref_t ProcessNameMapRef;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Hash map of Running Process objects, keyed by IPC session reference.
+ * Flat hash map of Running Process objects, keyed by IPC session reference.
  *
  * Value pointer points to a RunningProcess_t.
  */
 //--------------------------------------------------------------------------------------------------
-static le_hashmap_Ref_t IpcSessionMapRef;
+static le_flatmap_Ref_t IpcSessionMapRef;
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Hash map of Running Process objects, keyed by PID.
+ * Flat hash map of Running Process objects, keyed by PID.
  *
  * Value pointer points to a RunningProcess_t.
  */
 //--------------------------------------------------------------------------------------------------
-static le_hashmap_Ref_t ProcessIdMapRef;
+static le_flatmap_Ref_t ProcessIdMapRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rate limit and sampling settings.  See LOG_RATE_LIMIT_PARAMS_FORMAT.  A sample of 0 means the
+ * setting is unknown (has never been set).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t    rate;       ///< Most messages per second (0 = no limit).
+    uint32_t    burst;      ///< Most messages in a burst (0 = one second's worth).
+    uint32_t    sample;     ///< Keep one message in this many (1 = keep all, 0 = unknown).
+}
+RateLimit_t;
 
 
 //--------------------------------------------------------------------------------------------------
@@ -143,6 +169,7 @@ typedef struct
     le_dls_Link_t       link;                   ///< Link in the Process Name's component name list.
     char name[LIMIT_MAX_COMPONENT_NAME_BYTES];  ///< The component name.
     le_log_Level_t      level;                  ///< The log level setting.
+    RateLimit_t         rateLimit;              ///< The rate limit and sampling setting.
     le_dls_List_t       enabledTracesList;      ///< List of enabled trace keywords.
 }
 ComponentName_t;
@@ -253,6 +280,7 @@ typedef struct
     le_dls_Link_t       link;               ///< Link in the Running Process's log session list.
     char componentName[LIMIT_MAX_COMPONENT_NAME_BYTES];  ///< The component name.
     le_log_Level_t      level;              ///< This session's log level.
+    RateLimit_t         rateLimit;          ///< This session's rate limit and sampling.
     le_dls_List_t       traceList;          ///< List of Trace objects for this log session.
 }
 LogSession_t;
@@ -303,6 +331,14 @@ static le_mem_PoolRef_t TracePoolRef;
                                 - LIMIT_MAX_COMPONENT_NAME_LEN )
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of log messages.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_MSG_SIZE            256
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * File descriptor logging object.
@@ -317,6 +353,8 @@ typedef struct
     int             pid;                                    ///< PID of the process.
     le_log_Level_t  level;                                  ///< Log level.
     le_fdMonitor_Ref_t monitorRef;                          ///< Monitor object.
+    size_t          lineLen;                                ///< Bytes in line.
+    char            line[MAX_MSG_SIZE];                     ///< Line read so far.
 }
 FdLog_t;
 
@@ -331,10 +369,76 @@ static le_mem_PoolRef_t FdLogPoolRef;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Maximum length of log messages.
+ * Most bytes read from an app's stdout/stderr at a time.  The lines read are logged together.
  */
 //--------------------------------------------------------------------------------------------------
-#define MAX_MSG_SIZE            256
+#define FD_LOG_READ_BYTES       8192
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of records sent back for one log store query.  Each is queued as an IPC message
+ * to the log control tool, so this limits how much memory a query can take.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_QUERY_RECORDS       10000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of log control tools that can be streaming log messages at the same time.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_STREAM_SUBSCRIBERS  8
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stream Subscriber object.
+ *
+ * A log control tool that has asked for log messages to be streamed to it as they arrive.  Its
+ * filter is parsed (and its regular expression compiled) once, when it subscribes, and is then
+ * evaluated once for each message.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t       link;                                           ///< In Subscriber List.
+    le_msg_SessionRef_t ipcSessionRef;                                  ///< Log tool IPC session.
+    char                processName[LIMIT_MAX_PROCESS_NAME_BYTES];      ///< Process name, or "*".
+    pid_t               pid;                                            ///< PID, or -1 if by name.
+    char                componentName[LIMIT_MAX_COMPONENT_NAME_BYTES];  ///< Component, or "*".
+    le_log_Level_t      minLevel;                                       ///< Least severe level.
+    char                keyword[LOG_MAX_CMD_PACKET_BYTES];              ///< Text to find, or "".
+    bool                hasRegex;                                       ///< true if regex is used.
+    regex_t             regex;                                          ///< Compiled expression.
+}
+Subscriber_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for Stream Subscriber objects.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(Subscriber, MAX_STREAM_SUBSCRIBERS, sizeof(Subscriber_t));
+static le_mem_PoolRef_t SubscriberPoolRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * List of Stream Subscriber objects.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t SubscriberList = LE_DLS_LIST_INIT;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of Stream Subscriber objects in the Subscriber List.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t SubscriberCount = 0;
 
 
 
@@ -564,6 +668,7 @@ static ComponentName_t* CreateComponentName
     }
 
     objPtr->level = -1;
+    memset(&objPtr->rateLimit, 0, sizeof(objPtr->rateLimit));
     objPtr->enabledTracesList = LE_DLS_LIST_INIT;
 
     objPtr->link = LE_DLS_LINK_INIT;
@@ -684,7 +789,7 @@ static inline RunningProcess_t* FindProcessByPid
 )
 //--------------------------------------------------------------------------------------------------
 {
-    return le_hashmap_Get(ProcessIdMapRef, &pid);
+    return le_flatmap_Get(ProcessIdMapRef, &pid);
 }
 
 
@@ -703,7 +808,7 @@ static inline RunningProcess_t* FindProcessByIpcSession
 )
 //--------------------------------------------------------------------------------------------------
 {
-    return le_hashmap_Get(IpcSessionMapRef, &ipcSessionRef);
+    return le_flatmap_Get(IpcSessionMapRef, &ipcSessionRef);
 }
 
 
@@ -735,8 +840,8 @@ static RunningProcess_t* CreateRunningProcess
     objPtr->ipcSessionRef = ipcSessionRef;
 //    objPtr->sharedMemAddr = NULL;   // TODO: Implement shared memory.
 
-    le_hashmap_Put(ProcessIdMapRef, &objPtr->pid, objPtr);
-    le_hashmap_Put(IpcSessionMapRef, &objPtr->ipcSessionRef, objPtr);
+    le_flatmap_Put(ProcessIdMapRef, &objPtr->pid, objPtr);
+    le_flatmap_Put(IpcSessionMapRef, &objPtr->ipcSessionRef, objPtr);
 
     return objPtr;
 }
@@ -805,6 +910,7 @@ static LogSession_t* CreateLogSession
     }
 
     objPtr->level = -1;     // Indicates unknown state.
+    memset(&objPtr->rateLimit, 0, sizeof(objPtr->rateLimit));
     objPtr->traceList = LE_DLS_LIST_INIT;
     // TODO: implement shared memory.
 
@@ -1100,6 +1206,47 @@ static void SendToLogTool
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a command to one of a client's log sessions.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void SendClientCommand
+(
+    RunningProcess_t* runningProcObjPtr,
+    LogSession_t* logSessionPtr,
+    char commandChar,
+    const char* commandData
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_MessageRef_t msgRef = le_msg_CreateMsg(runningProcObjPtr->ipcSessionRef);
+    char* payloadPtr = le_msg_GetPayloadPtr(msgRef);
+    size_t maxSize = le_msg_GetMaxPayloadSize(msgRef);
+
+    size_t byteCount = snprintf(payloadPtr,
+                                maxSize,
+                                "%c%s/%s",
+                                commandChar,
+                                logSessionPtr->componentName,
+                                commandData);
+
+    if (byteCount >= maxSize)
+    {
+        LE_CRIT("Message too long (%zu bytes) to send to component '%s' in process '%s' (pid %d).",
+                byteCount,
+                logSessionPtr->componentName,
+                runningProcObjPtr->procNameObjPtr->name,
+                runningProcObjPtr->pid);
+        le_msg_ReleaseMsg(msgRef);
+    }
+    else
+    {
+        le_msg_Send(msgRef);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sends a client an update to its log session settings.
@@ -1112,38 +1259,28 @@ static void UpdateClientSessionSettings
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_msg_MessageRef_t msgRef;
-    char* payloadPtr;
-    size_t maxSize;
-    size_t byteCount;
-
     // First send the level update, if it's not -1 (default).
     if (logSessionPtr->level != (le_log_Level_t)-1)
     {
-        msgRef = le_msg_CreateMsg(runningProcObjPtr->ipcSessionRef);
-        payloadPtr = le_msg_GetPayloadPtr(msgRef);
-        maxSize = le_msg_GetMaxPayloadSize(msgRef);
+        SendClientCommand(runningProcObjPtr,
+                          logSessionPtr,
+                          LOG_CMD_SET_LEVEL,
+                          GetLevelString(logSessionPtr->level));
+    }
 
-        byteCount = snprintf(payloadPtr,
-                             maxSize,
-                             "%c%s/%s",
-                             LOG_CMD_SET_LEVEL,
-                             logSessionPtr->componentName,
-                             GetLevelString(logSessionPtr->level));
+    // Then the rate limit, if it has been set.
+    if (logSessionPtr->rateLimit.sample != 0)
+    {
+        char params[64];
 
-        if (byteCount >= maxSize)
-        {
-            LE_CRIT("Message too long (%zu bytes) to send to component '%s' in process '%s' (pid %d).",
-                    byteCount,
-                    logSessionPtr->componentName,
-                    runningProcObjPtr->procNameObjPtr->name,
-                    runningProcObjPtr->pid);
-            le_msg_ReleaseMsg(msgRef);
-        }
-        else
-        {
-            le_msg_Send(msgRef);
-        }
+        snprintf(params,
+                 sizeof(params),
+                 LOG_RATE_LIMIT_PARAMS_FORMAT,
+                 logSessionPtr->rateLimit.rate,
+                 logSessionPtr->rateLimit.burst,
+                 logSessionPtr->rateLimit.sample);
+
+        SendClientCommand(runningProcObjPtr, logSessionPtr, LOG_CMD_SET_RATE_LIMIT, params);
     }
 }
 
@@ -1161,11 +1298,6 @@ static void UpdateClientTraceSetting
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // First send the level update.
-    le_msg_MessageRef_t msgRef = le_msg_CreateMsg(runningProcObjPtr->ipcSessionRef);
-    char* payloadPtr = le_msg_GetPayloadPtr(msgRef);
-    size_t maxSize = le_msg_GetMaxPayloadSize(msgRef);
-
     char commandChar;
 
     if (traceObjPtr->isEnabled)
@@ -1177,26 +1309,7 @@ static void UpdateClientTraceSetting
         commandChar = LOG_CMD_DISABLE_TRACE;
     }
 
-    size_t byteCount = snprintf(payloadPtr,
-                                maxSize,
-                                "%c%s/%s",
-                                commandChar,
-                                logSessionPtr->componentName,
-                                traceObjPtr->name);
-
-    if (byteCount >= maxSize)
-    {
-        LE_CRIT("Message too long (%zu bytes) to send to component '%s' in process '%s' (pid %d).",
-                byteCount,
-                logSessionPtr->componentName,
-                runningProcObjPtr->procNameObjPtr->name,
-                runningProcObjPtr->pid);
-        le_msg_ReleaseMsg(msgRef);
-    }
-    else
-    {
-        le_msg_Send(msgRef);
-    }
+    SendClientCommand(runningProcObjPtr, logSessionPtr, commandChar, traceObjPtr->name);
 }
 
 
@@ -1213,6 +1326,7 @@ static void CopyComponentSettings
 )
 {
     logSessionPtr->level = compNameObjPtr->level;
+    logSessionPtr->rateLimit = compNameObjPtr->rateLimit;
 
     UpdateClientSessionSettings(runningProcObjPtr, logSessionPtr);
 
@@ -1478,8 +1592,8 @@ static void ClientIpcSessionClosed
              runningProcObjPtr->pid);
 
     // Remove the process from the PID and IPC Session hash maps.
-    le_hashmap_Remove(ProcessIdMapRef, &runningProcObjPtr->pid);
-    le_hashmap_Remove(IpcSessionMapRef, &ipcSessionRef);
+    le_flatmap_Remove(ProcessIdMapRef, &runningProcObjPtr->pid);
+    le_flatmap_Remove(IpcSessionMapRef, &ipcSessionRef);
 
     // Delete all the log sessions for this process.
 
@@ -1528,7 +1642,8 @@ static void SetForRunningProcess
 (
     RunningProcess_t* runningProcObjPtr,
     const char* componentName,
-    le_log_Level_t* levelPtr                ///< [IN] Ptr log level, or NULL if not being set.
+    le_log_Level_t* levelPtr,               ///< [IN] Ptr log level, or NULL if not being set.
+    const RateLimit_t* rateLimitPtr         ///< [IN] Ptr rate limit, or NULL if not being set.
 )
 //--------------------------------------------------------------------------------------------------
 {
@@ -1545,6 +1660,10 @@ static void SetForRunningProcess
             {
                 logSessionObjPtr->level = *levelPtr;
             }
+            if (rateLimitPtr != NULL)
+            {
+                logSessionObjPtr->rateLimit = *rateLimitPtr;
+            }
 
             UpdateClientSessionSettings(runningProcObjPtr, logSessionObjPtr);
 
@@ -1562,6 +1681,10 @@ static void SetForRunningProcess
             {
                 logSessionObjPtr->level = *levelPtr;
             }
+            if (rateLimitPtr != NULL)
+            {
+                logSessionObjPtr->rateLimit = *rateLimitPtr;
+            }
 
             UpdateClientSessionSettings(runningProcObjPtr, logSessionObjPtr);
         }
@@ -1579,11 +1702,12 @@ static void SetByPid
     pid_t pid,
     const char* componentName,
     le_log_Level_t* levelPtr,               ///< [IN] Ptr log level, or NULL if not being set.
+    const RateLimit_t* rateLimitPtr,        ///< [IN] Ptr rate limit, or NULL if not being set.
     le_msg_SessionRef_t toolIpcSessionRef   ///< [IN] Reference to log control tool's IPC session.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    RunningProcess_t* runningProcObjPtr = le_hashmap_Get(ProcessIdMapRef, &pid);
+    RunningProcess_t* runningProcObjPtr = le_flatmap_Get(ProcessIdMapRef, &pid);
     if (runningProcObjPtr == NULL)
     {
         char message[128];
@@ -1594,7 +1718,7 @@ static void SetByPid
     }
     else
     {
-        SetForRunningProcess(runningProcObjPtr, componentName, levelPtr);
+        SetForRunningProcess(runningProcObjPtr, componentName, levelPtr, rateLimitPtr);
     }
 }
 
@@ -1608,7 +1732,8 @@ static void SetByPid
 static void SetForAllProcesses
 (
     const char* componentName,
-    le_log_Level_t* levelPtr                ///< [IN] Ptr log level, or NULL if not being set.
+    le_log_Level_t* levelPtr,               ///< [IN] Ptr log level, or NULL if not being set.
+    const RateLimit_t* rateLimitPtr         ///< [IN] Ptr rate limit, or NULL if not being set.
 )
 //--------------------------------------------------------------------------------------------------
 {
@@ -1649,6 +1774,10 @@ static void SetForAllProcesses
                 {
                     compNameObjPtr->level = *levelPtr;
                 }
+                if (rateLimitPtr != NULL)
+                {
+                    compNameObjPtr->rateLimit = *rateLimitPtr;
+                }
 
                 linkPtr = le_dls_PeekNext(&procNameObjPtr->componentNameList, linkPtr);
             }
@@ -1664,6 +1793,10 @@ static void SetForAllProcesses
                 {
                     compNameObjPtr->level = *levelPtr;
                 }
+                if (rateLimitPtr != NULL)
+                {
+                    compNameObjPtr->rateLimit = *rateLimitPtr;
+                }
             }
         }
 
@@ -1673,7 +1806,7 @@ static void SetForAllProcesses
         {
             RunningProcess_t* runningProcObjPtr = CONTAINER_OF(linkPtr, RunningProcess_t, link);
 
-            SetForRunningProcess(runningProcObjPtr, componentName, levelPtr);
+            SetForRunningProcess(runningProcObjPtr, componentName, levelPtr, rateLimitPtr);
 
             linkPtr = le_dls_PeekNext(&procNameObjPtr->runningProcessesList, linkPtr);
         }
@@ -1732,7 +1865,8 @@ static void SetByProcessName
 (
     const char* processName,
     const char* componentName,
-    le_log_Level_t* levelPtr                ///< [IN] Ptr log level, or NULL if not being set.
+    le_log_Level_t* levelPtr,               ///< [IN] Ptr log level, or NULL if not being set.
+    const RateLimit_t* rateLimitPtr         ///< [IN] Ptr rate limit, or NULL if not being set.
 )
 //--------------------------------------------------------------------------------------------------
 {
@@ -1769,6 +1903,10 @@ static void SetByProcessName
             {
                 compNameObjPtr->level = *levelPtr;
             }
+            if (rateLimitPtr != NULL)
+            {
+                compNameObjPtr->rateLimit = *rateLimitPtr;
+            }
 
             linkPtr = le_dls_PeekNext(&procNameObjPtr->componentNameList, linkPtr);
         }
@@ -1787,6 +1925,10 @@ static void SetByProcessName
         {
             compNameObjPtr->level = *levelPtr;
         }
+        if (rateLimitPtr != NULL)
+        {
+            compNameObjPtr->rateLimit = *rateLimitPtr;
+        }
     }
 
     // Now update all the actual running processes that share this process name.
@@ -1795,7 +1937,7 @@ static void SetByProcessName
     {
         RunningProcess_t* runningProcObjPtr = CONTAINER_OF(linkPtr, RunningProcess_t, link);
 
-        SetForRunningProcess(runningProcObjPtr, componentName, levelPtr);
+        SetForRunningProcess(runningProcObjPtr, componentName, levelPtr, rateLimitPtr);
 
         linkPtr = le_dls_PeekNext(&procNameObjPtr->runningProcessesList, linkPtr);
     }
@@ -1812,6 +1954,7 @@ static void ApplySettings
     const char* processName,
     const char* componentName,
     le_log_Level_t* levelPtr,               ///< [IN] Ptr log level, or NULL if not being set.
+    const RateLimit_t* rateLimitPtr,        ///< [IN] Ptr rate limit, or NULL if not being set.
     le_msg_SessionRef_t toolIpcSessionRef   ///< [IN] Reference to log control tool's IPC session.
 
 )
@@ -1821,18 +1964,18 @@ static void ApplySettings
     pid_t pid = StringToPid(processName);
     if (pid > 0)
     {
-        SetByPid(pid, componentName, levelPtr, toolIpcSessionRef);
+        SetByPid(pid, componentName, levelPtr, rateLimitPtr, toolIpcSessionRef);
     }
     // If the process name is "*",
     else if (strcmp(processName, "*") == 0)
     {
         // This setting applies to ALL PROCESSES.
-        SetForAllProcesses(componentName, levelPtr);
+        SetForAllProcesses(componentName, levelPtr, rateLimitPtr);
     }
     else
     {
         // This setting applies to processes sharing a specific name.
-        SetByProcessName(processName, componentName, levelPtr);
+        SetByProcessName(processName, componentName, levelPtr, rateLimitPtr);
     }
 }
 
@@ -1864,7 +2007,7 @@ static void SetLevel
     }
     else
     {
-        ApplySettings(processName, componentName, &level, toolIpcSessionRef);
+        ApplySettings(processName, componentName, &level, NULL, toolIpcSessionRef);
         snprintf(message,
                  sizeof(message),
                  "Set filtering level for '%s/%s' to '%s'.",
@@ -1876,6 +2019,51 @@ static void SetLevel
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the rate limit and sampling for a given process/component.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void SetRateLimit
+(
+    const char* processName,
+    const char* componentName,
+    const char* paramsStr,
+    le_msg_SessionRef_t toolIpcSessionRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char message[256];
+    RateLimit_t rateLimit;
+
+    // Parse the command data payload to get the rate limit setting.
+    if (   (sscanf(paramsStr,
+                   LOG_RATE_LIMIT_PARAMS_FORMAT,
+                   &rateLimit.rate,
+                   &rateLimit.burst,
+                   &rateLimit.sample) != 3)
+        || (rateLimit.sample == 0))
+    {
+        snprintf(message, sizeof(message), "***ERROR: Invalid rate limit '%s'.", paramsStr);
+        LE_WARN("%s", message);
+        SendToLogTool(toolIpcSessionRef, message);
+    }
+    else
+    {
+        ApplySettings(processName, componentName, NULL, &rateLimit, toolIpcSessionRef);
+        snprintf(message,
+                 sizeof(message),
+                 "Set rate limit for '%s/%s' to %u messages/s (burst %u), keeping 1 in %u.",
+                 processName,
+                 componentName,
+                 rateLimit.rate,
+                 rateLimit.burst,
+                 rateLimit.sample);
+        SendToLogTool(toolIpcSessionRef, message);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets (enables or disables) a trace for a specific component name.
@@ -1992,7 +2180,7 @@ static void SetTraceByPid
 )
 //--------------------------------------------------------------------------------------------------
 {
-    RunningProcess_t* runningProcObjPtr = le_hashmap_Get(ProcessIdMapRef, &pid);
+    RunningProcess_t* runningProcObjPtr = le_flatmap_Get(ProcessIdMapRef, &pid);
     if (runningProcObjPtr == NULL)
     {
         char message[128];
@@ -2248,6 +2436,7 @@ static void SendComponentInfoToLogTool
 (
     const char* componentName,
     le_log_Level_t level,
+    const RateLimit_t* rateLimitPtr,
     le_msg_SessionRef_t ipcSessionRef
 )
 //--------------------------------------------------------------------------------------------------
@@ -2255,12 +2444,26 @@ static void SendComponentInfoToLogTool
     le_msg_MessageRef_t msgRef = le_msg_CreateMsg(ipcSessionRef);
 
     char* payloadPtr = le_msg_GetPayloadPtr(msgRef);
+    size_t maxSize = le_msg_GetMaxPayloadSize(msgRef);
 
-    snprintf(payloadPtr,
-             le_msg_GetMaxPayloadSize(msgRef),
-             "      /%s @ %s",
-             componentName,
-             GetLevelString(level));
+    int len = snprintf(payloadPtr,
+                       maxSize,
+                       "      /%s @ %s",
+                       componentName,
+                       GetLevelString(level));
+
+    // Show the rate limit, if there is one.
+    if (   ((rateLimitPtr->rate != 0) || (rateLimitPtr->sample > 1))
+        && (len >= 0)
+        && ((size_t)len < maxSize))
+    {
+        snprintf(payloadPtr + len,
+                 maxSize - len,
+                 " (limit %u/s, burst %u, 1 in %u)",
+                 rateLimitPtr->rate,
+                 rateLimitPtr->burst,
+                 rateLimitPtr->sample);
+    }
 
     le_msg_Send(msgRef);
 }
@@ -2282,6 +2485,7 @@ static void GenerateComponentList
 {
     SendComponentInfoToLogTool(compNameObjPtr->name,
                                compNameObjPtr->level,
+                               &compNameObjPtr->rateLimit,
                                ipcSessionRef);
 
     le_dls_Link_t* linkPtr = le_dls_Peek(&compNameObjPtr->enabledTracesList);
@@ -2311,6 +2515,7 @@ static void GenerateLogSessionList
 {
     SendComponentInfoToLogTool(logSessionObjPtr->componentName,
                                logSessionObjPtr->level,
+                               &logSessionObjPtr->rateLimit,
                                ipcSessionRef);
 
     le_dls_Link_t* linkPtr = le_dls_Peek(&logSessionObjPtr->traceList);
@@ -2375,11 +2580,16 @@ static void GenerateList
 )
 //--------------------------------------------------------------------------------------------------
 {
-    const ProcessName_t* procNameObjPtr;
-    le_hashmap_It_Ref_t iteratorRef = le_hashmap_GetIterator(ProcessNameMapRef);
-    while (le_hashmap_NextNode(iteratorRef) == LE_OK)
+    // Take the process names out of the map in one pass, so the map's iterator isn't tied up
+    // (and the map can't resize) while the list is being sent.
+    size_t procCount = le_hashmap_Size(ProcessNameMapRef);
+    le_hashmap_KeyValue_t procNames[procCount > 0 ? procCount : 1];
+    procCount = le_hashmap_Snapshot(ProcessNameMapRef, procNames, procCount);
+
+    size_t i;
+    for (i = 0; i < procCount; i++)
     {
-        procNameObjPtr = le_hashmap_GetValue(iteratorRef);
+        const ProcessName_t* procNameObjPtr = procNames[i].valuePtr;
 
         SendProcessNameToLogTool(procNameObjPtr, ipcSessionRef);
 
@@ -2524,6 +2734,348 @@ static void ClientMsgReceiveHandler
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Formats a log record as a line of text for a log control tool.  Messages that don't fit in one
+ * packet are truncated.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void FormatRecord
+(
+    const logStore_Record_t*    recordPtr,  ///< [IN] The record.
+    char*                       linePtr,    ///< [OUT] Buffer for the line.
+    size_t                      lineSize    ///< [IN] Size of the buffer.
+)
+{
+    char timeStr[32] = "";
+    struct tm tm;
+    time_t sec = recordPtr->timestamp.tv_sec;
+
+    if (localtime_r(&sec, &tm) != NULL)
+    {
+        strftime(timeStr, sizeof(timeStr), "%b %d %H:%M:%S", &tm);
+    }
+
+    snprintf(linePtr, lineSize, "%s.%06ld : %s | %s[%d]/%s | %.*s",
+             timeStr, (long)recordPtr->timestamp.tv_usec, GetLevelString(recordPtr->level),
+             recordPtr->procNamePtr, (int)recordPtr->pid, recordPtr->compNamePtr,
+             (int)recordPtr->msgLen, recordPtr->msgPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a record found by a query to a log control tool.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void SendRecordToLogTool
+(
+    const logStore_Record_t*    recordPtr,  ///< [IN] The record.
+    void*                       contextPtr  ///< [IN] IPC session of the log control tool.
+)
+{
+    char line[LOG_MAX_CMD_PACKET_BYTES];
+
+    FormatRecord(recordPtr, line, sizeof(line));
+    SendToLogTool(contextPtr, line);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends the stored records that match a query to a log control tool.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void QueryLogStore
+(
+    const char* processNamePtr,     ///< [IN] Process name or PID, or "*" for any.
+    const char* componentNamePtr,   ///< [IN] Component name, or "*" for any.
+    const char* paramsPtr,          ///< [IN] Query parameters (see LOG_QUERY_PARAMS_FORMAT).
+    le_msg_SessionRef_t ipcSessionRef ///< [IN] IPC session of the log control tool.
+)
+{
+    long long fromTime;
+    long long toTime;
+    size_t maxRecords;
+
+    if (!logStore_IsEnabled())
+    {
+        SendToLogTool(ipcSessionRef, "*** The log store is not enabled.");
+        return;
+    }
+
+    if (sscanf(paramsPtr, LOG_QUERY_PARAMS_FORMAT, &fromTime, &toTime, &maxRecords) != 3)
+    {
+        LE_ERROR("Invalid query parameters '%s' from log control tool.", paramsPtr);
+        SendToLogTool(ipcSessionRef, "*** Invalid query.");
+        return;
+    }
+
+    logStore_Query_t query =
+        {
+            .procNamePtr = processNamePtr,
+            .compNamePtr = componentNamePtr,
+            .fromTime = fromTime,
+            .toTime = toTime,
+            .maxRecords = (maxRecords < MAX_QUERY_RECORDS) ? maxRecords : MAX_QUERY_RECORDS
+        };
+
+    logStore_Query(&query, SendRecordToLogTool, ipcSessionRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Subscribes a log control tool to the log messages that match a filter.  The tool's IPC session
+ * is kept open, and matching messages are sent to it until it closes the session.
+ *
+ * @return true if the tool was subscribed, false if the filter was invalid (an error has then been
+ *         sent to the tool).
+ **/
+//--------------------------------------------------------------------------------------------------
+static bool StartStream
+(
+    const char* processNamePtr,     ///< [IN] Process name or PID, or "*" for any.
+    const char* componentNamePtr,   ///< [IN] Component name, or "*" for any.
+    const char* paramsPtr,          ///< [IN] Stream parameters (see LOG_STREAM_PARAMS_SEPARATOR).
+    le_msg_SessionRef_t ipcSessionRef ///< [IN] IPC session of the log control tool.
+)
+{
+    char params[LOG_MAX_CMD_PACKET_BYTES];
+    char message[LOG_MAX_CMD_PACKET_BYTES];
+
+    if (SubscriberCount >= MAX_STREAM_SUBSCRIBERS)
+    {
+        SendToLogTool(ipcSessionRef, "*** Too many log streams are open.");
+        return false;
+    }
+
+    // Split the parameters into the level, keyword and regular expression.
+    LE_ASSERT(le_utf8_Copy(params, paramsPtr, sizeof(params), NULL) == LE_OK);
+
+    char* levelStr = params;
+    char* keywordStr = strchr(levelStr, LOG_STREAM_PARAMS_SEPARATOR);
+    char* regexStr = (keywordStr != NULL) ?
+                         strchr(keywordStr + 1, LOG_STREAM_PARAMS_SEPARATOR) : NULL;
+
+    if (regexStr == NULL)
+    {
+        LE_ERROR("Invalid stream parameters from log control tool.");
+        SendToLogTool(ipcSessionRef, "*** Invalid stream parameters.");
+        return false;
+    }
+    *keywordStr++ = '\0';
+    *regexStr++ = '\0';
+
+    le_log_Level_t minLevel = LE_LOG_DEBUG;
+
+    if (levelStr[0] != '\0')
+    {
+        minLevel = log_StrToSeverityLevel(levelStr);
+        if (minLevel == (le_log_Level_t)-1)
+        {
+            snprintf(message, sizeof(message), "***ERROR: Invalid log level '%s'.", levelStr);
+            SendToLogTool(ipcSessionRef, message);
+            return false;
+        }
+    }
+
+    Subscriber_t* subscriberPtr = le_mem_Alloc(SubscriberPoolRef);
+
+    subscriberPtr->hasRegex = (regexStr[0] != '\0');
+    if (subscriberPtr->hasRegex)
+    {
+        int result = regcomp(&subscriberPtr->regex, regexStr, REG_EXTENDED | REG_NOSUB);
+
+        if (result != 0)
+        {
+            char errorStr[128];
+
+            regerror(result, &subscriberPtr->regex, errorStr, sizeof(errorStr));
+            snprintf(message, sizeof(message),
+                     "***ERROR: Invalid regular expression '%s' (%s).", regexStr, errorStr);
+            SendToLogTool(ipcSessionRef, message);
+
+            le_mem_Release(subscriberPtr);
+            return false;
+        }
+    }
+
+    subscriberPtr->link = LE_DLS_LINK_INIT;
+    subscriberPtr->ipcSessionRef = ipcSessionRef;
+    LE_ASSERT(le_utf8_Copy(subscriberPtr->processName, processNamePtr,
+                           sizeof(subscriberPtr->processName), NULL) == LE_OK);
+    subscriberPtr->pid = (strcmp(processNamePtr, "*") == 0) ? -1 : StringToPid(processNamePtr);
+    LE_ASSERT(le_utf8_Copy(subscriberPtr->componentName, componentNamePtr,
+                           sizeof(subscriberPtr->componentName), NULL) == LE_OK);
+    subscriberPtr->minLevel = minLevel;
+    LE_ASSERT(le_utf8_Copy(subscriberPtr->keyword, keywordStr,
+                           sizeof(subscriberPtr->keyword), NULL) == LE_OK);
+
+    le_dls_Queue(&SubscriberList, &subscriberPtr->link);
+    SubscriberCount++;
+
+    LE_DEBUG("Log tool session %p is streaming '%s/%s'.",
+             ipcSessionRef, processNamePtr, componentNamePtr);
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a log message passes a Stream Subscriber's filter.  The cheap checks are done
+ * first, so the keyword and regular expression are only looked at for messages that pass them.
+ *
+ * @return true if the message should be sent to the subscriber.
+ **/
+//--------------------------------------------------------------------------------------------------
+static bool StreamFilterMatches
+(
+    const Subscriber_t*         subscriberPtr,  ///< [IN] The subscriber.
+    const logStore_Record_t*    recordPtr       ///< [IN] The log message (NUL-terminated).
+)
+{
+    if (recordPtr->level < subscriberPtr->minLevel)
+    {
+        return false;
+    }
+
+    if (subscriberPtr->pid > 0)
+    {
+        if (recordPtr->pid != subscriberPtr->pid)
+        {
+            return false;
+        }
+    }
+    else if (   (strcmp(subscriberPtr->processName, "*") != 0)
+             && (strcmp(subscriberPtr->processName, recordPtr->procNamePtr) != 0))
+    {
+        return false;
+    }
+
+    if (   (strcmp(subscriberPtr->componentName, "*") != 0)
+        && (strcmp(subscriberPtr->componentName, recordPtr->compNamePtr) != 0))
+    {
+        return false;
+    }
+
+    if (   (subscriberPtr->keyword[0] != '\0')
+        && (strstr(recordPtr->msgPtr, subscriberPtr->keyword) == NULL))
+    {
+        return false;
+    }
+
+    if (   subscriberPtr->hasRegex
+        && (regexec(&subscriberPtr->regex, recordPtr->msgPtr, 0, NULL, 0) != 0))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a log message to the Stream Subscribers whose filters it passes.  The message is only
+ * formatted once, for the first of them.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void StreamToSubscribers
+(
+    le_log_Level_t  level,          ///< [IN] Severity level.
+    pid_t           pid,            ///< [IN] PID of the process that logged the message.
+    const char*     procNamePtr,    ///< [IN] Name of the process.
+    const char*     compNamePtr,    ///< [IN] Name of the component.
+    const char*     msgPtr          ///< [IN] The message.
+)
+{
+    if (SubscriberCount == 0)
+    {
+        return;
+    }
+
+    logStore_Record_t record =
+        {
+            .level = level,
+            .pid = pid,
+            .procNamePtr = procNamePtr,
+            .compNamePtr = compNamePtr,
+            .msgPtr = msgPtr,
+            .msgLen = strlen(msgPtr)
+        };
+    char line[LOG_MAX_CMD_PACKET_BYTES];
+    bool isFormatted = false;
+
+    // The tool ends each line itself.
+    while ((record.msgLen > 0) && (msgPtr[record.msgLen - 1] == '\n'))
+    {
+        record.msgLen--;
+    }
+
+    le_dls_Link_t* linkPtr = le_dls_Peek(&SubscriberList);
+
+    while (linkPtr != NULL)
+    {
+        Subscriber_t* subscriberPtr = CONTAINER_OF(linkPtr, Subscriber_t, link);
+
+        if (StreamFilterMatches(subscriberPtr, &record))
+        {
+            if (!isFormatted)
+            {
+                gettimeofday(&record.timestamp, NULL);
+                FormatRecord(&record, line, sizeof(line));
+                isFormatted = true;
+            }
+
+            SendToLogTool(subscriberPtr->ipcSessionRef, line);
+        }
+
+        linkPtr = le_dls_PeekNext(&SubscriberList, linkPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles a log control tool's IPC session closing.  If the tool was streaming log messages, its
+ * subscription is removed.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ControlToolIpcSessionClosed
+(
+    le_msg_SessionRef_t ipcSessionRef,  ///< [IN] The IPC session that closed.
+    void*               contextPtr      ///< Not used.
+)
+{
+    LE_UNUSED(contextPtr);
+
+    le_dls_Link_t* linkPtr = le_dls_Peek(&SubscriberList);
+
+    while (linkPtr != NULL)
+    {
+        Subscriber_t* subscriberPtr = CONTAINER_OF(linkPtr, Subscriber_t, link);
+
+        if (subscriberPtr->ipcSessionRef == ipcSessionRef)
+        {
+            le_dls_Remove(&SubscriberList, linkPtr);
+            SubscriberCount--;
+
+            if (subscriberPtr->hasRegex)
+            {
+                regfree(&subscriberPtr->regex);
+            }
+            le_mem_Release(subscriberPtr);
+
+            return;
+        }
+
+        linkPtr = le_dls_PeekNext(&SubscriberList, linkPtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Process a message received from a connected log control tool.
@@ -2568,6 +3120,12 @@ static void ControlToolMsgReceiveHandler
 
                 break;
 
+            case LOG_CMD_SET_RATE_LIMIT:
+
+                SetRateLimit(processName, componentName, commandDataPtr, ipcSessionRef);
+
+                break;
+
             case LOG_CMD_REG_COMPONENT:
 
                 LE_ERROR("Unexpected command '%c' from log control tool.", command);
@@ -2586,6 +3144,23 @@ static void ControlToolMsgReceiveHandler
 
                 break;
 
+            case LOG_CMD_QUERY:
+
+                QueryLogStore(processName, componentName, commandDataPtr, ipcSessionRef);
+
+                break;
+
+            case LOG_CMD_STREAM:
+
+                // The session stays open for as long as the tool wants the stream.
+                if (StartStream(processName, componentName, commandDataPtr, ipcSessionRef))
+                {
+                    le_msg_ReleaseMsg(msgRef);
+                    return;
+                }
+
+                break;
+
             default:
 
                 LE_ERROR("Unknown command byte '%c' received from log control tool.", command);
@@ -2624,7 +3199,88 @@ static void DeleteFdLog
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Logs message received from the fd.
+ * Logs the line read so far from an fd, if it isn't empty, and starts a new one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogFdLine
+(
+    FdLog_t* fdLogPtr           ///< [IN] Fd log object.
+)
+{
+    if (fdLogPtr->lineLen == 0)
+    {
+        return;
+    }
+
+    fdLogPtr->line[fdLogPtr->lineLen] = '\0';
+    fdLogPtr->lineLen = 0;
+
+    // Log the data.
+    // TODO: Don't log the app name for now so that it matches all the other log formats.  Add
+    //       the app name to all log messages at the same time.
+    log_LogGenericMsg(fdLogPtr->level, fdLogPtr->procName, fdLogPtr->pid, fdLogPtr->line);
+
+    // Keep it in the log store too.  Fd logs have no component, so they are stored under the
+    // app name.
+    logStore_Append(fdLogPtr->level, fdLogPtr->pid, fdLogPtr->procName,
+                    fdLogPtr->appName, fdLogPtr->line);
+
+    // And send it to anyone streaming it.
+    StreamToSubscribers(fdLogPtr->level, fdLogPtr->pid, fdLogPtr->procName,
+                        fdLogPtr->appName, fdLogPtr->line);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Splits data read from an fd into lines and logs each complete line.  A line that is too long
+ * for one message is logged in pieces.  An incomplete line at the end of the data is kept until
+ * the rest of it is read.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogFdData
+(
+    FdLog_t* fdLogPtr,          ///< [IN] Fd log object.
+    const char* dataPtr,        ///< [IN] Data read from the fd.
+    size_t dataLen              ///< [IN] Number of bytes of data.
+)
+{
+    while (dataLen > 0)
+    {
+        const char* newlinePtr = memchr(dataPtr, '\n', dataLen);
+        size_t len = (newlinePtr != NULL) ? (size_t)(newlinePtr - dataPtr) : dataLen;
+        size_t room = sizeof(fdLogPtr->line) - 1 - fdLogPtr->lineLen;
+
+        if (len > room)
+        {
+            len = room;
+            newlinePtr = NULL;
+        }
+
+        memcpy(fdLogPtr->line + fdLogPtr->lineLen, dataPtr, len);
+        fdLogPtr->lineLen += len;
+        dataPtr += len;
+        dataLen -= len;
+
+        if (newlinePtr != NULL)
+        {
+            // Skip the newline.
+            dataPtr++;
+            dataLen--;
+
+            LogFdLine(fdLogPtr);
+        }
+        else if (fdLogPtr->lineLen == sizeof(fdLogPtr->line) - 1)
+        {
+            LogFdLine(fdLogPtr);
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Logs messages received from the fd.
  */
 //--------------------------------------------------------------------------------------------------
 static void LogFdMessages
@@ -2637,14 +3293,15 @@ static void LogFdMessages
 
     if (events & POLLIN)
     {
-        // Read the data from the fd.
-        char msg[MAX_MSG_SIZE] = {'\0'};
+        // Read as much as is available, up to a large buffer's worth, in one call.  The log daemon
+        // is single-threaded, so the buffer can be shared by all fds.
+        static char buffer[FD_LOG_READ_BYTES];
 
-        int c;
+        ssize_t c;
 
         do
         {
-            c = read(fd, msg, sizeof(msg));
+            c = read(fd, buffer, sizeof(buffer));
         }
         while ( (c == -1) && (errno == EINTR) );
 
@@ -2653,13 +3310,12 @@ static void LogFdMessages
             LE_ERROR("Could not read fd log message for app/process '%s/%s[%d]'.  %m.",
                      fdLogPtr->appName, fdLogPtr->procName, fdLogPtr->pid);
 
+            LogFdLine(fdLogPtr);
             DeleteFdLog(fd, fdLogPtr);
+            return;
         }
 
-        // Log the data.
-        // TODO: Don't log the app name for now so that it matches all the other log formats.  Add
-        //       the app name to all log messages at the same time.
-        log_LogGenericMsg(fdLogPtr->level, fdLogPtr->procName, fdLogPtr->pid, msg);
+        LogFdData(fdLogPtr, buffer, c);
     }
 
     if ( (events & POLLRDHUP) || (events & POLLERR) || (events & POLLHUP) )
@@ -2667,6 +3323,8 @@ static void LogFdMessages
         LE_DEBUG("Error on app/proc '%s/%s' log fd, events=%d.  Cannot log from this fd.",
                 fdLogPtr->appName, fdLogPtr->procName, events);
 
+        // Log whatever was left without a newline.
+        LogFdLine(fdLogPtr);
         DeleteFdLog(fd, fdLogPtr);
     }
 }
@@ -2702,6 +3360,7 @@ static void CreateFdLogMonitor
 
     fdLogPtr->level = logLevel;
     fdLogPtr->pid = pid;
+    fdLogPtr->lineLen = 0;
 
     // Create the fd monitor.
     fdLogPtr->monitorRef = le_fdMonitor_Create(monitorNamePtr, fd, LogFdMessages, 0);
@@ -2804,6 +3463,8 @@ COMPONENT_INIT
     LogSessionPoolRef = le_mem_CreatePool("LogSession", sizeof(LogSession_t));
     TracePoolRef = le_mem_CreatePool("Traces", sizeof(Trace_t));
     FdLogPoolRef = le_mem_CreatePool("FdLogs", sizeof(FdLog_t));
+    SubscriberPoolRef = le_mem_InitStaticPool(Subscriber, MAX_STREAM_SUBSCRIBERS,
+                                              sizeof(Subscriber_t));
 
     // Tune the pools' initial sizes to reduce warnings in the log at start-up.
     // TODO: Make this configurable.
@@ -2820,15 +3481,21 @@ COMPONENT_INIT
                                           MAX_EXPECTED_PROCESSES,
                                           le_hashmap_HashString,
                                           le_hashmap_EqualsString);
-    IpcSessionMapRef  = le_hashmap_Create("IPCSession",
+    le_hashmap_EnableResize(ProcessNameMapRef, 75);
+    IpcSessionMapRef  = le_flatmap_Create("IPCSession",
                                           MAX_EXPECTED_PROCESSES,
                                           IpcSessionHash,
                                           IpcSessionEquals);
-    ProcessIdMapRef   = le_hashmap_Create("ProcessID",
+    ProcessIdMapRef   = le_flatmap_Create("ProcessID",
                                           MAX_EXPECTED_PROCESSES,
                                           ProcessIdHash,
                                           ProcessIdEquals);
 
+    // These maps are looked up for every log message, so use flat maps.  Like the process name
+    // map, let them grow if there are more processes than expected.
+    le_flatmap_SetGrowable(IpcSessionMapRef, true);
+    le_flatmap_SetGrowable(ProcessIdMapRef, true);
+
     // Get a reference to the Log Control Protocol identification.
     le_msg_ProtocolRef_t protocolRef = le_msg_GetProtocolRef(LOG_CONTROL_PROTOCOL_ID,
                                                              LOG_MAX_CMD_PACKET_BYTES);
@@ -2842,8 +3509,12 @@ COMPONENT_INIT
     // Create and advertise the log control service (the one the control tool uses).
     serviceRef = le_msg_CreateService(protocolRef, LOG_CONTROL_SERVICE_NAME);
     le_msg_SetServiceRecvHandler(serviceRef, ControlToolMsgReceiveHandler, NULL);
+    le_msg_AddServiceCloseHandler(serviceRef, ControlToolIpcSessionClosed, NULL);
     le_msg_AdvertiseService(serviceRef);
 
+    // Open the persistent log store (if it is enabled).
+    logStore_Init();
+
     // Close the fd that we inherited from the Supervisor.  This will let the Supervisor know that
     // we are initialized.  Then re-open it to /dev/null so that it cannot be reused later.
     FILE* filePtr;
@@ -86,6 +86,7 @@
 #define LOG_CMD_SET_LEVEL               'l' // CommandData = level string (see below)
 #define LOG_CMD_ENABLE_TRACE            'e' // CommandData = keyword string
 #define LOG_CMD_DISABLE_TRACE           'd' // CommandData = keyword string
+#define LOG_CMD_SET_RATE_LIMIT          'm' // CommandData = "rate,burst,sample" (see below)
 
 
 //--------------------------------------------------------------------------------------------------
@@ -103,6 +104,36 @@
 //--------------------------------------------------------------------------------------------------
 #define LOG_CMD_LIST_COMPONENTS         'c' // No ProcessName, ComponentName, or CommandData
 #define LOG_CMD_FORGET_PROCESS          'x' // No ComponentName or CommandData
+#define LOG_CMD_QUERY                   'q' // CommandData = "from,to,max" (see below)
+#define LOG_CMD_STREAM                  's' // CommandData = "level\nkeyword\nregex" (see below)
+
+
+// ====================================================
+//  QUERY PARAMETERS (CommandData part of QUERY commands)
+// ====================================================
+
+// Times are in seconds since the Epoch; max is the most records to send back.
+#define LOG_QUERY_PARAMS_FORMAT "%lld,%lld,%zu"
+
+
+// ======================================================
+//  STREAM PARAMETERS (CommandData part of STREAM commands)
+// ======================================================
+
+// The least severe level to send (a level string, or empty for all levels), a keyword that
+// messages must contain and a POSIX extended regular expression that they must match (either may
+// be empty), separated by this character.  The log control tool stays connected, and the Log
+// Control Daemon sends it matching messages until it disconnects.
+#define LOG_STREAM_PARAMS_SEPARATOR '\n'
+
+
+// ==============================================================
+//  RATE LIMIT PARAMETERS (CommandData part of SET_RATE_LIMIT commands)
+// ==============================================================
+
+// Rate is the most messages per second (0 = no limit), burst is the most messages in a burst
+// (0 = one second's worth) and sample keeps one message in that many (1 = keep all).
+#define LOG_RATE_LIMIT_PARAMS_FORMAT "%u,%u,%u"
 
 
 // =========================================================================
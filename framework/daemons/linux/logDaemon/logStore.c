@@ -0,0 +1,856 @@
+/** @file logStore.c
+ *
+ * The Log Control Daemon's persistent log store.  See logStore.h for an overview.
+ *
+ * Segment files are named "seg-<sequence number>.lgs".  Each starts with a SegmentHeader_t,
+ * followed by records packed one after another, each an 8-byte aligned RecordHeader_t followed by
+ * the message text.  A record is written completely before the header's write offset is moved
+ * past it, so a segment that was being written when the device lost power is still readable up to
+ * its last complete record.
+ *
+ * Queries assume that the wall clock doesn't go backwards while records are being stored; if it
+ * does, some records around the jump may be missed by time range queries.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+#include "limit.h"
+#include "logStore.h"
+
+#include <dirent.h>
+#include <sys/mman.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store parameters.  These come from the KConfig options, but can be set on the command line, so
+ * that the store can be built and tested on its own.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef LOG_STORE_ENABLED
+#define LOG_STORE_ENABLED       LE_CONFIG_LOG_STORE
+#endif
+
+#if LOG_STORE_ENABLED
+
+#ifndef LOG_STORE_DIR
+#define LOG_STORE_DIR           LE_CONFIG_LOG_STORE_DIR
+#endif
+
+#ifndef LOG_STORE_SEGMENT_KB
+#define LOG_STORE_SEGMENT_KB    LE_CONFIG_LOG_STORE_SEGMENT_KB
+#endif
+
+#ifndef LOG_STORE_MAX_SEGMENTS
+#define LOG_STORE_MAX_SEGMENTS  LE_CONFIG_LOG_STORE_MAX_SEGMENTS
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value of the magic field in a segment header.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SEGMENT_MAGIC           0x5347474c  // "LGGS"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Version of the segment format.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SEGMENT_VERSION         1
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of each segment file, in bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SEGMENT_BYTES           ((size_t)LOG_STORE_SEGMENT_KB * 1024)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of different process/component names in one segment.  When a segment's name
+ * table is full, a new segment is started.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_NAMES               64
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of entries in each segment's time index.  An entry is added for the first record stored
+ * in each 1/TIME_INDEX_ENTRIES of the segment.
+ */
+//--------------------------------------------------------------------------------------------------
+#define TIME_INDEX_ENTRIES      256
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a stored message.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_MSG_LEN             255
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Format of the segment file names.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SEGMENT_NAME_FORMAT     "seg-%08" PRIu32 ".lgs"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A process/component name pair.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char procName[LIMIT_MAX_PROCESS_NAME_BYTES];    ///< Process name.
+    char compName[LIMIT_MAX_COMPONENT_NAME_BYTES];  ///< Component name.
+}
+NameEntry_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * An entry in a segment's time index.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int64_t         sec;            ///< Time of the record.
+    uint32_t        offset;         ///< Offset of the record from the start of the segment.
+    uint32_t        reserved;       ///< Padding.
+}
+TimeIndexEntry_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of every segment.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t            magic;              ///< SEGMENT_MAGIC.
+    uint32_t            version;            ///< SEGMENT_VERSION.
+    uint32_t            seq;                ///< Sequence number of the segment.
+    uint32_t            size;               ///< Size of the segment file, in bytes.
+    uint32_t            writeOffset;        ///< Offset just past the last complete record.
+    uint32_t            recordCount;        ///< Number of records in the segment.
+    uint32_t            nameCount;          ///< Number of entries used in names[].
+    uint32_t            timeIndexCount;     ///< Number of entries used in timeIndex[].
+    int64_t             firstSec;           ///< Time of the first record.
+    int64_t             lastSec;            ///< Time of the last record.
+    NameEntry_t         names[MAX_NAMES];   ///< Names used by the records in this segment.
+    TimeIndexEntry_t    timeIndex[TIME_INDEX_ENTRIES];  ///< Sparse time index.
+}
+SegmentHeader_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Offset of the first record in a segment.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DATA_OFFSET             ((sizeof(SegmentHeader_t) + 7) & ~(size_t)7)
+
+static_assert(DATA_OFFSET < SEGMENT_BYTES / 2, "Log store segments are too small");
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header of each record.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint16_t        size;           ///< Size of the record, including this header and padding.
+    uint16_t        msgLen;         ///< Length of the message text that follows.
+    uint8_t         level;          ///< le_log_Level_t.
+    uint8_t         nameIndex;      ///< Index of the record's names in the segment's names[].
+    uint16_t        reserved;       ///< Padding.
+    int32_t         pid;            ///< PID of the process.
+    uint32_t        usec;           ///< Microseconds part of the time.
+    int64_t         sec;            ///< Seconds part of the time.
+}
+RecordHeader_t;
+
+static_assert((sizeof(RecordHeader_t) % 8) == 0, "Log store record header must be 8-byte aligned");
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The segment currently being appended to, or NULL if the store isn't open.
+ */
+//--------------------------------------------------------------------------------------------------
+static SegmentHeader_t* CurrentPtr = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sequence number of the oldest segment that may still exist.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t OldestSeq;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Builds the path of a segment file.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetSegmentPath
+(
+    uint32_t    seq,        ///< [IN] Sequence number of the segment.
+    char*       pathPtr,    ///< [OUT] Buffer for the path.
+    size_t      pathSize    ///< [IN] Size of the buffer.
+)
+{
+    char name[32];
+
+    snprintf(name, sizeof(name), SEGMENT_NAME_FORMAT, seq);
+    LE_ASSERT(snprintf(pathPtr, pathSize, "%s/%s", LOG_STORE_DIR, name) <
+              (int)pathSize);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks that a segment's header is consistent, so it can be read safely.
+ *
+ * @return true if the segment is usable.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSegmentValid
+(
+    const SegmentHeader_t*  segPtr,     ///< [IN] The mapped segment.
+    uint32_t                seq,        ///< [IN] Sequence number it should have.
+    size_t                  fileSize    ///< [IN] Size of the file.
+)
+{
+    return (segPtr->magic == SEGMENT_MAGIC) &&
+           (segPtr->version == SEGMENT_VERSION) &&
+           (segPtr->seq == seq) &&
+           (segPtr->size == fileSize) &&
+           (segPtr->writeOffset >= DATA_OFFSET) &&
+           (segPtr->writeOffset <= segPtr->size) &&
+           (segPtr->nameCount <= MAX_NAMES) &&
+           (segPtr->timeIndexCount <= TIME_INDEX_ENTRIES);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps a segment file.
+ *
+ * @return Pointer to the mapped segment, or NULL if it doesn't exist or isn't valid.
+ */
+//--------------------------------------------------------------------------------------------------
+static SegmentHeader_t* MapSegment
+(
+    uint32_t    seq,        ///< [IN] Sequence number of the segment.
+    bool        writable    ///< [IN] true to map it for appending.
+)
+{
+    char path[PATH_MAX];
+    struct stat st;
+
+    GetSegmentPath(seq, path, sizeof(path));
+
+    int fd = open(path, writable ? O_RDWR | O_CLOEXEC : O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < DATA_OFFSET))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    void* addr = mmap(NULL, st.st_size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map log store segment '%s'. %m.", path);
+        return NULL;
+    }
+
+    if (!IsSegmentValid(addr, seq, st.st_size))
+    {
+        LE_WARN("Ignoring invalid log store segment '%s'.", path);
+        munmap(addr, st.st_size);
+        return NULL;
+    }
+
+    return addr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unmaps a segment.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UnmapSegment
+(
+    SegmentHeader_t* segPtr     ///< [IN] The mapped segment.
+)
+{
+    munmap(segPtr, segPtr->size);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a new, empty segment file and maps it for appending.
+ *
+ * @return Pointer to the mapped segment, or NULL on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static SegmentHeader_t* CreateSegment
+(
+    uint32_t    seq         ///< [IN] Sequence number of the segment.
+)
+{
+    char path[PATH_MAX];
+
+    GetSegmentPath(seq, path, sizeof(path));
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP);
+    if (fd < 0)
+    {
+        LE_ERROR("Failed to create log store segment '%s'. %m.", path);
+        return NULL;
+    }
+
+    if (ftruncate(fd, SEGMENT_BYTES) != 0)
+    {
+        LE_ERROR("Failed to size log store segment '%s'. %m.", path);
+        close(fd);
+        unlink(path);
+        return NULL;
+    }
+
+    SegmentHeader_t* segPtr = mmap(NULL, SEGMENT_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (segPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map log store segment '%s'. %m.", path);
+        unlink(path);
+        return NULL;
+    }
+
+    // The file is all zeros, so only the non-zero fields need to be set.  The magic number goes
+    // last, so that a half-initialized segment isn't taken for a valid one.
+    segPtr->version = SEGMENT_VERSION;
+    segPtr->seq = seq;
+    segPtr->size = SEGMENT_BYTES;
+    segPtr->writeOffset = DATA_OFFSET;
+    __atomic_store_n(&segPtr->magic, SEGMENT_MAGIC, __ATOMIC_RELEASE);
+
+    return segPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deletes a segment file.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeleteSegment
+(
+    uint32_t    seq         ///< [IN] Sequence number of the segment.
+)
+{
+    char path[PATH_MAX];
+
+    GetSegmentPath(seq, path, sizeof(path));
+
+    if ((unlink(path) != 0) && (errno != ENOENT))
+    {
+        LE_WARN("Failed to delete log store segment '%s'. %m.", path);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finishes the current segment and starts the next one, deleting the oldest if there are too
+ * many.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartNextSegment
+(
+    void
+)
+{
+    uint32_t seq = CurrentPtr->seq + 1;
+
+    msync(CurrentPtr, CurrentPtr->size, MS_ASYNC);
+    UnmapSegment(CurrentPtr);
+
+    while (seq - OldestSeq >= LOG_STORE_MAX_SEGMENTS)
+    {
+        DeleteSegment(OldestSeq);
+        OldestSeq++;
+    }
+
+    CurrentPtr = CreateSegment(seq);
+    if (CurrentPtr == NULL)
+    {
+        LE_ERROR("Log store disabled.");
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the index of a process/component name pair in the current segment's name table, adding it
+ * if needed.
+ *
+ * @return The index, or -1 if the table is full.
+ */
+//--------------------------------------------------------------------------------------------------
+static int GetNameIndex
+(
+    const char*     procNamePtr,    ///< [IN] Process name.
+    const char*     compNamePtr     ///< [IN] Component name.
+)
+{
+    uint32_t i;
+
+    for (i = 0; i < CurrentPtr->nameCount; i++)
+    {
+        if ((strcmp(CurrentPtr->names[i].procName, procNamePtr) == 0) &&
+            (strcmp(CurrentPtr->names[i].compName, compNamePtr) == 0))
+        {
+            return i;
+        }
+    }
+
+    if (i >= MAX_NAMES)
+    {
+        return -1;
+    }
+
+    le_utf8_Copy(CurrentPtr->names[i].procName, procNamePtr,
+                 sizeof(CurrentPtr->names[i].procName), NULL);
+    le_utf8_Copy(CurrentPtr->names[i].compName, compNamePtr,
+                 sizeof(CurrentPtr->names[i].compName), NULL);
+    CurrentPtr->nameCount = i + 1;
+
+    return i;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a string is a PID.
+ *
+ * @return The PID, or -1 if the string isn't a number.
+ */
+//--------------------------------------------------------------------------------------------------
+static pid_t ParsePid
+(
+    const char* str     ///< [IN] The string.
+)
+{
+    char* endPtr;
+
+    errno = 0;
+    long pid = strtol(str, &endPtr, 10);
+
+    if ((str[0] == '\0') || (*endPtr != '\0') || (errno != 0) || (pid <= 0) || (pid > INT32_MAX))
+    {
+        return -1;
+    }
+
+    return (pid_t)pid;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the records in a segment that match a query.
+ *
+ * @return The number of matching records found.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t QuerySegment
+(
+    const SegmentHeader_t*  segPtr,     ///< [IN] The mapped segment.
+    const logStore_Query_t* queryPtr,   ///< [IN] What to look for.
+    pid_t                   pid,        ///< [IN] PID to match, or -1 to match by process name.
+    size_t                  maxRecords, ///< [IN] Stop after this many matches.
+    logStore_RecordFunc_t   func,       ///< [IN] Function to call for each matching record.
+    void*                   contextPtr  ///< [IN] Passed to func.
+)
+{
+    bool nameMatches[MAX_NAMES];
+    bool anyNameMatches = false;
+    uint32_t i;
+    size_t count = 0;
+
+    // Skip the segment if it's outside the time range.
+    if ((segPtr->recordCount == 0) ||
+        (segPtr->lastSec < queryPtr->fromTime) ||
+        (segPtr->firstSec > queryPtr->toTime))
+    {
+        return 0;
+    }
+
+    // Skip it if none of the records are for the requested process/component.
+    for (i = 0; i < segPtr->nameCount; i++)
+    {
+        const NameEntry_t* namePtr = &segPtr->names[i];
+
+        nameMatches[i] = ((pid >= 0) ||
+                          (strcmp(queryPtr->procNamePtr, "*") == 0) ||
+                          (strncmp(queryPtr->procNamePtr, namePtr->procName,
+                                   sizeof(namePtr->procName)) == 0)) &&
+                         ((strcmp(queryPtr->compNamePtr, "*") == 0) ||
+                          (strncmp(queryPtr->compNamePtr, namePtr->compName,
+                                   sizeof(namePtr->compName)) == 0));
+        anyNameMatches = anyNameMatches || nameMatches[i];
+    }
+    if (!anyNameMatches)
+    {
+        return 0;
+    }
+
+    // Use the time index to find where to start: the last indexed record before the start of the
+    // time range.
+    size_t offset = DATA_OFFSET;
+    size_t lo = 0;
+    size_t hi = segPtr->timeIndexCount;
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+
+        if (segPtr->timeIndex[mid].sec < queryPtr->fromTime)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if (lo > 0)
+    {
+        offset = segPtr->timeIndex[lo - 1].offset;
+    }
+
+    size_t endOffset = segPtr->writeOffset;
+    const uint8_t* basePtr = (const uint8_t*)segPtr;
+
+    while ((offset + sizeof(RecordHeader_t) <= endOffset) && (count < maxRecords))
+    {
+        const RecordHeader_t* recPtr = (const RecordHeader_t*)(basePtr + offset);
+
+        if ((recPtr->size < sizeof(RecordHeader_t)) ||
+            (offset + recPtr->size > endOffset) ||
+            (recPtr->msgLen > recPtr->size - sizeof(RecordHeader_t)) ||
+            (recPtr->nameIndex >= segPtr->nameCount))
+        {
+            LE_WARN("Corrupt record at offset %zu in log store segment %" PRIu32 ".",
+                    offset, segPtr->seq);
+            break;
+        }
+
+        if (recPtr->sec > queryPtr->toTime)
+        {
+            break;
+        }
+
+        if ((recPtr->sec >= queryPtr->fromTime) &&
+            nameMatches[recPtr->nameIndex] &&
+            ((pid < 0) || (recPtr->pid == pid)))
+        {
+            const NameEntry_t* namePtr = &segPtr->names[recPtr->nameIndex];
+            logStore_Record_t record =
+                {
+                    .timestamp = { .tv_sec = recPtr->sec, .tv_usec = recPtr->usec },
+                    .level = recPtr->level,
+                    .pid = recPtr->pid,
+                    .procNamePtr = namePtr->procName,
+                    .compNamePtr = namePtr->compName,
+                    .msgPtr = (const char*)(recPtr + 1),
+                    .msgLen = recPtr->msgLen
+                };
+
+            func(&record, contextPtr);
+            count++;
+        }
+
+        offset += recPtr->size;
+    }
+
+    return count;
+}
+
+#endif /* end LOG_STORE_ENABLED */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes the log store, opening the newest segment in the store directory for appending (or
+ * starting a new one).  If the store can't be opened, an error is logged and nothing is stored.
+ */
+//--------------------------------------------------------------------------------------------------
+void logStore_Init
+(
+    void
+)
+{
+#if LOG_STORE_ENABLED
+    if (le_dir_MakePath(LOG_STORE_DIR, S_IRWXU | S_IRGRP | S_IXGRP) == LE_FAULT)
+    {
+        LE_ERROR("Failed to create log store directory '%s'. Log store disabled.",
+                 LOG_STORE_DIR);
+        return;
+    }
+
+    // Find the range of segments that exist.
+    DIR* dirPtr = opendir(LOG_STORE_DIR);
+    if (dirPtr == NULL)
+    {
+        LE_ERROR("Failed to open log store directory '%s'. %m. Log store disabled.",
+                 LOG_STORE_DIR);
+        return;
+    }
+
+    bool found = false;
+    uint32_t oldestSeq = 0;
+    uint32_t newestSeq = 0;
+    struct dirent* entryPtr;
+
+    while ((entryPtr = readdir(dirPtr)) != NULL)
+    {
+        uint32_t seq;
+        char check;
+
+        if (sscanf(entryPtr->d_name, "seg-%" SCNu32 ".lg%c", &seq, &check) == 2 && check == 's')
+        {
+            if (!found || (seq < oldestSeq))
+            {
+                oldestSeq = seq;
+            }
+            if (!found || (seq > newestSeq))
+            {
+                newestSeq = seq;
+            }
+            found = true;
+        }
+    }
+    closedir(dirPtr);
+
+    if (found)
+    {
+        OldestSeq = oldestSeq;
+        CurrentPtr = MapSegment(newestSeq, true);
+
+        if (CurrentPtr == NULL)
+        {
+            // Leave the unusable segment for inspection and start after it.
+            uint32_t seq = newestSeq + 1;
+
+            while (seq - OldestSeq >= LOG_STORE_MAX_SEGMENTS)
+            {
+                DeleteSegment(OldestSeq);
+                OldestSeq++;
+            }
+            CurrentPtr = CreateSegment(seq);
+        }
+    }
+    else
+    {
+        OldestSeq = 0;
+        CurrentPtr = CreateSegment(0);
+    }
+
+    if (CurrentPtr == NULL)
+    {
+        LE_ERROR("Log store disabled.");
+        return;
+    }
+
+    LE_INFO("Log store opened in '%s' (segments %" PRIu32 " to %" PRIu32 ").",
+            LOG_STORE_DIR, OldestSeq, CurrentPtr->seq);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the log store is enabled and open.
+ *
+ * @return true if records are being stored.
+ */
+//--------------------------------------------------------------------------------------------------
+bool logStore_IsEnabled
+(
+    void
+)
+{
+#if LOG_STORE_ENABLED
+    return (CurrentPtr != NULL);
+#else
+    return false;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Appends a message to the store.
+ */
+//--------------------------------------------------------------------------------------------------
+void logStore_Append
+(
+    le_log_Level_t  level,          ///< [IN] Severity level.
+    pid_t           pid,            ///< [IN] PID of the process that logged the message.
+    const char*     procNamePtr,    ///< [IN] Name of the process.
+    const char*     compNamePtr,    ///< [IN] Name of the component.
+    const char*     msgPtr          ///< [IN] The message.
+)
+{
+#if LOG_STORE_ENABLED
+    if (CurrentPtr == NULL)
+    {
+        return;
+    }
+
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    size_t msgLen = strnlen(msgPtr, MAX_MSG_LEN);
+
+    // Stdout/stderr lines usually end with a newline, which isn't worth storing.
+    while ((msgLen > 0) && (msgPtr[msgLen - 1] == '\n'))
+    {
+        msgLen--;
+    }
+
+    size_t size = (sizeof(RecordHeader_t) + msgLen + 7) & ~(size_t)7;
+
+    int nameIndex = GetNameIndex(procNamePtr, compNamePtr);
+
+    if ((nameIndex < 0) || (CurrentPtr->writeOffset + size > CurrentPtr->size))
+    {
+        StartNextSegment();
+        if (CurrentPtr == NULL)
+        {
+            return;
+        }
+        nameIndex = GetNameIndex(procNamePtr, compNamePtr);
+    }
+
+    uint32_t offset = CurrentPtr->writeOffset;
+    RecordHeader_t* recPtr = (RecordHeader_t*)((uint8_t*)CurrentPtr + offset);
+
+    recPtr->size = size;
+    recPtr->msgLen = msgLen;
+    recPtr->level = level;
+    recPtr->nameIndex = nameIndex;
+    recPtr->reserved = 0;
+    recPtr->pid = pid;
+    recPtr->sec = now.tv_sec;
+    recPtr->usec = now.tv_usec;
+    memcpy(recPtr + 1, msgPtr, msgLen);
+
+    // Update the indexes.
+    if (CurrentPtr->recordCount == 0)
+    {
+        CurrentPtr->firstSec = now.tv_sec;
+    }
+    CurrentPtr->lastSec = now.tv_sec;
+
+    size_t indexStride = (CurrentPtr->size - DATA_OFFSET) / TIME_INDEX_ENTRIES;
+    uint32_t indexCount = CurrentPtr->timeIndexCount;
+    if ((indexCount < TIME_INDEX_ENTRIES) && (offset >= DATA_OFFSET + indexCount * indexStride))
+    {
+        CurrentPtr->timeIndex[indexCount].sec = now.tv_sec;
+        CurrentPtr->timeIndex[indexCount].offset = offset;
+        CurrentPtr->timeIndexCount = indexCount + 1;
+    }
+
+    CurrentPtr->recordCount++;
+
+    // Commit the record.
+    __atomic_store_n(&CurrentPtr->writeOffset, offset + size, __ATOMIC_RELEASE);
+#else
+    LE_UNUSED(level);
+    LE_UNUSED(pid);
+    LE_UNUSED(procNamePtr);
+    LE_UNUSED(compNamePtr);
+    LE_UNUSED(msgPtr);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the stored records that match a query, oldest first.
+ *
+ * @return The number of matching records found.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t logStore_Query
+(
+    const logStore_Query_t* queryPtr,   ///< [IN] What to look for.
+    logStore_RecordFunc_t   func,       ///< [IN] Function to call for each matching record.
+    void*                   contextPtr  ///< [IN] Passed to func.
+)
+{
+#if LOG_STORE_ENABLED
+    size_t count = 0;
+    uint32_t seq;
+
+    if (CurrentPtr == NULL)
+    {
+        return 0;
+    }
+
+    pid_t pid = ParsePid(queryPtr->procNamePtr);
+
+    for (seq = OldestSeq; (seq != CurrentPtr->seq + 1) && (count < queryPtr->maxRecords); seq++)
+    {
+        if (seq == CurrentPtr->seq)
+        {
+            count += QuerySegment(CurrentPtr, queryPtr, pid, queryPtr->maxRecords - count,
+                                  func, contextPtr);
+        }
+        else
+        {
+            SegmentHeader_t* segPtr = MapSegment(seq, false);
+
+            if (segPtr != NULL)
+            {
+                count += QuerySegment(segPtr, queryPtr, pid, queryPtr->maxRecords - count,
+                                      func, contextPtr);
+                UnmapSegment(segPtr);
+            }
+        }
+    }
+
+    return count;
+#else
+    LE_UNUSED(queryPtr);
+    LE_UNUSED(func);
+    LE_UNUSED(contextPtr);
+    return 0;
+#endif
+}
@@ -0,0 +1,115 @@
+/** @file logStore.h
+ *
+ * Interface of the Log Control Daemon's persistent log store.
+ *
+ * The store is a directory of fixed-size segment files, used as a ring: records are appended to
+ * the newest segment, a new segment is started when it is full, and the oldest segment is deleted
+ * when there are more than LE_CONFIG_LOG_STORE_MAX_SEGMENTS.  Segments are memory mapped, so
+ * appending a record is a copy into the page cache.
+ *
+ * Each segment's header holds a table of the process/component names that appear in it (records
+ * refer to their names by index into this table) and a sparse time index.  A query can therefore
+ * skip segments that don't overlap its time range or that don't contain its process/component,
+ * and seek within a segment to the first record near the start of its time range.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LOG_STORE_INCLUDE_GUARD
+#define LOG_STORE_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A record read back from the store.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    struct timeval      timestamp;      ///< When the message was stored.
+    le_log_Level_t      level;          ///< Severity level.
+    pid_t               pid;            ///< PID of the process that logged the message.
+    const char*         procNamePtr;    ///< Name of the process that logged the message.
+    const char*         compNamePtr;    ///< Name of the component (app name for stdout/stderr).
+    const char*         msgPtr;         ///< The message (not NUL-terminated).
+    size_t              msgLen;         ///< Length of the message, in bytes.
+}
+logStore_Record_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * What to look for in a query.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char*         procNamePtr;    ///< Process name or PID to match, or "*" for any.
+    const char*         compNamePtr;    ///< Component name to match, or "*" for any.
+    int64_t             fromTime;       ///< Earliest time to match (seconds since the Epoch).
+    int64_t             toTime;         ///< Latest time to match (seconds since the Epoch).
+    size_t              maxRecords;     ///< Stop after this many matches.
+}
+logStore_Query_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function called for each record that matches a query.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*logStore_RecordFunc_t)
+(
+    const logStore_Record_t*    recordPtr,  ///< [IN] The record.
+    void*                       contextPtr  ///< [IN] Context passed to logStore_Query().
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes the log store, opening the newest segment in the store directory for appending (or
+ * starting a new one).  If the store can't be opened, an error is logged and nothing is stored.
+ */
+//--------------------------------------------------------------------------------------------------
+void logStore_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the log store is enabled and open.
+ *
+ * @return true if records are being stored.
+ */
+//--------------------------------------------------------------------------------------------------
+bool logStore_IsEnabled
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Appends a message to the store.
+ */
+//--------------------------------------------------------------------------------------------------
+void logStore_Append
+(
+    le_log_Level_t  level,          ///< [IN] Severity level.
+    pid_t           pid,            ///< [IN] PID of the process that logged the message.
+    const char*     procNamePtr,    ///< [IN] Name of the process.
+    const char*     compNamePtr,    ///< [IN] Name of the component.
+    const char*     msgPtr          ///< [IN] The message.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the stored records that match a query, oldest first.
+ *
+ * @return The number of matching records found.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t logStore_Query
+(
+    const logStore_Query_t* queryPtr,   ///< [IN] What to look for.
+    logStore_RecordFunc_t   func,       ///< [IN] Function to call for each matching record.
+    void*                   contextPtr  ///< [IN] Passed to func.
+);
+
+#endif // LOG_STORE_INCLUDE_GUARD
@@ -98,6 +98,19 @@ User List ------> User --+---> Name               |        |        |
  * Each Binding object and Connection object holds a reference count on a User object.  A User
  * object will be deleted when all associated Binding objects and Connection objects are deleted.
  *
+ * So that connecting clients and advertising servers don't have to be matched up by walking these
+ * lists, the objects are also indexed by hash maps:
+ *  - the User Map finds a User object from its user ID,
+ *  - the Binding Map finds a Binding object from its client User and client-side interface name,
+ *  - the Service Map finds a Server Connection on a User's Service List from its User and
+ *    service name, and
+ *  - the Service Bindings Map finds, from a server User and service name, the list of all the
+ *    Binding objects that refer to that service.  The list is kept in a Service Bindings object,
+ *    which is deleted when its last Binding is.
+ *
+ * The lists remain the authoritative record (and are what the sdir tool's listings walk); the maps
+ * are updated wherever objects are added to or removed from the lists.
+ *
  *
  * @section sd_theoryOfOperation Theory of Operation
  *
@@ -166,6 +179,14 @@ User List ------> User --+---> Name               |        |        |
  *    ready to talk to service clients and servers), the Service Directory closes fd 0 and reopens
  *    it to "/dev/null".
  *
+ * To let the other framework daemons start while the Service Directory is still initializing,
+ * the Supervisor's child process creates the Service Directory's two sockets, and starts them
+ * listening, before execing it.  It passes them on as fds 3 and 4 (see
+ * @ref c_unixSocketsInheriting) and writes a byte to the pipe to tell the Supervisor that they
+ * exist.  From then on, connections to the Service Directory are queued by the kernel until it
+ * gets to them, so the Supervisor can start the other framework daemons without waiting for the
+ * pipe to be closed.
+ *
  * @section sd_DesignNotes          Design Notes
  *
  * @subsection sd_DesignNotesConfig     Binding Configuration
@@ -202,6 +223,7 @@ User List ------> User --+---> Name               |        |        |
 #include "legato.h"
 #include "serviceDirectoryProtocol.h"
 #include "sdirToolProtocol.h"
+#include "bootProfile.h"
 #include "unixSocket.h"
 #include "fileDescriptor.h"
 #include "limit.h"
@@ -250,6 +272,27 @@ static le_mem_PoolRef_t UserPoolRef;
 static le_dls_List_t UserList = LE_DLS_LIST_INIT;
 
 
+//--------------------------------------------------------------------------------------------------
+/// The User Map, which indexes the User List by user ID.
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t UserMapRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key under which Binding and Server Connection objects are indexed: an interface name belonging
+ * to a particular user.  Keys are stored inside the objects they index, and the name they
+ * point to belongs to the same object.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const User_t*   userPtr;        ///< Ptr to the User object.
+    const char*     interfaceName;  ///< Interface name.
+}
+InterfaceKey_t;
+
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -265,6 +308,7 @@ typedef struct
     User_t*                     userPtr;        ///< Pointer to the User object for the client uid.
     pid_t                       pid;            ///< Process ID of client process.
     svcdir_InterfaceDetails_t   interface;      ///< IPC interface details.
+    InterfaceKey_t              key;            ///< Key in the Service Map.
 }
 ServerConnection_t;
 
@@ -275,6 +319,39 @@ ServerConnection_t;
 static le_mem_PoolRef_t ServerConnectionPoolRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/// The Service Map, which indexes the Server Connections on all Users' Service Lists.
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t ServiceMapRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Keeps track of all the bindings to a particular service.  Objects of this type are allocated
+ * from the Service Bindings Pool and are indexed by the Service Bindings Map.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    InterfaceKey_t  key;                ///< Key in the Service Bindings Map.
+    char            serviceName[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES]; ///< Service name.
+    le_dls_List_t   bindingList;        ///< List of Bindings to the service.
+}
+ServiceBindings_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Pool from which Service Bindings objects are allocated.
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ServiceBindingsPoolRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/// The Service Bindings Map, in which all Service Bindings objects are kept.
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t ServiceBindingsMapRef;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Represents a binding from a user's client interface to a service.  Objects of this type are
@@ -290,6 +367,9 @@ typedef struct
     char                serverInterfaceName[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES];///< Service name
     ServerConnection_t* serverConnectionPtr;///< Ptr to Server Connection (NULL if service unavail.)
     le_dls_List_t       waitingClientsList; ///< List of Client Connections waiting for the service.
+    InterfaceKey_t      key;                ///< Key in the Binding Map.
+    le_dls_Link_t       serviceLink;        ///< Used to link into the Service Bindings' list.
+    ServiceBindings_t*  serviceBindingsPtr; ///< Ptr to the Service Bindings whose list I'm in.
 }
 Binding_t;
 
@@ -300,6 +380,12 @@ Binding_t;
 static le_mem_PoolRef_t BindingPoolRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/// The Binding Map, which indexes the Bindings on all Users' Binding Lists.
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t BindingMapRef;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Enumeration of the different states that a client connection can be in.
@@ -370,6 +456,48 @@ static le_fdMonitor_Ref_t ServerSocketMonitorRef;
 // =======================================
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hash function for the keys of the Binding, Service and Service Bindings Maps.
+ *
+ * @return The hash value.
+ **/
+//--------------------------------------------------------------------------------------------------
+static size_t HashInterfaceKey
+(
+    const void* keyPtr  ///< [in] Ptr to the InterfaceKey_t to hash.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const InterfaceKey_t* interfaceKeyPtr = keyPtr;
+
+    return (le_hashmap_HashString(interfaceKeyPtr->interfaceName) * 31)
+           + interfaceKeyPtr->userPtr->uid;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Equality function for the keys of the Binding, Service and Service Bindings Maps.
+ *
+ * @return true if the keys refer to the same interface name of the same user.
+ **/
+//--------------------------------------------------------------------------------------------------
+static bool EqualsInterfaceKey
+(
+    const void* firstKeyPtr,    ///< [in] Ptr to the first InterfaceKey_t.
+    const void* secondKeyPtr    ///< [in] Ptr to the second InterfaceKey_t.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const InterfaceKey_t* firstPtr = firstKeyPtr;
+    const InterfaceKey_t* secondPtr = secondKeyPtr;
+
+    return (   (firstPtr->userPtr == secondPtr->userPtr)
+            && (strcmp(firstPtr->interfaceName, secondPtr->interfaceName) == 0) );
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates a User object for a given Unix user ID.
@@ -399,8 +527,9 @@ static User_t* CreateUser
     userPtr->serviceList = LE_DLS_LIST_INIT;
     userPtr->unboundClientsList = LE_DLS_LIST_INIT;
 
-    // Add it to the User List.
+    // Add it to the User List and the User Map.
     le_dls_Queue(&UserList, &userPtr->link);
+    le_hashmap_Put(UserMapRef, &userPtr->uid, userPtr);
 
     return userPtr;
 }
@@ -408,7 +537,7 @@ static User_t* CreateUser
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Searches the User List for a particular Unix user ID.  If found, increments the reference count
+ * Looks up a particular Unix user ID in the User Map.  If found, increments the reference count
  * on that object.  If not found, creates a new User object.
  *
  * @return Pointer to the User object.
@@ -420,19 +549,12 @@ static User_t* GetUser
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_dls_Link_t* linkPtr = le_dls_Peek(&UserList);
+    User_t* userPtr = le_hashmap_Get(UserMapRef, &uid);
 
-    while (linkPtr != NULL)
+    if (userPtr != NULL)
     {
-        User_t* userPtr = CONTAINER_OF(linkPtr, User_t, link);
-
-        if (userPtr->uid == uid)
-        {
-            le_mem_AddRef(userPtr);
-            return userPtr;
-        }
-
-        linkPtr = le_dls_PeekNext(&UserList, linkPtr);
+        le_mem_AddRef(userPtr);
+        return userPtr;
     }
 
     return CreateUser(uid);
@@ -453,14 +575,15 @@ static void UserDestructor
 {
     User_t* userPtr = objPtr;
 
-    // Remove the User object from the User List.
+    // Remove the User object from the User List and the User Map.
     le_dls_Remove(&UserList, &userPtr->link);
+    le_hashmap_Remove(UserMapRef, &userPtr->uid);
 }
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Searches a (client) User's Binding List for a particular client-side interface name.
+ * Looks up a (client) User's binding for a particular client-side interface name.
  *
  * @return Pointer to the Binding object or NULL if not found.
  **/
@@ -472,21 +595,9 @@ static Binding_t* FindBinding
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_dls_Link_t* linkPtr = le_dls_Peek(&userPtr->bindingList);
-
-    while (linkPtr != NULL)
-    {
-        Binding_t* bindingPtr = CONTAINER_OF(linkPtr, Binding_t, link);
-
-        if (strcmp(bindingPtr->clientInterfaceName, interfaceName) == 0)
-        {
-            return bindingPtr;
-        }
+    InterfaceKey_t key = { .userPtr = userPtr, .interfaceName = interfaceName };
 
-        linkPtr = le_dls_PeekNext(&userPtr->bindingList, linkPtr);
-    }
-
-    return NULL;
+    return le_hashmap_Get(BindingMapRef, &key);
 }
 
 
@@ -597,7 +708,7 @@ static le_result_t ReceiveMessage
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Searches a User's Service List for a particular service name.
+ * Looks up the Server Connection on a User's Service List for a particular service name.
  *
  * @return Pointer to the Server Connection object for the matching service.
  **/
@@ -609,21 +720,9 @@ static ServerConnection_t* FindService
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_dls_Link_t* linkPtr = le_dls_Peek(&userPtr->serviceList);
+    InterfaceKey_t key = { .userPtr = userPtr, .interfaceName = serviceName };
 
-    while (linkPtr != NULL)
-    {
-        ServerConnection_t* serverConnectionPtr = CONTAINER_OF(linkPtr, ServerConnection_t, link);
-
-        if (strcmp(serverConnectionPtr->interface.interfaceName, serviceName) == 0)
-        {
-            return serverConnectionPtr;
-        }
-
-        linkPtr = le_dls_PeekNext(&userPtr->serviceList, linkPtr);
-    }
-
-    return NULL;
+    return le_hashmap_Get(ServiceMapRef, &key);
 }
 
 
@@ -832,6 +931,88 @@ static void FollowBinding
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Looks up the Service Bindings object for a given server User and service name.
+ *
+ * @return Pointer to the Service Bindings object or NULL if no Binding refers to the service.
+ **/
+//--------------------------------------------------------------------------------------------------
+static ServiceBindings_t* FindServiceBindings
+(
+    const User_t* userPtr,      ///< [in] Ptr to the server's User object.
+    const char* serviceName     ///< [in] Service name string.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    InterfaceKey_t key = { .userPtr = userPtr, .interfaceName = serviceName };
+
+    return le_hashmap_Get(ServiceBindingsMapRef, &key);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a new Binding object to the Service Bindings object for the service it refers to,
+ * creating the Service Bindings object if this is the first Binding to that service.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void AddBindingToService
+(
+    Binding_t* bindingPtr   ///< [in] Ptr to the Binding object.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    ServiceBindings_t* serviceBindingsPtr = FindServiceBindings(bindingPtr->serverUserPtr,
+                                                                bindingPtr->serverInterfaceName);
+    if (serviceBindingsPtr == NULL)
+    {
+        serviceBindingsPtr = le_mem_ForceAlloc(ServiceBindingsPoolRef);
+
+        le_utf8_Copy(serviceBindingsPtr->serviceName,
+                     bindingPtr->serverInterfaceName,
+                     sizeof(serviceBindingsPtr->serviceName),
+                     NULL);
+        serviceBindingsPtr->bindingList = LE_DLS_LIST_INIT;
+
+        // The Bindings on the list hold references to the server User object, so the
+        // Service Bindings object doesn't need one of its own.
+        serviceBindingsPtr->key.userPtr = bindingPtr->serverUserPtr;
+        serviceBindingsPtr->key.interfaceName = serviceBindingsPtr->serviceName;
+        le_hashmap_Put(ServiceBindingsMapRef, &serviceBindingsPtr->key, serviceBindingsPtr);
+    }
+
+    bindingPtr->serviceLink = LE_DLS_LINK_INIT;
+    le_dls_Queue(&serviceBindingsPtr->bindingList, &bindingPtr->serviceLink);
+    bindingPtr->serviceBindingsPtr = serviceBindingsPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Removes a Binding object from its Service Bindings object, deleting the Service Bindings object
+ * if no Binding refers to the service any more.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void RemoveBindingFromService
+(
+    Binding_t* bindingPtr   ///< [in] Ptr to the Binding object.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    ServiceBindings_t* serviceBindingsPtr = bindingPtr->serviceBindingsPtr;
+
+    le_dls_Remove(&serviceBindingsPtr->bindingList, &bindingPtr->serviceLink);
+    bindingPtr->serviceBindingsPtr = NULL;
+
+    if (le_dls_IsEmpty(&serviceBindingsPtr->bindingList))
+    {
+        le_hashmap_Remove(ServiceBindingsMapRef, &serviceBindingsPtr->key);
+        le_mem_Release(serviceBindingsPtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates a Binding object for a given binding between a client user's interface name and a
@@ -917,8 +1098,14 @@ static void CreateBinding
     bindingPtr->serverConnectionPtr = NULL;
     bindingPtr->waitingClientsList = LE_DLS_LIST_INIT;
 
-    // Add the Binding to the client User's Binding List.
+    // Add the Binding to the client User's Binding List and the Binding Map.
     le_dls_Queue(&bindingPtr->clientUserPtr->bindingList, &bindingPtr->link);
+    bindingPtr->key.userPtr = bindingPtr->clientUserPtr;
+    bindingPtr->key.interfaceName = bindingPtr->clientInterfaceName;
+    le_hashmap_Put(BindingMapRef, &bindingPtr->key, bindingPtr);
+
+    // Add the Binding to the list of Bindings to its destination service.
+    AddBindingToService(bindingPtr);
 
     // Look for a server serving the binding's destination service.
     bindingPtr->serverConnectionPtr = FindService(bindingPtr->serverUserPtr, serverInterfaceName);
@@ -998,51 +1185,42 @@ static void ResolveBindingsToServer
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // For each user,
-    le_dls_Link_t* userLinkPtr = le_dls_Peek(&UserList);
+    ServiceBindings_t* serviceBindingsPtr =
+        FindServiceBindings(connectionPtr->userPtr, connectionPtr->interface.interfaceName);
+    if (serviceBindingsPtr == NULL)
+    {
+        return;
+    }
 
-    while (userLinkPtr != NULL)
+    // For each of the bindings pointing at the new server's service,
+    le_dls_Link_t* bindingLinkPtr = le_dls_Peek(&serviceBindingsPtr->bindingList);
+    while (bindingLinkPtr != NULL)
     {
-        User_t* userPtr = CONTAINER_OF(userLinkPtr, User_t, link);
+        Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, serviceLink);
 
-        // For each of the user's bindings,
-        le_dls_Link_t* bindingLinkPtr = le_dls_Peek(&userPtr->bindingList);
-        while (bindingLinkPtr != NULL)
-        {
-            Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, link);
+        bindingPtr->serverConnectionPtr = connectionPtr;
 
-            // If the binding is pointing at the new server's service,
-            if (   (connectionPtr->userPtr == bindingPtr->serverUserPtr)
-                && (0 == strcmp(connectionPtr->interface.interfaceName,
-                                bindingPtr->serverInterfaceName))  )
+        // While there's still a client connection on the Waiting Clients List, get
+        // a pointer to the first one, without removing it from the list, then try
+        // to dispatch that client to the server.
+        le_dls_Link_t* clientLinkPtr;
+        while (NULL != (clientLinkPtr = le_dls_Peek(&bindingPtr->waitingClientsList)))
+        {
+            ClientConnection_t* clientConnectionPtr = CONTAINER_OF(clientLinkPtr,
+                                                                   ClientConnection_t,
+                                                                   link);
+            if (DispatchToServer(clientConnectionPtr, connectionPtr) == LE_CLOSED)
             {
-                bindingPtr->serverConnectionPtr = connectionPtr;
-
-                // While there's still a client connection on the Waiting Clients List, get
-                // a pointer to the first one, without removing it from the list, then try
-                // to dispatch that client to the server.
-                le_dls_Link_t* clientLinkPtr;
-                while (NULL != (clientLinkPtr = le_dls_Peek(&bindingPtr->waitingClientsList)))
-                {
-                    ClientConnection_t* clientConnectionPtr = CONTAINER_OF(clientLinkPtr,
-                                                                           ClientConnection_t,
-                                                                           link);
-                    if (DispatchToServer(clientConnectionPtr, connectionPtr) == LE_CLOSED)
-                    {
-                        // Server went down.  Client was left on the Waiting Clients List.
-                        // Server Connection destructor was run and it disconnected itself
-                        // from the Binding object.
-                        return;
-                    }
-                    // NOTE: If the server didn't go down, then the Client Connection has been
-                    // deleted and its destructor removed it from the Waiting Clients List.
-                }
+                // Server went down.  Client was left on the Waiting Clients List.
+                // Server Connection destructor was run and it disconnected itself
+                // from the Binding object.
+                return;
             }
-
-            bindingLinkPtr = le_dls_PeekNext(&userPtr->bindingList, bindingLinkPtr);
+            // NOTE: If the server didn't go down, then the Client Connection has been
+            // deleted and its destructor removed it from the Waiting Clients List.
         }
 
-        userLinkPtr = le_dls_PeekNext(&UserList, userLinkPtr);
+        bindingLinkPtr = le_dls_PeekNext(&serviceBindingsPtr->bindingList, bindingLinkPtr);
     }
 }
 
@@ -1076,8 +1254,11 @@ static void ProcessAdvertisementFromServer
     // connection to the service list.
     else
     {
-        // Add the object to the User's Service List.
+        // Add the object to the User's Service List and the Service Map.
         le_dls_Queue(&connectionPtr->userPtr->serviceList, &connectionPtr->link);
+        connectionPtr->key.userPtr = connectionPtr->userPtr;
+        connectionPtr->key.interfaceName = connectionPtr->interface.interfaceName;
+        le_hashmap_Put(ServiceMapRef, &connectionPtr->key, connectionPtr);
 
         LE_DEBUG("Server (uid %u '%s', pid %d) now serving service '%s' (%s).",
                  connectionPtr->userPtr->uid,
@@ -1086,6 +1267,12 @@ static void ProcessAdvertisementFromServer
                  connectionPtr->interface.interfaceName,
                  connectionPtr->interface.protocolId);
 
+        // Recorded by pid, which "legato boot-profile" matches to the app or daemon it started.
+        char detail[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES + 16];
+        snprintf(detail, sizeof(detail), "%d %s",
+                 connectionPtr->pid, connectionPtr->interface.interfaceName);
+        bootProfile_Record("serviceDirectory", "advertise", detail);
+
         // Search for and associate bindings that refer to this service and dispatch any
         // waiting clients to the new server.
         ResolveBindingsToServer(connectionPtr);
@@ -1640,18 +1827,15 @@ static void ServerConnectionDestructor
 
     // Disassociate the Server Connection object from all Binding objects that refer to it...
 
-    // For each user,
-    le_dls_Link_t* userLinkPtr = le_dls_Peek(&UserList);
-
-    while (userLinkPtr != NULL)
+    // Only the bindings to the connection's service can refer to it.
+    ServiceBindings_t* serviceBindingsPtr =
+        FindServiceBindings(connectionPtr->userPtr, connectionPtr->interface.interfaceName);
+    if (serviceBindingsPtr != NULL)
     {
-        User_t* userPtr = CONTAINER_OF(userLinkPtr, User_t, link);
-
-        // For each of the user's bindings,
-        le_dls_Link_t* bindingLinkPtr = le_dls_Peek(&userPtr->bindingList);
+        le_dls_Link_t* bindingLinkPtr = le_dls_Peek(&serviceBindingsPtr->bindingList);
         while (bindingLinkPtr != NULL)
         {
-            Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, link);
+            Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, serviceLink);
 
             // If the binding is associated with the deleted server connection,
             if (connectionPtr == bindingPtr->serverConnectionPtr)
@@ -1659,10 +1843,8 @@ static void ServerConnectionDestructor
                 bindingPtr->serverConnectionPtr = NULL;
             }
 
-            bindingLinkPtr = le_dls_PeekNext(&userPtr->bindingList, bindingLinkPtr);
+            bindingLinkPtr = le_dls_PeekNext(&serviceBindingsPtr->bindingList, bindingLinkPtr);
         }
-
-        userLinkPtr = le_dls_PeekNext(&UserList, userLinkPtr);
     }
 
     if (connectionPtr->interface.interfaceName[0] == '\0')
@@ -1687,6 +1869,7 @@ static void ServerConnectionDestructor
         if (le_dls_IsInList(&connectionPtr->userPtr->serviceList, &connectionPtr->link))
         {
             le_dls_Remove(&connectionPtr->userPtr->serviceList, &connectionPtr->link);
+            le_hashmap_Remove(ServiceMapRef, &connectionPtr->key);
         }
     }
 
@@ -1777,8 +1960,11 @@ static void BindingDestructor
 {
     Binding_t* bindingPtr = objPtr;
 
-    // Remove the Binding object from the User's Binding List.
+    // Remove the Binding object from the User's Binding List, the Binding Map and its service's
+    // list of Bindings.
     le_dls_Remove(&bindingPtr->clientUserPtr->bindingList, &bindingPtr->link);
+    le_hashmap_Remove(BindingMapRef, &bindingPtr->key);
+    RemoveBindingFromService(bindingPtr);
 
     // While the list of waiting clients is not empty, pop one off and process it.
     le_dls_Link_t* linkPtr;
@@ -2087,6 +2273,43 @@ static void SdirToolList
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes a "client" or "service" member for the 'sdir' tool's json output, identifying the app or
+ * user and its interface.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SdirToolWriteEndpointJson
+(
+    le_json_Writer_t* writerPtr,    ///< [in] The json writer.
+    const char* memberNamePtr,      ///< [in] "client" or "service".
+    const char* userNamePtr,        ///< [in] The user name ("app<name>" for an app).
+    const char* interfaceNamePtr    ///< [in] The interface name.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_json_WriteMember(writerPtr, memberNamePtr);
+    le_json_StartObject(writerPtr);
+
+    // Check whether the user is an app or not.
+    if (strncmp(userNamePtr, "app", 3) == 0)
+    {
+        le_json_WriteMember(writerPtr, "app");
+        le_json_WriteString(writerPtr, userNamePtr + 3);
+    }
+    else
+    {
+        le_json_WriteMember(writerPtr, "user");
+        le_json_WriteString(writerPtr, userNamePtr);
+    }
+
+    le_json_WriteMember(writerPtr, "interface");
+    le_json_WriteString(writerPtr, interfaceNamePtr);
+
+    le_json_EndObject(writerPtr);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Handles the "List Services" request from the 'sdir' tool. Dumps output in json format.
@@ -2094,13 +2317,12 @@ static void SdirToolList
 //--------------------------------------------------------------------------------------------------
 static void SdirToolListServicesJson
 (
-    int fd      ///< [in] The file descriptor to write the output to.
+    le_json_Writer_t* writerPtr ///< [in] The json writer to write the output to.
 )
 //--------------------------------------------------------------------------------------------------
 {
     // Iterate over the User List, and for each user, iterate over their Service List.
     le_dls_Link_t* userLinkPtr = le_dls_Peek(&UserList);
-    bool isFirstJsonEntry = true;
 
     while (userLinkPtr != NULL)
     {
@@ -2113,40 +2335,20 @@ static void SdirToolListServicesJson
             ServerConnection_t* connectionPtr = CONTAINER_OF(serviceLinkPtr,
                                                              ServerConnection_t,
                                                              link);
-            size_t nameOffset = 0;
-            const char* serverTypeStr = "user";
 
-            // Check whether server is app or not.
-            if (strncmp(userPtr->name, "app", 3) == 0)
-            {
-                nameOffset = 3;
-                serverTypeStr = "app";
-            }
+            le_json_StartObject(writerPtr);
+            SdirToolWriteEndpointJson(writerPtr,
+                                      "service",
+                                      userPtr->name,
+                                      connectionPtr->interface.interfaceName);
+            le_json_WriteMember(writerPtr, "pid");
+            le_json_WriteInt(writerPtr, connectionPtr->pid);
+            le_json_WriteMember(writerPtr, "maxMessageSize");
+            le_json_WriteUint(writerPtr, connectionPtr->interface.maxProtocolMsgSize);
+            le_json_WriteMember(writerPtr, "protocolId");
+            le_json_WriteString(writerPtr, connectionPtr->interface.protocolId);
+            le_json_EndObject(writerPtr);
 
-            // Print the service info to the provided file descriptor.
-            if (isFirstJsonEntry == false)
-            {
-                // Not the first Json entry. So, print comma before dumping json entry.
-                dprintf(fd, ",");
-            }
-
-            dprintf(fd, "{"
-                        "\"service\":{"
-                        "\"%s\":\"%s\","
-                        "\"interface\":\"%s\""
-                        "},"
-                        "\"pid\":%d,"
-                        "\"maxMessageSize\":%zu,"
-                        "\"protocolId\":\"%s\""
-                        "}",
-                        serverTypeStr,
-                        userPtr->name + nameOffset,
-                        connectionPtr->interface.interfaceName,
-                        connectionPtr->pid,
-                        connectionPtr->interface.maxProtocolMsgSize,
-                        connectionPtr->interface.protocolId);
-
-            isFirstJsonEntry = false;
             serviceLinkPtr = le_dls_PeekNext(&userPtr->serviceList, serviceLinkPtr);
         }
 
@@ -2162,28 +2364,17 @@ static void SdirToolListServicesJson
 //--------------------------------------------------------------------------------------------------
 static void SdirToolListWaitingClientsJson
 (
-    int fd      ///< [in] The file descriptor to write the output to.
+    le_json_Writer_t* writerPtr ///< [in] The json writer to write the output to.
 )
 //--------------------------------------------------------------------------------------------------
 {
     // Iterate over the User List, and for each user,
     le_dls_Link_t* userLinkPtr = le_dls_Peek(&UserList);
-    bool isFirstJsonEntry = true;
 
     while (userLinkPtr != NULL)
     {
         User_t* userPtr = CONTAINER_OF(userLinkPtr, User_t, link);
 
-        size_t nameOffsetClient = 0;
-        const char* clientTypeStr = "user";
-
-        // Check whether client is app or not.
-        if (strncmp(userPtr->name, "app", 3) == 0)
-        {
-            nameOffsetClient = 3;
-            clientTypeStr = "app";
-        }
-
         // List all the unbound client connections:
         le_dls_Link_t* clientLinkPtr = le_dls_Peek(&userPtr->unboundClientsList);
         while (clientLinkPtr != NULL)
@@ -2192,27 +2383,17 @@ static void SdirToolListWaitingClientsJson
                                                              ClientConnection_t,
                                                              link);
 
-            if (isFirstJsonEntry == false)
-            {
-                // Not the first Json entry. So, print comma before dumping json entry.
-                dprintf(fd, ",");
-            }
+            le_json_StartObject(writerPtr);
+            SdirToolWriteEndpointJson(writerPtr,
+                                      "client",
+                                      userPtr->name,
+                                      connectionPtr->interface.interfaceName);
+            le_json_WriteMember(writerPtr, "pid");
+            le_json_WriteInt(writerPtr, connectionPtr->pid);
+            le_json_WriteMember(writerPtr, "protocolId");
+            le_json_WriteString(writerPtr, connectionPtr->interface.protocolId);
+            le_json_EndObject(writerPtr);
 
-            dprintf(fd, "{"
-                        "\"client\":{"
-                        "\"%s\":\"%s\","
-                        "\"interface\":\"%s\""
-                        "},"
-                        "\"pid\":%d,"
-                        "\"protocolId\":\"%s\""
-                        "}",
-                        clientTypeStr,
-                        userPtr->name + nameOffsetClient,
-                        connectionPtr->interface.interfaceName,
-                        connectionPtr->pid,
-                        connectionPtr->interface.protocolId);
-
-            isFirstJsonEntry = false;
             clientLinkPtr = le_dls_PeekNext(&userPtr->unboundClientsList, clientLinkPtr);
         }
 
@@ -2230,47 +2411,24 @@ static void SdirToolListWaitingClientsJson
                 ClientConnection_t* connectionPtr = CONTAINER_OF(clientLinkPtr,
                                                                  ClientConnection_t,
                                                                  link);
-                size_t nameOffsetServer = 0;
-                const char* serverTypeStr = "user";
 
-                // Check whether server is app or not.
-                if (strncmp(bindingPtr->serverUserPtr->name, "app", 3) == 0)
-                {
-                    nameOffsetServer = 3;
-                    serverTypeStr = "app";
-                }
+                // Describe the waiting connection and what it is waiting for.
+                le_json_StartObject(writerPtr);
+                SdirToolWriteEndpointJson(writerPtr,
+                                          "client",
+                                          userPtr->name,
+                                          connectionPtr->interface.interfaceName);
+                le_json_WriteMember(writerPtr, "pid");
+                le_json_WriteInt(writerPtr, connectionPtr->pid);
+                SdirToolWriteEndpointJson(writerPtr,
+                                          "service",
+                                          bindingPtr->serverUserPtr->name,
+                                          bindingPtr->serverInterfaceName);
+                le_json_WriteMember(writerPtr, "protocolId");
+                le_json_WriteString(writerPtr, connectionPtr->interface.protocolId);
+                le_json_EndObject(writerPtr);
 
-                // Print a description of the waiting connection and what it is waiting for.
-                if (isFirstJsonEntry == false)
-                {
-                    // Not the first Json entry. So, print comma before dumping json entry.
-                    dprintf(fd, ",");
-                }
-
-                dprintf(fd, "{"
-                            "\"client\":{"
-                            "\"%s\":\"%s\","
-                            "\"interface\":\"%s\""
-                            "},"
-                            "\"pid\":%d,"
-                            "\"service\": {"
-                            "\"%s\":\"%s\","
-                            "\"interface\":\"%s\""
-                            "},"
-                            "\"protocolId\":\"%s\""
-                            "}",
-                            clientTypeStr,
-                            userPtr->name + nameOffsetClient,
-                            connectionPtr->interface.interfaceName,
-                            connectionPtr->pid,
-                            serverTypeStr,
-                            bindingPtr->serverUserPtr->name + nameOffsetServer,
-                            bindingPtr->serverInterfaceName,
-                            connectionPtr->interface.protocolId);
-
-                isFirstJsonEntry = false;
                 clientLinkPtr = le_dls_PeekNext(&bindingPtr->waitingClientsList, clientLinkPtr);
-
             }
 
             bindingLinkPtr = le_dls_PeekNext(&userPtr->bindingList, bindingLinkPtr);
@@ -2288,13 +2446,12 @@ static void SdirToolListWaitingClientsJson
 //--------------------------------------------------------------------------------------------------
 static void SdirToolListBindingsJson
 (
-    int fd      ///< [in] The file descriptor to write the output to.
+    le_json_Writer_t* writerPtr ///< [in] The json writer to write the output to.
 )
 //--------------------------------------------------------------------------------------------------
 {
     // Iterate over the User List, and for each user, iterate over their Bindings List.
     le_dls_Link_t* userLinkPtr = le_dls_Peek(&UserList);
-    bool isFirstJsonEntry = true;
 
     while (userLinkPtr != NULL)
     {
@@ -2306,51 +2463,17 @@ static void SdirToolListBindingsJson
         {
             Binding_t* bindingPtr = CONTAINER_OF(bindingLinkPtr, Binding_t, link);
 
-            size_t nameOffsetClient = 0;
-            const char* clientTypeStr = "user";
-
-            // Check whether client is app or not.
-            if (strncmp(userPtr->name, "app", 3) == 0)
-            {
-                nameOffsetClient = 3;
-                clientTypeStr = "app";
-            }
-
-            size_t nameOffsetServer = 0;
-            const char* serverTypeStr = "user";
+            le_json_StartObject(writerPtr);
+            SdirToolWriteEndpointJson(writerPtr,
+                                      "client",
+                                      userPtr->name,
+                                      bindingPtr->clientInterfaceName);
+            SdirToolWriteEndpointJson(writerPtr,
+                                      "service",
+                                      bindingPtr->serverUserPtr->name,
+                                      bindingPtr->serverInterfaceName);
+            le_json_EndObject(writerPtr);
 
-            // Check whether server is app or not.
-            if (strncmp(bindingPtr->serverUserPtr->name, "app", 3) == 0)
-            {
-                nameOffsetServer = 3;
-                serverTypeStr = "app";
-            }
-
-            // Print the binding to the provided file descriptor.
-            if (isFirstJsonEntry == false)
-            {
-                // Not the first Json entry. So, print comma before dumping json entry.
-                dprintf(fd, ",");
-            }
-
-            dprintf(fd, "{"
-                        "\"client\":{"
-                        "\"%s\":\"%s\","
-                        "\"interface\":\"%s\""
-                        "},"
-                        "\"service\":{"
-                        "\"%s\":\"%s\","
-                        "\"interface\":\"%s\""
-                        "}"
-                        "}",
-                        clientTypeStr,
-                        userPtr->name + nameOffsetClient,
-                        bindingPtr->clientInterfaceName,
-                        serverTypeStr,
-                        bindingPtr->serverUserPtr->name + nameOffsetServer,
-                        bindingPtr->serverInterfaceName);
-
-            isFirstJsonEntry = false;
             bindingLinkPtr = le_dls_PeekNext(&userPtr->bindingList, bindingLinkPtr);
         }
 
@@ -2362,6 +2485,9 @@ static void SdirToolListBindingsJson
 //--------------------------------------------------------------------------------------------------
 /**
  * Handles the "List" request from the 'sdir' tool. Dumps output in json format.
+ *
+ * The output is composed in a buffer and written to the file descriptor a buffer-full at a time,
+ * rather than with a write() for every piece of every entry.
  */
 //--------------------------------------------------------------------------------------------------
 static void SdirToolListJson
@@ -2376,21 +2502,38 @@ static void SdirToolListJson
     }
     else
     {
-        dprintf(fd, "{\"bindings\":[");
+        char buffer[1024];
+        le_json_Writer_t writer;
 
-        SdirToolListBindingsJson(fd);
+        le_json_InitWriter(&writer, fd, buffer, sizeof(buffer));
 
-        dprintf(fd, "],"
-                    "\"services\":[");
+        le_json_StartObject(&writer);
 
-        SdirToolListServicesJson(fd);
+        le_json_WriteMember(&writer, "bindings");
+        le_json_StartArray(&writer);
+        SdirToolListBindingsJson(&writer);
+        le_json_EndArray(&writer);
 
-        dprintf(fd, "],"
-                    "\"waiting\":[");
+        le_json_WriteMember(&writer, "services");
+        le_json_StartArray(&writer);
+        SdirToolListServicesJson(&writer);
+        le_json_EndArray(&writer);
 
-        SdirToolListWaitingClientsJson(fd);
+        le_json_WriteMember(&writer, "waiting");
+        le_json_StartArray(&writer);
+        SdirToolListWaitingClientsJson(&writer);
+        le_json_EndArray(&writer);
 
-        dprintf(fd, "]}\n");
+        le_json_EndObject(&writer);
+
+        if (le_json_FinishWriter(&writer) == LE_OK)
+        {
+            dprintf(fd, "\n");
+        }
+        else
+        {
+            LE_WARN("Failed to write service list to the 'sdir' tool.");
+        }
 
         fd_Close(fd);
     }
@@ -2563,6 +2706,7 @@ COMPONENT_INIT
     ServerConnectionPoolRef = le_mem_CreatePool("Server Connection", sizeof(ServerConnection_t));
     UserPoolRef = le_mem_CreatePool("User", sizeof(User_t));
     BindingPoolRef = le_mem_CreatePool("Binding", sizeof(Binding_t));
+    ServiceBindingsPoolRef = le_mem_CreatePool("Service Bindings", sizeof(ServiceBindings_t));
 
     /// Expand the pools to their expected maximum sizes.
     /// @todo Make this configurable.
@@ -2570,6 +2714,7 @@ COMPONENT_INIT
     le_mem_ExpandPool(ServerConnectionPoolRef, 30);
     le_mem_ExpandPool(UserPoolRef, 30);
     le_mem_ExpandPool(BindingPoolRef, 30);
+    le_mem_ExpandPool(ServiceBindingsPoolRef, 30);
 
     // Register destructor functions.
     le_mem_SetDestructor(ClientConnectionPoolRef, ClientConnectionDestructor);
@@ -2577,19 +2722,41 @@ COMPONENT_INIT
     le_mem_SetDestructor(UserPoolRef, UserDestructor);
     le_mem_SetDestructor(BindingPoolRef, BindingDestructor);
 
+    // Create the maps that index the objects, letting them grow with the number of objects.
+    UserMapRef = le_hashmap_Create("User", 31, le_hashmap_HashUInt32, le_hashmap_EqualsUInt32);
+    BindingMapRef = le_hashmap_Create("Binding", 31, HashInterfaceKey, EqualsInterfaceKey);
+    ServiceMapRef = le_hashmap_Create("Service", 31, HashInterfaceKey, EqualsInterfaceKey);
+    ServiceBindingsMapRef = le_hashmap_Create("Service Bindings",
+                                              31,
+                                              HashInterfaceKey,
+                                              EqualsInterfaceKey);
+    le_hashmap_EnableResize(UserMapRef, 75);
+    le_hashmap_EnableResize(BindingMapRef, 75);
+    le_hashmap_EnableResize(ServiceMapRef, 75);
+    le_hashmap_EnableResize(ServiceBindingsMapRef, 75);
+
     // Create built-in, hard-coded bindings.
     CreateHardCodedBindings();
 
-    // Create the Legato runtime directory if it doesn't already exists.
-    LE_ASSERT(le_dir_Make(LE_CONFIG_RUNTIME_DIR, S_IRWXU | S_IXOTH) != LE_FAULT);
+    // Use the sockets the Supervisor created for us, if it did (see @ref sd_startUpSync).
+    if (unixSocket_GetInherited() == 2)
+    {
+        ClientSocketFd = UNIXSOCKET_LISTEN_FDS_START;
+        ServerSocketFd = UNIXSOCKET_LISTEN_FDS_START + 1;
+    }
+    else
+    {
+        // Create the Legato runtime directory if it doesn't already exists.
+        LE_ASSERT(le_dir_Make(LE_CONFIG_RUNTIME_DIR, S_IRWXU | S_IXOTH) != LE_FAULT);
 
-    /// @todo Check permissions of directory containing client and server socket addresses.
-    ///       Only the current user or root should be allowed write access.
-    ///       Warn if it is found to be otherwise.
+        /// @todo Check permissions of directory containing client and server socket addresses.
+        ///       Only the current user or root should be allowed write access.
+        ///       Warn if it is found to be otherwise.
 
-    // Open the sockets.
-    ClientSocketFd = OpenSocket(LE_SVCDIR_CLIENT_SOCKET_NAME);
-    ServerSocketFd = OpenSocket(LE_SVCDIR_SERVER_SOCKET_NAME);
+        // Open the sockets.
+        ClientSocketFd = OpenSocket(LE_SVCDIR_CLIENT_SOCKET_NAME);
+        ServerSocketFd = OpenSocket(LE_SVCDIR_SERVER_SOCKET_NAME);
+    }
 
     // Start listening for connection attempts.
     ClientSocketMonitorRef = le_fdMonitor_Create("Client Socket",
@@ -30,6 +30,7 @@
 #include "start.h"
 #include "pa_start.h"
 
+#include "bootProfile.h"
 #include "daemon.h"
 #include "dir.h"
 #include "file.h"
@@ -1350,6 +1351,8 @@ static int TryToRun
 )
 {
 
+    bootProfile_Record("start", "execSupervisor", NULL);
+
     // Start the Supervisor.
     pid_t supervisorPid = fork();
     if (supervisorPid == 0)
@@ -2172,6 +2175,10 @@ int main
     LE_INFO("Installing/launching the system.");
     while(1)
     {
+        // Each launch of a system is profiled from here, restarts included.
+        bootProfile_Start();
+        bootProfile_Record("start", "selectSystem", NULL);
+
         if (!isReadOnly)
         {
             // Verify and install the current system.
@@ -43,10 +43,12 @@
 #include "legato.h"
 #include "watchdogAction.h"
 #include "app.h"
+#include "bootProfile.h"
 #include "limit.h"
 #include "proc.h"
 #include "user.h"
 #include "le_cfg_interface.h"
+#include "cfgSubtree.h"
 #include "resourceLimits.h"
 #include "smack.h"
 #include "supervisor.h"
@@ -340,6 +342,8 @@ typedef struct app_Ref
 {
     char*           name;                               // Name of the application.
     char            cfgPathRoot[LIMIT_MAX_PATH_BYTES];  // Our path in the config tree.
+    cfgSubtree_NodeRef_t cfgRef;        // Copy of our config, read in one go when the app is
+                                        // created.
     bool            sandboxed;                          // true if this is a sandboxed app.
     char            installDirPath[LIMIT_MAX_PATH_BYTES]; // Abs path to install files dir.
     char            workingDir[LIMIT_MAX_PATH_BYTES];   // Abs path to the apps working directory.
@@ -355,6 +359,9 @@ typedef struct app_Ref
     le_sls_List_t   additionalLinks;    // List of additional links that are temporarily added to
                                         // the app.
     le_sls_List_t   reqModuleName;      // List of required kernel module names
+    char            areaHash[LIMIT_MAX_APP_HASH_BYTES]; // Hash of the app when its working area
+                                                        // was set up, or empty if it must be set
+                                                        // up at the next start.
 }
 App_t;
 
@@ -444,6 +451,26 @@ typedef enum
 KillType_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the first child of a node in the app's copy of its config.
+ *
+ * @return
+ *      The first child, or NULL if the node doesn't exist or has no children.
+ **/
+//--------------------------------------------------------------------------------------------------
+static cfgSubtree_NodeRef_t GetFirstCfgChild
+(
+    app_Ref_t appRef,                   ///< [IN] The app.
+    const char* pathPtr                 ///< [IN] Path to the node, relative to the app's config.
+)
+{
+    cfgSubtree_NodeRef_t nodeRef = cfgSubtree_GetNode(appRef->cfgRef, pathPtr);
+
+    return (nodeRef != NULL) ? cfgSubtree_GetFirstChild(nodeRef) : NULL;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Create the supplementary groups for an application.
@@ -457,16 +484,13 @@ static le_result_t CreateSupplementaryGroups
     app_Ref_t appRef        // The app to create groups for.
 )
 {
-    // Get an iterator to the supplementary groups list in the config.
-    le_cfg_IteratorRef_t cfgIter = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
-
-    le_cfg_GoToNode(cfgIter, CFG_NODE_GROUPS);
+    // Get the supplementary groups list in the config.
+    cfgSubtree_NodeRef_t groupRef = GetFirstCfgChild(appRef, CFG_NODE_GROUPS);
 
-    if (le_cfg_GoToFirstChild(cfgIter) != LE_OK)
+    if (groupRef == NULL)
     {
         appRef->numSupplementGids = 0;
         LE_DEBUG("No supplementary groups for app '%s'.", appRef->name);
-        le_cfg_CancelTxn(cfgIter);
 
         return LE_OK;
     }
@@ -477,10 +501,9 @@ static le_result_t CreateSupplementaryGroups
     {
         // Read the supplementary group name from the config.
         char groupName[LIMIT_MAX_USER_NAME_BYTES];
-        if (le_cfg_GetNodeName(cfgIter, "", groupName, sizeof(groupName)) != LE_OK)
+        if (cfgSubtree_GetNodeName(groupRef, "", groupName, sizeof(groupName)) != LE_OK)
         {
             LE_ERROR("Could not read supplementary group for app '%s'.", appRef->name);
-            le_cfg_CancelTxn(cfgIter);
             return LE_FAULT;
         }
 
@@ -491,7 +514,6 @@ static le_result_t CreateSupplementaryGroups
             LE_ERROR("Could not create supplementary group '%s' for app '%s'.",
                      groupName,
                      appRef->name);
-            le_cfg_CancelTxn(cfgIter);
             return LE_FAULT;
         }
 
@@ -499,22 +521,21 @@ static le_result_t CreateSupplementaryGroups
         appRef->supplementGids[i] = gid;
 
         // Go to the next group.
-        if (le_cfg_GoToNextSibling(cfgIter) != LE_OK)
+        groupRef = cfgSubtree_GetNextSibling(groupRef);
+
+        if (groupRef == NULL)
         {
             break;
         }
         else if (i >= LIMIT_MAX_NUM_SUPPLEMENTARY_GROUPS - 1)
         {
             LE_ERROR("Too many supplementary groups for app '%s'.", appRef->name);
-            le_cfg_CancelTxn(cfgIter);
             return LE_FAULT;
         }
     }
 
     appRef->numSupplementGids = i + 1;
 
-    le_cfg_CancelTxn(cfgIter);
-
     return LE_OK;
 }
 
@@ -580,7 +601,7 @@ static le_result_t CreateUserAndGroups
 //--------------------------------------------------------------------------------------------------
 static void GetCfgPermissions
 (
-    le_cfg_IteratorRef_t cfgIter,       ///< [IN] Config iterator pointing to the device file.
+    cfgSubtree_NodeRef_t cfgRef,        ///< [IN] Config node of the device file.
     char* bufPtr,                       ///< [OUT] Buffer to hold the permission string.
     size_t bufSize                      ///< [IN] Size of the buffer.
 )
@@ -590,17 +611,17 @@ static void GetCfgPermissions
 
     int i = 0;
 
-    if (le_cfg_GetBool(cfgIter, "isReadable", false))
+    if (cfgSubtree_GetBool(cfgRef, "isReadable", false))
     {
         bufPtr[i++] = 'r';
     }
 
-    if (le_cfg_GetBool(cfgIter, "isWritable", false))
+    if (cfgSubtree_GetBool(cfgRef, "isWritable", false))
     {
         bufPtr[i++] = 'w';
     }
 
-    if (le_cfg_GetBool(cfgIter, "isExecutable", false))
+    if (cfgSubtree_GetBool(cfgRef, "isExecutable", false))
     {
         bufPtr[i++] = 'x';
     }
@@ -611,7 +632,7 @@ static void GetCfgPermissions
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the source path for the device file at the current node in the config iterator.
+ * Get the source path for the device file at a config node.
  *
  * @return
  *      LE_OK if successful.
@@ -621,14 +642,14 @@ static void GetCfgPermissions
 static le_result_t GetDevSrcPath
 (
     app_Ref_t appRef,                   ///< [IN] Reference to the application object.
-    le_cfg_IteratorRef_t cfgIter,       ///< [IN] Config iterator for the import.
+    cfgSubtree_NodeRef_t cfgRef,        ///< [IN] Config node for the import.
     char* bufPtr,                       ///< [OUT] Buffer to store the source path.
     size_t bufSize                      ///< [IN] Size of the buffer.
 )
 {
     char srcPath[LIMIT_MAX_PATH_BYTES] = "";
 
-    if (le_cfg_GetString(cfgIter, "src", srcPath, sizeof(srcPath), "") != LE_OK)
+    if (cfgSubtree_GetString(cfgRef, "src", srcPath, sizeof(srcPath), "") != LE_OK)
     {
         LE_ERROR("Source file path '%s...' for app '%s' is too long.", srcPath, app_GetName(appRef));
         return LE_FAULT;
@@ -742,14 +763,10 @@ static le_result_t SetCfgDevicePermissions
     app_Ref_t appRef                ///< [IN] The application.
 )
 {
-    // Create an iterator for the app.
-    le_cfg_IteratorRef_t appCfg = le_cfg_CreateReadTxn(app_GetConfigPath(appRef));
-
     // Get the list of device files.
-    le_cfg_GoToNode(appCfg, CFG_NODE_REQUIRES);
-    le_cfg_GoToNode(appCfg, CFG_NODE_DEVICES);
+    cfgSubtree_NodeRef_t devRef = GetFirstCfgChild(appRef, CFG_NODE_REQUIRES "/" CFG_NODE_DEVICES);
 
-    if (le_cfg_GoToFirstChild(appCfg) == LE_OK)
+    if (devRef != NULL)
     {
         // Get the app's SMACK label.
         char appLabel[LIMIT_MAX_SMACK_LABEL_BYTES];
@@ -759,15 +776,14 @@ static le_result_t SetCfgDevicePermissions
         {
             // Get source path.
             char srcPath[LIMIT_MAX_PATH_BYTES];
-            if (GetDevSrcPath(appRef, appCfg, srcPath, sizeof(srcPath)) != LE_OK)
+            if (GetDevSrcPath(appRef, devRef, srcPath, sizeof(srcPath)) != LE_OK)
             {
-                le_cfg_CancelTxn(appCfg);
                 return LE_FAULT;
             }
 
             // Get the required permissions for the device.
             char permStr[MAX_DEVICE_PERM_STR_BYTES];
-            GetCfgPermissions(appCfg, permStr, sizeof(permStr));
+            GetCfgPermissions(devRef, permStr, sizeof(permStr));
 
             if (SetDevicePermissions(appLabel, srcPath, permStr) != LE_OK)
             {
@@ -775,17 +791,12 @@ static le_result_t SetCfgDevicePermissions
                          permStr,
                          appRef->name,
                          srcPath);
-                le_cfg_CancelTxn(appCfg);
                 return LE_FAULT;
             }
         }
-        while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
-
-        le_cfg_GoToParent(appCfg);
+        while ((devRef = cfgSubtree_GetNextSibling(devRef)) != NULL);
     }
 
-    le_cfg_CancelTxn(appCfg);
-
     return LE_OK;
 }
 
@@ -844,15 +855,13 @@ static void SetSmackRulesForBindings
     const char* appLabelPtr             ///< [IN] Smack label for the app.
 )
 {
-    // Create a config read transaction to the bindings section for the application.
-    le_cfg_IteratorRef_t bindCfg = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
-    le_cfg_GoToNode(bindCfg, CFG_NODE_BINDINGS);
+    // Get the bindings section for the application.
+    cfgSubtree_NodeRef_t bindRef = GetFirstCfgChild(appRef, CFG_NODE_BINDINGS);
 
     // Search the binding sections for server applications we need to set rules for.
-    if (le_cfg_GoToFirstChild(bindCfg) != LE_OK)
+    if (bindRef == NULL)
     {
         // No bindings.
-        le_cfg_CancelTxn(bindCfg);
         return;
     }
 
@@ -860,7 +869,7 @@ static void SetSmackRulesForBindings
     {
         char serverName[LIMIT_MAX_APP_NAME_BYTES];
 
-        if ( (le_cfg_GetString(bindCfg, "app", serverName, sizeof(serverName), "") == LE_OK) &&
+        if ( (cfgSubtree_GetString(bindRef, "app", serverName, sizeof(serverName), "") == LE_OK) &&
              (serverName[0] != '\0') )
         {
             // Get the server's SMACK label.
@@ -873,9 +882,7 @@ static void SetSmackRulesForBindings
             smack_SetRule(appLabelPtr, "rwx", serverLabel);
             smack_SetRule(serverLabel, "rwx", appLabelPtr);
         }
-    } while (le_cfg_GoToNextSibling(bindCfg) == LE_OK);
-
-    le_cfg_CancelTxn(bindCfg);
+    } while ((bindRef = cfgSubtree_GetNextSibling(bindRef)) != NULL);
 }
 
 
@@ -1362,70 +1369,52 @@ static le_result_t SetPermissionForRequired
     app_Ref_t appRef                      ///< [IN] Reference to the application.
 )
 {
-    // Get a config iterator for this app.
-    le_cfg_IteratorRef_t appCfg = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
-
     // Go to the required directory section.
-    le_cfg_GoToNode(appCfg, CFG_NODE_REQUIRES "/" CFG_NODE_DIRS);
+    cfgSubtree_NodeRef_t dirRef = GetFirstCfgChild(appRef, CFG_NODE_REQUIRES "/" CFG_NODE_DIRS);
 
-    if (le_cfg_GoToFirstChild(appCfg) == LE_OK)
+    for (; dirRef != NULL; dirRef = cfgSubtree_GetNextSibling(dirRef))
     {
-        do
+        char permStr[MAX_DEVICE_PERM_STR_BYTES];
+        GetCfgPermissions(dirRef, permStr, sizeof(permStr));
+
+        // Only add dirs that require access permission
+        if (strcmp(permStr, "") != 0)
         {
-            char permStr[MAX_DEVICE_PERM_STR_BYTES];
-            GetCfgPermissions(appCfg, permStr, sizeof(permStr));
+            char srcPath[LIMIT_MAX_PATH_BYTES];
 
-            // Only add dirs that require access permission
-            if (strcmp(permStr, "") != 0)
+            if (cfgSubtree_GetString(dirRef, "src", srcPath, sizeof(srcPath), "") != LE_OK)
             {
-                char srcPath[LIMIT_MAX_PATH_BYTES];
-
-                if (le_cfg_GetString(appCfg, "src", srcPath, sizeof(srcPath), "") != LE_OK)
-                {
-                    LE_ERROR("Source path '%s...' for app '%s' is too long.", srcPath, appRef->name);
-                    return LE_FAULT;
-                }
-
-                SetPermissionForResource(appRef, CFG_NODE_DIRS, srcPath, permStr);
+                LE_ERROR("Source path '%s...' for app '%s' is too long.", srcPath, appRef->name);
+                return LE_FAULT;
             }
-        }
-        while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
 
-        le_cfg_GoToParent(appCfg);
+            SetPermissionForResource(appRef, CFG_NODE_DIRS, srcPath, permStr);
+        }
     }
 
     // Go to the required files section.
-    le_cfg_GoToParent(appCfg);
-    le_cfg_GoToNode(appCfg, CFG_NODE_FILES);
+    cfgSubtree_NodeRef_t fileRef = GetFirstCfgChild(appRef, CFG_NODE_REQUIRES "/" CFG_NODE_FILES);
 
-    if (le_cfg_GoToFirstChild(appCfg) == LE_OK)
+    for (; fileRef != NULL; fileRef = cfgSubtree_GetNextSibling(fileRef))
     {
-        do
+        char permStr[MAX_DEVICE_PERM_STR_BYTES];
+        GetCfgPermissions(fileRef, permStr, sizeof(permStr));
+
+        // Only add files that require access permission
+        if (strcmp(permStr, "") != 0)
         {
-            char permStr[MAX_DEVICE_PERM_STR_BYTES];
-            GetCfgPermissions(appCfg, permStr, sizeof(permStr));
+            char srcPath[LIMIT_MAX_PATH_BYTES];
 
-            // Only add files that require access permission
-            if (strcmp(permStr, "") != 0)
+            if (cfgSubtree_GetString(fileRef, "src", srcPath, sizeof(srcPath), "") != LE_OK)
             {
-                char srcPath[LIMIT_MAX_PATH_BYTES];
-
-                if (le_cfg_GetString(appCfg, "src", srcPath, sizeof(srcPath), "") != LE_OK)
-                {
-                    LE_ERROR("Source path '%s...' for app '%s' is too long.", srcPath, appRef->name);
-                    return LE_FAULT;
-                }
-
-                SetPermissionForResource(appRef, CFG_NODE_FILES, srcPath, permStr);
+                LE_ERROR("Source path '%s...' for app '%s' is too long.", srcPath, appRef->name);
+                return LE_FAULT;
             }
-        }
-        while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
 
-        le_cfg_GoToParent(appCfg);
+            SetPermissionForResource(appRef, CFG_NODE_FILES, srcPath, permStr);
+        }
     }
 
-    le_cfg_CancelTxn(appCfg);
-
     return LE_OK;
 }
 
@@ -1451,23 +1440,28 @@ static le_result_t SetSmackRules
     char appLabel[LIMIT_MAX_SMACK_LABEL_BYTES];
     smack_GetAppLabel(appRef->name, appLabel, sizeof(appLabel));
 
+    // An app typically needs dozens of rules, so load them all at once.
+    smack_StartRuleBatch();
+
     SetDefaultSmackRules(appRef, appLabel);
 
     SetSmackRulesForBindings(appRef, appLabel);
 
     le_result_t result = SetDefaultDevicePermissions(appRef);
-    if (result != LE_OK)
+
+    if (result == LE_OK)
     {
-        return result;
+        result = SetPermissionForRequired(appRef);
     }
 
-    result = SetPermissionForRequired(appRef);
-    if (result != LE_OK)
+    if (result == LE_OK)
     {
-        return result;
+        result = SetCfgDevicePermissions(appRef);
     }
 
-    return SetCfgDevicePermissions(appRef);
+    smack_CommitRuleBatch();
+
+    return result;
 }
 
 
@@ -1498,6 +1492,15 @@ static void StoppingProcsInList
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Longest time to wait for a change of an app's freeze state before checking it again, in
+ * milliseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define FREEZE_WAIT_MS      100
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Kills all the processes in the specified application.
@@ -1530,6 +1533,10 @@ static le_result_t KillAppProcs
                 LE_ERROR("Could not get freeze state of application '%s'.", appRef->name);
                 break;
             }
+
+            // Sleep until the freeze state changes, where the cgroups can tell us.  Otherwise
+            // this returns at once and the state is polled.
+            cgrp_WaitForEvent(appRef->name, FREEZE_WAIT_MS);
         }
 
         LE_DEBUG("App '%s' frozen.", appRef->name);
@@ -1718,9 +1725,7 @@ static void StopProc
 {
     proc_Stopping(procRef);
 
-    pid_t pid = proc_GetPID(procRef);
-
-    kill_Hard(pid);
+    proc_Kill(procRef);
 }
 
 
@@ -2414,7 +2419,7 @@ static le_result_t CreateLibBinLinks
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the source path for read only bundled files at the current node in the config iterator.
+ * Get the source path for read only bundled files at a config node.
  *
  * @return
  *      LE_OK if successful.
@@ -2424,14 +2429,14 @@ static le_result_t CreateLibBinLinks
 static le_result_t GetBundledReadOnlySrcPath
 (
     app_Ref_t appRef,                   ///< [IN] Reference to the application object.
-    le_cfg_IteratorRef_t cfgIter,       ///< [IN] Config iterator.
+    cfgSubtree_NodeRef_t cfgRef,        ///< [IN] Config node.
     char* bufPtr,                       ///< [OUT] Buffer to store the source path.
     size_t bufSize                      ///< [IN] Size of the buffer.
 )
 {
     char srcPath[LIMIT_MAX_PATH_BYTES] = "";
 
-    if (le_cfg_GetString(cfgIter, "src", srcPath, sizeof(srcPath), "") != LE_OK)
+    if (cfgSubtree_GetString(cfgRef, "src", srcPath, sizeof(srcPath), "") != LE_OK)
     {
         LE_ERROR("Source file path '%s...' for app '%s' is too long.", srcPath, app_GetName(appRef));
         return LE_FAULT;
@@ -2475,7 +2480,7 @@ static le_result_t GetBundledReadOnlySrcPath
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the destination path for the app at the current node in the config iterator.
+ * Get the destination path for the app at a config node.
  *
  * @return
  *      LE_OK if successful.
@@ -2485,12 +2490,12 @@ static le_result_t GetBundledReadOnlySrcPath
 static le_result_t GetDestPath
 (
     app_Ref_t appRef,                   ///< [IN] Reference to the application object.
-    le_cfg_IteratorRef_t cfgIter,       ///< [IN] Config iterator.
+    cfgSubtree_NodeRef_t cfgRef,        ///< [IN] Config node.
     char* bufPtr,                       ///< [OUT] Buffer to store the path.
     size_t bufSize                      ///< [IN] Size of the buffer.
 )
 {
-    if (le_cfg_GetString(cfgIter, "dest", bufPtr, bufSize, "") != LE_OK)
+    if (cfgSubtree_GetString(cfgRef, "dest", bufPtr, bufSize, "") != LE_OK)
     {
         LE_ERROR("Destination path '%s...' for app '%s' is too long.", bufPtr, appRef->name);
         return LE_FAULT;
@@ -2508,7 +2513,7 @@ static le_result_t GetDestPath
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the source path for the app at the current node in the config iterator.
+ * Get the source path for the app at a config node.
  *
  * @return
  *      LE_OK if successful.
@@ -2518,12 +2523,12 @@ static le_result_t GetDestPath
 static le_result_t GetSrcPath
 (
     app_Ref_t appRef,                   ///< [IN] Reference to the application object.
-    le_cfg_IteratorRef_t cfgIter,       ///< [IN] Config iterator.
+    cfgSubtree_NodeRef_t cfgRef,        ///< [IN] Config node.
     char* bufPtr,                       ///< [OUT] Buffer to store the path.
     size_t bufSize                      ///< [IN] Size of the buffer.
 )
 {
-    if (le_cfg_GetString(cfgIter, "src", bufPtr, bufSize, "") != LE_OK)
+    if (cfgSubtree_GetString(cfgRef, "src", bufPtr, bufSize, "") != LE_OK)
     {
         LE_ERROR("Source path '%s...' for app '%s' is too long.", bufPtr, appRef->name);
         return LE_FAULT;
@@ -2554,95 +2559,72 @@ static le_result_t CreateBundledLinks
     const char* appDirLabelPtr          ///< [IN] SMACK label to use for created directories.
 )
 {
-    // Get a config iterator for this app.
-    le_cfg_IteratorRef_t appCfg = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
-
     // Go to the bundled directories section.
-    le_cfg_GoToNode(appCfg, CFG_NODE_BUNDLES);
-    le_cfg_GoToNode(appCfg, CFG_NODE_DIRS);
+    cfgSubtree_NodeRef_t dirRef = GetFirstCfgChild(appRef, CFG_NODE_BUNDLES "/" CFG_NODE_DIRS);
 
-    if (le_cfg_GoToFirstChild(appCfg) == LE_OK)
+    for (; dirRef != NULL; dirRef = cfgSubtree_GetNextSibling(dirRef))
     {
-        do
+        // Only handle read only directories.
+        if (!cfgSubtree_GetBool(dirRef, "isWritable", false))
         {
-            // Only handle read only directories.
-            if (!le_cfg_GetBool(appCfg, "isWritable", false))
+            // Get source path.
+            char srcPath[LIMIT_MAX_PATH_BYTES];
+            if (GetBundledReadOnlySrcPath(appRef, dirRef, srcPath, sizeof(srcPath)) != LE_OK)
             {
-                // Get source path.
-                char srcPath[LIMIT_MAX_PATH_BYTES];
-                if (GetBundledReadOnlySrcPath(appRef, appCfg, srcPath, sizeof(srcPath)) != LE_OK)
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
+                return LE_FAULT;
+            }
 
-                // Get destination path.
-                char destPath[LIMIT_MAX_PATH_BYTES];
-                if (GetDestPath(appRef, appCfg, destPath, sizeof(destPath)) != LE_OK)
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
+            // Get destination path.
+            char destPath[LIMIT_MAX_PATH_BYTES];
+            if (GetDestPath(appRef, dirRef, destPath, sizeof(destPath)) != LE_OK)
+            {
+                return LE_FAULT;
+            }
 
-                // Create links for all files in the source directory.
-                if (RecursivelyCreateLinks(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
+            // Create links for all files in the source directory.
+            if (RecursivelyCreateLinks(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
+            {
+                return LE_FAULT;
             }
         }
-        while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
-
-        le_cfg_GoToParent(appCfg);
     }
 
-    // Go to the requires files section.
-    le_cfg_GoToParent(appCfg);
-    le_cfg_GoToNode(appCfg, CFG_NODE_FILES);
+    // Go to the bundled files section.
+    cfgSubtree_NodeRef_t fileRef = GetFirstCfgChild(appRef, CFG_NODE_BUNDLES "/" CFG_NODE_FILES);
 
-    if (le_cfg_GoToFirstChild(appCfg) == LE_OK)
+    for (; fileRef != NULL; fileRef = cfgSubtree_GetNextSibling(fileRef))
     {
-        do
+        // Only handle read only files.
+        if (!cfgSubtree_GetBool(fileRef, "isWritable", false))
         {
-            // Only handle read only files.
-            if (!le_cfg_GetBool(appCfg, "isWritable", false))
+            // Get source path.
+            char srcPath[LIMIT_MAX_PATH_BYTES];
+            if (GetBundledReadOnlySrcPath(appRef, fileRef, srcPath, sizeof(srcPath)) != LE_OK)
             {
-                // Get source path.
-                char srcPath[LIMIT_MAX_PATH_BYTES];
-                if (GetBundledReadOnlySrcPath(appRef, appCfg, srcPath, sizeof(srcPath)) != LE_OK)
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
+                return LE_FAULT;
+            }
 
-                // Get destination path.
-                char destPath[LIMIT_MAX_PATH_BYTES];
-                if (GetDestPath(appRef, appCfg, destPath, sizeof(destPath)) != LE_OK)
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
+            // Get destination path.
+            char destPath[LIMIT_MAX_PATH_BYTES];
+            if (GetDestPath(appRef, fileRef, destPath, sizeof(destPath)) != LE_OK)
+            {
+                return LE_FAULT;
+            }
 
-                if (CreateFileLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
+            if (CreateFileLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
+            {
+                return LE_FAULT;
             }
         }
-        while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
     }
 
-    le_cfg_CancelTxn(appCfg);
-
     return LE_OK;
 }
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Create links to the app's required files under the current node in the configuration iterator.
+ * Create links to the app's required files under a node of the app's config.
  *
  * @return
  *      LE_OK if successful.
@@ -2653,36 +2635,32 @@ static le_result_t CreateRequiredFileLinks
 (
     app_Ref_t appRef,                   ///< [IN] Application reference.
     const char* appDirLabelPtr,         ///< [IN] SMACK label to use for created directories.
-    le_cfg_IteratorRef_t cfgIter        ///< [IN] Config iterator.
+    const char* cfgPathPtr              ///< [IN] Path of the node, relative to the app's config.
 )
 {
-    if (le_cfg_GoToFirstChild(cfgIter) == LE_OK)
-    {
-        do
-        {
-            // Get source path.
-            char srcPath[LIMIT_MAX_PATH_BYTES];
+    cfgSubtree_NodeRef_t fileRef = GetFirstCfgChild(appRef, cfgPathPtr);
 
-            if (GetSrcPath(appRef, cfgIter, srcPath, sizeof(srcPath)) != LE_OK)
-            {
-                return LE_FAULT;
-            }
+    for (; fileRef != NULL; fileRef = cfgSubtree_GetNextSibling(fileRef))
+    {
+        // Get source path.
+        char srcPath[LIMIT_MAX_PATH_BYTES];
 
-            // Get destination path.
-            char destPath[LIMIT_MAX_PATH_BYTES];
-            if (GetDestPath(appRef, cfgIter, destPath, sizeof(destPath)) != LE_OK)
-            {
-                return LE_FAULT;
-            }
+        if (GetSrcPath(appRef, fileRef, srcPath, sizeof(srcPath)) != LE_OK)
+        {
+            return LE_FAULT;
+        }
 
-            if (CreateFileLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
-            {
-                return LE_FAULT;
-            }
+        // Get destination path.
+        char destPath[LIMIT_MAX_PATH_BYTES];
+        if (GetDestPath(appRef, fileRef, destPath, sizeof(destPath)) != LE_OK)
+        {
+            return LE_FAULT;
         }
-        while (le_cfg_GoToNextSibling(cfgIter) == LE_OK);
 
-        le_cfg_GoToParent(cfgIter);
+        if (CreateFileLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
+        {
+            return LE_FAULT;
+        }
     }
 
     return LE_OK;
@@ -2704,82 +2682,61 @@ static le_result_t CreateRequiredLinks
     const char* appDirLabelPtr          ///< [IN] SMACK label to use for created directories.
 )
 {
-    // Get a config iterator for this app.
-    le_cfg_IteratorRef_t appCfg = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
-
     // Go to the required directories section.
-    le_cfg_GoToNode(appCfg, CFG_NODE_REQUIRES);
-    le_cfg_GoToNode(appCfg, CFG_NODE_DIRS);
+    cfgSubtree_NodeRef_t dirRef = GetFirstCfgChild(appRef, CFG_NODE_REQUIRES "/" CFG_NODE_DIRS);
 
-    if (le_cfg_GoToFirstChild(appCfg) == LE_OK)
+    for (; dirRef != NULL; dirRef = cfgSubtree_GetNextSibling(dirRef))
     {
-        do
+        // Get source path.
+        char srcPath[LIMIT_MAX_PATH_BYTES];
+
+        if (GetSrcPath(appRef, dirRef, srcPath, sizeof(srcPath)) != LE_OK)
         {
-            // Get source path.
-            char srcPath[LIMIT_MAX_PATH_BYTES];
+            return LE_FAULT;
+        }
 
-            if (GetSrcPath(appRef, appCfg, srcPath, sizeof(srcPath)) != LE_OK)
-            {
-                le_cfg_CancelTxn(appCfg);
-                return LE_FAULT;
-            }
+        // Get destination path.
+        char destPath[LIMIT_MAX_PATH_BYTES];
+        if (GetDestPath(appRef, dirRef, destPath, sizeof(destPath)) != LE_OK)
+        {
+            return LE_FAULT;
+        }
 
-            // Get destination path.
-            char destPath[LIMIT_MAX_PATH_BYTES];
-            if (GetDestPath(appRef, appCfg, destPath, sizeof(destPath)) != LE_OK)
+        // Treat /dev/shm differently.  These are shared memory expected to be shared between
+        // other apps but also other userland processes.  So export the entire directory.
+        if (le_path_IsEquivalent("/dev/shm", srcPath, "/") ||
+                 le_path_IsSubpath("/dev/shm", srcPath, "/"))
+        {
+            if ((CreateDirLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK) ||
+                (smack_SetLabel(srcPath, "*") != LE_OK))
             {
-                le_cfg_CancelTxn(appCfg);
                 return LE_FAULT;
             }
 
-            // Treat /dev/shm differently.  These are shared memory expected to be shared between
-            // other apps but also other userland processes.  So export the entire directory.
-            if (le_path_IsEquivalent("/dev/shm", srcPath, "/") ||
-                     le_path_IsSubpath("/dev/shm", srcPath, "/"))
-            {
-                if ((CreateDirLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK) ||
-                    (smack_SetLabel(srcPath, "*") != LE_OK))
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
-
-            }
-            else
+        }
+        else
+        {
+            if (CreateDirLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
             {
-                if (CreateDirLink(appRef, appDirLabelPtr, srcPath, destPath) != LE_OK)
-                {
-                    le_cfg_CancelTxn(appCfg);
-                    return LE_FAULT;
-                }
+                return LE_FAULT;
             }
         }
-        while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
-
-        le_cfg_GoToParent(appCfg);
     }
 
     // Go to the requires files section
-    le_cfg_GoToParent(appCfg);
-    le_cfg_GoToNode(appCfg, CFG_NODE_FILES);
-
-    if (CreateRequiredFileLinks(appRef, appDirLabelPtr, appCfg) != LE_OK)
+    if (CreateRequiredFileLinks(appRef, appDirLabelPtr, CFG_NODE_REQUIRES "/" CFG_NODE_FILES)
+        != LE_OK)
     {
-        le_cfg_CancelTxn(appCfg);
         return LE_FAULT;
     }
 
     // Go to the devices section.
-    le_cfg_GoToParent(appCfg);
-    le_cfg_GoToNode(appCfg, CFG_NODE_DEVICES);
-
-    if (CreateRequiredFileLinks(appRef, appDirLabelPtr, appCfg) != LE_OK)
+    if (CreateRequiredFileLinks(appRef, appDirLabelPtr, CFG_NODE_REQUIRES "/" CFG_NODE_DEVICES)
+        != LE_OK)
     {
-        le_cfg_CancelTxn(appCfg);
         return LE_FAULT;
     }
 
-    le_cfg_CancelTxn(appCfg);
     return LE_OK;
 }
 
@@ -2853,6 +2810,63 @@ static le_result_t SetupAppArea
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets up the application execution area, reusing what is still set up from a previous start of
+ * the same version of the app.
+ *
+ * The working area is not torn down when an app stops, and installing or removing an app deletes
+ * its app object, so if the app's hash hasn't changed since the area was set up the default links
+ * and the links to the app's own files are already there.  The links to required directories,
+ * files and devices are still created on every start, as their sources (and the requirements in
+ * the config tree) can change without the app's hash changing.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t PrepareAppArea
+(
+    app_Ref_t appRef                    ///< [IN] The application reference.
+)
+{
+#if LE_CONFIG_SUPERV_SANDBOX_CACHE
+    char hash[LIMIT_MAX_APP_HASH_BYTES] = "";
+
+    if (le_appInfo_GetHash(appRef->name, hash, sizeof(hash)) != LE_OK)
+    {
+        hash[0] = '\0';
+    }
+
+    if ( (hash[0] != '\0') &&
+         (strcmp(hash, appRef->areaHash) == 0) &&
+         ( !appRef->sandboxed || fs_IsMountPoint(appRef->workingDir) ) )
+    {
+        LE_INFO("Reusing app area of '%s'.", appRef->name);
+
+        char appDirLabel[LIMIT_MAX_SMACK_LABEL_BYTES];
+        smack_GetAppAccessLabel(app_GetName(appRef), S_IRWXU, appDirLabel, sizeof(appDirLabel));
+
+        return CreateRequiredLinks(appRef, appDirLabel);
+    }
+
+    appRef->areaHash[0] = '\0';
+
+    if (SetupAppArea(appRef) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    LE_ASSERT(le_utf8_Copy(appRef->areaHash, hash, sizeof(appRef->areaHash), NULL) == LE_OK);
+
+    return LE_OK;
+#else
+    return SetupAppArea(appRef);
+#endif
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Checks whether the destination path conflicts with anything under the specified working
@@ -2939,35 +2953,31 @@ static le_result_t GetKernelModules(app_Ref_t appRef)
     appRef->reqModuleName = LE_SLS_LIST_INIT;
 
     ModNameNode_t* modNameNodePtr;
-    // Get a config iterator for this app.
-    le_cfg_IteratorRef_t iter = le_cfg_CreateReadTxn(appRef->cfgPathRoot);
 
     // Go to the required kernelModules section.
-    le_cfg_GoToNode(iter, CFG_NODE_REQUIRES "/" CFG_NODE_KERNELMODULES);
+    cfgSubtree_NodeRef_t modRef = GetFirstCfgChild(appRef,
+                                                   CFG_NODE_REQUIRES "/" CFG_NODE_KERNELMODULES);
 
-    if (le_cfg_GoToFirstChild(iter) == LE_OK)
+    for (; modRef != NULL; modRef = cfgSubtree_GetNextSibling(modRef))
     {
-        do
-        {
-            modNameNodePtr = le_mem_ForceAlloc(ReqModStringPool);
-            modNameNodePtr->link = LE_SLS_LINK_INIT;
+        modNameNodePtr = le_mem_ForceAlloc(ReqModStringPool);
+        modNameNodePtr->link = LE_SLS_LINK_INIT;
 
-            le_cfg_GetNodeName(iter, "", modNameNodePtr->modName, sizeof(modNameNodePtr->modName));
+        cfgSubtree_GetNodeName(modRef,
+                               "",
+                               modNameNodePtr->modName,
+                               sizeof(modNameNodePtr->modName));
 
-            if (strncmp(modNameNodePtr->modName, "", sizeof(modNameNodePtr->modName)) == 0)
-            {
-                LE_WARN("Found empty kernel module dependency");
-                le_mem_Release(modNameNodePtr);
-                continue;
-            }
-
-            modNameNodePtr->isOptional = le_cfg_GetBool(iter, "isOptional", false);
-            le_sls_Queue(&(appRef->reqModuleName), &(modNameNodePtr->link));
+        if (strncmp(modNameNodePtr->modName, "", sizeof(modNameNodePtr->modName)) == 0)
+        {
+            LE_WARN("Found empty kernel module dependency");
+            le_mem_Release(modNameNodePtr);
+            continue;
         }
-        while (le_cfg_GoToNextSibling(iter) == LE_OK);
-    }
 
-    le_cfg_CancelTxn(iter);
+        modNameNodePtr->isOptional = cfgSubtree_GetBool(modRef, "isOptional", false);
+        le_sls_Queue(&(appRef->reqModuleName), &(modNameNodePtr->link));
+    }
 
     if (!le_sls_IsEmpty(&(appRef->reqModuleName)))
     {
@@ -3255,14 +3265,29 @@ app_Ref_t app_Create
     appPtr->additionalLinks = LE_SLS_LIST_INIT;
     appPtr->state = APP_STATE_STOPPED;
     appPtr->killTimer = NULL;
+    appPtr->areaHash[0] = '\0';
 
     LE_INFO("Creating app '%s'", appPtr->name);
 
-    // Get a config iterator for this app.
+    // Read the app's config in one go; everything the app object needs from it is read from this
+    // copy.
     le_cfg_IteratorRef_t cfgIterator = le_cfg_CreateReadTxn(appPtr->cfgPathRoot);
+    le_result_t result = cfgSubtree_Read(cfgIterator, "", &appPtr->cfgRef);
+
+    le_cfg_CancelTxn(cfgIterator);
+
+    if (result != LE_OK)
+    {
+        LE_ERROR("Could not read the config of app '%s' (%s).",
+                 appPtr->name,
+                 LE_RESULT_TXT(result));
+
+        le_mem_Release(appPtr);
+        return NULL;
+    }
 
     // See if this is a sandboxed app.
-    appPtr->sandboxed = le_cfg_GetBool(cfgIterator, CFG_NODE_SANDBOXED, true);
+    appPtr->sandboxed = cfgSubtree_GetBool(appPtr->cfgRef, CFG_NODE_SANDBOXED, true);
 
     // @todo: Create the user and all the groups for this app.  This function has a side affect
     //        where it populates the app's supplementary groups list and sets the uid and the
@@ -3303,47 +3328,46 @@ app_Ref_t app_Create
         goto failed;
     }
 
-    // Move the config iterator to the procs list for this app.
-    le_cfg_GoToNode(cfgIterator, CFG_NODE_PROC_LIST);
+    // Read the list of processes for this application from the config.
+    cfgSubtree_NodeRef_t procRef = GetFirstCfgChild(appPtr, CFG_NODE_PROC_LIST);
 
-    // Read the list of processes for this application from the config tree.
-    if (le_cfg_GoToFirstChild(cfgIterator) == LE_OK)
+    for (; procRef != NULL; procRef = cfgSubtree_GetNextSibling(procRef))
     {
-        do
-        {
-            // Get the process's config path.
-            char procCfgPath[LIMIT_MAX_PATH_BYTES];
-
-            if (le_cfg_GetPath(cfgIterator, "", procCfgPath, sizeof(procCfgPath)) == LE_OVERFLOW)
-            {
-                LE_ERROR("Internal path buffer too small.");
-                goto failed;
-            }
+        // Get the process name.
+        char procName[LIMIT_MAX_PROCESS_NAME_BYTES];
 
-            // Strip off the trailing '/'.
-            size_t lastIndex = le_utf8_NumBytes(procCfgPath) - 1;
+        if (cfgSubtree_GetNodeName(procRef, "", procName, sizeof(procName)) != LE_OK)
+        {
+            LE_ERROR("Process name in app '%s' is too long.", appPtr->name);
+            goto failed;
+        }
 
-            if (procCfgPath[lastIndex] == '/')
-            {
-                procCfgPath[lastIndex] = '\0';
-            }
+        // Get the process's config path.
+        char procCfgPath[LIMIT_MAX_PATH_BYTES] = "";
 
-            // Get the process name.
-            char* procNamePtr = le_path_GetBasenamePtr(procCfgPath, "/");
+        if (le_path_Concat("/",
+                           procCfgPath,
+                           sizeof(procCfgPath),
+                           appPtr->cfgPathRoot,
+                           CFG_NODE_PROC_LIST,
+                           procName,
+                           NULL) != LE_OK)
+        {
+            LE_ERROR("Internal path buffer too small.");
+            goto failed;
+        }
 
-            // Create the process.
-            proc_Ref_t procPtr;
-            if ((procPtr = proc_Create(procNamePtr, appPtr, procCfgPath)) == NULL)
-            {
-                goto failed;
-            }
+        // Create the process.
+        proc_Ref_t procPtr;
+        if ((procPtr = proc_Create(procName, appPtr, procCfgPath)) == NULL)
+        {
+            goto failed;
+        }
 
-            // Add the process to the app's process list.
-            ProcContainer_t* procContainerPtr = CreateProcContainer(appPtr, procPtr);
+        // Add the process to the app's process list.
+        ProcContainer_t* procContainerPtr = CreateProcContainer(appPtr, procPtr);
 
-            le_dls_Queue(&(appPtr->procs), &(procContainerPtr->link));
-        }
-        while (le_cfg_GoToNextSibling(cfgIterator) == LE_OK);
+        le_dls_Queue(&(appPtr->procs), &(procContainerPtr->link));
     }
 
     // Set the resource limit for this application.
@@ -3365,13 +3389,11 @@ app_Ref_t app_Create
 
     file_WriteStr(notifyPath, "1", 0);
 
-    le_cfg_CancelTxn(cfgIterator);
     return appPtr;
 
 failed:
 
     app_Delete(appPtr);
-    le_cfg_CancelTxn(cfgIterator);
     return NULL;
 }
 
@@ -3450,6 +3472,12 @@ void app_Delete
         le_timer_Delete(appRef->killTimer);
     }
 
+    // Release the copy of the app's config.
+    if (appRef->cfgRef != NULL)
+    {
+        cfgSubtree_Delete(appRef->cfgRef);
+    }
+
     // Release app.
     le_mem_Release(appRef);
 }
@@ -3487,6 +3515,8 @@ le_result_t app_Start
         return LE_FAULT;
     }
 
+    bootProfile_Record(appRef->name, "start", NULL);
+
     // Install the required kernel modules
     if (GetKernelModules(appRef) != LE_OK)
     {
@@ -3498,8 +3528,9 @@ le_result_t app_Start
 
     // Set SMACK rules for this app.
     // Setup the runtime area in the file system.
+    bootProfile_Record(appRef->name, "setUpSandbox", NULL);
     if ( (SetSmackRules(appRef) != LE_OK) ||
-         (SetupAppArea(appRef) != LE_OK) )
+         (PrepareAppArea(appRef) != LE_OK) )
     {
         LE_ERROR("Failed to set Smack rules or set up app area.");
         return LE_FAULT;
@@ -3526,6 +3557,7 @@ le_result_t app_Start
     }
 
     // Start all the processes in the application.
+    bootProfile_Record(appRef->name, "startProcs", NULL);
     le_dls_Link_t* procLinkPtr = le_dls_Peek(&(appRef->procs));
 
     while (procLinkPtr != NULL)
@@ -3709,23 +3741,29 @@ app_ProcState_t app_GetProcState
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Checks if a given app is running a top-level process with given PID.
+ * Finds the app running a top-level process with given PID.
  *
  * An app's top-level processes are those that are started by the Supervisor directly.
  * If the Supervisor starts a process and that process starts another process, this function
  * will not find that second process.
  *
  * @return
- *      true if the process is one of this app's top-level processes, false if not.
+ *      The app, or NULL if the process is not a top-level process of any app.
  */
 //--------------------------------------------------------------------------------------------------
-bool app_HasTopLevelProc
+app_Ref_t app_FindByTopLevelProc
 (
-    app_Ref_t appRef,
     pid_t pid
 )
 {
-    return (FindProcContainer(appRef, pid) != NULL);
+    proc_Ref_t procRef = proc_FindByPid(pid);
+
+    if (procRef == NULL)
+    {
+        return NULL;
+    }
+
+    return proc_GetApp(procRef);
 }
 
 
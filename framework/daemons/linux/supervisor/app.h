@@ -215,19 +215,18 @@ app_ProcState_t app_GetProcState
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Checks if a given app is running a top-level process with given PID.
+ * Finds the app running a top-level process with given PID.
  *
  * An app's top-level processes are those that are started by the Supervisor directly.
  * If the Supervisor starts a process and that process starts another process, this function
  * will not find that second process.
  *
  * @return
- *      true if the process is one of this app's top-level processes, false if not.
+ *      The app, or NULL if the process is not a top-level process of any app.
  */
 //--------------------------------------------------------------------------------------------------
-bool app_HasTopLevelProc
+app_Ref_t app_FindByTopLevelProc
 (
-    app_Ref_t appRef,
     pid_t pid
 );
 
@@ -39,6 +39,17 @@
  * means we do not have to recreate app containers each time.  App containers are only cleaned when
  * the app is uninstalled.
  *
+ * @section c_apps_autoStart Auto-Start
+ *
+ * At start-up, the apps that are not marked "startManual" are launched in start levels worked out
+ * from their bindings: an app that binds to no other auto-started app is at level 0, and any other
+ * app is one level above the highest of the auto-started apps it binds to.  Apps are launched
+ * level by level, so that servers are launched before their clients and clients don't sit waiting
+ * for their services to be advertised.  Each launch is queued to the event loop separately, so the
+ * processes of the apps already launched get going while the rest are set up, and the Supervisor
+ * keeps serving IPC requests and SIGCHLDs throughout.  When and at what level each app was launched
+ * is kept, and can be fetched with le_appCtrl_GetStartTimes().
+ *
  * @section c_apps_appProcs Application Processes
  *
  * Generally the processes in an application are encapsulated and handled by the application class
@@ -204,6 +215,15 @@ static le_ref_MapRef_t AppMap;
 static le_ref_MapRef_t AppAttachHandlerMap;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map of app containers, by app reference.  Used to find the app a dead child process was part
+ * of without searching the active apps.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t AppContainerMap;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * List of all active app containers.
@@ -220,6 +240,40 @@ static le_dls_List_t ActiveAppsList = LE_DLS_LIST_INIT;
 static le_dls_List_t InactiveAppsList = LE_DLS_LIST_INIT;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Cached hash of an installed app, read from its info file.  The identity of the info file is kept
+ * with it, so a reinstalled app (whose info file is a new file) is noticed without re-reading it.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char            name[LIMIT_MAX_APP_NAME_BYTES];     ///< App name (key in AppHashMap).
+    dev_t           dev;                                ///< Device of the info file.
+    ino_t           ino;                                ///< Inode of the info file.
+    struct timespec mtime;                              ///< Modification time of the info file.
+    char            hash[LIMIT_MAX_APP_HASH_BYTES];     ///< App hash.
+}
+AppHash_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool for cached app hashes.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t AppHashPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map of cached app hashes, by app name.  Entries are dropped when an app is installed or
+ * uninstalled.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t AppHashMap;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Application Process object container.
@@ -250,6 +304,66 @@ static le_mem_PoolRef_t AppProcContainerPool;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t AppProcMap;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * An auto-started app, and its entry in the start-up timeline.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t   link;                       ///< Link in the AutoStartList.
+    char            name[LIMIT_MAX_APP_NAME_BYTES]; ///< Name of the app.
+    le_sls_List_t   serverList;                 ///< Auto-started apps this app binds to
+                                                ///  (AutoStartServer_t).
+    bool            hasLevel;                   ///< true once the start level has been worked out.
+    uint32_t        level;                      ///< Start level.
+    bool            isLaunched;                 ///< true once the app has been launched.
+    le_result_t     result;                     ///< Result of launching the app.
+    le_clk_Time_t   launchStart;                ///< When the launch began (relative time).
+    le_clk_Time_t   launchEnd;                  ///< When the launch finished (relative time).
+}
+AutoStartApp_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Entry in an auto-started app's list of the auto-started apps it binds to.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_sls_Link_t       link;           ///< Link in the client's serverList.
+    AutoStartApp_t*     serverPtr;      ///< The server app.
+}
+AutoStartServer_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pools for auto-started apps and their server lists.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t AutoStartAppPool;
+static le_mem_PoolRef_t AutoStartServerPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Apps being (or that were) auto-started, in launch order once the start levels are known.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t AutoStartList = LE_DLS_LIST_INIT;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Next app in the AutoStartList to launch, or NULL if all have been launched (or auto-start was
+ * cancelled by a shutdown).
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_Link_t* NextAutoStartLinkPtr = NULL;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Timeout value for waiting processes to exit for an app.
@@ -353,6 +467,7 @@ static void DeleteApp
     // Reset the additional link overrides here too because it is persistent in the file system.
     app_RemoveAllLinks(appContainerPtr->appRef);
 
+    le_hashmap_Remove(AppContainerMap, appContainerPtr->appRef);
     app_Delete(appContainerPtr->appRef);
 
     le_mem_Release(appContainerPtr);
@@ -536,21 +651,21 @@ static AppContainer_t* GetActiveAppWithProc
     pid_t pid
 )
 {
-    le_dls_Link_t* appLinkPtr = le_dls_Peek(&ActiveAppsList);
+    app_Ref_t appRef = app_FindByTopLevelProc(pid);
 
-    while (appLinkPtr != NULL)
+    if (appRef == NULL)
     {
-        AppContainer_t* appContainerPtr = CONTAINER_OF(appLinkPtr, AppContainer_t, link);
+        return NULL;
+    }
 
-        if (app_HasTopLevelProc(appContainerPtr->appRef, pid))
-        {
-            return appContainerPtr;
-        }
+    AppContainer_t* appContainerPtr = le_hashmap_Get(AppContainerMap, appRef);
 
-        appLinkPtr = le_dls_PeekNext(&ActiveAppsList, appLinkPtr);
+    if ((appContainerPtr == NULL) || !appContainerPtr->isActive)
+    {
+        return NULL;
     }
 
-    return NULL;
+    return appContainerPtr;
 }
 
 
@@ -626,6 +741,7 @@ static le_result_t CreateApp
 
     containerPtr->appRef = appRef;
     containerPtr->link = LE_DLS_LINK_INIT;
+    le_hashmap_Put(AppContainerMap, appRef, containerPtr);
     containerPtr->stopHandler = NULL;
     containerPtr->clientRef = NULL;
     containerPtr->traceAttachHandler = NULL;
@@ -895,6 +1011,26 @@ static void DeletesInactiveApp
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drops the cached hash of an app that is being installed or uninstalled.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ForgetAppHash
+(
+    const char* appName,  ///< App being installed or removed.
+    void* contextPtr      ///< Context for this function.  Not used.
+)
+{
+    AppHash_t* appHashPtr = le_hashmap_Remove(AppHashMap, appName);
+
+    if (appHashPtr != NULL)
+    {
+        le_mem_Release(appHashPtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Deletes all inactive app objects.
@@ -1324,13 +1460,22 @@ void apps_Init
     // Create memory pools.
     AppContainerPool = le_mem_CreatePool("appContainers", sizeof(AppContainer_t));
     AppProcContainerPool = le_mem_CreatePool("appProcContainers", sizeof(AppProcContainer_t));
+    AutoStartAppPool = le_mem_CreatePool("autoStartApps", sizeof(AutoStartApp_t));
+    AutoStartServerPool = le_mem_CreatePool("autoStartServers", sizeof(AutoStartServer_t));
 
     AppProcMap = le_ref_CreateMap("AppProcs", 5);
     AppMap = le_ref_CreateMap("App", 5);
     AppAttachHandlerMap = le_ref_CreateMap("AppAttachHandlers", 5);
+    AppContainerMap = le_hashmap_Create("AppContainers", 31, le_hashmap_HashVoidPointer,
+                                        le_hashmap_EqualsVoidPointer);
+    AppHashPool = le_mem_CreatePool("appHashes", sizeof(AppHash_t));
+    AppHashMap = le_hashmap_Create("AppHashes", 31, le_hashmap_HashString,
+                                   le_hashmap_EqualsString);
 
     le_instStat_AddAppUninstallEventHandler(DeletesInactiveApp, NULL);
     le_instStat_AddAppInstallEventHandler(DeletesInactiveApp, NULL);
+    le_instStat_AddAppUninstallEventHandler(ForgetAppHash, NULL);
+    le_instStat_AddAppInstallEventHandler(ForgetAppHash, NULL);
 
     le_msg_AddServiceCloseHandler(le_appProc_GetServiceRef(), DeleteClientAppProcs, NULL);
 
@@ -1360,6 +1505,9 @@ void apps_Shutdown
     void
 )
 {
+    // Don't launch any more auto-started apps.
+    NextAutoStartLinkPtr = NULL;
+
     // Deletes all inactive apps first.
     DeletesAllInactiveApp();
 
@@ -1412,9 +1560,293 @@ void apps_SetShutdownHandler
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds an app in the AutoStartList.
+ *
+ * @return
+ *      The app, or NULL if it is not being auto-started.
+ */
+//--------------------------------------------------------------------------------------------------
+static AutoStartApp_t* FindAutoStartApp
+(
+    const char* appName                 ///< [IN] Name of the app.
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&AutoStartList);
+
+    while (linkPtr != NULL)
+    {
+        AutoStartApp_t* appPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, link);
+
+        if (strcmp(appPtr->name, appName) == 0)
+        {
+            return appPtr;
+        }
+
+        linkPtr = le_dls_PeekNext(&AutoStartList, linkPtr);
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the bindings of an auto-started app, and records which other auto-started apps it binds
+ * to.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReadAutoStartServers
+(
+    AutoStartApp_t* appPtr              ///< [IN] The client app.
+)
+{
+    le_cfg_IteratorRef_t bindCfg = le_cfg_CreateReadTxn(CFG_NODE_APPS_LIST);
+    le_cfg_GoToNode(bindCfg, appPtr->name);
+    le_cfg_GoToNode(bindCfg, "bindings");
+
+    if (le_cfg_GoToFirstChild(bindCfg) != LE_OK)
+    {
+        // No bindings.
+        le_cfg_CancelTxn(bindCfg);
+        return;
+    }
+
+    do
+    {
+        char serverName[LIMIT_MAX_APP_NAME_BYTES];
+
+        if ( (le_cfg_GetString(bindCfg, "app", serverName, sizeof(serverName), "") != LE_OK) ||
+             (strcmp(serverName, appPtr->name) == 0) )
+        {
+            continue;
+        }
+
+        // Only other auto-started apps matter; anything else is either already running (the
+        // framework daemons) or will be started later by someone else.
+        AutoStartApp_t* serverPtr = FindAutoStartApp(serverName);
+
+        if (serverPtr == NULL)
+        {
+            continue;
+        }
+
+        // Bind to each server once, however many of its interfaces are used.
+        le_sls_Link_t* linkPtr = le_sls_Peek(&appPtr->serverList);
+
+        while ( (linkPtr != NULL) &&
+                (CONTAINER_OF(linkPtr, AutoStartServer_t, link)->serverPtr != serverPtr) )
+        {
+            linkPtr = le_sls_PeekNext(&appPtr->serverList, linkPtr);
+        }
+
+        if (linkPtr == NULL)
+        {
+            AutoStartServer_t* entryPtr = le_mem_ForceAlloc(AutoStartServerPool);
+
+            entryPtr->link = LE_SLS_LINK_INIT;
+            entryPtr->serverPtr = serverPtr;
+            le_sls_Queue(&appPtr->serverList, &entryPtr->link);
+        }
+    }
+    while (le_cfg_GoToNextSibling(bindCfg) == LE_OK);
+
+    le_cfg_CancelTxn(bindCfg);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tries to work out an auto-started app's start level from the levels of its servers.
+ *
+ * @return
+ *      true if the level is known.  false if some of the app's servers don't have a level yet.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool SetAutoStartLevel
+(
+    AutoStartApp_t* appPtr,             ///< [IN] The app.
+    bool            isForced            ///< [IN] true = ignore servers that have no level yet.
+)
+{
+    uint32_t level = 0;
+    le_sls_Link_t* linkPtr = le_sls_Peek(&appPtr->serverList);
+
+    while (linkPtr != NULL)
+    {
+        AutoStartApp_t* serverPtr = CONTAINER_OF(linkPtr, AutoStartServer_t, link)->serverPtr;
+
+        if (serverPtr->hasLevel)
+        {
+            if (serverPtr->level >= level)
+            {
+                level = serverPtr->level + 1;
+            }
+        }
+        else if (!isForced)
+        {
+            return false;
+        }
+
+        linkPtr = le_sls_PeekNext(&appPtr->serverList, linkPtr);
+    }
+
+    appPtr->level = level;
+    appPtr->hasLevel = true;
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Works out the start levels of all auto-started apps, and sorts the AutoStartList by level
+ * (keeping the config order within each level).
+ */
+//--------------------------------------------------------------------------------------------------
+static void SortAutoStartList
+(
+    void
+)
+{
+    size_t numLeft = le_dls_NumLinks(&AutoStartList);
+    uint32_t maxLevel = 0;
+
+    while (numLeft > 0)
+    {
+        size_t numSet = 0;
+        AutoStartApp_t* firstLeftPtr = NULL;
+        le_dls_Link_t* linkPtr = le_dls_Peek(&AutoStartList);
+
+        while (linkPtr != NULL)
+        {
+            AutoStartApp_t* appPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, link);
+
+            if (!appPtr->hasLevel)
+            {
+                if (SetAutoStartLevel(appPtr, false))
+                {
+                    numSet++;
+                }
+                else if (firstLeftPtr == NULL)
+                {
+                    firstLeftPtr = appPtr;
+                }
+            }
+
+            linkPtr = le_dls_PeekNext(&AutoStartList, linkPtr);
+        }
+
+        if (numSet == 0)
+        {
+            // The remaining apps bind to each other in a cycle.  Break it at the first one.
+            LE_WARN("App '%s' is in a cycle of bindings between auto-started apps.",
+                    firstLeftPtr->name);
+            SetAutoStartLevel(firstLeftPtr, true);
+            numSet = 1;
+        }
+
+        numLeft -= numSet;
+    }
+
+    // Sort by level.  The list is short, so just pull out one level at a time.
+    le_dls_Link_t* linkPtr = le_dls_Peek(&AutoStartList);
+
+    while (linkPtr != NULL)
+    {
+        AutoStartApp_t* appPtr = CONTAINER_OF(linkPtr, AutoStartApp_t, link);
+
+        if (appPtr->level > maxLevel)
+        {
+            maxLevel = appPtr->level;
+        }
+
+        linkPtr = le_dls_PeekNext(&AutoStartList, linkPtr);
+    }
+
+    le_dls_List_t sortedList = LE_DLS_LIST_INIT;
+    uint32_t level;
+
+    for (level = 0; level <= maxLevel; level++)
+    {
+        linkPtr = le_dls_Peek(&AutoStartList);
+
+        while (linkPtr != NULL)
+        {
+            le_dls_Link_t* nextLinkPtr = le_dls_PeekNext(&AutoStartList, linkPtr);
+
+            if (CONTAINER_OF(linkPtr, AutoStartApp_t, link)->level == level)
+            {
+                le_dls_Remove(&AutoStartList, linkPtr);
+                le_dls_Queue(&sortedList, linkPtr);
+            }
+
+            linkPtr = nextLinkPtr;
+        }
+    }
+
+    AutoStartList = sortedList;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Launches the next auto-started app, then queues itself to launch the one after.
+ *
+ * Apps are launched one per pass of the event loop so that the Supervisor keeps handling IPC and
+ * SIGCHLDs (from the apps already launched) while the rest are launched.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LaunchNextAutoStartApp
+(
+    void* param1Ptr,                    ///< [IN] Not used.
+    void* param2Ptr                     ///< [IN] Not used.
+)
+{
+    LE_UNUSED(param1Ptr);
+    LE_UNUSED(param2Ptr);
+
+    if (NextAutoStartLinkPtr == NULL)
+    {
+        return;
+    }
+
+    AutoStartApp_t* appPtr = CONTAINER_OF(NextAutoStartLinkPtr, AutoStartApp_t, link);
+    NextAutoStartLinkPtr = le_dls_PeekNext(&AutoStartList, NextAutoStartLinkPtr);
+
+    LE_DEBUG("Auto-starting app '%s' (level %" PRIu32 ").", appPtr->name, appPtr->level);
+
+    appPtr->launchStart = le_clk_GetRelativeTime();
+
+    // No need to check the result because there is nothing we can do about errors, but it is kept
+    // for the start-up timeline.
+    appPtr->result = LaunchApp(appPtr->name);
+
+    appPtr->launchEnd = le_clk_GetRelativeTime();
+    appPtr->isLaunched = true;
+
+    if (NextAutoStartLinkPtr != NULL)
+    {
+        le_event_QueueFunction(LaunchNextAutoStartApp, NULL, NULL);
+    }
+    else
+    {
+        AutoStartApp_t* firstPtr = CONTAINER_OF(le_dls_Peek(&AutoStartList), AutoStartApp_t, link);
+        le_clk_Time_t duration = le_clk_Sub(appPtr->launchEnd, firstPtr->launchStart);
+
+        LE_INFO("Auto-started %" PRIuS " apps in %" PRIu32 " levels in %ld ms.",
+                le_dls_NumLinks(&AutoStartList), appPtr->level + 1,
+                (long)(duration.sec * 1000 + duration.usec / 1000));
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Start all applications marked as 'auto' start.
+ *
+ * The apps are launched asynchronously, in start levels.  See @ref c_apps_autoStart.
  */
 //--------------------------------------------------------------------------------------------------
 void apps_AutoStart
@@ -1422,6 +1854,8 @@ void apps_AutoStart
     void
 )
 {
+    LE_FATAL_IF(!le_dls_IsEmpty(&AutoStartList), "Apps already auto-started.");
+
     // Read the list of applications from the config tree.
     le_cfg_IteratorRef_t appCfg = le_cfg_CreateReadTxn(CFG_NODE_APPS_LIST);
 
@@ -1450,15 +1884,37 @@ void apps_AutoStart
             }
             else
             {
-                // Launch the application now.  No need to check the return code because there is
-                // nothing we can do about errors.
-                LaunchApp(appName);
+                AutoStartApp_t* appPtr = le_mem_ForceAlloc(AutoStartAppPool);
+
+                memset(appPtr, 0, sizeof(*appPtr));
+                appPtr->link = LE_DLS_LINK_INIT;
+                appPtr->serverList = LE_SLS_LIST_INIT;
+                LE_ASSERT(le_utf8_Copy(appPtr->name, appName, sizeof(appPtr->name), NULL) == LE_OK);
+
+                le_dls_Queue(&AutoStartList, &appPtr->link);
             }
         }
     }
     while (le_cfg_GoToNextSibling(appCfg) == LE_OK);
 
     le_cfg_CancelTxn(appCfg);
+
+    // Work out the launch order from the bindings between the apps.
+    le_dls_Link_t* linkPtr = le_dls_Peek(&AutoStartList);
+
+    while (linkPtr != NULL)
+    {
+        ReadAutoStartServers(CONTAINER_OF(linkPtr, AutoStartApp_t, link));
+        linkPtr = le_dls_PeekNext(&AutoStartList, linkPtr);
+    }
+
+    SortAutoStartList();
+
+    NextAutoStartLinkPtr = le_dls_Peek(&AutoStartList);
+    if (NextAutoStartLinkPtr != NULL)
+    {
+        le_event_QueueFunction(LaunchNextAutoStartApp, NULL, NULL);
+    }
 }
 
 
@@ -2168,6 +2624,51 @@ void le_appCtrl_Stop
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets an app's start level, and when it was launched, during the auto-start of apps.  This
+ * function is called by the event loop when a separate process requests the start-up timeline.
+ *
+ * @note
+ *   The result code for this command should be sent back to the requesting process via
+ *   le_appCtrl_GetStartTimesRespond(). The possible result codes are:
+ *
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the app was not auto-started.
+ *      LE_BUSY if the app has not been launched yet.
+ *      LE_FAULT if the app failed to launch (the times are still valid).
+ */
+//--------------------------------------------------------------------------------------------------
+void le_appCtrl_GetStartTimes
+(
+    le_appCtrl_ServerCmdRef_t cmdRef,   ///< [IN] Command reference that must be passed to this
+                                        ///       command's response function.
+    const char* appName                 ///< [IN] Name of the app.
+)
+{
+    AutoStartApp_t* appPtr = FindAutoStartApp(appName);
+
+    if (appPtr == NULL)
+    {
+        le_appCtrl_GetStartTimesRespond(cmdRef, LE_NOT_FOUND, 0, 0, 0);
+    }
+    else if (!appPtr->isLaunched)
+    {
+        le_appCtrl_GetStartTimesRespond(cmdRef, LE_BUSY, appPtr->level, 0, 0);
+    }
+    else
+    {
+        le_appCtrl_GetStartTimesRespond(cmdRef,
+                                        (appPtr->result == LE_OK) ? LE_OK : LE_FAULT,
+                                        appPtr->level,
+                                        (uint64_t)appPtr->launchStart.sec * 1000 +
+                                            appPtr->launchStart.usec / 1000,
+                                        (uint64_t)appPtr->launchEnd.sec * 1000 +
+                                            appPtr->launchEnd.usec / 1000);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the state of the specified application.  The state of unknown applications is STOPPED.
@@ -2310,6 +2811,18 @@ le_result_t le_appInfo_GetName
         ///< [IN]
 )
 {
+    // The top-level processes of running apps are known already, so there is no need to read the
+    // process's cgroup for them.
+    AppContainer_t* appContainerPtr = GetActiveAppWithProc(pid);
+
+    if (appContainerPtr != NULL)
+    {
+        return le_utf8_Copy(appName,
+                            app_GetName(appContainerPtr->appRef),
+                            appNameNumElements,
+                            NULL);
+    }
+
     char cgroupFilePath[LIMIT_MAX_PATH_BYTES] = {0};
 
     LE_ASSERT(snprintf(cgroupFilePath, sizeof(cgroupFilePath), "/proc/%d/cgroup", pid)
@@ -2392,6 +2905,8 @@ le_result_t le_appInfo_GetName
  *
  * @note If the application name pointer is null or if its string is empty or of bad format it is a
  *       fatal error, the function will not return.
+ *
+ * @note The hash is cached, and the info file is only read again if it has been replaced.
  */
 //--------------------------------------------------------------------------------------------------
 le_result_t le_appInfo_GetHash
@@ -2441,21 +2956,54 @@ le_result_t le_appInfo_GetHash
         return LE_FAULT;
     }
 
+    // Use the cached hash if the info file hasn't changed since it was read.
+    AppHash_t* appHashPtr = le_hashmap_Get(AppHashMap, appName);
+
+    if (   (appHashPtr != NULL)
+        && (appHashPtr->dev == statBuf.st_dev)
+        && (appHashPtr->ino == statBuf.st_ino)
+        && (appHashPtr->mtime.tv_sec == statBuf.st_mtim.tv_sec)
+        && (appHashPtr->mtime.tv_nsec == statBuf.st_mtim.tv_nsec))
+    {
+        return le_utf8_Copy(hashStr, appHashPtr->hash, hashStrNumElements, NULL);
+    }
+
     // Get the md5 hash for the app's info.properties file.
+    char hash[LIMIT_MAX_APP_HASH_BYTES];
     le_result_t result = properties_GetValueForKey(infoFilePath,
                                                    KEY_STR_MD5,
-                                                   hashStr,
-                                                   hashStrNumElements);
+                                                   hash,
+                                                   sizeof(hash));
 
     switch(result)
     {
         case LE_OK:
+            break;
+
         case LE_OVERFLOW:
+            le_utf8_Copy(hashStr, hash, hashStrNumElements, NULL);
             return result;
 
         default:
             return LE_FAULT;
     }
+
+    if ((appHashPtr == NULL) && (strlen(appName) < LIMIT_MAX_APP_NAME_BYTES))
+    {
+        appHashPtr = le_mem_ForceAlloc(AppHashPool);
+        LE_ASSERT(le_utf8_Copy(appHashPtr->name, appName, sizeof(appHashPtr->name), NULL) == LE_OK);
+        le_hashmap_Put(AppHashMap, appHashPtr->name, appHashPtr);
+    }
+
+    if (appHashPtr != NULL)
+    {
+        appHashPtr->dev = statBuf.st_dev;
+        appHashPtr->ino = statBuf.st_ino;
+        appHashPtr->mtime = statBuf.st_mtim;
+        LE_ASSERT(le_utf8_Copy(appHashPtr->hash, hash, sizeof(appHashPtr->hash), NULL) == LE_OK);
+    }
+
+    return le_utf8_Copy(hashStr, hash, hashStrNumElements, NULL);
 }
 
 
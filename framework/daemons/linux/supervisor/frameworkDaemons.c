@@ -8,11 +8,13 @@
  */
 #include "legato.h"
 #include "frameworkDaemons.h"
+#include "bootProfile.h"
 #include "limit.h"
 #include "fileDescriptor.h"
 #include "killProc.h"
 #include "smack.h"
 #include "sysPaths.h"
+#include "unixSocket.h"
 #include "wait.h"
 
 
@@ -25,6 +27,12 @@ typedef struct
 {
     char            path[LIMIT_MAX_PATH_BYTES];     // Path to the daemon's executable.
     pid_t           pid;                            // The daemon's pid.
+    int             syncFd;                         // Read end of the daemon's synchronization
+                                                    // pipe, or -1 once the daemon is ready.
+    bool            afterPrevious;                  // Wait for the daemons before this one to be
+                                                    // ready before starting it.
+    bool            sdirSockets;                    // Create the Service Directory's sockets
+                                                    // before starting it.
 }
 DaemonObj_t;
 
@@ -46,7 +54,8 @@ DaemonObj_t;
  *          consideration.
  *
  * - The Service Directory must be the first framework daemon in this list.  Everything else needs
- *   it for IPC.
+ *   it for IPC.  Its sockets are created before it is started, so the daemons after it can connect
+ *   to it while it is still initializing (see @ref sd_startUpSync).
  *
  * - The Log Control Daemon is second because everything else uses logging.
  *
@@ -56,14 +65,23 @@ DaemonObj_t;
  *   Update Daemon may need to finish a system update.
  *
  * - The Watchdog Daemon fetches watchdog settings from the system configuration tree.
+ *
+ * With SUPERV_PARALLEL_DAEMONS, a daemon is started without waiting for the ones before it to be
+ * ready unless it is marked afterPrevious.  The Log Control Daemon, Config Tree and Update Daemon
+ * only talk to the daemons before them through IPC, which waits for the services it needs to be
+ * advertised, so they can initialize in parallel.  The Watchdog Daemon reads the configuration the
+ * Update Daemon may be updating, so it waits.
  */
 //--------------------------------------------------------------------------------------------------
 
-static DaemonObj_t FrameworkDaemons[] = { {SYSTEM_BIN_PATH "/serviceDirectory", -1},
-                                          {SYSTEM_BIN_PATH "/logCtrlDaemon", -1},
-                                          {SYSTEM_BIN_PATH "/configTree", -1},
-                                          {SYSTEM_BIN_PATH "/updateDaemon", -1},
-                                          {SYSTEM_BIN_PATH "/watchdog", -1} };
+static DaemonObj_t FrameworkDaemons[] =
+{
+    { SYSTEM_BIN_PATH "/serviceDirectory", -1, -1, false, true  },
+    { SYSTEM_BIN_PATH "/logCtrlDaemon",    -1, -1, false, false },
+    { SYSTEM_BIN_PATH "/configTree",       -1, -1, false, false },
+    { SYSTEM_BIN_PATH "/updateDaemon",     -1, -1, false, false },
+    { SYSTEM_BIN_PATH "/watchdog",         -1, -1, true,  false }
+};
 
 
 //--------------------------------------------------------------------------------------------------
@@ -202,7 +220,140 @@ static void SigChldStartingHandler
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Start a framework daemon.
+ * Opens one of the Service Directory's sockets and starts it listening.  Any socket left over
+ * from a previous run is replaced.
+ *
+ * @return File descriptor of the socket.
+ *
+ * @note Called in the child process; terminates it on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static int OpenSdirSocket
+(
+    const char* socketPathStr   ///< [IN] File system path of the socket.
+)
+{
+    int fd = unixSocket_CreateSeqPacketNamed(socketPathStr);
+
+    if (fd == LE_DUPLICATE)
+    {
+        LE_FATAL_IF(unlink(socketPathStr) != 0,
+                    "Couldn't unlink '%s' to make way for new socket.  %m.", socketPathStr);
+        fd = unixSocket_CreateSeqPacketNamed(socketPathStr);
+    }
+
+    LE_FATAL_IF(fd < 0,
+                "Failed to open socket '%s'. Result = %d (%s).",
+                socketPathStr,
+                fd,
+                LE_RESULT_TXT(fd));
+
+    LE_FATAL_IF(listen(fd, SOMAXCONN) != 0, "Socket '%s' listen() failed.  %m.", socketPathStr);
+
+    return fd;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates the Service Directory's sockets and passes them on to it, then tells the Supervisor
+ * that they exist by writing a byte to the synchronization pipe (on fd 0).
+ *
+ * @note Called in the child process, after it has taken the Service Directory's SMACK label so
+ *       that the sockets get that label; terminates it on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CreateSdirSockets
+(
+    void
+)
+{
+    int fds[2];
+
+    LE_FATAL_IF(le_dir_Make(LE_CONFIG_RUNTIME_DIR, S_IRWXU | S_IXOTH) == LE_FAULT,
+                "Failed to create directory '%s'.", LE_CONFIG_RUNTIME_DIR);
+
+    fds[0] = OpenSdirSocket(LE_SVCDIR_CLIENT_SOCKET_NAME);
+    fds[1] = OpenSdirSocket(LE_SVCDIR_SERVER_SOCKET_NAME);
+
+    unixSocket_PassListening(fds, NUM_ARRAY_MEMBERS(fds));
+
+    ssize_t numBytesWritten;
+    do
+    {
+        numBytesWritten = write(STDIN_FILENO, "", 1);
+    }
+    while ((numBytesWritten == -1) && (errno == EINTR));
+
+    LE_FATAL_IF(numBytesWritten != 1, "Could not write synchronization pipe.  %m.");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads a framework daemon's synchronization pipe.
+ *
+ * @return Number of bytes read: 0 when the daemon has closed its end of the pipe, i.e., is ready
+ *         (or died).
+ */
+//--------------------------------------------------------------------------------------------------
+static ssize_t ReadSyncPipe
+(
+    DaemonObj_t* daemonPtr      ///< [IN] The daemon.
+)
+{
+    ssize_t numBytesRead;
+    char dummyBuf;
+
+    do
+    {
+        numBytesRead = read(daemonPtr->syncFd, &dummyBuf, 1);
+    }
+    while ((numBytesRead == -1) && (errno == EINTR));
+
+    LE_FATAL_IF(numBytesRead == -1, "Could not read synchronization pipe.  %m.");
+
+    return numBytesRead;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Waits for a framework daemon to be ready: the daemon closes its end of the synchronization pipe
+ * once it has initialized.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WaitForDaemon
+(
+    DaemonObj_t* daemonPtr      ///< [IN] The daemon.
+)
+{
+    if (daemonPtr->syncFd < 0)
+    {
+        return;
+    }
+
+    // TODO: Add a timeout here.
+    while (ReadSyncPipe(daemonPtr) != 0)
+    {
+    }
+
+    // Close the read end of the pipe because it is no longer used.
+    fd_Close(daemonPtr->syncFd);
+    daemonPtr->syncFd = -1;
+
+    const char* daemonNamePtr = le_path_GetBasenamePtr(daemonPtr->path, "/");
+
+    bootProfile_Record(daemonNamePtr, "ready", NULL);
+
+    LE_INFO("System process '%s' is ready.", daemonNamePtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start a framework daemon.  Does not wait for it to be ready, except for the Service Directory,
+ * for which it waits until its sockets exist.
  */
 //--------------------------------------------------------------------------------------------------
 static void StartDaemon
@@ -261,6 +412,11 @@ static void StartDaemon
             smack_SetMyLabel("framework");
         }
 
+        if (daemonPtr->sdirSockets)
+        {
+            CreateSdirSockets();
+        }
+
         // Launch the child program.  This should not return unless there was an error.
         execl(daemonPtr->path, daemonNamePtr, (char*)NULL);
 
@@ -274,23 +430,21 @@ static void StartDaemon
     // Close the write end of the pipe because the parent does not need it.
     fd_Close(syncPipeFd[1]);
 
-    // Wait for the child process to close the read end of the pipe.  This ensures that the
-    // framework daemons start in the proper order.
-    // TODO: Add a timeout here.
-    ssize_t numBytesRead;
-    int dummyBuf;
-    do
-    {
-        numBytesRead = read(syncPipeFd[0], &dummyBuf, 1);
-    }
-    while ( ((numBytesRead == -1) && (errno == EINTR)) || (numBytesRead != 0) );
+    // Keep the read end, to find out when the child process is ready: it closes its end.
+    daemonPtr->syncFd = syncPipeFd[0];
 
-    LE_FATAL_IF(numBytesRead == -1, "Could not read synchronization pipe.  %m.");
+    LE_INFO("Started system process '%s' with PID: %d.", daemonNamePtr, pid);
 
-    // Close the read end of the pipe because it is no longer used.
-    fd_Close(syncPipeFd[0]);
+    // The pid lets the Service Directory's records of advertisements be matched to the daemon.
+    char pidStr[16];
+    snprintf(pidStr, sizeof(pidStr), "%d", pid);
+    bootProfile_Record(daemonNamePtr, "exec", pidStr);
 
-    LE_INFO("Started system process '%s' with PID: %d.", daemonNamePtr, pid);
+    // Once the Service Directory's sockets exist, the other daemons can be started.
+    if (daemonPtr->sdirSockets && (ReadSyncPipe(daemonPtr) == 0))
+    {
+        WaitForDaemon(daemonPtr);
+    }
 }
 
 
@@ -325,7 +479,26 @@ void fwDaemons_Start
 
     for (i = 0; i < NUM_ARRAY_MEMBERS(FrameworkDaemons); i++)
     {
+        int j;
+
+        if (FrameworkDaemons[i].afterPrevious)
+        {
+            for (j = 0; j < i; j++)
+            {
+                WaitForDaemon(&(FrameworkDaemons[j]));
+            }
+        }
+
         StartDaemon(&(FrameworkDaemons[i]));
+
+#if !LE_CONFIG_SUPERV_PARALLEL_DAEMONS
+        WaitForDaemon(&(FrameworkDaemons[i]));
+#endif
+    }
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(FrameworkDaemons); i++)
+    {
+        WaitForDaemon(&(FrameworkDaemons[i]));
     }
 
     LE_INFO("All framework daemons ready.");
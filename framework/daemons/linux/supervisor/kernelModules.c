@@ -10,10 +10,13 @@
 #include "fileDescriptor.h"
 #include "smack.h"
 #include "sysPaths.h"
+#include "bootProfile.h"
 #include "kernelModules.h"
 #include "le_cfg_interface.h"
 #include "supervisor.h"
 
+#include <sys/syscall.h>
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory pool size for module objects and strings
@@ -51,7 +54,8 @@
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Module insert command and format, arguments are module path and module params
+ * Module insert command and format, arguments are module path and module params.  Only used when
+ * the kernel can't load modules from a file descriptor (finit_module).
  */
 //--------------------------------------------------------------------------------------------------
 #define INSMOD_COMMAND "/sbin/insmod"
@@ -122,6 +126,11 @@ typedef struct
                                                              // traversing to detect cycle
     bool               recurStack;                           // Track recursion stack while
                                                              // traversing to detect cycle
+#if LE_CONFIG_SUPERV_KMODULE_LOAD_THREADS > 1
+    le_thread_Ref_t    loadThread;                           // Thread loading the module, if any
+    le_result_t        loadResult;                           // Result of loading the module
+    le_sls_Link_t      loadDoneLink;                         // link object for loaded module list
+#endif
 }
 KModuleObj_t;
 
@@ -138,6 +147,7 @@ static struct {
     le_mem_PoolRef_t    depModStringPool;  // memory pool of depend system kernel modules strings
     le_hashmap_Ref_t    moduleTable;       // table for kernel module objects
     le_hashmap_Ref_t    dependModuleTable; // table for depends system kernel modules
+    le_mutex_Ref_t      mutex;             // protects module use counts while loading in parallel
 } KModuleHandler = {NULL};
 
 
@@ -300,6 +310,70 @@ static le_result_t ExecuteCommand(char *argv[], int argc, int *filedes)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load a module's .ko file into the kernel with its parameters.  The file is handed to the kernel
+ * with finit_module() rather than by running insmod, which saves a fork and exec per module.
+ * insmod is only run if the kernel doesn't support finit_module().
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t InsertModuleFile(KModuleObj_t *mod)
+{
+#ifdef SYS_finit_module
+    /* Parameters are passed as a single string, separated by spaces, as insmod does. */
+    size_t paramsSize = 1;
+    int i;
+
+    for (i = 2; i < mod->argc; i++)
+    {
+        paramsSize += strlen(mod->argv[i]) + 1;
+    }
+
+    char *params = malloc(paramsSize);
+    LE_ASSERT(params != NULL);
+
+    char *p = params;
+    *p = '\0';
+    for (i = 2; i < mod->argc; i++)
+    {
+        p += sprintf(p, "%s%s", (p == params ? "" : " "), mod->argv[i]);
+    }
+
+    int fd = open(mod->path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+    {
+        LE_CRIT("Cannot open module file '%s' (%m)", mod->path);
+        free(params);
+        return LE_FAULT;
+    }
+
+    LE_INFO("Load '%s %s'", mod->path, params);
+
+    int rc = syscall(SYS_finit_module, fd, params, 0);
+    int err = errno;
+
+    fd_Close(fd);
+    free(params);
+
+    if (rc == 0)
+    {
+        return LE_OK;
+    }
+
+    if (err != ENOSYS)
+    {
+        errno = err;
+        LE_CRIT("Failed to load module '%s' (%m)", mod->name);
+        return LE_FAULT;
+    }
+#endif
+
+    mod->argv[0] = INSMOD_COMMAND;
+
+    return ExecuteCommand(mod->argv, mod->argc, NULL);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Strip extension ".ko" from module name
@@ -1025,8 +1099,121 @@ static le_result_t TraverseDependencyInsert
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Install each kernel module.
- * modprobe the system dependency module and insmod the Legato kernel module.
+ * Load a single kernel module whose required kernel modules are already loaded.
+ * modprobe the system dependency modules and insert the Legato kernel module.
+ *
+ * @return
+ *      - LE_OK if the module was loaded, or failed to load but is optional.
+ *      - Anything else if the module failed to load and fault action must be taken.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LoadModule(KModuleObj_t *mod)
+{
+    le_result_t result;
+    ProcModules_t procModules;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+    le_sls_Link_t *depModNameLinkPtr = le_sls_Peek(&(mod->dependsModuleName));
+
+    while (depModNameLinkPtr != NULL)
+    {
+        /* Install dependency system modules if any before installing the Legato module */
+        DepModNameNode_t* depModNameNodePtr = CONTAINER_OF(depModNameLinkPtr,
+                                                           DepModNameNode_t, link);
+        char *depargv[] = {MODPROBE_COMMAND, depModNameNodePtr->modName, NULL};
+
+        result = ExecuteCommand(depargv, ARRAY_LENGTH(depargv)-1, NULL);
+        if (result != LE_OK)
+        {
+            LE_CRIT("Command '%s' '%s' execution failed.", depargv[0], depargv[1]);
+            return result;
+        }
+
+        DepModNameNode_t *depModPtr = le_hashmap_Get(KModuleHandler.dependModuleTable,
+                                                     depModNameNodePtr->modName);
+        if (depModPtr == NULL)
+        {
+            LE_ERROR("Lookup for module '%s' failed.", depModNameNodePtr->modName);
+            return LE_NOT_FOUND;
+        }
+
+        /* System modules can be shared by modules loading at the same time. */
+        le_mutex_Lock(KModuleHandler.mutex);
+        depModPtr->useCount++;
+        le_mutex_Unlock(KModuleHandler.mutex);
+
+        depModNameLinkPtr = le_sls_PeekNext(&(mod->dependsModuleName), depModNameLinkPtr);
+    }
+
+    /* If install script is provided, execute the script otherwise insert the module file */
+    if (strcmp(mod->installScript, "") != 0)
+    {
+        char *scriptargv[] = {mod->installScript, mod->path, NULL};
+
+        result = ExecuteCommand(scriptargv, ARRAY_LENGTH(scriptargv)-1, NULL);
+        if (result != LE_OK)
+        {
+            LE_CRIT("Install script '%s' execution failed", mod->installScript);
+
+            return (mod->isOptional ? LE_OK : result);
+        }
+
+        /* Read module load status from /proc/modules */
+        procModules =  CheckProcModules(mod->name);
+
+        if (procModules.loadStatus != STATUS_INSTALLED)
+        {
+            LE_INFO("Module '%s' not in 'Live' state, wait for 10 seconds.", mod->name);
+            le_thread_Sleep(10);
+
+            /* If the module is not in live state, wait for 10 seconds to see if the
+             * module recovers to live state, otherwise restart the system.
+             */
+            if (procModules.loadStatus != STATUS_INSTALLED)
+            {
+                if (mod->isOptional)
+                {
+                    LE_INFO(
+                        "Module '%s' not in 'Live' state and is optional. "
+                        "Skip restarting system.",
+                        mod->name);
+                    return LE_OK;
+                }
+
+                LE_CRIT("Module '%s' not in 'Live' state. Restart system ...", mod->name);
+                return LE_FAULT;
+            }
+        }
+    }
+    else
+    {
+        bootProfile_Record("modules", "load", mod->name);
+        result = InsertModuleFile(mod);
+        bootProfile_Record("modules", "loaded", mod->name);
+        if (result != LE_OK)
+        {
+            if (mod->isOptional)
+            {
+                LE_INFO("Ignoring failure. "
+                         "Module '%s' failed to load and is an optional module.", mod->name);
+                return LE_OK;
+            }
+            return result;
+        }
+    }
+
+    le_clk_Time_t loadTime = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    mod->moduleLoadStatus = STATUS_INSTALLED;
+    LE_INFO("New kernel module '%s' (loaded in %ld ms)",
+            mod->name, (long)(loadTime.sec * 1000 + loadTime.usec / 1000));
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Install each kernel module, after the kernel modules it requires.
  */
 //--------------------------------------------------------------------------------------------------
 static le_result_t InstallEachKernelModule(KModuleObj_t *m, bool enableUseCount)
@@ -1035,7 +1222,6 @@ static le_result_t InstallEachKernelModule(KModuleObj_t *m, bool enableUseCount)
     le_dls_Link_t *listLink;
     /* The ordered list of required kernel modules to install */
     le_dls_List_t ModuleInsertList = LE_DLS_LIST_INIT;
-    ProcModules_t procModules;
 
     result = TraverseDependencyInsert(&ModuleInsertList, m, enableUseCount);
     if (result != LE_OK)
@@ -1061,97 +1247,11 @@ static le_result_t InstallEachKernelModule(KModuleObj_t *m, bool enableUseCount)
 
         if (mod->moduleLoadStatus != STATUS_INSTALLED)
         {
-            le_sls_Link_t *depModNameLinkPtr = le_sls_Peek(&(mod->dependsModuleName));
-
-            while (depModNameLinkPtr != NULL)
-            {
-                /* Install dependency system modules if any before installing the Legato module */
-                DepModNameNode_t* depModNameNodePtr = CONTAINER_OF(depModNameLinkPtr,
-                                                                   DepModNameNode_t, link);
-                char *depargv[] = {MODPROBE_COMMAND, depModNameNodePtr->modName, NULL};
-
-                result = ExecuteCommand(depargv, ARRAY_LENGTH(depargv)-1, NULL);
-                if (result != LE_OK)
-                {
-                    LE_CRIT("Command '%s' '%s' execution failed.", depargv[0], depargv[1]);
-                    return result;
-                }
-
-                DepModNameNode_t *depModPtr = le_hashmap_Get(KModuleHandler.dependModuleTable,
-                                                             depModNameNodePtr->modName);
-                if (depModPtr == NULL)
-                {
-                    LE_ERROR("Lookup for module '%s' failed.", depModNameNodePtr->modName);
-                    return LE_NOT_FOUND;
-                }
-
-                depModPtr->useCount++;
-                depModNameLinkPtr = le_sls_PeekNext(&(mod->dependsModuleName), depModNameLinkPtr);
-            }
-
-            /* If install script is provided, execute the script otherwise execute insmod */
-            if (strcmp(mod->installScript, "") != 0)
-            {
-                char *scriptargv[] = {mod->installScript, mod->path, NULL};
-
-                result = ExecuteCommand(scriptargv, ARRAY_LENGTH(scriptargv)-1, NULL);
-                if (result != LE_OK)
-                {
-                    LE_CRIT("Install script '%s' execution failed", mod->installScript);
-
-                    if (mod->isOptional)
-                    {
-                        continue;
-                    }
-                    return result;
-                }
-
-                /* Read module load status from /proc/modules */
-                procModules =  CheckProcModules(mod->name);
-
-                if (procModules.loadStatus != STATUS_INSTALLED)
-                {
-                    LE_INFO("Module '%s' not in 'Live' state, wait for 10 seconds.", mod->name);
-                    le_thread_Sleep(10);
-
-                    /* If the module is not in live state, wait for 10 seconds to see if the
-                     * module recovers to live state, otherwise restart the system.
-                     */
-                    if (procModules.loadStatus != STATUS_INSTALLED)
-                    {
-                        if (mod->isOptional)
-                        {
-                            LE_INFO(
-                                "Module '%s' not in 'Live' state and is optional. "
-                                "Skip restarting system.",
-                                mod->name);
-                            continue;
-                        }
-
-                        LE_CRIT("Module '%s' not in 'Live' state. Restart system ...", mod->name);
-                        return LE_FAULT;
-                    }
-                }
-            }
-            else
+            result = LoadModule(mod);
+            if (result != LE_OK)
             {
-                mod->argv[0] = INSMOD_COMMAND;
-
-                result = ExecuteCommand(mod->argv, mod->argc, NULL);
-                if (result != LE_OK)
-                {
-                    if (mod->isOptional)
-                    {
-                        LE_INFO("Ignoring failure. "
-                                 "Module '%s' failed to load and is an optional module.", mod->name);
-                        continue;
-                    }
-                    return result;
-                }
+                return result;
             }
-
-            mod->moduleLoadStatus = STATUS_INSTALLED;
-            LE_INFO("New kernel module '%s'", mod->name);
         }
     }
     return LE_OK;
@@ -1241,6 +1341,223 @@ static void setIsRequiredModule()
 }
 
 
+#if LE_CONFIG_SUPERV_KMODULE_LOAD_THREADS > 1
+//--------------------------------------------------------------------------------------------------
+/**
+ * Modules whose loading thread has finished, and the semaphore posted for each of them.
+ * Protected by KModuleHandler.mutex.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_sls_List_t LoadedModuleList = LE_SLS_LIST_INIT;
+static le_sem_Ref_t LoadedModuleSem;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread loading one kernel module.
+ */
+//--------------------------------------------------------------------------------------------------
+static void *LoadThreadMain(void *contextPtr)
+{
+    KModuleObj_t *mod = contextPtr;
+
+    mod->loadResult = LoadModule(mod);
+
+    le_mutex_Lock(KModuleHandler.mutex);
+    le_sls_Queue(&LoadedModuleList, &(mod->loadDoneLink));
+    le_mutex_Unlock(KModuleHandler.mutex);
+
+    le_sem_Post(LoadedModuleSem);
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if all the kernel modules a module requires are loaded, i.e. are no longer in the list of
+ * modules to load.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsReadyToLoad(le_dls_List_t *ModuleInsertList, KModuleObj_t *mod)
+{
+    le_sls_Link_t* modNameLinkPtr = le_sls_Peek(&(mod->reqModuleName));
+
+    while (modNameLinkPtr != NULL)
+    {
+        ModNameNode_t* modNameNodePtr = CONTAINER_OF(modNameLinkPtr, ModNameNode_t, link);
+        KModuleObj_t* KModulePtr = le_hashmap_Get(KModuleHandler.moduleTable,
+                                                  modNameNodePtr->modName);
+
+        if ((KModulePtr != NULL) &&
+            le_dls_IsInList(ModuleInsertList, &(KModulePtr->dependencyLink)))
+        {
+            return false;
+        }
+
+        modNameLinkPtr = le_sls_PeekNext(&(mod->reqModuleName), modNameLinkPtr);
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load a list of kernel modules, following their dependencies: each module is loaded by its own
+ * thread as soon as the modules it requires are loaded, so modules that don't depend on each other
+ * are loaded at the same time.  At most LE_CONFIG_SUPERV_KMODULE_LOAD_THREADS modules are loaded
+ * at once.
+ *
+ * @return
+ *      - LE_OK if all modules were loaded (or are optional).
+ *      - LE_FAULT if a module failed to load.  No more modules are started once one has failed,
+ *        but those already loading are waited for.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LoadModulesInParallel(le_dls_List_t *ModuleInsertList)
+{
+    le_result_t result = LE_OK;
+    le_dls_Link_t *linkPtr;
+    le_sls_Link_t *doneLinkPtr;
+    size_t numLoading = 0;
+    size_t numLoaded = 0;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    if (LoadedModuleSem == NULL)
+    {
+        LoadedModuleSem = le_sem_Create("KModuleLoaded", 0);
+    }
+
+    while (true)
+    {
+        /* Start every module that isn't loading yet and whose required modules are loaded. */
+        linkPtr = le_dls_Peek(ModuleInsertList);
+        while ((result == LE_OK) && (linkPtr != NULL) &&
+               (numLoading < LE_CONFIG_SUPERV_KMODULE_LOAD_THREADS))
+        {
+            KModuleObj_t *mod = CONTAINER_OF(linkPtr, KModuleObj_t, dependencyLink);
+            linkPtr = le_dls_PeekNext(ModuleInsertList, linkPtr);
+
+            if (mod->moduleLoadStatus == STATUS_INSTALLED)
+            {
+                le_dls_Remove(ModuleInsertList, &(mod->dependencyLink));
+            }
+            else if ((mod->loadThread == NULL) && IsReadyToLoad(ModuleInsertList, mod))
+            {
+                mod->loadThread = le_thread_Create("KModuleLoad", LoadThreadMain, mod);
+                le_thread_SetJoinable(mod->loadThread);
+                le_thread_Start(mod->loadThread);
+                numLoading++;
+            }
+        }
+
+        if (numLoading == 0)
+        {
+            break;
+        }
+
+        /* Wait for one of the modules to be loaded. */
+        le_sem_Wait(LoadedModuleSem);
+
+        le_mutex_Lock(KModuleHandler.mutex);
+        doneLinkPtr = le_sls_Pop(&LoadedModuleList);
+        le_mutex_Unlock(KModuleHandler.mutex);
+
+        LE_ASSERT(doneLinkPtr != NULL);
+        KModuleObj_t *mod = CONTAINER_OF(doneLinkPtr, KModuleObj_t, loadDoneLink);
+
+        le_thread_Join(mod->loadThread, NULL);
+        mod->loadThread = NULL;
+        numLoading--;
+
+        le_dls_Remove(ModuleInsertList, &(mod->dependencyLink));
+
+        if (mod->loadResult != LE_OK)
+        {
+            LE_ERROR("Error in installing module '%s'.", mod->name);
+            result = LE_FAULT;
+        }
+        else
+        {
+            numLoaded++;
+        }
+    }
+
+    if ((result == LE_OK) && !le_dls_IsEmpty(ModuleInsertList))
+    {
+        /* Cyclic dependencies are ruled out before loading, so this shouldn't happen. */
+        LE_ERROR("Some kernel modules' dependencies can't be satisfied.");
+        result = LE_FAULT;
+    }
+
+    le_clk_Time_t loadTime = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+    LE_INFO("Loaded %" PRIuS " kernel modules in %ld ms",
+            numLoaded, (long)(loadTime.sec * 1000 + loadTime.usec / 1000));
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Iterate through the module table and install kernel modules, loading those that don't depend
+ * on each other in parallel.
+ */
+//--------------------------------------------------------------------------------------------------
+static void installModules()
+{
+    KModuleObj_t *modPtr;
+    le_result_t result;
+    le_dls_Link_t* linkPtr;
+    /* All the kernel modules to install, with the modules they require */
+    le_dls_List_t ModuleInsertList = LE_DLS_LIST_INIT;
+
+    linkPtr = le_dls_Peek(&ModuleAlphaOrderList);
+    while (linkPtr != NULL)
+    {
+        modPtr = CONTAINER_OF(linkPtr, KModuleObj_t, alphabeticalLink);
+        LE_ASSERT(modPtr != NULL);
+        linkPtr = le_dls_PeekNext(&ModuleAlphaOrderList, linkPtr);
+
+        /*
+         * Skip if the modules are loaded manually via app.
+         * If the module is load manual, it will be loaded when app starts.
+         */
+        if (modPtr->isLoadManual)
+        {
+            continue;
+        }
+
+        result = TraverseDependencyInsert(&ModuleInsertList, modPtr, true);
+        if (result != LE_OK)
+        {
+            /* If the module is marked optional, ignore fault, otherwise take fault action. */
+            if (modPtr->isOptional)
+            {
+                LE_WARN("Traversing module '%s' dependencies failed, ignore as module is optional",
+                        modPtr->name);
+                if (le_dls_IsInList(&ModuleInsertList, &(modPtr->dependencyLink)))
+                {
+                    le_dls_Remove(&ModuleInsertList, &(modPtr->dependencyLink));
+                }
+                continue;
+            }
+
+            LE_ERROR("Traversing module '%s' dependencies failed. Restarting system ...",
+                     modPtr->name);
+            framework_Reboot();
+            return;
+        }
+    }
+
+    if (LoadModulesInParallel(&ModuleInsertList) != LE_OK)
+    {
+        LE_ERROR("Error in installing modules. Restarting system ...");
+        framework_Reboot();
+    }
+}
+#else
 //--------------------------------------------------------------------------------------------------
 /**
  * Iterate through the module table and install kernel module
@@ -1281,6 +1598,7 @@ static void installModules()
         linkPtr = le_dls_PeekNext(&ModuleAlphaOrderList, linkPtr);
     }
 }
+#endif /* end LE_CONFIG_SUPERV_KMODULE_LOAD_THREADS > 1 */
 
 
 //--------------------------------------------------------------------------------------------------
@@ -1696,6 +2014,8 @@ void kernelModules_Init(void)
                                              31,
                                              le_hashmap_HashString,
                                              le_hashmap_EqualsString);
+
+    KModuleHandler.mutex = le_mutex_CreateNonRecursive("KModuleMutex");
 }
 
 
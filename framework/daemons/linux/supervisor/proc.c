@@ -6,6 +6,12 @@
  * state information.  However, a processes state must be updated by calling the
  * proc_SigChildHandler() from within a SIGCHILD handler.
  *
+ * Each running process has a pidfd, when the kernel supports them (Linux 5.3 and later).  Its
+ * readability tells the Supervisor the process has died without waiting for a SIGCHILD, which
+ * several dying children share, and signals sent through it can't reach another process that was
+ * given the same pid after the process was reaped.  Running processes are also kept in a map by
+ * pid, so that the process a dead child was is found without searching every app.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
@@ -22,11 +28,14 @@
 #include "killProc.h"
 #include "le_cfg_interface.h"
 #include "limit.h"
+#include "bootProfile.h"
 #include "linux/logPlatform.h"
 #include "smack.h"
 #include "sysStatus.h"
 #include "user.h"
 
+#include <sys/syscall.h>
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -96,6 +105,17 @@
 //--------------------------------------------------------------------------------------------------
 #define CFG_NODE_FAULT_ACTION                       "faultAction"
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The name of the node in the config tree that lets a process opt out of being pre-forked.
+ *
+ * If this entry in the config tree is missing, the process is pre-forked when
+ * LE_CONFIG_SUPERV_PREFORK_PROCS is enabled and its fault action is "restart".
+ */
+//--------------------------------------------------------------------------------------------------
+#define CFG_NODE_PREFORK                            "preFork"
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fault action string definitions.
@@ -167,6 +187,11 @@ typedef struct proc_Ref
     proc_BlockCallback_t  blockCallback;  ///< Callback function to indicate when the process is
                                           ///  has been blocked after the fork but before the exec.
     void* blockContextPtr;          ///< Context pointer for the blockCallback.
+    bool    preFork;                ///< false if the process opted out of pre-forking.
+    pid_t   standbyPid;             ///< Pid of the pre-forked standby child, or -1 if none.
+    int     standbyPipe;            ///< Write end of the pipe the standby child waits on.
+    int     pidFd;                  ///< pidfd of the running process, or -1 if none.
+    le_fdMonitor_Ref_t pidFdMonitor;///< Monitor of the pidfd, or NULL if none.
 }
 Process_t;
 
@@ -216,6 +241,14 @@ static le_mem_PoolRef_t PriorityPool;
 static le_mem_PoolRef_t ArgsPool;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map of the running processes, by pid.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t ProcPidMap;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Nice level definitions for the different Legato priority levels.
@@ -372,6 +405,153 @@ static void GetWatchdogAction
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops monitoring the process's pidfd and closes it, if it has one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ClosePidFd
+(
+    proc_Ref_t procRef              ///< [IN] The process reference.
+)
+{
+    if (procRef->pidFdMonitor != NULL)
+    {
+        le_fdMonitor_Delete(procRef->pidFdMonitor);
+        procRef->pidFdMonitor = NULL;
+    }
+
+    if (procRef->pidFd != -1)
+    {
+        fd_Close(procRef->pidFd);
+        procRef->pidFd = -1;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler called when a process's pidfd becomes readable, which it does when the process dies.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PidFdHandler
+(
+    int fd,                         ///< [IN] The pidfd.
+    short events                    ///< [IN] The events that occurred.
+)
+{
+    proc_Ref_t procRef = le_fdMonitor_GetContextPtr();
+    pid_t pid = procRef->pid;
+
+    // The process may already have been reaped, if the Supervisor's SIGCHILD handler ran first.
+    siginfo_t childInfo = {.si_pid = 0};
+    int result;
+
+    do
+    {
+        result = waitid(P_PID, pid, &childInfo, WEXITED | WNOHANG | WNOWAIT);
+    }
+    while ((result == -1) && (errno == EINTR));
+
+    if ((result == 0) && (childInfo.si_pid == pid))
+    {
+        framework_HandleChildDeath(pid);
+    }
+
+    // The pidfd stays readable until the process is forgotten, which it is not if its death
+    // wasn't handled as the process's (e.g. because its app is not active).
+    if (procRef->pid == pid)
+    {
+        ClosePidFd(procRef);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records that the process is running with the pid it has been given: adds it to the map of
+ * running processes and opens a pidfd for it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TrackProc
+(
+    proc_Ref_t procRef              ///< [IN] The process reference.
+)
+{
+    LE_ASSERT(le_hashmap_Put(ProcPidMap, &procRef->pid, procRef) == NULL);
+
+#ifdef SYS_pidfd_open
+    // pidfds are always close-on-exec.
+    procRef->pidFd = syscall(SYS_pidfd_open, procRef->pid, 0);
+
+    if (procRef->pidFd == -1)
+    {
+        // Kernels older than 5.3 don't have pidfds.  The process's death is only known through
+        // SIGCHILD then.
+        LE_DEBUG("No pidfd for process '%s' (PID: %d).  %m.", procRef->namePtr, procRef->pid);
+        return;
+    }
+
+    procRef->pidFdMonitor = le_fdMonitor_Create(procRef->namePtr, procRef->pidFd, PidFdHandler,
+                                                POLLIN);
+    le_fdMonitor_SetContextPtr(procRef->pidFdMonitor, procRef);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records that the process is dead: removes it from the map of running processes and closes its
+ * pidfd.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UntrackProc
+(
+    proc_Ref_t procRef              ///< [IN] The process reference.
+)
+{
+    if (procRef->pid != -1)
+    {
+        le_hashmap_Remove(ProcPidMap, &procRef->pid);
+    }
+
+    ClosePidFd(procRef);
+
+    procRef->pid = -1;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kills the process with SIGKILL.  The signal is sent through the process's pidfd when it has
+ * one, so it can't reach another process that was given the same pid.
+ */
+//--------------------------------------------------------------------------------------------------
+static void KillProc
+(
+    proc_Ref_t procRef              ///< [IN] The process reference.
+)
+{
+#ifdef SYS_pidfd_send_signal
+    if (procRef->pidFd != -1)
+    {
+        // Cancel the hard kill of an earlier soft kill, like kill_Hard() does.
+        kill_Died(procRef->pid);
+
+        LE_DEBUG("Sending SIGKILL to process '%s' (PID: %d)", procRef->namePtr, procRef->pid);
+
+        LE_FATAL_IF((syscall(SYS_pidfd_send_signal, procRef->pidFd, SIGKILL, NULL, 0) == -1) &&
+                    (errno != ESRCH),
+                    "Failed to send SIGKILL to process '%s' (PID: %d).  %m.",
+                    procRef->namePtr, procRef->pid);
+        return;
+    }
+#endif
+
+    kill_Hard(procRef->pid);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initialize the process system.
@@ -386,6 +566,8 @@ void proc_Init
     PathPool = le_mem_CreatePool("Paths", LIMIT_MAX_PATH_BYTES);
     PriorityPool = le_mem_CreatePool("Priority", LIMIT_MAX_PRIORITY_NAME_BYTES);
     ArgsPool = le_mem_CreatePool("Args", sizeof(Arg_t));
+
+    ProcPidMap = le_hashmap_Create("ProcPids", 31, le_hashmap_HashUInt32, le_hashmap_EqualsUInt32);
 }
 
 
@@ -455,6 +637,8 @@ proc_Ref_t proc_Create
     procPtr->faultTime = 0;
     procPtr->pid = -1;  // Processes that are not running are assigned -1 as its pid.
     procPtr->cmdKill = false;
+    procPtr->pidFd = -1;
+    procPtr->pidFdMonitor = NULL;
 
     // Default to using /dev/null for standard streams.
     procPtr->stdInFd = -1;
@@ -470,6 +654,9 @@ proc_Ref_t proc_Create
     procPtr->blockPipe = -1;
     procPtr->blockCallback = NULL;
     procPtr->blockContextPtr = NULL;
+    procPtr->preFork = true;
+    procPtr->standbyPid = -1;
+    procPtr->standbyPipe = -1;
 
     // Get watchdog action & fault action from config tree now, if this process has a config
     // tree entry.
@@ -485,6 +672,7 @@ proc_Ref_t proc_Create
     GetWatchdogAction(procPtr, procCfg);
     if (procCfg)
     {
+        procPtr->preFork = le_cfg_GetBool(procCfg, CFG_NODE_PREFORK, true);
         le_cfg_CancelTxn(procCfg);
     }
 
@@ -508,6 +696,34 @@ proc_Ref_t proc_Create
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kills the process's pre-forked standby child, if it has one.  This must be done whenever the
+ * settings the standby was set up with may have changed.  The child is reaped by the Supervisor's
+ * SIGCHILD handler, like any other unconfigured child.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DiscardStandby
+(
+    proc_Ref_t procRef              ///< [IN] The process reference.
+)
+{
+    if (procRef->standbyPid == -1)
+    {
+        return;
+    }
+
+    LE_DEBUG("Discarding standby for process '%s' (PID: %d).",
+             procRef->namePtr, procRef->standbyPid);
+
+    kill_Hard(procRef->standbyPid);
+    fd_Close(procRef->standbyPipe);
+
+    procRef->standbyPid = -1;
+    procRef->standbyPipe = -1;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Delete the process object.
@@ -520,6 +736,9 @@ void proc_Delete
     proc_Ref_t procRef              ///< [IN] The process to start.
 )
 {
+    DiscardStandby(procRef);
+    UntrackProc(procRef);
+
     // Delete arguments override list.
     proc_ClearArgs(procRef);
 
@@ -1212,39 +1431,119 @@ static void BlockOnPipe
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Starts a process.  If the process belongs to a sandboxed app the process will run in its sandbox,
- * otherwise the process will run in its working directory as root.
+ * Blocks a pre-forked standby child until the Supervisor releases it by writing a byte to the
+ * pipe.  Closing the pipe is not used as the release signal because other children forked in the
+ * meantime hold copies of the write end.
+ *
+ * The child exits without exec'ing if the pipe is closed while it is waiting.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WaitForRelease
+(
+    int pipeFd[2]           ///< [IN]
+)
+{
+    // Don't need the write end of the pipe.
+    fd_Close(pipeFd[WRITE_PIPE]);
+
+    ssize_t numBytesRead;
+    char dummyBuf;
+    do
+    {
+        numBytesRead = read(pipeFd[READ_PIPE], &dummyBuf, 1);
+    }
+    while ((numBytesRead == -1) && (errno == EINTR));
+
+    if (numBytesRead != 1)
+    {
+        _exit(EXIT_SUCCESS);
+    }
+
+    fd_Close(pipeFd[READ_PIPE]);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Releases the process's pre-forked standby child so that it execs, and makes it the process.
  *
  * @return
  *      LE_OK if successful.
- *      LE_FAULT if there was an error.
+ *      LE_NOT_FOUND if there is no standby, or it has died.
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t proc_Start
+static le_result_t ReleaseStandby
 (
-    proc_Ref_t procRef              ///< [IN] The process to start.
+    proc_Ref_t procRef              ///< [IN] The process reference.
 )
 {
-    if (procRef->run == false)
+    pid_t pid = procRef->standbyPid;
+    int fd = procRef->standbyPipe;
+
+    if (pid == -1)
     {
-        LE_INFO("Process '%s' is configured to not run.", procRef->namePtr);
-        return LE_OK;
+        return LE_NOT_FOUND;
     }
 
-    if (procRef->pid != -1)
+    procRef->standbyPid = -1;
+    procRef->standbyPipe = -1;
+
+    // A standby that died while waiting has either been reaped already, or is a zombie that is
+    // reaped here.  If it dies after this check its SIGCHILD is handled as the process's.
+    int status;
+    if (waitpid(pid, &status, WNOHANG) != 0)
     {
-        LE_ERROR("Process '%s' (PID: %d) cannot be started because it is already running.",
-                 procRef->namePtr, procRef->pid);
-        return LE_FAULT;
+        LE_WARN("Standby for process '%s' (PID: %d) is gone.", procRef->namePtr, pid);
+        fd_Close(fd);
+        return LE_NOT_FOUND;
     }
 
-    if (framework_IsStopping())
+    ssize_t numBytesWritten;
+    char dummyBuf = 0;
+    do
     {
-        LE_ERROR("Process '%s' cannot be started because framework is shutting down.",
-                 procRef->namePtr);
-        return LE_FAULT;
+        numBytesWritten = write(fd, &dummyBuf, 1);
+    }
+    while ((numBytesWritten == -1) && (errno == EINTR));
+
+    fd_Close(fd);
+
+    if (numBytesWritten != 1)
+    {
+        LE_WARN("Could not release standby for process '%s' (PID: %d).  %m.",
+                procRef->namePtr, pid);
+        kill_Hard(pid);
+        return LE_NOT_FOUND;
     }
 
+    procRef->pid = pid;
+    TrackProc(procRef);
+
+    LE_INFO("Starting process '%s' with pid %d (pre-forked)", procRef->namePtr, procRef->pid);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forks and sets up a child for the process.  The child runs in the app's sandbox if the app is
+ * sandboxed, otherwise in its working directory as root.
+ *
+ * A standby child stops just before exec'ing, until released by ReleaseStandby(); it is recorded
+ * as the process's standby rather than as the process itself.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ForkProc
+(
+    proc_Ref_t procRef,             ///< [IN] The process to fork a child for.
+    bool isStandby                  ///< [IN] true to fork a standby child.
+)
+{
     // Create a pipe for parent/child synchronization.
     int syncPipeFd[2];
     LE_FATAL_IF(pipe(syncPipeFd) == -1, "Could not create synchronization pipe.  %m.");
@@ -1258,6 +1557,14 @@ le_result_t proc_Start
         LE_FATAL_IF(pipe(blockPipeFd) == -1, "Could not create block pipe.  %m.");
     }
 
+    // Create a pipe that a standby child waits on until it is released.
+    int standbyPipeFd[2] = {-1, -1};
+
+    if (isStandby)
+    {
+        LE_FATAL_IF(pipe(standbyPipeFd) == -1, "Could not create standby pipe.  %m.");
+    }
+
     // @Note The current IPC system does not support forking so any reads to the config DB must be
     //       done in the parent process.
 
@@ -1359,6 +1666,11 @@ le_result_t proc_Start
             BlockOnPipe(blockPipeFd);
         }
 
+        if (isStandby)
+        {
+            WaitForRelease(standbyPipeFd);
+        }
+
         // Launch the child program.  This should not return unless there was an error.
         LE_INFO("Execing '%s'", argsPtr[0]);
 
@@ -1400,8 +1712,32 @@ le_result_t proc_Start
     // Set the cgroups for the child process while the child process is blocked.
     resLim_SetCGroups(procRef);
 
+    if (isStandby)
+    {
+        // The child is not the process until it is released.
+        fd_Close(standbyPipeFd[READ_PIPE]);
+
+        procRef->standbyPid = pID;
+        procRef->standbyPipe = standbyPipeFd[WRITE_PIPE];
+        procRef->pid = -1;
+
+        LE_DEBUG("Pre-forked standby for process '%s' with pid %d", procRef->namePtr, pID);
+
+        // Let the child finish its set up.
+        fd_Close(syncPipeFd[WRITE_PIPE]);
+
+        return LE_OK;
+    }
+
+    TrackProc(procRef);
+
     LE_INFO("Starting process '%s' with pid %d", procRef->namePtr, procRef->pid);
 
+    // The pid lets the Service Directory's records of advertisements be matched to the app.
+    char detail[LIMIT_MAX_PROCESS_NAME_BYTES + 16];
+    snprintf(detail, sizeof(detail), "%d %s", procRef->pid, procRef->namePtr);
+    bootProfile_Record(app_GetName(procRef->appRef), "exec", detail);
+
     // Unblock the child process.
     fd_Close(syncPipeFd[WRITE_PIPE]);
 
@@ -1419,6 +1755,98 @@ le_result_t proc_Start
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forks a standby child for the process, if it is to be pre-forked and has none.  Only processes
+ * that are restarted when they fault benefit from it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PreFork
+(
+    proc_Ref_t procRef              ///< [IN] The process reference.
+)
+{
+#if LE_CONFIG_SUPERV_PREFORK_PROCS
+    if ( !procRef->preFork ||
+         (procRef->standbyPid != -1) ||
+         (procRef->faultAction != FAULT_ACTION_RESTART_PROC) ||
+         (procRef->blockCallback != NULL) ||
+         procRef->debug )
+    {
+        return;
+    }
+
+    if (ForkProc(procRef, true) != LE_OK)
+    {
+        LE_WARN("Could not pre-fork process '%s'.", procRef->namePtr);
+    }
+#else
+    LE_UNUSED(procRef);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a process.  If the process belongs to a sandboxed app the process will run in its sandbox,
+ * otherwise the process will run in its working directory as root.
+ *
+ * If the process has a pre-forked standby child, the standby is released instead of forking a new
+ * child.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t proc_Start
+(
+    proc_Ref_t procRef              ///< [IN] The process to start.
+)
+{
+    if (procRef->run == false)
+    {
+        LE_INFO("Process '%s' is configured to not run.", procRef->namePtr);
+        return LE_OK;
+    }
+
+    if (procRef->pid != -1)
+    {
+        LE_ERROR("Process '%s' (PID: %d) cannot be started because it is already running.",
+                 procRef->namePtr, procRef->pid);
+        return LE_FAULT;
+    }
+
+    if (framework_IsStopping())
+    {
+        LE_ERROR("Process '%s' cannot be started because framework is shutting down.",
+                 procRef->namePtr);
+        DiscardStandby(procRef);
+        return LE_FAULT;
+    }
+
+    // A process that is to be blocked or debugged must not skip its set up.
+    if ((procRef->blockCallback != NULL) || procRef->debug)
+    {
+        DiscardStandby(procRef);
+    }
+
+    le_result_t result = ReleaseStandby(procRef);
+
+    if (result != LE_OK)
+    {
+        result = ForkProc(procRef, false);
+    }
+
+    if (result == LE_OK)
+    {
+        PreFork(procRef);
+    }
+
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Used to indicate that the process is intentionally being stopped externally and not due to a
@@ -1435,6 +1863,59 @@ void proc_Stopping
     // Set this flag to indicate that the process was intentionally killed and its fault action
     // should not be respected.
     procRef->cmdKill = true;
+
+    DiscardStandby(procRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kills the process with SIGKILL.  The process state is only updated when the process actually
+ * dies.
+ */
+//--------------------------------------------------------------------------------------------------
+void proc_Kill
+(
+    proc_Ref_t procRef              ///< [IN] The process to kill.
+)
+{
+    LE_ASSERT(procRef->pid != -1);
+
+    KillProc(procRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the running process with a given pid.
+ *
+ * @return
+ *      The process reference, or NULL if no process object is running with that pid.
+ */
+//--------------------------------------------------------------------------------------------------
+proc_Ref_t proc_FindByPid
+(
+    pid_t pid                       ///< [IN] The pid.
+)
+{
+    return le_hashmap_Get(ProcPidMap, &pid);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the app that the process is part of.
+ *
+ * @return
+ *      The app reference.
+ */
+//--------------------------------------------------------------------------------------------------
+app_Ref_t proc_GetApp
+(
+    proc_Ref_t procRef             ///< [IN] The process reference.
+)
+{
+    return procRef->appRef;
 }
 
 
@@ -1594,6 +2075,8 @@ void proc_SetStdIn
     int stdInFd                 ///< [IN] File descriptor to use as the app proc's standard in.
 )
 {
+    DiscardStandby(procRef);
+
     if (procRef->stdInFd != -1)
     {
         fd_Close(procRef->stdInFd);
@@ -1615,6 +2098,8 @@ void proc_SetStdOut
     int stdOutFd                ///< [IN] File descriptor to use as the app proc's standard out.
 )
 {
+    DiscardStandby(procRef);
+
     if (procRef->stdOutFd != -1)
     {
         fd_Close(procRef->stdOutFd);
@@ -1636,6 +2121,8 @@ void proc_SetStdErr
     int stdErrFd                ///< [IN] File descriptor to use as the app proc's standard error.
 )
 {
+    DiscardStandby(procRef);
+
     if (procRef->stdErrFd != -1)
     {
         fd_Close(procRef->stdErrFd);
@@ -1663,6 +2150,8 @@ le_result_t proc_SetExecPath
                                 ///       the executable path.
 )
 {
+    DiscardStandby(procRef);
+
     // Clear the executable path.
     if (execPathPtr == NULL)
     {
@@ -1706,6 +2195,8 @@ le_result_t proc_SetPriority
     const char* priorityPtr     ///< [IN] Priority string.  NULL to clear the priority.
 )
 {
+    DiscardStandby(procRef);
+
     // Clear the priority string.
     if (priorityPtr == NULL)
     {
@@ -1773,6 +2264,8 @@ le_result_t proc_AddArgs
     const char* argPtr          ///< [IN] Argument string.
 )
 {
+    DiscardStandby(procRef);
+
     if (argPtr != NULL)
     {
         Arg_t* argObjPtr = le_mem_ForceAlloc(ArgsPool);
@@ -1837,6 +2330,8 @@ void proc_SetFaultAction
     FaultAction_t faultAction           ///< [IN] Fault action.
 )
 {
+    DiscardStandby(procRef);
+
     if (FAULT_ACTION_NONE == faultAction)
     {
         procRef->faultAction = procRef->defaultFaultAction;
@@ -1917,6 +2412,8 @@ void proc_SetRun
     bool run            ///< [IN] Run flag.
 )
 {
+    DiscardStandby(procRef);
+
     procRef->run = run;
 }
 
@@ -1932,6 +2429,8 @@ void proc_SetDebug
     bool debug          ///< [IN] Debug flag.
 )
 {
+    DiscardStandby(procRef);
+
     procRef->debug = debug;
 }
 
@@ -2062,7 +2561,9 @@ FaultAction_t proc_SigChildHandler
         procRef->cmdKill = false;
 
         // Remember that this process is dead.
-        procRef->pid = -1;
+        UntrackProc(procRef);
+
+        DiscardStandby(procRef);
 
         return FAULT_ACTION_NONE;
     }
@@ -2100,7 +2601,7 @@ FaultAction_t proc_SigChildHandler
     }
 
     // Record the fact that the process is dead.
-    procRef->pid = -1;
+    UntrackProc(procRef);
 
     // If the process has reached its fault limit, take action to stop
     // the apparently futile attempts to start this thing.
@@ -2135,5 +2636,10 @@ FaultAction_t proc_SigChildHandler
         CaptureDebugData(procRef, isRebooting);
     }
 
+    if (faultAction != FAULT_ACTION_RESTART_PROC)
+    {
+        DiscardStandby(procRef);
+    }
+
     return faultAction;
 }
@@ -122,6 +122,46 @@ void proc_Stopping
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kills the process with SIGKILL.  The process state is only updated when the process actually
+ * dies.
+ */
+//--------------------------------------------------------------------------------------------------
+void proc_Kill
+(
+    proc_Ref_t procRef              ///< [IN] The process to kill.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the running process with a given pid.
+ *
+ * @return
+ *      The process reference, or NULL if no process object is running with that pid.
+ */
+//--------------------------------------------------------------------------------------------------
+proc_Ref_t proc_FindByPid
+(
+    pid_t pid                       ///< [IN] The pid.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the app that the process is part of.
+ *
+ * @return
+ *      The app reference.
+ */
+//--------------------------------------------------------------------------------------------------
+app_Ref_t proc_GetApp
+(
+    proc_Ref_t procRef             ///< [IN] The process reference.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the process state.
@@ -526,6 +526,41 @@ void resLim_SetCGroups
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Logs how long an app's processes were kept waiting for the cpu and for memory while it ran, if
+ * the kernel keeps pressure stall information for its cgroup.  This tells whether the app's cpu
+ * share or memory limit held it back.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogAppPressure
+(
+    const char* appNamePtr          ///< [IN] Name of the application.
+)
+{
+    static const struct
+    {
+        cgrp_SubSys_t subSys;
+        const char* resourcePtr;
+    }
+    resources[] = { {CGRP_SUBSYS_CPU, "cpu"}, {CGRP_SUBSYS_MEM, "memory"} };
+
+    size_t i;
+    for (i = 0; i < NUM_ARRAY_MEMBERS(resources); i++)
+    {
+        cgrp_Pressure_t pressure;
+
+        if ( (cgrp_GetPressure(resources[i].subSys, appNamePtr, &pressure) == LE_OK) &&
+             (pressure.some.totalUs > 0) )
+        {
+            LE_INFO("App '%s' waited for %s for %" PRIu64 " ms (all of its processes for %"
+                    PRIu64 " ms).", appNamePtr, resources[i].resourcePtr,
+                    pressure.some.totalUs / 1000, pressure.full.totalUs / 1000);
+        }
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Cleans up any resources used to set the resource limits for an application.  This should be
@@ -540,6 +575,8 @@ void resLim_CleanupApp
 {
     const char* appNamePtr = app_GetName(appRef);
 
+    LogAppPressure(appNamePtr);
+
     // Remove cgroups for this app in each of the cgroup subsystems.
     cgrp_SubSys_t subSys = 0;
     for (; subSys < CGRP_NUM_SUBSYSTEMS; subSys++)
@@ -203,6 +203,7 @@
 #include "interfaces.h"
 #include "limit.h"
 #include "user.h"
+#include "bootProfile.h"
 #include "kernelModules.h"
 #include "frameworkDaemons.h"
 #include "cgroups.h"
@@ -515,6 +516,7 @@ static void StartFramework
     alarm(30);
 
     // Start all framework daemons.
+    bootProfile_Record("supervisor", "startDaemons", NULL);
     fwDaemons_Start();
 
     // Connect to the services we need from the framework daemons.
@@ -527,9 +529,11 @@ static void StartFramework
     alarm(0);
 
     // Insert kernel modules
+    bootProfile_Record("supervisor", "loadModules", NULL);
     kernelModules_Insert();
 
     // Advertise services.
+    bootProfile_Record("supervisor", "advertise", NULL);
     LE_DEBUG("---- Advertising the Supervisor's APIs ----");
     le_appCtrl_AdvertiseService();
     le_framework_AdvertiseService();
@@ -558,6 +562,7 @@ static void StartFramework
     {
         // Launch all user apps in the config tree that should be launched on system startup.
         LE_INFO("Auto-starting apps.");
+        bootProfile_Record("supervisor", "startApps", NULL);
         apps_AutoStart();
     }
     else
@@ -810,6 +815,55 @@ static void CaptureDebugData
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the death of a child process, which must be in a waitable state.
+ *
+ * The PID is passed down to the apps SIGCHILD handler and framework daemon SIGCHILD handler for
+ * identification and processing.  The lower layer handlers are assumed to reap the child only if
+ * it is going to handle the process death.  If neither the apps or framework daemons recognize
+ * the child then it is reaped here.
+ *
+ * This is called by the SIGCHLD handler, and by the process objects when the pidfd of one of
+ * their processes shows it has died.
+ */
+//--------------------------------------------------------------------------------------------------
+void framework_HandleChildDeath
+(
+    pid_t pid               ///< [IN] Pid of the child process that died.
+)
+{
+    // Send the pid to the apps SIGCHILD handler for processing.
+    le_result_t result = apps_SigChildHandler(pid);
+
+    if (result == LE_FAULT)
+    {
+        // There was an app fault that could not be handled so restart the framework.
+        framework_Reboot();
+    }
+
+    if (result == LE_NOT_FOUND)
+    {
+        // Send the pid to the framework daemon's SIGCHILD handler for processing.
+        le_result_t r = fwDaemons_SigChildHandler(pid);
+
+        if (r == LE_FAULT)
+        {
+            CaptureDebugData();
+            framework_Reboot();
+        }
+        else if (r == LE_NOT_FOUND)
+        {
+            // The child is neither an application process nor a framework daemon.
+            // Reap the child now.
+            LE_INFO("Reaping unconfigured child process %d.", pid);
+
+            wait_ReapChild(pid);
+        }
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The signal event handler function for SIGCHLD called from the Legato event loop.
@@ -824,10 +878,11 @@ static void CaptureDebugData
  *
  * Because SIGCHILD signals may come from either apps or framework daemons they are caught here
  * first.  In this function we do a wait_Peek() to get the PID of the process that generated the
- * SIGCHILD without reaping the child.  The PID is passed down to the apps SIGCHILD handler and
- * framework daemon SIGCHILD handler for identification and processing.  The lower layer handlers
- * are assumed to reap the child only if it is going to handle the process death.  If neither the
- * apps or framework daemons recognize the child then we must reap it here.
+ * SIGCHILD without reaping the child, and pass it to framework_HandleChildDeath().
+ *
+ * The processes the Supervisor starts for apps also have pidfds, which usually tell of their
+ * death first.  This handler then finds the children that don't have one: the framework daemons,
+ * reparented descendents of app processes, and all children on kernels without pidfds.
  */
 //--------------------------------------------------------------------------------------------------
 static void SigChildHandler
@@ -848,34 +903,7 @@ static void SigChildHandler
             break;
         }
 
-        // Send the pid to the apps SIGCHILD handler for processing.
-        le_result_t result = apps_SigChildHandler(pid);
-
-        if (result == LE_FAULT)
-        {
-            // There was an app fault that could not be handled so restart the framework.
-            framework_Reboot();
-        }
-
-        if (result == LE_NOT_FOUND)
-        {
-            // Send the pid to the framework daemon's SIGCHILD handler for processing.
-            le_result_t r = fwDaemons_SigChildHandler(pid);
-
-            if (r == LE_FAULT)
-            {
-                CaptureDebugData();
-                framework_Reboot();
-            }
-            else if (r == LE_NOT_FOUND)
-            {
-                // The child is neither an application process nor a framework daemon.
-                // Reap the child now.
-                LE_INFO("Reaping unconfigured child process %d.", pid);
-
-                wait_ReapChild(pid);
-            }
-        }
+        framework_HandleChildDeath(pid);
     }
 }
 
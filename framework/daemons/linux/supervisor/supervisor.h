@@ -32,4 +32,15 @@ bool framework_IsStopping
     void
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the death of a child process, which must be in a waitable state: reaps it and takes
+ * the action it calls for.
+ */
+//--------------------------------------------------------------------------------------------------
+void framework_HandleChildDeath
+(
+    pid_t pid               ///< [IN] Pid of the child process that died.
+);
+
 #endif // LEGATO_SRC_SUPERVISOR_INCLUDE_GUARD
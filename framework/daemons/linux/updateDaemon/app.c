@@ -40,6 +40,7 @@
 #include "sysPaths.h"
 #include "fileSystem.h"
 #include "ima.h"
+#include "fileStore.h"
 
 
 static const char* InstallHookScriptPath = "/legato/systems/current/bin/install-hook";
@@ -204,7 +205,8 @@ static void ExecPostinstallHook
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Recursively sets the permissions for all files and directories in application read-only directory.
+ * Recursively sets the permissions for all files and directories in application read-only directory,
+ * then adds the files to the file store.
  *
  * returns LE_OK if successful, LE_FAULT if fails.
  */
@@ -324,7 +326,17 @@ static le_result_t SetSmackPermReadOnlyDir
     }
 
     fts_close(ftsPtr);
-    return (result == LE_OK) ? LE_OK:LE_FAULT;
+
+    if (result != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    // The read-only files are final now, so they can share storage with identical files
+    // installed by other apps and systems.
+    fileStore_AddDir(readOnlyPath);
+
+    return LE_OK;
 }
 
 
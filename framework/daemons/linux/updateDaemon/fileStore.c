@@ -0,0 +1,389 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file fileStore.c
+ *
+ * Content-addressed store of installed files.
+ *
+ * legato/
+ *   fileStore/
+ *     <size>-<crc32>-<mode>-<uid>-<gid>-<smackLabel>.<n>
+ *
+ * Each stored file is a hard link to the same inode as every installed copy of it, so a stored
+ * file whose link count drops to one is no longer used by any app or system.  The CRC only picks
+ * the candidate; contents are always compared byte for byte before two files are merged, and
+ * the <n> suffix separates files whose keys collide.
+ *
+ * Hard links are used rather than reflinks because the flash file systems Legato runs on do not
+ * support reflinks.  Files that can't be linked (e.g., because the store is on another file
+ * system) are left untouched.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "limit.h"
+#include "fileDescriptor.h"
+#include "fileStore.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Absolute file system path to the file store.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* FileStorePath = "/legato/fileStore";
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Path used to build a link before it is renamed over an installed file.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* FileStoreTmpPath = "/legato/fileStore/.tmp";
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Files smaller than this are not worth sharing; they take little more than their directory
+ * entry and inode.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MIN_FILE_SIZE 1024
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of different files that may share the same key before giving up.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_COLLISIONS 8
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the buffers used to read files.
+ */
+//--------------------------------------------------------------------------------------------------
+#define READ_CHUNK_BYTES 4096
+
+
+#if LE_CONFIG_UPDATE_FILE_STORE
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the CRC32 of a file's contents.
+ *
+ * @return LE_OK if successful, LE_FAULT if the file couldn't be read.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ComputeCrc
+(
+    const char* pathPtr,    ///< [IN] File to read.
+    uint32_t* crcPtr        ///< [OUT] CRC of the file.
+)
+{
+    int fd = open(pathPtr, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        LE_WARN("Failed to open '%s' (%m).", pathPtr);
+        return LE_FAULT;
+    }
+
+    uint8_t buffer[READ_CHUNK_BYTES];
+    uint32_t crc = LE_CRC_START_CRC32;
+    ssize_t bytesRead;
+
+    while ((bytesRead = fd_ReadSize(fd, buffer, sizeof(buffer))) > 0)
+    {
+        crc = le_crc_Crc32(buffer, bytesRead, crc);
+    }
+
+    fd_Close(fd);
+
+    if (bytesRead < 0)
+    {
+        LE_WARN("Failed to read '%s'.", pathPtr);
+        return LE_FAULT;
+    }
+
+    *crcPtr = crc;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare the contents of two files of the same size.
+ *
+ * @return true if both files could be read and hold the same bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSameContent
+(
+    const char* path1Ptr,   ///< [IN] First file.
+    const char* path2Ptr    ///< [IN] Second file.
+)
+{
+    int fd1 = open(path1Ptr, O_RDONLY | O_CLOEXEC);
+
+    if (fd1 < 0)
+    {
+        return false;
+    }
+
+    int fd2 = open(path2Ptr, O_RDONLY | O_CLOEXEC);
+
+    if (fd2 < 0)
+    {
+        fd_Close(fd1);
+        return false;
+    }
+
+    uint8_t buffer1[READ_CHUNK_BYTES];
+    uint8_t buffer2[READ_CHUNK_BYTES];
+    bool isSame = true;
+
+    while (isSame)
+    {
+        ssize_t bytes1 = fd_ReadSize(fd1, buffer1, sizeof(buffer1));
+        ssize_t bytes2 = fd_ReadSize(fd2, buffer2, sizeof(buffer2));
+
+        if ((bytes1 < 0) || (bytes1 != bytes2) || (memcmp(buffer1, buffer2, bytes1) != 0))
+        {
+            isSame = false;
+        }
+        else if (bytes1 == 0)
+        {
+            break;
+        }
+    }
+
+    fd_Close(fd1);
+    fd_Close(fd2);
+
+    return isSame;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Atomically replace an installed file by a hard link to a stored file.
+ *
+ * @return LE_OK if successful, LE_FAULT otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReplaceWithLink
+(
+    const char* storedPathPtr,  ///< [IN] File in the store.
+    const char* pathPtr         ///< [IN] Installed file to replace.
+)
+{
+    (void)unlink(FileStoreTmpPath);
+
+    if (link(storedPathPtr, FileStoreTmpPath) != 0)
+    {
+        LE_WARN("Failed to link '%s' to '%s' (%m).", FileStoreTmpPath, storedPathPtr);
+        return LE_FAULT;
+    }
+
+    if (rename(FileStoreTmpPath, pathPtr) != 0)
+    {
+        LE_WARN("Failed to rename '%s' to '%s' (%m).", FileStoreTmpPath, pathPtr);
+        (void)unlink(FileStoreTmpPath);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add one installed file to the store.
+ *
+ * @return true if the file now shares its storage with a previously stored file.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool AddFile
+(
+    const char* pathPtr,            ///< [IN] Installed file.
+    const struct stat* statPtr      ///< [IN] The file's attributes.
+)
+{
+    uint32_t crc;
+
+    if (ComputeCrc(pathPtr, &crc) != LE_OK)
+    {
+        return false;
+    }
+
+    char label[LIMIT_MAX_SMACK_LABEL_BYTES] = "";
+    ssize_t labelLen = lgetxattr(pathPtr, "security.SMACK64", label, sizeof(label) - 1);
+    label[(labelLen > 0) ? labelLen : 0] = '\0';
+
+    int n;
+    for (n = 0; n < MAX_COLLISIONS; n++)
+    {
+        char storedPath[LIMIT_MAX_PATH_BYTES];
+
+        if (snprintf(storedPath, sizeof(storedPath), "%s/%jd-%08" PRIx32 "-%o-%u-%u-%s.%d",
+                     FileStorePath,
+                     (intmax_t)statPtr->st_size,
+                     crc,
+                     (unsigned int)(statPtr->st_mode & 07777),
+                     (unsigned int)statPtr->st_uid,
+                     (unsigned int)statPtr->st_gid,
+                     label,
+                     n) >= (int)sizeof(storedPath))
+        {
+            return false;
+        }
+
+        struct stat storedStat;
+
+        if (lstat(storedPath, &storedStat) != 0)
+        {
+            // Nothing stored under this key yet.  This file becomes the stored copy.
+            if ((errno == ENOENT) && (link(pathPtr, storedPath) != 0))
+            {
+                LE_DEBUG("Could not add '%s' to the file store (%m).", pathPtr);
+            }
+            return false;
+        }
+
+        if ( (storedStat.st_ino == statPtr->st_ino) && (storedStat.st_dev == statPtr->st_dev) )
+        {
+            // Already shared.
+            return false;
+        }
+
+        if (IsSameContent(pathPtr, storedPath))
+        {
+            return (ReplaceWithLink(storedPath, pathPtr) == LE_OK);
+        }
+    }
+
+    LE_DEBUG("Too many files in the file store share the key of '%s'.", pathPtr);
+
+    return false;
+}
+
+#endif // LE_CONFIG_UPDATE_FILE_STORE
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add every regular file under a directory tree to the file store.  Files whose contents,
+ * permissions, owner and SMACK label match a file already in the store are replaced by a hard
+ * link to the stored copy; other files become the stored copy for their contents.
+ *
+ * Must only be called on trees that are never modified in place after installation (an app's
+ * read-only files, a system's bin and lib directories), after their SMACK labels have been set.
+ *
+ * Failing to store a file is not an error; the file is simply left as it is.
+ */
+//--------------------------------------------------------------------------------------------------
+void fileStore_AddDir
+(
+    const char* dirPathPtr  ///< [IN] Path of the directory tree to add.
+)
+{
+#if LE_CONFIG_UPDATE_FILE_STORE
+    if (!le_dir_IsDir(dirPathPtr))
+    {
+        return;
+    }
+
+    if (le_dir_MakePath(FileStorePath, S_IRWXU) != LE_OK)
+    {
+        LE_ERROR("Failed to create directory '%s'.", FileStorePath);
+        return;
+    }
+
+    char* pathArrayPtr[] = {(char *)dirPathPtr, NULL};
+
+    FTS* ftsPtr = fts_open(pathArrayPtr, FTS_PHYSICAL, NULL);
+
+    LE_FATAL_IF(ftsPtr == NULL, "Could not access dir '%s'.  %m.", pathArrayPtr[0]);
+
+    size_t sharedCount = 0;
+    off_t sharedBytes = 0;
+
+    FTSENT* entPtr;
+    while ((entPtr = fts_read(ftsPtr)) != NULL)
+    {
+        if ( (entPtr->fts_info == FTS_F) &&
+             (entPtr->fts_statp->st_size >= MIN_FILE_SIZE) &&
+             (entPtr->fts_statp->st_nlink == 1) &&
+             AddFile(entPtr->fts_accpath, entPtr->fts_statp) )
+        {
+            sharedCount++;
+            sharedBytes += entPtr->fts_statp->st_size;
+        }
+    }
+
+    fts_close(ftsPtr);
+
+    LE_INFO("%zu files (%jd bytes) under '%s' are shared with other installed files.",
+            sharedCount,
+            (intmax_t)sharedBytes,
+            dirPathPtr);
+#else
+    LE_UNUSED(dirPathPtr);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete stored files that are no longer linked from any app or system.
+ */
+//--------------------------------------------------------------------------------------------------
+void fileStore_RemoveUnused
+(
+    void
+)
+{
+    if (!le_dir_IsDir(FileStorePath))
+    {
+        return;
+    }
+
+    (void)unlink(FileStoreTmpPath);
+
+    char* pathArrayPtr[] = {(char *)FileStorePath, NULL};
+
+    FTS* ftsPtr = fts_open(pathArrayPtr, FTS_PHYSICAL, NULL);
+
+    LE_FATAL_IF(ftsPtr == NULL, "Could not access dir '%s'.  %m.", pathArrayPtr[0]);
+
+    size_t removedCount = 0;
+
+    FTSENT* entPtr;
+    while ((entPtr = fts_read(ftsPtr)) != NULL)
+    {
+        if ( (entPtr->fts_level == 1) &&
+             (entPtr->fts_info == FTS_F) &&
+             (entPtr->fts_statp->st_nlink <= 1) )
+        {
+            if (unlink(entPtr->fts_accpath) == 0)
+            {
+                removedCount++;
+            }
+            else
+            {
+                LE_ERROR("Unable to remove '%s' (%m).", entPtr->fts_path);
+            }
+        }
+    }
+
+    fts_close(ftsPtr);
+
+    if (removedCount > 0)
+    {
+        LE_INFO("Removed %zu unused files from the file store.", removedCount);
+    }
+}
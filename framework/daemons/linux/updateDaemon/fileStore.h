@@ -0,0 +1,45 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file fileStore.h
+ *
+ * Content-addressed store of installed files.  Identical files installed by different apps,
+ * different versions of the same app or different systems share a single copy on flash.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_FILE_STORE_H_INCLUDE_GUARD
+#define LEGATO_FILE_STORE_H_INCLUDE_GUARD
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add every regular file under a directory tree to the file store.  Files whose contents,
+ * permissions, owner and SMACK label match a file already in the store are replaced by a hard
+ * link to the stored copy; other files become the stored copy for their contents.
+ *
+ * Must only be called on trees that are never modified in place after installation (an app's
+ * read-only files, a system's bin and lib directories), after their SMACK labels have been set.
+ *
+ * Failing to store a file is not an error; the file is simply left as it is.
+ */
+//--------------------------------------------------------------------------------------------------
+void fileStore_AddDir
+(
+    const char* dirPathPtr  ///< [IN] Path of the directory tree to add.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete stored files that are no longer linked from any app or system.
+ */
+//--------------------------------------------------------------------------------------------------
+void fileStore_RemoveUnused
+(
+    void
+);
+
+
+#endif  // LEGATO_FILE_STORE_H_INCLUDE_GUARD
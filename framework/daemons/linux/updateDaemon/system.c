@@ -23,6 +23,7 @@
 #include "sysPaths.h"
 #include "sysStatus.h"
 #include "smack.h"
+#include "fileStore.h"
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -775,6 +776,10 @@ le_result_t system_FinishUpdate
     SetSystemFilesPermissions("/legato/systems/unpack/lib");
     SetSystemFilesPermissions("/legato/systems/unpack/bin");
 
+    // Share the framework's files with identical ones from the systems already installed.
+    fileStore_AddDir("/legato/systems/unpack/lib");
+    fileStore_AddDir("/legato/systems/unpack/bin");
+
     // Now, move the unpacked system into its index.
     char newSystemPath[100] = "";
     snprintf(newSystemPath, sizeof(newSystemPath), "%s/%d", SystemPath, currentIndex);
@@ -897,6 +902,13 @@ le_result_t system_Snapshot
         return LE_FAULT;
     }
 
+    // The snapshot's framework files are identical to the current system's, so only keep one
+    // copy of them.
+    fileStore_AddDir(CURRENT_SYSTEM_PATH "/lib");
+    fileStore_AddDir(CURRENT_SYSTEM_PATH "/bin");
+    fileStore_AddDir(UNPACK_BASE_PATH "/lib");
+    fileStore_AddDir(UNPACK_BASE_PATH "/bin");
+
     // Atomically rename the work dir to the proper index
     char newSystemPath[100] = "";
     snprintf(newSystemPath, sizeof(newSystemPath), "%s/%d", SystemPath, currentIndex);
@@ -1092,6 +1104,9 @@ void system_RemoveUnusedApps
     }
 
     fts_close(ftsPtr);
+
+    // Drop any stored files that belonged only to the apps and systems just removed.
+    fileStore_RemoveUnused();
 }
 
 
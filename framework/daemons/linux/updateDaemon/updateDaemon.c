@@ -828,6 +828,7 @@ le_result_t  VerifyUnpackedSystem
                         {
                             LE_CRIT("Failed to import public certificate '%s'", appPubCertPath);
                             fts_close(ftsPtr);
+                            ima_WaitVerifyFiles();
                             return LE_FAULT;
                         }
                     }
@@ -844,22 +845,22 @@ le_result_t  VerifyUnpackedSystem
 
             case FTS_F:
                 // As directories are visiting preorder, verifying files using last received
-                // certificate should be ok.
+                // certificate should be ok.  The files are verified in parallel; a failure is
+                // reported by the next ima_StartVerifyFile() or by ima_WaitVerifyFiles().
                 if (file_Exists(appPubCertPath))
                 {
-                    result = ima_VerifyFile(entPtr->fts_accpath, appPubCertPath);
+                    result = ima_StartVerifyFile(entPtr->fts_accpath, appPubCertPath);
                 }
                 else
                 {
-                    result = ima_VerifyFile(entPtr->fts_accpath, path);
+                    result = ima_StartVerifyFile(entPtr->fts_accpath, path);
                 }
 
                 if (LE_OK != result)
                 {
-                    LE_CRIT("Failed to verify file '%s' with public certificate '%s'",
-                            entPtr->fts_accpath,
-                            file_Exists(appPubCertPath) ? appPubCertPath : path);
+                    LE_CRIT("Failed to verify files in '%s'", app_UnpackPath);
                     fts_close(ftsPtr);
+                    ima_WaitVerifyFiles();
                     return LE_FAULT;
                 }
                 break;
@@ -869,6 +870,12 @@ le_result_t  VerifyUnpackedSystem
 
     fts_close(ftsPtr);
 
+    if (LE_OK != ima_WaitVerifyFiles())
+    {
+        LE_CRIT("Failed to verify files in '%s'", app_UnpackPath);
+        return LE_FAULT;
+    }
+
     return LE_OK;
 }
 
@@ -24,6 +24,40 @@
 /// An MD5 hash string is 32 characters long, plus a null terminator.
 #define MD5_STRING_BYTES 33
 
+/// Name of the file, at the root of an app delta payload, that lists the paths to remove from the
+/// base app.  The paths are null-terminated and relative to the app's root (e.g. "./bin/foo").
+#define DELTA_REMOVED_FILE ".delta.removed"
+
+/// Number of payload bytes moved from the input stream per read.
+#define COPY_BUFFER_BYTES 16384
+
+/// Buffer used to move payload bytes from the input stream.  Too big for the stack.
+static char CopyBuffer[COPY_BUFFER_BYTES];
+
+/// A bzip2 decompressor that can run as its own process in the unpack pipeline.
+typedef struct
+{
+    const char* pathPtr;    ///< Path to the executable.
+    const char* namePtr;    ///< Name to pass as argv[0].
+    const char* argPtr;     ///< Option that makes it decompress to standard out.
+}
+Decompressor_t;
+
+/// Decompressors to try, in order.
+static const Decompressor_t Decompressors[] =
+{
+    { "/usr/bin/bzip2",     "bzip2",    "-dc" },
+    { "/bin/bzip2",         "bzip2",    "-dc" },
+    { "/usr/bin/bunzip2",   "bunzip2",  "-c" },
+    { "/bin/bunzip2",       "bunzip2",  "-c" },
+};
+
+/// Decompressor found on the target, or NULL if tar has to decompress by itself.
+static const Decompressor_t* DecompressorPtr = NULL;
+
+/// true once the target has been searched for a decompressor.
+static bool DecompressorSearched = false;
+
 /// File descriptor to read the update pack from.
 static int InputFd = -1;
 
@@ -55,6 +89,15 @@ static char AppName[LIMIT_MAX_APP_NAME_BYTES];
 /// The MD5 hash obtained from a JSON header.
 static char Md5[MD5_STRING_BYTES]; ///< The system's MD5 hash.
 
+/// MD5 hash of the installed app that an app delta applies to.  Empty if not a delta.
+static char DeltaFromMd5[MD5_STRING_BYTES];
+
+/// Path of the installed app that the app delta being unpacked applies to, or empty.
+static char DeltaBasePath[LIMIT_MAX_PATH_BYTES];
+
+/// Path of the directory that the app delta being unpacked is unpacked into, or empty.
+static char DeltaUnpackPath[LIMIT_MAX_PATH_BYTES];
+
 /// # of bytes of payload following the JSON.
 static size_t PayloadSize;
 
@@ -188,6 +231,9 @@ static void Reset
         pipeline_Delete(Pipeline);
         Pipeline = NULL;
     }
+
+    DeltaBasePath[0] = '\0';
+    DeltaUnpackPath[0] = '\0';
 }
 
 
@@ -358,6 +404,7 @@ static void StartParsing
     Command[0] = '\0';
     AppName[0] = '\0';
     Md5[0] = '\0';
+    DeltaFromMd5[0] = '\0';
     PayloadSize = 0;
 
     // Set the state
@@ -368,6 +415,117 @@ static void StartParsing
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Removes from an unpacked app delta the paths listed in its DELTA_REMOVED_FILE, then removes
+ * that file.  The list is read one path at a time, so memory use doesn't depend on its length.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FORMAT_ERROR if the list is malformed.
+ *      LE_FAULT if a path could not be removed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ApplyDeltaRemovals
+(
+    const char* unpackDir   ///< Directory the delta was unpacked into, over a copy of its base.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char listPath[LIMIT_MAX_PATH_BYTES] = "";
+    LE_FATAL_IF(le_path_Concat("/", listPath, sizeof(listPath), unpackDir, DELTA_REMOVED_FILE,
+                               NULL) != LE_OK,
+                "Path too long.");
+
+    FILE* listFile = fopen(listPath, "r");
+    if (listFile == NULL)
+    {
+        LE_ERROR("App delta has no removal list '%s' (%m).", listPath);
+        return LE_FORMAT_ERROR;
+    }
+
+    le_result_t result = LE_OK;
+    char entry[LIMIT_MAX_PATH_BYTES];
+    size_t len = 0;
+    int c;
+
+    while ((result == LE_OK) && ((c = getc(listFile)) != EOF))
+    {
+        if (c != '\0')
+        {
+            if (len >= sizeof(entry) - 1)
+            {
+                LE_ERROR("App delta removal list entry too long.");
+                result = LE_FORMAT_ERROR;
+            }
+            else
+            {
+                entry[len++] = (char)c;
+            }
+            continue;
+        }
+
+        entry[len] = '\0';
+        len = 0;
+
+        // Entries must stay inside the app.
+        if ( (strncmp(entry, "./", 2) != 0) ||
+             (strcmp(entry, "./..") == 0) ||
+             (strncmp(entry, "./../", 5) == 0) ||
+             (strstr(entry, "/../") != NULL) ||
+             ((strlen(entry) >= 3) && (strcmp(entry + strlen(entry) - 3, "/..") == 0)) )
+        {
+            LE_ERROR("Invalid path '%s' in app delta removal list.", entry);
+            result = LE_FORMAT_ERROR;
+            break;
+        }
+
+        char path[LIMIT_MAX_PATH_BYTES] = "";
+        if (le_path_Concat("/", path, sizeof(path), unpackDir, entry + 2, NULL) != LE_OK)
+        {
+            LE_ERROR("Path '%s' in app delta removal list too long.", entry);
+            result = LE_FORMAT_ERROR;
+            break;
+        }
+
+        struct stat statBuf;
+        if (lstat(path, &statBuf) == -1)
+        {
+            if (errno != ENOENT)
+            {
+                LE_ERROR("Failed to stat '%s' (%m).", path);
+                result = LE_FAULT;
+            }
+        }
+        else if (S_ISDIR(statBuf.st_mode))
+        {
+            result = le_dir_RemoveRecursive(path);
+        }
+        else if (unlink(path) == -1)
+        {
+            LE_ERROR("Failed to remove '%s' (%m).", path);
+            result = LE_FAULT;
+        }
+    }
+
+    if ((result == LE_OK) && (len != 0))
+    {
+        LE_ERROR("App delta removal list is not null-terminated.");
+        result = LE_FORMAT_ERROR;
+    }
+
+    fclose(listFile);
+
+    if (unlink(listPath) == -1)
+    {
+        LE_ERROR("Failed to remove '%s' (%m).", listPath);
+        result = (result == LE_OK) ? LE_FAULT : result;
+    }
+
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Completion callback for "tar xj" operation.
@@ -402,6 +560,26 @@ static void UntarDone
         return;
     }
 
+    // An app delta was unpacked over a copy of its base.  Remove what the new app doesn't have.
+    if (DeltaUnpackPath[0] != '\0')
+    {
+        le_result_t result = ApplyDeltaRemovals(DeltaUnpackPath);
+
+        DeltaBasePath[0] = '\0';
+        DeltaUnpackPath[0] = '\0';
+
+        if (result == LE_FORMAT_ERROR)
+        {
+            HandleFormatError();
+            return;
+        }
+        if (result != LE_OK)
+        {
+            HandleInternalError();
+            return;
+        }
+    }
+
     // If this update pack contains changes to individual apps,
     if (Type == TYPE_APP_UPDATE)
     {
@@ -482,16 +660,16 @@ static void CopyBytesToPipeline
 )
 //--------------------------------------------------------------------------------------------------
 {
-    char buffer[1024];
+    char* buffer = CopyBuffer;
 
     // Keep copying as much as we can until we've copied all the payload.
     while (PayloadBytesCopied < PayloadSize)
     {
         // Compute the number of bytes to read.
         size_t bytesToRead = PayloadSize - PayloadBytesCopied;
-        if (bytesToRead > sizeof(buffer))
+        if (bytesToRead > sizeof(CopyBuffer))
         {
-            bytesToRead = sizeof(buffer);
+            bytesToRead = sizeof(CopyBuffer);
         }
 
         // Read the bytes, retrying if interrupted by a signal.
@@ -588,16 +766,16 @@ static void DiscardPayloadBytes
 )
 //--------------------------------------------------------------------------------------------------
 {
-    char buffer[1024];
+    char* buffer = CopyBuffer;
 
     // Keep reading as much as we can until we've read all the payload.
     while (PayloadBytesCopied < PayloadSize)
     {
         // Compute the number of bytes to read.
         size_t bytesToRead = PayloadSize - PayloadBytesCopied;
-        if (bytesToRead > sizeof(buffer))
+        if (bytesToRead > sizeof(CopyBuffer))
         {
-            bytesToRead = sizeof(buffer);
+            bytesToRead = sizeof(CopyBuffer);
         }
 
         // Read the bytes, retrying if interrupted by a signal.
@@ -689,7 +867,106 @@ static void InputFdEventHandler
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Function that runs in the unpack pipeline's "tar" process.
+ * Finds a bzip2 decompressor on the target, the first time it is called.
+ *
+ * @return The decompressor, or NULL if there is none.
+ **/
+//--------------------------------------------------------------------------------------------------
+static const Decompressor_t* FindDecompressor
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (!DecompressorSearched)
+    {
+        size_t i;
+
+        for (i = 0; i < NUM_ARRAY_MEMBERS(Decompressors); i++)
+        {
+            if (access(Decompressors[i].pathPtr, X_OK) == 0)
+            {
+                DecompressorPtr = &Decompressors[i];
+                LE_INFO("Decompressing update payloads with '%s'.", DecompressorPtr->pathPtr);
+                break;
+            }
+        }
+
+        DecompressorSearched = true;
+    }
+
+    return DecompressorPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function that runs in the unpack pipeline's decompressor process, when there is one.
+ **/
+//--------------------------------------------------------------------------------------------------
+static int Decompress
+(
+    void* param
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const Decompressor_t* decompressorPtr = param;
+
+    fd_CloseAllNonStd();
+
+    execl(decompressorPtr->pathPtr, decompressorPtr->namePtr, decompressorPtr->argPtr, (char*)NULL);
+
+    LE_FATAL("Failed to exec %s (%m)", decompressorPtr->pathPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copies the base of the app delta being unpacked, if any, into the unpack directory.  Runs in the
+ * unpack pipeline's "tar" process, before tar is exec'ed.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void CopyDeltaBase
+(
+    const char* unpackDir
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (DeltaBasePath[0] == '\0')
+    {
+        return;
+    }
+
+    char srcPath[LIMIT_MAX_PATH_BYTES] = "";
+    LE_FATAL_IF(le_path_Concat("/", srcPath, sizeof(srcPath), DeltaBasePath, ".", NULL) != LE_OK,
+                "Path too long.");
+
+    pid_t pid = fork();
+    LE_FATAL_IF(pid == -1, "Failed to fork (%m)");
+
+    if (pid == 0)
+    {
+        execl("/bin/cp", "cp", "-a", srcPath, unpackDir, (char*)NULL);
+
+        LE_FATAL("Failed to exec cp (%m)");
+    }
+
+    int status;
+    pid_t result;
+    do
+    {
+        result = waitpid(pid, &status, 0);
+    }
+    while ((result == -1) && (errno == EINTR));
+
+    LE_FATAL_IF((result == -1) || !WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS),
+                "Failed to copy app delta base '%s' to '%s'.", DeltaBasePath, unpackDir);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function that runs in the unpack pipeline's "tar" process, when it has to decompress its input.
  **/
 //--------------------------------------------------------------------------------------------------
 static int Untar
@@ -704,6 +981,8 @@ static int Untar
     // This ensures that we don't keep copies of things like the pipeline input write pipe open.
     fd_CloseAllNonStd();
 
+    CopyDeltaBase(unpackDir);
+
     // Try bsdtar first.  If that fails, fallback to tar.
     execl("/usr/bin/bsdtar", "bsdtar", "xjmop", "-f", "-", "-C", unpackDir, (char*)NULL);
     execl("/bin/tar", "tar", "xjop", "-C", unpackDir, (char*)NULL);
@@ -712,6 +991,31 @@ static int Untar
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function that runs in the unpack pipeline's "tar" process, when its input is already
+ * decompressed.
+ **/
+//--------------------------------------------------------------------------------------------------
+static int UntarDecompressed
+(
+    void* param
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const char* unpackDir = param;
+
+    fd_CloseAllNonStd();
+
+    CopyDeltaBase(unpackDir);
+
+    execl("/usr/bin/bsdtar", "bsdtar", "xmop", "-f", "-", "-C", unpackDir, (char*)NULL);
+    execl("/bin/tar", "tar", "xop", "-C", unpackDir, (char*)NULL);
+
+    LE_FATAL("Failed to exec tar (%m)");
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Start unpacking a tarball.
@@ -727,10 +1031,31 @@ static void StartUntar
 
     PayloadBytesCopied = 0;
 
-    // Create a pipeline: PipelineFd -> tar
+    // An app delta is unpacked over a copy of the installed app it was made from.
+    if (DeltaFromMd5[0] != '\0')
+    {
+        LE_FATAL_IF(snprintf(DeltaBasePath, sizeof(DeltaBasePath), "/legato/apps/%s",
+                             DeltaFromMd5) >= (int)sizeof(DeltaBasePath),
+                    "Path too long.");
+        LE_FATAL_IF(le_utf8_Copy(DeltaUnpackPath, dirPath, sizeof(DeltaUnpackPath), NULL) != LE_OK,
+                    "Path too long.");
+    }
+
+    // Create a pipeline: PipelineFd -> bzip2 -> tar, so that decompression and writing the files
+    // run in parallel, or PipelineFd -> tar if there is no separate decompressor.
     Pipeline = pipeline_Create();
     PipelineFd = pipeline_CreateInputPipe(Pipeline);
-    pipeline_Append(Pipeline, Untar, (void*)dirPath);
+
+    const Decompressor_t* decompressorPtr = FindDecompressor();
+    if (decompressorPtr != NULL)
+    {
+        pipeline_Append(Pipeline, Decompress, (void*)decompressorPtr);
+        pipeline_Append(Pipeline, UntarDecompressed, (void*)dirPath);
+    }
+    else
+    {
+        pipeline_Append(Pipeline, Untar, (void*)dirPath);
+    }
     pipeline_Start(Pipeline, UntarDone);
 
     fd_SetNonBlocking(InputFd);
@@ -877,6 +1202,13 @@ static void JsonDone
             LE_ERROR("Malformed update pack (app update payload missing)");
             HandleFormatError();
         }
+        else if ((DeltaFromMd5[0] != '\0') && (app_Exists(DeltaFromMd5) == false) &&
+                 (app_Exists(Md5) == false))
+        {
+            LE_ERROR("App delta is for app with MD5 sum %s, which is not installed.",
+                     DeltaFromMd5);
+            HandleFormatError();
+        }
         else
         {
             if (Type == TYPE_UNKNOWN)
@@ -1073,6 +1405,21 @@ static void Md5EventHandler
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * "deltaFromMd5" member parsing event function.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeltaFromMd5EventHandler
+(
+    le_json_Event_t event
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StringMemberEventHandler(event, DeltaFromMd5, sizeof(DeltaFromMd5), "delta base MD5 hash");
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * "version" member parsing event function.
@@ -1196,6 +1543,10 @@ static void JsonEventHandler
             {
                 le_json_SetEventHandler(SizeEventHandler);
             }
+            else if (strcmp(memberName, "deltaFromMd5") == 0)
+            {
+                le_json_SetEventHandler(DeltaFromMd5EventHandler);
+            }
             else
             {
                 LE_ERROR("Malformed update pack (unexpected object member '%s').", memberName);
@@ -240,6 +240,10 @@ typedef struct
                                         ///< beyond it's maximum period by being treated as a
                                         ///< non-mandatory watchdog.
     le_timer_Ref_t timer;               ///< The timer this watchdog uses
+    le_clk_Time_t deadline;             ///< Relative time at which the watchdog expires
+    le_clk_Time_t timerExpiry;          ///< Relative time at which the timer was set to expire.
+                                        ///< Kicks only move the deadline; the timer is re-armed
+                                        ///< for the remaining time when it expires before it.
 }
 WatchdogObj_t;
 
@@ -287,6 +291,36 @@ static le_hashmap_Ref_t MandatoryWatchdogRefs;  ///< The container used to track
 
 static le_timer_Ref_t DefaultExternalWdogTimer; ///< Default external wdog timer
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set a watchdog to expire after the given timeout.
+ *
+ * Processes kick far more often than their watchdog expires, so a kick only moves the deadline
+ * when the timer is already due to expire before it: the timer is then re-armed once, when it
+ * expires, instead of being stopped and restarted on every kick.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ArmWatchdog
+(
+    WatchdogObj_t* dogPtr,          ///< [IN] Watchdog to arm
+    le_clk_Time_t timeout           ///< [IN] Time before the watchdog expires
+)
+{
+    dogPtr->deadline = le_clk_Add(le_clk_GetRelativeTime(), timeout);
+
+    if (le_timer_IsRunning(dogPtr->timer) &&
+        !le_clk_GreaterThan(dogPtr->timerExpiry, dogPtr->deadline))
+    {
+        return;
+    }
+
+    le_timer_Stop(dogPtr->timer);
+    // timer is stopped here so this should never fail
+    LE_ASSERT(LE_OK == le_timer_SetInterval(dogPtr->timer, timeout));
+    le_timer_Start(dogPtr->timer);
+    dogPtr->timerExpiry = dogPtr->deadline;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Remove the watchdog from our container, free the timer it contains and then free the storage
@@ -310,7 +344,10 @@ static void DeleteWatchdog
         {
             deadDogPtr->procId = NO_PROC;
             le_timer_SetContextPtr(deadDogPtr->timer, deadDogPtr);
-            le_timer_Start(deadDogPtr->timer);
+            if (!le_timer_IsRunning(deadDogPtr->timer))
+            {
+                ArmWatchdog(deadDogPtr, deadDogPtr->kickTimeoutInterval);
+            }
         }
         le_mem_Release(deadDogPtr);
     }
@@ -479,6 +516,17 @@ static void WatchdogHandleExpiry
 )
 {
     WatchdogObj_t* watchDogPtr = le_timer_GetContextPtr(timerRef);
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    if (le_clk_GreaterThan(watchDogPtr->deadline, now))
+    {
+        // Kicked since the timer was armed: wait for the rest of the timeout.
+        LE_ASSERT(LE_OK == le_timer_SetInterval(timerRef, le_clk_Sub(watchDogPtr->deadline, now)));
+        le_timer_Start(timerRef);
+        watchDogPtr->timerExpiry = watchDogPtr->deadline;
+        return;
+    }
+
     if (watchDogPtr->procId == NO_PROC)
     {
         // Mandatory watchdog expired without the process restarting.  Restart Legato.
@@ -825,6 +873,8 @@ static void InitNewWatchdog
     newDogPtr->procId = clientPid;
     newDogPtr->kickTimeoutInterval = kickTimeoutInterval;
     newDogPtr->maxKickTimeoutInterval = maxKickTimeoutInterval;
+    newDogPtr->deadline = (le_clk_Time_t){ 0, 0 };
+    newDogPtr->timerExpiry = (le_clk_Time_t){ 0, 0 };
 
     if (le_clk_GreaterThan(newDogPtr->kickTimeoutInterval, newDogPtr->maxKickTimeoutInterval))
     {
@@ -924,9 +974,7 @@ static void CreateMandatoryWatchdog
     LE_ASSERT(NULL == le_hashmap_Put(MandatoryWatchdogRefs, &(newDogPtr->key), newDogPtr));
 
     // Immediately start this watchdog.
-    LE_ASSERT(LE_OK == le_timer_SetInterval(newDogPtr->watchdog.timer,
-                                            newDogPtr->watchdog.kickTimeoutInterval));
-    le_timer_Start(newDogPtr->watchdog.timer);
+    ArmWatchdog(&(newDogPtr->watchdog), newDogPtr->watchdog.kickTimeoutInterval);
 }
 
 
@@ -959,9 +1007,7 @@ static MandatoryWatchdogObj_t* CreateFrameworkWatchdog
     LE_ASSERT(NULL == le_hashmap_Put(MandatoryWatchdogRefs, &(newDogPtr->key), newDogPtr));
 
     // Immediately start this watchdog.
-    LE_ASSERT(LE_OK == le_timer_SetInterval(newDogPtr->watchdog.timer,
-                                            newDogPtr->watchdog.kickTimeoutInterval));
-    le_timer_Start(newDogPtr->watchdog.timer);
+    ArmWatchdog(&(newDogPtr->watchdog), newDogPtr->watchdog.kickTimeoutInterval);
 
     return newDogPtr;
 }
@@ -1037,7 +1083,6 @@ static void ResetClientWatchdog
     WatchdogObj_t* watchDogPtr = GetClientWatchdogPtr();
     if (watchDogPtr != NULL)
     {
-        le_timer_Stop(watchDogPtr->timer);
         if (timeout == TIMEOUT_KICK)
         {
             timeoutValue = watchDogPtr->kickTimeoutInterval;
@@ -1061,12 +1106,11 @@ static void ResetClientWatchdog
 
         if (!le_clk_Equal(timeoutValue, MakeTimerInterval(LE_WDOG_TIMEOUT_NEVER)))
         {
-            // timer should be stopped here so this should never fail
-            LE_ASSERT(LE_OK == le_timer_SetInterval(watchDogPtr->timer, timeoutValue));
-            le_timer_Start(watchDogPtr->timer);
+            ArmWatchdog(watchDogPtr, timeoutValue);
         }
         else
         {
+            le_timer_Stop(watchDogPtr->timer);
             LE_DEBUG("Timeout set to NEVER!");
         }
     }
@@ -1090,7 +1134,7 @@ void ResetFrameworkWatchdog
 
     if (watchDogPtr != NULL)
     {
-        le_timer_Restart(watchDogPtr->watchdog.timer);
+        ArmWatchdog(&(watchDogPtr->watchdog), watchDogPtr->watchdog.kickTimeoutInterval);
     }
 }
 
@@ -10,6 +10,7 @@
 #include "le_rpcProxy.h"
 #include "le_rpcProxyNetwork.h"
 #include "le_rpcProxyConfig.h"
+#include "le_rpcProxyCompress.h"
 
 #ifndef RPC_PROXY_LOCAL_SERVICE
 #include <dlfcn.h>
@@ -665,6 +666,223 @@ uint32_t rpcProxy_GenerateProxyMessageId
     return GlobalMsgId;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to check whether a Proxy Message has a fixed layout, i.e., it is made up only of
+ * fixed-length items, with no strings, arrays or pointers.  Such a message needs no repack: only
+ * its Msg ID has to be converted to or from Network Order.
+ *
+ * @return
+ *      - true if the message has a fixed layout, with *usedSizePtr set to the size of the message
+ *        payload up to its last item.
+ *      - false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsFixedLayoutMessage
+(
+    const rpcProxy_Message_t *proxyMessagePtr, ///< [IN] Pointer to the Proxy Message
+    uint16_t *usedSizePtr ///< [OUT] Size of the message payload in use
+)
+{
+    const uint8_t* msgBufPtr = &proxyMessagePtr->message[LE_PACK_SIZEOF_UINT32];
+    const uint8_t* msgEndPtr = &proxyMessagePtr->message[proxyMessagePtr->msgSize];
+
+    // First field in message is the Msg ID (uint32_t)
+    if (proxyMessagePtr->msgSize < LE_PACK_SIZEOF_UINT32)
+    {
+        return false;
+    }
+
+    // Walk the Tag IDs, without copying anything
+    while (msgBufPtr < msgEndPtr)
+    {
+        TagID_t tagId = *msgBufPtr;
+
+        switch(tagId)
+        {
+            // Fixed-length Types
+            case LE_PACK_UINT8:
+            case LE_PACK_INT8:
+            case LE_PACK_BOOL:
+            case LE_PACK_CHAR:
+            case LE_PACK_UINT16:
+            case LE_PACK_INT16:
+            case LE_PACK_RESULT:
+            case LE_PACK_ONOFF:
+            case LE_PACK_UINT32:
+            case LE_PACK_INT32:
+            case LE_PACK_REFERENCE:
+            case LE_PACK_SIZE:
+            case LE_PACK_UINT64:
+            case LE_PACK_INT64:
+            case LE_PACK_DOUBLE:
+            {
+                msgBufPtr += (LE_PACK_SIZEOF_TAG_ID + ItemPackSize[tagId]);
+                break;
+            }
+
+            // Variable-length or Special Types, which need a repack
+            case LE_PACK_STRING:
+            case LE_PACK_ARRAYHEADER:
+            case LE_PACK_STRING_RESPONSE_SIZE:
+            case LE_PACK_ARRAY_RESPONSE_SIZE:
+            case LE_PACK_IN_STRING_POINTER:
+            case LE_PACK_OUT_STRING_POINTER:
+            case LE_PACK_IN_ARRAY_POINTER:
+            case LE_PACK_OUT_ARRAY_POINTER:
+            {
+                return false;
+            }
+
+            default:
+            {
+                // End of the message items
+                *usedSizePtr = (msgBufPtr - &proxyMessagePtr->message[0]);
+                return true;
+            }
+        }
+    }
+
+    // Leave a truncated last item to the repack
+    if (msgBufPtr > msgEndPtr)
+    {
+        return false;
+    }
+
+    *usedSizePtr = proxyMessagePtr->msgSize;
+    return true;
+}
+
+
+#ifdef RPC_PROXY_LOCAL_SERVICE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function to check whether any "out" parameter response buffers are waiting to be sent with a
+ * Server Response Proxy Message.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool HasLocalResponseData
+(
+    const rpcProxy_Message_t *proxyMessagePtr ///< [IN] Pointer to the Proxy Message
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&LocalMessageList);
+
+    while (linkPtr != NULL)
+    {
+        rpcProxy_LocalMessage_t* localMessagePtr =
+            CONTAINER_OF(linkPtr, rpcProxy_LocalMessage_t, link);
+
+        if (localMessagePtr->id == proxyMessagePtr->commonHeader.id)
+        {
+            return true;
+        }
+
+        linkPtr = le_dls_PeekNext(&LocalMessageList, linkPtr);
+    }
+
+    return false;
+}
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Buffer for a Proxy Message whose payload has been compressed for sending, or for a payload
+ * being decompressed on receipt.
+ */
+//--------------------------------------------------------------------------------------------------
+static rpcProxy_Message_t CompressionBuffer;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for compressing the Legato Message payload of a Client-Request or Server-Response
+ * Message that is ready for sending (in Network Order).
+ *
+ * @return
+ *      - Pointer to the compressed message, with *byteCountPtr updated, or
+ *      - the message itself, if its payload is too small or doesn't compress.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* CompressMessage
+(
+    rpcProxy_Message_t* proxyMessagePtr, ///< [IN] Message ready for sending
+    size_t* byteCountPtr ///< [IN/OUT] Total size of the message
+)
+{
+    size_t payloadSize = *byteCountPtr - RPC_PROXY_MSG_HEADER_SIZE;
+    size_t compressedSize;
+
+#if RPC_PROXY_COMPRESSION_THRESHOLD > 0
+    if (payloadSize < RPC_PROXY_COMPRESSION_THRESHOLD)
+    {
+        return proxyMessagePtr;
+    }
+#else
+    // Compression is never agreed to, so there is nothing to do
+    return proxyMessagePtr;
+#endif
+
+    compressedSize = rpcProxyCompress_Compress(proxyMessagePtr->message,
+                                               payloadSize,
+                                               CompressionBuffer.message,
+                                               sizeof(CompressionBuffer.message));
+    if (compressedSize == 0)
+    {
+        return proxyMessagePtr;
+    }
+
+    CompressionBuffer.commonHeader = proxyMessagePtr->commonHeader;
+    CompressionBuffer.commonHeader.type |= RPC_PROXY_COMPRESSED_MSG;
+    CompressionBuffer.msgSize = htobe16(compressedSize);
+
+    LE_DEBUG("Compressed payload from [%" PRIuS "] to [%" PRIuS "] bytes",
+             payloadSize,
+             compressedSize);
+
+    *byteCountPtr = RPC_PROXY_MSG_HEADER_SIZE + compressedSize;
+    return &CompressionBuffer;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for decompressing, in place, the Legato Message payload of a received Client-Request
+ * or Server-Response Message (still in Network Order).
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_FORMAT_ERROR, if the payload could not be decompressed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t DecompressMessage
+(
+    rpcProxy_Message_t* proxyMessagePtr, ///< [IN] Received message
+    size_t* bufferSizePtr ///< [IN/OUT] Total size of the message
+)
+{
+    size_t payloadSize = sizeof(CompressionBuffer.message);
+    le_result_t result;
+
+    result = rpcProxyCompress_Decompress(proxyMessagePtr->message,
+                                         be16toh(proxyMessagePtr->msgSize),
+                                         CompressionBuffer.message,
+                                         &payloadSize);
+    if (result != LE_OK)
+    {
+        LE_ERROR("Unable to decompress Proxy Message, id [%" PRIu32 "], result %d",
+                 be32toh(proxyMessagePtr->commonHeader.id),
+                 result);
+        return LE_FORMAT_ERROR;
+    }
+
+    memcpy(proxyMessagePtr->message, CompressionBuffer.message, payloadSize);
+    proxyMessagePtr->msgSize = htobe16(payloadSize);
+    proxyMessagePtr->commonHeader.type &= ~RPC_PROXY_COMPRESSED_MSG;
+
+    *bufferSizePtr = RPC_PROXY_MSG_HEADER_SIZE + payloadSize;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function for sending Proxy Messages to the far side via the le_comm API
@@ -679,8 +897,12 @@ le_result_t rpcProxy_SendMsg
     le_result_t         result;
     size_t              byteCount;
     rpcProxy_Message_t  tmpProxyMessage;
-    rpcProxy_Message_t *proxyMessagePtr;
+    rpcProxy_Message_t *proxyMessagePtr = NULL;
     void               *sendMessagePtr;
+    uint16_t            usedSize = 0;
+    uint16_t            originalMsgSize = 0;
+    bool                isFixedLayout = false;
+    bool                mayDefer = false;
 
     // Retrieve the Network Record for this system
     NetworkRecord_t* networkRecordPtr =
@@ -757,10 +979,46 @@ le_result_t rpcProxy_SendMsg
             proxyMessagePtr =
                 (rpcProxy_Message_t*) messagePtr;
 
+            // Only a one-way request may be held back and aggregated with later messages.
+            // Anything a client waits on is sent straight away, along with what is held back.
+            if (commonHeaderPtr->type == RPC_PROXY_CLIENT_REQUEST)
+            {
+                le_msg_MessageRef_t msgRef =
+                    le_hashmap_Get(MsgRefMapByProxyId, (void*)(uintptr_t) commonHeaderPtr->id);
+
+                mayDefer = (msgRef != NULL) && !le_msg_NeedsResponse(msgRef);
+            }
+
 #if RPC_PROXY_HEX_DUMP
             print_hex(proxyMessagePtr->message, proxyMessagePtr->msgSize);
 #endif
 
+            // A fixed-layout message is sent as it is, with no repack.  Only its header and Msg ID
+            // are converted to Network Order, in place, and they are converted back once sent.
+            isFixedLayout = IsFixedLayoutMessage(proxyMessagePtr, &usedSize);
+#ifdef RPC_PROXY_LOCAL_SERVICE
+            isFixedLayout = isFixedLayout && !HasLocalResponseData(proxyMessagePtr);
+#endif
+            if (isFixedLayout)
+            {
+                uint32_t id;
+
+                memcpy((uint8_t*) &id, &proxyMessagePtr->message[0], LE_PACK_SIZEOF_UINT32);
+                id = htobe32(id);
+                memcpy(&proxyMessagePtr->message[0], (uint8_t*) &id, LE_PACK_SIZEOF_UINT32);
+
+                byteCount = RPC_PROXY_MSG_HEADER_SIZE + usedSize;
+
+                commonHeaderPtr->id = htobe32(commonHeaderPtr->id);
+                commonHeaderPtr->serviceId = htobe32(commonHeaderPtr->serviceId);
+
+                originalMsgSize = proxyMessagePtr->msgSize;
+                proxyMessagePtr->msgSize = htobe16(usedSize);
+
+                sendMessagePtr = proxyMessagePtr;
+                break;
+            }
+
             // Re-package proxy message before sending
             result = RepackMessage(proxyMessagePtr, &tmpProxyMessage, true);
             if (result != LE_OK)
@@ -806,6 +1064,12 @@ le_result_t rpcProxy_SendMsg
         }
     } // End of switch-statement
 
+    // Compress the Legato Message payload, if the far side has agreed to it
+    if ((proxyMessagePtr != NULL) && networkRecordPtr->isCompressed)
+    {
+        sendMessagePtr = CompressMessage(sendMessagePtr, &byteCount);
+    }
+
     LE_DEBUG("Sending %s Proxy Message, service-id [%" PRIu32 "], "
              "proxy id [%" PRIu32 "], size [%" PRIuS "]",
              DisplayMessageType(commonHeaderPtr->type),
@@ -814,7 +1078,7 @@ le_result_t rpcProxy_SendMsg
              byteCount);
 
     // Send the Message Payload as an outgoing Proxy Message to the far-size RPC Proxy
-    result = le_comm_Send(networkRecordPtr->handle, sendMessagePtr, byteCount);
+    result = rpcProxyNetwork_SendMessage(networkRecordPtr, sendMessagePtr, byteCount, mayDefer);
     if (result != LE_OK)
     {
         // Delete the Network Communication Channel
@@ -825,6 +1089,18 @@ le_result_t rpcProxy_SendMsg
     commonHeaderPtr->id = be32toh(commonHeaderPtr->id);
     commonHeaderPtr->serviceId = be32toh(commonHeaderPtr->serviceId);
 
+    // Put a fixed-layout message, which was sent in place, back into Host Order
+    if (isFixedLayout)
+    {
+        uint32_t id;
+
+        memcpy((uint8_t*) &id, &proxyMessagePtr->message[0], LE_PACK_SIZEOF_UINT32);
+        id = be32toh(id);
+        memcpy(&proxyMessagePtr->message[0], (uint8_t*) &id, LE_PACK_SIZEOF_UINT32);
+
+        proxyMessagePtr->msgSize = originalMsgSize;
+    }
+
     return result;
 }
 
@@ -890,6 +1166,8 @@ static le_result_t RecvMsg
 
                 case RPC_PROXY_CLIENT_REQUEST:
                 case RPC_PROXY_SERVER_RESPONSE:
+                case RPC_PROXY_CLIENT_REQUEST | RPC_PROXY_COMPRESSED_MSG:
+                case RPC_PROXY_SERVER_RESPONSE | RPC_PROXY_COMPRESSED_MSG:
                     msgStatePtr->expectedSize =
                         LE_PACK_SIZEOF_UINT16;
                     break;
@@ -911,8 +1189,10 @@ static le_result_t RecvMsg
         }
         else if (msgStatePtr->recvState == NETWORK_MSG_MESSAGE) // MESSAGE State
         {
-            if ((msgStatePtr->type == RPC_PROXY_CLIENT_REQUEST) ||
-                (msgStatePtr->type == RPC_PROXY_SERVER_RESPONSE))
+            uint8_t type = msgStatePtr->type & ~RPC_PROXY_COMPRESSED_MSG;
+
+            if ((type == RPC_PROXY_CLIENT_REQUEST) ||
+                (type == RPC_PROXY_SERVER_RESPONSE))
             {
                 //
                 // Variable-length Message types
@@ -1007,6 +1287,16 @@ static le_result_t RecvMsg
 
     } // While-loop
 
+    // Decompress the Legato Message payload, if it was sent compressed
+    if (msgStatePtr->type & RPC_PROXY_COMPRESSED_MSG)
+    {
+        result = DecompressMessage((rpcProxy_Message_t*) msgStatePtr->buffer, bufferSizePtr);
+        if (result != LE_OK)
+        {
+            return result;
+        }
+    }
+
     // Pre-process the buffer before processing the message payload
     result = PreProcessResponse(msgStatePtr->buffer, bufferSizePtr);
     return result;
@@ -1884,6 +2174,21 @@ static le_result_t PreProcessResponse
             print_hex(proxyMessagePtr->message, proxyMessagePtr->msgSize);
 #endif
 
+            // A fixed-layout message needs no repack, only its Msg ID put into Host Order
+            uint16_t usedSize;
+
+            if (IsFixedLayoutMessage(proxyMessagePtr, &usedSize))
+            {
+                uint32_t id;
+
+                memcpy((uint8_t*) &id, &proxyMessagePtr->message[0], LE_PACK_SIZEOF_UINT32);
+                id = be32toh(id);
+                memcpy(&proxyMessagePtr->message[0], (uint8_t*) &id, LE_PACK_SIZEOF_UINT32);
+
+                proxyMessagePtr->msgSize = usedSize;
+                break;
+            }
+
             // Re-package proxy message before processing
             result = RepackMessage(proxyMessagePtr, &tmpProxyMessage, false);
             if (result != LE_OK)
@@ -2515,6 +2820,35 @@ static le_result_t DeleteConnectServiceRequestTimer
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for applying the link features agreed with a far-side system.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetLinkFeatures
+(
+    const char* systemName, ///< [IN] Name of the far-side system
+    int32_t linkFeatures ///< [IN] Link features agreed (RPC_PROXY_LINK_FEATURE_...)
+)
+{
+    NetworkRecord_t* networkRecordPtr =
+        le_hashmap_Get(rpcProxyNetwork_GetNetworkRecordHashMapByName(), systemName);
+
+    if (networkRecordPtr == NULL)
+    {
+        return;
+    }
+
+    bool isCompressed = ((linkFeatures & RPC_PROXY_LINK_FEATURE_COMPRESSION) != 0);
+    if (isCompressed != networkRecordPtr->isCompressed)
+    {
+        LE_INFO("Payload compression %s, system [%s]",
+                isCompressed ? "enabled" : "disabled",
+                systemName);
+        networkRecordPtr->isCompressed = isCompressed;
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function for Processing Connect-Service Response
@@ -2531,7 +2865,7 @@ static le_result_t ProcessConnectServiceResponse
     LE_ASSERT(proxyMessagePtr->commonHeader.type == RPC_PROXY_CONNECT_SERVICE_RESPONSE);
 
     // Check if service has been established successfully on the far-side
-    if (proxyMessagePtr->serviceCode != LE_OK)
+    if (proxyMessagePtr->serviceCode < LE_OK)
     {
         // Remote-side failed to set-up service
         LE_INFO("%s failed, serviceId "
@@ -2546,6 +2880,10 @@ static le_result_t ProcessConnectServiceResponse
     // Delete and clean-up the Connect-Service-Request timer
     DeleteConnectServiceRequestTimer(proxyMessagePtr->commonHeader.serviceId);
 
+    // A successful service-code holds the link features the far-side has accepted
+    SetLinkFeatures(proxyMessagePtr->systemName,
+                    proxyMessagePtr->serviceCode & RPC_PROXY_LINK_FEATURES);
+
     // Traverse all Service Reference entries in the Service Reference array and
     // search for matching service-name
     for (uint32_t index = 0; rpcProxyConfig_GetServerReferenceArray(index); index++)
@@ -2699,6 +3037,9 @@ static le_result_t ProcessConnectServiceRequest
     // Sanity Check - Verify Message Type
     LE_ASSERT(proxyMessagePtr->commonHeader.type == RPC_PROXY_CONNECT_SERVICE_REQUEST);
 
+    // The service-code of the request holds the link features offered by the far-side
+    int32_t linkFeatures = proxyMessagePtr->serviceCode & RPC_PROXY_LINK_FEATURES;
+
     LE_INFO("======= Starting RPC Proxy client for '%s' service, '%s' protocol ========",
             proxyMessagePtr->serviceName, proxyMessagePtr->protocolIdStr);
 
@@ -2713,8 +3054,17 @@ static le_result_t ProcessConnectServiceRequest
     // Set the Proxy Message type to CONNECT_SERVICE_RESPONSE
     proxyMessagePtr->commonHeader.type = RPC_PROXY_CONNECT_SERVICE_RESPONSE;
 
-    // Set the service-code with the DoConnectService result-code
-    proxyMessagePtr->serviceCode = result;
+    // Set the service-code with the DoConnectService result-code,
+    // or, if successful, with the link features accepted
+    if (result == LE_OK)
+    {
+        SetLinkFeatures(systemName, linkFeatures);
+        proxyMessagePtr->serviceCode = linkFeatures;
+    }
+    else
+    {
+        proxyMessagePtr->serviceCode = result;
+    }
 
     // Send Proxy Message to far-side
     result = rpcProxy_SendMsg(systemName, proxyMessagePtr);
@@ -2873,15 +3223,16 @@ void rpcProxy_AsyncRecvHandler
     rpcProxy_CommonHeader_t *commonHeaderPtr = NULL;
     le_result_t              result;
 
-    // Retrieve the system-name from where this message has been sent
-    // by a reverse look-up, using the handle
-    systemName = rpcProxyNetwork_GetSystemNameByHandle(handle);
-    if (systemName == NULL)
+    // Retrieve the Network Record, and with it the system-name from where this message has been
+    // sent, by a reverse look-up using the handle
+    NetworkRecord_t* networkRecordPtr = rpcProxyNetwork_GetNetworkRecordByHandle(handle);
+    if (networkRecordPtr == NULL)
     {
         LE_ERROR("Unable to retrieve system-name, handle [%d] - unknown system",
                  le_comm_GetId(handle));
         return;
     }
+    systemName = (char*) networkRecordPtr->systemName;
 
     if (events & POLLIN)
     {
@@ -2889,16 +3240,6 @@ void rpcProxy_AsyncRecvHandler
         // Data waiting to be read
         //
 
-        // Retrieve the Network Record Message State-Machine, using the handle
-        NetworkRecord_t* networkRecordPtr =
-            rpcProxyNetwork_GetNetworkRecordByHandle(handle);
-
-        if (networkRecordPtr == NULL)
-        {
-            LE_ERROR("Unknown Network Record");
-            return;
-        }
-
         bool done = false;
 
         while (!done)
@@ -2935,6 +3276,13 @@ void rpcProxy_AsyncRecvHandler
             // Set a pointer to the common message header
             commonHeaderPtr = (rpcProxy_CommonHeader_t*) buffer;
 
+            // Any message from the far side, other than an answer to our own keep-alive, shows
+            // the link is alive
+            if (commonHeaderPtr->type != RPC_PROXY_KEEPALIVE_RESPONSE)
+            {
+                networkRecordPtr->health.messagesReceived++;
+            }
+
             // Test the Proxy Message type and dispatch the event
             switch (commonHeaderPtr->type)
             {
@@ -3314,8 +3662,8 @@ static void SendSessionConnectRequest
                  sizeof(proxyMessagePtr->protocolIdStr),
                  NULL);
 
-    // Initialize the service-code to LE_OK
-    proxyMessagePtr->serviceCode = LE_OK;
+    // Initialize the service-code with the link features offered (LE_OK, if none)
+    proxyMessagePtr->serviceCode = RPC_PROXY_LINK_FEATURES;
 
     // Send Proxy Message to far-side
     result = rpcProxy_SendMsg(systemName, proxyMessagePtr);
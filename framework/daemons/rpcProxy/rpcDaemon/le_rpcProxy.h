@@ -80,6 +80,13 @@
 #define RPC_PROXY_KEEPALIVE_MSG_SIZE           (sizeof(rpcProxy_KeepAliveMessage_t) - \
                                                RPC_PROXY_COMMON_MSG_HEADER_SIZE)
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Smallest Legato Message payload that is compressed (0 turns compression off).
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_COMPRESSION_THRESHOLD        LE_CONFIG_RPC_PROXY_COMPRESSION_THRESHOLD
+
 //--------------------------------------------------------------------------------------------------
 /**
  * RPC Proxy Message Types
@@ -94,6 +101,31 @@
 #define RPC_PROXY_KEEPALIVE_RESPONSE           7
 #define RPC_PROXY_REQUEST_RESPONSE             8
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Flag set in the type of a Client-Request or Server-Response Message whose Legato Message
+ * payload is compressed.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_COMPRESSED_MSG               0x80
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Proxy Link Features
+ *
+ * A Connect-Service Request offers the features the sender supports in its service-code, which
+ * older senders set to LE_OK (no features).  A successful Connect-Service Response accepts the
+ * features both sides support, in place of LE_OK.  Failures are still negative result-codes.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_LINK_FEATURE_COMPRESSION     0x1
+
+#if RPC_PROXY_COMPRESSION_THRESHOLD > 0
+#define RPC_PROXY_LINK_FEATURES                RPC_PROXY_LINK_FEATURE_COMPRESSION
+#else
+#define RPC_PROXY_LINK_FEATURES                0
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * RPC Proxy Common Message Header Structure
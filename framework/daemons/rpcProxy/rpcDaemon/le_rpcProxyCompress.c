@@ -0,0 +1,389 @@
+/**
+ * @file le_rpcProxyCompress.c
+ *
+ * This file contains the source code for the RPC Proxy payload compression functions.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "le_rpcProxyCompress.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * LZ4 block format definitions
+ */
+//--------------------------------------------------------------------------------------------------
+#define COMPRESS_MIN_MATCH          4   ///< Shortest match that is encoded
+#define COMPRESS_LAST_LITERALS      5   ///< Number of bytes at the end that are always literals
+#define COMPRESS_MATCH_LIMIT        12  ///< No match may start in this many bytes at the end
+#define COMPRESS_MAX_OFFSET         65535
+#define COMPRESS_RUN_MASK           0x0F ///< Largest length held in a token nibble
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of entries in the match-finder hash table (a power of 2).
+ */
+//--------------------------------------------------------------------------------------------------
+#define COMPRESS_HASH_BITS          10
+#define COMPRESS_HASH_SIZE          (1 << COMPRESS_HASH_BITS)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Match-finder hash table, holding the last position (plus one, so that zero is "empty") at
+ * which each hash of four bytes was seen.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t HashTable[COMPRESS_HASH_SIZE];
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for reading four bytes, whatever their alignment.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint32_t Read32
+(
+    const uint8_t* ptr
+)
+{
+    uint32_t value;
+
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for hashing four bytes into a hash table index.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint32_t Hash
+(
+    uint32_t value
+)
+{
+    return (value * 2654435761U) >> (32 - COMPRESS_HASH_BITS);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for writing the extension bytes of a length that doesn't fit in a token nibble.
+ *
+ * @return
+ *      - Pointer past the extension bytes, or
+ *      - NULL, if they don't fit in the destination buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t* PutLength
+(
+    uint8_t* dstPtr, ///< [IN] Where to write
+    const uint8_t* dstEndPtr, ///< [IN] End of the destination buffer
+    size_t length ///< [IN] Length, less COMPRESS_RUN_MASK
+)
+{
+    while (length >= 255)
+    {
+        if (dstPtr >= dstEndPtr)
+        {
+            return NULL;
+        }
+        *dstPtr++ = 255;
+        length -= 255;
+    }
+
+    if (dstPtr >= dstEndPtr)
+    {
+        return NULL;
+    }
+    *dstPtr++ = (uint8_t) length;
+
+    return dstPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for writing a sequence: a token, a literal run, and, unless it is the last sequence,
+ * a match.
+ *
+ * @return
+ *      - Pointer past the sequence, or
+ *      - NULL, if it doesn't fit in the destination buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t* PutSequence
+(
+    uint8_t* dstPtr, ///< [IN] Where to write
+    const uint8_t* dstEndPtr, ///< [IN] End of the destination buffer
+    const uint8_t* literalPtr, ///< [IN] Literal run
+    size_t literalSize, ///< [IN] Length of the literal run
+    size_t offset, ///< [IN] Match offset (0 for the last sequence)
+    size_t matchSize ///< [IN] Match length
+)
+{
+    uint8_t* tokenPtr = dstPtr++;
+
+    if (tokenPtr >= dstEndPtr)
+    {
+        return NULL;
+    }
+
+    // Literal run length
+    if (literalSize >= COMPRESS_RUN_MASK)
+    {
+        *tokenPtr = COMPRESS_RUN_MASK << 4;
+        dstPtr = PutLength(dstPtr, dstEndPtr, literalSize - COMPRESS_RUN_MASK);
+        if (dstPtr == NULL)
+        {
+            return NULL;
+        }
+    }
+    else
+    {
+        *tokenPtr = (uint8_t) (literalSize << 4);
+    }
+
+    // Literal run
+    if ((size_t) (dstEndPtr - dstPtr) < literalSize)
+    {
+        return NULL;
+    }
+    memcpy(dstPtr, literalPtr, literalSize);
+    dstPtr += literalSize;
+
+    if (offset == 0)
+    {
+        return dstPtr;
+    }
+
+    // Match offset, in little-endian order
+    if ((dstEndPtr - dstPtr) < 2)
+    {
+        return NULL;
+    }
+    *dstPtr++ = (uint8_t) offset;
+    *dstPtr++ = (uint8_t) (offset >> 8);
+
+    // Match length
+    matchSize -= COMPRESS_MIN_MATCH;
+    if (matchSize >= COMPRESS_RUN_MASK)
+    {
+        *tokenPtr |= COMPRESS_RUN_MASK;
+        dstPtr = PutLength(dstPtr, dstEndPtr, matchSize - COMPRESS_RUN_MASK);
+    }
+    else
+    {
+        *tokenPtr |= (uint8_t) matchSize;
+    }
+
+    return dstPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for reading the extension bytes of a length.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_FORMAT_ERROR, if the extension runs past the end of the compressed payload.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetLength
+(
+    const uint8_t** srcPtrPtr, ///< [IN/OUT] Where to read
+    const uint8_t* srcEndPtr, ///< [IN] End of the compressed payload
+    size_t* lengthPtr ///< [IN/OUT] Length
+)
+{
+    uint8_t byte;
+
+    do
+    {
+        if (*srcPtrPtr >= srcEndPtr)
+        {
+            return LE_FORMAT_ERROR;
+        }
+        byte = *(*srcPtrPtr)++;
+        *lengthPtr += byte;
+    }
+    while (byte == 255);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for compressing a payload.
+ *
+ * @return
+ *      - The size of the compressed payload, or
+ *      - 0, if the payload doesn't compress to less than its own size (or doesn't fit in the
+ *        destination buffer), in which case it should be sent as it is.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t rpcProxyCompress_Compress
+(
+    const uint8_t* srcPtr, ///< [IN] Payload to compress
+    size_t srcSize, ///< [IN] Size of the payload
+    uint8_t* dstPtr, ///< [OUT] Buffer for the compressed payload
+    size_t dstSize ///< [IN] Size of the buffer
+)
+{
+    // Nothing shorter than this can hold a match
+    if (srcSize <= COMPRESS_MATCH_LIMIT)
+    {
+        return 0;
+    }
+
+    // Only a smaller result is of any use
+    if (dstSize >= srcSize)
+    {
+        dstSize = srcSize - 1;
+    }
+
+    const uint8_t* dstEndPtr = dstPtr + dstSize;
+    uint8_t* outPtr = dstPtr;
+    size_t matchStartLimit = srcSize - COMPRESS_MATCH_LIMIT;
+    size_t matchEndLimit = srcSize - COMPRESS_LAST_LITERALS;
+    size_t anchor = 0;
+    size_t pos = 0;
+
+    memset(HashTable, 0, sizeof(HashTable));
+
+    while (pos < matchStartLimit)
+    {
+        uint32_t sequence = Read32(srcPtr + pos);
+        uint32_t hash = Hash(sequence);
+        size_t candidate = HashTable[hash];
+
+        HashTable[hash] = pos + 1;
+
+        if ((candidate == 0) ||
+            ((pos - (candidate - 1)) > COMPRESS_MAX_OFFSET) ||
+            (Read32(srcPtr + candidate - 1) != sequence))
+        {
+            pos++;
+            continue;
+        }
+        candidate--;
+
+        // Extend the match as far as it goes
+        size_t matchSize = COMPRESS_MIN_MATCH;
+        while (((pos + matchSize) < matchEndLimit) &&
+               (srcPtr[candidate + matchSize] == srcPtr[pos + matchSize]))
+        {
+            matchSize++;
+        }
+
+        outPtr = PutSequence(outPtr, dstEndPtr,
+                             srcPtr + anchor, pos - anchor,
+                             pos - candidate, matchSize);
+        if (outPtr == NULL)
+        {
+            return 0;
+        }
+
+        pos += matchSize;
+        anchor = pos;
+    }
+
+    // The rest of the payload is the final literal run
+    outPtr = PutSequence(outPtr, dstEndPtr, srcPtr + anchor, srcSize - anchor, 0, 0);
+    if (outPtr == NULL)
+    {
+        return 0;
+    }
+
+    return (size_t) (outPtr - dstPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for decompressing a payload.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_FORMAT_ERROR, if the compressed payload is damaged,
+ *      - LE_OVERFLOW, if the payload doesn't fit in the destination buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyCompress_Decompress
+(
+    const uint8_t* srcPtr, ///< [IN] Compressed payload
+    size_t srcSize, ///< [IN] Size of the compressed payload
+    uint8_t* dstPtr, ///< [OUT] Buffer for the payload
+    size_t* dstSizePtr ///< [IN/OUT] Size of the buffer, then size of the payload
+)
+{
+    const uint8_t* srcEndPtr = srcPtr + srcSize;
+    size_t dstSize = *dstSizePtr;
+    size_t pos = 0;
+
+    while (srcPtr < srcEndPtr)
+    {
+        uint8_t token = *srcPtr++;
+
+        // Literal run
+        size_t literalSize = token >> 4;
+        if ((literalSize == COMPRESS_RUN_MASK) &&
+            (GetLength(&srcPtr, srcEndPtr, &literalSize) != LE_OK))
+        {
+            return LE_FORMAT_ERROR;
+        }
+
+        if ((size_t) (srcEndPtr - srcPtr) < literalSize)
+        {
+            return LE_FORMAT_ERROR;
+        }
+        if ((dstSize - pos) < literalSize)
+        {
+            return LE_OVERFLOW;
+        }
+        memcpy(dstPtr + pos, srcPtr, literalSize);
+        srcPtr += literalSize;
+        pos += literalSize;
+
+        // The last sequence has no match
+        if (srcPtr == srcEndPtr)
+        {
+            break;
+        }
+
+        // Match
+        if ((srcEndPtr - srcPtr) < 2)
+        {
+            return LE_FORMAT_ERROR;
+        }
+        size_t offset = srcPtr[0] | (srcPtr[1] << 8);
+        srcPtr += 2;
+
+        if ((offset == 0) || (offset > pos))
+        {
+            return LE_FORMAT_ERROR;
+        }
+
+        size_t matchSize = token & COMPRESS_RUN_MASK;
+        if ((matchSize == COMPRESS_RUN_MASK) &&
+            (GetLength(&srcPtr, srcEndPtr, &matchSize) != LE_OK))
+        {
+            return LE_FORMAT_ERROR;
+        }
+        matchSize += COMPRESS_MIN_MATCH;
+
+        if ((dstSize - pos) < matchSize)
+        {
+            return LE_OVERFLOW;
+        }
+
+        // The match may overlap its own output, so it is copied a byte at a time
+        const uint8_t* matchPtr = dstPtr + pos - offset;
+        while (matchSize-- > 0)
+        {
+            dstPtr[pos++] = *matchPtr++;
+        }
+    }
+
+    *dstSizePtr = pos;
+    return LE_OK;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file le_rpcProxyCompress.h
+ *
+ * Header file for the RPC Proxy payload compression functions.
+ *
+ * Payloads are compressed in the LZ4 block format: a sequence of literal runs, each followed by
+ * a match (a copy of earlier output, given as an offset and a length).  The format needs no
+ * tables on the receiving side, and its decoding is cheap, which suits the small payloads carried
+ * by Proxy Messages.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LE_RPC_PROXY_COMPRESS_H_INCLUDE_GUARD
+#define LE_RPC_PROXY_COMPRESS_H_INCLUDE_GUARD
+
+#include "legato.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for compressing a payload.
+ *
+ * @return
+ *      - The size of the compressed payload, or
+ *      - 0, if the payload doesn't compress to less than its own size (or doesn't fit in the
+ *        destination buffer), in which case it should be sent as it is.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t rpcProxyCompress_Compress
+(
+    const uint8_t* srcPtr, ///< [IN] Payload to compress
+    size_t srcSize, ///< [IN] Size of the payload
+    uint8_t* dstPtr, ///< [OUT] Buffer for the compressed payload
+    size_t dstSize ///< [IN] Size of the buffer
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for decompressing a payload.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_FORMAT_ERROR, if the compressed payload is damaged,
+ *      - LE_OVERFLOW, if the payload doesn't fit in the destination buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyCompress_Decompress
+(
+    const uint8_t* srcPtr, ///< [IN] Compressed payload
+    size_t srcSize, ///< [IN] Size of the compressed payload
+    uint8_t* dstPtr, ///< [OUT] Buffer for the payload
+    size_t* dstSizePtr ///< [IN/OUT] Size of the buffer, then size of the payload
+);
+
+#endif /* LE_RPC_PROXY_COMPRESS_H_INCLUDE_GUARD */
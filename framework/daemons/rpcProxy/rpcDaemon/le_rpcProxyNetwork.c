@@ -73,6 +73,68 @@ LE_MEM_DEFINE_STATIC_POOL(NetworkRecordPool,
 static le_mem_PoolRef_t NetworkRecordPoolRef = NULL;
 
 
+#if RPC_PROXY_NETWORK_AGGREGATION_MAX_DELAY > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * This pool is used to allocate memory for the Network Frames of aggregated messages.
+ * Initialized in rpcProxy_COMPONENT_INIT().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(NetworkFramePool,
+                          RPC_PROXY_NETWORK_SYSTEM_MAX_NUM,
+                          sizeof(NetworkFrame_t));
+static le_mem_PoolRef_t NetworkFramePoolRef = NULL;
+#endif
+
+
+#if LE_CONFIG_RPC_PROXY_SEND_THREAD
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send Buffer structure, holding a copy of a write queued to a link's send thread.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct SendBuffer
+{
+    void*    handle;  ///< Communication handle to write to
+    size_t   size;    ///< Number of bytes to write
+    uint8_t  data[RPC_PROXY_NETWORK_SEND_BUFFER_MAX]; ///< Bytes to write
+}
+SendBuffer_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This pool is used to allocate memory for the Network Senders.
+ * Initialized in rpcProxy_COMPONENT_INIT().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(NetworkSenderPool,
+                          RPC_PROXY_NETWORK_SYSTEM_MAX_NUM,
+                          sizeof(NetworkSender_t));
+static le_mem_PoolRef_t NetworkSenderPoolRef = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This pool is used to allocate memory for the Send Buffers queued to the send threads.
+ * Initialized in rpcProxy_COMPONENT_INIT().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(SendBufferPool,
+                          RPC_PROXY_NETWORK_SEND_BUFFER_NUM,
+                          sizeof(SendBuffer_t));
+static le_mem_PoolRef_t SendBufferPoolRef = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread on which the RPC Proxy runs, to which the send threads report write failures.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_thread_Ref_t MainThreadRef = NULL;
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Hash Map to store Network Record structures (value), using the System-name (key).
@@ -83,6 +145,113 @@ LE_HASHMAP_DEFINE_STATIC(NetworkRecordHashMap, RPC_PROXY_NETWORK_SYSTEM_MAX_NUM)
 static le_hashmap_Ref_t NetworkRecordHashMapByName = NULL;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Dense table of all Network Records, in order of creation.  Network Records are never freed, so
+ * the table only grows.  Used to route received messages by communication handle without walking
+ * the hash-map.
+ */
+//--------------------------------------------------------------------------------------------------
+static NetworkRecord_t* NetworkRecordTable[RPC_PROXY_NETWORK_SYSTEM_MAX_NUM];
+static size_t NetworkRecordCount = 0;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a relative time to milliseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t TimeToMs
+(
+    le_clk_Time_t time ///< Relative time
+)
+{
+    return (uint32_t) ((time.sec * 1000) + (time.usec / 1000));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fold the outcome of one keep-alive interval into a link's health score.  The score is a moving
+ * average giving a weight of 1/4 to the latest interval.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UpdateHealthScore
+(
+    NetworkHealth_t* healthPtr, ///< Health of the link
+    uint32_t quality ///< Quality of the interval, 0 to RPC_PROXY_NETWORK_HEALTH_SCORE_MAX
+)
+{
+    healthPtr->score = (uint8_t) (((3 * (uint32_t) healthPtr->score) + quality + 2) / 4);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the round-trip time of an answered KEEPALIVE-Request, as in RFC 6298, and score it
+ * against the longest time-out allowed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UpdateRoundTripTime
+(
+    NetworkHealth_t* healthPtr, ///< Health of the link
+    uint32_t rttMs ///< Measured round-trip time, in milliseconds
+)
+{
+    uint32_t maxTimeoutMs = RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL * 1000;
+
+    if (healthPtr->keepAlivesAnswered == 0)
+    {
+        healthPtr->srttMs = rttMs;
+        healthPtr->rttVarMs = rttMs / 2;
+    }
+    else
+    {
+        uint32_t deltaMs = (healthPtr->srttMs > rttMs) ? (healthPtr->srttMs - rttMs) :
+                                                         (rttMs - healthPtr->srttMs);
+
+        healthPtr->rttVarMs = ((3 * healthPtr->rttVarMs) + deltaMs) / 4;
+        healthPtr->srttMs = ((7 * healthPtr->srttMs) + rttMs) / 8;
+    }
+    healthPtr->keepAlivesAnswered++;
+
+    UpdateHealthScore(healthPtr,
+                      (rttMs >= maxTimeoutMs) ? 0 :
+                      RPC_PROXY_NETWORK_HEALTH_SCORE_MAX -
+                      ((RPC_PROXY_NETWORK_HEALTH_SCORE_MAX * rttMs) / maxTimeoutMs));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for retrieving the current KEEPALIVE-Response time-out of a Network Communication
+ * Channel, in milliseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t rpcProxyNetwork_GetKeepAliveTimeout
+(
+    const NetworkHealth_t* healthPtr ///< Health of the link
+)
+{
+    uint32_t maxTimeoutMs = RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL * 1000;
+
+    // Until a round-trip time has been measured, allow the longest time-out
+    if (healthPtr->keepAlivesAnswered == 0)
+    {
+        return maxTimeoutMs;
+    }
+
+    uint32_t timeoutMs = healthPtr->srttMs + (4 * healthPtr->rttVarMs);
+
+    if (timeoutMs < RPC_PROXY_NETWORK_KEEPALIVE_MIN_TIMEOUT)
+    {
+        timeoutMs = RPC_PROXY_NETWORK_KEEPALIVE_MIN_TIMEOUT;
+    }
+    if (timeoutMs > maxTimeoutMs)
+    {
+        timeoutMs = maxTimeoutMs;
+    }
+
+    return timeoutMs;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Handler function for Expired Network-related Timers
@@ -195,8 +364,21 @@ static void NetworkTimerExpiryHandler
 
             if (networkRecordPtr->state == NETWORK_UP)
             {
-                // Generate a Network Keepalive event
-                rpcProxyNetwork_SendKeepAliveRequest(systemName);
+                NetworkHealth_t* healthPtr = &networkRecordPtr->health;
+
+                if (healthPtr->messagesReceived != healthPtr->messagesChecked)
+                {
+                    healthPtr->messagesChecked = healthPtr->messagesReceived;
+
+                    // Messages were received during the interval: the link is alive, no need to ask
+                    healthPtr->keepAlivesSkipped++;
+                    UpdateHealthScore(healthPtr, RPC_PROXY_NETWORK_HEALTH_SCORE_MAX);
+                }
+                else
+                {
+                    // Generate a Network Keepalive event
+                    rpcProxyNetwork_SendKeepAliveRequest(systemName);
+                }
 
                 // Kick off the timer again
                 le_timer_Start(timerRef);
@@ -309,6 +491,10 @@ static void StartNetworkKeepAliveService
         return;
     }
 
+    // A new connection starts out healthy, with its round-trip time yet to be measured
+    memset(&networkRecordPtr->health, 0, sizeof(networkRecordPtr->health));
+    networkRecordPtr->health.score = RPC_PROXY_NETWORK_HEALTH_SCORE_MAX;
+
     LE_INFO("Starting Network-KEEPALIVE Service - frequency is %d seconds, "
             "system-name [%s], handle [%d]",
             RPC_PROXY_NETWORK_KEEPALIVE_SERVICE_INTERVAL,
@@ -378,6 +564,9 @@ static void StopNetworkKeepAliveService
     LE_INFO("Stopping Network-KEEPALIVE Service, system-name [%s]",
             systemName);
 
+    // The link is going down
+    networkRecordPtr->health.score = 0;
+
     result = le_timer_Stop(networkRecordPtr->keepAliveTimerRef);
     if (result != LE_OK)
     {
@@ -490,20 +679,14 @@ char* rpcProxyNetwork_GetSystemNameByHandle
     void* handle ///< Opaque handle to a le_comm communication channel
 )
 {
-    le_hashmap_It_Ref_t iter = le_hashmap_GetIterator(NetworkRecordHashMapByName);
-    while (le_hashmap_NextNode(iter) == LE_OK)
-    {
-        NetworkRecord_t* networkRecordPtr = le_hashmap_GetValue(iter);
+    NetworkRecord_t* networkRecordPtr = rpcProxyNetwork_GetNetworkRecordByHandle(handle);
 
-        // Search for matching handles
-        if (networkRecordPtr->handle == handle)
-        {
-            // Return the system-name (key)
-            return (char*) le_hashmap_GetKey(iter);
-        }
+    if (networkRecordPtr == NULL)
+    {
+        return NULL;
     }
 
-    return NULL;
+    return (char*) networkRecordPtr->systemName;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -516,16 +699,12 @@ NetworkRecord_t* rpcProxyNetwork_GetNetworkRecordByHandle
     void* handle ///< Opaque handle to a le_comm communication channel
 )
 {
-    le_hashmap_It_Ref_t iter = le_hashmap_GetIterator(NetworkRecordHashMapByName);
-    while (le_hashmap_NextNode(iter) == LE_OK)
+    for (size_t index = 0; index < NetworkRecordCount; index++)
     {
-        NetworkRecord_t* networkRecordPtr = le_hashmap_GetValue(iter);
-
         // Search for matching handles
-        if (networkRecordPtr->handle == handle)
+        if (NetworkRecordTable[index]->handle == handle)
         {
-            // Return the netword record (value)
-            return (NetworkRecord_t*) le_hashmap_GetValue(iter);
+            return NetworkRecordTable[index];
         }
     }
 
@@ -545,6 +724,328 @@ le_hashmap_Ref_t rpcProxyNetwork_GetNetworkRecordHashMapByName
     return NetworkRecordHashMapByName;
 }
 
+#if LE_CONFIG_RPC_PROXY_SEND_THREAD
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of a link's send thread, which writes the Send Buffers queued to it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* SendThreadMain
+(
+    void* contextPtr ///< Network Sender
+)
+{
+    NetworkSender_t* senderPtr = contextPtr;
+
+    senderPtr->failedHandle = NULL;
+
+    le_event_RunLoop();
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function, run on the main thread, for deleting a Network Communication Channel whose write
+ * failed on its send thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendFailedHandler
+(
+    void* param1Ptr, ///< Communication handle
+    void* param2Ptr ///< Not used
+)
+{
+    LE_UNUSED(param2Ptr);
+
+    // Delete the Network Communication Channel
+    rpcProxyNetwork_DeleteNetworkCommunicationChannelByHandle(param1Ptr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function, run on a link's send thread, for writing a Send Buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendBufferHandler
+(
+    void* param1Ptr, ///< Send Buffer
+    void* param2Ptr ///< Network Sender
+)
+{
+    SendBuffer_t* bufferPtr = param1Ptr;
+    NetworkSender_t* senderPtr = param2Ptr;
+
+    // Once a write has failed, the rest of what was queued on that handle is dropped
+    if (bufferPtr->handle != senderPtr->failedHandle)
+    {
+        le_result_t result = le_comm_Send(bufferPtr->handle, bufferPtr->data, bufferPtr->size);
+        if (result != LE_OK)
+        {
+            LE_ERROR("le_comm_Send failed, handle [%d], result %d",
+                     le_comm_GetId(bufferPtr->handle),
+                     result);
+
+            senderPtr->failedHandle = bufferPtr->handle;
+            le_event_QueueFunctionToThread(MainThreadRef,
+                                           SendFailedHandler,
+                                           bufferPtr->handle,
+                                           NULL);
+        }
+    }
+
+    le_mem_Release(bufferPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function, run on a link's send thread, for telling the main thread its queue is drained.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendDrainedHandler
+(
+    void* param1Ptr, ///< Network Sender
+    void* param2Ptr ///< Not used
+)
+{
+    NetworkSender_t* senderPtr = param1Ptr;
+
+    LE_UNUSED(param2Ptr);
+
+    le_sem_Post(senderPtr->drainSemRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for waiting until a link's send thread has finished with everything queued to it, so
+ * that its communication handle can be deleted.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DrainSendThread
+(
+    NetworkRecord_t* networkRecordPtr ///< Network Record of the link
+)
+{
+    NetworkSender_t* senderPtr = networkRecordPtr->senderPtr;
+
+    if (senderPtr == NULL)
+    {
+        return;
+    }
+
+    le_event_QueueFunctionToThread(senderPtr->threadRef, SendDrainedHandler, senderPtr, NULL);
+    le_sem_Wait(senderPtr->drainSemRef);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for writing to the communication channel of a Network Record, either straight away,
+ * or by queuing a copy to the link's send thread, if it has one.
+ *
+ * @return
+ *      - LE_OK, if successfully (or queued),
+ *      - otherwise the le_comm_Send() failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Write
+(
+    NetworkRecord_t* networkRecordPtr, ///< Network Record of the destination system
+    const void* bufPtr, ///< Bytes to write
+    size_t size ///< Number of bytes to write
+)
+{
+#if LE_CONFIG_RPC_PROXY_SEND_THREAD
+    NetworkSender_t* senderPtr = networkRecordPtr->senderPtr;
+
+    if (senderPtr != NULL)
+    {
+        LE_ASSERT(size <= RPC_PROXY_NETWORK_SEND_BUFFER_MAX);
+
+        SendBuffer_t* bufferPtr = le_mem_ForceAlloc(SendBufferPoolRef);
+        bufferPtr->handle = networkRecordPtr->handle;
+        bufferPtr->size = size;
+        memcpy(bufferPtr->data, bufPtr, size);
+
+        le_event_QueueFunctionToThread(senderPtr->threadRef,
+                                       SendBufferHandler,
+                                       bufferPtr,
+                                       senderPtr);
+        return LE_OK;
+    }
+#endif
+
+    return le_comm_Send(networkRecordPtr->handle, bufPtr, size);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for sending the frame of aggregated messages of a Network Record, if there are any.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - otherwise the le_comm_Send() failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FlushFrame
+(
+    NetworkRecord_t* networkRecordPtr ///< Network Record of the destination system
+)
+{
+    NetworkFrame_t* framePtr = networkRecordPtr->framePtr;
+
+    if ((framePtr == NULL) || (framePtr->size == 0))
+    {
+        return LE_OK;
+    }
+
+    le_timer_Stop(framePtr->timerRef);
+
+    size_t size = framePtr->size;
+    framePtr->size = 0;
+
+    networkRecordPtr->counters.frames++;
+    networkRecordPtr->counters.bytes += size;
+
+    return Write(networkRecordPtr, framePtr->buffer, size);
+}
+
+#if RPC_PROXY_NETWORK_AGGREGATION_MAX_DELAY > 0
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler function for the timer that sends a frame of aggregated messages once the maximum
+ * delay is up.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FrameTimerExpiryHandler
+(
+    le_timer_Ref_t timerRef ///< Timer reference
+)
+{
+    NetworkRecord_t* networkRecordPtr = le_timer_GetContextPtr(timerRef);
+
+    if (FlushFrame(networkRecordPtr) != LE_OK)
+    {
+        LE_ERROR("le_comm_Send failed, handle [%d]", le_comm_GetId(networkRecordPtr->handle));
+
+        // Delete the Network Communication Channel
+        rpcProxyNetwork_DeleteNetworkCommunicationChannelByHandle(networkRecordPtr->handle);
+    }
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for sending a Proxy Message over a Network Communication Channel.
+ *
+ * A message that may be deferred is added to the Network Record's frame of aggregated messages,
+ * which is sent once it is full or once the maximum delay is up.  Any other message is added to
+ * the frame, and the whole frame sent straight away.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - otherwise the le_comm_Send() failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_SendMessage
+(
+    NetworkRecord_t* networkRecordPtr, ///< Network Record of the destination system
+    const void* bufPtr, ///< Message to send
+    size_t size, ///< Size of the message
+    bool mayDefer ///< May the message be held back, to be sent along with later ones?
+)
+{
+    NetworkFrame_t* framePtr = networkRecordPtr->framePtr;
+    le_result_t result;
+
+    networkRecordPtr->counters.messages++;
+
+    if (framePtr != NULL)
+    {
+        // Send what is waiting first, if this message doesn't fit in behind it
+        if ((framePtr->size + size) > sizeof(framePtr->buffer))
+        {
+            result = FlushFrame(networkRecordPtr);
+            if (result != LE_OK)
+            {
+                return result;
+            }
+        }
+
+        if ((framePtr->size + size) <= sizeof(framePtr->buffer))
+        {
+            memcpy(framePtr->buffer + framePtr->size, bufPtr, size);
+            framePtr->size += size;
+
+            if (!mayDefer)
+            {
+                return FlushFrame(networkRecordPtr);
+            }
+
+            if (!le_timer_IsRunning(framePtr->timerRef))
+            {
+                le_timer_Start(framePtr->timerRef);
+            }
+            return LE_OK;
+        }
+    }
+
+    // The message is sent on its own
+    networkRecordPtr->counters.frames++;
+    networkRecordPtr->counters.bytes += size;
+
+    return Write(networkRecordPtr, bufPtr, size);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for retrieving the send counters of a Network Communication Channel.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_NOT_FOUND, if the system has no Network Record.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_GetCounters
+(
+    const char* systemName, ///< System name
+    NetworkCounters_t* countersPtr ///< Counters
+)
+{
+    NetworkRecord_t* networkRecordPtr = le_hashmap_Get(NetworkRecordHashMapByName, systemName);
+    if (networkRecordPtr == NULL)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    *countersPtr = networkRecordPtr->counters;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for retrieving the health of a Network Communication Channel.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_NOT_FOUND, if the system has no Network Record.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_GetHealth
+(
+    const char* systemName, ///< System name
+    NetworkHealth_t* healthPtr ///< Health of the link
+)
+{
+    NetworkRecord_t* networkRecordPtr = le_hashmap_Get(NetworkRecordHashMapByName, systemName);
+    if (networkRecordPtr == NULL)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    *healthPtr = networkRecordPtr->health;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function for creating and connecting a Network Communication Channel.
@@ -571,10 +1072,42 @@ le_result_t rpcProxyNetwork_CreateNetworkCommunicationChannel
         // Initialize the Network Record
         networkRecordPtr->state = NETWORK_DOWN;
         networkRecordPtr->type = UNKNOWN;
+        networkRecordPtr->systemName = systemName;
         networkRecordPtr->handle = NULL;
         networkRecordPtr->keepAliveTimerRef = NULL;
+        memset(&networkRecordPtr->counters, 0, sizeof(networkRecordPtr->counters));
+        memset(&networkRecordPtr->health, 0, sizeof(networkRecordPtr->health));
+        networkRecordPtr->isCompressed = false;
+
+#if RPC_PROXY_NETWORK_AGGREGATION_MAX_DELAY > 0
+        // Allocate the frame of aggregated messages
+        networkRecordPtr->framePtr = le_mem_ForceAlloc(NetworkFramePoolRef);
+        networkRecordPtr->framePtr->size = 0;
+        networkRecordPtr->framePtr->timerRef = le_timer_Create("Network-Frame timer");
+        le_timer_SetMsInterval(networkRecordPtr->framePtr->timerRef,
+                               RPC_PROXY_NETWORK_AGGREGATION_MAX_DELAY);
+        le_timer_SetHandler(networkRecordPtr->framePtr->timerRef, FrameTimerExpiryHandler);
+        le_timer_SetContextPtr(networkRecordPtr->framePtr->timerRef, networkRecordPtr);
+        le_timer_SetWakeup(networkRecordPtr->framePtr->timerRef, false);
+#else
+        networkRecordPtr->framePtr = NULL;
+#endif
+
+#if LE_CONFIG_RPC_PROXY_SEND_THREAD
+        // Start the link's send thread
+        networkRecordPtr->senderPtr = le_mem_ForceAlloc(NetworkSenderPoolRef);
+        networkRecordPtr->senderPtr->drainSemRef = le_sem_Create("rpcSendDrain", 0);
+        networkRecordPtr->senderPtr->threadRef =
+            le_thread_Create("rpcSend", SendThreadMain, networkRecordPtr->senderPtr);
+        le_thread_Start(networkRecordPtr->senderPtr->threadRef);
+#else
+        networkRecordPtr->senderPtr = NULL;
+#endif
 
         le_hashmap_Put(NetworkRecordHashMapByName, systemName, networkRecordPtr);
+
+        LE_ASSERT(NetworkRecordCount < RPC_PROXY_NETWORK_SYSTEM_MAX_NUM);
+        NetworkRecordTable[NetworkRecordCount++] = networkRecordPtr;
     }
 
     LE_INFO("Creating network communication channel, system-name [%s], handle [%d]",
@@ -745,6 +1278,11 @@ void rpcProxyNetwork_DeleteNetworkCommunicationChannel
     rpcProxy_HideServices(systemName);
     rpcProxy_DisconnectSessions(systemName);
 
+#if LE_CONFIG_RPC_PROXY_SEND_THREAD
+    // Let the send thread finish with the handle before it is deleted
+    DrainSendThread(networkRecordPtr);
+#endif
+
     // Delete the Communication channel
     result = le_comm_Delete(networkRecordPtr->handle);
     networkRecordPtr->handle = NULL;
@@ -759,6 +1297,16 @@ void rpcProxyNetwork_DeleteNetworkCommunicationChannel
     // Reset Network Message Re-assembly State-Machine
     networkRecordPtr->messageState.recvState = NETWORK_MSG_IDLE;
 
+    // The far side may come back as a different version, so it has to agree to compression again
+    networkRecordPtr->isCompressed = false;
+
+    // Drop any aggregated messages still waiting to be sent
+    if (networkRecordPtr->framePtr != NULL)
+    {
+        le_timer_Stop(networkRecordPtr->framePtr->timerRef);
+        networkRecordPtr->framePtr->size = 0;
+    }
+
     // Stop Network Keep-Alive service
     StopNetworkKeepAliveService(systemName, networkRecordPtr);
 
@@ -1020,6 +1568,14 @@ le_result_t rpcProxyNetwork_ProcessKeepAliveResponse
     {
         rpcProxy_KeepAliveMessage_t* proxyMessageCopyPtr = NULL;
 
+        // Only time the latest request, in case an earlier one is answered late
+        if (proxyMessagePtr->commonHeader.id == networkRecordPtr->health.keepAliveId)
+        {
+            UpdateRoundTripTime(&networkRecordPtr->health,
+                                TimeToMs(le_clk_Sub(le_clk_GetRelativeTime(),
+                                                    networkRecordPtr->health.keepAliveSentTime)));
+        }
+
         LE_DEBUG("Deleting timer for KEEPALIVE-Request, '%s', id [%" PRIu32 "]",
                  proxyMessagePtr->systemName,
                  proxyMessagePtr->commonHeader.id);
@@ -1082,6 +1638,8 @@ void rpcProxyNetwork_SendKeepAliveRequest
 {
     rpcProxy_KeepAliveMessage_t *proxyMessagePtr = NULL;
     le_result_t                  result;
+    uint32_t                     timeoutMs = RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL *
+                                             1000;
 
     // Allocate memory for a Proxy Message copy
     proxyMessagePtr = le_mem_ForceAlloc(ProxyKeepAliveMessagesPoolRef);
@@ -1097,6 +1655,17 @@ void rpcProxyNetwork_SendKeepAliveRequest
     LE_INFO("Sending Proxy KEEPALIVE-Request Message, id [%" PRIu32 "]",
              proxyMessagePtr->commonHeader.id);
 
+    // Time the request, and wait for the response for as long as the link's round-trip time
+    // suggests
+    NetworkRecord_t* networkRecordPtr = le_hashmap_Get(NetworkRecordHashMapByName, systemName);
+    if (networkRecordPtr != NULL)
+    {
+        networkRecordPtr->health.keepAliveId = proxyMessagePtr->commonHeader.id;
+        networkRecordPtr->health.keepAliveSentTime = le_clk_GetRelativeTime();
+        networkRecordPtr->health.keepAlivesSent++;
+        timeoutMs = rpcProxyNetwork_GetKeepAliveTimeout(&networkRecordPtr->health);
+    }
+
     // Send Proxy Message to far-side
     result = rpcProxy_SendMsg(systemName, proxyMessagePtr);
     if (result != LE_OK)
@@ -1109,12 +1678,10 @@ void rpcProxyNetwork_SendKeepAliveRequest
     // we do not hear back from the far-side RPC Proxy
     //
     le_timer_Ref_t  keepAliveRequestTimerRef;
-    le_clk_Time_t  timerInterval = {.sec=RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL,
-                                    .usec=0};
 
     // Create a timer to handle "lost" requests
     keepAliveRequestTimerRef = le_timer_Create("KEEPALIVE-Request timer");
-    le_timer_SetInterval(keepAliveRequestTimerRef, timerInterval);
+    le_timer_SetMsInterval(keepAliveRequestTimerRef, timeoutMs);
     le_timer_SetHandler(keepAliveRequestTimerRef, rpcProxy_ProxyMessageTimerExpiryHandler);
     le_timer_SetWakeup(keepAliveRequestTimerRef, false);
 
@@ -1130,8 +1697,8 @@ void rpcProxyNetwork_SendKeepAliveRequest
                    (void*)(uintptr_t) proxyMessagePtr->commonHeader.id,
                    keepAliveRequestTimerRef);
 
-    LE_INFO("Starting timer (%d secs.) for KEEPALIVE-Request, '%s', id [%" PRIu32 "]",
-            RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL,
+    LE_INFO("Starting timer (%" PRIu32 " ms) for KEEPALIVE-Request, '%s', id [%" PRIu32 "]",
+            timeoutMs,
             systemName,
             proxyMessagePtr->commonHeader.id);
 }
@@ -1229,6 +1796,25 @@ le_result_t rpcProxyNetwork_Initialize
                                                  RPC_PROXY_NETWORK_SYSTEM_MAX_NUM,
                                                  sizeof(NetworkRecord_t));
 
+#if RPC_PROXY_NETWORK_AGGREGATION_MAX_DELAY > 0
+    // Initialize memory pool for allocating Network Frames.
+    NetworkFramePoolRef = le_mem_InitStaticPool(NetworkFramePool,
+                                                RPC_PROXY_NETWORK_SYSTEM_MAX_NUM,
+                                                sizeof(NetworkFrame_t));
+#endif
+
+#if LE_CONFIG_RPC_PROXY_SEND_THREAD
+    // Initialize memory pools for allocating Network Senders and their Send Buffers.
+    NetworkSenderPoolRef = le_mem_InitStaticPool(NetworkSenderPool,
+                                                 RPC_PROXY_NETWORK_SYSTEM_MAX_NUM,
+                                                 sizeof(NetworkSender_t));
+    SendBufferPoolRef = le_mem_InitStaticPool(SendBufferPool,
+                                              RPC_PROXY_NETWORK_SEND_BUFFER_NUM,
+                                              sizeof(SendBuffer_t));
+
+    MainThreadRef = le_thread_GetCurrent();
+#endif
+
     // Create hash map for storing Network Records (value), using System-name as key.
     NetworkRecordHashMapByName = le_hashmap_InitStatic(NetworkRecordHashMap,
                                                        RPC_PROXY_NETWORK_SYSTEM_MAX_NUM,
@@ -33,6 +33,61 @@
 #define RPC_PROXY_RECV_BUFFER_MAX               (RPC_PROXY_MAX_MESSAGE + RPC_PROXY_MSG_HEADER_SIZE)
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum time (in milliseconds) one-way messages may be held back, so that they can be sent
+ * together with other messages in a single write.  Zero turns message aggregation off.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_NETWORK_AGGREGATION_MAX_DELAY LE_CONFIG_RPC_PROXY_AGGREGATION_MAX_DELAY
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of a frame of aggregated messages.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_NETWORK_FRAME_BUFFER_MAX      LE_CONFIG_RPC_PROXY_AGGREGATION_MAX_SIZE
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lower bound (in milliseconds) of the KEEPALIVE-Response time-out estimated from the link's
+ * round-trip time.  The upper bound is RPC_PROXY_NETWORK_KEEPALIVE_TIMEOUT_TIMER_INTERVAL.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_NETWORK_KEEPALIVE_MIN_TIMEOUT 1000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Health score of a link that is up and answering in no time.  Zero means the link is down.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_NETWORK_HEALTH_SCORE_MAX      100
+
+
+#if LE_CONFIG_RPC_PROXY_SEND_THREAD
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of send buffers set aside for messages queued to the send threads of the links.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_NETWORK_SEND_BUFFER_NUM       (RPC_PROXY_NETWORK_SYSTEM_MAX_NUM * \
+                                                LE_CONFIG_RPC_PROXY_SEND_THREAD_QUEUE_DEPTH)
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of a single write: a frame of aggregated messages, or a message sent on its own.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RPC_PROXY_NETWORK_SEND_BUFFER_MAX       \
+            ((RPC_PROXY_NETWORK_FRAME_BUFFER_MAX > RPC_PROXY_RECV_BUFFER_MAX) ? \
+             RPC_PROXY_NETWORK_FRAME_BUFFER_MAX : RPC_PROXY_RECV_BUFFER_MAX)
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * RPC Proxy Network Operational State definition
@@ -93,6 +148,74 @@ typedef struct NetworkMessageState
 NetworkMessageState_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Proxy Network Frame structure, holding the messages waiting to be sent in one write
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct NetworkFrame
+{
+    uint8_t         buffer[RPC_PROXY_NETWORK_FRAME_BUFFER_MAX]; ///< Messages waiting to be sent
+    size_t          size;      ///< Number of bytes waiting in the buffer
+    le_timer_Ref_t  timerRef;  ///< Timer to send the waiting messages, once the max delay is up
+}
+NetworkFrame_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Proxy Network Counters structure
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct NetworkCounters
+{
+    uint32_t  messages;  ///< Number of Proxy Messages sent
+    uint32_t  frames;    ///< Number of writes on the communication channel
+    uint64_t  bytes;     ///< Number of bytes sent
+}
+NetworkCounters_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Proxy Network Health structure, tracking how well a link answers.
+ *
+ * Any message received from the far side shows the link is alive, so KEEPALIVE-Requests are only
+ * sent on links that have received nothing for a whole keep-alive interval.  Their round-trip times are
+ * smoothed as in RFC 6298 to set the time-out of the next one.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct NetworkHealth
+{
+    uint32_t       messagesReceived;   ///< Number of messages received, not counting
+                                       ///< KEEPALIVE-Responses
+    uint32_t       messagesChecked;    ///< Value of messagesReceived at the last keep-alive tick
+    le_clk_Time_t  keepAliveSentTime;  ///< When the last KEEPALIVE-Request was sent
+    uint32_t       keepAliveId;        ///< Proxy Message ID of the last KEEPALIVE-Request
+    uint32_t       srttMs;             ///< Smoothed round-trip time, in milliseconds
+    uint32_t       rttVarMs;           ///< Round-trip time variation, in milliseconds
+    uint32_t       keepAlivesSent;     ///< Number of KEEPALIVE-Requests sent
+    uint32_t       keepAlivesAnswered; ///< Number of them answered (round-trip times measured)
+    uint32_t       keepAlivesSkipped;  ///< Number of KEEPALIVE-Requests not needed, as data was
+                                       ///< received during the interval
+    uint8_t        score;              ///< Health score, 0 to RPC_PROXY_NETWORK_HEALTH_SCORE_MAX
+}
+NetworkHealth_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Proxy Network Sender structure, for a link whose messages are written from a thread of its
+ * own
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct NetworkSender
+{
+    le_thread_Ref_t  threadRef;     ///< Send thread
+    le_sem_Ref_t     drainSemRef;   ///< Posted by the send thread once its queue is drained
+    void*            failedHandle;  ///< Handle on which the last write failed (send thread only)
+}
+NetworkSender_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * RPC Proxy Network Record structure
@@ -100,11 +223,19 @@ NetworkMessageState_t;
 //--------------------------------------------------------------------------------------------------
 typedef struct NetworkRecord
 {
+    const char*              systemName; ///< Name of the far-side system (hash-map key)
     void*                    handle;    ///< Opague handle to the network connection
     NetworkState_t           state;     ///< Operational state of the network connection
     NetworkConnectionType_t  type;      ///< Type of network connection
     le_timer_Ref_t           keepAliveTimerRef; ///< Keep-Alive Timer Ref
     NetworkMessageState_t    messageState; ///< Message Re-assembly State-Machine
+    NetworkFrame_t*          framePtr;  ///< Frame of aggregated messages (NULL if aggregation
+                                        ///< is turned off)
+    NetworkCounters_t        counters;  ///< Send counters
+    NetworkSender_t*         senderPtr; ///< Send thread (NULL if messages are written from the
+                                        ///< main thread)
+    bool                     isCompressed; ///< Has the far side agreed to compressed payloads?
+    NetworkHealth_t          health;    ///< Keep-alive round-trip times and health score
 }
 NetworkRecord_t;
 
@@ -162,6 +293,68 @@ le_hashmap_Ref_t rpcProxyNetwork_GetNetworkRecordHashMapByName
     void
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for sending a Proxy Message over a Network Communication Channel.
+ *
+ * A message that may be deferred is added to the Network Record's frame of aggregated messages,
+ * which is sent once it is full or once the maximum delay is up.  Any other message is added to
+ * the frame, and the whole frame sent straight away.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - otherwise the le_comm_Send() failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_SendMessage
+(
+    NetworkRecord_t* networkRecordPtr, ///< Network Record of the destination system
+    const void* bufPtr, ///< Message to send
+    size_t size, ///< Size of the message
+    bool mayDefer ///< May the message be held back, to be sent along with later ones?
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for retrieving the send counters of a Network Communication Channel.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_NOT_FOUND, if the system has no Network Record.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_GetCounters
+(
+    const char* systemName, ///< System name
+    NetworkCounters_t* countersPtr ///< Counters
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for retrieving the health of a Network Communication Channel.
+ *
+ * @return
+ *      - LE_OK, if successfully,
+ *      - LE_NOT_FOUND, if the system has no Network Record.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t rpcProxyNetwork_GetHealth
+(
+    const char* systemName, ///< System name
+    NetworkHealth_t* healthPtr ///< Health of the link
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function for retrieving the current KEEPALIVE-Response time-out of a Network Communication
+ * Channel, in milliseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+uint32_t rpcProxyNetwork_GetKeepAliveTimeout
+(
+    const NetworkHealth_t* healthPtr ///< Health of the link
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function for creating and connecting a Network Communication Channel.
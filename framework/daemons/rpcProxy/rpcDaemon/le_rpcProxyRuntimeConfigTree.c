@@ -1271,6 +1271,104 @@ le_result_t le_rpc_GetSystemLink
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Configuration Service API to get the send counters of a system-link.
+ *
+ * @return
+ *      - LE_OK if successful.
+ *      - LE_NOT_FOUND if the system-link has not been started.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_rpc_GetSystemLinkCounters
+(
+    const char* LE_NONNULL systemName,
+        ///< [IN] Remote System-Name
+    uint32_t* messagesPtr,
+        ///< [OUT] Number of messages sent
+    uint32_t* writesPtr,
+        ///< [OUT] Number of writes the messages were sent in
+    uint64_t* bytesPtr
+        ///< [OUT] Number of bytes sent
+)
+{
+    NetworkCounters_t counters;
+
+    // Verify the pointers are valid
+    if ((messagesPtr == NULL) ||
+        (writesPtr == NULL) ||
+        (bytesPtr == NULL))
+    {
+        LE_KILL_CLIENT("Invalid pointer");
+        return LE_FAULT;
+    }
+
+    if (rpcProxyNetwork_GetCounters(systemName, &counters) != LE_OK)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    *messagesPtr = counters.messages;
+    *writesPtr = counters.frames;
+    *bytesPtr = counters.bytes;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RPC Configuration Service API to get the health of a system-link.
+ *
+ * @return
+ *      - LE_OK if successful.
+ *      - LE_NOT_FOUND if the system-link has not been started.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_rpc_GetSystemLinkHealth
+(
+    const char* LE_NONNULL systemName,
+        ///< [IN] Remote System-Name
+    uint8_t* scorePtr,
+        ///< [OUT] Health score, from 0 (down) to 100 (healthy)
+    uint32_t* roundTripTimePtr,
+        ///< [OUT] Smoothed keep-alive round-trip time, in milliseconds
+    uint32_t* keepAliveTimeoutPtr,
+        ///< [OUT] Current keep-alive time-out, in milliseconds
+    uint32_t* keepAlivesSentPtr,
+        ///< [OUT] Number of keep-alives sent
+    uint32_t* keepAlivesSkippedPtr
+        ///< [OUT] Number of keep-alives not sent, as messages were received
+)
+{
+    NetworkHealth_t health;
+
+    // Verify the pointers are valid
+    if ((scorePtr == NULL) ||
+        (roundTripTimePtr == NULL) ||
+        (keepAliveTimeoutPtr == NULL) ||
+        (keepAlivesSentPtr == NULL) ||
+        (keepAlivesSkippedPtr == NULL))
+    {
+        LE_KILL_CLIENT("Invalid pointer");
+        return LE_FAULT;
+    }
+
+    if (rpcProxyNetwork_GetHealth(systemName, &health) != LE_OK)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    *scorePtr = health.score;
+    *roundTripTimePtr = health.srttMs;
+    *keepAliveTimeoutPtr = rpcProxyNetwork_GetKeepAliveTimeout(&health);
+    *keepAlivesSentPtr = health.keepAlivesSent;
+    *keepAlivesSkippedPtr = health.keepAlivesSkipped;
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * RPC Configuration Service API to reset a system-link.
@@ -19,11 +19,13 @@
 #include "log.h"
 #include "mem.h"
 #include "messaging.h"
+#include "metrics.h"
 #include "pathIter.h"
 #include "rand.h"
 #include "safeRef.h"
 #include "test.h"
 #include "thread.h"
+#include "threadPool.h"
 #include "timer.h"
 
 #include <locale.h>
@@ -113,6 +115,8 @@ static void InitLegatoFramework
     event_Init();       // Uses memory pools.
     timer_Init();       // Uses event loop.
     thread_Init();      // Uses event loop, memory pools and safe references.
+    threadPool_Init();  // Uses memory pools.
+    metrics_Init();     // Uses memory pools.
     test_Init();        // Uses mutexes.
     msg_Init();         // Uses event loop.
     fs_Init();          // Uses memory pools and safe references and path manipulation.
@@ -351,6 +355,13 @@ static le_result_t StartApp
 )
 {
     uint32_t taskNum;
+
+    // Starting an app in a task group starts the group's shared task.
+    if (appPtr->taskGroupPtr != NULL)
+    {
+        appPtr = appPtr->taskGroupPtr;
+    }
+
     for (taskNum = 0; taskNum < appPtr->taskCount; ++taskNum)
     {
         const Task_t* currentTaskPtr = &appPtr->taskList[taskNum];
@@ -430,7 +441,8 @@ LE_SHARED const Task_t* microSupervisor_FindTask
 /**
  * Check if an app is running.
  *
- * An app is running if at least one process in the app is running.
+ * An app is running if at least one process in the app is running.  An app in a task group is
+ * running if the group's task is.
  */
 //--------------------------------------------------------------------------------------------------
 LE_SHARED bool microSupervisor_IsAppRunning
@@ -438,6 +450,11 @@ LE_SHARED bool microSupervisor_IsAppRunning
     const App_t* appPtr                 ///< [IN] pointer to the app
 )
 {
+    if (appPtr->taskGroupPtr != NULL)
+    {
+        appPtr = appPtr->taskGroupPtr;
+    }
+
     // Check if there are any running tasks; if so app is already started.
     uint32_t task;
     for (task = 0; task < appPtr->taskCount; ++task)
@@ -509,6 +526,13 @@ LE_SHARED void le_microSupervisor_Main
             continue;
         }
 
+        if (currentAppPtr->taskGroupPtr != NULL)
+        {
+            LE_DEBUG("App %s is started by task group %s", currentAppPtr->appNameStr,
+                     currentAppPtr->taskGroupPtr->appNameStr);
+            continue;
+        }
+
         LE_DEBUG("Starting app %s", currentAppPtr->appNameStr);
 
         if (StartApp(currentAppPtr) != LE_OK)
@@ -695,10 +719,78 @@ LE_SHARED void le_microSupervisor_DebugAppStatus
          currentAppPtr->appNameStr != NULL;
          ++currentAppPtr)
     {
-        printf("[%s] %s\n",
-               (microSupervisor_IsAppRunning(currentAppPtr)?"running":"stopped"),
-               currentAppPtr->appNameStr);
+        if (currentAppPtr->taskGroupPtr != NULL)
+        {
+            printf("[%s] %s (in %s)\n",
+                   (microSupervisor_IsAppRunning(currentAppPtr)?"running":"stopped"),
+                   currentAppPtr->appNameStr,
+                   currentAppPtr->taskGroupPtr->appNameStr);
+        }
+        else
+        {
+            printf("[%s] %s\n",
+                   (microSupervisor_IsAppRunning(currentAppPtr)?"running":"stopped"),
+                   currentAppPtr->appNameStr);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print the high-water mark of every memory pool on serial port (using printf).
+ *
+ * "Spare" is the memory of the blocks that have never been used at the same time, i.e. what
+ * could be saved by shrinking the pool to its high-water mark.  Sub-pools take their blocks from
+ * their super-pool, so they are not counted in the totals.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void le_microSupervisor_DebugMemPools
+(
+    void
+)
+{
+    size_t totalBytes = 0;
+    size_t spareBytes = 0;
+
+    printf("%-32s %8s %8s %8s %8s %10s\n",
+           "POOL", "BLK SIZE", "BLOCKS", "IN USE", "MAX USED", "SPARE");
+
+    mem_Lock();
+
+    le_dls_List_t* poolListPtr = mem_GetPoolList();
+    le_dls_Link_t* poolLinkPtr = le_dls_Peek(poolListPtr);
+
+    while (poolLinkPtr != NULL)
+    {
+        const le_mem_Pool_t* poolPtr = CONTAINER_OF(poolLinkPtr, le_mem_Pool_t, poolLink);
+#if LE_CONFIG_MEM_POOL_STATS
+        size_t maxUsed = poolPtr->maxNumBlocksUsed;
+#else
+        size_t maxUsed = poolPtr->numBlocksInUse;
+#endif
+        size_t spare = (poolPtr->totalBlocks - maxUsed) * poolPtr->blockSize;
+
+        printf("%-32s %8" PRIuS " %8" PRIuS " %8" PRIuS " %8" PRIuS " %10" PRIuS "%s\n",
+#if LE_CONFIG_MEM_POOL_NAMES_ENABLED
+               poolPtr->name,
+#else
+               "-",
+#endif
+               poolPtr->blockSize, poolPtr->totalBlocks, poolPtr->numBlocksInUse, maxUsed,
+               spare, (poolPtr->superPoolPtr != NULL ? " (sub-pool)" : ""));
+
+        if (poolPtr->superPoolPtr == NULL)
+        {
+            totalBytes += poolPtr->totalBlocks * poolPtr->blockSize;
+            spareBytes += spare;
+        }
+
+        poolLinkPtr = le_dls_PeekNext(poolListPtr, poolLinkPtr);
     }
+
+    mem_Unlock();
+
+    printf("Total: %" PRIuS " bytes in pools, %" PRIuS " bytes spare\n", totalBytes, spareBytes);
 }
 
 //--------------------------------------------------------------------------------------------------
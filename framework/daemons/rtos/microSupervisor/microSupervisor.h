@@ -47,8 +47,12 @@ TaskInfo_t;
 
 /**
  * Definitions for apps managed by the microsupervisor.
+ *
+ * The processes of the apps in a task group (see the "taskGroup" app setting in the .sdef) share
+ * a single task.  The task group has its own entry, which runs the task, and the entries of its
+ * apps have no tasks and point to it.
  */
-typedef struct
+typedef struct App
 {
     const char   *appNameStr;          ///< Application name
     bool          manualStart;         ///< If this app should not be started on system start.
@@ -60,6 +64,8 @@ typedef struct
                                        ///< taskList.  For non-running applications it may be NULL.
     int32_t       watchdogTimeout;     ///< Watchdog timeout for all tasks in the app
     int32_t       maxWatchdogTimeout;  ///< Max watchdog timeout all tasks in the app
+    const struct App *taskGroupPtr;    ///< Task group whose task runs this app's processes, or
+                                       ///< NULL if the app has tasks of its own.
 }
 App_t;
 
@@ -191,6 +197,16 @@ LE_SHARED void le_microSupervisor_DebugAppStatus
     void
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print the high-water mark of every memory pool on serial port (using printf).
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void le_microSupervisor_DebugMemPools
+(
+    void
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set the log level filter
@@ -0,0 +1,170 @@
+/**
+ * @page c_aio Asynchronous File I/O API
+ *
+ * @subpage le_aio.h "API Reference"
+ *
+ * <HR>
+ *
+ * This API lets a thread read and write files without blocking its event loop.  A request is
+ * queued with le_aio_Read(), le_aio_Write() or le_aio_Sync() and the call returns straight away;
+ * when the transfer is finished, the completion handler passed with the request is called by the
+ * event loop of the thread that queued it.  A single-threaded daemon can therefore stream a large
+ * file to or from flash while it keeps serving IPC, timers and FD Monitors.
+ *
+ * The requests work on ordinary file descriptors, so they can be used with files opened with
+ * @c open(), with le_atomFile_Open() or le_atomFile_Create() (see @ref c_atomFile), etc.  Each
+ * request names the file offset explicitly and never moves the file descriptor's current
+ * position.
+ *
+ * @code
+ *
+ * static uint8_t Buffer[4096];
+ * static off_t Offset = 0;
+ *
+ * static void ReadDone(le_result_t result, size_t byteCount, void* contextPtr)
+ * {
+ *     int fd = (int)(intptr_t)contextPtr;
+ *
+ *     if ((result != LE_OK) || (byteCount == 0))
+ *     {
+ *         // Error or end of file.
+ *         close(fd);
+ *         return;
+ *     }
+ *
+ *     ProcessChunk(Buffer, byteCount);
+ *
+ *     Offset += byteCount;
+ *     le_aio_Read(fd, Buffer, sizeof(Buffer), Offset, ReadDone, contextPtr);
+ * }
+ *
+ * COMPONENT_INIT
+ * {
+ *     int fd = open("/data/package.bin", O_RDONLY | O_CLOEXEC);
+ *
+ *     le_aio_Read(fd, Buffer, sizeof(Buffer), 0, ReadDone, (void*)(intptr_t)fd);
+ * }
+ *
+ * @endcode
+ *
+ * @section c_aio_rules Rules
+ *
+ * - The thread that queues a request must run a Legato event loop, since that is where the
+ *   completion handler is called.
+ * - The buffer and the file descriptor must stay valid until the completion handler has been
+ *   called.  A request can't be cancelled.
+ * - Every request that was successfully queued has its handler called exactly once.
+ * - Requests queued together may complete in any order.  To keep data in order, queue the next
+ *   request from the completion handler of the previous one, or give each request its own offset.
+ * - A read returns fewer bytes than requested only at the end of the file.  A write either writes
+ *   everything or fails.
+ *
+ * @section c_aio_backends Back Ends
+ *
+ * When @c LE_CONFIG_AIO_IO_URING is enabled and the kernel supports it, each thread that queues
+ * requests gets its own io_uring, whose completions are picked up by an FD Monitor in that
+ * thread.  Otherwise, or if the io_uring can't be set up, the requests are carried out by a small
+ * pool of worker threads (@c LE_CONFIG_AIO_THREADS) shared by the whole process, which send the
+ * results back to the requesting thread with le_event_QueueFunctionToThread().
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/** @file le_aio.h
+ *
+ * Legato @ref c_aio include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_AIO_INCLUDE_GUARD
+#define LEGATO_AIO_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype of the functions called when an asynchronous file request has completed.
+ *
+ * @param result
+ *      - LE_OK if the request succeeded.
+ *      - LE_NO_MEMORY if a write failed because the file system is full.
+ *      - LE_FAULT if the request failed for any other reason (the error is logged).
+ * @param byteCount
+ *      Number of bytes read or written.  For a read, 0 means the offset was at or past the end of
+ *      the file.
+ * @param contextPtr
+ *      Context pointer that was passed when the request was queued.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_aio_CompletionHandler_t)
+(
+    le_result_t result,
+    size_t      byteCount,
+    void       *contextPtr
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a read of up to bufSize bytes from a given offset of a file.
+ *
+ * @return
+ *      - LE_OK if the request was queued.  The handler will be called when it completes.
+ *      - LE_BAD_PARAMETER if a parameter is invalid.  The handler will not be called.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_result_t le_aio_Read
+(
+    int                         fd,         ///< [IN] File descriptor to read from.
+    void                       *bufPtr,     ///< [OUT] Buffer to read into.  Must stay valid until
+                                            ///<       the handler is called.
+    size_t                      bufSize,    ///< [IN] Number of bytes to read.
+    off_t                       offset,     ///< [IN] Offset in the file to read from.
+    le_aio_CompletionHandler_t  handlerPtr, ///< [IN] Function to call when the read completes.
+    void                       *contextPtr  ///< [IN] Context pointer to pass to the handler.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a write of bufSize bytes to a given offset of a file.
+ *
+ * @return
+ *      - LE_OK if the request was queued.  The handler will be called when it completes.
+ *      - LE_BAD_PARAMETER if a parameter is invalid.  The handler will not be called.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_result_t le_aio_Write
+(
+    int                         fd,         ///< [IN] File descriptor to write to.
+    const void                 *bufPtr,     ///< [IN] Data to write.  Must stay valid until the
+                                            ///<      handler is called.
+    size_t                      bufSize,    ///< [IN] Number of bytes to write.
+    off_t                       offset,     ///< [IN] Offset in the file to write to.
+    le_aio_CompletionHandler_t  handlerPtr, ///< [IN] Function to call when the write completes.
+    void                       *contextPtr  ///< [IN] Context pointer to pass to the handler.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a flush of a file's data and metadata to storage (see @c fsync()).
+ *
+ * The flush only covers writes that have completed before it is queued.
+ *
+ * @return
+ *      - LE_OK if the request was queued.  The handler will be called when it completes.
+ *      - LE_BAD_PARAMETER if a parameter is invalid.  The handler will not be called.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_result_t le_aio_Sync
+(
+    int                         fd,         ///< [IN] File descriptor to flush.
+    le_aio_CompletionHandler_t  handlerPtr, ///< [IN] Function to call when the flush completes.
+    void                       *contextPtr  ///< [IN] Context pointer to pass to the handler.
+);
+
+
+#endif // LEGATO_AIO_INCLUDE_GUARD
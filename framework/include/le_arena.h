@@ -0,0 +1,234 @@
+/**
+ * @page c_arena Memory Arena API
+ *
+ * @subpage le_arena.h "API Reference"
+ *
+ * <HR>
+ *
+ * A memory arena hands out blocks of any size from large chunks, which it borrows from a
+ * @ref c_memory "memory pool".  Allocating from an arena just moves a pointer forward, and the
+ * blocks are never freed one at a time: they are all freed at once when the arena is reset.
+ *
+ * This suits data that lives exactly as long as one request (or one parse, or one encoding
+ * pass): instead of allocating and releasing many small objects, each from its own pool, the
+ * request's code allocates them all from an arena, and the arena is reset when the request is
+ * done.
+ *
+ * @section c_arena_create Creating an Arena
+ *
+ * First create a memory pool whose objects are the arena's chunks, then create the arena with
+ * @c le_arena_Create().  The arena keeps its own bookkeeping at the start of its first chunk, so
+ * the first chunk is always in use for as long as the arena exists.  Several arenas can share
+ * the same chunk pool.
+ *
+ * @code
+ * #define CHUNK_SIZE   1024
+ *
+ * static le_mem_PoolRef_t ChunkPool;
+ * static le_arena_Ref_t RequestArena;
+ *
+ * COMPONENT_INIT
+ * {
+ *     ChunkPool = le_mem_CreatePool("RequestChunks", CHUNK_SIZE);
+ *     le_mem_ExpandPool(ChunkPool, 4);
+ *
+ *     RequestArena = le_arena_Create(ChunkPool);
+ * }
+ * @endcode
+ *
+ * @section c_arena_alloc Allocating from an Arena
+ *
+ * Use @c le_arena_Alloc() to allocate a block.  Blocks are suitably aligned for any type.  When
+ * the current chunk is full, another one is taken from the pool.  A block can't be bigger than
+ * what fits in one chunk (see @c le_arena_GetMaxAllocSize()); asking for more is a fatal error.
+ * @c le_arena_TryAlloc() returns NULL instead, both for blocks that are too big and when the
+ * chunk pool is exhausted.
+ *
+ * @c le_arena_StrDup() copies a string into the arena.
+ *
+ * @section c_arena_reset Resetting an Arena
+ *
+ * @c le_arena_Reset() frees every block allocated from the arena at once, and gives every chunk
+ * but the first back to the pool.  When everything fitted in the first chunk, this takes
+ * constant time.
+ *
+ * Objects that hold other resources (file descriptors, reference counts on pool objects, ...)
+ * can register a destructor with @c le_arena_AddDestructor().  Destructors are called by
+ * @c le_arena_Reset() and @c le_arena_Delete(), most recently registered first.
+ *
+ * @code
+ * static void HandleRequest(const char* nameStr)
+ * {
+ *     char* namePtr = le_arena_StrDup(RequestArena, nameStr);
+ *     Item_t* itemPtr = le_arena_Alloc(RequestArena, sizeof(Item_t));
+ *
+ *     ...
+ *
+ *     le_arena_Reset(RequestArena);
+ * }
+ * @endcode
+ *
+ * @c le_arena_Delete() resets an arena and gives its first chunk back to the pool.
+ *
+ * @note Arenas are not thread-safe.  An arena is normally used by only one thread; use a mutex
+ *       if it must be shared.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file le_arena.h
+ *
+ * Legato @ref c_arena include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_ARENA_INCLUDE_GUARD
+#define LEGATO_ARENA_INCLUDE_GUARD
+
+#include "le_mem.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a memory arena.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_arena* le_arena_Ref_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for arena destructor functions.
+ *
+ * @param objPtr The pointer given to le_arena_AddDestructor().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_arena_Destructor_t)
+(
+    void* objPtr
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a memory arena.
+ *
+ * The pool's object size is the arena's chunk size.  It must leave room for at least a few
+ * blocks after the arena's own bookkeeping.
+ *
+ * @return A reference to the arena.
+ *
+ * @note Terminates the process on failure, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Ref_t le_arena_Create
+(
+    le_mem_PoolRef_t chunkPool  ///< [IN] Pool to borrow the arena's chunks from.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a memory arena.  Its destructors are called, and all of its chunks are given back to
+ * the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Delete
+(
+    le_arena_Ref_t arenaRef     ///< [IN] The arena.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a block from an arena.
+ *
+ * @return Pointer to the block.  It is aligned for any type, and its contents are undefined.
+ *
+ * @note Terminates the process if the block is bigger than le_arena_GetMaxAllocSize(), or if no
+ *       chunk can be had from the pool, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_arena_Alloc
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] The arena.
+    size_t         size         ///< [IN] Size of the block, in bytes.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a block from an arena, if possible.
+ *
+ * @return Pointer to the block, or NULL if the block is bigger than le_arena_GetMaxAllocSize()
+ *         or the pool has no free chunk.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_arena_TryAlloc
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] The arena.
+    size_t         size         ///< [IN] Size of the block, in bytes.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy a null-terminated string into an arena.
+ *
+ * @return Pointer to the copy.
+ *
+ * @note Terminates the process if the string doesn't fit in a chunk, so no need to check the
+ *       return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+char* le_arena_StrDup
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] The arena.
+    const char*    srcStr       ///< [IN] String to copy.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Register a function to be called with a given pointer when an arena is next reset or deleted.
+ * Destructors are called most recently registered first.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_AddDestructor
+(
+    le_arena_Ref_t        arenaRef,         ///< [IN] The arena.
+    le_arena_Destructor_t destructorFunc,   ///< [IN] Function to call.
+    void*                 objPtr            ///< [IN] Pointer to pass to it.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Free all of the blocks allocated from an arena.  Its destructors are called, and all of its
+ * chunks but the first are given back to the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Reset
+(
+    le_arena_Ref_t arenaRef     ///< [IN] The arena.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the size of the largest block that can be allocated from an arena.
+ *
+ * @return The size, in bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_arena_GetMaxAllocSize
+(
+    le_arena_Ref_t arenaRef     ///< [IN] The arena.
+);
+
+#endif /* LEGATO_ARENA_INCLUDE_GUARD */
@@ -154,6 +154,42 @@
  * le_atomFile_Close() and le_atomFile_Cancel() except that works on file streams rather than file
  * descriptors.
  *
+ * @section c_atomFile_batch Batches
+ *
+ * Committing a file costs several syncs to flash. When many files must change together, they can
+ * be committed as a batch instead: create the batch with @c le_atomFile_BeginBatch(), close each
+ * file or stream with @c le_atomFile_AddToBatch() or @c le_atomFile_AddStreamToBatch() instead of
+ * @c le_atomFile_Close() or @c le_atomFile_CloseStream(), then call @c le_atomFile_CommitBatch().
+ * The whole batch is committed with one sync barrier, and either all or none of its files are
+ * replaced, even if the device loses power during the commit. @c le_atomFile_CancelBatch()
+ * discards the changes of every file in the batch.
+ *
+ * Files added to a batch stay locked until the batch is committed or cancelled, so a batch should
+ * be committed promptly.
+ *
+ * @code
+ *
+ *      le_atomFile_BatchRef_t batch = le_atomFile_BeginBatch();
+ *
+ *      int fd1 = le_atomFile_Create("./file1.txt", LE_FLOCK_WRITE, LE_FLOCK_REPLACE_IF_EXIST,
+ *                                   S_IRUSR | S_IWUSR);
+ *      int fd2 = le_atomFile_Create("./file2.txt", LE_FLOCK_WRITE, LE_FLOCK_REPLACE_IF_EXIST,
+ *                                   S_IRUSR | S_IWUSR);
+ *
+ *      // Write something in fd1 and fd2
+ *
+ *      if ( (le_atomFile_AddToBatch(batch, fd1) != LE_OK) ||
+ *           (le_atomFile_AddToBatch(batch, fd2) != LE_OK) )
+ *      {
+ *          le_atomFile_CancelBatch(batch);             // Neither file changes.
+ *      }
+ *      else if (le_atomFile_CommitBatch(batch) != LE_OK)
+ *      {
+ *          // Print error message.
+ *      }
+ *
+ * @endcode
+ *
  * @section c_atomFile_nonblock Non-blocking
  *
  * Functions le_atomFile_Open(), le_atomFile_Create(), le_atomFile_OpenStream(),
@@ -260,6 +296,14 @@
 #include "le_fileLock.h"
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a batch of atomic file replacements.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_atomFile_Batch* le_atomFile_BatchRef_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Opens an existing file for atomic access operation.
@@ -590,4 +634,88 @@ le_result_t le_atomFile_TryDelete
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a batch of atomic file replacements that are committed together.
+ *
+ * @return
+ *      Reference to the new batch.
+ *
+ * @note
+ *     The batch must be ended using le_atomFile_CommitBatch() or le_atomFile_CancelBatch().
+ */
+//--------------------------------------------------------------------------------------------------
+le_atomFile_BatchRef_t le_atomFile_BeginBatch
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a file descriptor obtained from this API and adds its changes to a batch instead of
+ * committing them. The file stays locked until the batch is committed or cancelled. Files opened
+ * with LE_FLOCK_READ have no changes and are simply closed.
+ *
+ * The file descriptor is closed in both success and error scenario.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error, in which case the file's changes are discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atomFile_AddToBatch
+(
+    le_atomFile_BatchRef_t batchRef,    ///< [IN] Batch to add the file's changes to.
+    int fd                              ///< [IN] The file descriptor to close.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a file stream obtained from this API and adds its changes to a batch instead of
+ * committing them. The file stays locked until the batch is committed or cancelled. Streams opened
+ * with LE_FLOCK_READ have no changes and are simply closed.
+ *
+ * The file stream is closed in both success and error scenario.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error, in which case the file's changes are discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atomFile_AddStreamToBatch
+(
+    le_atomFile_BatchRef_t batchRef,    ///< [IN] Batch to add the file's changes to.
+    FILE* fileStreamPtr                 ///< [IN] File stream pointer to close.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Commits the changes of all the files in a batch, with one sync barrier for the whole batch, and
+ * releases the batch. Either all or none of the files are replaced, even across a power-cut.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atomFile_CommitBatch
+(
+    le_atomFile_BatchRef_t batchRef     ///< [IN] Batch to commit.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Discards the changes of all the files in a batch and releases the batch.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_atomFile_CancelBatch
+(
+    le_atomFile_BatchRef_t batchRef     ///< [IN] Batch to cancel.
+);
+
+
 #endif //LEGATO_ATOMIC_INCLUDE_GUARD
@@ -47,6 +47,25 @@
  */
 #define LE_ATOMIC_TEST_AND_SET(ptr, order) __atomic_test_and_set((ptr), (order))
 
+/**
+ * Atomically read the value pointed to by ptr.
+ *
+ * @return value read
+ */
+#define LE_ATOMIC_LOAD(ptr, order) __atomic_load_n((ptr), (order))
+
+/**
+ * Atomically write value into the address pointed to by ptr.
+ */
+#define LE_ATOMIC_STORE(ptr, value, order) __atomic_store_n((ptr), (value), (order))
+
+/**
+ * Atomically write value into the address pointed to by ptr, and return the previous value.
+ *
+ * @return value stored at ptr before the operation
+ */
+#define LE_ATOMIC_EXCHANGE(ptr, value, order) __atomic_exchange_n((ptr), (value), (order))
+
 /**
  * Performs an atomic add operation. Results are stored in address pointed to by ptr
  *
@@ -107,6 +126,18 @@
 #error "The frameworkAdaptor is missing a definition of LE_ATOMIC_TEST_AND_SET"
 #endif
 
+#ifndef LE_ATOMIC_LOAD
+#error "The frameworkAdaptor is missing a definition of LE_ATOMIC_LOAD"
+#endif
+
+#ifndef LE_ATOMIC_STORE
+#error "The frameworkAdaptor is missing a definition of LE_ATOMIC_STORE"
+#endif
+
+#ifndef LE_ATOMIC_EXCHANGE
+#error "The frameworkAdaptor is missing a definition of LE_ATOMIC_EXCHANGE"
+#endif
+
 #ifndef LE_ATOMIC_ADD_FETCH
 #error "The frameworkAdaptor is missing a definition of LE_ATOMIC_ADD_FETCH"
 #endif
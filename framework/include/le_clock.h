@@ -133,6 +133,25 @@ typedef struct
 le_clk_Time_t le_clk_GetRelativeTime(void);
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get relative time since a fixed but unspecified starting point, from a clock that is cheaper to
+ * read than the one used by le_clk_GetRelativeTime(), but only advances every few milliseconds.
+ *
+ * Use it for timeouts and intervals that don't need better than millisecond precision.
+ *
+ * @return
+ *      Relative time in seconds/microseconds
+ *
+ * @note
+ *      Coarse relative time may not include time that the processor is suspended, and is not
+ *      on the same time line as le_clk_GetRelativeTime(), so only compare it with other coarse
+ *      relative times.
+ */
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t le_clk_GetCoarseRelativeTime(void);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get absolute time since the Epoch, 1970-01-01 00:00:00 +0000 (UTC).
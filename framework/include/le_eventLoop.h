@@ -459,6 +459,26 @@
  * deregisters any handlers and deletes the thread's Event Loop, its Event
  * Queue, and any event reports still in that Event Queue.
  *
+ * @section c_event_priorities Handler Priorities
+ *
+ * An Event Loop normally dispatches its event reports, queued functions, file descriptor events
+ * and timer expiries in the order they happened.  A handler that must not wait behind a burst
+ * of other work (a watchdog kick, an emergency call signal) can be given a high priority with
+ * @c le_event_SetHandlerPriority(), @c le_fdMonitor_SetPriority() or @c le_timer_SetPriority().
+ * Each time the Event Loop wakes up, it dispatches the high priority reports it found before the
+ * normal priority ones.
+ *
+ * So that a flood of high priority events can't starve the rest of the thread, the Event Loop
+ * lets one normal priority report through after every @c LE_CONFIG_EVENT_HIGH_PRIORITY_BURST
+ * high priority ones.  On Linux, @c LE_CONFIG_EVENT_BATCH_DEADLINE_MS can also make the Event
+ * Loop check its file descriptors again when it has been dispatching normal priority reports
+ * for that long, so that high priority handlers that became ready in the meantime don't wait for
+ * the whole batch.
+ *
+ * Priorities don't preempt anything: a handler that is running is never interrupted.  Setting
+ * @c LE_CONFIG_EVENT_SLOW_HANDLER_MS makes Event Loops log a warning for every handler that runs
+ * for longer than that, which helps to find the handlers that hold up the others.
+ *
  * @section c_event_integratingLegacyPosix Integrating with Legacy POSIX Code
  *
  * Many legacy programs written on top of POSIX APIs will have previously built their own event loop
@@ -633,6 +653,19 @@ typedef void (*le_event_DeferredFunc_t)
 typedef struct le_event_Handler* le_event_HandlerRef_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Priority of a handler.  See @ref c_event_priorities.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    LE_EVENT_PRIORITY_NORMAL = 0,   ///< Dispatched in the order the events happened (default).
+    LE_EVENT_PRIORITY_HIGH,         ///< Dispatched ahead of normal priority handlers.
+}
+le_event_Priority_t;
+
+
 #if LE_CONFIG_EVENT_NAMES_ENABLED
 //--------------------------------------------------------------------------------------------------
 /**
@@ -938,6 +971,18 @@ void le_event_SetContextPtr
     void*                   contextPtr  ///< [in] Context pointer value.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the priority of a given event handler.  Reports already queued to the handler keep the
+ * priority the handler had when they were reported.  See @ref c_event_priorities.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_event_SetHandlerPriority
+(
+    le_event_HandlerRef_t   handlerRef, ///< [in] Handler whose priority is to be set.
+    le_event_Priority_t     priority    ///< [in] Priority of the handler.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the context pointer for a given event handler.
@@ -1006,6 +1051,9 @@ void le_event_QueueFunctionToThread
  * It's generally better to ensure the event is only generated once, for example by disabling
  * generating the event until the event handler is run.
  *
+ * @note A thread's Event Loop takes everything off its Event Queue at once when it wakes up, so
+ *       a function that is about to be called by that wakeup is no longer in the Event Queue.
+ *
  * @return LE_OK if the function was queued to the Event Queue
  * @return LE_DUPLICATE if the function was already in the Event Queue
  */
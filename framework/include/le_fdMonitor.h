@@ -200,7 +200,18 @@ static void ConnectionEventHandler(int fd, int event)
  * until its trigger condition becomes true again.
  *
  * If events occur on different fds at the same time, the order in which the handlers
- * are called is implementation-dependent.
+ * are called is implementation-dependent.  Events that occur on the same fd before its handler
+ * has been called are reported to the handler together, in a single call.
+ *
+ * @section c_fdMonitorEdgeTriggered Edge-Triggered Monitoring
+ *
+ * By default, the handler keeps being called for as long as an enabled event's trigger condition
+ * is true.  A server with many connections can save wakeups by calling
+ * le_fdMonitor_SetEdgeTriggered(), after which the handler is only called when the condition
+ * becomes true.  The handler must then keep reading (or writing) until the fd returns
+ * @c EAGAIN, because it won't be called again for data that was already there.  The fd must be
+ * non-blocking.  Handlers that drain the fd this way also work on platforms that don't support
+ * edge-triggered monitoring, where the call has no effect.
  *
  *
  * @section c_fdMonitorHandlerContext Handler Function Context
@@ -266,6 +277,9 @@ static void ConnectionEventHandler(int fd, int event)
  * It's not recommended to monitor the same fd in two threads at the same time, because the threads
  * will race to handle any events on that fd.
  *
+ * The events of an fd whose handler must not wait behind the rest of the thread's work can be
+ * dispatched ahead of it by calling le_fdMonitor_SetPriority() (see @ref c_event_priorities).
+ *
  *
  * @section c_fdMonitorTroubleshooting Troubleshooting
  *
@@ -510,6 +524,33 @@ void le_fdMonitor_SetDeferrable
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets if the handler of a File Descriptor Monitor is called only when an enabled event becomes
+ * ready (edge-triggered), rather than for as long as it stays ready (level-triggered, the
+ * default).  See @ref c_fdMonitorEdgeTriggered.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fdMonitor_SetEdgeTriggered
+(
+    le_fdMonitor_Ref_t monitorRef,      ///< [in] Reference to the File Descriptor Monitor object.
+    bool               isEdgeTriggered  ///< [in] true (edge-triggered) or false (level-triggered).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the priority with which the events of a File Descriptor Monitor are dispatched by its
+ * thread's Event Loop (see @ref c_event_priorities).  The default is LE_EVENT_PRIORITY_NORMAL.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fdMonitor_SetPriority
+(
+    le_fdMonitor_Ref_t  monitorRef, ///< [in] Reference to the File Descriptor Monitor object.
+    le_event_Priority_t priority    ///< [in] Priority of the handler.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the Context Pointer for File Descriptor Monitor's handler function.  This can be retrieved
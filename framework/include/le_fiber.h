@@ -0,0 +1,219 @@
+/**
+ * @page c_fiber Fiber API
+ *
+ * @subpage le_fiber.h "API Reference"
+ *
+ * <HR>
+ *
+ * A fiber is a function that runs on its own stack, inside the event loop of the thread that
+ * started it, and that can wait for something (an IPC response, a file descriptor, a timer) in
+ * the middle of its code.  While it waits, the thread's event loop goes on running its other
+ * handlers and fibers.  This lets a request that takes several asynchronous steps be written as
+ * one straight function rather than as a chain of callbacks, without blocking the thread the way
+ * le_msg_RequestSyncResponse() or a blocking read() would.
+ *
+ * @code
+ *
+ * static void HandleConnection(void* contextPtr)
+ * {
+ *     int fd = (int)(intptr_t)contextPtr;
+ *     char buffer[256];
+ *
+ *     while (le_fiber_WaitFd(fd, POLLIN) & POLLIN)
+ *     {
+ *         ssize_t count = read(fd, buffer, sizeof(buffer));
+ *         if (count <= 0)
+ *         {
+ *             break;
+ *         }
+ *
+ *         le_msg_MessageRef_t msgRef = le_msg_CreateMsg(SessionRef);
+ *         ...
+ *         msgRef = le_fiber_RequestResponse(msgRef);
+ *         ...
+ *         le_msg_ReleaseMsg(msgRef);
+ *     }
+ *
+ *     close(fd);
+ * }
+ *
+ * static void AcceptConnection(int fd, short events)
+ * {
+ *     int clientFd = accept(fd, NULL, NULL);
+ *
+ *     le_fiber_Start("connection", HandleConnection, (void*)(intptr_t)clientFd);
+ * }
+ *
+ * @endcode
+ *
+ * @section c_fiber_scheduling Scheduling
+ *
+ * Fibers are cooperative: a fiber runs until it waits, yields with le_fiber_Yield(), or returns
+ * from its main function, and only then does its thread's event loop go on with its next event.
+ * A fiber that is ready to run (just started, or whose wait is over) is queued on its thread's
+ * event queue, like a function queued with le_event_QueueFunction(), so fibers and ordinary
+ * handlers take turns in the order they became ready.
+ *
+ * The waiting functions are built on le_fiber_Suspend() and le_fiber_Resume(), which can be used
+ * to wait for other kinds of events: the fiber stores its reference where the handler of the
+ * event can find it, then suspends itself, and the handler resumes it.
+ *
+ * @section c_fiber_rules Rules
+ *
+ * - The thread that starts a fiber must run a Legato event loop.  A fiber always runs in the
+ *   thread that started it, and can only be resumed from that thread.
+ * - The waiting functions can only be called from a fiber.
+ * - Each fiber has a stack of @c LE_CONFIG_FIBER_STACK_SIZE bytes.  Large buffers should not be
+ *   put on it.
+ * - A fiber must not call le_event_RunLoop() or le_event_ServiceLoop(), nor block the thread
+ *   for long: all the thread's other fibers and handlers wait for it.
+ * - Only one fiber (or handler) of a thread can monitor a given file descriptor at a time.
+ *
+ * @note Fibers are only available on Linux.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file le_fiber.h
+ *
+ * Legato @ref c_fiber include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_FIBER_INCLUDE_GUARD
+#define LEGATO_FIBER_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a fiber.  It is only valid until the fiber's main function returns.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_fiber* le_fiber_Ref_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for the main function of a fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_fiber_MainFunc_t)
+(
+    void* contextPtr    ///< [IN] The context pointer given to le_fiber_Start().
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start a fiber in the calling thread.  The fiber first runs when the thread's event loop gets
+ * to it, after the events already queued.
+ *
+ * @return A reference to the fiber.
+ *
+ * @note Terminates the process on failure, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_fiber_Ref_t le_fiber_Start
+(
+    const char*         nameStr,    ///< [IN] Name of the fiber (for diagnostics).
+    le_fiber_MainFunc_t mainFunc,   ///< [IN] Main function of the fiber.
+    void*               contextPtr  ///< [IN] Pointer to pass to it.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the fiber that is running.
+ *
+ * @return The fiber, or NULL if the caller is not running in a fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_fiber_Ref_t le_fiber_GetCurrent
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Suspend the calling fiber until it is resumed with le_fiber_Resume().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_fiber_Suspend
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make a suspended fiber ready to run.  It runs when its thread's event loop gets to it.
+ * Resuming a fiber that is already ready to run has no effect.
+ *
+ * @warning Must be called from the thread that started the fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_fiber_Resume
+(
+    le_fiber_Ref_t fiberRef     ///< [IN] The fiber.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Let the thread's event loop run the events that are already queued, then go on.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_fiber_Yield
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Suspend the calling fiber for a while.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_fiber_Sleep
+(
+    uint32_t ms     ///< [IN] Time to sleep, in milliseconds.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Suspend the calling fiber until a file descriptor is ready.
+ *
+ * @return The events that occurred (see le_fdMonitor_Create()).  @c POLLRDHUP, @c POLLERR and
+ *         @c POLLHUP can be returned even though they were not asked for.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API short le_fiber_WaitFd
+(
+    int     fd,         ///< [IN] File descriptor to wait for.
+    short   events      ///< [IN] Events to wait for (@c POLLIN, @c POLLOUT, @c POLLPRI).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a request message and suspend the calling fiber until the response is received (see
+ * le_msg_RequestResponse()).
+ *
+ * @return The response message, or NULL if the transaction failed.  The response must be
+ *         released with le_msg_ReleaseMsg().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_msg_MessageRef_t le_fiber_RequestResponse
+(
+    le_msg_MessageRef_t msgRef  ///< [IN] The request message.
+);
+
+
+#endif // LEGATO_FIBER_INCLUDE_GUARD
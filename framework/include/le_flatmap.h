@@ -0,0 +1,388 @@
+/**
+ * @page c_flatmap Flat HashMap API
+ *
+ * @subpage le_flatmap.h "API Reference"
+ *
+ * <HR>
+ *
+ * This API provides an open-addressing hash map, as an alternative to the chained
+ * @ref c_hashmap.
+ *
+ * A flat map stores each key-value pair directly in a slot of a single array, rather than in a
+ * separately allocated entry on a bucket list.  Looking up a key usually touches a single cache
+ * line, and adding a key never allocates memory (unless the map has to grow).  Collisions are
+ * resolved with Robin Hood linear probing, and entries are removed by shifting the following
+ * entries back, so no "deleted" markers are left behind to slow down later lookups.
+ *
+ * Flat maps use the same hash and equality functions as hashmaps, so any of the
+ * le_hashmap_HashXxx() and le_hashmap_EqualsXxx() functions (or custom ones) can be used.
+ * Like hashmaps, flat maps only store the key and value pointers; the caller remains responsible
+ * for the storage of the keys and values themselves.
+ *
+ * @section c_flatmap_create Creating a Flat Map
+ *
+ * Use @c le_flatmap_Create() to create a flat map on the heap, or LE_FLATMAP_DEFINE_STATIC()
+ * followed by le_flatmap_InitStatic() to create one in static memory.  The number of slots is the
+ * smallest power of two that keeps the map at most 75% full when it holds the given capacity.
+ *
+ * By default a flat map has a fixed number of slots, and the process exits if more keys are
+ * added than there are slots.  A map created with le_flatmap_Create() can be allowed to grow by
+ * calling le_flatmap_SetGrowable(); it then doubles its number of slots whenever it becomes
+ * more than 7/8 full.  Statically defined maps can not grow.
+ *
+ * @section c_flatmap_iterating Iterating over a Flat Map
+ *
+ * Use le_flatmap_ForEach() to call a function for each key-value pair in the map.  The map must
+ * not be modified while it is being iterated over, as removing or adding a key may move other
+ * entries within the map.
+ *
+ * @note Flat maps are not thread-safe.  Use a mutex if a map is shared between threads.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file le_flatmap.h
+ *
+ * Legato @ref c_flatmap include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_FLATMAP_INCLUDE_GUARD
+#define LEGATO_FLATMAP_INCLUDE_GUARD
+
+#include "le_hashmap.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a flat map.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_flatmap* le_flatmap_Ref_t;
+
+/**
+ * A slot of a flat map.
+ *
+ * @note This is an internal structure which should not be instantiated directly
+ */
+typedef struct le_flatmap_Slot
+{
+    const void  *keyPtr;        ///< Pointer to key data.
+    const void  *valuePtr;      ///< Pointer to value data.
+    uint32_t     hash;          ///< Hash of the key.
+    uint32_t     probeLen;      ///< Distance from the key's home slot, plus one.  0 if the slot
+                                ///  is empty.
+}
+le_flatmap_Slot_t;
+
+/**
+ * The flat map itself
+ *
+ * @note This is an internal structure which should not be instantiated directly
+ */
+typedef struct le_flatmap
+{
+    le_hashmap_EqualsFunc_t  equalsFuncPtr; ///< Equality operator.
+    le_hashmap_HashFunc_t    hashFuncPtr;   ///< Hash operator.
+
+    le_flatmap_Slot_t       *slotsPtr;      ///< Pointer to the array of slots.
+    size_t                   slotCount;     ///< Number of slots.  Always a power of two.
+    size_t                   size;          ///< Number of inserted entries.
+    bool                     isDynamic;     ///< Were the slots allocated from the heap?
+    bool                     isGrowable;    ///< Can the map allocate more slots when it fills up?
+
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+    const char              *nameStr;       ///< Name of the map for diagnostic purposes.
+#endif /* end LE_CONFIG_HASHMAP_NAMES_ENABLED */
+}
+le_flatmap_Flatmap_t;
+
+
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a flat map.
+ *
+ *  @param[in]  nameStr     Name of the map.  This must be a static string as it is not copied.
+ *  @param[in]  capacity    Maximum number of keys expected in the map.
+ *  @param[in]  hashFunc    Hash function
+ *  @param[in]  equalsFunc  Equality function
+ *
+ *  @return  Returns a reference to the map.
+ *
+ *  @note Terminates the process on failure, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_flatmap_Ref_t le_flatmap_Create
+(
+    const char                *nameStr,
+    size_t                     capacity,
+    le_hashmap_HashFunc_t      hashFunc,
+    le_hashmap_EqualsFunc_t    equalsFunc
+);
+#else /* if not LE_CONFIG_HASHMAP_NAMES_ENABLED */
+/// @cond HIDDEN_IN_USER_DOCS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Internal function used to implement le_flatmap_Create().
+ */
+//--------------------------------------------------------------------------------------------------
+le_flatmap_Ref_t _le_flatmap_Create
+(
+    size_t                     capacity,
+    le_hashmap_HashFunc_t      hashFunc,
+    le_hashmap_EqualsFunc_t    equalsFunc
+);
+/// @endcond
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a flat map.
+ *
+ *  @param[in]  nameStr     Name of the map.  This must be a static string as it is not copied.
+ *  @param[in]  capacity    Maximum number of keys expected in the map.
+ *  @param[in]  hashFunc    Hash function
+ *  @param[in]  equalsFunc  Equality function
+ *
+ *  @return  Returns a reference to the map.
+ *
+ *  @note Terminates the process on failure, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE le_flatmap_Ref_t le_flatmap_Create
+(
+    const char                *nameStr,
+    size_t                     capacity,
+    le_hashmap_HashFunc_t      hashFunc,
+    le_hashmap_EqualsFunc_t    equalsFunc
+)
+{
+    LE_UNUSED(nameStr);
+    return _le_flatmap_Create(capacity, hashFunc, equalsFunc);
+}
+#endif /* end LE_CONFIG_HASHMAP_NAMES_ENABLED */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Statically define a flat map.
+ *
+ * This allocates all the space required for a flat map at file scope so no dynamic memory
+ * is needed for the map.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_FLATMAP_DEFINE_STATIC(name, capacity)                                      \
+    static le_flatmap_Flatmap_t _flatmap_##name##Flatmap;                             \
+    static le_flatmap_Slot_t _flatmap_##name##Slots[LE_HASHMAP_BUCKET_COUNT(capacity)]
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize a statically-defined flat map
+ *
+ *  @param  name        Name used when defining the static map.
+ *  @param  capacity    Capacity specified when defining the static map.
+ *  @param  hashFunc    Callback to invoke to hash an entry's key.
+ *  @param  equalsFunc  Callback to invoke to test key equality.
+ *
+ *  @return  Returns a reference to the map.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+#   define le_flatmap_InitStatic(name, capacity, hashFunc, equalsFunc)              \
+        (inline_static_assert(                                                      \
+            sizeof(_flatmap_##name##Slots) ==                                       \
+                sizeof(le_flatmap_Slot_t[LE_HASHMAP_BUCKET_COUNT(capacity)]),       \
+            "flatmap init capacity does not match definition"),                     \
+        _le_flatmap_InitStatic(#name, (hashFunc), (equalsFunc),                     \
+                               &_flatmap_##name##Flatmap,                           \
+                               _flatmap_##name##Slots,                              \
+                               NUM_ARRAY_MEMBERS(_flatmap_##name##Slots)))
+#else
+#   define le_flatmap_InitStatic(name, capacity, hashFunc, equalsFunc)              \
+        (inline_static_assert(                                                      \
+            sizeof(_flatmap_##name##Slots) ==                                       \
+                sizeof(le_flatmap_Slot_t[LE_HASHMAP_BUCKET_COUNT(capacity)]),       \
+            "flatmap init capacity does not match definition"),                     \
+        _le_flatmap_InitStatic((hashFunc), (equalsFunc),                            \
+                               &_flatmap_##name##Flatmap,                           \
+                               _flatmap_##name##Slots,                              \
+                               NUM_ARRAY_MEMBERS(_flatmap_##name##Slots)))
+#endif
+
+/// @cond HIDDEN_IN_USER_DOCS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Internal function to initialize a statically-defined flat map
+ *
+ * @note use le_flatmap_InitStatic() macro instead
+ */
+//--------------------------------------------------------------------------------------------------
+le_flatmap_Ref_t _le_flatmap_InitStatic
+(
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+    const char              *nameStr,       ///< [in] Name of the map
+#endif
+    le_hashmap_HashFunc_t    hashFunc,      ///< [in] The hash function
+    le_hashmap_EqualsFunc_t  equalsFunc,    ///< [in] The equality function
+    le_flatmap_Flatmap_t    *mapPtr,        ///< [in] The static map to initialize
+    le_flatmap_Slot_t       *slotsPtr,      ///< [in] The slots
+    size_t                   slotCount      ///< [in] Number of slots.  Must be a power of two.
+);
+/// @endcond
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allow or prevent a flat map from growing when it fills up.
+ *
+ * @note The process exits if growth is enabled on a statically-defined map.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_flatmap_SetGrowable
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    bool isGrowable            ///< [in] true to allow the map to grow.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a key-value pair to a flat map. If the key already exists in the map, the previous value
+ * will be replaced with the new value passed into this function.
+ *
+ * @return  Returns NULL for a new entry or a pointer to the old value if it is replaced.
+ *
+ * @note The process exits if the key is new and the map is full and can not grow.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_Put
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr,        ///< [in] Pointer to the key to be stored.
+    const void* valuePtr       ///< [in] Pointer to the value to be stored.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retrieve a value from a flat map.
+ *
+ * @return  Returns a pointer to the value or NULL if the key is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_Get
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be retrieved.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retrieve a stored key from a flat map.
+ *
+ * @return  Returns a pointer to the key that was stored in the map by le_flatmap_Put() or
+ *          NULL if the key is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_GetStoredKey
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be retrieved.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a value from a flat map.
+ *
+ * @return  Returns a pointer to the value or NULL if the key is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_Remove
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be removed.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests if a flat map is empty (i.e. contains zero keys).
+ *
+ * @return  Returns true if empty, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_flatmap_IsEmpty
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of keys in a flat map.
+ *
+ * @return  The number of keys in the map.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_flatmap_Size
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests if a flat map contains a particular key.
+ *
+ * @return  Returns true if the key is found, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_flatmap_ContainsKey
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be searched.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deletes all the entries held in a flat map. This will not delete the data pointed to by the
+ * key and value pointers. That cleanup is the responsibility of the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_flatmap_RemoveAll
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Iterates over the whole map, calling the supplied callback with each key-value pair. If the
+ * callback returns false for any key then this function will return.
+ *
+ * @return  Returns true if all elements were checked; or false if iteration was stopped early
+ *
+ * @warning The map must not be modified during the iteration.
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_flatmap_ForEach
+(
+    le_flatmap_Ref_t mapRef,                 ///< [in] Reference to the map.
+    le_hashmap_ForEachHandler_t forEachFn,   ///< [in] Callback function to be called with each pair.
+    void* contextPtr                         ///< [in] Pointer to a context to be supplied to the
+                                             ///<      callback.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counts the number of entries in the map that are not stored in their home slot, i.e., that
+ * collided with another entry.
+ *
+ * @return  Returns the number of displaced entries.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_flatmap_CountCollisions
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+);
+
+#endif /* LEGATO_FLATMAP_INCLUDE_GUARD */
@@ -20,6 +20,19 @@
  * - move a file with le_fs_Move()
  * - recursively deletes a folder with le_fs_RemoveDirRecursive()
  * - checks whether a regular file exists le_fs_Exists()
+ * - map a file into memory for reading with le_fs_MapReadOnly(), and unmap it with le_fs_Unmap()
+ *
+ * @section c_fs_map Read-Only Mappings
+ *
+ * le_fs_MapReadOnly() gives direct access to the contents of a file, without copying them into a
+ * buffer first.  This suits large files that are read but never modified in place, such as
+ * databases or assets that are looked up at random.  The pages are loaded from storage as they are
+ * touched, and are shared with every other process mapping the same file.  An access pattern hint
+ * lets the kernel tune its read ahead.
+ *
+ * The mapping stays valid until le_fs_Unmap() is called, even if the file is deleted or replaced
+ * (e.g., by renaming another file over it) in the meantime.  The file must not be truncated while
+ * it is mapped: touching pages past its new end kills the process with SIGBUS.
  *
  *
  * <HR>
@@ -76,6 +89,29 @@ le_fs_Position_t;
 typedef struct le_fs_File* le_fs_FileRef_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference of a read-only file mapping
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_fs_Mapping* le_fs_MappingRef_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expected access pattern of a file mapping, used to tune read ahead.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    LE_FS_ACCESS_NORMAL = 0,    ///< No particular pattern
+    LE_FS_ACCESS_SEQUENTIAL,    ///< Mostly read from the beginning to the end
+    LE_FS_ACCESS_RANDOM,        ///< Read in no particular order; read ahead is not useful
+    LE_FS_ACCESS_WHOLE          ///< All of the file will be needed soon; start loading it now
+}
+le_fs_AccessPattern_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function is called to create or open an existing file.
@@ -258,6 +294,47 @@ LE_API_FILESYSTEM bool le_fs_Exists
     const char* filePathPtr     ///< [IN] File path
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is called to map a file into memory for reading.
+ *
+ * An empty file gives a NULL data pointer and a size of 0.  The mapping must be released with
+ * le_fs_Unmap().
+ *
+ * @return
+ *  - LE_OK             The function succeeded.
+ *  - LE_BAD_PARAMETER  A parameter is invalid, or the path is not a regular file.
+ *  - LE_OVERFLOW       The file is too big to be mapped.
+ *  - LE_NOT_FOUND      The file does not exist or a directory in the path does not exist
+ *  - LE_NOT_PERMITTED  Access denied to the file or to a directory in the path
+ *  - LE_UNSUPPORTED    The prefix cannot be added and the function is unusable
+ *  - LE_FAULT          The function failed.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API LE_API_FILESYSTEM le_result_t le_fs_MapReadOnly
+(
+    const char* filePath,               ///< [IN] File path
+    le_fs_AccessPattern_t pattern,      ///< [IN] Expected access pattern
+    le_fs_MappingRef_t* mappingRefPtr,  ///< [OUT] Mapping reference (if successful)
+    const uint8_t** dataPtrPtr,         ///< [OUT] Contents of the file (if successful)
+    size_t* sizePtr                     ///< [OUT] Size of the file (if successful)
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is called to release a file mapping.  The data pointer returned with the mapping
+ * must not be used anymore.
+ *
+ * @return
+ *  - LE_OK             The function succeeded.
+ *  - LE_BAD_PARAMETER  The mapping reference is invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API LE_API_FILESYSTEM le_result_t le_fs_Unmap
+(
+    le_fs_MappingRef_t mappingRef   ///< [IN] Mapping reference
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Obtain the absolute directory containing the running executable and the name of the executable.
@@ -17,10 +17,10 @@
  * type of key that you intend to store. It's unwise to mix types in a single table because
  * implementation of the table has no way to detect this behaviour.
  *
- * Choose the initial size should carefully as the index size remains fixed. The best
- * choice for the initial size is a prime number slightly larger than the
- * maximum expected capacity. If a too small size is chosen, there will be an
- * increase in collisions that degrade performance over time.
+ * Choose the initial size should carefully as the index size remains fixed, unless resizing is
+ * enabled (see @ref c_hashmap_resize). The best choice for the initial size is a prime number
+ * slightly larger than the maximum expected capacity. If a too small size is chosen, there will
+ * be an increase in collisions that degrade performance over time.
  *
  * All hashmaps have names for diagnostic purposes.
  *
@@ -142,6 +142,53 @@
  *
  * If you need to control access to the hashmap, then a mutex can be used.
  *
+ * To work on the entries without holding on to the map (for example, to format them for output
+ * without keeping the mutex locked, or to change the map while going through them), take a
+ * snapshot of them with le_hashmap_Snapshot().  This copies every key and value pointer into an
+ * array supplied by the caller, in a single pass over the buckets:
+ *
+ * @code
+ * void PrintTable(le_hashmap_Ref_t myTable)
+ * {
+ *     le_mutex_Lock(MyTableMutex);
+ *     size_t count = le_hashmap_Size(myTable);
+ *     le_hashmap_KeyValue_t entries[count];
+ *     count = le_hashmap_Snapshot(myTable, entries, count);
+ *     le_mutex_Unlock(MyTableMutex);
+ *
+ *     size_t i;
+ *     for (i = 0; i < count; i++)
+ *     {
+ *         printf("%s = %s\n", (const char*)entries[i].keyPtr, (const char*)entries[i].valuePtr);
+ *     }
+ * }
+ * @endcode
+ *
+ * The snapshot only holds pointers, so the keys and values themselves must stay valid for as
+ * long as it is used.
+ *
+ * @section c_hashmap_resize Resizing a map
+ *
+ * If the number of entries in a map can not be predicted, call le_hashmap_EnableResize() with the
+ * maximum load factor (number of entries per 100 buckets) that the map should be allowed to reach.
+ * When the map becomes more loaded than that, a bucket array twice as large is allocated from the
+ * heap, and the entries are moved over to it a few buckets at a time by each subsequent call to
+ * le_hashmap_Put() or le_hashmap_Remove(), so no single call has to rehash the whole map.
+ *
+ * Resizing works for both dynamically created and statically defined maps, provided that heap
+ * memory is available; if the larger bucket array can not be allocated, the map keeps its
+ * current size.  The memory pool for the entries of a statically defined map is still limited to
+ * the capacity given when the map was defined.
+ *
+ * A map is not resized while it is being iterated over with le_hashmap_NextNode(), i.e., between a
+ * call to le_hashmap_GetIterator() and le_hashmap_NextNode() returning LE_NOT_FOUND.  An iteration
+ * that stops before the end should be ended with le_hashmap_ReleaseIterator().  If the map grows
+ * to twice its maximum load while an iteration is still open, the iteration is assumed to have
+ * been abandoned and the map is resized anyway; the iterator then acts as if it had reached the
+ * end of the map.  Any resize
+ * in progress is completed when le_hashmap_GetIterator(), le_hashmap_ForEach(),
+ * le_hashmap_Snapshot(), le_hashmap_GetFirstNode() or le_hashmap_GetNodeAfter() is called.
+ *
  * @section c_hashmap_tracing Tracing a map
  *
  * Hashmaps can be traced using the logging system.
@@ -252,6 +299,19 @@ typedef bool (*le_hashmap_ForEachHandler_t)
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * A key-value pair copied out of a map by le_hashmap_Snapshot().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_hashmap_KeyValue
+{
+    const void          *keyPtr;        ///< Pointer to the key.
+    const void          *valuePtr;      ///< Pointer to the value.
+}
+le_hashmap_KeyValue_t;
+
+
 /**
  * A struct to hold the data in the table
  *
@@ -262,6 +322,9 @@ typedef struct le_hashmap_Entry
     le_hashmap_Link_t    entryListLink; ///< Next entry in bucket.
     const void          *keyPtr;        ///< Pointer to key data.
     const void          *valuePtr;      ///< Pointer to value data.
+#if LE_CONFIG_HASHMAP_STORE_HASH
+    size_t               hash;          ///< Hash of the key.
+#endif
 }
 le_hashmap_Entry_t;
 
@@ -294,6 +357,16 @@ typedef struct le_hashmap
     size_t                   bucketCount;   ///< Number of buckets.
     size_t                   size;          ///< Number of inserted entries.
 
+    le_hashmap_Bucket_t     *oldBucketsPtr; ///< Buckets being migrated from during a resize, or
+                                            ///  NULL if the map is not being resized.
+    size_t                   oldBucketCount;///< Number of buckets being migrated from.
+    size_t                   migrateIndex;  ///< Index of the next old bucket to migrate.
+    uint32_t                 maxLoadPercent;///< Load factor above which the map is resized
+                                            ///  (entries per 100 buckets), or 0 to never resize.
+    bool                     isBucketsOnHeap;    ///< Were the buckets allocated from the heap?
+    bool                     isOldBucketsOnHeap; ///< Were the old buckets allocated from the heap?
+    bool                     isIterating;   ///< Is a step-by-step iteration in progress?
+
 #if LE_CONFIG_HASHMAP_NAMES_ENABLED
     const char               *nameStr;        ///< Name of the hashmap for diagnostic purposes.
     le_log_TraceRef_t         traceRef;       ///< Log trace reference for debugging the hashmap.
@@ -505,6 +578,26 @@ le_hashmap_Ref_t _le_hashmap_InitStatic
 /// @endcond
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable automatic, incremental resizing of a HashMap.
+ *
+ * When the number of entries exceeds maxLoadPercent percent of the number of buckets, the number
+ * of buckets is doubled.  Entries are migrated to the new buckets a few at a time by subsequent
+ * calls to le_hashmap_Put() and le_hashmap_Remove().
+ *
+ * Pass 0 as the maximum load to disable resizing again.  A resize already in progress will still
+ * be completed.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_hashmap_EnableResize
+(
+    le_hashmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    uint32_t maxLoadPercent    ///< [in] Maximum number of entries per 100 buckets, or 0 to never
+                               ///<      resize.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Add a key-value pair to a HashMap. If the key already exists in the map, the previous value
@@ -640,6 +733,26 @@ bool le_hashmap_ForEach
     void* contextPtr                         ///< [in] Pointer to a context to be supplied to the callback.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copies the key and value pointers of the map's entries into an array, in one pass over the map.
+ * The entries are in the same order as le_hashmap_ForEach() would visit them.
+ *
+ * Unlike iterating, this leaves the map free to be changed (or its mutex to be released) while
+ * the copied pairs are being worked on.  Use le_hashmap_Size() to find out how large the array
+ * needs to be.
+ *
+ * @return  Number of pairs copied.  This is less than le_hashmap_Size() only if the array was too
+ *          small to hold all of them.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_hashmap_Snapshot
+(
+    le_hashmap_Ref_t mapRef,                 ///< [in] Reference to the map.
+    le_hashmap_KeyValue_t* pairsPtr,         ///< [out] Array to copy the key-value pairs into.
+    size_t maxCount                          ///< [in] Number of pairs the array can hold.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets an iterator for step-by-step iteration over the map. In this mode,
@@ -673,6 +786,18 @@ le_result_t le_hashmap_NextNode
     le_hashmap_It_Ref_t iteratorRef        ///< [IN] Reference to the iterator.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ends a step-by-step iteration before le_hashmap_NextNode() has reached the end of the map, so
+ * that the map can be resized again (see @ref c_hashmap_resize).  The iterator must not be used
+ * again until le_hashmap_GetIterator() is called.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_hashmap_ReleaseIterator
+(
+    le_hashmap_It_Ref_t iteratorRef        ///< [IN] Reference to the iterator.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Moves the iterator to the previous key/value pair in the map. Order is dependent
@@ -792,6 +917,22 @@ size_t le_hashmap_HashString
     const void* stringToHashPtr    ///< [in] Pointer to the string to be hashed.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hash a block of bytes with the same function as le_hashmap_HashString().  Can be used to look up
+ * a string that isn't null-terminated, such as part of a path, in a map of strings.
+ *
+ * @return  Returns the hash value of the bytes.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+
+size_t le_hashmap_HashBytes
+(
+    const void* bytesPtr,    ///< [in] Pointer to the bytes to be hashed.
+    size_t numBytes          ///< [in] Number of bytes to hash.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * String equality function. Can be used as a parameter to le_hashmap_Create() if the key to
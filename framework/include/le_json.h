@@ -74,6 +74,76 @@
  * finishes.  The error handler function is passed parameters that indicate what type of error
  * occurred.
  *
+ *  @section c_json_query Path Queries
+ *
+ * When only a few values are needed from a large document, le_json_Query() can be used instead
+ * of an event-driven parsing session.  It scans a document held in memory synchronously and
+ * calls a handler function only for the values matching a path, such as
+ *
+ * @code
+ * apns[*].mcc
+ * @endcode
+ *
+ * A path is a sequence of components, each selecting children of the current value:
+ * - <c>.name</c> (or just <c>name</c> at the start of the path) selects an object member by name,
+ * - <c>.*</c> selects all members of an object,
+ * - <c>[n]</c> selects element n of an array, counting from 0,
+ * - <c>[*]</c> selects all elements of an array.
+ *
+ * An empty path selects the whole document.
+ *
+ * Sub-trees which can't match the path are skipped by only tracking string and bracket
+ * boundaries, without reporting events.  As a consequence, syntax errors inside skipped sub-trees
+ * may go undetected.
+ *
+ * The handler gets the type of each matching value (as the event which would have started it)
+ * and its text, which points directly into the document.  For strings, the text excludes the
+ * quotes and escape sequences are not decoded.  For objects and arrays, the text is the whole
+ * value including brackets, so it can be passed to le_json_Query() again.  The handler returns
+ * false to stop the query early.
+ *
+ * On Linux, le_json_QueryFd() does the same for a document read from a regular file, by mapping
+ * the file into memory.
+ *
+ *  @section c_json_writer Writing JSON
+ *
+ * A JSON document can be written with a le_json_Writer_t, without building it in memory first.
+ * le_json_InitWriter() sets up a writer with a buffer supplied by the caller.  If it is also
+ * given a file descriptor, the buffer is written to it whenever it fills up, so documents of any
+ * size can be written with one small buffer and few write() calls.  Otherwise, the document is
+ * composed in the buffer itself, and is kept null-terminated.
+ *
+ * The document is then written a value at a time, starting and ending objects and arrays around
+ * their contents, and writing each object member's name with le_json_WriteMember() before its
+ * value.  The writer adds the commas and colons, and escapes strings.
+ *
+ * @code
+ * char buffer[512];
+ * le_json_Writer_t writer;
+ *
+ * le_json_InitWriter(&writer, fd, buffer, sizeof(buffer));
+ * le_json_StartObject(&writer);
+ * le_json_WriteMember(&writer, "name");
+ * le_json_WriteString(&writer, "joe");
+ * le_json_WriteMember(&writer, "scores");
+ * le_json_StartArray(&writer);
+ * le_json_WriteInt(&writer, 1);
+ * le_json_WriteInt(&writer, 2);
+ * le_json_EndArray(&writer);
+ * le_json_EndObject(&writer);
+ *
+ * if (le_json_FinishWriter(&writer) != LE_OK)
+ * {
+ *     LE_ERROR("Failed to write the document.");
+ * }
+ * @endcode
+ *
+ * writes <c>{"name":"joe","scores":[1,2]}</c>.
+ *
+ * Errors are kept in the writer, and anything written after one is ignored, so they only need to
+ * be checked once, when le_json_FinishWriter() is called.  The writer doesn't check that the
+ * document is well formed (e.g., that every member has a value).
+ *
  *  @section c_json_otherFunctions Other Functions
  *
  * For diagnostic purposes, le_json_GetEventName() can be called to get a human-readable
@@ -418,4 +488,276 @@ le_json_ParsingSessionRef_t le_json_GetSession
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of components in a path passed to le_json_Query().
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_JSON_QUERY_MAX_DEPTH 16
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value matched by a path query.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_json_Event_t type;   ///< LE_JSON_OBJECT_START, LE_JSON_ARRAY_START, LE_JSON_STRING,
+                            ///< LE_JSON_NUMBER, LE_JSON_TRUE, LE_JSON_FALSE or LE_JSON_NULL.
+    const char* textPtr;    ///< Text of the value in the document (not null-terminated).
+    size_t textLen;         ///< Number of bytes of text.
+}
+le_json_Value_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Callbacks for values matched by a path query look like this.
+ *
+ * @param valuePtr  [in] The matching value. (Valid until the handler returns.)
+ *
+ * @param contextPtr [in] Context pointer passed to le_json_Query().
+ *
+ * @return true to continue the query, false to stop it.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef bool (* le_json_QueryHandler_t)
+(
+    const le_json_Value_t* valuePtr,
+    void* contextPtr
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Synchronously find the values matching a path in a JSON document held in memory.
+ *
+ * @return
+ *      - LE_OK             The document was scanned (or the handler stopped the query).
+ *      - LE_BAD_PARAMETER  The path is invalid.
+ *      - LE_FORMAT_ERROR   The document is not valid JSON.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_json_Query
+(
+    const char* bufferPtr,          ///< JSON document.
+    size_t bufferSize,              ///< Size of the JSON document in bytes.
+    const char* pathPtr,            ///< Path of the values to find (see @ref c_json_query).
+    le_json_QueryHandler_t handler, ///< Function to call for each matching value.
+    void* contextPtr                ///< Context pointer passed to the handler.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Synchronously find the values matching a path in a JSON document read from a regular file.
+ *
+ * @return
+ *      - LE_OK             The document was scanned (or the handler stopped the query).
+ *      - LE_BAD_PARAMETER  The path is invalid.
+ *      - LE_FORMAT_ERROR   The document is not valid JSON.
+ *      - LE_FAULT          The file could not be mapped into memory.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_result_t le_json_QueryFd
+(
+    int fd,                         ///< File descriptor to read the JSON document from.
+    const char* pathPtr,            ///< Path of the values to find (see @ref c_json_query).
+    le_json_QueryHandler_t handler, ///< Function to call for each matching value.
+    void* contextPtr                ///< Context pointer passed to the handler.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of objects and arrays that can be open at the same time in a JSON writer.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_JSON_WRITER_MAX_DEPTH 31
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * JSON writer (see @ref c_json_writer).
+ *
+ * @note The members are internal; use le_json_InitWriter() to set one up.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int fd;                 ///< File descriptor the buffer is written to, or -1 if none.
+    char* bufferPtr;        ///< Buffer in which the output is composed.
+    size_t bufferSize;      ///< Size of the buffer, in bytes.
+    size_t used;            ///< Number of bytes of output in the buffer.
+    uint32_t depth;         ///< Number of objects and arrays open.
+    uint32_t hasValueMask;  ///< Bit n is set when the object or array at depth n has a value
+                            ///< already, so the next one needs a comma.
+    bool isAfterMember;     ///< A member name was just written, so the value needs no comma.
+    le_result_t result;     ///< LE_OK, or the first error encountered.
+}
+le_json_Writer_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set up a JSON writer.
+ *
+ * If fd is not -1, the output is written to it, using the buffer to batch up write() calls.
+ * Otherwise, the output is composed in the buffer, which is kept null-terminated.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_InitWriter
+(
+    le_json_Writer_t* writerPtr,    ///< [OUT] Writer to set up.
+    int fd,                         ///< [IN] File descriptor to write to, or -1.
+    char* bufferPtr,                ///< [IN] Buffer to compose the output in.
+    size_t bufferSize               ///< [IN] Size of the buffer, in bytes.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the start of an object ('{').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_StartObject
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the end of an object ('}').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_EndObject
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the start of an array ('[').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_StartArray
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the end of an array (']').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_EndArray
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the name of an object member.  Its value must be written next.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteMember
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    const char* namePtr             ///< [IN] Member name (UTF-8).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a string value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteString
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    const char* stringPtr           ///< [IN] String (UTF-8).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a signed integer value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteInt
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    int64_t value                   ///< [IN] Value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write an unsigned integer value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteUint
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    uint64_t value                  ///< [IN] Value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a number value.  Infinities and NaN, which JSON can't represent, are written as null.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteNumber
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    double value                    ///< [IN] Value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a true or false value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteBool
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    bool value                      ///< [IN] Value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a null value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteNull
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finish writing: write whatever is left in the buffer to the file descriptor, if there is one.
+ *
+ * @return
+ *      - LE_OK         Everything was written.
+ *      - LE_OVERFLOW   The output didn't fit in the buffer (no file descriptor), or objects and
+ *                      arrays were nested more than LE_JSON_WRITER_MAX_DEPTH deep.
+ *      - LE_FAULT      Writing to the file descriptor failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_json_FinishWriter
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+);
+
+
 #endif // LEGATO_JSON_H_INCLUDE_GUARD
@@ -176,6 +176,33 @@
  * Applications can use @ref LE_IS_TRACE_ENABLED(NewShapeTraceRef) to query whether
  * a trace keyword is enabled.
  *
+ * A component with many trace keywords, or that traces in tight loops, can instead define its
+ * keywords statically in a table and register the whole table at start-up.  This needs no memory
+ * allocation, and since the trace references are constant, checking whether a trace is enabled
+ * is a single load:
+ *
+ * @code
+ * enum { TRACE_NEW_SHAPE, TRACE_DEL_SHAPE };
+ *
+ * static le_log_TraceKeyword_t Traces[] =
+ * {
+ *     [TRACE_NEW_SHAPE] = LE_LOG_TRACE_KEYWORD_INIT("newShape"),
+ *     [TRACE_DEL_SHAPE] = LE_LOG_TRACE_KEYWORD_INIT("delShape"),
+ * };
+ *
+ * le_log_RegTraceKeywords(Traces, NUM_ARRAY_MEMBERS(Traces));
+ *
+ * LE_TRACE(LE_LOG_TRACE_REF(Traces[TRACE_NEW_SHAPE]), "Created %p.", shapePtr);
+ * @endcode
+ *
+ * @subsection c_log_static_filter Compile-Time Filtering
+ *
+ * Log statements below the static log level filter selected in KConfig are removed at compile
+ * time, along with their arguments, and can't be enabled at runtime.  A single component can
+ * raise its own static filter by defining @c LE_LOG_LEVEL_STATIC_FILTER in its @c cflags:
+ * section (e.g., <c>-DLE_LOG_LEVEL_STATIC_FILTER=LE_LOG_WARN</c>).  LE_TRACE() statements can be
+ * removed system-wide by enabling the @c LOG_STATIC_NO_TRACE KConfig option.
+ *
  * These allow apps to hook into the trace management system to use it to implement
  * sophisticated, app-specific tracing or profiling features.
  *
@@ -389,11 +416,17 @@ le_log_Level_t;
 /**
  * Compile-time filtering level.
  *
+ * This is set system-wide by the static log level filter in KConfig, and may be raised for a
+ * single component by defining it on the compiler command line (e.g., in the component's
+ * @c cflags: section, <c>-DLE_LOG_LEVEL_STATIC_FILTER=LE_LOG_WARN</c>).
+ *
  * @note Logs below this filter level will be removed at compile-time and cannot be enabled
  *       at runtime.
  */
 //--------------------------------------------------------------------------------------------------
-#if LE_CONFIG_LOG_STATIC_FILTER_NO_LOG
+#if defined(LE_LOG_LEVEL_STATIC_FILTER)
+    // Set for this component by the build.
+#elif LE_CONFIG_LOG_STATIC_FILTER_NO_LOG
 #   define LE_LOG_LEVEL_STATIC_FILTER   LE_LOG_MAX
 #elif LE_CONFIG_LOG_STATIC_FILTER_EMERG
 #   define LE_LOG_LEVEL_STATIC_FILTER   LE_LOG_EMERG
@@ -416,6 +449,17 @@ typedef struct le_log_Session* le_log_SessionRef_t;
 
 typedef struct le_log_Trace* le_log_TraceRef_t;
 
+/**
+ * Statically defined trace keyword.  Use LE_LOG_TRACE_KEYWORD_INIT() to initialize one.
+ */
+typedef struct le_log_TraceKeyword
+{
+    bool                         isEnabled;     ///< true if enabled (trace references point here).
+    const char                  *keywordPtr;    ///< The keyword.
+    struct le_log_TraceKeyword  *nextPtr;       ///< Next keyword of the same component.
+}
+le_log_TraceKeyword_t;
+
 #if !defined(LE_DEBUG) && \
     !defined(LE_DUMP) && \
     !defined(LE_LOG_DUMP) && \
@@ -475,6 +519,18 @@ le_log_TraceRef_t _le_log_GetTraceRef
     const char          *keyword        ///< Trace keyword.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers statically defined trace keywords for the calling component.
+ **/
+//--------------------------------------------------------------------------------------------------
+void _le_log_RegTraceKeywords
+(
+    le_log_SessionRef_t     logSession,     ///< Log session.
+    le_log_TraceKeyword_t  *keywordsPtr,    ///< Array of keyword definitions.
+    size_t                  count           ///< Number of keywords in the array.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the log filter level for the calling component.
@@ -554,9 +610,7 @@ extern LE_SHARED le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
  *  @param  dataLength  Length og the buffer.
  */
 //--------------------------------------------------------------------------------------------------
-#define LE_DUMP(dataPtr, dataLength)                                                              \
-    _le_LogData(LE_LOG_DEBUG, dataPtr, dataLength, STRINGIZE(LE_FILENAME), _LE_LOG_FUNCTION_NAME, \
-        __LINE__)
+#define LE_DUMP(dataPtr, dataLength) LE_LOG_DUMP(LE_LOG_DEBUG, dataPtr, dataLength)
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -567,8 +621,12 @@ extern LE_SHARED le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
  *  @param  dataLength  Length of the buffer.
  */
 //--------------------------------------------------------------------------------------------------
-#define LE_LOG_DUMP(level, dataPtr, dataLength) \
-    _le_LogData(level, dataPtr, dataLength, STRINGIZE(LE_FILENAME), _LE_LOG_FUNCTION_NAME, __LINE__)
+#define LE_LOG_DUMP(level, dataPtr, dataLength)                                                   \
+    do {                                                                                          \
+        if ((level) >= LE_LOG_LEVEL_STATIC_FILTER)                                                \
+            _le_LogData(level, dataPtr, dataLength, STRINGIZE(LE_FILENAME),                       \
+                        _LE_LOG_FUNCTION_NAME, __LINE__);                                         \
+    } while(0)
 /** @copydoc LE_LOG_INFO */
 #define LE_INFO(formatString, ...)      _LE_LOG_MSG(LE_LOG_INFO, formatString, ##__VA_ARGS__)
 /** @copydoc LE_LOG_WARN */
@@ -581,6 +639,40 @@ extern LE_SHARED le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
 #define LE_EMERG(formatString, ...)     _LE_LOG_MSG(LE_LOG_EMERG, formatString, ##__VA_ARGS__)
 
 
+#if LE_CONFIG_LOG_STATIC_NO_TRACE
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queries whether or not a trace keyword is enabled.  Traces are compiled out, so never.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_IS_TRACE_ENABLED(traceRef)  ((void)(traceRef), false)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Traces are compiled out, so this logs nothing.
+ *
+ * The arguments are still referenced, but never evaluated, so that variables only used for
+ * tracing don't become unused and the format string is still checked.  The compiler discards the
+ * call.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_TRACE(traceRef, string, ...)         \
+        if (0)                                  \
+        {                                       \
+            _le_log_Send((le_log_Level_t)-1,    \
+                    traceRef,                   \
+                    LE_LOG_SESSION,             \
+                    STRINGIZE(LE_FILENAME),     \
+                    _LE_LOG_FUNCTION_NAME,      \
+                    __LINE__,                   \
+                    string,                     \
+                    ##__VA_ARGS__);             \
+        }
+
+#else /* !LE_CONFIG_LOG_STATIC_NO_TRACE */
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Mark tracing as used, so trace-related code can be compiled in.
@@ -619,6 +711,8 @@ extern LE_SHARED le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
                     ##__VA_ARGS__);             \
         }
 
+#endif /* end !LE_CONFIG_LOG_STATIC_NO_TRACE */
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -633,6 +727,19 @@ extern LE_SHARED le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
     _le_log_GetTraceRef(LE_LOG_SESSION, (keywordPtr))
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers an array of statically defined trace keywords, so they can be controlled like those
+ * obtained with le_log_GetTraceRef().  No memory is allocated.
+ *
+ * @param keywordsPtr   [IN] Pointer to the first le_log_TraceKeyword_t in the array.
+ * @param count         [IN] Number of keywords in the array.
+ **/
+//--------------------------------------------------------------------------------------------------
+#define le_log_RegTraceKeywords(keywordsPtr, count)     \
+    _le_log_RegTraceKeywords(LE_LOG_SESSION, (keywordsPtr), (count))
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Determines if a trace is currently enabled.
@@ -802,6 +909,17 @@ extern LE_SHARED le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
 #define le_log_GetTraceRef(keywordPtr) ((le_log_TraceRef_t)NULL)
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers an array of statically defined trace keywords.
+ *
+ * @param keywordsPtr   [IN] Pointer to the first le_log_TraceKeyword_t in the array.
+ * @param count         [IN] Number of keywords in the array.
+ **/
+//--------------------------------------------------------------------------------------------------
+#define le_log_RegTraceKeywords(keywordsPtr, count) ((void)(keywordsPtr), (void)(count))
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Determines if a trace is currently enabled.
@@ -843,6 +961,28 @@ extern LE_SHARED le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
 
 #endif /* Logging macro override */
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializer for a statically defined trace keyword (le_log_TraceKeyword_t).
+ *
+ * @param keyword   [IN] The keyword string (a string literal).
+ **/
+//--------------------------------------------------------------------------------------------------
+#define LE_LOG_TRACE_KEYWORD_INIT(keyword)  { .isEnabled = false, .keywordPtr = (keyword), \
+                                              .nextPtr = NULL }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the trace reference of a statically defined trace keyword.  Because its address is known
+ * at compile time, LE_TRACE() with such a reference needs no NULL check.
+ *
+ * @param keywordObj    [IN] The le_log_TraceKeyword_t (not a pointer to it).
+ *
+ * @return  Trace reference.
+ **/
+//--------------------------------------------------------------------------------------------------
+#define LE_LOG_TRACE_REF(keywordObj)        ((le_log_TraceRef_t)&(keywordObj).isEnabled)
+
 /// Function that does the real work of translating result codes.  See @ref LE_RESULT_TXT.
 const char* _le_log_GetResultCodeString
 (
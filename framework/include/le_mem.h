@@ -250,6 +250,23 @@
  *
  * To reset the pool statistics, use @c le_mem_ResetStats().
  *
+ * On RTOS systems, the "app pools" command prints the block size, number of blocks and
+ * high-water mark of every pool, along with the memory that shrinking each pool to its
+ * high-water mark would save.  The memory reserved at build time by each component's static
+ * pools, reference maps and hash maps is listed by mksys in the <tt>\<target\>.mem.txt</tt> file
+ * next to the system's object file.
+ *
+ * @section mem_profile Allocation Profiling
+ *
+ * When the @ref MEM_POOL_PROFILE KConfig option is enabled, one in every
+ * @ref MEM_POOL_PROFILE_INTERVAL allocations from each pool is sampled: the address the allocation
+ * function was called from, and the time, are recorded in a small ring kept for the pool.  The
+ * most recent samples can be fetched with @c le_mem_GetAllocSamples().
+ *
+ * The "inspect pools --hot" command uses them to show, for each pool, its recent allocation rate,
+ * its peak usage, the number of times le_mem_ForceAlloc() had to expand it, and the call sites
+ * that allocate from it most often.
+ *
  * @section mem_diagnostics Diagnostics
  *
  * The memory system also supports two different forms of diagnostics.  Both are enabled by setting
@@ -297,6 +314,24 @@
  * the data structure, then the mutex must be held by the thread that calls le_mem_Release() to
  * ensure there's no other thread accessing the data structure when the destructor runs.
  *
+ * @section mem_thread_cache Per-Thread Caches
+ *
+ * Every allocation and release normally takes a single process-wide mutex, which serializes
+ * pool operations across all threads.  For a pool that is hammered by several threads at once,
+ * @c le_mem_EnableThreadCache() can be called right after creating (and expanding) the pool to give
+ * each thread its own small cache of free blocks:
+ *  - Allocations are taken from the calling thread's cache.  When it is empty, it is refilled from
+ *    the pool with a batch of half the cache size under the mutex.
+ *  - Releases of the last reference put the block into the calling thread's cache.  When it holds
+ *    more than the cache size, half of it is spilled back to the pool under the mutex.
+ *  - When a thread exits, its cached blocks are returned to the pool.
+ *
+ * Blocks held in a thread's cache are free, but can only be allocated by that thread until they
+ * are spilled, so a pool with a cache should be sized with a few extra objects per thread.  The
+ * number of free objects sitting in caches is reported in the @c numThreadCached statistic.  The
+ * in-use and allocation counts reported by @c le_mem_GetStats() are updated each time a cache is
+ * refilled or spilled, so they may lag behind by up to the cache size per thread.
+ *
  * @section mem_pool_sizes Managing Pool Sizes
  *
  * We know it's possible to have pools automatically expand
@@ -443,6 +478,45 @@
  * or it has any sub-pools.  Reduced-size pools also automatically inherit their parent's
  * destructor function.
  *
+ * @section mem_size_classes Size Classes
+ *
+ * A chain of reduced-size pools has only as many sizes as it has pools, and finding the right
+ * one means walking up the chain.  Where object sizes vary widely, call
+ * @c le_mem_EnableSizeClasses() on a pool instead.  This creates a pool for each size class
+ * from the given minimum up to the pool's own object size, with classes spaced at powers of two
+ * and half-way between them (16, 24, 32, 48, 64, 96, ...), so no block is more than a third
+ * bigger than needed.  After that, @c le_mem_TryVarAlloc(), @c le_mem_AssertVarAlloc() and
+ * @c le_mem_ForceVarAlloc() on the pool go straight to the smallest class that fits, and only
+ * objects bigger than every class come from the pool itself.
+ *
+ * Each size-class pool has its own free list, and grows a page's worth (4 KiB) of blocks at a
+ * time.  Size-class pools show up in the pool list (and in the inspect tool) with the class size
+ * appended to the pool's name, so the occupancy of each class can be seen.  Each pool also keeps
+ * the total number of bytes asked for by variable-size allocations it served
+ * (numBytesRequested in @c le_mem_PoolStats_t), from which the wasted space can be worked out.
+ *
+ * Size-class pools take the pool's destructor, so set it before enabling size classes.  Size
+ * classes are not available for sub-pools, and can only be enabled once per pool.
+ *
+ * @section mem_trim Trimming
+ *
+ * Pools never shrink: a pool expanded by @c le_mem_ForceAlloc() during a burst of activity keeps
+ * its blocks afterwards.  On Linux, @c le_mem_Trim() gives the pages under the free blocks of all
+ * pools back to the system (with @c madvise(MADV_DONTNEED)), leaving a few free blocks in each
+ * pool untouched.  Only whole pages covered by runs of adjacent free blocks can be given back, so
+ * pools of small objects with scattered free blocks may not give back anything.  The trimmed
+ * blocks stay in their pool, and get fresh zero-filled pages when they are next allocated, so
+ * trimming never makes an allocation fail; it only makes the next allocations after it slower.
+ *
+ * The number of free blocks a pool keeps is set by @c LE_CONFIG_MEM_TRIM_MIN_FREE, and can be
+ * changed for a pool with @c le_mem_SetTrimMinimum(), e.g., to keep a pool that must stay fast
+ * from being trimmed at all.  Sub-pools are not trimmed, but their super-pool is.
+ *
+ * Unless the framework was built without @c MEM_TRIM_ON_PRESSURE, every process calls
+ * @c le_mem_Trim() from its main thread when the system (or the process' cgroup) is under memory
+ * pressure, at most every few seconds.  The number of trimmed blocks in a pool is reported in
+ * numTrimmed of @c le_mem_PoolStats_t.
+ *
  * <HR>
  *
  * Copyright (C) Sierra Wireless Inc.
@@ -508,9 +582,18 @@ typedef struct le_mem_Pool
     uint64_t numAllocations;            ///< Total number of times an object has been allocated
                                         ///  from this pool.
     size_t maxNumBlocksUsed;            ///< Maximum number of allocated blocks at any one time.
+    uint64_t numBytesRequested;         ///< Total number of bytes asked for by variable-size
+                                        ///  allocations served by this pool.
+#if LE_CONFIG_MEM_POOL_PROFILE
+    struct mem_AllocProfile* profilePtr;///< Ring of sampled allocations, or NULL if none yet.
+#endif
 #endif
 #if LE_CONFIG_MEM_POOLS
     le_sls_List_t freeList;             ///< List of free memory blocks.
+    struct le_mem_Pool** sizeClassesPtr;///< Pools serving variable-size allocations of each size
+                                        ///  class, smallest first, or NULL if not enabled.
+    size_t numSizeClasses;              ///< Number of entries in sizeClassesPtr.
+    size_t minSizeClassShift;           ///< log2 of the smallest size class.
 #endif
 
     size_t userDataSize;                ///< Size of the object requested by the client in bytes.
@@ -525,6 +608,19 @@ typedef struct le_mem_Pool
                                         ///< for this pool.
 #endif
 
+#if LE_CONFIG_MEM_THREAD_CACHE
+    size_t threadCacheSize;             ///< Maximum number of free blocks each thread may cache
+                                        ///  (0 if per-thread caching is disabled).
+    size_t numBlocksCached;             ///< Number of free blocks held in per-thread caches.
+#endif
+
+#if LE_CONFIG_MEM_TRIM
+    le_sls_List_t trimmedList;          ///< Runs of free blocks whose pages have been given back
+                                        ///  to the system (see le_mem_Trim()).
+    size_t numBlocksTrimmed;            ///< Number of blocks in the runs on trimmedList.
+    size_t trimMinFree;                 ///< Number of free blocks le_mem_Trim() leaves alone.
+#endif
+
     le_mem_Destructor_t destructor;     ///< The destructor for objects in this pool.
 #if LE_CONFIG_MEM_POOL_NAMES_ENABLED
     char name[LE_MEM_LIMIT_MAX_MEM_POOL_NAME_BYTES]; ///< Name of the pool.
@@ -554,10 +650,30 @@ typedef struct
     size_t      numOverflows;       ///< Number of times le_mem_ForceAlloc() had to expand the pool.
     uint64_t    numAllocs;          ///< Number of times an object has been allocated from this pool.
     size_t      numFree;            ///< Number of free objects currently available in this pool.
+    size_t      numThreadCached;    ///< Number of the free objects that are held in per-thread
+                                    ///  caches (see le_mem_EnableThreadCache()).
+    uint64_t    numBytesRequested;  ///< Total number of bytes asked for by variable-size
+                                    ///  allocations served by this pool (see
+                                    ///  le_mem_EnableSizeClasses()).
+    size_t      numTrimmed;         ///< Number of the free objects whose memory has been given
+                                    ///  back to the system (see le_mem_Trim()).
 }
 le_mem_PoolStats_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * A sampled allocation (see @ref mem_profile).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    void*       callerPtr;          ///< Address the allocation function was called from.
+    uint64_t    timestamp;          ///< When the allocation happened (relative time, in usec).
+}
+le_mem_AllocSample_t;
+
+
 #if LE_CONFIG_MEM_TRACE
     //----------------------------------------------------------------------------------------------
     /**
@@ -1216,6 +1332,84 @@ void le_mem_SetDestructor
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enables a per-thread cache of free blocks for a specified pool.
+ *
+ * See @ref mem_thread_cache for more information.
+ *
+ * @return
+ *      Nothing.
+ *
+ * @note
+ *      Must be called before any objects are allocated from the pool.  Sub-pools can't have a
+ *      per-thread cache.  This is a no-op if the framework was built without
+ *      @ref MEM_THREAD_CACHE.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_EnableThreadCache
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    size_t              numObjects  ///< [IN] Maximum number of free objects each thread may hold
+                                    ///       in its cache.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Serves variable-size allocations from a pool out of size-class pools.
+ *
+ * See @ref mem_size_classes for more information.
+ *
+ * @return
+ *      Nothing.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_EnableSizeClasses
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    size_t              minObjSize  ///< [IN] Size of the smallest size class (rounded up to a
+                                    ///       power of two).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the number of free objects that le_mem_Trim() leaves untouched in a pool.
+ *
+ * See @ref mem_trim for more information.
+ *
+ * @return
+ *      Nothing.
+ *
+ * @note
+ *      This is a no-op if the framework was built without @ref MEM_TRIM.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_SetTrimMinimum
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    size_t              numObjects  ///< [IN] Number of free objects to keep (SIZE_MAX to never
+                                    ///       trim the pool).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives the memory under the free blocks of all memory pools back to the system.
+ *
+ * See @ref mem_trim for more information.
+ *
+ * @return
+ *      Number of bytes given back (0 if the framework was built without @ref MEM_TRIM).
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_mem_Trim
+(
+    void
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the statistics for a specified pool.
@@ -1245,6 +1439,24 @@ void le_mem_ResetStats
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fetches the most recent allocation samples for a specified pool, oldest first.
+ *
+ * See @ref mem_profile for more information.
+ *
+ * @return
+ *      Number of samples stored in the buffer (always 0 if allocation profiling is disabled).
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_mem_GetAllocSamples
+(
+    le_mem_PoolRef_t        pool,           ///< [IN] Pool whose samples are to be fetched.
+    le_mem_AllocSample_t*   samplesPtr,     ///< [OUT] Buffer to store the samples in.
+    size_t                  maxSamples      ///< [IN] Number of samples the buffer can hold.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the memory pool's name, including the component name prefix.
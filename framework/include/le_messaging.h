@@ -93,6 +93,20 @@
  * a session (by calling le_msg_CreateSession()), they are required to provide a reference to a
  * Protocol object that they obtained from le_msg_GetProtocolRef().
  *
+ * Each process keeps its own copy of the protocol identifier and of the names of the interfaces
+ * it uses.  Where these are constant data, as they are in generated code, the process can refer
+ * to them instead, so that they are shared (through the page cache) by all the processes that
+ * use them: describe the protocol with a constant @c le_msg_ProtocolDesc_t and get its reference
+ * from le_msg_GetStaticProtocolRef(), and create services and sessions with
+ * le_msg_CreateStaticService() and le_msg_CreateStaticSession().
+ *
+ * @code
+ *     static const le_msg_ProtocolDesc_t ProtocolDesc = { PROTOCOL_ID, sizeof(myproto_Msg_t) };
+ *
+ *     protocolRef = le_msg_GetStaticProtocolRef(&ProtocolDesc);
+ *     sessionRef = le_msg_CreateStaticSession(protocolRef, MY_INTERFACE_NAME);
+ * @endcode
+ *
  * @section c_messagingClientUsage Client Usage Model
  *
  * @ref c_messagingClientSending <br>
@@ -145,6 +159,12 @@
  *     msgPayloadPtr->... = ...; // <-- Populate message payload...
  * @endcode
  *
+ * Messages created with le_msg_CreateMsg() are as big as the protocol's largest message.  If the
+ * client knows that a message, and the server's response to it, are smaller than that, it can use
+ * le_msg_CreateSizedMsg() instead.  The message then takes less memory on both sides of the
+ * session, and fewer bytes are sent.  le_msg_GetMaxPayloadSize() gives the size of a message's
+ * payload buffer, which the server's response must also fit in.
+ *
  * If no response is required from the server, the client sends the message using le_msg_Send().
  * At this point, the client has handed off the message to the messaging system, and the messaging
  * system will delete the message automatically once it has finished sending it.
@@ -186,6 +206,17 @@
  *     le_msg_ReleaseMsg(responseMsgRef);
  * @endcode
  *
+ * A client can have many asynchronous requests in flight on the same session at once, instead of
+ * waiting for each response before sending the next request.  Responses to requests that arrive
+ * together are all handled in the same pass of the event loop.  To stop a fast client from
+ * flooding a slow server, the number of requests in flight can be limited by calling
+ * le_msg_SetSessionRequestWindow().  Requests beyond the window are held by the session and sent
+ * as responses come back (in the order they were requested).
+ *
+ * @code
+ *     le_msg_SetSessionRequestWindow(sessionRef, 16);
+ * @endcode
+ *
  * @subsection c_messagingClientReceiving Receiving a Non-Response Message
  *
  * When a server sends a message to the client that is not a response to a request from the client,
@@ -366,6 +397,8 @@
  *
  * @ref c_messagingServerProcessingMessages <br>
  * @ref c_messagingServerSendingNonResponse <br>
+ * @ref c_messagingServerDurableQueue <br>
+ * @ref c_messagingServerBroadcast <br>
  * @ref c_messagingServerCleanUp <br>
  * @ref c_messagingRemovingService <br>
  * @ref c_messagingServerMultithreading <br>
@@ -510,6 +543,40 @@
  * The function le_msg_NeedsResponse() can be used to check if a received message requires a
  * response or not.
  *
+ * @subsection c_messagingServerDurableQueue Durable Queues
+ *
+ * A server that would rather not lose the one-way messages its clients send while it is busy or
+ * restarting (telemetry, for instance) can call le_msg_SetServiceDurableQueue() before advertising
+ * its service.  Each client user then gets a ring file of the given size, shared by both sides,
+ * and messages sent with le_msg_Send() are appended to it instead of going through the session's
+ * socket.  The server's receive handler gets them at the server's own pace, as if they had come
+ * through the socket.  Messages still in the ring when the server goes down are delivered, through
+ * the next session opened by the same user, when it is back, and clients keep appending to the
+ * ring in the meantime.
+ *
+ * A message is only removed from the ring after the receive handler returns, so a message being
+ * handled when the server dies will be handled again.  Messages that carry a file descriptor,
+ * requests, and messages sent while the ring is full go through the socket as usual, so they may
+ * overtake messages still in the ring.
+ *
+ * @subsection c_messagingServerBroadcast Broadcasting to Subscribers
+ *
+ * A server that sends the same message to many clients (an event that many clients registered
+ * handlers for, for instance) can subscribe their sessions with le_msg_Subscribe() and send the
+ * message to all of them at once with le_msg_Broadcast().  If the service was given a broadcast
+ * channel with le_msg_SetServiceBroadcast() before being advertised, the message is copied once
+ * into a ring of shared memory slots that the clients read from, and each subscriber is just
+ * woken up.  Otherwise, a copy is sent through each subscriber's session.  Either way, the client
+ * gets the message through its session's receive handler, as if it had been sent with
+ * le_msg_Send().
+ *
+ * As the same payload goes to all subscribers, it can't hold anything specific to one of them.
+ * Any client of the service can read the messages in the ring, subscribed or not.
+ *
+ * A client that falls more than a ring's worth of messages behind either skips the messages it
+ * missed (LE_MSG_BROADCAST_SKIP) or has its session closed (LE_MSG_BROADCAST_CLOSE), as chosen by
+ * the server.  Broadcast messages may overtake messages sent through the session's socket.
+ *
  * @subsection c_messagingServerSendingNonResponse Sending Non-Response Messages to Clients
  *
  * If a server wants to send a non-response message to a client, it first needs a reference
@@ -831,6 +898,18 @@
 //--------------------------------------------------------------------------------------------------
 typedef struct le_msg_Protocol* le_msg_ProtocolRef_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Description of a protocol, kept in constant data (see le_msg_GetStaticProtocolRef()).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char* id;             ///< String uniquely identifying the protocol and version.
+    size_t      maxMsgSize;     ///< Size (in bytes) of the largest message in the protocol.
+}
+le_msg_ProtocolDesc_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Reference to an interface's service instance.
@@ -932,6 +1011,20 @@ typedef void (* le_msg_ResponseCallback_t)
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * What a client does when it falls too far behind on a service's broadcast channel to read the
+ * messages it missed (see @ref c_messagingServerBroadcast).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    LE_MSG_BROADCAST_SKIP,      ///< Skip the missed messages and carry on with the oldest one left.
+    LE_MSG_BROADCAST_CLOSE      ///< Close the session, as if the server had closed it.
+}
+le_msg_BroadcastOverflow_t;
+
+
 
 
 //--------------------------------------------------------------------------------------------------
@@ -993,6 +1086,7 @@ typedef struct
 #endif
     le_msg_LocalReceiver_t receiver; ///< Server destination
     le_mem_PoolRef_t messagePool;    ///< Pool for messages on this service
+    const void* directCallsPtr;      ///< Functions called directly by clients in the server's thread
 } le_msg_LocalService_t;
 
 
@@ -1040,6 +1134,25 @@ LE_FULL_API le_msg_ProtocolRef_t le_msg_GetProtocolRef
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a reference to refer to a particular version of a particular protocol, from a description
+ * of the protocol kept in constant data.
+ *
+ * Unlike le_msg_GetProtocolRef(), this doesn't copy the protocol identifier: the protocol keeps
+ * referring to the description's.
+ *
+ * @return  Protocol reference.
+ *
+ * @warning The description and its identifier string must never change or go away.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_msg_ProtocolRef_t le_msg_GetStaticProtocolRef
+(
+    const le_msg_ProtocolDesc_t* descPtr    ///< [in] Description of the protocol.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the unique identifier string of the protocol.
@@ -1088,6 +1201,22 @@ LE_FULL_API le_msg_SessionRef_t le_msg_CreateSession
     const char*             interfaceName   ///< [in] Name of the client-side interface.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Same as le_msg_CreateSession(), except that the interface name isn't copied: the interface
+ * keeps referring to the caller's string.
+ *
+ * @return  Session reference.
+ *
+ * @warning The interface name must never change or go away (e.g., a string literal).
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_msg_SessionRef_t le_msg_CreateStaticSession
+(
+    le_msg_ProtocolRef_t    protocolRef,    ///< [in] Reference to the protocol to be used.
+    const char*             interfaceName   ///< [in] Name of the client-side interface.
+);
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -1132,6 +1261,25 @@ LE_FULL_API void* le_msg_GetSessionContextPtr
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of asynchronous requests (sent using le_msg_RequestResponse()) that
+ * may be waiting for their responses on a session at once.  Requests made while the window is
+ * full are held by the session and sent as earlier requests complete.
+ *
+ * The default is LE_CONFIG_MSG_REQUEST_WINDOW.
+ *
+ * @note    Only meaningful on the client side.  Has no effect on local sessions, whose requests
+ *          are always handled in order by the server's thread.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_SetSessionRequestWindow
+(
+    le_msg_SessionRef_t sessionRef, ///< [in] Reference to the session.
+    uint32_t            window      ///< [in] Maximum requests in flight, or 0 for unlimited.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Deletes a session.  This will end the session and free up any resources associated
@@ -1403,6 +1551,29 @@ le_msg_MessageRef_t le_msg_CreateMsg
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a message to be sent over a given session, with a payload buffer of a given size
+ * instead of the protocol's maximum message size.
+ *
+ * The buffer may be made bigger than asked for (but never bigger than the protocol's maximum
+ * message size).  Use le_msg_GetMaxPayloadSize() to get its actual size.  If a response is
+ * expected, it must fit in the same buffer.
+ *
+ * @return  Message reference.
+ *
+ * @note
+ * - Function never returns on failure, there's no need to check the return code.
+ * - Messages over local sessions are always as big as the service's largest message.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_MessageRef_t le_msg_CreateSizedMsg
+(
+    le_msg_SessionRef_t sessionRef,     ///< [in] Reference to the session.
+    size_t              payloadSize     ///< [in] Size of the payload buffer, in bytes.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Adds to the reference count on a message object.
@@ -1622,6 +1793,22 @@ LE_FULL_API le_msg_ServiceRef_t le_msg_CreateService
     const char*             interfaceName   ///< [in] Server-side interface name.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Same as le_msg_CreateService(), except that the interface name isn't copied: the interface
+ * keeps referring to the caller's string.
+ *
+ * @return  Service reference.
+ *
+ * @warning The interface name must never change or go away (e.g., a string literal).
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API le_msg_ServiceRef_t le_msg_CreateStaticService
+(
+    le_msg_ProtocolRef_t    protocolRef,    ///< [in] Reference to the protocol to be used.
+    const char*             interfaceName   ///< [in] Server-side interface name.
+);
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -1639,6 +1826,41 @@ le_msg_ServiceRef_t le_msg_InitLocalService
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the table of functions through which clients running in a local service's own thread call
+ * the server directly, instead of sending it messages.  The layout of the table is only known to
+ * the client and server code generated for the service's protocol.
+ *
+ * Does nothing if the service is not a local service.
+ *
+ * @note    Server-only function.  Must be called before the service is advertised.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetServiceDirectCalls
+(
+    le_msg_ServiceRef_t serviceRef, ///< [in] Reference to the service.
+    const void*         tablePtr    ///< [in] Table of functions (must stay valid), or NULL.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the table of functions through which a client can call the server of a session directly
+ * (see le_msg_SetServiceDirectCalls()).
+ *
+ * @return The table, or NULL if the session is not a local session, its service has no table, or
+ *         the calling thread is not the service's thread.  Messages must then be sent as usual.
+ *
+ * @note    Client-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+const void* le_msg_GetSessionDirectCalls
+(
+    le_msg_SessionRef_t sessionRef  ///< [in] Reference to the session.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Deletes a service. Any open sessions will be terminated.
@@ -1744,6 +1966,88 @@ LE_FULL_API void* le_msg_GetServiceContextPtr
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives a service a durable queue for the one-way messages its clients send
+ * (see @ref c_messagingServerDurableQueue).  Only affects sessions opened afterwards.
+ *
+ * Does nothing if durable queues are disabled (LE_CONFIG_MSG_DURABLE_QUEUE).
+ *
+ * @note    Server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_SetServiceDurableQueue
+(
+    le_msg_ServiceRef_t serviceRef, ///< [in] Reference to the service.
+    size_t              numBytes    ///< [in] Size of each client user's ring, in bytes, or 0 for
+                                    ///       no durable queue.  Rounded up to hold at least two
+                                    ///       messages.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives a service a broadcast channel, through which le_msg_Broadcast() delivers messages to the
+ * subscribers of the sessions opened afterwards (see @ref c_messagingServerBroadcast).  Must be
+ * called at most once per service, before advertising it.
+ *
+ * Does nothing if broadcast channels are disabled (LE_CONFIG_MSG_BROADCAST) or can't be created.
+ *
+ * @note    Server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_SetServiceBroadcast
+(
+    le_msg_ServiceRef_t         serviceRef, ///< [in] Reference to the service.
+    size_t                      numMsgs,    ///< [in] Number of messages the channel holds.
+    le_msg_BroadcastOverflow_t  overflow    ///< [in] What a client that falls further behind
+                                            ///       than that does.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a session to the subscribers of the messages its service broadcasts.
+ *
+ * @note    Server-only function.  Must be called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_Subscribe
+(
+    le_msg_SessionRef_t sessionRef  ///< [in] Reference to the session.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Removes a session from the subscribers of the messages its service broadcasts.  Messages
+ * broadcast before this is called are still delivered.
+ *
+ * @note    Server-only function.  Must be called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_Unsubscribe
+(
+    le_msg_SessionRef_t sessionRef  ///< [in] Reference to the session.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a message to every session subscribed to a service.  No response expected.
+ *
+ * @note    Server-only function.  Must be called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_Broadcast
+(
+    le_msg_ServiceRef_t serviceRef, ///< [in] Reference to the service.
+    const void*         payloadPtr, ///< [in] Payload of the message.
+    size_t              payloadSize ///< [in] Size of the payload, in bytes (at most the
+                                    ///       protocol's maximum message size).
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Makes a given service available for clients to find.
@@ -1814,6 +2118,26 @@ le_msg_MessageRef_t le_msg_GetServiceRxMsg
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calls a service's message receive handler for a message on the calling thread, as if the
+ * message had been received there.  This is for servers that hand received messages off to other
+ * threads: le_msg_GetServiceRxMsg() and LE_KILL_CLIENT() then work in the handler.
+ *
+ * Responses (and session closes) from a thread other than the service's thread are carried out
+ * by the service's thread.
+ *
+ * @note    Server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_HandleServiceRxMsg
+(
+    le_msg_ReceiveHandler_t handlerFunc,    ///< [in] Receive handler function.
+    le_msg_MessageRef_t     msgRef,         ///< [in] Reference to the received message.
+    void*                   contextPtr      ///< [in] contextPtr parameter for the handler.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Logs an error message (at EMERGENCY level) and:
@@ -0,0 +1,339 @@
+/**
+ * @page c_metrics Metrics API
+ *
+ * @subpage le_metrics.h "API Reference"
+ *
+ * <HR>
+ *
+ * Metrics are named performance counters that a component keeps up to date as it runs (requests
+ * served, bytes written, queue depth, request latencies, ...) and that can be read at any time,
+ * from any thread, without the component having to log them.
+ *
+ * There are three types of metric:
+ *  - A @b counter only goes up.  @c le_metrics_Add() and @c le_metrics_Increment() add to it.
+ *  - A @b gauge holds a value that goes up and down.  @c le_metrics_SetGauge() sets it, and
+ *    @c le_metrics_AddToGauge() adds a (possibly negative) amount to it.
+ *  - A @b histogram records the distribution of a value (e.g. a latency in microseconds).
+ *    @c le_metrics_Record() adds a sample to it.
+ *
+ * Updating a metric never takes a lock, so it is cheap enough to do on every request.  Counters
+ * and histograms are split into shards, and each thread updates the shard it was given the
+ * first time it updated a metric, so that threads running on different CPUs rarely write to the
+ * same cache line.  The shards are added up when the metric is read.
+ *
+ * @section c_metrics_create Creating Metrics
+ *
+ * @code
+ * static le_metrics_Ref_t RequestCount;
+ * static le_metrics_Ref_t QueueDepth;
+ * static le_metrics_Ref_t RequestLatency;
+ *
+ * COMPONENT_INIT
+ * {
+ *     RequestCount = le_metrics_CreateCounter("myDaemon.requests");
+ *     QueueDepth = le_metrics_CreateGauge("myDaemon.queueDepth");
+ *     RequestLatency = le_metrics_CreateHistogram("myDaemon.latencyUs");
+ * }
+ *
+ * static void HandleRequest(Request_t* requestPtr)
+ * {
+ *     le_metrics_Increment(RequestCount);
+ *     ...
+ *     le_metrics_Record(RequestLatency, elapsedUs);
+ * }
+ * @endcode
+ *
+ * Metric names must be unique within a process.  By convention they start with the name of the
+ * component that owns them.
+ *
+ * @section c_metrics_read Reading Metrics
+ *
+ * @c le_metrics_GetCount() gets the value of a counter, or the number of samples recorded by a
+ * histogram.  @c le_metrics_GetGauge() gets the value of a gauge.  @c le_metrics_GetSum() gets
+ * the sum of the samples recorded by a histogram, and @c le_metrics_GetPercentile() an estimate
+ * of the value below which a given percentage of them fall.
+ *
+ * Histograms keep, for each power of two, four buckets of equal width (like an HDR histogram
+ * with two significant bits), so percentiles are within 25% of the recorded values over their
+ * whole range, whatever that range is.
+ *
+ * @c le_metrics_ForEach() calls a function for each metric of the process, e.g. to export them
+ * to a monitoring service.
+ *
+ * Reads are not synchronized with updates: a value read while other threads update the metric
+ * includes some of the updates made during the read, and a histogram's count, sum and
+ * percentiles may be read at slightly different times.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file le_metrics.h
+ *
+ * Legato @ref c_metrics include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_METRICS_INCLUDE_GUARD
+#define LEGATO_METRICS_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of bytes in a metric name, including the null terminator.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_METRICS_NAME_MAX_BYTES   48
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a metric.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_metrics_Metric* le_metrics_Ref_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Types of metric.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    LE_METRICS_COUNTER,     ///< Value that only goes up.
+    LE_METRICS_GAUGE,       ///< Value that goes up and down.
+    LE_METRICS_HISTOGRAM    ///< Distribution of a value.
+}
+le_metrics_Type_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for functions called by le_metrics_ForEach().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_metrics_ForEachFunc_t)
+(
+    le_metrics_Ref_t metricRef,     ///< [IN] The metric.
+    void* contextPtr                ///< [IN] The context pointer given to le_metrics_ForEach().
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a counter, starting at zero.
+ *
+ * @return Reference to the counter.
+ *
+ * @note Terminates the process if a metric with the same name already exists.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Ref_t le_metrics_CreateCounter
+(
+    const char* namePtr     ///< [IN] Name of the counter.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a gauge, starting at zero.
+ *
+ * @return Reference to the gauge.
+ *
+ * @note Terminates the process if a metric with the same name already exists.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Ref_t le_metrics_CreateGauge
+(
+    const char* namePtr     ///< [IN] Name of the gauge.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an empty histogram.
+ *
+ * @return Reference to the histogram.
+ *
+ * @note Terminates the process if a metric with the same name already exists.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Ref_t le_metrics_CreateHistogram
+(
+    const char* namePtr     ///< [IN] Name of the histogram.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a metric.  It must no longer be updated or read by any thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_Delete
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The metric.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add to a counter.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_Add
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The counter.
+    uint64_t amount             ///< [IN] Amount to add.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add one to a counter.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void le_metrics_Increment
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The counter.
+)
+{
+    le_metrics_Add(metricRef, 1);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the value of a gauge.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_SetGauge
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The gauge.
+    int64_t value               ///< [IN] New value.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add to the value of a gauge.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_AddToGauge
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The gauge.
+    int64_t amount              ///< [IN] Amount to add (negative to subtract).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record a sample in a histogram.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_Record
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The histogram.
+    uint64_t value              ///< [IN] Value of the sample.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the value of a counter, or the number of samples recorded by a histogram.
+ *
+ * @return The count.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_metrics_GetCount
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The counter or histogram.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the value of a gauge.
+ *
+ * @return The value.
+ */
+//--------------------------------------------------------------------------------------------------
+int64_t le_metrics_GetGauge
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The gauge.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the sum of the samples recorded by a histogram.
+ *
+ * @return The sum (wraps around if it doesn't fit in 64 bits).
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_metrics_GetSum
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The histogram.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Estimate a percentile of the samples recorded by a histogram.
+ *
+ * @return The largest value of the bucket holding the given percentile (the largest value
+ *         recorded for 100), or 0 if the histogram is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_metrics_GetPercentile
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The histogram.
+    double percentile           ///< [IN] Percentile, from 0 to 100.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the name of a metric.
+ *
+ * @return The name.
+ */
+//--------------------------------------------------------------------------------------------------
+const char* le_metrics_GetName
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The metric.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the type of a metric.
+ *
+ * @return The type.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Type_t le_metrics_GetType
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The metric.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Call a function for each metric of the process, oldest first.
+ *
+ * @warning The function must not create or delete metrics.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_ForEach
+(
+    le_metrics_ForEachFunc_t func,  ///< [IN] Function to call.
+    void* contextPtr                ///< [IN] Context pointer to pass to it.
+);
+
+
+#endif // LEGATO_METRICS_INCLUDE_GUARD
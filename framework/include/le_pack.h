@@ -1122,6 +1122,282 @@ LE_DECLARE_INLINE bool le_pack_PackTaggedArrayHeader
         }                                                               \
     } while (0)
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of fixed-size integers into a buffer, incrementing the buffer pointer.
+ *
+ * The result is the same as with LE_PACK_PACKARRAY, but the elements are copied as a block
+ * (or, when the wire format needs a tag and a byte swap per element, in a single loop) rather
+ * than through one pack function call per element.
+ *
+ * @note Users of this API should generally use one of the typed functions below, e.g.,
+ * le_pack_PackUint32Array().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackIntArray
+(
+    uint8_t **bufferPtr,
+    const void *arrayPtr,
+    size_t elementSize,     ///< 1, 2, 4 or 8
+    size_t arrayCount,
+    size_t arrayMaxCount,
+    uint8_t elementTag      ///< Tag of each element (only used with LE_CONFIG_RPC)
+)
+{
+    if (!le_pack_PackArrayHeader(bufferPtr, arrayPtr, elementSize, arrayCount, arrayMaxCount))
+    {
+        return false;
+    }
+
+    if (0 == arrayCount)
+    {
+        return true;
+    }
+
+#ifdef LE_CONFIG_RPC
+    // Each element is tagged and big-endian on the wire.
+    size_t i;
+    uint8_t *outPtr = *bufferPtr;
+    const uint8_t *inPtr = (const uint8_t *)arrayPtr;
+
+    for (i = 0; i < arrayCount; ++i, inPtr += elementSize)
+    {
+        *outPtr++ = elementTag;
+        switch (elementSize)
+        {
+            case 2:
+            {
+                uint16_t value;
+                memcpy(&value, inPtr, sizeof(value));
+                value = htobe16(value);
+                memcpy(outPtr, &value, sizeof(value));
+                break;
+            }
+            case 4:
+            {
+                uint32_t value;
+                memcpy(&value, inPtr, sizeof(value));
+                value = htobe32(value);
+                memcpy(outPtr, &value, sizeof(value));
+                break;
+            }
+            case 8:
+            {
+                uint64_t value;
+                memcpy(&value, inPtr, sizeof(value));
+                value = htobe64(value);
+                memcpy(outPtr, &value, sizeof(value));
+                break;
+            }
+            default:
+                *outPtr = *inPtr;
+                break;
+        }
+        outPtr += elementSize;
+    }
+    *bufferPtr = outPtr;
+#else
+    LE_UNUSED(elementTag);
+
+    // Elements are untagged and in host order: copy them in one go.
+    memcpy(*bufferPtr, arrayPtr, elementSize * arrayCount);
+    *bufferPtr = *bufferPtr + elementSize * arrayCount;
+#endif
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of uint8_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackUint8Array
+(
+    uint8_t **bufferPtr,
+    const uint8_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_UINT8);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of uint16_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackUint16Array
+(
+    uint8_t **bufferPtr,
+    const uint16_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_UINT16);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of uint32_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackUint32Array
+(
+    uint8_t **bufferPtr,
+    const uint32_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_UINT32);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of uint64_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackUint64Array
+(
+    uint8_t **bufferPtr,
+    const uint64_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_UINT64);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of int8_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackInt8Array
+(
+    uint8_t **bufferPtr,
+    const int8_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_INT8);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of int16_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackInt16Array
+(
+    uint8_t **bufferPtr,
+    const int16_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_INT16);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of int32_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackInt32Array
+(
+    uint8_t **bufferPtr,
+    const int32_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_INT32);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack an array of int64_t into a buffer, incrementing the buffer pointer.
+ *
+ * @return false if arrayCount exceeds arrayMaxCount.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_PackInt64Array
+(
+    uint8_t **bufferPtr,
+    const int64_t *arrayPtr,
+    size_t arrayCount,
+    size_t arrayMaxCount
+)
+{
+#ifdef LE_CONFIG_RPC
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                LE_PACK_INT64);
+#else
+    return le_pack_PackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr), arrayCount, arrayMaxCount,
+                                0);
+#endif
+}
+
 //--------------------------------------------------------------------------------------------------
 // Unpack functions
 //--------------------------------------------------------------------------------------------------
@@ -1687,4 +1963,237 @@ LE_DECLARE_INLINE bool le_pack_UnpackArrayHeader
     LE_PACK_UNPACKARRAY((bufferPtr), (arrayPtr), (arrayCountPtr),       \
                         (arrayMaxCount), (unpackFunc), (resultPtr))
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of fixed-size integers from a buffer, incrementing the buffer pointer.
+ *
+ * The result is the same as with LE_PACK_UNPACKARRAY, but the elements are copied as a block
+ * (or, when the wire format has a tag and a byte swap per element, in a single loop) rather than
+ * through one unpack function call per element.
+ *
+ * @note Users of this API should generally use one of the typed functions below, e.g.,
+ * le_pack_UnpackUint32Array().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackIntArray
+(
+    uint8_t **bufferPtr,
+    void *arrayPtr,
+    size_t elementSize,     ///< 1, 2, 4 or 8
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    if (!le_pack_UnpackArrayHeader(bufferPtr, arrayPtr, elementSize, arrayCountPtr, arrayMaxCount))
+    {
+        return false;
+    }
+
+    if (0 == *arrayCountPtr)
+    {
+        return true;
+    }
+
+#ifdef LE_CONFIG_RPC
+    // Each element is tagged and big-endian on the wire.
+    size_t i;
+    const uint8_t *inPtr = *bufferPtr;
+    uint8_t *outPtr = (uint8_t *)arrayPtr;
+
+    for (i = 0; i < *arrayCountPtr; ++i, outPtr += elementSize)
+    {
+        // Skip the tag.
+        inPtr++;
+        switch (elementSize)
+        {
+            case 2:
+            {
+                uint16_t value;
+                memcpy(&value, inPtr, sizeof(value));
+                value = be16toh(value);
+                memcpy(outPtr, &value, sizeof(value));
+                break;
+            }
+            case 4:
+            {
+                uint32_t value;
+                memcpy(&value, inPtr, sizeof(value));
+                value = be32toh(value);
+                memcpy(outPtr, &value, sizeof(value));
+                break;
+            }
+            case 8:
+            {
+                uint64_t value;
+                memcpy(&value, inPtr, sizeof(value));
+                value = be64toh(value);
+                memcpy(outPtr, &value, sizeof(value));
+                break;
+            }
+            default:
+                *outPtr = *inPtr;
+                break;
+        }
+        inPtr += elementSize;
+    }
+    *bufferPtr = (uint8_t *)inPtr;
+#else
+    memcpy(arrayPtr, *bufferPtr, elementSize * (*arrayCountPtr));
+    *bufferPtr = *bufferPtr + elementSize * (*arrayCountPtr);
+#endif
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of uint8_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackUint8Array
+(
+    uint8_t **bufferPtr,
+    uint8_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of uint16_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackUint16Array
+(
+    uint8_t **bufferPtr,
+    uint16_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of uint32_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackUint32Array
+(
+    uint8_t **bufferPtr,
+    uint32_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of uint64_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackUint64Array
+(
+    uint8_t **bufferPtr,
+    uint64_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of int8_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackInt8Array
+(
+    uint8_t **bufferPtr,
+    int8_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of int16_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackInt16Array
+(
+    uint8_t **bufferPtr,
+    int16_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of int32_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackInt32Array
+(
+    uint8_t **bufferPtr,
+    int32_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack an array of int64_t from a buffer, incrementing the buffer pointer.
+ *
+ * @return false if the packed array has more than arrayMaxCount elements.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_DECLARE_INLINE bool le_pack_UnpackInt64Array
+(
+    uint8_t **bufferPtr,
+    int64_t *arrayPtr,
+    size_t *arrayCountPtr,
+    size_t arrayMaxCount
+)
+{
+    return le_pack_UnpackIntArray(bufferPtr, arrayPtr, sizeof(*arrayPtr),
+                                  arrayCountPtr, arrayMaxCount);
+}
+
 #endif /* LE_PACK_H_INCLUDE_GUARD */
@@ -11,6 +11,15 @@
  * The random numbers returned by this API may be used for cryptographic purposes such as encryption
  * keys, initialization vectors, etc.
  *
+ * @c le_rand_GetNumBetween() and @c le_rand_GetBuffer() take their numbers from a ChaCha20
+ * generator that each thread has to itself, so getting many small random numbers (transaction
+ * IDs, nonces, timer jitter) is cheap.  The generator is seeded from the platform's random number
+ * generator (e.g. @c getrandom() on Linux), and reseeded from it regularly and after a fork.
+ *
+ * @c le_rand_GetEntropy() reads the platform's random number generator directly, at the cost of a
+ * system call.  Use it for long-term secrets (e.g. to seed another generator or make a long-lived
+ * key) that should not depend on any state kept by the process.
+ *
  * <HR>
  *
  * Copyright (C) Sierra Wireless Inc.
@@ -57,4 +66,17 @@ void le_rand_GetBuffer
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a buffer of random numbers straight from the platform's random number generator, bypassing
+ * the thread's generator.  Slower than le_rand_GetBuffer().
+ */
+//--------------------------------------------------------------------------------------------------
+void le_rand_GetEntropy
+(
+    uint8_t* bufPtr,            ///< [OUT] Buffer to store the random numbers in.
+    size_t bufSize              ///< [IN] Number of random numbers to get.
+);
+
+
 #endif // LEGATO_RAND_INCLUDE_GUARD
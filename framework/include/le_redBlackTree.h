@@ -136,6 +136,68 @@
  *     le_mem_Release(myNodePtr);
  * @endcode
  *
+ * @section rbtree_bounds Searching Ranges
+ *
+ * le_rbtree_LowerBound() finds the first node whose key is not less than a given key, and
+ * le_rbtree_UpperBound() the first node whose key is greater than it.  Together with
+ * le_rbtree_GetNext() they iterate over a range of keys without visiting the rest of the tree:
+ *
+ * @code
+ * // Visit the nodes whose keys are in [lowKey, highKey).
+ * le_rbtree_Node_t* linkPtr;
+ * for (linkPtr = le_rbtree_LowerBound(&MyTree, &lowKey);
+ *      linkPtr != NULL;
+ *      linkPtr = le_rbtree_GetNext(&MyTree, linkPtr))
+ * {
+ *     MyNodeClass_t* myNodePtr = CONTAINER_OF(linkPtr, MyNodeClass_t, myLink);
+ *     if (compare(&myNodePtr->key, &highKey) >= 0)
+ *     {
+ *         break;
+ *     }
+ *     ...
+ * }
+ * @endcode
+ *
+ * @section rbtree_augment Augmented Trees
+ *
+ * A node can hold data that summarizes its whole subtree, such as the number of nodes in it (to
+ * find the n-th node or the rank of a node in O(log n)) or the greatest end of the intervals in it
+ * (to find the intervals overlapping a point or an interval).  The tree keeps this data up to
+ * date through an augment function, set with le_rbtree_SetAugmentFunc() while the tree is empty.
+ * It is called to recompute the data of a node from the node itself and its children, whenever
+ * the node's subtree changes: on insertion, removal and rotations.
+ *
+ * @code
+ * typedef struct
+ * {
+ *     uint32_t start;              // Key.
+ *     uint32_t end;
+ *     uint32_t maxEnd;             // Greatest end in the subtree.
+ *     le_rbtree_Node_t link;
+ * }
+ * Interval_t;
+ *
+ * static void UpdateMaxEnd(le_rbtree_Node_t* linkPtr, le_rbtree_Node_t* leftPtr,
+ *                          le_rbtree_Node_t* rightPtr)
+ * {
+ *     Interval_t* intervalPtr = CONTAINER_OF(linkPtr, Interval_t, link);
+ *
+ *     intervalPtr->maxEnd = intervalPtr->end;
+ *     if (leftPtr != NULL && CONTAINER_OF(leftPtr, Interval_t, link)->maxEnd > intervalPtr->maxEnd)
+ *     {
+ *         intervalPtr->maxEnd = CONTAINER_OF(leftPtr, Interval_t, link)->maxEnd;
+ *     }
+ *     ... // Same for rightPtr.
+ * }
+ *
+ * le_rbtree_InitTree(&IntervalTree, CompareStart);
+ * le_rbtree_SetAugmentFunc(&IntervalTree, UpdateMaxEnd);
+ * @endcode
+ *
+ * Queries on the summary data walk down from le_rbtree_GetRoot() with le_rbtree_GetLeftChild()
+ * and le_rbtree_GetRightChild().  If a node's own contribution to the summary changes while it is
+ * in the tree (the end of an interval, but not its key), call le_rbtree_UpdateAugment() on it.
+ *
  * @section rbtree_synch Thread Safety and Re-Entrancy
  *
  * All Red-Black Tree function calls are re-entrant and thread safe themselves, but if the nodes
@@ -198,6 +260,20 @@ typedef int (*le_rbtree_CompareFunc_t)
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Augment function, which recomputes the summary data of a node's subtree from the node and its
+ * children (whose data is up to date).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_rbtree_AugmentFunc_t)
+(
+    le_rbtree_Node_t *linkPtr,      ///< [IN] Node whose data is to be recomputed.
+    le_rbtree_Node_t *leftPtr,      ///< [IN] Its left child, or NULL.
+    le_rbtree_Node_t *rightPtr      ///< [IN] Its right child, or NULL.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This is the RBTree object. User must initialize it by calling le_rbtree_InitTree.
@@ -210,6 +286,7 @@ typedef struct le_rbtree_Tree
     le_rbtree_Node_t *root;         ///< Root tree node.
     size_t size;                    ///< Number of elements in the tree.
     le_rbtree_CompareFunc_t compFn; ///< Key comparison function.
+    le_rbtree_AugmentFunc_t augmentFn; ///< Augment function, or NULL.
 }
 le_rbtree_Tree_t;
 
@@ -225,6 +302,18 @@ void le_rbtree_InitTree
     le_rbtree_CompareFunc_t compFn  ///< [IN] Pointer to the comparator function.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the function maintaining the summary data of an augmented tree.  Must be called while the
+ * tree is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_rbtree_SetAugmentFunc
+(
+    le_rbtree_Tree_t *treePtr,          ///< [IN] Pointer to the tree object.
+    le_rbtree_AugmentFunc_t augmentFn   ///< [IN] Augment function.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initialize the Node Link.
@@ -265,6 +354,34 @@ le_rbtree_Node_t* le_rbtree_Find
     void *keyPtr                  ///< [IN] Pointer to the key to be retrieved
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the first node in the tree whose key is greater than or equal to the given key.
+ *
+ * @return Pointer to the Node found in the tree.
+ *         NULL if all keys are less than the given key.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_LowerBound
+(
+    const le_rbtree_Tree_t *treePtr,    ///< [IN] Tree to search.
+    const void *keyPtr                  ///< [IN] Pointer to the key.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the first node in the tree whose key is greater than the given key.
+ *
+ * @return Pointer to the Node found in the tree.
+ *         NULL if no key is greater than the given key.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_UpperBound
+(
+    const le_rbtree_Tree_t *treePtr,    ///< [IN] Tree to search.
+    const void *keyPtr                  ///< [IN] Pointer to the key.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Removes the specified node from the tree.
@@ -351,6 +468,57 @@ le_rbtree_Node_t* le_rbtree_GetPrev
     le_rbtree_Node_t *currentLinkPtr        ///< [IN] Get the link that is relative to this link.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the root node of the tree, to walk down an augmented tree.
+ *
+ * @return Pointer to the root node.
+ *         NULL if the tree is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_GetRoot
+(
+    const le_rbtree_Tree_t *treePtr    ///< [IN] Tree to get the node from.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the left child of a node (whose keys are all less than the node's).
+ *
+ * @return Pointer to the child node.
+ *         NULL if the node has no left child.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_GetLeftChild
+(
+    const le_rbtree_Node_t *linkPtr    ///< [IN] Node in a tree.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the right child of a node (whose keys are all greater than the node's).
+ *
+ * @return Pointer to the child node.
+ *         NULL if the node has no right child.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_GetRightChild
+(
+    const le_rbtree_Node_t *linkPtr    ///< [IN] Node in a tree.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Recompute the summary data of a node and of its ancestors, after a change to the node's own
+ * contribution to it.  Does nothing if the tree has no augment function.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_rbtree_UpdateAugment
+(
+    le_rbtree_Tree_t *treePtr,    ///< [IN] Tree containing the node.
+    le_rbtree_Node_t *linkPtr     ///< [IN] Node whose data has changed.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Tests if the Tree is empty.
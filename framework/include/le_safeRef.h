@@ -59,10 +59,17 @@
  * @section c_safeRef_multithreading Multithreading
  *
  * This API's functions are reentrant, but not thread safe. If there's the slightest
- * possibility the same Reference Map will be accessed by two threads at the same time, use
+ * possibility the same Reference Map will be modified by two threads at the same time, use
  * a mutex or some other thread synchronization mechanism to protect the Reference Map from
  * concurrent access.
  *
+ * The exception is @c le_ref_Lookup(), which never needs the lock: it can be called from any
+ * number of threads while one thread creates or deletes Safe References in the same map.  A lookup
+ * that races with @c le_ref_DeleteRef() may still return the old pointer, so an object looked up
+ * without the lock must not be freed until no such lookup can be using it (for example, by having
+ * the lookup take a reference count on it, or by only freeing it from the thread that does the
+ * lookups).  The iterator functions still need the lock.
+ *
  * @section c_safeRef_example Sample Code
  *
  * Here's an API Definition sample:
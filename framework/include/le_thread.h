@@ -151,6 +151,16 @@
  * the clean-up is done, if the thread's cancellation type is set to "deferred".
  * See 'man 7 pthreads' for more information on cancellation and cancellation points.
  *
+ * @section threadSingleThreaded Single-Threaded Executables
+ *
+ * Most executables only ever run their main thread.  Building an executable with
+ * @c LE_SINGLE_THREADED defined (e.g., <c>mkexe --cflags=-DLE_SINGLE_THREADED</c>) makes its
+ * generated @c main() call le_thread_SetSingleThreaded() before anything else, so that the Legato
+ * framework can skip the mutexes that protect its internal data from other threads.  Any attempt
+ * to create or adopt a thread in such a process is then a fatal error.  This requires the
+ * framework to be built with @c LE_CONFIG_SINGLE_THREADED_EXES; otherwise the declaration is
+ * ignored.
+ *
  *
  * <HR>
  *
@@ -729,4 +739,24 @@ void le_thread_CleanupLegatoThreadData
 );
 
 
+#if LE_CONFIG_SINGLE_THREADED_EXES
+//--------------------------------------------------------------------------------------------------
+/**
+ * Declare the calling process single-threaded: from now on, the Legato framework does not protect
+ * its internal data against other threads, and creating a thread is a fatal error.
+ *
+ * Called by the generated main() of executables built with LE_SINGLE_THREADED defined.  Must be
+ * called from the main thread, before any other thread has been created.
+ **/
+//--------------------------------------------------------------------------------------------------
+void le_thread_SetSingleThreaded
+(
+    void
+);
+#else
+/// Ignored if the framework does not support single-threaded executables.
+#define le_thread_SetSingleThreaded()   ((void) 0)
+#endif
+
+
 #endif // LEGATO_THREAD_INCLUDE_GUARD
@@ -0,0 +1,200 @@
+/**
+ * @page c_threadPool Thread Pool API
+ *
+ * @subpage le_threadPool.h "API Reference"
+ *
+ * <HR>
+ *
+ * A thread pool runs short jobs on a fixed set of worker threads, so that a program can spread
+ * CPU-bound work (parsing, compression, checksums, ...) over several cores without creating a
+ * thread per job.
+ *
+ * Each worker has its own queue of jobs.  A job submitted from inside another job goes to the
+ * queue of the worker running it, and that worker runs its newest job first, which keeps the
+ * data it just touched in its cache.  A worker whose queue is empty takes the oldest job of
+ * another worker's queue ("work stealing"), so a burst of jobs submitted from one place still
+ * spreads over all the workers.
+ *
+ * @section c_threadPool_create Creating a Pool
+ *
+ * Create a pool with @c le_threadPool_Create(), giving the number of workers (or zero for one
+ * worker per online CPU), then start the workers with @c le_threadPool_Start().  Before the pool
+ * is started, @c le_threadPool_SetCpuAffinity() can pin a worker to a set of CPUs.
+ *
+ * @code
+ * static le_threadPool_Ref_t Pool;
+ *
+ * COMPONENT_INIT
+ * {
+ *     Pool = le_threadPool_Create("hashPool", 0);
+ *     le_threadPool_Start(Pool);
+ * }
+ * @endcode
+ *
+ * @section c_threadPool_submit Submitting Jobs
+ *
+ * @c le_threadPool_Submit() queues a job function and a context pointer.  The value returned by
+ * the job function is its result.  If a completion function is given, it is queued to the event
+ * loop of the thread that submitted the job, and called there with the job's result and context
+ * once the job has run, in the same way as @c le_event_QueueFunctionToThread().  The submitting
+ * thread must therefore run an event loop.  Workers don't run one: a job submitted from inside
+ * another job has its completion function called directly by the worker that ran it.
+ *
+ * @code
+ * static void* HashFile(void* contextPtr)
+ * {
+ *     Request_t* requestPtr = contextPtr;
+ *     ...
+ *     return requestPtr;
+ * }
+ *
+ * static void HashDone(void* resultPtr, void* contextPtr)
+ * {
+ *     Request_t* requestPtr = resultPtr;
+ *     ...
+ * }
+ *
+ * le_threadPool_Submit(Pool, HashFile, requestPtr, HashDone);
+ * @endcode
+ *
+ * Jobs are not run in any particular order, and must not block for long (waiting for another
+ * job in particular can deadlock the pool).
+ *
+ * @section c_threadPool_delete Deleting a Pool
+ *
+ * @c le_threadPool_Delete() waits for all the jobs already submitted to run, then stops the
+ * workers and frees the pool.  Completion functions still queued to an event loop are called
+ * as usual.  It must not be called from one of the pool's own workers.
+ *
+ * @note CPU affinity is only supported on Linux.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file le_threadPool.h
+ *
+ * Legato @ref c_threadPool include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_THREADPOOL_INCLUDE_GUARD
+#define LEGATO_THREADPOOL_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_threadPool* le_threadPool_Ref_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for job functions, run by a worker of the pool.
+ *
+ * @return The job's result, passed to the completion function.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void* (*le_threadPool_JobFunc_t)
+(
+    void* contextPtr    ///< [IN] The context pointer given to le_threadPool_Submit().
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for completion functions, called by the thread that submitted the job.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_threadPool_CompletionFunc_t)
+(
+    void* resultPtr,    ///< [IN] The value returned by the job function.
+    void* contextPtr    ///< [IN] The context pointer given to le_threadPool_Submit().
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a thread pool.  Its workers don't run until le_threadPool_Start() is called.
+ *
+ * @return A reference to the pool.
+ *
+ * @note Terminates the process on failure, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_threadPool_Ref_t le_threadPool_Create
+(
+    const char* nameStr,    ///< [IN] Name of the pool (its workers are named after it).
+    size_t      workerCount ///< [IN] Number of workers, or 0 for one per online CPU.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pin a worker of a pool to a set of CPUs.  Must be called before le_threadPool_Start().
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_OUT_OF_RANGE if there is no such worker, or the mask is empty.
+ *      - LE_NOT_PERMITTED if the pool has already been started.
+ *      - LE_UNSUPPORTED if CPU affinity is not supported on this platform.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_threadPool_SetCpuAffinity
+(
+    le_threadPool_Ref_t poolRef,        ///< [IN] The pool.
+    size_t              workerIndex,    ///< [IN] Index of the worker, from 0.
+    uint32_t            cpuMask         ///< [IN] CPUs the worker may run on (bit n = CPU n).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the workers of a thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Start
+(
+    le_threadPool_Ref_t poolRef     ///< [IN] The pool.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Submit a job to a thread pool.
+ *
+ * Jobs can be submitted before the pool is started; they run once it is.
+ *
+ * @note Terminates the process if no memory is available for the job, so there is no error to
+ *       check.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Submit
+(
+    le_threadPool_Ref_t             poolRef,        ///< [IN] The pool.
+    le_threadPool_JobFunc_t         jobFunc,        ///< [IN] Function to run.
+    void*                           contextPtr,     ///< [IN] Pointer to pass to it.
+    le_threadPool_CompletionFunc_t  completionFunc  ///< [IN] Function to call in this thread
+                                                    ///<      when the job is done, or NULL.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a thread pool.  Waits for all of the submitted jobs to run, then stops the workers.
+ *
+ * @warning Must not be called from a worker of the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Delete
+(
+    le_threadPool_Ref_t poolRef     ///< [IN] The pool.
+);
+
+#endif /* LEGATO_THREADPOOL_INCLUDE_GUARD */
@@ -21,6 +21,7 @@
  *  - le_timer_SetHandler()
  *  - le_timer_SetInterval() (or le_timer_SetMsInterval())
  *  - le_timer_SetRepeat()
+ *  - le_timer_SetSlack() (or le_timer_SetMsSlack())
  *  - le_timer_SetContextPtr()
  *
  * The following attributes of the timer can be retrieved:
@@ -67,6 +68,14 @@
  * In addition, a suspended system will also wake up by default if the timer expires. If this behaviour
  * is not desired, user can disable the wake up by passing false into le_timer_SetWakeup().
  *
+ * To reduce the number of times the system is woken up, a timer can be given some slack using
+ * le_timer_SetSlack() or le_timer_SetMsSlack().  A timer with slack may expire up to that amount
+ * of time late, so that it can expire together with other timers of the same thread, rather than
+ * each timer causing a separate wakeup.  A timer never expires before its interval has elapsed,
+ * and never later than its interval plus its slack (in addition to any event loop latency), so
+ * timers that must wake up a suspended system still do so on time.  Repeating timers with slack do
+ * not drift.
+ *
  * The number of times that a timer has expired can be retrieved by le_timer_GetExpiryCount(). This
  * count is independent of whether there is an expiry handler for the timer.
  *
@@ -83,6 +92,11 @@
  * dropped expiries, the combined execution time of all handlers called from the event loop should
  *  ideally be less than the timer period.
  *
+ * A timer whose expiry handler must not wait behind the rest of the thread's work can be given a
+ * high priority with le_timer_SetPriority() (see @ref c_event_priorities).  The timers of a thread
+ * that are due at the same time are all handled together, so they are handled ahead of the
+ * thread's other work if the first of them has a high priority.
+ *
  * See @ref c_eventLoop for details on running the event loop of a thread.
  *
  * @section le_timer_suspend Suspend Support
@@ -110,6 +124,8 @@
  *     - le_timer_GetTimeRemaining()
  *     - le_timer_GetMsTimeRemaining()
  *     - le_timer_SetWakeup()
+ *     - le_timer_SetSlack()
+ *     - le_timer_SetMsSlack()
  *
  * @section timer_troubleshooting Troubleshooting
  *
@@ -362,6 +378,52 @@ le_result_t le_timer_SetWakeup
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the amount of time by which the timer's expiry may be delayed.
+ *
+ * This allows the timer to be batched with the other timers of the same thread, so that they all
+ * expire together, reducing the number of wakeups. The timer will never expire before its interval
+ * has elapsed, nor later than its interval plus its slack (subject to event loop latency).
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BUSY if the timer is currently running
+ *
+ * @note
+ *      The default slack is zero.
+ *      If an invalid timer object is given, the process exits.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_timer_SetSlack
+(
+    le_timer_Ref_t timerRef,     ///< [IN] Set slack for this timer object.
+    le_clk_Time_t slack          ///< [IN] Maximum amount of time by which expiry may be delayed.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the amount of time by which the timer's expiry may be delayed, using milliseconds.
+ *
+ * See le_timer_SetSlack() for details.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BUSY if the timer is currently running
+ *
+ * @note
+ *      If an invalid timer object is given, the process exits.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_timer_SetMsSlack
+(
+    le_timer_Ref_t timerRef,     ///< [IN] Set slack for this timer object.
+    uint32_t slack               ///< [IN] Maximum amount of time by which expiry may be delayed
+                                 ///       (ms).
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set context pointer for the timer.
@@ -383,6 +445,26 @@ le_result_t le_timer_SetContextPtr
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the priority with which the timer's expiry is dispatched by the event loop (see
+ * @ref c_event_priorities).  The default is LE_EVENT_PRIORITY_NORMAL.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BUSY if the timer is currently running
+ *
+ * @note
+ *      If an invalid timer object is given, the process exits.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_timer_SetPriority
+(
+    le_timer_Ref_t timerRef,        ///< [IN] Set priority for this timer object
+    le_event_Priority_t priority    ///< [IN] Priority of the expiry handler.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get context pointer for the timer.
@@ -22,6 +22,7 @@
  * | -----------------------------|-----------------------------| -------------------------| --------------------------------------------------------------------------------------------------------------------------|
  * | @subpage c_atomic            | @ref le_atomic.h            | @c le_atomic.h           | Provides atomic operations                                                                                                |
  * | @subpage c_args              | @ref le_args.h              | @c le_args.h             | Provides the ability to add arguments from the command line                                                               |
+ * | @subpage c_arena             | @ref le_arena.h             | @c le_arena.h            | Provides bump-pointer allocation of request-scoped data from chunks of a memory pool                                      |
  * | @subpage c_atomFile          | @ref le_atomFile.h          | @c le_atomFile.h         | Provides atomic file access mechanism that can be used to perform file operation (specially file write) in atomic fashion |
  * | @subpage c_basics            | @ref le_basics.h            | @c le_basics.h           | Provides error codes, portable integer types, and helpful macros that make things easier to use                           |
  * | @subpage c_clock             | @ref le_clock.h             | @c le_clock.h            | Gets/sets date and/or time values, and performs conversions between these values.                                         |
@@ -30,6 +31,8 @@
  * | @subpage c_doublyLinkedList  | @ref le_doublyLinkedList.h  | @c le_doublyLinkedList.h | Provides a data structure that consists of data elements with links to the next node and previous nodes                   |
  * | @subpage c_eventLoop         | @ref le_eventLoop.h         | @c le_eventLoop.h        | Provides event loop functions to support the event-driven programming model                                               |
  * | @subpage c_fdMonitor         | @ref le_fdMonitor.h         | @c le_fdMonitor.h        | Provides monitoring of file descriptors, reporting, and related events                                                    |
+ * | @subpage c_fiber             | @ref le_fiber.h             | @c le_fiber.h            | Provides fibers, functions that can wait for IPC, file descriptors or timers without blocking the event loop              |
+ * | @subpage c_flatmap           | @ref le_flatmap.h           | @c le_flatmap.h          | Provides an open-addressing hashmap with entries stored inline                                                            |
  * | @subpage c_flock             | @ref le_fileLock.h          | @c le_fileLock.h         | Provides file locking, a form of IPC used to synchronize multiple processes' access to common files                       |
  * | @subpage c_fs                | @ref le_fs.h                | @c le_fs.h               | Provides a way to access the file system across different platforms                                                       |
  * | @subpage c_hashmap           | @ref le_hashmap.h           | @c le_hashmap.h          | Provides creating, iterating and tracing functions for a hashmap                                                          |
@@ -38,6 +41,7 @@
  * | @subpage c_logging           | @ref le_log.h               | @c le_log.h              | Provides a toolkit allowing code to be instrumented with error, warning, informational, and debugging messages            |
  * | @subpage c_memory            | @ref le_mem.h               | @c le_mem.h              | Provides functions to create, allocate and release data from a memory pool                                                |
  * | @subpage c_messaging         | @ref le_messaging.h         | @c le_messaging.h        | Provides support to low level messaging within Legato                                                                     |
+ * | @subpage c_metrics           | @ref le_metrics.h           | @c le_metrics.h          | Provides counters, gauges and histograms that can be updated from any thread without locking                              |
  * | @subpage c_mutex             | @ref le_mutex.h             | @c le_mutex.h            | Provides standard mutex functionality with added diagnostics capabilities                                                 |
  * | @subpage c_pack              | @ref le_pack.h              | @c le_pack.h             | Provides low-level pack/unpack functions to support the higher level IPC messaging system                                 |
  * | @subpage c_path              | @ref le_path.h              | @c le_path.h             | Provides support for UTF-8 null-terminated strings and multi-character separators                                         |
@@ -49,6 +53,7 @@
  * | @subpage c_singlyLinkedList  | @ref le_singlyLinkedList.h  | @c le_singlyLinkedList.h | Provides a data structure consisting of a group of nodes linked together linearly                                         |
  * | @subpage c_test              | @ref le_test.h              | @c le_test.h             | Provides macros that are used to simplify unit testing                                                                    |
  * | @subpage c_threading         | @ref le_thread.h            | @c le_thread.h           | Provides controls for creating, ending and joining threads                                                                |
+ * | @subpage c_threadPool        | @ref le_threadPool.h        | @c le_threadPool.h       | Provides a pool of worker threads that run short jobs, balanced by work stealing                                          |
  * | @subpage c_timer             | @ref le_timer.h             | @c le_timer.h            | Provides functions for managing and using timers                                                                          |
  * | @subpage c_tty               | @ref le_tty.h               | @c le_tty.h              | Provides routines to configure serial ports                                                                               |
  * | @subpage c_utf8              | @ref le_utf8.h              | @c le_utf8.h             | Provides safe and easy to use string handling functions for null-terminated strings with UTF-8 encoding                   |
@@ -187,6 +192,7 @@ extern "C" {
 // the dependant header should #include the one(s) it depends on.
 #include "le_log.h"
 
+#include "le_aio.h"
 #include "le_args.h"
 #include "le_atomFile.h"
 #include "le_atomic.h"
@@ -203,10 +209,14 @@ extern "C" {
 #include "le_fileLock.h"
 #include "le_fs.h"
 #include "le_hashmap.h"
+#include "le_flatmap.h"
 #include "le_hex.h"
 #include "le_json.h"
 #include "le_mem.h"
+#include "le_arena.h"
 #include "le_messaging.h"
+#include "le_metrics.h"
+#include "le_fiber.h"
 #include "le_mutex.h"
 #include "le_pack.h"
 #include "le_path.h"
@@ -220,6 +230,7 @@ extern "C" {
 #include "le_singlyLinkedList.h"
 #include "le_test.h"
 #include "le_thread.h"
+#include "le_threadPool.h"
 #include "le_timer.h"
 #include "le_tty.h"
 #include "le_utf8.h"
@@ -8,6 +8,7 @@
 package io.legato;
 
 import java.io.FileDescriptor;
+import java.nio.ByteBuffer;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -91,6 +92,8 @@ class LegatoJni {
 
 	public static native void Send(long messageRef);
 
+	public static native void SendBatch(long[] messageRefs);
+
 	public static native long RequestSyncResponse(long messageRef);
 
 	public static native void Respond(long messageRef);
@@ -101,39 +104,9 @@ class LegatoJni {
 
 	public static native long GetSession(long messageRef);
 
+	public static native ByteBuffer GetPayloadBuffer(long messageRef);
+
 	public static native FileDescriptor GetMessageFd(long messageRef);
 
 	public static native void SetMessageFd(long messageRef, FileDescriptor fd);
-
-	public static native boolean GetMessageBool(long messageRef, int location);
-
-	public static native void SetMessageBool(long messageRef, int location, boolean newValue);
-
-	public static native byte GetMessageByte(long messageRef, int location);
-
-	public static native void SetMessageByte(long messageRef, int location, byte value);
-
-	public static native short GetMessageShort(long messageRef, int location);
-
-	public static native void SetMessageShort(long messageRef, int location, short value);
-
-	public static native int GetMessageInt(long messageRef, int location);
-
-	public static native void SetMessageInt(long messageRef, int location, int value);
-
-	public static native long GetMessageLong(long messageRef, int location);
-
-	public static native void SetMessageLong(long messageRef, int location, long value);
-
-	public static native double GetMessageDouble(long messageRef, int location);
-
-	public static native void SetMessageDouble(long messageRef, int location, double value);
-
-	public static native MessageBuffer.LocationValue GetMessageString(long messageRef, int location);
-
-	public static native int SetMessageString(long messageRef, int location, String value, int maxByteSize);
-
-	public static native long GetMessageLongRef(long messageRef, int location);
-
-	public static native void SetMessageLongRef(long messageRef, int location, long longRef);
 }
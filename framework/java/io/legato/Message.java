@@ -65,6 +65,25 @@ public class Message implements AutoCloseable {
 		LegatoJni.Send(messageRef);
 	}
 
+	// ----------------------------------------------------------------------------------------------
+	/**
+	 * Send a batch of messages, in order, without waiting for responses. This costs
+	 * a single native call for the whole batch, instead of one per message.
+	 *
+	 * @param messages
+	 *            The messages to send.
+	 */
+	// ----------------------------------------------------------------------------------------------
+	public static void sendAll(Message... messages) {
+		long[] refs = new long[messages.length];
+
+		for (int i = 0; i < messages.length; i++) {
+			refs[i] = messages[i].messageRef;
+		}
+
+		LegatoJni.SendBatch(refs);
+	}
+
 	// ----------------------------------------------------------------------------------------------
 	/**
 	 * Send this message out across the attached session. This will not return until
@@ -9,6 +9,9 @@ package io.legato;
 
 import java.io.FileDescriptor;
 import java.math.BigInteger;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -16,6 +19,10 @@ import java.math.BigInteger;
  *
  * The get and set methods act as a streaming operation. The buffer maintains an
  * internal pointer that is updated as values are read and written.
+ *
+ * Values are read and written directly in the message's payload memory, through
+ * a direct {@link ByteBuffer}, so that they don't each have to be passed through
+ * JNI. A buffer must not be used after its message has been sent or released.
  */
 // --------------------------------------------------------------------------------------------------
 public class MessageBuffer implements AutoCloseable {
@@ -25,43 +32,15 @@ public class MessageBuffer implements AutoCloseable {
 	private Message hostMessage;
 
 	/**
-	 * The current buffer insertion location. Reads and writes start from and update
-	 * this location.
+	 * The message's payload memory, in the native byte order.
 	 */
-	private int location;
+	private ByteBuffer payload;
 
-	// ----------------------------------------------------------------------------------------------
 	/**
-	 * Package internal class used to keep track of the amount of bytes variable
-	 * length data structures require when being written into the data buffer.
+	 * The current buffer insertion location. Reads and writes start from and update
+	 * this location.
 	 */
-	// ----------------------------------------------------------------------------------------------
-	class LocationValue {
-		/**
-		 * The message object that owns this buffer.
-		 */
-		public final int bytesUsed;
-
-		/**
-		 * The message object that owns this buffer.
-		 */
-		public final Object value;
-
-		// ------------------------------------------------------------------------------------------
-		/**
-		 * Construct a new location value.
-		 *
-		 * @param newBytesUsed
-		 *            The number of bytes needed to store the object.
-		 * @param newValue
-		 *            The object itself.
-		 */
-		// ------------------------------------------------------------------------------------------
-		LocationValue(int newBytesUsed, Object newValue) {
-			bytesUsed = newBytesUsed;
-			value = newValue;
-		}
-	}
+	private int location;
 
 	// ----------------------------------------------------------------------------------------------
 	/**
@@ -74,6 +53,7 @@ public class MessageBuffer implements AutoCloseable {
 	// ----------------------------------------------------------------------------------------------
 	MessageBuffer(Message message) {
 		hostMessage = message;
+		payload = LegatoJni.GetPayloadBuffer(message.getRef()).order(ByteOrder.nativeOrder());
 		location = 0;
 	}
 
@@ -85,6 +65,7 @@ public class MessageBuffer implements AutoCloseable {
 	@Override
 	public void close() {
 		hostMessage = null;
+		payload = null;
 		location = 0;
 	}
 
@@ -105,7 +86,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public boolean readBool() {
-		boolean result = LegatoJni.GetMessageBool(hostMessage.getRef(), location);
+		boolean result = payload.get(location) != 0;
 		location += 1;
 
 		return result;
@@ -120,7 +101,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public void writeBool(boolean newValue) {
-		LegatoJni.SetMessageBool(hostMessage.getRef(), location, newValue);
+		payload.put(location, (byte) (newValue ? 1 : 0));
 		location += 1;
 	}
 
@@ -155,7 +136,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public byte readByte() {
-		byte result = LegatoJni.GetMessageByte(hostMessage.getRef(), location);
+		byte result = payload.get(location);
 		location += 1;
 
 		return result;
@@ -170,7 +151,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public void writeByte(byte newValue) {
-		LegatoJni.SetMessageByte(hostMessage.getRef(), location, newValue);
+		payload.put(location, newValue);
 		location += 1;
 	}
 
@@ -182,7 +163,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public short readShort() {
-		short result = LegatoJni.GetMessageShort(hostMessage.getRef(), location);
+		short result = payload.getShort(location);
 		location += 2;
 
 		return result;
@@ -197,7 +178,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public void writeShort(Short newValue) {
-		LegatoJni.SetMessageShort(hostMessage.getRef(), location, newValue);
+		payload.putShort(location, newValue);
 		location += 2;
 	}
 
@@ -209,7 +190,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public int readInt() {
-		int result = LegatoJni.GetMessageInt(hostMessage.getRef(), location);
+		int result = payload.getInt(location);
 		location += 4;
 
 		return result;
@@ -224,7 +205,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public void writeInt(int newValue) {
-		LegatoJni.SetMessageInt(hostMessage.getRef(), location, newValue);
+		payload.putInt(location, newValue);
 		location += 4;
 	}
 
@@ -236,7 +217,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public long readLong() {
-		long result = LegatoJni.GetMessageLong(hostMessage.getRef(), location);
+		long result = payload.getLong(location);
 		location += 8;
 
 		return result;
@@ -251,7 +232,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public void writeLong(long newValue) {
-		LegatoJni.SetMessageLong(hostMessage.getRef(), location, newValue);
+		payload.putLong(location, newValue);
 		location += 8;
 	}
 
@@ -263,7 +244,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public double readDouble() {
-		double result = LegatoJni.GetMessageDouble(hostMessage.getRef(), location);
+		double result = payload.getDouble(location);
 		location += 8;
 
 		return result;
@@ -278,7 +259,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public void writeDouble(double newValue) {
-		LegatoJni.SetMessageDouble(hostMessage.getRef(), location, newValue);
+		payload.putDouble(location, newValue);
 		location += 8;
 	}
 
@@ -291,10 +272,14 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public String readString() {
-		LocationValue result = LegatoJni.GetMessageString(hostMessage.getRef(), location);
+		int size = payload.getInt(location);
+		byte[] bytes = new byte[size];
 
-		location += result.bytesUsed;
-		return (String) result.value;
+		payload.position(location + 4);
+		payload.get(bytes);
+
+		location += 4 + size;
+		return new String(bytes, StandardCharsets.UTF_8);
 	}
 
 	// ----------------------------------------------------------------------------------------------
@@ -306,7 +291,13 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public void writeString(String strValue, int maxSize) {
-		location += LegatoJni.SetMessageString(hostMessage.getRef(), location, strValue, maxSize);
+		byte[] bytes = strValue.getBytes(StandardCharsets.UTF_8);
+
+		payload.putInt(location, bytes.length);
+		payload.position(location + 4);
+		payload.put(bytes);
+
+		location += 4 + bytes.length;
 	}
 
 	// ----------------------------------------------------------------------------------------------
@@ -317,7 +308,7 @@ public class MessageBuffer implements AutoCloseable {
 	 */
 	// ----------------------------------------------------------------------------------------------
 	public long readLongRef() {
-		long result = Integer.toUnsignedLong(LegatoJni.GetMessageInt(hostMessage.getRef(), location));
+		long result = Integer.toUnsignedLong(payload.getInt(location));
 		location += 4;
 
 		return result;
@@ -336,7 +327,7 @@ public class MessageBuffer implements AutoCloseable {
 			throw new IllegalArgumentException("Illegal reference");
 		}
 
-		LegatoJni.SetMessageInt(hostMessage.getRef(), location, (int) longRef);
+		payload.putInt(location, (int) longRef);
 		location += 4;
 	}
 
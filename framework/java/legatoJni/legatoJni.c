@@ -18,6 +18,23 @@
 static JavaVM* JvmPtr;
 
 
+/// Java classes, methods and fields used by the shim.  These are looked up once by
+/// LegatoJni.Init(), instead of every time a message or event crosses into Java.  The classes are
+/// held through global references so that they, and the IDs found in them, stay valid.
+static jclass LogHandleClassPtr;
+static jmethodID LogHandleConstructorId;
+static jclass SessionClassPtr;
+static jmethodID SessionConstructorId;
+static jclass MessageClassPtr;
+static jmethodID MessageConstructorId;
+static jclass FileDescriptorClassPtr;
+static jmethodID FileDescriptorConstructorId;
+static jfieldID FileDescriptorFdId;
+static jmethodID ComponentInitId;
+static jmethodID SessionEventHandleId;
+static jmethodID MessageEventHandleId;
+
+
 
 
 void _HexDump
@@ -56,43 +73,52 @@ void _HexDump
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Construct a Java object to hold onto the active connection to the logging system.
+ *  Look up a Java class and keep a global reference to it, so that it can be used from any thread
+ *  for as long as the library is loaded.
  *
- *  @return: A new instance of a log handle object.
+ *  @return The class if found, NULL with an exception raised if not.
  */
 //--------------------------------------------------------------------------------------------------
-static jobject NewLogHandle
+static jclass FindGlobalClass
 (
-    JNIEnv* envPtr,                    ///< [IN] The Java environment to work out of.
-    le_log_SessionRef_t logSession,    ///< [IN] The Legato log session to report on.
-    le_log_Level_t* logLevelFilterPtr  ///< [IN] THe current filter level for the logs.
+    JNIEnv* envPtr,         ///< [IN] The Java environment to work out of.
+    const char* className   ///< [IN] The name of the class to look up.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    jclass classPtr = (*envPtr)->FindClass(envPtr, "io/legato/LogHandler$LogHandle");
-
-    if (classPtr == NULL)
+    jclass localClassPtr = (*envPtr)->FindClass(envPtr, className);
+    if (localClassPtr == NULL)
     {
-        (*envPtr)->ExceptionDescribe(envPtr);
-        (*envPtr)->ExceptionClear(envPtr);
         return NULL;
     }
 
-    jmethodID constructorPtr = (*envPtr)->GetMethodID(envPtr,
-                                                      classPtr,
-                                                      "<init>",
-                                                      "(Lio/legato/LogHandler;JJ)V");
+    jclass classPtr = (*envPtr)->NewGlobalRef(envPtr, localClassPtr);
+    (*envPtr)->DeleteLocalRef(envPtr, localClassPtr);
+
+    return classPtr;
+}
+
+
 
-    if (constructorPtr == NULL)
-    {
-        (*envPtr)->ExceptionDescribe(envPtr);
-        (*envPtr)->ExceptionClear(envPtr);
-        return NULL;
-    }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Construct a Java object to hold onto the active connection to the logging system.
+ *
+ *  @return: A new instance of a log handle object.
+ */
+//--------------------------------------------------------------------------------------------------
+static jobject NewLogHandle
+(
+    JNIEnv* envPtr,                    ///< [IN] The Java environment to work out of.
+    le_log_SessionRef_t logSession,    ///< [IN] The Legato log session to report on.
+    le_log_Level_t* logLevelFilterPtr  ///< [IN] THe current filter level for the logs.
+)
+//--------------------------------------------------------------------------------------------------
+{
     return (*envPtr)->NewObject(envPtr,
-                                classPtr,
-                                constructorPtr,
+                                LogHandleClassPtr,
+                                LogHandleConstructorId,
                                 NULL,
                                 (jlong)(intptr_t)logSession,
                                 (jlong)(intptr_t)logLevelFilterPtr);
@@ -103,40 +129,23 @@ static jobject NewLogHandle
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Construct a new object instance of the named Java class.  This function looks for a constructor
- *  that can take a single long parameter.  If this function fails then  an exception will be raised
- *  in the Java VM on exit from the JNI code.
+ *  Construct a new object instance of a Java class around a native handle, using a constructor
+ *  that takes a single long parameter.  If this function fails then an exception will be raised in
+ *  the Java VM on exit from the JNI code.
  *
  *  @return A new pointer to a Java object if successful, NULL if the construction fails.
  */
 //--------------------------------------------------------------------------------------------------
 static jobject ConstructObjectFromHandle
 (
-    JNIEnv* envPtr,         ///< [IN] The Java environment to work out of.
-    const char* className,  ///< [IN] The name of the class to construct an object from.
-    jlong ref               ///< [IN] The "native" object handle to construct the class around.
+    JNIEnv* envPtr,             ///< [IN] The Java environment to work out of.
+    jclass classPtr,            ///< [IN] The class to construct an object from.
+    jmethodID constructorId,    ///< [IN] The class' constructor that takes a long.
+    jlong ref                   ///< [IN] The "native" object handle to construct the class around.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // First, try to find the named class.
-    jclass classPtr = (*envPtr)->FindClass(envPtr, className);
-    if (classPtr == NULL)
-    {
-        // An exception will have been thrown now.
-        return NULL;
-    }
-
-    // Now try to find the constructor.  This will fail if the class in question does not have one
-    // that matches our requirements.
-    jmethodID constructorPtr = (*envPtr)->GetMethodID(envPtr, classPtr, "<init>", "(J)V");
-    if (constructorPtr == NULL)
-    {
-        // An exception will have been thrown now.
-        return NULL;
-    }
-
-    // Finally, create and return the new object.
-    return (*envPtr)->NewObject(envPtr, classPtr, constructorPtr, ref);
+    return (*envPtr)->NewObject(envPtr, classPtr, constructorId, ref);
 }
 
 
@@ -156,21 +165,7 @@ static jobject CreateFileDescriptor
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Find the java class.
-    jclass descriptorClassPtr = (*envPtr)->FindClass(envPtr, "java/io/FileDescriptor");
-    if (descriptorClassPtr == NULL)
-    {
-        return NULL;
-    }
-
-    // Look for and invoke the constructor that can take a descriptor.
-    jmethodID constructorPtr = (*envPtr)->GetMethodID(envPtr, descriptorClassPtr, "<init>", "(I)V");
-    if (constructorPtr == NULL)
-    {
-        return NULL;
-    }
-
-    return (*envPtr)->NewObject(envPtr, descriptorClassPtr, constructorPtr, fd);
+    return (*envPtr)->NewObject(envPtr, FileDescriptorClassPtr, FileDescriptorConstructorId, fd);
 }
 
 
@@ -190,17 +185,7 @@ static int ExtractFd
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Get the class for the descriptor and lookup the fd field.  Once that's done, read the field
-    // and return the value to the caller.
-    jclass descriptorClassPtr = (*envPtr)->GetObjectClass(envPtr, fileDescriptorPtr);
-
-    jfieldID fdFieldPtr = (*envPtr)->GetFieldID(envPtr, descriptorClassPtr, "fd", "I");
-    if (fdFieldPtr == NULL)
-    {
-        return -1;
-    }
-
-    return (*envPtr)->GetIntField(envPtr, fileDescriptorPtr, fdFieldPtr);
+    return (*envPtr)->GetIntField(envPtr, fileDescriptorPtr, FileDescriptorFdId);
 }
 
 
@@ -208,38 +193,24 @@ static int ExtractFd
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Function used on event callback objects.  This will take the given Java object and lookup it's
- *  "handle" method.  Once that's done, it'll take the given object parameter and pass it along to
- *  the Java method on the object.
+ *  Function used on event callback objects.  This will take the given Java object and call it's
+ *  "handle" method, passing along the given object parameter.
  */
 //--------------------------------------------------------------------------------------------------
 static void CallHandleMethod
 (
-    JNIEnv* envPtr,               ///< [IN] The Java environment to work out of.
-    jobject objectPtr,            ///< [IN] The object we're calling a method on.
-    const char* methodSignature,  ///< [IN] Signature of the method we're about to lookup.
-    jobject parameterPtr          ///< [IN] The parameter we're passing to the object.
+    JNIEnv* envPtr,         ///< [IN] The Java environment to work out of.
+    jobject objectPtr,      ///< [IN] The object we're calling a method on.
+    jmethodID handleId,     ///< [IN] The handle method of the event interface the object implements.
+    jobject parameterPtr    ///< [IN] The parameter we're passing to the object.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    jclass eventClass = (*envPtr)->GetObjectClass(envPtr, objectPtr);
-    if (eventClass == NULL)
-    {
-        (*envPtr)->ExceptionDescribe(envPtr);
-        return;
-    }
+    (*envPtr)->CallVoidMethod(envPtr, objectPtr, handleId, parameterPtr);
 
-    jmethodID handerIdPtr = (*envPtr)->GetMethodID(envPtr,
-                                                   eventClass,
-                                                   "handle",
-                                                   methodSignature);
-    if (handerIdPtr == NULL)
-    {
-        (*envPtr)->ExceptionDescribe(envPtr);
-        return;
-    }
-
-    (*envPtr)->CallVoidMethod(envPtr, objectPtr, handerIdPtr, parameterPtr);
+    // The local reference to the parameter would otherwise live until the thread next returns to
+    // Java, which for the event loop thread is never.
+    (*envPtr)->DeleteLocalRef(envPtr, parameterPtr);
 }
 
 
@@ -265,7 +236,8 @@ static void SessionEventHandler
 
     // Now, construct a session object from the reference.
     jobject sessionPtr = ConstructObjectFromHandle(envPtr,
-                                                   "io/legato/Session",
+                                                   SessionClassPtr,
+                                                   SessionConstructorId,
                                                    (jlong)(intptr_t)sessionRef);
     if (sessionPtr == NULL)
     {
@@ -275,7 +247,7 @@ static void SessionEventHandler
 
     // Finally pass the new session object to the handler object's handle method.
     jobject handlerObjPtr = (jobject)contextPtr;
-    CallHandleMethod(envPtr, handlerObjPtr, "(Ljava/lang/Object;)V", sessionPtr);
+    CallHandleMethod(envPtr, handlerObjPtr, SessionEventHandleId, sessionPtr);
 }
 
 
@@ -301,7 +273,8 @@ static void SessionReceiveHandler
 
     // Construct a Java message object wrapper for the handle we received.
     jobject messagePtr = ConstructObjectFromHandle(envPtr,
-                                                   "io/legato/Message",
+                                                   MessageClassPtr,
+                                                   MessageConstructorId,
                                                    (jlong)(intptr_t)msgRef);
     if (messagePtr == NULL)
     {
@@ -311,7 +284,7 @@ static void SessionReceiveHandler
 
     // Now call the handle method with this message object.
     jobject handlerObjPtr = (jobject)contextPtr;
-    CallHandleMethod(envPtr, handlerObjPtr, "(Lio/legato/Message;)V", messagePtr);
+    CallHandleMethod(envPtr, handlerObjPtr, MessageEventHandleId, messagePtr);
 }
 
 
@@ -335,34 +308,8 @@ static void InternalComponentInit
     jint rs = (*JvmPtr)->AttachCurrentThread(JvmPtr, (void**)&envPtr, NULL);
     LE_ASSERT(rs == JNI_OK);
 
-    // Find the component interface.
-    jclass componentInterfacePtr = (*envPtr)->FindClass(envPtr, "io/legato/Component");
-    if (componentInterfacePtr == NULL)
-    {
-        // TODO: Log exception.
-        (*envPtr)->ExceptionDescribe(envPtr);
-        (*envPtr)->ExceptionClear(envPtr);
-        (*envPtr)->DeleteGlobalRef(envPtr, componentPtr);
-        return;
-    }
-
-    // Find the init method on the component interface.
-    jmethodID initMethodPtr = (*envPtr)->GetMethodID(envPtr,
-                                                     componentInterfacePtr,
-                                                     "componentInit",
-                                                     "()V");
-
-    if (initMethodPtr == NULL)
-    {
-        // TODO: Log exception.
-        (*envPtr)->ExceptionDescribe(envPtr);
-        (*envPtr)->ExceptionClear(envPtr);
-        (*envPtr)->DeleteGlobalRef(envPtr, componentPtr);
-        return;
-    }
-
-    // Finally call the init method, and free our reference to the object.
-    (*envPtr)->CallVoidMethod(envPtr, componentPtr, initMethodPtr);
+    // Call the init method, and free our reference to the object.
+    (*envPtr)->CallVoidMethod(envPtr, componentPtr, ComponentInitId);
 
     if ((*envPtr)->ExceptionOccurred(envPtr) != NULL)
     {
@@ -376,49 +323,6 @@ static void InternalComponentInit
 
 
 
-//--------------------------------------------------------------------------------------------------
-/**
- *  Construct a location value for returning a value and a size, (in bytes,) of that value.
- */
-//--------------------------------------------------------------------------------------------------
-static jobject NewLocationValue
-(
-    JNIEnv* envPtr,     ///< [IN] The Java environment to work out of.
-    jobject parentPtr,  ///< [IN] Location value is a nested class of MessageBuffer, so it's
-                        ///<      constructor can take a pointer to that parent object.
-    jint byteSize,      ///< [IN] The size in bytes of the value in question.
-    jstring valuePtr    ///< [IN] The value itself.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    // Look up the class info, and find it's constructor.
-    jclass classPtr = (*envPtr)->FindClass(envPtr, "io/legato/MessageBuffer$LocationValue");
-    if (classPtr == NULL)
-    {
-        (*envPtr)->ExceptionDescribe(envPtr);
-        (*envPtr)->ExceptionClear(envPtr);
-        return NULL;
-    }
-
-    jmethodID constructorPtr =
-                          (*envPtr)->GetMethodID(envPtr,
-                                                 classPtr,
-                                                 "<init>",
-                                                 "(Lio/legato/MessageBuffer;ILjava/lang/Object;)V");
-    if (constructorPtr == NULL)
-    {
-        (*envPtr)->ExceptionDescribe(envPtr);
-        (*envPtr)->ExceptionClear(envPtr);
-        return NULL;
-    }
-
-    // Now construct the new object, and call the constructor we picked out.
-    return (*envPtr)->NewObject(envPtr, classPtr, constructorPtr, parentPtr, byteSize, valuePtr);
-}
-
-
-
-
 //--------------------------------------------------------------------------------------------------
 /**
  *  Init the C layer of the of the Legato interface.
@@ -436,10 +340,62 @@ JNIEXPORT void JNICALL Java_io_legato_LegatoJni_Init
     jint rs = (*envPtr)->GetJavaVM(envPtr, &JvmPtr);
     LE_ASSERT(rs == JNI_OK);
 
-    // TODO: Cache required Java method IDs so that the various functions that need to call Java
-    //       methods can be faster.
+    // Look up everything the callbacks and accessors need to reach in Java.  If anything is
+    // missing, the pending exception is thrown from LegatoJni's static initializer.
+    jclass classPtr;
+
+    if (   ((LogHandleClassPtr = FindGlobalClass(envPtr, "io/legato/LogHandler$LogHandle")) == NULL)
+        || ((LogHandleConstructorId = (*envPtr)->GetMethodID(envPtr,
+                                                             LogHandleClassPtr,
+                                                             "<init>",
+                                                             "(Lio/legato/LogHandler;JJ)V")) == NULL)
+        || ((SessionClassPtr = FindGlobalClass(envPtr, "io/legato/Session")) == NULL)
+        || ((SessionConstructorId = (*envPtr)->GetMethodID(envPtr,
+                                                           SessionClassPtr,
+                                                           "<init>",
+                                                           "(J)V")) == NULL)
+        || ((MessageClassPtr = FindGlobalClass(envPtr, "io/legato/Message")) == NULL)
+        || ((MessageConstructorId = (*envPtr)->GetMethodID(envPtr,
+                                                           MessageClassPtr,
+                                                           "<init>",
+                                                           "(J)V")) == NULL)
+        || ((FileDescriptorClassPtr = FindGlobalClass(envPtr, "java/io/FileDescriptor")) == NULL)
+        || ((FileDescriptorConstructorId = (*envPtr)->GetMethodID(envPtr,
+                                                                  FileDescriptorClassPtr,
+                                                                  "<init>",
+                                                                  "(I)V")) == NULL)
+        || ((FileDescriptorFdId = (*envPtr)->GetFieldID(envPtr,
+                                                        FileDescriptorClassPtr,
+                                                        "fd",
+                                                        "I")) == NULL))
+    {
+        return;
+    }
+
+    // Method IDs found through an interface or base class can be called on any object that
+    // implements it, so the classes themselves don't need to be kept.
+    if ((classPtr = (*envPtr)->FindClass(envPtr, "io/legato/Component")) == NULL)
+    {
+        return;
+    }
+    ComponentInitId = (*envPtr)->GetMethodID(envPtr, classPtr, "componentInit", "()V");
+    (*envPtr)->DeleteLocalRef(envPtr, classPtr);
+
+    if ((classPtr = (*envPtr)->FindClass(envPtr, "io/legato/SessionEvent")) == NULL)
+    {
+        return;
+    }
+    SessionEventHandleId = (*envPtr)->GetMethodID(envPtr, classPtr, "handle",
+                                                  "(Ljava/lang/Object;)V");
+    (*envPtr)->DeleteLocalRef(envPtr, classPtr);
 
-    // TODO: Convert to a JNI_OnUnload method?
+    if ((classPtr = (*envPtr)->FindClass(envPtr, "io/legato/MessageEvent")) == NULL)
+    {
+        return;
+    }
+    MessageEventHandleId = (*envPtr)->GetMethodID(envPtr, classPtr, "handle",
+                                                  "(Lio/legato/Message;)V");
+    (*envPtr)->DeleteLocalRef(envPtr, classPtr);
 }
 
 
@@ -1334,12 +1290,16 @@ JNIEXPORT jlong JNICALL Java_io_legato_LegatoJni_GetSession
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Fetches a received file descriptor from the message.
+ * Gets a direct ByteBuffer over the message's payload memory, so that Java can read and write the
+ * payload in place instead of crossing into native code for every value.
  *
- * @return A Java FileDescritpor object.
+ * @warning The buffer is only valid for as long as the message is.
+ *
+ * @return A ByteBuffer of the maximum payload size of the message, or NULL with an exception raised
+ *         if the JVM doesn't support direct buffer access.
  */
 //--------------------------------------------------------------------------------------------------
-JNIEXPORT jobject JNICALL Java_io_legato_LegatoJni_GetMessageFd
+JNIEXPORT jobject JNICALL Java_io_legato_LegatoJni_GetPayloadBuffer
 (
     JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
     jclass callClassPtr,  ///< [IN] The java class that called this function.
@@ -1347,9 +1307,11 @@ JNIEXPORT jobject JNICALL Java_io_legato_LegatoJni_GetMessageFd
 )
 //--------------------------------------------------------------------------------------------------
 {
-    int fd = le_msg_GetFd((le_msg_MessageRef_t)(intptr_t)messageRef);
+    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
 
-    return CreateFileDescriptor(envPtr, fd);
+    return (*envPtr)->NewDirectByteBuffer(envPtr,
+                                          le_msg_GetPayloadPtr(nRef),
+                                          (jlong)le_msg_GetMaxPayloadSize(nRef));
 }
 
 
@@ -1357,385 +1319,40 @@ JNIEXPORT jobject JNICALL Java_io_legato_LegatoJni_GetMessageFd
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Sets the file descriptor to be sent with this message.
- *
- * This file descriptor will be closed when the message is sent (or when it is deleted without
- * being sent).
- *
- * At most one file descriptor is allowed to be sent per message.
+ * Sends a batch of messages, in order, with a single call from Java.  No responses expected.
  */
 //--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageFd
+JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SendBatch
 (
     JNIEnv* envPtr,         ///< [IN] The Java environment to work out of.
     jclass callClassPtr,    ///< [IN] The java class that called this function.
-    jlong messageRef,       ///< [IN] Reference to the message.
-    jobject fileDescriptor  ///< [IN] A file descriptor object.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    int fd = ExtractFd(envPtr, fileDescriptor);
-
-    le_msg_SetFd((le_msg_MessageRef_t)(intptr_t)messageRef, fd);
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read a boolean value from the message.
- *
- *  @return A boolean read from the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jboolean JNICALL Java_io_legato_LegatoJni_GetMessageBool
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
+    jlongArray messageRefs  ///< [IN] References to the messages.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    bool test = *((bool*)&msgBufferPtr[bufferPosition]);
+    // Copy the references out a chunk at a time, rather than pinning the array, as sending can
+    // block.
+    jlong refs[32];
+    jsize count = (*envPtr)->GetArrayLength(envPtr, messageRefs);
+    jsize i;
 
-    if (test)
+    for (i = 0; i < count; i += NUM_ARRAY_MEMBERS(refs))
     {
-        return JNI_TRUE;
-    }
-
-    return JNI_FALSE;
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Write a boolean value into the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageBool
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jboolean value        ///< [IN] The value to write.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    *((jshort*)&msgBufferPtr[bufferPosition]) = value == JNI_FALSE ? false : true;
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read a single byte from the message.
- *
- *  @return The byte read from the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jbyte JNICALL Java_io_legato_LegatoJni_GetMessageByte
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    return (jbyte)msgBufferPtr[bufferPosition];
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Write a byte into the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageByte
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jbyte value           ///< [IN] The value to write.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    msgBufferPtr[bufferPosition] = (uint8_t)value;
-}
+        jsize chunk = count - i;
+        jsize j;
 
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read a two byte short from the message.
- *
- *  @return The short value read from the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jshort JNICALL Java_io_legato_LegatoJni_GetMessageShort
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    return *((jshort*)&msgBufferPtr[bufferPosition]);
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Write a two byte short into a message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageShort
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jshort value          ///< [IN] The value to write.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    *((jshort*)&msgBufferPtr[bufferPosition]) = value;
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read a 4 byte integer from the message.
- *
- *  @return An integer read from the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jint JNICALL Java_io_legato_LegatoJni_GetMessageInt
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    return *((jint*)&msgBufferPtr[bufferPosition]);
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Write a 4 byte integer into the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageInt
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jint value            ///< [IN] The value to write.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    *((jint*)&msgBufferPtr[bufferPosition]) = value;
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read an 8 byte long from the message.
- *
- *  @return The long value read from the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jlong JNICALL Java_io_legato_LegatoJni_GetMessageLong
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    return *((jlong*)&msgBufferPtr[bufferPosition]);
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Write an 8 byte long value into a message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageLong
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jlong value           ///< [IN] The value to write.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    *((jlong*)&msgBufferPtr[bufferPosition]) = value;
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read an 8 byte floating point value from the message.
- *
- *  @return The double value read from the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jdouble JNICALL Java_io_legato_LegatoJni_GetMessageDouble
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    return *((jdouble*)&msgBufferPtr[bufferPosition]);
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Write an 8 byte double into a message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageDouble
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jdouble value         ///< [IN] The value to write.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    *((jdouble*)&msgBufferPtr[bufferPosition]) = value;
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read a string from the message.  Return a string and the number of bytes actually read.
- *
- *  @return An io.legato.MessageBuffer.LocationValue that holds the string and number of bytes read
- *          from the message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jobject JNICALL Java_io_legato_LegatoJni_GetMessageString
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The Java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    char* msgBufferPtr = (char*)le_msg_GetPayloadPtr(nRef) + bufferPosition;
-
-    uint32_t strSize;
-    const uint32_t sizeOfStrSize = sizeof(strSize);
-
-    memcpy(&strSize, msgBufferPtr, sizeOfStrSize);
-    msgBufferPtr += sizeOfStrSize;
-
-    jstring newStr;
-
-    if (strSize > 0)
-    {
-        // TODO: Check for realistic size.
-        char* charBuffer = malloc(strSize + 1);
-        if (!charBuffer)
+        if (chunk > (jsize)NUM_ARRAY_MEMBERS(refs))
         {
-           return 0;
+            chunk = NUM_ARRAY_MEMBERS(refs);
         }
 
-        memcpy(charBuffer, msgBufferPtr, strSize);
-        charBuffer[strSize] = 0;
+        (*envPtr)->GetLongArrayRegion(envPtr, messageRefs, i, chunk, refs);
 
-        newStr = (*envPtr)->NewStringUTF(envPtr, charBuffer);
-
-        free(charBuffer);
-    }
-    else
-    {
-        newStr = (*envPtr)->NewStringUTF(envPtr, "");
+        for (j = 0; j < chunk; j++)
+        {
+            le_msg_Send((le_msg_MessageRef_t)(intptr_t)refs[j]);
+        }
     }
-
-    return NewLocationValue(envPtr,
-                            NULL,
-                            strSize + sizeOfStrSize,
-                            newStr);
 }
 
 
@@ -1743,69 +1360,22 @@ JNIEXPORT jobject JNICALL Java_io_legato_LegatoJni_GetMessageString
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Write a string value into a message.
- */
-//--------------------------------------------------------------------------------------------------
-JNIEXPORT jint JNICALL Java_io_legato_LegatoJni_SetMessageString
-(
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jstring value,        ///< [IN] The value to write.
-    jint maxByteSize      ///< [IN] The maximum string size to write to the buffer.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
-
-    const char* rawStrPtr = (*envPtr)->GetStringUTFChars(envPtr, value, NULL);
-
-    if (rawStrPtr == NULL)
-    {
-        return 0;
-    }
-
-    msgBufferPtr += bufferPosition;
-
-    uint32_t strSize = strlen(rawStrPtr);
-    const uint32_t sizeOfStrSize = sizeof(strSize);
-
-    // Always pack the string size first, and then the string itself.
-    memcpy(msgBufferPtr, &strSize, sizeOfStrSize);
-    msgBufferPtr += sizeOfStrSize;
-
-    memcpy(msgBufferPtr, rawStrPtr, strSize);
-
-    return sizeOfStrSize + strSize;
-}
-
-
-
-
-//--------------------------------------------------------------------------------------------------
-/**
- *  Read a reference value from the message.
+ * Fetches a received file descriptor from the message.
  *
- *  @note References are system dependent, (either 32 or 64 bits.)  However Java is system agnostic,
- *        so we always convert a reference into a long, but we only use the appropriate amount of
- *        bytes from the buffer.
+ * @return A Java FileDescritpor object.
  */
 //--------------------------------------------------------------------------------------------------
-JNIEXPORT jlong JNICALL Java_io_legato_LegatoJni_GetMessageLongRef
+JNIEXPORT jobject JNICALL Java_io_legato_LegatoJni_GetMessageFd
 (
     JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
     jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition   ///< [IN] Where in the message buffer to read the value from.
+    jlong messageRef      ///< [IN] Reference to the message.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
+    int fd = le_msg_GetFd((le_msg_MessageRef_t)(intptr_t)messageRef);
 
-    return *((intptr_t*)&msgBufferPtr[bufferPosition]);
+    return CreateFileDescriptor(envPtr, fd);
 }
 
 
@@ -1813,25 +1383,24 @@ JNIEXPORT jlong JNICALL Java_io_legato_LegatoJni_GetMessageLongRef
 
 //--------------------------------------------------------------------------------------------------
 /**
- *  Write a Legato reference to a message.
+ * Sets the file descriptor to be sent with this message.
+ *
+ * This file descriptor will be closed when the message is sent (or when it is deleted without
+ * being sent).
  *
- *  @note References are system dependent, (either 32 or 64 bits.)  However Java is system agnostic,
- *        so we always read a reference from a long, but we only use the appropriate amount of bytes
- *        from the buffer.
+ * At most one file descriptor is allowed to be sent per message.
  */
 //--------------------------------------------------------------------------------------------------
-JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageLongRef
+JNIEXPORT void JNICALL Java_io_legato_LegatoJni_SetMessageFd
 (
-    JNIEnv* envPtr,       ///< [IN] The Java environment to work out of.
-    jclass callClassPtr,  ///< [IN] The java class that called this function.
-    jlong messageRef,     ///< [IN] Reference to the message.
-    jint bufferPosition,  ///< [IN] Where in the message buffer to read the value from.
-    jlong value           ///< [IN] The value to write.
+    JNIEnv* envPtr,         ///< [IN] The Java environment to work out of.
+    jclass callClassPtr,    ///< [IN] The java class that called this function.
+    jlong messageRef,       ///< [IN] Reference to the message.
+    jobject fileDescriptor  ///< [IN] A file descriptor object.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_msg_MessageRef_t nRef = (le_msg_MessageRef_t)(intptr_t)messageRef;
-    uint8_t* msgBufferPtr = (uint8_t*)le_msg_GetPayloadPtr(nRef);
+    int fd = ExtractFd(envPtr, fileDescriptor);
 
-    *((intptr_t*)&msgBufferPtr[bufferPosition]) = value;
+    le_msg_SetFd((le_msg_MessageRef_t)(intptr_t)messageRef, fd);
 }
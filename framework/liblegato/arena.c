@@ -0,0 +1,358 @@
+/** @file arena.c
+ *
+ * Implementation of the @ref c_arena.
+ *
+ * An arena is a chain of chunks borrowed from a memory pool.  The arena object itself lives at
+ * the start of the first chunk, followed by free space; every other chunk starts with a link to
+ * the next one.  Blocks are carved from the free space of the newest chunk by moving a pointer
+ * forward.  Destructor records are allocated from the arena like any other block, and kept on a
+ * list, newest first.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Alignment of the blocks handed out by an arena (enough for any type).
+ */
+//--------------------------------------------------------------------------------------------------
+#define ARENA_ALIGNMENT     __alignof__(long double)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Smallest number of bytes of free space that a chunk must have after the arena object.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ARENA_MIN_FREE      (4 * ARENA_ALIGNMENT)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Bytes at the start of a chunk after the first that can't be used for blocks: the chunk header,
+ * plus the worst-case padding to align the first block (pool objects need not be aligned as
+ * strictly as arena blocks).
+ */
+//--------------------------------------------------------------------------------------------------
+#define ARENA_CHUNK_OVERHEAD    (sizeof(ArenaChunk_t) + ARENA_ALIGNMENT - 1)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header of each chunk after the first.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct ArenaChunk
+{
+    struct ArenaChunk *nextPtr;     ///< Next (older) chunk, or NULL.
+}
+ArenaChunk_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor registered with le_arena_AddDestructor().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct ArenaDestructor
+{
+    struct ArenaDestructor *nextPtr;    ///< Next (older) destructor, or NULL.
+    le_arena_Destructor_t   func;       ///< Function to call.
+    void                   *objPtr;     ///< Pointer to pass to it.
+}
+ArenaDestructor_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The arena object, at the start of the arena's first chunk.
+ */
+//--------------------------------------------------------------------------------------------------
+struct le_arena
+{
+    le_mem_PoolRef_t    poolRef;        ///< Pool the chunks come from.
+    size_t              chunkSize;      ///< Size of a chunk.
+    ArenaChunk_t       *chunksPtr;      ///< Chunks after the first, newest first.
+    ArenaDestructor_t  *destructorsPtr; ///< Registered destructors, newest first.
+    uint8_t            *firstFreePtr;   ///< Start of the free space of the first chunk.
+    uint8_t            *freePtr;        ///< Start of the free space of the newest chunk.
+    uint8_t            *endPtr;         ///< End of the newest chunk.
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Round a pointer up to the arena alignment.
+ *
+ * @return The rounded pointer.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint8_t *AlignUp
+(
+    uint8_t *ptr    ///< [IN] Pointer to round.
+)
+{
+    uintptr_t mask = (uintptr_t) ARENA_ALIGNMENT - 1;
+
+    return (uint8_t *) (((uintptr_t) ptr + mask) & ~mask);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Call and forget all of an arena's destructors, and give all of its chunks but the first back to
+ * the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Clear
+(
+    le_arena_Ref_t arenaRef     ///< [IN] The arena.
+)
+{
+    // Destructors go first, as their objects may be in any chunk.
+    while (arenaRef->destructorsPtr != NULL)
+    {
+        ArenaDestructor_t *destructorPtr = arenaRef->destructorsPtr;
+
+        arenaRef->destructorsPtr = destructorPtr->nextPtr;
+        destructorPtr->func(destructorPtr->objPtr);
+    }
+
+    while (arenaRef->chunksPtr != NULL)
+    {
+        ArenaChunk_t *chunkPtr = arenaRef->chunksPtr;
+
+        arenaRef->chunksPtr = chunkPtr->nextPtr;
+        le_mem_Release(chunkPtr);
+    }
+
+    arenaRef->freePtr = arenaRef->firstFreePtr;
+    arenaRef->endPtr = (uint8_t *) arenaRef + arenaRef->chunkSize;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a block from an arena.
+ *
+ * @return Pointer to the block, or NULL if it doesn't fit in a chunk, or (when a new chunk is
+ *         needed and force is false) the pool has no free chunk.
+ */
+//--------------------------------------------------------------------------------------------------
+static void *Alloc
+(
+    le_arena_Ref_t  arenaRef,   ///< [IN] The arena.
+    size_t          size,       ///< [IN] Size of the block.
+    bool            force       ///< [IN] true = expand the pool if it has no free chunk.
+)
+{
+    uint8_t *blockPtr = AlignUp(arenaRef->freePtr);
+
+    if ((blockPtr <= arenaRef->endPtr) && (size <= (size_t) (arenaRef->endPtr - blockPtr)))
+    {
+        arenaRef->freePtr = blockPtr + size;
+        return blockPtr;
+    }
+
+    // The block has to go in a new chunk.
+    if (size > arenaRef->chunkSize - ARENA_CHUNK_OVERHEAD)
+    {
+        return NULL;
+    }
+
+    ArenaChunk_t *chunkPtr = (force ? le_mem_ForceAlloc(arenaRef->poolRef) :
+                                      le_mem_TryAlloc(arenaRef->poolRef));
+    if (chunkPtr == NULL)
+    {
+        return NULL;
+    }
+
+    chunkPtr->nextPtr = arenaRef->chunksPtr;
+    arenaRef->chunksPtr = chunkPtr;
+
+    blockPtr = AlignUp((uint8_t *) (chunkPtr + 1));
+    arenaRef->freePtr = blockPtr + size;
+    arenaRef->endPtr = (uint8_t *) chunkPtr + arenaRef->chunkSize;
+
+    return blockPtr;
+}
+
+
+// =============================================
+//  PUBLIC API FUNCTIONS
+// =============================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a memory arena.
+ *
+ * The pool's object size is the arena's chunk size.  It must leave room for at least a few
+ * blocks after the arena's own bookkeeping.
+ *
+ * @return A reference to the arena.
+ *
+ * @note Terminates the process on failure, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Ref_t le_arena_Create
+(
+    le_mem_PoolRef_t chunkPool  ///< [IN] Pool to borrow the arena's chunks from.
+)
+{
+    size_t chunkSize = le_mem_GetObjectSize(chunkPool);
+
+    LE_ASSERT(chunkSize >= sizeof(struct le_arena) + ARENA_ALIGNMENT - 1 + ARENA_MIN_FREE);
+
+    le_arena_Ref_t arenaRef = le_mem_ForceAlloc(chunkPool);
+
+    arenaRef->poolRef = chunkPool;
+    arenaRef->chunkSize = chunkSize;
+    arenaRef->chunksPtr = NULL;
+    arenaRef->destructorsPtr = NULL;
+    arenaRef->firstFreePtr = AlignUp((uint8_t *) (arenaRef + 1));
+    arenaRef->freePtr = arenaRef->firstFreePtr;
+    arenaRef->endPtr = (uint8_t *) arenaRef + chunkSize;
+
+    return arenaRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a memory arena.  Its destructors are called, and all of its chunks are given back to
+ * the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Delete
+(
+    le_arena_Ref_t arenaRef     ///< [IN] The arena.
+)
+{
+    Clear(arenaRef);
+    le_mem_Release(arenaRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a block from an arena.
+ *
+ * @return Pointer to the block.  It is aligned for any type, and its contents are undefined.
+ *
+ * @note Terminates the process if the block is bigger than le_arena_GetMaxAllocSize(), or if no
+ *       chunk can be had from the pool, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_arena_Alloc
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] The arena.
+    size_t         size         ///< [IN] Size of the block, in bytes.
+)
+{
+    void *blockPtr = Alloc(arenaRef, size, true);
+
+    if (blockPtr == NULL)
+    {
+        LE_FATAL("Can't allocate %" PRIuS " bytes from an arena of %" PRIuS "-byte chunks.",
+                 size, arenaRef->chunkSize);
+    }
+
+    return blockPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a block from an arena, if possible.
+ *
+ * @return Pointer to the block, or NULL if the block is bigger than le_arena_GetMaxAllocSize()
+ *         or the pool has no free chunk.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_arena_TryAlloc
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] The arena.
+    size_t         size         ///< [IN] Size of the block, in bytes.
+)
+{
+    return Alloc(arenaRef, size, false);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy a null-terminated string into an arena.
+ *
+ * @return Pointer to the copy.
+ *
+ * @note Terminates the process if the string doesn't fit in a chunk, so no need to check the
+ *       return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+char* le_arena_StrDup
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] The arena.
+    const char*    srcStr       ///< [IN] String to copy.
+)
+{
+    size_t size = strlen(srcStr) + 1;
+    char *destStr = le_arena_Alloc(arenaRef, size);
+
+    memcpy(destStr, srcStr, size);
+    return destStr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Register a function to be called with a given pointer when an arena is next reset or deleted.
+ * Destructors are called most recently registered first.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_AddDestructor
+(
+    le_arena_Ref_t        arenaRef,         ///< [IN] The arena.
+    le_arena_Destructor_t destructorFunc,   ///< [IN] Function to call.
+    void*                 objPtr            ///< [IN] Pointer to pass to it.
+)
+{
+    LE_ASSERT(destructorFunc != NULL);
+
+    ArenaDestructor_t *destructorPtr = le_arena_Alloc(arenaRef, sizeof(ArenaDestructor_t));
+
+    destructorPtr->func = destructorFunc;
+    destructorPtr->objPtr = objPtr;
+    destructorPtr->nextPtr = arenaRef->destructorsPtr;
+    arenaRef->destructorsPtr = destructorPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Free all of the blocks allocated from an arena.  Its destructors are called, and all of its
+ * chunks but the first are given back to the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Reset
+(
+    le_arena_Ref_t arenaRef     ///< [IN] The arena.
+)
+{
+    Clear(arenaRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the size of the largest block that can be allocated from an arena.
+ *
+ * @return The size, in bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_arena_GetMaxAllocSize
+(
+    le_arena_Ref_t arenaRef     ///< [IN] The arena.
+)
+{
+    return arenaRef->chunkSize - ARENA_CHUNK_OVERHEAD;
+}
@@ -30,105 +30,54 @@ le_result_t le_base64_Encode
 {
     const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     const uint8_t *data = (const uint8_t *) srcPtr;
-    size_t resultIndex = 0;
+    char *resultPtr = dstPtr;
+    size_t groups = srcLen / 3 + (srcLen % 3 != 0);
     size_t x;
-    uint32_t n = 0;
-    int padCount = srcLen % 3;
-    uint8_t n0, n1, n2, n3;
-    size_t resultSize;
+    uint32_t n;
 
     if ((NULL == dstLenPtr) || (NULL == dstPtr) || (NULL == srcPtr))
     {
         return LE_BAD_PARAMETER;
     }
-    resultSize = *dstLenPtr;
 
-    /* increment over the length of the string, three characters at a time */
-    for (x = 0; x < srcLen; x += 3)
+    /* every started group of three bytes gives four characters, plus the terminating 0 */
+    if ((0 == *dstLenPtr) || (groups > (*dstLenPtr - 1) / 4))
     {
-        /* these three 8-bit (ASCII) characters become one 24-bit number */
-        n = ((uint32_t) data[x]) << 16;
-        if ((x + 1) < srcLen)
-        {
-            n += ((uint32_t)data[x + 1]) << 8;
-        }
-
-        if ((x + 2) < srcLen)
-        {
-            n += data[x + 2];
-        }
-
-        /* this 24-bit number gets separated into four 6-bit numbers */
-        n0 = (uint8_t)(n >> 18) & 63;
-        n1 = (uint8_t)(n >> 12) & 63;
-        n2 = (uint8_t)(n >> 6) & 63;
-        n3 = (uint8_t)n & 63;
-
-        /*
-         * if we have one byte available, then its encoding is spread
-         * out over two characters
-         */
-        if(resultIndex >= resultSize)
-        {
-            return LE_OVERFLOW;
-        }
-        dstPtr[resultIndex++] = base64Chars[n0];
-        if(resultIndex >= resultSize)
-        {
-            return LE_OVERFLOW;
-        }
-        dstPtr[resultIndex++] = base64Chars[n1];
+        return LE_OVERFLOW;
+    }
 
-        /*
-         * if we have only two bytes available, then their encoding is
-         * spread out over three chars
-         */
-        if ((x + 1) < srcLen)
-        {
-            if(resultIndex >= resultSize)
-            {
-                return LE_OVERFLOW;
-            }
-            dstPtr[resultIndex++] = base64Chars[n2];
-        }
+    /* full groups: three 8-bit bytes become one 24-bit number, split into four 6-bit numbers */
+    for (x = 0; (srcLen - x) >= 3; x += 3)
+    {
+        n = ((uint32_t)data[x] << 16) | ((uint32_t)data[x + 1] << 8) | data[x + 2];
 
-        /*
-         * if we have all three bytes available, then their encoding is spread
-         * out over four characters
-         */
-        if ((x + 2) < srcLen)
-        {
-            if(resultIndex >= resultSize)
-            {
-                return LE_OVERFLOW;
-            }
-            dstPtr[resultIndex++] = base64Chars[n3];
-        }
+        *resultPtr++ = base64Chars[(n >> 18) & 63];
+        *resultPtr++ = base64Chars[(n >> 12) & 63];
+        *resultPtr++ = base64Chars[(n >> 6) & 63];
+        *resultPtr++ = base64Chars[n & 63];
     }
 
     /*
-     * create and add padding that is required if we did not have a multiple of 3
-     * number of characters available
+     * one or two bytes left: their encoding is spread out over two or three characters, and
+     * padding is added to make a multiple of four characters
      */
-    if (padCount > 0)
+    if (x < srcLen)
     {
-        for (; padCount < 3; padCount++)
+        n = (uint32_t)data[x] << 16;
+        if ((x + 1) < srcLen)
         {
-            if(resultIndex >= resultSize)
-            {
-                return LE_OVERFLOW;
-            }
-            dstPtr[resultIndex++] = '=';
+            n |= (uint32_t)data[x + 1] << 8;
         }
+
+        *resultPtr++ = base64Chars[(n >> 18) & 63];
+        *resultPtr++ = base64Chars[(n >> 12) & 63];
+        *resultPtr++ = ((x + 1) < srcLen) ? base64Chars[(n >> 6) & 63] : '=';
+        *resultPtr++ = '=';
     }
-    if (resultIndex >= resultSize)
-    {
-        return LE_OVERFLOW;   /* indicate failure: buffer too small */
-    }
-    dstPtr[resultIndex] = 0;
+    *resultPtr = 0;
 
     // also counting the terminating 0
-    *dstLenPtr = resultIndex + 1;
+    *dstLenPtr = resultPtr - dstPtr + 1;
 
     return LE_OK;
 }
@@ -197,7 +146,28 @@ le_result_t le_base64_Decode
 
     while (in < end)
     {
-        unsigned char c = DecodeTable[(int)(*in++)];
+        /* fast path for a whole group of four data characters */
+        if ((iter == 0) && ((end - in) >= 4) && ((outLen - len) >= 3))
+        {
+            uint32_t c0 = DecodeTable[(unsigned char)in[0]];
+            uint32_t c1 = DecodeTable[(unsigned char)in[1]];
+            uint32_t c2 = DecodeTable[(unsigned char)in[2]];
+            uint32_t c3 = DecodeTable[(unsigned char)in[3]];
+
+            /* the special values all have bit 6 set */
+            if (((c0 | c1 | c2 | c3) & 64) == 0)
+            {
+                uint32_t group = (c0 << 18) | (c1 << 12) | (c2 << 6) | c3;
+                *(out++) = (group >> 16) & 255;
+                *(out++) = (group >> 8) & 255;
+                *(out++) = group & 255;
+                len += 3;
+                in += 4;
+                continue;
+            }
+        }
+
+        unsigned char c = DecodeTable[(unsigned char)(*in++)];
 
         switch (c)
         {
@@ -84,6 +84,41 @@ le_clk_Time_t le_clk_GetRelativeTime(void)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get relative time since some fixed but unspecified starting point, from a clock that is cheap
+ * to read but only advances every few milliseconds.
+ *
+ * @return
+ *      The relative time in seconds/microseconds
+ *
+ * @note
+ *      - The coarse relative time may not include time that the processor is suspended.
+ *      - It is a fatal error if the relative time cannot be returned
+ */
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t le_clk_GetCoarseRelativeTime(void)
+{
+    struct timespec systemTime;
+    le_clk_Time_t relativeTime;
+
+#ifdef CLOCK_MONOTONIC_COARSE
+    // The coarse clock is the kernel's last tick, which is read without a system call.
+    if (0 > clock_gettime(CLOCK_MONOTONIC_COARSE, &systemTime))
+#else
+    if (0 > clock_gettime(CLOCK_MONOTONIC, &systemTime))
+#endif
+    {
+        LE_FATAL("clock_gettime() failed. errno = %d", errno);
+    }
+
+    relativeTime.sec = systemTime.tv_sec;
+    relativeTime.usec = systemTime.tv_nsec/1000;
+
+    return relativeTime;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get absolute time since the Epoch, 1970-01-01 00:00:00 +0000 (UTC).
@@ -22,6 +22,10 @@ le_log_Level_t* LE_LOG_LEVEL_FILTER_PTR;
 
 int main(int argc, const char* argv[])
 {
+#ifdef LE_SINGLE_THREADED
+    le_thread_SetSingleThreaded();
+#endif
+
     le_arg_SetArgs((size_t)argc, argv);
 
     LE_DEBUG("== Starting Executable '%s' ==", STRINGIZE(LE_EXECUTABLE_NAME));
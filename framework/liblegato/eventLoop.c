@@ -67,6 +67,7 @@
 #include "legato.h"
 
 #include "eventLoop.h"
+#include "fa/traceMarker.h"
 #include "fdMonitor.h"
 #include "limit.h"
 #include "thread.h"
@@ -82,6 +83,9 @@
 /// than this have a separate pool created for each report types
 #define HIGH_REPORT_OBJECT_SIZE   512
 
+/// Dispatches are timed for slow handler warnings and for profiling.
+#define TIME_DISPATCHES ((LE_CONFIG_EVENT_SLOW_HANDLER_MS > 0) || LE_CONFIG_EVENT_PROFILING)
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Insert a string name variable if configured or a placeholder string if not.
@@ -217,6 +221,7 @@ typedef struct
     Event_t*                eventPtr;   ///< Ptr to the Event obj for the event that this handles.
     void*                   contextPtr; ///< The context pointer for this handler.
     void*                   safeRef;    ///< Safe Reference for this object.
+    le_event_Priority_t     priority;   ///< Priority given to the reports for this handler.
 #if LE_CONFIG_EVENT_NAMES_ENABLED
     char                    name[LIMIT_MAX_EVENT_HANDLER_NAME_BYTES];///< UTF-8 name of the handler.
 #endif
@@ -283,6 +288,7 @@ typedef struct
 {
     le_sls_Link_t           link;       ///< Used to link onto an Event Queue.
     EventReportType_t       type;       ///< Indicates what type of event report this is.
+    le_event_Priority_t     priority;   ///< Priority with which the report is dispatched.
 }
 Report_t;
 
@@ -394,6 +400,12 @@ int event_Lock
 )
 //--------------------------------------------------------------------------------------------------
 {
+    if (thread_IsSingleThreaded())
+    {
+        // No other thread to race with, or to be cancelled by
+        return PTHREAD_CANCEL_ENABLE;
+    }
+
     int oldState;
 
     int err = pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &oldState);
@@ -417,6 +429,11 @@ void event_Unlock
 )
 //--------------------------------------------------------------------------------------------------
 {
+    if (thread_IsSingleThreaded())
+    {
+        return;
+    }
+
     int junk;
 
     LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
@@ -548,34 +565,237 @@ static void DeleteHandler
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Process one event report from the calling thread's Event Queue.
+ * Check whether the calling thread has dispatched every report of its batch.
  **/
 //--------------------------------------------------------------------------------------------------
-void event_ProcessOneEventReport
+static inline bool IsBatchEmpty
 (
     event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_sls_Link_t* linkPtr;
-    Report_t* reportObjPtr;
-    Handler_t* handlerPtr;
+    return le_sls_IsEmpty(&perThreadRecPtr->highPriorityQueue) &&
+           le_sls_IsEmpty(&perThreadRecPtr->batchQueue);
+}
+
+
+#if LE_CONFIG_EVENT_PROFILING
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the time taken by a dispatch to the calling thread's histogram of dispatch times, and to
+ * its list of slowest handlers if it is one of the slowest.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ProfileDispatch
+(
+    event_PerThreadRec_t*   perThreadRecPtr,///< [in] Ptr to the calling thread's per-thread record.
+    le_clk_Time_t           elapsed,        ///< [in] Time taken by the dispatch.
+    void*                   funcPtr         ///< [in] Function that was called, or NULL if none.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint64_t elapsedUs = (uint64_t)elapsed.sec * 1000000 + elapsed.usec;
+    size_t bucket = 0;
+
+    while ((elapsedUs >= 4) && (bucket < EVENT_DISPATCH_TIME_BUCKETS - 1))
+    {
+        elapsedUs >>= 2;
+        bucket++;
+    }
+    perThreadRecPtr->dispatchTimeHistogram[bucket]++;
+
+    if (funcPtr == NULL)
+    {
+        return;
+    }
+
+    // Each function has at most one entry.  Find the function's entry, or else take the last
+    // (fastest) one, then move it up past the entries that are faster than this dispatch.
+    event_HandlerTime_t* slowestPtr = perThreadRecPtr->slowestHandlers;
+    size_t i;
+    for (i = 0; (i < EVENT_SLOWEST_HANDLERS - 1) && (slowestPtr[i].funcPtr != funcPtr); i++)
+    {
+    }
+
+    if (!le_clk_GreaterThan(elapsed, slowestPtr[i].maxTime))
+    {
+        return;
+    }
+
+    while ((i > 0) && le_clk_GreaterThan(elapsed, slowestPtr[i - 1].maxTime))
+    {
+        slowestPtr[i] = slowestPtr[i - 1];
+        i--;
+    }
+    slowestPtr[i].funcPtr = funcPtr;
+    slowestPtr[i].maxTime = elapsed;
+}
+#endif /* end LE_CONFIG_EVENT_PROFILING */
+
+
+#if TIME_DISPATCHES
+//--------------------------------------------------------------------------------------------------
+/**
+ * Keep track of the time taken by a dispatch, and warn about it if it was too long.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void CheckDispatchTime
+(
+    event_PerThreadRec_t*   perThreadRecPtr,///< [in] Ptr to the calling thread's per-thread record.
+    le_clk_Time_t           startTime,      ///< [in] Time at which the dispatch started.
+    void*                   funcPtr         ///< [in] Function that was called.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    if (le_clk_GreaterThan(elapsed, perThreadRecPtr->maxDispatchTime))
+    {
+        perThreadRecPtr->maxDispatchTime = elapsed;
+    }
+
+#if LE_CONFIG_EVENT_PROFILING
+    ProfileDispatch(perThreadRecPtr, elapsed, funcPtr);
+#endif
+
+#if LE_CONFIG_EVENT_SLOW_HANDLER_MS > 0
+    uint64_t elapsedMs = (uint64_t)elapsed.sec * 1000 + elapsed.usec / 1000;
+    if (elapsedMs >= LE_CONFIG_EVENT_SLOW_HANDLER_MS)
+    {
+        perThreadRecPtr->slowDispatchCount++;
+
+        LE_WARN("Handler '%s' (%p) of thread '%s' ran for %" PRIu64 " ms.",
+                perThreadRecPtr->handlerName[0] != '\0' ? perThreadRecPtr->handlerName : "?",
+                funcPtr,
+                le_thread_GetMyName(),
+                elapsedMs);
+    }
+#else
+    LE_UNUSED(funcPtr);
+#endif
+}
+#endif /* end TIME_DISPATCHES */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take every report currently on the calling thread's Event Queue as one batch, under a single
+ * acquisition of the mutex, and reset the thread's wakeup trigger.
+ *
+ * High priority reports go to the high priority queue, the others to the batch queue.  If the
+ * previous batch was not finished, the new reports are put behind what is left of it.
+ *
+ * @return The number of reports in the batch.
+ **/
+//--------------------------------------------------------------------------------------------------
+uint64_t event_FetchEventReports
+(
+    event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // Reset the wakeup trigger before taking the batch.  Anything queued from here until the
+    // mutex is taken below still sees triggerPending set, so it doesn't trigger again, but it
+    // does end up in this batch.  Anything queued after the mutex is released triggers a new
+    // wakeup.
+    fa_event_WaitForEvent(perThreadRecPtr);
 
     int oldState = event_Lock();
 
-    // Pop an Event Report off the head of the Event Queue (inside a critical section).
-    linkPtr = le_sls_Pop(&perThreadRecPtr->eventQueue);
+    // Take the whole Event Queue.  The list is circular and only points to its tail link, so it
+    // can simply be copied.
+    le_sls_List_t eventQueue = perThreadRecPtr->eventQueue;
+    perThreadRecPtr->eventQueue = LE_SLS_LIST_INIT;
+    size_t batchLen = perThreadRecPtr->eventQueueLen;
+    perThreadRecPtr->eventQueueLen = 0;
+    perThreadRecPtr->triggerPending = false;
 
     event_Unlock(oldState);
 
+    le_sls_Link_t* linkPtr;
+    while (NULL != (linkPtr = le_sls_Pop(&eventQueue)))
+    {
+        if (CONTAINER_OF(linkPtr, Report_t, link)->priority == LE_EVENT_PRIORITY_HIGH)
+        {
+            le_sls_Queue(&perThreadRecPtr->highPriorityQueue, linkPtr);
+        }
+        else
+        {
+            le_sls_Queue(&perThreadRecPtr->batchQueue, linkPtr);
+        }
+    }
+
+    perThreadRecPtr->loopTime = le_clk_GetCoarseRelativeTime();
+    perThreadRecPtr->wakeupCount++;
+    perThreadRecPtr->batchReportCount += batchLen;
+    if (batchLen > perThreadRecPtr->maxBatchLen)
+    {
+        perThreadRecPtr->maxBatchLen = batchLen;
+    }
+
+    return batchLen;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Process the next event report of the batch taken by event_FetchEventReports().
+ *
+ * High priority reports go first, except that one normal priority report is let through after
+ * every LE_CONFIG_EVENT_HIGH_PRIORITY_BURST high priority ones, so they can't starve the others.
+ **/
+//--------------------------------------------------------------------------------------------------
+void event_ProcessOneEventReport
+(
+    event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_sls_Link_t* linkPtr = NULL;
+    Report_t* reportObjPtr;
+    Handler_t* handlerPtr;
+    int oldState;
+
+    // Pop an Event Report off the head of the batch.  Only this thread touches the batch, so
+    // this doesn't need the mutex.
+    if (le_sls_IsEmpty(&perThreadRecPtr->batchQueue))
+    {
+        perThreadRecPtr->highPriorityRun = 0;
+        linkPtr = le_sls_Pop(&perThreadRecPtr->highPriorityQueue);
+    }
+    else if (perThreadRecPtr->highPriorityRun < LE_CONFIG_EVENT_HIGH_PRIORITY_BURST)
+    {
+        linkPtr = le_sls_Pop(&perThreadRecPtr->highPriorityQueue);
+        if (linkPtr != NULL)
+        {
+            perThreadRecPtr->highPriorityRun++;
+        }
+    }
+
     if (linkPtr == NULL)
     {
-        return;
+        perThreadRecPtr->highPriorityRun = 0;
+        linkPtr = le_sls_Pop(&perThreadRecPtr->batchQueue);
+
+        if (linkPtr == NULL)
+        {
+            return;
+        }
     }
 
     // Convert the link pointer into a pointer to the Report base class.
     reportObjPtr = CONTAINER_OF(linkPtr, Report_t, link);
 
+#if LE_CONFIG_EVENT_PROFILING
+    perThreadRecPtr->dispatchCount++;
+#endif
+
+#if TIME_DISPATCHES
+    void* funcPtr = NULL;
+    perThreadRecPtr->handlerName[0] = '\0';
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+#endif
+
     // If it's a queued function report,
     if (reportObjPtr->type == LE_EVENT_REPORT_QUEUED_FUNC)
     {
@@ -583,9 +803,15 @@ void event_ProcessOneEventReport
         QueuedFunctionReport_t* queuedFuncReportPtr;
         queuedFuncReportPtr = CONTAINER_OF(reportObjPtr, QueuedFunctionReport_t, baseClass);
 
+#if TIME_DISPATCHES
+        funcPtr = queuedFuncReportPtr->function;
+#endif
+
         // Call the function.
+        TRACE_MARKER('B', "%p", (void*)queuedFuncReportPtr->function);
         queuedFuncReportPtr->function(queuedFuncReportPtr->param1Ptr,
                                       queuedFuncReportPtr->param2Ptr);
+        TRACE_MARKER('E', NULL);
 
     }
     // If it's a publish-subscribe event report,
@@ -621,6 +847,16 @@ void event_ProcessOneEventReport
             le_event_LayeredHandlerFunc_t firstLayerFunc = handlerPtr->firstLayerFunc;
             void* secondLayerFunc = handlerPtr->secondLayerFunc;
 
+#if TIME_DISPATCHES
+            funcPtr = secondLayerFunc;
+#endif
+#if (LE_CONFIG_EVENT_SLOW_HANDLER_MS > 0) && LE_CONFIG_EVENT_NAMES_ENABLED
+            le_utf8_Copy(perThreadRecPtr->handlerName,
+                         handlerPtr->name,
+                         sizeof(perThreadRecPtr->handlerName),
+                         NULL);
+#endif
+
             // If it's a reference-counted report, then the payload is a pointer to the
             // report.  Otherwise, the report itself is in the payload.
             void* reportPtr;
@@ -636,12 +872,18 @@ void event_ProcessOneEventReport
             event_Unlock(oldState);  // Unlock the mutex before calling the handler function.
                                // Don't access the Handler object anymore after this.
 
+            TRACE_MARKER('B', "%p", secondLayerFunc);
             firstLayerFunc(reportPtr, secondLayerFunc);
+            TRACE_MARKER('E', NULL);
         }
     }
 
     // NOTE: The Mutex should be unlocked by this point.
 
+#if TIME_DISPATCHES
+    CheckDispatchTime(perThreadRecPtr, startTime, funcPtr);
+#endif
+
     // We are done with this report.
     le_mem_Release(reportObjPtr);
 }
@@ -649,26 +891,66 @@ void event_ProcessOneEventReport
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Process Event Reports from the calling thread's Event Queue until the queue is empty.
+ * Process what is left of the batch taken by event_FetchEventReports(), until it is empty or
+ * LE_CONFIG_EVENT_BATCH_DEADLINE_MS have passed.
+ *
+ * @return true if the deadline passed before the batch was empty.
  */
 //--------------------------------------------------------------------------------------------------
-void event_ProcessEventReports
+bool event_ProcessBatch
 (
     event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Read the eventfd to fetch the number of Reports on the Event Queue and reset the count
-    // to zero.
-    uint64_t numReports = fa_event_WaitForEvent(perThreadRecPtr);
+#if LE_CONFIG_EVENT_BATCH_DEADLINE_MS > 0
+    static const le_clk_Time_t batchTime =
+    {
+        .sec = LE_CONFIG_EVENT_BATCH_DEADLINE_MS / 1000,
+        .usec = (LE_CONFIG_EVENT_BATCH_DEADLINE_MS % 1000) * 1000
+    };
+    // Millisecond precision is enough for the deadline, so use the cheap clock.
+    le_clk_Time_t deadline = le_clk_Add(le_clk_GetCoarseRelativeTime(), batchTime);
+#endif
 
-    // Process only those event reports that are already on the queue.  Anything reported by the
-    // event handlers will have to wait until next time ProcessEventReports() is called.
+    // Process only those event reports that were in the batch.  Anything reported by the
+    // event handlers will have to wait until the next batch is fetched.
     // This approach ensures that event handlers that re-queue events to the event
     // queue don't cause fd events to be starved.
-    for (; numReports > 0; numReports--)
+    while (!IsBatchEmpty(perThreadRecPtr))
     {
         event_ProcessOneEventReport(perThreadRecPtr);
+
+#if LE_CONFIG_EVENT_BATCH_DEADLINE_MS > 0
+        if (!IsBatchEmpty(perThreadRecPtr) &&
+            le_clk_GreaterThan(le_clk_GetCoarseRelativeTime(), deadline))
+        {
+            return true;
+        }
+#endif
+    }
+
+    return false;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Process Event Reports from the calling thread's Event Queue until the queue is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+void event_ProcessEventReports
+(
+    event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // Take everything that is on the Event Queue now, in one go.
+    event_FetchEventReports(perThreadRecPtr);
+
+    while (event_ProcessBatch(perThreadRecPtr))
+    {
+        // Keep going until the whole batch has been dispatched.
     }
 }
 
@@ -697,6 +979,29 @@ static void PubSubHandlerFunc
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a report to a thread's Event Queue and wake up that thread's Event Loop.
+ *
+ * @warning Assumes the mutex is locked and the thread is protected from cancellation.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueReport_NoLock
+(
+    event_PerThreadRec_t*   perThreadRecPtr, ///< [in] Pointer to the thread's event data record.
+    Report_t*               reportPtr        ///< [in] The report to queue.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_sls_Queue(&perThreadRecPtr->eventQueue, &reportPtr->link);
+    perThreadRecPtr->eventQueueLen++;
+
+    // Notify the Event Loop that there is something on the queue.  This only writes to the
+    // eventfd if the thread has not already been woken up since it last fetched its queue.
+    fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Queue a function onto a specific thread's Event Queue (could belong to the calling thread or
@@ -708,6 +1013,7 @@ static void PubSubHandlerFunc
 static void QueueFunction_NoLock
 (
     event_PerThreadRec_t*   perThreadRecPtr, ///< [in] Pointer to the thread's event data record.
+    le_event_Priority_t     priority,   ///< [in] Priority with which to dispatch the function.
     le_event_DeferredFunc_t func,       ///< [in] The function to be called later.
     void*                   param1Ptr,  ///< [in] Value to be passed to the function when called.
     void*                   param2Ptr   ///< [in] Value to be passed to the function when called.
@@ -720,15 +1026,13 @@ static void QueueFunction_NoLock
     // Initialize it.
     reportPtr->baseClass.link = LE_SLS_LINK_INIT;
     reportPtr->baseClass.type = LE_EVENT_REPORT_QUEUED_FUNC;
+    reportPtr->baseClass.priority = priority;
     reportPtr->function = func;
     reportPtr->param1Ptr = param1Ptr;
     reportPtr->param2Ptr = param2Ptr;
 
     // Queue it to the Event Queue.
-    le_sls_Queue(&perThreadRecPtr->eventQueue, &reportPtr->baseClass.link);
-
-    // Write to the eventfd to notify the Event Loop that there is something on the queue.
-    fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+    QueueReport_NoLock(perThreadRecPtr, &reportPtr->baseClass);
 }
 
 
@@ -825,6 +1129,28 @@ event_PerThreadRec_t* event_CreatePerThreadInfo
 
     // Initialize the various thread-specific lists and queues.
     recPtr->eventQueue = LE_SLS_LIST_INIT;
+    recPtr->eventQueueLen = 0;
+    recPtr->triggerPending = false;
+    recPtr->batchQueue = LE_SLS_LIST_INIT;
+    recPtr->highPriorityQueue = LE_SLS_LIST_INIT;
+    recPtr->highPriorityRun = 0;
+    recPtr->liveEventCount = 0;
+    recPtr->wakeupCount = 0;
+    recPtr->batchReportCount = 0;
+    recPtr->maxBatchLen = 0;
+    recPtr->loopTime = le_clk_GetCoarseRelativeTime();
+    recPtr->handlerName[0] = '\0';
+    recPtr->slowDispatchCount = 0;
+    recPtr->maxDispatchTime.sec = 0;
+    recPtr->maxDispatchTime.usec = 0;
+#if LE_CONFIG_EVENT_PROFILING
+    recPtr->dispatchCount = 0;
+    recPtr->fdEventCount = 0;
+    recPtr->fdCoalescedCount = 0;
+    recPtr->timerExpiryCount = 0;
+    memset(recPtr->dispatchTimeHistogram, 0, sizeof(recPtr->dispatchTimeHistogram));
+    memset(recPtr->slowestHandlers, 0, sizeof(recPtr->slowestHandlers));
+#endif
     recPtr->handlerList = LE_DLS_LIST_INIT;
     recPtr->fdMonitorList = LE_DLS_LIST_INIT;
 
@@ -908,8 +1234,11 @@ void event_DestructThread
     // Delete all the FD Monitors for this thread.
     fdMon_DestructThread(perThreadRecPtr);
 
-    // Discard everything on the Event Queue.
-    while (NULL != (singleLinkPtr = le_sls_Pop(&perThreadRecPtr->eventQueue)))
+    // Discard everything on the Event Queue, starting with what is left of the batch being
+    // dispatched (if the thread is exiting from inside a handler).
+    while ((NULL != (singleLinkPtr = le_sls_Pop(&perThreadRecPtr->highPriorityQueue))) ||
+           (NULL != (singleLinkPtr = le_sls_Pop(&perThreadRecPtr->batchQueue))) ||
+           (NULL != (singleLinkPtr = le_sls_Pop(&perThreadRecPtr->eventQueue))))
     {
         Report_t* reportPtr = CONTAINER_OF(singleLinkPtr, Report_t, link);
 
@@ -926,6 +1255,17 @@ void event_DestructThread
         le_mem_Release(reportPtr);
     }
 
+    LE_DEBUG("Dispatched %" PRIu64 " event reports in %" PRIu64 " wakeups (largest batch %zu).",
+             perThreadRecPtr->batchReportCount,
+             perThreadRecPtr->wakeupCount,
+             perThreadRecPtr->maxBatchLen);
+#if TIME_DISPATCHES
+    LE_DEBUG("Longest dispatch %ld.%06ld s, %" PRIu64 " slow dispatches.",
+             (long)perThreadRecPtr->maxDispatchTime.sec,
+             (long)perThreadRecPtr->maxDispatchTime.usec,
+             perThreadRecPtr->slowDispatchCount);
+#endif
+
     fa_event_DestructThread(perThreadRecPtr);
 }
 
@@ -949,6 +1289,68 @@ void event_SetCurrentContextPtr
     thread_GetEventRecPtr()->contextPtr = contextPtr;
 }
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the coarse relative time at which the calling thread's event loop last fetched a batch of
+ * event reports.
+ *
+ * @return The time at which the current batch was fetched.
+ */
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t event_GetLoopTime
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return thread_GetEventRecPtr()->loopTime;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records the name of the handler that the calling thread is dispatching, to name it if it turns
+ * out to be slow (see LE_CONFIG_EVENT_SLOW_HANDLER_MS).
+ */
+//--------------------------------------------------------------------------------------------------
+void event_SetHandlerName
+(
+    const char* nameStr     ///< [in] Name of the handler.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_EVENT_SLOW_HANDLER_MS > 0
+    event_PerThreadRec_t* perThreadRecPtr = thread_GetEventRecPtr();
+
+    le_utf8_Copy(perThreadRecPtr->handlerName, nameStr, sizeof(perThreadRecPtr->handlerName), NULL);
+#else
+    LE_UNUSED(nameStr);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a function onto a specific thread's Event Queue, to be dispatched with a given priority.
+ */
+//--------------------------------------------------------------------------------------------------
+void event_QueueFunctionWithPriority
+(
+    event_PerThreadRec_t*   perThreadRecPtr, ///< [in] Pointer to the thread's event data record.
+    le_event_Priority_t     priority,   ///< [in] Priority with which to dispatch the function.
+    le_event_DeferredFunc_t func,       ///< [in] The function to be called later.
+    void*                   param1Ptr,  ///< [in] Value to be passed to the function when called.
+    void*                   param2Ptr   ///< [in] Value to be passed to the function when called.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int oldState = event_Lock();
+
+    QueueFunction_NoLock(perThreadRecPtr, priority, func, param1Ptr, param2Ptr);
+
+    event_Unlock(oldState);
+}
+
 /// Expose old symbol name to support apps compiled against an older liblegato.
 __attribute__((deprecated)) void event_QueueComponentInit
 (
@@ -1119,6 +1521,7 @@ le_event_HandlerRef_t _le_event_AddLayeredHandler
     handlerPtr->threadRecPtr = threadRecPtr;
     handlerPtr->eventPtr = eventPtr;
     handlerPtr->contextPtr = NULL;
+    handlerPtr->priority = LE_EVENT_PRIORITY_NORMAL;
     handlerPtr->firstLayerFunc = firstLayerFunc;
     handlerPtr->secondLayerFunc = secondLayerFunc;
 #if LE_CONFIG_EVENT_NAMES_ENABLED
@@ -1229,14 +1632,13 @@ void le_event_Report
         PubSubEventReport_t* reportObjPtr = le_mem_ForceAlloc(eventPtr->reportPoolRef);
         reportObjPtr->baseClass.link = LE_SLS_LINK_INIT;
         reportObjPtr->baseClass.type = LE_EVENT_REPORT_PLAIN;
+        reportObjPtr->baseClass.priority = handlerPtr->priority;
         reportObjPtr->handlerRef = handlerPtr->safeRef;
         memset(reportObjPtr->payload, 0, eventPtr->payloadSize);
         memcpy(reportObjPtr->payload, payloadPtr, payloadSize);
-        le_sls_Queue(&perThreadRecPtr->eventQueue, &reportObjPtr->baseClass.link);
 
-        // Increment the eventfd for the handler's thread's Event Queue.
         // This will wake up the thread and tell it that it has something on its Event Queue.
-        fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+        QueueReport_NoLock(perThreadRecPtr, &reportObjPtr->baseClass);
 
         linkPtr = le_dls_PeekNext(&eventPtr->handlerList, linkPtr);
     }
@@ -1290,14 +1692,13 @@ void le_event_ReportWithRefCounting
         PubSubEventReport_t* reportObjPtr = le_mem_ForceAlloc(eventPtr->reportPoolRef);
         reportObjPtr->baseClass.link = LE_SLS_LINK_INIT;
         reportObjPtr->baseClass.type = LE_EVENT_REPORT_COUNTED_REF;
+        reportObjPtr->baseClass.priority = handlerPtr->priority;
         reportObjPtr->handlerRef = handlerPtr->safeRef;
         reportObjPtr->payload[0] = objectPtr;
         le_mem_AddRef(objectPtr);
-        le_sls_Queue(&perThreadRecPtr->eventQueue, &reportObjPtr->baseClass.link);
 
-        // Increment the eventfd for the handler's thread's Event Queue.
         // This will wake up the thread and tell it that it has something on its Event Queue.
-        fa_event_TriggerEvent_NoLock(perThreadRecPtr);
+        QueueReport_NoLock(perThreadRecPtr, &reportObjPtr->baseClass);
 
         linkPtr = le_dls_PeekNext(&eventPtr->handlerList, linkPtr);
     }
@@ -1337,6 +1738,29 @@ void le_event_SetContextPtr
     event_Unlock(oldState);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the priority of a given event handler.  Reports already queued to the handler keep the
+ * priority the handler had when they were reported.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_event_SetHandlerPriority
+(
+    le_event_HandlerRef_t   handlerRef, ///< [in] Handler whose priority is to be set.
+    le_event_Priority_t     priority    ///< [in] Priority of the handler.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int oldState = event_Lock();
+
+    Handler_t* handlerPtr = le_ref_Lookup(HandlerRefMap, handlerRef);
+    LE_FATAL_IF(handlerPtr == NULL, "Handler %p not found.", handlerRef);
+
+    handlerPtr->priority = priority;
+
+    event_Unlock(oldState);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the context pointer for a given event handler.
@@ -1405,7 +1829,7 @@ void le_event_QueueFunction
 {
     int oldState = event_Lock();
 
-    QueueFunction_NoLock(thread_GetEventRecPtr(), func, param1Ptr, param2Ptr);
+    QueueFunction_NoLock(thread_GetEventRecPtr(), LE_EVENT_PRIORITY_NORMAL, func, param1Ptr, param2Ptr);
 
     event_Unlock(oldState);
 }
@@ -1428,7 +1852,11 @@ void le_event_QueueFunctionToThread
 {
     int oldState = event_Lock();
 
-    QueueFunction_NoLock(thread_GetOtherEventRecPtr(thread), func, param1Ptr, param2Ptr);
+    QueueFunction_NoLock(thread_GetOtherEventRecPtr(thread),
+                         LE_EVENT_PRIORITY_NORMAL,
+                         func,
+                         param1Ptr,
+                         param2Ptr);
 
     event_Unlock(oldState);
 }
@@ -1444,6 +1872,9 @@ void le_event_QueueFunctionToThread
  * It's generally better to ensure the event is only generated once, for example by disabling
  * generating the event until the event handler is run.
  *
+ * @note A thread's Event Loop takes everything off its Event Queue at once when it wakes up, so
+ *       a function that is about to be called by that wakeup is no longer in the Event Queue.
+ *
  * @return LE_OK if the function was queued to the Event Queue
  * @return LE_DUPLICATE if the function was already in the Event Queue
  */
@@ -1476,7 +1907,7 @@ le_result_t le_event_QueueFunctionToThreadUnique
         }
     }
 
-    QueueFunction_NoLock(thread_GetOtherEventRecPtr(thread), func, param1Ptr, param2Ptr);
+    QueueFunction_NoLock(perThreadRecPtr, LE_EVENT_PRIORITY_NORMAL, func, param1Ptr, param2Ptr);
 
     event_Unlock(oldState);
 
@@ -91,7 +91,43 @@ void event_SetCurrentContextPtr
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Process one event report from the calling thread's Event Queue.
+ * Take every report currently on the calling thread's Event Queue as one batch, under a single
+ * acquisition of the mutex, and reset the thread's wakeup trigger.
+ *
+ * The batch is then dispatched by event_ProcessOneEventReport(), event_ProcessBatch() or
+ * event_ProcessEventReports().  If the previous batch has not been fully dispatched, the new
+ * reports are added behind what is left of it.
+ *
+ * @return The number of reports in the batch.
+ **/
+//--------------------------------------------------------------------------------------------------
+uint64_t event_FetchEventReports
+(
+    event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the coarse relative time (see le_clk_GetCoarseRelativeTime()) at which the calling
+ * thread's event loop last fetched a batch of event reports.
+ *
+ * This is sampled once per event loop wakeup, so handlers that only need to know roughly what
+ * time it is can use it instead of reading a clock themselves.  It doesn't advance while a
+ * handler runs, so it must not be used to time anything within a handler.
+ *
+ * @return The time at which the current batch was fetched.
+ **/
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t event_GetLoopTime
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Process the next event report of the batch taken by event_FetchEventReports().
  *
  * This is usually called from the framework adaptor implementation of le_event_RunLoop() and
  * le_event_ServiceLoop()
@@ -106,7 +142,24 @@ void event_ProcessOneEventReport
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Process Event Reports from the calling thread's Event Queue until the queue is empty.
+ * Process what is left of the batch taken by event_FetchEventReports(), until it is empty or
+ * LE_CONFIG_EVENT_BATCH_DEADLINE_MS have passed.
+ *
+ * A framework adaptor that stops when the deadline passes must check its file descriptors
+ * without blocking, fetch whatever they reported, and call this again.
+ *
+ * @return true if the deadline passed before the batch was empty.
+ */
+//--------------------------------------------------------------------------------------------------
+bool event_ProcessBatch
+(
+    event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fetch the calling thread's Event Queue and process every Event Report that was on it.
  *
  * This is usually called from the framework adaptor implementation of le_event_RunLoop() and
  * le_event_ServiceLoop()
@@ -117,6 +170,31 @@ void event_ProcessEventReports
     event_PerThreadRec_t* perThreadRecPtr   ///< [in] Ptr to the calling thread's per-thread record.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a function onto a specific thread's Event Queue, to be dispatched with a given priority.
+ */
+//--------------------------------------------------------------------------------------------------
+void event_QueueFunctionWithPriority
+(
+    event_PerThreadRec_t*   perThreadRecPtr, ///< [in] Pointer to the thread's event data record.
+    le_event_Priority_t     priority,   ///< [in] Priority with which to dispatch the function.
+    le_event_DeferredFunc_t func,       ///< [in] The function to be called later.
+    void*                   param1Ptr,  ///< [in] Value to be passed to the function when called.
+    void*                   param2Ptr   ///< [in] Value to be passed to the function when called.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records the name of the handler that the calling thread is dispatching, to name it if it turns
+ * out to be slow (see LE_CONFIG_EVENT_SLOW_HANDLER_MS).
+ */
+//--------------------------------------------------------------------------------------------------
+void event_SetHandlerName
+(
+    const char* nameStr     ///< [in] Name of the handler.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Guards against thread cancellation and locks the mutex.
@@ -10,6 +10,7 @@
 #define FA_EVENTLOOP_H_INCLUDE_GUARD
 
 #include "legato.h"
+#include "../limit.h"
 
 
 // File Descriptor Monitor
@@ -28,6 +29,39 @@ typedef enum
 }
 event_LoopState_t;
 
+#if LE_CONFIG_EVENT_PROFILING
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of buckets in each thread's histogram of dispatch times.  Bucket 0 counts the dispatches
+ * that took less than 4 microseconds, and each following bucket those that took up to four times
+ * as long as the previous one; the last bucket counts all the longer ones.
+ */
+//--------------------------------------------------------------------------------------------------
+#define EVENT_DISPATCH_TIME_BUCKETS     12
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of slowest handlers each thread keeps track of.
+ */
+//--------------------------------------------------------------------------------------------------
+#define EVENT_SLOWEST_HANDLERS          4
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Longest time taken by one of the handlers (or queued functions) dispatched by a thread.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    void            *funcPtr;   ///< The handler or queued function.
+    le_clk_Time_t    maxTime;   ///< Longest time it ran for.
+}
+event_HandlerTime_t;
+#endif /* end LE_CONFIG_EVENT_PROFILING */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Event Loop's per-thread record.
@@ -36,12 +70,24 @@ event_LoopState_t;
  * will call the function thread_GetEventRecPtr() to fetch a pointer to it.
  *
  * @warning No code outside of the Event Loop module or the FD Monitor module should ever access
- * any member of this structure.
+ * any member of this structure, except for the profiling counters, which the Timer module updates
+ * and the inspect tool reads.
  */
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
     le_sls_List_t        eventQueue;        ///< The thread's event queue.
+    size_t               eventQueueLen;     ///< Number of reports on eventQueue.
+    le_sls_List_t        batchQueue;        ///< Reports taken off eventQueue in one batch, that
+                                            ///< are waiting to be dispatched.  Only accessed by
+                                            ///< the thread itself, so needs no locking.
+    bool                 triggerPending;    ///< true if the event loop has been triggered and
+                                            ///< has not yet fetched the Event Queue.  Used to
+                                            ///< coalesce triggers into one wakeup.
+    le_sls_List_t        highPriorityQueue; ///< High priority reports of the batch, dispatched
+                                            ///< ahead of those in batchQueue.
+    uint32_t             highPriorityRun;   ///< Number of high priority reports dispatched in a
+                                            ///< row while normal priority ones were waiting.
     le_dls_List_t        handlerList;       ///< List of handlers registered with this thread.
     le_dls_List_t        fdMonitorList;     ///< List of FD Monitors created by this thread.
     void                *contextPtr;        ///< Context pointer from last Handler called.
@@ -49,6 +95,33 @@ typedef struct
     uint64_t             liveEventCount;    ///< Number of events ready for dequeing.  Ensures
                                             ///< balance between queued events and monitored fds
                                             ///< in le_event_ServiceLoop().
+    uint64_t             wakeupCount;       ///< Number of batches fetched from the Event Queue.
+    uint64_t             batchReportCount;  ///< Total number of reports fetched in those batches.
+                                            ///< batchReportCount / wakeupCount gives the average
+                                            ///< number of reports dispatched per wakeup.
+    size_t               maxBatchLen;       ///< Largest number of reports fetched in one batch.
+    le_clk_Time_t        loopTime;          ///< Coarse relative time at which the last batch
+                                            ///< was fetched (see event_GetLoopTime()).
+    char                 handlerName[LIMIT_MAX_EVENT_HANDLER_NAME_BYTES];
+                                            ///< Name of the handler being dispatched, if known
+                                            ///< (for slow handler warnings).
+    uint64_t             slowDispatchCount; ///< Number of dispatches that ran for at least
+                                            ///< LE_CONFIG_EVENT_SLOW_HANDLER_MS.
+    le_clk_Time_t        maxDispatchTime;   ///< Longest time taken by one dispatch.
+#if LE_CONFIG_EVENT_PROFILING
+    uint64_t             dispatchCount;     ///< Number of reports dispatched.  The reports
+                                            ///< fetched but not dispatched yet number
+                                            ///< batchReportCount - dispatchCount.
+    uint64_t             fdEventCount;      ///< Number of fd events reported to this thread's
+                                            ///< FD Monitors.
+    uint64_t             fdCoalescedCount;  ///< Number of those that were merged into an
+                                            ///< FD Monitor dispatch that was already queued.
+    uint64_t             timerExpiryCount;  ///< Number of timer expiries handled.
+    uint32_t             dispatchTimeHistogram[EVENT_DISPATCH_TIME_BUCKETS];
+                                            ///< Number of dispatches by time taken.
+    event_HandlerTime_t  slowestHandlers[EVENT_SLOWEST_HANDLERS];
+                                            ///< Slowest handlers, slowest first.
+#endif
 }
 event_PerThreadRec_t;
 
@@ -101,6 +174,12 @@ void fa_event_ThreadInit
 //--------------------------------------------------------------------------------------------------
 /**
  * Inform event loop an event has fired.  Wakes the event loop if it is asleep.
+ *
+ * Only needs to be called when a report is pushed onto an empty event queue: until the thread
+ * takes its event queue, it is already due to wake up and see the reports pushed after that.
+ *
+ * @note Despite the name, this may be called with or without the event mutex held, from any
+ *       thread.
  */
 //--------------------------------------------------------------------------------------------------
 void fa_event_TriggerEvent_NoLock
@@ -111,9 +190,9 @@ void fa_event_TriggerEvent_NoLock
 //--------------------------------------------------------------------------------------------------
 /**
  * Wait for an event to trigger.  This fetches the value of the Event FD (which is
- * the number of event reports on the Event Queue) and resets the Event FD value to zero.
+ * the number of wakeups signalled since the last call) and resets the Event FD value to zero.
  *
- * @return The number of Event Reports on the thread's Event Queue.
+ * @return The number of wakeups signalled.
  */
 //--------------------------------------------------------------------------------------------------
 uint64_t fa_event_WaitForEvent
@@ -32,6 +32,10 @@ typedef struct fdMon
     le_fdMonitor_Ref_t       safeRef;           ///< Safe Reference for this object.
     event_PerThreadRec_t    *threadRecPtr;      ///< Ptr to per-thread data for monitoring thread.
     uint32_t                 eventFlags;        ///< Event flags in the style of poll().
+    le_event_Priority_t      priority;          ///< Priority with which events are dispatched.
+    uint32_t                 pendingFlags;      ///< Events reported but not yet dispatched (a
+                                                ///< dispatch is queued while this is non-zero).
+                                                ///< Protected by the FD Monitor mutex.
 
     le_fdMonitor_HandlerFunc_t   handlerFunc;   ///< Handler function.
     void                        *contextPtr;    ///< The context pointer for this handler.
@@ -123,6 +127,19 @@ void fa_fdMon_SetDeferrable
     bool     isDeferrable ///< Deferrable (true) or urgent (false).
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set if events on a given fd are reported only when the fd becomes ready (edge-triggered) rather
+ * than for as long as it is ready (level-triggered).  Platforms that can't do edge-triggered
+ * monitoring may ignore this.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_fdMon_SetEdgeTriggered
+(
+    fdMon_t *monitorPtr,        ///< FD monitor instance.
+    bool     isEdgeTriggered    ///< Edge-triggered (true) or level-triggered (false).
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Dispatch an FD Event to the appropriate registered handler function.
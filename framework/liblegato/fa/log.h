@@ -34,6 +34,20 @@ le_log_TraceRef_t fa_log_GetTraceRef
     const char          *keyword        ///< Trace keyword.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers a component's statically defined trace keywords.
+ *
+ * @note Optional.  Adaptors that don't provide it get a default that leaves the keywords disabled.
+ **/
+//--------------------------------------------------------------------------------------------------
+void fa_log_RegTraceKeywords
+(
+    le_log_SessionRef_t     logSession,     ///< Log session.
+    le_log_TraceKeyword_t  *keywordsPtr,    ///< Array of keyword definitions.
+    size_t                  count           ///< Number of keywords in the array.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the log filter level for a given log session in the calling process.
@@ -0,0 +1,54 @@
+/**
+ * @file mem.h
+ *
+ * Memory pool interface that must be implemented by a Legato framework adaptor to support
+ * trimming of memory pools (see @ref mem_trim).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef FA_MEM_H_INCLUDE_GUARD
+#define FA_MEM_H_INCLUDE_GUARD
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the size of the pages that fa_mem_DiscardPages() works on.
+ *
+ * @return The page size, in bytes (a power of two).
+ */
+//--------------------------------------------------------------------------------------------------
+size_t fa_mem_GetPageSize
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Give the memory of a range of pages back to the system.  The range stays mapped, and reads as
+ * zeroes the next time it is touched.
+ *
+ * @warning Called with the memory pool mutex locked, so must not log or allocate from a pool.
+ *
+ * @return true if the pages were given back.
+ */
+//--------------------------------------------------------------------------------------------------
+bool fa_mem_DiscardPages
+(
+    void*   startPtr,   ///< [IN] Start of the range (page aligned).
+    size_t  size        ///< [IN] Size of the range (a multiple of the page size).
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start watching for memory pressure, calling le_mem_Trim() from the calling thread's event loop
+ * when there is some.  Does nothing if the platform can't report memory pressure.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_mem_MonitorPressure
+(
+    void
+);
+
+#endif /* end FA_MEM_H_INCLUDE_GUARD */
@@ -43,11 +43,18 @@ typedef struct
     le_clk_Time_t interval;                  ///< Interval
     uint32_t repeatCount;                    ///< Number of times the timer will repeat
     void* contextPtr;                        ///< Context for timer expiry
+    le_event_Priority_t priority;            ///< Priority with which the expiry is dispatched
 
     // Internal State
     le_dls_Link_t link;                      ///< For adding to the timer list
+    size_t heapIndex;                        ///< Position in the thread's timer heap (only valid
+                                             ///  while the timer is active)
+    uint32_t startSequence;                  ///< Order in which the timer was started, used to
+                                             ///  order timers with the same expiry time
     bool isActive;                           ///< Is the timer active/running?
     le_clk_Time_t expiryTime;                ///< Time at which the timer should expire
+    le_clk_Time_t slack;                     ///< Amount of time by which expiry may be delayed
+                                             ///  to batch it with other timers
     uint32_t expiryCount;                    ///< Number of times the counter has expired
     le_timer_Ref_t safeRef;                  ///< For the API user to refer to this timer by
     bool isWakeupEnabled;                    ///< Will system be woken up from suspended timer.
@@ -69,10 +76,19 @@ Timer_t;
 typedef struct
 {
     le_dls_List_t activeTimerList;      ///< Linked list of running legato timers for this thread
+                                        ///  (unordered)
+    Timer_t** timerHeap;                ///< Binary min-heap of running timers, ordered by expiry
+                                        ///  time
+    size_t heapSize;                    ///< Number of timers in the heap
+    size_t heapCapacity;                ///< Number of slots allocated for the heap
+    uint32_t nextStartSequence;         ///< Start sequence number for the next timer started
     Timer_t* firstTimerPtr;             ///< Pointer to the timer on the active list that is
                                         ///  associated with the currently running timerFD,
                                         ///  or NULL if there are no timers on the active list.
                                         ///  This is normally the first timer on the list.
+    le_clk_Time_t armedTime;            ///< Time for which the timerFD is currently armed.  May be
+                                        ///  later than firstTimerPtr's expiry time if timers
+                                        ///  have slack.
 }
 timer_ThreadRec_t;
 
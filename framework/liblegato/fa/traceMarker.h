@@ -0,0 +1,78 @@
+/**
+ * @file traceMarker.h
+ *
+ * Trace marker interface that must be implemented by a Legato framework adaptor.
+ *
+ * Trace markers are short text records written to the system's tracer at points of interest in
+ * the framework (handler dispatch, IPC messages, timer expiries, memory pool growth), so that the
+ * activity of all processes can be seen on one time line.  Records are of the form
+ * "<type>|<pid>|<text>", where the type is 'B' (begin a slice), 'E' (end the innermost slice) or
+ * 'L' (a point event), the same form as used by Android's atrace.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef FA_TRACEMARKER_H_INCLUDE_GUARD
+#define FA_TRACEMARKER_H_INCLUDE_GUARD
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a trace marker if tracing is available.  Costs a single test when it is not.
+ *
+ * @param   type    Record type: 'B', 'E' or 'L'.
+ * @param   ...     printf-style format and arguments of the record's text, or NULL for none.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_TRACE_MARKERS
+#   define TRACE_MARKER(type, ...)                                      \
+        do                                                              \
+        {                                                               \
+            if (fa_traceMarker_IsEnabled())                             \
+            {                                                           \
+                fa_traceMarker_Write((type), __VA_ARGS__);              \
+            }                                                           \
+        } while (0)
+#else
+#   define TRACE_MARKER(type, ...)  do {} while (0)
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the platform's tracer.  Tracing stays disabled in this process if it can't be opened.
+ *
+ * This function must be called exactly once at process start-up before any other trace marker
+ * functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_traceMarker_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether trace markers can be written.
+ *
+ * @return true if they can.
+ */
+//--------------------------------------------------------------------------------------------------
+bool fa_traceMarker_IsEnabled
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a trace marker.  Records longer than the platform's limit are truncated.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_traceMarker_Write
+(
+    char        type,       ///< [IN] Record type.
+    const char *format,     ///< [IN] printf-style format of the record's text, or NULL.
+    ...                     ///< [IN] Arguments.
+) __attribute__((format(printf, 2, 3)));
+
+#endif /* end FA_TRACEMARKER_H_INCLUDE_GUARD */
@@ -9,6 +9,7 @@
 
 #include "legato.h"
 
+#include "fa/traceMarker.h"
 #include "fdMonitor.h"
 #include "thread.h"
 
@@ -53,11 +54,11 @@ LE_REF_DEFINE_STATIC_MAP(FdMonitors, LE_CONFIG_MAX_FD_MONITOR_POOL_SIZE);
 //--------------------------------------------------------------------------------------------------
 static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;   // POSIX "Fast" mutex.
 
-/// Locks the mutex.
-#define LOCK    LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+/// Locks the mutex, unless the process is single-threaded.
+#define LOCK    { if (!thread_IsSingleThreaded()) LE_ASSERT(pthread_mutex_lock(&Mutex) == 0); }
 
-/// Unlocks the mutex.
-#define UNLOCK  LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+/// Unlocks the mutex, unless the process is single-threaded.
+#define UNLOCK  { if (!thread_IsSingleThreaded()) LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0); }
 
 // ==============================================
 //  PRIVATE FUNCTIONS
@@ -102,16 +103,24 @@ static void DeleteFdMonitor
 static void DispatchToHandler
 (
     void        *fdMonRef,  ///< FD Monitor safe reference.
-    void        *param      ///< Event flags.
+    void        *param      ///< Not used.
 )
 {
     fdMon_t     *fdMonitorPtr;
-    uint32_t     flags = (uintptr_t) param;
+    uint32_t     flags = 0;
+
+    LE_UNUSED(param);
 
     LOCK
 
-    // Get a pointer to the FD Monitor object for this fd.
+    // Get a pointer to the FD Monitor object for this fd, and take the events reported for it
+    // since the dispatch was queued.  Events reported from now on queue another dispatch.
     fdMonitorPtr = le_ref_Lookup(FdMonitorRefMap, fdMonRef);
+    if (fdMonitorPtr != NULL)
+    {
+        flags = fdMonitorPtr->pendingFlags;
+        fdMonitorPtr->pendingFlags = 0;
+    }
 
     UNLOCK
 
@@ -135,7 +144,13 @@ static void DispatchToHandler
     // Set the thread's event loop Context Pointer.
     event_SetCurrentContextPtr(fdMonitorPtr->contextPtr);
 
+#if LE_CONFIG_FD_MONITOR_NAMES_ENABLED
+    event_SetHandlerName(fdMonitorPtr->name);
+#endif
+
+    TRACE_MARKER('B', "fd %d %s", fdMonitorPtr->fd, FDMON_NAME(fdMonitorPtr->name));
     fa_fdMon_DispatchToHandler(fdMonitorPtr, flags);
+    TRACE_MARKER('E', NULL);
 
     // Clear the thread-specific pointer to the FD Monitor.
     LE_ASSERT(pthread_setspecific(FDMonitorPtrKey, NULL) == 0);
@@ -144,6 +159,61 @@ static void DispatchToHandler
     le_mem_Release(fdMonitorPtr);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add events to those waiting to be dispatched to an FD Monitor's handler, and queue a dispatch
+ * to the monitoring thread unless one is already queued.  Events reported for the same fd
+ * before its handler runs are thus handled by a single call of the handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportEvents
+(
+    event_PerThreadRec_t *perThreadRecPtr,  ///< Event record of the monitoring thread.
+    void                 *fdMonRef,         ///< FD Monitor safe reference.
+    uint32_t              eventFlags        ///< OR'd together event flags.
+)
+{
+    fdMon_t     *fdMonitorPtr;
+    le_event_Priority_t priority;
+
+    LOCK
+
+    fdMonitorPtr = le_ref_Lookup(FdMonitorRefMap, fdMonRef);
+
+    // If the FD Monitor object has been deleted, there is nothing to dispatch.
+    if (fdMonitorPtr == NULL)
+    {
+        UNLOCK
+        LE_DEBUG("Discarding events for non-existent FD Monitor %p.", fdMonRef);
+        return;
+    }
+
+    bool isQueued = (fdMonitorPtr->pendingFlags != 0);
+    fdMonitorPtr->pendingFlags |= eventFlags;
+    priority = fdMonitorPtr->priority;
+
+#if LE_CONFIG_EVENT_PROFILING
+    // These counters are only updated with the mutex held, as events can be reported from
+    // another thread.
+    perThreadRecPtr->fdEventCount++;
+    if (isQueued)
+    {
+        perThreadRecPtr->fdCoalescedCount++;
+    }
+#endif
+
+    UNLOCK
+
+    if (!isQueued)
+    {
+        event_QueueFunctionWithPriority(perThreadRecPtr,
+                                        priority,
+                                        &DispatchToHandler,
+                                        fdMonRef,
+                                        NULL);
+    }
+}
+
 // ==============================================
 //  INTER-MODULE FUNCTIONS
 // ==============================================
@@ -252,7 +322,7 @@ void fdMon_Report
     uint32_t     eventFlags     ///< [in] OR'd together event flags.
 )
 {
-    le_event_QueueFunction(&DispatchToHandler, safeRef, (void *) (uintptr_t) eventFlags);
+    ReportEvents(thread_GetEventRecPtr(), safeRef, eventFlags);
 }
 
 
@@ -272,8 +342,7 @@ void fdMon_ReportToThread
     uint32_t     eventFlags     ///< [in] OR'd together event flags.
 )
 {
-    le_event_QueueFunctionToThread(thread, &DispatchToHandler,
-                                   safeRef, (void *) (uintptr_t) eventFlags);
+    ReportEvents(thread_GetOtherEventRecPtr(thread), safeRef, eventFlags);
 }
 
 
@@ -347,7 +416,10 @@ void fdMon_Lock
     void
 )
 {
-    LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+    if (!thread_IsSingleThreaded())
+    {
+        LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -360,7 +432,10 @@ void fdMon_Unlock
     void
 )
 {
-    LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+    if (!thread_IsSingleThreaded())
+    {
+        LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+    }
 }
 
 // ==============================================
@@ -443,6 +518,8 @@ le_fdMonitor_Ref_t _le_fdMonitor_Create
     fdMonitorPtr->handlerFunc = handlerFunc;
     fdMonitorPtr->contextPtr = NULL;
     fdMonitorPtr->eventFlags = events;
+    fdMonitorPtr->priority = LE_EVENT_PRIORITY_NORMAL;
+    fdMonitorPtr->pendingFlags = 0;
 
 #if LE_CONFIG_FD_MONITOR_NAMES_ENABLED
     // Copy the name into it.
@@ -605,6 +682,61 @@ void le_fdMonitor_SetDeferrable
     fa_fdMon_SetDeferrable(monitorPtr, isDeferrable);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets if the handler of a File Descriptor Monitor is called only when an enabled event becomes
+ * ready (edge-triggered), rather than for as long as it stays ready (level-triggered, the
+ * default).
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fdMonitor_SetEdgeTriggered
+(
+    le_fdMonitor_Ref_t monitorRef,      ///< [in] Reference to the File Descriptor Monitor object.
+    bool               isEdgeTriggered  ///< [in] true (edge-triggered) or false (level-triggered).
+)
+{
+    fdMon_t *monitorPtr;
+
+    LOCK
+    monitorPtr = le_ref_Lookup(FdMonitorRefMap, monitorRef);
+    UNLOCK
+
+    LE_FATAL_IF(monitorPtr == NULL, "File Descriptor Monitor %p doesn't exist!", monitorRef);
+    LE_FATAL_IF(thread_GetEventRecPtr() != monitorPtr->threadRecPtr,
+                "FD Monitor '%s' (fd %d) is owned by another thread.",
+                FDMON_NAME(monitorPtr->name),
+                monitorPtr->fd);
+
+    fa_fdMon_SetEdgeTriggered(monitorPtr, isEdgeTriggered);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the priority with which the events of a File Descriptor Monitor are dispatched by its
+ * thread's Event Loop.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fdMonitor_SetPriority
+(
+    le_fdMonitor_Ref_t  monitorRef, ///< [in] Reference to the File Descriptor Monitor object.
+    le_event_Priority_t priority    ///< [in] Priority of the handler.
+)
+{
+    fdMon_t *monitorPtr;
+
+    LOCK
+    monitorPtr = le_ref_Lookup(FdMonitorRefMap, monitorRef);
+    UNLOCK
+
+    LE_FATAL_IF(monitorPtr == NULL, "File Descriptor Monitor %p doesn't exist!", monitorRef);
+    LE_FATAL_IF(thread_GetEventRecPtr() != monitorPtr->threadRecPtr,
+                "FD Monitor '%s' (fd %d) is owned by another thread.",
+                FDMON_NAME(monitorPtr->name),
+                monitorPtr->fd);
+
+    monitorPtr->priority = priority;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the Context Pointer for File Descriptor Monitor's handler function.  This can be retrieved
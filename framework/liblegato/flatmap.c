@@ -0,0 +1,572 @@
+/** @file flatmap.c
+ *
+ * Implementation of the open-addressing @ref c_flatmap.
+ *
+ * Entries are placed using Robin Hood linear probing: when inserting, an entry that is further
+ * from its home slot than the entry occupying a slot takes over that slot, and the displaced entry
+ * continues probing.  This keeps probe sequences short and lets a lookup stop as soon as it
+ * reaches an entry that is closer to its home slot than the key being searched for would be.
+ * Removal shifts the following entries of the probe sequence back by one slot, so no tombstones
+ * are needed.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+// Create definitions for inlineable functions
+//
+// See le_flatmap.h for bodies & documentation
+//--------------------------------------------------------------------------------------------------
+#if !LE_CONFIG_HASHMAP_NAMES_ENABLED
+LE_DEFINE_INLINE le_flatmap_Ref_t le_flatmap_Create
+(
+    const char                *nameStr,
+    size_t                     capacity,
+    le_hashmap_HashFunc_t      hashFunc,
+    le_hashmap_EqualsFunc_t    equalsFunc
+);
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Name of a map, for diagnostic messages.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+#   define MAP_NAME(mapRef) ((mapRef)->nameStr)
+#else
+#   define MAP_NAME(mapRef) "<omitted>"
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calculate a hash.  First this calls the user-supplied hash function, then it applies the same
+ * secondary hashing as the chained hashmap, to defend against poor user-supplied hash functions.
+ *
+ * @return  Returns the hash of the key.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint32_t HashKey
+(
+    const le_flatmap_Flatmap_t  *mapRef,    ///< [IN] Map instance.
+    const void                  *keyPtr     ///< [IN] Key to hash.
+)
+{
+    size_t h = mapRef->hashFuncPtr(keyPtr);
+
+    // If the Hseih hash has been used then we can just return h
+    if (mapRef->hashFuncPtr != &le_hashmap_HashString)
+    {
+        h += ~(h << 9);
+        h ^= (((unsigned int) h) >> 14);
+        h += (h << 4);
+        h ^= (((unsigned int) h) >> 10);
+    }
+
+    return (uint32_t) h;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the slot holding a key.
+ *
+ * @return  Index of the slot holding the key, or slotCount if the key is not in the map.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t FindSlot
+(
+    const le_flatmap_Flatmap_t  *mapRef,    ///< [IN] Map instance.
+    const void                  *keyPtr     ///< [IN] Key to look for.
+)
+{
+    size_t mask = mapRef->slotCount - 1;
+    uint32_t hash = HashKey(mapRef, keyPtr);
+    size_t index = hash & mask;
+    uint32_t probeLen;
+
+    for (probeLen = 1; probeLen <= mapRef->slotCount; ++probeLen)
+    {
+        const le_flatmap_Slot_t *slotPtr = &mapRef->slotsPtr[index];
+
+        // Stop at an empty slot or at an entry that is closer to its home slot than the key
+        // would be; Robin Hood insertion would have placed the key before it.
+        if (slotPtr->probeLen < probeLen)
+        {
+            break;
+        }
+
+        if ((slotPtr->hash == hash) &&
+            ((slotPtr->keyPtr == keyPtr) || mapRef->equalsFuncPtr(slotPtr->keyPtr, keyPtr)))
+        {
+            return index;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    return mapRef->slotCount;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Insert a new entry into the slots of a map.  The key must not already be in the map, and there
+ * must be at least one empty slot.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InsertEntry
+(
+    le_flatmap_Slot_t   *slotsPtr,      ///< [IN] Array of slots.
+    size_t               slotCount,     ///< [IN] Number of slots.
+    le_flatmap_Slot_t    entry          ///< [IN] Entry to insert.  probeLen is ignored.
+)
+{
+    size_t mask = slotCount - 1;
+    size_t index = entry.hash & mask;
+
+    entry.probeLen = 1;
+
+    for (;;)
+    {
+        le_flatmap_Slot_t *slotPtr = &slotsPtr[index];
+
+        if (slotPtr->probeLen == 0)
+        {
+            *slotPtr = entry;
+            return;
+        }
+
+        // Take the slot from an entry that is closer to its home slot, and carry on inserting
+        // that entry instead.
+        if (slotPtr->probeLen < entry.probeLen)
+        {
+            le_flatmap_Slot_t displaced = *slotPtr;
+            *slotPtr = entry;
+            entry = displaced;
+        }
+
+        entry.probeLen++;
+        index = (index + 1) & mask;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Double the number of slots of a map, and re-insert all of its entries.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Grow
+(
+    le_flatmap_Flatmap_t    *mapRef     ///< [IN] Map instance.
+)
+{
+    size_t newSlotCount = mapRef->slotCount * 2;
+    size_t i;
+
+    LE_FATAL_IF(newSlotCount < mapRef->slotCount, "Flat map '%s' too large", MAP_NAME(mapRef));
+
+    le_flatmap_Slot_t *newSlotsPtr = calloc(newSlotCount, sizeof(le_flatmap_Slot_t));
+    LE_ASSERT(newSlotsPtr);
+
+    for (i = 0; i < mapRef->slotCount; ++i)
+    {
+        if (mapRef->slotsPtr[i].probeLen != 0)
+        {
+            InsertEntry(newSlotsPtr, newSlotCount, mapRef->slotsPtr[i]);
+        }
+    }
+
+    free(mapRef->slotsPtr);
+    mapRef->slotsPtr = newSlotsPtr;
+    mapRef->slotCount = newSlotCount;
+
+    LE_DEBUG("Flat map '%s' grown to %" PRIuS " slots", MAP_NAME(mapRef), newSlotCount);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Internal function to initialize a statically-defined flat map
+ *
+ * @note use le_flatmap_InitStatic() macro instead
+ */
+//--------------------------------------------------------------------------------------------------
+le_flatmap_Ref_t _le_flatmap_InitStatic
+(
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+    const char*                nameStr,          ///< [in] Name of the map
+#endif
+    le_hashmap_HashFunc_t      hashFunc,         ///< [in] The hash function
+    le_hashmap_EqualsFunc_t    equalsFunc,       ///< [in] The equality function
+    le_flatmap_Flatmap_t*      mapPtr,           ///< [in] The static map to initialize
+    le_flatmap_Slot_t*         slotsPtr,         ///< [in] The slots
+    size_t                     slotCount         ///< [in] Number of slots
+)
+{
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+    LE_ASSERT(nameStr);
+#endif
+    LE_ASSERT(hashFunc);
+    LE_ASSERT(equalsFunc);
+    LE_ASSERT(mapPtr);
+    LE_ASSERT(slotsPtr);
+    LE_ASSERT((slotCount != 0) && ((slotCount & (slotCount - 1)) == 0));
+
+    // Do not zero members as these are pre-zeroed entering this function.
+
+    mapPtr->hashFuncPtr = hashFunc;
+    mapPtr->equalsFuncPtr = equalsFunc;
+    mapPtr->slotsPtr = slotsPtr;
+    mapPtr->slotCount = slotCount;
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+    mapPtr->nameStr = nameStr;
+#endif
+
+    return mapPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a flat map
+ *
+ * @return  Returns a reference to the map.
+ *
+ * @note Terminates the process on failure, so no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+le_flatmap_Ref_t le_flatmap_Create
+(
+    const char*                nameStr,          ///< [in] Name of the map
+    size_t                     capacity,         ///< [in] Expected capacity of the map
+    le_hashmap_HashFunc_t      hashFunc,         ///< [in] The hash function
+    le_hashmap_EqualsFunc_t    equalsFunc        ///< [in] The equality function
+)
+#else
+le_flatmap_Ref_t _le_flatmap_Create
+(
+    size_t                     capacity,         ///< [in] Expected capacity of the map
+    le_hashmap_HashFunc_t      hashFunc,         ///< [in] The hash function
+    le_hashmap_EqualsFunc_t    equalsFunc        ///< [in] The equality function
+)
+#endif
+{
+    size_t slotCount;
+
+    // Check for no overflow
+    LE_ASSERT(4*capacity >= capacity);
+
+    // Round up to a power of 2, keeping the map no more than 75% full.
+    for (slotCount = 4; slotCount && slotCount < (4*capacity)/3; slotCount <<= 1)
+    {
+        /* no body */
+    }
+    LE_ASSERT(slotCount);
+
+    le_flatmap_Flatmap_t *mapPtr = calloc(1, sizeof(le_flatmap_Flatmap_t));
+    le_flatmap_Slot_t *slotsPtr = calloc(slotCount, sizeof(le_flatmap_Slot_t));
+    LE_ASSERT(mapPtr && slotsPtr);
+
+    mapPtr->isDynamic = true;
+
+    return _le_flatmap_InitStatic(
+#if LE_CONFIG_HASHMAP_NAMES_ENABLED
+        nameStr,
+#endif
+        hashFunc,
+        equalsFunc,
+        mapPtr,
+        slotsPtr,
+        slotCount);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allow or prevent a flat map from growing when it fills up.
+ *
+ * @note The process exits if growth is enabled on a statically-defined map.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_flatmap_SetGrowable
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    bool isGrowable            ///< [in] true to allow the map to grow.
+)
+{
+    LE_FATAL_IF(isGrowable && !mapRef->isDynamic,
+                "Statically-defined flat map '%s' can not grow", MAP_NAME(mapRef));
+
+    mapRef->isGrowable = isGrowable;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a key-value pair to a flat map. If the key already exists in the map, the previous value
+ * will be replaced with the new value passed into this function.
+ *
+ * @return  Returns NULL for a new entry or a pointer to the old value if it is replaced.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_Put
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr,        ///< [in] Pointer to the key to be stored.
+    const void* valuePtr       ///< [in] Pointer to the value to be stored.
+)
+{
+    size_t index = FindSlot(mapRef, keyPtr);
+
+    if (index < mapRef->slotCount)
+    {
+        const void *oldValuePtr = mapRef->slotsPtr[index].valuePtr;
+        mapRef->slotsPtr[index].valuePtr = valuePtr;
+        return (void *) oldValuePtr;
+    }
+
+    // Grow once the map is more than 7/8 full, as probe sequences get long beyond that.
+    if (mapRef->isGrowable && (mapRef->size >= mapRef->slotCount - (mapRef->slotCount / 8)))
+    {
+        Grow(mapRef);
+    }
+
+    LE_FATAL_IF(mapRef->size >= mapRef->slotCount,
+                "Flat map '%s' is full (%" PRIuS " entries)", MAP_NAME(mapRef), mapRef->size);
+
+    le_flatmap_Slot_t entry =
+    {
+        .keyPtr = keyPtr,
+        .valuePtr = valuePtr,
+        .hash = HashKey(mapRef, keyPtr)
+    };
+    InsertEntry(mapRef->slotsPtr, mapRef->slotCount, entry);
+    mapRef->size++;
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retrieve a value from a flat map.
+ *
+ * @return  Returns a pointer to the value or NULL if the key is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_Get
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be retrieved.
+)
+{
+    size_t index = FindSlot(mapRef, keyPtr);
+
+    if (index < mapRef->slotCount)
+    {
+        return (void *) mapRef->slotsPtr[index].valuePtr;
+    }
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Retrieve a stored key from a flat map.
+ *
+ * @return  Returns a pointer to the key that was stored in the map by le_flatmap_Put() or
+ *          NULL if the key is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_GetStoredKey
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be retrieved.
+)
+{
+    size_t index = FindSlot(mapRef, keyPtr);
+
+    if (index < mapRef->slotCount)
+    {
+        return (void *) mapRef->slotsPtr[index].keyPtr;
+    }
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a value from a flat map.
+ *
+ * @return  Returns a pointer to the value or NULL if the key is not found.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_flatmap_Remove
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be removed.
+)
+{
+    size_t mask = mapRef->slotCount - 1;
+    size_t index = FindSlot(mapRef, keyPtr);
+
+    if (index >= mapRef->slotCount)
+    {
+        return NULL;
+    }
+
+    const void *valuePtr = mapRef->slotsPtr[index].valuePtr;
+
+    // Shift the rest of the probe sequence back by one slot, until reaching an empty slot or an
+    // entry that is already in its home slot.
+    for (;;)
+    {
+        size_t nextIndex = (index + 1) & mask;
+        le_flatmap_Slot_t *nextSlotPtr = &mapRef->slotsPtr[nextIndex];
+
+        if (nextSlotPtr->probeLen <= 1)
+        {
+            mapRef->slotsPtr[index] = (le_flatmap_Slot_t){ 0 };
+            break;
+        }
+
+        mapRef->slotsPtr[index] = *nextSlotPtr;
+        mapRef->slotsPtr[index].probeLen--;
+        index = nextIndex;
+    }
+
+    mapRef->size--;
+
+    return (void *) valuePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests if a flat map is empty (i.e. contains zero keys).
+ *
+ * @return  Returns true if empty, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_flatmap_IsEmpty
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+)
+{
+    return (mapRef->size == 0);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of keys in a flat map.
+ *
+ * @return  The number of keys in the map.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_flatmap_Size
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+)
+{
+    return mapRef->size;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tests if a flat map contains a particular key.
+ *
+ * @return  Returns true if the key is found, false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_flatmap_ContainsKey
+(
+    le_flatmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    const void* keyPtr         ///< [in] Pointer to the key to be searched.
+)
+{
+    return (FindSlot(mapRef, keyPtr) < mapRef->slotCount);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deletes all the entries held in a flat map. This will not delete the data pointed to by the
+ * key and value pointers. That cleanup is the responsibility of the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_flatmap_RemoveAll
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+)
+{
+    memset(mapRef->slotsPtr, 0, mapRef->slotCount * sizeof(le_flatmap_Slot_t));
+    mapRef->size = 0;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Iterates over the whole map, calling the supplied callback with each key-value pair. If the
+ * callback returns false for any key then this function will return.
+ *
+ * @return  Returns true if all elements were checked; or false if iteration was stopped early
+ */
+//--------------------------------------------------------------------------------------------------
+bool le_flatmap_ForEach
+(
+    le_flatmap_Ref_t mapRef,                 ///< [in] Reference to the map.
+    le_hashmap_ForEachHandler_t forEachFn,   ///< [in] Callback function to be called with each pair.
+    void* contextPtr                         ///< [in] Pointer to a context to be supplied to the
+                                             ///<      callback.
+)
+{
+    size_t i;
+
+    for (i = 0; i < mapRef->slotCount; ++i)
+    {
+        const le_flatmap_Slot_t *slotPtr = &mapRef->slotsPtr[i];
+
+        if ((slotPtr->probeLen != 0) &&
+            !forEachFn(slotPtr->keyPtr, slotPtr->valuePtr, contextPtr))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counts the number of entries in the map that are not stored in their home slot.
+ *
+ * @return  Returns the number of displaced entries.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_flatmap_CountCollisions
+(
+    le_flatmap_Ref_t mapRef    ///< [in] Reference to the map.
+)
+{
+    size_t i;
+    size_t count = 0;
+
+    for (i = 0; i < mapRef->slotCount; ++i)
+    {
+        if (mapRef->slotsPtr[i].probeLen > 1)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
@@ -18,7 +18,6 @@
  */
 
 #include "legato.h"
-#include "hsieh_hash.h"
 #include "limit.h"
 
 #if LE_CONFIG_REDUCE_FOOTPRINT
@@ -31,6 +30,7 @@
 #   define bucket_Queue     le_sls_Queue
 #   define bucket_Stack     le_sls_Stack
 #   define bucket_PeekTail  le_sls_PeekTail
+#   define bucket_Pop       le_sls_Pop
 
 //--------------------------------------------------------------------------------------------------
 // Create definitions for inlineable functions
@@ -108,6 +108,7 @@ static inline le_sls_Link_t *bucket_PeekPrev
 #   define bucket_PeekTail  le_dls_PeekTail
 #   define bucket_Queue     le_dls_Queue
 #   define bucket_Stack     le_dls_Stack
+#   define bucket_Pop       le_dls_Pop
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -123,6 +124,18 @@ static inline le_sls_Link_t *bucket_PeekPrev
 
 #endif /* end LE_CONFIG_REDUCE_FOOTPRINT */
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of old buckets migrated to the new bucket array by each le_hashmap_Put() or
+ * le_hashmap_Remove() call while a map is being resized.
+ *
+ * The new array has twice as many buckets as the old one, and the map only needs to be resized
+ * again once it holds twice as many entries, so this always completes a resize well before the
+ * next one is needed.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MIGRATE_BUCKET_COUNT    4
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Trace if tracing is enabled for a given hashmap.
@@ -153,7 +166,7 @@ static inline le_sls_Link_t *bucket_PeekPrev
 static inline size_t HashKey(le_hashmap_Hashmap_t* map, const void* key) {
     size_t h = map->hashFuncPtr(key);
 
-    // If the Hseih hash has been used then we can just return h
+    // The string hash is already well mixed, so we can just return h
     if (map->hashFuncPtr == &le_hashmap_HashString)
     {
         return h;
@@ -169,6 +182,25 @@ static inline size_t HashKey(le_hashmap_Hashmap_t* map, const void* key) {
     return h;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the hash of the key of an entry that is in a map.
+ *
+ * @param map A pointer to the hashmap instance
+ * @param entryPtr A pointer to the entry
+ * @return  Returns the hash
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static inline size_t EntryHash(le_hashmap_Hashmap_t* map, const le_hashmap_Entry_t* entryPtr) {
+#if LE_CONFIG_HASHMAP_STORE_HASH
+    LE_UNUSED(map);
+    return entryPtr->hash;
+#else
+    return HashKey(map, entryPtr->keyPtr);
+#endif
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Create a new entry to put in the map. Allocates the entry from the pool which was created
@@ -176,6 +208,7 @@ static inline size_t HashKey(le_hashmap_Hashmap_t* map, const void* key) {
  *
  * @param newKeyPtr A pointer to the key
  * @param newValuePtr A pointer to the value
+ * @param hash The hash of the key
  * @param poolRef A memory pool reference to use for allocating memory. This pool must have been
  * created as a pool of Entry_t.
  * @return  Returns a pointer to the newly allocated and filled-in Entry_t
@@ -186,6 +219,7 @@ static le_hashmap_Entry_t* CreateEntry
 (
     const void* newKeyPtr,
     const void* newValuePtr,
+    size_t hash,
     le_mem_PoolRef_t poolRef
 )
 {
@@ -194,6 +228,11 @@ static le_hashmap_Entry_t* CreateEntry
 
     entryPtr->keyPtr = newKeyPtr;
     entryPtr->valuePtr = newValuePtr;
+#if LE_CONFIG_HASHMAP_STORE_HASH
+    entryPtr->hash = hash;
+#else
+    LE_UNUSED(hash);
+#endif
     entryPtr->entryListLink = BUCKET_LINK_INIT;
     return entryPtr;
 }
@@ -214,10 +253,12 @@ static inline size_t CalculateIndex(size_t bucketCount, size_t hash) {
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Checks if 2 keys are equal (or are actually the same key)
+ * Checks if an entry's key is equal to a key (or is actually the same key).  If the entries hold
+ * the hashes of their keys, keys with different hashes are told apart without comparing them.
  *
- * @param keyAPtr Pointer to the first key
- * @param keyBPtr Pointer to the second key
+ * @param entryPtr Pointer to the entry
+ * @param keyPtr Pointer to the key
+ * @param hash The hash of the key
  * @param equalsFuncPtr The equality function in use by the map
  * @return  Returns true if the keys are identical, false otherwise
  *
@@ -225,15 +266,23 @@ static inline size_t CalculateIndex(size_t bucketCount, size_t hash) {
 //--------------------------------------------------------------------------------------------------
 static inline bool EqualKeys
 (
-    const void* keyAPtr,
-    const void* keyBPtr,
+    const le_hashmap_Entry_t* entryPtr,
+    const void* keyPtr,
+    size_t hash,
     le_hashmap_EqualsFunc_t equalsFuncPtr
 )
 {
-    if (keyAPtr == keyBPtr) {
+    if (entryPtr->keyPtr == keyPtr) {
         return true;
     }
-    return equalsFuncPtr(keyAPtr, keyBPtr);
+#if LE_CONFIG_HASHMAP_STORE_HASH
+    if (entryPtr->hash != hash) {
+        return false;
+    }
+#else
+    LE_UNUSED(hash);
+#endif
+    return equalsFuncPtr(entryPtr->keyPtr, keyPtr);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -252,6 +301,186 @@ static le_hashmap_Bucket_t *IndexToBucket
     return (index < mapRef->bucketCount ? &mapRef->bucketsPtr[index] : NULL);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Look up the bucket list that holds (or would hold) the entries with a given hash.
+ *
+ *  While the map is being resized, entries that hash to an old bucket that has not yet been
+ *  migrated are still on that old bucket.
+ *
+ *  @return  Bucket list.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Bucket_t *HashToBucket
+(
+    le_hashmap_Hashmap_t    *mapRef,    ///< Map instance.
+    size_t                   hash       ///< Hash of the key.
+)
+{
+    if (mapRef->oldBucketsPtr != NULL)
+    {
+        size_t oldIndex = CalculateIndex(mapRef->oldBucketCount, hash);
+
+        if (oldIndex >= mapRef->migrateIndex)
+        {
+            return &mapRef->oldBucketsPtr[oldIndex];
+        }
+    }
+
+    return &mapRef->bucketsPtr[CalculateIndex(mapRef->bucketCount, hash)];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Move entries from the old bucket array of a map being resized to the new one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MigrateBuckets
+(
+    le_hashmap_Hashmap_t    *mapRef,    ///< Map instance.
+    size_t                   count      ///< Maximum number of old buckets to migrate.
+)
+{
+    while ((mapRef->oldBucketsPtr != NULL) && (count > 0))
+    {
+        le_hashmap_Bucket_t *oldListHeadPtr = &mapRef->oldBucketsPtr[mapRef->migrateIndex];
+        le_hashmap_Link_t   *theLinkPtr;
+
+        while ((theLinkPtr = bucket_Pop(oldListHeadPtr)) != NULL)
+        {
+            le_hashmap_Entry_t* currentEntryPtr = CONTAINER_OF(theLinkPtr,
+                                                               le_hashmap_Entry_t,
+                                                               entryListLink);
+            size_t index = CalculateIndex(mapRef->bucketCount,
+                                          EntryHash(mapRef, currentEntryPtr));
+
+            bucket_Stack(&mapRef->bucketsPtr[index], theLinkPtr);
+        }
+
+        mapRef->migrateIndex++;
+        count--;
+
+        if (mapRef->migrateIndex >= mapRef->oldBucketCount)
+        {
+            if (mapRef->isOldBucketsOnHeap)
+            {
+                free(mapRef->oldBucketsPtr);
+            }
+            mapRef->oldBucketsPtr = NULL;
+            mapRef->oldBucketCount = 0;
+            mapRef->migrateIndex = 0;
+
+            HASHMAP_TRACE(
+                mapRef,
+                "Hashmap %s: Resize to %" PRIuS " buckets complete",
+                mapRef->nameStr,
+                mapRef->bucketCount
+            );
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Complete any resize in progress.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void FinishResize
+(
+    le_hashmap_Hashmap_t    *mapRef     ///< Map instance.
+)
+{
+    if (mapRef->oldBucketsPtr != NULL)
+    {
+        MigrateBuckets(mapRef, mapRef->oldBucketCount - mapRef->migrateIndex);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Do the incremental resize work for a call that modified a map: migrate a few buckets if a
+ *  resize is in progress, otherwise start a resize if the map has become too loaded.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResizeStep
+(
+    le_hashmap_Hashmap_t    *mapRef     ///< Map instance.
+)
+{
+    // Never move entries around under an iterator.  An iteration left open while the map grew to
+    // twice its maximum load is taken to have been abandoned without le_hashmap_ReleaseIterator(),
+    // so that it doesn't stop the map from ever being resized again.  The iterator is moved past
+    // the end, so it can't walk buckets that have since been rehashed.
+    if (mapRef->isIterating)
+    {
+        if ((mapRef->maxLoadPercent == 0) ||
+            ((uint64_t) mapRef->size * 100 <=
+                (uint64_t) mapRef->bucketCount * mapRef->maxLoadPercent * 2))
+        {
+            return;
+        }
+
+        HASHMAP_TRACE(
+            mapRef,
+            "Hashmap %s: Ending an abandoned iteration to resize",
+            mapRef->nameStr
+        );
+        mapRef->iterator.currentIndex = SIZE_MAX;
+        mapRef->iterator.currentLinkPtr = NULL;
+        mapRef->isIterating = false;
+    }
+
+    if (mapRef->oldBucketsPtr != NULL)
+    {
+        MigrateBuckets(mapRef, MIGRATE_BUCKET_COUNT);
+        return;
+    }
+
+    if ((mapRef->maxLoadPercent == 0) ||
+        ((uint64_t) mapRef->size * 100 <= (uint64_t) mapRef->bucketCount * mapRef->maxLoadPercent))
+    {
+        return;
+    }
+
+    size_t newBucketCount = mapRef->bucketCount * 2;
+    if (newBucketCount < mapRef->bucketCount)
+    {
+        return;
+    }
+
+    // Not being able to resize is not fatal; the map just gets slower.
+    le_hashmap_Bucket_t *newBucketsPtr = calloc(newBucketCount, sizeof(le_hashmap_Bucket_t));
+    if (newBucketsPtr == NULL)
+    {
+        HASHMAP_TRACE(
+            mapRef,
+            "Hashmap %s: Unable to allocate %" PRIuS " buckets",
+            mapRef->nameStr,
+            newBucketCount
+        );
+        return;
+    }
+
+    mapRef->oldBucketsPtr = mapRef->bucketsPtr;
+    mapRef->oldBucketCount = mapRef->bucketCount;
+    mapRef->isOldBucketsOnHeap = mapRef->isBucketsOnHeap;
+    mapRef->migrateIndex = 0;
+
+    mapRef->bucketsPtr = newBucketsPtr;
+    mapRef->bucketCount = newBucketCount;
+    mapRef->isBucketsOnHeap = true;
+
+    HASHMAP_TRACE(
+        mapRef,
+        "Hashmap %s: Resizing to %" PRIuS " buckets for %" PRIuS " entries",
+        mapRef->nameStr,
+        newBucketCount,
+        mapRef->size
+    );
+
+    MigrateBuckets(mapRef, MIGRATE_BUCKET_COUNT);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get number of buckets required for a given capacity
@@ -324,6 +553,7 @@ le_hashmap_Ref_t _le_hashmap_InitStatic
 #endif
 
     le_hashmap_GetIterator(mapPtr);
+    mapPtr->isIterating = false;
     return mapPtr;
 }
 
@@ -365,7 +595,7 @@ le_hashmap_Ref_t _le_hashmap_Create
 
     // Use same function internally as static allocation, but take pointers from
     // heap instead of static memory
-    return _le_hashmap_InitStatic(
+    le_hashmap_Ref_t mapRef = _le_hashmap_InitStatic(
 #if LE_CONFIG_HASHMAP_NAMES_ENABLED
         nameStr,
 #endif
@@ -377,6 +607,25 @@ le_hashmap_Ref_t _le_hashmap_Create
                                             sizeof(le_hashmap_Entry_t)),
                           bucketCount / 2),
         calloc(bucketCount, sizeof(le_hashmap_Bucket_t)));
+
+    mapRef->isBucketsOnHeap = true;
+    return mapRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable automatic, incremental resizing of a HashMap.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_hashmap_EnableResize
+(
+    le_hashmap_Ref_t mapRef,   ///< [in] Reference to the map.
+    uint32_t maxLoadPercent    ///< [in] Maximum number of entries per 100 buckets, or 0 to never
+                               ///<      resize.
+)
+{
+    mapRef->maxLoadPercent = maxLoadPercent;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -397,21 +646,23 @@ void* le_hashmap_Put
 )
 {
     size_t hash = HashKey(mapRef, keyPtr);
-    size_t index = CalculateIndex(mapRef->bucketCount, hash);
 
     HASHMAP_TRACE(
         mapRef,
-        "Hashmap %s: Generated index of %" PRIuS " for hash %u",
+        "Hashmap %s: Generated index of %" PRIuS " for hash %" PRIuS,
         mapRef->nameStr,
-        index,
-        (int)hash
+        CalculateIndex(mapRef->bucketCount, hash),
+        hash
     );
 
-    le_hashmap_Bucket_t* listHeadPtr = &(mapRef->bucketsPtr[index]);
+    le_hashmap_Bucket_t* listHeadPtr = HashToBucket(mapRef, hash);
 
     if (bucket_IsEmpty(listHeadPtr))
     {
-        le_hashmap_Entry_t* newEntryPtr = CreateEntry(keyPtr, valuePtr, mapRef->entryPoolRef);
+        le_hashmap_Entry_t* newEntryPtr = CreateEntry(keyPtr,
+                                                      valuePtr,
+                                                      hash,
+                                                      mapRef->entryPoolRef);
         LE_ASSERT(newEntryPtr);
 
         bucket_Stack(listHeadPtr, &(newEntryPtr->entryListLink));
@@ -424,6 +675,7 @@ void* le_hashmap_Put
             mapRef->size
         );
 
+        ResizeStep(mapRef);
         return NULL;
     }
     else
@@ -436,8 +688,9 @@ void* le_hashmap_Put
                                                                entryListLink);
 
             // Replace existing value if the keys match.
-            if (EqualKeys(currentEntryPtr->keyPtr,
+            if (EqualKeys(currentEntryPtr,
                           keyPtr,
+                          hash,
                           mapRef->equalsFuncPtr)
                           )
             {
@@ -458,6 +711,7 @@ void* le_hashmap_Put
             if (bucket_PeekNext(listHeadPtr, theLinkPtr) == NULL) {
                 le_hashmap_Entry_t* newEntryPtr = CreateEntry(keyPtr,
                                                               valuePtr,
+                                                              hash,
                                                               mapRef->entryPoolRef);
                 LE_ASSERT(newEntryPtr);
 
@@ -478,6 +732,7 @@ void* le_hashmap_Put
                     bucket_NumLinks(listHeadPtr)
                 );
 
+                ResizeStep(mapRef);
                 return NULL;
             }
 
@@ -503,16 +758,15 @@ void* le_hashmap_Get
 )
 {
     size_t hash = HashKey(mapRef, keyPtr);
-    size_t index = CalculateIndex(mapRef->bucketCount, hash);
     HASHMAP_TRACE(
         mapRef,
         "Hashmap %s: Generated index of %" PRIuS " for hash %" PRIuS,
         mapRef->nameStr,
-        index,
+        CalculateIndex(mapRef->bucketCount, hash),
         hash
     );
 
-    le_hashmap_Bucket_t* listHeadPtr = &(mapRef->bucketsPtr[index]);
+    le_hashmap_Bucket_t* listHeadPtr = HashToBucket(mapRef, hash);
     HASHMAP_TRACE(
         mapRef,
         "Hashmap %s: Looked up list contains %" PRIuS " links",
@@ -526,8 +780,9 @@ void* le_hashmap_Get
         le_hashmap_Entry_t* currentEntryPtr = CONTAINER_OF(theLinkPtr,
                                                            le_hashmap_Entry_t,
                                                            entryListLink);
-        if (EqualKeys(currentEntryPtr->keyPtr,
+        if (EqualKeys(currentEntryPtr,
                           keyPtr,
+                          hash,
                           mapRef->equalsFuncPtr)
                           )
         {
@@ -565,16 +820,15 @@ void* le_hashmap_GetStoredKey
 )
 {
     size_t hash = HashKey(mapRef, keyPtr);
-    size_t index = CalculateIndex(mapRef->bucketCount, hash);
     HASHMAP_TRACE(
         mapRef,
         "Hashmap %s: Generated index of %" PRIuS " for hash %" PRIuS,
         mapRef->nameStr,
-        index,
+        CalculateIndex(mapRef->bucketCount, hash),
         hash
     );
 
-    le_hashmap_Bucket_t* listHeadPtr = &(mapRef->bucketsPtr[index]);
+    le_hashmap_Bucket_t* listHeadPtr = HashToBucket(mapRef, hash);
     HASHMAP_TRACE(
         mapRef,
         "Hashmap %s: Looked up list contains %" PRIuS " links",
@@ -588,8 +842,9 @@ void* le_hashmap_GetStoredKey
         le_hashmap_Entry_t* currentEntryPtr = CONTAINER_OF(theLinkPtr,
                                                            le_hashmap_Entry_t,
                                                            entryListLink);
-        if (EqualKeys(currentEntryPtr->keyPtr,
+        if (EqualKeys(currentEntryPtr,
                           keyPtr,
+                          hash,
                           mapRef->equalsFuncPtr)
                           )
         {
@@ -629,18 +884,17 @@ void* le_hashmap_Remove
    const void* keyPtr       ///< [in] Pointer to the key to be removed
 )
 {
-    int hash = HashKey(mapRef, keyPtr);
-    size_t index = CalculateIndex(mapRef->bucketCount, hash);
+    size_t hash = HashKey(mapRef, keyPtr);
 
     HASHMAP_TRACE(
         mapRef,
-        "Hashmap %s: Generated index of %" PRIuS " for hash %u",
+        "Hashmap %s: Generated index of %" PRIuS " for hash %" PRIuS,
         mapRef->nameStr,
-        index,
+        CalculateIndex(mapRef->bucketCount, hash),
         hash
     );
 
-    le_hashmap_Bucket_t *listHeadPtr = &(mapRef->bucketsPtr[index]);
+    le_hashmap_Bucket_t *listHeadPtr = HashToBucket(mapRef, hash);
     le_hashmap_Link_t   *theLinkPtr = bucket_Peek(listHeadPtr);
     le_hashmap_Link_t   *prevLinkPtr = NULL;
 
@@ -648,8 +902,9 @@ void* le_hashmap_Remove
         le_hashmap_Entry_t* currentEntryPtr = CONTAINER_OF(theLinkPtr,
                                                            le_hashmap_Entry_t,
                                                            entryListLink);
-        if (EqualKeys(currentEntryPtr->keyPtr,
+        if (EqualKeys(currentEntryPtr,
                           keyPtr,
+                          hash,
                           mapRef->equalsFuncPtr)
                           )
         {
@@ -669,6 +924,7 @@ void* le_hashmap_Remove
                 mapRef->nameStr
             );
 
+            ResizeStep(mapRef);
             return value;
         }
 
@@ -734,26 +990,26 @@ bool le_hashmap_ContainsKey
     const void* keyPtr        ///< [in] Pointer to the key to be searched for
 )
 {
-    int hash = HashKey(mapRef, keyPtr);
-    size_t index = CalculateIndex(mapRef->bucketCount, hash);
+    size_t hash = HashKey(mapRef, keyPtr);
 
     HASHMAP_TRACE(
         mapRef,
-        "Hashmap %s: Generated index of %" PRIuS " for hash %u",
+        "Hashmap %s: Generated index of %" PRIuS " for hash %" PRIuS,
         mapRef->nameStr,
-        index,
+        CalculateIndex(mapRef->bucketCount, hash),
         hash
     );
 
-    le_hashmap_Bucket_t* listHeadPtr = &(mapRef->bucketsPtr[index]);
+    le_hashmap_Bucket_t* listHeadPtr = HashToBucket(mapRef, hash);
     le_hashmap_Link_t* theLinkPtr = bucket_Peek(listHeadPtr);
 
     while (theLinkPtr != NULL) {
         le_hashmap_Entry_t* currentEntryPtr = CONTAINER_OF(theLinkPtr,
                                                            le_hashmap_Entry_t,
                                                            entryListLink);
-        if (EqualKeys(currentEntryPtr->keyPtr,
+        if (EqualKeys(currentEntryPtr,
                           keyPtr,
+                          hash,
                           mapRef->equalsFuncPtr)
                           )
         {
@@ -791,8 +1047,9 @@ void le_hashmap_RemoveAll
     le_hashmap_Ref_t mapRef    ///< [in] Reference to the map
 )
 {
-    // Reset the iterator
+    // Reset the iterator.  This also completes any resize in progress.
     le_hashmap_GetIterator(mapRef);
+    mapRef->isIterating = false;
 
     uint32_t i;
     for (i = 0; i < mapRef->bucketCount; i++) {
@@ -837,6 +1094,8 @@ bool le_hashmap_ForEach
                                             ///<      callback
 )
 {
+    FinishResize(mapRef);
+
     uint32_t i;
     for (i = 0; i < mapRef->bucketCount; i++) {
         le_hashmap_Bucket_t* listHeadPtr = &(mapRef->bucketsPtr[i]);
@@ -871,6 +1130,47 @@ bool le_hashmap_ForEach
     return true;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copies the key and value pointers of the map's entries into an array, in one pass over the map.
+ *
+ * @return  Number of pairs copied.  This is less than the size of the map only if the array was
+ *          too small to hold all of them.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_hashmap_Snapshot
+(
+    le_hashmap_Ref_t mapRef,                ///< [in] Reference to the map
+    le_hashmap_KeyValue_t* pairsPtr,        ///< [out] Array to copy the key-value pairs into
+    size_t maxCount                         ///< [in] Number of pairs the array can hold
+)
+{
+    FinishResize(mapRef);
+
+    size_t count = 0;
+    size_t i;
+    for (i = 0; (i < mapRef->bucketCount) && (count < maxCount); i++)
+    {
+        le_hashmap_Bucket_t* listHeadPtr = &(mapRef->bucketsPtr[i]);
+        le_hashmap_Link_t* theLinkPtr = bucket_Peek(listHeadPtr);
+
+        while ((theLinkPtr != NULL) && (count < maxCount))
+        {
+            le_hashmap_Entry_t* currentEntryPtr = CONTAINER_OF(theLinkPtr,
+                                                               le_hashmap_Entry_t,
+                                                               entryListLink);
+            pairsPtr[count].keyPtr = currentEntryPtr->keyPtr;
+            pairsPtr[count].valuePtr = currentEntryPtr->valuePtr;
+            count++;
+
+            theLinkPtr = bucket_PeekNext(listHeadPtr, theLinkPtr);
+        }
+    }
+
+    return count;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets an interator for step-by-step iteration over the map. In this mode
@@ -888,8 +1188,11 @@ le_hashmap_It_Ref_t le_hashmap_GetIterator
     le_hashmap_Ref_t mapRef                 ///< [in] Reference to the map
 )
 {
+    FinishResize(mapRef);
+
     mapRef->iterator.currentIndex = 0;
     mapRef->iterator.currentLinkPtr = NULL;
+    mapRef->isIterating = true;
     return &mapRef->iterator;
 }
 
@@ -917,6 +1220,7 @@ le_result_t le_hashmap_NextNode
     // If the map is empty immediately return LE_NOT_FOUND
     if (le_hashmap_isEmpty(mapRef))
     {
+        mapRef->isIterating = false;
         return LE_NOT_FOUND;
     }
 
@@ -926,6 +1230,7 @@ le_result_t le_hashmap_NextNode
         if (listHeadPtr == NULL)
         {
             // At end of map
+            mapRef->isIterating = false;
             return LE_NOT_FOUND;
         }
 
@@ -959,6 +1264,7 @@ le_result_t le_hashmap_NextNode
             if (iteratorRef->currentIndex >= mapRef->bucketCount)
             {
                 // At end of map
+                mapRef->isIterating = false;
                 return LE_NOT_FOUND;
             }
         }
@@ -966,6 +1272,26 @@ le_result_t le_hashmap_NextNode
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ends a step-by-step iteration before le_hashmap_NextNode() has reached the end of the map, so
+ * that the map can be resized again.  The iterator must not be used again until
+ * le_hashmap_GetIterator() is called.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_hashmap_ReleaseIterator
+(
+    le_hashmap_It_Ref_t iteratorRef        ///< [IN] Reference to the iterator
+)
+{
+    le_hashmap_Ref_t mapRef = CONTAINER_OF(iteratorRef, le_hashmap_Hashmap_t, iterator);
+
+    iteratorRef->currentIndex = SIZE_MAX;
+    iteratorRef->currentLinkPtr = NULL;
+    mapRef->isIterating = false;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Moves the iterator to the previous key/value pair in the map. Order is dependent
@@ -1111,6 +1437,8 @@ le_result_t le_hashmap_GetFirstNode
         return LE_BAD_PARAMETER;
     }
 
+    FinishResize(mapRef);
+
     // Find the first list head
     size_t index = 0;
     for (
@@ -1166,6 +1494,8 @@ le_result_t le_hashmap_GetNodeAfter
         return LE_BAD_PARAMETER;
     }
 
+    FinishResize(mapRef);
+
     // Find the node pointed to by the key
     size_t hash = HashKey(mapRef, keyPtr);
     size_t index = CalculateIndex(mapRef->bucketCount, hash);
@@ -1177,7 +1507,7 @@ le_result_t le_hashmap_GetNodeAfter
         hash
     );
 
-    le_hashmap_Bucket_t* listHeadPtr = &(mapRef->bucketsPtr[index]);
+    le_hashmap_Bucket_t* listHeadPtr = HashToBucket(mapRef, hash);
     HASHMAP_TRACE(
         mapRef,
         "Hashmap %s: Looked up list contains %" PRIuS " links",
@@ -1191,8 +1521,9 @@ le_result_t le_hashmap_GetNodeAfter
         le_hashmap_Entry_t* currentEntryPtr = CONTAINER_OF(theLinkPtr,
                                                            le_hashmap_Entry_t,
                                                            entryListLink);
-        if (EqualKeys(currentEntryPtr->keyPtr,
+        if (EqualKeys(currentEntryPtr,
                           keyPtr,
+                          hash,
                           mapRef->equalsFuncPtr)
                           )
         {
@@ -1267,6 +1598,9 @@ size_t le_hashmap_CountCollisions
 )
 {
     size_t i, collCount = 0;
+
+    FinishResize(mapRef);
+
     for (i = 0; i < mapRef->bucketCount; i++) {
         size_t chainLength = bucket_NumLinks(&mapRef->bucketsPtr[i]);
         if (chainLength > 1)
@@ -1278,6 +1612,193 @@ size_t le_hashmap_CountCollisions
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Byte hashing primitives, from Wang Yi's wyhash (public domain).  Hashes are only ever kept in
+ * memory, so words are read in the CPU's native byte order.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint32_t ReadUInt32(const uint8_t* bytePtr)
+{
+    uint32_t word;
+    memcpy(&word, bytePtr, sizeof(word));
+    return word;
+}
+
+static inline uint32_t ReadUpTo3Bytes(const uint8_t* bytePtr, size_t numBytes)
+{
+    return (((uint32_t)bytePtr[0]) << 16) |
+           (((uint32_t)bytePtr[numBytes >> 1]) << 8) |
+           bytePtr[numBytes - 1];
+}
+
+#if (SIZE_MAX > UINT32_MAX) && defined(__SIZEOF_INT128__)
+//--------------------------------------------------------------------------------------------------
+/**
+ * 64-bit CPUs use wyhash, which consumes 16 or 48 bytes per round using 64x64->128 bit multiplies.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint64_t ReadUInt64(const uint8_t* bytePtr)
+{
+    uint64_t word;
+    memcpy(&word, bytePtr, sizeof(word));
+    return word;
+}
+
+static inline uint64_t Mix64(uint64_t a, uint64_t b)
+{
+    __uint128_t product = (__uint128_t)a * b;
+    return ((uint64_t)product) ^ ((uint64_t)(product >> 64));
+}
+
+static size_t HashBytes
+(
+    const uint8_t* bytePtr,
+    size_t numBytes
+)
+{
+    static const uint64_t Secret[4] =
+    {
+        0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL
+    };
+
+    uint64_t seed = Mix64(Secret[0], Secret[1]);
+    uint64_t a;
+    uint64_t b;
+
+    if (numBytes <= 16)
+    {
+        if (numBytes >= 4)
+        {
+            size_t middle = (numBytes >> 3) << 2;
+
+            a = (((uint64_t)ReadUInt32(bytePtr)) << 32) | ReadUInt32(bytePtr + middle);
+            b = (((uint64_t)ReadUInt32(bytePtr + numBytes - 4)) << 32) |
+                ReadUInt32(bytePtr + numBytes - 4 - middle);
+        }
+        else if (numBytes > 0)
+        {
+            a = ReadUpTo3Bytes(bytePtr, numBytes);
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        size_t remaining = numBytes;
+
+        if (remaining >= 48)
+        {
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+
+            do
+            {
+                seed = Mix64(ReadUInt64(bytePtr) ^ Secret[1], ReadUInt64(bytePtr + 8) ^ seed);
+                seed1 = Mix64(ReadUInt64(bytePtr + 16) ^ Secret[2],
+                              ReadUInt64(bytePtr + 24) ^ seed1);
+                seed2 = Mix64(ReadUInt64(bytePtr + 32) ^ Secret[3],
+                              ReadUInt64(bytePtr + 40) ^ seed2);
+                bytePtr += 48;
+                remaining -= 48;
+            }
+            while (remaining >= 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = Mix64(ReadUInt64(bytePtr) ^ Secret[1], ReadUInt64(bytePtr + 8) ^ seed);
+            bytePtr += 16;
+            remaining -= 16;
+        }
+
+        a = ReadUInt64(bytePtr + remaining - 16);
+        b = ReadUInt64(bytePtr + remaining - 8);
+    }
+
+    a ^= Secret[1];
+    b ^= seed;
+
+    __uint128_t product = (__uint128_t)a * b;
+
+    return Mix64(((uint64_t)product) ^ Secret[0] ^ numBytes,
+                 ((uint64_t)(product >> 64)) ^ Secret[1]);
+}
+#else
+//--------------------------------------------------------------------------------------------------
+/**
+ * 32-bit CPUs use wyhash32, which only needs 32x32->64 bit multiplies (a single UMULL on ARM).
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void Mix32(uint32_t* aPtr, uint32_t* bPtr)
+{
+    uint64_t product = (uint64_t)(*aPtr ^ 0x53c5ca59U) * (*bPtr ^ 0x74743c1bU);
+
+    *aPtr = (uint32_t)product;
+    *bPtr = (uint32_t)(product >> 32);
+}
+
+static size_t HashBytes
+(
+    const uint8_t* bytePtr,
+    size_t numBytes
+)
+{
+    size_t remaining = numBytes;
+    uint32_t seed = 0;
+    uint32_t seed1 = (uint32_t)numBytes;
+
+    Mix32(&seed, &seed1);
+
+    for (; remaining > 8; remaining -= 8, bytePtr += 8)
+    {
+        seed ^= ReadUInt32(bytePtr);
+        seed1 ^= ReadUInt32(bytePtr + 4);
+        Mix32(&seed, &seed1);
+    }
+
+    if (remaining >= 4)
+    {
+        seed ^= ReadUInt32(bytePtr);
+        seed1 ^= ReadUInt32(bytePtr + remaining - 4);
+    }
+    else if (remaining > 0)
+    {
+        seed ^= ReadUpTo3Bytes(bytePtr, remaining);
+    }
+
+    Mix32(&seed, &seed1);
+    Mix32(&seed, &seed1);
+
+    return seed ^ seed1;
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hash a block of bytes with the same function as le_hashmap_HashString(), so that the hash of a
+ * string that isn't null-terminated can be compared with hashes made by le_hashmap_HashString().
+ *
+ * @return  Returns the hash value of the bytes
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+
+size_t le_hashmap_HashBytes
+(
+    const void* bytesPtr,    ///< [in] Pointer to the bytes to be hashed
+    size_t numBytes          ///< [in] Number of bytes to hash
+)
+{
+    return HashBytes(bytesPtr, numBytes);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * String hashing function. This can be used as a parameter to le_hashmap_Create if the key to
@@ -1293,8 +1814,7 @@ size_t le_hashmap_HashString
     const void* stringToHashPtr    ///< [in] Pointer to the string to be hashed
 )
 {
-    int len = le_utf8_NumBytes(stringToHashPtr);
-    return SuperFastHash(stringToHashPtr, len);
+    return HashBytes(stringToHashPtr, strlen(stringToHashPtr));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -56,24 +56,33 @@ static inline void SafeStrAppend
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Convert a numeric value into a uppercase character representing the hexidecimal value of the
- * input.
+ * Uppercase hexadecimal characters, indexed by their value.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char HexChars[16] = "0123456789ABCDEF";
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a hexadecimal character [0-9a-fA-F] into its numeric value.
  *
- * @return Hexidecimal character in the range [0-9A-F] or 0 if the input value was too large
+ * @return Value in the range [0-15] or -1 if the input is not a hexadecimal character
  */
 //--------------------------------------------------------------------------------------------------
-static char DecToHex(uint8_t hex)
+static inline int HexToDec(char hex)
 {
-    if (hex < 10) {
-        return (char)('0'+hex);  // for number
+    if (hex >= '0' && hex <= '9')
+    {
+        return hex - '0';
     }
-    else if (hex < 16) {
-        return (char)('A'+hex-10);  // for A,B,C,D,E,F
+    else if (hex >= 'a' && hex <= 'f')
+    {
+        return hex - 'a' + 10;
     }
-    else {
-        LE_DEBUG("value %u cannot be converted in HEX string", hex);
-        return 0;
+    else if (hex >= 'A' && hex <= 'F')
+    {
+        return hex - 'A' + 10;
     }
+    return -1;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -99,9 +108,8 @@ int32_t le_hex_StringToBinary
 {
     uint32_t idxString;
     uint32_t idxBinary;
-    char*    refStrPtr = "0123456789ABCDEF";
 
-    if (stringLength > strlen(stringPtr))
+    if (stringLength > strnlen(stringPtr, stringLength))
     {
         LE_DEBUG("The stringLength (%" PRIu32 ") is more than size of stringPtr (%s)",
                  stringLength, stringPtr);
@@ -126,13 +134,12 @@ int32_t le_hex_StringToBinary
 
     for (idxString=0,idxBinary=0 ; idxString<stringLength ; idxString+=2,idxBinary++)
     {
-        char* ch1Ptr = strchr(refStrPtr, toupper(stringPtr[idxString]));
-        char* ch2Ptr = strchr(refStrPtr, toupper((int)stringPtr[idxString+1]));
+        int high = HexToDec(stringPtr[idxString]);
+        int low = HexToDec(stringPtr[idxString+1]);
 
-        if ( (ch1Ptr && *ch1Ptr) && (ch2Ptr && *ch2Ptr) )
+        if ((high >= 0) && (low >= 0))
         {
-            binaryPtr[idxBinary] = ((ch2Ptr - refStrPtr) & 0x0F) |
-                                   (((ch1Ptr - refStrPtr)<<4) & 0xF0);
+            binaryPtr[idxBinary] = (uint8_t)((high << 4) | low);
         }
         else
         {
@@ -177,8 +184,8 @@ int32_t le_hex_BinaryToString
         idxBinary<binarySize;
         idxBinary++,idxString=idxString+2)
     {
-        stringPtr[idxString]   = DecToHex( (binaryPtr[idxBinary]>>4) & 0x0F);
-        stringPtr[idxString+1] = DecToHex(  binaryPtr[idxBinary]     & 0x0F);
+        stringPtr[idxString]   = HexChars[(binaryPtr[idxBinary]>>4) & 0x0F];
+        stringPtr[idxString+1] = HexChars[ binaryPtr[idxBinary]     & 0x0F];
     }
     stringPtr[idxString] = '\0';
 
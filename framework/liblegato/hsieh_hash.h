@@ -1,9 +0,0 @@
-/**
- * Copyright (c) 2010, Paul Hsieh
- * All rights reserved.
- *
- * Licensed under the Paul Hsieh derivative license which is available at
- * http://www.azillionmonkeys.com/qed/weblicense.html
- */
-
-size_t SuperFastHash (const char * data, int len);
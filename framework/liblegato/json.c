@@ -8,6 +8,10 @@
 
 #include "legato.h"
 
+#if LE_CONFIG_LINUX
+#   include <sys/mman.h>
+#endif
+
 
 /// Maximum number of bytes allowed in a string value, object member name, or number's text
 /// including the null terminator.
@@ -1448,3 +1452,524 @@ le_json_ParsingSessionRef_t le_json_GetSession
 {
     return GetCurrentParser(__func__);
 }
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * One component of a query path.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool isIndex;           ///< true to select array elements, false to select object members.
+    bool isWildcard;        ///< true to select all elements or members.
+    const char* namePtr;    ///< Name of the member to select (not null-terminated).
+    size_t nameLen;         ///< Length of the member name.
+    size_t index;           ///< Index of the element to select.
+}
+PathComponent_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of a path query.  Queries are synchronous, so this lives on the caller's stack.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char* ptr;                ///< Next character of the document to scan.
+    const char* endPtr;             ///< End of the document.
+    PathComponent_t path[LE_JSON_QUERY_MAX_DEPTH];  ///< Components of the query path.
+    size_t pathLen;                 ///< Number of components in the path.
+    le_json_QueryHandler_t handler; ///< Function to call for each matching value.
+    void* contextPtr;               ///< Context pointer passed to the handler.
+    bool stopped;                   ///< true if the handler stopped the query.
+}
+Query_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Split a query path into its components.
+ *
+ * @return
+ *      - LE_OK             The path is valid.
+ *      - LE_BAD_PARAMETER  The path is invalid or has too many components.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ParsePath
+(
+    Query_t* queryPtr,
+    const char* pathPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const char* ptr = pathPtr;
+
+    queryPtr->pathLen = 0;
+
+    while (*ptr != '\0')
+    {
+        if (queryPtr->pathLen >= LE_JSON_QUERY_MAX_DEPTH)
+        {
+            LE_ERROR("Too many components in JSON path '%s'.", pathPtr);
+            return LE_BAD_PARAMETER;
+        }
+
+        PathComponent_t* componentPtr = &queryPtr->path[queryPtr->pathLen];
+        memset(componentPtr, 0, sizeof(*componentPtr));
+
+        if (*ptr == '[')
+        {
+            ptr++;
+            componentPtr->isIndex = true;
+            if (*ptr == '*')
+            {
+                componentPtr->isWildcard = true;
+                ptr++;
+            }
+            else if (isdigit((unsigned char)*ptr))
+            {
+                char* endPtr;
+                componentPtr->index = strtoul(ptr, &endPtr, 10);
+                ptr = endPtr;
+            }
+            if (*ptr != ']')
+            {
+                LE_ERROR("Invalid array index in JSON path '%s'.", pathPtr);
+                return LE_BAD_PARAMETER;
+            }
+            ptr++;
+        }
+        else
+        {
+            // Member names are separated by a '.', except at the start of the path.
+            if (*ptr == '.')
+            {
+                ptr++;
+            }
+            else if (ptr != pathPtr)
+            {
+                LE_ERROR("Expected '.' or '[' in JSON path '%s'.", pathPtr);
+                return LE_BAD_PARAMETER;
+            }
+
+            componentPtr->namePtr = ptr;
+            componentPtr->nameLen = strcspn(ptr, ".[");
+            if (componentPtr->nameLen == 0)
+            {
+                LE_ERROR("Empty member name in JSON path '%s'.", pathPtr);
+                return LE_BAD_PARAMETER;
+            }
+            componentPtr->isWildcard = ((componentPtr->nameLen == 1) && (*ptr == '*'));
+            ptr += componentPtr->nameLen;
+        }
+
+        queryPtr->pathLen++;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Skip whitespace in the document.
+ *
+ * @return The next character, or '\0' at the end of the document.
+ */
+//--------------------------------------------------------------------------------------------------
+static char SkipSpace
+(
+    Query_t* queryPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    while ((queryPtr->ptr < queryPtr->endPtr) && isspace((unsigned char)*queryPtr->ptr))
+    {
+        queryPtr->ptr++;
+    }
+
+    return (queryPtr->ptr < queryPtr->endPtr) ? *queryPtr->ptr : '\0';
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Scan a string starting at the current '"' character, and move past its closing '"'.
+ *
+ * @return
+ *      - LE_OK             The string was scanned.
+ *      - LE_FORMAT_ERROR   The string is not terminated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ScanString
+(
+    Query_t* queryPtr,
+    const char** textPtrPtr,    ///< [OUT] Start of the string contents.
+    size_t* textLenPtr          ///< [OUT] Length of the string contents.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const char* ptr = queryPtr->ptr + 1;
+
+    while (ptr < queryPtr->endPtr)
+    {
+        if (*ptr == '"')
+        {
+            *textPtrPtr = queryPtr->ptr + 1;
+            *textLenPtr = ptr - *textPtrPtr;
+            queryPtr->ptr = ptr + 1;
+            return LE_OK;
+        }
+        else if (*ptr == '\\')
+        {
+            // Skip the escaped character.
+            ptr++;
+        }
+        ptr++;
+    }
+
+    return LE_FORMAT_ERROR;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Skip the value starting at the current character, without reporting anything.  Objects and
+ * arrays are skipped by only tracking string and bracket boundaries.
+ *
+ * @return
+ *      - LE_OK             The value was skipped.
+ *      - LE_FORMAT_ERROR   The value is not valid.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SkipValue
+(
+    Query_t* queryPtr,
+    le_json_Value_t* valuePtr   ///< [OUT] Type and text of the skipped value.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char c = SkipSpace(queryPtr);
+    const char* startPtr = queryPtr->ptr;
+
+    if (c == '"')
+    {
+        valuePtr->type = LE_JSON_STRING;
+        return ScanString(queryPtr, &valuePtr->textPtr, &valuePtr->textLen);
+    }
+
+    if ((c == '{') || (c == '['))
+    {
+        // Brackets of both kinds are only counted, so mismatched brackets inside a skipped
+        // value are not detected.
+        size_t depth = 0;
+
+        valuePtr->type = (c == '{') ? LE_JSON_OBJECT_START : LE_JSON_ARRAY_START;
+
+        while (queryPtr->ptr < queryPtr->endPtr)
+        {
+            c = *queryPtr->ptr;
+            if (c == '"')
+            {
+                const char* textPtr;
+                size_t textLen;
+                if (ScanString(queryPtr, &textPtr, &textLen) != LE_OK)
+                {
+                    return LE_FORMAT_ERROR;
+                }
+                continue;
+            }
+
+            queryPtr->ptr++;
+            if ((c == '{') || (c == '['))
+            {
+                depth++;
+            }
+            else if ((c == '}') || (c == ']'))
+            {
+                depth--;
+                if (depth == 0)
+                {
+                    valuePtr->textPtr = startPtr;
+                    valuePtr->textLen = queryPtr->ptr - startPtr;
+                    return LE_OK;
+                }
+            }
+        }
+
+        return LE_FORMAT_ERROR;
+    }
+
+    // Numbers and constants run until the next separator.
+    while ((queryPtr->ptr < queryPtr->endPtr) &&
+           (isalnum((unsigned char)*queryPtr->ptr) || (strchr("+-.", *queryPtr->ptr) != NULL)))
+    {
+        queryPtr->ptr++;
+    }
+
+    valuePtr->textPtr = startPtr;
+    valuePtr->textLen = queryPtr->ptr - startPtr;
+
+    if ((valuePtr->textLen == 4) && (memcmp(startPtr, "true", 4) == 0))
+    {
+        valuePtr->type = LE_JSON_TRUE;
+    }
+    else if ((valuePtr->textLen == 5) && (memcmp(startPtr, "false", 5) == 0))
+    {
+        valuePtr->type = LE_JSON_FALSE;
+    }
+    else if ((valuePtr->textLen == 4) && (memcmp(startPtr, "null", 4) == 0))
+    {
+        valuePtr->type = LE_JSON_NULL;
+    }
+    else if ((valuePtr->textLen != 0) && ((c == '-') || isdigit((unsigned char)c)))
+    {
+        valuePtr->type = LE_JSON_NUMBER;
+    }
+    else
+    {
+        return LE_FORMAT_ERROR;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Scan the value starting at the current character, reporting the parts of it which match the
+ * query path from a given depth.
+ *
+ * @return
+ *      - LE_OK             The value was scanned.
+ *      - LE_FORMAT_ERROR   The value is not valid.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t QueryValue
+(
+    Query_t* queryPtr,
+    size_t depth        ///< Number of path components already matched.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_json_Value_t value;
+    char c = SkipSpace(queryPtr);
+
+    if (depth == queryPtr->pathLen)
+    {
+        // The whole path matched: report this value.
+        le_result_t result = SkipValue(queryPtr, &value);
+        if ((result == LE_OK) && !queryPtr->handler(&value, queryPtr->contextPtr))
+        {
+            queryPtr->stopped = true;
+        }
+        return result;
+    }
+
+    const PathComponent_t* componentPtr = &queryPtr->path[depth];
+
+    if ((c == '{') && !componentPtr->isIndex)
+    {
+        queryPtr->ptr++;
+        if (SkipSpace(queryPtr) == '}')
+        {
+            queryPtr->ptr++;
+            return LE_OK;
+        }
+
+        for (;;)
+        {
+            const char* namePtr;
+            size_t nameLen;
+            le_result_t result;
+
+            if ((SkipSpace(queryPtr) != '"') ||
+                (ScanString(queryPtr, &namePtr, &nameLen) != LE_OK) ||
+                (SkipSpace(queryPtr) != ':'))
+            {
+                return LE_FORMAT_ERROR;
+            }
+            queryPtr->ptr++;
+
+            if (componentPtr->isWildcard ||
+                ((nameLen == componentPtr->nameLen) &&
+                 (memcmp(namePtr, componentPtr->namePtr, nameLen) == 0)))
+            {
+                result = QueryValue(queryPtr, depth + 1);
+            }
+            else
+            {
+                result = SkipValue(queryPtr, &value);
+            }
+            if ((result != LE_OK) || queryPtr->stopped)
+            {
+                return result;
+            }
+
+            c = SkipSpace(queryPtr);
+            queryPtr->ptr++;
+            if (c == '}')
+            {
+                return LE_OK;
+            }
+            else if (c != ',')
+            {
+                return LE_FORMAT_ERROR;
+            }
+        }
+    }
+
+    if ((c == '[') && componentPtr->isIndex)
+    {
+        size_t index;
+
+        queryPtr->ptr++;
+        if (SkipSpace(queryPtr) == ']')
+        {
+            queryPtr->ptr++;
+            return LE_OK;
+        }
+
+        for (index = 0; ; index++)
+        {
+            le_result_t result;
+
+            if (componentPtr->isWildcard || (index == componentPtr->index))
+            {
+                result = QueryValue(queryPtr, depth + 1);
+            }
+            else
+            {
+                result = SkipValue(queryPtr, &value);
+            }
+            if ((result != LE_OK) || queryPtr->stopped)
+            {
+                return result;
+            }
+
+            c = SkipSpace(queryPtr);
+            queryPtr->ptr++;
+            if (c == ']')
+            {
+                return LE_OK;
+            }
+            else if (c != ',')
+            {
+                return LE_FORMAT_ERROR;
+            }
+        }
+    }
+
+    // This value can't match the rest of the path.
+    return SkipValue(queryPtr, &value);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Synchronously find the values matching a path in a JSON document held in memory.
+ *
+ * @return
+ *      - LE_OK             The document was scanned (or the handler stopped the query).
+ *      - LE_BAD_PARAMETER  The path is invalid.
+ *      - LE_FORMAT_ERROR   The document is not valid JSON.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_json_Query
+(
+    const char* bufferPtr,          ///< JSON document.
+    size_t bufferSize,              ///< Size of the JSON document in bytes.
+    const char* pathPtr,            ///< Path of the values to find (see @ref c_json_query).
+    le_json_QueryHandler_t handler, ///< Function to call for each matching value.
+    void* contextPtr                ///< Context pointer passed to the handler.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Query_t query;
+
+    LE_ASSERT(pathPtr != NULL);
+    LE_ASSERT(handler != NULL);
+
+    le_result_t result = ParsePath(&query, pathPtr);
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
+    query.ptr = bufferPtr;
+    query.endPtr = bufferPtr + bufferSize;
+    query.handler = handler;
+    query.contextPtr = contextPtr;
+    query.stopped = false;
+
+    char c = SkipSpace(&query);
+    if ((c != '{') && (c != '['))
+    {
+        LE_ERROR("Document must start with '{' or '['.");
+        return LE_FORMAT_ERROR;
+    }
+
+    result = QueryValue(&query, 0);
+    if (result != LE_OK)
+    {
+        LE_ERROR("Invalid JSON document (at offset %" PRIuS ").", (size_t)(query.ptr - bufferPtr));
+    }
+
+    return result;
+}
+
+
+#if LE_CONFIG_LINUX
+//--------------------------------------------------------------------------------------------------
+/**
+ * Synchronously find the values matching a path in a JSON document read from a regular file.
+ *
+ * @return
+ *      - LE_OK             The document was scanned (or the handler stopped the query).
+ *      - LE_BAD_PARAMETER  The path is invalid.
+ *      - LE_FORMAT_ERROR   The document is not valid JSON.
+ *      - LE_FAULT          The file could not be mapped into memory.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_json_QueryFd
+(
+    int fd,                         ///< File descriptor to read the JSON document from.
+    const char* pathPtr,            ///< Path of the values to find (see @ref c_json_query).
+    le_json_QueryHandler_t handler, ///< Function to call for each matching value.
+    void* contextPtr                ///< Context pointer passed to the handler.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    struct stat st;
+
+    if ((fstat(fd, &st) != 0) || !S_ISREG(st.st_mode))
+    {
+        LE_ERROR("JSON document is not a regular file.");
+        return LE_FAULT;
+    }
+
+    if (st.st_size == 0)
+    {
+        LE_ERROR("JSON document is empty.");
+        return LE_FORMAT_ERROR;
+    }
+
+    void* bufferPtr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (bufferPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map JSON document. %m");
+        return LE_FAULT;
+    }
+
+    // The document is scanned once from start to end.
+    madvise(bufferPtr, st.st_size, MADV_SEQUENTIAL);
+
+    le_result_t result = le_json_Query(bufferPtr, st.st_size, pathPtr, handler, contextPtr);
+
+    munmap(bufferPtr, st.st_size);
+
+    return result;
+}
+#endif
@@ -0,0 +1,508 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file jsonWriter.c JSON writer implementation (see @ref c_json_writer).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+
+#include <math.h>
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the contents of the buffer to the file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Flush
+(
+    le_json_Writer_t* writerPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    size_t offset = 0;
+
+    while (offset < writerPtr->used)
+    {
+        ssize_t written = write(writerPtr->fd,
+                                writerPtr->bufferPtr + offset,
+                                writerPtr->used - offset);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            LE_DEBUG("Failed to write JSON output to fd %d (%m).", writerPtr->fd);
+            writerPtr->result = LE_FAULT;
+            break;
+        }
+
+        offset += written;
+    }
+
+    writerPtr->used = 0;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add bytes to the output.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Append
+(
+    le_json_Writer_t* writerPtr,
+    const char* dataPtr,
+    size_t length
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // Without a file descriptor, leave room for the null terminator.
+    size_t capacity = (writerPtr->fd < 0) ? (writerPtr->bufferSize - 1) : writerPtr->bufferSize;
+
+    while ((length > 0) && (writerPtr->result == LE_OK))
+    {
+        if (writerPtr->used == capacity)
+        {
+            if (writerPtr->fd < 0)
+            {
+                writerPtr->result = LE_OVERFLOW;
+                break;
+            }
+
+            Flush(writerPtr);
+        }
+
+        size_t chunk = capacity - writerPtr->used;
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+
+        memcpy(writerPtr->bufferPtr + writerPtr->used, dataPtr, chunk);
+        writerPtr->used += chunk;
+        dataPtr += chunk;
+        length -= chunk;
+    }
+
+    if (writerPtr->fd < 0)
+    {
+        writerPtr->bufferPtr[writerPtr->used] = '\0';
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a single byte to the output.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void AppendChar
+(
+    le_json_Writer_t* writerPtr,
+    char c
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Append(writerPtr, &c, 1);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a quoted, escaped string to the output.  Runs of characters that don't need escaping are
+ * copied in one go.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AppendString
+(
+    le_json_Writer_t* writerPtr,
+    const char* stringPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    AppendChar(writerPtr, '"');
+
+    for (;;)
+    {
+        const char* runPtr = stringPtr;
+        unsigned char c;
+
+        while (((c = (unsigned char)*stringPtr) >= 0x20) && (c != '"') && (c != '\\'))
+        {
+            stringPtr++;
+        }
+
+        Append(writerPtr, runPtr, stringPtr - runPtr);
+
+        if (c == '\0')
+        {
+            break;
+        }
+
+        char escape[7];
+        switch (c)
+        {
+            case '"':   memcpy(escape, "\\\"", 3); break;
+            case '\\':  memcpy(escape, "\\\\", 3); break;
+            case '\b':  memcpy(escape, "\\b", 3);  break;
+            case '\f':  memcpy(escape, "\\f", 3);  break;
+            case '\n':  memcpy(escape, "\\n", 3);  break;
+            case '\r':  memcpy(escape, "\\r", 3);  break;
+            case '\t':  memcpy(escape, "\\t", 3);  break;
+            default:    snprintf(escape, sizeof(escape), "\\u%04x", c); break;
+        }
+        Append(writerPtr, escape, strlen(escape));
+
+        stringPtr++;
+    }
+
+    AppendChar(writerPtr, '"');
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get ready to write a value or member name: add a comma if something was written before it at
+ * the same level.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartItem
+(
+    le_json_Writer_t* writerPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (writerPtr->isAfterMember)
+    {
+        writerPtr->isAfterMember = false;
+        return;
+    }
+
+    uint32_t bit = ((uint32_t)1) << writerPtr->depth;
+
+    if (writerPtr->hasValueMask & bit)
+    {
+        AppendChar(writerPtr, ',');
+    }
+    writerPtr->hasValueMask |= bit;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the start of an object or array.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartContainer
+(
+    le_json_Writer_t* writerPtr,
+    char bracket
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StartItem(writerPtr);
+
+    if (writerPtr->depth >= LE_JSON_WRITER_MAX_DEPTH)
+    {
+        if (writerPtr->result == LE_OK)
+        {
+            writerPtr->result = LE_OVERFLOW;
+        }
+        return;
+    }
+
+    AppendChar(writerPtr, bracket);
+
+    writerPtr->depth++;
+    writerPtr->hasValueMask &= ~(((uint32_t)1) << writerPtr->depth);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the end of an object or array.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndContainer
+(
+    le_json_Writer_t* writerPtr,
+    char bracket
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (writerPtr->depth > 0)
+    {
+        writerPtr->depth--;
+    }
+
+    writerPtr->isAfterMember = false;
+    AppendChar(writerPtr, bracket);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set up a JSON writer.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_InitWriter
+(
+    le_json_Writer_t* writerPtr,    ///< [OUT] Writer to set up.
+    int fd,                         ///< [IN] File descriptor to write to, or -1.
+    char* bufferPtr,                ///< [IN] Buffer to compose the output in.
+    size_t bufferSize               ///< [IN] Size of the buffer, in bytes.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(writerPtr != NULL);
+    LE_ASSERT((bufferPtr != NULL) && (bufferSize > 1));
+
+    writerPtr->fd = fd;
+    writerPtr->bufferPtr = bufferPtr;
+    writerPtr->bufferSize = bufferSize;
+    writerPtr->used = 0;
+    writerPtr->depth = 0;
+    writerPtr->hasValueMask = 0;
+    writerPtr->isAfterMember = false;
+    writerPtr->result = LE_OK;
+
+    if (fd < 0)
+    {
+        bufferPtr[0] = '\0';
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the start of an object ('{').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_StartObject
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StartContainer(writerPtr, '{');
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the end of an object ('}').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_EndObject
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    EndContainer(writerPtr, '}');
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the start of an array ('[').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_StartArray
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StartContainer(writerPtr, '[');
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the end of an array (']').
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_EndArray
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    EndContainer(writerPtr, ']');
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the name of an object member.  Its value must be written next.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteMember
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    const char* namePtr             ///< [IN] Member name (UTF-8).
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StartItem(writerPtr);
+    AppendString(writerPtr, namePtr);
+    AppendChar(writerPtr, ':');
+
+    writerPtr->isAfterMember = true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a string value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteString
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    const char* stringPtr           ///< [IN] String (UTF-8).
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StartItem(writerPtr);
+    AppendString(writerPtr, stringPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a signed integer value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteInt
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    int64_t value                   ///< [IN] Value.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char text[24];
+    int length = snprintf(text, sizeof(text), "%" PRId64, value);
+
+    StartItem(writerPtr);
+    Append(writerPtr, text, length);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write an unsigned integer value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteUint
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    uint64_t value                  ///< [IN] Value.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char text[24];
+    int length = snprintf(text, sizeof(text), "%" PRIu64, value);
+
+    StartItem(writerPtr);
+    Append(writerPtr, text, length);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a number value.  Infinities and NaN, which JSON can't represent, are written as null.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteNumber
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    double value                    ///< [IN] Value.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (!isfinite(value))
+    {
+        le_json_WriteNull(writerPtr);
+        return;
+    }
+
+    char text[32];
+    int length = snprintf(text, sizeof(text), "%.17g", value);
+
+    StartItem(writerPtr);
+    Append(writerPtr, text, length);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a true or false value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteBool
+(
+    le_json_Writer_t* writerPtr,    ///< [IN] Writer.
+    bool value                      ///< [IN] Value.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StartItem(writerPtr);
+
+    if (value)
+    {
+        Append(writerPtr, "true", 4);
+    }
+    else
+    {
+        Append(writerPtr, "false", 5);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a null value.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_json_WriteNull
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    StartItem(writerPtr);
+    Append(writerPtr, "null", 4);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finish writing: write whatever is left in the buffer to the file descriptor, if there is one.
+ *
+ * @return
+ *      - LE_OK         Everything was written.
+ *      - LE_OVERFLOW   The output didn't fit in the buffer (no file descriptor), or objects and
+ *                      arrays were nested more than LE_JSON_WRITER_MAX_DEPTH deep.
+ *      - LE_FAULT      Writing to the file descriptor failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_json_FinishWriter
+(
+    le_json_Writer_t* writerPtr     ///< [IN] Writer.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if ((writerPtr->fd >= 0) && (writerPtr->result == LE_OK))
+    {
+        Flush(writerPtr);
+    }
+
+    return writerPtr->result;
+}
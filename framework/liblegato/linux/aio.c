@@ -0,0 +1,960 @@
+//--------------------------------------------------------------------------------------------------
+/** @file aio.c
+ *
+ * Asynchronous file I/O.  See le_aio.h for the API.
+ *
+ * Requests are carried out in one of two ways:
+ *
+ * - With io_uring (if LE_CONFIG_AIO_IO_URING is enabled): each thread that queues requests gets
+ *   a Ring_t, holding an io_uring and an eventfd registered with it.  An FD Monitor on the eventfd
+ *   runs in the thread's own event loop, reaps the completions and calls the handlers directly.
+ *   Requests that don't fit in the ring wait on the ring's backlog until earlier ones complete.
+ *   Short transfers are resubmitted for the remaining bytes.
+ *
+ * - With worker threads: the request is put on a queue shared by the whole process and carried
+ *   out with blocking pread()/pwrite()/fsync() calls by one of LE_CONFIG_AIO_THREADS worker
+ *   threads, which are started when the first request is queued.  The worker then queues the
+ *   completion to the requesting thread with le_event_QueueFunctionToThread().
+ *
+ * Worker threads are also used by threads whose io_uring couldn't be set up (e.g., because the
+ * kernel is too old or was built without io_uring support).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "aio.h"
+
+#if LE_CONFIG_AIO_IO_URING
+#   include <linux/io_uring.h>
+#   include <sys/eventfd.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   include <sys/uio.h>
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of worker threads carrying out requests that don't go through an io_uring.
+ */
+//--------------------------------------------------------------------------------------------------
+#define WORKER_COUNT                LE_CONFIG_AIO_THREADS
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of requests for which memory is reserved when the module is initialized.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DEFAULT_REQUEST_POOL_SIZE   8
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kinds of requests.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    OP_READ,    ///< Read into the buffer.
+    OP_WRITE,   ///< Write the buffer.
+    OP_SYNC     ///< Flush the file to storage.
+}
+Op_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A queued request.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t               link;       ///< Link in the work queue or a ring's backlog.
+    Op_t                        op;         ///< What to do.
+    int                         fd;         ///< File descriptor to do it on.
+    uint8_t                    *bufPtr;     ///< Buffer to read into or write from.
+    size_t                      size;       ///< Number of bytes to transfer.
+    off_t                       offset;     ///< Offset in the file of the first byte to transfer.
+    size_t                      doneCount;  ///< Number of bytes transferred so far.
+    le_result_t                 result;     ///< Outcome, once the request is complete.
+    le_aio_CompletionHandler_t  handlerPtr; ///< Completion handler.
+    void                       *contextPtr; ///< Context pointer for the completion handler.
+    le_thread_Ref_t             threadRef;  ///< Thread whose event loop calls the handler.
+#if LE_CONFIG_AIO_IO_URING
+    struct iovec                iov;        ///< Part of the buffer the ring is working on.
+#endif
+}
+Request_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which requests are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t RequestPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Requests waiting for a worker thread.  Protected by WorkQueueMutex.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t WorkQueue = LE_DLS_LIST_INIT;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the work queue and the count of started workers.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_mutex_t WorkQueueMutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Semaphore posted once for every request put on the work queue.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_sem_Ref_t WorkSemRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of worker threads started so far.  Protected by WorkQueueMutex.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t WorkerCount;
+
+
+#if LE_CONFIG_AIO_IO_URING
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of submission queue entries requested for each thread's io_uring.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RING_DEPTH                  LE_CONFIG_AIO_QUEUE_DEPTH
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A thread's io_uring.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int                     ringFd;         ///< The io_uring, or -1 if it couldn't be set up.
+    int                     eventFd;        ///< eventfd signalled when completions are posted.
+    le_fdMonitor_Ref_t      monitorRef;     ///< Monitor of eventFd.
+    void                   *sqRingPtr;      ///< Mapping of the submission queue ring.
+    size_t                  sqRingSize;     ///< Size of the submission queue ring mapping.
+    void                   *cqRingPtr;      ///< Mapping of the completion queue ring.
+    size_t                  cqRingSize;     ///< Size of the completion queue ring mapping.
+    struct io_uring_sqe    *sqeArrayPtr;    ///< Mapping of the submission queue entries.
+    size_t                  sqeArraySize;   ///< Size of the submission queue entries mapping.
+    unsigned               *sqHeadPtr;      ///< Submission queue head (advanced by the kernel).
+    unsigned               *sqTailPtr;      ///< Submission queue tail (advanced by this thread).
+    unsigned                sqMask;         ///< Mask to apply to submission queue indices.
+    unsigned                sqEntries;      ///< Number of submission queue entries.
+    unsigned               *sqIndexArrayPtr;///< Submission queue index array.
+    unsigned               *cqHeadPtr;      ///< Completion queue head (advanced by this thread).
+    unsigned               *cqTailPtr;      ///< Completion queue tail (advanced by the kernel).
+    unsigned                cqMask;         ///< Mask to apply to completion queue indices.
+    struct io_uring_cqe    *cqeArrayPtr;    ///< Completion queue entries.
+    unsigned                unsubmittedCount;///< Entries added to the ring but not yet submitted.
+    unsigned                inFlightCount;  ///< Requests submitted but not yet completed.
+    le_dls_List_t           backlog;        ///< Requests waiting for room in the ring.
+}
+Ring_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which rings are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t RingPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread-local data key for the thread's ring.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_key_t RingKey;
+
+#endif // LE_CONFIG_AIO_IO_URING
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the name of a kind of request, for logging.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* OpName
+(
+    Op_t op     ///< [IN] Kind of request.
+)
+{
+    switch (op)
+    {
+        case OP_READ:   return "read";
+        case OP_WRITE:  return "write";
+        case OP_SYNC:   return "sync";
+    }
+
+    return "unknown";
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records the failure of a request.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetError
+(
+    Request_t* reqPtr,  ///< [IN] The request.
+    int errNum          ///< [IN] The errno value it failed with.
+)
+{
+    reqPtr->result = ((errNum == ENOSPC) || (errNum == EDQUOT)) ? LE_NO_MEMORY : LE_FAULT;
+
+    errno = errNum;
+    LE_ERROR("Asynchronous %s of %zu bytes at offset %jd on fd %d failed (%m).",
+             OpName(reqPtr->op),
+             reqPtr->size,
+             (intmax_t)reqPtr->offset,
+             reqPtr->fd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calls a completed request's handler and releases the request.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompleteRequest
+(
+    Request_t* reqPtr   ///< [IN] The request.
+)
+{
+    le_aio_CompletionHandler_t handlerPtr = reqPtr->handlerPtr;
+    le_result_t result = reqPtr->result;
+    size_t doneCount = reqPtr->doneCount;
+    void* contextPtr = reqPtr->contextPtr;
+
+    le_mem_Release(reqPtr);
+
+    handlerPtr(result, doneCount, contextPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queued to the requesting thread by a worker thread when it has finished a request.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WorkDone
+(
+    void* param1Ptr,    ///< [IN] The request.
+    void* param2Ptr     ///< [IN] Not used.
+)
+{
+    LE_UNUSED(param2Ptr);
+
+    CompleteRequest(param1Ptr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Carries out a request with blocking calls.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PerformRequest
+(
+    Request_t* reqPtr   ///< [IN] The request.
+)
+{
+    if (reqPtr->op == OP_SYNC)
+    {
+        if (fsync(reqPtr->fd) != 0)
+        {
+            SetError(reqPtr, errno);
+        }
+        return;
+    }
+
+    while (reqPtr->doneCount < reqPtr->size)
+    {
+        ssize_t count;
+
+        if (reqPtr->op == OP_READ)
+        {
+            count = pread(reqPtr->fd,
+                          reqPtr->bufPtr + reqPtr->doneCount,
+                          reqPtr->size - reqPtr->doneCount,
+                          reqPtr->offset + reqPtr->doneCount);
+        }
+        else
+        {
+            count = pwrite(reqPtr->fd,
+                           reqPtr->bufPtr + reqPtr->doneCount,
+                           reqPtr->size - reqPtr->doneCount,
+                           reqPtr->offset + reqPtr->doneCount);
+        }
+
+        if (count < 0)
+        {
+            if (errno != EINTR)
+            {
+                SetError(reqPtr, errno);
+                return;
+            }
+        }
+        else if (count == 0)
+        {
+            // End of file.  A write can't make progress either.
+            if (reqPtr->op == OP_WRITE)
+            {
+                SetError(reqPtr, EIO);
+            }
+            return;
+        }
+        else
+        {
+            reqPtr->doneCount += count;
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the worker threads.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* WorkerMain
+(
+    void* contextPtr    ///< [IN] Not used.
+)
+{
+    LE_UNUSED(contextPtr);
+
+    for (;;)
+    {
+        le_sem_Wait(WorkSemRef);
+
+        LE_ASSERT(pthread_mutex_lock(&WorkQueueMutex) == 0);
+        le_dls_Link_t* linkPtr = le_dls_Pop(&WorkQueue);
+        LE_ASSERT(pthread_mutex_unlock(&WorkQueueMutex) == 0);
+
+        LE_ASSERT(linkPtr != NULL);
+
+        Request_t* reqPtr = CONTAINER_OF(linkPtr, Request_t, link);
+
+        PerformRequest(reqPtr);
+
+        le_event_QueueFunctionToThread(reqPtr->threadRef, WorkDone, reqPtr, NULL);
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hands a request to the worker threads, starting them if needed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueToWorkers
+(
+    Request_t* reqPtr   ///< [IN] The request.
+)
+{
+    LE_ASSERT(pthread_mutex_lock(&WorkQueueMutex) == 0);
+
+    while (WorkerCount < WORKER_COUNT)
+    {
+        char name[16];
+
+        snprintf(name, sizeof(name), "aio-%zu", WorkerCount);
+
+        le_thread_Start(le_thread_Create(name, WorkerMain, NULL));
+        WorkerCount++;
+    }
+
+    le_dls_Queue(&WorkQueue, &reqPtr->link);
+
+    LE_ASSERT(pthread_mutex_unlock(&WorkQueueMutex) == 0);
+
+    le_sem_Post(WorkSemRef);
+}
+
+
+#if LE_CONFIG_AIO_IO_URING
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Passes entries added to a ring to the kernel.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SubmitToKernel
+(
+    Ring_t* ringPtr     ///< [IN] The thread's ring.
+)
+{
+    while (ringPtr->unsubmittedCount > 0)
+    {
+        int count = syscall(__NR_io_uring_enter, ringPtr->ringFd, ringPtr->unsubmittedCount,
+                            0, 0, NULL, 0);
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // EAGAIN and EBUSY mean the kernel is short of resources or completions have to be
+            // reaped first.  The entries stay in the ring and are submitted with the next ones.
+            LE_CRIT_IF((errno != EAGAIN) && (errno != EBUSY),
+                       "Failed to submit to io_uring (%m).");
+            return;
+        }
+
+        ringPtr->unsubmittedCount -= count;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a request to a thread's ring, or to the ring's backlog if the ring is full.  The request
+ * covers the bytes that have not been transferred yet.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AddToRing
+(
+    Ring_t* ringPtr,    ///< [IN] The thread's ring.
+    Request_t* reqPtr   ///< [IN] The request.
+)
+{
+    unsigned tail = *ringPtr->sqTailPtr;
+    unsigned head = LE_ATOMIC_LOAD(ringPtr->sqHeadPtr, LE_ATOMIC_ORDER_ACQUIRE);
+
+    // The in-flight count is also limited so completions can't overflow the completion queue.
+    if (((tail - head) >= ringPtr->sqEntries) || (ringPtr->inFlightCount >= ringPtr->sqEntries))
+    {
+        le_dls_Queue(&ringPtr->backlog, &reqPtr->link);
+        return;
+    }
+
+    unsigned index = tail & ringPtr->sqMask;
+    struct io_uring_sqe* sqePtr = &ringPtr->sqeArrayPtr[index];
+
+    memset(sqePtr, 0, sizeof(*sqePtr));
+    sqePtr->fd = reqPtr->fd;
+    sqePtr->user_data = (uintptr_t)reqPtr;
+
+    if (reqPtr->op == OP_SYNC)
+    {
+        sqePtr->opcode = IORING_OP_FSYNC;
+    }
+    else
+    {
+        reqPtr->iov.iov_base = reqPtr->bufPtr + reqPtr->doneCount;
+        reqPtr->iov.iov_len = reqPtr->size - reqPtr->doneCount;
+
+        sqePtr->opcode = (reqPtr->op == OP_READ) ? IORING_OP_READV : IORING_OP_WRITEV;
+        sqePtr->off = reqPtr->offset + reqPtr->doneCount;
+        sqePtr->addr = (uintptr_t)&reqPtr->iov;
+        sqePtr->len = 1;
+    }
+
+    ringPtr->sqIndexArrayPtr[index] = index;
+    LE_ATOMIC_STORE(ringPtr->sqTailPtr, tail + 1, LE_ATOMIC_ORDER_RELEASE);
+
+    ringPtr->unsubmittedCount++;
+    ringPtr->inFlightCount++;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Moves as many requests as fit from a ring's backlog into the ring.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DrainBacklog
+(
+    Ring_t* ringPtr     ///< [IN] The thread's ring.
+)
+{
+    le_dls_List_t backlog = ringPtr->backlog;
+    ringPtr->backlog = LE_DLS_LIST_INIT;
+
+    le_dls_Link_t* linkPtr;
+    while ((linkPtr = le_dls_Pop(&backlog)) != NULL)
+    {
+        AddToRing(ringPtr, CONTAINER_OF(linkPtr, Request_t, link));
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called by the thread's event loop when its ring has posted completions.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RingEventHandler
+(
+    int fd,         ///< [IN] The ring's eventfd.
+    short events    ///< [IN] Events that occurred.
+)
+{
+    LE_UNUSED(events);
+
+    Ring_t* ringPtr = le_fdMonitor_GetContextPtr();
+    eventfd_t value;
+
+    (void)eventfd_read(fd, &value);
+
+    le_dls_List_t doneList = LE_DLS_LIST_INIT;
+    unsigned head = *ringPtr->cqHeadPtr;
+    unsigned tail = LE_ATOMIC_LOAD(ringPtr->cqTailPtr, LE_ATOMIC_ORDER_ACQUIRE);
+
+    while (head != tail)
+    {
+        struct io_uring_cqe* cqePtr = &ringPtr->cqeArrayPtr[head & ringPtr->cqMask];
+        Request_t* reqPtr = (Request_t*)(uintptr_t)cqePtr->user_data;
+        int res = cqePtr->res;
+
+        head++;
+        ringPtr->inFlightCount--;
+
+        if ((res == -EINTR) || (res == -EAGAIN))
+        {
+            // Try again.
+            le_dls_Queue(&ringPtr->backlog, &reqPtr->link);
+        }
+        else if (res < 0)
+        {
+            SetError(reqPtr, -res);
+            le_dls_Queue(&doneList, &reqPtr->link);
+        }
+        else if (reqPtr->op == OP_SYNC)
+        {
+            le_dls_Queue(&doneList, &reqPtr->link);
+        }
+        else if (res == 0)
+        {
+            // End of file.  A write can't make progress either.
+            if ((reqPtr->op == OP_WRITE) && (reqPtr->doneCount < reqPtr->size))
+            {
+                SetError(reqPtr, EIO);
+            }
+            le_dls_Queue(&doneList, &reqPtr->link);
+        }
+        else
+        {
+            reqPtr->doneCount += res;
+
+            if (reqPtr->doneCount < reqPtr->size)
+            {
+                // Short transfer.  Go again for the rest.
+                le_dls_Queue(&ringPtr->backlog, &reqPtr->link);
+            }
+            else
+            {
+                le_dls_Queue(&doneList, &reqPtr->link);
+            }
+        }
+    }
+
+    LE_ATOMIC_STORE(ringPtr->cqHeadPtr, head, LE_ATOMIC_ORDER_RELEASE);
+
+    DrainBacklog(ringPtr);
+    SubmitToKernel(ringPtr);
+
+    // Handlers may queue new requests, so they are only called once the ring is consistent.
+    le_dls_Link_t* linkPtr;
+    while ((linkPtr = le_dls_Pop(&doneList)) != NULL)
+    {
+        CompleteRequest(CONTAINER_OF(linkPtr, Request_t, link));
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unmaps and closes everything a ring has set up.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseRing
+(
+    Ring_t* ringPtr     ///< [IN] The ring.
+)
+{
+    if (ringPtr->monitorRef != NULL)
+    {
+        le_fdMonitor_Delete(ringPtr->monitorRef);
+        ringPtr->monitorRef = NULL;
+    }
+    if (ringPtr->sqeArrayPtr != NULL)
+    {
+        munmap(ringPtr->sqeArrayPtr, ringPtr->sqeArraySize);
+        ringPtr->sqeArrayPtr = NULL;
+    }
+    if ((ringPtr->cqRingPtr != NULL) && (ringPtr->cqRingPtr != ringPtr->sqRingPtr))
+    {
+        munmap(ringPtr->cqRingPtr, ringPtr->cqRingSize);
+    }
+    ringPtr->cqRingPtr = NULL;
+    if (ringPtr->sqRingPtr != NULL)
+    {
+        munmap(ringPtr->sqRingPtr, ringPtr->sqRingSize);
+        ringPtr->sqRingPtr = NULL;
+    }
+    if (ringPtr->eventFd >= 0)
+    {
+        close(ringPtr->eventFd);
+        ringPtr->eventFd = -1;
+    }
+    if (ringPtr->ringFd >= 0)
+    {
+        close(ringPtr->ringFd);
+        ringPtr->ringFd = -1;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets up an io_uring for the calling thread.
+ *
+ * @return LE_OK if successful, LE_FAULT otherwise (the ring is left closed).
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t OpenRing
+(
+    Ring_t* ringPtr     ///< [IN] The thread's ring.
+)
+{
+    struct io_uring_params params;
+
+    memset(&params, 0, sizeof(params));
+
+    ringPtr->ringFd = syscall(__NR_io_uring_setup, RING_DEPTH, &params);
+    if (ringPtr->ringFd < 0)
+    {
+        LE_INFO("io_uring not available (%m); using worker threads for asynchronous file I/O.");
+        return LE_FAULT;
+    }
+
+    ringPtr->sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    ringPtr->cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    ringPtr->sqeArraySize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    bool isSingleMmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        isSingleMmap = true;
+        if (ringPtr->cqRingSize > ringPtr->sqRingSize)
+        {
+            ringPtr->sqRingSize = ringPtr->cqRingSize;
+        }
+    }
+#endif
+
+    void* mapPtr = mmap(NULL, ringPtr->sqRingSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ringPtr->ringFd, IORING_OFF_SQ_RING);
+    if (mapPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map io_uring submission queue (%m).");
+        CloseRing(ringPtr);
+        return LE_FAULT;
+    }
+    ringPtr->sqRingPtr = mapPtr;
+
+    if (isSingleMmap)
+    {
+        ringPtr->cqRingPtr = ringPtr->sqRingPtr;
+    }
+    else
+    {
+        mapPtr = mmap(NULL, ringPtr->cqRingSize, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ringPtr->ringFd, IORING_OFF_CQ_RING);
+        if (mapPtr == MAP_FAILED)
+        {
+            LE_ERROR("Failed to map io_uring completion queue (%m).");
+            CloseRing(ringPtr);
+            return LE_FAULT;
+        }
+        ringPtr->cqRingPtr = mapPtr;
+    }
+
+    mapPtr = mmap(NULL, ringPtr->sqeArraySize, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, ringPtr->ringFd, IORING_OFF_SQES);
+    if (mapPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map io_uring submission queue entries (%m).");
+        CloseRing(ringPtr);
+        return LE_FAULT;
+    }
+    ringPtr->sqeArrayPtr = mapPtr;
+
+    uint8_t* sqPtr = ringPtr->sqRingPtr;
+    uint8_t* cqPtr = ringPtr->cqRingPtr;
+
+    ringPtr->sqHeadPtr = (unsigned*)(sqPtr + params.sq_off.head);
+    ringPtr->sqTailPtr = (unsigned*)(sqPtr + params.sq_off.tail);
+    ringPtr->sqMask = *(unsigned*)(sqPtr + params.sq_off.ring_mask);
+    ringPtr->sqEntries = *(unsigned*)(sqPtr + params.sq_off.ring_entries);
+    ringPtr->sqIndexArrayPtr = (unsigned*)(sqPtr + params.sq_off.array);
+    ringPtr->cqHeadPtr = (unsigned*)(cqPtr + params.cq_off.head);
+    ringPtr->cqTailPtr = (unsigned*)(cqPtr + params.cq_off.tail);
+    ringPtr->cqMask = *(unsigned*)(cqPtr + params.cq_off.ring_mask);
+    ringPtr->cqeArrayPtr = (struct io_uring_cqe*)(cqPtr + params.cq_off.cqes);
+
+    ringPtr->eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ringPtr->eventFd < 0)
+    {
+        LE_ERROR("Failed to create eventfd (%m).");
+        CloseRing(ringPtr);
+        return LE_FAULT;
+    }
+
+    if (syscall(__NR_io_uring_register, ringPtr->ringFd, IORING_REGISTER_EVENTFD,
+                &ringPtr->eventFd, 1) != 0)
+    {
+        LE_ERROR("Failed to register eventfd with io_uring (%m).");
+        CloseRing(ringPtr);
+        return LE_FAULT;
+    }
+
+    ringPtr->monitorRef = le_fdMonitor_Create("aio", ringPtr->eventFd, RingEventHandler, POLLIN);
+    le_fdMonitor_SetContextPtr(ringPtr->monitorRef, ringPtr);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when a thread that has a ring exits.  Requests still in the ring are abandoned.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DestroyRing
+(
+    void* contextPtr    ///< [IN] The thread's ring.
+)
+{
+    Ring_t* ringPtr = contextPtr;
+
+    if ((ringPtr->inFlightCount > 0) || !le_dls_IsEmpty(&ringPtr->backlog))
+    {
+        LE_WARN("Thread '%s' exited with asynchronous file requests pending.",
+                le_thread_GetMyName());
+    }
+
+    CloseRing(ringPtr);
+    pthread_setspecific(RingKey, NULL);
+    le_mem_Release(ringPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the calling thread's ring, setting it up if this is the thread's first request.
+ *
+ * @return The ring, or NULL if the thread's requests must go to the worker threads.
+ */
+//--------------------------------------------------------------------------------------------------
+static Ring_t* GetRing
+(
+    void
+)
+{
+    Ring_t* ringPtr = pthread_getspecific(RingKey);
+
+    if (ringPtr == NULL)
+    {
+        ringPtr = le_mem_ForceAlloc(RingPool);
+        memset(ringPtr, 0, sizeof(*ringPtr));
+        ringPtr->ringFd = -1;
+        ringPtr->eventFd = -1;
+        ringPtr->backlog = LE_DLS_LIST_INIT;
+
+        // A ring that fails to open stays attached to the thread, so the next request doesn't
+        // try again.
+        (void)OpenRing(ringPtr);
+
+        LE_ASSERT(pthread_setspecific(RingKey, ringPtr) == 0);
+        le_thread_AddDestructor(DestroyRing, ringPtr);
+    }
+
+    return (ringPtr->ringFd >= 0) ? ringPtr : NULL;
+}
+
+#endif // LE_CONFIG_AIO_IO_URING
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a request and starts it.
+ *
+ * @return LE_OK if the request was queued, LE_BAD_PARAMETER otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t StartRequest
+(
+    Op_t op,                                ///< [IN] Kind of request.
+    int fd,                                 ///< [IN] File descriptor.
+    uint8_t* bufPtr,                        ///< [IN] Buffer (NULL for a sync).
+    size_t size,                            ///< [IN] Number of bytes to transfer.
+    off_t offset,                           ///< [IN] Offset in the file.
+    le_aio_CompletionHandler_t handlerPtr,  ///< [IN] Completion handler.
+    void* contextPtr                        ///< [IN] Context pointer for the handler.
+)
+{
+    if ( (fd < 0) ||
+         (handlerPtr == NULL) ||
+         (offset < 0) ||
+         ((op != OP_SYNC) && (bufPtr == NULL) && (size > 0)) )
+    {
+        LE_ERROR("Invalid asynchronous %s request (fd %d, buffer %p, offset %jd).",
+                 OpName(op),
+                 fd,
+                 bufPtr,
+                 (intmax_t)offset);
+        return LE_BAD_PARAMETER;
+    }
+
+    Request_t* reqPtr = le_mem_ForceAlloc(RequestPool);
+
+    reqPtr->link = LE_DLS_LINK_INIT;
+    reqPtr->op = op;
+    reqPtr->fd = fd;
+    reqPtr->bufPtr = bufPtr;
+    reqPtr->size = size;
+    reqPtr->offset = offset;
+    reqPtr->doneCount = 0;
+    reqPtr->result = LE_OK;
+    reqPtr->handlerPtr = handlerPtr;
+    reqPtr->contextPtr = contextPtr;
+    reqPtr->threadRef = le_thread_GetCurrent();
+
+#if LE_CONFIG_AIO_IO_URING
+    Ring_t* ringPtr = GetRing();
+
+    if (ringPtr != NULL)
+    {
+        AddToRing(ringPtr, reqPtr);
+        SubmitToKernel(ringPtr);
+        return LE_OK;
+    }
+#endif
+
+    QueueToWorkers(reqPtr);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a read of up to bufSize bytes from a given offset of a file.
+ *
+ * @return
+ *      - LE_OK if the request was queued.  The handler will be called when it completes.
+ *      - LE_BAD_PARAMETER if a parameter is invalid.  The handler will not be called.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_aio_Read
+(
+    int                         fd,         ///< [IN] File descriptor to read from.
+    void                       *bufPtr,     ///< [OUT] Buffer to read into.  Must stay valid until
+                                            ///<       the handler is called.
+    size_t                      bufSize,    ///< [IN] Number of bytes to read.
+    off_t                       offset,     ///< [IN] Offset in the file to read from.
+    le_aio_CompletionHandler_t  handlerPtr, ///< [IN] Function to call when the read completes.
+    void                       *contextPtr  ///< [IN] Context pointer to pass to the handler.
+)
+{
+    return StartRequest(OP_READ, fd, bufPtr, bufSize, offset, handlerPtr, contextPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a write of bufSize bytes to a given offset of a file.
+ *
+ * @return
+ *      - LE_OK if the request was queued.  The handler will be called when it completes.
+ *      - LE_BAD_PARAMETER if a parameter is invalid.  The handler will not be called.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_aio_Write
+(
+    int                         fd,         ///< [IN] File descriptor to write to.
+    const void                 *bufPtr,     ///< [IN] Data to write.  Must stay valid until the
+                                            ///<      handler is called.
+    size_t                      bufSize,    ///< [IN] Number of bytes to write.
+    off_t                       offset,     ///< [IN] Offset in the file to write to.
+    le_aio_CompletionHandler_t  handlerPtr, ///< [IN] Function to call when the write completes.
+    void                       *contextPtr  ///< [IN] Context pointer to pass to the handler.
+)
+{
+    return StartRequest(OP_WRITE, fd, (uint8_t*)bufPtr, bufSize, offset, handlerPtr, contextPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a flush of a file's data and metadata to storage (see @c fsync()).
+ *
+ * The flush only covers writes that have completed before it is queued.
+ *
+ * @return
+ *      - LE_OK if the request was queued.  The handler will be called when it completes.
+ *      - LE_BAD_PARAMETER if a parameter is invalid.  The handler will not be called.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_aio_Sync
+(
+    int                         fd,         ///< [IN] File descriptor to flush.
+    le_aio_CompletionHandler_t  handlerPtr, ///< [IN] Function to call when the flush completes.
+    void                       *contextPtr  ///< [IN] Context pointer to pass to the handler.
+)
+{
+    return StartRequest(OP_SYNC, fd, NULL, 0, 0, handlerPtr, contextPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the asynchronous file I/O module.  This function is meant to be called from Legato's
+ * internal init.
+ */
+//--------------------------------------------------------------------------------------------------
+void aio_Init
+(
+    void
+)
+{
+    RequestPool = le_mem_CreatePool("AioRequestPool", sizeof(Request_t));
+    le_mem_ExpandPool(RequestPool, DEFAULT_REQUEST_POOL_SIZE);
+
+    WorkSemRef = le_sem_Create("AioWorkSem", 0);
+
+#if LE_CONFIG_AIO_IO_URING
+    RingPool = le_mem_CreatePool("AioRingPool", sizeof(Ring_t));
+    LE_ASSERT(pthread_key_create(&RingKey, NULL) == 0);
+#endif
+}
@@ -18,6 +18,12 @@
  * during the re-naming should keep the original file intact. All the aforementioned steps are
  * followed in this API implementation,
  *
+ * A batch commits several files with a single sync barrier. Before the barrier, a journal listing
+ * every file of the batch (with the inode of its temporary copy) is written to each directory
+ * involved. Once the barrier has passed, the copies are renamed and the journals emptied. If the
+ * process dies while renaming, the next atomic open of a file in any of those directories finds the
+ * journal and finishes the renames, so either all or none of the files in the batch change.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
@@ -43,6 +49,14 @@
 #define LOCK_FILE_EXTENSION       ".lock~~XXXXXX"
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Name of the batch journal file created in each directory a batch writes to
+ */
+//--------------------------------------------------------------------------------------------------
+#define BATCH_JOURNAL_NAME        ".atomBatch~~"
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Temp directory to use for lock file when directory is not writable
@@ -77,11 +91,28 @@ typedef struct
     int tempFd;                           ///< File descriptor of temp file.
     int originFd;                         ///< File descriptor of original file.
     int lockFd;                           ///< File descriptor for lock file.
+    FILE* streamPtr;                      ///< Stream of the temp file, if added to a batch as a
+                                          ///  stream, NULL otherwise.
+    int journalFd;                        ///< File descriptor of the batch journal in this file's
+                                          ///  directory, if this file is the first of the batch
+                                          ///  in that directory, -1 otherwise.
     char filePath[PATH_MAX];              ///< Original file path
 }
 FileAccess_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch of atomic file replacements that are committed together.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_atomFile_Batch
+{
+    le_dls_List_t fileList;               ///< FileAccess_t objects waiting to be committed.
+}
+Batch_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Pool to allocate FileAccess_t objects.
@@ -98,6 +129,14 @@ static le_mem_PoolRef_t FileAccessPool;
 static le_dls_List_t FileAccessList = LE_DLS_LIST_INIT;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool to allocate Batch_t objects.
+ **/
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t BatchPool;
+
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -158,6 +197,8 @@ static void SaveFileData
     accessPtr->originFd = fd;
     accessPtr->lockFd = lockFd;
     accessPtr->tempFd = tempFd;
+    accessPtr->streamPtr = NULL;
+    accessPtr->journalFd = -1;
     LE_ASSERT_OK(le_utf8_Copy(accessPtr->filePath, pathNamePtr, sizeof(accessPtr->filePath), NULL));
     le_dls_Queue(&FileAccessList, &accessPtr->link);
 
@@ -375,6 +416,276 @@ static int OpenLockFile
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the path of the directory containing a file. The current directory is returned if the path
+ * has no directory part.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void GetDirPath
+(
+    const char* filePath,           ///< [IN] Path of the file.
+    char* outDirPath,               ///< [OUT] Path of the containing directory.
+    size_t dirPathSize              ///< [IN] Size of the output buffer.
+)
+{
+    LE_ASSERT_OK(le_path_GetDir(filePath, "/", outDirPath, dirPathSize));
+
+    // le_path_GetDir returns file name when no path is specified.
+    if (!le_dir_IsDir(outDirPath))
+    {
+        LE_ASSERT_OK(le_utf8_Copy(outDirPath, ".", dirPathSize, NULL));
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the canonical absolute path of a file, so that the same file is always named the same way
+ * in batch journals.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if the containing directory can't be resolved or the path is too long.
+ **/
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetAbsPath
+(
+    const char* filePath,           ///< [IN] Path of the file.
+    char* outAbsPath,               ///< [OUT] Absolute path. Must be PATH_MAX bytes.
+    size_t absPathSize              ///< [IN] Size of the output buffer.
+)
+{
+    char dirPath[PATH_MAX];
+    char realDirPath[PATH_MAX];
+
+    GetDirPath(filePath, dirPath, sizeof(dirPath));
+
+    if (realpath(dirPath, realDirPath) == NULL)
+    {
+        LE_CRIT("Failed to resolve directory '%s' (%m).", dirPath);
+        return LE_FAULT;
+    }
+
+    if (snprintf(outAbsPath, absPathSize, "%s/%s",
+                 realDirPath, le_path_GetBasenamePtr(filePath, "/")) >= (int)absPathSize)
+    {
+        LE_CRIT("Path of '%s' is too long.", filePath);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the path of the batch journal for the directory containing a file.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void GetJournalPath
+(
+    const char* filePath,           ///< [IN] Path of a file in the directory.
+    char* outJournalPath,           ///< [OUT] Path of the journal.
+    size_t journalPathSize          ///< [IN] Size of the output buffer.
+)
+{
+    char dirPath[PATH_MAX];
+
+    GetDirPath(filePath, dirPath, sizeof(dirPath));
+
+    LE_ASSERT(snprintf(outJournalPath, journalPathSize, "%s/" BATCH_JOURNAL_NAME, dirPath)
+              < journalPathSize);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finish the commit of a batch whose committer died after its sync barrier, then empty the
+ * journal. The journal must be locked by the caller.
+ *
+ * Each listed file is only renamed if its lock can be taken without blocking (a process holding it
+ * has already recovered it) and its temporary copy is still the one the journal recorded.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ReplayLockedJournal
+(
+    int journalFd,                  ///< [IN] File descriptor of the locked journal.
+    const char* journalPath,        ///< [IN] Path of the batch journal.
+    const char* ownPathPtr          ///< [IN] Absolute path of a file whose lock the caller already
+                                    ///       holds, or NULL.
+)
+{
+    char line[PATH_MAX + 32];
+    le_result_t result;
+
+    while ((result = fd_ReadLine(journalFd, line, sizeof(line))) == LE_OK)
+    {
+        char* pathPtr = NULL;
+        unsigned long long ino = strtoull(line, &pathPtr, 10);
+
+        if ((pathPtr == NULL) || (*pathPtr != '\t'))
+        {
+            LE_CRIT("Malformed entry '%s' in '%s'.", line, journalPath);
+            continue;
+        }
+        pathPtr++;
+
+        int lockFd = -1;
+
+        if ((ownPathPtr == NULL) || (strcmp(pathPtr, ownPathPtr) != 0))
+        {
+            lockFd = OpenLockFile(pathPtr, LE_FLOCK_WRITE, false);
+
+            if (lockFd < 0)
+            {
+                continue;
+            }
+        }
+
+        char tempFilePath[PATH_MAX];
+        struct stat tempStat;
+        GetFilePath(pathPtr, TEMP_FILE_EXTENSION, tempFilePath, sizeof(tempFilePath));
+
+        if ((lstat(tempFilePath, &tempStat) == 0) && (tempStat.st_ino == (ino_t)ino))
+        {
+            if (rename(tempFilePath, pathPtr) == 0)
+            {
+                LE_WARN("Completed interrupted batch commit of '%s'.", pathPtr);
+            }
+            else
+            {
+                LE_CRIT("Failed rename '%s' to '%s' (%m).", tempFilePath, pathPtr);
+            }
+        }
+
+        if (lockFd >= 0)
+        {
+            le_flock_Close(lockFd);
+        }
+
+        // The same batch left a journal in the directory of every file it contains. Journals that
+        // are already locked, including this one, are skipped.
+        char otherJournalPath[PATH_MAX];
+        struct stat journalStat;
+        GetJournalPath(pathPtr, otherJournalPath, sizeof(otherJournalPath));
+
+        if ((stat(otherJournalPath, &journalStat) == 0) && (journalStat.st_size > 0))
+        {
+            int otherJournalFd = le_flock_TryCreate(otherJournalPath,
+                                                    LE_FLOCK_READ_AND_WRITE,
+                                                    LE_FLOCK_OPEN_IF_EXIST,
+                                                    S_IRUSR | S_IWUSR);
+
+            if (otherJournalFd >= 0)
+            {
+                ReplayLockedJournal(otherJournalFd, otherJournalPath, ownPathPtr);
+                le_flock_Close(otherJournalFd);
+            }
+        }
+    }
+
+    if (result != LE_OUT_OF_RANGE)
+    {
+        LE_CRIT("Failed to read batch journal '%s'.", journalPath);
+    }
+    // Journals are emptied rather than deleted, for the same reason lock files are never deleted.
+    else if (ftruncate(journalFd, 0) != 0)
+    {
+        LE_CRIT("Failed to empty batch journal '%s' (%m).", journalPath);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Replay the batch journal at a given path. Nothing is done if the journal is empty, or if it is
+ * locked by another process and blocking wasn't requested.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ReplayJournal
+(
+    const char* journalPath,        ///< [IN] Path of the batch journal.
+    const char* ownPathPtr,         ///< [IN] Absolute path of a file whose lock the caller already
+                                    ///       holds, or NULL.
+    bool blocking                   ///< [IN] true to wait for a process still using the journal.
+)
+{
+    struct stat journalStat;
+
+    if ((stat(journalPath, &journalStat) != 0) || (journalStat.st_size == 0))
+    {
+        return;
+    }
+
+    // A journal lock is held while committing or replaying a batch. While holding it, other locks
+    // are either taken without blocking or, for journal locks, in path order, so waiting for it
+    // can't deadlock.
+    int journalFd = blocking ? le_flock_Create(journalPath,
+                                               LE_FLOCK_READ_AND_WRITE,
+                                               LE_FLOCK_OPEN_IF_EXIST,
+                                               S_IRUSR | S_IWUSR) :
+                               le_flock_TryCreate(journalPath,
+                                                  LE_FLOCK_READ_AND_WRITE,
+                                                  LE_FLOCK_OPEN_IF_EXIST,
+                                                  S_IRUSR | S_IWUSR);
+
+    if (journalFd < 0)
+    {
+        return;
+    }
+
+    ReplayLockedJournal(journalFd, journalPath, ownPathPtr);
+
+    le_flock_Close(journalFd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open and lock the lock file of a file that is about to be accessed, then finish any batch commit
+ * that was interrupted in the file's directory, so that the file is seen with either all or none of
+ * the changes of that batch.
+ *
+ * @return
+ *      A file descriptor for the lock file.
+ *      LE_WOULD_BLOCK if there is already an incompatible lock on the file.
+ *      LE_FAULT if there was an error.
+ **/
+//--------------------------------------------------------------------------------------------------
+static int LockForAccess
+(
+    const char* pathNamePtr,             ///< [IN] Path of the file to access.
+    le_flock_AccessMode_t accessMode,    ///< [IN] The access mode to open the file with.
+    bool blocking                        ///< [IN] true if blocking, false if non-blocking.
+)
+{
+    int lockFd = OpenLockFile(pathNamePtr, accessMode, blocking);
+
+    if (lockFd < 0)
+    {
+        return lockFd;
+    }
+
+    char journalPath[PATH_MAX];
+    struct stat journalStat;
+    GetJournalPath(pathNamePtr, journalPath, sizeof(journalPath));
+
+    // Cheap check first: journals are empty unless a batch commit is in progress or was interrupted.
+    if ((stat(journalPath, &journalStat) == 0) && (journalStat.st_size > 0))
+    {
+        char absPath[PATH_MAX];
+
+        if (GetAbsPath(pathNamePtr, absPath, sizeof(absPath)) == LE_OK)
+        {
+            ReplayJournal(journalPath, absPath, true);
+        }
+    }
+
+    return lockFd;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates temporary file for doing all intermediate operations. This function is used to create
@@ -556,7 +867,7 @@ static int Open
     //     4. Open the temp copy and return the file descriptor.
 
     // Open(or lock) the lockfile.
-    int lockFd = OpenLockFile(pathNamePtr, accessMode, blocking);
+    int lockFd = LockForAccess(pathNamePtr, accessMode, blocking);
 
     if (lockFd < 0)
     {
@@ -667,7 +978,7 @@ static int Create
     char tempFilePath[PATH_MAX];
     GetFilePath(pathNamePtr, TEMP_FILE_EXTENSION, tempFilePath, sizeof(tempFilePath));
 
-    int lockFd = OpenLockFile(pathNamePtr, accessMode, blocking);
+    int lockFd = LockForAccess(pathNamePtr, accessMode, blocking);
 
     if (lockFd < 0)
     {
@@ -988,6 +1299,311 @@ static le_result_t Delete
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close all the files held by a file that was added to a batch and release it.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ReleaseBatchedFile
+(
+    FileAccess_t* accessPtr             ///< [IN] File to release.
+)
+{
+    if (accessPtr->streamPtr != NULL)
+    {
+        le_flock_CloseStream(accessPtr->streamPtr);
+    }
+    else
+    {
+        le_flock_Close(accessPtr->tempFd);
+    }
+
+    if (accessPtr->originFd > -1)
+    {
+        le_flock_Close(accessPtr->originFd);
+    }
+
+    if (accessPtr->journalFd > -1)
+    {
+        le_flock_Close(accessPtr->journalFd);
+    }
+
+    le_flock_Close(accessPtr->lockFd);
+
+    le_mem_Release(accessPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move a file opened for writing from the list of open files to a batch. The file keeps its locks
+ * until the batch is committed or cancelled.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if the file's path couldn't be resolved, in which case its changes are cancelled.
+ **/
+//--------------------------------------------------------------------------------------------------
+static le_result_t AddToBatch
+(
+    Batch_t* batchPtr,                  ///< [IN] Batch to add the file to.
+    FileAccess_t* accessPtr             ///< [IN] File to add.
+)
+{
+    char absPath[PATH_MAX];
+
+    // Journals name files by their absolute path, so that every process finds the same journal
+    // and the same lock file for a given file.
+    if (GetAbsPath(accessPtr->filePath, absPath, sizeof(absPath)) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    LOCK
+
+    le_dls_Remove(&FileAccessList, &accessPtr->link);
+
+    UNLOCK
+
+    LE_ASSERT_OK(le_utf8_Copy(accessPtr->filePath, absPath, sizeof(accessPtr->filePath), NULL));
+    le_dls_Queue(&batchPtr->fileList, &accessPtr->link);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lock the journals of all the directories a batch writes to, recovering any interrupted batch
+ * they still describe, and write the list of the batch's files into each of them.
+ *
+ * Journals are locked in path order so that two batches committing concurrently can't deadlock.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ **/
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteJournals
+(
+    Batch_t* batchPtr                   ///< [IN] Batch being committed.
+)
+{
+    char lastJournalPath[PATH_MAX] = "";
+
+    for (;;)
+    {
+        FileAccess_t* nextPtr = NULL;
+        char nextJournalPath[PATH_MAX] = "";
+        le_dls_Link_t* linkPtr;
+
+        for (linkPtr = le_dls_Peek(&batchPtr->fileList);
+             linkPtr != NULL;
+             linkPtr = le_dls_PeekNext(&batchPtr->fileList, linkPtr))
+        {
+            FileAccess_t* accessPtr = CONTAINER_OF(linkPtr, FileAccess_t, link);
+            char journalPath[PATH_MAX];
+
+            GetJournalPath(accessPtr->filePath, journalPath, sizeof(journalPath));
+
+            if ( (strcmp(journalPath, lastJournalPath) > 0) &&
+                 ((nextPtr == NULL) || (strcmp(journalPath, nextJournalPath) < 0)) )
+            {
+                nextPtr = accessPtr;
+                LE_ASSERT_OK(le_utf8_Copy(nextJournalPath, journalPath,
+                                          sizeof(nextJournalPath), NULL));
+            }
+        }
+
+        if (nextPtr == NULL)
+        {
+            return LE_OK;
+        }
+
+        int journalFd = le_flock_Create(nextJournalPath,
+                                        LE_FLOCK_READ_AND_WRITE,
+                                        LE_FLOCK_OPEN_IF_EXIST,
+                                        S_IRUSR | S_IWUSR);
+        if (journalFd < 0)
+        {
+            LE_CRIT("Failed to open batch journal '%s'.", nextJournalPath);
+            return LE_FAULT;
+        }
+
+        nextPtr->journalFd = journalFd;
+
+        // Whoever wrote a non-empty journal that isn't locked died while committing.
+        ReplayLockedJournal(journalFd, nextJournalPath, NULL);
+
+        if (lseek(journalFd, 0, SEEK_SET) != 0)
+        {
+            LE_CRIT("Failed to rewind batch journal '%s' (%m).", nextJournalPath);
+            return LE_FAULT;
+        }
+
+        for (linkPtr = le_dls_Peek(&batchPtr->fileList);
+             linkPtr != NULL;
+             linkPtr = le_dls_PeekNext(&batchPtr->fileList, linkPtr))
+        {
+            FileAccess_t* accessPtr = CONTAINER_OF(linkPtr, FileAccess_t, link);
+            struct stat tempStat;
+            char line[PATH_MAX + 32];
+
+            if (fstat(accessPtr->tempFd, &tempStat) != 0)
+            {
+                LE_CRIT("Failed to stat temp file of '%s' (%m).", accessPtr->filePath);
+                return LE_FAULT;
+            }
+
+            int len = snprintf(line, sizeof(line), "%llu\t%s\n",
+                               (unsigned long long)tempStat.st_ino, accessPtr->filePath);
+            LE_ASSERT(len < sizeof(line));
+
+            if (fd_WriteSize(journalFd, line, len) != len)
+            {
+                LE_CRIT("Failed to write batch journal '%s'.", nextJournalPath);
+                return LE_FAULT;
+            }
+        }
+
+        LE_ASSERT_OK(le_utf8_Copy(lastJournalPath, nextJournalPath, sizeof(lastJournalPath), NULL));
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Commit all the files of a batch with a single sync barrier per directory, then release the
+ * batch.
+ *
+ * High level algorithm:
+ *    1. Lock and write the journal of every directory the batch writes to.
+ *    2. Sync the file system of each directory once. This syncs the temp copies, the journals and
+ *       the directories.
+ *    3. Rename all the temp copies to their appropriate names.
+ *    4. Empty the journals, close files and release resources.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error, in which case no file was changed unless the error happened
+ *               while renaming.
+ **/
+//--------------------------------------------------------------------------------------------------
+static le_result_t CommitBatch
+(
+    Batch_t* batchPtr                   ///< [IN] Batch to commit.
+)
+{
+    le_result_t result = LE_OK;
+    le_dls_Link_t* linkPtr;
+    char tempFilePath[PATH_MAX];
+
+    if (le_dls_NumLinks(&batchPtr->fileList) == 1)
+    {
+        // No need for a journal, a single rename is atomic.
+        FileAccess_t* accessPtr = CONTAINER_OF(le_dls_Peek(&batchPtr->fileList), FileAccess_t, link);
+        GetFilePath(accessPtr->filePath, TEMP_FILE_EXTENSION, tempFilePath, sizeof(tempFilePath));
+
+        result = SyncFile(accessPtr, tempFilePath);
+        if (result != LE_OK)
+        {
+            DeleteFile(tempFilePath);
+        }
+    }
+    else if (!le_dls_IsEmpty(&batchPtr->fileList))
+    {
+        result = WriteJournals(batchPtr);
+
+        // The sync barrier.
+        for (linkPtr = le_dls_Peek(&batchPtr->fileList);
+             (linkPtr != NULL) && (result == LE_OK);
+             linkPtr = le_dls_PeekNext(&batchPtr->fileList, linkPtr))
+        {
+            FileAccess_t* accessPtr = CONTAINER_OF(linkPtr, FileAccess_t, link);
+
+            if ((accessPtr->journalFd > -1) && (syncfs(accessPtr->journalFd) != 0))
+            {
+                LE_CRIT("Failed to sync file system of '%s' (%m).", accessPtr->filePath);
+                result = LE_FAULT;
+            }
+        }
+
+        // Past the barrier, the journals make the batch complete even if renaming is interrupted.
+        bool isSynced = (result == LE_OK);
+
+        for (linkPtr = le_dls_Peek(&batchPtr->fileList);
+             linkPtr != NULL;
+             linkPtr = le_dls_PeekNext(&batchPtr->fileList, linkPtr))
+        {
+            FileAccess_t* accessPtr = CONTAINER_OF(linkPtr, FileAccess_t, link);
+            GetFilePath(accessPtr->filePath, TEMP_FILE_EXTENSION, tempFilePath,
+                        sizeof(tempFilePath));
+
+            if (!isSynced)
+            {
+                DeleteFile(tempFilePath);
+            }
+            else if (rename(tempFilePath, accessPtr->filePath) != 0)
+            {
+                LE_CRIT("Failed rename '%s' to '%s' (%m).", tempFilePath, accessPtr->filePath);
+                result = LE_FAULT;
+            }
+        }
+
+        // If a rename failed, the journals are kept so that the next access retries it.
+        // Otherwise, emptying a journal is a metadata change ordered after the renames by the file
+        // system's own journal, so it doesn't need a barrier of its own.
+        for (linkPtr = le_dls_Peek(&batchPtr->fileList);
+             (linkPtr != NULL) && ((result == LE_OK) || !isSynced);
+             linkPtr = le_dls_PeekNext(&batchPtr->fileList, linkPtr))
+        {
+            FileAccess_t* accessPtr = CONTAINER_OF(linkPtr, FileAccess_t, link);
+
+            if ((accessPtr->journalFd > -1) && (ftruncate(accessPtr->journalFd, 0) != 0))
+            {
+                LE_CRIT("Failed to empty batch journal of '%s' (%m).", accessPtr->filePath);
+            }
+        }
+    }
+
+    while ((linkPtr = le_dls_Pop(&batchPtr->fileList)) != NULL)
+    {
+        ReleaseBatchedFile(CONTAINER_OF(linkPtr, FileAccess_t, link));
+    }
+
+    le_mem_Release(batchPtr);
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Discard the changes of all the files of a batch and release the batch.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void CancelBatch
+(
+    Batch_t* batchPtr                   ///< [IN] Batch to cancel.
+)
+{
+    le_dls_Link_t* linkPtr;
+
+    while ((linkPtr = le_dls_Pop(&batchPtr->fileList)) != NULL)
+    {
+        FileAccess_t* accessPtr = CONTAINER_OF(linkPtr, FileAccess_t, link);
+        char tempFilePath[PATH_MAX];
+
+        GetFilePath(accessPtr->filePath, TEMP_FILE_EXTENSION, tempFilePath, sizeof(tempFilePath));
+        DeleteFile(tempFilePath);
+
+        ReleaseBatchedFile(accessPtr);
+    }
+
+    le_mem_Release(batchPtr);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Opens an existing file for atomic access operation.
@@ -1179,7 +1795,7 @@ static FILE* OpenStream
     //     3. Create a temp copy of the file and lock that temp copy
     //     4. Open the temp copy and return the file stream
 
-    int lockFd = OpenLockFile(pathNamePtr, accessMode, blocking);
+    int lockFd = LockForAccess(pathNamePtr, accessMode, blocking);
 
     if (lockFd < 0)
     {
@@ -1297,7 +1913,7 @@ static FILE* CreateStream
     char tempFilePath[PATH_MAX];
     GetFilePath(pathNamePtr, TEMP_FILE_EXTENSION, tempFilePath, sizeof(tempFilePath));
 
-    int lockFd = OpenLockFile(pathNamePtr, accessMode, blocking);
+    int lockFd = LockForAccess(pathNamePtr, accessMode, blocking);
 
     if (lockFd < 0)
     {
@@ -1746,6 +2362,165 @@ le_result_t le_atomFile_TryDelete
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a batch of atomic file replacements that are committed together.
+ *
+ * @return
+ *      Reference to the new batch.
+ */
+//--------------------------------------------------------------------------------------------------
+le_atomFile_BatchRef_t le_atomFile_BeginBatch
+(
+    void
+)
+{
+    Batch_t* batchPtr = le_mem_ForceAlloc(BatchPool);
+
+    batchPtr->fileList = LE_DLS_LIST_INIT;
+
+    return batchPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a file descriptor obtained from this API and adds its changes to a batch instead of
+ * committing them. The file stays locked until the batch is committed or cancelled. Files opened
+ * with LE_FLOCK_READ have no changes and are simply closed.
+ *
+ * The file descriptor is closed in both success and error scenario.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error, in which case the file's changes are discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atomFile_AddToBatch
+(
+    le_atomFile_BatchRef_t batchRef,    ///< [IN] Batch to add the file's changes to.
+    int fd                              ///< [IN] The file descriptor to close.
+)
+{
+    LE_ASSERT(batchRef != NULL);
+    LE_ASSERT(fd > -1);
+
+    FileAccess_t* accessPtr = GetFileData(fd);
+
+    // Coding bug. So terminate immediately.
+    LE_FATAL_IF(accessPtr == NULL, "Bad file descriptor: %d", fd);
+
+    if (accessPtr->tempFd < 0)
+    {
+        return Close(fd, true);
+    }
+
+    if (AddToBatch(batchRef, accessPtr) != LE_OK)
+    {
+        Close(fd, false);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a file stream obtained from this API and adds its changes to a batch instead of
+ * committing them. The file stays locked until the batch is committed or cancelled. Streams opened
+ * with LE_FLOCK_READ have no changes and are simply closed.
+ *
+ * The file stream is closed in both success and error scenario.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error, in which case the file's changes are discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atomFile_AddStreamToBatch
+(
+    le_atomFile_BatchRef_t batchRef,    ///< [IN] Batch to add the file's changes to.
+    FILE* fileStreamPtr                 ///< [IN] File stream pointer to close.
+)
+{
+    LE_ASSERT(batchRef != NULL);
+    LE_ASSERT(fileStreamPtr != NULL);
+
+    FileAccess_t* accessPtr = GetFileData(fileno(fileStreamPtr));
+
+    // Coding bug. Terminate immediately.
+    LE_FATAL_IF(accessPtr == NULL, "Bad file stream: %p", fileStreamPtr);
+
+    if (accessPtr->tempFd < 0)
+    {
+        return CloseStream(fileStreamPtr, true);
+    }
+
+    // Flush data to OS now; the stream is only closed when the batch is done.
+    int flushResult;
+    do
+    {
+        flushResult = fflush(fileStreamPtr);
+    }
+    while ( (flushResult != 0) && (errno == EINTR) );
+
+    if (flushResult != 0)
+    {
+        LE_CRIT("Failed to flush file '%s' (%m).", accessPtr->filePath);
+        CloseStream(fileStreamPtr, false);
+        return LE_FAULT;
+    }
+
+    if (AddToBatch(batchRef, accessPtr) != LE_OK)
+    {
+        CloseStream(fileStreamPtr, false);
+        return LE_FAULT;
+    }
+
+    accessPtr->streamPtr = fileStreamPtr;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Commits the changes of all the files in a batch, with one sync barrier for the whole batch, and
+ * releases the batch. Either all or none of the files are replaced, even across a power-cut.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atomFile_CommitBatch
+(
+    le_atomFile_BatchRef_t batchRef     ///< [IN] Batch to commit.
+)
+{
+    LE_ASSERT(batchRef != NULL);
+
+    return CommitBatch(batchRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Discards the changes of all the files in a batch and releases the batch.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_atomFile_CancelBatch
+(
+    le_atomFile_BatchRef_t batchRef     ///< [IN] Batch to cancel.
+)
+{
+    LE_ASSERT(batchRef != NULL);
+
+    CancelBatch(batchRef);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initialize the atomic file access internal memory pools.  This function is meant to be called
@@ -1760,4 +2535,5 @@ void atomFile_Init
     // Initialize pools
     FileAccessPool = le_mem_CreatePool("AtomicFileAccessPool",
                                         sizeof(FileAccess_t));
+    BatchPool = le_mem_CreatePool("AtomicFileBatchPool", sizeof(Batch_t));
 }
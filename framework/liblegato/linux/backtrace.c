@@ -200,6 +200,18 @@ static inline void DumpContextStack(const void *infoPtr, int skip, char *buf, si
 
 #endif /* end __arm__ */
 
+void backtrace_Init(void)
+{
+#if !defined(__arm__)
+    // The first call to backtrace(3) loads the unwinder (libgcc_s) with dlopen(3), which takes a
+    // while and calls malloc(3).  Do that now, while it is still safe, so that a crashing process
+    // only has to capture its raw return addresses.  Symbolize them off-line using the process
+    // map dumped alongside them.
+    void *retSp[1];
+    (void)backtrace(&retSp[0], 1);
+#endif
+}
+
 void backtrace_DumpContextStack(const void *infoPtr, int skip, char *buf, size_t bufLen)
 {
     snprintf(buf, bufLen, "BACKTRACE\n");
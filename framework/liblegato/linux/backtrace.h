@@ -10,6 +10,17 @@
 #ifndef LEGATO_FA_BACKTRACE_INCLUDE_GUARD
 #define LEGATO_FA_BACKTRACE_INCLUDE_GUARD
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Prepare to take backtraces, so that backtrace_DumpContextStack() doesn't have to load anything
+ *  the first time it is called, from a signal handler.
+ */
+//--------------------------------------------------------------------------------------------------
+void backtrace_Init
+(
+    void
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Dump call stack and register information to stderr in a signal-handler safe manner.
@@ -0,0 +1,130 @@
+//--------------------------------------------------------------------------------------------------
+/** @file bootProfile.c
+ *
+ * Boot profile record.  See bootProfile.h.
+ *
+ * Every event is written with a single write() to a file opened with O_APPEND, so events from the
+ * start program, the Supervisor and the framework daemons don't get mixed up even when they are
+ * recorded at the same time.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "bootProfile.h"
+#include "fileDescriptor.h"
+
+#include <sys/xattr.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of the record.  A start-up with many apps takes a few KiB.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_RECORD_BYTES    65536
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of one event's line.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_LINE_BYTES      256
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a new boot profile record, discarding the previous one.
+ *
+ * @note Only called by the start program, before it launches the Supervisor.
+ */
+//--------------------------------------------------------------------------------------------------
+void bootProfile_Start
+(
+    void
+)
+{
+    if (le_dir_Make(LE_CONFIG_RUNTIME_DIR, S_IRWXU | S_IXOTH) == LE_FAULT)
+    {
+        LE_WARN("Can't create '%s'. Boot profile not recorded.", LE_CONFIG_RUNTIME_DIR);
+        return;
+    }
+
+    int fd;
+    do
+    {
+        fd = open(BOOT_PROFILE_PATH, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    }
+    while ((fd == -1) && (errno == EINTR));
+
+    if (fd == -1)
+    {
+        LE_WARN("Can't create '%s' (%m). Boot profile not recorded.", BOOT_PROFILE_PATH);
+        return;
+    }
+
+    // The framework daemons record their events too, so give the record their label.  This fails
+    // harmlessly on systems without SMACK.
+    (void)fsetxattr(fd, "security.SMACK64", "framework", sizeof("framework") - 1, 0);
+
+    fd_Close(fd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds an event, time-stamped now, to the boot profile record.
+ */
+//--------------------------------------------------------------------------------------------------
+void bootProfile_Record
+(
+    const char* trackPtr,       ///< [IN] Name of the track (process or app) the event is about.
+    const char* eventPtr,       ///< [IN] Name of the event (must not contain spaces).
+    const char* detailPtr       ///< [IN] Details about the event, or NULL.
+)
+{
+    struct timespec now;
+    LE_ASSERT(clock_gettime(CLOCK_MONOTONIC, &now) == 0);
+
+    // Don't create the record: if it doesn't exist, this isn't a start-up being profiled.
+    int fd;
+    do
+    {
+        fd = open(BOOT_PROFILE_PATH, O_WRONLY | O_APPEND | O_CLOEXEC);
+    }
+    while ((fd == -1) && (errno == EINTR));
+
+    if (fd == -1)
+    {
+        return;
+    }
+
+    struct stat st;
+    if ((fstat(fd, &st) == 0) && (st.st_size < MAX_RECORD_BYTES))
+    {
+        char line[MAX_LINE_BYTES];
+        int len = snprintf(line, sizeof(line), "%" PRIu64 " %s %s%s%s\n",
+                           ((uint64_t)now.tv_sec * 1000000000) + (uint64_t)now.tv_nsec,
+                           trackPtr,
+                           eventPtr,
+                           (detailPtr != NULL ? " " : ""),
+                           (detailPtr != NULL ? detailPtr : ""));
+
+        if (len >= (int)sizeof(line))
+        {
+            // Keep the line whole even when the detail is truncated.
+            len = sizeof(line) - 1;
+            line[len - 1] = '\n';
+        }
+
+        ssize_t numBytesWritten;
+        do
+        {
+            numBytesWritten = write(fd, line, len);
+        }
+        while ((numBytesWritten == -1) && (errno == EINTR));
+    }
+
+    fd_Close(fd);
+}
@@ -0,0 +1,63 @@
+//--------------------------------------------------------------------------------------------------
+/** @file bootProfile.h
+ *
+ * Boot profile record, shared by the start program, the Supervisor and the framework daemons.
+ *
+ * Each phase of the framework's start-up is recorded as one line of text in a file in the runtime
+ * directory:
+ *
+ * @verbatim
+   <monotonic time in ns> <track> <event> [<detail>]
+   @endverbatim
+ *
+ * where the track is "start", "supervisor", or the name of the framework daemon or app that the
+ * event is about.  The record is restarted each time the start program launches a system, and is
+ * read by "legato boot-profile".
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_BOOT_PROFILE_H_INCLUDE_GUARD
+#define LEGATO_BOOT_PROFILE_H_INCLUDE_GUARD
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Path of the boot profile record.
+ */
+//--------------------------------------------------------------------------------------------------
+#define BOOT_PROFILE_PATH   LE_CONFIG_RUNTIME_DIR "/bootProfile"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a new boot profile record, discarding the previous one.
+ *
+ * @note Only called by the start program, before it launches the Supervisor.
+ */
+//--------------------------------------------------------------------------------------------------
+void bootProfile_Start
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds an event, time-stamped now, to the boot profile record.
+ *
+ * Failures are ignored, so that profiling never gets in the way of the start-up itself.  Events
+ * stop being recorded once the record reaches its maximum size, so that app restarts long after
+ * the start-up don't make it grow forever.
+ */
+//--------------------------------------------------------------------------------------------------
+void bootProfile_Record
+(
+    const char* trackPtr,       ///< [IN] Name of the track (process or app) the event is about.
+    const char* eventPtr,       ///< [IN] Name of the event (must not contain spaces).
+    const char* detailPtr       ///< [IN] Details about the event, or NULL.
+);
+
+
+#endif // LEGATO_BOOT_PROFILE_H_INCLUDE_GUARD
@@ -13,6 +13,8 @@
 #include "fileSystem.h"
 #include "killProc.h"
 
+#include <sys/vfs.h>
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -33,42 +35,136 @@ static const char* SubSysName[CGRP_NUM_SUBSYSTEMS] = {"cpu,cpuacct", "memory", "
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Cgroup tasks file.  The tasks file list the PIDs of all threads in a cgroup.
+ * Magic number of a cgroup2 file system (see statfs()).
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef CGROUP2_SUPER_MAGIC
+#define CGROUP2_SUPER_MAGIC         0x63677270
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Cgroup control files used by this module.
  */
 //--------------------------------------------------------------------------------------------------
-#define TASKS_FILENAME              "tasks"
+typedef enum
+{
+    CGRP_FILE_TASKS = 0,        ///< Threads in the cgroup.
+    CGRP_FILE_PROCS,            ///< Processes in the cgroup.
+    CGRP_FILE_CPU_SHARE,        ///< Relative cpu share.
+    CGRP_FILE_MEM_LIMIT,        ///< Memory limit.
+    CGRP_FILE_FREEZE,           ///< Freeze control.
+    CGRP_FILE_EVENTS,           ///< Populated and frozen events (unified hierarchy only).
+    CGRP_FILE_MEM_USED,         ///< Memory in use.
+    CGRP_FILE_MEM_MAX_USED,     ///< Peak memory use.
+    CGRP_FILE_PRESSURE,         ///< Pressure stall information (unified hierarchy only).
+    CGRP_NUM_FILES              ///< Number of files.  Must be the last item in this enum.
+}
+CgrpFile_t;
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Cgroup procs file.  The procs file list the PIDs of all processes in a cgroup.
+ * Names of the control files in the per sub-system (v1) hierarchies.  NULL if there is no such
+ * file.
  */
 //--------------------------------------------------------------------------------------------------
-#define PROCS_FILENAME              "cgroup.procs"
+static const char* V1FileName[CGRP_NUM_FILES] =
+{
+    "tasks",
+    "cgroup.procs",
+    "cpu.shares",
+    "memory.limit_in_bytes",
+    "freezer.state",
+    NULL,
+    "memory.memsw.usage_in_bytes",
+    "memory.memsw.max_usage_in_bytes",
+    NULL
+};
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Cpu shares file.
+ * Names of the control files in the unified (v2) hierarchy.  The pressure file depends on the
+ * sub-system, see GetFileName().
  */
 //--------------------------------------------------------------------------------------------------
-#define CPU_SHARES_FILENAME         "cpu.shares"
+static const char* V2FileName[CGRP_NUM_FILES] =
+{
+    "cgroup.threads",
+    "cgroup.procs",
+    "cpu.weight",
+    "memory.max",
+    "cgroup.freeze",
+    "cgroup.events",
+    "memory.current",
+    "memory.peak",
+    NULL
+};
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Memory limit file.
+ * Names of the pressure stall information files of each sub-system in the unified hierarchy.
  */
 //--------------------------------------------------------------------------------------------------
-#define MEM_LIMIT_FILENAME          "memory.limit_in_bytes"
+static const char* PressureFileName[CGRP_NUM_SUBSYSTEMS] = {"cpu.pressure", "memory.pressure", NULL};
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Freeze state file.
+ * Control files that are written to, and so are opened for reading and writing.
  */
 //--------------------------------------------------------------------------------------------------
-#define FREEZE_STATE_FILENAME       "freezer.state"
+#define WRITABLE_FILES  ( (1 << CGRP_FILE_PROCS) | (1 << CGRP_FILE_CPU_SHARE) | \
+                          (1 << CGRP_FILE_MEM_LIMIT) | (1 << CGRP_FILE_FREEZE) )
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A cgroup whose control files are open.
+ *
+ * The control files of a cgroup are opened the first time they are used and stay open until the
+ * cgroup is deleted, so that checking the state of an app does not cost an open() and a close()
+ * each time.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char name[LIMIT_MAX_PATH_BYTES];                ///< Name of the cgroup (the map key).
+    uint32_t createdSubSys;                         ///< Sub-systems it was created in (bit mask).
+    int fd[CGRP_NUM_SUBSYSTEMS][CGRP_NUM_FILES];    ///< Open control files, or -1.
+}
+Cgroup_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of Cgroup_t objects, and map of them by name.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t CgroupPool = NULL;
+static le_hashmap_Ref_t CgroupMap = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Estimated number of cgroups (one per app).
+ */
+//--------------------------------------------------------------------------------------------------
+#define CGROUP_MAP_SIZE             31
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Whether ROOT_PATH holds the unified (v2) hierarchy: -1 if not known yet, 0 if not, 1 if so.
+ *
+ * In the unified hierarchy, all the sub-systems share one hierarchy, so a cgroup is a single
+ * directory, ROOT_PATH/<name>, whatever the sub-system.
+ */
+//--------------------------------------------------------------------------------------------------
+static int Unified = -1;
 
 
 //--------------------------------------------------------------------------------------------------
@@ -87,6 +183,22 @@ static const char* SubSysName[CGRP_NUM_SUBSYSTEMS] = {"cpu,cpuacct", "memory", "
 #define MAX_FREEZE_STATE_BYTES      20
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of bytes in a cgroup.events file.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_EVENTS_BYTES            100
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of bytes in a pressure stall information file.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_PRESSURE_BYTES          256
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Checks if all cgroup subsystems are mounted.
@@ -147,6 +259,75 @@ static void MountSubSys
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the unified (v2) cgroup hierarchy is mounted on ROOT_PATH.  The answer is only
+ * worked out once.
+ *
+ * @return
+ *      true if the unified hierarchy is used.
+ *      false if the per sub-system (v1) hierarchies are used.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsUnified
+(
+    void
+)
+{
+    if (Unified < 0)
+    {
+        struct statfs fsInfo;
+
+        Unified = ( (statfs(ROOT_PATH, &fsInfo) == 0) && (fsInfo.f_type == CGROUP2_SUPER_MAGIC) );
+    }
+
+    return (Unified != 0);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enables the cpu and memory controllers for the cgroups under the root of the unified hierarchy.
+ * The freezer is built into the unified hierarchy and needs no controller.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EnableControllers
+(
+    void
+)
+{
+    static const char* controllers[] = {"+cpu", "+memory"};
+
+    int fd;
+
+    do
+    {
+        fd = open(ROOT_PATH "/cgroup.subtree_control", O_WRONLY | O_CLOEXEC);
+    }
+    while ((fd < 0) && (errno == EINTR));
+
+    LE_FATAL_IF(fd < 0, "Could not open '%s/cgroup.subtree_control'.  %m.", ROOT_PATH);
+
+    // Enable the controllers one at a time, so that a missing one does not stop the others.
+    size_t i;
+    for (i = 0; i < NUM_ARRAY_MEMBERS(controllers); i++)
+    {
+        ssize_t numBytesWritten;
+
+        do
+        {
+            numBytesWritten = write(fd, controllers[i], strlen(controllers[i]));
+        }
+        while ((numBytesWritten == -1) && (errno == EINTR));
+
+        LE_WARN_IF(numBytesWritten == -1,
+                   "Could not enable cgroup controller '%s'.  %m.", controllers[i] + 1);
+    }
+
+    fd_Close(fd);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initializes cgroups for the system.  Sets up a hierarchy for each supported subsystem.
@@ -162,6 +343,23 @@ void cgrp_Init
     void
 )
 {
+#if LE_CONFIG_SUPERV_CGROUP_V2
+    if (!IsUnified())
+    {
+        LE_FATAL_IF(mount("cgroup2", ROOT_PATH, "cgroup2", 0, NULL) != 0,
+                    "Could not mount the unified cgroup hierarchy.  %m.");
+
+        LE_INFO("Mounted the unified cgroup hierarchy.");
+        Unified = 1;
+    }
+#endif
+
+    if (IsUnified())
+    {
+        EnableControllers();
+        return;
+    }
+
     // Setup the cgroup root directory if it does not already exist.
     if (!fs_IsMounted(ROOT_NAME, ROOT_PATH))
     {
@@ -188,12 +386,186 @@ void cgrp_Init
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Builds the path of a cgroup, or of one of its files.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetPath
+(
+    char* pathPtr,                  ///< [OUT] Buffer for the path.
+    size_t pathSize,                ///< [IN] Size of the buffer.
+    cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    const char* fileNamePtr         ///< [IN] Name of the file, or NULL for the cgroup itself.
+)
+{
+    LE_ASSERT(le_utf8_Copy(pathPtr, ROOT_PATH, pathSize, NULL) == LE_OK);
+
+    if (IsUnified())
+    {
+        LE_ASSERT(le_path_Concat("/", pathPtr, pathSize, cgroupNamePtr, fileNamePtr,
+                                 (char*)NULL) == LE_OK);
+    }
+    else
+    {
+        LE_ASSERT(le_path_Concat("/", pathPtr, pathSize, SubSysName[subsystem], cgroupNamePtr,
+                                 fileNamePtr, (char*)NULL) == LE_OK);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the name of a control file in the hierarchy in use.
+ *
+ * @return
+ *      The name of the file, or NULL if the hierarchy has no such file.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* GetFileName
+(
+    cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
+    CgrpFile_t file                 ///< [IN] The file.
+)
+{
+    if (!IsUnified())
+    {
+        return V1FileName[file];
+    }
+
+    if (file == CGRP_FILE_PRESSURE)
+    {
+        return PressureFileName[subsystem];
+    }
+
+    return V2FileName[file];
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the record of a cgroup, creating it if there is none yet.
+ *
+ * @return
+ *      Pointer to the record.
+ */
+//--------------------------------------------------------------------------------------------------
+static Cgroup_t* GetCgroup
+(
+    const char* cgroupNamePtr       ///< [IN] Name of the cgroup.
+)
+{
+    if (CgroupMap == NULL)
+    {
+        CgroupPool = le_mem_CreatePool("Cgroup", sizeof(Cgroup_t));
+        CgroupMap = le_hashmap_Create("Cgroups",
+                                      CGROUP_MAP_SIZE,
+                                      le_hashmap_HashString,
+                                      le_hashmap_EqualsString);
+    }
+
+    Cgroup_t* cgroupPtr = le_hashmap_Get(CgroupMap, cgroupNamePtr);
+
+    if (cgroupPtr == NULL)
+    {
+        cgroupPtr = le_mem_ForceAlloc(CgroupPool);
+
+        LE_FATAL_IF(le_utf8_Copy(cgroupPtr->name, cgroupNamePtr, sizeof(cgroupPtr->name),
+                                 NULL) != LE_OK,
+                    "Cgroup name '%s' is too long.", cgroupNamePtr);
+
+        cgroupPtr->createdSubSys = 0;
+
+        cgrp_SubSys_t subSys;
+        for (subSys = 0; subSys < CGRP_NUM_SUBSYSTEMS; subSys++)
+        {
+            CgrpFile_t file;
+            for (file = 0; file < CGRP_NUM_FILES; file++)
+            {
+                cgroupPtr->fd[subSys][file] = -1;
+            }
+        }
+
+        le_hashmap_Put(CgroupMap, cgroupPtr->name, cgroupPtr);
+    }
+
+    return cgroupPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forgets a cgroup if it has no files open and was not created in any sub-system.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ForgetIfUnused
+(
+    Cgroup_t* cgroupPtr             ///< [IN] The cgroup.
+)
+{
+    if (cgroupPtr->createdSubSys != 0)
+    {
+        return;
+    }
+
+    cgrp_SubSys_t subSys;
+    for (subSys = 0; subSys < CGRP_NUM_SUBSYSTEMS; subSys++)
+    {
+        CgrpFile_t file;
+        for (file = 0; file < CGRP_NUM_FILES; file++)
+        {
+            if (cgroupPtr->fd[subSys][file] >= 0)
+            {
+                return;
+            }
+        }
+    }
+
+    le_hashmap_Remove(CgroupMap, cgroupPtr->name);
+    le_mem_Release(cgroupPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes the control files of a cgroup that are open for a sub-system, or for all of them in the
+ * unified hierarchy (where the sub-systems share the files).
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseFiles
+(
+    Cgroup_t* cgroupPtr,            ///< [IN] The cgroup.
+    cgrp_SubSys_t subsystem         ///< [IN] Sub-system of the cgroup.
+)
+{
+    cgrp_SubSys_t subSys;
+    for (subSys = 0; subSys < CGRP_NUM_SUBSYSTEMS; subSys++)
+    {
+        if ((subSys != subsystem) && !IsUnified())
+        {
+            continue;
+        }
+
+        CgrpFile_t file;
+        for (file = 0; file < CGRP_NUM_FILES; file++)
+        {
+            if (cgroupPtr->fd[subSys][file] >= 0)
+            {
+                fd_Close(cgroupPtr->fd[subSys][file]);
+                cgroupPtr->fd[subSys][file] = -1;
+            }
+        }
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Opens a cgroup file.
  *
  * @return
- *      The file descriptor of the cgroup's tasks file if successful.
+ *      The file descriptor of the cgroup file if successful.
  *      A negative value if there was an error.
  */
 //--------------------------------------------------------------------------------------------------
@@ -201,34 +573,112 @@ static int OpenCgrpFile
 (
     cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
     const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
-    const char* fileNamePtr,        ///< [IN] Name of the file.
-    int accessMode                  ///< [IN] Either O_RDONLY, O_WRONLY, or O_RDWR.
-
+    CgrpFile_t file                 ///< [IN] The file.
 )
 {
+    const char* fileNamePtr = GetFileName(subsystem, file);
+
+    if (fileNamePtr == NULL)
+    {
+        LE_ERROR("Cgroup '%s' has no such file in this hierarchy.", cgroupNamePtr);
+        return -1;
+    }
+
     // Create the path to the cgroup file.
-    char path[LIMIT_MAX_PATH_BYTES] = ROOT_PATH;
-    LE_ASSERT(le_path_Concat("/", path, sizeof(path), SubSysName[subsystem], cgroupNamePtr,
-                             fileNamePtr, (char*)NULL) == LE_OK);
+    char path[LIMIT_MAX_PATH_BYTES];
+    GetPath(path, sizeof(path), subsystem, cgroupNamePtr, fileNamePtr);
 
     // Open the cgroup file.
+    int accessMode = ((WRITABLE_FILES & (1 << file)) != 0) ? O_RDWR : O_RDONLY;
     int fd;
 
     do
     {
-        fd = open(path, accessMode);
+        fd = open(path, accessMode | O_CLOEXEC);
     }
     while ((fd < 0) && (errno == EINTR));
 
     if (fd < 0)
     {
-        LE_ERROR("Could not open file '%s'.  %m.", path);
+        // Pressure stall information and peak memory use depend on the kernel version and
+        // configuration, so their absence is not an error.
+        if ( (errno == ENOENT) &&
+             ((file == CGRP_FILE_PRESSURE) || (file == CGRP_FILE_MEM_MAX_USED)) )
+        {
+            LE_DEBUG("No file '%s'.", path);
+        }
+        else
+        {
+            LE_ERROR("Could not open file '%s'.  %m.", path);
+        }
     }
 
     return fd;
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the file descriptor of a cgroup file, opening the file if it is not open yet.
+ *
+ * @return
+ *      The file descriptor if successful.
+ *      A negative value if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static int GetFd
+(
+    cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    CgrpFile_t file                 ///< [IN] The file.
+)
+{
+    Cgroup_t* cgroupPtr = GetCgroup(cgroupNamePtr);
+    int* fdPtr = &(cgroupPtr->fd[subsystem][file]);
+
+    if (*fdPtr < 0)
+    {
+        *fdPtr = OpenCgrpFile(subsystem, cgroupNamePtr, file);
+
+        if (*fdPtr < 0)
+        {
+            // Don't keep a record of a cgroup just for a file that could not be opened.
+            ForgetIfUnused(cgroupPtr);
+            return -1;
+        }
+    }
+
+    return *fdPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a cgroup file after an error, so that it is opened again the next time it is used.  This
+ * covers a cgroup that was removed and created again behind our back, which leaves the old file
+ * descriptor failing with ENODEV.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DropFd
+(
+    cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    CgrpFile_t file                 ///< [IN] The file.
+)
+{
+    Cgroup_t* cgroupPtr = GetCgroup(cgroupNamePtr);
+
+    if (cgroupPtr->fd[subsystem][file] >= 0)
+    {
+        fd_Close(cgroupPtr->fd[subsystem][file]);
+        cgroupPtr->fd[subsystem][file] = -1;
+    }
+
+    // Forget the record if that was the last file of a cgroup we didn't create.
+    ForgetIfUnused(cgroupPtr);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Writes a string to a cgroup file.  Overwrites what is currently in the file.
@@ -247,7 +697,7 @@ static le_result_t WriteToFile
 (
     cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
     const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
-    const char* fileNamePtr,        ///< [IN] File to write to.
+    CgrpFile_t file,                ///< [IN] File to write to.
     const char* string              ///< [IN] String to write into the file.
 )
 {
@@ -255,42 +705,44 @@ static le_result_t WriteToFile
     size_t len = strlen(string);
     LE_ASSERT(len > 0);
 
-    // Open the file.
-    int fd = OpenCgrpFile(subsystem, cgroupNamePtr, fileNamePtr, O_WRONLY);
+    int retries = 1;
 
-    if (fd < 0)
+    while (1)
     {
-        return LE_FAULT;
-    }
+        int fd = GetFd(subsystem, cgroupNamePtr, file);
 
-    // Write the string to the file.
-    le_result_t result = LE_OK;
-    ssize_t numBytesWritten = 0;
+        if (fd < 0)
+        {
+            return LE_FAULT;
+        }
 
-    do
-    {
-        numBytesWritten = write(fd, string, len);
-    }
-    while ((numBytesWritten == -1) && (errno == EINTR));
+        // Write the string to the file.
+        ssize_t numBytesWritten = 0;
 
-    if (numBytesWritten != len)
-    {
-        LE_ERROR("Could not write '%s' to file '%s' in cgroup '%s'.  %m.",
-                 string, fileNamePtr, cgroupNamePtr);
+        do
+        {
+            numBytesWritten = write(fd, string, len);
+        }
+        while ((numBytesWritten == -1) && (errno == EINTR));
 
-        if (errno == ESRCH)
+        if (numBytesWritten == len)
         {
-            result = LE_OUT_OF_RANGE;
+            return LE_OK;
         }
-        else
+
+        int error = errno;
+        DropFd(subsystem, cgroupNamePtr, file);
+
+        if ((numBytesWritten == -1) && (error == ENODEV) && (retries-- > 0))
         {
-            result = LE_FAULT;
+            continue;
         }
-    }
 
-    fd_Close(fd);
+        LE_ERROR("Could not write '%s' to file '%s' in cgroup '%s'.  %s.",
+                 string, GetFileName(subsystem, file), cgroupNamePtr, strerror(error));
 
-    return result;
+        return (error == ESRCH) ? LE_OUT_OF_RANGE : LE_FAULT;
+    }
 }
 
 
@@ -309,60 +761,112 @@ static le_result_t GetValue
 (
     cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
     const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
-    const char* fileNamePtr,        ///< [IN] File name to read from.
+    CgrpFile_t file,                ///< [IN] File to read from.
     char* bufPtr,                   ///< [OUT] Buffer to store the value in.
     size_t bufSize                  ///< [IN] Size of the buffer.
 )
 {
-    // Open the file.
-    int fd = OpenCgrpFile(subsystem, cgroupNamePtr, fileNamePtr, O_RDONLY);
+    int retries = 1;
+    ssize_t numBytesRead;
 
-    if (fd < 0)
+    while (1)
     {
-        return LE_FAULT;
-    }
+        int fd = GetFd(subsystem, cgroupNamePtr, file);
 
-    // Read the value from the file.
-    ssize_t numBytesRead;
+        if (fd < 0)
+        {
+            return LE_FAULT;
+        }
 
-    do
-    {
-        numBytesRead = read(fd, bufPtr, bufSize);
-    }
-    while ( (numBytesRead == -1) && (errno == EINTR) );
+        // Read the value from the start of the file.
+        do
+        {
+            numBytesRead = pread(fd, bufPtr, bufSize, 0);
+        }
+        while ( (numBytesRead == -1) && (errno == EINTR) );
 
-    le_result_t result = LE_FAULT;
+        if (numBytesRead >= 0)
+        {
+            break;
+        }
 
-    // Check if the read value is valid.
-    if (numBytesRead == -1)
-    {
-        LE_ERROR("Could not read file '%s' in cgroup '%s'.  %m.", fileNamePtr, cgroupNamePtr);
-        result = LE_FAULT;
+        int error = errno;
+        DropFd(subsystem, cgroupNamePtr, file);
+
+        if ((error != ENODEV) || (retries-- <= 0))
+        {
+            LE_ERROR("Could not read file '%s' in cgroup '%s'.  %s.",
+                     GetFileName(subsystem, file), cgroupNamePtr, strerror(error));
+            return LE_FAULT;
+        }
     }
-    else if (numBytesRead == bufSize)
+
+    // Check if the read value is valid.
+    if (numBytesRead == bufSize)
     {
         // The value in the file is larger than the provided buffer.  Truncate the buffer.
         bufPtr[bufSize-1] = '\0';
-        result = LE_OVERFLOW;
+        return LE_OVERFLOW;
     }
-    else if ((numBytesRead >= 0) && (numBytesRead < bufSize))
+
+    // Null-terminate the string.
+    bufPtr[numBytesRead] = '\0';
+
+    // Remove trailing newline characters.
+    while ((numBytesRead > 0) && (bufPtr[numBytesRead - 1] == '\n'))
     {
-        // Null-terminate the string.
+        numBytesRead--;
         bufPtr[numBytesRead] = '\0';
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the value of a key in a cgroup's cgroup.events file (unified hierarchy only), which holds
+ * lines like "populated 1" and "frozen 0".
+ *
+ * @return
+ *      The value if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static int GetEvent
+(
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    const char* keyPtr              ///< [IN] Key to look for.
+)
+{
+    char events[MAX_EVENTS_BYTES];
+
+    if (GetValue(CGRP_SUBSYS_FREEZE, cgroupNamePtr, CGRP_FILE_EVENTS,
+                 events, sizeof(events)) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    size_t keyLen = strlen(keyPtr);
+    const char* linePtr = events;
 
-        // Remove trailing newline characters.
-        while ((numBytesRead > 0) && (bufPtr[numBytesRead - 1] == '\n'))
+    while (linePtr != NULL)
+    {
+        if ((strncmp(linePtr, keyPtr, keyLen) == 0) && (linePtr[keyLen] == ' '))
         {
-            numBytesRead--;
-            bufPtr[numBytesRead] = '\0';
+            return atoi(linePtr + keyLen + 1);
         }
 
-        result = LE_OK;
-    }
+        linePtr = strchr(linePtr, '\n');
 
-    fd_Close(fd);
+        if (linePtr != NULL)
+        {
+            linePtr++;
+        }
+    }
 
-    return result;
+    LE_ERROR("No '%s' event in cgroup '%s'.", keyPtr, cgroupNamePtr);
+    return LE_FAULT;
 }
 
 
@@ -406,6 +910,52 @@ static pid_t GetTasksId
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the file descriptor of a procs or tasks file, positioned at its start so that its PIDs can
+ * be read with GetTasksId().
+ *
+ * @return
+ *      The file descriptor if successful.
+ *      A negative value if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static int RewindTasksFile
+(
+    cgrp_SubSys_t subsystem,        ///< [IN] Sub-system of the cgroup.
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    CgrpFile_t file                 ///< [IN] CGRP_FILE_TASKS or CGRP_FILE_PROCS.
+)
+{
+    int retries = 1;
+
+    while (1)
+    {
+        int fd = GetFd(subsystem, cgroupNamePtr, file);
+
+        if (fd < 0)
+        {
+            return -1;
+        }
+
+        if (lseek(fd, 0, SEEK_SET) == 0)
+        {
+            return fd;
+        }
+
+        int error = errno;
+        DropFd(subsystem, cgroupNamePtr, file);
+
+        if ((error != ENODEV) || (retries-- <= 0))
+        {
+            LE_ERROR("Could not rewind file '%s' in cgroup '%s'.  %s.",
+                     GetFileName(subsystem, file), cgroupNamePtr, strerror(error));
+            return -1;
+        }
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Modifies the string by removing all trailing white space from the string.
@@ -441,6 +991,9 @@ static void RemoveTrailingWhiteSpace
  * that is a sub-group of "Students".  Note that all parent groups must first exist before a
  * sub-group can be created.
  *
+ * In the unified hierarchy the sub-systems share one directory per cgroup, which is made when the
+ * cgroup is first created in any sub-system.
+ *
  * @return
  *      LE_OK if successful.
  *      LE_DUPLICATE if the cgroup already exists.
@@ -453,25 +1006,44 @@ le_result_t cgrp_Create
     const char* cgroupNamePtr       ///< Name of the cgroup to create.
 )
 {
+    Cgroup_t* cgroupPtr = GetCgroup(cgroupNamePtr);
+
     // Create the path to the cgroup.
-    char path[LIMIT_MAX_PATH_BYTES] = ROOT_PATH;
-    LE_ASSERT(le_path_Concat("/", path, sizeof(path), SubSysName[subsystem], cgroupNamePtr,
-                             (char*)NULL) == LE_OK);
+    char path[LIMIT_MAX_PATH_BYTES];
+    GetPath(path, sizeof(path), subsystem, cgroupNamePtr, NULL);
 
-    // Create the cgroup.
-    le_result_t result = le_dir_Make(path, S_IRWXU);
+    le_result_t result;
+
+    if ((cgroupPtr->createdSubSys & (1 << subsystem)) != 0)
+    {
+        result = LE_DUPLICATE;
+    }
+    else if (IsUnified() && (cgroupPtr->createdSubSys != 0))
+    {
+        // The directory was made for another sub-system.
+        result = LE_OK;
+    }
+    else
+    {
+        // Create the cgroup.
+        result = le_dir_Make(path, S_IRWXU);
+    }
 
     if (result == LE_DUPLICATE)
     {
         LE_WARN("Cgroup %s already exists.", path);
+        ForgetIfUnused(cgroupPtr);
         return LE_DUPLICATE;
     }
     else if (result == LE_FAULT)
     {
         LE_ERROR("Could not create cgroup %s.", path);
+        ForgetIfUnused(cgroupPtr);
         return LE_FAULT;
     }
 
+    cgroupPtr->createdSubSys |= (1 << subsystem);
+
     return LE_OK;
 }
 
@@ -499,7 +1071,7 @@ le_result_t cgrp_AddProc
     LE_ASSERT(snprintf(pidStr, sizeof(pidStr), "%d", pidToAdd) < sizeof(pidStr));
 
     // Write the pid to the file.
-    return WriteToFile(subsystem, cgroupNamePtr, PROCS_FILENAME, pidStr);
+    return WriteToFile(subsystem, cgroupNamePtr, CGRP_FILE_PROCS, pidStr);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -567,21 +1139,20 @@ ssize_t cgrp_GetThreadList
     size_t maxTids                  ///< [IN] The maximum number of tids tidListPtr can hold.
 )
 {
-    // Open the cgroup's tasks file for reading.
-    int fd = OpenCgrpFile(subsystem, cgroupNamePtr, TASKS_FILENAME, O_RDONLY);
+    // Get the cgroup's tasks file, ready for reading.
+    int fd = RewindTasksFile(subsystem, cgroupNamePtr, CGRP_FILE_TASKS);
 
     if (fd < 0)
     {
         return LE_FAULT;
     }
 
-    size_t numTids = BuildTidList(fd, tidListPtr, maxTids);
-
-    fd_Close(fd);
+    ssize_t numTids = BuildTidList(fd, tidListPtr, maxTids);
 
     if (numTids == LE_FAULT)
     {
         LE_ERROR("Error reading the '%s' cgroup's tasks.", cgroupNamePtr);
+        DropFd(subsystem, cgroupNamePtr, CGRP_FILE_TASKS);
     }
 
     return numTids;
@@ -605,23 +1176,22 @@ ssize_t cgrp_GetProcessesList
     size_t maxPids                  ///< [IN] The maximum number of pids pidListPtr can hold.
 )
 {
-    // Open the cgroup's processes file for reading.
-    int fd = OpenCgrpFile(subsystem, cgroupNamePtr, PROCS_FILENAME, O_RDONLY);
+    // Get the cgroup's processes file, ready for reading.
+    int fd = RewindTasksFile(subsystem, cgroupNamePtr, CGRP_FILE_PROCS);
 
     if (fd < 0)
     {
         return LE_FAULT;
     }
 
-    size_t numPids = BuildTidList(fd, pidListPtr, maxPids);
+    ssize_t numPids = BuildTidList(fd, pidListPtr, maxPids);
 
     if (numPids == LE_FAULT)
     {
         LE_ERROR("Error reading the '%s' cgroup's tasks.", cgroupNamePtr);
+        DropFd(subsystem, cgroupNamePtr, CGRP_FILE_PROCS);
     }
 
-    fd_Close(fd);
-
     return numPids;
 }
 
@@ -708,8 +1278,8 @@ ssize_t cgrp_SendSig
     int sig                         ///< [IN] The signal to send.
 )
 {
-    // Open the cgroup's procs file for reading.
-    int fd = OpenCgrpFile(subsystem, cgroupNamePtr, PROCS_FILENAME, O_RDONLY);
+    // Get the cgroup's procs file, ready for reading.
+    int fd = RewindTasksFile(subsystem, cgroupNamePtr, CGRP_FILE_PROCS);
 
     if (fd < 0)
     {
@@ -757,12 +1327,11 @@ ssize_t cgrp_SendSig
         else
         {
             LE_ERROR("Error reading the '%s' cgroup's tasks.", cgroupNamePtr);
-            fd_Close(fd);
+            DropFd(subsystem, cgroupNamePtr, CGRP_FILE_PROCS);
             return LE_FAULT;
         }
     }
 
-    fd_Close(fd);
     return numPids;
 }
 
@@ -782,8 +1351,13 @@ bool cgrp_IsEmpty
     const char* cgroupNamePtr       ///< [IN] Name of the cgroup.
 )
 {
-    // Open the cgroup's tasks file for reading.
-    int fd = OpenCgrpFile(subsystem, cgroupNamePtr, TASKS_FILENAME, O_RDONLY);
+    if (IsUnified())
+    {
+        return (GetEvent(cgroupNamePtr, "populated") == 0);
+    }
+
+    // Get the cgroup's tasks file, ready for reading.
+    int fd = RewindTasksFile(subsystem, cgroupNamePtr, CGRP_FILE_TASKS);
 
     if (fd < 0)
     {
@@ -792,7 +1366,6 @@ bool cgrp_IsEmpty
 
     // Read a tid from the file.
     pid_t tid = GetTasksId(fd);
-    fd_Close(fd);
 
     if (tid >= 0)
     {
@@ -806,15 +1379,71 @@ bool cgrp_IsEmpty
     else
     {
         LE_ERROR("Error reading the '%s' cgroup's tasks.", cgroupNamePtr);
+        DropFd(subsystem, cgroupNamePtr, CGRP_FILE_TASKS);
         return false;
     }
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Waits for the state of a cgroup to change: for it to become empty or populated, or frozen or
+ * thawed.  Only changes made since the state was last read (with cgrp_IsEmpty() or
+ * cgrp_frz_GetState()) are waited for, so a change that happens between reading the state and
+ * calling this function is not missed.
+ *
+ * @return
+ *      LE_OK if the state changed.
+ *      LE_TIMEOUT if the state did not change before the timeout.
+ *      LE_UNSUPPORTED if the per sub-system hierarchies are used, which give no notifications.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t cgrp_WaitForEvent
+(
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    int timeoutMs                   ///< [IN] Longest time to wait, in milliseconds.
+)
+{
+    if (!IsUnified())
+    {
+        return LE_UNSUPPORTED;
+    }
+
+    int fd = GetFd(CGRP_SUBSYS_FREEZE, cgroupNamePtr, CGRP_FILE_EVENTS);
+
+    if (fd < 0)
+    {
+        return LE_FAULT;
+    }
+
+    // The kernel flags a change of cgroup.events as a priority event.
+    struct pollfd pollFd = { .fd = fd, .events = POLLPRI };
+    int numReady;
+
+    do
+    {
+        numReady = poll(&pollFd, 1, timeoutMs);
+    }
+    while ((numReady == -1) && (errno == EINTR));
+
+    if (numReady < 0)
+    {
+        LE_ERROR("Could not wait for events of cgroup '%s'.  %m.", cgroupNamePtr);
+        return LE_FAULT;
+    }
+
+    return (numReady == 0) ? LE_TIMEOUT : LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Deletes a cgroup.
  *
+ * In the unified hierarchy the directory of the cgroup is only removed once the cgroup has been
+ * deleted from all the sub-systems it was created in.
+ *
  * @note A cgroup can only be removed when there are no processes in the group.  Ensure there are no
  *       processes in a cgroup (by killing the processes) before attempting to delete it.
  *
@@ -830,10 +1459,22 @@ le_result_t cgrp_Delete
     const char* cgroupNamePtr       ///< Name of the cgroup to delete.
 )
 {
+    Cgroup_t* cgroupPtr = GetCgroup(cgroupNamePtr);
+
+    cgroupPtr->createdSubSys &= ~(1 << subsystem);
+
+    if (IsUnified() && (cgroupPtr->createdSubSys != 0))
+    {
+        // The directory is still used by other sub-systems.
+        return LE_OK;
+    }
+
+    CloseFiles(cgroupPtr, subsystem);
+    ForgetIfUnused(cgroupPtr);
+
     // Create the path to the cgroup.
-    char path[LIMIT_MAX_PATH_BYTES] = ROOT_PATH;
-    LE_ASSERT(le_path_Concat("/", path, sizeof(path), SubSysName[subsystem], cgroupNamePtr,
-                             (char*)NULL) == LE_OK);
+    char path[LIMIT_MAX_PATH_BYTES];
+    GetPath(path, sizeof(path), subsystem, cgroupNamePtr, NULL);
 
     // Attempt to remove the cgroup directory.
     if (rmdir(path) != 0)
@@ -909,6 +1550,9 @@ const char* cgrp_SubSysName
  * The process in cgroupC will get 2048/4608 = 44% of the cpu.
  * The system process will get 1024/4608 = 22% of the cpu.
  *
+ * In the unified hierarchy the share is scaled to a cpu weight (1 to 10000) so that the default
+ * share of 1024 is the default weight of 100, which keeps the proportions above.
+ *
  * @return
  *      LE_OK if successful.
  *      LE_FAULT if there was an error.
@@ -921,12 +1565,18 @@ le_result_t cgrp_cpu_SetShare
                                     ///  details.
 )
 {
+    if (IsUnified())
+    {
+        share = (share * 100) / 1024;
+        share = (share < 1) ? 1 : ((share > 10000) ? 10000 : share);
+    }
+
     // Convert the value to a string.
     char shareStr[MAX_DIGITS];
     LE_ASSERT(snprintf(shareStr, sizeof(shareStr), "%zd", share) < sizeof(shareStr));
 
     // Write the share value to the file.
-    if (WriteToFile(CGRP_SUBSYS_CPU, cgroupNamePtr, CPU_SHARES_FILENAME, shareStr) != LE_OK)
+    if (WriteToFile(CGRP_SUBSYS_CPU, cgroupNamePtr, CGRP_FILE_CPU_SHARE, shareStr) != LE_OK)
     {
         return LE_FAULT;
     }
@@ -958,7 +1608,7 @@ le_result_t cgrp_mem_SetLimit
     LE_ASSERT(snprintf(limitStr, sizeof(limitStr), "%zd", limit * 1024) < sizeof(limitStr));
 
     // Write the limit to the file.
-    if (WriteToFile(CGRP_SUBSYS_MEM, cgroupNamePtr, MEM_LIMIT_FILENAME, limitStr) != LE_OK)
+    if (WriteToFile(CGRP_SUBSYS_MEM, cgroupNamePtr, CGRP_FILE_MEM_LIMIT, limitStr) != LE_OK)
     {
         return LE_FAULT;
     }
@@ -968,7 +1618,7 @@ le_result_t cgrp_mem_SetLimit
 
     if (GetValue(CGRP_SUBSYS_MEM,
                  cgroupNamePtr,
-                 MEM_LIMIT_FILENAME,
+                 CGRP_FILE_MEM_LIMIT,
                  readLimitStr,
                  sizeof(readLimitStr)) != LE_OK)
     {
@@ -1002,7 +1652,8 @@ le_result_t cgrp_frz_Freeze
     const char* cgroupNamePtr       ///< [IN] Name of the cgroup.
 )
 {
-    if (WriteToFile(CGRP_SUBSYS_FREEZE, cgroupNamePtr, FREEZE_STATE_FILENAME, "FROZEN") != LE_OK)
+    if (WriteToFile(CGRP_SUBSYS_FREEZE, cgroupNamePtr, CGRP_FILE_FREEZE,
+                    IsUnified() ? "1" : "FROZEN") != LE_OK)
     {
         return LE_FAULT;
     }
@@ -1028,7 +1679,8 @@ le_result_t cgrp_frz_Thaw
     const char* cgroupNamePtr       ///< [IN] Name of the cgroup.
 )
 {
-    if (WriteToFile(CGRP_SUBSYS_FREEZE, cgroupNamePtr, FREEZE_STATE_FILENAME, "THAWED") != LE_OK)
+    if (WriteToFile(CGRP_SUBSYS_FREEZE, cgroupNamePtr, CGRP_FILE_FREEZE,
+                    IsUnified() ? "0" : "THAWED") != LE_OK)
     {
         return LE_FAULT;
     }
@@ -1051,11 +1703,23 @@ cgrp_FreezeState_t cgrp_frz_GetState
     const char* cgroupNamePtr       ///< [IN] Name of the cgroup.
 )
 {
+    if (IsUnified())
+    {
+        int frozen = GetEvent(cgroupNamePtr, "frozen");
+
+        if (frozen == LE_FAULT)
+        {
+            return LE_FAULT;
+        }
+
+        return (frozen != 0) ? CGRP_FROZEN : CGRP_THAWED;
+    }
+
     char stateStr[MAX_FREEZE_STATE_BYTES] = {0};
 
     le_result_t result = GetValue(CGRP_SUBSYS_FREEZE,
                                   cgroupNamePtr,
-                                  FREEZE_STATE_FILENAME,
+                                  CGRP_FILE_FREEZE,
                                   stateStr,
                                   sizeof(stateStr));
 
@@ -1100,10 +1764,11 @@ ssize_t cgrp_GetMemUsed
 
     if (GetValue(CGRP_SUBSYS_MEM,
                  cgroupNamePtr,
-                 "memory.memsw.usage_in_bytes",
+                 CGRP_FILE_MEM_USED,
                  buffer,
                  sizeof(buffer)) == LE_OK)
     {
+        errno = 0;
         result = strtol(buffer, NULL, 10);
         if ((errno == ERANGE) || (errno == EINVAL))
         {
@@ -1133,10 +1798,11 @@ ssize_t cgrp_GetMaxMemUsed
 
     if (GetValue(CGRP_SUBSYS_MEM,
                  cgroupNamePtr,
-                 "memory.memsw.max_usage_in_bytes",
+                 CGRP_FILE_MEM_MAX_USED,
                  buffer,
                  sizeof(buffer)) == LE_OK)
     {
+        errno = 0;
         result = strtol(buffer, NULL, 10);
         if ((errno == ERANGE) || (errno == EINVAL))
         {
@@ -1149,3 +1815,81 @@ ssize_t cgrp_GetMaxMemUsed
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parses one line of a pressure file, for example
+ * "some avg10=0.12 avg60=0.05 avg300=0.01 total=123456".
+ *
+ * @return
+ *      true if the line is for the given kind of stall and was parsed.
+ *      false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ParseStall
+(
+    const char* linePtr,            ///< [IN] The line.
+    const char* kindPtr,            ///< [IN] "some" or "full".
+    cgrp_Stall_t* stallPtr          ///< [OUT] The parsed values.
+)
+{
+    size_t kindLen = strlen(kindPtr);
+
+    if ((strncmp(linePtr, kindPtr, kindLen) != 0) || (linePtr[kindLen] != ' '))
+    {
+        return false;
+    }
+
+    return (sscanf(linePtr + kindLen + 1, "avg10=%lf avg60=%lf avg300=%lf total=%" SCNu64,
+                   &stallPtr->avg10, &stallPtr->avg60, &stallPtr->avg300,
+                   &stallPtr->totalUs) == 4);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the pressure stall information of a cgroup for a sub-system: how much of the time its tasks
+ * were kept waiting for the cpu, or for memory (reclaim, swapping, ...).
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_UNSUPPORTED if the per sub-system hierarchies are used, the sub-system has no pressure
+ *                     information, or the kernel does not keep it.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t cgrp_GetPressure
+(
+    cgrp_SubSys_t subsystem,        ///< [IN] CGRP_SUBSYS_CPU or CGRP_SUBSYS_MEM.
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    cgrp_Pressure_t* pressurePtr    ///< [OUT] The pressure stall information.
+)
+{
+    if (!IsUnified() || (PressureFileName[subsystem] == NULL) ||
+        (GetFd(subsystem, cgroupNamePtr, CGRP_FILE_PRESSURE) < 0))
+    {
+        return LE_UNSUPPORTED;
+    }
+
+    char buffer[MAX_PRESSURE_BYTES];
+
+    if (GetValue(subsystem, cgroupNamePtr, CGRP_FILE_PRESSURE, buffer, sizeof(buffer)) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    // The "full" line is missing for the cpu on older kernels.
+    memset(pressurePtr, 0, sizeof(*pressurePtr));
+
+    const char* fullPtr = strchr(buffer, '\n');
+
+    if (!ParseStall(buffer, "some", &pressurePtr->some) ||
+        ((fullPtr != NULL) && !ParseStall(fullPtr + 1, "full", &pressurePtr->full)))
+    {
+        LE_ERROR("Could not parse pressure of cgroup '%s': '%s'.", cgroupNamePtr, buffer);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+
@@ -1,6 +1,7 @@
 /** @file cgroups.h
  *
  * @ref c_cgrp_layout <br>
+ * @ref c_cgrp_unified <br>
  * @ref c_cgrp_init <br>
  * @ref c_cgrp_create <br>
  * @ref c_cgrp_settingAttributes <br>
@@ -44,6 +45,23 @@
  * sub-system will be used interchangeably henceforth.
  *
  *
+ * @section c_cgrp_unified Unified Hierarchy
+ *
+ * If the unified (v2) hierarchy is mounted on /sys/fs/cgroup (or LE_CONFIG_SUPERV_CGROUP_V2 asks
+ * for it to be mounted), it is used instead.  All the sub-systems then share one hierarchy, so a
+ * cgroup created in several sub-systems is a single cgroup, and the API works out the equivalent
+ * v2 control files (cpu.weight for the cpu share, memory.max for the memory limit, cgroup.freeze
+ * for the freezer).  Two things are only available in the unified hierarchy:
+ *
+ * - cgrp_WaitForEvent() waits for a cgroup to freeze, thaw, empty or be populated, rather than
+ *   having to poll its state.
+ * - cgrp_GetPressure() gets pressure stall information: how long the cgroup's tasks were kept
+ *   waiting for the cpu or for memory.
+ *
+ * In both hierarchies the control files of a cgroup are opened the first time they are used and
+ * kept open until the cgroup is deleted.
+ *
+ *
  * @section c_cgrp_init Initialization
  *
  * On system start-up the cgrp_Init() function must be called to setup the hierarchies.  Cgroups are
@@ -132,6 +150,34 @@ typedef enum
 cgrp_FreezeState_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pressure stall figures for one kind of stall.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    double avg10;           ///< Percentage of the last 10 seconds during which tasks were stalled.
+    double avg60;           ///< Same over the last 60 seconds.
+    double avg300;          ///< Same over the last 300 seconds.
+    uint64_t totalUs;       ///< Total time tasks were stalled, in microseconds.
+}
+cgrp_Stall_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pressure stall information of a cgroup for a resource.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    cgrp_Stall_t some;      ///< Time during which some of the tasks were stalled.
+    cgrp_Stall_t full;      ///< Time during which all the non-idle tasks were stalled at once.
+}
+cgrp_Pressure_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initializes cgroups for the system.  Sets up a hierarchy for each supported subsystem.
@@ -158,6 +204,9 @@ void cgrp_Init
  * that is a sub-group of "Students".  Note that all parent groups must first exist before a
  * sub-group can be created.
  *
+ * In the unified hierarchy the sub-systems share one directory per cgroup, which is made when the
+ * cgroup is first created in any sub-system.
+ *
  * @return
  *      LE_OK if successful.
  *      LE_DUPLICATE if the cgroup already exists.
@@ -258,10 +307,34 @@ bool cgrp_IsEmpty
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Waits for the state of a cgroup to change: for it to become empty or populated, or frozen or
+ * thawed.  Only changes made since the state was last read (with cgrp_IsEmpty() or
+ * cgrp_frz_GetState()) are waited for, so a change that happens between reading the state and
+ * calling this function is not missed.
+ *
+ * @return
+ *      LE_OK if the state changed.
+ *      LE_TIMEOUT if the state did not change before the timeout.
+ *      LE_UNSUPPORTED if the per sub-system hierarchies are used, which give no notifications.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t cgrp_WaitForEvent
+(
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    int timeoutMs                   ///< [IN] Longest time to wait, in milliseconds.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Deletes a cgroup.
  *
+ * In the unified hierarchy the directory of the cgroup is only removed once the cgroup has been
+ * deleted from all the sub-systems it was created in.
+ *
  * @note A cgroup can only be removed when there are no processes in the group.  Ensure there are no
  *       processes in a cgroup (by killing the processes) before attempting to delete it.
  *
@@ -327,6 +400,9 @@ const char* cgrp_SubSysName
  * The process in cgroupC will get 2048/4608 = 44% of the cpu.
  * The system process will get 1024/4608 = 22% of the cpu.
  *
+ * In the unified hierarchy the share is scaled to a cpu weight (1 to 10000) so that the default
+ * share of 1024 is the default weight of 100, which keeps the proportions above.
+ *
  * @return
  *      LE_OK if successful.
  *      LE_FAULT if there was an error.
@@ -435,4 +511,24 @@ ssize_t cgrp_GetMaxMemUsed
     const char* cgroupNamePtr       ///< [IN] Name of the cgroup.
 );
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the pressure stall information of a cgroup for a sub-system: how much of the time its tasks
+ * were kept waiting for the cpu, or for memory (reclaim, swapping, ...).
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_UNSUPPORTED if the per sub-system hierarchies are used, the sub-system has no pressure
+ *                     information, or the kernel does not keep it.
+ *      LE_FAULT if there was some other error.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t cgrp_GetPressure
+(
+    cgrp_SubSys_t subsystem,        ///< [IN] CGRP_SUBSYS_CPU or CGRP_SUBSYS_MEM.
+    const char* cgroupNamePtr,      ///< [IN] Name of the cgroup.
+    cgrp_Pressure_t* pressurePtr    ///< [OUT] The pressure stall information.
+);
+
 #endif // LEGATO_SRC_CGROUPS_INCLUDE_GUARD
@@ -19,14 +19,16 @@
  * Included in the set of file descriptors that are being monitored by epoll is an eventfd
  * (see 'man eventfd') monitored in "level-triggered" mode.
  *
- * Whenever an Event Report is added to the Event Queue for a thread, the number 1 is written to
- * that thread's eventfd.  When Event Reports are popped off a thread's Event Queue, that thread's
- * eventfd is read to decrement it.  As long as the eventfd's value is greater than 0, epoll_wait()
+ * When an Event Report is added to an empty Event Queue for a thread (or, more precisely, the
+ * first time one is added after the thread last fetched its queue), the number 1 is written to
+ * that thread's eventfd.  Further reports added before the thread wakes up don't touch the
+ * eventfd.  When the thread wakes up, it reads the eventfd to reset it and takes the whole
+ * Event Queue in one batch.  As long as the eventfd's value is greater than 0, epoll_wait()
  * will return immediately, reporting that there is something to read from that fd.
  *
  * The Event Loop is an infinite loop that calls epoll_wait() and then responds to any fd events
- * that epoll_wait() reports.  If epoll_wait() reports an event on the eventfd, then an Event Report
- * is popped off the Event Queue and processed.  If epoll_wait() reports an event on any other fd,
+ * that epoll_wait() reports.  If epoll_wait() reports an event on the eventfd, then the Event
+ * Queue is taken as a batch and its Event Reports are processed.  If epoll_wait() reports an event on any other fd,
  * FD Event Reports are created and pushed onto Event Queues according to what handlers are
  * registered for those events.  All pending Event Reports are processed until the Event Queue is
  * empty before returning to epoll_wait().  (NOTE: This choice was made to save system call
@@ -53,7 +55,7 @@
 // ==============================================
 
 /// Maximum number of events that can be received from epoll_wait() at one time.
-#define MAX_EPOLL_EVENTS 32
+#define MAX_EPOLL_EVENTS LE_CONFIG_EVENT_MAX_FD_EVENTS
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -77,6 +79,14 @@ static short EPollToPoll
 {
     short pollFlags = 0;
 
+    // Linux gives the epoll(7) flags the same values as their poll(2) counterparts, in which case
+    // this folds down to a mask at compile time.
+    if ((EPOLLIN == POLLIN) && (EPOLLPRI == POLLPRI) && (EPOLLOUT == POLLOUT) &&
+        (EPOLLHUP == POLLHUP) && (EPOLLRDHUP == POLLRDHUP) && (EPOLLERR == POLLERR))
+    {
+        return (short)(epollFlags & (POLLIN | POLLPRI | POLLOUT | POLLHUP | POLLRDHUP | POLLERR));
+    }
+
     if (epollFlags & EPOLLIN)
     {
         pollFlags |= POLLIN;
@@ -217,9 +227,10 @@ void fa_event_DestructThread
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Write to a thread's Event File Descriptor.  This increments it by one.
+ * Write to a thread's Event File Descriptor, unless the thread has already been triggered since
+ * it last fetched its Event Queue.
  *
- * This must be done exactly once for each Event Report pushed onto the thread's Event Queue.
+ * This must be done each time an Event Report is pushed onto the thread's Event Queue.
  */
 //--------------------------------------------------------------------------------------------------
 void fa_event_TriggerEvent_NoLock
@@ -235,6 +246,13 @@ void fa_event_TriggerEvent_NoLock
 
     ssize_t writeSize;
 
+    // The thread is already going to wake up and take everything on its queue.
+    if (portablePerThreadRecPtr->triggerPending)
+    {
+        return;
+    }
+    portablePerThreadRecPtr->triggerPending = true;
+
     for (;;)
     {
         writeSize = write(perThreadRecPtr->eventQueueFd, &writeBuff, sizeof(writeBuff));
@@ -260,9 +278,9 @@ void fa_event_TriggerEvent_NoLock
 //--------------------------------------------------------------------------------------------------
 /**
  * Read a thread's Event File Descriptor.  This fetches the value of the Event FD (which is
- * the number of event reports on the Event Queue) and resets the Event FD value to zero.
+ * the number of wakeups signalled since it was last read) and resets the Event FD value to zero.
  *
- * @return The number of Event Reports on the thread's Event Queue.
+ * @return The number of wakeups signalled.
  */
 //--------------------------------------------------------------------------------------------------
 uint64_t fa_event_WaitForEvent
@@ -323,6 +341,7 @@ void fa_event_RunLoop
                                event_LinuxPerThreadRec_t,
                                portablePerThreadRec)->epollFd;
     struct epoll_event epollEventList[MAX_EPOLL_EVENTS];
+    bool isBatchLeft = false;
 
     // Make sure nobody calls this function more than once in the same thread.
     LE_ASSERT(perThreadRecPtr->state == LE_EVENT_LOOP_INITIALIZED);
@@ -334,8 +353,12 @@ void fa_event_RunLoop
     for (;;)
     {
         // Wait for something to happen on one of the file descriptors that we are monitoring
-        // using our epoll fd.
-        int result = epoll_wait(epollFd, epollEventList, NUM_ARRAY_MEMBERS(epollEventList), -1);
+        // using our epoll fd.  If the last batch was cut short by its deadline, only check
+        // what has happened in the meantime, without waiting.
+        int result = epoll_wait(epollFd,
+                                epollEventList,
+                                NUM_ARRAY_MEMBERS(epollEventList),
+                                isBatchLeft ? 0 : -1);
 
         // If something happened on one or more of the monitored file descriptors,
         if (result > 0)
@@ -362,8 +385,16 @@ void fa_event_RunLoop
                 }
             }
 
-            // Process all the Event Reports on the Event Queue.
-            event_ProcessEventReports(perThreadRecPtr);
+            // Take all the Event Reports on the Event Queue, and process them (high priority
+            // ones first) until they are done or the batch deadline has passed.
+            event_FetchEventReports(perThreadRecPtr);
+            isBatchLeft = event_ProcessBatch(perThreadRecPtr);
+        }
+        // Otherwise, if nothing happened while the last batch was being processed, go on with it.
+        // (The Event Queue's eventfd isn't readable, so there is nothing to fetch.)
+        else if ((result == 0) && isBatchLeft)
+        {
+            isBatchLeft = event_ProcessBatch(perThreadRecPtr);
         }
         // Otherwise, if an epoll_wait() reported an error, hopefully it's just an interruption
         // by a signal (EINTR).  Anything else is a fatal error.
@@ -378,8 +409,8 @@ void fa_event_RunLoop
             // check if someone has cancelled the thread and terminate the thread now, if so.
             pthread_testcancel();
         }
-        // Otherwise, if epoll_wait() returned zero, something has gone horribly wrong, because
-        // it should never return zero.
+        // Otherwise, if epoll_wait() returned zero without a timeout, something has gone horribly
+        // wrong, because it should never return zero.
         else
         {
             LE_FATAL("epoll_wait() returned zero!");
@@ -513,9 +544,9 @@ le_result_t le_event_ServiceLoop
         return LE_WOULD_BLOCK;
     }
 
-    // Read the eventfd to reset it to zero so epoll stops telling us about it until more
-    // are added.
-    perThreadRecPtr->liveEventCount = fa_event_WaitForEvent(perThreadRecPtr);
+    // Reset the eventfd so epoll stops telling us about it until more are added, and take
+    // everything on the Event Queue as one batch.
+    perThreadRecPtr->liveEventCount = event_FetchEventReports(perThreadRecPtr);
 
     LE_DEBUG("perThreadRecPtr->liveEventCount is" "%" PRIu64, perThreadRecPtr->liveEventCount);
 
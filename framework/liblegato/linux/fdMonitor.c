@@ -491,3 +491,31 @@ void fa_fdMon_SetDeferrable
 
     UpdateEpollFd(linuxMonPtr);
 }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets if events on a given fd are reported only when the fd becomes ready (edge-triggered) rather
+ * than for as long as it is ready (level-triggered).
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_fdMon_SetEdgeTriggered
+(
+    fdMon_t *monitorPtr,        ///< FD monitor instance.
+    bool     isEdgeTriggered    ///< Edge-triggered (true) or level-triggered (false).
+)
+{
+    fdMon_Linux_t *linuxMonPtr = CONTAINER_OF(monitorPtr, fdMon_Linux_t, base);
+
+    // Set/clear the EPOLLET flag in the FD Monitor's epoll(7) flags set.  Re-arming the fd
+    // reports it again if it is ready now, so no readiness is lost by switching.
+    if (isEdgeTriggered)
+    {
+        linuxMonPtr->epollEvents |= EPOLLET;
+    }
+    else
+    {
+        linuxMonPtr->epollEvents &= ~EPOLLET;
+    }
+
+    UpdateEpollFd(linuxMonPtr);
+}
@@ -0,0 +1,462 @@
+//--------------------------------------------------------------------------------------------------
+/** @file fiber.c
+ *
+ * Implementation of the @ref c_fiber.
+ *
+ * Each fiber has a stack from a memory pool and a ucontext_t.  A fiber that is ready to run is
+ * queued on its thread's event queue as a call to RunFiber(), which switches to the fiber's
+ * context, saving the event loop's context in the fiber.  When the fiber suspends itself (or
+ * returns from its main function), it switches back to that saved context, and RunFiber()
+ * returns to the event loop.  The fiber's stack is only given back to the pool from RunFiber(),
+ * once the fiber is off it.
+ *
+ * The waiting functions create a timer, FD Monitor or IPC response handler in the fiber's thread,
+ * whose handler records the outcome in the fiber and resumes it.  They suspend the fiber until
+ * their own event has happened, so that a stray le_fiber_Resume() doesn't cut a wait short.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "fiber.h"
+
+#include <ucontext.h>
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a fiber's name, including the null terminator.
+ */
+//--------------------------------------------------------------------------------------------------
+#define FIBER_NAME_BYTES    32
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * States of a fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    FIBER_READY,        ///< Queued on its thread's event queue.
+    FIBER_RUNNING,      ///< Running.
+    FIBER_SUSPENDED,    ///< Waiting to be resumed.
+    FIBER_DONE          ///< Returned from its main function.
+}
+FiberState_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+struct le_fiber
+{
+    char                name[FIBER_NAME_BYTES]; ///< Name of the fiber.
+    FiberState_t        state;          ///< What the fiber is doing.
+    le_thread_Ref_t     threadRef;      ///< Thread the fiber runs in.
+    le_fiber_MainFunc_t mainFunc;       ///< Main function.
+    void               *contextPtr;     ///< Pointer to pass to it.
+    void               *stackPtr;       ///< Stack, from the stack pool.
+    ucontext_t          context;        ///< Context of the fiber, while it is not running.
+    ucontext_t          loopContext;    ///< Context of the event loop, while the fiber is running.
+    bool                isWaitOver;     ///< Set by the handler of the event being waited for.
+    short               fdEvents;       ///< Events reported by le_fiber_WaitFd()'s FD Monitor.
+    le_msg_MessageRef_t responseRef;    ///< Response received by le_fiber_RequestResponse().
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool the fibers are allocated from.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t FiberPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool the fibers' stacks are allocated from.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t StackPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread-local data key holding the fiber that the thread is running, if any.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_key_t CurrentFiberKey;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the running fiber, which the caller must be.
+ *
+ * @return The fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_fiber_Ref_t GetCurrentFiber
+(
+    const char *funcNameStr     ///< [IN] Name of the calling function, for the error message.
+)
+{
+    le_fiber_Ref_t fiberRef = pthread_getspecific(CurrentFiberKey);
+
+    LE_FATAL_IF(fiberRef == NULL, "%s() called outside of a fiber.", funcNameStr);
+    return fiberRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Entry point of every fiber's context.  Runs the fiber's main function, then switches back to
+ * the event loop for good.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FiberEntry
+(
+    void
+)
+{
+    le_fiber_Ref_t fiberRef = pthread_getspecific(CurrentFiberKey);
+
+    fiberRef->mainFunc(fiberRef->contextPtr);
+
+    fiberRef->state = FIBER_DONE;
+    setcontext(&fiberRef->loopContext);
+
+    LE_FATAL("Fiber '%s' returned to its entry point.", fiberRef->name);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run a fiber until it suspends itself or is done.  Called by the event loop of the fiber's
+ * thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunFiber
+(
+    void *param1Ptr,    ///< [IN] The fiber.
+    void *param2Ptr     ///< [IN] Unused.
+)
+{
+    le_fiber_Ref_t fiberRef = param1Ptr;
+
+    LE_UNUSED(param2Ptr);
+    LE_ASSERT(fiberRef->state == FIBER_READY);
+
+    fiberRef->state = FIBER_RUNNING;
+    pthread_setspecific(CurrentFiberKey, fiberRef);
+    LE_ASSERT(swapcontext(&fiberRef->loopContext, &fiberRef->context) == 0);
+    pthread_setspecific(CurrentFiberKey, NULL);
+
+    if (fiberRef->state == FIBER_DONE)
+    {
+        LE_DEBUG("Fiber '%s' done.", fiberRef->name);
+        le_mem_Release(fiberRef->stackPtr);
+        le_mem_Release(fiberRef);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record that the event a fiber is waiting for has happened, and resume the fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndWait
+(
+    le_fiber_Ref_t fiberRef     ///< [IN] The fiber.
+)
+{
+    fiberRef->isWaitOver = true;
+    le_fiber_Resume(fiberRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Suspend the calling fiber until EndWait() is called for it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Wait
+(
+    le_fiber_Ref_t fiberRef     ///< [IN] The fiber, which must be the caller.
+)
+{
+    while (!fiberRef->isWaitOver)
+    {
+        le_fiber_Suspend();
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timer handler for le_fiber_Sleep().
+ */
+//--------------------------------------------------------------------------------------------------
+static void SleepExpired
+(
+    le_timer_Ref_t timerRef     ///< [IN] The sleeping fiber's timer.
+)
+{
+    EndWait(le_timer_GetContextPtr(timerRef));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * FD Monitor handler for le_fiber_WaitFd().
+ */
+//--------------------------------------------------------------------------------------------------
+static void FdReady
+(
+    int     fd,         ///< [IN] The file descriptor.
+    short   events      ///< [IN] Events that occurred.
+)
+{
+    le_fiber_Ref_t fiberRef = le_fdMonitor_GetContextPtr();
+
+    LE_UNUSED(fd);
+
+    // Stop polling for the events until the fiber has run and deleted the monitor.
+    le_fdMonitor_Disable(le_fdMonitor_GetMonitor(), POLLIN | POLLOUT | POLLPRI);
+
+    fiberRef->fdEvents = events;
+    EndWait(fiberRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * IPC response handler for le_fiber_RequestResponse().
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResponseReceived
+(
+    le_msg_MessageRef_t msgRef,     ///< [IN] The response, or NULL if the transaction failed.
+    void               *contextPtr  ///< [IN] The waiting fiber.
+)
+{
+    le_fiber_Ref_t fiberRef = contextPtr;
+
+    fiberRef->responseRef = msgRef;
+    EndWait(fiberRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start a fiber in the calling thread.
+ *
+ * @return A reference to the fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+le_fiber_Ref_t le_fiber_Start
+(
+    const char*         nameStr,    ///< [IN] Name of the fiber (for diagnostics).
+    le_fiber_MainFunc_t mainFunc,   ///< [IN] Main function of the fiber.
+    void*               contextPtr  ///< [IN] Pointer to pass to it.
+)
+{
+    le_fiber_Ref_t fiberRef;
+
+    LE_ASSERT(nameStr);
+    LE_ASSERT(mainFunc);
+
+    fiberRef = le_mem_ForceAlloc(FiberPool);
+    memset(fiberRef, 0, sizeof(*fiberRef));
+
+    if (le_utf8_Copy(fiberRef->name, nameStr, sizeof(fiberRef->name), NULL) == LE_OVERFLOW)
+    {
+        LE_WARN("Fiber name '%s' truncated to '%s'.", nameStr, fiberRef->name);
+    }
+    fiberRef->threadRef = le_thread_GetCurrent();
+    fiberRef->mainFunc = mainFunc;
+    fiberRef->contextPtr = contextPtr;
+    fiberRef->stackPtr = le_mem_ForceAlloc(StackPool);
+
+    LE_FATAL_IF(getcontext(&fiberRef->context) != 0,
+                "Can't get context for fiber '%s' (error %d).", fiberRef->name, errno);
+    fiberRef->context.uc_stack.ss_sp = fiberRef->stackPtr;
+    fiberRef->context.uc_stack.ss_size = LE_CONFIG_FIBER_STACK_SIZE;
+    fiberRef->context.uc_link = NULL;
+    makecontext(&fiberRef->context, FiberEntry, 0);
+
+    fiberRef->state = FIBER_READY;
+    le_event_QueueFunction(RunFiber, fiberRef, NULL);
+
+    return fiberRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the fiber that is running.
+ *
+ * @return The fiber, or NULL if the caller is not running in a fiber.
+ */
+//--------------------------------------------------------------------------------------------------
+le_fiber_Ref_t le_fiber_GetCurrent
+(
+    void
+)
+{
+    return pthread_getspecific(CurrentFiberKey);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Suspend the calling fiber until it is resumed with le_fiber_Resume().
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fiber_Suspend
+(
+    void
+)
+{
+    le_fiber_Ref_t fiberRef = GetCurrentFiber(__func__);
+
+    // A fiber that resumed itself (see le_fiber_Yield()) is already queued to run again.
+    if (fiberRef->state == FIBER_RUNNING)
+    {
+        fiberRef->state = FIBER_SUSPENDED;
+    }
+
+    LE_ASSERT(swapcontext(&fiberRef->context, &fiberRef->loopContext) == 0);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make a suspended fiber ready to run.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fiber_Resume
+(
+    le_fiber_Ref_t fiberRef     ///< [IN] The fiber.
+)
+{
+    LE_ASSERT(fiberRef);
+    LE_FATAL_IF(fiberRef->threadRef != le_thread_GetCurrent(),
+                "Fiber '%s' resumed from another thread.", fiberRef->name);
+
+    if ((fiberRef->state == FIBER_SUSPENDED) || (fiberRef->state == FIBER_RUNNING))
+    {
+        fiberRef->state = FIBER_READY;
+        le_event_QueueFunction(RunFiber, fiberRef, NULL);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Let the thread's event loop run the events that are already queued, then go on.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fiber_Yield
+(
+    void
+)
+{
+    le_fiber_Resume(GetCurrentFiber(__func__));
+    le_fiber_Suspend();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Suspend the calling fiber for a while.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_fiber_Sleep
+(
+    uint32_t ms     ///< [IN] Time to sleep, in milliseconds.
+)
+{
+    le_fiber_Ref_t fiberRef = GetCurrentFiber(__func__);
+    le_timer_Ref_t timerRef = le_timer_Create(fiberRef->name);
+
+    LE_ASSERT_OK(le_timer_SetMsInterval(timerRef, ms));
+    LE_ASSERT_OK(le_timer_SetHandler(timerRef, SleepExpired));
+    LE_ASSERT_OK(le_timer_SetContextPtr(timerRef, fiberRef));
+
+    fiberRef->isWaitOver = false;
+    LE_ASSERT_OK(le_timer_Start(timerRef));
+    Wait(fiberRef);
+
+    le_timer_Delete(timerRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Suspend the calling fiber until a file descriptor is ready.
+ *
+ * @return The events that occurred.
+ */
+//--------------------------------------------------------------------------------------------------
+short le_fiber_WaitFd
+(
+    int     fd,         ///< [IN] File descriptor to wait for.
+    short   events      ///< [IN] Events to wait for (POLLIN, POLLOUT, POLLPRI).
+)
+{
+    le_fiber_Ref_t fiberRef = GetCurrentFiber(__func__);
+    le_fdMonitor_Ref_t monitorRef;
+
+    fiberRef->isWaitOver = false;
+    fiberRef->fdEvents = 0;
+
+    monitorRef = le_fdMonitor_Create(fiberRef->name, fd, FdReady, events);
+    le_fdMonitor_SetContextPtr(monitorRef, fiberRef);
+    Wait(fiberRef);
+
+    le_fdMonitor_Delete(monitorRef);
+    return fiberRef->fdEvents;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a request message and suspend the calling fiber until the response is received.
+ *
+ * @return The response message, or NULL if the transaction failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_MessageRef_t le_fiber_RequestResponse
+(
+    le_msg_MessageRef_t msgRef  ///< [IN] The request message.
+)
+{
+    le_fiber_Ref_t fiberRef = GetCurrentFiber(__func__);
+
+    fiberRef->isWaitOver = false;
+    fiberRef->responseRef = NULL;
+
+    le_msg_RequestResponse(msgRef, ResponseReceived, fiberRef);
+    Wait(fiberRef);
+
+    return fiberRef->responseRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the fiber module.  This function is meant to be called from Legato's internal init.
+ */
+//--------------------------------------------------------------------------------------------------
+void fiber_Init
+(
+    void
+)
+{
+    FiberPool = le_mem_CreatePool("FiberPool", sizeof(struct le_fiber));
+    StackPool = le_mem_CreatePool("FiberStackPool", LE_CONFIG_FIBER_STACK_SIZE);
+    LE_ASSERT(pthread_key_create(&CurrentFiberKey, NULL) == 0);
+}
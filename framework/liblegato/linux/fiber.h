@@ -0,0 +1,28 @@
+//--------------------------------------------------------------------------------------------------
+/** @file fiber.h
+ *
+ * Legato fiber inter-module include file.
+ *
+ * This file exposes interfaces that are for use by other modules inside the framework
+ * implementation, but must not be used outside of the framework implementation.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_SRC_FIBER_INCLUDE_GUARD
+#define LEGATO_SRC_FIBER_INCLUDE_GUARD
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the fiber module.  This function is meant to be called from Legato's internal init.
+ */
+//--------------------------------------------------------------------------------------------------
+void fiber_Init
+(
+    void
+);
+
+
+#endif  // LEGATO_SRC_FIBER_INCLUDE_GUARD
@@ -10,6 +10,9 @@
 //--------------------------------------------------------------------------------------------------
 
 #include <sys/sendfile.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
 #include "legato.h"
 #include "smack.h"
 #include "fileDescriptor.h"
@@ -545,6 +548,127 @@ static le_result_t CreateDir
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set once copy_file_range() turns out not to be supported by the kernel, so that it isn't tried
+ * again for every file.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool CopyFileRangeUnsupported = false;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy the contents of one open file into another, empty, one.
+ *
+ * The cheapest way the kernel and file systems support is used:
+ *  - a reflink (FICLONE), which shares the source's data blocks with the destination instead of
+ *    copying them, on file systems that support it;
+ *  - copy_file_range(), which copies the data inside the kernel and lets the file system offload
+ *    the copy;
+ *  - sendfile(), which copies the data inside the kernel.
+ *
+ * @return - LE_OK if the copy was successful.
+ *         - LE_IO_ERROR if an IO error occurs during the copy operation.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CopyData
+(
+    int readFd,                 ///< [IN] File to copy from, open for reading.
+    int writeFd,                ///< [IN] File to copy to, open for writing.
+    off_t size,                 ///< [IN] Size of the file to copy from.
+    const char* sourcePathPtr,  ///< [IN] Path of the file to copy from, for error messages.
+    const char* destPathPtr     ///< [IN] Path of the file to copy to, for error messages.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#ifdef FICLONE
+    // Fails with EOPNOTSUPP, EXDEV, EINVAL, ... if the file system or the pair of files don't
+    // support it, in which case the data has to be copied.
+    if (ioctl(writeFd, FICLONE, readFd) == 0)
+    {
+        return LE_OK;
+    }
+#endif
+
+    off_t sizeWritten = 0;
+
+#ifdef SYS_copy_file_range
+    // Called through syscall() because the C library may not have a wrapper for it.
+    while (!CopyFileRangeUnsupported && (sizeWritten < size))
+    {
+        ssize_t nextWritten = syscall(SYS_copy_file_range,
+                                      readFd, NULL,
+                                      writeFd, NULL,
+                                      (size_t)(size - sizeWritten),
+                                      0);
+
+        if (nextWritten == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            if (errno == ENOSYS)
+            {
+                CopyFileRangeUnsupported = true;
+            }
+
+            // Kernels before 5.3 refuse to copy between file systems (EXDEV), and some file
+            // systems don't support it at all.  Let sendfile() finish the job from where this
+            // stopped.
+            if ((errno == ENOSYS) || (errno == EXDEV) || (errno == EINVAL) ||
+                (errno == EOPNOTSUPP))
+            {
+                break;
+            }
+
+            LE_CRIT("Error when copying file '%s' to '%s'. (%m)", sourcePathPtr, destPathPtr);
+            return LE_IO_ERROR;
+        }
+
+        if (nextWritten == 0)
+        {
+            // The source file got shorter while it was being copied.
+            return LE_OK;
+        }
+
+        sizeWritten += nextWritten;
+    }
+#endif
+
+    // Get the kernel to copy the data over.  It may or may not happen in one go, so keep trying
+    // until the whole file has been written or we error out.  Both file offsets are where
+    // copy_file_range() left them.
+    while (sizeWritten < size)
+    {
+        ssize_t nextWritten = sendfile(writeFd, readFd, NULL, size - sizeWritten);
+
+        if (nextWritten == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            LE_CRIT("Error when copying file '%s' to '%s'. (%m)", sourcePathPtr, destPathPtr);
+            return LE_IO_ERROR;
+        }
+
+        if (nextWritten == 0)
+        {
+            // The source file got shorter while it was being copied.
+            break;
+        }
+
+        sizeWritten += nextWritten;
+    }
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Copy a file.  This function copies the source file's owner, permissions and extended attributes
@@ -632,28 +756,8 @@ le_result_t file_Copy
         return result;
     }
 
-    // Get the kernel to copy the data over.  It may or may not happen in one go, so keep trying
-    // until the whole file has been written or we error out.
-    ssize_t sizeWritten = 0;
-    result = LE_OK;
-    off_t fileOffset = 0;
-
-    while (sizeWritten < sourceStatus.st_size)
-    {
-        ssize_t nextWritten = sendfile(writeFd,
-                                       readFd,
-                                       &fileOffset,
-                                       sourceStatus.st_size - sizeWritten);
-
-        if (nextWritten == -1)
-        {
-            LE_CRIT("Error when copying file '%s' to '%s'. (%m)", sourcePathPtr, destPathPtr);
-            result = LE_IO_ERROR;
-            break;
-        }
-
-        sizeWritten += nextWritten;
-    }
+    // Copy the data.
+    result = CopyData(readFd, writeFd, sourceStatus.st_size, sourcePathPtr, destPathPtr);
 
     fd_Close(readFd);
     fd_Close(writeFd);
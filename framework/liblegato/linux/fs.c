@@ -12,6 +12,8 @@
 #include "file.h"
 #include "dir.h"
 
+#include <sys/mman.h>
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -28,6 +30,13 @@
 //--------------------------------------------------------------------------------------------------
 #define FS_MAX_FILE_REF          32
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of mappingRef managed by the service
+ */
+//--------------------------------------------------------------------------------------------------
+#define FS_MAX_MAPPING_REF       8
+
 //--------------------------------------------------------------------------------------------------
 /**
  * File structure
@@ -40,6 +49,19 @@ typedef struct
 }
 File_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read-only file mapping structure
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_fs_MappingRef_t mappingRef;  ///< The mapping reference to exchange with clients
+    void* addr;                     ///< Address of the mapping (NULL for an empty file)
+    size_t size;                    ///< Size of the mapping
+}
+Mapping_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Default prefixes path used by the daemon. If NULL, the daemon will reject all open/rename/delete
@@ -62,6 +84,20 @@ static le_mem_PoolRef_t FsFileRefPool;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t FsFileRefMap;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool to store the mapping structures
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t FsMappingPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Safe reference map for the mapping structure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_ref_MapRef_t FsMappingRefMap;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function adds the prefix to the filePath to access
@@ -153,6 +189,30 @@ static void FsFileRefDestructor
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor function that runs when a mapping is deallocated
+ */
+//--------------------------------------------------------------------------------------------------
+static void FsMappingDestructor
+(
+    void* objPtr
+)
+{
+    Mapping_t* mappingPtr = (Mapping_t*) objPtr;
+
+    if (NULL != mappingPtr)
+    {
+        if ((NULL != mappingPtr->addr) && (-1 == munmap(mappingPtr->addr, mappingPtr->size)))
+        {
+            LE_ERROR("Failed to unmap %zu bytes at %p: %m", mappingPtr->size, mappingPtr->addr);
+        }
+
+        // Release the reference
+        le_ref_DeleteRef(FsMappingRefMap, mappingPtr->mappingRef);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 // APIs
 //--------------------------------------------------------------------------------------------------
@@ -772,6 +832,168 @@ le_result_t le_fs_Move
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is called to map a file into memory for reading.
+ *
+ * An empty file gives a NULL data pointer and a size of 0.  The mapping must be released with
+ * le_fs_Unmap().
+ *
+ * @return
+ *  - LE_OK             The function succeeded.
+ *  - LE_BAD_PARAMETER  A parameter is invalid, or the path is not a regular file.
+ *  - LE_OVERFLOW       The file is too big to be mapped.
+ *  - LE_NOT_FOUND      The file does not exist or a directory in the path does not exist
+ *  - LE_NOT_PERMITTED  Access denied to the file or to a directory in the path
+ *  - LE_UNSUPPORTED    The prefix cannot be added and the function is unusable
+ *  - LE_FAULT          The function failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_fs_MapReadOnly
+(
+    const char* filePathPtr,            ///< [IN]  File path
+    le_fs_AccessPattern_t pattern,      ///< [IN]  Expected access pattern
+    le_fs_MappingRef_t* mappingRefPtr,  ///< [OUT] Mapping reference (if successful)
+    const uint8_t** dataPtrPtr,         ///< [OUT] Contents of the file (if successful)
+    size_t* sizePtr                     ///< [OUT] Size of the file (if successful)
+)
+{
+    int advice;
+    int fd;
+    struct stat st;
+    void* addr = NULL;
+    char path[PATH_MAX];
+
+    // Check whether input is null. filePathPtr can be null as it is a pointer (i.e. pointer to
+    // const char).
+    if (filePathPtr == NULL)
+    {
+        LE_ERROR("File path can't be null");
+        return LE_BAD_PARAMETER;
+    }
+
+    // Check if the pointers are set
+    if ((NULL == mappingRefPtr) || (NULL == dataPtrPtr) || (NULL == sizePtr))
+    {
+        LE_ERROR("NULL output pointer!");
+        return LE_BAD_PARAMETER;
+    }
+    *mappingRefPtr = NULL;
+
+    // Check if the file path starts with '/'
+    if ('/' != *filePathPtr)
+    {
+        LE_ERROR("File path should start with '/'");
+        return LE_BAD_PARAMETER;
+    }
+
+    switch (pattern)
+    {
+        case LE_FS_ACCESS_NORMAL:       advice = MADV_NORMAL;       break;
+        case LE_FS_ACCESS_SEQUENTIAL:   advice = MADV_SEQUENTIAL;   break;
+        case LE_FS_ACCESS_RANDOM:       advice = MADV_RANDOM;       break;
+        case LE_FS_ACCESS_WHOLE:        advice = MADV_WILLNEED;     break;
+        default:
+            LE_ERROR("Wrong access pattern %d", pattern);
+            return LE_BAD_PARAMETER;
+    }
+
+    if (NULL == BuildPathName(path, PATH_MAX, filePathPtr))
+    {
+        return LE_UNSUPPORTED;
+    }
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (-1 == fd)
+    {
+        if (ENOENT == errno)
+        {
+            return LE_NOT_FOUND;
+        }
+        else if (EACCES == errno)
+        {
+            return LE_NOT_PERMITTED;
+        }
+        return LE_FAULT;
+    }
+
+    if (-1 == fstat(fd, &st))
+    {
+        LE_ERROR("Failed to stat '%s': %m", path);
+        close(fd);
+        return LE_FAULT;
+    }
+
+    if (!S_ISREG(st.st_mode))
+    {
+        LE_ERROR("'%s' is not a regular file", path);
+        close(fd);
+        return LE_BAD_PARAMETER;
+    }
+
+    if ((uintmax_t)st.st_size > SIZE_MAX)
+    {
+        close(fd);
+        return LE_OVERFLOW;
+    }
+
+    if (st.st_size > 0)
+    {
+        addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+
+    // The mapping keeps its own reference to the file.
+    close(fd);
+
+    if (MAP_FAILED == addr)
+    {
+        LE_ERROR("Failed to map '%s': %m", path);
+        return (ENOMEM == errno) ? LE_OVERFLOW : LE_FAULT;
+    }
+
+    if ((NULL != addr) && (MADV_NORMAL != advice) && (-1 == madvise(addr, st.st_size, advice)))
+    {
+        // Only a hint.
+        LE_WARN("madvise(%d) failed for '%s': %m", advice, path);
+    }
+
+    Mapping_t* mappingPtr = le_mem_ForceAlloc(FsMappingPool);
+    mappingPtr->addr = addr;
+    mappingPtr->size = st.st_size;
+    mappingPtr->mappingRef = le_ref_CreateRef(FsMappingRefMap, mappingPtr);
+
+    *mappingRefPtr = mappingPtr->mappingRef;
+    *dataPtrPtr = addr;
+    *sizePtr = mappingPtr->size;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is called to release a file mapping.  The data pointer returned with the mapping
+ * must not be used anymore.
+ *
+ * @return
+ *  - LE_OK             The function succeeded.
+ *  - LE_BAD_PARAMETER  The mapping reference is invalid.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_fs_Unmap
+(
+    le_fs_MappingRef_t mappingRef   ///< [IN] Mapping reference
+)
+{
+    Mapping_t* mappingPtr = le_ref_Lookup(FsMappingRefMap, mappingRef);
+
+    if (NULL == mappingPtr)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    le_mem_Release(mappingPtr);
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Obtain the absolute directory containing the running executable and the name of the executable.
@@ -922,4 +1144,8 @@ end:
 
     // Create the Safe Reference Map to use for data profile object Safe References.
     FsFileRefMap = le_ref_CreateMap("FsFileRefMap", FS_MAX_FILE_REF);
+
+    FsMappingPool = le_mem_CreatePool("FsMappingPool", sizeof(Mapping_t));
+    le_mem_SetDestructor(FsMappingPool, FsMappingDestructor);
+    FsMappingRefMap = le_ref_CreateMap("FsMappingRefMap", FS_MAX_MAPPING_REF);
 }
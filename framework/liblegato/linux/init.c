@@ -7,23 +7,30 @@
 
 #include "legato.h"
 
+#include "aio.h"
 #include "args.h"
 #include "atomFile.h"
 #include "eventLoop.h"
+#include "fa/mem.h"
+#include "fa/traceMarker.h"
+#include "fiber.h"
 #include "fs.h"
 #include "json.h"
 #include "killProc.h"
 #include "log.h"
 #include "mem.h"
 #include "messaging.h"
+#include "metrics.h"
 #include "pathIter.h"
 #include "pipeline.h"
 #include "properties.h"
 #include "rand.h"
 #include "safeRef.h"
 #include "signals.h"
+#include "statsSnapshot.h"
 #include "test.h"
 #include "thread.h"
+#include "threadPool.h"
 #include "timer.h"
 
 
@@ -36,11 +43,15 @@
  *
  * It initializes all the individual module in the framework in the correct order.
  *
+ * It is given the highest constructor priority so that, when liblegato is linked statically into
+ * an executable along with its components, it still runs before any constructors in the
+ * components (such as C++ static initializers) that may use the framework.
+ *
  * @note
  *      On failure, the process exits.
  */
 //--------------------------------------------------------------------------------------------------
-__attribute__((constructor)) void _legato_InitFramework
+__attribute__((constructor(101))) void _legato_InitFramework
 (
     void
 )
@@ -54,6 +65,9 @@ __attribute__((constructor)) void _legato_InitFramework
 
     rand_Init();        // Does not use any other resource.  Initialize first so that randomness is
                         // available for other modules' initialization.
+#if LE_CONFIG_TRACE_MARKERS
+    fa_traceMarker_Init();  // Does not use any other resource.
+#endif
     mem_Init();         // Many things rely on memory pools, so initialize them as soon as possible.
     log_Init();         // Uses memory pools.
     sig_Init();         // Uses memory pools.
@@ -64,6 +78,8 @@ __attribute__((constructor)) void _legato_InitFramework
     event_Init();       // Uses memory pools.
     timer_Init();       // Uses event loop.
     thread_Init();      // Uses event loop, memory pools and safe references.
+    threadPool_Init();  // Uses memory pools.
+    metrics_Init();     // Uses memory pools.
     arg_Init();         // Uses memory pools.
     msg_Init();         // Uses event loop.
     kill_Init();        // Uses memory pools and timers.
@@ -72,11 +88,18 @@ __attribute__((constructor)) void _legato_InitFramework
     pipeline_Init();    // Uses memory pools and FD Monitors.
     atomFile_Init();    // Uses memory pools.
     fs_Init();          // Uses memory pools and safe references.
+    aio_Init();         // Uses memory pools and semaphores.
+    fiber_Init();       // Uses memory pools.
     test_Init();        // Initialize test infrastructure last.
 
     // This must be called last, because it calls several subsystems to perform the
     // thread-specific initialization for the main thread.
     thread_InitThread();
+
+#if LE_CONFIG_MEM_TRIM
+    fa_mem_MonitorPressure();   // Uses the main thread's event loop.
+#endif
+    statsSnapshot_Start();      // Uses memory pools and the main thread's event loop.
 }
 
 
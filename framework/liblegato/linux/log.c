@@ -12,6 +12,7 @@
 #include "limit.h"
 #include "log.h"
 #include "logDaemon/logDaemon.h"
+#include "logDeferred.h"
 #include "logPlatform.h"
 #include "messagingSession.h"
 
@@ -23,6 +24,37 @@
 #define MAX_MSG_SIZE            256
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Nanoseconds per second.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NS_PER_S                1000000000ULL
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rate limiting and sampling settings and state of a log session.
+ *
+ * The rate limit is a token bucket: it holds up to "burst" tokens, gains "rate" tokens a second,
+ * and each message logged takes one.  Sampling keeps one message in every "sample" and discards
+ * the rest.  Messages discarded by either are counted, and the count is reported in the log.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t rate;                      ///< Messages allowed per second (0 = no limit).
+    uint32_t burst;                     ///< Most messages allowed in a burst.
+    uint32_t sample;                    ///< Keep one message in this many (0 or 1 = keep all).
+    uint32_t sampleCount;               ///< Messages seen since the last one kept by sampling.
+    uint32_t tokens;                    ///< Messages that can be logged now.
+    uint32_t suppressedCount;           ///< Messages discarded since the last summary.
+    uint64_t refillNs;                  ///< When tokens were last added (monotonic time, ns).
+    uint64_t summaryNs;                 ///< When the last summary was logged (monotonic time, ns).
+}
+RateLimit_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Log session.  Stores log configuration for each registered component.  The component names and
@@ -35,7 +67,8 @@ typedef struct le_log_Session
     const char* componentNamePtr;       ///< A pointer to the component's name.
     le_log_Level_t level;               ///< The component's severity level filter.
                                         ///  Log messages with severity less than this are ignored.
-    le_sls_List_t keywordList;          ///< The list of keywords for this component.
+    le_log_TraceKeyword_t* keywordListPtr;  ///< The list of keywords for this component.
+    RateLimit_t rateLimit;              ///< The component's rate limiting and sampling.
     le_sls_Link_t link;                 ///< The link used for linking with the SessionList.
 }
 LogSession_t;
@@ -66,7 +99,7 @@ static le_mem_PoolRef_t SessionMemPool;
 static LogSession_t DefaultLogSession =    {
                                             .componentNamePtr="<invalid>",
                                             .level=LOG_DEFAULT_LOG_FILTER,
-                                            .keywordList=LE_SLS_LIST_INIT,
+                                            .keywordListPtr=NULL,
                                             .link=LE_SLS_LINK_INIT
                                         };
 
@@ -74,13 +107,16 @@ static LogSession_t DefaultLogSession =    {
 //--------------------------------------------------------------------------------------------------
 /**
  * A keyword object that contains the keyword string and can be attached to the keyword list.
+ *
+ * These are created at runtime for keywords that the component didn't define statically (using
+ * LE_LOG_TRACE_KEYWORD_INIT()).  Both kinds are linked into the component's keyword list through
+ * the le_log_TraceKeyword_t, so the rest of this module doesn't tell them apart.
  */
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
-    le_sls_Link_t link;                        // The link in the keyword list.
-    char keyword[LIMIT_MAX_LOG_KEYWORD_BYTES]; // The keyword.
-    bool isEnabled;                            // true if the keyword is enabled.  false otherwise.
+    le_log_TraceKeyword_t trace;                // The keyword's settings and list link.
+    char keyword[LIMIT_MAX_LOG_KEYWORD_BYTES];  // The keyword.
 }
 KeywordObj_t;
 
@@ -109,6 +145,16 @@ static le_msg_SessionRef_t IpcSessionRef;
 //--------------------------------------------------------------------------------------------------
 static le_log_TraceRef_t TraceRef;
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timer that logs the summaries of suppressed messages that are due, so that they don't wait for
+ * the component's next message.  Created by the thread that handles log commands (the main
+ * thread), and only runs while a rate limit or sampling is set, or a summary is pending.
+ **/
+//--------------------------------------------------------------------------------------------------
+static le_timer_Ref_t SummaryTimer;
+
 /// Macro used to generate trace output in this module.
 /// Takes the same parameters as LE_DEBUG() et. al.
 #define TRACE(...) LE_TRACE(TraceRef, ##__VA_ARGS__)
@@ -171,7 +217,7 @@ static inline void Unlock
  * @return
  **/
 //--------------------------------------------------------------------------------------------------
-static KeywordObj_t* CreateKeyword
+static le_log_TraceKeyword_t* CreateKeyword
 (
     LogSession_t* logSessionPtr,
     const char* keyword
@@ -192,13 +238,14 @@ static KeywordObj_t* CreateKeyword
                keywordObjPtr->keyword);
 
     // Init the keyword object.
-    keywordObjPtr->isEnabled = false;
-    keywordObjPtr->link = LE_SLS_LINK_INIT;
+    keywordObjPtr->trace.isEnabled = false;
+    keywordObjPtr->trace.keywordPtr = keywordObjPtr->keyword;
 
     // Add the object to the list of keywords.
-    le_sls_Queue(&(logSessionPtr->keywordList), &(keywordObjPtr->link));
+    keywordObjPtr->trace.nextPtr = logSessionPtr->keywordListPtr;
+    logSessionPtr->keywordListPtr = &keywordObjPtr->trace;
 
-    return keywordObjPtr;
+    return &keywordObjPtr->trace;
 }
 
 
@@ -211,25 +258,20 @@ static KeywordObj_t* CreateKeyword
  * @warning Assumes that mutex is already locked by the caller.
  */
 //--------------------------------------------------------------------------------------------------
-static KeywordObj_t* GetKeywordObj
+static le_log_TraceKeyword_t* GetKeywordObj
 (
-    const char* keywordPtr,         // The keyword to search for.
-    le_sls_List_t* keywordList      // The keyword list to search in.
+    const char* keywordPtr,                 // The keyword to search for.
+    le_log_TraceKeyword_t* keywordListPtr   // The keyword list to search in.
 )
 {
     // Search the keyword list for the keyword.
-    le_sls_Link_t* keywordLinkPtr = le_sls_Peek(keywordList);
-
-    while (keywordLinkPtr)
+    while (keywordListPtr)
     {
-        // Get the keyword object.
-        KeywordObj_t* keywordObjPtr = CONTAINER_OF(keywordLinkPtr, KeywordObj_t, link);
-
-        if (strcmp(keywordObjPtr->keyword, keywordPtr) == 0)
+        if (strcmp(keywordListPtr->keywordPtr, keywordPtr) == 0)
         {
-            return keywordObjPtr;
+            return keywordListPtr;
         }
-        keywordLinkPtr = le_sls_PeekNext(keywordList, keywordLinkPtr);
+        keywordListPtr = keywordListPtr->nextPtr;
     }
 
     return NULL;
@@ -290,7 +332,8 @@ static void EnableTrace
     if (sessionPtr)
     {
         // Search for the keyword.
-        KeywordObj_t* keywordObjPtr = GetKeywordObj(keywordPtr, &(sessionPtr->keywordList));
+        le_log_TraceKeyword_t* keywordObjPtr = GetKeywordObj(keywordPtr,
+                                                             sessionPtr->keywordListPtr);
 
         if (keywordObjPtr == NULL)
         {
@@ -298,8 +341,14 @@ static void EnableTrace
             keywordObjPtr = CreateKeyword(sessionPtr, keywordPtr);
         }
 
-        // Enable the keyword.
-        keywordObjPtr->isEnabled = true;
+        // Enable the keyword.  A keyword obtained at runtime before the component registered its
+        // static definition of the same keyword can be in the list twice, so enable them all.
+        do
+        {
+            keywordObjPtr->isEnabled = true;
+            keywordObjPtr = GetKeywordObj(keywordPtr, keywordObjPtr->nextPtr);
+        }
+        while (keywordObjPtr != NULL);
     }
 
     Unlock();
@@ -325,12 +374,14 @@ static void DisableTrace
     if (sessionPtr)
     {
         // Search the keyword list for the keyword.
-        KeywordObj_t* keywordObjPtr = GetKeywordObj(keywordPtr, &(sessionPtr->keywordList));
+        le_log_TraceKeyword_t* keywordObjPtr = GetKeywordObj(keywordPtr,
+                                                             sessionPtr->keywordListPtr);
 
-        if (keywordObjPtr)
+        while (keywordObjPtr)
         {
             // Disable the keyword.
             keywordObjPtr->isEnabled = false;
+            keywordObjPtr = GetKeywordObj(keywordPtr, keywordObjPtr->nextPtr);
         }
     }
 
@@ -364,6 +415,303 @@ static void SetLogLevelFilter
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the current monotonic time.
+ *
+ * @return The time, in nanoseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetMonotonicNs
+(
+    void
+)
+{
+    struct timespec now;
+
+    // The coarse clock is read without a system call, and is precise enough for rate limiting.
+    LE_FATAL_IF(clock_gettime(CLOCK_MONOTONIC_COARSE, &now) != 0,
+                "Failed to read the monotonic clock (%m).");
+
+    return ((uint64_t)now.tv_sec * NS_PER_S) + (uint64_t)now.tv_nsec;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Takes the number of messages a log session has suppressed, if a summary of them is due.
+ *
+ * @warning Assumes that the mutex is held by the caller.
+ *
+ * @return The number of messages to report, or 0 if no summary is due.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t TakeDueSummary
+(
+    RateLimit_t* limitPtr,          // The log session's rate limit.
+    uint64_t nowNs                  // The current monotonic time (ns).
+)
+{
+    uint32_t reportCount = 0;
+
+    if (   (limitPtr->suppressedCount > 0)
+        && ((nowNs - limitPtr->summaryNs)
+            >= ((uint64_t)LE_CONFIG_LOG_RATE_LIMIT_SUMMARY_SEC * NS_PER_S)))
+    {
+        reportCount = limitPtr->suppressedCount;
+        limitPtr->suppressedCount = 0;
+        limitPtr->summaryNs = nowNs;
+    }
+
+    return reportCount;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Logs a summary of the messages a log session has suppressed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LogSummary
+(
+    LogSession_t* sessionPtr,       // The log session.
+    uint32_t reportCount            // The number of messages suppressed.
+)
+{
+    char msg[MAX_MSG_SIZE];
+
+    snprintf(msg, sizeof(msg), "%" PRIu32 " messages suppressed by rate limiting or sampling.",
+             reportCount);
+
+    logDefer_Flush();
+    log_Output(LE_LOG_WARN, NULL, sessionPtr, le_thread_GetMyName(), __FILE__, __func__,
+               __LINE__, time(NULL), msg);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Logs the summaries that are due, and stops the summary timer once no session is limited and no
+ * summary is pending.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SummaryTimerExpiryHandler
+(
+    le_timer_Ref_t timerRef         // The summary timer.
+)
+{
+    bool isNeeded;
+    LogSession_t* reportSessionPtr;
+    uint32_t reportCount;
+
+    // Log one summary at a time, without holding the mutex.
+    do
+    {
+        uint64_t nowNs = GetMonotonicNs();
+
+        isNeeded = false;
+        reportSessionPtr = NULL;
+        reportCount = 0;
+
+        Lock();
+
+        le_sls_Link_t* linkPtr = le_sls_Peek(&SessionList);
+
+        while (linkPtr != NULL)
+        {
+            LogSession_t* sessionPtr = CONTAINER_OF(linkPtr, LogSession_t, link);
+            RateLimit_t* limitPtr = &sessionPtr->rateLimit;
+
+            if (reportSessionPtr == NULL)
+            {
+                reportCount = TakeDueSummary(limitPtr, nowNs);
+                reportSessionPtr = (reportCount > 0 ? sessionPtr : NULL);
+            }
+
+            isNeeded = isNeeded || (limitPtr->rate != 0) || (limitPtr->sample > 1)
+                                || (limitPtr->suppressedCount > 0);
+
+            linkPtr = le_sls_PeekNext(&SessionList, linkPtr);
+        }
+
+        Unlock();
+
+        if (reportSessionPtr != NULL)
+        {
+            LogSummary(reportSessionPtr, reportCount);
+        }
+    }
+    while (reportSessionPtr != NULL);
+
+    if (!isNeeded)
+    {
+        le_timer_Stop(timerRef);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the rate limit and sampling for a specific component.
+ *
+ * Must be called by the thread that handles log commands, which runs the summary timer.
+ */
+//--------------------------------------------------------------------------------------------------
+void log_SetRateLimit
+(
+    const char* componentNamePtr,   ///< [IN] The name of the component.
+    uint32_t rate,                  ///< [IN] Messages allowed per second (0 = no limit).
+    uint32_t burst,                 ///< [IN] Most messages allowed in a burst (0 = one second's
+                                    ///       worth).
+    uint32_t sample                 ///< [IN] Keep one message in this many (1 = keep all).
+)
+{
+    // The timer stops itself once it is no longer needed.
+    if ((rate != 0) || (sample > 1))
+    {
+        if (SummaryTimer == NULL)
+        {
+            SummaryTimer = le_timer_Create("LogSummary");
+            le_timer_SetMsInterval(SummaryTimer, LE_CONFIG_LOG_RATE_LIMIT_SUMMARY_SEC * 1000);
+            le_timer_SetRepeat(SummaryTimer, 0);
+            le_timer_SetHandler(SummaryTimer, SummaryTimerExpiryHandler);
+        }
+        if (!le_timer_IsRunning(SummaryTimer))
+        {
+            le_timer_Start(SummaryTimer);
+        }
+    }
+
+    Lock();
+
+    // Find the session to apply the limit to.
+    LogSession_t* sessionPtr = GetSession(componentNamePtr);
+
+    if (sessionPtr)
+    {
+        RateLimit_t* limitPtr = &sessionPtr->rateLimit;
+
+        limitPtr->burst = (burst != 0 ? burst : rate);
+        limitPtr->sample = sample;
+        limitPtr->sampleCount = 0;
+        limitPtr->tokens = limitPtr->burst;
+        limitPtr->refillNs = GetMonotonicNs();
+
+        // Set this last, because it is checked without holding the mutex.
+        limitPtr->rate = rate;
+    }
+
+    Unlock();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Applies a log session's rate limit and sampling to a message, and logs a summary of the
+ * messages discarded so far if one is due.
+ *
+ * @return true if the message must be discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSuppressed
+(
+    LogSession_t* sessionPtr,       // The log session.
+    le_log_Level_t level            // The message's severity level, or -1 for a trace.
+)
+{
+    RateLimit_t* limitPtr = &sessionPtr->rateLimit;
+    uint32_t reportCount = 0;
+    bool isSuppressed = false;
+
+    // Most sessions aren't limited, so check that first, without taking the mutex.  A setting
+    // that is changing while this is read only affects the messages logged while it changes.
+    // If the limit has just been removed, carry on until the last summary has been logged.
+    if ((limitPtr->rate == 0) && (limitPtr->sample <= 1) && (limitPtr->suppressedCount == 0))
+    {
+        return false;
+    }
+
+    // Critical and emergency messages are never discarded.
+    if ((level >= LE_LOG_CRIT) && (level != (le_log_Level_t)-1))
+    {
+        return false;
+    }
+
+    uint64_t nowNs = GetMonotonicNs();
+
+    Lock();
+
+    if (limitPtr->sample > 1)
+    {
+        limitPtr->sampleCount++;
+
+        if (limitPtr->sampleCount < limitPtr->sample)
+        {
+            isSuppressed = true;
+        }
+        else
+        {
+            limitPtr->sampleCount = 0;
+        }
+    }
+
+    if ((!isSuppressed) && (limitPtr->rate != 0))
+    {
+        uint64_t elapsedNs = nowNs - limitPtr->refillNs;
+
+        // Past the time it takes to fill an empty bucket, the bucket is full.  Checking this first
+        // also keeps the multiplication below from overflowing.
+        if (elapsedNs >= (((uint64_t)limitPtr->burst * NS_PER_S) / limitPtr->rate))
+        {
+            limitPtr->tokens = limitPtr->burst;
+            limitPtr->refillNs = nowNs;
+        }
+        else
+        {
+            uint64_t newTokens = (elapsedNs * limitPtr->rate) / NS_PER_S;
+
+            if (newTokens > 0)
+            {
+                uint64_t tokens = limitPtr->tokens + newTokens;
+
+                limitPtr->tokens = (tokens > limitPtr->burst ? limitPtr->burst : tokens);
+
+                // Only move the refill time up by the time taken to earn these tokens, so that
+                // the time towards the next token isn't lost.
+                limitPtr->refillNs += (newTokens * NS_PER_S) / limitPtr->rate;
+            }
+        }
+
+        if (limitPtr->tokens > 0)
+        {
+            limitPtr->tokens--;
+        }
+        else
+        {
+            isSuppressed = true;
+        }
+    }
+
+    if (isSuppressed)
+    {
+        limitPtr->suppressedCount++;
+    }
+    else
+    {
+        reportCount = TakeDueSummary(limitPtr, nowNs);
+    }
+
+    Unlock();
+
+    if (reportCount > 0)
+    {
+        LogSummary(sessionPtr, reportCount);
+    }
+
+    return isSuppressed;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Create a log session.
@@ -382,7 +730,8 @@ static LogSession_t* CreateSession
     // Initialize the log session.
     logSessionPtr->componentNamePtr = componentNamePtr;
     logSessionPtr->level = DefaultLogSession.level;
-    logSessionPtr->keywordList = LE_SLS_LIST_INIT;
+    logSessionPtr->keywordListPtr = NULL;
+    memset(&logSessionPtr->rateLimit, 0, sizeof(logSessionPtr->rateLimit));
     logSessionPtr->link = LE_SLS_LINK_INIT;
 
     Lock();
@@ -643,6 +992,23 @@ static void ProcessLogCmd
                 DisableTrace(componentName, commandDataPtr);
                 break;
 
+            case LOG_CMD_SET_RATE_LIMIT:
+            {
+                unsigned int rate, burst, sample;
+
+                if (   (sscanf(commandDataPtr, LOG_RATE_LIMIT_PARAMS_FORMAT, &rate, &burst, &sample)
+                        == 3)
+                    && (sample > 0))
+                {
+                    log_SetRateLimit(componentName, rate, burst, sample);
+                }
+                else
+                {
+                    LE_ERROR("Invalid rate limit '%s'.", commandDataPtr);
+                }
+                break;
+            }
+
             default:
                 LE_ERROR("Invalid command character '%c'.", command);
                 break;
@@ -751,6 +1117,9 @@ void fa_log_Init
     // Get a reference to the trace keyword that is used to control tracing in this module.
     TraceRef = le_log_GetTraceRef("logControl");
 
+    // Set up the per-thread rings used for deferred logging (if it is enabled).
+    logDefer_Init();
+
     // Set the syslog format.
     openlog("Legato", 0, LOG_USER);
 }
@@ -933,44 +1302,22 @@ static int ConvertToSyslogLevel
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Builds the log message and sends it to the logging system.
+ * Sends a formatted log message to the logging system.
  */
 //--------------------------------------------------------------------------------------------------
-void fa_log_Send
+void log_Output
 (
-    const le_log_Level_t     level,             // The severity level. Set to -1 if this is a Trace
-                                                // log.
-    const le_log_TraceRef_t  traceRef,          // The Trace reference. Set to NULL if this is not a
-                                                // Trace log.
-    le_log_SessionRef_t      logSession,        // The log session.
-    const char              *filenamePtr,       // The name of the source file that logged the
-                                                // message.
-    const char              *functionNamePtr,   // The name of the function that logged the message.
-    const unsigned int       lineNumber,        // The line number in the source file that logged
-                                                // the message.
-    const char              *formatPtr,         // The user message format.
-    va_list                  args               // Positional parameters.
+    le_log_Level_t          level,          ///< [IN] Severity level, or -1 for a trace message.
+    le_log_TraceRef_t       traceRef,       ///< [IN] Trace reference, or NULL if not a trace.
+    le_log_SessionRef_t     logSession,     ///< [IN] Log session (not NULL).
+    const char*             threadNamePtr,  ///< [IN] Name of the thread that logged the message.
+    const char*             filenamePtr,    ///< [IN] Source file name.
+    const char*             functionNamePtr,///< [IN] Function name (may be NULL).
+    unsigned int            lineNumber,     ///< [IN] Source line number.
+    time_t                  timestamp,      ///< [IN] When the message was logged.
+    const char*             msgPtr          ///< [IN] The formatted user message.
 )
 {
-    // Save the current errno to be used in the log message because some of the system calls below
-    // may change errno.
-    int savedErrno = errno;
-
-    // If the logging function was called from code that doesn't have a log session reference,
-    if (logSession == NULL)
-    {
-        // Use the default log session.
-        logSession = &DefaultLogSession;
-
-        // Check that the message's log level is actually higher than the default filtering
-        // level, since the logging macros probably weren't provided with a valid pointer
-        // to a filtering level.
-        if ((level < logSession->level) && (level != (le_log_Level_t)-1))
-        {
-            return;
-        }
-    }
-
     // Get either the log level or the trace keyword.
     const char* levelPtr;
 
@@ -983,10 +1330,11 @@ void fa_log_Send
     {
         // NOTE: The reference is actually a pointer to the isEnabled flag inside the
         //       keyword object.
-        KeywordObj_t* keywordObjPtr = CONTAINER_OF(traceRef, KeywordObj_t, isEnabled);
+        le_log_TraceKeyword_t* keywordObjPtr = CONTAINER_OF(traceRef, le_log_TraceKeyword_t,
+                                                            isEnabled);
 
         // Add the trace keyword.
-        levelPtr = keywordObjPtr->keyword;
+        levelPtr = keywordObjPtr->keywordPtr;
     }
 
     // Get the component name.
@@ -996,9 +1344,6 @@ void fa_log_Send
     // Get the file name.
     char* baseFileNamePtr = le_path_GetBasenamePtr((char*)filenamePtr, "/");
 
-    // Get the thread name.
-    const char* threadNamePtr = le_thread_GetMyName();
-
     // Get the process name.
     const char* procNamePtr = le_arg_GetProgramName();
     if (procNamePtr == NULL)
@@ -1006,40 +1351,31 @@ void fa_log_Send
         procNamePtr = "n/a";
     }
 
-    // Get the user message.
-    char msg[MAX_MSG_SIZE] = "";
-
-    // Reset the errno to ensure that we report the proper errno value.
-    errno = savedErrno;
-
-    // Don't need to check the return value because if there is an error we can't do anything about
-    // it.  If there was a truncation then that'll just show up in the logs.
-    vsnprintf(msg, sizeof(msg), formatPtr, args);
-
     // If running on an embedded target, write the message out to the log.
 #ifdef LEGATO_EMBEDDED
 
+    LE_UNUSED(timestamp);
+
     if (functionNamePtr == NULL)
     {
         syslog(ConvertToSyslogLevel(level), "%s | %s[%d]/%s T=%s | %s %d | %s\n",
            levelPtr, procNamePtr, getpid(), compNamePtr, threadNamePtr, baseFileNamePtr,
-           lineNumber, msg);
+           lineNumber, msgPtr);
     }
     else
     {
         syslog(ConvertToSyslogLevel(level), "%s | %s[%d]/%s T=%s | %s %s() %d | %s\n",
            levelPtr, procNamePtr, getpid(), compNamePtr, threadNamePtr, baseFileNamePtr,
-           functionNamePtr, lineNumber, msg);
+           functionNamePtr, lineNumber, msgPtr);
     }
 
     // If running on a PC, write the message to standard error with a timestamp added.
 #else
 
-    time_t now;
     char timeStamp[26] = "";
     char* timeStampPtr = timeStamp;
 
-    if ( (time(&now) != ((time_t)-1)) && (ctime_r(&now, timeStamp) != NULL) )
+    if ( (timestamp != ((time_t)-1)) && (ctime_r(&timestamp, timeStamp) != NULL) )
     {
         // Tue Jan 14 18:01:56 2014
         // 0123456789012345678901234
@@ -1051,19 +1387,93 @@ void fa_log_Send
     {
         fprintf(stderr, "%s : %s | %s[%d]/%s T=%s | %s %d | %s\n",
                 timeStampPtr, levelPtr, procNamePtr, getpid(), compNamePtr,
-                threadNamePtr, baseFileNamePtr, lineNumber, msg);
+                threadNamePtr, baseFileNamePtr, lineNumber, msgPtr);
     }
     else
     {
         fprintf(stderr, "%s : %s | %s[%d]/%s T=%s | %s %s() %d | %s\n",
             timeStampPtr, levelPtr, procNamePtr, getpid(), compNamePtr, threadNamePtr,
-            baseFileNamePtr, functionNamePtr, lineNumber, msg);
+            baseFileNamePtr, functionNamePtr, lineNumber, msgPtr);
     }
 
 #endif
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Builds the log message and sends it to the logging system.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_log_Send
+(
+    const le_log_Level_t     level,             // The severity level. Set to -1 if this is a Trace
+                                                // log.
+    const le_log_TraceRef_t  traceRef,          // The Trace reference. Set to NULL if this is not a
+                                                // Trace log.
+    le_log_SessionRef_t      logSession,        // The log session.
+    const char              *filenamePtr,       // The name of the source file that logged the
+                                                // message.
+    const char              *functionNamePtr,   // The name of the function that logged the message.
+    const unsigned int       lineNumber,        // The line number in the source file that logged
+                                                // the message.
+    const char              *formatPtr,         // The user message format.
+    va_list                  args               // Positional parameters.
+)
+{
+    // Save the current errno to be used in the log message because some of the system calls below
+    // may change errno.
+    int savedErrno = errno;
+
+    // If the logging function was called from code that doesn't have a log session reference,
+    if (logSession == NULL)
+    {
+        // Use the default log session.
+        logSession = &DefaultLogSession;
+
+        // Check that the message's log level is actually higher than the default filtering
+        // level, since the logging macros probably weren't provided with a valid pointer
+        // to a filtering level.
+        if ((level < logSession->level) && (level != (le_log_Level_t)-1))
+        {
+            return;
+        }
+    }
+
+    // Discard the message as early as possible if it is over the component's rate limit or isn't
+    // one of its samples.
+    if (IsSuppressed(logSession, level))
+    {
+        errno = savedErrno;
+        return;
+    }
+
+    // Leave formatting and output to the flusher thread, if possible.
+    if (logDefer_Send(level, traceRef, logSession, filenamePtr, functionNamePtr, lineNumber,
+                      formatPtr, args, savedErrno))
+    {
+        errno = savedErrno;
+        return;
+    }
+
+    // This message is going out now, so anything deferred earlier has to go out first.
+    logDefer_Flush();
+
+    // Get the user message.
+    char msg[MAX_MSG_SIZE] = "";
+
+    // Reset the errno to ensure that we report the proper errno value.
+    errno = savedErrno;
+
+    // Don't need to check the return value because if there is an error we can't do anything about
+    // it.  If there was a truncation then that'll just show up in the logs.
+    vsnprintf(msg, sizeof(msg), formatPtr, args);
+
+    log_Output(level, traceRef, logSession, le_thread_GetMyName(), filenamePtr, functionNamePtr,
+               lineNumber, time(NULL), msg);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets a reference to a trace keyword's settings.
@@ -1082,7 +1492,7 @@ le_log_TraceRef_t fa_log_GetTraceRef
 
     Lock();
 
-    KeywordObj_t* keywordObjPtr = GetKeywordObj(keywordPtr, &(logSession->keywordList));
+    le_log_TraceKeyword_t* keywordObjPtr = GetKeywordObj(keywordPtr, logSession->keywordListPtr);
 
     if (keywordObjPtr == NULL)
     {
@@ -1097,6 +1507,58 @@ le_log_TraceRef_t fa_log_GetTraceRef
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers a component's statically defined trace keywords, so that they can be enabled and
+ * disabled like those obtained through fa_log_GetTraceRef().  Unlike those, no memory is allocated.
+ **/
+//--------------------------------------------------------------------------------------------------
+void fa_log_RegTraceKeywords
+(
+    const le_log_SessionRef_t   logSession,     ///< [IN] The log session.
+    le_log_TraceKeyword_t*      keywordsPtr,    ///< [IN] Array of keyword definitions.
+    size_t                      count           ///< [IN] Number of keywords in the array.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    size_t i;
+
+    LE_ASSERT(logSession != NULL);
+
+    Lock();
+
+    for (i = 0; i < count; i++)
+    {
+        le_log_TraceKeyword_t* keywordObjPtr = &keywordsPtr[i];
+        le_log_TraceKeyword_t* existingPtr = logSession->keywordListPtr;
+
+        LE_ASSERT(keywordObjPtr->keywordPtr != NULL);
+        LE_WARN_IF(strlen(keywordObjPtr->keywordPtr) >= LIMIT_MAX_LOG_KEYWORD_BYTES,
+                   "Keyword '%s' is too long to be controlled by the log control tool",
+                   keywordObjPtr->keywordPtr);
+
+        // Skip it if it has already been registered.
+        while ((existingPtr != NULL) && (existingPtr != keywordObjPtr))
+        {
+            existingPtr = existingPtr->nextPtr;
+        }
+        if (existingPtr != NULL)
+        {
+            continue;
+        }
+
+        // The keyword may have been enabled (e.g., from the environment) before it was registered.
+        existingPtr = GetKeywordObj(keywordObjPtr->keywordPtr, logSession->keywordListPtr);
+        keywordObjPtr->isEnabled = (existingPtr != NULL) && existingPtr->isEnabled;
+
+        keywordObjPtr->nextPtr = logSession->keywordListPtr;
+        logSession->keywordListPtr = keywordObjPtr;
+    }
+
+    Unlock();
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the log filter level for a given log session in the calling process.
@@ -0,0 +1,1296 @@
+/** @file logDeferred.c
+ *
+ * Deferred logging.  See logDeferred.h for an overview.
+ *
+ * Each thread that logs gets a Ring object, holding a byte ring buffer.  The thread is the ring's
+ * only producer and the flusher (or whoever calls logDefer_Flush(), under RingListMutex) is its
+ * only consumer, so records are added and removed without locks: the producer owns the head
+ * index, the consumer owns the tail index, and each publishes its index with release semantics.
+ *
+ * A record is a RecordHeader_t followed by the argument values (one Arg_t per conversion in the
+ * format string, plus one for each '*' width or precision), followed by copies of any string
+ * arguments.  Records are padded to multiples of 8 bytes.  A record never wraps around the end of
+ * the buffer; if it doesn't fit in the space left before the end, a padding record fills that
+ * space and the record starts at the beginning of the buffer.
+ *
+ * The format string, file name and function name are kept as pointers, so these must stay valid
+ * until the message is flushed.  This is true for the string literals the logging macros are
+ * called with, except when the code they live in is unloaded.  Formats that use conversions the
+ * record format can't carry (e.g., "%n", "%ls", "%Lf" or positional arguments) are formatted by
+ * the calling thread and stored as text.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+#include "limit.h"
+#include "log.h"
+#include "logDeferred.h"
+#include "logPlatform.h"
+#include "thread.h"
+
+#include <semaphore.h>
+
+#if LE_CONFIG_LOG_DEFERRED
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of log messages (including the terminator).  Must match log.c.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_MSG_SIZE            256
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of each thread's ring buffer, in bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RING_BYTES              LE_CONFIG_LOG_DEFERRED_RING_BYTES
+
+static_assert((RING_BYTES & (RING_BYTES - 1)) == 0, "Log ring size must be a power of two");
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The largest record that will be put in a ring.  Bigger records are stored as text instead.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_RECORD_BYTES        (RING_BYTES / 4)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of argument values in a record.  Messages with more are stored as text.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_ARGS                16
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a conversion specification (e.g., "%-08.3lx") in a format string.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_SPEC_BYTES          32
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Argument value slot marking a NULL string argument.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NULL_STRING_OFFSET      UINT32_MAX
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kinds of records.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    RECORD_PAD,     ///< Filler up to the end of the buffer.
+    RECORD_ARGS,    ///< Format pointer and argument values.
+    RECORD_TEXT     ///< Message already formatted by the thread that logged it.
+}
+RecordKind_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Types of argument values, as read from a va_list.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    ARG_NONE,       ///< Conversion takes no argument ("%%" or "%m").
+    ARG_INT,        ///< int (also used for char, short and '*' widths and precisions).
+    ARG_LONG,       ///< long
+    ARG_LLONG,      ///< long long
+    ARG_INTMAX,     ///< intmax_t
+    ARG_SIZE,       ///< size_t
+    ARG_PTRDIFF,    ///< ptrdiff_t
+    ARG_DOUBLE,     ///< double (also used for float)
+    ARG_STRING,     ///< const char*, copied into the record
+    ARG_POINTER,    ///< void*
+    ARG_UNSUPPORTED ///< Can't be deferred.
+}
+ArgType_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A conversion specification parsed from a format string.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    size_t      len;            ///< Length of the specification, from the '%' to the conversion.
+    bool        widthStar;      ///< true if the width is given by an argument.
+    bool        precisionStar;  ///< true if the precision is given by an argument.
+    int         precision;      ///< Precision if given in the format, otherwise -1.
+    ArgType_t   type;           ///< Type of the converted argument.
+}
+Spec_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * An argument value in a record.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef union
+{
+    long long   i;              ///< ARG_INT, ARG_LONG, ARG_LLONG, ARG_SIZE and ARG_PTRDIFF.
+    intmax_t    j;              ///< ARG_INTMAX.
+    double      d;              ///< ARG_DOUBLE.
+    void*       p;              ///< ARG_POINTER.
+    uint32_t    offset;         ///< ARG_STRING: offset of the copy from the start of the record.
+}
+Arg_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of every record.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t            size;           ///< Total size of the record, in bytes.
+    uint8_t             kind;           ///< RecordKind_t.
+    uint8_t             argCount;       ///< Number of Arg_t following the header.
+    int                 savedErrno;     ///< errno when the message was logged, for "%m".
+    le_log_Level_t      level;          ///< Severity level, or -1 for a trace message.
+    unsigned int        lineNumber;     ///< Source line number.
+    le_log_TraceRef_t   traceRef;       ///< Trace reference, or NULL.
+    le_log_SessionRef_t logSession;     ///< Log session.
+    const char*         filenamePtr;    ///< Source file name.
+    const char*         functionNamePtr;///< Function name, or NULL.
+    const char*         formatPtr;      ///< Message format (RECORD_ARGS only).
+    time_t              timestamp;      ///< When the message was logged.
+}
+RecordHeader_t;
+
+static_assert((sizeof(RecordHeader_t) % 8) == 0, "Log record header must be 8-byte aligned");
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A thread's ring of deferred log records.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t   link;               ///< Link in the RingList.
+    size_t          head;               ///< Total bytes ever added (owned by the producer).
+    size_t          tail;               ///< Total bytes ever removed (owned by the consumer).
+    uint32_t        droppedCount;       ///< Records dropped because the ring was full.
+    bool            isOrphaned;         ///< true once the owning thread has exited.
+    char            threadName[LIMIT_MAX_THREAD_NAME_BYTES]; ///< Name of the owning thread.
+    uint8_t         buffer[RING_BYTES] __attribute__((aligned(8))); ///< The records.
+}
+Ring_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * List of all the Ring objects in the process.  Protected by RingListMutex.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t RingList = LE_DLS_LIST_INIT;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the RingList and serializing the consumers of the rings.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_mutex_t RingListMutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which Ring objects are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t RingPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key used to find out when a thread that has a ring exits.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_key_t RingKey;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Semaphore used to wake up the flusher thread before its flush interval is up.
+ */
+//--------------------------------------------------------------------------------------------------
+static sem_t FlushSem;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * true once the flusher thread has been started (in this process).  Protected by RingListMutex.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool FlusherStarted = false;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * true once logDefer_Init() has been called.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsInitialized = false;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The calling thread's ring, or NULL if it hasn't logged a deferred message yet.
+ */
+//--------------------------------------------------------------------------------------------------
+static __thread Ring_t* ThreadRingPtr;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * true while the calling thread is inside this module, or if it is the flusher thread.  Anything
+ * that the calling thread logs meanwhile is logged immediately, rather than recursing.
+ */
+//--------------------------------------------------------------------------------------------------
+static __thread bool IsBusy;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Round a size up to a multiple of 8 bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline size_t Align8
+(
+    size_t size
+)
+{
+    return (size + 7) & ~((size_t)7);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse the conversion specification at the start of a string.
+ *
+ * @return The specification's argument type, which is ARG_UNSUPPORTED if the specification can't
+ *         be deferred.
+ */
+//--------------------------------------------------------------------------------------------------
+static ArgType_t ParseSpec
+(
+    const char* specStartPtr,   ///< [IN] The '%' starting the specification.
+    Spec_t*     specPtr         ///< [OUT] The parsed specification.
+)
+{
+    const char* p = specStartPtr + 1;
+    int length = 0;     // 'H' = hh, 'h', 'l', 'q' = ll, 'L', 'j', 'z', 't', or 0 for none.
+
+    specPtr->widthStar = false;
+    specPtr->precisionStar = false;
+    specPtr->precision = -1;
+    specPtr->type = ARG_UNSUPPORTED;
+
+    // Flags.
+    while ((*p != '\0') && (strchr("-+ #0'I", *p) != NULL))
+    {
+        p++;
+    }
+
+    // Width.
+    if (*p == '*')
+    {
+        specPtr->widthStar = true;
+        p++;
+    }
+    else
+    {
+        while (isdigit((unsigned char)*p))
+        {
+            p++;
+        }
+    }
+
+    // Positional arguments ("%1$d") are not supported.
+    if (*p == '$')
+    {
+        return ARG_UNSUPPORTED;
+    }
+
+    // Precision.
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            specPtr->precisionStar = true;
+            p++;
+        }
+        else
+        {
+            specPtr->precision = 0;
+            while (isdigit((unsigned char)*p))
+            {
+                specPtr->precision = (specPtr->precision * 10) + (*p - '0');
+                p++;
+            }
+        }
+    }
+
+    // Length modifier.
+    switch (*p)
+    {
+        case 'h':
+            length = (p[1] == 'h') ? 'H' : 'h';
+            p += (p[1] == 'h') ? 2 : 1;
+            break;
+        case 'l':
+            length = (p[1] == 'l') ? 'q' : 'l';
+            p += (p[1] == 'l') ? 2 : 1;
+            break;
+        case 'q':
+            length = 'q';
+            p++;
+            break;
+        case 'L':
+        case 'j':
+        case 't':
+            length = *p;
+            p++;
+            break;
+        case 'z':
+        case 'Z':
+            length = 'z';
+            p++;
+            break;
+        default:
+            break;
+    }
+
+    specPtr->len = (p - specStartPtr) + 1;
+    if ((*p == '\0') || (specPtr->len >= MAX_SPEC_BYTES))
+    {
+        return ARG_UNSUPPORTED;
+    }
+
+    // Conversion.
+    switch (*p)
+    {
+        case 'd':
+        case 'i':
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            switch (length)
+            {
+                case 0:
+                case 'H':
+                case 'h':
+                    specPtr->type = ARG_INT;
+                    break;
+                case 'l':
+                    specPtr->type = ARG_LONG;
+                    break;
+                case 'q':
+                    specPtr->type = ARG_LLONG;
+                    break;
+                case 'j':
+                    specPtr->type = ARG_INTMAX;
+                    break;
+                case 'z':
+                    specPtr->type = ARG_SIZE;
+                    break;
+                case 't':
+                    specPtr->type = ARG_PTRDIFF;
+                    break;
+                default:
+                    break;
+            }
+            break;
+
+        case 'c':
+            if (length == 0)
+            {
+                specPtr->type = ARG_INT;
+            }
+            break;
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if ((length == 0) || (length == 'l'))
+            {
+                specPtr->type = ARG_DOUBLE;
+            }
+            break;
+
+        case 's':
+            if (length == 0)
+            {
+                specPtr->type = ARG_STRING;
+            }
+            break;
+
+        case 'p':
+            if (length == 0)
+            {
+                specPtr->type = ARG_POINTER;
+            }
+            break;
+
+        case 'm':
+            specPtr->type = ARG_NONE;
+            break;
+
+        case '%':
+            if (specPtr->len == 2)
+            {
+                specPtr->type = ARG_NONE;
+            }
+            break;
+
+        default:
+            // Including "%n", which would write through a pointer that is long gone by the time
+            // the message is formatted.
+            break;
+    }
+
+    return specPtr->type;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Builds an ARGS record from a format and its arguments.
+ *
+ * @return The size of the record, or 0 if the message can't be stored this way.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t BuildArgsRecord
+(
+    uint8_t*        recordPtr,  ///< [OUT] Buffer for the record, of MAX_RECORD_BYTES.
+    const char*     formatPtr,  ///< [IN] Message format.
+    va_list         args        ///< [IN] Message format arguments.
+)
+{
+    RecordHeader_t* headerPtr = (RecordHeader_t*)recordPtr;
+    Arg_t argValues[MAX_ARGS];
+    size_t argCount = 0;
+    size_t stringBytes = 0;
+    const char* stringPtrs[MAX_ARGS];
+    size_t stringLens[MAX_ARGS];
+    const char* p;
+    Spec_t spec;
+
+    // First pass: read the arguments and work out how big the record is.
+    for (p = strchr(formatPtr, '%'); p != NULL; p = strchr(p + spec.len, '%'))
+    {
+        ArgType_t type = ParseSpec(p, &spec);
+
+        if (type == ARG_UNSUPPORTED)
+        {
+            return 0;
+        }
+        if (argCount + spec.widthStar + spec.precisionStar + (type != ARG_NONE) > MAX_ARGS)
+        {
+            return 0;
+        }
+
+        int starPrecision = -1;
+        if (spec.widthStar)
+        {
+            argValues[argCount++].i = va_arg(args, int);
+        }
+        if (spec.precisionStar)
+        {
+            starPrecision = va_arg(args, int);
+            argValues[argCount++].i = starPrecision;
+        }
+
+        switch (type)
+        {
+            case ARG_NONE:
+                break;
+            case ARG_INT:
+                argValues[argCount++].i = va_arg(args, int);
+                break;
+            case ARG_LONG:
+                argValues[argCount++].i = va_arg(args, long);
+                break;
+            case ARG_LLONG:
+                argValues[argCount++].i = va_arg(args, long long);
+                break;
+            case ARG_INTMAX:
+                argValues[argCount++].j = va_arg(args, intmax_t);
+                break;
+            case ARG_SIZE:
+                argValues[argCount++].i = (long long)va_arg(args, size_t);
+                break;
+            case ARG_PTRDIFF:
+                argValues[argCount++].i = va_arg(args, ptrdiff_t);
+                break;
+            case ARG_DOUBLE:
+                argValues[argCount++].d = va_arg(args, double);
+                break;
+            case ARG_POINTER:
+                argValues[argCount++].p = va_arg(args, void*);
+                break;
+            case ARG_STRING:
+            {
+                const char* strPtr = va_arg(args, const char*);
+                int precision = spec.precisionStar ? starPrecision : spec.precision;
+
+                // Nothing past the end of the longest possible message can ever be seen.
+                size_t maxLen = MAX_MSG_SIZE - 1;
+                if ((precision >= 0) && ((size_t)precision < maxLen))
+                {
+                    maxLen = precision;
+                }
+
+                stringPtrs[argCount] = strPtr;
+                stringLens[argCount] = (strPtr == NULL) ? 0 : strnlen(strPtr, maxLen);
+                if (strPtr != NULL)
+                {
+                    stringBytes += stringLens[argCount] + 1;
+                }
+                argCount++;
+                break;
+            }
+            default:
+                return 0;
+        }
+    }
+
+    size_t argsOffset = sizeof(RecordHeader_t);
+    size_t stringsOffset = argsOffset + (argCount * sizeof(Arg_t));
+    size_t size = Align8(stringsOffset + stringBytes);
+
+    if (size > MAX_RECORD_BYTES)
+    {
+        return 0;
+    }
+
+    // Second pass: copy the strings into the record.
+    size_t i;
+    size_t offset = stringsOffset;
+    for (i = 0, p = strchr(formatPtr, '%'); p != NULL; p = strchr(p + spec.len, '%'))
+    {
+        ArgType_t type = ParseSpec(p, &spec);
+
+        i += spec.widthStar + spec.precisionStar;
+        if (type == ARG_STRING)
+        {
+            if (stringPtrs[i] == NULL)
+            {
+                argValues[i].offset = NULL_STRING_OFFSET;
+            }
+            else
+            {
+                memcpy(recordPtr + offset, stringPtrs[i], stringLens[i]);
+                recordPtr[offset + stringLens[i]] = '\0';
+                argValues[i].offset = offset;
+                offset += stringLens[i] + 1;
+            }
+        }
+        if (type != ARG_NONE)
+        {
+            i++;
+        }
+    }
+
+    memcpy(recordPtr + argsOffset, argValues, argCount * sizeof(Arg_t));
+
+    headerPtr->size = size;
+    headerPtr->kind = RECORD_ARGS;
+    headerPtr->argCount = argCount;
+    headerPtr->formatPtr = formatPtr;
+
+    return size;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Builds a TEXT record by formatting the message now.
+ *
+ * @return The size of the record.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t BuildTextRecord
+(
+    uint8_t*        recordPtr,  ///< [OUT] Buffer for the record, of MAX_RECORD_BYTES.
+    const char*     formatPtr,  ///< [IN] Message format.
+    va_list         args,       ///< [IN] Message format arguments.
+    int             savedErrno  ///< [IN] errno to use for "%m".
+)
+{
+    RecordHeader_t* headerPtr = (RecordHeader_t*)recordPtr;
+    char* textPtr = (char*)(recordPtr + sizeof(RecordHeader_t));
+    size_t textSize = MAX_RECORD_BYTES - sizeof(RecordHeader_t);
+
+    if (textSize > MAX_MSG_SIZE)
+    {
+        textSize = MAX_MSG_SIZE;
+    }
+
+    errno = savedErrno;
+    int len = vsnprintf(textPtr, textSize, formatPtr, args);
+    if (len < 0)
+    {
+        len = 0;
+        textPtr[0] = '\0';
+    }
+    else if ((size_t)len >= textSize)
+    {
+        len = textSize - 1;
+    }
+
+    headerPtr->size = Align8(sizeof(RecordHeader_t) + len + 1);
+    headerPtr->kind = RECORD_TEXT;
+    headerPtr->argCount = 0;
+    headerPtr->formatPtr = NULL;
+
+    return headerPtr->size;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Formats the message of an ARGS record.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FormatArgsRecord
+(
+    const uint8_t*  recordPtr,  ///< [IN] The record.
+    char*           msgPtr,     ///< [OUT] Buffer for the message, of MAX_MSG_SIZE.
+    size_t          msgSize     ///< [IN] Size of the message buffer.
+)
+{
+    const RecordHeader_t* headerPtr = (const RecordHeader_t*)recordPtr;
+    const char* p = headerPtr->formatPtr;
+    size_t used = 0;
+    size_t argIndex = 0;
+    Arg_t argValues[MAX_ARGS];
+
+    memcpy(argValues, recordPtr + sizeof(RecordHeader_t), headerPtr->argCount * sizeof(Arg_t));
+
+    msgPtr[0] = '\0';
+
+    while ((*p != '\0') && (used < msgSize - 1))
+    {
+        // Copy literal text up to the next conversion.
+        const char* specStartPtr = strchr(p, '%');
+        size_t literalLen = (specStartPtr == NULL) ? strlen(p) : (size_t)(specStartPtr - p);
+
+        if (literalLen > msgSize - 1 - used)
+        {
+            literalLen = msgSize - 1 - used;
+        }
+        memcpy(msgPtr + used, p, literalLen);
+        used += literalLen;
+        msgPtr[used] = '\0';
+
+        if (specStartPtr == NULL)
+        {
+            break;
+        }
+
+        // The format was checked when the record was built, so the specification is supported.
+        Spec_t spec;
+        ArgType_t type = ParseSpec(specStartPtr, &spec);
+        char specStr[MAX_SPEC_BYTES];
+        int starValues[2];
+        int starCount = 0;
+
+        memcpy(specStr, specStartPtr, spec.len);
+        specStr[spec.len] = '\0';
+        p = specStartPtr + spec.len;
+
+        if (spec.widthStar)
+        {
+            starValues[starCount++] = (int)argValues[argIndex++].i;
+        }
+        if (spec.precisionStar)
+        {
+            starValues[starCount++] = (int)argValues[argIndex++].i;
+        }
+
+        char* outPtr = msgPtr + used;
+        size_t outSize = msgSize - used;
+        int len = 0;
+
+// Format one value, passing any '*' width and precision values first.
+#define FORMAT_VALUE(value)                                                                 \
+        do {                                                                                \
+            if (starCount == 2)                                                             \
+            {                                                                               \
+                len = snprintf(outPtr, outSize, specStr, starValues[0], starValues[1], value); \
+            }                                                                               \
+            else if (starCount == 1)                                                        \
+            {                                                                               \
+                len = snprintf(outPtr, outSize, specStr, starValues[0], value);             \
+            }                                                                               \
+            else                                                                            \
+            {                                                                               \
+                len = snprintf(outPtr, outSize, specStr, value);                            \
+            }                                                                               \
+        } while (0)
+
+        switch (type)
+        {
+            case ARG_NONE:
+                // "%%" or "%m".
+                errno = headerPtr->savedErrno;
+                len = snprintf(outPtr, outSize, specStr, 0);
+                break;
+            case ARG_INT:
+                FORMAT_VALUE((int)argValues[argIndex].i);
+                argIndex++;
+                break;
+            case ARG_LONG:
+                FORMAT_VALUE((long)argValues[argIndex].i);
+                argIndex++;
+                break;
+            case ARG_LLONG:
+                FORMAT_VALUE(argValues[argIndex].i);
+                argIndex++;
+                break;
+            case ARG_INTMAX:
+                FORMAT_VALUE(argValues[argIndex].j);
+                argIndex++;
+                break;
+            case ARG_SIZE:
+                FORMAT_VALUE((size_t)argValues[argIndex].i);
+                argIndex++;
+                break;
+            case ARG_PTRDIFF:
+                FORMAT_VALUE((ptrdiff_t)argValues[argIndex].i);
+                argIndex++;
+                break;
+            case ARG_DOUBLE:
+                FORMAT_VALUE(argValues[argIndex].d);
+                argIndex++;
+                break;
+            case ARG_POINTER:
+                FORMAT_VALUE(argValues[argIndex].p);
+                argIndex++;
+                break;
+            case ARG_STRING:
+            {
+                uint32_t offset = argValues[argIndex].offset;
+                const char* strPtr = (offset == NULL_STRING_OFFSET) ?
+                                         NULL : (const char*)(recordPtr + offset);
+                FORMAT_VALUE(strPtr);
+                argIndex++;
+                break;
+            }
+            default:
+                LE_FATAL("Corrupt deferred log record.");
+        }
+
+#undef FORMAT_VALUE
+
+        if (len > 0)
+        {
+            used += ((size_t)len < outSize) ? (size_t)len : outSize - 1;
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Formats and sends the records waiting in a ring.
+ *
+ * @warning Assumes that RingListMutex is held by the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DrainRing
+(
+    Ring_t* ringPtr
+)
+{
+    size_t tail = ringPtr->tail;
+    size_t head = __atomic_load_n(&ringPtr->head, __ATOMIC_ACQUIRE);
+
+    while (tail != head)
+    {
+        const uint8_t* recordPtr = ringPtr->buffer + (tail & (RING_BYTES - 1));
+        const RecordHeader_t* headerPtr = (const RecordHeader_t*)recordPtr;
+
+        if (headerPtr->kind == RECORD_ARGS)
+        {
+            char msg[MAX_MSG_SIZE];
+
+            FormatArgsRecord(recordPtr, msg, sizeof(msg));
+            log_Output(headerPtr->level, headerPtr->traceRef, headerPtr->logSession,
+                       ringPtr->threadName, headerPtr->filenamePtr, headerPtr->functionNamePtr,
+                       headerPtr->lineNumber, headerPtr->timestamp, msg);
+        }
+        else if (headerPtr->kind == RECORD_TEXT)
+        {
+            log_Output(headerPtr->level, headerPtr->traceRef, headerPtr->logSession,
+                       ringPtr->threadName, headerPtr->filenamePtr, headerPtr->functionNamePtr,
+                       headerPtr->lineNumber, headerPtr->timestamp,
+                       (const char*)(recordPtr + sizeof(RecordHeader_t)));
+        }
+
+        tail += headerPtr->size;
+
+        // Hand the space back to the producer.
+        __atomic_store_n(&ringPtr->tail, tail, __ATOMIC_RELEASE);
+
+        if (tail == head)
+        {
+            // Pick up anything that was added meanwhile.
+            head = __atomic_load_n(&ringPtr->head, __ATOMIC_ACQUIRE);
+        }
+    }
+
+    uint32_t droppedCount = __atomic_exchange_n(&ringPtr->droppedCount, 0, __ATOMIC_ACQ_REL);
+    if (droppedCount > 0)
+    {
+        char msg[MAX_MSG_SIZE];
+        const char* procNamePtr = le_arg_GetProgramName();
+
+        snprintf(msg, sizeof(msg), "%"PRIu32" log messages from thread '%s' were dropped"
+                 " (log ring full).", droppedCount, ringPtr->threadName);
+        log_LogGenericMsg(LE_LOG_WARN, (procNamePtr == NULL) ? "n/a" : procNamePtr, getpid(),
+                          msg);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drains all the rings, and deletes the rings of threads that have exited.
+ *
+ * @warning Assumes that RingListMutex is held by the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DrainAllRings
+(
+    void
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&RingList);
+
+    while (linkPtr != NULL)
+    {
+        Ring_t* ringPtr = CONTAINER_OF(linkPtr, Ring_t, link);
+
+        linkPtr = le_dls_PeekNext(&RingList, linkPtr);
+
+        // Check this before draining.  Once the owner is gone, nothing more can be added.
+        bool isOrphaned = __atomic_load_n(&ringPtr->isOrphaned, __ATOMIC_ACQUIRE);
+
+        DrainRing(ringPtr);
+
+        if (isOrphaned)
+        {
+            le_dls_Remove(&RingList, &ringPtr->link);
+            le_mem_Release(ringPtr);
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the flusher thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* FlusherThreadMain
+(
+    void* contextPtr    ///< Not used.
+)
+{
+    LE_UNUSED(contextPtr);
+
+    // Anything this thread logs goes straight out.
+    IsBusy = true;
+
+    for (;;)
+    {
+        struct timespec deadline;
+
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += LE_CONFIG_LOG_DEFERRED_FLUSH_MS / 1000;
+        deadline.tv_nsec += (LE_CONFIG_LOG_DEFERRED_FLUSH_MS % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        // Wait until a ring is getting full or the flush interval is up.
+        while ((sem_timedwait(&FlushSem, &deadline) != 0) && (errno == EINTR))
+        {
+        }
+
+        LE_ASSERT(pthread_mutex_lock(&RingListMutex) == 0);
+        DrainAllRings();
+        LE_ASSERT(pthread_mutex_unlock(&RingListMutex) == 0);
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when a thread that has a ring exits.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ThreadExited
+(
+    void* ringPtr   ///< The thread's ring.
+)
+{
+    // The flusher deletes the ring once it has been drained.
+    __atomic_store_n(&((Ring_t*)ringPtr)->isOrphaned, true, __ATOMIC_RELEASE);
+    sem_post(&FlushSem);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the calling thread's ring, creating it (and the flusher thread) if needed.
+ *
+ * @return The ring, or NULL if it couldn't be created.
+ */
+//--------------------------------------------------------------------------------------------------
+static Ring_t* GetRing
+(
+    void
+)
+{
+    if (ThreadRingPtr != NULL)
+    {
+        return ThreadRingPtr;
+    }
+
+    // A single-threaded process can't have a flusher thread, so it logs directly
+    if (thread_IsSingleThreaded())
+    {
+        return NULL;
+    }
+
+    // A thread that forked still has its ring, (see AtForkChild(),) so it only needs a flusher.
+    Ring_t* ringPtr = pthread_getspecific(RingKey);
+    bool isNewRing = (ringPtr == NULL);
+
+    if (isNewRing)
+    {
+        // Creating the ring may log (e.g., if the pool has to grow).  Those messages go out
+        // directly.
+        ringPtr = le_mem_ForceAlloc(RingPool);
+
+        ringPtr->link = LE_DLS_LINK_INIT;
+        ringPtr->head = 0;
+        ringPtr->tail = 0;
+        ringPtr->droppedCount = 0;
+        ringPtr->isOrphaned = false;
+        le_utf8_Copy(ringPtr->threadName, le_thread_GetMyName(), sizeof(ringPtr->threadName),
+                     NULL);
+    }
+
+    LE_ASSERT(pthread_mutex_lock(&RingListMutex) == 0);
+
+    if (isNewRing)
+    {
+        le_dls_Queue(&RingList, &ringPtr->link);
+    }
+
+    if (!FlusherStarted)
+    {
+        pthread_t thread;
+        pthread_attr_t attr;
+
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        if (pthread_create(&thread, &attr, FlusherThreadMain, NULL) == 0)
+        {
+            FlusherStarted = true;
+        }
+        pthread_attr_destroy(&attr);
+    }
+
+    bool flusherStarted = FlusherStarted;
+
+    LE_ASSERT(pthread_mutex_unlock(&RingListMutex) == 0);
+
+    if (!flusherStarted)
+    {
+        // Without a flusher, nothing would ever be logged.  The ring stays on the list, to be
+        // drained by logDefer_Flush() (or by a flusher started for another thread).
+        __atomic_store_n(&ringPtr->isOrphaned, true, __ATOMIC_RELEASE);
+        pthread_setspecific(RingKey, NULL);
+        return NULL;
+    }
+
+    pthread_setspecific(RingKey, ringPtr);
+    ThreadRingPtr = ringPtr;
+
+    return ringPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copies a record into a ring.
+ *
+ * @return true if the record was added, false if the ring is full.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool PushRecord
+(
+    Ring_t*         ringPtr,    ///< [IN] The ring.
+    const uint8_t*  recordPtr,  ///< [IN] The record.
+    size_t          size        ///< [IN] Size of the record.
+)
+{
+    size_t head = ringPtr->head;
+    size_t tail = __atomic_load_n(&ringPtr->tail, __ATOMIC_ACQUIRE);
+    size_t offset = head & (RING_BYTES - 1);
+    size_t contiguous = RING_BYTES - offset;
+    size_t needed = size + ((contiguous < size) ? contiguous : 0);
+    size_t used = head - tail;
+
+    if (RING_BYTES - used < needed)
+    {
+        return false;
+    }
+
+    if (contiguous < size)
+    {
+        // Doesn't fit before the end of the buffer, so pad up to the end and start again at the
+        // beginning.
+        RecordHeader_t* padPtr = (RecordHeader_t*)(ringPtr->buffer + offset);
+        padPtr->size = contiguous;
+        padPtr->kind = RECORD_PAD;
+        offset = 0;
+        head += contiguous;
+    }
+
+    memcpy(ringPtr->buffer + offset, recordPtr, size);
+
+    // Publish the record to the consumer.
+    __atomic_store_n(&ringPtr->head, head + size, __ATOMIC_RELEASE);
+
+    // Wake the flusher early when the ring passes half full, to make it less likely to fill up.
+    if ((used < RING_BYTES / 2) && (used + needed >= RING_BYTES / 2))
+    {
+        sem_post(&FlushSem);
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * fork() handlers.  The RingListMutex is held across the fork so that the child gets the ring
+ * list in a consistent state.  The child then drops whatever the parent had waiting in its rings,
+ * since the parent logs those itself.
+ *
+ * The rings of the other threads, which don't exist in the child, are freed by the child's first
+ * drain.  The forking thread keeps its ring, which GetRing() finds again the next time the thread
+ * logs, starting a flusher in the child.  Nothing is allocated or freed here, as another thread
+ * may have held the memory pool lock when fork() was called.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AtForkPrepare(void)
+{
+    LE_ASSERT(pthread_mutex_lock(&RingListMutex) == 0);
+}
+
+static void AtForkParent(void)
+{
+    LE_ASSERT(pthread_mutex_unlock(&RingListMutex) == 0);
+}
+
+static void AtForkChild(void)
+{
+    le_dls_Link_t* linkPtr;
+
+    // The parent's flusher thread doesn't exist in the child.
+    FlusherStarted = false;
+    sem_init(&FlushSem, 0, 0);
+
+    for (linkPtr = le_dls_Peek(&RingList);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(&RingList, linkPtr))
+    {
+        Ring_t* ringPtr = CONTAINER_OF(linkPtr, Ring_t, link);
+
+        ringPtr->tail = ringPtr->head;
+        ringPtr->droppedCount = 0;
+
+        // Only the thread that forked exists in the child.
+        if (ringPtr != ThreadRingPtr)
+        {
+            ringPtr->isOrphaned = true;
+        }
+    }
+
+    // The forking thread's ring needs a flusher again, so make its next message go through
+    // GetRing().  The thread-specific value still points to the ring.
+    ThreadRingPtr = NULL;
+
+    LE_ASSERT(pthread_mutex_unlock(&RingListMutex) == 0);
+}
+
+#endif /* end LE_CONFIG_LOG_DEFERRED */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes the deferred logging module.
+ */
+//--------------------------------------------------------------------------------------------------
+void logDefer_Init
+(
+    void
+)
+{
+#if LE_CONFIG_LOG_DEFERRED
+    RingPool = le_mem_CreatePool("LogRings", sizeof(Ring_t));
+    LE_ASSERT(pthread_key_create(&RingKey, ThreadExited) == 0);
+    LE_ASSERT(sem_init(&FlushSem, 0, 0) == 0);
+    LE_ASSERT(pthread_atfork(AtForkPrepare, AtForkParent, AtForkChild) == 0);
+
+    // Whatever is still waiting when the process exits normally still gets logged.
+    atexit(logDefer_Flush);
+
+    IsInitialized = true;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tries to defer a log message.
+ */
+//--------------------------------------------------------------------------------------------------
+bool logDefer_Send
+(
+    le_log_Level_t          level,          ///< [IN] Severity level, or -1 for a trace message.
+    le_log_TraceRef_t       traceRef,       ///< [IN] Trace reference, or NULL if not a trace.
+    le_log_SessionRef_t     logSession,     ///< [IN] Log session (not NULL).
+    const char*             filenamePtr,    ///< [IN] Source file name.
+    const char*             functionNamePtr,///< [IN] Function name (may be NULL).
+    unsigned int            lineNumber,     ///< [IN] Source line number.
+    const char*             formatPtr,      ///< [IN] Message format.
+    va_list                 args,           ///< [IN] Message format arguments.
+    int                     savedErrno      ///< [IN] The caller's errno, for "%m".
+)
+{
+#if LE_CONFIG_LOG_DEFERRED
+    // Critical and emergency messages go out right away, as the process may be about to die.
+    if ((!IsInitialized) || IsBusy ||
+        ((level >= LE_LOG_CRIT) && (level != (le_log_Level_t)-1)))
+    {
+        return false;
+    }
+
+    IsBusy = true;
+
+    Ring_t* ringPtr = GetRing();
+    if (ringPtr == NULL)
+    {
+        IsBusy = false;
+        return false;
+    }
+
+    uint8_t record[MAX_RECORD_BYTES] __attribute__((aligned(8)));
+    RecordHeader_t* headerPtr = (RecordHeader_t*)record;
+    va_list argsCopy;
+
+    va_copy(argsCopy, args);
+    size_t size = BuildArgsRecord(record, formatPtr, argsCopy);
+    va_end(argsCopy);
+
+    if (size == 0)
+    {
+        va_copy(argsCopy, args);
+        size = BuildTextRecord(record, formatPtr, argsCopy, savedErrno);
+        va_end(argsCopy);
+    }
+
+    headerPtr->savedErrno = savedErrno;
+    headerPtr->level = level;
+    headerPtr->lineNumber = lineNumber;
+    headerPtr->traceRef = traceRef;
+    headerPtr->logSession = logSession;
+    headerPtr->filenamePtr = filenamePtr;
+    headerPtr->functionNamePtr = functionNamePtr;
+    headerPtr->timestamp = time(NULL);
+
+    if (!PushRecord(ringPtr, record, size))
+    {
+        __atomic_add_fetch(&ringPtr->droppedCount, 1, __ATOMIC_RELAXED);
+        sem_post(&FlushSem);
+    }
+
+    IsBusy = false;
+    return true;
+#else
+    LE_UNUSED(level);
+    LE_UNUSED(traceRef);
+    LE_UNUSED(logSession);
+    LE_UNUSED(filenamePtr);
+    LE_UNUSED(functionNamePtr);
+    LE_UNUSED(lineNumber);
+    LE_UNUSED(formatPtr);
+    LE_UNUSED(args);
+    LE_UNUSED(savedErrno);
+    return false;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Formats and sends all deferred messages that are waiting in any thread's ring to the log.
+ */
+//--------------------------------------------------------------------------------------------------
+void logDefer_Flush
+(
+    void
+)
+{
+#if LE_CONFIG_LOG_DEFERRED
+    if ((!IsInitialized) || IsBusy)
+    {
+        return;
+    }
+
+    IsBusy = true;
+
+    LE_ASSERT(pthread_mutex_lock(&RingListMutex) == 0);
+    DrainAllRings();
+    LE_ASSERT(pthread_mutex_unlock(&RingListMutex) == 0);
+
+    IsBusy = false;
+#endif
+}
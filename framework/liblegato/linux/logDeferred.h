@@ -0,0 +1,64 @@
+/** @file logDeferred.h
+ *
+ * Linux-specific intra-framework interface of the log system's "Deferred Logging" module.
+ *
+ * When deferred logging is enabled, a thread that logs a message doesn't format it or send it to
+ * the log itself.  Instead, it appends a compact binary record (the format string pointer and the
+ * argument values) to a ring buffer of its own, and a background flusher thread formats the
+ * records and sends them to the log in batches.  If a thread's ring is full, its new records are
+ * dropped and counted, and the flusher reports how many were lost.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LINUX_LOGDEFERRED_INCLUDE_GUARD
+#define LINUX_LOGDEFERRED_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes the deferred logging module.  This must be called only once at start-up, before
+ * any other functions in this module are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void logDefer_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tries to defer a log message.
+ *
+ * @return
+ *      - true if the message has been dealt with (deferred, or dropped because the calling
+ *        thread's ring was full).
+ *      - false if the message must be logged immediately by the caller.  This is the case for
+ *        critical and emergency messages (which must be in the log before, e.g., the process
+ *        exits), when deferred logging is disabled, and when called from the flusher itself.
+ *        The caller should call logDefer_Flush() first, to keep the log in order.
+ */
+//--------------------------------------------------------------------------------------------------
+bool logDefer_Send
+(
+    le_log_Level_t          level,          ///< [IN] Severity level, or -1 for a trace message.
+    le_log_TraceRef_t       traceRef,       ///< [IN] Trace reference, or NULL if not a trace.
+    le_log_SessionRef_t     logSession,     ///< [IN] Log session (not NULL).
+    const char*             filenamePtr,    ///< [IN] Source file name.
+    const char*             functionNamePtr,///< [IN] Function name (may be NULL).
+    unsigned int            lineNumber,     ///< [IN] Source line number.
+    const char*             formatPtr,      ///< [IN] Message format.
+    va_list                 args,           ///< [IN] Message format arguments.
+    int                     savedErrno      ///< [IN] The caller's errno, for "%m".
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Formats and sends all deferred messages that are waiting in any thread's ring to the log.
+ */
+//--------------------------------------------------------------------------------------------------
+void logDefer_Flush
+(
+    void
+);
+
+#endif /* end LINUX_LOGDEFERRED_INCLUDE_GUARD */
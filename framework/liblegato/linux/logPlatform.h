@@ -46,6 +46,24 @@ void log_ReInit
     void
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a formatted log message to the logging system.
+ */
+//--------------------------------------------------------------------------------------------------
+void log_Output
+(
+    le_log_Level_t          level,          ///< [IN] Severity level, or -1 for a trace message.
+    le_log_TraceRef_t       traceRef,       ///< [IN] Trace reference, or NULL if not a trace.
+    le_log_SessionRef_t     logSession,     ///< [IN] Log session (not NULL).
+    const char*             threadNamePtr,  ///< [IN] Name of the thread that logged the message.
+    const char*             filenamePtr,    ///< [IN] Source file name.
+    const char*             functionNamePtr,///< [IN] Function name (may be NULL).
+    unsigned int            lineNumber,     ///< [IN] Source line number.
+    time_t                  timestamp,      ///< [IN] When the message was logged.
+    const char*             msgPtr          ///< [IN] The formatted user message.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Logs a generic message with the given information.
@@ -59,4 +77,21 @@ void log_LogGenericMsg
     const char* msgPtr          ///< [IN] Message.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the rate limit and sampling for a specific component.
+ *
+ * Must be called by the thread that handles log commands, which runs the timer that logs the
+ * summaries of suppressed messages.
+ */
+//--------------------------------------------------------------------------------------------------
+void log_SetRateLimit
+(
+    const char* componentNamePtr,   ///< [IN] The name of the component.
+    uint32_t rate,                  ///< [IN] Messages allowed per second (0 = no limit).
+    uint32_t burst,                 ///< [IN] Most messages allowed in a burst (0 = one second's
+                                    ///       worth).
+    uint32_t sample                 ///< [IN] Keep one message in this many (1 = keep all).
+);
+
 #endif /* end LINUX_LOGPLATFORM_INCLUDE_GUARD */
@@ -0,0 +1,255 @@
+//--------------------------------------------------------------------------------------------------
+/** @file mem.c
+ *
+ * Linux support for trimming memory pools.  Pages are given back with madvise(MADV_DONTNEED),
+ * and memory pressure is detected with a pressure stall information (PSI) trigger on
+ * /proc/pressure/memory or, where that can't be opened (kernels without PSI, or processes not
+ * allowed to create triggers), with the memory.events file of the process' cgroup v2 group, whose
+ * "high" and "max" counters go up when the group is throttled or hits its limit.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "fa/mem.h"
+#include "../eventLoop.h"
+#include "fileDescriptor.h"
+#include "limit.h"
+
+#include <sys/mman.h>
+
+#if LE_CONFIG_MEM_TRIM
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * PSI file and trigger: notify when tasks have been stalled waiting for memory for 150 ms or more
+ * within a 2 s window.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PSI_MEMORY_FILE     "/proc/pressure/memory"
+#define PSI_MEMORY_TRIGGER  "some 150000 2000000"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mount point of the cgroup v2 hierarchy, and the line of /proc/self/cgroup that gives the
+ * process' group in it.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CGROUP2_ROOT        "/sys/fs/cgroup"
+#define CGROUP2_SELF_PREFIX "0::"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum time between two trims, in seconds.  Trimming while the pressure lasts would only
+ * burn CPU time, as the pools have nothing more to give back until they are used again.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MIN_TRIM_INTERVAL_SEC   5
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * When the pools were last trimmed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_clk_Time_t LastTrimTime;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the size of the pages that fa_mem_DiscardPages() works on.
+ *
+ * @return The page size, in bytes (a power of two).
+ */
+//--------------------------------------------------------------------------------------------------
+size_t fa_mem_GetPageSize
+(
+    void
+)
+{
+    static size_t pageSize;
+
+    if (pageSize == 0)
+    {
+        long size = sysconf(_SC_PAGESIZE);
+        pageSize = (size > 0 ? (size_t)size : 4096);
+    }
+
+    return pageSize;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Give the memory of a range of pages back to the system.
+ *
+ * @return true if the pages were given back.
+ */
+//--------------------------------------------------------------------------------------------------
+bool fa_mem_DiscardPages
+(
+    void*   startPtr,   ///< [IN] Start of the range (page aligned).
+    size_t  size        ///< [IN] Size of the range (a multiple of the page size).
+)
+{
+    return (madvise(startPtr, size, MADV_DONTNEED) == 0);
+}
+
+
+#if LE_CONFIG_MEM_TRIM_ON_PRESSURE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a PSI trigger for memory stalls.
+ *
+ * @return The trigger's file descriptor, or -1 if it couldn't be created.
+ */
+//--------------------------------------------------------------------------------------------------
+static int OpenPsiTrigger
+(
+    void
+)
+{
+    int fd = open(PSI_MEMORY_FILE, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    // The kernel wants the terminating null character with the trigger.
+    if (write(fd, PSI_MEMORY_TRIGGER, sizeof(PSI_MEMORY_TRIGGER)) < 0)
+    {
+        LE_DEBUG("Can't create memory pressure trigger (%m).");
+        fd_Close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the memory.events file of the process' cgroup v2 group.
+ *
+ * @return The file descriptor, or -1 if the process is not in a cgroup v2 group with a memory
+ *         controller.
+ */
+//--------------------------------------------------------------------------------------------------
+static int OpenCgroupEvents
+(
+    void
+)
+{
+    char line[LIMIT_MAX_PATH_BYTES];
+    char path[LIMIT_MAX_PATH_BYTES] = "";
+
+    FILE* filePtr = fopen("/proc/self/cgroup", "r");
+    if (filePtr == NULL)
+    {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), filePtr) != NULL)
+    {
+        if (strncmp(line, CGROUP2_SELF_PREFIX, sizeof(CGROUP2_SELF_PREFIX) - 1) == 0)
+        {
+            char* groupPtr = line + sizeof(CGROUP2_SELF_PREFIX) - 1;
+
+            groupPtr[strcspn(groupPtr, "\n")] = '\0';
+
+            // The root group has no memory.events file.
+            if (strcmp(groupPtr, "/") != 0)
+            {
+                snprintf(path, sizeof(path), CGROUP2_ROOT "%s/memory.events", groupPtr);
+            }
+            break;
+        }
+    }
+
+    fclose(filePtr);
+
+    if (path[0] == '\0')
+    {
+        return -1;
+    }
+
+    return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when there is memory pressure.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PressureHandler
+(
+    int     fd,         ///< [IN] PSI trigger or memory.events file descriptor.
+    short   events      ///< [IN] Events that occurred.
+)
+{
+    if (events & POLLERR)
+    {
+        // A PSI trigger reports an error if its cgroup goes away.
+        LE_WARN("Memory pressure monitoring stopped.");
+        le_fdMonitor_Delete(le_fdMonitor_GetMonitor());
+        fd_Close(fd);
+        return;
+    }
+
+    // Reading a cgroup events file acknowledges the notification (reading a trigger does
+    // nothing).
+    char buffer[256];
+    if (pread(fd, buffer, sizeof(buffer), 0) < 0)
+    {
+        LE_DEBUG("Can't read memory events (%m).");
+    }
+
+    le_clk_Time_t now = event_GetLoopTime();
+    le_clk_Time_t minInterval = { MIN_TRIM_INTERVAL_SEC, 0 };
+
+    if (((LastTrimTime.sec != 0) || (LastTrimTime.usec != 0)) &&
+        !le_clk_GreaterThan(le_clk_Sub(now, LastTrimTime), minInterval))
+    {
+        return;
+    }
+    LastTrimTime = now;
+
+    size_t numBytes = le_mem_Trim();
+
+    LE_DEBUG("Memory pressure: %" PRIuS " bytes of memory pools given back.", numBytes);
+}
+#endif /* end LE_CONFIG_MEM_TRIM_ON_PRESSURE */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start watching for memory pressure, calling le_mem_Trim() from the calling thread's event loop
+ * when there is some.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_mem_MonitorPressure
+(
+    void
+)
+{
+#if LE_CONFIG_MEM_TRIM_ON_PRESSURE
+    int fd = OpenPsiTrigger();
+
+    if (fd < 0)
+    {
+        fd = OpenCgroupEvents();
+    }
+
+    if (fd < 0)
+    {
+        LE_DEBUG("Memory pressure can't be monitored.");
+        return;
+    }
+
+    le_fdMonitor_Create("MemPressure", fd, PressureHandler, POLLPRI);
+#endif
+}
+
+#endif /* end LE_CONFIG_MEM_TRIM */
@@ -85,6 +85,30 @@
  * side.  For all other types of messages, this is set to 0 (NULL) to indicate that it does
  * not belong to a request-response transaction.
  *
+ * When LE_CONFIG_MSG_SHARED_MEMORY is enabled, the server may hand the client a memfd along
+ * with its session open response, for protocols whose payloads are large.  Both sides map it,
+ * and messages created on that session keep their payloads in its slots.  Such a message is
+ * sent as the transaction identifier followed by a small descriptor naming the slot, instead of
+ * the payload itself.  See messagingSharedMem.c.
+ *
+ * When LE_CONFIG_MSG_SESSION_RESUME is enabled, a server that accepts a session routed to it by
+ * the Service Directory also hands the client one end of a socket pair (its Resume Endpoint).
+ * The client interface keeps it, and later sessions on that interface are opened by sending the
+ * "Open" request, with one end of a fresh socket pair, straight to the server through it.  If that
+ * fails, the client forgets the endpoint and goes back through the Service Directory.
+ *
+ * When LE_CONFIG_MSG_DURABLE_QUEUE is enabled and a service has a durable queue, the server also
+ * hands the client the ring file of the client's user and an eventfd.  The client appends its
+ * one-way messages to the ring and rings the eventfd; the server drains the ring into its receive
+ * handler.  The ring outlives both processes.  See messagingQueue.c.
+ *
+ * When LE_CONFIG_MSG_BROADCAST is enabled and a service has a broadcast channel, the server also
+ * hands each client the channel's sealed memfd, which the client maps read-only, and an eventfd.
+ * le_msg_Broadcast() writes each message into the channel once and signals the eventfds of the
+ * subscribed sessions, whose clients copy the message out of the channel.  Subscribing and
+ * unsubscribing are announced to the client by short control messages sent through the socket.
+ * See messagingBroadcast.c.
+ *
  * See also @ref serviceDirectoryProtocol.
  *
  * @warning The code in this subsystem @b must be thread safe and re-entrant.
@@ -101,6 +125,9 @@
 #include "messagingSession.h"
 #include "messagingInterface.h"
 #include "messagingLocal.h"
+#include "messagingSharedMem.h"
+#include "messagingQueue.h"
+#include "messagingBroadcast.h"
 
 // =======================================
 //  PROTECTED (INTER-MODULE) FUNCTIONS
@@ -121,6 +148,9 @@ void msg_Init
     msgCommon_Init();
     msgLocal_Init();
     msgProto_Init();
+    msgShm_Init();
+    msgQueue_Init();
+    msgBcast_Init();
     msgMessage_Init();
     msgInterface_Init();
     msgSession_Init();
@@ -0,0 +1,731 @@
+/** @file messagingBroadcast.c
+ *
+ * @ref c_messaging implementation's "Broadcast" module implementation.
+ *
+ * See @ref messaging.c for an overview of the @ref c_messaging implementation.
+ *
+ * A broadcast channel is a memfd holding a header followed by a ring of equally sized slots:
+ *
+ * @verbatim
+ *
+ *      +-----------------+--------------------------+--------------------------+----
+ *      | ChannelHeader   | SlotHeader | payload ... | SlotHeader | payload ... | ...
+ *      +-----------------+--------------------------+--------------------------+----
+ *
+ * @endverbatim
+ *
+ * Messages are numbered from 0 in the order they are broadcast, and message n goes in slot
+ * n % slotCount.  The header holds the number of the next message, and each slot holds one more
+ * than the number of the message in it (0 while the server is writing the slot), which lets a
+ * client that is copying a message out of a slot find out if the server overwrote it meanwhile.
+ *
+ * Only the server writes to the channel.  Once it has mapped the memfd, it seals it against
+ * writing, so the clients, which may not trust each other, can only map it read-only.  Each
+ * client keeps its own read position.  One that falls more than a ring's worth of messages behind
+ * either skips the messages it missed or closes its session, as the server chose when creating
+ * the channel.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "messagingBroadcast.h"
+#include "messagingMessage.h"
+#include "fileDescriptor.h"
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+
+#ifndef F_SEAL_FUTURE_WRITE
+#define F_SEAL_FUTURE_WRITE 0x0010  // Only in recent kernel headers.
+#endif
+
+// =======================================
+//  PRIVATE DATA
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value of the magic field in a channel's header.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHANNEL_MAGIC   0x4342534d  // "MSBC"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Slots are multiples of this size, so that two slots never share a cache line.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SLOT_ALIGNMENT  64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of a channel.  Written by the server before the channel is shared; only
+ * nextSeq changes after that.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;         ///< Always CHANNEL_MAGIC.
+    uint32_t slotCount;     ///< Number of slots in the ring.
+    uint32_t slotSize;      ///< Size of each slot, including its header, in bytes.
+    uint32_t payloadSize;   ///< Size of the payload buffer in each slot, in bytes.
+    uint32_t overflow;      ///< What a client that falls behind does (le_msg_BroadcastOverflow_t).
+    uint64_t nextSeq __attribute__((aligned(SLOT_ALIGNMENT)));  ///< Number of the next message.
+}
+__attribute__((aligned(SLOT_ALIGNMENT)))
+ChannelHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of each slot.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t seq;           ///< Number of the message in the slot plus one, or 0 if being written.
+    uint32_t length;        ///< Length of the message's payload, in bytes.
+    uint32_t reserved;      ///< Keeps the payload 8-byte aligned.
+}
+SlotHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Server's view of a channel.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgBcast_Channel
+{
+    int             fd;             ///< The memfd.
+    uint8_t*        basePtr;        ///< Start of the mapping.
+    size_t          mapSize;        ///< Size of the mapping, in bytes.
+    uint32_t        slotCount;      ///< Number of slots in the ring.
+    uint32_t        slotSize;       ///< Size of each slot, including its header, in bytes.
+    uint32_t        payloadSize;    ///< Size of the payload buffer in each slot, in bytes.
+}
+Channel_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Client's view of a channel.  The geometry is copied out of the header when the channel is
+ * attached, so it can't change under the client.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgBcast_Reader
+{
+    const uint8_t*          basePtr;        ///< Start of the (read-only) mapping.
+    size_t                  mapSize;        ///< Size of the mapping, in bytes.
+    uint32_t                slotCount;      ///< Number of slots in the ring.
+    uint32_t                slotSize;       ///< Size of each slot, including its header, in bytes.
+    uint32_t                payloadSize;    ///< Size of the payload buffer in each slot, in bytes.
+    le_msg_BroadcastOverflow_t overflow;    ///< What to do when falling behind.
+    int                     eventFd;        ///< Eventfd the server wakes the client with.
+    le_fdMonitor_Ref_t      fdMonitorRef;   ///< Monitor of eventFd.
+    le_msg_SessionRef_t     sessionRef;     ///< Session to create delivered messages for.
+    msgBcast_DeliverFunc_t  deliverFunc;    ///< Function to deliver messages to.
+    void*                   contextPtr;     ///< Context pointer to pass to deliverFunc.
+    uint64_t                cursor;         ///< Number of the next message to deliver.
+    bool                    isSubscribed;   ///< true = deliver new messages as they come.
+    bool                    isAttached;     ///< false once msgBcast_Detach() has been called.
+}
+Reader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pools from which Channel and Reader objects are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ChannelPoolRef;
+static le_mem_PoolRef_t ReaderPoolRef;
+
+
+// =======================================
+//  PRIVATE FUNCTIONS
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the size of the slots for a given payload size.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline size_t SlotSize
+(
+    size_t payloadSize
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return ((sizeof(SlotHeader_t) + payloadSize + SLOT_ALIGNMENT - 1) / SLOT_ALIGNMENT) *
+           SLOT_ALIGNMENT;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a pointer to the header of the slot holding a given message.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline SlotHeader_t* GetSlot
+(
+    const uint8_t*  basePtr,
+    uint32_t        slotCount,
+    uint32_t        slotSize,
+    uint64_t        seq
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return (SlotHeader_t*)(basePtr + sizeof(ChannelHeader_t) + (seq % slotCount) * slotSize);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor for Channel objects.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ChannelDestructor
+(
+    void* objPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Channel_t* channelPtr = objPtr;
+
+    if (munmap(channelPtr->basePtr, channelPtr->mapSize) != 0)
+    {
+        LE_ERROR("munmap() failed (%m).");
+    }
+    fd_Close(channelPtr->fd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor for Reader objects.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReaderDestructor
+(
+    void* objPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Reader_t* readerPtr = objPtr;
+
+    if (munmap((void*)readerPtr->basePtr, readerPtr->mapSize) != 0)
+    {
+        LE_ERROR("munmap() failed (%m).");
+    }
+}
+
+
+#if LE_CONFIG_MSG_BROADCAST
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move a reader past messages it can no longer read, as the channel's overflow policy says.
+ *
+ * @return true if the reader can go on reading, false if its session is being closed.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool Overrun
+(
+    Reader_t*   readerPtr,
+    uint64_t    newCursor   ///< [IN] Number of the oldest message that can still be read.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (readerPtr->overflow == LE_MSG_BROADCAST_CLOSE)
+    {
+        readerPtr->deliverFunc(readerPtr->contextPtr, NULL);
+        return false;
+    }
+
+    LE_WARN("Fell behind on broadcast channel of '%s'; %" PRIu64 " messages skipped.",
+            le_msg_GetInterfaceName(le_msg_GetSessionInterface(readerPtr->sessionRef)),
+            newCursor - readerPtr->cursor);
+    readerPtr->cursor = newCursor;
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deliver the messages that are waiting for a reader, up to (but not including) a given one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Drain
+(
+    Reader_t*   readerPtr,
+    uint64_t    limit       ///< [IN] Number of the first message not to deliver.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const ChannelHeader_t* headerPtr = (const ChannelHeader_t*)readerPtr->basePtr;
+
+    // A delivery function may detach the reader.
+    le_mem_AddRef(readerPtr);
+
+    while (readerPtr->isAttached)
+    {
+        uint64_t nextSeq = LE_ATOMIC_LOAD(&headerPtr->nextSeq, LE_ATOMIC_ORDER_ACQUIRE);
+        uint64_t seq = readerPtr->cursor;
+
+        if ((seq >= nextSeq) || (seq >= limit))
+        {
+            break;
+        }
+
+        if (nextSeq - seq > readerPtr->slotCount)
+        {
+            if (!Overrun(readerPtr, nextSeq - readerPtr->slotCount))
+            {
+                break;
+            }
+            continue;
+        }
+
+        const SlotHeader_t* slotPtr = GetSlot(readerPtr->basePtr,
+                                              readerPtr->slotCount,
+                                              readerPtr->slotSize,
+                                              seq);
+        uint64_t slotSeq = LE_ATOMIC_LOAD(&slotPtr->seq, LE_ATOMIC_ORDER_ACQUIRE);
+        uint32_t length = slotPtr->length;
+        le_msg_MessageRef_t msgRef = NULL;
+
+        if ((slotSeq == seq + 1) && (length <= readerPtr->payloadSize))
+        {
+            msgRef = msgMessage_CreateReceiveMsg(readerPtr->sessionRef);
+            memcpy(le_msg_GetPayloadPtr(msgRef), slotPtr + 1, length);
+
+            // If the server started writing the slot while it was being copied, the copy may be
+            // garbled.
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (LE_ATOMIC_LOAD(&slotPtr->seq, LE_ATOMIC_ORDER_RELAXED) != slotSeq)
+            {
+                le_msg_ReleaseMsg(msgRef);
+                msgRef = NULL;
+            }
+        }
+
+        if (msgRef == NULL)
+        {
+            // The message has been (or is being) overwritten.
+            if (!Overrun(readerPtr, seq + 1))
+            {
+                break;
+            }
+            continue;
+        }
+
+        readerPtr->cursor = seq + 1;
+        readerPtr->deliverFunc(readerPtr->contextPtr, msgRef);
+    }
+
+    le_mem_Release(readerPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called in the session's thread when the server wakes the client up.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EventFdHandler
+(
+    int     fd,         ///< [IN] Reader's eventfd.
+    short   events      ///< [IN] Events that occurred.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Reader_t* readerPtr = le_fdMonitor_GetContextPtr();
+    uint64_t count;
+
+    LE_UNUSED(events);
+
+    if (read(fd, &count, sizeof(count)) < 0)
+    {
+        LE_DEBUG("Can't read broadcast event (%m).");
+    }
+
+    if (readerPtr->isSubscribed)
+    {
+        Drain(readerPtr, UINT64_MAX);
+    }
+}
+
+#endif /* end LE_CONFIG_MSG_BROADCAST */
+
+
+// =======================================
+//  PROTECTED (INTER-MODULE) FUNCTIONS
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes this module.  This must be called only once at start-up, before any other functions
+ * in this module are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_Init
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    ChannelPoolRef = le_mem_CreatePool("MsgBcastChannel", sizeof(Channel_t));
+    le_mem_SetDestructor(ChannelPoolRef, ChannelDestructor);
+
+    ReaderPoolRef = le_mem_CreatePool("MsgBcastReader", sizeof(Reader_t));
+    le_mem_SetDestructor(ReaderPoolRef, ReaderDestructor);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a broadcast channel.  This is done by the server side.
+ *
+ * @return A reference to the channel, or NULL if it couldn't be created (le_msg_Broadcast() then
+ *         sends a copy of each message through each subscriber's session instead).
+ */
+//--------------------------------------------------------------------------------------------------
+msgBcast_ChannelRef_t msgBcast_CreateChannel
+(
+    size_t                      payloadSize,    ///< [IN] Maximum payload size of the protocol.
+    size_t                      numSlots,       ///< [IN] Number of messages the ring holds.
+    le_msg_BroadcastOverflow_t  overflow        ///< [IN] What a client that falls behind does.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_MSG_BROADCAST
+    // Control messages are sent in place of a payload, and told apart from others by their size.
+    if ((payloadSize <= sizeof(msgBcast_Control_t)) || (numSlots == 0) || (numSlots > UINT32_MAX))
+    {
+        LE_WARN("Can't create broadcast channel with %" PRIuS " slots of %" PRIuS " bytes.",
+                numSlots, payloadSize);
+        return NULL;
+    }
+
+    size_t slotSize = SlotSize(payloadSize);
+    size_t mapSize = sizeof(ChannelHeader_t) + numSlots * slotSize;
+
+    int fd = memfd_create("le_msg_bcast", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0)
+    {
+        LE_WARN("memfd_create() failed (%m).  Broadcasts will be sent to each subscriber.");
+        return NULL;
+    }
+
+    if (ftruncate(fd, mapSize) != 0)
+    {
+        LE_WARN("Can't size broadcast channel (%m).");
+        fd_Close(fd);
+        return NULL;
+    }
+
+    void* basePtr = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (basePtr == MAP_FAILED)
+    {
+        LE_WARN("mmap() failed (%m).  Broadcasts will be sent to each subscriber.");
+        fd_Close(fd);
+        return NULL;
+    }
+
+    // Our mapping stays writable, but nobody can map the channel for writing from now on.
+    if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_FUTURE_WRITE | F_SEAL_SEAL) != 0)
+    {
+        LE_WARN("Can't seal broadcast channel (%m).  Broadcasts will be sent to each subscriber.");
+        munmap(basePtr, mapSize);
+        fd_Close(fd);
+        return NULL;
+    }
+
+    // A new memfd is zero-filled, so all the slots start out empty.
+    ChannelHeader_t* headerPtr = basePtr;
+    headerPtr->magic = CHANNEL_MAGIC;
+    headerPtr->slotCount = numSlots;
+    headerPtr->slotSize = slotSize;
+    headerPtr->payloadSize = payloadSize;
+    headerPtr->overflow = overflow;
+
+    Channel_t* channelPtr = le_mem_ForceAlloc(ChannelPoolRef);
+    channelPtr->fd = fd;
+    channelPtr->basePtr = basePtr;
+    channelPtr->mapSize = mapSize;
+    channelPtr->slotCount = numSlots;
+    channelPtr->slotSize = slotSize;
+    channelPtr->payloadSize = payloadSize;
+
+    return channelPtr;
+#else
+    LE_UNUSED(payloadSize);
+    LE_UNUSED(numSlots);
+    LE_UNUSED(overflow);
+    return NULL;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a broadcast channel's memfd, to be sent to clients.
+ *
+ * @return The file descriptor (still owned by the channel).
+ */
+//--------------------------------------------------------------------------------------------------
+int msgBcast_GetChannelFd
+(
+    msgBcast_ChannelRef_t channelRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return channelRef->fd;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the sequence number that the next message put in a broadcast channel will have.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t msgBcast_GetNextSeq
+(
+    msgBcast_ChannelRef_t channelRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const ChannelHeader_t* headerPtr = (const ChannelHeader_t*)channelRef->basePtr;
+
+    return LE_ATOMIC_LOAD(&headerPtr->nextSeq, LE_ATOMIC_ORDER_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Puts a message in the next slot of a broadcast channel, overwriting the oldest one if the ring
+ * is full.  This is done by the server side.
+ *
+ * @return
+ *      - LE_OK if successful.
+ *      - LE_OVERFLOW if the payload doesn't fit in a slot.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgBcast_Publish
+(
+    msgBcast_ChannelRef_t   channelRef,     ///< [IN] Channel.
+    const void*             payloadPtr,     ///< [IN] Payload.
+    size_t                  payloadSize     ///< [IN] Size of the payload, in bytes.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    ChannelHeader_t* headerPtr = (ChannelHeader_t*)channelRef->basePtr;
+
+    if (payloadSize > channelRef->payloadSize)
+    {
+        return LE_OVERFLOW;
+    }
+
+    uint64_t seq = LE_ATOMIC_LOAD(&headerPtr->nextSeq, LE_ATOMIC_ORDER_RELAXED);
+    SlotHeader_t* slotPtr = GetSlot(channelRef->basePtr,
+                                    channelRef->slotCount,
+                                    channelRef->slotSize,
+                                    seq);
+
+    // Mark the slot as being written before touching its payload, so that a client still
+    // copying the old message out of it finds out.
+    LE_ATOMIC_STORE(&slotPtr->seq, 0, LE_ATOMIC_ORDER_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slotPtr->length = payloadSize;
+    memcpy(slotPtr + 1, payloadPtr, payloadSize);
+
+    LE_ATOMIC_STORE(&slotPtr->seq, seq + 1, LE_ATOMIC_ORDER_RELEASE);
+    LE_ATOMIC_STORE(&headerPtr->nextSeq, seq + 1, LE_ATOMIC_ORDER_RELEASE);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wakes a subscriber up through its eventfd.  This is done by the server side.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_Signal
+(
+    int eventFd     ///< [IN] Subscriber's eventfd.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint64_t one = 1;
+
+    // Only fails if the counter is about to overflow, in which case the client has been woken
+    // up already.
+    if (write(eventFd, &one, sizeof(one)) < 0)
+    {
+        LE_DEBUG("Can't signal broadcast subscriber (%m).");
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps a broadcast channel received from the server, and starts monitoring the eventfd that the
+ * server wakes the client with.  This is done by the client side, in the session's thread.
+ *
+ * @return A reference to the reader, or NULL if the channel could not be mapped or can't be
+ *         trusted.
+ *
+ * @note Always takes ownership of channelFd and eventFd.
+ */
+//--------------------------------------------------------------------------------------------------
+msgBcast_ReaderRef_t msgBcast_Attach
+(
+    int                     channelFd,      ///< [IN] Channel's memfd received from the server.
+    int                     eventFd,        ///< [IN] Eventfd received from the server.
+    le_msg_SessionRef_t     sessionRef,     ///< [IN] Session to create delivered messages for.
+    msgBcast_DeliverFunc_t  deliverFunc,    ///< [IN] Function to deliver messages to.
+    void*                   contextPtr      ///< [IN] Context pointer to pass to deliverFunc.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Reader_t* readerPtr = NULL;
+
+#if LE_CONFIG_MSG_BROADCAST
+    size_t payloadSize = le_msg_GetProtocolMaxMsgSize(le_msg_GetSessionProtocol(sessionRef));
+    int seals = fcntl(channelFd, F_GET_SEALS);
+    struct stat st;
+
+    // If other processes could write to the channel, they could forge messages.
+    if ((seals < 0) ||
+        ((seals & (F_SEAL_SHRINK | F_SEAL_FUTURE_WRITE)) != (F_SEAL_SHRINK | F_SEAL_FUTURE_WRITE)) ||
+        (fstat(channelFd, &st) != 0) ||
+        ((size_t)st.st_size < sizeof(ChannelHeader_t)))
+    {
+        LE_WARN("Bad broadcast channel.  Session will not use it.");
+    }
+    else
+    {
+        size_t mapSize = st.st_size;
+        void* basePtr = mmap(NULL, mapSize, PROT_READ, MAP_SHARED, channelFd, 0);
+
+        if (basePtr == MAP_FAILED)
+        {
+            LE_WARN("mmap() failed (%m).  Session will not use broadcast channel.");
+        }
+        else
+        {
+            const ChannelHeader_t* headerPtr = basePtr;
+            uint32_t slotCount = headerPtr->slotCount;
+            uint32_t slotSize = headerPtr->slotSize;
+
+            if ((headerPtr->magic != CHANNEL_MAGIC) ||
+                (headerPtr->payloadSize != payloadSize) ||
+                (slotSize != SlotSize(payloadSize)) ||
+                (slotCount == 0) ||
+                (mapSize != sizeof(ChannelHeader_t) + (size_t)slotCount * slotSize))
+            {
+                LE_WARN("Broadcast channel doesn't match protocol.  Session will not use it.");
+                munmap(basePtr, mapSize);
+            }
+            else
+            {
+                readerPtr = le_mem_ForceAlloc(ReaderPoolRef);
+                readerPtr->basePtr = basePtr;
+                readerPtr->mapSize = mapSize;
+                readerPtr->slotCount = slotCount;
+                readerPtr->slotSize = slotSize;
+                readerPtr->payloadSize = payloadSize;
+                readerPtr->overflow = (headerPtr->overflow == LE_MSG_BROADCAST_CLOSE ?
+                                       LE_MSG_BROADCAST_CLOSE : LE_MSG_BROADCAST_SKIP);
+                readerPtr->eventFd = eventFd;
+                readerPtr->sessionRef = sessionRef;
+                readerPtr->deliverFunc = deliverFunc;
+                readerPtr->contextPtr = contextPtr;
+                readerPtr->cursor = 0;
+                readerPtr->isSubscribed = false;
+                readerPtr->isAttached = true;
+                readerPtr->fdMonitorRef = le_fdMonitor_Create("MsgBcast",
+                                                              eventFd,
+                                                              EventFdHandler,
+                                                              POLLIN);
+                le_fdMonitor_SetContextPtr(readerPtr->fdMonitorRef, readerPtr);
+                eventFd = -1;
+            }
+        }
+    }
+#else
+    LE_UNUSED(sessionRef);
+    LE_UNUSED(deliverFunc);
+    LE_UNUSED(contextPtr);
+#endif
+
+    fd_Close(channelFd);
+    if (eventFd >= 0)
+    {
+        fd_Close(eventFd);
+    }
+
+    return readerPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles a control message received from the server.  This is done by the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_HandleControl
+(
+    msgBcast_ReaderRef_t        readerRef,  ///< [IN] Reader.
+    const msgBcast_Control_t*   controlPtr  ///< [IN] Control message.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_MSG_BROADCAST
+    switch (controlPtr->op)
+    {
+        case MSGBCAST_OP_SUBSCRIBE:
+            readerRef->cursor = controlPtr->seq;
+            readerRef->isSubscribed = true;
+            Drain(readerRef, UINT64_MAX);
+            break;
+
+        case MSGBCAST_OP_UNSUBSCRIBE:
+            // Deliver what was broadcast before the server unsubscribed us.
+            if (readerRef->isSubscribed)
+            {
+                Drain(readerRef, controlPtr->seq);
+                readerRef->isSubscribed = false;
+            }
+            break;
+
+        default:
+            LE_ERROR("Unknown broadcast control operation %" PRIu32 ".", controlPtr->op);
+    }
+#else
+    LE_UNUSED(readerRef);
+    LE_UNUSED(controlPtr);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops reading a broadcast channel and deletes the reader.  Can be called from a delivery
+ * function.  This is done by the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_Detach
+(
+    msgBcast_ReaderRef_t readerRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    readerRef->isAttached = false;
+    readerRef->isSubscribed = false;
+
+    le_fdMonitor_Delete(readerRef->fdMonitorRef);
+    fd_Close(readerRef->eventFd);
+
+    le_mem_Release(readerRef);
+}
@@ -0,0 +1,190 @@
+/** @file messagingBroadcast.h
+ *
+ * @ref c_messaging implementation's "Broadcast" module's inter-module interface definitions.
+ *
+ * A service can be given a broadcast channel (see le_msg_SetServiceBroadcast()): a ring of
+ * message slots in a memfd that the server writes and that all the service's clients map
+ * read-only.  le_msg_Broadcast() copies a message into the next slot once, and then wakes each
+ * subscribed session through its own eventfd.  Each client keeps its own read position in the
+ * ring, and delivers the messages it reads to its session's receive handler.
+ *
+ * The ring and the session's eventfd are handed to the client with its session open response.
+ * Subscribing and unsubscribing are done by the server, which tells the client with a short
+ * control message (msgBcast_Control_t) sent through the session's socket, in line with the
+ * session's other messages, giving the position in the ring where the subscription starts or
+ * ends.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_MESSAGING_BROADCAST_H_INCLUDE_GUARD
+#define LEGATO_MESSAGING_BROADCAST_H_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a broadcast channel (server side).  Channels are memory pool objects; use
+ * le_mem_Release() to delete them.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgBcast_Channel* msgBcast_ChannelRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a client's view of a broadcast channel.  Readers are memory pool objects; use
+ * msgBcast_Detach() to delete them.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgBcast_Reader* msgBcast_ReaderRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Control message sent by the server, in place of a message payload, to tell a client where its
+ * subscription to the broadcast channel starts or ends.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;     ///< Always MSGBCAST_CONTROL_MAGIC.
+    uint32_t op;        ///< MSGBCAST_OP_SUBSCRIBE or MSGBCAST_OP_UNSUBSCRIBE.
+    uint64_t seq;       ///< Sequence number of the first message that is (or is no longer) for
+                        ///  the client.
+}
+msgBcast_Control_t;
+
+#define MSGBCAST_CONTROL_MAGIC  0x54534342  // "BCST"
+#define MSGBCAST_OP_SUBSCRIBE   1
+#define MSGBCAST_OP_UNSUBSCRIBE 2
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function called to deliver a message read from a broadcast channel.
+ *
+ * @param contextPtr    Context pointer given to msgBcast_Attach().
+ * @param msgRef        The message, or NULL if the client fell too far behind to catch up and the
+ *                      channel's overflow policy is LE_MSG_BROADCAST_CLOSE.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*msgBcast_DeliverFunc_t)
+(
+    void*               contextPtr,
+    le_msg_MessageRef_t msgRef
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes this module.  This must be called only once at start-up, before any other functions
+ * in this module are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a broadcast channel.  This is done by the server side.
+ *
+ * @return A reference to the channel, or NULL if it couldn't be created (le_msg_Broadcast() then
+ *         sends a copy of each message through each subscriber's session instead).
+ */
+//--------------------------------------------------------------------------------------------------
+msgBcast_ChannelRef_t msgBcast_CreateChannel
+(
+    size_t                      payloadSize,    ///< [IN] Maximum payload size of the protocol.
+    size_t                      numSlots,       ///< [IN] Number of messages the ring holds.
+    le_msg_BroadcastOverflow_t  overflow        ///< [IN] What a client that falls behind does.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a broadcast channel's memfd, to be sent to clients.
+ *
+ * @return The file descriptor (still owned by the channel).
+ */
+//--------------------------------------------------------------------------------------------------
+int msgBcast_GetChannelFd
+(
+    msgBcast_ChannelRef_t channelRef
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the sequence number that the next message put in a broadcast channel will have.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t msgBcast_GetNextSeq
+(
+    msgBcast_ChannelRef_t channelRef
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Puts a message in the next slot of a broadcast channel, overwriting the oldest one if the ring
+ * is full.  This is done by the server side.
+ *
+ * @return
+ *      - LE_OK if successful.
+ *      - LE_OVERFLOW if the payload doesn't fit in a slot.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgBcast_Publish
+(
+    msgBcast_ChannelRef_t   channelRef,     ///< [IN] Channel.
+    const void*             payloadPtr,     ///< [IN] Payload.
+    size_t                  payloadSize     ///< [IN] Size of the payload, in bytes.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wakes a subscriber up through its eventfd.  This is done by the server side.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_Signal
+(
+    int eventFd     ///< [IN] Subscriber's eventfd.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps a broadcast channel received from the server, and starts monitoring the eventfd that the
+ * server wakes the client with.  This is done by the client side, in the session's thread.
+ *
+ * @return A reference to the reader, or NULL if the channel could not be mapped or can't be
+ *         trusted.
+ *
+ * @note Always takes ownership of channelFd and eventFd.
+ */
+//--------------------------------------------------------------------------------------------------
+msgBcast_ReaderRef_t msgBcast_Attach
+(
+    int                     channelFd,      ///< [IN] Channel's memfd received from the server.
+    int                     eventFd,        ///< [IN] Eventfd received from the server.
+    le_msg_SessionRef_t     sessionRef,     ///< [IN] Session to create delivered messages for.
+    msgBcast_DeliverFunc_t  deliverFunc,    ///< [IN] Function to deliver messages to.
+    void*                   contextPtr      ///< [IN] Context pointer to pass to deliverFunc.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles a control message received from the server.  This is done by the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_HandleControl
+(
+    msgBcast_ReaderRef_t        readerRef,  ///< [IN] Reader.
+    const msgBcast_Control_t*   controlPtr  ///< [IN] Control message.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops reading a broadcast channel and deletes the reader.  Can be called from a delivery
+ * function.  This is done by the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgBcast_Detach
+(
+    msgBcast_ReaderRef_t readerRef
+);
+
+#endif // LEGATO_MESSAGING_BROADCAST_H_INCLUDE_GUARD
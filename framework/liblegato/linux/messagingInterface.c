@@ -84,6 +84,16 @@ static le_mem_PoolRef_t ServicePoolRef;
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t ClientInterfacePoolRef;
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which copies of the names of the interfaces that don't come from constant data are
+ * allocated (see le_msg_CreateStaticService() and le_msg_CreateStaticSession()).  Uses size
+ * classes.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t InterfaceNamePoolRef;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Pool from which session event handler object are allocated.
@@ -103,6 +113,34 @@ static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
 #define UNLOCK  LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resume Endpoint object.  The server's end of a socket pair through which a client that the
+ * Service Directory has already connected to a service can reopen sessions with it directly.
+ * Objects of this type are allocated from the Resume Endpoint Pool and kept on a Service's
+ * Resume List.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t               link;           ///< Used to link into the Service's Resume List.
+    int                         fd;             ///< Server's end of the socket pair.
+    le_fdMonitor_Ref_t          fdMonitorRef;   ///< File descriptor monitor for the socket.
+    msgInterface_UnixService_t* servicePtr;     ///< The Service that sessions are opened with.
+}
+ResumeEndpoint_t;
+
+
+#if LE_CONFIG_MSG_SESSION_RESUME
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which Resume Endpoint objects are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ResumeEndpointPoolRef;
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * session event handler object
@@ -186,25 +224,70 @@ static void InitInterface
 (
     le_msg_ProtocolRef_t    protocolRef,   ///< [in] Protocol to initialize the interface obj.
     const char*             interfaceName, ///< [in] Interface name to initialize the interface obj.
+    bool                    isStaticName,  ///< [in] true if interfaceName never changes or goes
+                                           ///       away, so it doesn't need to be copied.
     msgInterface_Type_t interfaceType,     ///< [in] Interface type to init the interface obj.
     msgInterface_Interface_t* interfacePtr ///< [out] Ptr to the interface object to be initialized.
 )
 {
     interfacePtr->interfaceType = interfaceType;
     interfacePtr->id.protocolRef = protocolRef;
-    le_result_t result = le_utf8_Copy(interfacePtr->id.name,
-                                      interfaceName,
-                                      sizeof(interfacePtr->id.name),
-                                      NULL);
-    LE_FATAL_IF(result != LE_OK,
-                "Service ID '%s' too long (should only be %zu bytes total).",
-                interfaceName,
-                sizeof(interfacePtr->id.name));
+
+    if (isStaticName)
+    {
+        interfacePtr->id.name = interfaceName;
+        interfacePtr->ownsName = false;
+    }
+    else
+    {
+        // The caller has already checked the length of the name.
+        size_t nameSize = le_utf8_NumBytes(interfaceName) + 1;
+        char* namePtr = le_mem_ForceVarAlloc(InterfaceNamePoolRef, nameSize);
+        le_utf8_Copy(namePtr, interfaceName, nameSize, NULL);
+        interfacePtr->id.name = namePtr;
+        interfacePtr->ownsName = true;
+    }
 
     interfacePtr->sessionList = LE_DLS_LIST_INIT;
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Releases an Interface object's copy of its name, if it has one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseInterfaceName
+(
+    msgInterface_Interface_t* interfacePtr ///< [in] Ptr to the interface object.
+)
+{
+    if (interfacePtr->ownsName)
+    {
+        le_mem_Release((void*)interfacePtr->id.name);
+        interfacePtr->id.name = NULL;
+        interfacePtr->ownsName = false;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Makes sure an interface name isn't too long.  Kills the process if it is.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckInterfaceName
+(
+    const char* interfaceName
+)
+{
+    LE_FATAL_IF(le_utf8_NumBytes(interfaceName) >= LIMIT_MAX_IPC_INTERFACE_NAME_BYTES,
+                "Service ID '%s' too long (should only be %d bytes total).",
+                interfaceName,
+                LIMIT_MAX_IPC_INTERFACE_NAME_BYTES);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates a new Service object.
@@ -217,13 +300,14 @@ static void InitInterface
 static msgInterface_UnixService_t* CreateService
 (
     le_msg_ProtocolRef_t    protocolRef,
-    const char*             interfaceName
+    const char*             interfaceName,
+    bool                    isStaticName
 )
 //--------------------------------------------------------------------------------------------------
 {
     msgInterface_UnixService_t* servicePtr = le_mem_ForceAlloc(ServicePoolRef);
 
-    InitInterface(protocolRef, interfaceName, LE_MSG_INTERFACE_SERVER,
+    InitInterface(protocolRef, interfaceName, isStaticName, LE_MSG_INTERFACE_SERVER,
                   &servicePtr->interface);
 
     servicePtr->service.type = LE_MSG_SERVICE_UNIX_SOCKET;
@@ -242,6 +326,13 @@ static msgInterface_UnixService_t* CreateService
     // Initialize the open handlers dls
     servicePtr->openListPtr = LE_DLS_LIST_INIT;
 
+    servicePtr->resumeList = LE_DLS_LIST_INIT;
+
+    servicePtr->queueSize = 0;
+    servicePtr->queueList = LE_DLS_LIST_INIT;
+
+    servicePtr->bcastChannelRef = NULL;
+
     ServiceObjMapChangeCount++;
     le_hashmap_Put(ServiceMapRef, &servicePtr->interface.id, servicePtr);
 
@@ -261,7 +352,8 @@ static msgInterface_UnixService_t* CreateService
 static msgInterface_ClientInterface_t* CreateClientInterface
 (
     le_msg_ProtocolRef_t    protocolRef,
-    const char*             interfaceName
+    const char*             interfaceName,
+    bool                    isStaticName
 )
 //--------------------------------------------------------------------------------------------------
 {
@@ -269,9 +361,12 @@ static msgInterface_ClientInterface_t* CreateClientInterface
 
     InitInterface(protocolRef,
                   interfaceName,
+                  isStaticName,
                   LE_MSG_INTERFACE_CLIENT,
                   &clientPtr->interface);
 
+    clientPtr->resumeFd = -1;
+
     ClientInterfaceMapChangeCount++;
     le_hashmap_Put(ClientInterfaceMapRef, &clientPtr->interface.id, clientPtr);
 
@@ -294,22 +389,23 @@ static msgInterface_ClientInterface_t* CreateClientInterface
 static msgInterface_UnixService_t* GetService
 (
     le_msg_ProtocolRef_t    protocolRef,
-    const char*             interfaceName
+    const char*             interfaceName,
+    bool                    isStaticName    ///< [in] true if interfaceName never changes or goes
+                                            ///       away, so it doesn't need to be copied.
 )
 //--------------------------------------------------------------------------------------------------
 {
     msgInterface_Id_t id;
 
+    CheckInterfaceName(interfaceName);
+
     id.protocolRef = protocolRef;
-    LE_FATAL_IF(le_utf8_Copy(id.name, interfaceName, sizeof(id.name), NULL) == LE_OVERFLOW,
-                "Service ID '%s' too long (should only be %zu bytes total).",
-                interfaceName,
-                sizeof(id.name));
+    id.name = interfaceName;
 
     msgInterface_UnixService_t* servicePtr = le_hashmap_Get(ServiceMapRef, &id);
     if (servicePtr == NULL)
     {
-        servicePtr = CreateService(protocolRef, interfaceName);
+        servicePtr = CreateService(protocolRef, interfaceName, isStaticName);
     }
     else
     {
@@ -335,26 +431,27 @@ static msgInterface_UnixService_t* GetService
 static msgInterface_ClientInterface_t* GetClient
 (
     le_msg_ProtocolRef_t    protocolRef,
-    const char*             interfaceName
+    const char*             interfaceName,
+    bool                    isStaticName    ///< [in] true if interfaceName never changes or goes
+                                            ///       away, so it doesn't need to be copied.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Create an ID structure for this interface.
+    // Create an ID structure for this interface.  The name is only used for the look-up, so it
+    // isn't copied.
     msgInterface_Id_t id;
 
-    id.protocolRef = protocolRef;
+    CheckInterfaceName(interfaceName);
 
-    LE_FATAL_IF(le_utf8_Copy(id.name, interfaceName, sizeof(id.name), NULL) == LE_OVERFLOW,
-                "Service ID '%s' too long (should only be %zu bytes total).",
-                interfaceName,
-                sizeof(id.name));
+    id.protocolRef = protocolRef;
+    id.name = interfaceName;
 
     // Look up the ID in the client hash map to see if a client already exists for this interface.
     msgInterface_ClientInterface_t* clientPtr = le_hashmap_Get(ClientInterfaceMapRef, &id);
 
     if (clientPtr == NULL)
     {
-        clientPtr = CreateClientInterface(protocolRef, interfaceName);
+        clientPtr = CreateClientInterface(protocolRef, interfaceName, isStaticName);
     }
     else
     {
@@ -405,6 +502,13 @@ static void ServiceDestructor
 
         le_mem_Release(openEventPtr);
     }
+
+    if (servicePtr->bcastChannelRef != NULL)
+    {
+        le_mem_Release(servicePtr->bcastChannelRef);
+    }
+
+    ReleaseInterfaceName(&servicePtr->interface);
 }
 
 
@@ -427,6 +531,14 @@ static void ClientInterfaceDestructor
 
     ClientInterfaceMapChangeCount++;
     le_hashmap_Remove(ClientInterfaceMapRef, &clientPtr->interface.id);
+
+    if (clientPtr->resumeFd >= 0)
+    {
+        fd_Close(clientPtr->resumeFd);
+        clientPtr->resumeFd = -1;
+    }
+
+    ReleaseInterfaceName(&clientPtr->interface);
 }
 
 
@@ -573,9 +685,11 @@ static void DirectorySocketReadable
     }
     else
     {
-        // Create a server-side Session object for that connection to this Service.
+        // Create a server-side Session object for that connection to this Service.  The client
+        // has been authorized by the Service Directory, so it can be offered a Resume Endpoint.
         le_msg_SessionRef_t sessionRef = msgSession_CreateServerSideSession(&servicePtr->service,
-                                                                            clientSocketFd);
+                                                                            clientSocketFd,
+                                                                            true);
 
         // If successful, call the registered "open" handler, if there is one.
         if (sessionRef != NULL)
@@ -701,6 +815,153 @@ static void StartMonitoringDirectorySocket
 }
 
 
+#if LE_CONFIG_MSG_SESSION_RESUME
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deletes a Resume Endpoint, closing its socket.  Any client still holding the other end will
+ * open its next session through the Service Directory.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeleteResumeEndpoint
+(
+    ResumeEndpoint_t* endpointPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_dls_Remove(&endpointPtr->servicePtr->resumeList, &endpointPtr->link);
+
+    le_fdMonitor_Delete(endpointPtr->fdMonitorRef);
+    fd_Close(endpointPtr->fd);
+
+    le_mem_Release(endpointPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Event handler function called when a Resume Endpoint becomes readable.
+ *
+ * This means that the client has sent us an open request with the file descriptor of a new
+ * session socket (the other end of which it keeps).
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResumeEndpointReadable
+(
+    ResumeEndpoint_t* endpointPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgInterface_UnixService_t* servicePtr = endpointPtr->servicePtr;
+    svcdir_OpenRequest_t msg;
+    size_t msgSize = sizeof(msg);
+    int clientSocketFd;
+
+    le_result_t result = unixSocket_ReceiveMsg(endpointPtr->fd,
+                                               &msg,
+                                               &msgSize,
+                                               &clientSocketFd,
+                                               NULL);  // credPtr
+    if (result == LE_WOULD_BLOCK)
+    {
+        return;
+    }
+    if (result == LE_CLOSED)
+    {
+        DeleteResumeEndpoint(endpointPtr);
+        return;
+    }
+
+    svcdir_InterfaceDetails_t details;
+    msgInterface_GetInterfaceDetails(&servicePtr->interface, &details);
+
+    if ((result != LE_OK) || (clientSocketFd < 0) || (msgSize != sizeof(msg)))
+    {
+        LE_ERROR("Malformed session reopen request for (%s:%s).",
+                 servicePtr->interface.id.name,
+                 details.protocolId);
+    }
+    // The client interface bound to this service must still be using the same protocol.
+    else if (   (msg.interface.maxProtocolMsgSize != details.maxProtocolMsgSize)
+             || (strcmp(msg.interface.protocolId, details.protocolId) != 0) )
+    {
+        LE_ERROR("Session reopen request for (%s:%s) has protocol (%s), max message size %zu.",
+                 servicePtr->interface.id.name,
+                 details.protocolId,
+                 msg.interface.protocolId,
+                 msg.interface.maxProtocolMsgSize);
+    }
+    else
+    {
+        // The client already has this Resume Endpoint, so it isn't offered another one.
+        le_msg_SessionRef_t sessionRef = msgSession_CreateServerSideSession(&servicePtr->service,
+                                                                            clientSocketFd,
+                                                                            false);
+        if (sessionRef != NULL)
+        {
+            CallOpenHandler(servicePtr, sessionRef);
+        }
+        return;
+    }
+
+    // Drop the client's new session socket and the Resume Endpoint, so that the client goes back
+    // through the Service Directory.
+    if (clientSocketFd >= 0)
+    {
+        fd_Close(clientSocketFd);
+    }
+    DeleteResumeEndpoint(endpointPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles events detected on the socket of a Resume Endpoint.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ResumeEndpointEventHandler
+(
+    int     fd,
+    short   events
+)
+//--------------------------------------------------------------------------------------------------
+{
+    ResumeEndpoint_t* endpointPtr = le_fdMonitor_GetContextPtr();
+
+    LE_ASSERT(fd == endpointPtr->fd);
+
+    // Pick up any request the client sent before it hung up, then see the hang-up next time.
+    if (events & POLLIN)
+    {
+        ResumeEndpointReadable(endpointPtr);
+    }
+    else if (events & (POLLHUP | POLLRDHUP | POLLERR))
+    {
+        DeleteResumeEndpoint(endpointPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deletes all of a Service's Resume Endpoints.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeleteAllResumeEndpoints
+(
+    msgInterface_UnixService_t* servicePtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_dls_Link_t* linkPtr;
+
+    while ((linkPtr = le_dls_Peek(&servicePtr->resumeList)) != NULL)
+    {
+        DeleteResumeEndpoint(CONTAINER_OF(linkPtr, ResumeEndpoint_t, link));
+    }
+}
+#endif /* end LE_CONFIG_MSG_SESSION_RESUME */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Close all sessions on a given Service object's list of open sessions.
@@ -736,6 +997,47 @@ static void CloseAllSessions
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a service that is accessible using a given protocol.
+ *
+ * @return  The service reference.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_msg_ServiceRef_t CreateServiceRef
+(
+    le_msg_ProtocolRef_t    protocolRef,    ///< [in] Reference to the protocol to be used.
+    const char*             interfaceName,  ///< [in] Server-side interface name.
+    bool                    isStaticName    ///< [in] true if interfaceName never changes or goes
+                                            ///       away, so it doesn't need to be copied.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // Must lock the mutex to prevent races between different threads trying to offer the
+    // same service at the same time, or one thread trying to delete a service while another
+    // tries to create it, or accessing the Service List hashmap while another thread
+    // is updating it.
+
+    LOCK
+
+    // Get a Service object.
+    msgInterface_UnixService_t* servicePtr = GetService(protocolRef, interfaceName, isStaticName);
+
+    // If the Service object already has a server thread, then it means that this service
+    // is already being offered by someone else in this very process.
+    LE_FATAL_IF(servicePtr->serverThread != NULL,
+                "Duplicate service (%s:%s) offered in same process.",
+                interfaceName,
+                le_msg_GetProtocolIdStr(protocolRef));
+
+    servicePtr->serverThread = le_thread_GetCurrent();
+
+    UNLOCK
+
+    return &servicePtr->service;
+}
+
+
 // =======================================
 //  PROTECTED (INTER-MODULE) FUNCTIONS
 // =======================================
@@ -819,6 +1121,10 @@ void msgInterface_Init
     le_mem_ExpandPool(ClientInterfacePoolRef, MAX_EXPECTED_CLIENT_INTERFACES );
     le_mem_SetDestructor(ClientInterfacePoolRef, ClientInterfaceDestructor);
 
+    // Create the pool of interface name copies.
+    InterfaceNamePoolRef = le_mem_CreatePool("InterfaceNames", LIMIT_MAX_IPC_INTERFACE_NAME_BYTES);
+    le_mem_EnableSizeClasses(InterfaceNamePoolRef, 32);
+
     // Create and initialize the pool of event handlers objects.
     HandlerEventPoolRef = le_mem_CreatePool("HandlerEventPool", sizeof(SessionEventHandler_t));
     le_mem_ExpandPool(HandlerEventPoolRef, MAX_EXPECTED_SERVICES*6);
@@ -826,6 +1132,13 @@ void msgInterface_Init
     // Create safe reference map for add references.
     HandlersRefMap = le_ref_CreateMap("HandlersRef", MAX_EXPECTED_SERVICES*6);
 
+#if LE_CONFIG_MSG_SESSION_RESUME
+    // Create the pool of Resume Endpoint objects.
+    ResumeEndpointPoolRef = le_mem_CreatePool("MessagingResumeEndpoints",
+                                              sizeof(ResumeEndpoint_t));
+    le_mem_ExpandPool(ResumeEndpointPoolRef, MAX_EXPECTED_SERVICES);
+#endif
+
     // Create the Service Map.
     ServiceMapRef = le_hashmap_Create("MessagingServices",
                                       MAX_EXPECTED_SERVICES,
@@ -851,14 +1164,16 @@ void msgInterface_Init
 le_msg_ClientInterfaceRef_t msgInterface_GetClient
 (
     le_msg_ProtocolRef_t    protocolRef,
-    const char*             interfaceName
+    const char*             interfaceName,
+    bool                    isStaticName    ///< true if interfaceName never changes or goes away,
+                                            ///  so it doesn't need to be copied.
 )
 //--------------------------------------------------------------------------------------------------
 {
     msgInterface_ClientInterface_t* clientPtr;
 
     LOCK
-    clientPtr = GetClient(protocolRef, interfaceName);
+    clientPtr = GetClient(protocolRef, interfaceName, isStaticName);
     UNLOCK
 
     return clientPtr;
@@ -1052,6 +1367,158 @@ void msgInterface_ProcessMessageFromClient
 }
 
 
+#if LE_CONFIG_MSG_SESSION_RESUME
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a Resume Endpoint to a Service.  The Service takes ownership of the socket, which is the
+ * server's end of a socket pair whose other end is handed to a client that the Service Directory
+ * has connected to the Service.
+ *
+ * @note    This is only called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgInterface_AddResumeEndpoint
+(
+    le_msg_ServiceRef_t serviceRef,     ///< [IN] Reference to the service.
+    int fd                              ///< [IN] Server's end of the socket pair.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgInterface_UnixService_t* servicePtr = CONTAINER_OF(serviceRef,
+                                                          msgInterface_UnixService_t,
+                                                          service);
+
+    ResumeEndpoint_t* endpointPtr = le_mem_ForceAlloc(ResumeEndpointPoolRef);
+
+    endpointPtr->link = LE_DLS_LINK_INIT;
+    endpointPtr->fd = fd;
+    endpointPtr->servicePtr = servicePtr;
+
+    fd_SetNonBlocking(fd);
+
+    endpointPtr->fdMonitorRef = le_fdMonitor_Create(servicePtr->interface.id.name,
+                                                    fd,
+                                                    ResumeEndpointEventHandler,
+                                                    POLLIN);
+    le_fdMonitor_SetContextPtr(endpointPtr->fdMonitorRef, endpointPtr);
+
+    le_dls_Queue(&servicePtr->resumeList, &endpointPtr->link);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a Client Interface's Resume Endpoint connection, through which a session can be reopened
+ * with the service it is bound to without going through the Service Directory.
+ *
+ * @return A duplicate of the connection's file descriptor, which the caller must close, or -1 if
+ *         the Client Interface doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+int msgInterface_GetResumeFd
+(
+    le_msg_InterfaceRef_t interfaceRef  ///< [IN] Reference to the Client Interface.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgInterface_ClientInterface_t* clientPtr = CONTAINER_OF(interfaceRef,
+                                                             msgInterface_ClientInterface_t,
+                                                             interface);
+    int fd = -1;
+
+    // The connection may be shared by sessions in several threads, and dropped by any of them,
+    // so each user gets its own duplicate.
+    LOCK
+    if (clientPtr->resumeFd >= 0)
+    {
+        fd = fcntl(clientPtr->resumeFd, F_DUPFD_CLOEXEC, 0);
+        if (fd < 0)
+        {
+            LE_WARN("Failed to duplicate resume fd. Errno = %d (%m).", errno);
+        }
+    }
+    UNLOCK
+
+    return fd;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives a Client Interface a Resume Endpoint connection received from its service's server.  If
+ * the Client Interface already has one, the new one is closed.
+ *
+ * The connection holds a reference to the Client Interface, so that it outlives the sessions
+ * opened through it and can be used by the next one.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgInterface_SetResumeFd
+(
+    le_msg_InterfaceRef_t interfaceRef, ///< [IN] Reference to the Client Interface.
+    int fd                              ///< [IN] The connection's file descriptor.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgInterface_ClientInterface_t* clientPtr = CONTAINER_OF(interfaceRef,
+                                                             msgInterface_ClientInterface_t,
+                                                             interface);
+
+    // Reopen requests are never worth blocking for; if the socket is full, the Service
+    // Directory is used instead.
+    fd_SetNonBlocking(fd);
+
+    LOCK
+    if (clientPtr->resumeFd < 0)
+    {
+        clientPtr->resumeFd = fd;
+        fd = -1;
+        le_mem_AddRef(clientPtr);
+    }
+    UNLOCK
+
+    if (fd >= 0)
+    {
+        fd_Close(fd);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a Client Interface's Resume Endpoint connection, if it has one, so that its sessions are
+ * opened through the Service Directory again.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgInterface_DropResumeFd
+(
+    le_msg_InterfaceRef_t interfaceRef  ///< [IN] Reference to the Client Interface.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgInterface_ClientInterface_t* clientPtr = CONTAINER_OF(interfaceRef,
+                                                             msgInterface_ClientInterface_t,
+                                                             interface);
+    int fd;
+
+    LOCK
+    fd = clientPtr->resumeFd;
+    clientPtr->resumeFd = -1;
+    if (fd >= 0)
+    {
+        // Drop the connection's reference.  The caller still holds one, so this never runs the
+        // destructor.
+        le_mem_Release(clientPtr);
+    }
+    UNLOCK
+
+    if (fd >= 0)
+    {
+        fd_Close(fd);
+    }
+}
+#endif /* end LE_CONFIG_MSG_SESSION_RESUME */
+
+
 // =======================================
 //  PUBLIC API FUNCTIONS
 // =======================================
@@ -1071,28 +1538,26 @@ le_msg_ServiceRef_t le_msg_CreateService
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Must lock the mutex to prevent races between different threads trying to offer the
-    // same service at the same time, or one thread trying to delete a service while another
-    // tries to create it, or accessing the Service List hashmap while another thread
-    // is updating it.
-
-    LOCK
-
-    // Get a Service object.
-    msgInterface_UnixService_t* servicePtr = GetService(protocolRef, interfaceName);
-
-    // If the Service object already has a server thread, then it means that this service
-    // is already being offered by someone else in this very process.
-    LE_FATAL_IF(servicePtr->serverThread != NULL,
-                "Duplicate service (%s:%s) offered in same process.",
-                interfaceName,
-                le_msg_GetProtocolIdStr(protocolRef));
+    return CreateServiceRef(protocolRef, interfaceName, false);
+}
 
-    servicePtr->serverThread = le_thread_GetCurrent();
 
-    UNLOCK
-
-    return &servicePtr->service;
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a service that is accessible using a given protocol, referring to the caller's
+ * interface name instead of copying it.
+ *
+ * @return  The service reference.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_ServiceRef_t le_msg_CreateStaticService
+(
+    le_msg_ProtocolRef_t    protocolRef,    ///< [in] Reference to the protocol to be used.
+    const char*             interfaceName   ///< [in] Server-side interface name (constant).
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return CreateServiceRef(protocolRef, interfaceName, true);
 }
 
 
@@ -1394,6 +1859,87 @@ void* le_msg_GetServiceContextPtr
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives a service a durable queue for the one-way messages its clients send.  Only affects
+ * sessions opened afterwards.
+ *
+ * @note    This is a server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetServiceDurableQueue
+(
+    le_msg_ServiceRef_t serviceRef, ///< [in] Reference to the service.
+    size_t              numBytes    ///< [in] Size of each client user's ring, in bytes, or 0 for
+                                    ///       no durable queue.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    switch (serviceRef->type)
+    {
+        case LE_MSG_SERVICE_LOCAL:
+            LE_FATAL("Cannot set durable queue for a local service");
+            break;
+        case LE_MSG_SERVICE_UNIX_SOCKET:
+        {
+#if LE_CONFIG_MSG_DURABLE_QUEUE
+            msgInterface_UnixService_t* servicePtr =
+                CONTAINER_OF(serviceRef, msgInterface_UnixService_t, service);
+            servicePtr->queueSize = numBytes;
+#else
+            LE_UNUSED(numBytes);
+#endif
+            break;
+        }
+        default:
+            LE_FATAL("Corrupted service type: %d", serviceRef->type);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives a service a broadcast channel, through which le_msg_Broadcast() delivers messages to the
+ * subscribers of the sessions opened afterwards.
+ *
+ * @note    This is a server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetServiceBroadcast
+(
+    le_msg_ServiceRef_t         serviceRef, ///< [in] Reference to the service.
+    size_t                      numMsgs,    ///< [in] Number of messages the channel holds.
+    le_msg_BroadcastOverflow_t  overflow    ///< [in] What a client that falls further behind
+                                            ///       than that does.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    switch (serviceRef->type)
+    {
+        case LE_MSG_SERVICE_LOCAL:
+            LE_FATAL("Cannot set broadcast channel for a local service");
+            break;
+        case LE_MSG_SERVICE_UNIX_SOCKET:
+        {
+            msgInterface_UnixService_t* servicePtr =
+                CONTAINER_OF(serviceRef, msgInterface_UnixService_t, service);
+
+            LE_FATAL_IF(servicePtr->bcastChannelRef != NULL,
+                        "Service '%s' already has a broadcast channel.",
+                        servicePtr->interface.id.name);
+
+            servicePtr->bcastChannelRef = msgBcast_CreateChannel(
+                            le_msg_GetProtocolMaxMsgSize(servicePtr->interface.id.protocolRef),
+                            numMsgs,
+                            overflow);
+            break;
+        }
+        default:
+            LE_FATAL("Corrupted service type: %d", serviceRef->type);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Makes a given service available for clients to find.
@@ -1511,6 +2057,11 @@ void le_msg_HideService
     fd_Close(servicePtr->directorySocketFd);
     servicePtr->directorySocketFd = -1;
 
+#if LE_CONFIG_MSG_SESSION_RESUME
+    // Clients can't reopen sessions directly with a hidden service either.
+    DeleteAllResumeEndpoints(servicePtr);
+#endif
+
     servicePtr->state = LE_MSG_INTERFACE_SERVICE_HIDDEN;
 }
 
@@ -12,6 +12,7 @@
 
 #include "limit.h"
 #include "serviceDirectory/serviceDirectoryProtocol.h"
+#include "messagingBroadcast.h"
 
 
 //--------------------------------------------------------------------------------------------------
@@ -36,7 +37,8 @@ msgInterface_Type_t;
 typedef struct
 {
     le_msg_ProtocolRef_t    protocolRef;          ///< The protocol that this interface supports.
-    char    name[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES]; ///< The interface instance name.
+    const char*             name;                 ///< The interface instance name (either
+                                                  ///  the caller's constant, or a copy of it).
 }
 msgInterface_Id_t;
 
@@ -53,6 +55,8 @@ typedef struct le_msg_Interface
     le_dls_List_t sessionList;         ///< List of Session objects for open sessions with other
                                        ///  interfaces.
     msgInterface_Type_t interfaceType; ///< The type of the more specific interface object.
+    bool ownsName;                     ///< true if id.name is a copy to be released with the
+                                       ///  interface.
 }
 msgInterface_Interface_t;
 
@@ -94,6 +98,17 @@ typedef struct msgInterface_UnixService
 
     le_dls_List_t                   closeListPtr; ///< open List: list of close session handlers
                                                   ///  called when a session is opened
+
+    le_dls_List_t                   resumeList;   ///< List of Resume Endpoints through which
+                                                  ///  clients can reopen sessions directly.
+
+    size_t                          queueSize;    ///< Size of the durable queue of each client
+                                                  ///  user, in bytes (0 = no durable queue).
+    le_dls_List_t                   queueList;    ///< Durable queues of the users with sessions
+                                                  ///  open.
+
+    msgBcast_ChannelRef_t           bcastChannelRef; ///< Broadcast channel, or NULL if the
+                                                     ///  service doesn't have one.
 }
 msgInterface_UnixService_t;
 
@@ -108,6 +123,8 @@ typedef struct le_msg_ClientInterface
     msgInterface_Interface_t interface; ///< The interface part of a client interface object.
 
     // Stuff used only on the Client side:
+    int resumeFd;                       ///< Socket connected to a Resume Endpoint of the service
+                                        ///  the interface is bound to (or -1 if none).
 }
 msgInterface_ClientInterface_t;
 
@@ -179,7 +196,9 @@ void msgInterface_Init
 le_msg_ClientInterfaceRef_t msgInterface_GetClient
 (
     le_msg_ProtocolRef_t    protocolRef,
-    const char*             interfaceName
+    const char*             interfaceName,
+    bool                    isStaticName    ///< true if interfaceName never changes or goes away,
+                                            ///  so it doesn't need to be copied.
 );
 
 
@@ -272,4 +291,60 @@ void msgInterface_ProcessMessageFromClient
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a Resume Endpoint to a Service.  The Service takes ownership of the socket, which is the
+ * server's end of a socket pair whose other end is handed to a client that the Service Directory
+ * has connected to the Service.
+ *
+ * @note    This is only called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgInterface_AddResumeEndpoint
+(
+    le_msg_ServiceRef_t serviceRef,     ///< [IN] Reference to the service.
+    int fd                              ///< [IN] Server's end of the socket pair.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a Client Interface's Resume Endpoint connection, through which a session can be reopened
+ * with the service it is bound to without going through the Service Directory.
+ *
+ * @return A duplicate of the connection's file descriptor, which the caller must close, or -1 if
+ *         the Client Interface doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+int msgInterface_GetResumeFd
+(
+    le_msg_InterfaceRef_t interfaceRef  ///< [IN] Reference to the Client Interface.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives a Client Interface a Resume Endpoint connection received from its service's server.  If
+ * the Client Interface already has one, the new one is closed.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgInterface_SetResumeFd
+(
+    le_msg_InterfaceRef_t interfaceRef, ///< [IN] Reference to the Client Interface.
+    int fd                              ///< [IN] The connection's file descriptor.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a Client Interface's Resume Endpoint connection, if it has one, so that its sessions are
+ * opened through the Service Directory again.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgInterface_DropResumeFd
+(
+    le_msg_InterfaceRef_t interfaceRef  ///< [IN] Reference to the Client Interface.
+);
+
+
 #endif // LE_MESSAGING_INTERFACE_H_INCLUDE_GUARD
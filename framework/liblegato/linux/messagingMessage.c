@@ -16,6 +16,20 @@
 #include "fileDescriptor.h"
 #include "unixSocket.h"
 
+// =======================================
+//  PRIVATE DATA
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Smallest payload buffer given to a message created with le_msg_CreateSizedMsg().  Messages are
+ * sent as big as their payload buffer, and only shared memory descriptors and broadcast control
+ * messages are sent shorter than this, so neither can be mistaken for a sized message.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MIN_PAYLOAD_BYTES   32
+
+
 // =======================================
 //  PRIVATE FUNCTIONS
 // =======================================
@@ -101,11 +115,139 @@ static void MessageDestructor
         fd_Close(msgPtr->fd);
     }
 
+    // Release the shared memory slot holding the payload, if any.
+    if (msgPtr->shmRegionRef != NULL)
+    {
+        msgShm_ReleaseSlot(msgPtr->shmRegionRef, msgPtr->shmSlot);
+        le_mem_Release(msgPtr->shmRegionRef);
+    }
+
     // Release the Message object's hold on the Session object.
     le_mem_Release(msgPtr->message.sessionRef);
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make a Message object's payload live in a given shared memory slot.
+ *
+ * @note Takes over the caller's reference to the slot.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetSharedPayload
+(
+    UnixMessage_t*      msgPtr,
+    msgShm_RegionRef_t  regionRef,
+    uint32_t            slot,
+    void*               payloadPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_mem_AddRef(regionRef);
+    msgPtr->shmRegionRef = regionRef;
+    msgPtr->shmSlot = slot;
+    msgPtr->shmPayloadPtr = payloadPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move a Message object's payload out of its shared memory slot and into its own payload buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UnshareMessagePayload
+(
+    UnixMessage_t*  msgPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    memcpy(msgPtr->payload, msgPtr->shmPayloadPtr, msgPtr->payloadSize);
+
+    msgShm_ReleaseSlot(msgPtr->shmRegionRef, msgPtr->shmSlot);
+    le_mem_Release(msgPtr->shmRegionRef);
+    msgPtr->shmRegionRef = NULL;
+    msgPtr->shmPayloadPtr = NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a message to be sent over a given Unix socket session.
+ *
+ * @return  The message reference.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_msg_MessageRef_t CreateUnixMsg
+(
+    le_msg_SessionRef_t sessionRef,     ///< [in] Reference to the session.
+    size_t              payloadSize,    ///< [in] Size of the payload buffer, in bytes (at most the
+                                        ///       protocol's maximum message size).
+    bool                allowSharedMem  ///< [in] true = put the payload in shared memory, if the
+                                        ///       session has a shared memory slot free.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // Get a reference to the Session's Protocol and ask the Protocol to allocate a Message
+    // object from its Message Pool.
+    le_msg_ProtocolRef_t protocolRef = le_msg_GetSessionProtocol(sessionRef);
+    UnixMessage_t* msgPtr = msgProto_AllocMessage(protocolRef, payloadSize);
+
+    // Initialize the Message object's data members.
+    msgPtr->link = LE_DLS_LINK_INIT;
+    msgPtr->message.sessionRef = sessionRef;
+    le_mem_AddRef(sessionRef);  // Message object holds a reference to the Session object.
+
+    msgInterface_Type_t interfaceType = msgSession_GetInterfaceType(sessionRef);
+    switch (interfaceType)
+    {
+        case LE_MSG_INTERFACE_CLIENT:
+            msgPtr->clientServer.client.completionCallback = NULL;
+            msgPtr->clientServer.client.contextPtr = NULL;
+            break;
+
+        case LE_MSG_INTERFACE_SERVER:
+            msgPtr->clientServer.server.responseFd = -1;
+            break;
+
+        default:
+            LE_FATAL("Unhandled interface type (%d).", interfaceType);
+    }
+
+    msgPtr->fd = -1;
+    msgPtr->txnId = 0;
+    msgPtr->shmRegionRef = NULL;
+    msgPtr->shmPayloadPtr = NULL;
+    msgPtr->isBroadcastControl = false;
+    msgPtr->payloadSize = payloadSize;
+
+    // If the session has shared memory, build the payload directly in a shared slot, so that
+    // sending it doesn't need to copy it.  If no slot is free, fall back to the payload buffer.
+    msgShm_RegionRef_t regionRef = msgSession_GetSharedMemRegion(sessionRef);
+    if (allowSharedMem && (regionRef != NULL))
+    {
+        uint32_t slot;
+        void* payloadPtr = msgShm_AllocSlot(regionRef, &slot);
+
+        if (payloadPtr != NULL)
+        {
+            SetSharedPayload(msgPtr, regionRef, slot, payloadPtr);
+        }
+    }
+
+    // The receiver of a shared payload sees the whole slot, so clear all of it.
+    if (msgPtr->shmPayloadPtr != NULL)
+    {
+        memset(msgPtr->shmPayloadPtr, 0, le_msg_GetProtocolMaxMsgSize(protocolRef));
+    }
+    else
+    {
+        memset(msgPtr->payload, 0, payloadSize);
+    }
+
+    return msgMessage_GetMessageRef(msgPtr);
+}
+
+
 // =======================================
 //  PROTECTED (INTER-MODULE) FUNCTIONS
 // =======================================
@@ -155,6 +297,10 @@ le_mem_PoolRef_t msgMessage_CreatePool
 
     le_mem_SetDestructor(poolRef, MessageDestructor);
 
+    // Messages created with le_msg_CreateSizedMsg(), and small received messages, come from
+    // smaller blocks.
+    le_mem_EnableSizeClasses(poolRef, sizeof(UnixMessage_t) + MIN_PAYLOAD_BYTES);
+
     le_mem_ExpandPool(poolRef, 10); /// @todo Make this configurable.
 
     return poolRef;
@@ -163,25 +309,44 @@ le_mem_PoolRef_t msgMessage_CreatePool
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Send a single message over a connected socket.
+ * Create a Message object to receive a message into, using msgMessage_Receive().
  *
- * @return
- * - LE_OK if successful.
- * - LE_NO_MEMORY if the socket doesn't have enough send buffer space available right now.
- * - LE_COMM_ERROR if the localSocketFd is not connected.
- * - LE_FAULT if failed for some other reason (check your logs).
+ * Unlike le_msg_CreateMsg(), this never takes a shared memory slot, because the payload
+ * location is only known when the message has been received.
  *
- * @note    Won't return LE_NO_MEMORY if the socket is in blocking mode.
+ * @return  The message reference.
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t msgMessage_Send
+le_msg_MessageRef_t msgMessage_CreateReceiveMsg
 (
-    int         socketFd,       ///< [IN] Connected socket's file descriptor.
-    le_msg_MessageRef_t msgRef  ///< The Message to be sent.
+    le_msg_SessionRef_t sessionRef  ///< [IN] Reference to the session.
 )
 //--------------------------------------------------------------------------------------------------
 {
-    UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+    return CreateUnixMsg(sessionRef,
+                         le_msg_GetProtocolMaxMsgSize(le_msg_GetSessionProtocol(sessionRef)),
+                         false);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a Message object ready to be sent and describe what is to be sent for it.
+ *
+ * The first bytes come from the transaction ID and the rest from the Message object's payload
+ * section, which comes right after the transaction ID.  If the payload lives in a shared memory
+ * slot that the other side can see, a descriptor naming the slot is put in the payload section and
+ * only that is sent.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrepareSend
+(
+    UnixMessage_t*          msgPtr,     ///< [IN] The Message to be sent.
+    unixSocket_BatchMsg_t*  sendPtr     ///< [OUT] What to send.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_MessageRef_t msgRef = msgMessage_GetMessageRef(msgPtr);
 
     // If this is a response message,
     if (le_msg_NeedsResponse(msgRef))
@@ -199,14 +364,243 @@ le_result_t msgMessage_Send
         msgPtr->clientServer.server.responseFd = -1;
     }
 
-    // The first bytes come from our transaction ID and the rest (if any)
-    // from our Message object's payload section, which comes right after the transaction ID.
-    return unixSocket_SendMsg(  socketFd,
-                                &msgPtr->txnId,
-                                sizeof(msgPtr->txnId) +
-                                le_msg_GetMaxPayloadSize(msgMessage_GetMessageRef(msgPtr)),
-                                msgPtr->fd,
-                                false   ); // Don't send process credentials.
+    sendPtr->dataPtr = &msgPtr->txnId;
+    sendPtr->fd = msgPtr->fd;
+
+    if (msgPtr->isBroadcastControl)
+    {
+        sendPtr->dataSize = sizeof(msgPtr->txnId) + sizeof(msgBcast_Control_t);
+        return;
+    }
+
+    if (msgPtr->shmRegionRef != NULL)
+    {
+        if (msgPtr->shmRegionRef == msgSession_GetSharedMemRegion(msgRef->sessionRef))
+        {
+            // The payload buffer isn't used while the payload is shared, so put the descriptor
+            // there.
+            msgShm_Descriptor_t descriptor = { MSGSHM_DESCRIPTOR_MAGIC, msgPtr->shmSlot };
+            memcpy(msgPtr->payload, &descriptor, sizeof(descriptor));
+
+            // The receiver adopts this reference.  If the send fails, it is taken back.
+            msgShm_AddSlotRef(msgPtr->shmRegionRef, msgPtr->shmSlot);
+
+            sendPtr->dataSize = sizeof(msgPtr->txnId) + sizeof(descriptor);
+            return;
+        }
+
+        // The session has been reopened with a different region since this payload was put in
+        // shared memory, so the other side can't see the slot.  Send a copy instead.
+        UnshareMessagePayload(msgPtr);
+    }
+
+    sendPtr->dataSize = sizeof(msgPtr->txnId) + msgPtr->payloadSize;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Undo PrepareSend() for a Message object that was not sent, so that it can be sent again later.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AbortSend
+(
+    UnixMessage_t*  msgPtr      ///< [IN] The Message that was not sent.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (le_msg_NeedsResponse(msgMessage_GetMessageRef(msgPtr)))
+    {
+        msgPtr->clientServer.server.responseFd = msgPtr->fd;
+        msgPtr->fd = -1;
+    }
+
+    if (msgPtr->shmRegionRef != NULL)
+    {
+        msgShm_ReleaseSlot(msgPtr->shmRegionRef, msgPtr->shmSlot);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finish receiving a message into a Message object.
+ *
+ * @return
+ * - LE_OK if successful.
+ * - LE_COMM_ERROR if the message is not valid.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FinishReceive
+(
+    UnixMessage_t*  msgPtr,     ///< [IN] Message object the message was received into.
+    size_t          byteCount   ///< [IN] Number of bytes received.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // On a session with a broadcast channel, a message that is shorter than a full one may be a
+    // broadcast control message.  (Channels are only created for protocols whose messages are
+    // larger than one.)
+    if ((msgSession_GetBroadcastReader(msgPtr->message.sessionRef) != NULL) &&
+        (byteCount == sizeof(msgPtr->txnId) + sizeof(msgBcast_Control_t)))
+    {
+        msgBcast_Control_t control;
+
+        memcpy(&control, msgPtr->payload, sizeof(control));
+        if (control.magic == MSGBCAST_CONTROL_MAGIC)
+        {
+            msgPtr->isBroadcastControl = true;
+            return LE_OK;
+        }
+    }
+
+    // A message that is shorter than a full one carries a shared memory descriptor in place of
+    // its payload.
+    msgShm_RegionRef_t regionRef = msgSession_GetSharedMemRegion(msgPtr->message.sessionRef);
+    if ((regionRef != NULL) &&
+        (byteCount == sizeof(msgPtr->txnId) + sizeof(msgShm_Descriptor_t)))
+    {
+        msgShm_Descriptor_t descriptor;
+        void* payloadPtr = NULL;
+
+        memcpy(&descriptor, msgPtr->payload, sizeof(descriptor));
+        if (descriptor.magic == MSGSHM_DESCRIPTOR_MAGIC)
+        {
+            payloadPtr = msgShm_GetSlot(regionRef, descriptor.slot);
+        }
+
+        if (payloadPtr == NULL)
+        {
+            LE_ERROR("Received invalid shared memory descriptor.");
+            return LE_COMM_ERROR;
+        }
+
+        // Adopt the reference that the sender added to the slot for us.
+        SetSharedPayload(msgPtr, regionRef, descriptor.slot, payloadPtr);
+
+        return LE_OK;
+    }
+
+    // Otherwise, the payload buffer is as big as the sender's was, so that a response fits in it.
+    msgPtr->payloadSize = (byteCount > sizeof(msgPtr->txnId) ?
+                           byteCount - sizeof(msgPtr->txnId) : 0);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move a received message to a Message object with a payload buffer no bigger than the message,
+ * if that frees enough memory to be worth the copy (at least half of the object).  Messages are
+ * received into Message objects big enough for the protocol's largest message, but may then wait
+ * on the session's Receive Queue, or be held by the server until it responds to them.
+ *
+ * @return The Message object now holding the message (msgRef itself, if it was kept).
+ */
+//--------------------------------------------------------------------------------------------------
+static le_msg_MessageRef_t ShrinkReceivedMsg
+(
+    le_msg_MessageRef_t msgRef      ///< [IN] Message that has just been received.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+    le_msg_ProtocolRef_t protocolRef = le_msg_GetSessionProtocol(msgRef->sessionRef);
+    size_t objSize = sizeof(UnixMessage_t) + msgPtr->payloadSize;
+    size_t maxObjSize = sizeof(UnixMessage_t) + le_msg_GetProtocolMaxMsgSize(protocolRef);
+
+    if ((msgPtr->shmRegionRef != NULL) || msgPtr->isBroadcastControl || (objSize > maxObjSize / 2))
+    {
+        return msgRef;
+    }
+
+    le_msg_MessageRef_t newMsgRef = CreateUnixMsg(msgRef->sessionRef, msgPtr->payloadSize, false);
+    UnixMessage_t* newMsgPtr = msgMessage_GetUnixMessagePtr(newMsgRef);
+
+    memcpy(newMsgPtr->payload, msgPtr->payload, msgPtr->payloadSize);
+    newMsgPtr->txnId = msgPtr->txnId;
+    newMsgPtr->fd = msgPtr->fd;
+
+    // The old object no longer holds the message, so releasing it must not close its fd or
+    // complain that the message was not responded to.
+    msgPtr->txnId = 0;
+    msgPtr->fd = -1;
+    le_mem_Release(msgPtr);
+
+    return newMsgRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a single message over a connected socket.
+ *
+ * @return
+ * - LE_OK if successful.
+ * - LE_NO_MEMORY if the socket doesn't have enough send buffer space available right now.
+ * - LE_COMM_ERROR if the localSocketFd is not connected.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ *
+ * @note    Won't return LE_NO_MEMORY if the socket is in blocking mode.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgMessage_Send
+(
+    int         socketFd,       ///< [IN] Connected socket's file descriptor.
+    le_msg_MessageRef_t msgRef  ///< The Message to be sent.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    size_t sentCount;
+
+    return msgMessage_SendBatch(socketFd, &msgRef, 1, &sentCount);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a batch of messages over a connected socket, in order, using as few system calls as
+ * possible.
+ *
+ * If the socket fills up part way through, the messages that were sent are counted in
+ * *sentCountPtr and the rest are left as they were, ready to be sent again later.
+ *
+ * @return
+ * - LE_OK if all the messages were sent.
+ * - LE_NO_MEMORY if the socket doesn't have enough send buffer space available right now.
+ * - LE_COMM_ERROR if the localSocketFd is not connected.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgMessage_SendBatch
+(
+    int                 socketFd,       ///< [IN] Connected socket's file descriptor.
+    le_msg_MessageRef_t msgRefs[],      ///< [IN] The Messages to be sent.
+    size_t              count,          ///< [IN] Number of messages (at most
+                                        ///       UNIXSOCKET_MAX_BATCH_LEN).
+    size_t*             sentCountPtr    ///< [OUT] Number of messages that were sent.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    unixSocket_BatchMsg_t batch[UNIXSOCKET_MAX_BATCH_LEN];
+    size_t i;
+
+    LE_ASSERT(count <= UNIXSOCKET_MAX_BATCH_LEN);
+
+    for (i = 0; i < count; i++)
+    {
+        PrepareSend(msgMessage_GetUnixMessagePtr(msgRefs[i]), &batch[i]);
+    }
+
+    le_result_t result = unixSocket_SendMsgBatch(socketFd, batch, count, sentCountPtr);
+
+    for (i = *sentCountPtr; i < count; i++)
+    {
+        AbortSend(msgMessage_GetUnixMessagePtr(msgRefs[i]));
+    }
+
+    return result;
 }
 
 
@@ -243,6 +637,85 @@ le_result_t msgMessage_Receive
         msgPtr->clientServer.server.responseFd = -1;
     }
 
+    if (result == LE_OK)
+    {
+        result = FinishReceive(msgPtr, byteCount);
+    }
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receive a batch of messages from a connected socket using a single system call.
+ *
+ * The messages that were received successfully are moved, in order, to the front of the msgRefs
+ * array and counted in *receivedCountPtr.  The rest of the Message objects (unused, or holding a
+ * message that was discarded because it was truncated or invalid) are left after them.
+ *
+ * @return
+ * - LE_OK if anything was received (possibly only messages that had to be discarded).
+ * - LE_WOULD_BLOCK if there's nothing there to receive and the socket is set non-blocking.
+ * - LE_CLOSED if the connection has closed.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgMessage_ReceiveBatch
+(
+    int                 socketFd,           ///< [IN] The socket's file descriptor.
+    le_msg_MessageRef_t msgRefs[],          ///< [IN+OUT] Message objects to receive into.
+    size_t              count,              ///< [IN] Number of Message objects (at most
+                                            ///       UNIXSOCKET_MAX_BATCH_LEN).
+    size_t*             receivedCountPtr    ///< [OUT] Number of messages received successfully.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    unixSocket_BatchMsg_t batch[UNIXSOCKET_MAX_BATCH_LEN];
+    size_t batchCount;
+    size_t i;
+
+    LE_ASSERT(count <= UNIXSOCKET_MAX_BATCH_LEN);
+
+    for (i = 0; i < count; i++)
+    {
+        UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRefs[i]);
+
+        batch[i].dataPtr = &msgPtr->txnId;
+        batch[i].dataSize = sizeof(msgPtr->txnId) + le_msg_GetMaxPayloadSize(msgRefs[i]);
+    }
+
+    le_result_t result = unixSocket_ReceiveMsgBatch(socketFd, batch, count, &batchCount);
+
+    *receivedCountPtr = 0;
+
+    for (i = 0; i < batchCount; i++)
+    {
+        le_msg_MessageRef_t msgRef = msgRefs[i];
+        UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+
+        msgPtr->fd = batch[i].fd;
+        if (msgSession_GetInterfaceType(msgRef->sessionRef) == LE_MSG_INTERFACE_SERVER)
+        {
+            msgPtr->clientServer.server.responseFd = -1;
+        }
+
+        if (batch[i].result != LE_OK)
+        {
+            LE_ERROR("Discarding message that was truncated (%s).",
+                     LE_RESULT_TXT(batch[i].result));
+        }
+        else if (FinishReceive(msgPtr, batch[i].dataSize) == LE_OK)
+        {
+            msgRef = ShrinkReceivedMsg(msgRef);
+
+            // Keep the good messages together at the front, in the order they arrived.
+            msgRefs[i] = msgRefs[*receivedCountPtr];
+            msgRefs[*receivedCountPtr] = msgRef;
+            (*receivedCountPtr)++;
+        }
+    }
+
     return result;
 }
 
@@ -284,6 +757,105 @@ void* msgMessage_GetTxnId
 }
 
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a Message object carries a file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+bool msgMessage_HasFd
+(
+    le_msg_MessageRef_t msgRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    UnixMessage_t* localMsgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+
+    return (localMsgPtr->fd >= 0);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a broadcast control message to be sent to a client through a given session.
+ *
+ * @return  The message reference.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_MessageRef_t msgMessage_CreateBroadcastControlMsg
+(
+    le_msg_SessionRef_t         sessionRef, ///< [IN] Reference to the (server-side) session.
+    const msgBcast_Control_t*   controlPtr  ///< [IN] Control message to put in the payload.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // The control message goes in the payload buffer, never in shared memory.
+    le_msg_MessageRef_t msgRef = CreateUnixMsg(sessionRef,
+                                               le_msg_GetProtocolMaxMsgSize(
+                                                   le_msg_GetSessionProtocol(sessionRef)),
+                                               false);
+    UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+
+    memcpy(msgPtr->payload, controlPtr, sizeof(*controlPtr));
+    msgPtr->isBroadcastControl = true;
+
+    return msgRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a received Message object is a broadcast control message, whose payload is a
+ * msgBcast_Control_t.
+ */
+//--------------------------------------------------------------------------------------------------
+bool msgMessage_IsBroadcastControl
+(
+    le_msg_MessageRef_t msgRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    UnixMessage_t* localMsgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+
+    return localMsgPtr->isBroadcastControl;
+}
+
+
+#if LE_CONFIG_IPC_SESSION_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records when a request message was made, for the session's latency statistics.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgMessage_SetRequestTime
+(
+    le_msg_MessageRef_t msgRef,
+    le_clk_Time_t       requestTime
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgMessage_GetUnixMessagePtr(msgRef)->clientServer.client.requestTime = requestTime;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets when a request message was made.
+ *
+ * @return The time recorded by msgMessage_SetRequestTime().
+ */
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t msgMessage_GetRequestTime
+(
+    le_msg_MessageRef_t msgRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return msgMessage_GetUnixMessagePtr(msgRef)->clientServer.client.requestTime;
+}
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Call the completion callback function for a given message, if it has one.
@@ -338,37 +910,53 @@ le_msg_MessageRef_t le_msg_CreateMsg
     LE_FATAL_IF(sessionRef->type != LE_MSG_SESSION_UNIX_SOCKET,
                 "Corrupted session type: %d", sessionRef->type);
 
-    // Get a reference to the Session's Protocol and ask the Protocol to allocate a Message
-    // object from its Message Pool.
-    le_msg_ProtocolRef_t protocolRef = le_msg_GetSessionProtocol(sessionRef);
-    UnixMessage_t* msgPtr = msgProto_AllocMessage(protocolRef);
+    return CreateUnixMsg(sessionRef,
+                         le_msg_GetProtocolMaxMsgSize(le_msg_GetSessionProtocol(sessionRef)),
+                         true);
+}
 
-    // Initialize the Message object's data members.
-    msgPtr->link = LE_DLS_LINK_INIT;
-    msgPtr->message.sessionRef = sessionRef;
-    le_mem_AddRef(sessionRef);  // Message object holds a reference to the Session object.
 
-    msgInterface_Type_t interfaceType = msgSession_GetInterfaceType(sessionRef);
-    switch (interfaceType)
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a message to be sent over a given session, with a payload buffer of a given size.
+ *
+ * @return  The message reference.
+ *
+ * @note
+ * - This function never returns on failure, so no need to check the return code.
+ * - If you see warnings about message pools expanding, then you may be forgetting to
+ *   release the messages you have received.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_MessageRef_t le_msg_CreateSizedMsg
+(
+    le_msg_SessionRef_t sessionRef,     ///< [in] Reference to the session.
+    size_t              payloadSize     ///< [in] Size of the payload buffer, in bytes.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(sessionRef);
+    // Local messages all have the same size.
+    if (sessionRef->type == LE_MSG_SESSION_LOCAL)
     {
-        case LE_MSG_INTERFACE_CLIENT:
-            msgPtr->clientServer.client.completionCallback = NULL;
-            msgPtr->clientServer.client.contextPtr = NULL;
-            break;
+        return msgLocal_CreateMsg(sessionRef);
+    }
 
-        case LE_MSG_INTERFACE_SERVER:
-            msgPtr->clientServer.server.responseFd = -1;
-            break;
+    LE_FATAL_IF(sessionRef->type != LE_MSG_SESSION_UNIX_SOCKET,
+                "Corrupted session type: %d", sessionRef->type);
 
-        default:
-            LE_FATAL("Unhandled interface type (%d).", interfaceType);
-    }
+    size_t maxPayloadSize = le_msg_GetProtocolMaxMsgSize(le_msg_GetSessionProtocol(sessionRef));
 
-    msgPtr->fd = -1;
-    msgPtr->txnId = 0;
-    memset(msgPtr->payload, 0, le_msg_GetProtocolMaxMsgSize(protocolRef));
+    if (payloadSize < MIN_PAYLOAD_BYTES)
+    {
+        payloadSize = MIN_PAYLOAD_BYTES;
+    }
+    if (payloadSize > maxPayloadSize)
+    {
+        payloadSize = maxPayloadSize;
+    }
 
-    return msgMessage_GetMessageRef(msgPtr);
+    return CreateUnixMsg(sessionRef, payloadSize, true);
 }
 
 
@@ -485,7 +1073,14 @@ void* le_msg_GetPayloadPtr
         case LE_MSG_SESSION_LOCAL:
             return msgLocal_GetPayloadPtr(msgRef);
         case LE_MSG_SESSION_UNIX_SOCKET:
-            return msgMessage_GetUnixMessagePtr(msgRef)->payload;
+        {
+            UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+            if (msgPtr->shmPayloadPtr != NULL)
+            {
+                return msgPtr->shmPayloadPtr;
+            }
+            return msgPtr->payload;
+        }
         default:
             LE_FATAL("Corrupted session type: %d", msgRef->sessionRef->type);
     }
@@ -511,7 +1106,7 @@ size_t le_msg_GetMaxPayloadSize
         case LE_MSG_SESSION_LOCAL:
             return msgLocal_GetMaxPayloadSize(msgRef);
         case LE_MSG_SESSION_UNIX_SOCKET:
-            return le_msg_GetProtocolMaxMsgSize(le_msg_GetSessionProtocol(msgRef->sessionRef));
+            return msgMessage_GetUnixMessagePtr(msgRef)->payloadSize;
         default:
             LE_FATAL("Corrupted session type: %d", msgRef->sessionRef->type);
     }
@@ -8,6 +8,9 @@
 #ifndef LEGATO_MESSAGING_MESSAGE_H_INCLUDE_GUARD
 #define LEGATO_MESSAGING_MESSAGE_H_INCLUDE_GUARD
 
+#include "messagingSharedMem.h"
+#include "messagingBroadcast.h"
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Represents a message.
@@ -28,6 +31,9 @@ typedef struct le_msg_UnixMessage
             le_msg_ResponseCallback_t   completionCallback; ///< Function to call when txn finishes.
                                                             ///  NULL if no response expected.
             void*                       contextPtr; ///< Opaque ptr to pass to completion callback.
+#if LE_CONFIG_IPC_SESSION_STATS
+            le_clk_Time_t               requestTime;///< When the request was made.
+#endif
         }
         client;
 
@@ -41,6 +47,14 @@ typedef struct le_msg_UnixMessage
     clientServer;
 
     int                         fd;         ///< File descriptor to send or received (-1 = no fd)
+    msgShm_RegionRef_t          shmRegionRef;///< Shared memory region holding the payload, or
+                                            ///  NULL if the payload is in the payload buffer.
+    uint32_t                    shmSlot;    ///< Slot of shmRegionRef holding the payload.
+    void*                       shmPayloadPtr;///< Payload buffer in that slot.
+    bool                        isBroadcastControl;///< true = the payload is a msgBcast_Control_t,
+                                            ///  and only that much of it is sent.
+    size_t                      payloadSize;///< Size of the payload buffer, in bytes (at most the
+                                            ///  protocol's maximum message size).
     void*                       txnId;      ///< Safe reference value used as a transaction ID.
     void*                       payload[0]; ///< Variable-length payload buffer appears at the end.
 }
@@ -73,6 +87,22 @@ le_mem_PoolRef_t msgMessage_CreatePool
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a Message object to receive a message into, using msgMessage_Receive().
+ *
+ * Unlike le_msg_CreateMsg(), this never takes a shared memory slot, because the payload
+ * location is only known when the message has been received.
+ *
+ * @return  The message reference.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_MessageRef_t msgMessage_CreateReceiveMsg
+(
+    le_msg_SessionRef_t sessionRef  ///< [IN] Reference to the session.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Send a single message over a connected socket.
@@ -90,6 +120,30 @@ le_result_t msgMessage_Send
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a batch of messages over a connected socket, in order, using as few system calls as
+ * possible.
+ *
+ * If the socket fills up part way through, the messages that were sent are counted in
+ * *sentCountPtr and the rest are left as they were, ready to be sent again later.
+ *
+ * @return
+ * - LE_OK if all the messages were sent.
+ * - LE_NO_MEMORY if the socket doesn't have enough send buffer space available right now.
+ * - LE_COMM_ERROR if the socket reported an error on the send operation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgMessage_SendBatch
+(
+    int                 socketFd,       ///< [IN] Connected socket's file descriptor.
+    le_msg_MessageRef_t msgRefs[],      ///< [IN] The Messages to be sent.
+    size_t              count,          ///< [IN] Number of messages (at most
+                                        ///       UNIXSOCKET_MAX_BATCH_LEN).
+    size_t*             sentCountPtr    ///< [OUT] Number of messages that were sent.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Receive a single message from a connected socket.
@@ -108,6 +162,31 @@ le_result_t msgMessage_Receive
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receive a batch of messages from a connected socket using a single system call.
+ *
+ * The messages that were received successfully are moved, in order, to the front of the msgRefs
+ * array and counted in *receivedCountPtr.  The rest of the Message objects (unused, or holding a
+ * message that was discarded because it was truncated or invalid) are left after them.
+ *
+ * @return
+ * - LE_OK if anything was received (possibly only messages that had to be discarded).
+ * - LE_WOULD_BLOCK if there's nothing there to receive and the socket is set non-blocking.
+ * - LE_CLOSED if the connection has closed.
+ * - LE_FAULT if an error was encountered.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgMessage_ReceiveBatch
+(
+    int                 socketFd,           ///< [IN] The socket's file descriptor.
+    le_msg_MessageRef_t msgRefs[],          ///< [IN+OUT] Message objects to receive into.
+    size_t              count,              ///< [IN] Number of Message objects (at most
+                                            ///       UNIXSOCKET_MAX_BATCH_LEN).
+    size_t*             receivedCountPtr    ///< [OUT] Number of messages received successfully.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets a pointer to the queue link inside a Message object.
@@ -180,6 +259,71 @@ void* msgMessage_GetTxnId
 );
 
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a Message object carries a file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+bool msgMessage_HasFd
+(
+    le_msg_MessageRef_t msgRef
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a broadcast control message to be sent to a client through a given session.
+ *
+ * @return  The message reference.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_MessageRef_t msgMessage_CreateBroadcastControlMsg
+(
+    le_msg_SessionRef_t         sessionRef, ///< [IN] Reference to the (server-side) session.
+    const msgBcast_Control_t*   controlPtr  ///< [IN] Control message to put in the payload.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a received Message object is a broadcast control message, whose payload is a
+ * msgBcast_Control_t.
+ */
+//--------------------------------------------------------------------------------------------------
+bool msgMessage_IsBroadcastControl
+(
+    le_msg_MessageRef_t msgRef
+);
+
+
+#if LE_CONFIG_IPC_SESSION_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records when a request message was made, for the session's latency statistics.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgMessage_SetRequestTime
+(
+    le_msg_MessageRef_t msgRef,
+    le_clk_Time_t       requestTime
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets when a request message was made.
+ *
+ * @return The time recorded by msgMessage_SetRequestTime().
+ */
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t msgMessage_GetRequestTime
+(
+    le_msg_MessageRef_t msgRef
+);
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Call the completion callback function for a given message.
@@ -51,6 +51,15 @@ static le_sls_List_t ProtocolList = LE_SLS_LIST_INIT;
 static le_mem_PoolRef_t ProtocolPoolRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which copies of the identifiers of the protocols that don't come from constant data
+ * are allocated (see le_msg_GetStaticProtocolRef()).  Uses size classes.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t IdPoolRef;
+
+
 // =======================================
 //  PRIVATE FUNCTIONS
 // =======================================
@@ -102,7 +111,9 @@ static msgProtocol_Protocol_t* FindProtocol
 static msgProtocol_Protocol_t* CreateProtocol
 (
     const char* protocolId,     ///< [in] String uniquely identifying the the protocol and version.
-    size_t largestMsgSize       ///< [in] Size (in bytes) of the largest message in the protocol.
+    size_t largestMsgSize,      ///< [in] Size (in bytes) of the largest message in the protocol.
+    bool isStaticId             ///< [in] true if protocolId never changes or goes away, so it
+                                ///       doesn't need to be copied.
 )
 //--------------------------------------------------------------------------------------------------
 {
@@ -110,9 +121,27 @@ static msgProtocol_Protocol_t* CreateProtocol
 
     protocolPtr->link = LE_SLS_LINK_INIT;
     protocolPtr->maxPayloadSize = largestMsgSize;
-    if (le_utf8_Copy(protocolPtr->id, protocolId, sizeof(protocolPtr->id), NULL) == LE_OVERFLOW)
+
+    size_t idSize = le_utf8_NumBytes(protocolId) + 1;
+    if (idSize > LIMIT_MAX_PROTOCOL_ID_BYTES)
     {
-        LE_CRIT("Protocol identifier truncated from '%s' to '%s'.", protocolId, protocolPtr->id);
+        LE_CRIT("Protocol identifier '%s' is too long (max %d bytes); truncated.",
+                protocolId,
+                LIMIT_MAX_PROTOCOL_ID_BYTES - 1);
+        idSize = LIMIT_MAX_PROTOCOL_ID_BYTES;
+        isStaticId = false;
+    }
+
+    if (isStaticId)
+    {
+        protocolPtr->id = protocolId;
+    }
+    else
+    {
+        // Protocols are never deleted, so neither is this copy.
+        char* idPtr = le_mem_ForceVarAlloc(IdPoolRef, idSize);
+        le_utf8_Copy(idPtr, protocolId, idSize, NULL);
+        protocolPtr->id = idPtr;
     }
 
     protocolPtr->messagePoolRef = msgMessage_CreatePool(protocolId, largestMsgSize);
@@ -127,6 +156,38 @@ static msgProtocol_Protocol_t* CreateProtocol
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the Protocol object for a protocol identifier, creating it if it doesn't exist yet.
+ *
+ * @return  A pointer to the object.  Never returns on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static msgProtocol_Protocol_t* GetProtocol
+(
+    const char* protocolId,     ///< [in] String uniquely identifying the the protocol and version.
+    size_t largestMsgSize,      ///< [in] Size (in bytes) of the largest message in the protocol.
+    bool isStaticId             ///< [in] true if protocolId never changes or goes away.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgProtocol_Protocol_t* protocolPtr = FindProtocol(protocolId);
+    if (protocolPtr == NULL)
+    {
+        protocolPtr = CreateProtocol(protocolId, largestMsgSize, isStaticId);
+    }
+    else if (protocolPtr->maxPayloadSize != largestMsgSize)
+    {
+        LE_FATAL("Wrong maximum message size (%zu) specified for protocol '%s' (expected %zu).",
+                 largestMsgSize,
+                 protocolId,
+                 protocolPtr->maxPayloadSize);
+    }
+
+    return protocolPtr;
+}
+
+
 // =======================================
 //  PROTECTED (INTER-MODULE) FUNCTIONS
 // =======================================
@@ -145,6 +206,9 @@ void msgProto_Init
 {
     ProtocolPoolRef = le_mem_CreatePool("Protocol", sizeof(msgProtocol_Protocol_t));
     le_mem_ExpandPool(ProtocolPoolRef, 5);  /// @todo Make this configurable.
+
+    IdPoolRef = le_mem_CreatePool("ProtocolId", LIMIT_MAX_PROTOCOL_ID_BYTES);
+    le_mem_EnableSizeClasses(IdPoolRef, 32);
 }
 
 
@@ -157,12 +221,15 @@ void msgProto_Init
 //--------------------------------------------------------------------------------------------------
 UnixMessage_t *msgProto_AllocMessage
 (
-    le_msg_ProtocolRef_t protocolRef
+    le_msg_ProtocolRef_t protocolRef,
+    size_t payloadSize          ///< [in] Size of the object's payload buffer, in bytes (at most
+                                ///       the protocol's maximum message size).
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Allocate a Message object from this Protocol's Message Pool.
-    return le_mem_ForceAlloc(protocolRef->messagePoolRef);
+    // Allocate a Message object from this Protocol's Message Pool.  Objects with smaller payload
+    // buffers come from the pool's size classes.
+    return le_mem_ForceVarAlloc(protocolRef->messagePoolRef, sizeof(UnixMessage_t) + payloadSize);
 }
 
 
@@ -184,20 +251,25 @@ le_msg_ProtocolRef_t le_msg_GetProtocolRef
 )
 //--------------------------------------------------------------------------------------------------
 {
-    msgProtocol_Protocol_t* protocolPtr = FindProtocol(protocolId);
-    if (protocolPtr == NULL)
-    {
-        protocolPtr = CreateProtocol(protocolId, largestMsgSize);
-    }
-    else if (protocolPtr->maxPayloadSize != largestMsgSize)
-    {
-        LE_FATAL("Wrong maximum message size (%zu) specified for protocol '%s' (expected %zu).",
-                 largestMsgSize,
-                 protocolId,
-                 protocolPtr->maxPayloadSize);
-    }
+    return GetProtocol(protocolId, largestMsgSize, false);
+}
 
-    return protocolPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a reference to refer to a particular version of a particular protocol, from a description
+ * of the protocol kept in constant data.  The protocol identifier isn't copied.
+ *
+ * @return  The protocol reference.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_ProtocolRef_t le_msg_GetStaticProtocolRef
+(
+    const le_msg_ProtocolDesc_t* descPtr    ///< [in] Description of the protocol.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return GetProtocol(descPtr->id, descPtr->maxMsgSize, true);
 }
 
 
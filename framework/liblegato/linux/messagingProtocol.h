@@ -19,7 +19,8 @@
 typedef struct le_msg_Protocol
 {
     le_sls_Link_t link;                     ///< Used to link this into the Protocol List.
-    char id[LIMIT_MAX_PROTOCOL_ID_BYTES];   ///< Unique identifier for the protocol.
+    const char* id;                         ///< Unique identifier for the protocol (either
+                                            ///  the caller's constant, or a copy of it).
     size_t maxPayloadSize;                  ///< Max payload size (in bytes) in this protocol.
     le_mem_PoolRef_t messagePoolRef;        ///< Pool of Message objects.
 }
@@ -47,7 +48,9 @@ void msgProto_Init
 //--------------------------------------------------------------------------------------------------
 UnixMessage_t *msgProto_AllocMessage
 (
-    le_msg_ProtocolRef_t protocolRef
+    le_msg_ProtocolRef_t protocolRef,
+    size_t payloadSize          ///< [in] Size of the object's payload buffer, in bytes (at most
+                                ///       the protocol's maximum message size).
 );
 
 
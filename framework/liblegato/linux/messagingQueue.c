@@ -0,0 +1,911 @@
+/** @file messagingQueue.c
+ *
+ * @ref c_messaging implementation's "Durable Queue" module implementation.
+ *
+ * See @ref messaging.c for an overview of the @ref c_messaging implementation.
+ *
+ * When a session is opened on a service that has a durable queue, the server opens the ring file
+ * of the client's user (creating it if needed) and sends it, along with an eventfd, to the client
+ * in its session open response.  Both sides map the file:
+ *
+ * @verbatim
+ *
+ *      +-------------------------------+----------------------------------------------------+
+ *      | QueueHeader (one page)        | Record | Record | ...                              |
+ *      +-------------------------------+----------------------------------------------------+
+ *
+ * @endverbatim
+ *
+ * Each record is a length followed by a message payload, with its trailing zero bytes left out
+ * (payloads start out zeroed on both sides, so they aren't needed to rebuild it).  A record never
+ * wraps around the end of the ring; if it doesn't fit there, a wrap marker is written and the
+ * record goes at the start.  The write and read positions only ever grow; their difference is the
+ * number of bytes in use.
+ *
+ * Clients append under a robust, process-shared mutex kept in the header, and publish a record
+ * by moving the write position past it.  A client that dies while appending leaves the write
+ * position where it was, so the partial record is never seen and is overwritten by the next
+ * append.  The server is the only reader: it delivers each record to the service's receive
+ * handler, through an open session of the same user, and only then moves the read position past
+ * it, so records that were not handled when the server went down are delivered when it comes
+ * back.  A client only signals the eventfd when its record is the first one after a read position
+ * the server has reached, so a server that is busy draining the ring isn't woken for each record.
+ *
+ * @warning Clients can write to their ring at any time, so the server validates each record's
+ * length before using it.  A ring is only shared by processes of the same user, so a client can
+ * only garble its own user's messages.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "messagingQueue.h"
+#include "messagingSession.h"
+#include "messagingMessage.h"
+#include "fileDescriptor.h"
+#include "limit.h"
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+
+// =======================================
+//  PRIVATE DATA
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Directory holding the ring files.
+ */
+//--------------------------------------------------------------------------------------------------
+#define QUEUE_DIR           LE_CONFIG_RUNTIME_DIR "/msgQueues"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value of the magic field in a ring's header.
+ */
+//--------------------------------------------------------------------------------------------------
+#define QUEUE_MAGIC         0x51444d4c  // "LMDQ"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the header at the start of a ring file.  The records start right after it.
+ */
+//--------------------------------------------------------------------------------------------------
+#define QUEUE_HEADER_SIZE   4096
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records are multiples of this size.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RECORD_ALIGNMENT    8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Length of a wrap marker record: the rest of the ring is unused, and the next record is at the
+ * start.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RECORD_WRAP         UINT32_MAX
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Most records the server delivers before going back to its event loop.  If there are more, it
+ * signals itself to come back for them.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_RECORDS_PER_WAKEUP  32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of a ring file.  The first fields are written by the server when it
+ * creates the file, and never changed after that.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t        magic;          ///< Always QUEUE_MAGIC.
+    uint32_t        payloadSize;    ///< Maximum payload size of the service's protocol, in bytes.
+    uint64_t        capacity;       ///< Size of the record area, in bytes.
+    pthread_mutex_t mutex;          ///< Serializes appends (robust and process-shared).
+    uint64_t        writePos __attribute__((aligned(64)));  ///< Bytes ever appended.
+    uint64_t        readPos __attribute__((aligned(64)));   ///< Bytes ever consumed.
+}
+QueueHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of each record.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t length;        ///< Length of the payload, in bytes, or RECORD_WRAP.
+    uint32_t reserved;      ///< Keeps the payload 8-byte aligned.
+    uint8_t  payload[];     ///< Payload.
+}
+RecordHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A process's view of a mapped ring.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgQueue_Queue
+{
+    le_dls_Link_t       link;           ///< Link in the service's list of queues (server side).
+    uint8_t*            basePtr;        ///< Start of the mapping.
+    size_t              mapSize;        ///< Size of the mapping, in bytes.
+    uint64_t            capacity;       ///< Size of the record area (copied from the header).
+    uint32_t            payloadSize;    ///< Maximum payload size (copied from the header).
+    int                 eventFd;        ///< Wakes the server up when records are appended.
+    msgInterface_UnixService_t* servicePtr; ///< Service the queue belongs to (server side), or
+                                            ///  NULL (client side).
+    uid_t               uid;            ///< User whose sessions use the queue (server side).
+    le_fdMonitor_Ref_t  fdMonitorRef;   ///< Monitor of eventFd (server side).
+}
+Queue_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which Queue objects are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t QueuePoolRef;
+
+
+// =======================================
+//  PRIVATE FUNCTIONS
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a pointer to a ring's header.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline QueueHeader_t* GetHeader
+(
+    Queue_t*    queuePtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return (QueueHeader_t*)queuePtr->basePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a pointer to the record at a given position of a ring.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline RecordHeader_t* GetRecord
+(
+    Queue_t*    queuePtr,
+    uint64_t    pos
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return (RecordHeader_t*)(queuePtr->basePtr + QUEUE_HEADER_SIZE + (pos % queuePtr->capacity));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the size of a record for a given payload length.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint64_t RecordSize
+(
+    size_t length
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return ((sizeof(RecordHeader_t) + length + RECORD_ALIGNMENT - 1) / RECORD_ALIGNMENT) *
+           RECORD_ALIGNMENT;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor for Queue objects.  Unmaps the ring and, on the server side, stops monitoring it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueDestructor
+(
+    void* objPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Queue_t* queuePtr = objPtr;
+
+    if (queuePtr->servicePtr != NULL)
+    {
+        le_dls_Remove(&queuePtr->servicePtr->queueList, &queuePtr->link);
+        le_fdMonitor_Delete(queuePtr->fdMonitorRef);
+    }
+
+    fd_Close(queuePtr->eventFd);
+
+    if (munmap(queuePtr->basePtr, queuePtr->mapSize) != 0)
+    {
+        LE_ERROR("munmap() failed (%m).");
+    }
+}
+
+
+#if LE_CONFIG_MSG_DURABLE_QUEUE
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Signal a queue's eventfd.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Signal
+(
+    Queue_t*    queuePtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint64_t one = 1;
+
+    // Only fails if the counter is about to overflow, in which case the server has been signalled
+    // already.
+    if (write(queuePtr->eventFd, &one, sizeof(one)) < 0)
+    {
+        LE_DEBUG("Can't signal durable queue (%m).");
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a Queue object for a mapping.
+ */
+//--------------------------------------------------------------------------------------------------
+static Queue_t* NewQueue
+(
+    void*   basePtr,
+    size_t  mapSize,
+    int     eventFd
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const QueueHeader_t* headerPtr = basePtr;
+    Queue_t* queuePtr = le_mem_ForceAlloc(QueuePoolRef);
+
+    queuePtr->link = LE_DLS_LINK_INIT;
+    queuePtr->basePtr = basePtr;
+    queuePtr->mapSize = mapSize;
+    queuePtr->capacity = headerPtr->capacity;
+    queuePtr->payloadSize = headerPtr->payloadSize;
+    queuePtr->eventFd = eventFd;
+    queuePtr->servicePtr = NULL;
+    queuePtr->uid = (uid_t)-1;
+    queuePtr->fdMonitorRef = NULL;
+
+    return queuePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that a ring file's header can be used for a protocol.
+ *
+ * @return true if it can.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsHeaderValid
+(
+    const QueueHeader_t*    headerPtr,
+    size_t                  mapSize,
+    size_t                  payloadSize
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return ((headerPtr->magic == QUEUE_MAGIC) &&
+            (headerPtr->payloadSize == payloadSize) &&
+            (headerPtr->capacity % RECORD_ALIGNMENT == 0) &&
+            (headerPtr->capacity >= 2 * RecordSize(payloadSize)) &&
+            (headerPtr->capacity == mapSize - QUEUE_HEADER_SIZE));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lock a ring's mutex.  If the last client holding it died, its record was never published, so
+ * the ring is still consistent.
+ *
+ * @return true if the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool LockRing
+(
+    QueueHeader_t*  headerPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int result = pthread_mutex_lock(&headerPtr->mutex);
+
+    if (result == EOWNERDEAD)
+    {
+        result = pthread_mutex_consistent(&headerPtr->mutex);
+    }
+
+    if (result != 0)
+    {
+        LE_ERROR("Can't lock durable queue (%s).", strerror(result));
+        return false;
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the header of a new ring file.
+ *
+ * @return true if successful.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool InitHeader
+(
+    QueueHeader_t*  headerPtr,
+    uint64_t        capacity,
+    size_t          payloadSize
+)
+//--------------------------------------------------------------------------------------------------
+{
+    pthread_mutexattr_t attr;
+    bool ok;
+
+    memset(headerPtr, 0, sizeof(*headerPtr));
+
+    ok = ((pthread_mutexattr_init(&attr) == 0) &&
+          (pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED) == 0) &&
+          (pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST) == 0) &&
+          (pthread_mutex_init(&headerPtr->mutex, &attr) == 0));
+    pthread_mutexattr_destroy(&attr);
+
+    headerPtr->payloadSize = payloadSize;
+    headerPtr->capacity = capacity;
+
+    // Written last, so that a file left half initialized is recreated.
+    LE_ATOMIC_STORE(&headerPtr->magic, QUEUE_MAGIC, LE_ATOMIC_ORDER_RELEASE);
+
+    return ok;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open a service's ring file for a user, creating it (or recreating it, if it doesn't match the
+ * protocol) as needed, and map it.
+ *
+ * @return The start of the mapping, or NULL on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* MapRingFile
+(
+    msgInterface_UnixService_t* servicePtr, ///< [IN] Service.
+    uid_t                       uid,        ///< [IN] User ID of the client.
+    int*                        fdPtr,      ///< [OUT] Ring file.
+    size_t*                     mapSizePtr  ///< [OUT] Size of the mapping.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    char path[LIMIT_MAX_PATH_BYTES];
+    size_t payloadSize = le_msg_GetProtocolMaxMsgSize(servicePtr->interface.id.protocolRef);
+    uint64_t capacity = (servicePtr->queueSize / RECORD_ALIGNMENT) * RECORD_ALIGNMENT;
+    struct stat st;
+    int attempt;
+
+    if (capacity < 2 * RecordSize(payloadSize))
+    {
+        capacity = 2 * RecordSize(payloadSize);
+    }
+
+    if (snprintf(path, sizeof(path), QUEUE_DIR "/%s.%u", servicePtr->interface.id.name,
+                 (unsigned int)uid) >= (int)sizeof(path))
+    {
+        LE_ERROR("Durable queue path too long for service '%s'.", servicePtr->interface.id.name);
+        return NULL;
+    }
+
+    if (le_dir_MakePath(QUEUE_DIR, S_IRWXU) != LE_OK)
+    {
+        LE_ERROR("Can't create directory '%s'.", QUEUE_DIR);
+        return NULL;
+    }
+
+    // Second attempt is after removing a file that doesn't match the protocol.
+    for (attempt = 0; attempt < 2; attempt++)
+    {
+        int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (fd < 0)
+        {
+            LE_ERROR("Can't open durable queue '%s' (%m).", path);
+            return NULL;
+        }
+
+        if (fstat(fd, &st) != 0)
+        {
+            LE_ERROR("Can't stat durable queue '%s' (%m).", path);
+            fd_Close(fd);
+            return NULL;
+        }
+
+        bool isNew = (st.st_size == 0);
+        size_t mapSize = (isNew ? QUEUE_HEADER_SIZE + capacity : (size_t)st.st_size);
+
+        if (isNew && (ftruncate(fd, mapSize) != 0))
+        {
+            LE_ERROR("Can't size durable queue '%s' (%m).", path);
+            fd_Close(fd);
+            unlink(path);
+            return NULL;
+        }
+
+        void* basePtr = (mapSize > QUEUE_HEADER_SIZE ?
+                         mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) :
+                         MAP_FAILED);
+        if ((basePtr != MAP_FAILED) && isNew && !InitHeader(basePtr, capacity, payloadSize))
+        {
+            munmap(basePtr, mapSize);
+            basePtr = MAP_FAILED;
+        }
+
+        if ((basePtr != MAP_FAILED) && IsHeaderValid(basePtr, mapSize, payloadSize))
+        {
+            if (!isNew)
+            {
+                QueueHeader_t* headerPtr = basePtr;
+
+                LE_INFO("Reopened durable queue '%s' with %" PRIu64 " bytes waiting.",
+                        path,
+                        LE_ATOMIC_LOAD(&headerPtr->writePos, LE_ATOMIC_ORDER_ACQUIRE) -
+                        LE_ATOMIC_LOAD(&headerPtr->readPos, LE_ATOMIC_ORDER_RELAXED));
+            }
+
+            *fdPtr = fd;
+            *mapSizePtr = mapSize;
+            return basePtr;
+        }
+
+        // Clients still holding the old file keep appending to it, but nobody will read it.
+        LE_WARN("Durable queue '%s' doesn't match protocol; recreating it.", path);
+        if (basePtr != MAP_FAILED)
+        {
+            munmap(basePtr, mapSize);
+        }
+        fd_Close(fd);
+        unlink(path);
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find an open session, through which records of a server-side queue can be delivered.
+ *
+ * @return The session, or NULL if no session from the queue's user is open.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_msg_SessionRef_t FindSession
+(
+    Queue_t*    queuePtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_dls_List_t* listPtr = &queuePtr->servicePtr->interface.sessionList;
+    le_dls_Link_t* linkPtr = le_dls_Peek(listPtr);
+
+    while (linkPtr != NULL)
+    {
+        le_msg_SessionRef_t sessionRef = msgSession_GetSessionContainingLink(linkPtr);
+
+        if ((msgSession_GetDurableQueue(sessionRef) == queuePtr) && msgSession_IsOpen(sessionRef))
+        {
+            return sessionRef;
+        }
+
+        linkPtr = le_dls_PeekNext(listPtr, linkPtr);
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deliver the records waiting in a server-side queue to the service's receive handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Drain
+(
+    Queue_t*    queuePtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    QueueHeader_t* headerPtr = GetHeader(queuePtr);
+    uint64_t readPos = LE_ATOMIC_LOAD(&headerPtr->readPos, LE_ATOMIC_ORDER_RELAXED);
+    uint64_t writePos = LE_ATOMIC_LOAD(&headerPtr->writePos, LE_ATOMIC_ORDER_ACQUIRE);
+    size_t count = 0;
+
+    // A handler may close the last session using the queue.
+    le_mem_AddRef(queuePtr);
+
+    while (readPos != writePos)
+    {
+        if ((writePos - readPos > queuePtr->capacity) || (readPos % RECORD_ALIGNMENT != 0))
+        {
+            LE_ERROR("Durable queue of service '%s' is corrupted; %" PRIu64 " bytes dropped.",
+                     queuePtr->servicePtr->interface.id.name, writePos - readPos);
+            readPos = writePos;
+            LE_ATOMIC_STORE(&headerPtr->readPos, readPos, LE_ATOMIC_ORDER_RELEASE);
+            break;
+        }
+
+        if (count == MAX_RECORDS_PER_WAKEUP)
+        {
+            // Let other events in; come back for the rest.
+            Signal(queuePtr);
+            break;
+        }
+
+        uint64_t tail = queuePtr->capacity - (readPos % queuePtr->capacity);
+        RecordHeader_t* recordPtr = GetRecord(queuePtr, readPos);
+        uint32_t length = LE_ATOMIC_LOAD(&recordPtr->length, LE_ATOMIC_ORDER_RELAXED);
+
+        if (length == RECORD_WRAP)
+        {
+            readPos += tail;
+        }
+        else if ((length > queuePtr->payloadSize) || (RecordSize(length) > tail))
+        {
+            LE_ERROR("Bad record in durable queue of service '%s'; %" PRIu64 " bytes dropped.",
+                     queuePtr->servicePtr->interface.id.name, writePos - readPos);
+            readPos = writePos;
+        }
+        else
+        {
+            le_msg_SessionRef_t sessionRef = FindSession(queuePtr);
+            if (sessionRef == NULL)
+            {
+                // Left for the next session from this user.
+                break;
+            }
+
+            le_msg_MessageRef_t msgRef = msgMessage_CreateReceiveMsg(sessionRef);
+            memcpy(le_msg_GetPayloadPtr(msgRef), recordPtr->payload, length);
+
+            msgInterface_ProcessMessageFromClient(queuePtr->servicePtr, msgRef);
+
+            readPos += RecordSize(length);
+            count++;
+        }
+
+        // The record has been handled; let clients reuse its space.  The fence pairs with the one
+        // in msgQueue_Append(): either this sees the client's new write position, or the client
+        // sees that the ring was drained and signals the eventfd.
+        LE_ATOMIC_STORE(&headerPtr->readPos, readPos, LE_ATOMIC_ORDER_RELEASE);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        writePos = LE_ATOMIC_LOAD(&headerPtr->writePos, LE_ATOMIC_ORDER_ACQUIRE);
+    }
+
+    le_mem_Release(queuePtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called in the server thread when a server-side queue's eventfd is signalled.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EventFdHandler
+(
+    int     fd,         ///< [IN] Queue's eventfd.
+    short   events      ///< [IN] Events that occurred.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint64_t count;
+
+    LE_UNUSED(events);
+
+    if (read(fd, &count, sizeof(count)) < 0)
+    {
+        LE_DEBUG("Can't read durable queue event (%m).");
+    }
+
+    Drain(le_fdMonitor_GetContextPtr());
+}
+
+#endif /* end LE_CONFIG_MSG_DURABLE_QUEUE */
+
+
+// =======================================
+//  PROTECTED (INTER-MODULE) FUNCTIONS
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes this module.  This must be called only once at start-up, before any other functions
+ * in this module are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgQueue_Init
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    QueuePoolRef = le_mem_CreatePool("MsgQueue", sizeof(Queue_t));
+    le_mem_SetDestructor(QueuePoolRef, QueueDestructor);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the durable queue of a service for a client user, opening (or creating) its ring file if
+ * no session from that user is using it yet.  This is done by the server side, in the service's
+ * server thread.
+ *
+ * Messages already in the ring are delivered once the caller's session is open.
+ *
+ * @return A new reference to the queue, or NULL if the service has no durable queue or the ring
+ *         file could not be opened (the session then works without one).
+ *
+ * @note The caller is responsible for sending *ringFdPtr and *eventFdPtr to the client and then
+ *       closing them.
+ */
+//--------------------------------------------------------------------------------------------------
+msgQueue_QueueRef_t msgQueue_Open
+(
+    msgInterface_UnixService_t* servicePtr, ///< [IN] Service the session is for.
+    uid_t                       uid,        ///< [IN] User ID of the client.
+    int*                        ringFdPtr,  ///< [OUT] Ring file, to be sent to the client.
+    int*                        eventFdPtr  ///< [OUT] Event used to wake the server up, to be sent
+                                            ///        to the client.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_MSG_DURABLE_QUEUE
+    Queue_t* queuePtr = NULL;
+    le_dls_Link_t* linkPtr;
+    int ringFd;
+
+    if (servicePtr->queueSize == 0)
+    {
+        return NULL;
+    }
+
+    // Sessions from the same user share the queue.
+    for (linkPtr = le_dls_Peek(&servicePtr->queueList);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(&servicePtr->queueList, linkPtr))
+    {
+        Queue_t* candidatePtr = CONTAINER_OF(linkPtr, Queue_t, link);
+
+        if (candidatePtr->uid == uid)
+        {
+            queuePtr = candidatePtr;
+            break;
+        }
+    }
+
+    if (queuePtr != NULL)
+    {
+        char path[LIMIT_MAX_PATH_BYTES];
+
+        snprintf(path, sizeof(path), QUEUE_DIR "/%s.%u", servicePtr->interface.id.name,
+                 (unsigned int)uid);
+
+        ringFd = open(path, O_RDWR | O_CLOEXEC);
+        if (ringFd < 0)
+        {
+            LE_ERROR("Can't open durable queue '%s' (%m).", path);
+            return NULL;
+        }
+
+        le_mem_AddRef(queuePtr);
+    }
+    else
+    {
+        size_t mapSize;
+        void* basePtr = MapRingFile(servicePtr, uid, &ringFd, &mapSize);
+        if (basePtr == NULL)
+        {
+            return NULL;
+        }
+
+        int eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (eventFd < 0)
+        {
+            LE_ERROR("eventfd() failed (%m).");
+            munmap(basePtr, mapSize);
+            fd_Close(ringFd);
+            return NULL;
+        }
+
+        queuePtr = NewQueue(basePtr, mapSize, eventFd);
+        queuePtr->servicePtr = servicePtr;
+        queuePtr->uid = uid;
+        queuePtr->fdMonitorRef = le_fdMonitor_Create(servicePtr->interface.id.name,
+                                                     eventFd,
+                                                     EventFdHandler,
+                                                     POLLIN);
+        le_fdMonitor_SetContextPtr(queuePtr->fdMonitorRef, queuePtr);
+
+        le_dls_Queue(&servicePtr->queueList, &queuePtr->link);
+    }
+
+    *eventFdPtr = fcntl(queuePtr->eventFd, F_DUPFD_CLOEXEC, 0);
+    if (*eventFdPtr < 0)
+    {
+        LE_ERROR("Can't duplicate durable queue event (%m).");
+        fd_Close(ringFd);
+        le_mem_Release(queuePtr);
+        return NULL;
+    }
+    *ringFdPtr = ringFd;
+
+    // Deliver whatever is already waiting once the session is open.
+    Signal(queuePtr);
+
+    return queuePtr;
+#else
+    LE_UNUSED(servicePtr);
+    LE_UNUSED(uid);
+    LE_UNUSED(ringFdPtr);
+    LE_UNUSED(eventFdPtr);
+    return NULL;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps a durable queue received from the server.  This is done by the client side.
+ *
+ * @return A reference to the queue, or NULL if it could not be mapped or doesn't match the
+ *         protocol (the session then sends all its messages over the socket).
+ *
+ * @note Always closes ringFd and eventFd.
+ */
+//--------------------------------------------------------------------------------------------------
+msgQueue_QueueRef_t msgQueue_Attach
+(
+    int     ringFd,         ///< [IN] Ring file received from the server.
+    int     eventFd,        ///< [IN] Server's wake-up event received from the server.
+    size_t  payloadSize     ///< [IN] Maximum payload size of the session's protocol, in bytes.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Queue_t* queuePtr = NULL;
+
+#if LE_CONFIG_MSG_DURABLE_QUEUE
+    struct stat st;
+
+    if ((fstat(ringFd, &st) != 0) || (st.st_size <= QUEUE_HEADER_SIZE))
+    {
+        LE_WARN("Bad durable queue.  Session will not use it.");
+    }
+    else
+    {
+        size_t mapSize = st.st_size;
+        void* basePtr = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, ringFd, 0);
+
+        if (basePtr == MAP_FAILED)
+        {
+            LE_WARN("mmap() failed (%m).  Session will not use durable queue.");
+        }
+        else if (!IsHeaderValid(basePtr, mapSize, payloadSize))
+        {
+            LE_WARN("Durable queue doesn't match protocol.  Session will not use it.");
+            munmap(basePtr, mapSize);
+        }
+        else
+        {
+            queuePtr = NewQueue(basePtr, mapSize, eventFd);
+            eventFd = -1;
+        }
+    }
+#else
+    LE_UNUSED(payloadSize);
+#endif
+
+    fd_Close(ringFd);
+    if (eventFd >= 0)
+    {
+        fd_Close(eventFd);
+    }
+
+    return queuePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Appends a message's payload to a durable queue.  This is done by the client side.
+ *
+ * @return
+ *      - LE_OK if the payload was appended.
+ *      - LE_NO_MEMORY if the ring is full.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgQueue_Append
+(
+    msgQueue_QueueRef_t queueRef,   ///< [IN] Queue to append to.
+    const void*         payloadPtr, ///< [IN] Payload.
+    size_t              payloadSize ///< [IN] Size of the payload, in bytes.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_MSG_DURABLE_QUEUE
+    QueueHeader_t* headerPtr = GetHeader(queueRef);
+    const uint8_t* bytePtr = payloadPtr;
+
+    // The server starts from a zeroed payload, so trailing zeroes needn't be stored.
+    if (payloadSize > queueRef->payloadSize)
+    {
+        payloadSize = queueRef->payloadSize;
+    }
+    while ((payloadSize > 0) && (bytePtr[payloadSize - 1] == 0))
+    {
+        payloadSize--;
+    }
+
+    uint64_t size = RecordSize(payloadSize);
+
+    if (!LockRing(headerPtr))
+    {
+        return LE_FAULT;
+    }
+
+    uint64_t writePos = LE_ATOMIC_LOAD(&headerPtr->writePos, LE_ATOMIC_ORDER_RELAXED);
+    uint64_t readPos = LE_ATOMIC_LOAD(&headerPtr->readPos, LE_ATOMIC_ORDER_ACQUIRE);
+    uint64_t tail = queueRef->capacity - (writePos % queueRef->capacity);
+    uint64_t needed = (size > tail ? tail + size : size);
+
+    if (writePos - readPos + needed > queueRef->capacity)
+    {
+        pthread_mutex_unlock(&headerPtr->mutex);
+        return LE_NO_MEMORY;
+    }
+
+    uint64_t recordPos = writePos;
+    if (size > tail)
+    {
+        GetRecord(queueRef, writePos)->length = RECORD_WRAP;
+        recordPos += tail;
+    }
+
+    RecordHeader_t* recordPtr = GetRecord(queueRef, recordPos);
+    recordPtr->length = payloadSize;
+    recordPtr->reserved = 0;
+    memcpy(recordPtr->payload, payloadPtr, payloadSize);
+
+    // Publish the record, then check whether the server had already drained the ring (see
+    // Drain()).
+    LE_ATOMIC_STORE(&headerPtr->writePos, writePos + needed, LE_ATOMIC_ORDER_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    readPos = LE_ATOMIC_LOAD(&headerPtr->readPos, LE_ATOMIC_ORDER_ACQUIRE);
+
+    pthread_mutex_unlock(&headerPtr->mutex);
+
+    if (readPos == writePos)
+    {
+        Signal(queueRef);
+    }
+
+    return LE_OK;
+#else
+    LE_UNUSED(queueRef);
+    LE_UNUSED(payloadPtr);
+    LE_UNUSED(payloadSize);
+    return LE_FAULT;
+#endif
+}
@@ -0,0 +1,96 @@
+/** @file messagingQueue.h
+ *
+ * @ref c_messaging implementation's "Durable Queue" module's inter-module interface definitions.
+ *
+ * A service can be given a durable queue (see le_msg_SetServiceDurableQueue()).  Each client user
+ * of the service then gets a ring file, kept by the server and mapped by both sides, along with
+ * its session open response.  Messages that the client sends without expecting a response are
+ * appended to the ring instead of being sent over the session socket, and the server consumes
+ * them at its own pace.  The ring outlives the server process, so messages in it are delivered
+ * when the server comes back and the client's user opens a session again.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_MESSAGING_QUEUE_H_INCLUDE_GUARD
+#define LEGATO_MESSAGING_QUEUE_H_INCLUDE_GUARD
+
+#include "messagingInterface.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a durable queue.  Queues are reference counted memory pool objects; use
+ * le_mem_AddRef() and le_mem_Release() to hold and release them.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgQueue_Queue* msgQueue_QueueRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes this module.  This must be called only once at start-up, before any other functions
+ * in this module are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgQueue_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the durable queue of a service for a client user, opening (or creating) its ring file if
+ * no session from that user is using it yet.  This is done by the server side, in the service's
+ * server thread.
+ *
+ * Messages already in the ring are delivered once the caller's session is open.
+ *
+ * @return A new reference to the queue, or NULL if the service has no durable queue or the ring
+ *         file could not be opened (the session then works without one).
+ *
+ * @note The caller is responsible for sending *ringFdPtr and *eventFdPtr to the client and then
+ *       closing them.
+ */
+//--------------------------------------------------------------------------------------------------
+msgQueue_QueueRef_t msgQueue_Open
+(
+    msgInterface_UnixService_t* servicePtr, ///< [IN] Service the session is for.
+    uid_t                       uid,        ///< [IN] User ID of the client.
+    int*                        ringFdPtr,  ///< [OUT] Ring file, to be sent to the client.
+    int*                        eventFdPtr  ///< [OUT] Event used to wake the server up, to be sent
+                                            ///        to the client.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps a durable queue received from the server.  This is done by the client side.
+ *
+ * @return A reference to the queue, or NULL if it could not be mapped or doesn't match the
+ *         protocol (the session then sends all its messages over the socket).
+ *
+ * @note Always closes ringFd and eventFd.
+ */
+//--------------------------------------------------------------------------------------------------
+msgQueue_QueueRef_t msgQueue_Attach
+(
+    int     ringFd,         ///< [IN] Ring file received from the server.
+    int     eventFd,        ///< [IN] Server's wake-up event received from the server.
+    size_t  payloadSize     ///< [IN] Maximum payload size of the session's protocol, in bytes.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Appends a message's payload to a durable queue.  This is done by the client side.
+ *
+ * @return
+ *      - LE_OK if the payload was appended.
+ *      - LE_NO_MEMORY if the ring is full.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t msgQueue_Append
+(
+    msgQueue_QueueRef_t queueRef,   ///< [IN] Queue to append to.
+    const void*         payloadPtr, ///< [IN] Payload.
+    size_t              payloadSize ///< [IN] Size of the payload, in bytes.
+);
+
+#endif // LEGATO_MESSAGING_QUEUE_H_INCLUDE_GUARD
@@ -10,6 +10,7 @@
  */
 
 #include "legato.h"
+#include "fa/traceMarker.h"
 #include "unixSocket.h"
 #include "serviceDirectory/serviceDirectoryProtocol.h"
 #include "messagingInterface.h"
@@ -19,6 +20,8 @@
 #include "messagingLocal.h"
 #include "fileDescriptor.h"
 
+#include <sys/eventfd.h>
+
 
 // =======================================
 //  PRIVATE DATA
@@ -31,6 +34,37 @@
 #define MAX_EXPECTED_TXNS 32
 
 
+//--------------------------------------------------------------------------------------------------
+/// The most messages sent or received on a session socket in a single system call.
+//--------------------------------------------------------------------------------------------------
+#define BATCH_DEPTH LE_CONFIG_MSG_BATCH_DEPTH
+
+static_assert((BATCH_DEPTH >= 1) && (BATCH_DEPTH <= UNIXSOCKET_MAX_BATCH_LEN),
+              "LE_CONFIG_MSG_BATCH_DEPTH is out of range");
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Session open response ("Hello" message) sent by a server that hands the client more than a
+ * shared memory region.  Otherwise the response is a plain le_result_t, possibly carrying the fd
+ * of a shared memory region, which is also what the Service Directory sends to reject a client.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_result_t result;     ///< LE_OK.
+    uint32_t    fdFlags;    ///< Which file descriptors come with the message (HELLO_FD_xxx).  They
+                            ///  are in the same order as the flags.
+}
+HelloMsg_t;
+
+#define HELLO_FD_SHM        0x1     ///< Shared memory region for the session's payloads.
+#define HELLO_FD_RESUME     0x2     ///< Connection to a Resume Endpoint of the service.
+#define HELLO_FD_QUEUE      0x4     ///< Durable queue's ring file, followed by its eventfd.
+#define HELLO_FD_BCAST      0x8     ///< Broadcast channel's memfd, followed by the session's
+                                    ///  eventfd.
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Mutex used to protect data structures in this module from multi-threaded race conditions.
@@ -63,6 +97,14 @@ static le_log_TraceRef_t TraceRef;
 static le_mem_PoolRef_t SessionPoolRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which the client-side state of Session objects is allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ClientStatePoolRef;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Transaction Map.  This is a Safe Reference Map used to generate and match up
@@ -91,6 +133,8 @@ static msgSession_UnixSession_t *msgSession_GetUnixSessionPtr(le_msg_SessionRef_
 static le_msg_SessionRef_t msgSession_GetSessionRef(msgSession_UnixSession_t *unixSessionPtr);
 
 static void AttemptOpen(msgSession_UnixSession_t* sessionPtr);
+static void SendFromTransmitQueue(msgSession_UnixSession_t* sessionPtr);
+static void DeliverBroadcast(void* contextPtr, le_msg_MessageRef_t msgRef);
 
 
 //--------------------------------------------------------------------------------------------------
@@ -111,6 +155,13 @@ static void PushTransmitQueue
 
     LOCK
     le_dls_Queue(&sessionPtr->transmitQueue, linkPtr);
+#if LE_CONFIG_IPC_SESSION_STATS
+    sessionPtr->stats.transmitQueueLen++;
+    if (sessionPtr->stats.transmitQueueLen > sessionPtr->stats.transmitQueueMax)
+    {
+        sessionPtr->stats.transmitQueueMax = sessionPtr->stats.transmitQueueLen;
+    }
+#endif
     UNLOCK
 }
 
@@ -135,6 +186,12 @@ static le_msg_MessageRef_t PopTransmitQueue
 
     LOCK
     linkPtr = le_dls_Pop(&sessionPtr->transmitQueue);
+#if LE_CONFIG_IPC_SESSION_STATS
+    if (linkPtr != NULL)
+    {
+        sessionPtr->stats.transmitQueueLen--;
+    }
+#endif
     UNLOCK
 
     if (linkPtr != NULL)
@@ -146,6 +203,44 @@ static le_msg_MessageRef_t PopTransmitQueue
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pops up to a given number of messages off of the Transmit Queue.
+ *
+ * @return The number of messages popped (0 if the queue is empty).
+ *
+ * @note    This is used on both the client side and the server side.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t PopTransmitQueueBatch
+(
+    msgSession_UnixSession_t*   sessionPtr,
+    le_msg_MessageRef_t         msgRefs[],  ///< [OUT] The messages popped, oldest first.
+    size_t                      maxCount    ///< [IN] Most messages to pop.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    size_t count = 0;
+
+    LOCK
+    while (count < maxCount)
+    {
+        le_dls_Link_t* linkPtr = le_dls_Pop(&sessionPtr->transmitQueue);
+        if (linkPtr == NULL)
+        {
+            break;
+        }
+        msgRefs[count++] = msgMessage_GetMessageContainingLink(linkPtr);
+    }
+#if LE_CONFIG_IPC_SESSION_STATS
+    sessionPtr->stats.transmitQueueLen -= count;
+#endif
+    UNLOCK
+
+    return count;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Puts a message back onto the head of the Transmit Queue.
@@ -164,6 +259,9 @@ static void UnPopTransmitQueue
 
     LOCK
     le_dls_Stack(&sessionPtr->transmitQueue, linkPtr);
+#if LE_CONFIG_IPC_SESSION_STATS
+    sessionPtr->stats.transmitQueueLen++;
+#endif
     UNLOCK
 }
 
@@ -211,6 +309,35 @@ static le_msg_MessageRef_t PopReceiveQueue
 }
 
 
+#if LE_CONFIG_IPC_SESSION_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a request-response transaction to a session's latency histogram.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RecordLatency
+(
+    msgSession_UnixSession_t*   sessionPtr,
+    le_msg_MessageRef_t         requestMsgRef   ///< [IN] The request of the transaction.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(),
+                                       msgMessage_GetRequestTime(requestMsgRef));
+    size_t bucket = 0;
+
+    // Bucket 0 goes up to 16us, so count in units of 4us.
+    uint64_t elapsedUnits = ((uint64_t)elapsed.sec * 1000000 + elapsed.usec) >> 2;
+    while ((elapsedUnits >= 4) && (bucket < MSGSESSION_LATENCY_BUCKETS - 1))
+    {
+        elapsedUnits >>= 2;
+        bucket++;
+    }
+    sessionPtr->stats.latencyHistogram[bucket]++;
+}
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates a transaction ID for a given message and stores it inside the Message object.
@@ -417,6 +544,76 @@ static void PurgeReceiveQueue
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Removes all request messages held back by the request window, calls their completion callbacks
+ * (indicating transaction failure for each) and deletes them.
+ *
+ * @note    This is used only on the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PurgePendingQueue
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_dls_Link_t* linkPtr;
+
+    if (sessionPtr->clientPtr == NULL)
+    {
+        return;
+    }
+
+    while (NULL != (linkPtr = le_dls_Pop(&sessionPtr->clientPtr->pendingQueue)))
+    {
+        le_msg_MessageRef_t msgRef = msgMessage_GetMessageContainingLink(linkPtr);
+
+        DeleteTxnId(msgRef);
+
+        msgMessage_CallCompletionCallback(msgRef, NULL /* no response */);
+
+        le_msg_ReleaseMsg(msgRef);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a session's client-side state, allocating it if the session doesn't have it yet.
+ *
+ * @return  Pointer to the client-side state.
+ */
+//--------------------------------------------------------------------------------------------------
+static msgSession_ClientState_t* GetClientState
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (sessionPtr->clientPtr == NULL)
+    {
+        msgSession_ClientState_t* clientPtr = le_mem_ForceAlloc(ClientStatePoolRef);
+
+        clientPtr->pendingQueue = LE_DLS_LIST_INIT;
+        clientPtr->requestWindow = LE_CONFIG_MSG_REQUEST_WINDOW;
+        clientPtr->inFlightCount = 0;
+        clientPtr->rxHandler = NULL;
+        clientPtr->rxContextPtr = NULL;
+        clientPtr->openHandler = NULL;
+        clientPtr->openContextPtr = NULL;
+        clientPtr->closeHandler = NULL;
+        clientPtr->closeContextPtr = NULL;
+        clientPtr->bcastReaderRef = NULL;
+        clientPtr->isResumed = false;
+
+        sessionPtr->clientPtr = clientPtr;
+    }
+
+    return sessionPtr->clientPtr;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates a Session object.
@@ -446,12 +643,22 @@ static msgSession_UnixSession_t* CreateSession
     sessionPtr->receiveQueue = LE_DLS_LIST_INIT;
 
     sessionPtr->contextPtr = NULL;
-    sessionPtr->rxHandler = NULL;
-    sessionPtr->rxContextPtr = NULL;
-    sessionPtr->openHandler = NULL;
-    sessionPtr->openContextPtr = NULL;
-    sessionPtr->closeHandler = NULL;
-    sessionPtr->closeContextPtr = NULL;
+    sessionPtr->shmRegionRef = NULL;
+    sessionPtr->queueRef = NULL;
+    sessionPtr->bcastEventFd = -1;
+    sessionPtr->isSubscribed = false;
+
+    // Server-side sessions only get client-side state if a handler is set on them, which most
+    // servers never do.
+    sessionPtr->clientPtr = NULL;
+    if (interfaceRef->interfaceType != LE_MSG_INTERFACE_SERVER)
+    {
+        GetClientState(sessionPtr);
+    }
+
+#if LE_CONFIG_IPC_SESSION_STATS
+    memset(&sessionPtr->stats, 0, sizeof(sessionPtr->stats));
+#endif
 
     sessionPtr->interfaceRef = interfaceRef;
 
@@ -497,6 +704,37 @@ static void CloseSession
     fd_Close(sessionPtr->socketFd);
     sessionPtr->socketFd = -1;
 
+    // Let go of the shared memory region.  Messages still using slots in it keep it mapped
+    // until they are released; a new region is set up if the session is opened again.
+    if (sessionPtr->shmRegionRef != NULL)
+    {
+        le_mem_Release(sessionPtr->shmRegionRef);
+        sessionPtr->shmRegionRef = NULL;
+    }
+
+    // The server stops reading the durable queue for this session.  The client keeps appending
+    // to it, so one-way messages sent while the server is away are delivered when it's back.
+    if ((sessionPtr->queueRef != NULL) &&
+        (sessionPtr->interfaceRef->interfaceType == LE_MSG_INTERFACE_SERVER))
+    {
+        le_mem_Release(sessionPtr->queueRef);
+        sessionPtr->queueRef = NULL;
+    }
+
+    // Stop broadcasts.  A new channel reader (and eventfd) is set up if the session is opened
+    // again.
+    if ((sessionPtr->clientPtr != NULL) && (sessionPtr->clientPtr->bcastReaderRef != NULL))
+    {
+        msgBcast_Detach(sessionPtr->clientPtr->bcastReaderRef);
+        sessionPtr->clientPtr->bcastReaderRef = NULL;
+    }
+    if (sessionPtr->bcastEventFd >= 0)
+    {
+        fd_Close(sessionPtr->bcastEventFd);
+        sessionPtr->bcastEventFd = -1;
+    }
+    sessionPtr->isSubscribed = false;
+
     // If there are any messages stranded on the transmit queue, the pending transaction list,
     // or the receive queue, clean them all up.
     if (sessionPtr->interfaceRef->interfaceType == LE_MSG_INTERFACE_SERVER)
@@ -504,7 +742,14 @@ static void CloseSession
         PurgeTxnList(sessionPtr);
     }
     PurgeTransmitQueue(sessionPtr);
+    PurgePendingQueue(sessionPtr);
     PurgeReceiveQueue(sessionPtr);
+
+    // Whatever was in flight will never be answered now.
+    if (sessionPtr->clientPtr != NULL)
+    {
+        sessionPtr->clientPtr->inFlightCount = 0;
+    }
 }
 
 
@@ -528,6 +773,12 @@ static void DeleteSession
         CloseSession(sessionPtr);
     }
 
+    if (sessionPtr->queueRef != NULL)
+    {
+        le_mem_Release(sessionPtr->queueRef);
+        sessionPtr->queueRef = NULL;
+    }
+
     // Remove the Session from the Interface's Session List.
     SessionObjListChangeCount++;
     msgInterface_RemoveSession(sessionPtr->interfaceRef,
@@ -535,6 +786,10 @@ static void DeleteSession
                                mutexLocked);
 
     // Release the Session object itself.
+    if (sessionPtr->clientPtr != NULL)
+    {
+        le_mem_Release(sessionPtr->clientPtr);
+    }
     le_mem_Release(sessionPtr);
 }
 
@@ -624,6 +879,36 @@ static inline void DisableWriteabilityNotification
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when an attempt to open a session fails before the server has answered.  If the attempt
+ * went to a Resume Endpoint, the endpoint is assumed to be gone, so it is forgotten and the next
+ * attempt goes through the Service Directory.
+ *
+ * @note    This is used only on the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AbandonResumedOpen
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_MSG_SESSION_RESUME
+    if (sessionPtr->clientPtr->isResumed)
+    {
+        TRACE("Resume endpoint for interface '%s' is gone.",
+              le_msg_GetInterfaceName(sessionPtr->interfaceRef));
+
+        msgInterface_DropResumeFd(sessionPtr->interfaceRef);
+        sessionPtr->clientPtr->isResumed = false;
+    }
+#else
+    LE_UNUSED(sessionPtr);
+#endif
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Performs a retry on a failed attempt to open a session.
@@ -638,6 +923,7 @@ static void RetryOpen
 //--------------------------------------------------------------------------------------------------
 {
     CloseSession(sessionPtr);
+    AbandonResumedOpen(sessionPtr);
 
     le_msg_InterfaceRef_t interfaceRef =
         le_msg_GetSessionInterface(msgSession_GetSessionRef(sessionPtr));
@@ -668,20 +954,119 @@ static le_result_t ReceiveSessionOpenResponse
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // We expect to receive a very small message (one le_result_t).
-    le_result_t serverResponse;
-    size_t  bytesReceived = sizeof(serverResponse);
+    // We expect to receive a very small message (one le_result_t or a HelloMsg_t), possibly
+    // carrying the fds of a shared memory region for the session's payloads, of a Resume
+    // Endpoint, of a durable queue and of a broadcast channel.
+    HelloMsg_t hello;
+    size_t bytesReceived = sizeof(hello);
+    int fds[6];
+    size_t fdCount = NUM_ARRAY_MEMBERS(fds);
+    int shmFd = -1;
+    int resumeFd = -1;
+    int queueFd = -1;
+    int queueEventFd = -1;
+    int bcastFd = -1;
+    int bcastEventFd = -1;
+    size_t i = 0;
 
     // Receive the message.
     le_result_t result;
-    result = unixSocket_ReceiveDataMsg(sessionPtr->socketFd, &serverResponse, &bytesReceived);
+    result = unixSocket_ReceiveMsgFds(sessionPtr->socketFd,
+                                      &hello,
+                                      &bytesReceived,
+                                      fds,
+                                      &fdCount);
+
+    if (result == LE_OK)
+    {
+        if (bytesReceived == sizeof(hello.result))
+        {
+            hello.fdFlags = HELLO_FD_SHM;
+        }
+        else if (bytesReceived != sizeof(hello))
+        {
+            LE_FATAL("Unexpected server response size: %zu bytes.", bytesReceived);
+        }
+    }
+
+    // Only an accepted session keeps any of the fds that came with the response.
+    if ((result == LE_OK) && (hello.result == LE_OK))
+    {
+        if ((hello.fdFlags & HELLO_FD_SHM) && (i < fdCount))
+        {
+            shmFd = fds[i++];
+        }
+        if ((hello.fdFlags & HELLO_FD_RESUME) && (i < fdCount))
+        {
+            resumeFd = fds[i++];
+        }
+        if ((hello.fdFlags & HELLO_FD_QUEUE) && (i + 1 < fdCount))
+        {
+            queueFd = fds[i++];
+            queueEventFd = fds[i++];
+        }
+        if ((hello.fdFlags & HELLO_FD_BCAST) && (i + 1 < fdCount))
+        {
+            bcastFd = fds[i++];
+            bcastEventFd = fds[i++];
+        }
+    }
+
+    // Close whatever won't be used.
+    while (i < fdCount)
+    {
+        fd_Close(fds[i++]);
+    }
 
     if (result == LE_OK)
     {
+        le_result_t serverResponse = hello.result;
+
         if (serverResponse == LE_OK)
         {
             le_msg_InterfaceRef_t interfaceRef =
                 le_msg_GetSessionInterface(msgSession_GetSessionRef(sessionPtr));
+
+            size_t payloadSize = le_msg_GetProtocolMaxMsgSize(
+                                        le_msg_GetSessionProtocol(
+                                            msgSession_GetSessionRef(sessionPtr)));
+
+            if (shmFd >= 0)
+            {
+                sessionPtr->shmRegionRef = msgShm_AttachRegion(shmFd, payloadSize);
+            }
+
+            // A ring kept from before the server went away is replaced by the one it hands out
+            // now (normally the same file).
+            if (sessionPtr->queueRef != NULL)
+            {
+                le_mem_Release(sessionPtr->queueRef);
+                sessionPtr->queueRef = NULL;
+            }
+            if (queueFd >= 0)
+            {
+                sessionPtr->queueRef = msgQueue_Attach(queueFd, queueEventFd, payloadSize);
+            }
+
+            if (bcastFd >= 0)
+            {
+                sessionPtr->clientPtr->bcastReaderRef =
+                    msgBcast_Attach(bcastFd,
+                                    bcastEventFd,
+                                    msgSession_GetSessionRef(sessionPtr),
+                                    DeliverBroadcast,
+                                    sessionPtr);
+            }
+
+            if (resumeFd >= 0)
+            {
+#if LE_CONFIG_MSG_SESSION_RESUME
+                msgInterface_SetResumeFd(interfaceRef, resumeFd);
+#else
+                fd_Close(resumeFd);
+#endif
+            }
+
             TRACE("Session opened on interface (%s:%s)",
                   le_msg_GetInterfaceName(interfaceRef),
                   le_msg_GetProtocolIdStr(
@@ -721,13 +1106,60 @@ static le_result_t ReceiveSessionOpenResponse
 //--------------------------------------------------------------------------------------------------
 static le_result_t SendSessionOpenResponse
 (
-    int socketFd    ///< [IN] Connected socket to send through.
+    int socketFd,       ///< [IN] Connected socket to send through.
+    int shmFd,          ///< [IN] Shared memory region to hand to the client (-1 = none).
+    int resumeFd,       ///< [IN] Resume Endpoint connection to hand to the client (-1 = none).
+    int queueFd,        ///< [IN] Durable queue ring file to hand to the client (-1 = none).
+    int queueEventFd,   ///< [IN] Durable queue eventfd (ignored if queueFd is -1).
+    int bcastFd,        ///< [IN] Broadcast channel memfd to hand to the client (-1 = none).
+    int bcastEventFd    ///< [IN] Broadcast eventfd (ignored if bcastFd is -1).
 )
 //--------------------------------------------------------------------------------------------------
 {
-    const le_result_t response = LE_OK;
+    le_result_t response = LE_OK;
     ssize_t bytesSent;
 
+    if ((resumeFd >= 0) || (queueFd >= 0) || (bcastFd >= 0))
+    {
+        HelloMsg_t hello = { .result = LE_OK, .fdFlags = 0 };
+        int fds[6];
+        size_t fdCount = 0;
+
+        if (shmFd >= 0)
+        {
+            hello.fdFlags |= HELLO_FD_SHM;
+            fds[fdCount++] = shmFd;
+        }
+        if (resumeFd >= 0)
+        {
+            hello.fdFlags |= HELLO_FD_RESUME;
+            fds[fdCount++] = resumeFd;
+        }
+        if (queueFd >= 0)
+        {
+            hello.fdFlags |= HELLO_FD_QUEUE;
+            fds[fdCount++] = queueFd;
+            fds[fdCount++] = queueEventFd;
+        }
+        if (bcastFd >= 0)
+        {
+            hello.fdFlags |= HELLO_FD_BCAST;
+            fds[fdCount++] = bcastFd;
+            fds[fdCount++] = bcastEventFd;
+        }
+
+        return unixSocket_SendMsgFds(socketFd, &hello, sizeof(hello), fds, fdCount);
+    }
+
+    if (shmFd >= 0)
+    {
+        if (unixSocket_SendMsg(socketFd, &response, sizeof(response), shmFd, false) != LE_OK)
+        {
+            return LE_COMM_ERROR;
+        }
+        return LE_OK;
+    }
+
     do
     {
         bytesSent = send(socketFd, &response, sizeof(response), MSG_EOR);
@@ -748,6 +1180,61 @@ static le_result_t SendSessionOpenResponse
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a session's request window has room for another request to be sent.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline bool IsRequestWindowOpen
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const msgSession_ClientState_t* clientPtr = sessionPtr->clientPtr;
+
+    return (   (clientPtr->requestWindow == 0)
+            || (clientPtr->inFlightCount < clientPtr->requestWindow)  );
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move requests that were held back by the request window onto the Transmit Queue, as far as the
+ * window now allows, and try to send them.
+ *
+ * @note    This is used only on the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendPendingRequests
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    bool moved = false;
+
+    while (IsRequestWindowOpen(sessionPtr))
+    {
+        le_dls_Link_t* linkPtr = le_dls_Pop(&sessionPtr->clientPtr->pendingQueue);
+
+        if (linkPtr == NULL)
+        {
+            break;
+        }
+
+        sessionPtr->clientPtr->inFlightCount++;
+        PushTransmitQueue(sessionPtr, msgMessage_GetMessageContainingLink(linkPtr));
+        moved = true;
+    }
+
+    if (moved)
+    {
+        SendFromTransmitQueue(sessionPtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Process a message that was received from a server.
@@ -760,6 +1247,14 @@ static void ProcessMessageFromServer
 )
 //--------------------------------------------------------------------------------------------------
 {
+    // Broadcast control messages are for the session's broadcast channel reader.
+    if (msgMessage_IsBroadcastControl(msgRef))
+    {
+        msgBcast_HandleControl(sessionPtr->clientPtr->bcastReaderRef, le_msg_GetPayloadPtr(msgRef));
+        le_msg_ReleaseMsg(msgRef);
+        return;
+    }
+
     // This is either an asynchronous response message or an indication message from the server.
     // If it is an asynchronous response, this newly received message will have a matching
     // request message on the Transaction List and in the Transaction Map.
@@ -771,6 +1266,16 @@ static void ProcessMessageFromServer
         // The transaction is complete!  Remove it from the Transaction Map.
         DeleteTxnId(requestMsgRef);
 
+#if LE_CONFIG_IPC_SESSION_STATS
+        RecordLatency(sessionPtr, requestMsgRef);
+#endif
+
+        // That opens up a place in the request window.
+        if (sessionPtr->clientPtr->inFlightCount > 0)
+        {
+            sessionPtr->clientPtr->inFlightCount--;
+        }
+
         // Remove the request message from the session's Transaction List.
         RemoveFromTxnList(sessionPtr, requestMsgRef);
 
@@ -782,9 +1287,9 @@ static void ProcessMessageFromServer
     }
     // If it is an indication message, pass the indication message to the client's registered
     // receive handler, if there is one.
-    else if (sessionPtr->rxHandler != NULL)
+    else if (sessionPtr->clientPtr->rxHandler != NULL)
     {
-        sessionPtr->rxHandler(msgRef, sessionPtr->rxContextPtr);
+        sessionPtr->clientPtr->rxHandler(msgRef, sessionPtr->clientPtr->rxContextPtr);
     }
     // Discard the message if no handler is registered.
     else
@@ -826,6 +1331,14 @@ static void ProcessReceivedMessages
                                                   msgRef);
         }
     }
+
+    // Now that all the responses that arrived together have been handled, refill the request
+    // window in one go rather than once per response.
+    if (   (sessionPtr->interfaceRef->interfaceType == LE_MSG_INTERFACE_CLIENT)
+        && (sessionPtr->state == LE_MSG_SESSION_STATE_OPEN)  )
+    {
+        SendPendingRequests(sessionPtr);
+    }
 }
 
 
@@ -859,11 +1372,11 @@ static void ClientSocketHangUp
         case LE_MSG_SESSION_STATE_OPEN:
             // If the session has a close handler registered, then close the session and call
             // the handler.
-            if (sessionPtr->closeHandler != NULL)
+            if (sessionPtr->clientPtr->closeHandler != NULL)
             {
                 CloseSession(sessionPtr);
-                sessionPtr->closeHandler(msgSession_GetSessionRef(sessionPtr),
-                                         sessionPtr->closeContextPtr);
+                sessionPtr->clientPtr->closeHandler(msgSession_GetSessionRef(sessionPtr),
+                                                    sessionPtr->clientPtr->closeContextPtr);
             }
             // Otherwise, it's a fatal error, because the client is not designed to
             // recover from the session closing down on it.
@@ -893,6 +1406,75 @@ static void ClientSocketHangUp
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Client-side delivery function for messages read from the service's broadcast channel.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeliverBroadcast
+(
+    void*               contextPtr, ///< [IN] The session.
+    le_msg_MessageRef_t msgRef      ///< [IN] The message, or NULL if the session must be closed.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgSession_UnixSession_t* sessionPtr = contextPtr;
+
+    if (msgRef == NULL)
+    {
+        LE_WARN("Fell too far behind on broadcasts from service (%s:%s); closing session.",
+                le_msg_GetInterfaceName(sessionPtr->interfaceRef),
+                le_msg_GetProtocolIdStr(le_msg_GetInterfaceProtocol(sessionPtr->interfaceRef)));
+
+        // Handled as if the server had closed the session.
+        ClientSocketHangUp(sessionPtr);
+        return;
+    }
+
+#if LE_CONFIG_IPC_SESSION_STATS
+    sessionPtr->stats.receivedCount++;
+    sessionPtr->stats.receivedBytes += le_msg_GetMaxPayloadSize(msgRef);
+#endif
+
+    ProcessMessageFromServer(sessionPtr, msgRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tell a client where its subscription to the service's broadcast channel starts or ends.  Does
+ * nothing if the session has no broadcast channel.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendBroadcastControl
+(
+    msgSession_UnixSession_t*   sessionPtr,
+    uint32_t                    op          ///< [IN] MSGBCAST_OP_SUBSCRIBE or _UNSUBSCRIBE.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (sessionPtr->bcastEventFd < 0)
+    {
+        return;
+    }
+
+    msgInterface_UnixService_t* servicePtr = CONTAINER_OF(sessionPtr->interfaceRef,
+                                                          msgInterface_UnixService_t,
+                                                          interface);
+    msgBcast_Control_t control =
+    {
+        .magic = MSGBCAST_CONTROL_MAGIC,
+        .op = op,
+        .seq = msgBcast_GetNextSeq(servicePtr->bcastChannelRef)
+    };
+
+    PushTransmitQueue(sessionPtr,
+                      msgMessage_CreateBroadcastControlMsg(msgSession_GetSessionRef(sessionPtr),
+                                                           &control));
+    SendFromTransmitQueue(sessionPtr);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Client-side handler for an error on a session's socket.
@@ -936,6 +1518,10 @@ static void ClientSocketError
 //--------------------------------------------------------------------------------------------------
 /**
  * Receive messages from the socket and put them on the Receive Queue.
+ *
+ * Messages are received in batches.  The batch starts with one message, so that the common case
+ * of a single waiting message doesn't allocate Message objects it won't use, and doubles (up to
+ * BATCH_DEPTH) each time the socket fills it.
  */
 //--------------------------------------------------------------------------------------------------
 static void ReceiveMessages
@@ -944,25 +1530,58 @@ static void ReceiveMessages
 )
 //--------------------------------------------------------------------------------------------------
 {
+    le_msg_MessageRef_t msgRefs[BATCH_DEPTH];
+    size_t batchLen = 1;
+
     for (;;)
     {
-        // Create a Message object.
-        le_msg_MessageRef_t msgRef = le_msg_CreateMsg(msgSession_GetSessionRef(sessionPtr));
+        size_t i;
+        size_t receivedCount;
 
-        // Receive from the socket into the Message object.
-        le_result_t result = msgMessage_Receive(sessionPtr->socketFd, msgRef);
+        // Create the Message objects.
+        for (i = 0; i < batchLen; i++)
+        {
+            msgRefs[i] = msgMessage_CreateReceiveMsg(msgSession_GetSessionRef(sessionPtr));
+        }
 
-        if (result == LE_OK)
+        // Receive from the socket into the Message objects.
+        le_result_t result = msgMessage_ReceiveBatch(sessionPtr->socketFd,
+                                                     msgRefs,
+                                                     batchLen,
+                                                     &receivedCount);
+
+        // Push what was received onto the Receive Queue for later processing, and release the
+        // rest.
+        for (i = 0; i < receivedCount; i++)
         {
-            // Received something.  Push it onto the Receive Queue for later processing.
-            PushReceiveQueue(sessionPtr, msgRef);
+#if LE_CONFIG_IPC_SESSION_STATS
+            sessionPtr->stats.receivedBytes += le_msg_GetMaxPayloadSize(msgRefs[i]);
+#endif
+            TRACE_MARKER('L', "rx|%p|%s", msgMessage_GetTxnId(msgRefs[i]),
+                         le_msg_GetInterfaceName(sessionPtr->interfaceRef));
+            PushReceiveQueue(sessionPtr, msgRefs[i]);
         }
-        else
+#if LE_CONFIG_IPC_SESSION_STATS
+        sessionPtr->stats.receivedCount += receivedCount;
+#endif
+        for (; i < batchLen; i++)
+        {
+            le_msg_ReleaseMsg(msgRefs[i]);
+        }
+
+        if (result != LE_OK)
         {
             // Nothing left to receive from the socket.  We are done.
-            le_msg_ReleaseMsg(msgRef);
             break;
         }
+
+        if (receivedCount < batchLen)
+        {
+            // The socket has been drained.  If more arrives, the FD Monitor will tell us again.
+            break;
+        }
+
+        batchLen = (batchLen * 2 < BATCH_DEPTH) ? batchLen * 2 : BATCH_DEPTH;
     }
 }
 
@@ -1013,10 +1632,59 @@ static void ServerSocketError
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Dispose of a message that has been sent from a session's Transmit Queue.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FinishTransmit
+(
+    msgSession_UnixSession_t*   sessionPtr,
+    le_msg_MessageRef_t         msgRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    switch (sessionPtr->interfaceRef->interfaceType)
+    {
+        // If this is the client side of the session,
+        case LE_MSG_INTERFACE_CLIENT:
+            // If a response is expected from the other side later, then put this
+            // message on the Transaction List.
+            if (msgMessage_GetTxnId(msgRef) != 0)
+            {
+                AddToTxnList(sessionPtr, msgRef);
+            }
+            // Otherwise, release it.
+            else
+            {
+                le_msg_ReleaseMsg(msgRef);
+            }
+
+            break;
+
+        // If this is the server side of the session,
+        case LE_MSG_INTERFACE_SERVER:
+            // Release the message, but first clear out the transaction ID so that
+            // the message knows that it is not being deleted without a reponse message
+            // being sent if one was expected.
+            msgMessage_SetTxnId(msgRef, 0);
+            le_msg_ReleaseMsg(msgRef);
+
+            break;
+
+        default:
+            LE_FATAL("Unhandled interface type (%d)",
+                     sessionPtr->interfaceRef->interfaceType);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Send messages from a session's Transmit Queue until either the socket becomes full or there
  * are no more messages waiting on the queue.
+ *
+ * Up to BATCH_DEPTH queued messages are sent per system call.
  */
 //--------------------------------------------------------------------------------------------------
 static void SendFromTransmitQueue
@@ -1025,11 +1693,13 @@ static void SendFromTransmitQueue
 )
 //--------------------------------------------------------------------------------------------------
 {
+    le_msg_MessageRef_t msgRefs[BATCH_DEPTH];
+
     for (;;)
     {
-        le_msg_MessageRef_t msgRef = PopTransmitQueue(sessionPtr);
+        size_t count = PopTransmitQueueBatch(sessionPtr, msgRefs, BATCH_DEPTH);
 
-        if (msgRef == NULL)
+        if (count == 0)
         {
             // Since the Transmit Queue is empty, tell the FD Monitor that we don't need to be
             // notified about writeability anymore.
@@ -1037,51 +1707,41 @@ static void SendFromTransmitQueue
             break;
         }
 
-        le_result_t result = msgMessage_Send(sessionPtr->socketFd, msgRef);
+        size_t sentCount;
+        le_result_t result = msgMessage_SendBatch(sessionPtr->socketFd,
+                                                  msgRefs,
+                                                  count,
+                                                  &sentCount);
+        size_t i;
+
+        for (i = 0; i < sentCount; i++)
+        {
+#if LE_CONFIG_IPC_SESSION_STATS
+            sessionPtr->stats.sentBytes += le_msg_GetMaxPayloadSize(msgRefs[i]);
+#endif
+            TRACE_MARKER('L', "tx|%p|%s", msgMessage_GetTxnId(msgRefs[i]),
+                         le_msg_GetInterfaceName(sessionPtr->interfaceRef));
+            FinishTransmit(sessionPtr, msgRefs[i]);
+        }
+#if LE_CONFIG_IPC_SESSION_STATS
+        sessionPtr->stats.sentCount += sentCount;
+#endif
+
+        // Put the messages that weren't sent back on the head of the queue, in their original
+        // order.
+        for (i = count; i > sentCount; i--)
+        {
+            UnPopTransmitQueue(sessionPtr, msgRefs[i - 1]);
+        }
 
         switch (result)
         {
             case LE_OK:
-                switch (sessionPtr->interfaceRef->interfaceType)
-                {
-                    // If this is the client side of the session,
-                    case LE_MSG_INTERFACE_CLIENT:
-                        // If a response is expected from the other side later, then put this
-                        // message on the Transaction List.
-                        if (msgMessage_GetTxnId(msgRef) != 0)
-                        {
-                            AddToTxnList(sessionPtr, msgRef);
-                        }
-                        // Otherwise, release it.
-                        else
-                        {
-                            le_msg_ReleaseMsg(msgRef);
-                        }
-
-                        break;
-
-                    // If this is the server side of the session,
-                    case LE_MSG_INTERFACE_SERVER:
-                        // Release the message, but first clear out the transaction ID so that
-                        // the message knows that it is not being deleted without a reponse message
-                        // being sent if one was expected.
-                        msgMessage_SetTxnId(msgRef, 0);
-                        le_msg_ReleaseMsg(msgRef);
-
-                        break;
-
-                    default:
-                        LE_FATAL("Unhandled interface type (%d)",
-                                 sessionPtr->interfaceRef->interfaceType);
-                }
-
-                break;  // Continue to loop around and send another.
+                break;  // Continue to loop around and send another batch.
 
             case LE_NO_MEMORY:
-                // Have to wait for the socket to become writeable.  Put the message back on
-                // the head of the queue and ask the FD Monitor to tell us when the socket becomes
-                // writeable again.
-                UnPopTransmitQueue(sessionPtr, msgRef);
+                // Have to wait for the socket to become writeable.  Ask the FD Monitor to tell
+                // us when the socket becomes writeable again.
                 EnableWriteabilityNotification(sessionPtr);
 
                 return;
@@ -1089,10 +1749,8 @@ static void SendFromTransmitQueue
             case LE_COMM_ERROR:
                 // In this case, we expect a handler function to be called by the FD Monitor,
                 // so we don't need to handle this case here.  However, we must stop
-                // trying to transmit now.  Stick the current message back on the Transmit Queue
-                // so it gets cleaned up with the others when the session closes.
-                UnPopTransmitQueue(sessionPtr, msgRef);
-
+                // trying to transmit now.  The unsent messages are back on the Transmit Queue
+                // so they get cleaned up with the others when the session closes.
                 return;
 
             default:
@@ -1139,7 +1797,8 @@ static void ClientSocketReadable
                 sessionPtr->state = LE_MSG_SESSION_STATE_OPEN;
 
                 // Call the client's completion callback.
-                sessionPtr->openHandler(msgSession_GetSessionRef(sessionPtr), sessionPtr->openContextPtr);
+                sessionPtr->clientPtr->openHandler(msgSession_GetSessionRef(sessionPtr),
+                                                   sessionPtr->clientPtr->openContextPtr);
             }
             break;
 
@@ -1327,6 +1986,77 @@ static void StartSocketMonitoring
 }
 
 
+#if LE_CONFIG_MSG_SESSION_RESUME
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start an attempt to open a session by sending a request directly to the server's Resume
+ * Endpoint, if the client interface has one from an earlier session.  The request carries one end
+ * of a new socket pair, which becomes the session's connection if the server accepts it.
+ *
+ * If successful, stores the connection's file descriptor in the Session object and marks the
+ * attempt as resumed.
+ *
+ * @return
+ * - LE_OK if successful.
+ * - LE_NOT_FOUND if the client interface doesn't have a Resume Endpoint (any more).
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t StartResumedOpenAttempt
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int resumeFd = msgInterface_GetResumeFd(sessionPtr->interfaceRef);
+    if (resumeFd < 0)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    int localFd;
+    int remoteFd;
+    le_result_t result = unixSocket_CreateSeqPacketPair(&localFd, &remoteFd);
+    if (result != LE_OK)
+    {
+        fd_Close(resumeFd);
+        return LE_NOT_FOUND;
+    }
+
+    svcdir_OpenRequest_t msg;
+    msgInterface_GetInterfaceDetails(sessionPtr->interfaceRef, &(msg.interface));
+    msg.shouldWait = false;
+
+    result = unixSocket_SendMsgFds(resumeFd, &msg, sizeof(msg), &remoteFd, 1);
+
+    fd_Close(remoteFd);
+    fd_Close(resumeFd);
+
+    if (result != LE_OK)
+    {
+        TRACE("Failed to send to the resume endpoint of interface '%s' (%s).",
+              le_msg_GetInterfaceName(sessionPtr->interfaceRef),
+              LE_RESULT_TXT(result));
+
+        fd_Close(localFd);
+
+        // A full send buffer just means the server is busy, so only forget the endpoint if it
+        // has gone away.
+        if (result != LE_NO_MEMORY)
+        {
+            msgInterface_DropResumeFd(sessionPtr->interfaceRef);
+        }
+
+        return LE_NOT_FOUND;
+    }
+
+    sessionPtr->socketFd = localFd;
+    sessionPtr->clientPtr->isResumed = true;
+
+    return LE_OK;
+}
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Start an attempt to open a session by connecting to the Service Directory and sending it
@@ -1357,6 +2087,17 @@ static le_result_t StartSessionOpenAttempt
 {
     sessionPtr->state = LE_MSG_SESSION_STATE_OPENING;
 
+#if LE_CONFIG_MSG_SESSION_RESUME
+    // If the server handed us a Resume Endpoint when an earlier session was opened, skip the
+    // Service Directory and go straight to the server.
+    if (StartResumedOpenAttempt(sessionPtr) == LE_OK)
+    {
+        return LE_OK;
+    }
+#endif
+
+    sessionPtr->clientPtr->isResumed = false;
+
     // Create a socket for the session.
     sessionPtr->socketFd = CreateSocket();
 
@@ -1478,6 +2219,11 @@ static le_result_t AttemptOpenSync
             else
             {
                 CloseSession(sessionPtr);
+
+                if (result == LE_CLOSED)
+                {
+                    AbandonResumedOpen(sessionPtr);
+                }
             }
         }
 
@@ -1573,6 +2319,9 @@ void msgSession_Init
     SessionPoolRef = le_mem_CreatePool("Session", sizeof(msgSession_UnixSession_t));
     le_mem_ExpandPool(SessionPoolRef, 10); /// @todo Make this configurable.
 
+    ClientStatePoolRef = le_mem_CreatePool("SessionClientState",
+                                           sizeof(msgSession_ClientState_t));
+
     TxnMapRef = le_ref_CreateMap("MsgTxnIDs", MAX_EXPECTED_TXNS);
 
     // Get a reference to the trace keyword that is used to control tracing in this module.
@@ -1616,6 +2365,22 @@ bool msgSession_IsOpen
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a message from the session's own thread, on behalf of another thread of the server.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendMessageQueued
+(
+    void* sessionRef,   ///< [in] Reference to the session.
+    void* messageRef    ///< [in] Reference to the message.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgSession_SendMessage(sessionRef, messageRef);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sends a given Message object through a given Session.
@@ -1630,13 +2395,34 @@ void msgSession_SendMessage
 {
     msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
     // Only the thread that is handling events on this socket is allowed to send messages through
-    // this socket.  This prevents multi-threaded races.
-    /// @todo Allow other threads to send?
-    LE_FATAL_IF(le_thread_GetCurrent() != unixSessionPtr->threadRef,
-                "Attempt to send by thread that doesn't own session '%s'.",
-                le_msg_GetInterfaceName(le_msg_GetSessionInterface(sessionRef)));
+    // this socket.  This prevents multi-threaded races.  Servers may send from other threads
+    // (e.g., responses from the worker threads of a parallel server); the message is then handed
+    // to the session's thread, which sends it.  The message holds a reference to the session.
+    if (le_thread_GetCurrent() != unixSessionPtr->threadRef)
+    {
+        LE_FATAL_IF(unixSessionPtr->interfaceRef->interfaceType != LE_MSG_INTERFACE_SERVER,
+                    "Attempt to send by thread that doesn't own session '%s'.",
+                    le_msg_GetInterfaceName(le_msg_GetSessionInterface(sessionRef)));
+
+        le_event_QueueFunctionToThread(unixSessionPtr->threadRef,
+                                       SendMessageQueued,
+                                       sessionRef,
+                                       messageRef);
+        return;
+    }
 
-    if (unixSessionPtr->state != LE_MSG_SESSION_STATE_OPEN)
+    // One-way messages from a client with a durable queue go through the ring, even while the
+    // session is closed.  If the ring is full, they're sent the usual way.
+    if ((unixSessionPtr->queueRef != NULL) &&
+        (unixSessionPtr->interfaceRef->interfaceType == LE_MSG_INTERFACE_CLIENT) &&
+        (!msgMessage_HasFd(messageRef)) &&
+        (msgQueue_Append(unixSessionPtr->queueRef,
+                         le_msg_GetPayloadPtr(messageRef),
+                         le_msg_GetMaxPayloadSize(messageRef)) == LE_OK))
+    {
+        le_msg_ReleaseMsg(messageRef);
+    }
+    else if (unixSessionPtr->state != LE_MSG_SESSION_STATE_OPEN)
     {
         LE_DEBUG("Discarding message sent in session that is not open.");
 
@@ -1680,6 +2466,22 @@ void msgSession_RequestResponse
     // Create an ID for this transaction.
     CreateTxnId(msgRef);
 
+#if LE_CONFIG_IPC_SESSION_STATS
+    msgMessage_SetRequestTime(msgRef, le_clk_GetRelativeTime());
+#endif
+
+    // If the request window is full, hold the request back until a response comes in.
+    // Anything already held back goes first, to keep the requests in order.
+    msgSession_ClientState_t* clientPtr = unixSessionPtr->clientPtr;
+
+    if ((!IsRequestWindowOpen(unixSessionPtr)) || (!le_dls_IsEmpty(&clientPtr->pendingQueue)))
+    {
+        le_dls_Queue(&clientPtr->pendingQueue, msgMessage_GetQueueLinkPtr(msgRef));
+        return;
+    }
+
+    clientPtr->inFlightCount++;
+
     // Put the message on the Transmit Queue.
     PushTransmitQueue(unixSessionPtr, msgRef);
 
@@ -1712,11 +2514,25 @@ le_msg_MessageRef_t msgSession_DoSyncRequestResponse
     // Create an ID for this transaction.
     CreateTxnId(msgRef);
 
+#if LE_CONFIG_IPC_SESSION_STATS
+    msgMessage_SetRequestTime(msgRef, le_clk_GetRelativeTime());
+#endif
+
     // Put the socket into blocking mode.
     fd_SetBlocking(unixSessionPtr->socketFd);
 
     // Send the Request Message.
+#if LE_CONFIG_IPC_SESSION_STATS
+    if (msgMessage_Send(unixSessionPtr->socketFd, msgRef) == LE_OK)
+    {
+        unixSessionPtr->stats.sentCount++;
+        unixSessionPtr->stats.sentBytes += le_msg_GetMaxPayloadSize(msgRef);
+    }
+#else
     msgMessage_Send(unixSessionPtr->socketFd, msgRef);
+#endif
+    TRACE_MARKER('L', "tx|%p|%s", msgMessage_GetTxnId(msgRef),
+                 le_msg_GetInterfaceName(unixSessionPtr->interfaceRef));
 
     // While we have not yet received the response we are waiting for, keep
     // receiving messages.  Any that we receive that don't match the transaction ID
@@ -1724,7 +2540,7 @@ le_msg_MessageRef_t msgSession_DoSyncRequestResponse
     // function call.
     for (;;)
     {
-        rxMsgRef = le_msg_CreateMsg(sessionRef);
+        rxMsgRef = msgMessage_CreateReceiveMsg(sessionRef);
 
         le_result_t result = msgMessage_Receive(unixSessionPtr->socketFd, rxMsgRef);
 
@@ -1737,9 +2553,19 @@ le_msg_MessageRef_t msgSession_DoSyncRequestResponse
             break;
         }
 
+#if LE_CONFIG_IPC_SESSION_STATS
+        unixSessionPtr->stats.receivedCount++;
+        unixSessionPtr->stats.receivedBytes += le_msg_GetMaxPayloadSize(rxMsgRef);
+#endif
+        TRACE_MARKER('L', "rx|%p|%s", msgMessage_GetTxnId(rxMsgRef),
+                     le_msg_GetInterfaceName(unixSessionPtr->interfaceRef));
+
         if (msgMessage_GetTxnId(rxMsgRef) == msgMessage_GetTxnId(msgRef))
         {
             // Got the synchronous response we were waiting for.
+#if LE_CONFIG_IPC_SESSION_STATS
+            RecordLatency(unixSessionPtr, msgRef);
+#endif
             break;
         }
 
@@ -1889,6 +2715,10 @@ static le_msg_SessionRef_t msgSession_GetSessionRef
 /**
  * Creates a server-side Session object for a given client connection to a given Service.
  *
+ * If offerResume is true (and LE_CONFIG_MSG_SESSION_RESUME is enabled), the client is also handed
+ * a connection to a new Resume Endpoint of the Service, through which it can open its later
+ * sessions without going through the Service Directory.
+ *
  * @return A reference to the newly created Session object, or NULL if failed.
  *
  * @note Closes the file descriptor on failure.
@@ -1897,21 +2727,115 @@ static le_msg_SessionRef_t msgSession_GetSessionRef
 le_msg_SessionRef_t msgSession_CreateServerSideSession
 (
     le_msg_ServiceRef_t serviceRef,
-    int                 fd          ///< [IN] File descriptor of socket connected to client.
+    int                 fd,         ///< [IN] File descriptor of socket connected to client.
+    bool                offerResume ///< [IN] true = hand the client a Resume Endpoint (if enabled).
 )
 //--------------------------------------------------------------------------------------------------
 {
     msgInterface_UnixService_t* servicePtr = CONTAINER_OF(serviceRef,
                                                           msgInterface_UnixService_t,
                                                           service);
+    // If this protocol's payloads are large, set up a shared memory region for them.  The
+    // client maps it when it receives the Hello message.
+    msgShm_RegionRef_t shmRegionRef = NULL;
+    int shmFd = -1;
+    size_t payloadSize = le_msg_GetProtocolMaxMsgSize(servicePtr->interface.id.protocolRef);
+    if (msgShm_IsWorthwhile(payloadSize))
+    {
+        shmRegionRef = msgShm_CreateRegion(payloadSize, &shmFd);
+    }
+
+    // If the client came through the Service Directory, give it a Resume Endpoint so it can
+    // come straight back to us next time.
+    int resumeFd = -1;
+    int endpointFd = -1;
+#if LE_CONFIG_MSG_SESSION_RESUME
+    if (offerResume && (unixSocket_CreateSeqPacketPair(&endpointFd, &resumeFd) != LE_OK))
+    {
+        endpointFd = -1;
+        resumeFd = -1;
+    }
+#else
+    LE_UNUSED(offerResume);
+#endif
+
+    // If the service has durable queues, hand the client its user's ring.
+    msgQueue_QueueRef_t queueRef = NULL;
+    int queueFd = -1;
+    int queueEventFd = -1;
+#if LE_CONFIG_MSG_DURABLE_QUEUE
+    struct ucred cred;
+    socklen_t credSize = sizeof(cred);
+    if ((servicePtr->queueSize != 0) &&
+        (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &credSize) == 0))
+    {
+        queueRef = msgQueue_Open(servicePtr, cred.uid, &queueFd, &queueEventFd);
+    }
+#endif
+
+    // If the service has a broadcast channel, hand it to the client, with an eventfd to wake the
+    // client up when it is subscribed.
+    int bcastFd = -1;
+    int bcastEventFd = -1;
+    if (servicePtr->bcastChannelRef != NULL)
+    {
+        bcastEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (bcastEventFd >= 0)
+        {
+            bcastFd = msgBcast_GetChannelFd(servicePtr->bcastChannelRef);
+        }
+        else
+        {
+            LE_WARN("eventfd() failed (%m).  Broadcasts will be sent through the session.");
+        }
+    }
+
     // Send a Hello message (LE_OK) to the client.
-    if (SendSessionOpenResponse(fd) != LE_OK)
+    le_result_t result = SendSessionOpenResponse(fd, shmFd, resumeFd, queueFd, queueEventFd,
+                                                 bcastFd, bcastEventFd);
+    if (shmFd >= 0)
+    {
+        fd_Close(shmFd);
+    }
+    if (resumeFd >= 0)
+    {
+        fd_Close(resumeFd);
+    }
+    if (queueFd >= 0)
+    {
+        fd_Close(queueFd);
+        fd_Close(queueEventFd);
+    }
+    if (result != LE_OK)
     {
         // Something went wrong.  Abort.
+        if (shmRegionRef != NULL)
+        {
+            le_mem_Release(shmRegionRef);
+        }
+        if (queueRef != NULL)
+        {
+            le_mem_Release(queueRef);
+        }
+        if (bcastEventFd >= 0)
+        {
+            fd_Close(bcastEventFd);
+        }
+        if (endpointFd >= 0)
+        {
+            fd_Close(endpointFd);
+        }
         fd_Close(fd);
         return NULL;
     }
 
+#if LE_CONFIG_MSG_SESSION_RESUME
+    if (endpointFd >= 0)
+    {
+        msgInterface_AddResumeEndpoint(serviceRef, endpointFd);
+    }
+#endif
+
     // The Hello message was sent successfully.
     // Set the socket non-blocking for future operation.
     fd_SetNonBlocking(fd);
@@ -1921,6 +2845,9 @@ le_msg_SessionRef_t msgSession_CreateServerSideSession
 
     // Record the client connection file descriptor.
     sessionPtr->socketFd = fd;
+    sessionPtr->shmRegionRef = shmRegionRef;
+    sessionPtr->queueRef = queueRef;
+    sessionPtr->bcastEventFd = bcastEventFd;
 
     // Start monitoring the server-side session connection socket for events.
     StartSocketMonitoring(sessionPtr, ServerSocketEventHandler);
@@ -1955,7 +2882,36 @@ le_msg_SessionRef_t le_msg_CreateSession
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_msg_ClientInterfaceRef_t clientRef = msgInterface_GetClient(protocolRef, interfaceName);
+    le_msg_ClientInterfaceRef_t clientRef = msgInterface_GetClient(protocolRef,
+                                                                   interfaceName,
+                                                                   false);
+
+    msgSession_UnixSession_t* sessionPtr = CreateSession(&clientRef->interface);
+
+    msgInterface_Release(&clientRef->interface, false);
+
+    return msgSession_GetSessionRef(sessionPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a session like le_msg_CreateSession(), referring to the caller's interface name instead
+ * of copying it.
+ *
+ * @return  The Session reference.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_SessionRef_t le_msg_CreateStaticSession
+(
+    le_msg_ProtocolRef_t    protocolRef,    ///< [in] Reference to the protocol to be used.
+    const char*             interfaceName   ///< [in] Name of the client-side interface (constant).
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_ClientInterfaceRef_t clientRef = msgInterface_GetClient(protocolRef,
+                                                                   interfaceName,
+                                                                   true);
 
     msgSession_UnixSession_t* sessionPtr = CreateSession(&clientRef->interface);
 
@@ -1994,6 +2950,192 @@ void le_msg_SetSessionContextPtr
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of asynchronous requests that may be waiting for their responses on a
+ * session at once.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetSessionRequestWindow
+(
+    le_msg_SessionRef_t sessionRef, ///< [in] Reference to the session.
+    uint32_t            window      ///< [in] Maximum requests in flight, or 0 for unlimited.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(sessionRef);
+    switch (sessionRef->type)
+    {
+        case LE_MSG_SESSION_LOCAL:
+            // Requests on local sessions are handled in order by the server's thread, so there
+            // is nothing to limit.
+            break;
+        case LE_MSG_SESSION_UNIX_SOCKET:
+        {
+            msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
+
+            LE_FATAL_IF(le_thread_GetCurrent() != unixSessionPtr->threadRef,
+                        "Calling thread doesn't own the session '%s'.",
+                        le_msg_GetInterfaceName(le_msg_GetSessionInterface(sessionRef)));
+
+            GetClientState(unixSessionPtr)->requestWindow = window;
+
+            // If the window got bigger, requests that were held back may now be sent.
+            if (unixSessionPtr->state == LE_MSG_SESSION_STATE_OPEN)
+            {
+                SendPendingRequests(unixSessionPtr);
+            }
+            break;
+        }
+        default:
+            LE_FATAL("Corrupted session type: %d", sessionRef->type);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the Unix session behind a server-side session reference, checking that the calling thread
+ * is allowed to use it.
+ */
+//--------------------------------------------------------------------------------------------------
+static msgSession_UnixSession_t* GetServerSessionPtr
+(
+    le_msg_SessionRef_t sessionRef,
+    const char*         funcName    ///< [IN] Calling API function, for error messages.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(sessionRef);
+    LE_FATAL_IF(sessionRef->type != LE_MSG_SESSION_UNIX_SOCKET,
+                "%s() called for a local session.", funcName);
+
+    msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
+
+    LE_FATAL_IF(unixSessionPtr->interfaceRef->interfaceType != LE_MSG_INTERFACE_SERVER,
+                "%s() called for a client-side session.", funcName);
+    LE_FATAL_IF(le_thread_GetCurrent() != unixSessionPtr->threadRef,
+                "Calling thread doesn't own the session '%s'.",
+                le_msg_GetInterfaceName(le_msg_GetSessionInterface(sessionRef)));
+
+    return unixSessionPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a session to the subscribers of the messages its service broadcasts.
+ *
+ * @note    Server-only function.  Must be called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_Subscribe
+(
+    le_msg_SessionRef_t sessionRef  ///< [in] Reference to the session.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgSession_UnixSession_t* unixSessionPtr = GetServerSessionPtr(sessionRef, __func__);
+
+    if ((unixSessionPtr->state == LE_MSG_SESSION_STATE_OPEN) && !unixSessionPtr->isSubscribed)
+    {
+        unixSessionPtr->isSubscribed = true;
+        SendBroadcastControl(unixSessionPtr, MSGBCAST_OP_SUBSCRIBE);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Removes a session from the subscribers of the messages its service broadcasts.  Messages
+ * broadcast before this is called are still delivered.
+ *
+ * @note    Server-only function.  Must be called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_Unsubscribe
+(
+    le_msg_SessionRef_t sessionRef  ///< [in] Reference to the session.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgSession_UnixSession_t* unixSessionPtr = GetServerSessionPtr(sessionRef, __func__);
+
+    if (unixSessionPtr->isSubscribed)
+    {
+        unixSessionPtr->isSubscribed = false;
+        SendBroadcastControl(unixSessionPtr, MSGBCAST_OP_UNSUBSCRIBE);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a message to every session subscribed to a service.  No response expected.
+ *
+ * @note    Server-only function.  Must be called by the service's server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_Broadcast
+(
+    le_msg_ServiceRef_t serviceRef, ///< [in] Reference to the service.
+    const void*         payloadPtr, ///< [in] Payload of the message.
+    size_t              payloadSize ///< [in] Size of the payload, in bytes (at most the
+                                    ///       protocol's maximum message size).
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_FATAL_IF(serviceRef->type != LE_MSG_SERVICE_UNIX_SOCKET,
+                "Cannot broadcast on a local service");
+
+    msgInterface_UnixService_t* servicePtr = CONTAINER_OF(serviceRef,
+                                                          msgInterface_UnixService_t,
+                                                          service);
+
+    LE_FATAL_IF(le_thread_GetCurrent() != servicePtr->serverThread,
+                "Attempt to broadcast by thread that isn't the server of service '%s'.",
+                servicePtr->interface.id.name);
+    LE_FATAL_IF(payloadSize > le_msg_GetProtocolMaxMsgSize(servicePtr->interface.id.protocolRef),
+                "Broadcast payload too large (%" PRIuS " bytes) for service '%s'.",
+                payloadSize, servicePtr->interface.id.name);
+
+    // Put the message in the channel once; subscribers that read the channel just need waking.
+    bool isPublished = ((servicePtr->bcastChannelRef != NULL) &&
+                        (msgBcast_Publish(servicePtr->bcastChannelRef,
+                                          payloadPtr,
+                                          payloadSize) == LE_OK));
+
+    le_dls_List_t* listPtr = &servicePtr->interface.sessionList;
+    le_dls_Link_t* linkPtr = le_dls_Peek(listPtr);
+
+    while (linkPtr != NULL)
+    {
+        le_msg_SessionRef_t sessionRef = msgSession_GetSessionContainingLink(linkPtr);
+        msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
+
+        linkPtr = le_dls_PeekNext(listPtr, linkPtr);
+
+        if ((!unixSessionPtr->isSubscribed) ||
+            (unixSessionPtr->state != LE_MSG_SESSION_STATE_OPEN))
+        {
+            continue;
+        }
+
+        if (isPublished && (unixSessionPtr->bcastEventFd >= 0))
+        {
+            msgBcast_Signal(unixSessionPtr->bcastEventFd);
+        }
+        else
+        {
+            // Sessions opened before the service got its channel get their own copy.
+            le_msg_MessageRef_t msgRef = le_msg_CreateMsg(sessionRef);
+
+            memcpy(le_msg_GetPayloadPtr(msgRef), payloadPtr, payloadSize);
+            msgSession_SendMessage(sessionRef, msgRef);
+        }
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the opaque context value (void pointer) that was set earlier using
@@ -2087,8 +3229,9 @@ void le_msg_SetSessionRecvHandler
         {
             LE_DEBUG("SetSessionRecv: Unix socket session");
             msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
-            unixSessionPtr->rxHandler = handlerFunc;
-            unixSessionPtr->rxContextPtr = contextPtr;
+            msgSession_ClientState_t* clientPtr = GetClientState(unixSessionPtr);
+            clientPtr->rxHandler = handlerFunc;
+            clientPtr->rxContextPtr = contextPtr;
             break;
         }
         default:
@@ -2131,8 +3274,9 @@ void le_msg_SetSessionCloseHandler
         case LE_MSG_SESSION_UNIX_SOCKET:
         {
             msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
-            unixSessionPtr->closeHandler = handlerFunc;
-            unixSessionPtr->closeContextPtr = contextPtr;
+            msgSession_ClientState_t* clientPtr = GetClientState(unixSessionPtr);
+            clientPtr->closeHandler = handlerFunc;
+            clientPtr->closeContextPtr = contextPtr;
             break;
         }
         default:
@@ -2164,8 +3308,16 @@ void le_msg_GetSessionCloseHandler
         case LE_MSG_SESSION_UNIX_SOCKET:
         {
             msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
-            *handlerFuncPtr = unixSessionPtr->closeHandler;
-            *contextPtrPtr = unixSessionPtr->closeContextPtr;
+            if (unixSessionPtr->clientPtr != NULL)
+            {
+                *handlerFuncPtr = unixSessionPtr->clientPtr->closeHandler;
+                *contextPtrPtr = unixSessionPtr->clientPtr->closeContextPtr;
+            }
+            else
+            {
+                *handlerFuncPtr = NULL;
+                *contextPtrPtr = NULL;
+            }
             break;
         }
         default:
@@ -2211,8 +3363,9 @@ void le_msg_OpenSession
         case LE_MSG_SESSION_UNIX_SOCKET:
         {
             msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
-            unixSessionPtr->openHandler = callbackFunc;
-            unixSessionPtr->openContextPtr = contextPtr;
+            msgSession_ClientState_t* clientPtr = GetClientState(unixSessionPtr);
+            clientPtr->openHandler = callbackFunc;
+            clientPtr->openContextPtr = contextPtr;
 
             AttemptOpen(unixSessionPtr);
             break;
@@ -2336,6 +3489,33 @@ le_result_t le_msg_TryOpenSessionSync
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deletes a server-side session from the session's own thread, on behalf of another thread of the
+ * server.  Releases the reference taken when the deletion was queued.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeleteSessionQueued
+(
+    void* sessionPtr,   ///< [in] Pointer to the Unix Session.
+    void* unused        ///< [in] Not used.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_UNUSED(unused);
+
+    msgSession_UnixSession_t* unixSessionPtr = sessionPtr;
+
+    // The session may have been closed (and so deleted) in the meantime.
+    if (unixSessionPtr->state != LE_MSG_SESSION_STATE_CLOSED)
+    {
+        DeleteSession(unixSessionPtr, false);
+    }
+
+    le_mem_Release(unixSessionPtr);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Common code for terminating a session.
@@ -2358,10 +3538,23 @@ static void CloseSessionCommon
         {
             msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
 
-            // On the server side, sessions are automatically deleted when they close.
+            // On the server side, sessions are automatically deleted when they close.  If another
+            // thread of the server closes it (e.g., LE_KILL_CLIENT() on a worker thread), the
+            // session's thread deletes it.
             if (unixSessionPtr->interfaceRef->interfaceType == LE_MSG_INTERFACE_SERVER)
             {
-                DeleteSession(unixSessionPtr, mutexLocked);
+                if (le_thread_GetCurrent() != unixSessionPtr->threadRef)
+                {
+                    le_mem_AddRef(unixSessionPtr);
+                    le_event_QueueFunctionToThread(unixSessionPtr->threadRef,
+                                                   DeleteSessionQueued,
+                                                   unixSessionPtr,
+                                                   NULL);
+                }
+                else
+                {
+                    DeleteSession(unixSessionPtr, mutexLocked);
+                }
             }
             else if (unixSessionPtr->state != LE_MSG_SESSION_STATE_CLOSED)
             {
@@ -2540,3 +3733,77 @@ le_result_t le_msg_GetClientUserCreds
             LE_FATAL("Corrupted session type: %d", sessionRef->type);
     }
 }
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the shared memory region that a given Session's messages can keep their payloads in.
+ *
+ * @return  The region, or NULL if the session doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+msgShm_RegionRef_t msgSession_GetSharedMemRegion
+(
+    le_msg_SessionRef_t sessionRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (sessionRef->type != LE_MSG_SESSION_UNIX_SOCKET)
+    {
+        return NULL;
+    }
+
+    msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
+    return unixSessionPtr->shmRegionRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the durable queue that a given Session's one-way messages go through.
+ *
+ * @return  The queue, or NULL if the session doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+msgQueue_QueueRef_t msgSession_GetDurableQueue
+(
+    le_msg_SessionRef_t sessionRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (sessionRef->type != LE_MSG_SESSION_UNIX_SOCKET)
+    {
+        return NULL;
+    }
+
+    msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
+    return unixSessionPtr->queueRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the reader of the broadcast channel that a given (client-side) Session gets broadcasts
+ * through.
+ *
+ * @return  The reader, or NULL if the session doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+msgBcast_ReaderRef_t msgSession_GetBroadcastReader
+(
+    le_msg_SessionRef_t sessionRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (sessionRef->type != LE_MSG_SESSION_UNIX_SOCKET)
+    {
+        return NULL;
+    }
+
+    msgSession_UnixSession_t* unixSessionPtr = msgSession_GetUnixSessionPtr(sessionRef);
+    if (unixSessionPtr->clientPtr == NULL)
+    {
+        return NULL;
+    }
+    return unixSessionPtr->clientPtr->bcastReaderRef;
+}
@@ -12,6 +12,9 @@
 
 #include "messagingCommon.h"
 #include "messagingInterface.h"
+#include "messagingSharedMem.h"
+#include "messagingQueue.h"
+#include "messagingBroadcast.h"
 
 
 //--------------------------------------------------------------------------------------------------
@@ -31,19 +34,86 @@ typedef enum
 msgSession_SessionState_t;
 
 
+#if LE_CONFIG_IPC_SESSION_STATS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of buckets in a session's histogram of request-response latencies.  Bucket 0 counts the
+ * transactions that took less than 16 microseconds, and each following bucket those that took up
+ * to four times as long as the previous one; the last bucket counts all the longer ones.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MSGSESSION_LATENCY_BUCKETS  10
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Traffic statistics of a session, mainly for the Inspect tool.  Only updated by the thread that
+ * handles the session, except for the Transmit Queue counts, which are protected by the mutex.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t    sentCount;          ///< Number of messages sent.
+    uint64_t    receivedCount;      ///< Number of messages received.
+    uint64_t    sentBytes;          ///< Payload bytes of the messages sent.
+    uint64_t    receivedBytes;      ///< Payload bytes of the messages received.
+    size_t      transmitQueueLen;   ///< Number of messages on the Transmit Queue.
+    size_t      transmitQueueMax;   ///< Most messages that have been on the Transmit Queue.
+    uint32_t    latencyHistogram[MSGSESSION_LATENCY_BUCKETS];
+                                    ///< Client side: number of request-response transactions by
+                                    ///  time taken, from the request to its response.
+}
+msgSession_Stats_t;
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Part of a session's state that only client-side sessions need: the session's own handlers,
+ * the request window, and the broadcast channel reader.
+ *
+ * Servers may hold a session per client process, so this is kept out of the Session object and
+ * only allocated for sessions that use it (see msgSession_UnixSession_t::clientPtr).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_List_t                   pendingQueue;   ///< Queue of request messages held back
+                                                    ///  because the request window is full.
+    uint32_t                        requestWindow;  ///< Max requests in flight (0 = unlimited).
+    uint32_t                        inFlightCount;  ///< Async requests sent or being sent that
+                                                    ///  are waiting for their response.
+    le_msg_ReceiveHandler_t         rxHandler;      ///< Receive handler function.
+    void*                           rxContextPtr;   ///< Receive handler's context pointer.
+    le_msg_SessionEventHandler_t    openHandler;    ///< Open handler function.
+    void*                           openContextPtr; ///< Open handler's context pointer.
+    le_msg_SessionEventHandler_t    closeHandler;   ///< Close handler function.
+    void*                           closeContextPtr;///< Close handler's context pointer.
+    msgBcast_ReaderRef_t            bcastReaderRef; ///< Reader of the service's broadcast
+                                                    ///  channel, or NULL.
+    bool                            isResumed;      ///< true if the open attempt in progress went
+                                                    ///  to the server's Resume Endpoint instead
+                                                    ///  of the Service Directory.
+}
+msgSession_ClientState_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Represents a client-server session.
  *
  * This same object is used to track the session on both the server side and the client side.
+ * Fields are ordered to avoid padding: servers keep one of these per connected client.
  */
 //--------------------------------------------------------------------------------------------------
 typedef struct msg_UnixSession
 {
     struct le_msg_Session           session;        ///< Generic session object.
-    le_dls_Link_t                   link;           ///< Used to link into the Session List.
     msgSession_SessionState_t       state;          ///< The state that the session is in.
+    le_dls_Link_t                   link;           ///< Used to link into the Session List.
     int                             socketFd;       ///< File descriptor for the connected socket.
+    int                             bcastEventFd;   ///< Server side: eventfd that wakes the client
+                                                    ///  up for broadcasts (-1 = no channel).
     le_thread_Ref_t                 threadRef;      ///< The thread that handles this session.
     le_fdMonitor_Ref_t              fdMonitorRef;   ///< File descriptor monitor for the socket.
     le_msg_InterfaceRef_t           interfaceRef;   ///< The interface being accessed.
@@ -57,12 +127,18 @@ typedef struct msg_UnixSession
                                                     /// processed.
 
     void*                           contextPtr;     ///< The session's context pointer.
-    le_msg_ReceiveHandler_t         rxHandler;      ///< Receive handler function.
-    void*                           rxContextPtr;   ///< Receive handler's context pointer.
-    le_msg_SessionEventHandler_t    openHandler;    ///< Open handler function.
-    void*                           openContextPtr; ///< Open handler's context pointer.
-    le_msg_SessionEventHandler_t    closeHandler;   ///< Close handler function.
-    void*                           closeContextPtr;///< Close handler's context pointer.
+    msgShm_RegionRef_t              shmRegionRef;   ///< Shared memory region for payloads, or
+                                                    ///  NULL if the session doesn't have one.
+    msgQueue_QueueRef_t             queueRef;       ///< Durable queue for one-way messages, or
+                                                    ///  NULL if the session doesn't have one.
+    msgSession_ClientState_t*       clientPtr;      ///< Client-side state.  Always there on the
+                                                    ///  client side; on the server side, only
+                                                    ///  once a handler has been set on the session.
+    bool                            isSubscribed;   ///< Server side: true = the client gets the
+                                                    ///  service's broadcasts.
+#if LE_CONFIG_IPC_SESSION_STATS
+    msgSession_Stats_t              stats;          ///< Traffic statistics.
+#endif
 }
 msgSession_UnixSession_t;
 
@@ -116,6 +192,46 @@ bool msgSession_IsOpen
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the shared memory region that a given Session's messages can keep their payloads in.
+ *
+ * @return  The region, or NULL if the session doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+msgShm_RegionRef_t msgSession_GetSharedMemRegion
+(
+    le_msg_SessionRef_t sessionRef
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the durable queue that a given Session's one-way messages go through.
+ *
+ * @return  The queue, or NULL if the session doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+msgQueue_QueueRef_t msgSession_GetDurableQueue
+(
+    le_msg_SessionRef_t sessionRef
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the reader of the broadcast channel that a given (client-side) Session gets broadcasts
+ * through.
+ *
+ * @return  The reader, or NULL if the session doesn't have one.
+ */
+//--------------------------------------------------------------------------------------------------
+msgBcast_ReaderRef_t msgSession_GetBroadcastReader
+(
+    le_msg_SessionRef_t sessionRef
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sends a given Message object through a given Session.
@@ -204,7 +320,8 @@ le_msg_SessionRef_t msgSession_GetSessionContainingLink
 le_msg_SessionRef_t msgSession_CreateServerSideSession
 (
     le_msg_ServiceRef_t serviceRef,
-    int                 fd          ///< [IN] File descriptor of socket connected to client.
+    int                 fd,         ///< [IN] File descriptor of socket connected to client.
+    bool                offerResume ///< [IN] true = hand the client a Resume Endpoint (if enabled).
 );
 
 
@@ -0,0 +1,491 @@
+/** @file messagingSharedMem.c
+ *
+ * @ref c_messaging implementation's "Shared Memory" module implementation.
+ *
+ * See @ref messaging.c for an overview of the @ref c_messaging implementation.
+ *
+ * When a server-side session is created for a protocol with large payloads, the server creates a
+ * memfd, maps it, and sends it to the client along with the session open response.  The client
+ * maps it too.  The region starts with a header, followed by a number of equally sized slots:
+ *
+ * @verbatim
+ *
+ *      +---------------+--------------------------+--------------------------+----
+ *      | RegionHeader  | SlotHeader | payload ... | SlotHeader | payload ... | ...
+ *      +---------------+--------------------------+--------------------------+----
+ *
+ * @endverbatim
+ *
+ * Each slot header holds a reference count that both processes update atomically.  A slot with
+ * a count of zero is free and can be taken by either side.  The count is held by each Message
+ * object whose payload lives in the slot, plus one for each descriptor that is in flight over
+ * the socket (added by the sender and adopted by the receiver), so the slot is freed by
+ * whichever side releases the last message that uses it.
+ *
+ * The region's size is sealed, so neither side can shrink it under the other.
+ *
+ * @warning Both processes can write to a slot at any time, so a receiver of a shared memory
+ * payload can't assume the payload doesn't change while it is being unpacked.  Only enable
+ * shared memory for sessions between processes that trust each other.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "messagingSharedMem.h"
+#include "fileDescriptor.h"
+
+#include <sys/mman.h>
+
+// =======================================
+//  PRIVATE DATA
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value of the magic field in a mapped region's header.
+ */
+//--------------------------------------------------------------------------------------------------
+#define REGION_MAGIC    0x4d475352  // "RSGM"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Slots are multiples of this size, so that two slots never share a cache line.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SLOT_ALIGNMENT  64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of a mapped region.  Written by the server before the region is shared,
+ * and never changed after that.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;         ///< Always REGION_MAGIC.
+    uint32_t slotCount;     ///< Number of slots in the region.
+    uint32_t slotSize;      ///< Size of each slot, including its header, in bytes.
+    uint32_t payloadSize;   ///< Size of the payload buffer in each slot, in bytes.
+}
+RegionHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of each slot.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t refCount;      ///< Number of references to the slot, from both processes.  0 = free.
+    uint32_t reserved;      ///< Keeps the payload 8-byte aligned.
+    uint8_t  payload[];     ///< Payload buffer.
+}
+SlotHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A process's view of a mapped region.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgShm_Region
+{
+    uint8_t*    basePtr;    ///< Start of the mapping.
+    size_t      mapSize;    ///< Size of the mapping, in bytes.
+    uint32_t    slotCount;  ///< Number of slots (copied from the header).
+    uint32_t    slotSize;   ///< Size of each slot (copied from the header).
+    uint32_t    nextSlot;   ///< Where to start looking for a free slot.
+}
+Region_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool from which Region objects are allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t RegionPoolRef;
+
+
+// =======================================
+//  PRIVATE FUNCTIONS
+// =======================================
+
+#if LE_CONFIG_MSG_SHARED_MEMORY
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the size of one slot for a given payload size.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t SlotSize
+(
+    size_t payloadSize
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return ((sizeof(SlotHeader_t) + payloadSize + SLOT_ALIGNMENT - 1) / SLOT_ALIGNMENT) *
+           SLOT_ALIGNMENT;
+}
+
+#endif /* end LE_CONFIG_MSG_SHARED_MEMORY */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a pointer to a slot's header.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline SlotHeader_t* GetSlotHeader
+(
+    Region_t*   regionPtr,
+    uint32_t    slot
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return (SlotHeader_t*)(regionPtr->basePtr + SLOT_ALIGNMENT + (size_t)slot * regionPtr->slotSize);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor for Region objects.  Unmaps the region.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RegionDestructor
+(
+    void* objPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Region_t* regionPtr = objPtr;
+
+    if (munmap(regionPtr->basePtr, regionPtr->mapSize) != 0)
+    {
+        LE_ERROR("munmap() failed (%m).");
+    }
+}
+
+
+#if LE_CONFIG_MSG_SHARED_MEMORY
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a Region object for a mapping.
+ */
+//--------------------------------------------------------------------------------------------------
+static Region_t* NewRegion
+(
+    void*   basePtr,
+    size_t  mapSize
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const RegionHeader_t* headerPtr = basePtr;
+    Region_t* regionPtr = le_mem_ForceAlloc(RegionPoolRef);
+
+    regionPtr->basePtr = basePtr;
+    regionPtr->mapSize = mapSize;
+    regionPtr->slotCount = headerPtr->slotCount;
+    regionPtr->slotSize = headerPtr->slotSize;
+    regionPtr->nextSlot = 0;
+
+    return regionPtr;
+}
+
+#endif /* end LE_CONFIG_MSG_SHARED_MEMORY */
+
+
+// =======================================
+//  PROTECTED (INTER-MODULE) FUNCTIONS
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes this module.  This must be called only once at start-up, before any other functions
+ * in this module are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgShm_Init
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    RegionPoolRef = le_mem_CreatePool("MsgShmRegion", sizeof(Region_t));
+    le_mem_SetDestructor(RegionPoolRef, RegionDestructor);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether sessions of a protocol with a given maximum payload size should use a shared
+ * memory region.
+ *
+ * @return true if shared memory is enabled and the payloads are large enough to benefit from it.
+ */
+//--------------------------------------------------------------------------------------------------
+bool msgShm_IsWorthwhile
+(
+    size_t payloadSize  ///< [IN] Maximum payload size of the protocol, in bytes.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_MSG_SHARED_MEMORY
+    // Besides saving copies, this guarantees that a descriptor is always shorter than a full
+    // message, which is how the receiver tells them apart.
+    return ((payloadSize >= LE_CONFIG_MSG_SHARED_MEMORY_MIN_PAYLOAD) &&
+            (payloadSize > sizeof(msgShm_Descriptor_t)));
+#else
+    LE_UNUSED(payloadSize);
+    return false;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a new shared memory region for a session.  This is done by the server side.
+ *
+ * @return A reference to the region, or NULL on failure (the session then works without one).
+ *
+ * @note The caller is responsible for sending *fdPtr to the client and then closing it.
+ */
+//--------------------------------------------------------------------------------------------------
+msgShm_RegionRef_t msgShm_CreateRegion
+(
+    size_t  payloadSize,    ///< [IN] Maximum payload size of the session's protocol, in bytes.
+    int*    fdPtr           ///< [OUT] File descriptor of the region, to be sent to the client.
+)
+//--------------------------------------------------------------------------------------------------
+{
+#if LE_CONFIG_MSG_SHARED_MEMORY
+    const uint32_t slotCount = LE_CONFIG_MSG_SHARED_MEMORY_SLOTS;
+    const size_t slotSize = SlotSize(payloadSize);
+    const size_t mapSize = SLOT_ALIGNMENT + slotCount * slotSize;
+
+    LE_ASSERT(sizeof(RegionHeader_t) <= SLOT_ALIGNMENT);
+
+    if (slotSize > UINT32_MAX)
+    {
+        return NULL;
+    }
+
+    int fd = memfd_create("le_msg", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0)
+    {
+        LE_WARN("memfd_create() failed (%m).  Session will not use shared memory.");
+        return NULL;
+    }
+
+    if ((ftruncate(fd, mapSize) != 0) ||
+        (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0))
+    {
+        LE_WARN("Failed to size shared memory region (%m).  Session will not use shared memory.");
+        fd_Close(fd);
+        return NULL;
+    }
+
+    void* basePtr = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (basePtr == MAP_FAILED)
+    {
+        LE_WARN("mmap() failed (%m).  Session will not use shared memory.");
+        fd_Close(fd);
+        return NULL;
+    }
+
+    // A new memfd is zero-filled, so all the slots start out free.
+    RegionHeader_t* headerPtr = basePtr;
+    headerPtr->magic = REGION_MAGIC;
+    headerPtr->slotCount = slotCount;
+    headerPtr->slotSize = slotSize;
+    headerPtr->payloadSize = payloadSize;
+
+    *fdPtr = fd;
+    return NewRegion(basePtr, mapSize);
+#else
+    LE_UNUSED(payloadSize);
+    LE_UNUSED(fdPtr);
+    return NULL;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps a shared memory region received from the server.  This is done by the client side.
+ *
+ * @return A reference to the region, or NULL if it could not be mapped or doesn't match the
+ *         protocol (the session then works without one).
+ *
+ * @note Always closes fd.
+ */
+//--------------------------------------------------------------------------------------------------
+msgShm_RegionRef_t msgShm_AttachRegion
+(
+    int     fd,             ///< [IN] File descriptor received from the server.
+    size_t  payloadSize     ///< [IN] Maximum payload size of the session's protocol, in bytes.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Region_t* regionPtr = NULL;
+
+#if LE_CONFIG_MSG_SHARED_MEMORY
+    struct stat st;
+
+    // The server must not be able to shrink the region under us.
+    int seals = fcntl(fd, F_GET_SEALS);
+    if ((seals < 0) || !(seals & F_SEAL_SHRINK))
+    {
+        LE_WARN("Shared memory region is not sealed.  Session will not use shared memory.");
+    }
+    else if ((fstat(fd, &st) != 0) || (st.st_size < SLOT_ALIGNMENT))
+    {
+        LE_WARN("Bad shared memory region.  Session will not use shared memory.");
+    }
+    else
+    {
+        size_t mapSize = st.st_size;
+        void* basePtr = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        if (basePtr == MAP_FAILED)
+        {
+            LE_WARN("mmap() failed (%m).  Session will not use shared memory.");
+        }
+        else
+        {
+            const RegionHeader_t* headerPtr = basePtr;
+
+            if ((headerPtr->magic != REGION_MAGIC) ||
+                (headerPtr->payloadSize != payloadSize) ||
+                (headerPtr->slotSize != SlotSize(payloadSize)) ||
+                (headerPtr->slotCount == 0) ||
+                (headerPtr->slotCount > (mapSize - SLOT_ALIGNMENT) / headerPtr->slotSize))
+            {
+                LE_WARN("Shared memory region doesn't match protocol.  "
+                        "Session will not use shared memory.");
+                munmap(basePtr, mapSize);
+            }
+            else
+            {
+                regionPtr = NewRegion(basePtr, mapSize);
+            }
+        }
+    }
+#else
+    LE_UNUSED(payloadSize);
+#endif
+
+    fd_Close(fd);
+
+    return regionPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocates a free slot in a region.  The slot starts with a reference count of one.
+ *
+ * @return Pointer to the slot's payload buffer, or NULL if all the slots are in use.
+ */
+//--------------------------------------------------------------------------------------------------
+void* msgShm_AllocSlot
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region to allocate from.
+    uint32_t*           slotPtr     ///< [OUT] Index of the allocated slot.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint32_t start = LE_ATOMIC_LOAD(&regionRef->nextSlot, LE_ATOMIC_ORDER_RELAXED);
+    uint32_t i;
+
+    for (i = 0; i < regionRef->slotCount; i++)
+    {
+        uint32_t slot = (start + i) % regionRef->slotCount;
+        SlotHeader_t* slotHeaderPtr = GetSlotHeader(regionRef, slot);
+
+        if (LE_SYNC_BOOL_COMPARE_AND_SWAP(&slotHeaderPtr->refCount, 0, 1))
+        {
+            LE_ATOMIC_STORE(&regionRef->nextSlot,
+                            (slot + 1) % regionRef->slotCount,
+                            LE_ATOMIC_ORDER_RELAXED);
+            *slotPtr = slot;
+            return slotHeaderPtr->payload;
+        }
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the payload buffer of a slot named by a descriptor received from the other side.
+ *
+ * @return Pointer to the slot's payload buffer, or NULL if the slot index is not valid.
+ */
+//--------------------------------------------------------------------------------------------------
+void* msgShm_GetSlot
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region the slot is in.
+    uint32_t            slot        ///< [IN] Index of the slot.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (slot >= regionRef->slotCount)
+    {
+        return NULL;
+    }
+
+    return GetSlotHeader(regionRef, slot)->payload;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a reference to a slot.  This is done by the sender on behalf of the receiver before a
+ * descriptor is sent, so that the slot stays allocated while the descriptor is in flight.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgShm_AddSlotRef
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region the slot is in.
+    uint32_t            slot        ///< [IN] Index of the slot.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(slot < regionRef->slotCount);
+
+    LE_ATOMIC_ADD_FETCH(&GetSlotHeader(regionRef, slot)->refCount, 1, LE_ATOMIC_ORDER_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Releases a reference to a slot.  The slot becomes free for either side to allocate when the
+ * last reference is released.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgShm_ReleaseSlot
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region the slot is in.
+    uint32_t            slot        ///< [IN] Index of the slot.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(slot < regionRef->slotCount);
+
+    uint32_t* refCountPtr = &GetSlotHeader(regionRef, slot)->refCount;
+    uint32_t refCount;
+
+    // Don't let a misbehaving peer make the count wrap around.
+    do
+    {
+        refCount = LE_ATOMIC_LOAD(refCountPtr, LE_ATOMIC_ORDER_RELAXED);
+        if (refCount == 0)
+        {
+            LE_ERROR("Shared memory slot %" PRIu32 " released too many times.", slot);
+            return;
+        }
+    }
+    while (!LE_SYNC_BOOL_COMPARE_AND_SWAP(refCountPtr, refCount, refCount - 1));
+}
@@ -0,0 +1,149 @@
+/** @file messagingSharedMem.h
+ *
+ * @ref c_messaging implementation's "Shared Memory" module's inter-module interface definitions.
+ *
+ * A session whose protocol carries large payloads can be given a region of shared memory (a
+ * memfd mapped by both the client and the server) that is split into fixed-size payload slots.
+ * A message whose payload lives in one of those slots is sent over the socket as a small
+ * descriptor naming the slot, instead of copying the whole payload into and out of the kernel.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_MESSAGING_SHARED_MEM_H_INCLUDE_GUARD
+#define LEGATO_MESSAGING_SHARED_MEM_H_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a shared memory region.  Regions are reference counted memory pool objects;
+ * use le_mem_AddRef() and le_mem_Release() to hold and release them.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct msgShm_Region* msgShm_RegionRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * What is sent over the socket, after the transaction ID, in place of a payload that lives in a
+ * shared memory slot.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;     ///< Always MSGSHM_DESCRIPTOR_MAGIC.
+    uint32_t slot;      ///< Index of the slot holding the payload.
+}
+msgShm_Descriptor_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value of the magic field in a msgShm_Descriptor_t.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MSGSHM_DESCRIPTOR_MAGIC 0x4d534853  // "SHSM"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializes this module.  This must be called only once at start-up, before any other functions
+ * in this module are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgShm_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether sessions of a protocol with a given maximum payload size should use a shared
+ * memory region.
+ *
+ * @return true if shared memory is enabled and the payloads are large enough to benefit from it.
+ */
+//--------------------------------------------------------------------------------------------------
+bool msgShm_IsWorthwhile
+(
+    size_t payloadSize  ///< [IN] Maximum payload size of the protocol, in bytes.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a new shared memory region for a session.  This is done by the server side.
+ *
+ * @return A reference to the region, or NULL on failure (the session then works without one).
+ *
+ * @note The caller is responsible for sending *fdPtr to the client and then closing it.
+ */
+//--------------------------------------------------------------------------------------------------
+msgShm_RegionRef_t msgShm_CreateRegion
+(
+    size_t  payloadSize,    ///< [IN] Maximum payload size of the session's protocol, in bytes.
+    int*    fdPtr           ///< [OUT] File descriptor of the region, to be sent to the client.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps a shared memory region received from the server.  This is done by the client side.
+ *
+ * @return A reference to the region, or NULL if it could not be mapped or doesn't match the
+ *         protocol (the session then works without one).
+ *
+ * @note Always closes fd.
+ */
+//--------------------------------------------------------------------------------------------------
+msgShm_RegionRef_t msgShm_AttachRegion
+(
+    int     fd,             ///< [IN] File descriptor received from the server.
+    size_t  payloadSize     ///< [IN] Maximum payload size of the session's protocol, in bytes.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocates a free slot in a region.  The slot starts with a reference count of one.
+ *
+ * @return Pointer to the slot's payload buffer, or NULL if all the slots are in use.
+ */
+//--------------------------------------------------------------------------------------------------
+void* msgShm_AllocSlot
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region to allocate from.
+    uint32_t*           slotPtr     ///< [OUT] Index of the allocated slot.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the payload buffer of a slot named by a descriptor received from the other side.
+ *
+ * @return Pointer to the slot's payload buffer, or NULL if the slot index is not valid.
+ */
+//--------------------------------------------------------------------------------------------------
+void* msgShm_GetSlot
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region the slot is in.
+    uint32_t            slot        ///< [IN] Index of the slot.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a reference to a slot.  This is done by the sender on behalf of the receiver before a
+ * descriptor is sent, so that the slot stays allocated while the descriptor is in flight.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgShm_AddSlotRef
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region the slot is in.
+    uint32_t            slot        ///< [IN] Index of the slot.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Releases a reference to a slot.  The slot becomes free for either side to allocate when the
+ * last reference is released.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgShm_ReleaseSlot
+(
+    msgShm_RegionRef_t  regionRef,  ///< [IN] Region the slot is in.
+    uint32_t            slot        ///< [IN] Index of the slot.
+);
+
+#endif // LEGATO_MESSAGING_SHARED_MEM_H_INCLUDE_GUARD
@@ -51,6 +51,7 @@ typedef struct pipeline
     le_thread_Ref_t attachedThread; ///< Reference to the thread that created this pipeline.
     le_event_HandlerRef_t eventHandler; ///< Ref to signal event handler (NULL if not started).
     size_t numRunningProcs;     ///< Number of processes running in this pipeline.
+    int failStatus;             ///< Status of the first process that failed, or 0 if none has.
 }
 Pipeline_t;
 
@@ -236,6 +237,7 @@ pipeline_Ref_t pipeline_Create
     pipelinePtr->outputFd = -1;
     pipelinePtr->eventHandler = NULL;
     pipelinePtr->numRunningProcs = 0;
+    pipelinePtr->failStatus = 0;
 
     // Register a thread destructor to be called to clean up this pipeline if the thread dies.
     pipelinePtr->threadDestructor = le_thread_AddDestructor(ThreadDeathHandler, pipelinePtr);
@@ -542,6 +544,11 @@ static le_result_t HandleDeadChild
     }
     else
     {
+        if (pipelinePtr->failStatus == 0)
+        {
+            pipelinePtr->failStatus = status;
+        }
+
         if (WIFEXITED(status))
         {
             LE_DEBUG("Pipeline child process %d exited with code %d.", pid, WEXITSTATUS(status));
@@ -568,7 +575,10 @@ static le_result_t HandleDeadChild
         //          function MUST be the last thing we do with the pipeline.
         if (pipelinePtr->terminationFunc != NULL)
         {
-            pipelinePtr->terminationFunc(pipelinePtr, status);
+            // Like a shell's "pipefail", an earlier failure takes precedence over the last
+            // process's success, since the last process may not be able to tell that its input
+            // was cut short.
+            pipelinePtr->terminationFunc(pipelinePtr, pipelinePtr->failStatus);
             return LE_TERMINATED;
         }
     }
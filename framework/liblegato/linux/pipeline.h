@@ -267,7 +267,8 @@ void pipeline_CreatePipe
  *
  * @param pipeline Reference to the pipeline that terminated.
  *
- * @param status Status code from the last process in the pipeline.  Must be processed using
+ * @param status Status code from the first process in the pipeline that failed, or from the last
+ *               process if none failed before it terminated.  Must be processed using
  *               WIFEXITED(), WEXITSTATUS(), WIFSIGNALED(), WTERMSIG(), etc.  See 'man waitpid'.
  */
 //--------------------------------------------------------------------------------------------------
@@ -318,22 +318,34 @@ static void ShowStackSignalHandler
     fd = open(sigString, O_RDONLY);
     if (-1 != fd)
     {
-        int rc, len;
-        // We cannot use stdio(3) services. Print line by line
+        int rc;
+        size_t len = 0;
+        // We cannot use stdio(3) services. Read the map a buffer at a time (one byte per read(2)
+        // takes a system call per character, which stalls the crashing process), but still
+        // print it line by line.
         do
         {
-            for (len = 0; len < sizeof(sigString); len++)
+            rc = read( fd, sigString + len, sizeof(sigString) - len );
+            if (0 < rc)
             {
-                rc = read( fd, sigString + len, 1 );
-                if (0 >= rc)
-                {
-                     break;
-                }
-                if ('\n' == sigString[len])
-                {
-                    SIG_WRITE(sigString, len + 1);
-                    break;
-                }
+                len += rc;
+            }
+
+            size_t lineLen = len;
+            while ((0 < lineLen) && ('\n' != sigString[lineLen - 1]))
+            {
+                lineLen--;
+            }
+            if ((0 >= rc) || ((0 == lineLen) && (sizeof(sigString) == len)))
+            {
+                // End of the map, or a line too long for the buffer.
+                lineLen = len;
+            }
+            if (0 < lineLen)
+            {
+                SIG_WRITE(sigString, lineLen);
+                len -= lineLen;
+                memmove(sigString, sigString + lineLen, len);
             }
         }
         while( 0 < rc );
@@ -434,6 +446,9 @@ void le_sig_InstallShowStackHandler
             LE_WARN("Incorrect GDBSERVER_PORT=%s. Discarded...", gdbPtr);
         }
     }
+
+    // Get the stack unwinder loaded now, rather than in the handler of a crashing process.
+    backtrace_Init();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -116,6 +116,33 @@
 //********  SMACK is enabled.  *******************************************************************//
 #if LE_CONFIG_ENABLE_SMACK
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the buffer that rules are collected in between smack_StartRuleBatch() and
+ * smack_CommitRuleBatch().  smackfs truncates writes of a page or more, so this is kept under the
+ * smallest page size.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RULE_BATCH_BYTES                    4095
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Newline separated rules waiting to be written to the SMACK load file, and their length.
+ */
+//--------------------------------------------------------------------------------------------------
+static char RuleBatch[RULE_BATCH_BYTES];
+static size_t RuleBatchLen = 0;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * true between smack_StartRuleBatch() and smack_CommitRuleBatch().
+ */
+//--------------------------------------------------------------------------------------------------
+static bool RuleBatchActive = false;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set SMACK netlabel exception to grant applications permission to communicate with the Internet
@@ -536,6 +563,105 @@ le_result_t smack_SetLabelExec
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes one or more rules to the SMACK load file in a single write.
+ *
+ * @note If there's an error, this function will kill the calling process.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WriteRules
+(
+    const char* rulesPtr,           ///< [IN] Rules, separated by newlines if there are several.
+    size_t rulesLength              ///< [IN] Number of bytes to write.
+)
+{
+    // Open the SMACK load file.
+    int fd;
+
+    do
+    {
+        fd = open(SMACK_LOAD_FILE, O_WRONLY);
+    }
+    while ( (fd == -1) && (errno == EINTR) );
+
+    LE_FATAL_IF(fd == -1, "Could not open %s.  %m.\n", SMACK_LOAD_FILE);
+
+    // Write the rules to the SMACK load file.
+    ssize_t numBytes = 0;
+
+    do
+    {
+        numBytes = write(fd, rulesPtr, rulesLength);
+    }
+    while ( (numBytes == -1) && (errno == EINTR) );
+
+    LE_FATAL_IF(numBytes != rulesLength, "Could not write SMACK rules '%.*s'.  %m.",
+                (int)rulesLength, rulesPtr);
+
+    fd_Close(fd);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes the rules queued since the batch was started or last flushed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FlushRuleBatch
+(
+    void
+)
+{
+    if (RuleBatchLen > 0)
+    {
+        WriteRules(RuleBatch, RuleBatchLen);
+
+        LE_DEBUG("Loaded %" PRIuS " bytes of SMACK rules in one write.", RuleBatchLen);
+
+        RuleBatchLen = 0;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a batch of SMACK rules.  Rules set with smack_SetRule() are queued until
+ * smack_CommitRuleBatch() is called, and then loaded with as few writes to smackfs as possible.
+ *
+ * Does nothing if LE_CONFIG_SMACK_BATCH_RULES is not selected: the rules are then loaded one by
+ * one as they are set.
+ */
+//--------------------------------------------------------------------------------------------------
+void smack_StartRuleBatch
+(
+    void
+)
+{
+    LE_ASSERT(!RuleBatchActive);
+
+    RuleBatchActive = LE_CONFIG_IS_ENABLED(LE_CONFIG_SMACK_BATCH_RULES);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Loads the rules queued since smack_StartRuleBatch() was called, and ends the batch.
+ *
+ * @note If there's an error, this function will kill the calling process.
+ */
+//--------------------------------------------------------------------------------------------------
+void smack_CommitRuleBatch
+(
+    void
+)
+{
+    FlushRuleBatch();
+
+    RuleBatchActive = false;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets an explicit smack rule.
@@ -570,30 +696,25 @@ void smack_SetRule
     char rule[SMACK_RULE_STR_BYTES];
     MakeRuleStr(subjectLabelPtr, accessModePtr, objectLabelPtr, rule, sizeof(rule));
 
-    // Open the SMACK load file.
-    int fd;
-
-    do
+    if (RuleBatchActive)
     {
-        fd = open(SMACK_LOAD_FILE, O_WRONLY);
-    }
-    while ( (fd == -1) && (errno == EINTR) );
+        size_t ruleLength = strlen(rule);
 
-    LE_FATAL_IF(fd == -1, "Could not open %s.  %m.\n", SMACK_LOAD_FILE);
+        // Make room for the rule and its newline.
+        if (RuleBatchLen + ruleLength + 1 > sizeof(RuleBatch))
+        {
+            FlushRuleBatch();
+        }
 
-    // Write the rule to the SMACK load file.
-    int numBytes = 0;
-    size_t ruleLength = strlen(rule);
+        memcpy(RuleBatch + RuleBatchLen, rule, ruleLength);
+        RuleBatchLen += ruleLength;
+        RuleBatch[RuleBatchLen++] = '\n';
 
-    do
-    {
-        numBytes = write(fd, rule, ruleLength);
+        LE_DEBUG("Queued SMACK rule '%s'.", rule);
+        return;
     }
-    while ( (numBytes == -1) && (errno == EINTR) );
 
-    LE_FATAL_IF(numBytes != ruleLength, "Could not write SMACK rule '%s'.  %m.", rule);
-
-    fd_Close(fd);
+    WriteRules(rule, strlen(rule));
 
     LE_DEBUG("Set SMACK rule '%s'.", rule);
 }
@@ -618,6 +739,9 @@ bool smack_HasAccess
     CheckLabel(subjectLabelPtr);
     CheckLabel(objectLabelPtr);
 
+    // The answer must take the rules queued so far into account.
+    FlushRuleBatch();
+
     // Create the SMACK rule.
     char rule[SMACK_RULE_STR_BYTES];
     MakeRuleStr(subjectLabelPtr, accessModePtr, objectLabelPtr, rule, sizeof(rule));
@@ -672,6 +796,9 @@ void smack_RevokeSubject
     const char* subjectLabelPtr     ///< [IN] Subject label.
 )
 {
+    // Rules queued for the subject must not outlive the revocation.
+    FlushRuleBatch();
+
     // Open the SMACK revoke file.
     int fd;
 
@@ -1024,6 +1151,35 @@ le_result_t smack_SetLabelExec
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a batch of SMACK rules.  Rules set with smack_SetRule() are queued until
+ * smack_CommitRuleBatch() is called, and then loaded with as few writes to smackfs as possible.
+ */
+//--------------------------------------------------------------------------------------------------
+void smack_StartRuleBatch
+(
+    void
+)
+{
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Loads the rules queued since smack_StartRuleBatch() was called, and ends the batch.
+ *
+ * @note If there is an error this function will kill the calling process.
+ */
+//--------------------------------------------------------------------------------------------------
+void smack_CommitRuleBatch
+(
+    void
+)
+{
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets an explicit SMACK rule.
@@ -206,6 +206,35 @@ void smack_SetRule
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a batch of SMACK rules.  Rules set with smack_SetRule() are queued until
+ * smack_CommitRuleBatch() is called, and then loaded with as few writes to smackfs as possible,
+ * instead of one write each.
+ *
+ * smack_HasAccess() and smack_RevokeSubject() load the rules queued so far before they run, so
+ * they behave the same inside a batch as outside.  Batches can't be nested.
+ */
+//--------------------------------------------------------------------------------------------------
+void smack_StartRuleBatch
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Loads the rules queued since smack_StartRuleBatch() was called, and ends the batch.
+ *
+ * @note If there is an error this function will kill the calling process.
+ */
+//--------------------------------------------------------------------------------------------------
+void smack_CommitRuleBatch
+(
+    void
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Checks whether a subject has the specified access mode for an object.
@@ -0,0 +1,172 @@
+//--------------------------------------------------------------------------------------------------
+/** @file statsSnapshot.c
+ *
+ * Statistics snapshots, published by every process for the Inspect tool.  See statsSnapshot.h.
+ *
+ * The snapshot is refreshed by a non-wakeup timer with some slack, so that it doesn't wake the
+ * system up or add wake-ups of its own.  It grows (never shrinks) when the process has more pools
+ * than there is room for, so a reader never maps past its end.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "statsSnapshot.h"
+#include "fileDescriptor.h"
+
+#include <sys/mman.h>
+
+#if LE_CONFIG_INSPECT_SNAPSHOT
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of pools there is room for at first.  Most processes have fewer.
+ */
+//--------------------------------------------------------------------------------------------------
+#define INITIAL_MAX_POOLS   64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The snapshot's memfd and mapping.
+ */
+//--------------------------------------------------------------------------------------------------
+static int SnapshotFd = -1;
+static statsSnapshot_Header_t* SnapshotPtr;
+static size_t SnapshotSize;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the size of a snapshot with room for a given number of pools.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t GetSnapshotSize
+(
+    size_t maxPools
+)
+{
+    return sizeof(statsSnapshot_Header_t) + (maxPools * sizeof(mem_PoolSnapshot_t));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make room for a given number of pools.
+ *
+ * @return LE_OK, or LE_FAULT if the memfd couldn't be grown or mapped.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Resize
+(
+    size_t maxPools
+)
+{
+    size_t size = GetSnapshotSize(maxPools);
+
+    if (ftruncate(SnapshotFd, size) != 0)
+    {
+        LE_WARN("Can't grow the statistics snapshot (%m).");
+        return LE_FAULT;
+    }
+
+    void* mapPtr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, SnapshotFd, 0);
+    if (mapPtr == MAP_FAILED)
+    {
+        LE_WARN("Can't map the statistics snapshot (%m).");
+        return LE_FAULT;
+    }
+
+    if (SnapshotPtr != NULL)
+    {
+        munmap(SnapshotPtr, SnapshotSize);
+    }
+
+    SnapshotPtr = mapPtr;
+    SnapshotSize = size;
+    SnapshotPtr->maxPools = maxPools;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refresh the snapshot.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Refresh
+(
+    le_timer_Ref_t timerRef     ///< [IN] Refresh timer.
+)
+{
+    // A child forked without exec'ing shares the mapping, but isn't the one it describes.
+    if (SnapshotPtr->pid != getpid())
+    {
+        le_timer_Delete(timerRef);
+        return;
+    }
+
+    struct timespec now;
+    LE_ASSERT(clock_gettime(CLOCK_MONOTONIC, &now) == 0);
+
+    uint32_t seq = SnapshotPtr->seq;
+
+    __atomic_store_n(&SnapshotPtr->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    size_t numPools = mem_GetPoolSnapshots(SnapshotPtr->pools, SnapshotPtr->maxPools);
+
+    if ((numPools > SnapshotPtr->maxPools) && (Resize(numPools * 2) == LE_OK))
+    {
+        numPools = mem_GetPoolSnapshots(SnapshotPtr->pools, SnapshotPtr->maxPools);
+    }
+
+    SnapshotPtr->numPools = (numPools < SnapshotPtr->maxPools ? numPools : SnapshotPtr->maxPools);
+    SnapshotPtr->timeNs = ((uint64_t)now.tv_sec * 1000000000) + (uint64_t)now.tv_nsec;
+
+    __atomic_store_n(&SnapshotPtr->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+#endif /* end LE_CONFIG_INSPECT_SNAPSHOT */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts publishing the process' statistics, from the calling thread's event loop.
+ */
+//--------------------------------------------------------------------------------------------------
+void statsSnapshot_Start
+(
+    void
+)
+{
+#if LE_CONFIG_INSPECT_SNAPSHOT
+    SnapshotFd = memfd_create(STATS_SNAPSHOT_MEMFD_NAME, MFD_CLOEXEC);
+    if (SnapshotFd < 0)
+    {
+        LE_DEBUG("memfd_create() failed (%m).  Statistics snapshots are not published.");
+        return;
+    }
+
+    if (Resize(INITIAL_MAX_POOLS) != LE_OK)
+    {
+        fd_Close(SnapshotFd);
+        SnapshotFd = -1;
+        return;
+    }
+
+    // A new memfd is zero-filled, so the snapshot starts out empty.
+    SnapshotPtr->magic = STATS_SNAPSHOT_MAGIC;
+    SnapshotPtr->pid = getpid();
+    SnapshotPtr->intervalMs = LE_CONFIG_INSPECT_SNAPSHOT_INTERVAL_MS;
+
+    le_timer_Ref_t timerRef = le_timer_Create("InspectSnapshot");
+    LE_ASSERT_OK(le_timer_SetHandler(timerRef, Refresh));
+    LE_ASSERT_OK(le_timer_SetMsInterval(timerRef, LE_CONFIG_INSPECT_SNAPSHOT_INTERVAL_MS));
+    LE_ASSERT_OK(le_timer_SetMsSlack(timerRef, LE_CONFIG_INSPECT_SNAPSHOT_INTERVAL_MS / 4));
+    LE_ASSERT_OK(le_timer_SetRepeat(timerRef, 0));
+    LE_ASSERT_OK(le_timer_SetWakeup(timerRef, false));
+    LE_ASSERT_OK(le_timer_Start(timerRef));
+#endif
+}
@@ -0,0 +1,71 @@
+//--------------------------------------------------------------------------------------------------
+/** @file statsSnapshot.h
+ *
+ * Statistics snapshots, published by every process for the Inspect tool.
+ *
+ * A process publishes its memory pools' statistics in a memfd named STATS_SNAPSHOT_MEMFD_NAME,
+ * which its main thread refreshes every LE_CONFIG_INSPECT_SNAPSHOT_INTERVAL_MS milliseconds.  The
+ * Inspect tool finds the memfd among the process' file descriptors (in /proc/<pid>/fd), maps it
+ * and copies it, which is much cheaper than stopping the process and walking its lists through
+ * ptrace, and never has to be retried because a list changed under it.
+ *
+ * The memfd holds a statsSnapshot_Header_t followed by an array of mem_PoolSnapshot_t.  The
+ * header's sequence number makes it a sequence lock: it is odd while the snapshot is being
+ * written, so a reader's copy is consistent if the sequence number was even and unchanged before
+ * and after the copy.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_STATS_SNAPSHOT_H_INCLUDE_GUARD
+#define LEGATO_STATS_SNAPSHOT_H_INCLUDE_GUARD
+
+#include "mem.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Name of the memfd, as shown in the target of its /proc/<pid>/fd link ("/memfd:<name>").
+ */
+//--------------------------------------------------------------------------------------------------
+#define STATS_SNAPSHOT_MEMFD_NAME   "le_inspect"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Value of the magic field of the header.  Changes whenever the layout does.
+ */
+//--------------------------------------------------------------------------------------------------
+#define STATS_SNAPSHOT_MAGIC        0x31505353  // "SSP1"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header at the start of a snapshot.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t    magic;          ///< Always STATS_SNAPSHOT_MAGIC.
+    uint32_t    seq;            ///< Sequence number.  Odd while the snapshot is being written.
+    int32_t     pid;            ///< Process that writes the snapshot.
+    uint32_t    intervalMs;     ///< Time between refreshes, in milliseconds.
+    uint64_t    timeNs;         ///< When the snapshot was taken (CLOCK_MONOTONIC), in ns.
+    uint32_t    maxPools;       ///< Number of pools there is room for.
+    uint32_t    numPools;       ///< Number of pools in the snapshot.
+    mem_PoolSnapshot_t pools[]; ///< The pools' statistics.
+}
+statsSnapshot_Header_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts publishing the process' statistics, from the calling thread's event loop.  Does nothing
+ * if the framework is built without LE_CONFIG_INSPECT_SNAPSHOT.
+ */
+//--------------------------------------------------------------------------------------------------
+void statsSnapshot_Start
+(
+    void
+);
+
+
+#endif // LEGATO_STATS_SNAPSHOT_H_INCLUDE_GUARD
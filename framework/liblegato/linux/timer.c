@@ -216,6 +216,8 @@ timer_ThreadRec_t* fa_timer_InitThread
     timer_LinuxThreadRec_t* localThreadRecPtr =  le_mem_ForceAlloc(LinuxThreadRecPoolRef);
 
     localThreadRecPtr->timerFD = -1;
+    localThreadRecPtr->fdMonitorRef = NULL;
+    localThreadRecPtr->priority = LE_EVENT_PRIORITY_NORMAL;
 
     return &localThreadRecPtr->portableThreadRec;
 }
@@ -321,6 +323,14 @@ void fa_timer_RestartTimer
                      timer_LinuxThreadRec_t,
                      portableThreadRec);
 
+    // Dispatch the expiry with the priority of the timer it is armed for.
+    le_event_Priority_t priority = threadRecPtr->firstTimerPtr->priority;
+    if (priority != localThreadRecPtr->priority)
+    {
+        le_fdMonitor_SetPriority(localThreadRecPtr->fdMonitorRef, priority);
+        localThreadRecPtr->priority = priority;
+    }
+
     // Start the actual timerFD
     if (timerfd_settime(localThreadRecPtr->timerFD, TFD_TIMER_ABSTIME, timerIntervalPtr, NULL) < 0 )
     {
@@ -391,5 +401,6 @@ void fa_timer_Start
                                                            TimerFdHandler,
                                                            POLLIN);
         le_fdMonitor_SetContextPtr(fdMonitor, threadRecPtr);
+        localThreadRecPtr->fdMonitorRef = fdMonitor;
     }
 }
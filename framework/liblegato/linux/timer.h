@@ -24,6 +24,8 @@ typedef struct
 {
     timer_ThreadRec_t portableThreadRec; ///< portable timer structure
     int timerFD;                         ///< System timer used by the thread.
+    le_fdMonitor_Ref_t fdMonitorRef;     ///< FD Monitor of the timerFD.
+    le_event_Priority_t priority;        ///< Priority the FD Monitor currently has.
 }
 timer_LinuxThreadRec_t;
 
@@ -0,0 +1,121 @@
+//--------------------------------------------------------------------------------------------------
+/** @file traceMarker.c
+ *
+ * Linux implementation of trace markers, written to ftrace's trace_marker file.  The kernel time
+ * stamps each write and merges the markers of all processes with its own trace events, so a
+ * trace of the whole system is taken by enabling tracing, running the scenario and reading the
+ * "trace" file (or with trace-cmd), then converted with legato-trace2json.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "fa/traceMarker.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of bytes in a trace marker.
+ */
+//--------------------------------------------------------------------------------------------------
+#define TRACE_MARKER_MAX_BYTES  256
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File descriptor of the trace_marker file, or -1 if tracing is not available.
+ */
+//--------------------------------------------------------------------------------------------------
+static int MarkerFd = -1;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the trace_marker file, from the tracefs mount point or its older location in debugfs.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_traceMarker_Init
+(
+    void
+)
+{
+    static const char* const paths[] =
+    {
+        "/sys/kernel/tracing/trace_marker",
+        "/sys/kernel/debug/tracing/trace_marker"
+    };
+    size_t i;
+
+    for (i = 0; (i < NUM_ARRAY_MEMBERS(paths)) && (MarkerFd < 0); i++)
+    {
+        MarkerFd = open(paths[i], O_WRONLY | O_CLOEXEC);
+    }
+
+    if (MarkerFd < 0)
+    {
+        LE_DEBUG("Trace markers disabled, trace_marker can't be opened (%m).");
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether trace markers can be written.
+ *
+ * @return true if they can.
+ */
+//--------------------------------------------------------------------------------------------------
+bool fa_traceMarker_IsEnabled
+(
+    void
+)
+{
+    return (MarkerFd >= 0);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a trace marker.
+ *
+ * The record is written with a single write() so that records from different threads and
+ * processes never mix.  Failures are ignored: tracing must not change the program's behaviour.
+ */
+//--------------------------------------------------------------------------------------------------
+void fa_traceMarker_Write
+(
+    char        type,       ///< [IN] Record type.
+    const char *format,     ///< [IN] printf-style format of the record's text, or NULL.
+    ...                     ///< [IN] Arguments.
+)
+{
+    char record[TRACE_MARKER_MAX_BYTES];
+    int  len;
+
+    len = snprintf(record, sizeof(record), "%c|%d", type, (int)getpid());
+
+    if (format != NULL)
+    {
+        va_list args;
+        int     textLen;
+
+        record[len++] = '|';
+
+        va_start(args, format);
+        textLen = vsnprintf(record + len, sizeof(record) - len, format, args);
+        va_end(args);
+
+        if (textLen > 0)
+        {
+            len += textLen;
+            if (len >= (int)sizeof(record))
+            {
+                len = sizeof(record) - 1;
+            }
+        }
+    }
+
+    if (write(MarkerFd, record, len) < 0)
+    {
+        // Nothing to do: the trace buffer may just be full or tracing turned off.
+    }
+}
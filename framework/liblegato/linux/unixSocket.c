@@ -14,6 +14,24 @@
 /// @note We use CMSG_SPACE to ensure this is big enough to hold the cmsghdr structures.
 #define CMSG_BUFF_SIZE (CMSG_SPACE(sizeof(int)) + CMSG_SPACE(sizeof(struct ucred)))
 
+/// Environment variables giving the number of listening sockets passed on to a process, and the
+/// process they are meant for (the same as systemd's).
+#define LISTEN_FDS_ENV  "LISTEN_FDS"
+#define LISTEN_PID_ENV  "LISTEN_PID"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ancillary (control) message buffer for one file descriptor, aligned for a struct cmsghdr.
+ * Used by the batch send and receive functions, which need one of these per message.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef union
+{
+    char            buff[CMSG_SPACE(sizeof(int))];
+    struct cmsghdr  align;
+}
+FdCmsgBuffer_t;
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -730,6 +748,516 @@ le_result_t unixSocket_ReceiveDataMsg
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a data message together with a number of file descriptors through a connected Unix domain
+ * datagram or sequenced-packet socket.  The file descriptors arrive at the receiver in the order
+ * they are given.  If the peer has closed its end, LE_COMM_ERROR is returned rather than a
+ * SIGPIPE being raised.
+ *
+ * @return
+ * - LE_OK if successful
+ * - LE_COMM_ERROR if the localSocketFd is not connected.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ * - LE_NO_MEMORY if the send socket is set to non-blocking and it doesn't have enough buffer
+ *                  space to send right now.
+ *
+ * @warning DO NOT SEND DIRECTORY FILE DESCRIPTORS.  That can be exploited to break out of chroot()
+ *          jails.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_SendMsgFds
+(
+    int localSocketFd,          ///< [IN] fd of the local socket that will be used to send.
+    void* dataPtr,              ///< [IN] Pointer to the data payload to be sent.
+    size_t dataSize,            ///< [IN] Number of bytes of data payload to be sent.
+    const int* fdsPtr,          ///< [IN] The file descriptors to be sent.
+    size_t fdCount              ///< [IN] Number of file descriptors (at most UNIXSOCKET_MAX_FDS).
+)
+//--------------------------------------------------------------------------------------------------
+{
+    union
+    {
+        char            buff[CMSG_SPACE(UNIXSOCKET_MAX_FDS * sizeof(int))];
+        struct cmsghdr  align;
+    }
+    cmsgBuffer;
+
+    struct msghdr msgHeader;
+    struct iovec ioVector;
+
+    LE_ASSERT(fdCount <= UNIXSOCKET_MAX_FDS);
+
+    memset(&msgHeader, 0, sizeof(msgHeader));
+
+    ioVector.iov_base = dataPtr;
+    ioVector.iov_len = dataSize;
+    msgHeader.msg_iov = &ioVector;
+    msgHeader.msg_iovlen = 1;
+
+    // All the file descriptors go in a single "send rights" control message.
+    if (fdCount > 0)
+    {
+        msgHeader.msg_control = cmsgBuffer.buff;
+        msgHeader.msg_controllen = CMSG_SPACE(fdCount * sizeof(int));
+
+        struct cmsghdr* cmsgHeaderPtr = CMSG_FIRSTHDR(&msgHeader);
+        cmsgHeaderPtr->cmsg_level = SOL_SOCKET;
+        cmsgHeaderPtr->cmsg_type = SCM_RIGHTS;
+        cmsgHeaderPtr->cmsg_len = CMSG_LEN(fdCount * sizeof(int));
+        memcpy(CMSG_DATA(cmsgHeaderPtr), fdsPtr, fdCount * sizeof(int));
+    }
+
+    ssize_t bytesSent;
+    do
+    {
+        bytesSent = sendmsg(localSocketFd, &msgHeader, MSG_NOSIGNAL);
+    }
+    while ((bytesSent < 0) && (errno == EINTR));
+
+    if (bytesSent < 0)
+    {
+        switch (errno)
+        {
+            case EAGAIN:  // Same as EWOULDBLOCK
+                return LE_NO_MEMORY;
+
+            case ENOTCONN:
+            case ECONNRESET:
+            case EPIPE:
+                LE_WARN("sendmsg() failed with errno %d (%m).", errno);
+                return LE_COMM_ERROR;
+
+            default:
+                LE_ERROR("sendmsg() failed with errno %d (%m).", errno);
+                return LE_FAULT;
+        }
+    }
+
+    if (bytesSent < dataSize)
+    {
+        LE_ERROR("The last %zu data bytes (of %zu total) were discarded by sendmsg()!",
+                 dataSize - bytesSent,
+                 dataSize);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receives a data message together with any file descriptors sent with it through a connected
+ * Unix domain datagram or sequenced-packet socket.  File descriptors beyond the number that the
+ * caller has room for are closed.
+ *
+ * @return
+ * - LE_OK if successful
+ * - LE_NO_MEMORY if more data was received than could fit in the buffer provided.
+ * - LE_WOULD_BLOCK if the socket is set non-blocking and there is nothing to be received.
+ * - LE_CLOSED if the connection closed.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_ReceiveMsgFds
+(
+    int localSocketFd,      ///< [IN] fd of local socket that will be used to receive the message.
+    void* dataBuffPtr,      ///< [OUT] Pointer to where the data payload will be put.
+    size_t* dataSizePtr,    ///< [IN+OUT] Size of the buffer, updated to the number of bytes
+                            ///     of data received.
+    int* fdsPtr,            ///< [OUT] Array to store the received file descriptors in.
+    size_t* fdCountPtr      ///< [IN+OUT] Size of the array (at most UNIXSOCKET_MAX_FDS), updated
+                            ///     to the number of file descriptors received.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    union
+    {
+        char            buff[CMSG_SPACE(UNIXSOCKET_MAX_FDS * sizeof(int))];
+        struct cmsghdr  align;
+    }
+    cmsgBuffer;
+
+    struct msghdr msgHeader;
+    struct iovec ioVector;
+    size_t maxFds = *fdCountPtr;
+
+    LE_ASSERT(maxFds <= UNIXSOCKET_MAX_FDS);
+
+    *fdCountPtr = 0;
+
+    memset(&msgHeader, 0, sizeof(msgHeader));
+
+    ioVector.iov_base = dataBuffPtr;
+    ioVector.iov_len = *dataSizePtr;
+    msgHeader.msg_iov = &ioVector;
+    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_control = cmsgBuffer.buff;
+    msgHeader.msg_controllen = sizeof(cmsgBuffer.buff);
+
+    *dataSizePtr = 0;
+
+    ssize_t bytesReceived;
+    do
+    {
+        bytesReceived = recvmsg(localSocketFd, &msgHeader, 0);
+    }
+    while ((bytesReceived < 0) && (errno == EINTR));
+
+    if (bytesReceived < 0)
+    {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            return LE_WOULD_BLOCK;
+        }
+        else if (errno == ECONNRESET)
+        {
+            return LE_CLOSED;
+        }
+        else
+        {
+            LE_ERROR("recvmsg() failed with errno %d (%m).", errno);
+            return LE_FAULT;
+        }
+    }
+
+    // Collect the file descriptors from all the "send rights" control messages received.
+    struct cmsghdr* cmsgHeaderPtr;
+    for (cmsgHeaderPtr = CMSG_FIRSTHDR(&msgHeader);
+         cmsgHeaderPtr != NULL;
+         cmsgHeaderPtr = CMSG_NXTHDR(&msgHeader, cmsgHeaderPtr))
+    {
+        if ((cmsgHeaderPtr->cmsg_level != SOL_SOCKET) || (cmsgHeaderPtr->cmsg_type != SCM_RIGHTS))
+        {
+            LE_ERROR("Received unexpected ancillary data message (level %d, type %d).",
+                     cmsgHeaderPtr->cmsg_level,
+                     cmsgHeaderPtr->cmsg_type);
+            continue;
+        }
+
+        size_t count = (cmsgHeaderPtr->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        size_t i;
+        for (i = 0; i < count; i++)
+        {
+            int fd;
+            memcpy(&fd, CMSG_DATA(cmsgHeaderPtr) + (i * sizeof(int)), sizeof(int));
+
+            if (*fdCountPtr < maxFds)
+            {
+                fdsPtr[(*fdCountPtr)++] = fd;
+            }
+            else
+            {
+                LE_WARN("Discarding extra received file descriptor.");
+                fd_Close(fd);
+            }
+        }
+    }
+
+    if ((msgHeader.msg_flags & MSG_CTRUNC) != 0)
+    {
+        LE_WARN("Ancillary data was discarded because it couldn't fit in our buffer.");
+    }
+    else if ((msgHeader.msg_controllen == 0) && (bytesReceived == 0))
+    {
+        return LE_CLOSED;
+    }
+
+    *dataSizePtr = bytesReceived;
+
+    if ((msgHeader.msg_flags & MSG_TRUNC) != 0)
+    {
+        return LE_NO_MEMORY;
+    }
+
+    return LE_OK;
+}
+
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a batch of data messages, each with an optional file descriptor, through a connected Unix
+ * domain datagram or sequenced-packet socket using a single system call where possible.
+ *
+ * Messages are sent in order.  If the socket runs out of buffer space part way through the batch,
+ * the messages that were sent are counted in *sentCountPtr and the rest are left unsent.  A
+ * message whose data was cut short still counts as sent (LE_FAULT is returned).
+ *
+ * @return
+ * - LE_OK if all the messages were sent.
+ * - LE_NO_MEMORY if the send socket is set to non-blocking and it doesn't have enough buffer
+ *                  space to send the remaining messages right now.
+ * - LE_COMM_ERROR if the localSocketFd is not connected.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_SendMsgBatch
+(
+    int localSocketFd,              ///< [IN] fd of the local socket that will be used to send.
+    unixSocket_BatchMsg_t* msgs,    ///< [IN] The messages to send.
+    size_t count,                   ///< [IN] Number of messages (at most UNIXSOCKET_MAX_BATCH_LEN).
+    size_t* sentCountPtr            ///< [OUT] Number of messages that were sent.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    struct mmsghdr msgHeaders[UNIXSOCKET_MAX_BATCH_LEN];
+    struct iovec ioVectors[UNIXSOCKET_MAX_BATCH_LEN];
+    FdCmsgBuffer_t cmsgBuffers[UNIXSOCKET_MAX_BATCH_LEN];
+    size_t i;
+
+    LE_ASSERT(count <= UNIXSOCKET_MAX_BATCH_LEN);
+
+    *sentCountPtr = 0;
+
+    // A batch of one doesn't gain anything from sendmmsg().
+    if (count == 1)
+    {
+        le_result_t result = unixSocket_SendMsg(localSocketFd,
+                                                msgs[0].dataPtr,
+                                                msgs[0].dataSize,
+                                                msgs[0].fd,
+                                                false);
+        if (result == LE_OK)
+        {
+            *sentCountPtr = 1;
+        }
+        return result;
+    }
+
+    memset(msgHeaders, 0, count * sizeof(msgHeaders[0]));
+
+    for (i = 0; i < count; i++)
+    {
+        struct msghdr* msgHeaderPtr = &msgHeaders[i].msg_hdr;
+
+        if ((msgs[i].dataPtr != NULL) && (msgs[i].dataSize > 0))
+        {
+            ioVectors[i].iov_base = msgs[i].dataPtr;
+            ioVectors[i].iov_len = msgs[i].dataSize;
+            msgHeaderPtr->msg_iov = &ioVectors[i];
+            msgHeaderPtr->msg_iovlen = 1;
+        }
+
+        if (msgs[i].fd >= 0)
+        {
+            msgHeaderPtr->msg_control = cmsgBuffers[i].buff;
+            msgHeaderPtr->msg_controllen = sizeof(cmsgBuffers[i].buff);
+
+            struct cmsghdr* cmsgHeaderPtr = CMSG_FIRSTHDR(msgHeaderPtr);
+            cmsgHeaderPtr->cmsg_level = SOL_SOCKET;
+            cmsgHeaderPtr->cmsg_type = SCM_RIGHTS;
+            cmsgHeaderPtr->cmsg_len = CMSG_LEN(sizeof(int));
+            memcpy(CMSG_DATA(cmsgHeaderPtr), &msgs[i].fd, sizeof(int));
+
+            msgHeaderPtr->msg_controllen = cmsgHeaderPtr->cmsg_len;
+
+            LE_DEBUG("Sending fd %d.", msgs[i].fd);
+        }
+    }
+
+    // sendmmsg() stops at the first message that can't be sent and returns the number that were,
+    // so keep going until the whole batch is sent or it fails on the first remaining message.
+    while (*sentCountPtr < count)
+    {
+        int sent = sendmmsg(localSocketFd,
+                            &msgHeaders[*sentCountPtr],
+                            count - *sentCountPtr,
+                            0);
+        if (sent < 0)
+        {
+            switch (errno)
+            {
+                case EINTR:
+                    continue;
+
+                case EAGAIN:  // Same as EWOULDBLOCK
+                    return LE_NO_MEMORY;
+
+                case ENOTCONN:
+                case ECONNRESET:
+                case EPIPE:
+                    LE_WARN("sendmmsg() failed with errno %d (%m).", errno);
+                    return LE_COMM_ERROR;
+
+                default:
+                    LE_ERROR("sendmmsg() failed with errno %d (%m).", errno);
+                    return LE_FAULT;
+            }
+        }
+
+        // Every message sendmmsg() counted has gone to the peer, even one that was cut short, so
+        // all of them are reported as sent; sending them again would deliver duplicates.
+        bool truncated = false;
+        for (i = *sentCountPtr; i < *sentCountPtr + sent; i++)
+        {
+            if (msgHeaders[i].msg_len < msgs[i].dataSize)
+            {
+                LE_ERROR("The last %zu data bytes (of %zu total) were discarded by sendmmsg()!",
+                         msgs[i].dataSize - msgHeaders[i].msg_len,
+                         msgs[i].dataSize);
+                truncated = true;
+            }
+        }
+
+        *sentCountPtr += sent;
+
+        if (truncated)
+        {
+            return LE_FAULT;
+        }
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receives a batch of data messages, each with an optional file descriptor, through a connected
+ * Unix domain datagram or sequenced-packet socket using a single system call.
+ *
+ * If the socket is blocking, this waits for the first message only; the batch is then filled
+ * with whatever other messages have already arrived.
+ *
+ * Each received message's result field tells whether it fit in its buffer, and whether its
+ * file descriptors were lost.  If the connection
+ * closed after some messages were received, those messages are returned and the next call
+ * reports LE_CLOSED.
+ *
+ * @return
+ * - LE_OK if at least one message was received (see *receivedCountPtr).
+ * - LE_WOULD_BLOCK if the socket is set non-blocking and there is nothing to be received.
+ * - LE_CLOSED if the connection closed.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_ReceiveMsgBatch
+(
+    int localSocketFd,              ///< [IN] fd of local socket that will be used to receive.
+    unixSocket_BatchMsg_t* msgs,    ///< [IN+OUT] Buffers to receive into, and what was received.
+    size_t count,                   ///< [IN] Number of buffers (at most UNIXSOCKET_MAX_BATCH_LEN).
+    size_t* receivedCountPtr        ///< [OUT] Number of messages that were received.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    struct mmsghdr msgHeaders[UNIXSOCKET_MAX_BATCH_LEN];
+    struct iovec ioVectors[UNIXSOCKET_MAX_BATCH_LEN];
+    FdCmsgBuffer_t cmsgBuffers[UNIXSOCKET_MAX_BATCH_LEN];
+    size_t i;
+
+    LE_ASSERT(count <= UNIXSOCKET_MAX_BATCH_LEN);
+
+    *receivedCountPtr = 0;
+
+    // A batch of one doesn't gain anything from recvmmsg().
+    if (count == 1)
+    {
+        le_result_t result = unixSocket_ReceiveMsg(localSocketFd,
+                                                   msgs[0].dataPtr,
+                                                   &msgs[0].dataSize,
+                                                   &msgs[0].fd,
+                                                   NULL);
+        if ((result != LE_OK) && (result != LE_NO_MEMORY))
+        {
+            return result;
+        }
+        msgs[0].result = result;
+        *receivedCountPtr = 1;
+        return LE_OK;
+    }
+
+    memset(msgHeaders, 0, count * sizeof(msgHeaders[0]));
+
+    for (i = 0; i < count; i++)
+    {
+        struct msghdr* msgHeaderPtr = &msgHeaders[i].msg_hdr;
+
+        msgHeaderPtr->msg_control = cmsgBuffers[i].buff;
+        msgHeaderPtr->msg_controllen = sizeof(cmsgBuffers[i].buff);
+
+        if ((msgs[i].dataPtr != NULL) && (msgs[i].dataSize > 0))
+        {
+            ioVectors[i].iov_base = msgs[i].dataPtr;
+            ioVectors[i].iov_len = msgs[i].dataSize;
+            msgHeaderPtr->msg_iov = &ioVectors[i];
+            msgHeaderPtr->msg_iovlen = 1;
+        }
+
+        msgs[i].fd = -1;
+    }
+
+    // Keep trying to receive until we don't get interrupted by a signal.
+    // MSG_WAITFORONE makes only the first message wait (if the socket is blocking).
+    int received;
+    do
+    {
+        received = recvmmsg(localSocketFd, msgHeaders, count, MSG_WAITFORONE, NULL);
+    }
+    while ((received < 0) && (errno == EINTR));
+
+    if (received < 0)
+    {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            return LE_WOULD_BLOCK;
+        }
+        else if (errno == ECONNRESET)
+        {
+            return LE_CLOSED;
+        }
+        else
+        {
+            LE_ERROR("recvmmsg() failed with errno %d (%m).", errno);
+            return LE_FAULT;
+        }
+    }
+
+    for (i = 0; i < (size_t)received; i++)
+    {
+        struct msghdr* msgHeaderPtr = &msgHeaders[i].msg_hdr;
+
+        if (msgHeaderPtr->msg_controllen > 0)
+        {
+            ExtractAncillaryData(msgHeaderPtr, &msgs[i].fd, NULL);
+        }
+
+        // A message whose ancillary data was cut short has lost some of its file descriptors, so
+        // it is handed back as failed, without whatever descriptor did make it.  The messages
+        // around it are unaffected.
+        if ((msgHeaderPtr->msg_flags & MSG_CTRUNC) != 0)
+        {
+            LE_WARN("Ancillary data was discarded because it couldn't fit in our buffer.");
+            if (msgs[i].fd >= 0)
+            {
+                fd_Close(msgs[i].fd);
+                msgs[i].fd = -1;
+            }
+            msgs[i].dataSize = msgHeaders[i].msg_len;
+            msgs[i].result = LE_FAULT;
+            continue;
+        }
+        // An empty message with no ancillary data means the connection has closed.
+        // Every message after it will be the same.
+        else if ((msgHeaderPtr->msg_controllen == 0) && (msgHeaders[i].msg_len == 0))
+        {
+            if (i == 0)
+            {
+                return LE_CLOSED;
+            }
+            break;
+        }
+
+        msgs[i].dataSize = msgHeaders[i].msg_len;
+        msgs[i].result = ((msgHeaderPtr->msg_flags & MSG_TRUNC) != 0) ? LE_NO_MEMORY : LE_OK;
+    }
+
+    *receivedCountPtr = i;
+
+    return (i > 0) ? LE_OK : LE_FAULT;
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -755,3 +1283,89 @@ int unixSocket_GetErrorState
 
     return errCode;
 }
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Passes listening sockets on to the program about to be exec()ed by the calling process.  The
+ * sockets are moved to fd UNIXSOCKET_LISTEN_FDS_START onwards, in the order given.  Any other file
+ * descriptors in that range are closed.
+ *
+ * @note Terminates the process on failure, as it is meant to be called from a child process.
+ */
+//--------------------------------------------------------------------------------------------------
+void unixSocket_PassListening
+(
+    const int* fdsPtr,      ///< [IN] The sockets.
+    size_t numFds           ///< [IN] Number of sockets.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    int tempFds[numFds];
+    char numStr[24];
+    size_t i;
+
+    // First move all the sockets above the range, so that moving one into place can't close
+    // another.
+    for (i = 0; i < numFds; i++)
+    {
+        tempFds[i] = fcntl(fdsPtr[i], F_DUPFD, UNIXSOCKET_LISTEN_FDS_START + (int)numFds);
+        LE_FATAL_IF(tempFds[i] < 0, "Failed to duplicate fd %d.  %m.", fdsPtr[i]);
+        fd_Close(fdsPtr[i]);
+    }
+
+    for (i = 0; i < numFds; i++)
+    {
+        int r;
+        do
+        {
+            r = dup2(tempFds[i], UNIXSOCKET_LISTEN_FDS_START + (int)i);
+        }
+        while ((r == -1) && (errno == EINTR));
+
+        LE_FATAL_IF(r == -1, "Failed to duplicate fd %d.  %m.", tempFds[i]);
+        fd_Close(tempFds[i]);
+    }
+
+    snprintf(numStr, sizeof(numStr), "%" PRIuS, numFds);
+    LE_FATAL_IF(setenv(LISTEN_FDS_ENV, numStr, 1) != 0, "Failed to set " LISTEN_FDS_ENV ".  %m.");
+
+    snprintf(numStr, sizeof(numStr), "%d", (int)getpid());
+    LE_FATAL_IF(setenv(LISTEN_PID_ENV, numStr, 1) != 0, "Failed to set " LISTEN_PID_ENV ".  %m.");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the number of listening sockets passed on to the calling process by its parent.  They are
+ * fd UNIXSOCKET_LISTEN_FDS_START onwards.
+ *
+ * @return The number of sockets (0 if none).
+ */
+//--------------------------------------------------------------------------------------------------
+size_t unixSocket_GetInherited
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    const char* numFdsStr = getenv(LISTEN_FDS_ENV);
+    const char* pidStr = getenv(LISTEN_PID_ENV);
+    int num;
+    int pid;
+    size_t numFds = 0;
+
+    // The variables may have been inherited from a process that didn't clear them, so only
+    // believe them if they name this process.
+    if ((numFdsStr != NULL) && (pidStr != NULL) &&
+        (le_utf8_ParseInt(&pid, pidStr) == LE_OK) && (pid == (int)getpid()) &&
+        (le_utf8_ParseInt(&num, numFdsStr) == LE_OK) && (num > 0))
+    {
+        numFds = (size_t)num;
+    }
+
+    unsetenv(LISTEN_FDS_ENV);
+    unsetenv(LISTEN_PID_ENV);
+
+    return numFds;
+}
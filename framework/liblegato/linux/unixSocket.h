@@ -13,6 +13,7 @@
  *  - @ref c_unixSocketsConnecting
  *  - @ref c_unixSocketsSendingAndReceiving
  *  - @ref c_unixSocketsGettingCredentialsDirect
+ *  - @ref c_unixSocketsInheriting
  *  - @ref c_unixSocketsDeleting
  *
  * <HR>
@@ -157,6 +158,13 @@
  * - unixSocket_ReceiveMsg() receives a message containing any combination of normal
  *   data, a file descriptor, and authenticated credentials.
  *
+ * - unixSocket_SendMsgFds() and unixSocket_ReceiveMsgFds() send and receive a data message
+ *   together with up to @ref UNIXSOCKET_MAX_FDS file descriptors.
+ *
+ * - unixSocket_SendMsgBatch() and unixSocket_ReceiveMsgBatch() send and receive up to
+ *   @ref UNIXSOCKET_MAX_BATCH_LEN data messages (each with an optional file descriptor) on a
+ *   datagram or sequenced-packet socket in a single system call.  Message boundaries are kept.
+ *
  * When file descriptors are sent, they are duplicated in the receiving process as if they had
  * been created using the POSIX dup() function.  This means that they remain open in the sending
  * process and must be closed by the sending process when it doesn't need them anymore.
@@ -261,6 +269,31 @@
  * @endcode
  *
  *
+ * @section c_unixSocketsInheriting Inheriting Listening Sockets
+ *
+ * A process can create a daemon's named listening sockets before starting it, so that other
+ * processes can connect to them (and have their connections queued) while the daemon is still
+ * initializing.  The sockets are passed on the same way as with systemd's socket activation:
+ * just before calling exec(), the child process calls unixSocket_PassListening(), which moves the
+ * sockets to fd @c UNIXSOCKET_LISTEN_FDS_START onwards and records their number in the
+ * environment.  The daemon then calls unixSocket_GetInherited() to find out how many sockets it
+ * was given.
+ *
+ * @code
+ * // In the child, after fork():
+ * int fds[] = { clientSocketFd, serverSocketFd };
+ * unixSocket_PassListening(fds, NUM_ARRAY_MEMBERS(fds));
+ * execl(...);
+ *
+ * // In the daemon:
+ * if (unixSocket_GetInherited() == 2)
+ * {
+ *     clientSocketFd = UNIXSOCKET_LISTEN_FDS_START;
+ *     serverSocketFd = UNIXSOCKET_LISTEN_FDS_START + 1;
+ * }
+ * @endcode
+ *
+ *
  * @section c_unixSocketsDeleting Deleting a Socket
  *
  * The standard POSIX close() function can be used to delete a socket.  However, is recommended
@@ -518,6 +551,153 @@ le_result_t unixSocket_ReceiveDataMsg
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of file descriptors that can be sent with unixSocket_SendMsgFds() or received
+ * with unixSocket_ReceiveMsgFds() in one message.
+ */
+//--------------------------------------------------------------------------------------------------
+#define UNIXSOCKET_MAX_FDS 6
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a data message together with a number of file descriptors through a connected Unix domain
+ * datagram or sequenced-packet socket.  The file descriptors arrive at the receiver in the order
+ * they are given.  If the peer has closed its end, LE_COMM_ERROR is returned rather than a
+ * SIGPIPE being raised.
+ *
+ * @return
+ * - LE_OK if successful
+ * - LE_COMM_ERROR if the localSocketFd is not connected.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ * - LE_NO_MEMORY if the send socket is set to non-blocking and it doesn't have enough buffer
+ *                  space to send right now.
+ *
+ * @warning DO NOT SEND DIRECTORY FILE DESCRIPTORS.  That can be exploited to break out of chroot()
+ *          jails.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_SendMsgFds
+(
+    int localSocketFd,          ///< [IN] fd of the local socket that will be used to send.
+    void* dataPtr,              ///< [IN] Pointer to the data payload to be sent.
+    size_t dataSize,            ///< [IN] Number of bytes of data payload to be sent.
+    const int* fdsPtr,          ///< [IN] The file descriptors to be sent.
+    size_t fdCount              ///< [IN] Number of file descriptors (at most UNIXSOCKET_MAX_FDS).
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receives a data message together with any file descriptors sent with it through a connected
+ * Unix domain datagram or sequenced-packet socket.  File descriptors beyond the number that the
+ * caller has room for are closed.
+ *
+ * @return
+ * - LE_OK if successful
+ * - LE_NO_MEMORY if more data was received than could fit in the buffer provided.
+ * - LE_WOULD_BLOCK if the socket is set non-blocking and there is nothing to be received.
+ * - LE_CLOSED if the connection closed.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_ReceiveMsgFds
+(
+    int localSocketFd,      ///< [IN] fd of local socket that will be used to receive the message.
+    void* dataBuffPtr,      ///< [OUT] Pointer to where the data payload will be put.
+    size_t* dataSizePtr,    ///< [IN+OUT] Size of the buffer, updated to the number of bytes
+                            ///     of data received.
+    int* fdsPtr,            ///< [OUT] Array to store the received file descriptors in.
+    size_t* fdCountPtr      ///< [IN+OUT] Size of the array (at most UNIXSOCKET_MAX_FDS), updated
+                            ///     to the number of file descriptors received.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of messages that can be passed to unixSocket_SendMsgBatch() or
+ * unixSocket_ReceiveMsgBatch() in one call.
+ */
+//--------------------------------------------------------------------------------------------------
+#define UNIXSOCKET_MAX_BATCH_LEN 32
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * One message of a batch sent with unixSocket_SendMsgBatch() or received with
+ * unixSocket_ReceiveMsgBatch().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    void*   dataPtr;    ///< [IN] Data payload to send, or buffer to receive it into.
+    size_t  dataSize;   ///< [IN+OUT] Bytes to send, or size of the receive buffer (updated to the
+                        ///     number of bytes received).
+    int     fd;         ///< [IN+OUT] File descriptor to send (-1 = none), or the one received
+                        ///     (-1 = none).
+    le_result_t result; ///< [OUT] Receive only: LE_OK, LE_NO_MEMORY if the message was
+                        ///     larger than its buffer (the remainder is lost), or LE_FAULT if
+                        ///     its ancillary data was cut short (its fds are closed).
+}
+unixSocket_BatchMsg_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sends a batch of data messages, each with an optional file descriptor, through a connected Unix
+ * domain datagram or sequenced-packet socket using a single system call where possible.
+ *
+ * Messages are sent in order.  If the socket runs out of buffer space part way through the batch,
+ * the messages that were sent are counted in *sentCountPtr and the rest are left unsent.  A
+ * message whose data was cut short still counts as sent (LE_FAULT is returned).
+ *
+ * @return
+ * - LE_OK if all the messages were sent.
+ * - LE_NO_MEMORY if the send socket is set to non-blocking and it doesn't have enough buffer
+ *                  space to send the remaining messages right now.
+ * - LE_COMM_ERROR if the localSocketFd is not connected.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_SendMsgBatch
+(
+    int localSocketFd,              ///< [IN] fd of the local socket that will be used to send.
+    unixSocket_BatchMsg_t* msgs,    ///< [IN] The messages to send.
+    size_t count,                   ///< [IN] Number of messages (at most UNIXSOCKET_MAX_BATCH_LEN).
+    size_t* sentCountPtr            ///< [OUT] Number of messages that were sent.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receives a batch of data messages, each with an optional file descriptor, through a connected
+ * Unix domain datagram or sequenced-packet socket using a single system call.
+ *
+ * If the socket is blocking, this waits for the first message only; the batch is then filled
+ * with whatever other messages have already arrived.
+ *
+ * Each received message's result field tells whether it fit in its buffer, and whether its
+ * file descriptors were lost.  If the connection
+ * closed after some messages were received, those messages are returned and the next call
+ * reports LE_CLOSED.
+ *
+ * @return
+ * - LE_OK if at least one message was received (see *receivedCountPtr).
+ * - LE_WOULD_BLOCK if the socket is set non-blocking and there is nothing to be received.
+ * - LE_CLOSED if the connection closed.
+ * - LE_FAULT if failed for some other reason (check your logs).
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t unixSocket_ReceiveMsgBatch
+(
+    int localSocketFd,              ///< [IN] fd of local socket that will be used to receive.
+    unixSocket_BatchMsg_t* msgs,    ///< [IN+OUT] Buffers to receive into, and what was received.
+    size_t count,                   ///< [IN] Number of buffers (at most UNIXSOCKET_MAX_BATCH_LEN).
+    size_t* receivedCountPtr        ///< [OUT] Number of messages that were received.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the socket error state code (SO_ERROR).
@@ -549,4 +729,44 @@ le_result_t unixSocket_EnableAuthentication
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * File descriptor of the first listening socket passed on by unixSocket_PassListening().
+ */
+//--------------------------------------------------------------------------------------------------
+#define UNIXSOCKET_LISTEN_FDS_START     3
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Passes listening sockets on to the program about to be exec()ed by the calling process (see
+ * @ref c_unixSocketsInheriting).  The sockets are moved to fd UNIXSOCKET_LISTEN_FDS_START onwards,
+ * in the order given.  Any other file descriptors in that range are closed.
+ *
+ * @note Terminates the process on failure, as it is meant to be called from a child process.
+ */
+//--------------------------------------------------------------------------------------------------
+void unixSocket_PassListening
+(
+    const int* fdsPtr,      ///< [IN] The sockets.
+    size_t numFds           ///< [IN] Number of sockets.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the number of listening sockets passed on to the calling process by its parent (see
+ * @ref c_unixSocketsInheriting).  They are fd UNIXSOCKET_LISTEN_FDS_START onwards.  The
+ * environment variables that record them are removed, so that they are not passed on again.
+ *
+ * @return The number of sockets (0 if none).
+ */
+//--------------------------------------------------------------------------------------------------
+size_t unixSocket_GetInherited
+(
+    void
+);
+
+
+
 #endif // LEGATO_UNIX_SOCKET_INCLUDE_GUARD
@@ -15,6 +15,10 @@
  * Groups are created and deleted by modifying the /etc/group file.  File update and locking is
  * handled in the same way as the passwd file.
  *
+ * Lookups are served from in-memory indexes of the passwd and group files and from an in-memory
+ * copy of the apps translation table.  inotify watches on their directories mark these stale
+ * when the files change, and they are read again on the next lookup.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
@@ -26,6 +30,7 @@
 #include <grp.h>
 #include <sys/file.h>
 #include <sys/sendfile.h>
+#include <sys/inotify.h>
 
 
 //--------------------------------------------------------------------------------------------------
@@ -146,6 +151,80 @@ static le_mem_PoolRef_t AppsTabPool = NULL;
 //--------------------------------------------------------------------------------------------------
 static bool IsEtcWritable = false;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Entry of the passwd or group index.  For groups, id and gid are both the group ID.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_sls_Link_t link;                         ///< Link in the index's list of entries.
+    char          name[LIMIT_MAX_USER_NAME_BYTES]; ///< User or group name.
+    uint32_t      id;                           ///< User ID or group ID.
+    gid_t         gid;                          ///< Primary group ID.
+}
+IdEntry_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * In-memory index of the passwd or group file, so that looking up a user or group doesn't read and
+ * parse the file.  It is rebuilt on the first lookup after the file changes.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char*      fileName;      ///< File indexed.
+    bool             isGroup;       ///< true for the group file, false for the passwd file.
+    bool             isValid;       ///< false if the file must be read again.
+    bool             isComplete;    ///< false if some entries have names too long to be indexed.
+    le_sls_List_t    entryList;     ///< All entries, to release them.
+    le_hashmap_Ref_t byName;        ///< Entries by name.
+    le_hashmap_Ref_t byId;          ///< Entries by ID (the first entry of each ID).
+}
+IdIndex_t;
+
+static IdIndex_t PasswdIndex = { .fileName = PASSWORD_FILE, .isGroup = false };
+static IdIndex_t GroupIndex = { .fileName = GROUP_FILE, .isGroup = true };
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expected number of entries of an index.  The hashmaps grow past it.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ID_INDEX_CAPACITY   64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of index entries.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t IdEntryPool = NULL;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Whether the apps translation table in memory is up to date with the file.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsAppsTabValid = false;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * inotify instance watching /etc and the directory of the apps translation table, to invalidate
+ * the indexes and the apps translation table when their files change.  -1 if inotify is not
+ * available, in which case the files are read on each lookup.
+ */
+//--------------------------------------------------------------------------------------------------
+static int InotifyFd = -1;
+static int EtcWatch = -1;
+static int AppsTabWatch = -1;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Serializes access to the indexes.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_mutex_t IndexMutex = PTHREAD_MUTEX_INITIALIZER;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Updates the user or group ID range value from a string.  If the string contains the value to
@@ -427,6 +506,329 @@ static le_result_t RestoreBackup
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start watching the files that are cached in memory.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitWatches
+(
+    void
+)
+{
+    static const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE |
+                                 IN_DELETE;
+    char appsTabDir[LIMIT_MAX_PATH_BYTES];
+
+    InotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (InotifyFd < 0)
+    {
+        LE_WARN("Can't watch user and group files (%m).  They will be read on each lookup.");
+        return;
+    }
+
+    // The files are replaced by renaming new ones over them, so watch their directories.
+    EtcWatch = inotify_add_watch(InotifyFd, "/etc", mask);
+    if (EtcWatch < 0)
+    {
+        LE_WARN("Can't watch /etc (%m).  User and group files will be read on each lookup.");
+    }
+
+    LE_ASSERT(le_path_GetDir(APPS_TRANSLATION_FILE, "/", appsTabDir, sizeof(appsTabDir)) == LE_OK);
+    AppsTabWatch = inotify_add_watch(InotifyFd, appsTabDir, mask);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Invalidate the cached copies of the files that have changed since the last call.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckForChanges
+(
+    void
+)
+{
+    char buf[sizeof(struct inotify_event) + NAME_MAX + 1]
+        __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t len;
+
+    if (EtcWatch < 0)
+    {
+        PasswdIndex.isValid = false;
+        GroupIndex.isValid = false;
+    }
+    if (AppsTabWatch < 0)
+    {
+        IsAppsTabValid = false;
+    }
+    if (InotifyFd < 0)
+    {
+        return;
+    }
+
+    while ((len = read(InotifyFd, buf, sizeof(buf))) > 0)
+    {
+        char* ptr;
+
+        for (ptr = buf; ptr < buf + len; )
+        {
+            const struct inotify_event* eventPtr = (const struct inotify_event*)ptr;
+
+            if (eventPtr->mask & IN_Q_OVERFLOW)
+            {
+                PasswdIndex.isValid = false;
+                GroupIndex.isValid = false;
+                IsAppsTabValid = false;
+            }
+            else if (eventPtr->len == 0)
+            {
+                // Event on the directory itself.
+            }
+            else if (eventPtr->wd == EtcWatch)
+            {
+                if (strcmp(eventPtr->name, le_path_GetBasenamePtr(PASSWORD_FILE, "/")) == 0)
+                {
+                    PasswdIndex.isValid = false;
+                }
+                else if (strcmp(eventPtr->name, le_path_GetBasenamePtr(GROUP_FILE, "/")) == 0)
+                {
+                    GroupIndex.isValid = false;
+                }
+            }
+            else if ((eventPtr->wd == AppsTabWatch) &&
+                     (strcmp(eventPtr->name,
+                             le_path_GetBasenamePtr(APPS_TRANSLATION_FILE, "/")) == 0))
+            {
+                IsAppsTabValid = false;
+            }
+
+            ptr += sizeof(struct inotify_event) + eventPtr->len;
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the passwd or group file into its index if it has changed.
+ *
+ * @note Must be called with the index mutex locked.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if the file could not be read.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t UpdateIndex
+(
+    IdIndex_t* indexPtr     ///< [IN] Index to update.
+)
+{
+    le_sls_Link_t* linkPtr;
+    FILE* filePtr;
+    int err;
+
+    CheckForChanges();
+    if (indexPtr->isValid)
+    {
+        return LE_OK;
+    }
+
+    if (indexPtr->byName == NULL)
+    {
+        indexPtr->byName = le_hashmap_Create(indexPtr->isGroup ? "GroupsByName" : "UsersByName",
+                                             ID_INDEX_CAPACITY,
+                                             le_hashmap_HashString,
+                                             le_hashmap_EqualsString);
+        indexPtr->byId = le_hashmap_Create(indexPtr->isGroup ? "GroupsById" : "UsersById",
+                                           ID_INDEX_CAPACITY,
+                                           le_hashmap_HashUInt32,
+                                           le_hashmap_EqualsUInt32);
+        le_hashmap_EnableResize(indexPtr->byName, 75);
+        le_hashmap_EnableResize(indexPtr->byId, 75);
+        indexPtr->entryList = LE_SLS_LIST_INIT;
+    }
+
+    le_hashmap_RemoveAll(indexPtr->byName);
+    le_hashmap_RemoveAll(indexPtr->byId);
+    while ((linkPtr = le_sls_Pop(&indexPtr->entryList)) != NULL)
+    {
+        le_mem_Release(CONTAINER_OF(linkPtr, IdEntry_t, link));
+    }
+    indexPtr->isComplete = true;
+
+    filePtr = fopen(indexPtr->fileName, "r");
+    if (filePtr == NULL)
+    {
+        LE_ERROR("Could not open file %s.  %m.", indexPtr->fileName);
+        return LE_FAULT;
+    }
+
+    for (;;)
+    {
+        char buf[indexPtr->isGroup ? MaxGroupEntrySize : MaxPasswdEntrySize];
+        const char* namePtr;
+        uint32_t id;
+        gid_t gid;
+
+        if (indexPtr->isGroup)
+        {
+            struct group grp;
+            struct group* grpPtr;
+
+            err = fgetgrent_r(filePtr, &grp, buf, sizeof(buf), &grpPtr);
+            if (grpPtr == NULL)
+            {
+                break;
+            }
+            namePtr = grp.gr_name;
+            id = grp.gr_gid;
+            gid = grp.gr_gid;
+        }
+        else
+        {
+            struct passwd pwd;
+            struct passwd* pwdPtr;
+
+            err = fgetpwent_r(filePtr, &pwd, buf, sizeof(buf), &pwdPtr);
+            if (pwdPtr == NULL)
+            {
+                break;
+            }
+            namePtr = pwd.pw_name;
+            id = pwd.pw_uid;
+            gid = pwd.pw_gid;
+        }
+
+        IdEntry_t* entryPtr = le_mem_ForceAlloc(IdEntryPool);
+        if (le_utf8_Copy(entryPtr->name, namePtr, sizeof(entryPtr->name), NULL) != LE_OK)
+        {
+            // Lookups that miss the index must fall back to the C library.
+            indexPtr->isComplete = false;
+            le_mem_Release(entryPtr);
+            continue;
+        }
+        entryPtr->id = id;
+        entryPtr->gid = gid;
+        entryPtr->link = LE_SLS_LINK_INIT;
+        le_sls_Stack(&indexPtr->entryList, &entryPtr->link);
+
+        // Like the C library, the first entry with a given name or ID wins.
+        if (!le_hashmap_ContainsKey(indexPtr->byName, entryPtr->name))
+        {
+            le_hashmap_Put(indexPtr->byName, entryPtr->name, entryPtr);
+        }
+        if (!le_hashmap_ContainsKey(indexPtr->byId, &entryPtr->id))
+        {
+            le_hashmap_Put(indexPtr->byId, &entryPtr->id, entryPtr);
+        }
+    }
+
+    fclose(filePtr);
+
+    if ((err != 0) && (err != ENOENT))
+    {
+        errno = err;
+        LE_ERROR("Could not read %s.  %m.", indexPtr->fileName);
+        return LE_FAULT;
+    }
+
+    indexPtr->isValid = true;
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up a user or group by name or ID in the index of the passwd or group file.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the user or group is not in the index.  If the index is incomplete, the
+ *                   caller must then look it up with the C library.
+ *      LE_FAULT if the file could not be read.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LookUp
+(
+    IdIndex_t* indexPtr,        ///< [IN] Index to search.
+    const char* namePtr,        ///< [IN] Name to look up, or NULL to look up by ID.
+    uint32_t id,                ///< [IN] ID to look up, if namePtr is NULL.
+    IdEntry_t* entryPtr,        ///< [OUT] Copy of the entry found.
+    bool* isCompletePtr         ///< [OUT] Whether the index holds all the entries of the file.
+)
+{
+    le_result_t result;
+
+    LE_ASSERT(pthread_mutex_lock(&IndexMutex) == 0);
+
+    result = UpdateIndex(indexPtr);
+    if (result == LE_OK)
+    {
+        IdEntry_t* foundPtr = (namePtr != NULL) ? le_hashmap_Get(indexPtr->byName, namePtr) :
+                                                  le_hashmap_Get(indexPtr->byId, &id);
+        if (foundPtr != NULL)
+        {
+            *entryPtr = *foundPtr;
+        }
+        else
+        {
+            result = LE_NOT_FOUND;
+        }
+        *isCompletePtr = indexPtr->isComplete;
+    }
+
+    LE_ASSERT(pthread_mutex_unlock(&IndexMutex) == 0);
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the apps translation table into memory if it has changed.
+ *
+ * @return
+ *      LE_OK if successful, or if the table doesn't exist.
+ *      LE_FAULT if the table could not be read.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadAppsTab
+(
+    void
+)
+{
+    LE_ASSERT(pthread_mutex_lock(&IndexMutex) == 0);
+    CheckForChanges();
+    bool isValid = IsAppsTabValid;
+    IsAppsTabValid = true;
+    LE_ASSERT(pthread_mutex_unlock(&IndexMutex) == 0);
+
+    if (isValid)
+    {
+        return LE_OK;
+    }
+
+    FILE *fd = fopen(APPS_TRANSLATION_FILE, "r");
+    if (fd)
+    {
+        size_t rc;
+        rc = fread(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
+        fclose(fd);
+        if (NbAppsInTranslationTable != rc)
+        {
+            LE_ERROR("Read of apps translation table failed (rc %zu != %u)",
+                     rc, NbAppsInTranslationTable);
+            IsAppsTabValid = false;
+            return LE_FAULT;
+        }
+    }
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initialize the user system.  This should be called before any other function in this API.
@@ -440,6 +842,13 @@ void user_Init
     // Get the min and max values for local user IDs and group IDs.
     FILE *filePtr;
 
+    // Set up the in-memory copies of the user, group and apps translation tables, once.
+    if (IdEntryPool == NULL)
+    {
+        IdEntryPool = le_mem_CreatePool("UserIdEntry", sizeof(IdEntry_t));
+        InitWatches();
+    }
+
     // Check if /etc is writable and register the result for further checks
     IsEtcWritable = (0 == access( PASSWORD_FILE, W_OK ) ? true : false);
     LE_INFO("/etc is %swritable", IsEtcWritable ? "" : "NOT ");
@@ -590,28 +999,33 @@ static le_result_t GetName
         uint32_t ids = uid - BASE_MIN_UID;
 
         // /etc is not writable so try first to read the apps translation tab if it exist.
-        FILE *fd = fopen(APPS_TRANSLATION_FILE, "r");
-        if (fd)
+        if (ReadAppsTab() != LE_OK)
         {
-            size_t rc;
-            rc = fread(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
-            fclose(fd);
-            if (NbAppsInTranslationTable != rc)
-            {
-                LE_ERROR("Read of apps translation table failed (rc %zu != %u)",
-                         rc, NbAppsInTranslationTable);
-                return LE_FAULT;
-            }
+            return LE_FAULT;
+        }
 
-            // Check if the apps already exists in the apps translation table.
-            if ('\0' != AppsTab[ids].name[0])
-            {
-                // Copy the username to the caller's buffer.
-                return le_utf8_Copy(nameBufPtr, AppsTab[ids].name, nameBufSize, NULL);
-            }
+        // Check if the apps already exists in the apps translation table.
+        if ('\0' != AppsTab[ids].name[0])
+        {
+            // Copy the username to the caller's buffer.
+            return le_utf8_Copy(nameBufPtr, AppsTab[ids].name, nameBufSize, NULL);
         }
     }
 
+    // Look the user up in the index of the passwd file.  Only entries that couldn't be indexed
+    // need the C library.
+    IdEntry_t entry;
+    bool isComplete;
+    le_result_t result = LookUp(&PasswdIndex, NULL, uid, &entry, &isComplete);
+    if (result == LE_OK)
+    {
+        return le_utf8_Copy(nameBufPtr, entry.name, nameBufSize, NULL);
+    }
+    if ((result != LE_NOT_FOUND) || isComplete)
+    {
+        return result;
+    }
+
     do
     {
         err = getpwuid_r(uid, &pwd, buf, sizeof(buf), &resultPtr);
@@ -672,28 +1086,32 @@ static le_result_t GetGroupName
         uint32_t ids = gid - BASE_MIN_UID;
 
         // /etc is not writable so try first to read the apps translation tab if it exist.
-        FILE *fd = fopen(APPS_TRANSLATION_FILE, "r");
-        if (fd)
+        if (ReadAppsTab() != LE_OK)
         {
-            size_t rc;
-            rc = fread(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
-            fclose(fd);
-            if (NbAppsInTranslationTable != rc)
-            {
-                LE_ERROR("Read of apps translation table failed (rc %zu != %u)",
-                         rc, NbAppsInTranslationTable);
-                return LE_FAULT;
-            }
+            return LE_FAULT;
+        }
 
-            // Check if the apps already exists in the apps translation table.
-            if ('\0' != AppsTab[ids].name[0])
-            {
-                // Copy the username to the caller's buffer.
-                return le_utf8_Copy(nameBufPtr, AppsTab[ids].name, nameBufSize, NULL);
-            }
+        // Check if the apps already exists in the apps translation table.
+        if ('\0' != AppsTab[ids].name[0])
+        {
+            // Copy the username to the caller's buffer.
+            return le_utf8_Copy(nameBufPtr, AppsTab[ids].name, nameBufSize, NULL);
         }
     }
 
+    // Look the group up in the index of the group file.
+    IdEntry_t entry;
+    bool isComplete;
+    le_result_t result = LookUp(&GroupIndex, NULL, gid, &entry, &isComplete);
+    if (result == LE_OK)
+    {
+        return le_utf8_Copy(nameBufPtr, entry.name, nameBufSize, NULL);
+    }
+    if ((result != LE_NOT_FOUND) || isComplete)
+    {
+        return result;
+    }
+
     do
     {
         err = getgrgid_r(gid, &grp, buf, sizeof(buf), &resultPtr);
@@ -753,19 +1171,9 @@ static le_result_t GetIDs
 
     if (!IsEtcWritable)
     {
-        // /etc is not writable so try first to read the apps translation tab if it exist.
-        FILE *fd = fopen(APPS_TRANSLATION_FILE, "r");
-        if (fd)
+        if (ReadAppsTab() != LE_OK)
         {
-            size_t rc;
-            rc = fread(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
-            fclose(fd);
-            if (NbAppsInTranslationTable != rc)
-            {
-                LE_ERROR("Read of apps translation table failed (rc %zu != %u)",
-                         rc, NbAppsInTranslationTable);
-                return LE_FAULT;
-            }
+            return LE_FAULT;
         }
 
         for (ids = 0; ids < NbAppsInTranslationTable; ids++)
@@ -782,6 +1190,29 @@ static le_result_t GetIDs
         }
     }
 
+    // Look the user up in the index of the passwd file.
+    IdEntry_t entry;
+    bool isComplete;
+    le_result_t result = LookUp(&PasswdIndex, usernamePtr, 0, &entry, &isComplete);
+    if (result == LE_OK)
+    {
+        if (uidPtr != NULL)
+        {
+            *uidPtr = entry.id;
+        }
+
+        if (gidPtr != NULL)
+        {
+            *gidPtr = entry.gid;
+        }
+
+        return LE_OK;
+    }
+    if ((result != LE_NOT_FOUND) || isComplete)
+    {
+        return result;
+    }
+
     do
     {
         err = getpwnam_r(usernamePtr, &pwd, buf, sizeof(buf), &resultPtr);
@@ -870,19 +1301,9 @@ static le_result_t GetGid
 
     if (!IsEtcWritable)
     {
-        // /etc is not writable so try first to read the apps translation tab if it exist.
-        FILE *fd = fopen(APPS_TRANSLATION_FILE, "r");
-        if (fd)
+        if (ReadAppsTab() != LE_OK)
         {
-            size_t rc;
-            rc = fread(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
-            fclose(fd);
-            if (NbAppsInTranslationTable != rc)
-            {
-                LE_ERROR("Read of apps translation table failed (rc %zu != %u)",
-                         rc, NbAppsInTranslationTable);
-                return LE_FAULT;
-            }
+            return LE_FAULT;
         }
 
         for (ids = 0; ids < NbAppsInTranslationTable; ids++)
@@ -899,6 +1320,20 @@ static le_result_t GetGid
         }
     }
 
+    // Look the group up in the index of the group file.
+    IdEntry_t entry;
+    bool isComplete;
+    le_result_t result = LookUp(&GroupIndex, groupNamePtr, 0, &entry, &isComplete);
+    if (result == LE_OK)
+    {
+        *gidPtr = entry.id;
+        return LE_OK;
+    }
+    if ((result != LE_NOT_FOUND) || isComplete)
+    {
+        return result;
+    }
+
     do
     {
         err = getgrnam_r(groupNamePtr, &grp, buf, sizeof(buf), &resultPtr);
@@ -1158,18 +1593,9 @@ le_result_t user_Create
         // /etc is not writable. Use the apps translation table instead /etc/passwd.
         uint32_t ids;
         uint32_t uidfree = (uint32_t)-1;
-        FILE *fd = fopen(APPS_TRANSLATION_FILE, "r");
-        if (fd)
+        if (ReadAppsTab() != LE_OK)
         {
-            size_t rc;
-            rc = fread(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
-            fclose(fd);
-            if (NbAppsInTranslationTable != rc)
-            {
-                LE_ERROR("Read of apps translation table failed (rc %zu != %u)",
-                         rc, NbAppsInTranslationTable);
-                return LE_FAULT;
-            }
+            return LE_FAULT;
         }
 
         for (ids = 0; ids < NbAppsInTranslationTable; ids++)
@@ -1202,7 +1628,7 @@ le_result_t user_Create
                 snprintf(appsUserName, sizeof(appsUserName), USERNAME_TABLE_PREFIX "%02u", uidfree);
                 snprintf(AppsTab[uidfree].name, sizeof(appTab_t), "%s", usernamePtr);
                 // Write the apps translation table into flash
-                fd = fopen(APPS_TRANSLATION_FILE, "w");
+                FILE* fd = fopen(APPS_TRANSLATION_FILE, "w");
                 if (fd)
                 {
                     size_t rc;
@@ -1721,18 +2147,9 @@ static le_result_t DeleteUser
     else
     {
         uint32_t uid;
-        FILE* fd = fopen(APPS_TRANSLATION_FILE, "r");
-        if (fd)
+        if (ReadAppsTab() != LE_OK)
         {
-            size_t rc;
-            rc = fread(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
-            fclose(fd);
-            if (NbAppsInTranslationTable != rc)
-            {
-                LE_ERROR("Read of apps translation table failed (rc %zu != %u)",
-                         rc, NbAppsInTranslationTable);
-                return LE_FAULT;
-            }
+            return LE_FAULT;
         }
 
         for (uid = 0; uid < NbAppsInTranslationTable; uid++)
@@ -1742,7 +2159,7 @@ static le_result_t DeleteUser
                 size_t rc;
 
                 memset(AppsTab[uid].name, 0, sizeof(appTab_t));
-                fd = fopen(APPS_TRANSLATION_FILE, "w");
+                FILE* fd = fopen(APPS_TRANSLATION_FILE, "w");
                 if (fd)
                 {
                     rc = fwrite(AppsTab, sizeof(appTab_t), NbAppsInTranslationTable, fd);
@@ -334,6 +334,39 @@ le_log_TraceRef_t _le_log_GetTraceRef
     return fa_log_GetTraceRef(logSession, keyword);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Default for framework adaptors that don't implement statically defined trace keywords.  The
+ * keywords keep the state they were initialized with (disabled), so their traces are never
+ * logged, but components using them still build and run unchanged.
+ **/
+//--------------------------------------------------------------------------------------------------
+__attribute__((weak)) void fa_log_RegTraceKeywords
+(
+    le_log_SessionRef_t     logSession,     ///< Log session.
+    le_log_TraceKeyword_t  *keywordsPtr,    ///< Array of keyword definitions.
+    size_t                  count           ///< Number of keywords in the array.
+)
+{
+    LE_UNUSED(logSession);
+    LE_ASSERT((keywordsPtr != NULL) || (count == 0));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers statically defined trace keywords for the calling component.
+ **/
+//--------------------------------------------------------------------------------------------------
+void _le_log_RegTraceKeywords
+(
+    le_log_SessionRef_t     logSession,     ///< Log session.
+    le_log_TraceKeyword_t  *keywordsPtr,    ///< Array of keyword definitions.
+    size_t                  count           ///< Number of keywords in the array.
+)
+{
+    fa_log_RegTraceKeywords(logSession, keywordsPtr, count);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the log filter level for the calling component.
@@ -43,7 +43,10 @@
  *
  */
 #include "legato.h"
+#include "fa/mem.h"
+#include "fa/traceMarker.h"
 #include "mem.h"
+#include "thread.h"
 
 #define GUARD_WORD ((uint32_t)0xDEADBEEF)
 #define GUARD_BAND_SIZE (sizeof(GUARD_WORD) * LE_CONFIG_NUM_GUARD_BAND_WORDS)
@@ -116,6 +119,33 @@ LE_DEFINE_INLINE le_mem_PoolRef_t le_mem_CreateReducedPool
 #define DEFAULT_NUM_BLOCKS_TO_FORCE     1
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of bytes of blocks that a size-class pool grows by at a time (see
+ * le_mem_EnableSizeClasses()).
+ */
+//--------------------------------------------------------------------------------------------------
+#define SIZE_CLASS_GROWTH_BYTES         4096
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Most size classes a pool can have (two per power of two).
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_SIZE_CLASSES                (2 * 8 * sizeof(size_t))
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Address that the current allocation function was called from, for allocation sampling.
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_MEM_POOL_PROFILE
+#   define ALLOC_CALLER     __builtin_return_address(0)
+#else
+#   define ALLOC_CALLER     NULL
+#endif
+
+
 #if LE_CONFIG_MEM_TRACE
 #   undef le_mem_TryAlloc
 #   undef le_mem_AssertAlloc
@@ -193,6 +223,57 @@ static le_mem_PoolRef_t SubPoolsPool;
 static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
 
 
+#if LE_CONFIG_MEM_THREAD_CACHE
+//--------------------------------------------------------------------------------------------------
+/**
+ * A thread's cache of free blocks for one pool.
+ *
+ * Only ever accessed by the owning thread, so no locking is needed except when blocks are moved
+ * between the cache and the pool's shared free list.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_mem_Pool_t*  poolPtr;        ///< Pool whose blocks are cached (NULL if slot is unused).
+    le_sls_List_t   freeList;       ///< Free blocks held by this thread.
+    size_t          numFree;        ///< Number of blocks on freeList.
+    ssize_t         numInUse;       ///< Net number of blocks allocated through this slot since the
+                                    ///  pool's counters were last updated.
+    uint64_t        numAllocs;      ///< Number of allocations through this slot since the pool's
+                                    ///  counters were last updated.
+}
+ThreadCacheSlot_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A thread's set of pool caches.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    ThreadCacheSlot_t slot[LE_CONFIG_MEM_THREAD_CACHE_POOLS];
+}
+ThreadCache_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The calling thread's pool caches, created on first use.
+ */
+//--------------------------------------------------------------------------------------------------
+static __thread ThreadCache_t* ThreadCachePtr;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key used to return a thread's cached blocks to their pools when the thread exits.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_key_t ThreadCacheKey;
+#endif /* end LE_CONFIG_MEM_THREAD_CACHE */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Exposing the memory pool list; mainly for the Inspect tool.
@@ -234,7 +315,10 @@ void mem_Lock
     void
 )
 {
-    LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+    if (!thread_IsSingleThreaded())
+    {
+        LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+    }
 }
 
 
@@ -251,8 +335,274 @@ void mem_Unlock
     void
 )
 {
-    LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+    if (!thread_IsSingleThreaded())
+    {
+        LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+    }
+}
+
+
+#if LE_CONFIG_MEM_TRIM
+//--------------------------------------------------------------------------------------------------
+/**
+ * Puts blocks of a pool's first run of trimmed blocks back on its free list: as many as
+ * le_mem_ForceAlloc() would add to the pool, so that their pages are faulted in a few at a time.
+ * The rest of the run stays trimmed.
+ *
+ * A run is recorded in its first block: the block's link is on the pool's trimmed list and its
+ * reference count holds the number of blocks in the run.
+ *
+ * @note Assumes that the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RestoreTrimmedRun_NoLock
+(
+    le_mem_PoolRef_t    pool        ///< [IN] The pool.
+)
+{
+    le_sls_Link_t* runLinkPtr = le_sls_Pop(&(pool->trimmedList));
+    uint8_t* runPtr = (uint8_t*)CONTAINER_OF(runLinkPtr, MemBlock_t, data[0].link);
+    size_t runLength = CONTAINER_OF(runLinkPtr, MemBlock_t, data[0].link)->refCount;
+    size_t numBlocks = pool->numBlocksToForce;
+
+    if ((numBlocks == 0) || (numBlocks > runLength))
+    {
+        numBlocks = runLength;
+    }
+
+    if (numBlocks < runLength)
+    {
+        MemBlock_t* restPtr = (MemBlock_t*)(runPtr + numBlocks * pool->blockSize);
+
+        restPtr->refCount = runLength - numBlocks;
+        restPtr->data[0].link = LE_SLS_LINK_INIT;
+        le_sls_Stack(&(pool->trimmedList), &(restPtr->data[0].link));
+    }
+
+    // Stack the blocks from the last one, so that they are allocated in address order.
+    size_t i;
+    for (i = numBlocks; i > 0; i--)
+    {
+        MemBlock_t* blockPtr = (MemBlock_t*)(runPtr + (i - 1) * pool->blockSize);
+
+        blockPtr->poolPtr = pool;
+        blockPtr->refCount = 0;
+        blockPtr->data[0].link = LE_SLS_LINK_INIT;
+        le_sls_Stack(&(pool->freeList), &(blockPtr->data[0].link));
+    }
+
+    pool->numBlocksTrimmed -= numBlocks;
+}
+#endif /* end LE_CONFIG_MEM_TRIM */
+
+
+#if LE_CONFIG_MEM_POOLS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pops a block off a pool's free list.  If the list is empty but the pool has trimmed blocks,
+ * some of them are put back on the list first.
+ *
+ * @return The block's link, or NULL if the pool has no free blocks.
+ *
+ * @note Assumes that the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_sls_Link_t* PopFreeBlock_NoLock
+(
+    le_mem_PoolRef_t    pool        ///< [IN] The pool.
+)
+{
+    le_sls_Link_t* blockLinkPtr = le_sls_Pop(&(pool->freeList));
+
+#if LE_CONFIG_MEM_TRIM
+    if ((blockLinkPtr == NULL) && !le_sls_IsEmpty(&(pool->trimmedList)))
+    {
+        RestoreTrimmedRun_NoLock(pool);
+        blockLinkPtr = le_sls_Pop(&(pool->freeList));
+    }
+#endif
+
+    return blockLinkPtr;
+}
+#endif /* end LE_CONFIG_MEM_POOLS */
+
+
+#if LE_CONFIG_MEM_THREAD_CACHE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Folds the counters accumulated in a thread's cache slot into its pool.
+ *
+ * @note Assumes that the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SyncCacheSlot_NoLock
+(
+    ThreadCacheSlot_t* slotPtr      ///< [IN] The cache slot.
+)
+{
+    le_mem_Pool_t* poolPtr = slotPtr->poolPtr;
+
+    // Blocks allocated through the cache have left the cache and are now in use (or vice-versa
+    // for blocks released into the cache).
+    poolPtr->numBlocksInUse += slotPtr->numInUse;
+    poolPtr->numBlocksCached -= slotPtr->numInUse;
+
+#if LE_CONFIG_MEM_POOL_STATS
+    poolPtr->numAllocations += slotPtr->numAllocs;
+
+    if (poolPtr->numBlocksInUse > poolPtr->maxNumBlocksUsed)
+    {
+        poolPtr->maxNumBlocksUsed = poolPtr->numBlocksInUse;
+    }
+#endif
+
+    slotPtr->numInUse = 0;
+    slotPtr->numAllocs = 0;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Moves a batch of free blocks from a pool's shared free list into a thread's cache slot.  The
+ * slot may be left empty if the pool has no free blocks.
+ *
+ * @note Assumes that the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RefillCacheSlot_NoLock
+(
+    ThreadCacheSlot_t* slotPtr      ///< [IN] The cache slot.
+)
+{
+    le_mem_Pool_t* poolPtr = slotPtr->poolPtr;
+    size_t batchSize = (poolPtr->threadCacheSize + 1) / 2;
+
+    SyncCacheSlot_NoLock(slotPtr);
+
+    while (slotPtr->numFree < batchSize)
+    {
+        le_sls_Link_t* blockLinkPtr = PopFreeBlock_NoLock(poolPtr);
+        if (blockLinkPtr == NULL)
+        {
+            break;
+        }
+
+        le_sls_Stack(&(slotPtr->freeList), blockLinkPtr);
+        slotPtr->numFree++;
+        poolPtr->numBlocksCached++;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Moves free blocks from a thread's cache slot back to the pool's shared free list until no more
+ * than the given number remain in the slot.
+ *
+ * @note Assumes that the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SpillCacheSlot_NoLock
+(
+    ThreadCacheSlot_t* slotPtr,     ///< [IN] The cache slot.
+    size_t             numToKeep    ///< [IN] Number of blocks to leave in the slot.
+)
+{
+    le_mem_Pool_t* poolPtr = slotPtr->poolPtr;
+
+    SyncCacheSlot_NoLock(slotPtr);
+
+    while (slotPtr->numFree > numToKeep)
+    {
+        le_sls_Link_t* blockLinkPtr = le_sls_Pop(&(slotPtr->freeList));
+        LE_ASSERT(blockLinkPtr != NULL);
+
+        le_sls_Stack(&(poolPtr->freeList), blockLinkPtr);
+        slotPtr->numFree--;
+        poolPtr->numBlocksCached--;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Returns all of a thread's cached blocks to their pools.  Called by the pthreads key destructor
+ * when a thread exits.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ThreadCacheDestructor
+(
+    void* cachePtr                  ///< [IN] The exiting thread's cache.
+)
+{
+    ThreadCache_t* threadCachePtr = cachePtr;
+    size_t i;
+
+    mem_Lock();
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(threadCachePtr->slot); i++)
+    {
+        if (threadCachePtr->slot[i].poolPtr != NULL)
+        {
+            SpillCacheSlot_NoLock(&(threadCachePtr->slot[i]), 0);
+        }
+    }
+
+    mem_Unlock();
+
+    ThreadCachePtr = NULL;
+    free(threadCachePtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the calling thread's cache slot for a pool, claiming a free slot if the thread has not
+ * cached blocks from this pool before.
+ *
+ * @return The cache slot, or NULL if all of the thread's slots are used by other pools.
+ */
+//--------------------------------------------------------------------------------------------------
+static ThreadCacheSlot_t* GetCacheSlot
+(
+    le_mem_Pool_t* poolPtr          ///< [IN] The pool.
+)
+{
+    ThreadCache_t* threadCachePtr = ThreadCachePtr;
+    ThreadCacheSlot_t* unusedSlotPtr = NULL;
+    size_t i;
+
+    if (threadCachePtr == NULL)
+    {
+        threadCachePtr = calloc(1, sizeof(ThreadCache_t));
+        LE_ASSERT(threadCachePtr);
+        LE_ASSERT(pthread_setspecific(ThreadCacheKey, threadCachePtr) == 0);
+        ThreadCachePtr = threadCachePtr;
+    }
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(threadCachePtr->slot); i++)
+    {
+        ThreadCacheSlot_t* slotPtr = &(threadCachePtr->slot[i]);
+
+        if (slotPtr->poolPtr == poolPtr)
+        {
+            return slotPtr;
+        }
+        else if ((slotPtr->poolPtr == NULL) && (unusedSlotPtr == NULL))
+        {
+            unusedSlotPtr = slotPtr;
+        }
+    }
+
+    if (unusedSlotPtr != NULL)
+    {
+        unusedSlotPtr->poolPtr = poolPtr;
+        unusedSlotPtr->freeList = LE_SLS_LIST_INIT;
+    }
+
+    return unusedSlotPtr;
 }
+#endif /* end LE_CONFIG_MEM_THREAD_CACHE */
 
 
 #if LE_CONFIG_USE_GUARD_BAND
@@ -409,6 +759,9 @@ static void InitPool
     pool->userDataSize = objSize;
     pool->blockSize = blockSize;
     pool->numBlocksToForce = DEFAULT_NUM_BLOCKS_TO_FORCE;
+#if LE_CONFIG_MEM_TRIM
+    pool->trimMinFree = LE_CONFIG_MEM_TRIM_MIN_FREE;
+#endif
 
     pool->poolLink = LE_DLS_LINK_INIT;
 
@@ -454,7 +807,7 @@ static size_t MoveBlocks
         // Get the first block to move.
         LE_DEBUG("Getting next block from source pool");
 
-        le_sls_Link_t* blockLinkPtr = le_sls_Pop(&(srcPool->freeList));
+        le_sls_Link_t* blockLinkPtr = PopFreeBlock_NoLock(srcPool);
         ++removedCount;
 
         if (blockLinkPtr == NULL)
@@ -710,6 +1063,11 @@ void SubPoolDestructor
     PoolListChangeCount++;
     le_dls_Remove(&PoolList, &(subPool->poolLink));
 
+#if LE_CONFIG_MEM_POOL_PROFILE
+    free(subPool->profilePtr);
+    subPool->profilePtr = NULL;
+#endif
+
     mem_Unlock();
 }
 
@@ -736,6 +1094,10 @@ void mem_Init
                                          LE_CONFIG_MAX_SUB_POOLS_POOL_SIZE,
                                          sizeof(le_mem_Pool_t));
     le_mem_SetDestructor(SubPoolsPool, SubPoolDestructor);
+
+#if LE_CONFIG_MEM_THREAD_CACHE
+    LE_ASSERT(pthread_key_create(&ThreadCacheKey, ThreadCacheDestructor) == 0);
+#endif
 }
 
 
@@ -964,8 +1326,12 @@ static le_mem_PoolRef_t ExpandPool_NoLock
         // This is a sub-pool so the memory blocks to create must come from the super-pool.
         // Check that there are enough blocks in the superpool.
         size_t superBlocksPerBlock = (pool->superPoolPtr->blockSize/pool->blockSize);
+        size_t numSuperFree = le_sls_NumLinks(&(pool->superPoolPtr->freeList));
+#   if LE_CONFIG_MEM_TRIM
+        numSuperFree += pool->superPoolPtr->numBlocksTrimmed;
+#   endif
         ssize_t numBlocksToAdd = (numObjects + superBlocksPerBlock - 1)/superBlocksPerBlock
-                                    - le_sls_NumLinks(&(pool->superPoolPtr->freeList));
+                                    - numSuperFree;
 
         if (numBlocksToAdd > 0)
         {
@@ -1037,6 +1403,42 @@ le_mem_PoolRef_t le_mem_ExpandPool
 }
 
 
+#if LE_CONFIG_MEM_POOL_PROFILE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records a sampled allocation in a pool's ring, creating the ring the first time.
+ *
+ * @note Assumes that the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RecordAllocSample_NoLock
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool the object was allocated from.
+    void*               callerPtr   ///< [IN] Address the allocation function was called from.
+)
+{
+    if (pool->profilePtr == NULL)
+    {
+        // Profiling is best-effort; just skip the sample if there is no memory for the ring.
+        pool->profilePtr = calloc(1, sizeof(mem_AllocProfile_t));
+        if (pool->profilePtr == NULL)
+        {
+            return;
+        }
+    }
+
+    mem_AllocProfile_t* profilePtr = pool->profilePtr;
+    le_mem_AllocSample_t* samplePtr =
+        &profilePtr->samples[profilePtr->numSamples % LE_CONFIG_MEM_POOL_PROFILE_SAMPLES];
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    samplePtr->callerPtr = callerPtr;
+    samplePtr->timestamp = (uint64_t)now.sec * 1000000 + now.usec;
+    profilePtr->numSamples++;
+}
+#endif /* end LE_CONFIG_MEM_POOL_PROFILE */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Attempts to allocate an object from a pool.
@@ -1046,21 +1448,70 @@ le_mem_PoolRef_t le_mem_ExpandPool
  *      to allocate.
  */
 //--------------------------------------------------------------------------------------------------
-void* le_mem_TryAlloc
+static void* TryAlloc
 (
-    le_mem_PoolRef_t    pool    ///< [IN] The pool from which the object is to be allocated.
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool from which the object is to be allocated.
+    void*               callerPtr   ///< [IN] Address the allocation function was called from.
 )
 {
     LE_ASSERT(pool != NULL);
+    LE_UNUSED(callerPtr);
 
     MemBlock_t* blockPtr = NULL;
     void* userPtr = NULL;
 
+#if LE_CONFIG_MEM_THREAD_CACHE
+    if (pool->threadCacheSize != 0)
+    {
+        ThreadCacheSlot_t* slotPtr = GetCacheSlot(pool);
+
+        if (slotPtr != NULL)
+        {
+            if (slotPtr->numFree == 0)
+            {
+                mem_Lock();
+                RefillCacheSlot_NoLock(slotPtr);
+                mem_Unlock();
+            }
+
+            le_sls_Link_t* blockLinkPtr = le_sls_Pop(&(slotPtr->freeList));
+            if (blockLinkPtr == NULL)
+            {
+                return NULL;
+            }
+
+            slotPtr->numFree--;
+            slotPtr->numInUse++;
+            slotPtr->numAllocs++;
+
+#if LE_CONFIG_MEM_POOL_PROFILE
+            if ((slotPtr->numAllocs % LE_CONFIG_MEM_POOL_PROFILE_INTERVAL) == 0)
+            {
+                mem_Lock();
+                RecordAllocSample_NoLock(pool, callerPtr);
+                mem_Unlock();
+            }
+#endif
+
+            blockPtr = CONTAINER_OF(blockLinkPtr, MemBlock_t, data[0].link);
+            blockPtr->refCount = 1;
+
+#if LE_CONFIG_USE_GUARD_BAND
+            InitGuardBands(blockPtr);
+            userPtr = &blockPtr->data[0].item + GUARD_BAND_SIZE;
+#else
+            userPtr = blockPtr->data;
+#endif
+            return userPtr;
+        }
+    }
+#endif /* end LE_CONFIG_MEM_THREAD_CACHE */
+
     mem_Lock();
 
 #if LE_CONFIG_MEM_POOLS
     // Pop a link off the pool.
-    le_sls_Link_t* blockLinkPtr = le_sls_Pop(&(pool->freeList));
+    le_sls_Link_t* blockLinkPtr = PopFreeBlock_NoLock(pool);
 
     if (blockLinkPtr != NULL)
     {
@@ -1088,6 +1539,12 @@ void* le_mem_TryAlloc
         pool->maxNumBlocksUsed = pool->numBlocksInUse;
     }
 #endif
+#if LE_CONFIG_MEM_POOL_PROFILE
+        if ((pool->numAllocations % LE_CONFIG_MEM_POOL_PROFILE_INTERVAL) == 0)
+        {
+            RecordAllocSample_NoLock(pool, callerPtr);
+        }
+#endif
 
         blockPtr->refCount = 1;
 
@@ -1108,7 +1565,25 @@ void* le_mem_TryAlloc
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Allocates an object from a pool or logs a fatal error and terminates the process if the pool
+ * Attempts to allocate an object from a pool.
+ *
+ * @return
+ *      A pointer to the allocated object, or NULL if the pool doesn't have any free objects
+ *      to allocate.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_mem_TryAlloc
+(
+    le_mem_PoolRef_t    pool    ///< [IN] The pool from which the object is to be allocated.
+)
+{
+    return TryAlloc(pool, ALLOC_CALLER);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocates an object from a pool or logs a fatal error and terminates the process if the pool
  * doesn't have any free objects to allocate.
  *
  * @return A pointer to the allocated object.
@@ -1124,7 +1599,7 @@ void* le_mem_AssertAlloc
 {
     LE_ASSERT(pool != NULL);
 
-    void* objPtr = le_mem_TryAlloc(pool);
+    void* objPtr = TryAlloc(pool, ALLOC_CALLER);
 
     LE_ASSERT(objPtr);
 
@@ -1138,14 +1613,12 @@ void* le_mem_AssertAlloc
  * doesn't have any free objects to allocate.
  *
  * @return  A pointer to the allocated object.
- *
- * @note    On failure, the process exits, so you don't have to worry about checking the returned
- *          pointer for validity.
  */
 //--------------------------------------------------------------------------------------------------
-void* le_mem_ForceAlloc
+static void* ForceAlloc
 (
-    le_mem_PoolRef_t    pool    ///< [IN] The pool from which the object is to be allocated.
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool from which the object is to be allocated.
+    void*               callerPtr   ///< [IN] Address the allocation function was called from.
 )
 {
     LE_ASSERT(pool != NULL);
@@ -1153,7 +1626,7 @@ void* le_mem_ForceAlloc
     void* objPtr;
 
 #if LE_CONFIG_MEM_POOLS
-    while ((objPtr = le_mem_TryAlloc(pool)) == NULL)
+    while ((objPtr = TryAlloc(pool, callerPtr)) == NULL)
     {
         // Expand the pool.
         le_mem_ExpandPool(pool, pool->numBlocksToForce);
@@ -1171,16 +1644,86 @@ void* le_mem_ForceAlloc
         LE_DEBUG("Memory pool '%s' overflowed. Expanded to %" PRIuS " blocks.",
             MEMPOOL_NAME(pool->name), pool->totalBlocks);
 #   endif
+        TRACE_MARKER('L', "pool|%s|%" PRIuS, MEMPOOL_NAME(pool->name), pool->totalBlocks);
             mem_Unlock();
 
         }
 #else /* !LE_CONFIG_MEM_POOLS */
-        objPtr = le_mem_AssertAlloc(pool);
+        objPtr = TryAlloc(pool, callerPtr);
+        LE_ASSERT(objPtr);
 #endif /* end !LE_CONFIG_MEM_POOLS */
 
     return objPtr;
 }
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocates an object from a pool or logs a warning and expands the pool if the pool
+ * doesn't have any free objects to allocate.
+ *
+ * @return  A pointer to the allocated object.
+ *
+ * @note    On failure, the process exits, so you don't have to worry about checking the returned
+ *          pointer for validity.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_mem_ForceAlloc
+(
+    le_mem_PoolRef_t    pool    ///< [IN] The pool from which the object is to be allocated.
+)
+{
+    return ForceAlloc(pool, ALLOC_CALLER);
+}
+
+#if LE_CONFIG_MEM_POOLS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the object size of a size class.  Classes go m, 1.5m, 2m, 3m, 4m, 6m, ... where m is the
+ * smallest class.
+ *
+ * @return The object size, in bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline size_t SizeClassSize
+(
+    size_t minShift,    ///< [IN] log2 of the smallest class.
+    size_t index        ///< [IN] Size class index.
+)
+{
+    size_t base = (size_t)1 << (minShift + index / 2);
+
+    return ((index % 2) ? base + base / 2 : base);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the index of the smallest size class that can hold a given size.
+ *
+ * @return The size class index.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline size_t SizeToClass
+(
+    size_t minShift,    ///< [IN] log2 of the smallest class.
+    size_t size         ///< [IN] Object size.
+)
+{
+    if (size <= ((size_t)1 << minShift))
+    {
+        return 0;
+    }
+
+    // 2^p < size <= 2^(p+1); the class is either 1.5 * 2^p or 2^(p+1).
+    size_t p = (8 * sizeof(unsigned long) - 1) - __builtin_clzl(size - 1);
+    size_t index = 2 * (p - minShift);
+
+    return (size <= ((size_t)3 << (p - 1)) ? index + 1 : index + 2);
+}
+#endif /* end LE_CONFIG_MEM_POOLS */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Attempt to get the pool from which a block should be allocated.
@@ -1192,6 +1735,18 @@ le_mem_PoolRef_t GetPoolForSize
     size_t size               ///< [IN] The size of block to allocate
 )
 {
+#if LE_CONFIG_MEM_POOLS
+    if (pool->sizeClassesPtr != NULL)
+    {
+        size_t index = SizeToClass(pool->minSizeClassShift, size);
+
+        if (index < pool->numSizeClasses)
+        {
+            return pool->sizeClassesPtr[index];
+        }
+    }
+#endif
+
     while (pool->userDataSize < size)
     {
         if (pool->superPoolPtr && pool->superPoolPtr->userDataSize > pool->userDataSize)
@@ -1209,6 +1764,36 @@ le_mem_PoolRef_t GetPoolForSize
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Count the bytes asked for by a variable-size allocation in its pool's statistics.
+ *
+ * @return The allocated object (passed through).
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void* CountVarAlloc
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool the object was allocated from.
+    void*               objPtr,     ///< [IN] The object, or NULL.
+    size_t              size        ///< [IN] The size that was asked for.
+)
+{
+#if LE_CONFIG_MEM_POOL_STATS
+    if (objPtr != NULL)
+    {
+        mem_Lock();
+        pool->numBytesRequested += size;
+        mem_Unlock();
+    }
+#else
+    LE_UNUSED(pool);
+    LE_UNUSED(size);
+#endif
+
+    return objPtr;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Attempts to allocate an object of a specific size from a pool.
@@ -1226,7 +1811,8 @@ void* le_mem_TryVarAlloc
 {
     LE_ASSERT(pool != NULL);
 
-    return le_mem_TryAlloc(GetPoolForSize(pool, size));
+    pool = GetPoolForSize(pool, size);
+    return CountVarAlloc(pool, TryAlloc(pool, ALLOC_CALLER), size);
 }
 
 
@@ -1249,7 +1835,13 @@ void* le_mem_AssertVarAlloc
 {
     LE_ASSERT(pool != NULL);
 
-    return le_mem_AssertAlloc(GetPoolForSize(pool, size));
+    pool = GetPoolForSize(pool, size);
+
+    void* objPtr = TryAlloc(pool, ALLOC_CALLER);
+
+    LE_ASSERT(objPtr);
+
+    return CountVarAlloc(pool, objPtr, size);
 }
 
 
@@ -1272,7 +1864,8 @@ void* le_mem_ForceVarAlloc
 {
     LE_ASSERT(pool != NULL);
 
-    return le_mem_ForceAlloc(GetPoolForSize(pool, size));
+    pool = GetPoolForSize(pool, size);
+    return CountVarAlloc(pool, ForceAlloc(pool, ALLOC_CALLER), size);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1327,6 +1920,68 @@ void le_mem_SetNumObjsToForce
 }
 
 
+#if LE_CONFIG_MEM_THREAD_CACHE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Releases an object from a pool that has per-thread caches enabled.  If the reference count
+ * reaches zero the block is put into the calling thread's cache, spilling part of the cache back
+ * into the pool if it has grown too large.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseToThreadCache
+(
+    MemBlock_t* blockPtr,       ///< [IN] Block being released.
+    void*       objPtr          ///< [IN] Pointer to the user object in the block.
+)
+{
+    le_mem_Pool_t* poolPtr = blockPtr->poolPtr;
+    size_t refCount = LE_ATOMIC_SUB_FETCH(&(blockPtr->refCount), 1, LE_ATOMIC_ORDER_ACQ_REL);
+
+    if (refCount == (size_t)-1)
+    {
+        LE_EMERG("Releasing free block.");
+        LE_FATAL("Free block released from pool %p (%s).",
+                 poolPtr,
+                 MEMPOOL_NAME(poolPtr->name));
+    }
+    else if (refCount != 0)
+    {
+        return;
+    }
+
+    if (poolPtr->destructor)
+    {
+        poolPtr->destructor(objPtr);
+    }
+
+    ThreadCacheSlot_t* slotPtr = GetCacheSlot(poolPtr);
+
+    blockPtr->data[0].link = LE_SLS_LINK_INIT;
+
+    if (slotPtr == NULL)
+    {
+        // No room to cache this pool in this thread, so give the block straight back.
+        mem_Lock();
+        le_sls_Stack(&(poolPtr->freeList), &(blockPtr->data[0].link));
+        poolPtr->numBlocksInUse--;
+        mem_Unlock();
+        return;
+    }
+
+    le_sls_Stack(&(slotPtr->freeList), &(blockPtr->data[0].link));
+    slotPtr->numFree++;
+    slotPtr->numInUse--;
+
+    if (slotPtr->numFree > poolPtr->threadCacheSize)
+    {
+        mem_Lock();
+        SpillCacheSlot_NoLock(slotPtr, poolPtr->threadCacheSize / 2);
+        mem_Unlock();
+    }
+}
+#endif /* end LE_CONFIG_MEM_THREAD_CACHE */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Releases an object.  If the object's reference count has reached zero, it will be destructed
@@ -1362,6 +2017,14 @@ void le_mem_Release
     CheckGuardBands(blockPtr);
 #endif
 
+#if LE_CONFIG_MEM_THREAD_CACHE
+    if (blockPtr->poolPtr->threadCacheSize != 0)
+    {
+        ReleaseToThreadCache(blockPtr, objPtr);
+        return;
+    }
+#endif
+
     mem_Lock();
 
     switch (blockPtr->refCount)
@@ -1444,6 +2107,16 @@ void le_mem_AddRef
     CheckGuardBands(memBlockPtr);
 #endif
 
+#if LE_CONFIG_MEM_THREAD_CACHE
+    // Reference counts of blocks from pools with per-thread caches are only ever updated using
+    // atomic operations, since releasing them doesn't take the mutex.
+    if (memBlockPtr->poolPtr->threadCacheSize != 0)
+    {
+        LE_ASSERT(LE_ATOMIC_ADD_FETCH(&(memBlockPtr->refCount), 1, LE_ATOMIC_ORDER_RELAXED) > 1);
+        return;
+    }
+#endif
+
     mem_Lock();
 
     LE_ASSERT(memBlockPtr->refCount != 0);
@@ -1502,6 +2175,287 @@ void le_mem_SetDestructor
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enables a per-thread cache of free blocks for a given pool.
+ *
+ * See @ref mem_thread_cache for more information.
+ *
+ * @return
+ *      Nothing.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_EnableThreadCache
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    size_t              numObjects  ///< [IN] Maximum number of free objects each thread may hold
+                                    ///       in its cache.
+)
+{
+    LE_ASSERT(pool != NULL);
+
+#if LE_CONFIG_MEM_THREAD_CACHE
+    mem_Lock();
+
+    LE_FATAL_IF(pool->superPoolPtr != NULL,
+                "Per-thread caches are not supported for sub-pool '%s'.",
+                MEMPOOL_NAME(pool->name));
+    LE_FATAL_IF(pool->numBlocksInUse != 0,
+                "Per-thread cache enabled on pool '%s' while %" PRIuS " blocks are allocated.",
+                MEMPOOL_NAME(pool->name),
+                pool->numBlocksInUse);
+
+    pool->threadCacheSize = numObjects;
+
+    mem_Unlock();
+#else
+    LE_UNUSED(numObjects);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Serves variable-size allocations from a pool out of size-class pools.
+ *
+ * See @ref mem_size_classes for more information.
+ *
+ * @return
+ *      Nothing.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_EnableSizeClasses
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    size_t              minObjSize  ///< [IN] Size of the smallest size class (rounded up to a
+                                    ///       power of two).
+)
+{
+    LE_ASSERT(pool != NULL);
+
+#if LE_CONFIG_MEM_POOLS
+    LE_FATAL_IF(pool->superPoolPtr != NULL,
+                "Size classes are not supported for sub-pool '%s'.",
+                MEMPOOL_NAME(pool->name));
+    LE_FATAL_IF(pool->sizeClassesPtr != NULL,
+                "Size classes already enabled for pool '%s'.",
+                MEMPOOL_NAME(pool->name));
+
+    // The smallest class holds at least a pointer, so it can go on a free list anyway.
+    size_t minShift = 0;
+    while (((size_t)1 << minShift) < minObjSize || ((size_t)1 << minShift) < sizeof(void*))
+    {
+        minShift++;
+    }
+
+    // Only classes smaller than the pool's own objects are worth a pool.
+    size_t numClasses = 0;
+    while ((numClasses < MAX_SIZE_CLASSES) &&
+           (SizeClassSize(minShift, numClasses) < pool->userDataSize))
+    {
+        numClasses++;
+    }
+    if (numClasses == 0)
+    {
+        return;
+    }
+
+    le_mem_PoolRef_t* classesPtr = calloc(numClasses, sizeof(le_mem_PoolRef_t));
+    LE_ASSERT(classesPtr != NULL);
+
+    size_t i;
+    for (i = 0; i < numClasses; i++)
+    {
+        size_t classSize = SizeClassSize(minShift, i);
+
+#if LE_CONFIG_MEM_POOL_NAMES_ENABLED
+        char className[LE_MEM_LIMIT_MAX_MEM_POOL_NAME_BYTES];
+
+        snprintf(className, sizeof(className), "%" PRIuS, classSize);
+        classesPtr[i] = _le_mem_CreatePool(pool->name, className, classSize);
+#else
+        classesPtr[i] = _le_mem_CreatePool(classSize);
+#endif
+
+        // Grow a page's worth of blocks at a time.
+        size_t growBlocks = SIZE_CLASS_GROWTH_BYTES / classesPtr[i]->blockSize;
+        le_mem_SetNumObjsToForce(classesPtr[i], (growBlocks > 0) ? growBlocks : 1);
+        le_mem_SetDestructor(classesPtr[i], pool->destructor);
+    }
+
+    mem_Lock();
+    pool->minSizeClassShift = minShift;
+    pool->numSizeClasses = numClasses;
+    pool->sizeClassesPtr = classesPtr;
+    mem_Unlock();
+#else
+    LE_UNUSED(minObjSize);
+#endif
+}
+
+
+#if LE_CONFIG_MEM_TRIM
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives back the pages under the free blocks of a pool, keeping the pool's minimum number of free
+ * blocks untouched.  Free blocks are sorted by address to find runs of adjacent blocks, and the
+ * whole pages covered by the end of each run are given back, except for the header of the run's
+ * first trimmed block, which records the run.
+ *
+ * @return Number of bytes given back.
+ *
+ * @note Assumes that the mutex is locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t TrimPool_NoLock
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    size_t              pageSize    ///< [IN] Size of a page.
+)
+{
+    size_t numFree = le_sls_NumLinks(&(pool->freeList));
+
+    // Sub-pools' blocks belong to their super-pool, which is trimmed instead.
+    if ((pool->superPoolPtr != NULL) || (numFree <= pool->trimMinFree))
+    {
+        return 0;
+    }
+
+    size_t blockSize = pool->blockSize;
+    size_t numToTrim = numFree - pool->trimMinFree;
+    size_t numBytes = 0;
+    le_sls_List_t keptList = LE_SLS_LIST_INIT;
+
+    le_sls_Sort(&(pool->freeList), AddrCompare);
+
+    le_sls_Link_t* linkPtr = le_sls_Pop(&(pool->freeList));
+    while (linkPtr != NULL)
+    {
+        // Find the run of adjacent blocks starting with this one.
+        uint8_t* runPtr = (uint8_t*)CONTAINER_OF(linkPtr, MemBlock_t, data[0].link);
+        size_t runLength = 1;
+        le_sls_Link_t* nextLinkPtr;
+
+        while (((nextLinkPtr = le_sls_Pop(&(pool->freeList))) != NULL) &&
+               ((uint8_t*)CONTAINER_OF(nextLinkPtr, MemBlock_t, data[0].link) ==
+                runPtr + runLength * blockSize))
+        {
+            runLength++;
+        }
+
+        // Trim the end of the run, keeping the record of the trimmed part in its first block.
+        size_t numTrimmed = (runLength < numToTrim) ? runLength : numToTrim;
+        size_t numKept = runLength - numTrimmed;
+        uint8_t* trimPtr = runPtr + numKept * blockSize;
+        uintptr_t discardStart = ((uintptr_t)trimPtr + sizeof(MemBlock_t) + sizeof(le_sls_Link_t)
+                                  + pageSize - 1) & ~(uintptr_t)(pageSize - 1);
+        uintptr_t discardEnd = ((uintptr_t)runPtr + runLength * blockSize)
+                               & ~(uintptr_t)(pageSize - 1);
+
+        if ((numTrimmed > 0) && (discardEnd > discardStart) &&
+            fa_mem_DiscardPages((void*)discardStart, discardEnd - discardStart))
+        {
+            MemBlock_t* recordPtr = (MemBlock_t*)trimPtr;
+
+            recordPtr->refCount = numTrimmed;
+            recordPtr->data[0].link = LE_SLS_LINK_INIT;
+            le_sls_Stack(&(pool->trimmedList), &(recordPtr->data[0].link));
+
+            pool->numBlocksTrimmed += numTrimmed;
+            numToTrim -= numTrimmed;
+            numBytes += discardEnd - discardStart;
+        }
+        else
+        {
+            numKept = runLength;
+        }
+
+        size_t i;
+        for (i = 0; i < numKept; i++)
+        {
+            MemBlock_t* blockPtr = (MemBlock_t*)(runPtr + i * blockSize);
+
+            blockPtr->data[0].link = LE_SLS_LINK_INIT;
+            le_sls_Queue(&keptList, &(blockPtr->data[0].link));
+        }
+
+        linkPtr = nextLinkPtr;
+    }
+
+    pool->freeList = keptList;
+
+    return numBytes;
+}
+#endif /* end LE_CONFIG_MEM_TRIM */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the number of free objects that le_mem_Trim() leaves untouched in a pool.
+ *
+ * See @ref mem_trim for more information.
+ *
+ * @return
+ *      Nothing.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_SetTrimMinimum
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    size_t              numObjects  ///< [IN] Number of free objects to keep (SIZE_MAX to never
+                                    ///       trim the pool).
+)
+{
+    LE_ASSERT(pool != NULL);
+
+#if LE_CONFIG_MEM_TRIM
+    mem_Lock();
+    pool->trimMinFree = numObjects;
+    mem_Unlock();
+#else
+    LE_UNUSED(numObjects);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives the memory under the free blocks of all memory pools back to the system.
+ *
+ * See @ref mem_trim for more information.
+ *
+ * @return
+ *      Number of bytes given back.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_mem_Trim
+(
+    void
+)
+{
+    size_t numBytes = 0;
+
+#if LE_CONFIG_MEM_TRIM
+    size_t pageSize = fa_mem_GetPageSize();
+
+    mem_Lock();
+
+    le_dls_Link_t* poolLinkPtr = le_dls_Peek(&PoolList);
+    while (poolLinkPtr != NULL)
+    {
+        numBytes += TrimPool_NoLock(CONTAINER_OF(poolLinkPtr, le_mem_Pool_t, poolLink), pageSize);
+        poolLinkPtr = le_dls_PeekNext(&PoolList, poolLinkPtr);
+    }
+
+    mem_Unlock();
+
+    TRACE_MARKER('L', "trim|%" PRIuS, numBytes);
+#endif
+
+    return numBytes;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the statistics for a given pool.
@@ -1524,13 +2478,25 @@ void le_mem_GetStats
     statsPtr->numAllocs = pool->numAllocations;
     statsPtr->numOverflows = pool->numOverflows;
     statsPtr->maxNumBlocksUsed = pool->maxNumBlocksUsed;
+    statsPtr->numBytesRequested = pool->numBytesRequested;
 #else
     statsPtr->numAllocs = 0;
     statsPtr->numOverflows = 0;
     statsPtr->maxNumBlocksUsed = 0;
+    statsPtr->numBytesRequested = 0;
 #endif
     statsPtr->numFree = pool->totalBlocks - pool->numBlocksInUse;
     statsPtr->numBlocksInUse = pool->numBlocksInUse;
+#if LE_CONFIG_MEM_THREAD_CACHE
+    statsPtr->numThreadCached = pool->numBlocksCached;
+#else
+    statsPtr->numThreadCached = 0;
+#endif
+#if LE_CONFIG_MEM_TRIM
+    statsPtr->numTrimmed = pool->numBlocksTrimmed;
+#else
+    statsPtr->numTrimmed = 0;
+#endif
 
     mem_Unlock();
 }
@@ -1555,8 +2521,72 @@ void le_mem_ResetStats
     mem_Lock();
     pool->numAllocations = 0;
     pool->numOverflows = 0;
+    pool->numBytesRequested = 0;
+#if LE_CONFIG_MEM_POOL_PROFILE
+    if (pool->profilePtr != NULL)
+    {
+        pool->profilePtr->numSamples = 0;
+    }
+#endif
+    mem_Unlock();
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fetches the most recent allocation samples for a specified pool, oldest first.
+ *
+ * @return
+ *      Number of samples stored in the buffer (always 0 if allocation profiling is disabled).
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_mem_GetAllocSamples
+(
+    le_mem_PoolRef_t        pool,           ///< [IN] Pool whose samples are to be fetched.
+    le_mem_AllocSample_t*   samplesPtr,     ///< [OUT] Buffer to store the samples in.
+    size_t                  maxSamples      ///< [IN] Number of samples the buffer can hold.
+)
+{
+    LE_ASSERT(pool != NULL);
+    LE_ASSERT((samplesPtr != NULL) || (maxSamples == 0));
+
+    size_t numCopied = 0;
+
+#if LE_CONFIG_MEM_POOL_PROFILE
+    mem_Lock();
+
+    mem_AllocProfile_t* profilePtr = pool->profilePtr;
+
+    if (profilePtr != NULL)
+    {
+        uint64_t numKept = profilePtr->numSamples;
+
+        if (numKept > LE_CONFIG_MEM_POOL_PROFILE_SAMPLES)
+        {
+            numKept = LE_CONFIG_MEM_POOL_PROFILE_SAMPLES;
+        }
+        if (numKept > maxSamples)
+        {
+            numKept = maxSamples;
+        }
+
+        uint64_t sampleIndex = profilePtr->numSamples - numKept;
+
+        for (numCopied = 0; numCopied < numKept; numCopied++, sampleIndex++)
+        {
+            samplesPtr[numCopied] =
+                profilePtr->samples[sampleIndex % LE_CONFIG_MEM_POOL_PROFILE_SAMPLES];
+        }
+    }
+
     mem_Unlock();
+#else
+    LE_UNUSED(samplesPtr);
+    LE_UNUSED(maxSamples);
 #endif
+
+    return numCopied;
 }
 
 
@@ -1695,6 +2725,67 @@ size_t le_mem_GetObjectFullSize
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Takes the statistics of all the pools at once, while holding the pools' lock, so that they are
+ * consistent with each other.  Used for the Inspect tool's statistics snapshots.
+ *
+ * @return
+ *      Number of pools.  If it is more than maxSnapshots, only the first maxSnapshots pools were
+ *      stored.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t mem_GetPoolSnapshots
+(
+    mem_PoolSnapshot_t* snapshotsPtr,   ///< [OUT] Buffer to store the pools' statistics in.
+    size_t              maxSnapshots    ///< [IN] Number of pools the buffer can hold.
+)
+{
+    size_t numPools = 0;
+
+    mem_Lock();
+
+    le_dls_Link_t* poolLinkPtr = le_dls_Peek(&PoolList);
+    while (poolLinkPtr != NULL)
+    {
+        if (numPools < maxSnapshots)
+        {
+            le_mem_Pool_t* poolPtr = CONTAINER_OF(poolLinkPtr, le_mem_Pool_t, poolLink);
+            mem_PoolSnapshot_t* snapshotPtr = &snapshotsPtr[numPools];
+
+#if LE_CONFIG_MEM_POOL_NAMES_ENABLED
+            le_utf8_Copy(snapshotPtr->name, poolPtr->name, sizeof(snapshotPtr->name), NULL);
+#else
+            le_utf8_Copy(snapshotPtr->name, "<omitted>", sizeof(snapshotPtr->name), NULL);
+#endif
+#if LE_CONFIG_MEM_POOL_STATS
+            snapshotPtr->numAllocs = poolPtr->numAllocations;
+            snapshotPtr->numBytesRequested = poolPtr->numBytesRequested;
+            snapshotPtr->maxNumBlocksUsed = poolPtr->maxNumBlocksUsed;
+            snapshotPtr->numOverflows = poolPtr->numOverflows;
+#else
+            snapshotPtr->numAllocs = 0;
+            snapshotPtr->numBytesRequested = 0;
+            snapshotPtr->maxNumBlocksUsed = 0;
+            snapshotPtr->numOverflows = 0;
+#endif
+            snapshotPtr->totalBlocks = poolPtr->totalBlocks;
+            snapshotPtr->numBlocksInUse = poolPtr->numBlocksInUse;
+            snapshotPtr->objectSize = poolPtr->userDataSize;
+            snapshotPtr->blockSize = poolPtr->blockSize;
+            snapshotPtr->isSubPool = (poolPtr->superPoolPtr != NULL);
+        }
+
+        numPools++;
+        poolLinkPtr = le_dls_PeekNext(&PoolList, poolLinkPtr);
+    }
+
+    mem_Unlock();
+
+    return numPools;
+}
+
+
 #if LE_CONFIG_MEM_POOL_NAMES_ENABLED
 //--------------------------------------------------------------------------------------------------
 /**
@@ -14,6 +14,21 @@
 
 #include "limit.h"
 
+#if LE_CONFIG_MEM_POOL_PROFILE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ring of sampled allocations from a pool.  Also read by the Inspect tool.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct mem_AllocProfile
+{
+    uint64_t                numSamples;     ///< Total number of samples taken.  The next one goes
+                                            ///  in samples[numSamples % size of samples].
+    le_mem_AllocSample_t    samples[LE_CONFIG_MEM_POOL_PROFILE_SAMPLES];    ///< The ring.
+}
+mem_AllocProfile_t;
+#endif
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -51,6 +66,43 @@ size_t** mem_GetPoolListChgCntRef
     void
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Statistics of one pool, as taken by mem_GetPoolSnapshots().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char        name[LE_MEM_LIMIT_MAX_MEM_POOL_NAME_BYTES]; ///< Name of the pool.
+    uint64_t    numAllocs;          ///< Number of times an object has been allocated.
+    uint64_t    numBytesRequested;  ///< Bytes requested by variable-size allocations.
+    size_t      totalBlocks;        ///< Number of blocks, free and in use.
+    size_t      numBlocksInUse;     ///< Number of currently allocated blocks.
+    size_t      maxNumBlocksUsed;   ///< Maximum number of allocated blocks at any one time.
+    size_t      numOverflows;       ///< Number of times le_mem_ForceAlloc() expanded the pool.
+    size_t      objectSize;         ///< Size of the objects, in bytes.
+    size_t      blockSize;          ///< Size of the blocks, including all overhead, in bytes.
+    bool        isSubPool;          ///< true if the pool is a sub-pool.
+}
+mem_PoolSnapshot_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Takes the statistics of all the pools at once, while holding the pools' lock, so that they are
+ * consistent with each other.  Used for the Inspect tool's statistics snapshots.
+ *
+ * @return
+ *      Number of pools.  If it is more than maxSnapshots, only the first maxSnapshots pools were
+ *      stored.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t mem_GetPoolSnapshots
+(
+    mem_PoolSnapshot_t* snapshotsPtr,   ///< [OUT] Buffer to store the pools' statistics in.
+    size_t              maxSnapshots    ///< [IN] Number of pools the buffer can hold.
+);
+
 #if LE_CONFIG_RTOS
 //--------------------------------------------------------------------------------------------------
 /**
@@ -81,6 +81,24 @@ le_msg_MessageRef_t le_msg_GetServiceRxMsg
     return pthread_getspecific(ThreadLocalRxMsgKey);
 }
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Call a service's message receive handler for a message on the calling thread, as if the message
+ * had been received there.
+ **/
+//--------------------------------------------------------------------------------------------------
+void le_msg_HandleServiceRxMsg
+(
+    le_msg_ReceiveHandler_t handlerFunc,    ///< [in] Receive handler function.
+    le_msg_MessageRef_t     msgRef,         ///< [in] Reference to the received message.
+    void*                   contextPtr      ///< [in] contextPtr parameter for the handler.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgCommon_CallRecvHandler(handlerFunc, msgRef, contextPtr);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the user ID of the client at the far end of a given IPC session.
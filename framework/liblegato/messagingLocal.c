@@ -176,6 +176,7 @@ le_msg_ServiceRef_t le_msg_InitLocalService
         servicePtr->receiver.handler = NULL;
         servicePtr->receiver.contextPtr = NULL;
         servicePtr->messagePool = messagePoolRef;
+        servicePtr->directCallsPtr = NULL;
         le_mem_SetDestructor(servicePtr->messagePool, MessageDestructor);
 
         return &servicePtr->service;
@@ -283,6 +284,58 @@ void msgLocal_SetServiceRecvHandler
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the table of functions through which clients running in a local service's own thread call
+ * the server directly, instead of sending it messages.
+ *
+ * Does nothing if the service is not a local service.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetServiceDirectCalls
+(
+    le_msg_ServiceRef_t serviceRef, ///< [in] Reference to the service.
+    const void*         tablePtr    ///< [in] Table of functions, or NULL.
+)
+{
+    if ((serviceRef != NULL) && (serviceRef->type == LE_MSG_SERVICE_LOCAL))
+    {
+        CONTAINER_OF(serviceRef, le_msg_LocalService_t, service)->directCallsPtr = tablePtr;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the table of functions through which a client can call the server of a session directly.
+ *
+ * @return The table, or NULL if the session is not a local session, its service has no table, or
+ *         the calling thread is not the service's thread.
+ */
+//--------------------------------------------------------------------------------------------------
+const void* le_msg_GetSessionDirectCalls
+(
+    le_msg_SessionRef_t sessionRef  ///< [in] Reference to the session.
+)
+{
+    if ((sessionRef == NULL) || (sessionRef->type != LE_MSG_SESSION_LOCAL))
+    {
+        return NULL;
+    }
+
+    le_msg_LocalService_t* servicePtr =
+        CONTAINER_OF(sessionRef, msg_LocalSession_t, session)->servicePtr;
+
+    // Messages sent from any other thread are queued to the server's thread as usual.
+    if (servicePtr->receiver.thread != le_thread_GetCurrent())
+    {
+        return NULL;
+    }
+
+    return servicePtr->directCallsPtr;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Create a session that will always use message boxes to talk to a service in the same process
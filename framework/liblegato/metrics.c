@@ -0,0 +1,648 @@
+/** @file metrics.c
+ *
+ * Implementation of the @ref c_metrics.
+ *
+ * Counters and histograms have LE_CONFIG_METRICS_SHARDS shards, each in its own cache line.  A
+ * thread is given a shard, round robin, the first time it updates a metric, and then always
+ * updates that shard of every metric with relaxed atomic operations.  Threads sharing a shard
+ * don't lose updates, they only contend for the cache line.  Readers add the shards up.
+ *
+ * A gauge isn't sharded, because setting it has to replace the value every thread sees.
+ *
+ * The list of metrics is only locked to create, delete or iterate over metrics.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "metrics.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of metrics the metric pool starts with.
+ */
+//--------------------------------------------------------------------------------------------------
+#define METRIC_POOL_SIZE        16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of histograms the bucket pool starts with.
+ */
+//--------------------------------------------------------------------------------------------------
+#define HISTOGRAM_POOL_SIZE     4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of shards of counters and histograms.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SHARD_COUNT             LE_CONFIG_METRICS_SHARDS
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of a cache line, which each shard is padded to.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CACHE_LINE_BYTES        64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Histogram buckets.  Values below SUB_BUCKET_COUNT each have their own bucket.  Above that,
+ * each power of two is split into SUB_BUCKET_COUNT buckets of equal width, up to 2^MAX_MSB, and
+ * the last bucket also holds all the larger values.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SUB_BUCKET_BITS         2
+#define SUB_BUCKET_COUNT        (1 << SUB_BUCKET_BITS)
+#define MAX_MSB                 40
+#define BUCKET_COUNT            ((MAX_MSB - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A shard of a counter or histogram.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t    count;      ///< Value of a counter, or number of samples of a histogram.
+    uint64_t    sum;        ///< Sum of the samples of a histogram.
+    uint64_t    max;        ///< Largest sample of a histogram.
+    uint8_t     padding[CACHE_LINE_BYTES - (3 * sizeof(uint64_t))];
+}
+Shard_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Buckets of a histogram, by shard.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t    bucket[SHARD_COUNT][BUCKET_COUNT];  ///< Number of samples in each bucket.
+}
+Buckets_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A metric.
+ */
+//--------------------------------------------------------------------------------------------------
+struct le_metrics_Metric
+{
+    Shard_t             shard[SHARD_COUNT];             ///< Shards (counters and histograms).
+    le_dls_Link_t       link;                           ///< Link in the list of metrics.
+    char                name[LE_METRICS_NAME_MAX_BYTES];///< Name of the metric.
+    le_metrics_Type_t   type;                           ///< Type of the metric.
+    int64_t             gauge;                          ///< Value of a gauge.
+    Buckets_t          *bucketsPtr;                     ///< Buckets of a histogram, or NULL.
+};
+
+
+// Static pool the metrics are allocated from.
+LE_MEM_DEFINE_STATIC_POOL(Metrics, METRIC_POOL_SIZE, sizeof(struct le_metrics_Metric));
+
+// Pool the metrics are allocated from.
+static le_mem_PoolRef_t MetricPool;
+
+// Static pool the histograms' buckets are allocated from.
+LE_MEM_DEFINE_STATIC_POOL(MetricsHistograms, HISTOGRAM_POOL_SIZE, sizeof(Buckets_t));
+
+// Pool the histograms' buckets are allocated from.
+static le_mem_PoolRef_t BucketsPool;
+
+/// List of metrics, oldest first.
+static le_dls_List_t MetricList = LE_DLS_LIST_INIT;
+
+/// Protects the list of metrics.
+static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/// Shard to give to the next thread that updates a metric (atomic).
+static unsigned int NextShard;
+
+/// Shard the calling thread updates, plus one, or 0 if it hasn't been given one yet.
+static __thread unsigned int ThreadShard;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the shard of a metric that the calling thread updates.
+ *
+ * @return Pointer to the shard.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline Shard_t* GetShard
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The metric.
+)
+{
+    if (ThreadShard == 0)
+    {
+        ThreadShard = (__atomic_fetch_add(&NextShard, 1, __ATOMIC_RELAXED) % SHARD_COUNT) + 1;
+    }
+
+    return &metricRef->shard[ThreadShard - 1];
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the histogram bucket holding a value.
+ *
+ * @return Index of the bucket.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline size_t GetBucket
+(
+    uint64_t value
+)
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return value;
+    }
+
+    unsigned int msb = 63 - __builtin_clzll(value);
+    if (msb > MAX_MSB)
+    {
+        return BUCKET_COUNT - 1;
+    }
+
+    return ((msb - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) +
+           ((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the largest value held by a histogram bucket (but the last one, which holds all the larger
+ * values too).
+ *
+ * @return The value.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetBucketMax
+(
+    size_t bucket
+)
+{
+    if (bucket < SUB_BUCKET_COUNT)
+    {
+        return bucket;
+    }
+
+    unsigned int shift = (bucket >> SUB_BUCKET_BITS) - 1;
+    uint64_t subBucket = bucket & (SUB_BUCKET_COUNT - 1);
+
+    return ((SUB_BUCKET_COUNT + subBucket + 1) << shift) - 1;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find a metric by name.  The mutex must be held.
+ *
+ * @return The metric, or NULL if there is none by that name.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_metrics_Ref_t FindMetric
+(
+    const char* namePtr
+)
+{
+    le_dls_Link_t* linkPtr;
+
+    for (linkPtr = le_dls_Peek(&MetricList);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(&MetricList, linkPtr))
+    {
+        le_metrics_Ref_t metricRef = CONTAINER_OF(linkPtr, struct le_metrics_Metric, link);
+
+        if (strcmp(metricRef->name, namePtr) == 0)
+        {
+            return metricRef;
+        }
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a metric of a given type.
+ *
+ * @return Reference to the metric.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_metrics_Ref_t CreateMetric
+(
+    const char* namePtr,
+    le_metrics_Type_t type
+)
+{
+    le_metrics_Ref_t metricRef = le_mem_ForceAlloc(MetricPool);
+
+    memset(metricRef, 0, sizeof(*metricRef));
+    metricRef->link = LE_DLS_LINK_INIT;
+    metricRef->type = type;
+
+    LE_FATAL_IF(le_utf8_Copy(metricRef->name, namePtr, sizeof(metricRef->name), NULL) != LE_OK,
+                "Metric name '%s' is too long.", namePtr);
+
+    if (type == LE_METRICS_HISTOGRAM)
+    {
+        metricRef->bucketsPtr = le_mem_ForceAlloc(BucketsPool);
+        memset(metricRef->bucketsPtr, 0, sizeof(*metricRef->bucketsPtr));
+    }
+
+    LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+
+    LE_FATAL_IF(FindMetric(metricRef->name) != NULL,
+                "Metric '%s' already exists.", metricRef->name);
+    le_dls_Queue(&MetricList, &metricRef->link);
+
+    LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+
+    return metricRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a counter, starting at zero.
+ *
+ * @return Reference to the counter.
+ *
+ * @note Terminates the process if a metric with the same name already exists.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Ref_t le_metrics_CreateCounter
+(
+    const char* namePtr     ///< [IN] Name of the counter.
+)
+{
+    return CreateMetric(namePtr, LE_METRICS_COUNTER);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a gauge, starting at zero.
+ *
+ * @return Reference to the gauge.
+ *
+ * @note Terminates the process if a metric with the same name already exists.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Ref_t le_metrics_CreateGauge
+(
+    const char* namePtr     ///< [IN] Name of the gauge.
+)
+{
+    return CreateMetric(namePtr, LE_METRICS_GAUGE);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an empty histogram.
+ *
+ * @return Reference to the histogram.
+ *
+ * @note Terminates the process if a metric with the same name already exists.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Ref_t le_metrics_CreateHistogram
+(
+    const char* namePtr     ///< [IN] Name of the histogram.
+)
+{
+    return CreateMetric(namePtr, LE_METRICS_HISTOGRAM);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a metric.  It must no longer be updated or read by any thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_Delete
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The metric.
+)
+{
+    LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+    le_dls_Remove(&MetricList, &metricRef->link);
+    LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+
+    if (metricRef->bucketsPtr != NULL)
+    {
+        le_mem_Release(metricRef->bucketsPtr);
+    }
+    le_mem_Release(metricRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add to a counter.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_Add
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The counter.
+    uint64_t amount             ///< [IN] Amount to add.
+)
+{
+    LE_ASSERT(metricRef->type == LE_METRICS_COUNTER);
+
+    __atomic_fetch_add(&GetShard(metricRef)->count, amount, __ATOMIC_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the value of a gauge.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_SetGauge
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The gauge.
+    int64_t value               ///< [IN] New value.
+)
+{
+    LE_ASSERT(metricRef->type == LE_METRICS_GAUGE);
+
+    __atomic_store_n(&metricRef->gauge, value, __ATOMIC_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add to the value of a gauge.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_AddToGauge
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The gauge.
+    int64_t amount              ///< [IN] Amount to add (negative to subtract).
+)
+{
+    LE_ASSERT(metricRef->type == LE_METRICS_GAUGE);
+
+    __atomic_fetch_add(&metricRef->gauge, amount, __ATOMIC_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record a sample in a histogram.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_Record
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The histogram.
+    uint64_t value              ///< [IN] Value of the sample.
+)
+{
+    LE_ASSERT(metricRef->type == LE_METRICS_HISTOGRAM);
+
+    Shard_t* shardPtr = GetShard(metricRef);
+    size_t shardIndex = shardPtr - metricRef->shard;
+
+    __atomic_fetch_add(&metricRef->bucketsPtr->bucket[shardIndex][GetBucket(value)], 1,
+                       __ATOMIC_RELAXED);
+    __atomic_fetch_add(&shardPtr->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&shardPtr->sum, value, __ATOMIC_RELAXED);
+
+    uint64_t max = __atomic_load_n(&shardPtr->max, __ATOMIC_RELAXED);
+    while ((value > max) &&
+           !__atomic_compare_exchange_n(&shardPtr->max, &max, value, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the value of a counter, or the number of samples recorded by a histogram.
+ *
+ * @return The count.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_metrics_GetCount
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The counter or histogram.
+)
+{
+    LE_ASSERT(metricRef->type != LE_METRICS_GAUGE);
+
+    uint64_t count = 0;
+    size_t i;
+
+    for (i = 0; i < SHARD_COUNT; i++)
+    {
+        count += __atomic_load_n(&metricRef->shard[i].count, __ATOMIC_RELAXED);
+    }
+
+    return count;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the value of a gauge.
+ *
+ * @return The value.
+ */
+//--------------------------------------------------------------------------------------------------
+int64_t le_metrics_GetGauge
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The gauge.
+)
+{
+    LE_ASSERT(metricRef->type == LE_METRICS_GAUGE);
+
+    return __atomic_load_n(&metricRef->gauge, __ATOMIC_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the sum of the samples recorded by a histogram.
+ *
+ * @return The sum (wraps around if it doesn't fit in 64 bits).
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_metrics_GetSum
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The histogram.
+)
+{
+    LE_ASSERT(metricRef->type == LE_METRICS_HISTOGRAM);
+
+    uint64_t sum = 0;
+    size_t i;
+
+    for (i = 0; i < SHARD_COUNT; i++)
+    {
+        sum += __atomic_load_n(&metricRef->shard[i].sum, __ATOMIC_RELAXED);
+    }
+
+    return sum;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Estimate a percentile of the samples recorded by a histogram.
+ *
+ * @return The largest value of the bucket holding the given percentile (the largest value
+ *         recorded for 100), or 0 if the histogram is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_metrics_GetPercentile
+(
+    le_metrics_Ref_t metricRef, ///< [IN] The histogram.
+    double percentile           ///< [IN] Percentile, from 0 to 100.
+)
+{
+    LE_ASSERT(metricRef->type == LE_METRICS_HISTOGRAM);
+    LE_ASSERT((percentile >= 0) && (percentile <= 100));
+
+    uint64_t total = 0;
+    uint64_t max = 0;
+    size_t shard;
+    size_t bucket;
+
+    // Add the buckets up rather than the shards' counts, so that the rank is taken from the same
+    // samples as the buckets it is looked for in (unless samples are recorded in between).
+    for (shard = 0; shard < SHARD_COUNT; shard++)
+    {
+        uint64_t shardMax = __atomic_load_n(&metricRef->shard[shard].max, __ATOMIC_RELAXED);
+        if (shardMax > max)
+        {
+            max = shardMax;
+        }
+
+        for (bucket = 0; bucket < BUCKET_COUNT; bucket++)
+        {
+            total += __atomic_load_n(&metricRef->bucketsPtr->bucket[shard][bucket],
+                                     __ATOMIC_RELAXED);
+        }
+    }
+
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    // Rank (1 to total) of the sample at the percentile.
+    double exactRank = percentile * total / 100;
+    uint64_t rank = (uint64_t)exactRank;
+    if ((rank < exactRank) || (rank == 0))
+    {
+        rank++;
+    }
+
+    uint64_t seen = 0;
+    for (bucket = 0; bucket < BUCKET_COUNT - 1; bucket++)
+    {
+        for (shard = 0; shard < SHARD_COUNT; shard++)
+        {
+            seen += __atomic_load_n(&metricRef->bucketsPtr->bucket[shard][bucket],
+                                    __ATOMIC_RELAXED);
+        }
+
+        if (seen >= rank)
+        {
+            uint64_t bucketMax = GetBucketMax(bucket);
+            return (bucketMax < max ? bucketMax : max);
+        }
+    }
+
+    return max;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the name of a metric.
+ *
+ * @return The name.
+ */
+//--------------------------------------------------------------------------------------------------
+const char* le_metrics_GetName
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The metric.
+)
+{
+    return metricRef->name;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the type of a metric.
+ *
+ * @return The type.
+ */
+//--------------------------------------------------------------------------------------------------
+le_metrics_Type_t le_metrics_GetType
+(
+    le_metrics_Ref_t metricRef  ///< [IN] The metric.
+)
+{
+    return metricRef->type;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Call a function for each metric of the process, oldest first.
+ *
+ * @warning The function must not create or delete metrics.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_metrics_ForEach
+(
+    le_metrics_ForEachFunc_t func,  ///< [IN] Function to call.
+    void* contextPtr                ///< [IN] Context pointer to pass to it.
+)
+{
+    le_dls_Link_t* linkPtr;
+
+    LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+
+    for (linkPtr = le_dls_Peek(&MetricList);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(&MetricList, linkPtr))
+    {
+        func(CONTAINER_OF(linkPtr, struct le_metrics_Metric, link), contextPtr);
+    }
+
+    LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the metrics module.
+ *
+ * Must be called exactly once at start-up before any other metrics functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void metrics_Init
+(
+    void
+)
+{
+    MetricPool = le_mem_InitStaticPool(Metrics, METRIC_POOL_SIZE,
+                                       sizeof(struct le_metrics_Metric));
+    BucketsPool = le_mem_InitStaticPool(MetricsHistograms, HISTOGRAM_POOL_SIZE,
+                                        sizeof(Buckets_t));
+}
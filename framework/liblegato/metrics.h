@@ -0,0 +1,27 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file metrics.h
+ *
+ * Interfaces exported by the metrics module to other modules inside the Legato framework
+ * implementation.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef METRICS_H_INCLUDE_GUARD
+#define METRICS_H_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the metrics module.
+ *
+ * Must be called exactly once at start-up before any other metrics functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void metrics_Init
+(
+    void
+);
+
+#endif // METRICS_H_INCLUDE_GUARD
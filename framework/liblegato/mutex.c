@@ -173,6 +173,8 @@ le_mutex_Ref_t CreateMutex
     mutexPtr->lockedByThreadLink = LE_DLS_LINK_INIT;
     mutexPtr->waitingList = LE_DLS_LIST_INIT;
     pthread_mutex_init(&mutexPtr->waitingListMutex, NULL);  // Default attributes = Fast mutex.
+    mutexPtr->contendedCount = 0;
+    mutexPtr->waitTimeUs = 0;
 #endif
     mutexPtr->isRecursive = isRecursive;
     mutexPtr->lockCount = 0;
@@ -553,19 +555,37 @@ void le_mutex_Lock
     mutex_ThreadRec_t* perThreadRecPtr = thread_TryGetMutexRecPtr();
 
 #if LE_CONFIG_LINUX_TARGET_TOOLS
-    if (perThreadRecPtr)
+    // Most locks are uncontended, so try to take the lock first.  Only a thread that actually has
+    // to wait goes on the mutex's waiting list, where the Inspect tool can see it.
+    result = pthread_mutex_trylock(&mutexRef->mutex);
+
+    if (result == EBUSY)
     {
-        AddToWaitingList(mutexRef, perThreadRecPtr);
-    }
-#endif
+        le_clk_Time_t startTime = le_clk_GetRelativeTime();
 
-    result = pthread_mutex_lock(&mutexRef->mutex);
+        if (perThreadRecPtr)
+        {
+            AddToWaitingList(mutexRef, perThreadRecPtr);
+        }
 
-#if LE_CONFIG_LINUX_TARGET_TOOLS
-    if (perThreadRecPtr)
-    {
-        RemoveFromWaitingList(mutexRef, perThreadRecPtr);
+        result = pthread_mutex_lock(&mutexRef->mutex);
+
+        if (perThreadRecPtr)
+        {
+            RemoveFromWaitingList(mutexRef, perThreadRecPtr);
+        }
+
+        if (result == 0)
+        {
+            // The contention statistics are protected by the mutex itself.
+            le_clk_Time_t waitTime = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+            mutexRef->contendedCount++;
+            mutexRef->waitTimeUs += ((uint64_t)waitTime.sec * 1000000) + waitTime.usec;
+        }
     }
+#else
+    result = pthread_mutex_lock(&mutexRef->mutex);
 #endif
 
     if (result == 0)
@@ -25,6 +25,8 @@ typedef struct le_mutex
     le_dls_Link_t       lockedByThreadLink; ///< Used to link onto the thread's locked mutexes list.
     le_dls_List_t       waitingList;        ///< List of threads waiting for this mutex.
     pthread_mutex_t     waitingListMutex;   ///< Pthreads mutex used to protect the waiting list.
+    uint32_t            contendedCount;     ///< Number of lock calls that had to wait.
+    uint64_t            waitTimeUs;         ///< Total time spent waiting for the lock (in usec).
 #endif
     bool                isRecursive;        ///< true if recursive, false otherwise.
     int                 lockCount;      ///< Number of lock calls not yet matched by unlock calls.
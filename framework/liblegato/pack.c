@@ -37,6 +37,29 @@ LE_DEFINE_INLINE bool le_pack_PackArrayHeader(uint8_t **bufferPtr,
                                            size_t arrayCount,
                                            size_t arrayMaxCount);
 
+LE_DEFINE_INLINE bool le_pack_PackIntArray(uint8_t **bufferPtr,
+                                          const void *arrayPtr,
+                                          size_t elementSize,
+                                          size_t arrayCount,
+                                          size_t arrayMaxCount,
+                                          uint8_t elementTag);
+LE_DEFINE_INLINE bool le_pack_PackUint8Array(uint8_t **bufferPtr, const uint8_t *arrayPtr,
+                                             size_t arrayCount, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_PackUint16Array(uint8_t **bufferPtr, const uint16_t *arrayPtr,
+                                              size_t arrayCount, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_PackUint32Array(uint8_t **bufferPtr, const uint32_t *arrayPtr,
+                                              size_t arrayCount, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_PackUint64Array(uint8_t **bufferPtr, const uint64_t *arrayPtr,
+                                              size_t arrayCount, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_PackInt8Array(uint8_t **bufferPtr, const int8_t *arrayPtr,
+                                            size_t arrayCount, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_PackInt16Array(uint8_t **bufferPtr, const int16_t *arrayPtr,
+                                             size_t arrayCount, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_PackInt32Array(uint8_t **bufferPtr, const int32_t *arrayPtr,
+                                             size_t arrayCount, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_PackInt64Array(uint8_t **bufferPtr, const int64_t *arrayPtr,
+                                             size_t arrayCount, size_t arrayMaxCount);
+
 LE_DEFINE_INLINE bool le_pack_UnpackUint8(uint8_t** bufferPtr, uint8_t* valuePtr);
 LE_DEFINE_INLINE bool le_pack_UnpackUint16(uint8_t** bufferPtr, uint16_t* valuePtr);
 LE_DEFINE_INLINE bool le_pack_UnpackUint32(uint8_t** bufferPtr, uint32_t* valuePtr);
@@ -61,6 +84,27 @@ LE_DEFINE_INLINE bool le_pack_UnpackArrayHeader(uint8_t **bufferPtr,
                                              size_t elementSize,
                                              size_t *arrayCountPtr,
                                              size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackIntArray(uint8_t **bufferPtr,
+                                            void *arrayPtr,
+                                            size_t elementSize,
+                                            size_t *arrayCountPtr,
+                                            size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackUint8Array(uint8_t **bufferPtr, uint8_t *arrayPtr,
+                                               size_t *arrayCountPtr, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackUint16Array(uint8_t **bufferPtr, uint16_t *arrayPtr,
+                                                size_t *arrayCountPtr, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackUint32Array(uint8_t **bufferPtr, uint32_t *arrayPtr,
+                                                size_t *arrayCountPtr, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackUint64Array(uint8_t **bufferPtr, uint64_t *arrayPtr,
+                                                size_t *arrayCountPtr, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackInt8Array(uint8_t **bufferPtr, int8_t *arrayPtr,
+                                              size_t *arrayCountPtr, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackInt16Array(uint8_t **bufferPtr, int16_t *arrayPtr,
+                                               size_t *arrayCountPtr, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackInt32Array(uint8_t **bufferPtr, int32_t *arrayPtr,
+                                               size_t *arrayCountPtr, size_t arrayMaxCount);
+LE_DEFINE_INLINE bool le_pack_UnpackInt64Array(uint8_t **bufferPtr, int64_t *arrayPtr,
+                                               size_t *arrayCountPtr, size_t arrayMaxCount);
 
 #ifdef LE_CONFIG_RPC
 LE_DEFINE_INLINE bool le_pack_PackTagID(uint8_t** bufferPtr, TagID_t value);
@@ -4,6 +4,15 @@
  * This Random Number API is a wrapper around a cryptographic pseudo-random number generator (CPRNG)
  * that is properly seeded with entropy.
  *
+ * Asking the platform for random data costs a system call, so each thread has its own ChaCha20
+ * generator, seeded from the platform.  Each time it runs out of random data, the generator
+ * produces a few ChaCha20 blocks, replaces its key with the first 32 bytes of them ("fast key
+ * erasure") and hands out the rest, wiping each byte as it goes.  Neither the past output nor the
+ * key that produced it can be recovered from the state of the generator.
+ *
+ * The generator is reseeded from the platform after RESEED_BYTES bytes, and in a child process
+ * after a fork, so that the parent and the child never produce the same numbers.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
@@ -12,6 +21,238 @@
 #include "fa/rand.h"
 #include "rand.h"
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of bytes in a ChaCha20 key and in a ChaCha20 block.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KEY_BYTES               32
+#define BLOCK_BYTES             64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of ChaCha20 blocks produced each time a generator runs out of random data.
+ */
+//--------------------------------------------------------------------------------------------------
+#define BUFFER_BLOCKS           4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of bytes a generator produces before it is reseeded from the platform.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RESEED_BYTES            (1024 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Per-thread generator.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t key[KEY_BYTES / sizeof(uint32_t)];         ///< Key of the next blocks.
+    uint8_t  buffer[BUFFER_BLOCKS * BLOCK_BYTES];       ///< Random data not handed out yet is at
+                                                        ///  the end.
+    size_t   available;                                 ///< Number of bytes left in the buffer.
+    size_t   produced;                                  ///< Bytes produced since the last seed.
+    uint32_t forkCount;                                 ///< ForkCount when last seeded.
+    bool     isSeeded;                                  ///< Has been seeded at least once.
+}
+Generator_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generator of the calling thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static __thread Generator_t Generator;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of forks the process's ancestors have gone through since liblegato was initialized.
+ * Generators seeded before the last fork must be reseeded.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t ForkCount = 0;
+
+#define ROTL32(v, n)            (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTER_ROUND(a, b, c, d)                                                                  \
+    do                                                                                             \
+    {                                                                                              \
+        a += b; d ^= a; d = ROTL32(d, 16);                                                         \
+        c += d; b ^= c; b = ROTL32(b, 12);                                                         \
+        a += b; d ^= a; d = ROTL32(d, 8);                                                          \
+        c += d; b ^= c; b = ROTL32(b, 7);                                                          \
+    } while (0)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a ChaCha20 block (RFC 8439) with a zero nonce.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ChaChaBlock
+(
+    const uint32_t* keyPtr,     ///< [IN]  Key (8 words).
+    uint32_t counter,           ///< [IN]  Block counter.
+    uint8_t* outPtr             ///< [OUT] BLOCK_BYTES bytes of output.
+)
+{
+    uint32_t input[16] =
+    {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        keyPtr[0], keyPtr[1], keyPtr[2], keyPtr[3],
+        keyPtr[4], keyPtr[5], keyPtr[6], keyPtr[7],
+        counter, 0, 0, 0
+    };
+    uint32_t x[16];
+    int i;
+
+    memcpy(x, input, sizeof(x));
+
+    for (i = 0; i < 10; i++)
+    {
+        QUARTER_ROUND(x[0], x[4], x[8],  x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9],  x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8],  x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9],  x[14]);
+    }
+
+    // Serialize little-endian, whatever the byte order of the CPU.
+    for (i = 0; i < 16; i++)
+    {
+        uint32_t v = x[i] + input[i];
+
+        outPtr[4 * i]     = (uint8_t)v;
+        outPtr[4 * i + 1] = (uint8_t)(v >> 8);
+        outPtr[4 * i + 2] = (uint8_t)(v >> 16);
+        outPtr[4 * i + 3] = (uint8_t)(v >> 24);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * (Re)seed a generator from the platform's random number generator.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Seed
+(
+    Generator_t* genPtr         ///< [IN] Generator to seed.
+)
+{
+    uint32_t seed[KEY_BYTES / sizeof(uint32_t)];
+    size_t i;
+
+    le_result_t result = fa_rand_Read(seed, sizeof(seed));
+    LE_FATAL_IF(result != LE_OK, "Could not read random numbers (%s).", LE_RESULT_TXT(result));
+
+    // Mix the seed into the current key rather than replacing it, so that a weak seed never makes
+    // the generator weaker than it was.
+    for (i = 0; i < NUM_ARRAY_MEMBERS(seed); i++)
+    {
+        genPtr->key[i] ^= seed[i];
+    }
+    memset(seed, 0, sizeof(seed));
+
+    // Drop the data produced with the old key.
+    memset(genPtr->buffer, 0, sizeof(genPtr->buffer));
+    genPtr->available = 0;
+    genPtr->produced = 0;
+    genPtr->forkCount = __atomic_load_n(&ForkCount, __ATOMIC_RELAXED);
+    genPtr->isSeeded = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refill a generator's buffer, and replace its key.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Refill
+(
+    Generator_t* genPtr         ///< [IN] Generator to refill.
+)
+{
+    uint32_t i;
+
+    if ( (!genPtr->isSeeded) ||
+         (genPtr->produced >= RESEED_BYTES) ||
+         (genPtr->forkCount != __atomic_load_n(&ForkCount, __ATOMIC_RELAXED)) )
+    {
+        Seed(genPtr);
+    }
+
+    for (i = 0; i < BUFFER_BLOCKS; i++)
+    {
+        ChaChaBlock(genPtr->key, i, genPtr->buffer + (i * BLOCK_BYTES));
+    }
+
+    // The first bytes become the next key, and are never handed out.
+    memcpy(genPtr->key, genPtr->buffer, KEY_BYTES);
+    memset(genPtr->buffer, 0, KEY_BYTES);
+
+    genPtr->available = sizeof(genPtr->buffer) - KEY_BYTES;
+    genPtr->produced += genPtr->available;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fill a buffer with random data from the calling thread's generator.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Generate
+(
+    void* bufPtr,               ///< [OUT] Buffer to fill.
+    size_t bufSize              ///< [IN]  Number of bytes to fill.
+)
+{
+    Generator_t* genPtr = &Generator;
+    uint8_t* outPtr = bufPtr;
+
+    // A fork is checked for even if data is left, so that the child doesn't hand out the rest of
+    // the parent's buffer.
+    if (genPtr->forkCount != __atomic_load_n(&ForkCount, __ATOMIC_RELAXED))
+    {
+        genPtr->available = 0;
+    }
+
+    while (bufSize > 0)
+    {
+        if (genPtr->available == 0)
+        {
+            Refill(genPtr);
+        }
+
+        size_t count = (bufSize < genPtr->available ? bufSize : genPtr->available);
+        uint8_t* srcPtr = genPtr->buffer + sizeof(genPtr->buffer) - genPtr->available;
+
+        memcpy(outPtr, srcPtr, count);
+        memset(srcPtr, 0, count);
+
+        genPtr->available -= count;
+        outPtr += count;
+        bufSize -= count;
+    }
+}
+
+#if LE_CONFIG_LINUX
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called in the child process after a fork.  Makes every generator reseed before it is used again.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AtForkChild
+(
+    void
+)
+{
+    __atomic_add_fetch(&ForkCount, 1, __ATOMIC_RELAXED);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initializes the Random Number API service.
@@ -23,6 +264,10 @@ void rand_Init
 )
 {
     fa_rand_Init();
+
+#if LE_CONFIG_LINUX
+    LE_ASSERT(pthread_atfork(NULL, NULL, AtForkChild) == 0);
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -41,8 +286,6 @@ uint32_t le_rand_GetNumBetween
     uint32_t max    ///< [IN] Maximum value in range (inclusive).
 )
 {
-    le_result_t result;
-
     LE_ASSERT(max > min);
 
     // Determine range of numbers to reject.
@@ -56,8 +299,7 @@ uint32_t le_rand_GetNumBetween
 
     for (;;)
     {
-        result = fa_rand_Read(&randNum, sizeof(randNum));
-        LE_FATAL_IF(result != LE_OK, "Could not read random numbers (%s).", LE_RESULT_TXT(result));
+        Generate(&randNum, sizeof(randNum));
 
         // Check if this number is valid.  Reject numbers that are about greater than or equal to
         // our threshold to avoid bias.
@@ -81,6 +323,22 @@ void le_rand_GetBuffer
     uint8_t *bufPtr,    ///< [OUT] Buffer to store the random numbers in.
     size_t   bufSize    ///< [IN]  Number of random numbers to get.
 )
+{
+    LE_ASSERT(bufPtr != NULL);
+
+    Generate(bufPtr, bufSize);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a buffer of random numbers straight from the platform's random number generator.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_rand_GetEntropy
+(
+    uint8_t *bufPtr,    ///< [OUT] Buffer to store the random numbers in.
+    size_t   bufSize    ///< [IN]  Number of random numbers to get.
+)
 {
     le_result_t result;
 
@@ -49,6 +49,43 @@ static le_rbtree_Node_t NullNode =
 };
 
 
+/**
+ * Recompute the augmented data of node x from its children.
+ */
+static void Augment
+(
+    le_rbtree_Tree_t *rbt,
+    le_rbtree_Node_t *x
+)
+{
+    if (rbt->augmentFn != NULL && x != LE_RBTREE_NULL)
+    {
+        rbt->augmentFn(x,
+                       x->left != LE_RBTREE_NULL ? x->left : NULL,
+                       x->right != LE_RBTREE_NULL ? x->right : NULL);
+    }
+}
+
+
+/**
+ * Recompute the augmented data of node x and all of its ancestors.
+ */
+static void AugmentToRoot
+(
+    le_rbtree_Tree_t *rbt,
+    le_rbtree_Node_t *x
+)
+{
+    if (rbt->augmentFn != NULL)
+    {
+        for (; x != LE_RBTREE_NULL; x = x->parent)
+        {
+            Augment(rbt, x);
+        }
+    }
+}
+
+
 /**
  * Rotate node x to left.
  *
@@ -95,6 +132,10 @@ static void RotateLeft
     {
         x->parent = y;
     }
+
+    /* x is now below y; the subtree of y holds the same nodes as x's did before */
+    Augment(rbt, x);
+    Augment(rbt, y);
 }
 
 
@@ -144,6 +185,9 @@ static void RotateRight
     {
         x->parent = y;
     }
+
+    Augment(rbt, x);
+    Augment(rbt, y);
 }
 
 
@@ -344,6 +388,24 @@ void le_rbtree_InitTree
     tree->root = LE_RBTREE_NULL;
     tree->size = 0;
     tree->compFn = compFn;
+    tree->augmentFn = NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the function maintaining the summary data of an augmented tree.  Must be called while the
+ * tree is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_rbtree_SetAugmentFunc
+(
+    le_rbtree_Tree_t *tree,             ///< [IN] Pointer to the tree object.
+    le_rbtree_AugmentFunc_t augmentFn   ///< [IN] Augment function.
+)
+{
+    LE_ASSERT(tree->size == 0);
+    tree->augmentFn = augmentFn;
 }
 
 
@@ -565,6 +627,8 @@ le_rbtree_Node_t* le_rbtree_Insert
         {
             parent->right = current;
         }
+        /* the rotations done by the fixup keep the augmented data valid if it already is */
+        AugmentToRoot(rbt, current);
         InsertFixup(rbt, current);
     }
     else
@@ -572,6 +636,7 @@ le_rbtree_Node_t* le_rbtree_Insert
         rbt->root = current;
         current->parent = LE_RBTREE_NULL;
         current->color = LE_RBTREE_BLACK;
+        Augment(rbt, current);
     }
     ++rbt->size;
     return element;
@@ -631,6 +696,8 @@ le_rbtree_Node_t* le_rbtree_Remove
 {
     le_rbtree_Node_t *y;
     le_rbtree_Node_t *child;
+    le_rbtree_Node_t *changed;
+    le_rbtree_Color_t removedColor;
 
     if (NULL == z || (LE_RBTREE_NULL == z) || (LE_RBTREE_NO_COLOR == z->color))
     {
@@ -659,6 +726,12 @@ le_rbtree_Node_t* le_rbtree_Remove
     /* x is y's only child */
     child = (y->left != LE_RBTREE_NULL) ? y->left : y->right;
 
+    /* lowest node whose subtree loses a node; y takes z's place if z is y's parent */
+    changed = (y->parent == z) ? y : y->parent;
+
+    /* the colour that disappears from y's old position */
+    removedColor = y->color;
+
     /* Remove y from the tree. */
     child->parent = y->parent;
     if (y->parent != LE_RBTREE_NULL)
@@ -707,6 +780,11 @@ le_rbtree_Node_t* le_rbtree_Remove
         {
             z->right->parent = y;
         }
+        if (child->parent == z)
+        {
+            /* y was z's child: child is now y's (this matters when child is the NULL node) */
+            child->parent = y;
+        }
 
         if (rbt->root == z)
         {
@@ -717,16 +795,19 @@ le_rbtree_Node_t* le_rbtree_Remove
     /* reset the deleted node parent-left-right pointers, but preserve the key */
     le_rbtree_InitNode(z, z->key);
 
+    AugmentToRoot(rbt, changed);
+
     /*
      * Removing a black node might make some paths from root to leaf contain
      * fewer black nodes than others, or it might make two red nodes adjacent.
      */
-    if (y->color == LE_RBTREE_BLACK)
+    if (removedColor == LE_RBTREE_BLACK)
     {
-        if (child != LE_RBTREE_NULL)
-        {
-            DeleteFixup(rbt, child);
-        }
+        /*
+         * child may be the NULL node, whose parent was set above so that the fixup can walk up
+         * from it.
+         */
+        DeleteFixup(rbt, child);
     }
 
     --rbt->size;
@@ -759,3 +840,141 @@ le_rbtree_Node_t* le_rbtree_RemoveByKey
 
     return le_rbtree_Remove(rbt, z);
 }
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the first node in the tree whose key is greater than (or equal to, if orEqual is true)
+ * the given key.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_rbtree_Node_t* FindBound
+(
+    const le_rbtree_Tree_t *rbt,    ///< [IN] Tree to search.
+    const void *key,                ///< [IN] Pointer to the key.
+    bool orEqual                    ///< [IN] Whether a node with an equal key is a match.
+)
+{
+    le_rbtree_Node_t *node = rbt->root;
+    le_rbtree_Node_t *bound = NULL;
+    le_rbtree_CompareFunc_t compFn = rbt->compFn;
+
+    while (node != LE_RBTREE_NULL)
+    {
+        int cmp = (compFn)(key, node->key);
+        if (cmp < 0 || (cmp == 0 && orEqual))
+        {
+            /* node is a candidate; look for a smaller one on the left */
+            bound = node;
+            node = node->left;
+        }
+        else
+        {
+            node = node->right;
+        }
+    }
+    return bound;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the first node in the tree whose key is greater than or equal to the given key.
+ *
+ * @return Pointer to the Node found in the tree.
+ *         NULL if all keys are less than the given key.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_LowerBound
+(
+    const le_rbtree_Tree_t *rbt,    ///< [IN] Tree to search.
+    const void *key                 ///< [IN] Pointer to the key.
+)
+{
+    return FindBound(rbt, key, true);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the first node in the tree whose key is greater than the given key.
+ *
+ * @return Pointer to the Node found in the tree.
+ *         NULL if no key is greater than the given key.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_UpperBound
+(
+    const le_rbtree_Tree_t *rbt,    ///< [IN] Tree to search.
+    const void *key                 ///< [IN] Pointer to the key.
+)
+{
+    return FindBound(rbt, key, false);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the root node of the tree, to walk down an augmented tree.
+ *
+ * @return Pointer to the root node.
+ *         NULL if the tree is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_GetRoot
+(
+    const le_rbtree_Tree_t *rbt    ///< [IN] Tree to get the node from.
+)
+{
+    return rbt->root != LE_RBTREE_NULL ? rbt->root : NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the left child of a node (whose keys are all less than the node's).
+ *
+ * @return Pointer to the child node.
+ *         NULL if the node has no left child.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_GetLeftChild
+(
+    const le_rbtree_Node_t *x      ///< [IN] Node in a tree.
+)
+{
+    return x->left != LE_RBTREE_NULL ? x->left : NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the right child of a node (whose keys are all greater than the node's).
+ *
+ * @return Pointer to the child node.
+ *         NULL if the node has no right child.
+ */
+//--------------------------------------------------------------------------------------------------
+le_rbtree_Node_t* le_rbtree_GetRightChild
+(
+    const le_rbtree_Node_t *x      ///< [IN] Node in a tree.
+)
+{
+    return x->right != LE_RBTREE_NULL ? x->right : NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Recompute the summary data of a node and of its ancestors, after a change to the node's own
+ * contribution to it.  Does nothing if the tree has no augment function.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_rbtree_UpdateAugment
+(
+    le_rbtree_Tree_t *rbt,     ///< [IN] Tree containing the node.
+    le_rbtree_Node_t *x        ///< [IN] Node whose data has changed.
+)
+{
+    AugmentToRoot(rbt, x);
+}
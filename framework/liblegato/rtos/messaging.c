@@ -287,6 +287,27 @@ le_msg_MessageRef_t le_msg_CreateMsg
     return msgLocal_CreateMsg(sessionRef);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a message to be sent over a given session, with a payload buffer of a given size.
+ *
+ * Local messages are always as big as the service's largest message, so this is the same as
+ * le_msg_CreateMsg().
+ *
+ * @return  Message reference.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_MessageRef_t le_msg_CreateSizedMsg
+(
+    le_msg_SessionRef_t sessionRef,     ///< [in] Reference to the session.
+    size_t              payloadSize     ///< [in] Size of the payload buffer, in bytes.
+)
+{
+    LE_UNUSED(payloadSize);
+
+    return msgLocal_CreateMsg(sessionRef);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Adds to the reference count on a message object.
@@ -9,6 +9,12 @@
  *       processor architectures.  Also, if they try to use a memory address as a Safe Ref,
  *       the memory address is guaranteed to be detected as an invalid Safe Reference.
  *
+ * @note Lookups don't take any lock, so that servers can translate references from several
+ *       threads at once.  This works because blocks are never freed or moved once they are in the
+ *       map: the writer fills in a new overflow block before linking it in, links it in before
+ *       growing the map's size, and stores each slot atomically; the lookup reads them in the
+ *       opposite order.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 
@@ -287,7 +293,8 @@ static bool ReadRef
     *blockNum = IndexToBlockNum(mapRef, index);
     *slot = IndexToSlot(mapRef, index);
 
-    return (safety == REF_SAFETY_MASK && base == mapRef->mapBase && index < mapRef->size);
+    return (safety == REF_SAFETY_MASK && base == mapRef->mapBase &&
+            index < LE_ATOMIC_LOAD(&mapRef->size, LE_ATOMIC_ORDER_ACQUIRE));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -316,11 +323,11 @@ static void **FindSlot
     block = mapRef->blocksPtr;
     for (i = 1; i <= blockNum; ++i)
     {
-        if (block->nextPtr == NULL)
+        block = LE_ATOMIC_LOAD(&block->nextPtr, LE_ATOMIC_ORDER_ACQUIRE);
+        if (block == NULL)
         {
             return NULL;
         }
-        block = block->nextPtr;
     }
 
     return &block->slots[slot];
@@ -394,6 +401,7 @@ static void *Lookup
     char      buffer[REF_DBG_BUFFER_LENGTH];
 #endif
     void    **result;
+    void     *ptr;
 
     SAFE_REF_TRACE(mapRef, "Looking up safe reference %s in %s",
         DebugSafeRef(mapRef, safeRef, buffer), SAFEREF_NAME(mapRef->name));
@@ -405,8 +413,9 @@ static void *Lookup
         return NULL;
     }
 
-    SAFE_REF_TRACE(mapRef, "    Found entry %p at %p", *result, result);
-    return *result;
+    ptr = LE_ATOMIC_LOAD(result, LE_ATOMIC_ORDER_ACQUIRE);
+    SAFE_REF_TRACE(mapRef, "    Found entry %p at %p", ptr, result);
+    return ptr;
 }
 
 // =============================================
@@ -502,6 +511,7 @@ void *le_ref_CreateRef
     size_t               j;
     size_t               slotCount;
     struct le_ref_Block *block;
+    struct le_ref_Block *newBlock;
     void                *result = NULL;
 
     SAFE_REF_TRACE(mapRef, "Creating safe reference for %p in %s", ptr, SAFEREF_NAME(mapRef->name));
@@ -519,7 +529,7 @@ void *le_ref_CreateRef
             if (block->slots[j] == NULL)
             {
                 index = BlockAndSlotToIndex(mapRef, i, j);
-                block->slots[j] = ptr;
+                LE_ATOMIC_STORE(&block->slots[j], ptr, LE_ATOMIC_ORDER_RELEASE);
                 SAFE_REF_TRACE(mapRef, "    Inserted %p at %" PRIuS " (%p)", ptr, index,
                     &block->slots[j]);
                 result = MakeRef(mapRef->mapBase, index);
@@ -535,14 +545,16 @@ void *le_ref_CreateRef
     }
 
     index = BlockAndSlotToIndex(mapRef, blockCount, 0);
-    block->nextPtr = NewOverflowBlock();
-    block = block->nextPtr;
-    SAFE_REF_TRACE(mapRef, "    Created new overflow block %p", block);
-
-    block->slots[0] = ptr;
-    SAFE_REF_TRACE(mapRef, "    Inserted %p at %" PRIuS " (%p)", ptr, index, &block->slots[0]);
+    newBlock = NewOverflowBlock();
+    SAFE_REF_TRACE(mapRef, "    Created new overflow block %p", newBlock);
+
+    // Fill the block in, then publish it, then make its indices valid, so that a concurrent
+    // lookup never sees a partial block.
+    newBlock->slots[0] = ptr;
+    LE_ATOMIC_STORE(&block->nextPtr, newBlock, LE_ATOMIC_ORDER_RELEASE);
+    SAFE_REF_TRACE(mapRef, "    Inserted %p at %" PRIuS " (%p)", ptr, index, &newBlock->slots[0]);
     result = MakeRef(mapRef->mapBase, index);
-    mapRef->size += OVERFLOW_BLOCK_SIZE;
+    LE_ATOMIC_STORE(&mapRef->size, mapRef->size + OVERFLOW_BLOCK_SIZE, LE_ATOMIC_ORDER_RELEASE);
     LE_WARN("Safe reference map maximum exceeded for %s, new size %" PRIuS,
             SAFEREF_NAME(mapRef->name), mapRef->size);
     mapRef->index = mapRef->size;
@@ -602,7 +614,7 @@ void le_ref_DeleteRef
     }
     else
     {
-        *slot = NULL;
+        LE_ATOMIC_STORE(slot, NULL, LE_ATOMIC_ORDER_RELEASE);
     }
 }
 
@@ -402,6 +402,12 @@ void le_sem_Wait
     int result;
 
 #if LE_CONFIG_LINUX_TARGET_TOOLS
+    // If the semaphore can be taken straight away, don't bother with the waiting list.
+    if (sem_trywait(&semaphorePtr->semaphore) == 0)
+    {
+        return;
+    }
+
     sem_ThreadRec_t* perThreadRecPtr = thread_TryGetSemaphoreRecPtr();
 
     if (perThreadRecPtr)
@@ -485,6 +491,14 @@ le_result_t le_sem_WaitWithTimeOut
     struct timespec timeOut;
     int result;
 
+#if LE_CONFIG_LINUX_TARGET_TOOLS
+    // If the semaphore can be taken straight away, don't bother with the waiting list.
+    if (sem_trywait(&semaphorePtr->semaphore) == 0)
+    {
+        return LE_OK;
+    }
+#endif
+
     // Prepare the timer
     le_clk_Time_t currentUtcTime = le_clk_GetAbsoluteTime();
     le_clk_Time_t wakeUpTime = le_clk_Add(currentUtcTime,timeToWait);
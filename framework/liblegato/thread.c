@@ -120,6 +120,62 @@ static size_t* ThreadObjListChangeCountRef = &ThreadObjListChangeCount;
 static pthread_key_t ThreadLocalDataKey;
 
 
+#if LE_CONFIG_LINUX
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy of the calling thread's entry under ThreadLocalDataKey, in compiler-managed thread-local
+ * storage.  The Thread Object is looked up on every event and IPC dispatch, and reading this is
+ * much cheaper than a call to pthread_getspecific().
+ */
+//--------------------------------------------------------------------------------------------------
+static __thread thread_Obj_t* CurrentThreadPtr;
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the calling thread's Thread Object from thread-local storage.
+ *
+ * @return  Pointer to the thread's object, or NULL if the thread is not a Legato thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline thread_Obj_t* GetThreadLocalPtr
+(
+    void
+)
+{
+#if LE_CONFIG_LINUX
+    return CurrentThreadPtr;
+#else
+    return pthread_getspecific(ThreadLocalDataKey);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the calling thread's Thread Object in thread-local storage.
+ *
+ * @return  0 on success, or an error number from pthread_setspecific().
+ */
+//--------------------------------------------------------------------------------------------------
+static inline int SetThreadLocalPtr
+(
+    thread_Obj_t* threadPtr     ///< [in] The thread's object, or NULL.
+)
+{
+    int result = pthread_setspecific(ThreadLocalDataKey, threadPtr);
+
+#if LE_CONFIG_LINUX
+    if (result == 0)
+    {
+        CurrentThreadPtr = threadPtr;
+    }
+#endif
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Static pool for thread objects.
@@ -135,6 +191,16 @@ LE_MEM_DEFINE_STATIC_POOL(ThreadPool, LE_CONFIG_MAX_THREAD_POOL_SIZE, sizeof(thr
 static le_mem_PoolRef_t ThreadPool;
 
 
+#if LE_CONFIG_SINGLE_THREADED_EXES
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set once the process has declared itself single-threaded (see le_thread_SetSingleThreaded()).
+ */
+//--------------------------------------------------------------------------------------------------
+bool thread_SingleThreaded = false;
+#endif
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The destructor object that can be added to a destructor list.  Used to hold user destructors.
@@ -351,7 +417,7 @@ static void CleanupThread
     }
 
     // Clear the Legato thread info to prevent double-free errors and further Legato thread calls.
-    LE_ASSERT(pthread_setspecific(ThreadLocalDataKey, NULL) == 0);
+    LE_ASSERT(SetThreadLocalPtr(NULL) == 0);
 }
 
 
@@ -401,7 +467,7 @@ static void* PThreadStartRoutine
     // Store the Thread Object pointer in thread-local storage so GetCurrentThreadPtr() can
     // find it later.
     // NOTE: pthread_setspecific() is not a cancellation point.
-    if (pthread_setspecific(ThreadLocalDataKey, threadPtr) != 0)
+    if (SetThreadLocalPtr(threadPtr) != 0)
     {
         LE_FATAL("pthread_setspecific() failed!");
     }
@@ -527,7 +593,7 @@ static thread_Obj_t* CreateThread
     // Get current thread as we may inherit some properties (if available).  Do not use
     // GetCurrentThreadPtr() as it's OK if this thread is being created from a non-Legato thread;
     // in that case we just use default values.
-    thread_Obj_t* currentThreadPtr = pthread_getspecific(ThreadLocalDataKey);
+    thread_Obj_t* currentThreadPtr = GetThreadLocalPtr();
 
     // Initialize the pthreads attribute structure.
     LE_ASSERT(pthread_attr_init(&(threadPtr->attr)) == 0);
@@ -618,7 +684,7 @@ static thread_Obj_t* GetCurrentThreadPtr
     void
 )
 {
-    thread_Obj_t* threadPtr = pthread_getspecific(ThreadLocalDataKey);
+    thread_Obj_t* threadPtr = GetThreadLocalPtr();
 
     LE_FATAL_IF(threadPtr == NULL, "Legato threading API used in non-Legato thread!");
 
@@ -637,7 +703,7 @@ static thread_Obj_t* TryGetCurrentThreadPtr
     void
 )
 {
-    thread_Obj_t* threadPtr = pthread_getspecific(ThreadLocalDataKey);
+    thread_Obj_t* threadPtr = GetThreadLocalPtr();
 
     if (threadPtr == NULL)
     {
@@ -820,7 +886,7 @@ void thread_Init
 
     // Store the Thread Object pointer in thread-local storage so GetCurrentThreadPtr() can
     // find it later.
-    LE_ASSERT(pthread_setspecific(ThreadLocalDataKey, threadPtr) == 0);
+    LE_ASSERT(SetThreadLocalPtr(threadPtr) == 0);
 }
 
 
@@ -936,9 +1002,10 @@ event_PerThreadRec_t* thread_GetOtherEventRecPtr
     le_thread_Ref_t threadRef
 )
 {
-    thread_Obj_t* threadPtr;
+    thread_Obj_t* threadPtr = GetThreadLocalPtr();
 
-    if (!threadRef)
+    // Queuing to the calling thread is the common case, and needs no lookup.
+    if ((!threadRef) || ((threadPtr != NULL) && (threadPtr->safeRef == threadRef)))
     {
         return thread_GetEventRecPtr();
     }
@@ -1116,6 +1183,9 @@ le_thread_Ref_t _le_thread_Create
 )
 #endif
 {
+    LE_FATAL_IF(thread_IsSingleThreaded(),
+                "Attempt to create a thread in a single-threaded process.");
+
     // Create a new thread object.
 #if LE_CONFIG_THREAD_NAMES_ENABLED
     thread_Obj_t* threadPtr = CreateThread(name, mainFunc, context);
@@ -1568,7 +1638,7 @@ const char* le_thread_GetMyName
     void
 )
 {
-    thread_Obj_t* threadPtr = pthread_getspecific(ThreadLocalDataKey);
+    thread_Obj_t* threadPtr = GetThreadLocalPtr();
 
     if (NULL == threadPtr)
     {
@@ -1705,9 +1775,12 @@ void _le_thread_InitLegatoThreadData
     LE_FATAL_IF(ThreadPool == NULL,
                 "Legato C Runtime Library (liblegato) has not been initialized!");
 
-    LE_FATAL_IF(pthread_getspecific(ThreadLocalDataKey) != NULL,
+    LE_FATAL_IF(GetThreadLocalPtr() != NULL,
                 "Legato thread-specific data initialized more than once!");
 
+    LE_FATAL_IF(thread_IsSingleThreaded(),
+                "Attempt to use Legato APIs from another thread in a single-threaded process.");
+
     // Create a Thread object for the calling thread.
 #if LE_CONFIG_THREAD_NAMES_ENABLED
     thread_Obj_t* threadPtr = CreateThread(name, NULL, NULL);
@@ -1720,7 +1793,7 @@ void _le_thread_InitLegatoThreadData
 
     // Store the Thread Object pointer in thread-specific storage so GetCurrentThreadPtr() can
     // find it later.
-    if (pthread_setspecific(ThreadLocalDataKey, threadPtr) != 0)
+    if (SetThreadLocalPtr(threadPtr) != 0)
     {
         LE_FATAL("pthread_setspecific() failed!");
     }
@@ -1758,6 +1831,35 @@ void le_thread_CleanupLegatoThreadData
     }
 }
 
+#if LE_CONFIG_SINGLE_THREADED_EXES
+//--------------------------------------------------------------------------------------------------
+/**
+ * Declare the calling process single-threaded: from now on, the Legato framework does not protect
+ * its internal data against other threads, and creating a thread is a fatal error.
+ *
+ * Called by the generated main() of executables built with LE_SINGLE_THREADED defined.  Must be
+ * called from the main thread, before any other thread has been created.
+ **/
+//--------------------------------------------------------------------------------------------------
+void le_thread_SetSingleThreaded
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Lock();
+    size_t threadCount = le_dls_NumLinks(&ThreadObjList);
+    Unlock();
+
+    LE_FATAL_IF(threadCount != 1,
+                "Process declared single-threaded while running %zu threads.",
+                threadCount);
+
+    // No lock is held at this point, so the modules that stop locking can't be left holding one.
+    thread_SingleThreaded = true;
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the calling thread's component instance data record.
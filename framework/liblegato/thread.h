@@ -70,6 +70,37 @@ typedef struct thread_Obj
 thread_Obj_t;
 
 
+#if LE_CONFIG_SINGLE_THREADED_EXES
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set by le_thread_SetSingleThreaded() in processes that never create threads.
+ */
+//--------------------------------------------------------------------------------------------------
+extern bool thread_SingleThreaded;
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if the process has declared itself single-threaded, in which case liblegato's internal
+ * mutexes need not be taken.
+ *
+ * @return true if no other thread will ever run in this process.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline bool thread_IsSingleThreaded
+(
+    void
+)
+{
+#if LE_CONFIG_SINGLE_THREADED_EXES
+    return thread_SingleThreaded;
+#else
+    return false;
+#endif
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Exposing the thread obj list; mainly for the Inspect tool.
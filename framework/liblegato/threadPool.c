@@ -0,0 +1,537 @@
+/** @file threadPool.c
+ *
+ * Implementation of the @ref c_threadPool.
+ *
+ * Each worker has a list of jobs protected by its own mutex.  The worker pushes and pops jobs at
+ * the tail of its list, newest first, while other workers steal from the head, oldest first, so
+ * that the owner and the thieves rarely contend for the same end.
+ *
+ * The pool has one semaphore, posted once per submitted job, and once per worker when the pool
+ * is deleted.  A worker takes one job per wake-up, from its own list or else from another
+ * worker's.  It can happen that it finds nothing because the job it was woken for was taken by
+ * a worker that was woken for a job submitted later, which it then rescans for.  If it finds
+ * nothing while no job is queued, the wake-up was one of the deletion posts, and it exits.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "limit.h"
+#include "threadPool.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of jobs the job pool starts with.
+ */
+//--------------------------------------------------------------------------------------------------
+#define JOB_POOL_SIZE       16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a pool name, including the null terminator.
+ */
+//--------------------------------------------------------------------------------------------------
+#define POOL_NAME_BYTES     24
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A submitted job.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t                   link;           ///< Link in a worker's list of jobs.
+    le_threadPool_JobFunc_t         jobFunc;        ///< Function to run.
+    le_threadPool_CompletionFunc_t  completionFunc; ///< Function to call when done, or NULL.
+    void                           *contextPtr;     ///< Pointer to pass to both.
+    void                           *resultPtr;      ///< Value returned by the job function.
+    le_thread_Ref_t                 callerThread;   ///< Thread to call the completion function in,
+                                                    ///< or NULL to call it in the worker.
+}
+Job_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A worker of a pool.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_threadPool_Ref_t poolRef;        ///< Pool the worker belongs to.
+    le_thread_Ref_t     threadRef;      ///< Worker thread, or NULL until the pool is started.
+    le_mutex_Ref_t      mutexRef;       ///< Protects the list of jobs.
+    le_dls_List_t       jobList;        ///< Jobs, oldest first.
+    uint32_t            cpuMask;        ///< CPUs to run on, or 0 for any.
+}
+Worker_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+struct le_threadPool
+{
+    char            name[POOL_NAME_BYTES];  ///< Name of the pool.
+    size_t          workerCount;            ///< Number of workers.
+    Worker_t       *workersPtr;             ///< Array of workers.
+    le_sem_Ref_t    jobSem;                 ///< Posted once per job, and once per worker to stop.
+    size_t          queuedCount;            ///< Jobs in the workers' lists (atomic).
+    size_t          nextWorker;             ///< Worker to give the next outside job to (atomic).
+    bool            isStarted;              ///< true once the workers have been started.
+};
+
+
+// Static pool the jobs are allocated from.
+LE_MEM_DEFINE_STATIC_POOL(ThreadPoolJob, JOB_POOL_SIZE, sizeof(Job_t));
+
+// Pool the jobs are allocated from.
+static le_mem_PoolRef_t JobPool;
+
+/// Thread-local data key holding the worker a thread is, if any.
+static pthread_key_t WorkerKey;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the number of online CPUs.
+ *
+ * @return The number of CPUs, at least 1.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t GetCpuCount
+(
+    void
+)
+{
+#if LE_CONFIG_LINUX
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (count > 0)
+    {
+        return (size_t)count;
+    }
+#endif
+    return 1;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pin the calling thread to a set of CPUs.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ApplyCpuMask
+(
+    uint32_t cpuMask    ///< [IN] CPUs to run on (bit n = CPU n).
+)
+{
+#if LE_CONFIG_LINUX
+    cpu_set_t cpuSet;
+    unsigned int cpu;
+
+    CPU_ZERO(&cpuSet);
+    for (cpu = 0; cpu < 32; cpu++)
+    {
+        if (cpuMask & (1u << cpu))
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        LE_WARN("Could not set CPU affinity to 0x%08" PRIx32 " (error %d).", cpuMask, errno);
+    }
+#else
+    LE_UNUSED(cpuMask);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take a job off the tail of a worker's list (its newest job).
+ *
+ * @return The job, or NULL if the list is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+static Job_t *PopNewestJob
+(
+    Worker_t *workerPtr     ///< [IN] The worker.
+)
+{
+    le_dls_Link_t *linkPtr;
+
+    le_mutex_Lock(workerPtr->mutexRef);
+    linkPtr = le_dls_PopTail(&workerPtr->jobList);
+    le_mutex_Unlock(workerPtr->mutexRef);
+
+    return (linkPtr == NULL ? NULL : CONTAINER_OF(linkPtr, Job_t, link));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take a job off the head of a worker's list (its oldest job).
+ *
+ * @return The job, or NULL if the list is empty.
+ */
+//--------------------------------------------------------------------------------------------------
+static Job_t *PopOldestJob
+(
+    Worker_t *workerPtr     ///< [IN] The worker.
+)
+{
+    le_dls_Link_t *linkPtr;
+
+    le_mutex_Lock(workerPtr->mutexRef);
+    linkPtr = le_dls_Pop(&workerPtr->jobList);
+    le_mutex_Unlock(workerPtr->mutexRef);
+
+    return (linkPtr == NULL ? NULL : CONTAINER_OF(linkPtr, Job_t, link));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take a job for a worker: its own newest job, or else the oldest job of another worker,
+ * starting with the next one.
+ *
+ * @return The job, or NULL if no worker has any.
+ */
+//--------------------------------------------------------------------------------------------------
+static Job_t *TakeJob
+(
+    Worker_t *workerPtr     ///< [IN] The worker.
+)
+{
+    le_threadPool_Ref_t poolRef = workerPtr->poolRef;
+    size_t index = (size_t)(workerPtr - poolRef->workersPtr);
+    size_t i;
+    Job_t *jobPtr = PopNewestJob(workerPtr);
+
+    for (i = 1; (jobPtr == NULL) && (i < poolRef->workerCount); i++)
+    {
+        jobPtr = PopOldestJob(&poolRef->workersPtr[(index + i) % poolRef->workerCount]);
+    }
+
+    if (jobPtr != NULL)
+    {
+        LE_ATOMIC_SUB_FETCH(&poolRef->queuedCount, 1, LE_ATOMIC_ORDER_RELAXED);
+    }
+    return jobPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Call a job's completion function and free the job.  Runs in the thread that submitted it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompleteJob
+(
+    void *param1Ptr,    ///< [IN] The job.
+    void *param2Ptr     ///< [IN] Unused.
+)
+{
+    Job_t *jobPtr = param1Ptr;
+
+    LE_UNUSED(param2Ptr);
+
+    jobPtr->completionFunc(jobPtr->resultPtr, jobPtr->contextPtr);
+    le_mem_Release(jobPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run a job, then hand it over for completion.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunJob
+(
+    Job_t *jobPtr   ///< [IN] The job.
+)
+{
+    jobPtr->resultPtr = jobPtr->jobFunc(jobPtr->contextPtr);
+
+    if (jobPtr->completionFunc == NULL)
+    {
+        le_mem_Release(jobPtr);
+    }
+    else if (jobPtr->callerThread == NULL)
+    {
+        CompleteJob(jobPtr, NULL);
+    }
+    else
+    {
+        le_event_QueueFunctionToThread(jobPtr->callerThread, CompleteJob, jobPtr, NULL);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the worker threads.
+ *
+ * @return NULL.
+ */
+//--------------------------------------------------------------------------------------------------
+static void *WorkerMain
+(
+    void *contextPtr    ///< [IN] The worker.
+)
+{
+    Worker_t *workerPtr = contextPtr;
+    le_threadPool_Ref_t poolRef = workerPtr->poolRef;
+
+    pthread_setspecific(WorkerKey, workerPtr);
+    if (workerPtr->cpuMask != 0)
+    {
+        ApplyCpuMask(workerPtr->cpuMask);
+    }
+
+    for (;;)
+    {
+        Job_t *jobPtr;
+
+        le_sem_Wait(poolRef->jobSem);
+
+        while ((jobPtr = TakeJob(workerPtr)) == NULL)
+        {
+            if (LE_ATOMIC_LOAD(&poolRef->queuedCount, LE_ATOMIC_ORDER_ACQUIRE) == 0)
+            {
+                // Woken to stop.
+                return NULL;
+            }
+            sched_yield();
+        }
+
+        RunJob(jobPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a thread pool.  Its workers don't run until le_threadPool_Start() is called.
+ *
+ * @return A reference to the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+le_threadPool_Ref_t le_threadPool_Create
+(
+    const char* nameStr,    ///< [IN] Name of the pool (its workers are named after it).
+    size_t      workerCount ///< [IN] Number of workers, or 0 for one per online CPU.
+)
+{
+    le_threadPool_Ref_t poolRef;
+    size_t i;
+
+    LE_ASSERT(nameStr);
+
+    if (workerCount == 0)
+    {
+        workerCount = GetCpuCount();
+    }
+
+    poolRef = calloc(1, sizeof(struct le_threadPool));
+    LE_ASSERT(poolRef);
+    poolRef->workersPtr = calloc(workerCount, sizeof(Worker_t));
+    LE_ASSERT(poolRef->workersPtr);
+
+    if (le_utf8_Copy(poolRef->name, nameStr, sizeof(poolRef->name), NULL) == LE_OVERFLOW)
+    {
+        LE_WARN("Thread pool name '%s' truncated to '%s'.", nameStr, poolRef->name);
+    }
+    poolRef->workerCount = workerCount;
+    poolRef->jobSem = le_sem_Create(poolRef->name, 0);
+
+    for (i = 0; i < workerCount; i++)
+    {
+        Worker_t *workerPtr = &poolRef->workersPtr[i];
+
+        workerPtr->poolRef = poolRef;
+        workerPtr->mutexRef = le_mutex_CreateNonRecursive(poolRef->name);
+        workerPtr->jobList = LE_DLS_LIST_INIT;
+    }
+
+    return poolRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pin a worker of a pool to a set of CPUs.  Must be called before le_threadPool_Start().
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_OUT_OF_RANGE if there is no such worker, or the mask is empty.
+ *      - LE_NOT_PERMITTED if the pool has already been started.
+ *      - LE_UNSUPPORTED if CPU affinity is not supported on this platform.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_threadPool_SetCpuAffinity
+(
+    le_threadPool_Ref_t poolRef,        ///< [IN] The pool.
+    size_t              workerIndex,    ///< [IN] Index of the worker, from 0.
+    uint32_t            cpuMask         ///< [IN] CPUs the worker may run on (bit n = CPU n).
+)
+{
+    LE_ASSERT(poolRef);
+
+#if LE_CONFIG_LINUX
+    if ((workerIndex >= poolRef->workerCount) || (cpuMask == 0))
+    {
+        return LE_OUT_OF_RANGE;
+    }
+    if (poolRef->isStarted)
+    {
+        return LE_NOT_PERMITTED;
+    }
+
+    poolRef->workersPtr[workerIndex].cpuMask = cpuMask;
+    return LE_OK;
+#else
+    LE_UNUSED(workerIndex);
+    LE_UNUSED(cpuMask);
+    return LE_UNSUPPORTED;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the workers of a thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Start
+(
+    le_threadPool_Ref_t poolRef     ///< [IN] The pool.
+)
+{
+    char threadName[LIMIT_MAX_THREAD_NAME_BYTES];
+    size_t i;
+
+    LE_ASSERT(poolRef);
+    LE_FATAL_IF(poolRef->isStarted, "Thread pool '%s' already started.", poolRef->name);
+
+    poolRef->isStarted = true;
+    for (i = 0; i < poolRef->workerCount; i++)
+    {
+        Worker_t *workerPtr = &poolRef->workersPtr[i];
+
+        snprintf(threadName, sizeof(threadName), "%s-%" PRIuS, poolRef->name, i);
+        workerPtr->threadRef = le_thread_Create(threadName, WorkerMain, workerPtr);
+        le_thread_SetJoinable(workerPtr->threadRef);
+        le_thread_Start(workerPtr->threadRef);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Submit a job to a thread pool.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Submit
+(
+    le_threadPool_Ref_t             poolRef,        ///< [IN] The pool.
+    le_threadPool_JobFunc_t         jobFunc,        ///< [IN] Function to run.
+    void*                           contextPtr,     ///< [IN] Pointer to pass to it.
+    le_threadPool_CompletionFunc_t  completionFunc  ///< [IN] Function to call in this thread
+                                                    ///<      when the job is done, or NULL.
+)
+{
+    Worker_t *workerPtr = pthread_getspecific(WorkerKey);
+    Job_t *jobPtr;
+
+    LE_ASSERT(poolRef);
+    LE_ASSERT(jobFunc);
+
+    jobPtr = le_mem_ForceAlloc(JobPool);
+    jobPtr->link = LE_DLS_LINK_INIT;
+    jobPtr->jobFunc = jobFunc;
+    jobPtr->completionFunc = completionFunc;
+    jobPtr->contextPtr = contextPtr;
+    jobPtr->resultPtr = NULL;
+    jobPtr->callerThread = NULL;
+
+    if ((workerPtr == NULL) || (workerPtr->poolRef != poolRef))
+    {
+        // Submitted from outside the pool: the completion goes back to this thread's event loop,
+        // and the job to the workers in turn.
+        size_t index = LE_ATOMIC_ADD_FETCH(&poolRef->nextWorker, 1, LE_ATOMIC_ORDER_RELAXED);
+
+        if (completionFunc != NULL)
+        {
+            jobPtr->callerThread = le_thread_GetCurrent();
+        }
+        workerPtr = &poolRef->workersPtr[index % poolRef->workerCount];
+    }
+
+    le_mutex_Lock(workerPtr->mutexRef);
+    le_dls_Queue(&workerPtr->jobList, &jobPtr->link);
+    le_mutex_Unlock(workerPtr->mutexRef);
+
+    LE_ATOMIC_ADD_FETCH(&poolRef->queuedCount, 1, LE_ATOMIC_ORDER_RELEASE);
+    le_sem_Post(poolRef->jobSem);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a thread pool.  Waits for all of the submitted jobs to run, then stops the workers.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_threadPool_Delete
+(
+    le_threadPool_Ref_t poolRef     ///< [IN] The pool.
+)
+{
+    Worker_t *currentPtr = pthread_getspecific(WorkerKey);
+    size_t i;
+
+    LE_ASSERT(poolRef);
+    LE_FATAL_IF((currentPtr != NULL) && (currentPtr->poolRef == poolRef),
+                "Thread pool '%s' deleted by its own worker.", poolRef->name);
+
+    if (!poolRef->isStarted)
+    {
+        le_threadPool_Start(poolRef);
+    }
+
+    for (i = 0; i < poolRef->workerCount; i++)
+    {
+        le_sem_Post(poolRef->jobSem);
+    }
+
+    for (i = 0; i < poolRef->workerCount; i++)
+    {
+        le_thread_Join(poolRef->workersPtr[i].threadRef, NULL);
+        le_mutex_Delete(poolRef->workersPtr[i].mutexRef);
+    }
+
+    le_sem_Delete(poolRef->jobSem);
+    free(poolRef->workersPtr);
+    free(poolRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the thread pool module.
+ */
+//--------------------------------------------------------------------------------------------------
+void threadPool_Init
+(
+    void
+)
+{
+    JobPool = le_mem_InitStaticPool(ThreadPoolJob, JOB_POOL_SIZE, sizeof(Job_t));
+    LE_ASSERT(pthread_key_create(&WorkerKey, NULL) == 0);
+}
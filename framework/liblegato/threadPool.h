@@ -0,0 +1,27 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file threadPool.h
+ *
+ * Interfaces exported by the thread pool module to other modules inside the Legato framework
+ * implementation.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef THREAD_POOL_H_INCLUDE_GUARD
+#define THREAD_POOL_H_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the thread pool module.
+ *
+ * Must be called exactly once at start-up before any other thread pool functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void threadPool_Init
+(
+    void
+);
+
+#endif // THREAD_POOL_H_INCLUDE_GUARD
@@ -8,6 +8,7 @@
 
 #include "legato.h"
 #include "clock.h"
+#include "fa/traceMarker.h"
 #include "thread.h"
 #include "timer.h"
 
@@ -33,6 +34,15 @@ static size_t TimerListChangeCount = 0;
 static size_t* TimerListChangeCountRef = &TimerListChangeCount;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of slots allocated for a thread's timer heap when the first timer is started.  The heap
+ * doubles in size whenever it fills up.
+ */
+//--------------------------------------------------------------------------------------------------
+#define INITIAL_TIMER_HEAP_SIZE     8
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The default timer memory pool.  Initialized in timer_Init().
@@ -117,9 +127,11 @@ static Timer_t* CreateTimer
     timerPtr->interval = (le_clk_Time_t){0, 0};
     timerPtr->repeatCount = 1;
     timerPtr->contextPtr = NULL;
+    timerPtr->priority = LE_EVENT_PRIORITY_NORMAL;
     timerPtr->link = LE_DLS_LINK_INIT;
     timerPtr->isActive = false;
     timerPtr->expiryTime = (le_clk_Time_t){0, 0};
+    timerPtr->slack = (le_clk_Time_t){0, 0};
     timerPtr->expiryCount = 0;
     Lock();
     timerPtr->safeRef = le_ref_CreateRef(SafeRefMap, timerPtr);
@@ -132,53 +144,162 @@ static Timer_t* CreateTimer
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Add the timer record to the given list, sorted according to the timer value
+ * Check whether one timer is due before another.  Timers with the same expiry time are ordered by
+ * when they were started, so that they expire in the order they were started.
+ *
+ * @return true if timer A expires before timer B.
  */
 //--------------------------------------------------------------------------------------------------
-static void AddToTimerList
+static inline bool IsEarlier
 (
-    le_dls_List_t* listPtr,               ///< [IN] The list to add to.
-    Timer_t* newTimerPtr                  ///< [IN] The timer to add
+    const Timer_t* aPtr,                ///< [IN] Timer A.
+    const Timer_t* bPtr                 ///< [IN] Timer B.
 )
 {
-    Timer_t* timerPtr;
-    le_dls_Link_t* linkPtr;
+    if (le_clk_Equal(aPtr->expiryTime, bPtr->expiryTime))
+    {
+        // Compare start sequence numbers in a way that tolerates wrap-around.
+        return ((int32_t)(aPtr->startSequence - bPtr->startSequence) < 0);
+    }
 
-    if ( newTimerPtr->isActive )
+    return le_clk_GreaterThan(bPtr->expiryTime, aPtr->expiryTime);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Put a timer into a given slot of a thread's timer heap.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void SetHeapSlot
+(
+    timer_ThreadRec_t* threadRecPtr,    ///< [IN] Thread timer object.
+    size_t index,                       ///< [IN] Heap slot.
+    Timer_t* timerPtr                   ///< [IN] Timer to put in the slot.
+)
+{
+    threadRecPtr->timerHeap[index] = timerPtr;
+    timerPtr->heapIndex = index;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move the timer in a given heap slot towards the root of the heap until its parent is due before
+ * it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SiftUp
+(
+    timer_ThreadRec_t* threadRecPtr,    ///< [IN] Thread timer object.
+    size_t index                        ///< [IN] Heap slot of the timer to move.
+)
+{
+    Timer_t* timerPtr = threadRecPtr->timerHeap[index];
+
+    while (index > 0)
     {
-        LE_ERROR("Timer '%s' is already active", TIMER_NAME(newTimerPtr->name));
-        return;
+        size_t parentIndex = (index - 1) / 2;
+        Timer_t* parentPtr = threadRecPtr->timerHeap[parentIndex];
+
+        if (!IsEarlier(timerPtr, parentPtr))
+        {
+            break;
+        }
+
+        SetHeapSlot(threadRecPtr, index, parentPtr);
+        index = parentIndex;
     }
 
-    // Get the start of the list
-    linkPtr = le_dls_Peek(listPtr);
+    SetHeapSlot(threadRecPtr, index, timerPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move the timer in a given heap slot away from the root of the heap until both of its children
+ * are due after it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SiftDown
+(
+    timer_ThreadRec_t* threadRecPtr,    ///< [IN] Thread timer object.
+    size_t index                        ///< [IN] Heap slot of the timer to move.
+)
+{
+    Timer_t* timerPtr = threadRecPtr->timerHeap[index];
+    size_t heapSize = threadRecPtr->heapSize;
 
-    // Find the timer whose expiry time is greater than the new timer.
-    while ( linkPtr != NULL )
+    for (;;)
     {
-        timerPtr = CONTAINER_OF(linkPtr, Timer_t, link);
+        size_t childIndex = (2 * index) + 1;
+
+        if (childIndex >= heapSize)
+        {
+            break;
+        }
+
+        // Pick the earlier of the two children.
+        if ( ((childIndex + 1) < heapSize) &&
+             IsEarlier(threadRecPtr->timerHeap[childIndex + 1],
+                       threadRecPtr->timerHeap[childIndex]) )
+        {
+            childIndex++;
+        }
 
-        if ( le_clk_GreaterThan(timerPtr->expiryTime, newTimerPtr->expiryTime) )
+        if (!IsEarlier(threadRecPtr->timerHeap[childIndex], timerPtr))
         {
             break;
         }
 
-        linkPtr = le_dls_PeekNext(listPtr, linkPtr);
+        SetHeapSlot(threadRecPtr, index, threadRecPtr->timerHeap[childIndex]);
+        index = childIndex;
     }
 
-    TimerListChangeCount++;
-    if (linkPtr == NULL)
+    SetHeapSlot(threadRecPtr, index, timerPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the timer record to the given thread's active timers, ordered according to the timer value.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AddToTimerList
+(
+    timer_ThreadRec_t* threadRecPtr,    ///< [IN] The thread timer object to add to.
+    Timer_t* newTimerPtr                ///< [IN] The timer to add
+)
+{
+    if ( newTimerPtr->isActive )
     {
-        // The list is either empty, or the new timer has the largest expiry time.
-        // In either case, add the new timer to the end of the list.
-        le_dls_Queue(listPtr, &newTimerPtr->link);
+        LE_ERROR("Timer '%s' is already active", TIMER_NAME(newTimerPtr->name));
+        return;
     }
-    else
+
+    // Grow the heap if it is full.
+    if (threadRecPtr->heapSize == threadRecPtr->heapCapacity)
     {
-        // Found a timer with larger expiry time; insert the new timer before it.
-        le_dls_AddBefore(listPtr, linkPtr, &newTimerPtr->link);
+        size_t newCapacity = (threadRecPtr->heapCapacity == 0 ?
+                                INITIAL_TIMER_HEAP_SIZE : threadRecPtr->heapCapacity * 2);
+        Timer_t** newHeapPtr = realloc(threadRecPtr->timerHeap, newCapacity * sizeof(Timer_t*));
+
+        LE_ASSERT(newHeapPtr != NULL);
+        threadRecPtr->timerHeap = newHeapPtr;
+        threadRecPtr->heapCapacity = newCapacity;
     }
 
+    TimerListChangeCount++;
+    newTimerPtr->startSequence = threadRecPtr->nextStartSequence++;
+
+    SetHeapSlot(threadRecPtr, threadRecPtr->heapSize, newTimerPtr);
+    threadRecPtr->heapSize++;
+    SiftUp(threadRecPtr, newTimerPtr->heapIndex);
+
+    // The list of active timers is kept for diagnostics (e.g., the Inspect tool) only, so order
+    // does not matter.
+    le_dls_Queue(&threadRecPtr->activeTimerList, &newTimerPtr->link);
+
     // The new timer is now on the active list
     newTimerPtr->isActive = true;
 }
@@ -186,24 +307,21 @@ static void AddToTimerList
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Peek at the first timer from the given timer list
+ * Peek at the first timer from the given thread's active timers
  *
  * @return:
- *      - pointer to the first timer on the list
- *      - NULL if the list is empty
+ *      - pointer to the first timer due to expire
+ *      - NULL if there are no active timers
  */
 //--------------------------------------------------------------------------------------------------
 static Timer_t* PeekFromTimerList
 (
-    le_dls_List_t* listPtr              ///< [IN] The list to look at.
+    timer_ThreadRec_t* threadRecPtr     ///< [IN] The thread timer object to look at.
 )
 {
-    le_dls_Link_t* linkPtr;
-
-    linkPtr = le_dls_Peek(listPtr);
-    if (linkPtr != NULL)
+    if (threadRecPtr->heapSize > 0)
     {
-        return ( CONTAINER_OF(linkPtr, Timer_t, link) );
+        return threadRecPtr->timerHeap[0];
     }
     return NULL;
 }
@@ -211,83 +329,168 @@ static Timer_t* PeekFromTimerList
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Pop the first timer from the given timer list
+ * Remove the timer from the given thread's active timers
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemoveFromTimerList
+(
+    timer_ThreadRec_t* threadRecPtr,    ///< [IN] The thread timer object to look at.
+    Timer_t* timerPtr                   ///< [IN] The timer to remove
+)
+{
+    size_t index = timerPtr->heapIndex;
+
+    LE_ASSERT((index < threadRecPtr->heapSize) && (threadRecPtr->timerHeap[index] == timerPtr));
+
+    // Remove the timer from the active list
+    timerPtr->isActive = false;
+    TimerListChangeCount++;
+    le_dls_Remove(&threadRecPtr->activeTimerList, &timerPtr->link);
+
+    // Fill the hole with the last timer in the heap, then restore the heap order from there.
+    threadRecPtr->heapSize--;
+    if (index < threadRecPtr->heapSize)
+    {
+        SetHeapSlot(threadRecPtr, index, threadRecPtr->timerHeap[threadRecPtr->heapSize]);
+
+        if ( (index > 0) &&
+             IsEarlier(threadRecPtr->timerHeap[index], threadRecPtr->timerHeap[(index - 1) / 2]) )
+        {
+            SiftUp(threadRecPtr, index);
+        }
+        else
+        {
+            SiftDown(threadRecPtr, index);
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pop the first timer from the given thread's active timers
  *
  * @return:
- *      - pointer to the first timer on the list
- *      - NULL if the list is empty
+ *      - pointer to the first timer due to expire
+ *      - NULL if there are no active timers
  */
 //--------------------------------------------------------------------------------------------------
 static Timer_t* PopFromTimerList
 (
-    le_dls_List_t* listPtr              ///< [IN] The list to look at.
+    timer_ThreadRec_t* threadRecPtr     ///< [IN] The thread timer object to look at.
 )
 {
-    le_dls_Link_t* linkPtr;
-    Timer_t* timerPtr;
+    Timer_t* timerPtr = PeekFromTimerList(threadRecPtr);
 
-    linkPtr = le_dls_Pop(listPtr);
-    if (linkPtr != NULL)
+    if (timerPtr != NULL)
     {
-        TimerListChangeCount++;
-        timerPtr = CONTAINER_OF(linkPtr, Timer_t, link);
+        RemoveFromTimerList(threadRecPtr, timerPtr);
+    }
+    return timerPtr;
+}
 
-        // The timer is no longer on the active list
-        timerPtr->isActive = false;
 
-        return timerPtr;
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the latest time at which a timer may be allowed to expire, i.e., its expiry time plus its
+ * slack.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline le_clk_Time_t GetLatestExpiry
+(
+    const Timer_t* timerPtr         ///< [IN] Timer.
+)
+{
+    if ((timerPtr->slack.sec == 0) && (timerPtr->slack.usec == 0))
+    {
+        return timerPtr->expiryTime;
     }
-    return NULL;
+    return le_clk_Add(timerPtr->expiryTime, timerPtr->slack);
 }
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Remove the timer from the given timer list
+ * Find the earliest latest-expiry time of all the timers in a sub-tree of a thread's timer heap.
+ *
+ * Timers in a sub-tree never expire before the timer at its root, so any sub-tree whose root
+ * expires after the best deadline found so far can be skipped.  This keeps the search short unless
+ * many timers are due within the slack window.
  */
 //--------------------------------------------------------------------------------------------------
-static void RemoveFromTimerList
+static void FindDeadline
 (
-    le_dls_List_t* listPtr,             ///< [IN] The list to look at.
-    Timer_t* timerPtr                   ///< [IN] The timer to remove
+    const timer_ThreadRec_t* threadRecPtr,  ///< [IN] Thread timer object.
+    size_t index,                           ///< [IN] Heap slot at the root of the sub-tree.
+    le_clk_Time_t* deadlinePtr              ///< [IN,OUT] Earliest deadline found so far.
 )
 {
-    // Remove the timer from the active list
-    timerPtr->isActive = false;
-    TimerListChangeCount++;
-    le_dls_Remove(listPtr, &timerPtr->link);
+    if (index >= threadRecPtr->heapSize)
+    {
+        return;
+    }
+
+    const Timer_t* timerPtr = threadRecPtr->timerHeap[index];
+
+    if (!le_clk_GreaterThan(*deadlinePtr, timerPtr->expiryTime))
+    {
+        return;
+    }
+
+    le_clk_Time_t latestExpiry = GetLatestExpiry(timerPtr);
+    if (le_clk_GreaterThan(*deadlinePtr, latestExpiry))
+    {
+        *deadlinePtr = latestExpiry;
+    }
+
+    FindDeadline(threadRecPtr, (2 * index) + 1, deadlinePtr);
+    FindDeadline(threadRecPtr, (2 * index) + 2, deadlinePtr);
 }
 
 
 //--------------------------------------------------------------------------------------------------
 /**
  * Arm and (re)start the timer
+ *
+ * The timer FD is armed for the earliest time by which any active timer must expire, taking each
+ * timer's slack into account.  Any timers that are due by then will all be processed by the same
+ * wakeup.
  */
 //--------------------------------------------------------------------------------------------------
 static void RestartTimerPhys
 (
-    Timer_t* timerPtr      ///< [IN] (Re)start this timer object
+    Timer_t* timerPtr      ///< [IN] (Re)start this timer object.  Must be the first active timer.
 )
 {
     timer_ThreadRec_t* threadRecPtr = fa_timer_GetThreadTimerRec(timerPtr);
 
     struct itimerspec timerInterval;
+    le_clk_Time_t deadline = GetLatestExpiry(timerPtr);
 
-    // Set the timer to expire at the expiry time of the given timer
+    // Only search the rest of the heap if the first timer could be allowed to expire late.
+    if (le_clk_GreaterThan(deadline, timerPtr->expiryTime))
+    {
+        FindDeadline(threadRecPtr, 1, &deadline);
+        FindDeadline(threadRecPtr, 2, &deadline);
+    }
+
+    // Set the timer to expire at the computed deadline.
     // There is a small possibility that the time set now will be slightly in the past
     // at this point but it will just cause the timerfd to expire immediately.
-    timerInterval.it_value.tv_sec = timerPtr->expiryTime.sec;
-    timerInterval.it_value.tv_nsec = timerPtr->expiryTime.usec * 1000;
+    timerInterval.it_value.tv_sec = deadline.sec;
+    timerInterval.it_value.tv_nsec = deadline.usec * 1000;
 
     // The timer does not repeat
     timerInterval.it_interval.tv_sec = 0;
     timerInterval.it_interval.tv_nsec = 0;
 
+    // Store the timer for future reference (the platform may dispatch the expiry with its
+    // priority).
+    threadRecPtr->firstTimerPtr = timerPtr;
+    threadRecPtr->armedTime = deadline;
+
     // Start the actual timer
     fa_timer_RestartTimer(threadRecPtr, &timerInterval);
-
-    // Store the timer for future reference
-    threadRecPtr->firstTimerPtr = timerPtr;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -324,15 +527,18 @@ static void RunTimer
 
     Timer_t* firstTimerPtr;
 
-    AddToTimerList(&threadRecPtr->activeTimerList, timerPtr);
+    AddToTimerList(threadRecPtr, timerPtr);
 
     // Get the first timer from the active list. This is needed to determine whether the timer
     // needs to be restarted, in case the new timer was put at the beginning of the list.
-    firstTimerPtr = PeekFromTimerList(&threadRecPtr->activeTimerList);
+    firstTimerPtr = PeekFromTimerList(threadRecPtr);
 
     // If the timer is not running, or it is running a timer that is no longer at the beginning
-    // of the active list, then (re)start the timer.
-    if ( (NULL != firstTimerPtr) && (threadRecPtr->firstTimerPtr != firstTimerPtr) )
+    // of the active list, or the new timer must expire before the time the timer is running for,
+    // then (re)start the timer.
+    if ( (NULL != firstTimerPtr) &&
+         ( (threadRecPtr->firstTimerPtr != firstTimerPtr) ||
+           le_clk_GreaterThan(threadRecPtr->armedTime, GetLatestExpiry(timerPtr)) ) )
     {
         RestartTimerPhys(firstTimerPtr);
     }
@@ -353,7 +559,7 @@ static void StopTimer
 {
     timer_ThreadRec_t* threadRecPtr = fa_timer_GetThreadTimerRec(timerPtr);
 
-    RemoveFromTimerList(&threadRecPtr->activeTimerList, timerPtr);
+    RemoveFromTimerList(threadRecPtr, timerPtr);
 
     // If the timer was at the start of the active list, then restart the timerFD using the next
     // timer on the active list, if any.  Otherwise, stop the timerFD.
@@ -362,7 +568,7 @@ static void StopTimer
         TRACE("Stopping the first active timer");
         threadRecPtr->firstTimerPtr = NULL;
 
-        Timer_t* firstTimerPtr = PeekFromTimerList(&threadRecPtr->activeTimerList);
+        Timer_t* firstTimerPtr = PeekFromTimerList(threadRecPtr);
         if (firstTimerPtr != NULL)
         {
             RestartTimerPhys(firstTimerPtr);
@@ -389,6 +595,14 @@ static void ProcessExpiredTimer
 
     // Keep track of the number of times the timer has expired, regardless of whether it repeats.
     expiredTimer->expiryCount++;
+#if LE_CONFIG_EVENT_PROFILING
+    thread_GetEventRecPtr()->timerExpiryCount++;
+#endif
+#if LE_CONFIG_TIMER_NAMES_ENABLED
+    TRACE_MARKER('L', "timer|%s", expiredTimer->name);
+#else
+    TRACE_MARKER('L', "timer|%p", expiredTimer->safeRef);
+#endif
 
     // Handle repeating timers by adding it back to the list; do this before calling the expiry
     // handler to reduce jitter.
@@ -406,7 +620,7 @@ static void ProcessExpiredTimer
         expiredTimer->expiryTime = le_clk_Add(expiredTimer->expiryTime, expiredTimer->interval);
 
         // Add the timer back to the timer list
-        AddToTimerList(&threadRecPtr->activeTimerList, expiredTimer);
+        AddToTimerList(threadRecPtr, expiredTimer);
         //PrintTimerList(&threadRecPtr->activeTimerList);
     }
 
@@ -454,7 +668,7 @@ void timer_Handler
     Timer_t* firstTimerPtr;
 
     // Pop off the first timer from the active list, and make sure it is the expected timer.
-    firstTimerPtr = PopFromTimerList(&threadRecPtr->activeTimerList);
+    firstTimerPtr = PopFromTimerList(threadRecPtr);
     LE_ASSERT( NULL != firstTimerPtr);
 
     LE_ASSERT( threadRecPtr->firstTimerPtr == firstTimerPtr );
@@ -469,17 +683,17 @@ void timer_Handler
 
     // Check if there are any other timers that have since expired, pop them off the
     // list and process them.
-    firstTimerPtr = PeekFromTimerList(&threadRecPtr->activeTimerList);
+    firstTimerPtr = PeekFromTimerList(threadRecPtr);
     while ( firstTimerPtr != NULL &&
             le_clk_GreaterThan(clk_GetRelativeTime(firstTimerPtr->isWakeupEnabled),
                                firstTimerPtr->expiryTime) )
     {
         // Pop off the timer and process it
-        firstTimerPtr = PopFromTimerList(&threadRecPtr->activeTimerList);
+        firstTimerPtr = PopFromTimerList(threadRecPtr);
         ProcessExpiredTimer(firstTimerPtr);
 
         // Try the next timer on the list
-        firstTimerPtr = PeekFromTimerList(&threadRecPtr->activeTimerList);
+        firstTimerPtr = PeekFromTimerList(threadRecPtr);
     }
 
     // While processing expired timers in the above loop, it is possible that a timer was started,
@@ -568,6 +782,11 @@ timer_ThreadRec_t *timer_InitThread
 
     threadRecPtr->activeTimerList = LE_DLS_LIST_INIT;
     threadRecPtr->firstTimerPtr = NULL;
+    threadRecPtr->armedTime = (le_clk_Time_t){0, 0};
+    threadRecPtr->timerHeap = NULL;
+    threadRecPtr->heapSize = 0;
+    threadRecPtr->heapCapacity = 0;
+    threadRecPtr->nextStartSequence = 0;
 
     return threadRecPtr;
 }
@@ -620,6 +839,12 @@ void timer_DestructThread
 
             le_mem_Release(timerPtr);
         }
+
+        free(threadRecPtr->timerHeap);
+        threadRecPtr->timerHeap = NULL;
+        threadRecPtr->heapSize = 0;
+        threadRecPtr->heapCapacity = 0;
+
         fa_timer_DestructThread(threadRecPtr);
     }
 }
@@ -922,6 +1147,106 @@ le_result_t le_timer_SetWakeup
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the amount of time by which the timer's expiry may be delayed
+ *
+ * This allows the timer to be batched with the other timers of the same thread, so that they all
+ * expire together, reducing the number of wakeups.  The timer will never expire before its
+ * interval has elapsed, nor later than its interval plus its slack (subject to event loop
+ * latency).  Repeating timers do not drift; their expiries stay aligned to the interval.
+ *
+ * The default slack is zero.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BUSY if the timer is currently running
+ *
+ * @note
+ *      If an invalid timer object is given, the process exits
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_timer_SetSlack
+(
+    le_timer_Ref_t timerRef,     ///< [IN] Set slack for this timer object
+    le_clk_Time_t slack          ///< [IN] Maximum amount of time by which expiry may be delayed
+)
+{
+    Timer_t* timerPtr = GetTimer(timerRef);
+    LE_FATAL_IF(NULL == timerPtr, "Invalid timer reference %p.", timerRef);
+
+    if ( timerPtr->isActive )
+    {
+        return LE_BUSY;
+    }
+
+    timerPtr->slack = slack;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the amount of time by which the timer's expiry may be delayed, using milliseconds
+ *
+ * See le_timer_SetSlack() for details.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BUSY if the timer is currently running
+ *
+ * @note
+ *      If an invalid timer object is given, the process exits
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_timer_SetMsSlack
+(
+    le_timer_Ref_t timerRef,     ///< [IN] Set slack for this timer object
+    uint32_t slack               ///< [IN] Maximum delay of expiry, in milliseconds
+)
+{
+    time_t seconds = slack / 1000;
+    le_clk_Time_t timeStruct;
+    timeStruct.sec = seconds;
+    timeStruct.usec = (slack - (seconds * 1000)) * 1000;
+
+    return le_timer_SetSlack(timerRef, timeStruct);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the priority with which the timer's expiry is dispatched by the event loop.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BUSY if the timer is currently running
+ *
+ * @note
+ *      If an invalid timer object is given, the process exits
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_timer_SetPriority
+(
+    le_timer_Ref_t timerRef,        ///< [IN] Set priority for this timer object
+    le_event_Priority_t priority    ///< [IN] Priority of the expiry handler
+)
+{
+    Timer_t* timerPtr = GetTimer(timerRef);
+    LE_FATAL_IF(NULL == timerPtr, "Invalid timer reference %p.", timerRef);
+
+    if ( timerPtr->isActive )
+    {
+        return LE_BUSY;
+    }
+
+    timerPtr->priority = priority;
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set context pointer for the timer
@@ -16,6 +16,65 @@
 #define IS_THREE_BYTE_CHAR(leadByte)            ( (leadByte & 0xF0) == 0xE0 )
 #define IS_FOUR_BYTE_CHAR(leadByte)             ( (leadByte & 0xF8) == 0xF0 )
 
+// Machine word used to check several bytes at a time.  It may alias the characters of a string.
+typedef unsigned long __attribute__((__may_alias__)) Word_t;
+
+// Checks if any byte of a word is zero, or has its top bit set (i.e. is not a single byte char).
+#define WORD_LOW_BITS               ( ((Word_t)-1) / 0xFF )
+#define WORD_HIGH_BITS              ( WORD_LOW_BITS * 0x80 )
+#define WORD_HAS_ZERO_BYTE(word)    ( ((word) - WORD_LOW_BITS) & ~(word) & WORD_HIGH_BITS )
+#define WORD_HAS_HIGH_BYTE(word)    ( (word) & WORD_HIGH_BITS )
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counts the single byte (ASCII) characters at the start of a string, checking a word at a time
+ * where possible.  Words are only read from aligned addresses, so this never reads past the end
+ * of the page holding the null-terminator, but may read bytes after it within the same word.
+ *
+ * @return
+ *      Number of single byte characters at the start of the string, not including the
+ *      null-terminator, and at most maxBytes.
+ */
+//--------------------------------------------------------------------------------------------------
+__attribute__((no_sanitize_address))
+static size_t NumAsciiBytes
+(
+    const char* string,     ///< [IN] The string.
+    size_t maxBytes         ///< [IN] Maximum number of bytes to check.
+)
+{
+    size_t i = 0;
+
+    // Go a byte at a time until the pointer is aligned.
+    for (; (((uintptr_t)&string[i] % sizeof(Word_t)) != 0) && (i < maxBytes); i++)
+    {
+        if ((string[i] == '\0') || !IS_SINGLE_BYTE_CHAR(string[i]))
+        {
+            return i;
+        }
+    }
+
+    // Then a word at a time, until a word has a null or a multi-byte character in it.
+    for (; (maxBytes - i) >= sizeof(Word_t); i += sizeof(Word_t))
+    {
+        Word_t word = *(const Word_t*)&string[i];
+
+        if (WORD_HAS_ZERO_BYTE(word) || WORD_HAS_HIGH_BYTE(word))
+        {
+            break;
+        }
+    }
+
+    // And finish a byte at a time.
+    while ((i < maxBytes) && (string[i] != '\0') && IS_SINGLE_BYTE_CHAR(string[i]))
+    {
+        i++;
+    }
+
+    return i;
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -45,8 +104,18 @@ ssize_t le_utf8_NumChars
         return 0;
     }
 
-    while (string[strIndex] != '\0')
+    while (1)
     {
+        // Skip single byte characters quickly.
+        size_t numAscii = NumAsciiBytes(&string[strIndex], SIZE_MAX);
+        strIndex += numAscii;
+        numChars += numAscii;
+
+        if (string[strIndex] == '\0')
+        {
+            break;
+        }
+
         numBytes = le_utf8_NumBytesInChar(string[strIndex]);
 
         if (numBytes == 0)
@@ -175,10 +244,15 @@ le_result_t le_utf8_Copy
     LE_ASSERT(srcStr != NULL);
     LE_ASSERT(destSize > 0);
 
-    // Go through the string copying one character at a time.
+    // Go through the string copying one character at a time, except for runs of single byte
+    // characters which are copied together.
     size_t i = 0;
     while (1)
     {
+        size_t numAscii = NumAsciiBytes(&srcStr[i], destSize - 1 - i);
+        memcpy(&destStr[i], &srcStr[i], numAscii);
+        i += numAscii;
+
         if (srcStr[i] == '\0')
         {
             // NULL character found.  Complete the copy and return.
@@ -414,8 +488,16 @@ bool le_utf8_IsFormatCorrect
         return false;
     }
 
-    while (string[strIndex] != '\0')
+    while (1)
     {
+        // Skip single byte characters quickly.
+        strIndex += NumAsciiBytes(&string[strIndex], SIZE_MAX);
+
+        if (string[strIndex] == '\0')
+        {
+            break;
+        }
+
         numBytes = le_utf8_NumBytesInChar(string[strIndex]);
 
         if (numBytes == 0)
@@ -45,6 +45,9 @@ def convert_to_c(obj):
         return obj
     if obj is None:
         return ffi.NULL
+    if isinstance(obj, (bytearray, memoryview)):
+        # Pass the buffer's own memory, without copying it.
+        return ffi.from_buffer(obj)
     if isinstance(obj, basestring):
         return ffi.new("char[]", obj)
     if obj is list or obj is tuple:
@@ -68,6 +71,13 @@ py_to_ptr = ffi.new_handle
 ptr_to_py = ffi.from_handle
 # -end ffi aliases-
 
+def msg_payload_view(msgRef):
+    """
+    Get a view of a message's payload buffer, through which it can be filled in or read without
+    copying it.  The view must not be used once the message has been sent or released.
+    """
+    return ffi.buffer(lib.le_msg_GetPayloadPtr(msgRef), lib.le_msg_GetMaxPayloadSize(msgRef))
+
 
 class Result(IntEnum):
     """
@@ -0,0 +1,239 @@
+/**
+ * This module is for unit testing the le_aio module in the legato
+ * runtime library (liblegato.so).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+// Symbol and Enum definitions
+//--------------------------------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  File used by the test.
+ */
+// -------------------------------------------------------------------------------------------------
+#define TEST_FILE           "/tmp/testAio.bin"
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Number of chunks written at once.
+ */
+// -------------------------------------------------------------------------------------------------
+#define CHUNK_COUNT         4
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Size of each chunk written, in bytes.
+ */
+// -------------------------------------------------------------------------------------------------
+#define CHUNK_SIZE          16384
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Size of the buffer the file is read back with, in bytes.  Not a divisor of the file size, so
+ *  the last read is short.
+ */
+// -------------------------------------------------------------------------------------------------
+#define READ_SIZE           5000
+
+//--------------------------------------------------------------------------------------------------
+// Static variables
+//--------------------------------------------------------------------------------------------------
+
+static le_thread_Ref_t MainThreadRef;
+static int Fd = -1;
+static uint8_t WriteBuffer[CHUNK_COUNT][CHUNK_SIZE];
+static uint8_t ReadBuffer[READ_SIZE];
+static size_t WritesPending;
+static bool WritesOk;
+static off_t ReadOffset;
+static bool ReadMatches;
+
+//--------------------------------------------------------------------------------------------------
+// Test functions
+//--------------------------------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Completion of a read on a write-only file descriptor.  Ends the test.
+ */
+// -------------------------------------------------------------------------------------------------
+static void BadReadDone
+(
+    le_result_t result,
+    size_t byteCount,
+    void* contextPtr
+)
+{
+    int fd = (int)(intptr_t)contextPtr;
+
+    LE_TEST_OK(result == LE_FAULT, "Read from write-only file fails");
+    LE_TEST_OK(byteCount == 0, "Failed read transferred nothing");
+
+    close(fd);
+    unlink(TEST_FILE);
+
+    LE_TEST_EXIT;
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Completion of one read of the file.  Queues the next read until the end of the file.
+ */
+// -------------------------------------------------------------------------------------------------
+static void ReadDone
+(
+    le_result_t result,
+    size_t byteCount,
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    if ((result != LE_OK) || (le_thread_GetCurrent() != MainThreadRef))
+    {
+        ReadMatches = false;
+    }
+
+    if (byteCount > 0)
+    {
+        size_t i;
+        for (i = 0; i < byteCount; i++)
+        {
+            off_t offset = ReadOffset + i;
+
+            if (ReadBuffer[i] != WriteBuffer[offset / CHUNK_SIZE][offset % CHUNK_SIZE])
+            {
+                ReadMatches = false;
+                break;
+            }
+        }
+
+        ReadOffset += byteCount;
+
+        LE_ASSERT_OK(le_aio_Read(Fd, ReadBuffer, sizeof(ReadBuffer), ReadOffset, ReadDone, NULL));
+        return;
+    }
+
+    LE_TEST_OK(ReadMatches, "Reads complete in the main thread and return what was written");
+    LE_TEST_OK(ReadOffset == CHUNK_COUNT * CHUNK_SIZE, "Reads stop at end of file");
+
+    close(Fd);
+
+    int fd = open(TEST_FILE, O_WRONLY | O_CLOEXEC);
+    LE_ASSERT(fd >= 0);
+
+    LE_TEST_OK(le_aio_Read(fd, ReadBuffer, sizeof(ReadBuffer), 0, BadReadDone, (void*)(intptr_t)fd)
+               == LE_OK,
+               "Read from write-only file queued");
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Completion of the sync.  Starts reading the file back.
+ */
+// -------------------------------------------------------------------------------------------------
+static void SyncDone
+(
+    le_result_t result,
+    size_t byteCount,
+    void* contextPtr
+)
+{
+    LE_UNUSED(byteCount);
+
+    LE_TEST_OK(result == LE_OK, "Sync succeeds");
+    LE_TEST_OK(contextPtr == &Fd, "Sync context is passed to handler");
+
+    ReadOffset = 0;
+    ReadMatches = true;
+
+    LE_ASSERT_OK(le_aio_Read(Fd, ReadBuffer, sizeof(ReadBuffer), ReadOffset, ReadDone, NULL));
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Completion of one of the writes.  Syncs the file once they are all done.
+ */
+// -------------------------------------------------------------------------------------------------
+static void WriteDone
+(
+    le_result_t result,
+    size_t byteCount,
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    if ((result != LE_OK) ||
+        (byteCount != CHUNK_SIZE) ||
+        (le_thread_GetCurrent() != MainThreadRef))
+    {
+        WritesOk = false;
+    }
+
+    if (--WritesPending == 0)
+    {
+        LE_TEST_OK(WritesOk, "Concurrent writes complete in the main thread");
+        LE_TEST_OK(le_aio_Sync(Fd, SyncDone, &Fd) == LE_OK, "Sync queued");
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Test main function.
+ */
+// -------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    LE_TEST_INFO("Starting asynchronous file I/O test");
+
+    LE_TEST_PLAN(14);
+
+    MainThreadRef = le_thread_GetCurrent();
+
+    LE_TEST_OK(le_aio_Read(-1, ReadBuffer, sizeof(ReadBuffer), 0, ReadDone, NULL)
+               == LE_BAD_PARAMETER,
+               "Invalid file descriptor rejected");
+    LE_TEST_OK(le_aio_Write(STDOUT_FILENO, WriteBuffer, sizeof(WriteBuffer), 0, NULL, NULL)
+               == LE_BAD_PARAMETER,
+               "Missing handler rejected");
+    LE_TEST_OK(le_aio_Read(STDIN_FILENO, ReadBuffer, sizeof(ReadBuffer), -1, ReadDone, NULL)
+               == LE_BAD_PARAMETER,
+               "Negative offset rejected");
+
+    Fd = open(TEST_FILE, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    LE_ASSERT(Fd >= 0);
+
+    size_t i;
+    for (i = 0; i < CHUNK_COUNT; i++)
+    {
+        size_t j;
+        for (j = 0; j < CHUNK_SIZE; j++)
+        {
+            WriteBuffer[i][j] = (uint8_t)(i * 31 + j * 7);
+        }
+    }
+
+    // Queue all chunks at once, last first, to check that each lands at its own offset.
+    WritesOk = true;
+    WritesPending = CHUNK_COUNT;
+
+    bool queuedOk = true;
+    for (i = CHUNK_COUNT; i > 0; i--)
+    {
+        if (le_aio_Write(Fd, WriteBuffer[i - 1], CHUNK_SIZE, (i - 1) * CHUNK_SIZE, WriteDone, NULL)
+            != LE_OK)
+        {
+            queuedOk = false;
+        }
+    }
+    LE_TEST_OK(queuedOk, "Concurrent writes queued");
+
+    // Nothing has completed yet: handlers only run from the event loop.
+    LE_TEST_OK(WritesPending == CHUNK_COUNT, "Handlers are not called before returning");
+}
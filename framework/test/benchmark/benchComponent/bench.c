@@ -0,0 +1,331 @@
+/**
+ * Micro-benchmarks of the framework's hot paths: memory pools, hash maps, safe references, event
+ * reports, timers, packing, and IPC round trips to a server in the same process and in another
+ * process.
+ *
+ * Each benchmark checks its results as a test, and reports its timing on a TAP comment line of the
+ * form:
+ *
+ *     # BENCH {"name":"mem.allocRelease","iterations":10000,"us":1234,"nsPerOp":123}
+ *
+ * so that results can be extracted from the test output and tracked over time.  The number of
+ * iterations can be changed with "-n <count>".
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+
+#if LE_CONFIG_LINUX
+#   define DEFAULT_ITERATIONS   100000
+#   define COLLECTION_SIZE      1000
+#else
+#   define DEFAULT_ITERATIONS   10000
+#   define COLLECTION_SIZE      200
+#endif
+
+#define PACK_BUFFER_SIZE        64
+#define PACK_STRING             "benchmark"
+
+/*
+ * Number of times each operation is timed.
+ */
+static int Iterations = DEFAULT_ITERATIONS;
+
+/*
+ * Keys and references of the hash map and safe reference benchmarks.
+ */
+static uint32_t Keys[COLLECTION_SIZE];
+static void* Refs[COLLECTION_SIZE];
+
+/*
+ * Event report benchmark.
+ */
+static le_event_Id_t BenchEventId;
+static int EventCount;
+static le_clk_Time_t EventStartTime;
+
+/*
+ * Main thread, which serves the in-process IPC server.
+ */
+static le_thread_Ref_t MainThreadRef;
+
+static void Report
+(
+    const char*     nameStr,
+    int             count,
+    le_clk_Time_t   startTime
+)
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+    uint64_t usec = ((uint64_t)elapsed.sec * 1000000) + elapsed.usec;
+
+    LE_TEST_INFO("BENCH {\"name\":\"%s\",\"iterations\":%d,"
+                 "\"us\":%"PRIu64",\"nsPerOp\":%"PRIu64"}",
+                 nameStr, count, usec, (usec * 1000) / (count ? count : 1));
+}
+
+static void BenchMemPool
+(
+    void
+)
+{
+    le_mem_PoolRef_t poolRef = le_mem_CreatePool("BenchPool", 64);
+    le_mem_ExpandPool(poolRef, 1);
+
+    int i;
+    bool ok = true;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < Iterations; i++)
+    {
+        void* objPtr = le_mem_ForceAlloc(poolRef);
+        ok = ok && (objPtr != NULL);
+        le_mem_Release(objPtr);
+    }
+
+    Report("mem.allocRelease", Iterations, startTime);
+    LE_TEST_OK(ok, "pool alloc/release");
+}
+
+static void BenchHashMap
+(
+    void
+)
+{
+    le_hashmap_Ref_t mapRef = le_hashmap_Create("BenchMap",
+                                                COLLECTION_SIZE,
+                                                le_hashmap_HashUInt32,
+                                                le_hashmap_EqualsUInt32);
+    int i;
+    int misses = 0;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < COLLECTION_SIZE; i++)
+    {
+        Keys[i] = i * 7919;
+        le_hashmap_Put(mapRef, &Keys[i], &Keys[i]);
+    }
+
+    Report("hashmap.put", COLLECTION_SIZE, startTime);
+
+    startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < Iterations; i++)
+    {
+        uint32_t* keyPtr = &Keys[i % COLLECTION_SIZE];
+
+        if (le_hashmap_Get(mapRef, keyPtr) != keyPtr)
+        {
+            misses++;
+        }
+    }
+
+    Report("hashmap.get", Iterations, startTime);
+    LE_TEST_OK(misses == 0, "hash map put/get (%d misses)", misses);
+
+    le_hashmap_RemoveAll(mapRef);
+}
+
+static void BenchSafeRef
+(
+    void
+)
+{
+    le_ref_MapRef_t mapRef = le_ref_CreateMap("BenchRefs", COLLECTION_SIZE);
+    int i;
+    int misses = 0;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < COLLECTION_SIZE; i++)
+    {
+        Refs[i] = le_ref_CreateRef(mapRef, &Keys[i]);
+    }
+
+    Report("safeRef.create", COLLECTION_SIZE, startTime);
+
+    startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < Iterations; i++)
+    {
+        int index = i % COLLECTION_SIZE;
+
+        if (le_ref_Lookup(mapRef, Refs[index]) != &Keys[index])
+        {
+            misses++;
+        }
+    }
+
+    Report("safeRef.lookup", Iterations, startTime);
+    LE_TEST_OK(misses == 0, "safe reference create/lookup (%d misses)", misses);
+
+    for (i = 0; i < COLLECTION_SIZE; i++)
+    {
+        le_ref_DeleteRef(mapRef, Refs[i]);
+    }
+}
+
+static void BenchTimer
+(
+    void
+)
+{
+    le_timer_Ref_t timerRef = le_timer_Create("BenchTimer");
+    le_timer_SetMsInterval(timerRef, 60000);
+
+    int i;
+    int failures = 0;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < Iterations; i++)
+    {
+        if ((le_timer_Start(timerRef) != LE_OK) || (le_timer_Stop(timerRef) != LE_OK))
+        {
+            failures++;
+        }
+    }
+
+    Report("timer.startStop", Iterations, startTime);
+    LE_TEST_OK(failures == 0, "timer start/stop (%d failures)", failures);
+
+    le_timer_Delete(timerRef);
+}
+
+static void BenchPack
+(
+    void
+)
+{
+    uint8_t buffer[PACK_BUFFER_SIZE];
+    char string[sizeof(PACK_STRING)];
+    int i;
+    int failures = 0;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < Iterations; i++)
+    {
+        uint8_t* bufferPtr = buffer;
+        uint32_t value;
+
+        if (!le_pack_PackUint32(&bufferPtr, (uint32_t)i) ||
+            !le_pack_PackString(&bufferPtr, PACK_STRING, sizeof(PACK_STRING) - 1))
+        {
+            failures++;
+            continue;
+        }
+
+        bufferPtr = buffer;
+        if (!le_pack_UnpackUint32(&bufferPtr, &value) ||
+            !le_pack_UnpackString(&bufferPtr, string, sizeof(string), sizeof(PACK_STRING) - 1) ||
+            (value != (uint32_t)i))
+        {
+            failures++;
+        }
+    }
+
+    Report("pack.packUnpack", Iterations, startTime);
+    LE_TEST_OK(failures == 0, "pack/unpack (%d failures)", failures);
+}
+
+static void Finish
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    LE_TEST_EXIT;
+}
+
+static void BenchIpc
+(
+    const char* nameStr,
+    int32_t     (*incrementFunc)(int32_t)
+)
+{
+    int i;
+    int errors = 0;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < Iterations; i++)
+    {
+        if (incrementFunc(i) != i + 1)
+        {
+            errors++;
+        }
+    }
+
+    Report(nameStr, Iterations, startTime);
+    LE_TEST_OK(errors == 0, "%s round trips (%d errors)", nameStr, errors);
+}
+
+static void* IpcThreadMain
+(
+    void* contextPtr
+)
+{
+    // Clients run in their own thread so the in-process server is served by the main thread.
+    localBench_ConnectService();
+    BenchIpc("ipc.sameProcess", localBench_Increment);
+    localBench_DisconnectService();
+
+    remoteBench_ConnectService();
+    BenchIpc("ipc.otherProcess", remoteBench_Increment);
+    remoteBench_DisconnectService();
+
+    le_event_QueueFunctionToThread(MainThreadRef, Finish, NULL, NULL);
+
+    return NULL;
+}
+
+static void EventHandler
+(
+    void* reportPtr
+)
+{
+    // Each event is reported from the handler of the previous one, so every iteration includes a
+    // trip through the event loop.
+    if (++EventCount < Iterations)
+    {
+        le_event_Report(BenchEventId, &EventCount, sizeof(EventCount));
+        return;
+    }
+
+    Report("event.reportDispatch", Iterations, EventStartTime);
+    LE_TEST_OK(*(int*)reportPtr == Iterations - 1, "event report/dispatch");
+
+    le_thread_Start(le_thread_Create("BenchIpc", IpcThreadMain, NULL));
+}
+
+static void BenchEvent
+(
+    void
+)
+{
+    BenchEventId = le_event_CreateId("BenchEvent", sizeof(EventCount));
+    le_event_AddHandler("BenchHandler", BenchEventId, EventHandler);
+
+    EventCount = 0;
+    EventStartTime = le_clk_GetRelativeTime();
+    le_event_Report(BenchEventId, &EventCount, sizeof(EventCount));
+}
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(8);
+
+    le_arg_SetIntVar(&Iterations, "n", NULL);
+    le_arg_Scan();
+    LE_TEST_INFO("Running with %d iterations", Iterations);
+
+    MainThreadRef = le_thread_GetCurrent();
+
+    BenchMemPool();
+    BenchHashMap();
+    BenchSafeRef();
+    BenchTimer();
+    BenchPack();
+
+    // The event benchmark completes in the event loop, and then starts the IPC benchmarks.
+    BenchEvent();
+}
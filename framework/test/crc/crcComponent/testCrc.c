@@ -6,6 +6,82 @@
 
 #include "legato.h"
 
+#define BENCH_BUFFER_SIZE   (64 * 1024)
+#define BENCH_ITERATIONS    64
+
+static uint8_t BenchBuffer[BENCH_BUFFER_SIZE];
+
+// Reference CRC-32, computed one bit at a time.
+static uint32_t ReferenceCrc32
+(
+    const uint8_t  *dataPtr,
+    size_t          size,
+    uint32_t        crc
+)
+{
+    int bit;
+
+    for (; size > 0; size--)
+    {
+        crc ^= *dataPtr++;
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return crc;
+}
+
+// Check every combination of start alignment and (short) length against the reference, then
+// report the throughput on a larger buffer.
+static void TestBuffers
+(
+    void
+)
+{
+    size_t          offset;
+    size_t          size;
+    bool            match = true;
+    int             i;
+    uint32_t        crc = LE_CRC_START_CRC32;
+    le_clk_Time_t   start;
+    le_clk_Time_t   elapsed;
+    double          seconds;
+
+    for (i = 0; i < BENCH_BUFFER_SIZE; i++)
+    {
+        BenchBuffer[i] = (uint8_t)(i * 7 + (i >> 8));
+    }
+
+    for (offset = 0; offset < 8; offset++)
+    {
+        for (size = 0; size < 64; size++)
+        {
+            match = match &&
+                (le_crc_Crc32(BenchBuffer + offset, size, LE_CRC_START_CRC32) ==
+                 ReferenceCrc32(BenchBuffer + offset, size, LE_CRC_START_CRC32));
+        }
+    }
+    LE_TEST_OK(match, "CRC matches the reference for all short lengths and alignments");
+
+    LE_TEST_OK(le_crc_Crc32(BenchBuffer, BENCH_BUFFER_SIZE, LE_CRC_START_CRC32) ==
+               ReferenceCrc32(BenchBuffer, BENCH_BUFFER_SIZE, LE_CRC_START_CRC32),
+               "CRC matches the reference for a large buffer");
+
+    start = le_clk_GetRelativeTime();
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        crc = le_crc_Crc32(BenchBuffer, BENCH_BUFFER_SIZE, crc);
+    }
+    elapsed = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    seconds = elapsed.sec + elapsed.usec / 1000000.0;
+
+    LE_TEST_INFO("CRC-32 of %d KiB took %.3f ms (%.1f MiB/s, crc 0x%08" PRIX32 ")",
+        BENCH_BUFFER_SIZE * BENCH_ITERATIONS / 1024, seconds * 1000,
+        (seconds > 0 ? BENCH_BUFFER_SIZE * BENCH_ITERATIONS / seconds / (1024 * 1024) : 0),
+        crc);
+}
+
 COMPONENT_INIT
 {
     uint32_t    crc;
@@ -20,9 +96,9 @@ COMPONENT_INIT
                 };
     uint8_t     data3[2] = { 0x00, 0x00 };
 
-    LE_TEST_PLAN(3); // Indicate that there are 3 test cases in this app.
+    LE_TEST_PLAN(5); // Indicate that there are 5 test cases in this app.
 
-    // Execute the 3 test cases.
+    // Execute the 5 test cases.
     crc = le_crc_Crc32(data1, sizeof(data1), LE_CRC_START_CRC32);
     expected = ~0x7F34014E;
     LE_TEST_OK(crc == expected, "Verified initial CRC (0x%08" PRIX32 ") is valid (0x%08" PRIX32 ")",
@@ -38,6 +114,8 @@ COMPONENT_INIT
     LE_TEST_OK(crc == expected, "Verified final CRC (0x%08" PRIX32 ") is valid (0x%08" PRIX32 ")",
         crc, expected);
 
+    TestBuffers();
+
     // End the test sequence.
     LE_TEST_EXIT;
 }
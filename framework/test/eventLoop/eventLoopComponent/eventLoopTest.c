@@ -7,10 +7,12 @@
 static bool TestAPassed;
 static bool TestBPassed;
 static bool TestCPassed;
+static bool TestDPassed;
 
 static le_event_Id_t EventIdA;
 static le_event_Id_t EventIdB;
 static le_event_Id_t EventIdC;
+static le_event_Id_t EventIdD;
 
 static char EventContextA[] = "Context A";
 
@@ -64,6 +66,20 @@ static void EventHandlerB
 }
 
 
+static void EventHandlerD
+(
+    void* reportPtr
+)
+{
+    LE_UNUSED(reportPtr);
+
+    // Event D is reported last, but its handler has a high priority.
+    LE_TEST_OK(!TestAPassed, "High priority event D handled ahead of event A.");
+
+    TestDPassed = true;
+}
+
+
 static void Destructor
 (
     void* objPtr
@@ -96,6 +112,7 @@ static void CheckTestResults
     LE_TEST_OK(TestAPassed, "Test Event A passed");
     LE_TEST_OK(TestAPassed, "Test Event B passed");
     LE_TEST_OK(TestAPassed, "Test Event C passed");
+    LE_TEST_OK(TestDPassed, "Test Event D passed");
 
     LE_INFO("======== EVENT LOOP TEST COMPLETE (PASSED) ========");
     LE_TEST_EXIT;
@@ -109,12 +126,13 @@ COMPONENT_INIT
     TestAPassed = false;
     TestBPassed = false;
     TestCPassed = false;
+    TestDPassed = false;
 
     LE_INFO("======== BEGIN EVENT LOOP TEST ========");
 
     LE_INFO("%s called!", __func__);
 
-    LE_TEST_PLAN(22);
+    LE_TEST_PLAN(25);
 
     EventIdA = le_event_CreateId("Event A", sizeof(ReportA));
     LE_TEST_OK(true, "Created event ID A.");
@@ -152,6 +170,12 @@ COMPONENT_INIT
     le_event_ReportWithRefCounting(EventIdC, reportPtr);
     LE_TEST_OK(true, "Reporting event C with ref counting...");
 
+    EventIdD = le_event_CreateId("Event D", 0);
+    le_event_HandlerRef_t evtHdlerRefD = le_event_AddHandler("Handler D", EventIdD, EventHandlerD);
+    le_event_SetHandlerPriority(evtHdlerRefD, LE_EVENT_PRIORITY_HIGH);
+    le_event_Report(EventIdD, NULL, 0);
+    LE_TEST_OK(true, "Reporting high priority event D...");
+
     le_event_QueueFunction(CheckTestResults, &ReportA, &ReportB);
     LE_TEST_OK(true, "Queuing function to check test results for events A and B...");
 }
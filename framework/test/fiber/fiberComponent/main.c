@@ -0,0 +1,240 @@
+/**
+ * This module is for unit testing the le_fiber module in the legato
+ * runtime library (liblegato.so).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+// Symbol and Enum definitions
+//--------------------------------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Number of times each of the yielding fibers takes its turn.
+ */
+// -------------------------------------------------------------------------------------------------
+#define TURN_COUNT          3
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Time the writing fiber sleeps before writing to the pipe, in milliseconds.
+ */
+// -------------------------------------------------------------------------------------------------
+#define WRITE_DELAY_MS      100
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Interval of the timer that checks that the event loop keeps running, in milliseconds.
+ */
+// -------------------------------------------------------------------------------------------------
+#define TICK_MS             10
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Number of fibers started by the test.
+ */
+// -------------------------------------------------------------------------------------------------
+#define FIBER_COUNT         5
+
+//--------------------------------------------------------------------------------------------------
+// Static variables
+//--------------------------------------------------------------------------------------------------
+
+static le_thread_Ref_t MainThreadRef;
+static int PipeFds[2] = { -1, -1 };
+static le_timer_Ref_t TickTimerRef;
+static size_t TickCount;
+static char TurnStr[2 * TURN_COUNT + 1];
+static size_t TurnCount;
+static le_fiber_Ref_t SuspendedFiberRef;
+static bool IsSuspendedFiberResumed;
+static size_t FibersDone;
+
+//--------------------------------------------------------------------------------------------------
+// Test functions
+//--------------------------------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Called at the end of each fiber.  Ends the test after the last one.
+ */
+// -------------------------------------------------------------------------------------------------
+static void FiberDone
+(
+    void
+)
+{
+    LE_TEST_OK(le_thread_GetCurrent() == MainThreadRef, "Fiber runs in the thread that started it");
+
+    if (++FibersDone == FIBER_COUNT)
+    {
+        LE_TEST_OK(strcmp(TurnStr, "ABABAB") == 0, "Yielding fibers take turns (%s)", TurnStr);
+
+        le_timer_Delete(TickTimerRef);
+        close(PipeFds[0]);
+        close(PipeFds[1]);
+
+        LE_TEST_EXIT;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Timer handler, counting how often the event loop got to run it.
+ */
+// -------------------------------------------------------------------------------------------------
+static void Tick
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_UNUSED(timerRef);
+
+    TickCount++;
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fiber that waits for data on the pipe.
+ */
+// -------------------------------------------------------------------------------------------------
+static void Reader
+(
+    void* contextPtr
+)
+{
+    char byte = 0;
+
+    LE_UNUSED(contextPtr);
+
+    short events = le_fiber_WaitFd(PipeFds[0], POLLIN);
+    LE_TEST_OK(events & POLLIN, "Reader woken by data on the pipe (events 0x%x)", events);
+    LE_TEST_OK(read(PipeFds[0], &byte, 1) == 1 && byte == 'x', "Reader got the byte written");
+    LE_TEST_OK(TickCount > 0, "Event loop kept running while fibers waited (%" PRIuS " ticks)",
+               TickCount);
+
+    FiberDone();
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fiber that writes to the pipe after sleeping.
+ */
+// -------------------------------------------------------------------------------------------------
+static void Writer
+(
+    void* contextPtr
+)
+{
+    le_clk_Time_t start = le_clk_GetRelativeTime();
+
+    LE_UNUSED(contextPtr);
+
+    le_fiber_Sleep(WRITE_DELAY_MS);
+
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), start);
+    LE_TEST_OK(elapsed.sec * 1000 + elapsed.usec / 1000 >= WRITE_DELAY_MS,
+               "Writer slept for at least %d ms", WRITE_DELAY_MS);
+    LE_TEST_OK(write(PipeFds[1], "x", 1) == 1, "Writer wrote to the pipe");
+
+    FiberDone();
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fiber that takes turns with the other instance of itself.
+ */
+// -------------------------------------------------------------------------------------------------
+static void Yielder
+(
+    void* contextPtr
+)
+{
+    char letter = (char)(intptr_t)contextPtr;
+    int i;
+
+    for (i = 0; i < TURN_COUNT; i++)
+    {
+        TurnStr[TurnCount++] = letter;
+        le_fiber_Yield();
+    }
+
+    FiberDone();
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Resume the suspended fiber, from outside of any fiber.
+ */
+// -------------------------------------------------------------------------------------------------
+static void ResumeSuspended
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    LE_UNUSED(param1Ptr);
+    LE_UNUSED(param2Ptr);
+
+    LE_TEST_OK(le_fiber_GetCurrent() == NULL, "No fiber running in an event handler");
+
+    IsSuspendedFiberResumed = true;
+    le_fiber_Resume(SuspendedFiberRef);
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Fiber that suspends itself until resumed by an event handler.
+ */
+// -------------------------------------------------------------------------------------------------
+static void Suspender
+(
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    SuspendedFiberRef = le_fiber_GetCurrent();
+    LE_TEST_OK(SuspendedFiberRef != NULL, "Fiber can get its own reference");
+
+    le_event_QueueFunction(ResumeSuspended, NULL, NULL);
+    le_fiber_Suspend();
+
+    LE_TEST_OK(IsSuspendedFiberResumed, "Suspended fiber resumed by an event handler");
+
+    FiberDone();
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Test main function.
+ */
+// -------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    LE_TEST_INFO("Starting fiber test");
+
+    LE_TEST_PLAN(15);
+
+    MainThreadRef = le_thread_GetCurrent();
+
+    LE_ASSERT(pipe(PipeFds) == 0);
+
+    TickTimerRef = le_timer_Create("FiberTick");
+    le_timer_SetMsInterval(TickTimerRef, TICK_MS);
+    le_timer_SetRepeat(TickTimerRef, 0);
+    le_timer_SetHandler(TickTimerRef, Tick);
+    le_timer_Start(TickTimerRef);
+
+    le_fiber_Start("Reader", Reader, NULL);
+    le_fiber_Start("Writer", Writer, NULL);
+    le_fiber_Start("YielderA", Yielder, (void*)(intptr_t)'A');
+    le_fiber_Start("YielderB", Yielder, (void*)(intptr_t)'B');
+    le_fiber_Start("Suspender", Suspender, NULL);
+
+    // Nothing has run yet: fibers only run from the event loop.
+    LE_TEST_OK(TurnCount == 0, "Fibers don't run before returning to the event loop");
+}
@@ -54,7 +54,7 @@ COMPONENT_INIT
 
     LE_TEST_INFO("Starting FS test");
 
-    LE_TEST_PLAN(91);
+    LE_TEST_PLAN(99);
 
     le_fs_FileRef_t fileRef = NULL;
 
@@ -401,6 +401,31 @@ facilisis erat, a imperdiet risus eleifend nec.";
     LE_TEST_OK(LE_OK == le_fs_Close(fileRef), "Close file '%s'", loremFilePath);
     fileRef = NULL;
 
+    // Map the file for reading
+    LE_TEST_BEGIN_SKIP(!LE_CONFIG_IS_ENABLED(LE_CONFIG_LINUX), 8);
+    le_fs_MappingRef_t mappingRef = NULL;
+    const uint8_t* mappedPtr = NULL;
+    size_t mappedSize = 0;
+    LE_TEST_OK(LE_OK == le_fs_MapReadOnly(loremFilePath, LE_FS_ACCESS_SEQUENTIAL, &mappingRef,
+                                          &mappedPtr, &mappedSize),
+               "Map file '%s'", loremFilePath);
+    LE_TEST_OK(strlen((char*)loremIpsum) == mappedSize, "Check mapped size %zu", mappedSize);
+    LE_TEST_OK((NULL != mappedPtr) && (0 == memcmp(mappedPtr, loremIpsum, mappedSize)),
+               "Check mapped data");
+    LE_TEST_OK(LE_OK == le_fs_Unmap(mappingRef), "Unmap file '%s'", loremFilePath);
+    LE_TEST_OK(LE_BAD_PARAMETER == le_fs_Unmap(mappingRef), "Test le_fs_Unmap with bad ref");
+    LE_TEST_OK(LE_NOT_FOUND == le_fs_MapReadOnly("/bar/foo/none.txt", LE_FS_ACCESS_RANDOM,
+                                                 &mappingRef, &mappedPtr, &mappedSize),
+               "Test le_fs_MapReadOnly with missing file");
+    LE_TEST_OK(LE_BAD_PARAMETER == le_fs_MapReadOnly("/bar/foo", LE_FS_ACCESS_RANDOM,
+                                                     &mappingRef, &mappedPtr, &mappedSize),
+               "Test le_fs_MapReadOnly with a directory");
+    LE_TEST_OK(LE_BAD_PARAMETER == le_fs_MapReadOnly("bar/foo/lorem_ipsum.txt",
+                                                     LE_FS_ACCESS_NORMAL, &mappingRef,
+                                                     &mappedPtr, &mappedSize),
+               "Test le_fs_MapReadOnly with wrong file name");
+    LE_TEST_END_SKIP();
+
     // Remove all created files and directories
     LE_TEST_INFO("Remove all created files and directories");
     LE_TEST_OK(LE_OK == le_fs_RemoveDirRecursive("/foo"), "Remove directory '/foo'");
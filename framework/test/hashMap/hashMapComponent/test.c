@@ -26,6 +26,11 @@ size_t le_hashmap_HashCustom(const void* keyPtr);
 bool le_hashmap_EqualsCustom(const void* firstPtr, const void* secondPtr);
 bool itHandler(const void* keyPtr, const void* valuePtr, void* contextPtr);
 void TestIterRemove(le_hashmap_Ref_t map);
+void TestFlatmap(le_flatmap_Ref_t map);
+void TestResize(le_hashmap_Ref_t map);
+void TestSnapshot(le_hashmap_Ref_t map);
+void TestResizeAfterEarlyStop(void);
+bool flatmapCountHandler(const void* keyPtr, const void* valuePtr, void* contextPtr);
 
 typedef struct Key Key_t;
 struct Key {
@@ -40,6 +45,8 @@ LE_HASHMAP_DEFINE_STATIC(Map4, 1);
 LE_HASHMAP_DEFINE_STATIC(Map5, 100);
 LE_HASHMAP_DEFINE_STATIC(Map6, 200);
 LE_HASHMAP_DEFINE_STATIC(Map7, 13);
+LE_HASHMAP_DEFINE_STATIC(ResizeMap, 200);
+LE_FLATMAP_DEFINE_STATIC(FlatMap, TEST_SIZE);
 
 static void InitStaticMaps
 (
@@ -152,6 +159,31 @@ COMPONENT_INIT
     TestNewIter(map7);
     TestIterRemove(map1);
 
+    LE_TEST_INFO("*** Creating resizable hash maps. ***");
+    le_hashmap_Ref_t resizeMap = le_hashmap_Create("ResizeMap", 4, &le_hashmap_HashUInt32,
+                                                   &le_hashmap_EqualsUInt32);
+    LE_TEST(resizeMap != NULL);
+    TestResize(resizeMap);
+
+    resizeMap = le_hashmap_InitStatic(ResizeMap, 200, &le_hashmap_HashUInt32,
+                                      &le_hashmap_EqualsUInt32);
+    LE_TEST(resizeMap != NULL);
+    TestResize(resizeMap);
+    TestSnapshot(resizeMap);
+    TestResizeAfterEarlyStop();
+
+    LE_TEST_INFO("*** Creating flat maps. ***");
+    le_flatmap_Ref_t flatMap = le_flatmap_Create("FlatMap", 16, &le_hashmap_HashUInt32,
+                                                 &le_hashmap_EqualsUInt32);
+    LE_TEST(flatMap != NULL);
+    le_flatmap_SetGrowable(flatMap, true);
+    TestFlatmap(flatMap);
+
+    flatMap = le_flatmap_InitStatic(FlatMap, TEST_SIZE, &le_hashmap_HashUInt32,
+                                    &le_hashmap_EqualsUInt32);
+    LE_TEST(flatMap != NULL);
+    TestFlatmap(flatMap);
+
     LE_TEST_INFO("==== Hashmap Tests PASSED ====\n");
 
     LE_TEST_SUMMARY;
@@ -678,3 +710,280 @@ void TestLongIntHashMap(le_hashmap_Ref_t map)
     mapIt = le_hashmap_GetIterator(map);
     LE_TEST(le_hashmap_NextNode(mapIt) == LE_NOT_FOUND);
 }
+
+bool flatmapCountHandler(const void* keyPtr, const void* valuePtr, void* contextPtr)
+{
+    int* countPtr = contextPtr;
+
+    if (*((const uint32_t*) valuePtr) != *((const uint32_t*) keyPtr) * 2)
+    {
+        return false;
+    }
+
+    (*countPtr)++;
+    return true;
+}
+
+void TestFlatmap(le_flatmap_Ref_t map)
+{
+    uint32_t iKeys[TEST_SIZE];
+    uint32_t iVals[TEST_SIZE];
+    uint32_t ival2 = 350;
+    uint32_t missingKey = 1;
+    int count = 0;
+    int j;
+
+    LE_TEST_INFO("*** Running flat map tests ***");
+
+    LE_TEST(le_flatmap_IsEmpty(map));
+
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        iKeys[j] = j * 2;
+        iVals[j] = j * 4;
+        LE_TEST_OK(le_flatmap_Put(map, &iKeys[j], &iVals[j]) == NULL, "flat map put %d", j);
+    }
+    LE_TEST(le_flatmap_Size(map) == TEST_SIZE);
+    LE_TEST_INFO("Collision count = %" PRIuS, le_flatmap_CountCollisions(map));
+
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        uint32_t key = j * 2;
+        uint32_t* valPtr = le_flatmap_Get(map, &key);
+        LE_TEST_OK(valPtr == &iVals[j], "flat map get %d", j);
+    }
+    LE_TEST(!le_flatmap_ContainsKey(map, &missingKey));
+    LE_TEST(le_flatmap_GetStoredKey(map, &iKeys[3]) == &iKeys[3]);
+
+    // Replace a value
+    LE_TEST(le_flatmap_Put(map, &iKeys[0], &ival2) == &iVals[0]);
+    LE_TEST(le_flatmap_Get(map, &iKeys[0]) == &ival2);
+    LE_TEST(le_flatmap_Size(map) == TEST_SIZE);
+    le_flatmap_Put(map, &iKeys[0], &iVals[0]);
+
+    LE_TEST(le_flatmap_ForEach(map, flatmapCountHandler, &count));
+    LE_TEST(count == TEST_SIZE);
+
+    // Remove every other entry, then make sure all the remaining ones can still be found after
+    // entries have been shifted back.
+    for (j = 0; j < TEST_SIZE; j += 2)
+    {
+        LE_TEST_OK(le_flatmap_Remove(map, &iKeys[j]) == &iVals[j], "flat map remove %d", j);
+    }
+    LE_TEST(le_flatmap_Remove(map, &iKeys[0]) == NULL);
+    LE_TEST(le_flatmap_Size(map) == TEST_SIZE / 2);
+
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        bool isExpected = ((j % 2) != 0);
+        LE_TEST_OK(le_flatmap_ContainsKey(map, &iKeys[j]) == isExpected,
+                   "flat map contains %d after removal", j);
+    }
+
+    le_flatmap_RemoveAll(map);
+    LE_TEST(le_flatmap_IsEmpty(map));
+    LE_TEST(le_flatmap_Get(map, &iKeys[1]) == NULL);
+}
+
+void TestResize(le_hashmap_Ref_t map)
+{
+    uint32_t iKeys[TEST_SIZE];
+    uint32_t iVals[TEST_SIZE];
+    size_t collisions;
+    int itercnt = 0;
+    int j;
+
+    LE_TEST_INFO("*** Running hashmap resize tests ***");
+
+    // Fill the map without resizing to find out how badly it collides at its initial size.
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        iKeys[j] = j * 2;
+        iVals[j] = j * 4;
+        le_hashmap_Put(map, &iKeys[j], &iVals[j]);
+    }
+    collisions = le_hashmap_CountCollisions(map);
+    LE_TEST_INFO("Collision count without resize = %" PRIuS, collisions);
+    le_hashmap_RemoveAll(map);
+
+    le_hashmap_EnableResize(map, 75);
+
+    // Look up every key inserted so far after each insertion, so that lookups are checked while
+    // the map is part-way through a resize.
+    bool allFound = true;
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        int k;
+
+        LE_TEST_OK(le_hashmap_Put(map, &iKeys[j], &iVals[j]) == NULL, "resize put %d", j);
+        for (k = 0; k <= j; k += 7)
+        {
+            if (le_hashmap_Get(map, &iKeys[k]) != &iVals[k])
+            {
+                allFound = false;
+            }
+        }
+    }
+    LE_TEST(allFound);
+    LE_TEST(le_hashmap_Size(map) == TEST_SIZE);
+
+    // Getting an iterator finishes the resize, so every entry is seen exactly once.
+    le_hashmap_It_Ref_t mapIt = le_hashmap_GetIterator(map);
+    while (le_hashmap_NextNode(mapIt) == LE_OK)
+    {
+        itercnt++;
+    }
+    LE_TEST(itercnt == TEST_SIZE);
+
+    LE_TEST_INFO("Collision count with resize = %" PRIuS, le_hashmap_CountCollisions(map));
+    LE_TEST(le_hashmap_CountCollisions(map) < collisions);
+
+    // Remove entries while the map may still be resizing.
+    for (j = 0; j < TEST_SIZE; j += 2)
+    {
+        LE_TEST_OK(le_hashmap_Remove(map, &iKeys[j]) == &iVals[j], "resize remove %d", j);
+    }
+    LE_TEST(le_hashmap_Size(map) == TEST_SIZE / 2);
+
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        bool isExpected = ((j % 2) != 0);
+        LE_TEST_OK(le_hashmap_ContainsKey(map, &iKeys[j]) == isExpected,
+                   "resize map contains %d after removal", j);
+    }
+
+    le_hashmap_RemoveAll(map);
+    LE_TEST(le_hashmap_isEmpty(map));
+}
+
+void TestSnapshot(le_hashmap_Ref_t map)
+{
+    uint32_t iKeys[TEST_SIZE];
+    uint32_t iVals[TEST_SIZE];
+    le_hashmap_KeyValue_t pairs[TEST_SIZE];
+    bool seen[TEST_SIZE] = { false };
+    size_t count;
+    size_t j;
+
+    LE_TEST_INFO("*** Running hashmap snapshot tests ***");
+
+    LE_TEST(le_hashmap_Snapshot(map, pairs, TEST_SIZE) == 0);
+
+    // Filling the map may leave it part-way through a resize, which the snapshot completes.
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        iKeys[j] = j;
+        iVals[j] = j * 3;
+        le_hashmap_Put(map, &iKeys[j], &iVals[j]);
+    }
+
+    count = le_hashmap_Snapshot(map, pairs, TEST_SIZE);
+    LE_TEST(count == TEST_SIZE);
+
+    bool allMatch = true;
+    for (j = 0; j < count; j++)
+    {
+        uint32_t key = *(const uint32_t*)pairs[j].keyPtr;
+
+        if ((key >= TEST_SIZE) || seen[key] || (pairs[j].valuePtr != &iVals[key]))
+        {
+            allMatch = false;
+            break;
+        }
+        seen[key] = true;
+    }
+    LE_TEST(allMatch);
+
+    // The snapshot stays usable while the map is changed.
+    for (j = 0; j < count; j++)
+    {
+        le_hashmap_Remove(map, pairs[j].keyPtr);
+    }
+    LE_TEST(le_hashmap_isEmpty(map));
+
+    // A short array gets as many pairs as it can hold.
+    for (j = 0; j < 10; j++)
+    {
+        le_hashmap_Put(map, &iKeys[j], &iVals[j]);
+    }
+    LE_TEST(le_hashmap_Snapshot(map, pairs, 4) == 4);
+
+    le_hashmap_RemoveAll(map);
+}
+
+static bool StopIterating(const void* keyPtr, const void* valuePtr, void* contextPtr)
+{
+    LE_UNUSED(keyPtr);
+    LE_UNUSED(valuePtr);
+    LE_UNUSED(contextPtr);
+
+    return false;
+}
+
+// Fill a resizable map after an iteration over it has been stopped part-way, and check that the
+// map still grows.
+static void FillAfterEarlyStop(le_hashmap_Ref_t map, uint32_t* keysPtr, const char* howStr)
+{
+    int j;
+
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        le_hashmap_Put(map, &keysPtr[j], &keysPtr[j]);
+    }
+
+    LE_TEST_OK(map->bucketCount > 4, "map resized after %s (%" PRIuS " buckets)",
+               howStr, map->bucketCount);
+    LE_TEST_OK(le_hashmap_Size(map) == TEST_SIZE, "all entries kept after %s", howStr);
+}
+
+void TestResizeAfterEarlyStop(void)
+{
+    static uint32_t iKeys[TEST_SIZE];
+    le_hashmap_Ref_t map;
+    le_hashmap_It_Ref_t mapIt;
+    int j;
+
+    LE_TEST_INFO("*** Running hashmap resize after early stop tests ***");
+
+    for (j = 0; j < TEST_SIZE; j++)
+    {
+        iKeys[j] = j;
+    }
+
+    // le_hashmap_ForEach() stopped by its callback.
+    map = le_hashmap_Create("EarlyStop1", 4, &le_hashmap_HashUInt32, &le_hashmap_EqualsUInt32);
+    le_hashmap_EnableResize(map, 75);
+    le_hashmap_Put(map, &iKeys[0], &iKeys[0]);
+    le_hashmap_Put(map, &iKeys[1], &iKeys[1]);
+    LE_TEST(!le_hashmap_ForEach(map, StopIterating, NULL));
+    FillAfterEarlyStop(map, iKeys, "stopped ForEach");
+
+    // Step-by-step iteration ended with le_hashmap_ReleaseIterator().
+    map = le_hashmap_Create("EarlyStop2", 4, &le_hashmap_HashUInt32, &le_hashmap_EqualsUInt32);
+    le_hashmap_EnableResize(map, 75);
+    le_hashmap_Put(map, &iKeys[0], &iKeys[0]);
+    le_hashmap_Put(map, &iKeys[1], &iKeys[1]);
+    mapIt = le_hashmap_GetIterator(map);
+    LE_TEST(le_hashmap_NextNode(mapIt) == LE_OK);
+    le_hashmap_ReleaseIterator(mapIt);
+    FillAfterEarlyStop(map, iKeys, "released iterator");
+
+    // Step-by-step iteration that is simply dropped.
+    map = le_hashmap_Create("EarlyStop3", 4, &le_hashmap_HashUInt32, &le_hashmap_EqualsUInt32);
+    le_hashmap_EnableResize(map, 75);
+    le_hashmap_Put(map, &iKeys[0], &iKeys[0]);
+    le_hashmap_Put(map, &iKeys[1], &iKeys[1]);
+    mapIt = le_hashmap_GetIterator(map);
+    LE_TEST(le_hashmap_NextNode(mapIt) == LE_OK);
+    FillAfterEarlyStop(map, iKeys, "dropped iterator");
+    LE_TEST_OK(le_hashmap_NextNode(mapIt) == LE_NOT_FOUND, "dropped iterator ended by resize");
+
+    // A new iteration still sees every entry.
+    int itercnt = 0;
+    mapIt = le_hashmap_GetIterator(map);
+    while (le_hashmap_NextNode(mapIt) == LE_OK)
+    {
+        itercnt++;
+    }
+    LE_TEST(itercnt == TEST_SIZE);
+}
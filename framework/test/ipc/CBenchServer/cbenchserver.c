@@ -0,0 +1,22 @@
+/**
+ * Server side of the IPC benchmarks.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+
+int32_t ipcBench_Increment
+(
+    int32_t value
+        ///< [IN]
+)
+{
+    return value + 1;
+}
+
+
+COMPONENT_INIT
+{
+}
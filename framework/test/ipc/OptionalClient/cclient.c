@@ -7,10 +7,37 @@
 #include "legato.h"
 #include "interfaces.h"
 
+/// Number of rejected open attempts to make.
+#define REJECTED_OPEN_COUNT 3
+
 COMPONENT_INIT
 {
-    LE_TEST_PLAN(1);
-    le_result_t result = ipcTest_TryConnectService();
+    LE_TEST_PLAN(3);
+
+    // A descriptor opened before the attempts, which a rejected open must leave alone.
+    int fd = open("/dev/null", O_RDONLY);
+    LE_ASSERT(fd >= 0);
+
+    le_result_t result = LE_OK;
+    int i;
+    for (i = 0; i < REJECTED_OPEN_COUNT; i++)
+    {
+        result = ipcTest_TryConnectService();
+        if ((LE_UNAVAILABLE != result) && (LE_NOT_PERMITTED != result))
+        {
+            break;
+        }
+    }
     LE_TEST_OK((LE_UNAVAILABLE == result) || (LE_NOT_PERMITTED == result), "unbound service fails");
+
+    LE_TEST_OK(fcntl(fd, F_GETFD) != -1, "rejected opens don't close other descriptors");
+
+    // Nothing that came with the rejections is kept either, so the next descriptor opened gets
+    // the lowest number again.
+    close(fd);
+    int nextFd = open("/dev/null", O_RDONLY);
+    LE_TEST_OK(nextFd == fd, "rejected opens don't leak descriptors");
+    close(nextFd);
+
     LE_TEST_EXIT;
 }
@@ -51,6 +51,149 @@ static struct JsonExpectation Expected[] =
 
 static size_t TestIndex;
 
+/// Number of path query checks done by TestQuery().
+#define QUERY_TEST_COUNT 13
+
+/// Number of writer checks done by TestWriter().
+#define WRITER_TEST_COUNT 4
+
+struct QueryResult
+{
+    size_t  count;
+    char    text[128];
+};
+
+static bool OnQueryMatch
+(
+    const le_json_Value_t   *valuePtr,
+    void                    *contextPtr
+)
+{
+    struct QueryResult *resultPtr = contextPtr;
+    size_t              length = strlen(resultPtr->text);
+
+    // Collect the text of all matches, separated by '|'.
+    snprintf(resultPtr->text + length, sizeof(resultPtr->text) - length, "%s%.*s",
+        (resultPtr->count == 0 ? "" : "|"), (int) valuePtr->textLen, valuePtr->textPtr);
+    ++resultPtr->count;
+    return true;
+}
+
+static bool OnTypeMatch
+(
+    const le_json_Value_t   *valuePtr,
+    void                    *contextPtr
+)
+{
+    le_json_Value_t *resultPtr = contextPtr;
+
+    *resultPtr = *valuePtr;
+    return true;
+}
+
+static bool OnFirstQueryMatch
+(
+    const le_json_Value_t   *valuePtr,
+    void                    *contextPtr
+)
+{
+    OnQueryMatch(valuePtr, contextPtr);
+    return false;
+}
+
+static void CheckQuery
+(
+    const char  *path,
+    le_result_t  expectedResult,
+    const char  *expectedText
+)
+{
+    struct QueryResult  result = { 0 };
+    le_result_t         res;
+
+    res = le_json_Query(StaticJson, strlen(StaticJson), path, &OnQueryMatch, &result);
+    LE_TEST_OK(res == expectedResult && strcmp(result.text, expectedText) == 0,
+        "Query '%s' returned %s and '%s'", path, LE_RESULT_TXT(res), result.text);
+}
+
+static void TestQuery
+(
+    void
+)
+{
+    struct QueryResult  result = { 0 };
+    le_json_Value_t     value = { 0 };
+    static const char   truncatedJson[] = "{ \"one\": 1, \"two\": [2, ";
+
+    CheckQuery("one", LE_OK, "1");
+    CheckQuery("two[*]", LE_OK, "2|2");
+    CheckQuery("two[1]", LE_OK, "2");
+    CheckQuery("two[2]", LE_OK, "");
+    CheckQuery("three.3", LE_OK, "3.3");
+    CheckQuery("three.*", LE_OK, "3.3|null|true|\\\"three\\\"");
+    CheckQuery("two", LE_OK, "[2, 2]");
+    CheckQuery("four", LE_OK, "");
+    CheckQuery("one[0]", LE_OK, "");
+    CheckQuery("two[x]", LE_BAD_PARAMETER, "");
+
+    LE_TEST_OK(le_json_Query(truncatedJson, strlen(truncatedJson), "three", &OnQueryMatch,
+        &result) == LE_FORMAT_ERROR, "Truncated document is rejected");
+
+    LE_TEST_OK(le_json_Query(StaticJson, strlen(StaticJson), "three.*", &OnFirstQueryMatch,
+        &result) == LE_OK && result.count == 1, "Query stopped by handler");
+
+    // Get the type of a value from a nested query.
+    LE_TEST_OK(le_json_Query(StaticJson, strlen(StaticJson), "three.trois",
+        &OnTypeMatch, &value) == LE_OK && value.type == LE_JSON_TRUE,
+        "Query reported value type %s", le_json_GetEventName(value.type));
+}
+
+static void TestWriter
+(
+    void
+)
+{
+    char                buffer[128];
+    char                smallBuffer[8];
+    le_json_Writer_t    writer;
+    int                 i;
+
+    le_json_InitWriter(&writer, -1, buffer, sizeof(buffer));
+    le_json_StartObject(&writer);
+    le_json_WriteMember(&writer, "one");
+    le_json_WriteInt(&writer, -1);
+    le_json_WriteMember(&writer, "two");
+    le_json_StartArray(&writer);
+    le_json_WriteUint(&writer, 2);
+    le_json_WriteNumber(&writer, 2.5);
+    le_json_StartObject(&writer);
+    le_json_EndObject(&writer);
+    le_json_EndArray(&writer);
+    le_json_WriteMember(&writer, "three");
+    le_json_StartArray(&writer);
+    le_json_WriteNull(&writer);
+    le_json_WriteBool(&writer, true);
+    le_json_WriteString(&writer, "\"3\"\\\n\x01");
+    le_json_EndArray(&writer);
+    le_json_EndObject(&writer);
+    LE_TEST_OK(le_json_FinishWriter(&writer) == LE_OK, "Wrote document");
+    LE_TEST_OK(strcmp(buffer,
+        "{\"one\":-1,\"two\":[2,2.5,{}],\"three\":[null,true,\"\\\"3\\\"\\\\\\n\\u0001\"]}") == 0,
+        "Wrote '%s'", buffer);
+
+    le_json_InitWriter(&writer, -1, smallBuffer, sizeof(smallBuffer));
+    le_json_WriteString(&writer, "too long to fit");
+    LE_TEST_OK(le_json_FinishWriter(&writer) == LE_OVERFLOW && strlen(smallBuffer) == 7,
+        "Buffer overflow reported");
+
+    le_json_InitWriter(&writer, -1, buffer, sizeof(buffer));
+    for (i = 0; i <= LE_JSON_WRITER_MAX_DEPTH; ++i)
+    {
+        le_json_StartArray(&writer);
+    }
+    LE_TEST_OK(le_json_FinishWriter(&writer) == LE_OVERFLOW, "Nesting overflow reported");
+}
+
 static void OnEvent
 (
     le_json_Event_t event
@@ -111,11 +254,15 @@ static void OnError
 
 COMPONENT_INIT
 {
-    int testCount = NUM_ARRAY_MEMBERS(Expected) * 3 + 3;
+    int testCount = NUM_ARRAY_MEMBERS(Expected) * 3 + 3 + QUERY_TEST_COUNT +
+        WRITER_TEST_COUNT;
 
     LE_TEST_INFO("======== BEGIN JSON TEST ========");
     TestIndex = 0;
     LE_TEST_PLAN(testCount);
 
+    TestQuery();
+    TestWriter();
+
     LE_TEST_OK(le_json_ParseString(StaticJson, &OnEvent, &OnError, NULL) != NULL, "Created parser");
 }
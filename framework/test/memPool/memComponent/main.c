@@ -563,6 +563,338 @@ static void TestPools
 }
 
 
+#define CACHE_POOL_SIZE         32
+#define CACHE_SIZE              8
+#define CACHE_NUM_THREADS       4
+#define CACHE_NUM_ITERATIONS    1000
+
+static void* ThreadCacheWorker
+(
+    void* contextPtr
+)
+{
+    le_mem_PoolRef_t pool = contextPtr;
+    idObj_t* objsPtr[CACHE_SIZE];
+    int i, j;
+    bool ok = true;
+
+    for (i = 0; i < CACHE_NUM_ITERATIONS; i++)
+    {
+        for (j = 0; j < CACHE_SIZE; j++)
+        {
+            objsPtr[j] = le_mem_ForceAlloc(pool);
+            objsPtr[j]->id = i;
+        }
+
+        // Take and drop an extra reference on one of the objects.
+        le_mem_AddRef(objsPtr[0]);
+        le_mem_Release(objsPtr[0]);
+        ok = ok && (le_mem_GetRefCount(objsPtr[0]) == 1);
+
+        for (j = 0; j < CACHE_SIZE; j++)
+        {
+            ok = ok && (objsPtr[j]->id == (uint32_t)i);
+            le_mem_Release(objsPtr[j]);
+        }
+    }
+
+    return (void*)(intptr_t)ok;
+}
+
+static void TestThreadCache
+(
+    void
+)
+{
+    le_mem_PoolRef_t pool;
+    le_mem_PoolStats_t stats;
+    le_thread_Ref_t threads[CACHE_NUM_THREADS];
+    void* resultPtr;
+    int i;
+
+    LE_TEST_BEGIN_SKIP(TEST_MEM_VALGRIND || !LE_CONFIG_IS_ENABLED(LE_CONFIG_MEM_THREAD_CACHE), 5);
+
+    pool = le_mem_CreatePool("Cached Pool", sizeof(idObj_t));
+    le_mem_ExpandPool(pool, CACHE_POOL_SIZE);
+    le_mem_EnableThreadCache(pool, CACHE_SIZE);
+
+    for (i = 0; i < CACHE_NUM_THREADS; i++)
+    {
+        threads[i] = le_thread_Create("cacheWorker", ThreadCacheWorker, pool);
+        le_thread_SetJoinable(threads[i]);
+        le_thread_Start(threads[i]);
+    }
+
+    for (i = 0; i < CACHE_NUM_THREADS; i++)
+    {
+        le_thread_Join(threads[i], &resultPtr);
+        LE_TEST_OK(resultPtr != NULL, "Cached allocations in thread %d", i);
+    }
+
+    // Exited threads give their cached blocks back to the pool.
+    le_mem_GetStats(pool, &stats);
+    LE_TEST_OK(stats.numBlocksInUse == 0 && stats.numThreadCached == 0 &&
+               stats.numFree == le_mem_GetObjectCount(pool),
+               "All cached blocks returned (in use %" PRIuS ", cached %" PRIuS ", free %" PRIuS ")",
+               stats.numBlocksInUse, stats.numThreadCached, stats.numFree);
+
+    LE_TEST_END_SKIP();
+}
+
+
+#define ARENA_CHUNK_SIZE        256
+#define ARENA_NUM_CHUNKS        2
+#define ARENA_NUM_BLOCKS        100
+
+static unsigned int NumArenaDestructs = 0;
+
+static void ArenaDestructor(void* objPtr)
+{
+    // Destructors run newest first.
+    LE_TEST_OK(*(unsigned int*)objPtr == NumArenaDestructs, "Arena destructor %u called in order",
+               NumArenaDestructs);
+    NumArenaDestructs--;
+}
+
+static void TestArena
+(
+    void
+)
+{
+    le_mem_PoolRef_t chunkPool;
+    le_mem_PoolStats_t stats;
+    le_arena_Ref_t arena;
+    idObj_t* objsPtr[ARENA_NUM_BLOCKS];
+    unsigned int* countsPtr[2];
+    bool ok = true;
+    int i;
+
+    chunkPool = le_mem_CreatePool("Arena Chunks", ARENA_CHUNK_SIZE);
+    le_mem_ExpandPool(chunkPool, ARENA_NUM_CHUNKS);
+
+    arena = le_arena_Create(chunkPool);
+    le_mem_GetStats(chunkPool, &stats);
+    LE_TEST_OK(stats.numBlocksInUse == 1, "Arena takes one chunk");
+
+    // Fill more than one chunk, and check that the blocks don't overlap.
+    for (i = 0; i < ARENA_NUM_BLOCKS; i++)
+    {
+        objsPtr[i] = le_arena_Alloc(arena, sizeof(idObj_t));
+        ok = ok && ((((uintptr_t)objsPtr[i]) % __alignof__(long double)) == 0);
+        objsPtr[i]->id = i;
+    }
+    for (i = 0; i < ARENA_NUM_BLOCKS; i++)
+    {
+        ok = ok && (objsPtr[i]->id == (uint32_t)i);
+    }
+    LE_TEST_OK(ok, "Arena blocks are aligned and distinct");
+
+    le_mem_GetStats(chunkPool, &stats);
+    LE_TEST_OK(stats.numBlocksInUse > 1, "Arena grew to %" PRIuS " chunks", stats.numBlocksInUse);
+
+    LE_TEST_OK(strcmp(le_arena_StrDup(arena, "arena"), "arena") == 0, "Arena string copy");
+    LE_TEST_OK(le_arena_TryAlloc(arena, le_arena_GetMaxAllocSize(arena) + 1) == NULL,
+               "Arena refuses a block bigger than a chunk");
+    LE_TEST_OK(le_arena_Alloc(arena, le_arena_GetMaxAllocSize(arena)) != NULL,
+               "Arena gives a block as big as a chunk");
+
+    // Destructors are called on reset, newest first.
+    for (i = 0; i < 2; i++)
+    {
+        countsPtr[i] = le_arena_Alloc(arena, sizeof(unsigned int));
+        *countsPtr[i] = i + 1;
+        le_arena_AddDestructor(arena, ArenaDestructor, countsPtr[i]);
+    }
+    NumArenaDestructs = 2;
+
+    le_arena_Reset(arena);
+    LE_TEST_OK(NumArenaDestructs == 0, "Arena destructors called on reset");
+    le_mem_GetStats(chunkPool, &stats);
+    LE_TEST_OK(stats.numBlocksInUse == 1, "Arena gives back all chunks but the first on reset");
+
+    // A reset arena can be used again.
+    objsPtr[0] = le_arena_Alloc(arena, sizeof(idObj_t));
+    objsPtr[0]->id = 1;
+    le_arena_AddDestructor(arena, ArenaDestructor, &objsPtr[0]->id);
+    NumArenaDestructs = 1;
+
+    le_arena_Delete(arena);
+    LE_TEST_OK(NumArenaDestructs == 0, "Arena destructors called on delete");
+    le_mem_GetStats(chunkPool, &stats);
+    LE_TEST_OK(stats.numBlocksInUse == 0, "Arena gives back all chunks on delete");
+}
+
+
+#define SIZE_CLASS_POOL_BYTES   1024
+#define SIZE_CLASS_MIN_BYTES    16
+#define SIZE_CLASS_STEP_BYTES   13
+
+static void TestSizeClasses
+(
+    void
+)
+{
+    le_mem_PoolRef_t varPool;
+    le_mem_PoolStats_t stats;
+    void* objsPtr[SIZE_CLASS_POOL_BYTES / SIZE_CLASS_STEP_BYTES + 3];
+    size_t numObjs = 0;
+    size_t size;
+    bool ok = true;
+
+    varPool = le_mem_CreatePool("Size Class Pool", SIZE_CLASS_POOL_BYTES);
+    le_mem_EnableSizeClasses(varPool, SIZE_CLASS_MIN_BYTES);
+
+    // Each allocation comes from a class no more than half again as big as asked for (once past
+    // the smallest class), and the pool's own objects are only used for the biggest sizes.
+    for (size = 1; size <= SIZE_CLASS_POOL_BYTES; size += SIZE_CLASS_STEP_BYTES)
+    {
+        objsPtr[numObjs] = le_mem_ForceVarAlloc(varPool, size);
+        memset(objsPtr[numObjs], 0xa5, size);
+
+        size_t objSize = le_mem_GetBlockSize(objsPtr[numObjs]);
+        ok = ok && (objSize >= size) &&
+             ((size <= SIZE_CLASS_MIN_BYTES) ? (objSize == SIZE_CLASS_MIN_BYTES) :
+                                               (objSize * 2 < size * 3));
+        numObjs++;
+    }
+    LE_TEST_OK(ok, "Variable-size allocations are served from fitting size classes");
+
+    le_mem_GetStats(varPool, &stats);
+    LE_TEST_OK(stats.numBlocksInUse > 0 && stats.numBlocksInUse < numObjs,
+               "Only the biggest allocations use the pool's own objects");
+
+    objsPtr[numObjs] = le_mem_ForceVarAlloc(varPool, 40);
+    LE_TEST_OK(le_mem_GetBlockSize(objsPtr[numObjs]) == 48, "40 bytes come from the 48-byte class");
+    numObjs++;
+
+    // Only the bytes asked for are counted, so the pool can tell how much of its space is wasted.
+    le_mem_ResetStats(varPool);
+    objsPtr[numObjs++] = le_mem_ForceVarAlloc(varPool, SIZE_CLASS_POOL_BYTES - 1);
+    le_mem_GetStats(varPool, &stats);
+    LE_TEST_OK(stats.numAllocs == 1 && stats.numBytesRequested == SIZE_CLASS_POOL_BYTES - 1,
+               "Variable-size allocation counts the bytes requested");
+
+    while (numObjs > 0)
+    {
+        le_mem_Release(objsPtr[--numObjs]);
+    }
+    le_mem_GetStats(varPool, &stats);
+    LE_TEST_OK(stats.numBlocksInUse == 0, "Size class objects released");
+}
+
+
+#define TRIM_POOL_SIZE          256
+#define TRIM_OBJ_BYTES          1024
+#define TRIM_MIN_FREE           16
+
+static void TestTrim
+(
+    void
+)
+{
+    LE_TEST_BEGIN_SKIP(!LE_CONFIG_IS_ENABLED(LE_CONFIG_MEM_TRIM), 5);
+
+    le_mem_PoolRef_t trimPool;
+    le_mem_PoolStats_t stats;
+    void* objsPtr[TRIM_POOL_SIZE];
+    size_t numObjs = 0;
+    size_t i;
+    bool ok = true;
+
+    trimPool = le_mem_CreatePool("Trim Pool", TRIM_OBJ_BYTES);
+    le_mem_ExpandPool(trimPool, TRIM_POOL_SIZE);
+
+    // Touch every block, then free them all.
+    for (i = 0; i < TRIM_POOL_SIZE; i++)
+    {
+        objsPtr[i] = le_mem_AssertAlloc(trimPool);
+        memset(objsPtr[i], 0xa5, TRIM_OBJ_BYTES);
+    }
+    for (i = 0; i < TRIM_POOL_SIZE; i++)
+    {
+        le_mem_Release(objsPtr[i]);
+    }
+
+    le_mem_SetTrimMinimum(trimPool, TRIM_MIN_FREE);
+    LE_TEST_OK(le_mem_Trim() > 0, "Free blocks trimmed");
+
+    le_mem_GetStats(trimPool, &stats);
+    LE_TEST_OK(stats.numFree == TRIM_POOL_SIZE &&
+               stats.numTrimmed > 0 && stats.numTrimmed <= TRIM_POOL_SIZE - TRIM_MIN_FREE,
+               "Trimmed blocks stay in the pool (free %" PRIuS ", trimmed %" PRIuS ")",
+               stats.numFree, stats.numTrimmed);
+
+    // Trimmed blocks are still allocated from the pool, without expanding it.
+    while ((numObjs < TRIM_POOL_SIZE) &&
+           ((objsPtr[numObjs] = le_mem_TryAlloc(trimPool)) != NULL))
+    {
+        memset(objsPtr[numObjs], (int)numObjs, TRIM_OBJ_BYTES);
+        numObjs++;
+    }
+    for (i = 0; i < numObjs; i++)
+    {
+        ok = ok && (((uint8_t*)objsPtr[i])[TRIM_OBJ_BYTES - 1] == (uint8_t)i);
+    }
+    LE_TEST_OK(ok && numObjs == TRIM_POOL_SIZE && le_mem_GetObjectCount(trimPool) == TRIM_POOL_SIZE,
+               "All %" PRIuS " blocks allocated after trimming", numObjs);
+
+    le_mem_GetStats(trimPool, &stats);
+    LE_TEST_OK(stats.numTrimmed == 0, "No blocks left trimmed");
+
+    for (i = 0; i < numObjs; i++)
+    {
+        le_mem_Release(objsPtr[i]);
+    }
+
+    le_mem_SetTrimMinimum(trimPool, SIZE_MAX);
+    le_mem_Trim();
+    le_mem_GetStats(trimPool, &stats);
+    LE_TEST_OK(stats.numTrimmed == 0, "Pool with no trim allowance is left alone");
+
+    LE_TEST_END_SKIP();
+}
+
+
+static void TestAllocSamples
+(
+    void
+)
+{
+    LE_TEST_BEGIN_SKIP(!LE_CONFIG_IS_ENABLED(LE_CONFIG_MEM_POOL_PROFILE), 3);
+#if LE_CONFIG_MEM_POOL_PROFILE
+    le_mem_PoolRef_t sampledPool;
+    le_mem_AllocSample_t samples[LE_CONFIG_MEM_POOL_PROFILE_SAMPLES];
+    void* objPtr;
+    size_t numSamples;
+    size_t i;
+    bool ok = true;
+
+    sampledPool = le_mem_CreatePool("Sampled Pool", sizeof(idObj_t));
+
+    // One allocation in every LE_CONFIG_MEM_POOL_PROFILE_INTERVAL is sampled.
+    for (i = 0; i < 2 * LE_CONFIG_MEM_POOL_PROFILE_INTERVAL; i++)
+    {
+        objPtr = le_mem_ForceAlloc(sampledPool);
+        le_mem_Release(objPtr);
+    }
+
+    numSamples = le_mem_GetAllocSamples(sampledPool, samples, NUM_ARRAY_MEMBERS(samples));
+    LE_TEST_OK(numSamples == 2, "Sampled %" PRIuS " allocations", numSamples);
+
+    for (i = 0; i < numSamples; i++)
+    {
+        ok = ok && (samples[i].callerPtr != NULL) && (samples[i].callerPtr == samples[0].callerPtr);
+        ok = ok && (samples[i].timestamp >= samples[0].timestamp);
+    }
+    LE_TEST_OK(ok, "Samples record the call site and time");
+
+    le_mem_ResetStats(sampledPool);
+    LE_TEST_OK(le_mem_GetAllocSamples(sampledPool, samples, NUM_ARRAY_MEMBERS(samples)) == 0,
+               "Samples cleared with the stats");
+#endif
+    LE_TEST_END_SKIP();
+}
+
 
 COMPONENT_INIT
 {
@@ -620,6 +952,20 @@ COMPONENT_INIT
     LE_TEST_INFO("Testing static pools");
     TestPools(staticIdPool, staticColourPool, staticStringsPool);
 
+    LE_TEST_INFO("Testing per-thread caches");
+    TestThreadCache();
+
+    LE_TEST_INFO("Testing arenas");
+    TestArena();
+
+    LE_TEST_INFO("Testing size classes");
+    TestSizeClasses();
+
+    LE_TEST_INFO("Testing trimming");
+    TestTrim();
+
+    LE_TEST_INFO("Testing allocation sampling");
+    TestAllocSamples();
 
     // FIXME: Find pool by name is currently suffering from issues
     // Failure is tracked by ticket LE-5909
@@ -0,0 +1,271 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Benchmark for pipelined requests on the Low-Level Messaging APIs.
+ *
+ * - Create a server thread and a client in the same process.
+ * - Make the same number of requests synchronously (waiting for each response before making the
+ *   next request), and then pipelined (with up to a window's worth of requests in flight).
+ * - Check that the pipelined responses come back in order, and report the latency and throughput
+ *   of each.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+
+
+#define SERVICE_INSTANCE_NAME "PipelinedBench"
+#define PROTOCOL_ID_STR "PipelinedBenchProtocol"
+
+#define TEST_ITERATIONS 10000
+#define TEST_WINDOW     32
+#define TEST_TIMEOUT    30000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The one message of the protocol.  The server responds to a request with the value plus one.
+ **/
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int32_t value;
+}
+Message_t;
+
+
+// ==================================
+//  SERVER
+// ==================================
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Message receive handler for the service.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ServerRecvHandler
+(
+    le_msg_MessageRef_t msgRef,     ///< Reference to the received message.
+    void*               contextPtr  ///< not used
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Message_t* msgPtr = le_msg_GetPayloadPtr(msgRef);
+
+    msgPtr->value++;
+
+    le_msg_Respond(msgRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function for the server thread.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void* ServerThreadMain
+(
+    void* opaqueContextPtr  ///< not used
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_ProtocolRef_t protocolRef = le_msg_GetProtocolRef(PROTOCOL_ID_STR, sizeof(Message_t));
+    le_msg_ServiceRef_t serviceRef = le_msg_CreateService(protocolRef, SERVICE_INSTANCE_NAME);
+
+    le_msg_SetServiceRecvHandler(serviceRef, ServerRecvHandler, NULL);
+    le_msg_AdvertiseService(serviceRef);
+
+    le_event_RunLoop();
+}
+
+
+// ==================================
+//  CLIENT
+// ==================================
+
+/*
+ * Timer to trigger timeout if the pipelined requests don't all complete.
+ */
+static le_timer_Ref_t TestTimeoutTimerRef;
+
+/*
+ * Progress of the pipelined requests.
+ */
+static int32_t NextExpectedValue;
+static int CompletedCount;
+static int ErrorCount;
+static le_clk_Time_t PipelinedStartTime;
+
+/*
+ * Time taken by the synchronous requests, for comparison.
+ */
+static le_clk_Time_t SyncElapsedTime;
+
+
+static uint64_t ToUsec
+(
+    le_clk_Time_t time
+)
+{
+    return ((uint64_t)time.sec * 1000000) + time.usec;
+}
+
+
+static void ReportRate
+(
+    const char*     nameStr,
+    le_clk_Time_t   elapsed
+)
+{
+    uint64_t usec = ToUsec(elapsed);
+
+    if (usec == 0)
+    {
+        usec = 1;
+    }
+
+    LE_TEST_INFO("%s: %d requests in %"PRIu64" us: %"PRIu64" ns/request, %"PRIu64" requests/s",
+                 nameStr, TEST_ITERATIONS, usec,
+                 (usec * 1000) / TEST_ITERATIONS,
+                 ((uint64_t)TEST_ITERATIONS * 1000000) / usec);
+}
+
+
+static le_msg_MessageRef_t CreateRequest
+(
+    le_msg_SessionRef_t sessionRef,
+    int32_t             value
+)
+{
+    le_msg_MessageRef_t msgRef = le_msg_CreateMsg(sessionRef);
+    Message_t* msgPtr = le_msg_GetPayloadPtr(msgRef);
+
+    msgPtr->value = value;
+
+    return msgRef;
+}
+
+
+static void TestSync
+(
+    le_msg_SessionRef_t sessionRef
+)
+{
+    int i;
+    int errorCount = 0;
+    le_clk_Time_t startTime = le_clk_GetRelativeTime();
+
+    for (i = 0; i < TEST_ITERATIONS; i++)
+    {
+        le_msg_MessageRef_t msgRef = le_msg_RequestSyncResponse(CreateRequest(sessionRef, i));
+
+        if (msgRef == NULL)
+        {
+            LE_TEST_FATAL("Transaction failed!");
+        }
+        if (((Message_t*)le_msg_GetPayloadPtr(msgRef))->value != i + 1)
+        {
+            errorCount++;
+        }
+        le_msg_ReleaseMsg(msgRef);
+    }
+
+    SyncElapsedTime = le_clk_Sub(le_clk_GetRelativeTime(), startTime);
+
+    LE_TEST_OK(errorCount == 0, "synchronous requests returned correct results");
+    ReportRate("sync", SyncElapsedTime);
+}
+
+
+static void PipelinedResponse
+(
+    le_msg_MessageRef_t msgRef,
+    void*               contextPtr
+)
+{
+    // Responses must come back in the order the requests were made.
+    if ((msgRef == NULL) ||
+        (((Message_t*)le_msg_GetPayloadPtr(msgRef))->value != NextExpectedValue + 1) ||
+        (contextPtr != (void*)(intptr_t)NextExpectedValue))
+    {
+        ErrorCount++;
+    }
+    NextExpectedValue++;
+
+    if (msgRef != NULL)
+    {
+        le_msg_ReleaseMsg(msgRef);
+    }
+
+    if (++CompletedCount == TEST_ITERATIONS)
+    {
+        le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), PipelinedStartTime);
+
+        le_timer_Stop(TestTimeoutTimerRef);
+
+        LE_TEST_OK(ErrorCount == 0, "pipelined requests returned correct results in order");
+        ReportRate("pipelined", elapsed);
+        LE_TEST_INFO("pipelined speed-up: %"PRIu64"%%",
+                     (ToUsec(SyncElapsedTime) * 100) / (ToUsec(elapsed) ? ToUsec(elapsed) : 1));
+
+        LE_TEST_EXIT;
+    }
+}
+
+
+static void PipelinedTimeout
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_TEST_FATAL("Timed out with %d of %d pipelined requests complete",
+                  CompletedCount, TEST_ITERATIONS);
+}
+
+
+static void TestPipelined
+(
+    le_msg_SessionRef_t sessionRef
+)
+{
+    int i;
+
+    TestTimeoutTimerRef = le_timer_Create("TestTimeout");
+    le_timer_SetHandler(TestTimeoutTimerRef, PipelinedTimeout);
+    le_timer_SetMsInterval(TestTimeoutTimerRef, TEST_TIMEOUT);
+    le_timer_Start(TestTimeoutTimerRef);
+
+    le_msg_SetSessionRequestWindow(sessionRef, TEST_WINDOW);
+
+    PipelinedStartTime = le_clk_GetRelativeTime();
+
+    // Requests beyond the window are held by the session and sent as responses come back.
+    for (i = 0; i < TEST_ITERATIONS; i++)
+    {
+        le_msg_RequestResponse(CreateRequest(sessionRef, i), PipelinedResponse,
+                               (void*)(intptr_t)i);
+    }
+}
+
+
+// Component initialization function.
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(2);
+    LE_TEST_INFO("Server and Client in same process but different threads - Pipelined");
+
+    le_thread_Start(le_thread_Create("PipelinedServer", ServerThreadMain, NULL));
+
+    le_msg_ProtocolRef_t protocolRef = le_msg_GetProtocolRef(PROTOCOL_ID_STR, sizeof(Message_t));
+    le_msg_SessionRef_t sessionRef = le_msg_CreateSession(protocolRef, SERVICE_INSTANCE_NAME);
+
+    le_msg_OpenSessionSync(sessionRef);
+    LE_TEST_INFO("Connected to server");
+
+    TestSync(sessionRef);
+    TestPipelined(sessionRef);
+
+    // No finish yet -- responses to the pipelined requests are handled by the event loop.
+}
@@ -0,0 +1,209 @@
+/**
+ * This module is for unit testing the le_metrics module in the legato
+ * runtime library (liblegato.so).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+// Symbol and Enum definitions
+//--------------------------------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Number of threads updating the metrics at the same time.
+ */
+// -------------------------------------------------------------------------------------------------
+#define THREAD_COUNT        4
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Number of updates made by each thread.
+ */
+// -------------------------------------------------------------------------------------------------
+#define UPDATE_COUNT        100000
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Number of samples recorded in the histogram (1 to SAMPLE_COUNT).
+ */
+// -------------------------------------------------------------------------------------------------
+#define SAMPLE_COUNT        1000
+
+//--------------------------------------------------------------------------------------------------
+// Static variables
+//--------------------------------------------------------------------------------------------------
+
+static le_metrics_Ref_t CounterRef;
+static le_metrics_Ref_t GaugeRef;
+static le_metrics_Ref_t HistogramRef;
+
+//--------------------------------------------------------------------------------------------------
+// Test functions
+//--------------------------------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Thread that updates the counter and the gauge, leaving the gauge as it found it.
+ */
+// -------------------------------------------------------------------------------------------------
+static void* Updater
+(
+    void* contextPtr
+)
+{
+    int i;
+
+    LE_UNUSED(contextPtr);
+
+    for (i = 0; i < UPDATE_COUNT; i++)
+    {
+        le_metrics_Increment(CounterRef);
+        le_metrics_AddToGauge(GaugeRef, 1);
+    }
+    for (i = 0; i < UPDATE_COUNT; i++)
+    {
+        le_metrics_AddToGauge(GaugeRef, -1);
+    }
+
+    return NULL;
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Count the metrics of the process.
+ */
+// -------------------------------------------------------------------------------------------------
+static void CountMetric
+(
+    le_metrics_Ref_t metricRef,
+    void* contextPtr
+)
+{
+    LE_UNUSED(metricRef);
+
+    (*(int*)contextPtr)++;
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Test updating a counter and a gauge from several threads.
+ */
+// -------------------------------------------------------------------------------------------------
+static void TestCounterAndGauge
+(
+    void
+)
+{
+    le_thread_Ref_t threads[THREAD_COUNT];
+    int i;
+
+    le_metrics_SetGauge(GaugeRef, 10);
+    le_metrics_AddToGauge(GaugeRef, -3);
+    LE_TEST_OK(le_metrics_GetGauge(GaugeRef) == 7, "Gauge can be set and added to");
+
+    for (i = 0; i < THREAD_COUNT; i++)
+    {
+        threads[i] = le_thread_Create("MetricsUpdater", Updater, NULL);
+        le_thread_SetJoinable(threads[i]);
+        le_thread_Start(threads[i]);
+    }
+
+    le_metrics_Add(CounterRef, 5);
+
+    for (i = 0; i < THREAD_COUNT; i++)
+    {
+        void* unused;
+        LE_ASSERT_OK(le_thread_Join(threads[i], &unused));
+    }
+
+    LE_TEST_OK(le_metrics_GetCount(CounterRef) == (THREAD_COUNT * UPDATE_COUNT) + 5,
+               "Counter updated by %d threads holds %" PRIu64,
+               THREAD_COUNT, le_metrics_GetCount(CounterRef));
+    LE_TEST_OK(le_metrics_GetGauge(GaugeRef) == 7,
+               "Gauge updated by %d threads holds %" PRId64,
+               THREAD_COUNT, le_metrics_GetGauge(GaugeRef));
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Test recording samples in a histogram.
+ */
+// -------------------------------------------------------------------------------------------------
+static void TestHistogram
+(
+    void
+)
+{
+    uint64_t value;
+
+    LE_TEST_OK(le_metrics_GetPercentile(HistogramRef, 50) == 0,
+               "Percentile of an empty histogram is 0");
+
+    for (value = 1; value <= SAMPLE_COUNT; value++)
+    {
+        le_metrics_Record(HistogramRef, value);
+    }
+
+    LE_TEST_OK(le_metrics_GetCount(HistogramRef) == SAMPLE_COUNT, "Histogram sample count");
+    LE_TEST_OK(le_metrics_GetSum(HistogramRef) == (SAMPLE_COUNT * (SAMPLE_COUNT + 1)) / 2,
+               "Histogram sample sum");
+
+    uint64_t median = le_metrics_GetPercentile(HistogramRef, 50);
+    LE_TEST_OK((median >= SAMPLE_COUNT / 2) && (median <= (SAMPLE_COUNT / 2) * 5 / 4),
+               "Median %" PRIu64 " within 25%% of %d", median, SAMPLE_COUNT / 2);
+
+    uint64_t p99 = le_metrics_GetPercentile(HistogramRef, 99);
+    LE_TEST_OK((p99 >= 990) && (p99 <= SAMPLE_COUNT),
+               "99th percentile %" PRIu64 " within 25%% of 990", p99);
+
+    LE_TEST_OK(le_metrics_GetPercentile(HistogramRef, 0) == 1, "0th percentile is the smallest");
+    LE_TEST_OK(le_metrics_GetPercentile(HistogramRef, 100) == SAMPLE_COUNT,
+               "100th percentile is the largest");
+}
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Test looking metrics up and deleting them.
+ */
+// -------------------------------------------------------------------------------------------------
+static void TestRegistry
+(
+    void
+)
+{
+    int count = 0;
+
+    LE_TEST_OK((strcmp(le_metrics_GetName(HistogramRef), "test.latency") == 0) &&
+               (le_metrics_GetType(HistogramRef) == LE_METRICS_HISTOGRAM),
+               "Histogram name and type");
+
+    le_metrics_ForEach(CountMetric, &count);
+    LE_TEST_OK(count == 3, "%d metrics found", count);
+
+    le_metrics_Delete(GaugeRef);
+    GaugeRef = NULL;
+
+    count = 0;
+    le_metrics_ForEach(CountMetric, &count);
+    LE_TEST_OK(count == 2, "%d metrics found after deletion", count);
+}
+
+COMPONENT_INIT
+{
+    LE_TEST_INFO("Starting metrics test");
+
+    LE_TEST_PLAN(13);
+
+    CounterRef = le_metrics_CreateCounter("test.requests");
+    GaugeRef = le_metrics_CreateGauge("test.queueDepth");
+    HistogramRef = le_metrics_CreateHistogram("test.latency");
+
+    TestCounterAndGauge();
+    TestHistogram();
+    TestRegistry();
+
+    LE_TEST_EXIT;
+}
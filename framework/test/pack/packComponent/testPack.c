@@ -111,6 +111,61 @@ static void TestString(void)
     CheckString("", 512, 12, true); // Empty
 }
 
+/** Integer arrays **/
+
+// Check that a bulk array pack/unpack function gives the same result as packing each element.
+#define CHECK_INT_ARRAY(type, name, ...)                                                    \
+    do {                                                                                    \
+        const type arrayIn[] = { __VA_ARGS__ };                                             \
+        const size_t count = NUM_ARRAY_MEMBERS(arrayIn);                                    \
+        uint8_t buffer[BUFFER_SZ];                                                          \
+        uint8_t refBuffer[BUFFER_SZ];                                                       \
+        uint8_t* bufferPtr = buffer;                                                        \
+        uint8_t* refBufferPtr = refBuffer;                                                  \
+        type arrayOut[NUM_ARRAY_MEMBERS(arrayIn)];                                          \
+        size_t countOut = 0;                                                                \
+        bool res;                                                                           \
+                                                                                            \
+        ResetBuffer(buffer, sizeof(buffer));                                                \
+        ResetBuffer(refBuffer, sizeof(refBuffer));                                          \
+                                                                                            \
+        res = le_pack_Pack##name##Array(&bufferPtr, arrayIn, count, count);                 \
+        LE_TEST_OK(res == true, "Pack a " #type " array into a buffer");                    \
+        LE_PACK_PACKARRAY(&refBufferPtr, arrayIn, count, count, le_pack_Pack##name, &res);  \
+        LE_TEST_OK((bufferPtr - buffer == refBufferPtr - refBuffer) &&                      \
+                   (0 == memcmp(buffer, refBuffer, sizeof(buffer))),                        \
+                   "Packed " #type " array matches element by element packing");            \
+                                                                                            \
+        bufferPtr = buffer;                                                                 \
+        res = le_pack_Unpack##name##Array(&bufferPtr, arrayOut, &countOut, count);          \
+        LE_TEST_OK(res == true, "Unpack a buffer into a " #type " array");                  \
+        LE_TEST_OK((countOut == count) && (0 == memcmp(arrayIn, arrayOut, sizeof(arrayIn))), \
+                   "Unpacked " #type " array is correct");                                  \
+        LE_TEST_OK(bufferPtr - buffer == refBufferPtr - refBuffer,                          \
+                   "Increment the buffer pointer as appropriate");                          \
+                                                                                            \
+        bufferPtr = buffer;                                                                 \
+        res = le_pack_Pack##name##Array(&bufferPtr, arrayIn, count, count - 1);             \
+        LE_TEST_OK(res == false, "Pack a " #type " array too big for its maximum");         \
+        bufferPtr = refBuffer;                                                              \
+        res = le_pack_Unpack##name##Array(&bufferPtr, arrayOut, &countOut, count - 1);      \
+        LE_TEST_OK(res == false, "Unpack a " #type " array too big for its maximum");       \
+    } while (0)
+
+static void TestIntArrays(void)
+{
+    LE_TEST_INFO("=> Testing packing/unpacking integer arrays\n");
+
+    CHECK_INT_ARRAY(uint8_t, Uint8, 0x00, 0xAB, 0xFF);
+    CHECK_INT_ARRAY(uint16_t, Uint16, 0x0000, 0x1234, 0xFFFF);
+    CHECK_INT_ARRAY(uint32_t, Uint32, 0x00000000, 0x12345678, 0xFFFFFFFF, 42);
+    CHECK_INT_ARRAY(uint64_t, Uint64, 0, 0x123456789ABCDEF0, UINT64_MAX);
+    CHECK_INT_ARRAY(int8_t, Int8, INT8_MIN, -1, 0, INT8_MAX);
+    CHECK_INT_ARRAY(int16_t, Int16, INT16_MIN, -1, 0, INT16_MAX);
+    CHECK_INT_ARRAY(int32_t, Int32, INT32_MIN, -1, 0, INT32_MAX);
+    CHECK_INT_ARRAY(int64_t, Int64, INT64_MIN, -1, 0, INT64_MAX);
+}
+
 COMPONENT_INIT
 {
     LE_TEST_INIT;
@@ -118,6 +173,7 @@ COMPONENT_INIT
 
     TestUint8();
     TestString();
+    TestIntArrays();
 
     LE_TEST_INFO("======== le_pack Test Complete ========\n");
     LE_TEST_EXIT;
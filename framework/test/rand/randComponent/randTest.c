@@ -244,13 +244,21 @@ static void TestLargeRange(void)
     TestRange(9, 10000008, 40000000);
 }
 
-static void TestBuffer(void)
+static void TestBuffer(bool fromPlatform)
 {
-    LE_TEST_INFO("Test buffer (%" PRIuS ")", sizeof(SampleBuffer));
+    LE_TEST_INFO("Test %s buffer (%" PRIuS ")",
+                 fromPlatform ? "entropy" : "generator", sizeof(SampleBuffer));
     memset(SampleBuffer, 0, sizeof(SampleBuffer));
 
     // Collect samples
-    le_rand_GetBuffer(SampleBuffer, sizeof(SampleBuffer));
+    if (fromPlatform)
+    {
+        le_rand_GetEntropy(SampleBuffer, sizeof(SampleBuffer));
+    }
+    else
+    {
+        le_rand_GetBuffer(SampleBuffer, sizeof(SampleBuffer));
+    }
 
     const uint32_t numBuckets = 256 >> 2;
     uint64_t buckets[numBuckets];
@@ -271,15 +279,58 @@ static void TestBuffer(void)
     Chi2Test(buckets, numBuckets, BUF_SAMPLES);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that a child process doesn't get the same random numbers as its parent.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestFork(void)
+{
+    LE_TEST_BEGIN_SKIP(!LE_CONFIG_IS_ENABLED(LE_CONFIG_LINUX), 3);
+#if LE_CONFIG_LINUX
+    uint8_t parentBytes[16];
+    uint8_t childBytes[16];
+    int fds[2];
+
+    // Make sure the parent's generator is seeded and has data left in its buffer.
+    le_rand_GetBuffer(parentBytes, 1);
+
+    LE_TEST_ASSERT(pipe(fds) == 0, "create pipe");
+
+    pid_t pid = fork();
+    LE_TEST_ASSERT(pid >= 0, "fork");
+
+    if (pid == 0)
+    {
+        le_rand_GetBuffer(childBytes, sizeof(childBytes));
+        _exit(write(fds[1], childBytes, sizeof(childBytes)) == sizeof(childBytes) ? 0 : 1);
+    }
+
+    le_rand_GetBuffer(parentBytes, sizeof(parentBytes));
+
+    ssize_t count = read(fds[0], childBytes, sizeof(childBytes));
+    waitpid(pid, NULL, 0);
+    close(fds[0]);
+    close(fds[1]);
+
+    LE_TEST_OK((count == sizeof(childBytes)) &&
+               (memcmp(parentBytes, childBytes, sizeof(childBytes)) != 0),
+               "parent and child get different random numbers");
+#endif
+    LE_TEST_END_SKIP();
+}
+
 COMPONENT_INIT
 {
-    LE_TEST_PLAN(6);
+    LE_TEST_PLAN(10);
 
     LE_TEST_INFO("======== Begin Random Number Tests ========");
 
-    TestBuffer();
+    TestBuffer(false);
+    TestBuffer(true);
     TestSmallRange();
     TestLargeRange();
+    TestFork();
 
     LE_TEST_INFO("======== Completed Random Number Tests (Passed) ========");
 
@@ -18,6 +18,7 @@
 #include "externalThreadApi.h"
 #include "priority.h"
 #include "staticThread.h"
+#include "threadPool.h"
 
 const char TestNameStr[] = "Thread Test";
 
@@ -39,6 +40,7 @@ static void FinishTest
     fjm_CheckResults();
     eta_CheckResults();
     prio_CheckResults();
+    pool_CheckResults();
 
     LE_TEST_BEGIN_SKIP(!LE_CONFIG_IS_ENABLED(LE_CONFIG_STATIC_THREAD_STACKS), 2);
     static_CheckResults();
@@ -59,6 +61,7 @@ COMPONENT_INIT
     eta_Start();
     fjm_Start();
     prio_Start();
+    pool_Start();
 
     LE_TEST_BEGIN_SKIP(!LE_CONFIG_IS_ENABLED(LE_CONFIG_STATIC_THREAD_STACKS), 4);
     static_Start();
@@ -0,0 +1,206 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Implementation of the thread pool test.
+ *
+ * A client thread submits jobs to a pool of workers.  Each of them submits more jobs from inside
+ * the pool, which land on the worker's own list and are stolen by the other workers.  The client
+ * counts the completions it gets through its event loop, then deletes the pool, which must run
+ * every job that is still queued.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ **/
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "threadPool.h"
+
+/// Number of workers in the pool.
+#define NB_WORKERS      4
+
+/// Number of jobs submitted by the client thread.
+#ifdef LE_CONFIG_REDUCE_FOOTPRINT
+#   define NB_JOBS      16
+#else
+#   define NB_JOBS      64
+#endif
+
+/// Number of jobs submitted by each of the client's jobs.
+#define NB_CHILD_JOBS   4
+
+/// Time to wait for the test to finish.
+#define TIMEOUT_SECS    30
+
+/// The pool under test.
+static le_threadPool_Ref_t PoolRef;
+
+/// Posted by the client thread when it is done.
+static le_sem_Ref_t DoneSem;
+
+/// Number of jobs that have run (atomic).
+static size_t JobCount;
+
+/// Number of completions seen by the client thread.
+static size_t CompletionCount;
+
+/// Number of completions seen by the client thread with the wrong result or in the wrong thread.
+static size_t BadCompletionCount;
+
+/// The client thread.
+static le_thread_Ref_t ClientThread;
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Job submitted from inside the pool.
+ *
+ * @return NULL.
+ */
+// -------------------------------------------------------------------------------------------------
+static void* ChildJob
+(
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    LE_ATOMIC_ADD_FETCH(&JobCount, 1, LE_ATOMIC_ORDER_RELAXED);
+    return NULL;
+}
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Job submitted by the client thread.
+ *
+ * @return The context pointer, as the job's result.
+ */
+// -------------------------------------------------------------------------------------------------
+static void* ParentJob
+(
+    void* contextPtr
+)
+{
+    int i;
+
+    for (i = 0; i < NB_CHILD_JOBS; i++)
+    {
+        le_threadPool_Submit(PoolRef, ChildJob, NULL, NULL);
+    }
+
+    LE_ATOMIC_ADD_FETCH(&JobCount, 1, LE_ATOMIC_ORDER_RELAXED);
+    return contextPtr;
+}
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Called by the client thread when one of its jobs is done.  Deletes the pool after the last one.
+ */
+// -------------------------------------------------------------------------------------------------
+static void ParentDone
+(
+    void* resultPtr,
+    void* contextPtr
+)
+{
+    if ((resultPtr != contextPtr) || (le_thread_GetCurrent() != ClientThread))
+    {
+        BadCompletionCount++;
+    }
+
+    if (++CompletionCount == NB_JOBS)
+    {
+        // Child jobs may still be queued; deleting the pool runs them.
+        le_threadPool_Delete(PoolRef);
+        PoolRef = NULL;
+        le_sem_Post(DoneSem);
+    }
+}
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Client thread main function.
+ *
+ * @return NULL.
+ */
+// -------------------------------------------------------------------------------------------------
+static void* ClientMain
+(
+    void* contextPtr
+)
+{
+    le_result_t result;
+    uintptr_t i;
+
+    LE_UNUSED(contextPtr);
+
+    PoolRef = le_threadPool_Create("testPool", NB_WORKERS);
+
+    result = le_threadPool_SetCpuAffinity(PoolRef, NB_WORKERS, 0x1);
+    LE_TEST_OK((result == LE_OUT_OF_RANGE) || (result == LE_UNSUPPORTED),
+               "Pin a worker that doesn't exist (%s)", LE_RESULT_TXT(result));
+    result = le_threadPool_SetCpuAffinity(PoolRef, 0, 0x1);
+    LE_TEST_OK((result == LE_OK) || (result == LE_UNSUPPORTED),
+               "Pin the first worker to CPU 0 (%s)", LE_RESULT_TXT(result));
+
+    // Submit half of the jobs before starting the workers, and half after.
+    for (i = 0; i < NB_JOBS / 2; i++)
+    {
+        le_threadPool_Submit(PoolRef, ParentJob, (void*)(i + 1), ParentDone);
+    }
+    le_threadPool_Start(PoolRef);
+
+    result = le_threadPool_SetCpuAffinity(PoolRef, 0, 0x1);
+    LE_TEST_OK((result == LE_NOT_PERMITTED) || (result == LE_UNSUPPORTED),
+               "Pin a worker of a started pool (%s)", LE_RESULT_TXT(result));
+
+    for (; i < NB_JOBS; i++)
+    {
+        le_threadPool_Submit(PoolRef, ParentJob, (void*)(i + 1), ParentDone);
+    }
+
+    le_event_RunLoop();
+}
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Starts the test.
+ */
+// -------------------------------------------------------------------------------------------------
+void pool_Start
+(
+    void
+)
+{
+    DoneSem = le_sem_Create("PoolTestDone", 0);
+
+    ClientThread = le_thread_Create("PoolClient", ClientMain, NULL);
+    le_thread_Start(ClientThread);
+}
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Checks the completion status of the test.
+ */
+// -------------------------------------------------------------------------------------------------
+void pool_CheckResults
+(
+    void
+)
+{
+    le_clk_Time_t timeout = { .sec = TIMEOUT_SECS, .usec = 0 };
+
+    LE_TEST_OK(le_sem_WaitWithTimeOut(DoneSem, timeout) == LE_OK, "Thread pool test finished");
+    LE_TEST_OK(CompletionCount == NB_JOBS, "All completions called (%" PRIuS ")",
+               CompletionCount);
+    LE_TEST_OK(BadCompletionCount == 0, "Completions called in the submitting thread");
+    LE_TEST_OK(LE_ATOMIC_LOAD(&JobCount, LE_ATOMIC_ORDER_ACQUIRE) ==
+               NB_JOBS * (1 + NB_CHILD_JOBS),
+               "All jobs run (%" PRIuS ")", LE_ATOMIC_LOAD(&JobCount, LE_ATOMIC_ORDER_ACQUIRE));
+
+    le_thread_Cancel(ClientThread);
+    le_sem_Delete(DoneSem);
+}
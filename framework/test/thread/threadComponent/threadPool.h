@@ -0,0 +1,32 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header file for thread pool tests.  These functions are called by the main module (main.c).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ **/
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LE_THREAD_POOL_TEST_H_INCLUSION_GUARD
+#define LE_THREAD_POOL_TEST_H_INCLUSION_GUARD
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Starts the test.
+ */
+// -------------------------------------------------------------------------------------------------
+void pool_Start
+(
+    void
+);
+
+// -------------------------------------------------------------------------------------------------
+/**
+ * Checks the completion status of the test.
+ */
+// -------------------------------------------------------------------------------------------------
+void pool_CheckResults
+(
+    void
+);
+
+#endif // LE_THREAD_POOL_TEST_H_INCLUSION_GUARD
@@ -16,7 +16,7 @@
 
 // One test per timer, plus some additional tests after
 #define TESTS_PER_TIMER 1
-#define ADDITIONAL_TEST_COUNT 18
+#define ADDITIONAL_TEST_COUNT 23
 
 // Format and log time values
 #define LOG_TIME_MSG(msg, tm) \
@@ -115,6 +115,88 @@ static void ShortTimerExpiryHandler
 }
 
 
+// Time at which the slack tests were started.
+static le_clk_Time_t SlackStartTime;
+
+// Time at which the timer with slack expired.
+static le_clk_Time_t SlackExpiryTime;
+
+static void SlackTimerExpiryHandler
+(
+    le_timer_Ref_t timerRef    ///< This timer has expired
+)
+{
+    LE_UNUSED(timerRef);
+
+    SlackExpiryTime = le_clk_Sub(le_clk_GetRelativeTime(), SlackStartTime);
+}
+
+
+static void StrictTimerExpiryHandler
+(
+    le_timer_Ref_t timerRef    ///< This timer has expired
+)
+{
+    // The timer with slack is due at 200 ms, but may be up to 1 s late, so it should have been
+    // batched with this timer, which is due at 800 ms and has no slack.
+    le_clk_Time_t expectedInterval = { 0, 800*ONE_MSEC };
+    le_clk_Time_t latestSlackInterval = { 1, 200*ONE_MSEC };
+    le_clk_Time_t diffTime = le_clk_Sub(le_clk_GetRelativeTime(), SlackStartTime);
+    le_clk_Time_t subTime = le_clk_Sub(diffTime, expectedInterval);
+    bool testFailed = le_clk_GreaterThan(subTime, TimerTolerance);
+
+    LE_TEST_OK(!testFailed, "timer without slack accuracy within tolerance");
+    if ( testFailed )
+    {
+        LOG_TIME_MSG("Expected Duration", expectedInterval);
+        LOG_TIME_MSG("Actual Duration", diffTime);
+        LOG_TIME_MSG("Difference", subTime);
+    }
+
+    LE_TEST_OK(!le_clk_GreaterThan(expectedInterval, SlackExpiryTime),
+               "timer with slack was batched with the later timer");
+    LE_TEST_OK(!le_clk_GreaterThan(SlackExpiryTime,
+                                   le_clk_Add(latestSlackInterval, TimerTolerance)),
+               "timer with slack expired within its slack");
+    LOG_TIME_MSG("Slack timer expiry", SlackExpiryTime);
+
+    le_timer_Delete(le_timer_GetContextPtr(timerRef));
+    le_timer_Delete(timerRef);
+
+    // All tests are now done, so exit
+    LE_TEST_INFO("Tests ended");
+    LE_TEST_EXIT;
+}
+
+
+static void SlackTests
+(
+    void
+)
+{
+    le_timer_Ref_t slackTimer;
+    le_timer_Ref_t strictTimer;
+
+    LE_TEST_INFO("\n ==================== Slack Tests =================");
+
+    slackTimer = le_timer_Create("slack timer");
+    le_timer_SetHandler(slackTimer, SlackTimerExpiryHandler);
+    le_timer_SetMsInterval(slackTimer, 200);
+    LE_TEST_OK(le_timer_SetMsSlack(slackTimer, 1000) == LE_OK, "set slack on stopped timer");
+
+    strictTimer = le_timer_Create("strict timer");
+    le_timer_SetHandler(strictTimer, StrictTimerExpiryHandler);
+    le_timer_SetMsInterval(strictTimer, 800);
+    le_timer_SetContextPtr(strictTimer, slackTimer);
+
+    SlackStartTime = le_clk_GetRelativeTime();
+    le_timer_Start(slackTimer);
+    le_timer_Start(strictTimer);
+
+    LE_TEST_OK(le_timer_SetMsSlack(slackTimer, 0) == LE_BUSY, "set slack on running timer");
+}
+
+
 static void LongTimerExpiryHandler
 (
     le_timer_Ref_t timerRef    ///< This timer has expired
@@ -151,9 +233,7 @@ static void LongTimerExpiryHandler
     LE_TEST_OK(expiryCount == 1, "Medium timer expired once (expired %"PRIu32" times)",
                expiryCount);
 
-    // All tests are now done, so exit
-    LE_TEST_INFO("Tests ended");
-    LE_TEST_EXIT;
+    SlackTests();
 }
 
 static void VeryShortTimerExpiryHandler
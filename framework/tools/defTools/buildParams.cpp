@@ -32,9 +32,14 @@ BuildParams_t::BuildParams_t
     isStandAloneComp(false),
     binPack(false),
     noPie(false),
+    fastLoad(false),
+    staticExes(false),
+    binaryConfig(false),
     isDryRun(false),
     argc(0),
     argv(NULL),
+    unityBuild(false),
+    precompileHeaders(false),
     readOnly(false)
 //--------------------------------------------------------------------------------------------------
 {
@@ -61,6 +66,16 @@ void BuildParams_t::FinishConfig
     }
     envVars::Load(envFilePath, *this);
 
+    if (envVars::GetConfigBool("LE_CONFIG_LINK_FAST_LOAD"))
+    {
+        fastLoad = true;
+    }
+
+    if (envVars::GetConfigBool("LE_CONFIG_LINK_STATIC_EXES"))
+    {
+        staticExes = true;
+    }
+
     interfaceDirs.push_front(path::Combine(frameworkRootPath,
                                           "build/" + target + "/framework/include"));
     interfaceDirs.push_front(path::Combine(frameworkRootPath, "framework/include"));
@@ -48,6 +48,11 @@ struct BuildParams_t
     bool                    isStandAloneComp;   ///< true = generate stand-alone component
     bool                    binPack;            ///< true = generate a binary package for redist.
     bool                    noPie;              ///< true = generate executable without pie.
+    bool                    fastLoad;           ///< true = link for faster dynamic loading.
+    bool                    staticExes;         ///< true = link executables statically with their
+                                                ///  components and liblegato, using LTO.
+    bool                    binaryConfig;       ///< true = generate the system's configuration
+                                                ///  files as Config Tree images.
     bool                    isDryRun;           ///< true = test process before real execution
     int                     argc;               ///< Number of arguments (argc to main)
     const char**            argv;               ///< Argument list (argv to main)
@@ -66,6 +71,10 @@ struct BuildParams_t
     std::string             objcopyPath;        ///< Object file copier (needed for -d option)
     std::string             readelfPath;        ///< ELF file reader (needed for -d option)
     std::string             compilerCachePath;  ///< Compiler cache (ccache, sccache, ...)
+    std::string             ifgenCacheDir;      ///< Directory caching ifgen's output ("" = none)
+    bool                    unityBuild;         ///< true = compile each component's C sources
+                                                ///< (and C++ sources) as one unit
+    bool                    precompileHeaders;  ///< true = precompile legato.h for components
     std::list<std::string>  crossToolPaths;     ///< Tool chain executable paths
     bool                    readOnly;           ///< true = only read. Required by tools such as
                                                 ///< mkedit, mkparse
@@ -438,7 +438,8 @@ ApiClientInterface_t::ApiClientInterface_t
 //--------------------------------------------------------------------------------------------------
 :   ApiRef_t(itemPtr, aPtr, cPtr, iName),
     manualStart(false),
-    optional(false)
+    optional(false),
+    pipelined(false)
 //--------------------------------------------------------------------------------------------------
 {
 }
@@ -523,7 +524,8 @@ ApiServerInterface_t::ApiServerInterface_t
 :   ApiRef_t(itemPtr, aPtr, cPtr, iName),
     async(isAsync),
     manualStart(false),
-    direct(false)
+    direct(false),
+    parallel(false)
 //--------------------------------------------------------------------------------------------------
 {
 }
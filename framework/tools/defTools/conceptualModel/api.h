@@ -176,6 +176,7 @@ struct ApiClientInterface_t : public ApiRef_t
 {
     bool manualStart;   ///< true = generated main() should not call the ConnectService() function.
     bool optional;      ///< true = okay to not be bound.
+    bool pipelined;     ///< true = generate asynchronous (pipelined) versions of the functions.
 
     ApiClientInterface_t(const parseTree::TokenList_t* itemPtr,
                          ApiFile_t* aPtr, Component_t* cPtr, const std::string& iName);
@@ -197,6 +198,7 @@ struct ApiServerInterface_t : public ApiRef_t
     bool manualStart;   ///< true = generated main() should not call AdvertiseService() function.
     bool direct;       ///< true = API can be called directly from other components within
                        ///<        the same process.
+    bool parallel;     ///< true = requests are handled by a pool of worker threads.
 
     ApiServerInterface_t(const parseTree::TokenList_t* itemPtr,
                          ApiFile_t* aPtr, Component_t* cPtr, const std::string& iName, bool async);
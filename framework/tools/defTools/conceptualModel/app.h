@@ -58,6 +58,9 @@ struct App_t : public HasTargetInfo_t
 
     std::string preloadedMd5; ///< MD5 hash of preloaded app (empty if not specified).
 
+    std::string taskGroup;  ///< On RTOS, name of the task the app's processes share with those of
+                            ///< the other apps in the same task group ("" if not in a group).
+
     std::set<Component_t*> components;  ///< Set of components used in this app.
 
     std::map<std::string, Exe_t*> executables;  ///< Collection of executables defined in this app.
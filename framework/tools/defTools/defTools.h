@@ -16,6 +16,7 @@
 #define LEGATO_DEFTOOLS_H_INCLUDE_GUARD
 
 #include <algorithm>
+#include <condition_variable>
 #include <fstream>
 #include <functional>
 #include <iostream>
@@ -24,11 +25,13 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <typeindex>
 #include <unordered_set>
 #include <unordered_map>
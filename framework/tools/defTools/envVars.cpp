@@ -21,6 +21,53 @@ extern char**environ;
 namespace envVars
 {
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Private set of environment variables used by the calling thread instead of the process'
+ * environment, or NULL if the thread uses the process' environment.  See UsePrivate().
+ */
+//--------------------------------------------------------------------------------------------------
+static thread_local Environment_t* PrivateEnvPtr = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Names of the variables read from the calling thread's private environment, or NULL if not
+ * recorded.  See UsePrivate().
+ */
+//--------------------------------------------------------------------------------------------------
+static thread_local std::set<std::string>* ReadVarsPtr = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up an environment variable in the calling thread's environment.
+ *
+ * @return  The value, or NULL if not found.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* Lookup
+(
+    const std::string& name  ///< The name of the environment variable.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (PrivateEnvPtr != NULL)
+    {
+        if (ReadVarsPtr != NULL)
+        {
+            ReadVarsPtr->insert(name);
+        }
+
+        auto i = PrivateEnvPtr->find(name);
+
+        return (i == PrivateEnvPtr->end() ? nullptr : i->second.c_str());
+    }
+
+    return getenv(name.c_str());
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetch the value of a given optional environment variable.
@@ -34,7 +81,7 @@ std::string Get
 )
 //--------------------------------------------------------------------------------------------------
 {
-    const char* value = getenv(name.c_str());
+    const char* value = Lookup(name);
 
     if (value == nullptr)
     {
@@ -57,7 +104,7 @@ bool GetConfigBool
     const std::string &name  ///< The name of the environment variable.
 )
 {
-    const char *value = getenv(name.c_str());
+    const char *value = Lookup(name);
     if (value == nullptr)
     {
         return false;
@@ -80,7 +127,7 @@ std::string GetRequired
 )
 //--------------------------------------------------------------------------------------------------
 {
-    const char* value = getenv(name.c_str());
+    const char* value = Lookup(name);
 
     if (value == nullptr)
     {
@@ -106,7 +153,11 @@ void Set
 )
 //--------------------------------------------------------------------------------------------------
 {
-    if (setenv(name.c_str(), value.c_str(), true /* overwrite existing */) != 0)
+    if (PrivateEnvPtr != NULL)
+    {
+        (*PrivateEnvPtr)[name] = value;
+    }
+    else if (setenv(name.c_str(), value.c_str(), true /* overwrite existing */) != 0)
     {
         throw mk::Exception_t(
             mk::format(LE_I18N("Failed to set environment variable '%s' to '%s'."), name, value)
@@ -126,7 +177,11 @@ void Unset
 )
 //--------------------------------------------------------------------------------------------------
 {
-    if (unsetenv(name.c_str()) != 0)
+    if (PrivateEnvPtr != NULL)
+    {
+        PrivateEnvPtr->erase(name);
+    }
+    else if (unsetenv(name.c_str()) != 0)
     {
         throw mk::Exception_t(
             mk::format(LE_I18N("Failed to unset environment variable '%s'."), name)
@@ -491,6 +546,21 @@ void Iterate
 )
 //--------------------------------------------------------------------------------------------------
 {
+    if (PrivateEnvPtr != NULL)
+    {
+        for (const auto& var : *PrivateEnvPtr)
+        {
+            if (ReadVarsPtr != NULL)
+            {
+                ReadVarsPtr->insert(var.first);
+            }
+
+            callback(var.first, var.second);
+        }
+
+        return;
+    }
+
     for (int i = 0; environ[i] != NULL; i++)
     {
         const auto next = std::string(environ[i]);
@@ -503,6 +573,49 @@ void Iterate
     }
 }
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take a copy of the calling thread's environment variables.
+ *
+ * @return  The environment variables.
+ */
+//--------------------------------------------------------------------------------------------------
+Environment_t Copy
+(
+)
+//--------------------------------------------------------------------------------------------------
+{
+    Environment_t env;
+
+    Iterate([&env](const std::string& name, const std::string& value)
+            {
+                env[name] = value;
+            });
+
+    return env;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make the calling thread use a private set of environment variables instead of the process'
+ * environment.
+ */
+//--------------------------------------------------------------------------------------------------
+void UsePrivate
+(
+    Environment_t* envPtr,              ///< Set of environment variables to use, or NULL
+                                        ///< to go back to the process' environment.
+    std::set<std::string>* readVarsPtr  ///< If not NULL, records the names of the
+                                        ///< variables read from the private set.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    PrivateEnvPtr = envPtr;
+    ReadVarsPtr = (envPtr == NULL ? NULL : readVarsPtr);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Load environment variables from a file into the current process' environment.  The environment
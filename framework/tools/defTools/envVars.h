@@ -15,6 +15,14 @@ namespace envVars
 {
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * A copy of a set of environment variables, mapping names to values.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef std::map<std::string, std::string> Environment_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetch the value of a given optional environment variable.
@@ -145,6 +153,36 @@ void Iterate
     const std::function<void(const std::string&, const std::string&)>& callback
 );
 
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take a copy of the calling thread's environment variables.
+ *
+ * @return  The environment variables.
+ */
+//--------------------------------------------------------------------------------------------------
+Environment_t Copy
+(
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make the calling thread use a private set of environment variables instead of the process'
+ * environment.  Get(), Set(), Unset() and Iterate() called from this thread then only read or
+ * modify that set, so a worker thread can substitute variables (including the CURDIR it sets
+ * while doing so) without racing with the main thread.  The names of the variables read can be
+ * recorded, to tell whether the result of the work depends on variables that have changed since.
+ */
+//--------------------------------------------------------------------------------------------------
+void UsePrivate
+(
+    Environment_t* envPtr,                      ///< Set of environment variables to use, or NULL
+                                                ///< to go back to the process' environment.
+    std::set<std::string>* readVarsPtr = NULL   ///< If not NULL, records the names of the
+                                                ///< variables read from the private set.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Load environment variables from a file into the current process' environment.  The environment
@@ -483,4 +483,110 @@ void RemoveFile
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether two files have the same content.
+ *
+ * @return true if both files can be read and are identical.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool FilesAreIdentical
+(
+    const std::string& path1,
+    const std::string& path2
+)
+{
+    std::ifstream stream1(path1, std::ifstream::binary);
+    std::ifstream stream2(path2, std::ifstream::binary);
+
+    if (!stream1.is_open() || !stream2.is_open())
+    {
+        return false;
+    }
+
+    std::stringstream content1;
+    std::stringstream content2;
+    content1 << stream1.rdbuf();
+    content2 << stream2.rdbuf();
+
+    return (content1.str() == content2.str());
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open a generated file stream.  The content goes to a temporary file until Commit() is called.
+ *
+ * @throw mk::Exception_t if the temporary file can't be opened.
+ */
+//--------------------------------------------------------------------------------------------------
+GeneratedFileStream_t::GeneratedFileStream_t
+(
+    const std::string& filePath
+)
+:   filePath(filePath),
+    tempFilePath(filePath + ".tmp"),
+    isCommitted(false)
+{
+    open(tempFilePath, std::ofstream::trunc);
+
+    if (!is_open())
+    {
+        throw mk::Exception_t(
+            mk::format(LE_I18N("Failed to open file '%s' for writing."), tempFilePath)
+        );
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close a generated file stream, discarding its content if it wasn't committed.
+ */
+//--------------------------------------------------------------------------------------------------
+GeneratedFileStream_t::~GeneratedFileStream_t
+(
+)
+{
+    if (!isCommitted)
+    {
+        close();
+        unlink(tempFilePath.c_str());
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close the stream and replace the generated file with the new content, unless it is unchanged.
+ *
+ * @throw mk::Exception_t if the content couldn't be written or the file couldn't be replaced.
+ */
+//--------------------------------------------------------------------------------------------------
+void GeneratedFileStream_t::Commit
+(
+)
+{
+    close();
+    isCommitted = true;
+
+    if (fail())
+    {
+        unlink(tempFilePath.c_str());
+        throw mk::Exception_t(
+            mk::format(LE_I18N("Failed to write file '%s'."), tempFilePath)
+        );
+    }
+
+    if (FilesAreIdentical(tempFilePath, filePath))
+    {
+        unlink(tempFilePath.c_str());
+    }
+    else
+    {
+        RenameFile(tempFilePath, filePath);
+    }
+}
+
+
 } // namespace file
@@ -198,6 +198,36 @@ void RemoveFile
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Output stream for a generated file that is only replaced if its content has changed.
+ *
+ * The content is written to a temporary file next to the target file.  Commit() then compares it
+ * with the target file: if they are identical, the temporary file is deleted and the target file
+ * keeps its modification time, so the build doesn't redo what depends on it.  Otherwise the
+ * temporary file is renamed over the target file.
+ *
+ * If the stream is destroyed without being committed (e.g., because an exception was thrown
+ * while generating the content), the temporary file is deleted and the target file is untouched.
+ */
+//--------------------------------------------------------------------------------------------------
+class GeneratedFileStream_t : public std::ofstream
+{
+    public:
+
+        GeneratedFileStream_t(const std::string& filePath);
+        ~GeneratedFileStream_t();
+
+        void Commit();
+
+    private:
+
+        std::string filePath;       ///< Path of the file to generate.
+        std::string tempFilePath;   ///< Path of the temporary file being written.
+        bool isCommitted;           ///< true once Commit() has been called.
+};
+
+
 } // namespace file
 
 #endif // LEGATO_DEFTOOLS_FILE_H_INCLUDE_GUARD
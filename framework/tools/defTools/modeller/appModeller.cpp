@@ -2021,6 +2021,50 @@ void GetKModuleFromExecs
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start parsing in the background the .cdef files of the components listed in an .adef file's
+ * "components:" and "executables:" sections.
+ *
+ * @return The prefetcher, to be kept until the components have been modelled.
+ */
+//--------------------------------------------------------------------------------------------------
+static std::unique_ptr<parser::Prefetcher_t> PrefetchAppComponents
+(
+    model::App_t* appPtr,
+    const parseTree::AdefFile_t* adefFilePtr,
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::list<const parseTree::Token_t*> tokens;
+
+    for (auto sectionPtr : adefFilePtr->sections)
+    {
+        auto& sectionName = sectionPtr->firstTokenPtr->text;
+
+        if (sectionName == "components")
+        {
+            for (auto tokenPtr : ToTokenListSectionPtr(sectionPtr)->Contents())
+            {
+                tokens.push_back(tokenPtr);
+            }
+        }
+        else if (sectionName == "executables")
+        {
+            // In the order AddExecutables() models them.
+            for (auto itemPtr : ToCompoundItemListPtr(sectionPtr)->Contents())
+            {
+                auto& contents = ToTokenListPtr(itemPtr)->Contents();
+                tokens.insert(tokens.end(), contents.rbegin(), contents.rend());
+            }
+        }
+    }
+
+    return PrefetchComponents(tokens, buildParams, { appPtr->dir });
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get a conceptual model for a single application whose .adef file can be found at a given path.
@@ -2064,6 +2108,9 @@ model::App_t* GetApp
     // Set BUILDDIR environment variable for this app
     SetAppBuildDirEnvVar(appPtr, buildParams);
 
+    // Start parsing the .cdef files of the app's components in the background.
+    auto prefetcherPtr = PrefetchAppComponents(appPtr, adefFilePtr, buildParams);
+
     // Iterate over the .adef file's list of sections, processing content items.
     for (auto sectionPtr : adefFilePtr->sections)
     {
@@ -526,6 +526,7 @@ static void GetProvidedApi
     bool async = false;
     bool manualStart = false;
     bool direct = false;
+    bool parallel = false;
     for (auto contentPtr : contentList)
     {
         if (contentPtr->type == parseTree::Token_t::SERVER_IPC_OPTION)
@@ -542,6 +543,10 @@ static void GetProvidedApi
             {
                 direct = true;
             }
+            else if (contentPtr->text == "[parallel]")
+            {
+                parallel = true;
+            }
         }
     }
 
@@ -573,6 +578,7 @@ static void GetProvidedApi
                                                  async);
     ifPtr->manualStart = manualStart;
     ifPtr->direct = direct;
+    ifPtr->parallel = parallel;
 
     componentPtr->serverApis.push_back(ifPtr);
 
@@ -777,6 +783,7 @@ static void GetRequiredApi
     bool typesOnly = false;
     bool manualStart = false;
     bool optional = false;
+    bool pipelined = false;
     for (auto contentPtr : contentList)
     {
         if (contentPtr->type == parseTree::Token_t::CLIENT_IPC_OPTION)
@@ -794,6 +801,10 @@ static void GetRequiredApi
                 manualStart = true; // [optional] implies [manual-start].
                 optional = true;
             }
+            else if (contentPtr->text == "[pipelined]")
+            {
+                pipelined = true;
+            }
         }
     }
     if (typesOnly && manualStart)
@@ -801,6 +812,11 @@ static void GetRequiredApi
         itemPtr->ThrowException(LE_I18N("Can't use [types-only] with [manual-start] or [optional]"
                                   " for the same interface."));
     }
+    if (typesOnly && pipelined)
+    {
+        itemPtr->ThrowException(LE_I18N("Can't use [types-only] with [pipelined]"
+                                  " for the same interface."));
+    }
 
     // Get a pointer to the .api file object.
     auto apiFilePtr = GetApiFilePtr(apiFilePath, buildParams.interfaceDirs, contentList[0]);
@@ -826,6 +842,7 @@ static void GetRequiredApi
 
         ifPtr->manualStart = manualStart;
         ifPtr->optional = optional;
+        ifPtr->pipelined = pipelined;
 
         componentPtr->clientApis.push_back(ifPtr);
     }
@@ -1239,6 +1256,11 @@ static void PrintSummary
                                      " suppressed.")
                           << std::endl;
             }
+            if (itemPtr->parallel)
+            {
+                std::cout << LE_I18N("      Requests handled by a pool of worker threads.")
+                          << std::endl;
+            }
         }
     }
 }
@@ -1291,6 +1313,129 @@ static void SanitizeApiSet
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the directory of a component, first in some given directories and then in the build's
+ * component search directories.
+ *
+ * @return The path of the directory, or "" if not found.
+ */
+//--------------------------------------------------------------------------------------------------
+static std::string FindComponentDir
+(
+    const std::string& componentPath,
+    const mk::BuildParams_t& buildParams,
+    const std::list<std::string>& preSearchDirs ///< Dirs to search before buildParams source dirs
+)
+//--------------------------------------------------------------------------------------------------
+{
+    auto resolvedPath = file::FindComponent(componentPath, preSearchDirs);
+    if (resolvedPath.empty())
+    {
+        resolvedPath = file::FindComponent(componentPath, buildParams.componentDirs);
+    }
+
+    return resolvedPath;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start parsing in the background the .cdef files of the components specified by FILE_PATH
+ * tokens, skipping components that can't be found or have already been modelled.
+ *
+ * @return The prefetcher, to be kept until the components have been modelled.
+ */
+//--------------------------------------------------------------------------------------------------
+std::unique_ptr<parser::Prefetcher_t> PrefetchComponents
+(
+    const std::list<const parseTree::Token_t*>& tokens,
+    const mk::BuildParams_t& buildParams,
+    const std::list<std::string>& preSearchDirs ///< Dirs to search before buildParams source dirs
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::list<std::string> cdefFilePaths;
+
+    for (auto tokenPtr : tokens)
+    {
+        std::string componentPath = path::Unquote(DoSubstitution(tokenPtr));
+        if (componentPath.empty())
+        {
+            continue;
+        }
+
+        // Components that can't be found are left for GetComponent() to report.
+        auto resolvedPath = FindComponentDir(componentPath, buildParams, preSearchDirs);
+        if (resolvedPath.empty())
+        {
+            continue;
+        }
+
+        auto componentDir = path::MakeAbsolute(resolvedPath);
+        if (model::Component_t::GetComponent(componentDir) == NULL)
+        {
+            cdefFilePaths.push_back(path::Combine(componentDir, "Component.cdef"));
+        }
+    }
+
+    return parser::cdef::Prefetch(cdefFilePaths);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start parsing in the background the .cdef files of the components listed in the "component:"
+ * subsections of a .cdef file's "requires:" sections.
+ *
+ * @return The prefetcher, to be kept until the components have been modelled.
+ */
+//--------------------------------------------------------------------------------------------------
+static std::unique_ptr<parser::Prefetcher_t> PrefetchRequiredComponents
+(
+    model::Component_t* componentPtr,
+    const parseTree::CdefFile_t* cdefFilePtr,
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::list<const parseTree::Token_t*> tokens;
+
+    for (auto sectionPtr : cdefFilePtr->sections)
+    {
+        if (sectionPtr->firstTokenPtr->text != "requires")
+        {
+            continue;
+        }
+
+        auto complexSectionPtr = static_cast<const parseTree::ComplexSection_t*>(sectionPtr);
+
+        for (auto memberPtr : complexSectionPtr->Contents())
+        {
+            if (memberPtr->firstTokenPtr->text != "component")
+            {
+                continue;
+            }
+
+            // In the order AddRequiredItems() models them.
+            auto& items = parseTree::ToCompoundItemListPtr(memberPtr)->Contents();
+            for (auto it = items.rbegin(); it != items.rend(); ++it)
+            {
+                for (auto contentPtr : parseTree::ToTokenListPtr(*it)->Contents())
+                {
+                    if (contentPtr->type != parseTree::Token_t::PROVIDE_HEADER_OPTION)
+                    {
+                        tokens.push_back(contentPtr);
+                    }
+                }
+            }
+        }
+    }
+
+    return PrefetchComponents(tokens, buildParams, { componentPtr->dir });
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get a conceptual model for a single component residing in a given directory.
@@ -1373,6 +1518,9 @@ model::Component_t* GetComponent
     // Set BUILDDIR environment variable for this component
     SetComponentBuildDirEnvVar(componentPtr, buildParams);
 
+    // Start parsing the .cdef files of the required components in the background.
+    auto prefetcherPtr = PrefetchRequiredComponents(componentPtr, cdefFilePtr, buildParams);
+
     // Iterate over the .cdef file's list of sections.
     for (auto sectionPtr : cdefFilePtr->sections)
     {
@@ -1535,11 +1683,7 @@ model::Component_t* GetComponent
         return NULL;
     }
 
-    auto resolvedPath = file::FindComponent(componentPath, preSearchDirs);
-    if (resolvedPath.empty())
-    {
-        resolvedPath = file::FindComponent(componentPath, buildParams.componentDirs);
-    }
+    auto resolvedPath = FindComponentDir(componentPath, buildParams, preSearchDirs);
     if (resolvedPath.empty())
     {
         if (buildParams.isRelaxedStrictness)
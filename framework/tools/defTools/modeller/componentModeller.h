@@ -54,6 +54,22 @@ model::Component_t* GetComponent
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start parsing in the background the .cdef files of the components specified by FILE_PATH
+ * tokens, skipping components that can't be found or have already been modelled.
+ *
+ * @return The prefetcher, to be kept until the components have been modelled.
+ */
+//--------------------------------------------------------------------------------------------------
+std::unique_ptr<parser::Prefetcher_t> PrefetchComponents
+(
+    const std::list<const parseTree::Token_t*>& tokens,
+    const mk::BuildParams_t& buildParams,
+    const std::list<std::string>& preSearchDirs ///< Dirs to search before buildParams source dirs
+);
+
+
 } // namespace modeller
 
 #endif // LEGATO_DEFTOOLS_COMPONENT_MODELLER_H_INCLUDE_GUARD
@@ -163,6 +163,10 @@ static void ModelAppOverrides
                 appPtr->preloadedMd5 = tokenText;
             }
         }
+        else if (subsectionName == "taskGroup")
+        {
+            appPtr->taskGroup = ToSimpleSectionPtr(subsectionPtr)->Text();
+        }
         else
         {
             subsectionPtr->ThrowException(
@@ -374,6 +374,18 @@ parseTree::CdefFile_t* Parse
 )
 //--------------------------------------------------------------------------------------------------
 {
+    auto prefetchedPtr = static_cast<parseTree::CdefFile_t*>(TakePrefetched(filePath));
+    if (prefetchedPtr != NULL)
+    {
+        if (beVerbose)
+        {
+            std::cout << mk::format(LE_I18N("Parsing file: '%s'."), prefetchedPtr->path)
+                      << std::endl;
+        }
+
+        return prefetchedPtr;
+    }
+
     parseTree::CdefFile_t* filePtr = new parseTree::CdefFile_t(filePath);
 
     ParseFile(filePtr, beVerbose, internal::ParseSection);
@@ -382,6 +394,46 @@ parseTree::CdefFile_t* Parse
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parses a .cdef file on a prefetch worker thread: quietly, and stopping at the first error.
+ *
+ * @return Pointer to a fully populated CdefFile_t object.
+ *
+ * @throw mk::Exception_t if an error is encountered.
+ */
+//--------------------------------------------------------------------------------------------------
+static parseTree::DefFile_t* ParseInBackground
+(
+    const std::string& filePath     ///< Path to .cdef file to be parsed.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    parseTree::CdefFile_t* filePtr = new parseTree::CdefFile_t(filePath);
+
+    ParseFile(filePtr, false, internal::ParseSection, false);
+
+    return filePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start parsing .cdef files in the background.  Parse() then takes the result for these files.
+ *
+ * @return The prefetcher.  Files are only prefetched for as long as it exists.
+ */
+//--------------------------------------------------------------------------------------------------
+std::unique_ptr<Prefetcher_t> Prefetch
+(
+    const std::list<std::string>& filePaths     ///< Paths to the .cdef files.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return std::unique_ptr<Prefetcher_t>(new Prefetcher_t(filePaths, ParseInBackground));
+}
+
+
 
 } // namespace cdef
 
@@ -30,6 +30,20 @@ parseTree::CdefFile_t* Parse
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start parsing .cdef files in the background.  Parse() then takes the result for these files
+ * (see prefetch.h).
+ *
+ * @return The prefetcher.  Files are only prefetched for as long as it exists.
+ */
+//--------------------------------------------------------------------------------------------------
+std::unique_ptr<Prefetcher_t> Prefetch
+(
+    const std::list<std::string>& filePaths     ///< Paths to the .cdef files.
+);
+
+
 
 } // namespace cdef
 
@@ -18,49 +18,95 @@ namespace parser
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Constructor
+ * Get the contents of a def file.  Each file is read only once per run, no matter how many times
+ * it is lexed (e.g., a .sinc file included by many .sdef, .adef and .cdef files).  Safe to call
+ * from the prefetch worker threads.
+ *
+ * @return Pointer to the file's contents.
+ *
+ * @throw mk::Exception_t if the file can't be read.
  */
 //--------------------------------------------------------------------------------------------------
-Lexer_t::LexerContext_t::LexerContext_t
+static std::shared_ptr<const std::string> GetFileText
 (
-    parseTree::DefFileFragment_t* filePtr
+    const std::string& filePath
 )
 //--------------------------------------------------------------------------------------------------
-:   filePtr(filePtr),
-    inputStream(filePtr->path),
-    line(1),
-    column(0),
-    ifNestDepth(0)
-//--------------------------------------------------------------------------------------------------
 {
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::shared_ptr<const std::string>> fileTextCache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    auto iter = fileTextCache.find(filePath);
+    if (iter != fileTextCache.end())
+    {
+        return iter->second;
+    }
+
     // Make sure the file exists and we were able to open it.
-    if (!file::FileExists(filePtr->path))
+    if (!file::FileExists(filePath))
     {
         throw mk::Exception_t(
-            mk::format(LE_I18N("File not found: '%s'."), filePtr->path)
+            mk::format(LE_I18N("File not found: '%s'."), filePath)
         );
     }
+
+    std::ifstream inputStream(filePath);
+
     if (!inputStream.is_open())
     {
         throw mk::Exception_t(
-            mk::format(LE_I18N("Failed to open file '%s' for reading."), filePtr->path)
+            mk::format(LE_I18N("Failed to open file '%s' for reading."), filePath)
         );
     }
 
-    // Read in the first characters.
-    Buffer(2);
+    // Read the whole file in one go, rather than a character at a time.
+    std::stringstream textBuffer;
+    textBuffer << inputStream.rdbuf();
 
     if (inputStream.bad())
     {
         throw mk::Exception_t(
-            mk::format(LE_I18N("Failed to read from file '%s'."), filePtr->path)
+            mk::format(LE_I18N("Failed to read from file '%s'."), filePath)
         );
     }
+
+    auto textPtr = std::make_shared<const std::string>(textBuffer.str());
+
+    fileTextCache[filePath] = textPtr;
+
+    return textPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Constructor
+ */
+//--------------------------------------------------------------------------------------------------
+Lexer_t::LexerContext_t::LexerContext_t
+(
+    parseTree::DefFileFragment_t* filePtr
+)
+//--------------------------------------------------------------------------------------------------
+:   filePtr(filePtr),
+    textPtr(GetFileText(filePtr->path)),
+    readPos(0),
+    line(1),
+    column(0),
+    ifNestDepth(0),
+    curPos(-1)
+//--------------------------------------------------------------------------------------------------
+{
+    // Read in the first characters.
+    Buffer(2);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Ensure at least n elements are present in the lookahead character buffer
+ * Ensure at least n elements are present in the lookahead character buffer.  Once the end of the
+ * file is reached, a single EOF is added to the buffer.
  */
 //--------------------------------------------------------------------------------------------------
 void Lexer_t::LexerContext_t::Buffer
@@ -68,16 +114,27 @@ void Lexer_t::LexerContext_t::Buffer
     size_t n
 )
 {
-    while (inputStream.good() && (nextChars.size() < n))
+    while ((readPos <= textPtr->size()) && (nextChars.size() < n))
     {
-        nextChars.push_back(inputStream.get());
+        if (readPos < textPtr->size())
+        {
+            nextChars.push_back(static_cast<unsigned char>((*textPtr)[readPos]));
+        }
+        else
+        {
+            nextChars.push_back(EOF);
+        }
+
+        readPos++;
     }
 }
 
 
 void Lexer_t::LexerContext_t::setCurPos()
 {
-    curPos = inputStream.tellg();
+    // Position of the next character to be read from the file, or -1 once the end of the file
+    // has been read.
+    curPos = (readPos > textPtr->size()) ? -1 : static_cast<int>(readPos);
 }
 
 
@@ -91,7 +148,8 @@ Lexer_t::Lexer_t
     parseTree::DefFile_t* fileObjPtr
 )
 //--------------------------------------------------------------------------------------------------
-:   beVerbose(false)
+:   beVerbose(false),
+    recoverFromErrors(true)
 //--------------------------------------------------------------------------------------------------
 {
     // Setup the lexer context for the top-level file
@@ -1658,7 +1716,8 @@ void Lexer_t::PullServerIpcOption
     // Check that it's one of the valid server-side options.
     if (   (tokenPtr->text != "[manual-start]")
            && (tokenPtr->text != "[async]")
-           && (tokenPtr->text != "[direct]"))
+           && (tokenPtr->text != "[direct]")
+           && (tokenPtr->text != "[parallel]"))
     {
         ThrowException(
             mk::format(LE_I18N("Invalid server-side IPC option: '%s'"), tokenPtr->text)
@@ -1683,7 +1742,8 @@ void Lexer_t::PullClientIpcOption
     // Check that it's one of the valid client-side options.
     if (   (tokenPtr->text != "[manual-start]")
            && (tokenPtr->text != "[types-only]")
-           && (tokenPtr->text != "[optional]") )
+           && (tokenPtr->text != "[optional]")
+           && (tokenPtr->text != "[pipelined]") )
     {
         ThrowException(
             mk::format(LE_I18N("Invalid client-side IPC option: '%s'"), tokenPtr->text)
@@ -2571,11 +2631,6 @@ void Lexer_t::AdvanceOneCharacter
 
     context.top().nextChars.pop_front();
     context.top().Buffer(2);
-
-    if (context.top().inputStream.bad())
-    {
-        ThrowException(LE_I18N("Failed to fetch next character from file."));
-    }
 }
 
 
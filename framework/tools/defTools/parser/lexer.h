@@ -54,6 +54,8 @@ class Lexer_t
 
         // Errors encountered so far.
         std::vector<mk::Exception_t> errorList;
+
+        // true = report errors and skip to the next section, false = stop at the first error.
         bool recoverFromErrors;
 
         // Throw an exception with the file, line and column at the front.
@@ -66,14 +68,17 @@ class Lexer_t
         {
             parseTree::DefFileFragment_t* filePtr;  ///< Pointer to the File object for the file being parsed.
 
-            std::ifstream inputStream;      ///< File input stream from which tokens will be matched.
-            std::deque<int> nextChars;      ///< File buffer for characters read from the input
-                                            ///< stream but not yet consumed.
+            std::shared_ptr<const std::string> textPtr; ///< Contents of the file, from which
+                                                        ///< tokens will be matched.
+            size_t readPos;                 ///< Position in the file of the next character to be
+                                            ///< buffered.
+            std::deque<int> nextChars;      ///< File buffer for characters read from the file
+                                            ///< but not yet consumed.
             size_t line;                    ///< File line number.
             size_t column;                  ///< Char index on line (treat tab & return same as space).
             size_t ifNestDepth;             ///< Current number of nested #if directives.
 
-            int curPos;                     ///< Position of current character in the stream.
+            int curPos;                     ///< Position of current character in the file.
 
             LexerContext_t(parseTree::DefFileFragment_t *filePtr);
 
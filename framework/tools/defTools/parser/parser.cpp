@@ -39,6 +39,11 @@ parseTree::SimpleSection_t* ParseSimpleSection
     }
     catch (mk::Exception_t &e)
     {
+        if (!lexer.recoverFromErrors)
+        {
+            throw;
+        }
+
         std::cerr << "[ERROR] " << e.what() << std::endl;
         lexer.BailUntil(parseTree::Token_t::END_OF_FILE, true);
     }
@@ -120,6 +125,11 @@ parseTree::TokenList_t* ParseTokenListSection
         }
         catch (mk::Exception_t& e)
         {
+            if (!lexer.recoverFromErrors)
+            {
+                throw;
+            }
+
             std::cerr << "[ERROR] " << e.what() << std::endl;
             lexer.BailUntil(parseTree::Token_t::CLOSE_CURLY);
             return sectionPtr;
@@ -301,6 +311,11 @@ parseTree::CompoundItemList_t* ParseComplexSection
         }
         catch (mk::Exception_t& e)
         {
+            if (!lexer.recoverFromErrors)
+            {
+                throw;
+            }
+
             std::cerr << "[ERROR] " << e.what() << std::endl;
             lexer.BailUntil(parseTree::Token_t::CLOSE_CURLY);
             return sectionPtr;
@@ -359,6 +374,11 @@ parseTree::CompoundItemList_t* ParseNamedComplexSection
         }
         catch (mk::Exception_t &e)
         {
+            if (!lexer.recoverFromErrors)
+            {
+                throw;
+            }
+
             std::cerr << "[ERROR] " << e.what() << std::endl;
             lexer.BailUntil(parseTree::Token_t::CLOSE_CURLY);
             return sectionPtr;
@@ -417,7 +437,9 @@ void ParseFile
 (
     parseTree::DefFile_t* defFilePtr,   ///< Pointer to the definition file object to populate.
     bool beVerbose,                 ///< true if progress messages should be printed.
-    parseTree::CompoundItem_t* (*sectionParserFunc)(Lexer_t& lexer) ///< Section parser function.
+    parseTree::CompoundItem_t* (*sectionParserFunc)(Lexer_t& lexer), ///< Section parser function.
+    bool recoverFromErrors          ///< false to stop at the first error rather than
+                                    ///< report it and skip to the next section.
 )
 //--------------------------------------------------------------------------------------------------
 {
@@ -430,7 +452,7 @@ void ParseFile
     // Create a Lexer for this file.
     Lexer_t lexer(defFilePtr);
     lexer.beVerbose = beVerbose;
-    lexer.recoverFromErrors = true;
+    lexer.recoverFromErrors = recoverFromErrors;
 
     // Expect a list of any combination of sections.
     while (!lexer.IsMatch(parseTree::Token_t::END_OF_FILE))
@@ -448,6 +470,11 @@ void ParseFile
         }
         catch (mk::Exception_t &e)
         {
+            if (!lexer.recoverFromErrors)
+            {
+                throw;
+            }
+
             std::cerr << "[ERROR (root level)] " << e.what() << std::endl;
             lexer.BailUntil(parseTree::Token_t::CLOSE_CURLY);
         }
@@ -14,10 +14,14 @@
  * - @ref mdefParser.h
  * - @ref sdefParser.h
  * - @ref apiParser.h
+ * - @ref prefetch.h
  *
  * Also, there's a set of parsing functions declared in @ref parser.h that are shared by multiple
  * parsers.
  *
+ * .cdef files that the modellers will need soon can be parsed ahead of time on worker threads
+ * (see @ref prefetch.h).
+ *
  * The Lexer analyzes the input stream and generates lexical tokens from it.  All parsing functions
  * use the same Lexer class to do the lexical analysis.  The Lexer provides a ThrowException()
  * function, which is used internally and by the parsing functions to throw exceptions containing
@@ -45,6 +49,7 @@ namespace parser
 
 
 #include "lexer.h"
+#include "prefetch.h"
 #include "cdefParser.h"
 #include "adefParser.h"
 #include "mdefParser.h"
@@ -208,7 +213,9 @@ void ParseFile
 (
     parseTree::DefFile_t* defFilePtr,   ///< Pointer to the definition file object to populate.
     bool beVerbose,                 ///< true if progress messages should be printed.
-    parseTree::CompoundItem_t* (*sectionParserFunc)(Lexer_t& lexer) ///< Section parser function.
+    parseTree::CompoundItem_t* (*sectionParserFunc)(Lexer_t& lexer), ///< Section parser function.
+    bool recoverFromErrors = true   ///< false to stop at the first error rather than
+                                    ///< report it and skip to the next section.
 );
 
 
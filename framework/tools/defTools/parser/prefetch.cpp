@@ -0,0 +1,302 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file prefetch.cpp  Parsing of definition files in the background.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "defTools.h"
+
+
+namespace parser
+{
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A definition file being parsed in the background.
+ */
+//--------------------------------------------------------------------------------------------------
+struct PrefetchJob_t
+{
+    enum State_t
+    {
+        QUEUED,     ///< Waiting for a worker.
+        PARSING,    ///< Being parsed by a worker.
+        DONE,       ///< Parsed (or failed to parse).
+        CANCELLED   ///< Dropped before a worker picked it.
+    };
+
+    std::string filePath;               ///< Path to the definition file.
+    State_t state;                      ///< Where the job is at.
+    parseTree::DefFile_t* filePtr;      ///< The parsed file, or NULL if parsing failed.
+    std::set<std::string> readVars;     ///< Environment variables read while parsing the file.
+    envVars::Environment_t env;         ///< Worker's environment after parsing the file.
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Protects the prefetch jobs, and signals the completion of a job.
+ */
+//--------------------------------------------------------------------------------------------------
+static std::mutex JobMutex;
+static std::condition_variable JobDone;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Files being prefetched that haven't been taken yet, by path, with the environment of the
+ * prefetcher that started them.
+ */
+//--------------------------------------------------------------------------------------------------
+static std::map<std::string, std::pair<std::shared_ptr<PrefetchJob_t>,
+                                       const envVars::Environment_t*>> Jobs;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start parsing a set of definition files in the background.
+ */
+//--------------------------------------------------------------------------------------------------
+Prefetcher_t::Prefetcher_t
+(
+    const std::list<std::string>& filePaths,    ///< Paths to the definition files.
+    PrefetchParseFunc_t parseFunc               ///< Function to parse each file.
+)
+//--------------------------------------------------------------------------------------------------
+:   parseFunc(parseFunc),
+    env(envVars::Copy()),
+    isStopping(false)
+//--------------------------------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> lock(JobMutex);
+
+    // Skip files that are already being prefetched.
+    std::list<std::string> newFilePaths;
+    for (const auto& filePath : filePaths)
+    {
+        if (Jobs.find(filePath) == Jobs.end())
+        {
+            newFilePaths.push_back(filePath);
+        }
+    }
+
+    // A single file won't be parsed any sooner by a worker than by the modeller when it needs it.
+    if (newFilePaths.size() < 2)
+    {
+        return;
+    }
+
+    for (const auto& filePath : newFilePaths)
+    {
+        auto jobPtr = std::make_shared<PrefetchJob_t>();
+        jobPtr->filePath = filePath;
+        jobPtr->state = PrefetchJob_t::QUEUED;
+        jobPtr->filePtr = NULL;
+
+        Jobs[filePath] = std::make_pair(jobPtr, &env);
+        queue.push_back(jobPtr);
+        jobs.push_back(jobPtr);
+    }
+
+    size_t workerCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+                                          queue.size());
+
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        workers.emplace_back(&Prefetcher_t::Work, this);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stop parsing in the background, and drop the files that haven't been taken.
+ */
+//--------------------------------------------------------------------------------------------------
+Prefetcher_t::~Prefetcher_t
+(
+)
+//--------------------------------------------------------------------------------------------------
+{
+    {
+        std::lock_guard<std::mutex> lock(JobMutex);
+
+        for (auto& jobPtr : queue)
+        {
+            jobPtr->state = PrefetchJob_t::CANCELLED;
+        }
+        queue.clear();
+
+        isStopping = true;
+        JobDone.notify_all();
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(JobMutex);
+
+    for (auto& jobPtr : jobs)
+    {
+        auto i = Jobs.find(jobPtr->filePath);
+
+        if ((i != Jobs.end()) && (i->second.first == jobPtr))
+        {
+            Jobs.erase(i);
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Worker thread: parses queued files until there are none left.
+ */
+//--------------------------------------------------------------------------------------------------
+void Prefetcher_t::Work
+(
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::list<std::shared_ptr<PrefetchJob_t>> parsedJobs;
+
+    for (;;)
+    {
+        std::shared_ptr<PrefetchJob_t> jobPtr;
+
+        {
+            std::unique_lock<std::mutex> lock(JobMutex);
+
+            while (!queue.empty() && (queue.front()->state != PrefetchJob_t::QUEUED))
+            {
+                queue.pop_front();
+            }
+
+            if (queue.empty())
+            {
+                // Free what was allocated here on this thread too.  Memory freed by the modeller's
+                // thread would be reused by its next allocations, and the addresses of the objects
+                // in the model (which order the model's pointer sets) would depend on timing.
+                JobDone.wait(lock, [this] { return isStopping; });
+
+                for (auto& parsedJobPtr : parsedJobs)
+                {
+                    envVars::Environment_t().swap(parsedJobPtr->env);
+                    std::set<std::string>().swap(parsedJobPtr->readVars);
+                }
+                return;
+            }
+
+            jobPtr = queue.front();
+            queue.pop_front();
+            jobPtr->state = PrefetchJob_t::PARSING;
+        }
+
+        // Parse with a private copy of the environment, so substitutions see the environment as
+        // it was when prefetching started, whatever the modeller has changed since.
+        envVars::Environment_t workerEnv = env;
+        std::set<std::string> readVars;
+        parseTree::DefFile_t* filePtr = NULL;
+
+        envVars::UsePrivate(&workerEnv, &readVars);
+        try
+        {
+            filePtr = parseFunc(jobPtr->filePath);
+        }
+        catch (...)
+        {
+            // The modeller will parse the file again, and report the error.
+        }
+        envVars::UsePrivate(NULL);
+
+        std::lock_guard<std::mutex> lock(JobMutex);
+
+        parsedJobs.push_back(jobPtr);
+        jobPtr->filePtr = filePtr;
+        jobPtr->readVars = std::move(readVars);
+        jobPtr->env = std::move(workerEnv);
+        jobPtr->state = PrefetchJob_t::DONE;
+        JobDone.notify_all();
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take the result of parsing a definition file in the background, waiting for it if a worker is
+ * still parsing the file.
+ *
+ * @return Pointer to the parsed file, or NULL if it has not been prefetched or the result can't be
+ *         used.  The caller must then parse the file itself.
+ */
+//--------------------------------------------------------------------------------------------------
+parseTree::DefFile_t* TakePrefetched
+(
+    const std::string& filePath     ///< Path to the definition file, as given to the prefetcher.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::unique_lock<std::mutex> lock(JobMutex);
+
+    auto i = Jobs.find(filePath);
+    if (i == Jobs.end())
+    {
+        return NULL;
+    }
+
+    auto jobPtr = i->second.first;
+    auto& startEnv = *i->second.second;
+    Jobs.erase(i);
+
+    // Wait even if no worker has picked the file yet, rather than parse it here: whether a file
+    // is taken from a worker must not depend on timing, or the modeller's allocations (and so the
+    // order of the pointer sets in the model) would vary from one run to the next.
+    JobDone.wait(lock, [&jobPtr] { return jobPtr->state == PrefetchJob_t::DONE; });
+
+    lock.unlock();
+
+    if (jobPtr->filePtr == NULL)
+    {
+        return NULL;
+    }
+
+    // The result only holds if the variables the parser read haven't changed since.
+    for (const auto& name : jobPtr->readVars)
+    {
+        auto j = startEnv.find(name);
+
+        if (envVars::Get(name) != (j == startEnv.end() ? std::string() : j->second))
+        {
+            return NULL;
+        }
+    }
+
+    // Parsing may leave changes in the environment (e.g., CURDIR, set while substituting), so
+    // make the same changes as parsing the file here would have.
+    for (const auto& var : jobPtr->env)
+    {
+        auto j = startEnv.find(var.first);
+
+        if ((j == startEnv.end()) || (j->second != var.second))
+        {
+            envVars::Set(var.first, var.second);
+        }
+    }
+    for (const auto& var : startEnv)
+    {
+        if (jobPtr->env.find(var.first) == jobPtr->env.end())
+        {
+            envVars::Unset(var.first);
+        }
+    }
+
+    return jobPtr->filePtr;
+}
+
+
+} // namespace parser
@@ -0,0 +1,81 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file prefetch.h  Parsing of definition files in the background.
+ *
+ * The modellers work through the definition files one at a time, but the files that are known to
+ * be needed soon (e.g., the .cdef files of all the components of an app) can be parsed ahead of
+ * time on worker threads by a Prefetcher_t.  The file's Parse() function then takes the result
+ * instead of parsing the file itself.
+ *
+ * Parsing depends on environment variables (substitutions in include and conditional directives),
+ * so each worker parses with a private copy of the environment that was current when the
+ * prefetching started.  A result is only used if the file parsed without error and the variables
+ * that the parser read still have the same values when the file is needed.  Otherwise the file is
+ * parsed again the usual way, so the parse tree and error messages are the same as without
+ * prefetching.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_DEFTOOLS_PREFETCH_H_INCLUDE_GUARD
+#define LEGATO_DEFTOOLS_PREFETCH_H_INCLUDE_GUARD
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function that parses a definition file on a worker thread.  It must not print anything, and
+ * must throw an exception on the first error instead of recovering from it.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef parseTree::DefFile_t* (*PrefetchParseFunc_t)(const std::string& filePath);
+
+
+/// A definition file being parsed in the background.
+struct PrefetchJob_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parses a set of definition files in the background, using up to one worker thread per CPU.
+ *
+ * Files that haven't been taken by TakePrefetched() when the object is deleted are dropped, so the
+ * object should live until the files have been modelled.
+ */
+//--------------------------------------------------------------------------------------------------
+class Prefetcher_t
+{
+    public:
+
+        Prefetcher_t(const std::list<std::string>& filePaths, PrefetchParseFunc_t parseFunc);
+        ~Prefetcher_t();
+
+    private:
+
+        void Work();
+
+        PrefetchParseFunc_t parseFunc;                     ///< Parse function for the files.
+        envVars::Environment_t env;                        ///< Environment at the start.
+        std::list<std::shared_ptr<PrefetchJob_t>> queue;   ///< Files not picked by a worker yet.
+        std::list<std::shared_ptr<PrefetchJob_t>> jobs;    ///< All files of this prefetcher.
+        std::vector<std::thread> workers;                  ///< Worker threads.
+        bool isStopping;                                   ///< true once being deleted.
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take the result of parsing a definition file in the background, waiting for it if a worker is
+ * still parsing the file.
+ *
+ * @return Pointer to the parsed file, or NULL if it has not been prefetched or the result can't be
+ *         used.  The caller must then parse the file itself.
+ */
+//--------------------------------------------------------------------------------------------------
+parseTree::DefFile_t* TakePrefetched
+(
+    const std::string& filePath     ///< Path to the definition file, as given to the prefetcher.
+);
+
+
+#endif // LEGATO_DEFTOOLS_PREFETCH_H_INCLUDE_GUARD
@@ -204,6 +204,10 @@ static parseTree::CompoundItem_t* ParseAppOverride
     {
         return ParseAppPreloadedSection(lexer, sectionNameTokenPtr);
     }
+    else if (sectionName == "taskGroup")
+    {
+        return ParseSimpleSection(lexer, sectionNameTokenPtr, parseTree::Token_t::NAME);
+    }
     else if (sectionName == "watchdogAction")
     {
         return ParseWatchdogAction(lexer, sectionNameTokenPtr);
@@ -0,0 +1,159 @@
+#
+# ifgen server: generates code for many interfaces in one long-running process, so that Python
+# start-up, loading ifgen, parsing interfaces and compiling templates don't have to be repeated for
+# each interface.
+#
+# The mk tools start a server ("ifgen --serve SERVER_DIR BUILD_PID") before running ninja, and
+# the ifgen-client script passes ifgen command lines to it.  The server lasts until the build
+# process exits.
+#
+# Protocol, all through SERVER_DIR:
+#  - 'pid' holds the server's process ID, and 'requests' is a named pipe that appears once the
+#    server is ready.
+#  - A client creates a named pipe for the reply (REPLY), writes its working directory and ifgen
+#    arguments to REPLY.args, separated by NUL characters, and then writes the line "REPLY" to
+#    'requests'.
+#  - The server writes to REPLY the line "EXIT_CODE OUTPUT_SIZE", followed by what ifgen printed.
+#
+# Each request is handled by a child process forked from the server, so requests are handled in
+# parallel, and whatever a request does to the interface or templates doesn't affect later ones.
+# The server itself only parses the interface and loads the templates first, which are then cached
+# for later requests.
+#
+# Copyright (C) Sierra Wireless Inc.
+#
+
+import errno
+import fcntl
+import os
+import select
+import shutil
+import sys
+import tempfile
+import traceback
+
+
+def IsAlive(pid):
+    try:
+        os.kill(pid, 0)
+    except OSError as e:
+        return e.errno != errno.ESRCH
+    return True
+
+def ReapChildren():
+    try:
+        while os.waitpid(-1, os.WNOHANG)[0] != 0:
+            pass
+    except OSError:
+        # No children left
+        pass
+
+def ToStr(data):
+    """Convert bytes read from a file to a native string (Python 2 str is bytes)."""
+    return data if isinstance(data, str) else data.decode('utf-8')
+
+def WriteAll(fd, data):
+    while data:
+        data = data[os.write(fd, data):]
+
+def RunRequest(argv, mainFunc):
+    """Run ifgen in a child process, capturing its output, and return its exit code and output."""
+
+    output = tempfile.TemporaryFile()
+    os.dup2(output.fileno(), 1)
+    os.dup2(output.fileno(), 2)
+
+    try:
+        mainFunc(argv)
+        exitCode = 0
+    except SystemExit as e:
+        if e.code is None:
+            exitCode = 0
+        elif isinstance(e.code, int):
+            exitCode = e.code
+        else:
+            sys.stderr.write("%s\n" % e.code)
+            exitCode = 1
+    except:
+        traceback.print_exc()
+        exitCode = 1
+
+    sys.stdout.flush()
+    sys.stderr.flush()
+
+    output.seek(0)
+    return exitCode, output.read()
+
+def HandleRequest(replyPath, prepareFunc, mainFunc):
+    with open(replyPath + '.args', 'rb') as argsFile:
+        fields = argsFile.read().split(b'\0')[:-1]
+
+    if not fields:
+        return
+
+    workingDir = ToStr(fields[0])
+    argv = [ ToStr(field) for field in fields[1:] ]
+
+    os.chdir(workingDir)
+
+    # Parse the interface and load the templates here, so they are cached for later requests.
+    # Any error is left for the child process to report.
+    try:
+        prepareFunc(argv)
+    except BaseException:
+        pass
+
+    if os.fork() != 0:
+        return
+
+    try:
+        exitCode, output = RunRequest(argv, mainFunc)
+
+        # The client keeps the reply pipe open, so opening it only fails if the client is gone.
+        replyFd = os.open(replyPath, os.O_WRONLY | os.O_NONBLOCK)
+        fcntl.fcntl(replyFd, fcntl.F_SETFL, 0)
+        WriteAll(replyFd, ("%d %d\n" % (exitCode, len(output))).encode('utf-8') + output)
+    finally:
+        os._exit(0)
+
+def Serve(serveArgs, prepareFunc, mainFunc):
+    """Serve requests until the process with the given ID exits."""
+
+    serverDir, buildPid = serveArgs[0], int(serveArgs[1])
+    requestsPath = os.path.join(serverDir, 'requests')
+
+    # Diagnostics about the requests go to the clients.
+    nullFd = os.open(os.devnull, os.O_RDWR)
+    for fd in (0, 1, 2):
+        os.dup2(nullFd, fd)
+
+    try:
+        with open(os.path.join(serverDir, 'pid'), 'w') as pidFile:
+            pidFile.write("%d\n" % os.getpid())
+
+        # Make the requests pipe appear only once it can be read.
+        os.mkfifo(requestsPath + '.tmp', 0o600)
+        requestsFd = os.open(requestsPath + '.tmp', os.O_RDWR)
+        os.rename(requestsPath + '.tmp', requestsPath)
+
+        pending = b''
+        while True:
+            readable = select.select([ requestsFd ], [], [], 1.0)[0]
+
+            ReapChildren()
+
+            if not readable:
+                if not IsAlive(buildPid):
+                    break
+                continue
+
+            pending += os.read(requestsFd, 4096)
+            while b'\n' in pending:
+                replyPath, pending = pending.split(b'\n', 1)
+                try:
+                    HandleRequest(ToStr(replyPath), prepareFunc, mainFunc)
+                except (IOError, OSError):
+                    # The client is gone, or will run ifgen itself once it finds the server gone.
+                    pass
+    finally:
+        shutil.rmtree(serverDir, ignore_errors=True)
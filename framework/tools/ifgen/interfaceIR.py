@@ -633,9 +633,9 @@ class Interface(object):
         else:
             raise Exception("Unknown declaration object type")
 
-    def getMessageSize(self):
+    def getMessagePadding(self):
         """
-        Get size of largest possible message to a function or handler.
+        Get the number of bytes added to the packed parameters of every message.
 
         A message is 4-bytes for message ID, optional 4
         bytes for required output parameters, optional 1 byte for TagID,
@@ -646,11 +646,27 @@ class Interface(object):
         if (os.environ.get('LE_CONFIG_RPC') == "y"):
             # Include a 1-byte TagID
             padding = padding + 1
-        return padding + max([1] +
+        return padding
+
+    def getMessageSize(self):
+        """
+        Get size of largest possible message to a function or handler.
+        """
+        return self.getMessagePadding() + max([1] +
                        [function.GetMessageSize() for function in self.functions.values()] +
                        [handler.GetMessageSize()
                         for handler in self.types.values() if isinstance(handler, HandlerType)])
 
+    def getFunctionMessageSize(self, function):
+        """
+        Get size of largest possible message with a function's message ID: a call to the function,
+        its response, or a call to its handler.
+        """
+        return self.getMessagePadding() + max([1, function.GetMessageSize()] +
+                       [parameter.apiType.GetMessageSize()
+                        for parameter in function.parameters
+                        if isinstance(parameter.apiType, HandlerType)])
+
     def usesHandlers(self):
         """
         Returns if any function in this API use handlers.
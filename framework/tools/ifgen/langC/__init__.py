@@ -17,11 +17,34 @@ def AddLangArgumentGroup(parser):
                         action='store_true',
                         default=False,
                         help='generate local service functions')
+    parser.add_argument('--pipelined-client',
+                        dest="pipelinedClient",
+                        action='store_true',
+                        default=False,
+                        help='generate asynchronous (pipelined) client functions')
+    parser.add_argument('--fixed-layout',
+                        dest="fixedLayout",
+                        action='store_true',
+                        default=False,
+                        help='pack the inputs of functions taking only fixed-size parameters as a'
+                             ' single structure (client and server must both use this option)')
+    parser.add_argument('--direct-dispatch',
+                        dest="directDispatch",
+                        action='store_true',
+                        default=False,
+                        help='with --local-service, let clients running in the server\'s thread'
+                             ' call the server functions directly instead of sending messages')
     parser.add_argument('--allow-direct',
                         dest="direct",
                         action='store_true',
                         default=False,
                         help='allow in-place function calls')
+    parser.add_argument('--parallel-server',
+                        dest="parallel",
+                        action='store_true',
+                        default=False,
+                        help='handle requests on a pool of worker threads, keeping each client'
+                             ' session on the same worker')
 
 # Custom filters needed for C templates
 Filters = { 'DecorateName':        codeGenHelpers.DecorateName,
@@ -37,13 +60,21 @@ Filters = { 'DecorateName':        codeGenHelpers.DecorateName,
             'GetParameterCountPtr':  codeGenHelpers.GetParameterCountPtr,
             'PackFunction':          codeGenHelpers.GetPackFunction,
             'UnpackFunction':        codeGenHelpers.GetUnpackFunction,
+            'PackArrayFunction':     codeGenHelpers.GetPackArrayFunction,
+            'UnpackArrayFunction':   codeGenHelpers.GetUnpackArrayFunction,
+            'FixedLayoutFields':     codeGenHelpers.GetFixedLayoutFields,
+            'FixedLayoutSize':       codeGenHelpers.GetFixedLayoutSize,
             'CAPIParameters':        codeGenHelpers.IterCAPIParameters,
             'MaxCOutputBuffers':     codeGenHelpers.GetMaxCOutputBuffers,
             'LocalMessageSize':      codeGenHelpers.GetLocalMessageSize}
 
 
 Tests = { 'SizeParameter':         codeGenHelpers.IsSizeParameter,
-          'HandlerUser':           codeGenHelpers.UsesHandlers }
+          'HandlerUser':           codeGenHelpers.UsesHandlers,
+          'PipelinedFunction':     codeGenHelpers.IsPipelinedFunction,
+          'DirectDispatchFunction': codeGenHelpers.IsDirectDispatchFunction,
+          'DirectDispatchUser':    codeGenHelpers.HasDirectDispatchFunctions,
+          'FixedLayout':           codeGenHelpers.IsFixedLayout }
 
 Globals = { 'Labeler':             codeGenHelpers.Labeler }
 
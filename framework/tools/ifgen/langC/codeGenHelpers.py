@@ -343,6 +343,94 @@ def GetUnpackFunction(context, apiType):
     else:
         return _PackFunctionMapping[apiType] % ("Unpack", )
 
+# Integer types which have bulk array pack/unpack functions.
+_ArrayPackFunctionTypes = [
+    interfaceIR.UINT8_TYPE,
+    interfaceIR.UINT16_TYPE,
+    interfaceIR.UINT32_TYPE,
+    interfaceIR.UINT64_TYPE,
+    interfaceIR.INT8_TYPE,
+    interfaceIR.INT16_TYPE,
+    interfaceIR.INT32_TYPE,
+    interfaceIR.INT64_TYPE,
+]
+
+def GetPackArrayFunction(apiType):
+    """
+    Get the function packing a whole array of apiType, or None if arrays of this type must be
+    packed element by element.
+    """
+    if apiType in _ArrayPackFunctionTypes:
+        return _PackFunctionMapping[apiType] % ("Pack", ) + "Array"
+    return None
+
+def GetUnpackArrayFunction(apiType):
+    """
+    Get the function unpacking a whole array of apiType, or None if arrays of this type must be
+    unpacked element by element.
+    """
+    if apiType in _ArrayPackFunctionTypes:
+        return _PackFunctionMapping[apiType] % ("Unpack", ) + "Array"
+    return None
+
+# C type used in a fixed message layout for each type which can be part of one.  bool is carried
+# as a uint8_t, as when it is packed by le_pack.
+_FixedLayoutTypeMapping = {
+    interfaceIR.UINT8_TYPE:  "uint8_t",
+    interfaceIR.UINT16_TYPE: "uint16_t",
+    interfaceIR.UINT32_TYPE: "uint32_t",
+    interfaceIR.UINT64_TYPE: "uint64_t",
+    interfaceIR.INT8_TYPE:   "int8_t",
+    interfaceIR.INT16_TYPE:  "int16_t",
+    interfaceIR.INT32_TYPE:  "int32_t",
+    interfaceIR.INT64_TYPE:  "int64_t",
+    interfaceIR.BOOL_TYPE:   "uint8_t",
+    interfaceIR.CHAR_TYPE:   "char",
+    interfaceIR.DOUBLE_TYPE: "double",
+}
+
+def IsFixedLayout(parameterList):
+    """
+    Can the inputs of a function (or handler) be packed as a single fixed-layout structure?  This
+    is the case when there is at least one input, every input is a fixed-size basic type, and
+    there are no strings or arrays in either direction (their sizes are part of the inputs).
+    Tagged (RPC) messages always use the field by field format.
+    """
+    if os.environ.get('LE_CONFIG_RPC') == "y":
+        return False
+
+    inputs = [parameter for parameter in parameterList
+              if (parameter.direction & interfaceIR.DIR_IN) != 0]
+    if not inputs:
+        return False
+
+    return all([not isinstance(parameter, interfaceIR.StringParameter) and
+                not isinstance(parameter, interfaceIR.ArrayParameter)
+                for parameter in parameterList]) and \
+           all([parameter.apiType in _FixedLayoutTypeMapping for parameter in inputs])
+
+def GetFixedLayoutFields(parameterList):
+    """
+    Get the (C type, name, offset) of each field of the fixed-layout structure holding the inputs
+    of a function.
+    """
+    fields = []
+    offset = 0
+    for parameter in parameterList:
+        if (parameter.direction & interfaceIR.DIR_IN) != 0:
+            fields.append((_FixedLayoutTypeMapping[parameter.apiType],
+                           DecorateName(parameter.name),
+                           offset))
+            offset += parameter.apiType.size
+    return fields
+
+def GetFixedLayoutSize(parameterList):
+    """
+    Get the size of the fixed-layout structure holding the inputs of a function.
+    """
+    return sum([parameter.apiType.size for parameter in parameterList
+                if (parameter.direction & interfaceIR.DIR_IN) != 0])
+
 def EscapeString(string):
     return string.encode('string_escape').replace('"', '\\"')
 
@@ -402,6 +490,32 @@ def IsSizeParameter(parameter):
 def UsesHandlers(interface):
     return interface.usesHandlers()
 
+def IsPipelinedFunction(function):
+    """
+    Can this function be called asynchronously by a pipelined client?  Only functions whose
+    parameters are all inputs qualify, as there is nowhere for outputs to go once the caller has
+    returned.  Functions taking handlers (including add/remove handler functions) are excluded.
+    """
+    if isinstance(function, interfaceIR.EventFunction):
+        return False
+    return all([(parameter.direction & interfaceIR.DIR_OUT) == 0 and
+                not isinstance(parameter.apiType, interfaceIR.HandlerType)
+                for parameter in function.parameters])
+
+def IsDirectDispatchFunction(function):
+    """
+    Can a client running in a local service's own thread call this function directly (see the
+    --direct-dispatch option)?  Functions taking handlers (including add/remove handler functions)
+    are excluded, as their handlers are called back through the session.
+    """
+    if isinstance(function, interfaceIR.EventFunction):
+        return False
+    return not any([isinstance(parameter.apiType, interfaceIR.HandlerType)
+                    for parameter in function.parameters])
+
+def HasDirectDispatchFunctions(interface):
+    return any([IsDirectDispatchFunction(function) for function in interface.functions.values()])
+
 #---------------------------------------------------------------------------------------------------
 # Global functions
 #---------------------------------------------------------------------------------------------------
@@ -7,7 +7,7 @@
  #
  #  Copyright (C) Sierra Wireless Inc.
  #}
-{%- import 'pack.templ' as pack -%}
+{%- import 'pack.templ' as pack with context -%}
 /*
  * ====================== WARNING ======================
  *
@@ -78,6 +78,51 @@ static le_mem_PoolRef_t _ClientThreadDataPool;
  */
 //--------------------------------------------------------------------------------------------------
 static pthread_key_t _ThreadDataKey;
+{%- if args.pipelinedClient %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pipelined Request Objects
+ *
+ * One of these is kept for each asynchronous call that is waiting for its response, to remember
+ * the caller's completion handler.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_msg_SessionRef_t sessionRef;     ///< Session the request was sent on
+    void*               handlerPtr;     ///< Completion handler
+    void*               contextPtr;     ///< Context for completion handler
+}
+_PipelinedRequest_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Default expected maximum simultaneous asynchronous calls.  The pool grows beyond this if needed.
+ */
+//--------------------------------------------------------------------------------------------------
+#define HIGH_PIPELINED_REQUEST_COUNT   16
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Static pool for pipelined requests.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL({{apiName}}_PipelinedRequest,
+                          HIGH_PIPELINED_REQUEST_COUNT,
+                          sizeof(_PipelinedRequest_t));
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The memory pool for pipelined request objects
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t _PipelinedRequestPool;
+{%- endif %}
 
 
 //--------------------------------------------------------------------------------------------------
@@ -127,10 +172,13 @@ static le_result_t InitClientForThread
 
     sessionRef = le_msg_CreateLocalSession(LE_CDATA_THIS->_ClientServicePtr);
 {%- else %}
+    // The protocol identifier and the service instance name are constant, so the messaging
+    // library refers to them instead of making its own copies.
+    static const le_msg_ProtocolDesc_t protocolDesc = { PROTOCOL_ID_STR, sizeof(_Message_t) };
     le_msg_ProtocolRef_t protocolRef;
 
-    protocolRef = le_msg_GetProtocolRef(PROTOCOL_ID_STR, sizeof(_Message_t));
-    sessionRef = le_msg_CreateSession(protocolRef, SERVICE_INSTANCE_NAME);
+    protocolRef = le_msg_GetStaticProtocolRef(&protocolDesc);
+    sessionRef = le_msg_CreateStaticSession(protocolRef, SERVICE_INSTANCE_NAME);
 {%- endif %}
     le_result_t result = ifgen_{{apiBaseName}}_OpenSession(sessionRef, isBlocking);
     if (result != LE_OK)
@@ -219,6 +267,13 @@ static void InitCommonData(void)
 
     // Create the thread-local data key to be used to store a pointer to each thread object.
     LE_ASSERT(pthread_key_create(&_ThreadDataKey, NULL) == 0);
+{%- if args.pipelinedClient %}
+
+    // Allocate the pipelined request pool
+    _PipelinedRequestPool = le_mem_InitStaticPool({{apiName}}_PipelinedRequest,
+                                                  HIGH_PIPELINED_REQUEST_COUNT,
+                                                  sizeof(_PipelinedRequest_t));
+{%- endif %}
 }
 
 
@@ -525,4 +580,181 @@ void {{apiName}}_DisconnectService
         {%- endfor %}
     );
 }
+{%- if args.pipelinedClient and function is PipelinedFunction %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the server's response to {{apiName}}_{{function.name}}Async().
+ */
+//--------------------------------------------------------------------------------------------------
+static void _Handle{{function.name}}Response
+(
+    le_msg_MessageRef_t _responseMsgRef,
+    void* _contextPtr
+)
+{
+    {%- with error_unpack_label=Labeler("error_unpack") %}
+    _PipelinedRequest_t* _requestPtr = _contextPtr;
+    le_msg_SessionRef_t _sessionRef = _requestPtr->sessionRef;
+    {{apiName}}_{{function.name}}RespHandler_t _handlerPtr = _requestPtr->handlerPtr;
+    void* _handlerContextPtr = _requestPtr->contextPtr;
+    {%- if function.returnType %}
+    {{function.returnType|FormatType}} _result =
+        {{function.returnType|FormatTypeInitializer}};
+    {%- endif %}
+
+    le_mem_Release(_requestPtr);
+
+    // It is a serious error if we don't get a valid response from the server.  Call disconnect
+    // handler (if one is defined) to allow cleanup
+    if (_responseMsgRef == NULL)
+    {
+        le_msg_SessionEventHandler_t sessionCloseHandler = NULL;
+        void*                        closeContextPtr = NULL;
+
+        le_msg_GetSessionCloseHandler(_sessionRef,
+                                      &sessionCloseHandler,
+                                      &closeContextPtr);
+        if (sessionCloseHandler)
+        {
+            sessionCloseHandler(_sessionRef, closeContextPtr);
+        }
+
+        LE_FATAL("Error receiving response from server");
+    }
+    {%- if function.returnType %}
+
+    // Unpack the result
+    _Message_t* _msgPtr = le_msg_GetPayloadPtr(_responseMsgRef);
+    uint8_t* _msgBufPtr = _msgPtr->buffer;
+    if (!{{function.returnType|UnpackFunction}}( &_msgBufPtr, &_result ))
+    {
+        goto {{error_unpack_label}};
+    }
+    {%- endif %}
+
+    // Release the message object, now that the result has been copied.
+    le_msg_ReleaseMsg(_responseMsgRef);
+
+    if (_handlerPtr != NULL)
+    {
+        _handlerPtr({% if function.returnType %}_result, {% endif %}_handlerContextPtr);
+    }
+    return;
+    {%- if error_unpack_label.IsUsed() %}
+
+error_unpack:
+    LE_FATAL("Unexpected response from server.");
+    {%- endif %}
+    {%- endwith %}
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Asynchronous version of {{apiName}}_{{function.name}}().
+ */
+//--------------------------------------------------------------------------------------------------
+void {{apiName}}_{{function.name}}Async
+(
+    {%- for parameter in function|CAPIParameters %}
+    {{parameter|FormatParameter}},
+        ///< [{{parameter.direction|FormatDirection}}]
+             {{-parameter.comments|join("\n///<")|indent(8)}}
+    {%-endfor%}
+    {{apiName}}_{{function.name}}RespHandler_t handlerPtr,
+        ///< [IN] Handler called on completion (may be NULL).
+    void* contextPtr
+        ///< [IN] Context pointer passed to the handler.
+)
+{
+    le_msg_SessionRef_t _sessionRef = GetCurrentSessionRef();
+
+    // A locally bound service is called directly, so the call has completed by the time it
+    // returns.
+    if (_sessionRef == NULL)
+    {
+        {% if function.returnType %}{{function.returnType|FormatType}} _result = {% endif -%}
+        {{apiName}}_{{function.name}}(
+            {%- for parameter in function|CAPIParameters %}
+            {{parameter|FormatParameterName}}{% if not loop.last %},{% endif %}
+            {%- endfor %}
+        );
+        if (handlerPtr != NULL)
+        {
+            handlerPtr({% if function.returnType %}_result, {% endif %}contextPtr);
+        }
+        return;
+    }
+
+    le_msg_MessageRef_t _msgRef;
+    _Message_t* _msgPtr;
+
+    // Will not be used if no data is sent to the server.
+    __attribute__((unused)) uint8_t* _msgBufPtr;
+
+    // Range check values, if appropriate
+    {%- for parameter in function.parameters if parameter is InParameter %}
+    {%- if parameter is StringParameter %}
+    if ( {{parameter|GetParameterCount}} > {{parameter.maxCount}} )
+    {
+        LE_FATAL("{{parameter|GetParameterCount}} > {{parameter.maxCount}}");
+    }
+    {%- elif parameter is ArrayParameter %}
+    if ( (NULL == {{parameter|FormatParameterName}}) &&
+         (0 != {{parameter|GetParameterCount}}) )
+    {
+        LE_FATAL("If {{parameter|FormatParameterName}} is NULL "
+                 "{{parameter|GetParameterCount}} must be zero");
+    }
+    if ( {{parameter|GetParameterCount}} > {{parameter.maxCount}} )
+    {
+        LE_FATAL("{{parameter|GetParameterCount}} > {{parameter.maxCount}}");
+    }
+    {%- endif %}
+    {%- endfor %}
+
+    // Create a new message object and get the message buffer
+    _msgRef = le_msg_CreateSizedMsg(_sessionRef, _MSGSIZE_{{apiBaseName}}_{{function.name}});
+    _msgPtr = le_msg_GetPayloadPtr(_msgRef);
+    _msgPtr->id = _MSGID_{{apiBaseName}}_{{function.name}};
+    _msgBufPtr = _msgPtr->buffer;
+
+    // Pack the input parameters
+    {{- pack.PackInputs(function.parameters) }}
+
+    // Remember who to tell when the response arrives.
+    _PipelinedRequest_t* _requestPtr = le_mem_ForceAlloc(_PipelinedRequestPool);
+    _requestPtr->sessionRef = _sessionRef;
+    _requestPtr->handlerPtr = handlerPtr;
+    _requestPtr->contextPtr = contextPtr;
+
+    // Send the request to the server without waiting for the response.
+    le_msg_RequestResponse(_msgRef, _Handle{{function.name}}Response, _requestPtr);
+}
+{%- endif %}
 {%- endfor %}
+{%- if args.pipelinedClient %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the maximum number of asynchronous calls that the current client thread may have waiting
+ * for the server at once.
+ */
+//--------------------------------------------------------------------------------------------------
+void {{apiName}}_SetRequestWindow
+(
+    uint32_t window     ///< [IN] Maximum calls in flight, or 0 for unlimited.
+)
+{
+    le_msg_SessionRef_t sessionRef = GetCurrentSessionRef();
+
+    // Locally bound calls complete immediately, so there is nothing to limit.
+    if (sessionRef != NULL)
+    {
+        le_msg_SetSessionRequestWindow(sessionRef, window);
+    }
+}
+{%- endif %}
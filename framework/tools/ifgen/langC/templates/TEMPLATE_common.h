@@ -28,7 +28,12 @@
 {%- endfor %}
 {%- endif %}
 
+{%- if args.fixedLayout %}
+// Messages with fixed layouts are not understood by peers generated without --fixed-layout.
+#define IFGEN_{{apiBaseName|upper}}_PROTOCOL_ID "{{idString}}-fixed"
+{%- else %}
 #define IFGEN_{{apiBaseName|upper}}_PROTOCOL_ID "{{idString}}"
+{%- endif %}
 #define IFGEN_{{apiBaseName|upper}}_MSG_SIZE {{messageSize}}
 {%- if args.localService %}
 // with ARM RVCT the max size of UINTPTR_MAX is signed.
@@ -110,6 +115,29 @@ typedef void (*{{handler|FormatType(useBaseName=True)}})
     {%-endfor%}
 );
 {%- endfor %}
+{%- if args.localService and interface is DirectDispatchUser %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Functions through which a client running in a local service's own thread calls the server
+ * directly, instead of sending it messages (see le_msg_SetServiceDirectCalls()).
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    {%- for function in functions if function is DirectDispatchFunction %}
+    {{function.returnType|FormatType(useBaseName=True)}} (*{{function.name}})
+    (
+        le_msg_SessionRef_t _ifgen_sessionRef
+        {%- for parameter in function|CAPIParameters %},
+        {{parameter|FormatParameter(useBaseName=True)}}
+        {%- endfor %}
+    );
+    {%- endfor %}
+}
+ifgen_{{apiBaseName}}_DirectCalls_t;
+{%- endif %}
 
 
 //--------------------------------------------------------------------------------------------------
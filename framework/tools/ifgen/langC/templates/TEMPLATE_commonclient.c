@@ -410,10 +410,29 @@ LE_SHARED {{function.returnType|FormatType(useBaseName=True)}} ifgen_{{apiBaseNa
     }
     {%- endif %}
     {%- endfor %}
+    {%- if args.localService and args.directDispatch and function is DirectDispatchFunction %}
+
+    // A client running in the server's own thread calls the server function directly: the thread
+    // couldn't handle the request while waiting for its response, and packing is saved.
+    const ifgen_{{apiBaseName}}_DirectCalls_t* _directCallsPtr =
+        le_msg_GetSessionDirectCalls(_ifgen_sessionRef);
+    if (_directCallsPtr != NULL)
+    {
+        {% if function.returnType %}return {% endif -%}
+        _directCallsPtr->{{function.name}}(_ifgen_sessionRef
+            {%- for parameter in function|CAPIParameters %},
+            {{parameter|FormatParameterName}}
+            {%- endfor %});
+        {%- if not function.returnType %}
+        return;
+        {%- endif %}
+    }
+    {%- endif %}
 
 
     // Create a new message object and get the message buffer
-    _msgRef = le_msg_CreateMsg(_ifgen_sessionRef);
+    _msgRef = le_msg_CreateSizedMsg(_ifgen_sessionRef,
+                                   _MSGSIZE_{{apiBaseName}}_{{function.name}});
     _msgPtr = le_msg_GetPayloadPtr(_msgRef);
     _msgPtr->id = _MSGID_{{apiBaseName}}_{{function.name}};
     _msgBufPtr = _msgPtr->buffer;
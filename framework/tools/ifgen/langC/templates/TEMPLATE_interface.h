@@ -99,4 +99,62 @@ void {{apiName}}_DisconnectService
 (
     void
 );
+{%- if args.pipelinedClient %}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the maximum number of asynchronous (...Async()) calls that the current client thread may
+ * have waiting for the server at once.  Calls made while this many are outstanding are queued and
+ * sent to the server as earlier calls complete.  0 means unlimited.
+ *
+ * This function is created automatically.
+ */
+//--------------------------------------------------------------------------------------------------
+void {{apiName}}_SetRequestWindow
+(
+    uint32_t window     ///< [IN] Maximum calls in flight, or 0 for unlimited.
+);
+{%- endif %}
+{%- endblock %}
+{% block FunctionDeclaration %}
+{{- super() }}
+{%- if args.pipelinedClient and function is PipelinedFunction %}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler for the completion of {{apiName}}_{{function.name}}Async().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*{{apiName}}_{{function.name}}RespHandler_t)
+(
+    {%- if function.returnType %}
+    {{function.returnType|FormatType}} result,
+        ///< [IN] Value returned by the server.
+    {%- endif %}
+    void* contextPtr
+        ///< [IN] Context pointer passed to {{apiName}}_{{function.name}}Async().
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Asynchronous version of {{apiName}}_{{function.name}}().  The request is sent to the server
+ * without waiting for it to complete; the handler is called from the calling thread's event loop
+ * when the server's response arrives.  Calls complete in the order they were made.
+ *
+ * This function is created automatically.
+ */
+//--------------------------------------------------------------------------------------------------
+void {{apiName}}_{{function.name}}Async
+(
+    {%- for parameter in function|CAPIParameters %}
+    {{parameter|FormatParameter}},
+        ///< [{{parameter.direction|FormatDirection}}]
+             {{-parameter.comments|join("\n///<")|indent(8)}}
+    {%-endfor%}
+    {{apiName}}_{{function.name}}RespHandler_t handlerPtr,
+        ///< [IN] Handler called on completion (may be NULL).
+    void* contextPtr
+        ///< [IN] Context pointer passed to the handler.
+);
+{%- endif %}
 {%- endblock %}
@@ -40,6 +40,16 @@ _Message_t;
 #define _MSGID_{{apiBaseName}}_{{function.name}} {{loop.index0}}
 {%- endfor %}
 
+// Define the payload size of the messages for each function, big enough for the call, its
+// response, and calls to its handler (if any)
+{%- for function in functions %}
+{%- if args.localService %}
+#define _MSGSIZE_{{apiBaseName}}_{{function.name}} sizeof(_Message_t)
+{%- else %}
+#define _MSGSIZE_{{apiBaseName}}_{{function.name}} (sizeof(uint32_t) + {{interface.getFunctionMessageSize(function)}})
+{%- endif %}
+{%- endfor %}
+
 
 // Define type-safe pack/unpack functions for all enums, including included types
 {%- for type in allTypes if type is EnumType or type is BitMaskType %}
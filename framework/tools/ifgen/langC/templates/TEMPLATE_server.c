@@ -192,11 +192,17 @@ static void ServerMsgRecvHandler
  *  - Server service reference
  *  - Server thread reference
  *  - Client session reference
+{%- if args.parallel %}
+ *  - Worker thread references
+{%- endif %}
  */
 //--------------------------------------------------------------------------------------------------
 LE_CDATA_DECLARE({le_msg_ServiceRef_t _ServerServiceRef;
         le_thread_Ref_t _ServerThreadRef;
-        le_msg_SessionRef_t _ClientSessionRef;});
+        le_msg_SessionRef_t _ClientSessionRef;
+{%- if args.parallel %}
+        le_thread_Ref_t _WorkerThreadRefs[LE_CONFIG_IPC_SERVER_WORKERS];
+{%- endif %}});
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -397,9 +403,93 @@ le_msg_SessionRef_t {{apiName}}_GetClientSessionRef
     void
 )
 {
+    {%- if args.parallel %}
+    // Requests are handled by the worker threads, which get the session from the message they're
+    // handling.
+    if (le_thread_GetCurrent() != LE_CDATA_THIS->_ServerThreadRef)
+    {
+        le_msg_MessageRef_t rxMsgRef = le_msg_GetServiceRxMsg();
+
+        return (rxMsgRef != NULL) ? le_msg_GetSession(rxMsgRef) : NULL;
+    }
+
+    {%- endif %}
     return LE_CDATA_THIS->_ClientSessionRef;
 }
 
+{%- if args.localService and args.directDispatch and not args.async and
+      interface is DirectDispatchUser %}
+{%- for function in functions if function is DirectDispatchFunction %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Direct call to {{apiName}}_{{function.name}}(), for clients running in the server's thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static {{function.returnType|FormatType(useBaseName=True)}} Direct_{{apiName}}_{{function.name}}
+(
+    le_msg_SessionRef_t _ifgen_sessionRef
+    {%- for parameter in function|CAPIParameters %},
+    {{parameter|FormatParameter(useBaseName=True)}}
+    {%- endfor %}
+)
+{
+    // Let the server function get the client session reference, as if it was handling a message.
+    le_msg_SessionRef_t _prevSessionRef = LE_CDATA_THIS->_ClientSessionRef;
+    LE_CDATA_THIS->_ClientSessionRef = _ifgen_sessionRef;
+
+    {% if function.returnType -%}
+    {{function.returnType|FormatType(useBaseName=True)}} _result =
+        {% endif -%}
+    {{apiName}}_{{function.name}}(
+        {%- for parameter in function|CAPIParameters %}
+        {{parameter|FormatParameterName}}{% if not loop.last %},{% endif %}
+        {%- endfor %}
+    );
+
+    LE_CDATA_THIS->_ClientSessionRef = _prevSessionRef;
+    {%- if function.returnType %}
+
+    return _result;
+    {%- endif %}
+}
+{%- endfor %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Functions called directly by clients running in the server's thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static const ifgen_{{apiBaseName}}_DirectCalls_t DirectCalls =
+{
+    {%- for function in functions if function is DirectDispatchFunction %}
+    .{{function.name}} = Direct_{{apiName}}_{{function.name}},
+    {%- endfor %}
+};
+{%- endif %}
+{%- if args.parallel %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the worker threads, which handle the requests queued to them by the server
+ * thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* WorkerThreadMain
+(
+    void* contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    le_event_RunLoop();
+    return NULL;
+}
+{%- endif %}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -450,16 +540,40 @@ void {{apiName}}_AdvertiseService
     }
     _UNLOCK
 
+    {%- endif %}
+    {%- if args.parallel %}
+
+    // Start the worker threads.  They inherit this thread's component instance.
+    if (LE_CDATA_THIS->_WorkerThreadRefs[0] == NULL)
+    {
+        int i;
+
+        for (i = 0; i < LE_CONFIG_IPC_SERVER_WORKERS; i++)
+        {
+            // Keep the names short enough not to be truncated.
+            char name[24];
+
+            snprintf(name, sizeof(name), "%.16s%d", "{{apiName}}", i);
+            LE_CDATA_THIS->_WorkerThreadRefs[i] = le_thread_Create(name, WorkerThreadMain, NULL);
+            le_thread_Start(LE_CDATA_THIS->_WorkerThreadRefs[i]);
+        }
+    }
     {%- endif %}
 
     // Start the server side of the service
     {%- if not args.localService %}
+    static const le_msg_ProtocolDesc_t protocolDesc = { PROTOCOL_ID_STR, sizeof(_Message_t) };
     le_msg_ProtocolRef_t protocolRef;
 
-    protocolRef = le_msg_GetProtocolRef(PROTOCOL_ID_STR, sizeof(_Message_t));
-    LE_CDATA_THIS->_ServerServiceRef = le_msg_CreateService(protocolRef, SERVICE_INSTANCE_NAME);
+    protocolRef = le_msg_GetStaticProtocolRef(&protocolDesc);
+    LE_CDATA_THIS->_ServerServiceRef = le_msg_CreateStaticService(protocolRef,
+                                                                  SERVICE_INSTANCE_NAME);
     {%- endif %}
     le_msg_SetServiceRecvHandler(LE_CDATA_THIS->_ServerServiceRef, ServerMsgRecvHandler, NULL);
+    {%- if args.localService and args.directDispatch and not args.async and
+          interface is DirectDispatchUser %}
+    le_msg_SetServiceDirectCalls(LE_CDATA_THIS->_ServerServiceRef, &DirectCalls);
+    {%- endif %}
     le_msg_AdvertiseService(LE_CDATA_THIS->_ServerServiceRef);
     {%- if not args.localService %}
 
@@ -584,7 +698,8 @@ static void AsyncResponse_{{apiName}}_{{function.name}}
     __attribute__((unused)) uint8_t* _msgBufPtr;
 
     // Create a new message object and get the message buffer
-    _msgRef = le_msg_CreateMsg(serverDataPtr->clientSessionRef);
+    _msgRef = le_msg_CreateSizedMsg(serverDataPtr->clientSessionRef,
+                                   _MSGSIZE_{{apiBaseName}}_{{function.name}});
     _msgPtr = le_msg_GetPayloadPtr(_msgRef);
     _msgPtr->id = _MSGID_{{apiBaseName}}_{{function.name}};
     _msgBufPtr = _msgPtr->buffer;
@@ -953,6 +1068,57 @@ error_unpack:
 }
 {%- endif %}
 {%- endfor %}
+{%- if args.parallel %}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handle a request on a worker thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WorkerMsgRecvHandler
+(
+    le_msg_MessageRef_t msgRef,
+    void*               contextPtr
+)
+{
+    LE_UNUSED(contextPtr);
+
+    // Get the message payload so that we can get the message "id"
+    _Message_t* msgPtr = le_msg_GetPayloadPtr(msgRef);
+
+    // Dispatch to appropriate message handler and get response
+    switch (msgPtr->id)
+    {
+        {%- for function in functions %}
+        case _MSGID_{{apiBaseName}}_{{function.name}} :
+            Handle_{{apiName}}_{{function.name}}(msgRef);
+            break;
+        {%- endfor %}
+
+        default: LE_ERROR("Unknowm msg id = %" PRIu32 , msgPtr->id);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handle a request queued to a worker thread by the server thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WorkerQueuedMsgHandler
+(
+    void* msgRef,   ///< [in] Reference to the message.
+    void* unused    ///< [in] Not used
+)
+{
+    LE_UNUSED(unused);
+
+    // Make the message the thread's received message, so the server functions can use
+    // GetClientSessionRef() and LE_KILL_CLIENT() as they would on the server thread.
+    le_msg_HandleServiceRxMsg(WorkerMsgRecvHandler, msgRef, NULL);
+}
+{%- endif %}
 
 
 static void ServerMsgRecvHandler
@@ -965,6 +1131,39 @@ static void ServerMsgRecvHandler
 
     // Get the message payload so that we can get the message "id"
     _Message_t* msgPtr = le_msg_GetPayloadPtr(msgRef);
+{%- if not args.localService and functions %}
+
+    // The message must be big enough for the function's largest message, or unpacking it (or
+    // packing the response into it) could run past its end.
+    static const size_t msgSizes[] =
+    {
+        {%- for function in functions %}
+        _MSGSIZE_{{apiBaseName}}_{{function.name}},
+        {%- endfor %}
+    };
+    if ((msgPtr->id < NUM_ARRAY_MEMBERS(msgSizes)) &&
+        (le_msg_GetMaxPayloadSize(msgRef) < msgSizes[msgPtr->id]))
+    {
+        LE_EMERG("Message %" PRIu32 " from client is too small (%" PRIuS " bytes)",
+                 msgPtr->id, le_msg_GetMaxPayloadSize(msgRef));
+        le_msg_CloseSession(le_msg_GetSession(msgRef));
+        le_msg_ReleaseMsg(msgRef);
+        return;
+    }
+{%- endif %}
+{%- if args.parallel %}
+
+    // Hand the request to a worker thread.  All of a session's requests go to the same worker,
+    // which handles them in the order they were received.
+    le_msg_SessionRef_t sessionRef = le_msg_GetSession(msgRef);
+    size_t worker = le_hashmap_HashBytes(&sessionRef, sizeof(sessionRef)) %
+                    LE_CONFIG_IPC_SERVER_WORKERS;
+
+    le_event_QueueFunctionToThread(LE_CDATA_THIS->_WorkerThreadRefs[worker],
+                                   WorkerQueuedMsgHandler,
+                                   msgRef,
+                                   NULL);
+{%- else %}
 
     // Get the client session ref for the current message.  This ref is used by the server to
     // get info about the client process, such as user id.  If there are multiple clients, then
@@ -986,4 +1185,5 @@ static void ServerMsgRecvHandler
     // Clear the client session ref associated with the current message, since the message
     // has now been processed.
     LE_CDATA_THIS->_ClientSessionRef = 0;
+{%- endif %}
 }
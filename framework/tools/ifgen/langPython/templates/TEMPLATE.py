@@ -76,8 +76,22 @@ class {{type.name}}(Enum):
 {%- endif %}
 {%- endfor %}
 
+def _array_ptr(ctype, items):
+    '''
+    Get a C array of the items of an array parameter.  Objects supporting the buffer protocol
+    (bytes, bytearray, memoryview, array.array, ...) are used in place, without copying their
+    contents; other sequences are copied into a new array.
+    '''
+    try:
+        return ffi.from_buffer(ctype, items)
+    except TypeError:
+        return ffi.new(ctype, items)
+
 _handler_reg_queue = []
 _connected = False
+# Names given to set_ServiceInstanceName().  The messaging library keeps referring to the name a
+# session was created with, so these are never freed.
+_ServiceInstanceNames = []
 
 {%- for function in functions %}
 
@@ -100,7 +114,17 @@ def {{function.name}}(
 {%- endfor %}):
     {% set add_default = False %}
     {%- for parameter in function.parameters %}
-        {%- if parameter.direction == 2 %}
+        {%- if parameter is ArrayParameter and parameter.direction == 2 %}
+            {#- Output arrays are received in the caller's buffer if one is given #}
+    if {{parameter.name}} is None:
+        {{parameter.name}}_ptr = ffi.new("{{parameter.apiType|FormatType}}[]", {{parameter.maxCount}})
+    else:
+        {{parameter.name}}_ptr = ffi.from_buffer("{{parameter.apiType|FormatType}}[]", {{parameter.name}},
+                                                 require_writable=True)
+    {{parameter.name}}_count = ffi.new("size_t *", len({{parameter.name}}_ptr))
+        {%- elif parameter is ArrayParameter %}
+    {{parameter.name}}_ptr = _array_ptr("{{parameter.apiType|FormatType}}[]", {{parameter.name}})
+        {%- elif parameter.direction == 2 %}
             {#- do only output parameters need to be converted to pointers? probably. #}
             {%- if parameter.apiType|FormatType == 'char*' %}
     {{parameter.name}}_ptr = ffi.new("char[]", {{parameter.name}} if {{parameter.name}} is not None else 256)
@@ -120,14 +144,25 @@ def {{function.name}}(
         {%- endif %}
     {%- endfor %}
     result = lib.{{apiName}}_{{function.name}}(
-        {%- for parameter in function.parameters %}{{parameter.name}}
+        {%- for parameter in function.parameters %}
+        {#- Arrays are passed with their number of items #}
+        {%- if parameter is ArrayParameter and parameter.direction == 2 %}{{parameter.name}}_ptr, {{parameter.name}}_count
+        {%- elif parameter is ArrayParameter %}{{parameter.name}}_ptr, len({{parameter.name}}_ptr)
+        {%- else %}{{parameter.name}}
+        {%- endif %}
         {#- If it's an output char*, fill out the size parameter #}
         {%- if parameter.apiType|FormatType == 'char*' and parameter.direction == 2 %}, ffi.sizeof({{parameter.name}}) {%- endif -%}
         {%- if not loop.last %}, {% endif %}
         {%- endfor %})
     {#- Casting back to python types #}
     {%- for parameter in function.parameters if parameter.direction == 2 %}
+    {%- if parameter is ArrayParameter %}
+    {#- A view of the received items, in the caller's buffer if one was given #}
+    {{parameter.name}} = ffi.buffer({{parameter.name}}_ptr,
+                                    {{parameter.name}}_count[0] * ffi.sizeof("{{parameter.apiType|FormatType}}"))
+    {%- else %}
     {{parameter|CDataToPython}}
+    {%- endif %}
     {%- endfor %}
     {%- if function.returnType|FormatType == 'le_result_t' %}
     result = Result(result)
@@ -257,6 +292,7 @@ def set_ServiceInstanceName(name):
     global _ServiceInstanceNamePtr
     global _ServiceInstanceNameDblPtr
     _ServiceInstanceNamePtr = ffi.new('char[]', name)
+    _ServiceInstanceNames.append(_ServiceInstanceNamePtr)
     _ServiceInstanceNameDblPtr = ffi.new('char**', _ServiceInstanceNamePtr)
     lib.{{apiName}}_ServiceInstanceNamePtr = _ServiceInstanceNameDblPtr
 
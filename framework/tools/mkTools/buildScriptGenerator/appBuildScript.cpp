@@ -70,7 +70,10 @@ void AppBuildScriptGenerator_t::GenerateAppBuildRules
         // symlinks as part of the MD5 hash.
         "            md5=$$( ( cd $workingDir/staging && $\n"
         "                      find -P -print0 |LC_ALL=C sort -z && $\n"
-        "                      find -P -type f -print0 |LC_ALL=C sort -z |xargs -0 md5sum && $\n"
+        // Files are hashed in parallel, and the sums sorted back into path order so the
+        // result is the same as hashing them one after the other.
+        "                      find -P -type f -print0 |LC_ALL=C sort -z $\n"
+        "                        |xargs -0 -P $$(nproc) -n 32 md5sum |LC_ALL=C sort -k 2 && $\n"
         "                      find -P -type l -print0 |LC_ALL=C sort -z"
                              " |xargs -0 -r -n 1 readlink $\n"
         "                    ) | md5sum) && $\n"
@@ -142,7 +145,10 @@ void AppBuildScriptGenerator_t::GenerateAppBuildRules
             // of symlinks as part of the MD5 hash.
             "            md5signed=$$( ( cd $workingDir/staging.signed && $\n"
             "                      find -P -print0 |LC_ALL=C sort -z && $\n"
-            "                      find -P -type f -print0 |LC_ALL=C sort -z |xargs -0 md5sum && $\n"
+            // Files are hashed in parallel, and the sums sorted back into path order so the
+            // result is the same as hashing them one after the other.
+            "                      find -P -type f -print0 |LC_ALL=C sort -z $\n"
+            "                        |xargs -0 -P $$(nproc) -n 32 md5sum |LC_ALL=C sort -k 2 && $\n"
             "                      find -P -type l -print0 |LC_ALL=C sort -z"
                                  " |xargs -0 -r -n 1 readlink $\n"
             "                    ) | md5sum) && $\n"
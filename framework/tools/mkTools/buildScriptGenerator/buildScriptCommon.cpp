@@ -165,6 +165,30 @@ void BuildScriptGenerator_t::GenerateIncludedApis
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write out to a given script file the implicit inputs of a build statement that runs ifgen on a
+ * given .api file (the .api files it needs).  If ifgen's output is cached, also define the
+ * ifgenApis variable, listing the .api files that the cache key is computed from.
+ **/
+//--------------------------------------------------------------------------------------------------
+void BuildScriptGenerator_t::GenerateIfgenInputs
+(
+    const model::ApiFile_t* apiFilePtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    GenerateIncludedApis(apiFilePtr);
+
+    if (!buildParams.ifgenCacheDir.empty())
+    {
+        script << "\n"
+                  "  ifgenApis =";
+        GenerateIncludedApis(apiFilePtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Generate C flags.
@@ -174,7 +198,7 @@ void BuildScriptGenerator_t::GenerateIncludedApis
 //--------------------------------------------------------------------------------------------------
 void BuildScriptGenerator_t::GenerateCFlags
 (
-    void
+    bool defineFileName ///< false = leave LE_FILENAME for the compile command to define.
 )
 {
     const std::string& target = buildParams.target;
@@ -199,9 +223,12 @@ void BuildScriptGenerator_t::GenerateCFlags
             " -fvisibility=hidden"; // Prevent exporting of symbols by default.
     }
 
-    script << "  -c $in -o $out "
-        " -DLE_FILENAME=`basename $in`" // Define the file name for the log macros.
-        " -DMK_TOOLS_BUILD"; // Indicate build is being done by the mk tools.
+    script << "  -c $in -o $out ";
+    if (defineFileName)
+    {
+        script << " -DLE_FILENAME=`basename $in`"; // Define the file name for the log macros.
+    }
+    script << " -DMK_TOOLS_BUILD"; // Indicate build is being done by the mk tools.
     if (target != "localhost")
     {
         script << "  -DLEGATO_EMBEDDED";    // Indicate target is an embedded device (not a PC).
@@ -289,6 +316,44 @@ void BuildScriptGenerator_t::GenerateBuildRules
                            // other settings can be overridden
               "\n\n";
 
+    if (buildParams.precompileHeaders &&
+        (buildParams.compilerType == mk::BuildParams_t::COMPILER_GCC))
+    {
+        // Generate rules for precompiling the header included ahead of a component's sources, and
+        // for compiling the sources with it.  GCC only uses a precompiled header if the macros it
+        // refers to are defined the same way as when it was compiled, so LE_FILENAME (which
+        // differs for each source file) is defined after the header, from a generated file.
+        script << "rule CompileCHeader\n"
+                  "  description = Precompiling C header\n"
+                  "  depfile = $out.d\n"
+                  "  command = " << compilerCachePath << " " << cCompilerPath << " -x c-header";
+        GenerateCFlags(false);
+        script << " $cFlags\n\n";
+
+        script << "rule CompileCWithPch\n"
+                  "  description = Compiling C source\n"
+                  "  depfile = $out.d\n"
+                  "  command = echo \"#define LE_FILENAME `basename $in`\" > $out.h && "
+               << compilerCachePath << " " << cCompilerPath;
+        GenerateCFlags(false);
+        script << " -include $pch -include $out.h $cFlags\n\n";
+
+        script << "rule CompileCxxHeader\n"
+                  "  description = Precompiling C++ header\n"
+                  "  depfile = $out.d\n"
+                  "  command = " << compilerCachePath << " " << cxxCompilerPath << " -x c++-header";
+        GenerateCFlags(false);
+        script << " $cxxFlags\n\n";
+
+        script << "rule CompileCxxWithPch\n"
+                  "  description = Compiling C++ source\n"
+                  "  depfile = $out.d\n"
+                  "  command = echo \"#define LE_FILENAME `basename $in`\" > $out.h && "
+               << compilerCachePath << " " << cxxCompilerPath;
+        GenerateCFlags(false);
+        script << " -include $pch -include $out.h $cxxFlags\n\n";
+    }
+
     script << "rule ProcessConfig\n"
         << "  description = Merging config file\n"
         "  depfile = $in.d\n" // Tell ninja where gcc will put the dependencies.
@@ -308,11 +373,19 @@ void BuildScriptGenerator_t::GenerateBuildRules
               "            $externalCommand\n"
               "\n";
 
-    // Generate a rule for running ifgen.
+    // Generate a rule for running ifgen, through the ifgen cache if there is one.
     script << "rule GenInterfaceCode\n"
-              "  description = Generating IPC interface code\n"
-              "  command = ifgen --output-dir $outputDir $ifgenFlags $in\n"
-              "\n";
+              "  description = Generating IPC interface code\n";
+    if (buildParams.ifgenCacheDir.empty())
+    {
+        script << "  command = ifgen-client --output-dir $outputDir $ifgenFlags $in\n";
+    }
+    else
+    {
+        script << "  command = ifgen-cache -c " << buildParams.ifgenCacheDir <<
+                  " -a \"$in $ifgenApis\" -- --output-dir $outputDir $ifgenFlags $in\n";
+    }
+    script << "\n";
 
     // Generate a rule for generating a Python C Extension .c file for an API
     script << "rule GenPyApiCExtension\n"
@@ -67,9 +67,10 @@ class BuildScriptGenerator_t
 
     public:
         virtual void GenerateIncludedApis(const model::ApiFile_t* apiFilePtr);
+        virtual void GenerateIfgenInputs(const model::ApiFile_t* apiFilePtr);
 
         virtual void GenerateIfgenFlags(void);
-        virtual void GenerateCFlags(void);
+        virtual void GenerateCFlags(bool defineFileName = true);
         virtual void GenerateBuildRules(void);
 
         virtual void GenerateNinjaScriptBuildStatement(const std::set<std::string>& dependencies);
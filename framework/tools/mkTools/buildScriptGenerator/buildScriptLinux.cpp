@@ -21,17 +21,23 @@ namespace ninja
 /**
  * Generate Linux C flags.
  *
- * Linux C flags add -fPIC to the generic C flags
+ * Linux C flags add -fPIC to the generic C flags, and -flto when executables are linked
+ * statically with their components.
  */
 //--------------------------------------------------------------------------------------------------
 void LinuxBuildScriptGenerator_t::GenerateCFlags
 (
-    void
+    bool defineFileName ///< false = leave LE_FILENAME for the compile command to define.
 )
 {
-    BuildScriptGenerator_t::GenerateCFlags();
+    BuildScriptGenerator_t::GenerateCFlags(defineFileName);
 
     script << " -fPIC";
+
+    if (buildParams.staticExes)
+    {
+        script << " -flto";
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -66,6 +72,29 @@ void LinuxBuildScriptGenerator_t::GenerateBuildRules
         }
     }
 
+    // Linker flags that make libraries and executables faster to load: GNU hash tables (quicker
+    // symbol look-ups than SysV ones) and optimized string tables.  Component libraries also
+    // keep the symbols of the static libraries linked into them hidden, so the dynamic loader
+    // has fewer symbols to search.
+    // Component libraries aren't linked with -Bsymbolic: some of them provide weak functions
+    // that another library is expected to override.
+    std::string libLoadFlags;
+    std::string exeLoadFlags;
+    if (buildParams.fastLoad)
+    {
+        exeLoadFlags = " -Wl,-O1 -Wl,--hash-style=gnu";
+        libLoadFlags = exeLoadFlags + " -Wl,--exclude-libs,ALL";
+    }
+
+    // Objects are compiled for link-time optimization when executables are linked statically,
+    // so the links must run the optimizer too.  Component libraries are still built from the
+    // same objects, to be bundled and linked against by other apps.
+    if (buildParams.staticExes)
+    {
+        libLoadFlags += " -flto";
+        exeLoadFlags += " -flto";
+    }
+
     // First generate common build rules
     BuildScriptGenerator_t::GenerateBuildRules();
 
@@ -77,7 +106,7 @@ void LinuxBuildScriptGenerator_t::GenerateBuildRules
     {
         script << " -Wl,--build-id -g";
     }
-    script << " -shared -o $out $in $ldFlags";
+    script << " -shared" << libLoadFlags << " -o $out $in $ldFlags";
     if (!buildParams.debugDir.empty())
     {
         script << " $\n"
@@ -93,7 +122,7 @@ void LinuxBuildScriptGenerator_t::GenerateBuildRules
     {
         script << " -Wl,--build-id -g";
     }
-    script << " -shared -o $out $in $ldFlags";
+    script << " -shared" << libLoadFlags << " -o $out $in $ldFlags";
     if (!buildParams.debugDir.empty())
     {
         script << " $\n"
@@ -113,7 +142,7 @@ void LinuxBuildScriptGenerator_t::GenerateBuildRules
     {
       script << " -fPIE -pie";
     }
-    script << " -o $out $in $ldFlags";
+    script << exeLoadFlags << " -o $out $in $ldFlags";
     if (!buildParams.debugDir.empty())
     {
         script << " -g $\n"
@@ -133,7 +162,7 @@ void LinuxBuildScriptGenerator_t::GenerateBuildRules
     {
       script << " -fPIE -pie";
     }
-    script << " -o $out $in $ldFlags";
+    script << exeLoadFlags << " -o $out $in $ldFlags";
     if (!buildParams.debugDir.empty())
     {
         script << " -g $\n"
@@ -26,7 +26,7 @@ namespace ninja
 class LinuxBuildScriptGenerator_t : public BuildScriptGenerator_t
 {
     public:
-        virtual void GenerateCFlags(void) override;
+        virtual void GenerateCFlags(bool defineFileName = true) override;
         virtual void GenerateBuildRules(void) override;
 
     public:
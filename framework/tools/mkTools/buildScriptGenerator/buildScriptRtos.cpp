@@ -28,8 +28,10 @@ void RtosBuildScriptGenerator_t::GenerateIfgenFlags
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // On RTOS, generate local services always
-    script << " --local-service";
+    // On RTOS, generate local services always, and let clients running in a server's own thread
+    // call it directly (they would otherwise wait forever for their own thread to handle the
+    // request).
+    script << " --local-service --direct-dispatch";
 
     // Then call base to generate the rest of the flags.
     BuildScriptGenerator_t::GenerateIfgenFlags();
@@ -101,10 +103,10 @@ void RtosBuildScriptGenerator_t::GenerateBuildRules
 //--------------------------------------------------------------------------------------------------
 void RtosBuildScriptGenerator_t::GenerateCFlags
 (
-    void
+    bool defineFileName ///< false = leave LE_FILENAME for the compile command to define.
 )
 {
-    BuildScriptGenerator_t::GenerateCFlags();
+    BuildScriptGenerator_t::GenerateCFlags(defineFileName);
 
     // Generate per-data & per-function sections so these can be removed if not referenced.
     // ELF file generated is larger, but final link will be smaller when combined with
@@ -27,7 +27,7 @@ class RtosBuildScriptGenerator_t : public BuildScriptGenerator_t
 {
     public:
         virtual void GenerateBuildRules(void) override;
-        virtual void GenerateCFlags(void) override;
+        virtual void GenerateCFlags(bool defineFileName = true) override;
         virtual void GenerateIfgenFlags(void) override;
     public:
         RtosBuildScriptGenerator_t(const std::string scriptPath,
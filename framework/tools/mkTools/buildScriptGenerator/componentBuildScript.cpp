@@ -296,14 +296,29 @@ void ComponentBuildScriptGenerator_t::GetObjectFiles
     model::Component_t* componentPtr
 )
 {
-    // Includes object files compiled from the component's C/C++ source files.
-    for (auto objFilePtr : componentPtr->cObjectFiles)
+    // Includes object files compiled from the component's C/C++ source files, or from the unity
+    // sources that include them.
+    if (code::UsesUnitySource(componentPtr->cObjectFiles, buildParams))
     {
-        script << " $builddir/" << objFilePtr->path;
+        script << " $builddir/" << componentPtr->workingDir << "/obj/_unity.c.o";
     }
-    for (auto objFilePtr : componentPtr->cxxObjectFiles)
+    else
     {
-        script << " $builddir/" << objFilePtr->path;
+        for (auto objFilePtr : componentPtr->cObjectFiles)
+        {
+            script << " $builddir/" << objFilePtr->path;
+        }
+    }
+    if (code::UsesUnitySource(componentPtr->cxxObjectFiles, buildParams))
+    {
+        script << " $builddir/" << componentPtr->workingDir << "/obj/_unity.cpp.o";
+    }
+    else
+    {
+        for (auto objFilePtr : componentPtr->cxxObjectFiles)
+        {
+            script << " $builddir/" << objFilePtr->path;
+        }
     }
 
     // Also includes all the object files for the auto-generated IPC API client and server
@@ -496,14 +511,22 @@ void ComponentBuildScriptGenerator_t::GenerateCSourceBuildStatement
 )
 //--------------------------------------------------------------------------------------------------
 {
+    bool usesPch = code::UsesPrecompiledHeader(componentPtr->cObjectFiles, buildParams);
+    std::string pchPath = "$builddir/" + componentPtr->workingDir + "/src/_pch.h";
+
     // Create the build statement.
     script << "build $builddir/" << objFilePtr->path << ":"
-              " CompileC " << objFilePtr->sourceFilePath;
+              " " << (usesPch ? "CompileCWithPch " : "CompileC ") << objFilePtr->sourceFilePath;
 
-    if (HasExternalDependencies(componentPtr))
+    if (HasExternalDependencies(componentPtr) || usesPch)
     {
         script << " | ";
         GetExternalDependencies(componentPtr);
+
+        if (usesPch)
+        {
+            script << " " << pchPath << ".gch";
+        }
     }
 
     // Add order-only dependencies for all the generated .h files that will be needed by the
@@ -525,7 +548,14 @@ void ComponentBuildScriptGenerator_t::GenerateCSourceBuildStatement
     {
         script << " " << arg;
     }
-    script << "\n\n";
+    script << "\n";
+
+    if (usesPch)
+    {
+        script << "  pch = " << pchPath << "\n";
+    }
+
+    script << "\n";
 }
 
 
@@ -545,14 +575,22 @@ void ComponentBuildScriptGenerator_t::GenerateCxxSourceBuildStatement
 )
 //--------------------------------------------------------------------------------------------------
 {
+    bool usesPch = code::UsesPrecompiledHeader(componentPtr->cxxObjectFiles, buildParams);
+    std::string pchPath = "$builddir/" + componentPtr->workingDir + "/src/_pch.hpp";
+
     // Create the build statement.
     script << "build $builddir/" << objFilePtr->path << ":"
-              " CompileCxx " << objFilePtr->sourceFilePath;
+              " " << (usesPch ? "CompileCxxWithPch " : "CompileCxx ") << objFilePtr->sourceFilePath;
 
-    if (HasExternalDependencies(componentPtr))
+    if (HasExternalDependencies(componentPtr) || usesPch)
     {
         script << " | ";
         GetExternalDependencies(componentPtr);
+
+        if (usesPch)
+        {
+            script << " " << pchPath << ".gch";
+        }
     }
 
     // Add order-only dependencies for all the generated .h files that will be needed by the
@@ -573,6 +611,60 @@ void ComponentBuildScriptGenerator_t::GenerateCxxSourceBuildStatement
     {
         script << " " << arg;
     }
+    script << "\n";
+
+    if (usesPch)
+    {
+        script << "  pch = " << pchPath << "\n";
+    }
+
+    script << "\n";
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print to a given build script a statement for precompiling the header included ahead of a given
+ * component's C or C++ source files.
+ *
+ * The header is compiled with the same flags as the sources, as GCC requires.
+ **/
+//--------------------------------------------------------------------------------------------------
+void ComponentBuildScriptGenerator_t::GeneratePrecompiledHeaderBuildStatement
+(
+    model::Component_t* componentPtr,
+    bool isCxx,                              ///< true = for the C++ sources, false = for C.
+    const std::list<std::string>& apiHeaders ///< IPC API .h files needed by component.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::string pchPath = "$builddir/" + componentPtr->workingDir
+                        + (isCxx ? "/src/_pch.hpp" : "/src/_pch.h");
+
+    // Create the build statement.
+    script << "build " << pchPath << ".gch:"
+              " " << (isCxx ? "CompileCxxHeader " : "CompileCHeader ") << pchPath;
+
+    if (HasExternalDependencies(componentPtr))
+    {
+        script << " | ";
+        GetExternalDependencies(componentPtr);
+    }
+
+    if (!apiHeaders.empty())
+    {
+        script << " || ";
+        std::copy(apiHeaders.begin(), apiHeaders.end(),
+                  std::ostream_iterator<std::string>(script, " "));
+    }
+    script << "\n";
+
+    // Define the cFlags or cxxFlags variable.
+    script << (isCxx ? "  cxxFlags = $cxxFlags" : "  cFlags = $cFlags");
+    GenerateCommonCAndCxxFlags(componentPtr);
+    for (auto& arg : (isCxx ? componentPtr->cxxFlags : componentPtr->cFlags))
+    {
+        script << " " << arg;
+    }
     script << "\n\n";
 }
 
@@ -668,14 +760,42 @@ void ComponentBuildScriptGenerator_t::GenerateBuildStatements
         GetJavaInterfaceFiles(interfaceHeaders, componentPtr);
     }
 
-    // Add build statements for all the component's object files.
-    for (auto objFilePtr : componentPtr->cObjectFiles)
+    // Add build statements for all the component's object files.  In a unity build, the sources
+    // in each language are all compiled together into one object file.
+    if (code::UsesUnitySource(componentPtr->cObjectFiles, buildParams))
+    {
+        model::ObjectFile_t unityObjFile(componentPtr->workingDir + "/obj/_unity.c.o",
+                                         "$builddir/" + componentPtr->workingDir + "/src/_unity.c");
+        GenerateCSourceBuildStatement(componentPtr, &unityObjFile, interfaceHeaders);
+    }
+    else
+    {
+        if (code::UsesPrecompiledHeader(componentPtr->cObjectFiles, buildParams))
+        {
+            GeneratePrecompiledHeaderBuildStatement(componentPtr, false, interfaceHeaders);
+        }
+        for (auto objFilePtr : componentPtr->cObjectFiles)
+        {
+            GenerateCSourceBuildStatement(componentPtr, objFilePtr, interfaceHeaders);
+        }
+    }
+    if (code::UsesUnitySource(componentPtr->cxxObjectFiles, buildParams))
     {
-        GenerateCSourceBuildStatement(componentPtr, objFilePtr, interfaceHeaders);
+        model::ObjectFile_t unityObjFile(componentPtr->workingDir + "/obj/_unity.cpp.o",
+                                         "$builddir/" + componentPtr->workingDir +
+                                         "/src/_unity.cpp");
+        GenerateCxxSourceBuildStatement(componentPtr, &unityObjFile, interfaceHeaders);
     }
-    for (auto objFilePtr : componentPtr->cxxObjectFiles)
+    else
     {
-        GenerateCxxSourceBuildStatement(componentPtr, objFilePtr, interfaceHeaders);
+        if (code::UsesPrecompiledHeader(componentPtr->cxxObjectFiles, buildParams))
+        {
+            GeneratePrecompiledHeaderBuildStatement(componentPtr, true, interfaceHeaders);
+        }
+        for (auto objFilePtr : componentPtr->cxxObjectFiles)
+        {
+            GenerateCxxSourceBuildStatement(componentPtr, objFilePtr, interfaceHeaders);
+        }
     }
 
     if (componentPtr->HasCOrCppCode())
@@ -787,7 +907,7 @@ void ComponentBuildScriptGenerator_t::GenerateTypesOnlyBuildStatement
 
         script << "build $builddir/" << cFiles.interfaceFile << ":"
                   " GenInterfaceCode " << ifPtr->apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(ifPtr->apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(ifPtr->apiFilePtr);
         script << "\n"
                   "  ifgenFlags = --gen-interface"
                   " --name-prefix " << ifPtr->internalName <<
@@ -820,7 +940,7 @@ void ComponentBuildScriptGenerator_t::GenerateJavaTypesOnlyBuildStatement
         script << "build " <<
                   path::Combine(buildParams.workingDir, javaFiles.interfaceSourceFile) << ":"
                   " GenInterfaceCode " << ifPtr->apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(ifPtr->apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(ifPtr->apiFilePtr);
         script << "\n"
                   "  ifgenFlags = --gen-interface --lang Java"
                   " --name-prefix " << ifPtr->internalName << " $ifgenFlags\n"
@@ -853,7 +973,7 @@ void ComponentBuildScriptGenerator_t::GenerateCommonUsetypesBuildStatement
 
         script << "build $builddir/" << cFiles.interfaceFile <<
                   ": GenInterfaceCode " << apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(apiFilePtr);
         script << "\n"
                   "  outputDir = $builddir/" << path::GetContainingDir(cFiles.interfaceFile) << "\n"
                   "  ifgenFlags = --gen-common-interface $ifgenFlags\n"
@@ -883,7 +1003,7 @@ void ComponentBuildScriptGenerator_t::GenerateClientUsetypesBuildStatement
 
         script << "build $builddir/" << headerFile <<
                   ": GenInterfaceCode " << apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(apiFilePtr);
         script << "\n"
                   "  outputDir = $builddir/" << path::GetContainingDir(headerFile) << "\n"
                   "  ifgenFlags = --gen-interface $ifgenFlags\n"
@@ -913,7 +1033,7 @@ void ComponentBuildScriptGenerator_t::GenerateServerUsetypesBuildStatement
 
         script << "build $builddir/" << headerFile <<
                   ": GenInterfaceCode " << apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(apiFilePtr);
         script << "\n"
                   "  outputDir = $builddir/" << path::GetContainingDir(headerFile) << "\n"
                   "  ifgenFlags = --gen-server-interface $ifgenFlags\n"
@@ -1009,7 +1129,7 @@ void ComponentBuildScriptGenerator_t::GenerateCCommonBuildStatement
     {
         script << "build" << generatedFiles << ":"
                   " GenInterfaceCode " << apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(apiFilePtr);
         script << "\n"
                   "  ifgenFlags =" << ifgenFlags << " $ifgenFlags\n"
                   "  outputDir = $builddir/" << path::GetContainingDir(commonFiles.sourceFile) <<
@@ -1039,7 +1159,7 @@ void ComponentBuildScriptGenerator_t::GenerateJavaUsetypesBuildStatement
         generatedIPC.insert(interfaceFile);
         script << "build " << path::Combine(buildParams.workingDir, interfaceFile) <<
                   ": GenInterfaceCode " << apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(apiFilePtr);
         script << "\n"
                   "  outputDir = $builddir/" <<
                   path::Combine(apiFilePtr->codeGenDir, "src") << "\n"
@@ -1140,10 +1260,14 @@ void ComponentBuildScriptGenerator_t::GenerateCBuildStatement
     }
     if (!generatedFiles.empty())
     {
+        if (ifPtr->pipelined)
+        {
+            ifgenFlags += " --pipelined-client";
+        }
         ifgenFlags += " --name-prefix " + ifPtr->internalName;
         script << "build" << generatedFiles <<
                   ": GenInterfaceCode " << ifPtr->apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(ifPtr->apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(ifPtr->apiFilePtr);
         script << "\n"
                   "  ifgenFlags =" << ifgenFlags << " $ifgenFlags\n"
                   "  outputDir = $builddir/" << path::GetContainingDir(cFiles.sourceFile) << "\n\n";
@@ -1192,7 +1316,7 @@ void ComponentBuildScriptGenerator_t::GenerateJavaBuildStatement
     script << "build " << generatedFiles << ": $\n"
               "      GenInterfaceCode " << apiFilePtr->path << " | ";
 
-    baseGeneratorPtr->GenerateIncludedApis(apiFilePtr);
+    baseGeneratorPtr->GenerateIfgenInputs(apiFilePtr);
 
     script << "\n"
               "  ifgenFlags = --lang Java" << requiredFlags << " --name-prefix "
@@ -1247,7 +1371,7 @@ void ComponentBuildScriptGenerator_t::GeneratePythonBuildStatement
               "      " << path::Combine(outputDir, pythonFiles.wrapperSourceFile) << " : $\n"
               "      GenInterfaceCode " << apiFilePtr->path << " | ";
 
-    baseGeneratorPtr->GenerateIncludedApis(apiFilePtr);
+    baseGeneratorPtr->GenerateIfgenInputs(apiFilePtr);
     script << "\n"
               "  ifgenFlags = --lang Python " << apiFlag << " --name-prefix "
            << internalName << " $ifgenFlags\n"
@@ -1268,7 +1392,7 @@ void ComponentBuildScriptGenerator_t::GeneratePythonBuildStatement
         script << "build " << pyCdefSourceFilePath << " : $\n"
                   "      GenInterfaceCode " << includedApiPtr->path << " | ";
 
-        baseGeneratorPtr->GenerateIncludedApis(includedApiPtr);
+        baseGeneratorPtr->GenerateIfgenInputs(includedApiPtr);
         // cffi cdef.h files generated in folder includedApi
         script << "\n"
                   "  ifgenFlags = --lang Python " << apiFlag << " --name-prefix "
@@ -1435,10 +1559,14 @@ void ComponentBuildScriptGenerator_t::GenerateCBuildStatement
         {
             ifgenFlags += " --allow-direct";
         }
+        if (ifPtr->parallel)
+        {
+            ifgenFlags += " --parallel-server";
+        }
         ifgenFlags += " --name-prefix " + ifPtr->internalName;
         script << "build" << generatedFiles << ":"
                   " GenInterfaceCode " << ifPtr->apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(ifPtr->apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(ifPtr->apiFilePtr);
         script << "\n"
                   "  ifgenFlags =" << ifgenFlags << " $ifgenFlags\n"
                   "  outputDir = $builddir/" << path::GetContainingDir(cFiles.sourceFile) << "\n"
@@ -27,7 +27,6 @@ class ComponentBuildScriptGenerator_t : protected RequireBaseGenerator_t
     protected:
         virtual void GetImplicitDependencies(model::Component_t* componentPtr);
         virtual void GetExternalDependencies(model::Component_t* componentPtr);
-        virtual void GetObjectFiles(model::Component_t* componentPtr);
 
         virtual void GenerateTypesOnlyBuildStatement(const model::ApiTypesOnlyInterface_t* ifPtr);
         virtual void GenerateJavaTypesOnlyBuildStatement(const model::ApiTypesOnlyInterface_t* ifPtr);
@@ -88,6 +87,9 @@ class ComponentBuildScriptGenerator_t : protected RequireBaseGenerator_t
         virtual void GenerateCxxSourceBuildStatement(model::Component_t* componentPtr,
                                                      const model::ObjectFile_t* objFilePtr,
                                                      const std::list<std::string>& apiHeaders);
+        virtual void GeneratePrecompiledHeaderBuildStatement(model::Component_t* componentPtr,
+                                                             bool isCxx,
+                                                             const std::list<std::string>& apiHeaders);
         virtual void GenerateJavaBuildCommand(const std::string& outputJar,
                                               const std::string& classDestPath,
                                               const std::list<std::string>& sources,
@@ -107,6 +109,7 @@ class ComponentBuildScriptGenerator_t : protected RequireBaseGenerator_t
         virtual void Generate(model::Component_t* componentPtr);
         virtual void GenerateBuildRules(void);
 
+        virtual void GetObjectFiles(model::Component_t* componentPtr);
         virtual void GetCommonApiFiles(model::Component_t* componentPtr,
                                        std::set<std::string> &commonApiObjects);
 
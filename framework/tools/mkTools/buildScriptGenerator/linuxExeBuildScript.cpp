@@ -29,7 +29,22 @@ std::string LinuxExeBuildScriptGenerator_t::GetLinkRule
 )
 //--------------------------------------------------------------------------------------------------
 {
-    if (exePtr->cxxObjectFiles.empty())
+    bool hasCxxCode = !exePtr->cxxObjectFiles.empty();
+
+    // When the components are linked into the executable, the C++ runtime is needed if any of
+    // them has C++ code.
+    if (buildParams.staticExes)
+    {
+        for (auto componentInstancePtr : exePtr->componentInstances)
+        {
+            if (!componentInstancePtr->componentPtr->cxxObjectFiles.empty())
+            {
+                hasCxxCode = true;
+            }
+        }
+    }
+
+    if (!hasCxxCode)
     {
         return "LinkCExe";
     }
@@ -81,8 +96,9 @@ void LinuxExeBuildScriptGenerator_t::GetDependentLibLdFlags
         auto componentPtr = (*i)->componentPtr;
         auto& lib = componentPtr->GetTargetInfo<target::LinuxComponentInfo_t>()->lib;
 
-        // If the component has itself been built into a library, link with that.
-        if (lib != "")
+        // If the component has itself been built into a library, link with that (unless its
+        // object files are linked into the executable).
+        if ((lib != "") && !buildParams.staticExes)
         {
             script << " \"-L" << path::GetContainingDir(lib) << "\"";
 
@@ -137,6 +153,30 @@ void LinuxExeBuildScriptGenerator_t::GenerateBuildStatement
         script << " $builddir/" << objFilePtr->path;
     }
 
+    // When linking statically, link in the components' .o files too, in place of their shared
+    // libraries.  The common IPC API client files can be shared by several components, so only
+    // link them once.
+    if (buildParams.staticExes)
+    {
+        std::set<std::string> commonApiObjects;
+
+        for (auto componentInstancePtr : exePtr->componentInstances)
+        {
+            auto componentPtr = componentInstancePtr->componentPtr;
+
+            if (componentPtr->HasCOrCppCode())
+            {
+                componentGeneratorPtr->GetObjectFiles(componentPtr);
+                componentGeneratorPtr->GetCommonApiFiles(componentPtr, commonApiObjects);
+            }
+        }
+
+        for (const auto& commonApiObject : commonApiObjects)
+        {
+            script << " $builddir/" << commonApiObject;
+        }
+    }
+
     // Declare the exe's (implicit) dependencies, including all the components' shared libraries
     // and liblegato.  Collect a set of static libraries needed by the components, while we are
     // looking at them.
@@ -147,7 +187,10 @@ void LinuxExeBuildScriptGenerator_t::GenerateBuildStatement
         for (auto componentInstancePtr : exePtr->componentInstances)
         {
             auto componentPtr = componentInstancePtr->componentPtr;
-            script << " " << componentPtr->GetTargetInfo<target::LinuxComponentInfo_t>()->lib;
+            if (!buildParams.staticExes)
+            {
+                script << " " << componentPtr->GetTargetInfo<target::LinuxComponentInfo_t>()->lib;
+            }
 
             for (const auto& dependency : componentPtr->implicitDependencies)
             {
@@ -160,8 +203,16 @@ void LinuxExeBuildScriptGenerator_t::GenerateBuildStatement
             }
         }
     }
-    script << " " << path::Combine(envVars::Get("LEGATO_ROOT"),
-                                   "build/$target/framework/lib/liblegato.so");
+    if (buildParams.staticExes)
+    {
+        script << " " << path::Combine(envVars::Get("LEGATO_ROOT"),
+                                       "build/$target/framework/lib-static/liblegato.a");
+    }
+    else
+    {
+        script << " " << path::Combine(envVars::Get("LEGATO_ROOT"),
+                                       "build/$target/framework/lib/liblegato.so");
+    }
     script << "\n";
 
     // Define an exe-specific ldFlags variable that adds all the components' and interfaces'
@@ -170,8 +221,11 @@ void LinuxExeBuildScriptGenerator_t::GenerateBuildStatement
 
     // Make the executable able to export symbols to dynamic shared libraries that get loaded.
     // This is needed so the executable can define executable-specific interface name variables
-    // for component libraries to use.
-    script << " -rdynamic";
+    // for component libraries to use.  Not needed when the components are linked in.
+    if (!buildParams.staticExes)
+    {
+        script << " -rdynamic";
+    }
 
     // Set the DT_RUNPATH variable inside the executable's ELF headers to include the expected
     // on-target runtime locations of the libraries needed.
@@ -200,8 +254,17 @@ void LinuxExeBuildScriptGenerator_t::GenerateBuildStatement
     // Include another list of -l directives for all the libraries the executable needs.
     GetDependentLibLdFlags(exePtr);
 
-    // Link with the standard runtime libs.
-    script << " \"-L$$LEGATO_BUILD/framework/lib\" -llegato -lpthread -lrt -ldl -lm";
+    // Link with the standard runtime libs.  When linking statically, pull liblegato's
+    // constructor in from the archive, as nothing refers to it.
+    if (buildParams.staticExes)
+    {
+        script << " -Wl,--undefined=_legato_InitFramework"
+                  " $$LEGATO_BUILD/framework/lib-static/liblegato.a -lpthread -lrt -ldl -lm";
+    }
+    else
+    {
+        script << " \"-L$$LEGATO_BUILD/framework/lib\" -llegato -lpthread -lrt -ldl -lm";
+    }
 
     // Add ldFlags from earlier definition.
     script << " $ldFlags\n"
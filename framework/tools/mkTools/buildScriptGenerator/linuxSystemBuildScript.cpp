@@ -143,7 +143,10 @@ void LinuxSystemBuildScriptGenerator_t::GenerateSystemBuildRules
     // as part of the MD5 hash.
     "            md5=$$( ( cd $stagingDir && $\n"
     "                      find -P -print0 |LC_ALL=C sort -z && $\n"
-    "                      find -P -type f -print0 |LC_ALL=C sort -z |xargs -0 md5sum && $\n"
+    // Files are hashed in parallel, and the sums sorted back into path order so the
+    // result is the same as hashing them one after the other.
+    "                      find -P -type f -print0 |LC_ALL=C sort -z $\n"
+    "                        |xargs -0 -P $$(nproc) -n 32 md5sum |LC_ALL=C sort -k 2 && $\n"
     "                      find -P -type l -print0 |LC_ALL=C sort -z |xargs -0 -r -n 1 readlink $\n"
     "                    ) |tee /proc/self/fd/2 | md5sum) && $\n"
     "            md5=$${md5%% *} && $\n"
@@ -247,7 +250,10 @@ void LinuxSystemBuildScriptGenerator_t::GenerateSystemBuildRules
         // of symlinks as part of the MD5 hash.
         "            md5signed=$$( ( cd $stagingDir.signed && $\n"
         "                      find -P -print0 |LC_ALL=C sort -z && $\n"
-        "                      find -P -type f -print0 |LC_ALL=C sort -z |xargs -0 md5sum && $\n"
+        // Files are hashed in parallel, and the sums sorted back into path order so the
+        // result is the same as hashing them one after the other.
+        "                      find -P -type f -print0 |LC_ALL=C sort -z $\n"
+        "                        |xargs -0 -P $$(nproc) -n 32 md5sum |LC_ALL=C sort -k 2 && $\n"
         "                      find -P -type l -print0 |LC_ALL=C sort -z "
                                "|xargs -0 -r -n 1 readlink $\n"
         "                    ) | md5sum) && $\n"
@@ -313,7 +319,7 @@ void LinuxSystemBuildScriptGenerator_t::GenerateRpcCfgReferences
 
         script << "build  $builddir/" << apiRefFile << ": GenInterfaceCode "
                << apiRef.second->ifPtr->apiFilePtr->path << " |";
-        baseGeneratorPtr->GenerateIncludedApis(apiRef.second->ifPtr->apiFilePtr);
+        baseGeneratorPtr->GenerateIfgenInputs(apiRef.second->ifPtr->apiFilePtr);
         script <<
             "\n"
             "  outputDir = $builddir/" << path::GetContainingDir(apiRefFile) << "\n"
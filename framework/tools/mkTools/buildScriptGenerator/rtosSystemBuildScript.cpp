@@ -45,6 +45,14 @@ void RtosSystemBuildScriptGenerator_t::GenerateSystemBuildRules
         "    done; $\n"
         "    touch $out\n"
         "\n";
+
+    // List the memory reserved by the static pools, reference maps and hash maps of each
+    // component.
+    script <<
+        "rule StaticMemMap\n"
+        "  description = Mapping static memory\n"
+        "  command = static-mem-map -o $out $objects\n"
+        "\n";
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -264,6 +272,34 @@ void RtosSystemBuildScriptGenerator_t::GenerateSystemPackBuildStatement
 
     GenerateLdFlags();
 
+    // Map the static memory of each component, and of the Legato runtime library.
+    script << "build "
+           << path::MakeAbsolute(path::Combine(buildParams.outputDir, "$target.mem.txt"))
+           << ": StaticMemMap";
+    for (auto& componentEntry : model::Component_t::GetComponentMap())
+    {
+        auto componentPtr = componentEntry.second;
+
+        if (componentPtr->HasCOrCppCode())
+        {
+            script << " " << componentPtr->GetTargetInfo<target::RtosComponentInfo_t>()->staticlib;
+        }
+    }
+    script << "\n"
+              "  objects =";
+    for (auto& componentEntry : model::Component_t::GetComponentMap())
+    {
+        auto componentPtr = componentEntry.second;
+
+        if (componentPtr->HasCOrCppCode())
+        {
+            script << " " << componentPtr->name << "="
+                   << componentPtr->GetTargetInfo<target::RtosComponentInfo_t>()->staticlib;
+        }
+    }
+    script << " legato=$$LEGATO_BUILD/framework/lib-static/liblegato.a\n"
+              "\n";
+
     // Pack each app in the system into the RFS image.  On RTOS RFS only includes
     // bundled files, not libraries or executables
     script <<
@@ -54,6 +54,42 @@ void GenerateRtosComponentMainFile
     const mk::BuildParams_t& buildParams
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a component's C (or C++) sources are compiled as one, through a unity source.
+ **/
+//--------------------------------------------------------------------------------------------------
+bool UsesUnitySource
+(
+    const std::list<model::ObjectFile_t*>& objectFiles,
+    const mk::BuildParams_t& buildParams
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a component's C (or C++) sources are compiled with a precompiled legato.h.
+ **/
+//--------------------------------------------------------------------------------------------------
+bool UsesPrecompiledHeader
+(
+    const std::list<model::ObjectFile_t*>& objectFiles,
+    const mk::BuildParams_t& buildParams
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate the unity sources and the headers to precompile used to build a given component.
+ **/
+//--------------------------------------------------------------------------------------------------
+void GenerateComponentUnitySources
+(
+    const model::Component_t* componentPtr,
+    const mk::BuildParams_t& buildParams
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Generate an _main.c file for a given executable.
@@ -86,13 +86,7 @@ void GenerateCLangComponentMainFile
 
     // Open the .c file for writing.
     file::MakeDir(outputDir);
-    std::ofstream fileStream(filePath, std::ofstream::trunc);
-    if (!fileStream.is_open())
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Failed to open file '%s' for writing."), filePath)
-        );
-    }
+    file::GeneratedFileStream_t fileStream(filePath);
 
     // Generate file header and #include directives.
     fileStream << "/*\n"
@@ -142,13 +136,24 @@ void GenerateCLangComponentMainFile
                   "}\n"
                   "// Component initialization function (COMPONENT_INIT).\n"
                   "COMPONENT_INIT;\n"
-                  "\n"
+                  "\n";
 
-    // Define the library initialization function to be run by the dynamic linker/loader.
-                  "// Library initialization function.\n"
-                  "// Will be called by the dynamic linker loader when the library is loaded.\n"
-                  "__attribute__((constructor)) void _" << compName << "_Init(void)\n"
-                  "{\n"
+    // Define the library initialization function to be run by the dynamic linker/loader, or, if
+    // the component is linked statically into its executables, by their main().
+    if (buildParams.staticExes)
+    {
+        fileStream << "// Component initialization function.\n"
+                      "// Will be called by the executable's main() function.\n"
+                      "void _" << compName << "_Init(void)\n";
+    }
+    else
+    {
+        fileStream << "// Library initialization function.\n"
+                      "// Will be called by the dynamic linker loader when the library is loaded.\n"
+                      "__attribute__((constructor)) void _" << compName << "_Init(void)\n";
+    }
+
+    fileStream << "{\n"
                   "    LE_DEBUG(\"Initializing " << compName << " component library.\");\n"
                   "\n";
 
@@ -218,6 +223,8 @@ void GenerateCLangComponentMainFile
                   "#ifdef __cplusplus\n"
                   "}\n"
                   "#endif\n";
+
+    fileStream.Commit();
 }
 
 
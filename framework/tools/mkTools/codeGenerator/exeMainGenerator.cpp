@@ -42,13 +42,7 @@ void GenerateCLangExeMain
 
     // Open the file as an output stream.
     file::MakeDir(path::GetContainingDir(sourceFile));
-    std::ofstream outputFile(sourceFile);
-    if (outputFile.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), sourceFile)
-        );
-    }
+    file::GeneratedFileStream_t outputFile(sourceFile);
 
     // Generate the file header comment and #include directives.
     outputFile << "\n"
@@ -98,6 +92,25 @@ void GenerateCLangExeMain
                   "LE_SHARED le_log_Level_t* " << defaultCompName << "_LogLevelFilterPtr;\n"
                   "\n";
 
+    // When the components are linked into the executable, declare their initialization
+    // functions, which main() calls in place of loading their libraries.
+    if (buildParams.staticExes)
+    {
+        outputFile << "// Declare components' initialization functions.\n";
+
+        for (auto componentInstancePtr : exePtr->componentInstances)
+        {
+            auto componentPtr = componentInstancePtr->componentPtr;
+
+            if (!componentPtr->GetTargetInfo<target::LinuxComponentInfo_t>()->lib.empty())
+            {
+                outputFile << "void _" << componentPtr->name << "_Init(void);\n";
+            }
+        }
+
+        outputFile << "\n";
+    }
+
     // Generate forward declaration of the default component's COMPONENT_INIT function.
     // If there are C/C++ source files other than the _main.c file,
     if ((!exePtr->cObjectFiles.empty()) || (!exePtr->cxxObjectFiles.empty()))
@@ -137,6 +150,12 @@ void GenerateCLangExeMain
     // Define main().
                   "int main(int argc, const char* argv[])\n"
                   "{\n"
+                  "    // An executable built with LE_SINGLE_THREADED must declare itself\n"
+                  "    // single-threaded before anything else can run.\n"
+                  "    #ifdef LE_SINGLE_THREADED\n"
+                  "        le_thread_SetSingleThreaded();\n"
+                  "    #endif\n"
+                  "\n"
                   "    // Pass the args to the Command Line Arguments API.\n"
                   "    le_arg_SetArgs((size_t)argc, argv);\n"
 
@@ -180,7 +199,16 @@ void GenerateCLangExeMain
 
         std::string componentLib = componentPtr->GetTargetInfo<target::LinuxComponentInfo_t>()->lib;
 
-        if (!componentLib.empty())
+        if (componentLib.empty())
+        {
+            continue;
+        }
+
+        if (buildParams.staticExes)
+        {
+            outputFile << "    _" << componentPtr->name << "_Init();\n";
+        }
+        else
         {
             outputFile << "    LoadLib(\"" << path::GetLastNode(componentLib) << "\");\n";
         }
@@ -213,7 +241,7 @@ void GenerateCLangExeMain
                   "    LE_FATAL(\"== SHOULDN'T GET HERE! ==\");\n"
                   "}\n";
 
-    outputFile.close();
+    outputFile.Commit();
 }
 
 
@@ -30,13 +30,7 @@ void GenerateJavaExeMain
 
     // Open the file as an output stream.
     file::MakeDir(path::GetContainingDir(sourceFile));
-    std::ofstream outputFile(sourceFile);
-    if (outputFile.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), sourceFile)
-        );
-    }
+    file::GeneratedFileStream_t outputFile(sourceFile);
 
     auto& exeName = exePtr->name;
     auto& appName = exePtr->appPtr->name;
@@ -116,6 +110,8 @@ void GenerateJavaExeMain
                   "        }\n"
                   "    }\n"
                   "}\n";
+
+    outputFile.Commit();
 }
 
 
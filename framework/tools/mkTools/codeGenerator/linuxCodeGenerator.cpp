@@ -70,6 +70,7 @@ void GenerateLinuxComponentMainFile
     if (componentPtr->HasCOrCppCode())
     {
         GenerateCLangComponentMainFile(componentPtr, buildParams);
+        GenerateComponentUnitySources(componentPtr, buildParams);
     }
     else if (componentPtr->HasJavaCode())
     {
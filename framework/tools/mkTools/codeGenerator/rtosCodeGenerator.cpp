@@ -131,13 +131,7 @@ void GenerateRtosComponentMainFile
 
     // Open the .c file for writing.
     file::MakeDir(outputDir);
-    std::ofstream fileStream(filePath, std::ofstream::trunc);
-    if (!fileStream.is_open())
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Failed to open file '%s' for writing."), filePath)
-        );
-    }
+    file::GeneratedFileStream_t fileStream(filePath);
 
     // Generate file header and #include directives,
     // define the default component's log session variables,
@@ -280,6 +274,10 @@ void GenerateRtosComponentMainFile
     }
 
     fileStream << "}\n";
+
+    fileStream.Commit();
+
+    GenerateComponentUnitySources(componentPtr, buildParams);
 }
 
 
@@ -337,9 +335,11 @@ void GenerateRtosExeMain
     std::string mainFuncName = exeFullName + "_Main";
     std::string serviceInitFuncName =
         exeFullName + "InitEarly";
+    std::string startFuncName = exeFullName + "_Start";
 
     exePtr->GetTargetInfo<target::RtosExeInfo_t>()->entryPoint = mainFuncName;
     exePtr->GetTargetInfo<target::RtosExeInfo_t>()->initFunc = serviceInitFuncName;
+    exePtr->GetTargetInfo<target::RtosExeInfo_t>()->startFunc = startFuncName;
 
     auto sourceFile = exePtr->MainObjectFile().sourceFilePath;
 
@@ -353,13 +353,7 @@ void GenerateRtosExeMain
 
     // Open the file as an output stream.
     file::MakeDir(path::GetContainingDir(sourceFile));
-    std::ofstream outputFile(sourceFile);
-    if (outputFile.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), sourceFile)
-        );
-    }
+    file::GeneratedFileStream_t outputFile(sourceFile);
 
     // Generate common prefix for executable main source.
     outputFile << "// Startup code for the executable '" << exeName << "'.\n"
@@ -501,19 +495,10 @@ void GenerateRtosExeMain
         "}\n"
         "\n";
 
-    // Define main task function.
-    outputFile << "LE_SHARED void* " << mainFuncName << "(void* args)\n"
-                  "{\n"
-                  "    TaskInfo_t* taskInfo = args;\n"
-                  "\n"
-
-    // Set component instance map
-                  "    _le_thread_SetCDataInstancePtr(componentDataMap);\n"
-    // Set arguments
-                  "    LE_DEBUG(\"Starting " << mainFuncName << ".  taskInfo=%p with %d arguments\",\n"
-                  "             taskInfo, taskInfo->argc);\n"
-                  "    le_arg_SetArgs(taskInfo->argc, taskInfo->argv);\n"
-                  "\n";
+    // Define function to initialize the components in the calling task.  This is done by the
+    // executable's own task, or by the task of the task group it shares a task with.
+    outputFile << "LE_SHARED void " << startFuncName << "(void)\n"
+                  "{\n";
 
     // Set bindings and initialize included components for C/C++ components
     for (auto componentInstancePtr : exePtr->componentInstances)
@@ -576,6 +561,25 @@ void GenerateRtosExeMain
                       "    le_event_QueueFunction(&COMPONENT_INIT_NAME, NULL, NULL);\n";
     }
 
+    outputFile << "}\n"
+                  "\n";
+
+    // Define main task function.
+    outputFile << "LE_SHARED void* " << mainFuncName << "(void* args)\n"
+                  "{\n"
+                  "    TaskInfo_t* taskInfo = args;\n"
+                  "\n"
+
+    // Set component instance map
+                  "    _le_thread_SetCDataInstancePtr(componentDataMap);\n"
+    // Set arguments
+                  "    LE_DEBUG(\"Starting " << mainFuncName << ".  taskInfo=%p with %d arguments\",\n"
+                  "             taskInfo, taskInfo->argc);\n"
+                  "    le_arg_SetArgs(taskInfo->argc, taskInfo->argv);\n"
+                  "\n"
+                  "    " << startFuncName << "();\n"
+                  "\n";
+
     // Start the event loop
     outputFile << "    LE_DEBUG(\"== Starting Event Processing Loop ==\");\n"
                   "    le_event_RunLoop();\n"
@@ -583,7 +587,7 @@ void GenerateRtosExeMain
                   "    return NULL;\n"
                   "}\n";
 
-    outputFile.close();
+    outputFile.Commit();
 }
 
 
@@ -140,13 +140,7 @@ void GenerateLinkerScript
 
     // Open the file as an output stream.
     file::MakeDir(path::GetContainingDir(linkerScriptFile));
-    std::ofstream outputFile(linkerScriptFile);
-    if (outputFile.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), linkerScriptFile)
-        );
-    }
+    file::GeneratedFileStream_t outputFile(linkerScriptFile);
 
     if (buildParams.compilerType == mk::BuildParams_t::COMPILER_GCC)
     {
@@ -156,6 +150,8 @@ void GenerateLinkerScript
     {
         GenerateArmLinkerScript(outputFile, systemPtr, buildParams);
     }
+
+    outputFile.Commit();
 }
 
 } // end namespace code
@@ -185,6 +185,218 @@ void GenerateProcessList
                << "TaskInfo[" << processCount << "];\n";
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Collect the apps of each task group in a system.
+ *
+ * @return Map of task group names to the apps in the group.
+ */
+//--------------------------------------------------------------------------------------------------
+static std::map<std::string, std::list<model::App_t*>> GetTaskGroups
+(
+    model::System_t* systemPtr
+)
+{
+    std::map<std::string, std::list<model::App_t*>> taskGroups;
+
+    for (auto& appItem : systemPtr->apps)
+    {
+        auto appPtr = appItem.second;
+
+        if (appPtr->taskGroup.empty())
+        {
+            continue;
+        }
+
+        // The task group is listed along with the apps by the microSupervisor.
+        if (systemPtr->apps.find(appPtr->taskGroup) != systemPtr->apps.end())
+        {
+            throw mk::Exception_t(
+                mk::format(LE_I18N("Task group '%s' of app '%s' has the same name as an app."),
+                           appPtr->taskGroup, appPtr->name)
+            );
+        }
+
+        taskGroups[appPtr->taskGroup].push_back(appPtr);
+    }
+
+    return taskGroups;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate the shared task of a task group in tasks.c.
+ *
+ * The task starts the processes of all the apps in the group one after the other, which then
+ * share the task's stack and event loop: their event handlers are run one at a time, each one
+ * running to completion before the next one is called.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GenerateTaskGroup
+(
+    std::ostream &outputFile,
+    const std::string& groupName,
+    const std::list<model::App_t*>& appList
+)
+{
+    std::string taskName = "_group_" + groupName;
+    std::map<int, int> componentDataMap;
+    std::list<std::string> startFuncs;
+    const model::Priority_t* priorityPtr = NULL;
+    int priority = model::Priority_t::MEDIUM;
+    size_t stackBytes = 0;
+
+    for (auto appPtr : appList)
+    {
+        for (auto processEnvPtr : appPtr->processEnvs)
+        {
+            // The task runs at the highest priority of the processes, with the largest of their
+            // stacks, as only one of them runs at a time.
+            auto& startPriority = processEnvPtr->GetStartPriority();
+            if (startPriority.IsSet() && (startPriority.GetNumericalValue() > priority))
+            {
+                priorityPtr = &startPriority;
+                priority = startPriority.GetNumericalValue();
+            }
+            if (processEnvPtr->maxStackBytes.IsSet() &&
+                (processEnvPtr->maxStackBytes.Get() > stackBytes))
+            {
+                stackBytes = processEnvPtr->maxStackBytes.Get();
+            }
+
+            for (auto processPtr : processEnvPtr->processes)
+            {
+                auto exePtr = appPtr->executables[model::Exe_t::NameFromPath(processPtr->exePath)];
+
+                if (!processPtr->commandLineArgs.empty())
+                {
+                    throw mk::Exception_t(
+                        mk::format(LE_I18N("Process '%s' of app '%s' can't be in task group '%s'"
+                                           " because it has command-line arguments."),
+                                   processPtr->GetName(), appPtr->name, groupName)
+                    );
+                }
+
+                auto& startFunc = exePtr->GetTargetInfo<target::RtosExeInfo_t>()->startFunc;
+                if (startFunc.empty())
+                {
+                    continue;
+                }
+                startFuncs.push_back(startFunc);
+
+                // There is a single component instance map for the task, so a component can only
+                // be used once in the whole group.
+                for (auto componentInstancePtr : exePtr->componentInstances)
+                {
+                    auto componentPtr = componentInstancePtr->componentPtr;
+
+                    if (!componentPtr->HasCOrCppCode())
+                    {
+                        continue;
+                    }
+
+                    auto componentInfoPtr =
+                        componentPtr->GetTargetInfo<target::RtosComponentInfo_t>();
+                    if (componentInfoPtr->globalUsage == 0)
+                    {
+                        continue;
+                    }
+
+                    if (componentDataMap.find(componentInfoPtr->componentKey) !=
+                        componentDataMap.end())
+                    {
+                        throw mk::Exception_t(
+                            mk::format(LE_I18N("Component '%s' is used more than once in task"
+                                               " group '%s'."),
+                                       componentPtr->name, groupName)
+                        );
+                    }
+                    componentDataMap[componentInfoPtr->componentKey] =
+                        componentInstancePtr->
+                            GetTargetInfo<target::RtosComponentInstanceInfo_t>()->instanceNum;
+                }
+            }
+        }
+    }
+
+    outputFile <<
+        "////////////////////////////////////////////////////////////////\n"
+        "// Shared task for task group '" << groupName << "'\n"
+        "#if LE_CONFIG_STATIC_THREAD_STACKS\n"
+        "// Stack for task group " << groupName << "\n"
+        "LE_THREAD_DEFINE_STATIC_STACK(" << taskName << ", " << stackBytes << ");\n"
+        "#endif /* end LE_CONFIG_STATIC_THREAD_STACKS */\n"
+        "\n"
+        "// Component instances of all the processes in the task group\n"
+        "static const _le_cdata_MapEntry_t " << taskName << "_ComponentDataMap[] =\n"
+        "{\n";
+    for (auto& entry : componentDataMap)
+    {
+        outputFile << "    { " << entry.first << ", " << entry.second << " },\n";
+    }
+    outputFile <<
+        "    { -1, -1 }\n"
+        "};\n"
+        "\n"
+        "// Arguments for task group " << groupName << "\n"
+        "static const char* " << taskName << "_Args[] =\n"
+        "{\n"
+        "    NULL\n"
+        "};\n"
+        "\n"
+        "// Entry point for task group " << groupName << "\n"
+        "static void* " << taskName << "_Main(void* args)\n"
+        "{\n"
+        "    TaskInfo_t* taskInfo = args;\n"
+        "\n"
+        "    _le_thread_SetCDataInstancePtr(" << taskName << "_ComponentDataMap);\n"
+        "    le_arg_SetArgs(taskInfo->argc, taskInfo->argv);\n"
+        "\n";
+    for (auto& startFunc : startFuncs)
+    {
+        outputFile << "    " << startFunc << "();\n";
+    }
+    outputFile <<
+        "\n"
+        "    le_event_RunLoop();\n"
+        "    LE_FATAL(\"== SHOULDN'T GET HERE! ==\");\n"
+        "    return NULL;\n"
+        "}\n"
+        "\n"
+        "static Task_t " << taskName << "Tasks[1] =\n"
+        "{\n"
+        "    {\n"
+        "        .nameStr = \"" << groupName << "\",\n"
+        "        .priority = ";
+    if (priorityPtr != NULL)
+    {
+        outputFile << *priorityPtr;
+    }
+    else
+    {
+        outputFile << "LE_THREAD_PRIORITY_MEDIUM";
+    }
+    outputFile << ",\n"
+        "#if LE_CONFIG_STATIC_THREAD_STACKS\n"
+        "        .stackSize = sizeof(_thread_stack_" << taskName << "),\n"
+        "        .stackPtr = _thread_stack_" << taskName << ",\n"
+        "#else /* !LE_CONFIG_STATIC_THREAD_STACKS */\n"
+        "        .stackSize = " << stackBytes << ",\n"
+        "        .stackPtr = NULL,\n"
+        "#endif /* end !LE_CONFIG_STATIC_THREAD_STACKS */\n"
+        "        .entryPoint = " << taskName << "_Main,\n"
+        "        .defaultArgc = 0,\n"
+        "        .defaultArgv = " << taskName << "_Args,\n"
+        "        .watchdogTimeout = 0,\n"
+        "        .maxWatchdogTimeout = 0,\n"
+        "    },\n"
+        "};\n"
+        "\n"
+        "// ThreadInfo list for task group '" << groupName << "'\n"
+        "static TaskInfo_t " << taskName << "TaskInfo[1];\n";
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Generate a tasks.c for tasks in a given system.
@@ -197,16 +409,11 @@ void GenerateRtosSystemTasks
 )
 {
     auto sourceFile = path::Combine(buildParams.workingDir, "src/tasks.c");
+    auto taskGroups = GetTaskGroups(systemPtr);
 
     // Open the file as an output stream.
     file::MakeDir(path::GetContainingDir(sourceFile));
-    std::ofstream outputFile(sourceFile);
-    if (outputFile.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), sourceFile)
-        );
-    }
+    file::GeneratedFileStream_t outputFile(sourceFile);
 
     // Generate the file header comment and #include directives.
     outputFile << "\n"
@@ -230,6 +437,15 @@ void GenerateRtosSystemTasks
             outputFile <<
                 "extern void* " << exePtr->GetTargetInfo<target::RtosExeInfo_t>()->entryPoint <<
                     "(void* args);\n";
+
+            // Apps in a task group are started by the group's task.
+            if (!appPtr->taskGroup.empty() &&
+                !exePtr->GetTargetInfo<target::RtosExeInfo_t>()->startFunc.empty())
+            {
+                outputFile <<
+                    "extern void " << exePtr->GetTargetInfo<target::RtosExeInfo_t>()->startFunc <<
+                        "(void);\n";
+            }
         }
     }
     outputFile << "\n";
@@ -239,6 +455,12 @@ void GenerateRtosSystemTasks
     {
         auto appPtr = appItem.second;
 
+        // The processes of apps in a task group have no task of their own.
+        if (!appPtr->taskGroup.empty())
+        {
+            continue;
+        }
+
         outputFile <<
             "////////////////////////////////////////////////////////////////\n"
             "// Tasks for app '" << appPtr->name << "'\n";
@@ -286,6 +508,11 @@ void GenerateRtosSystemTasks
         GenerateProcessList(outputFile, appPtr);
     }
 
+    for (auto& groupItem : taskGroups)
+    {
+        GenerateTaskGroup(outputFile, groupItem.first, groupItem.second);
+    }
+
     // Generate app list
     outputFile <<
         "// App list for system '" << systemPtr->name << "'\n"
@@ -300,8 +527,9 @@ void GenerateRtosSystemTasks
             "        .appNameStr = \"" << appPtr->name << "\",\n"
             "        .manualStart = " << ((appPtr->startTrigger == model::App_t::MANUAL)?
                                           "true":"false") << ",\n"
-            "        .taskCount = " << appPtr->GetProcessCount() << ",\n";
-        if (appPtr->GetProcessCount())
+            "        .taskCount = " << (appPtr->taskGroup.empty() ?
+                                        appPtr->GetProcessCount() : 0) << ",\n";
+        if (appPtr->GetProcessCount() && appPtr->taskGroup.empty())
         {
             outputFile <<
                 "        .taskList = " << appPtr->name << "Tasks,\n"
@@ -338,7 +566,54 @@ void GenerateRtosSystemTasks
 
         outputFile << ",\n";
 
+        if (!appPtr->taskGroup.empty())
+        {
+            // The entries of the task groups follow those of the apps.
+            outputFile << "        .taskGroupPtr = &SystemApps["
+                       << systemPtr->apps.size() +
+                          std::distance(taskGroups.begin(), taskGroups.find(appPtr->taskGroup))
+                       << "],\n";
+        }
+
+        outputFile <<
+            "    },\n";
+    }
+
+    // Generate an entry for the shared task of each task group.  The group is started when any
+    // of its apps would be, and is watched with the shortest of their watchdog timeouts.
+    for (auto& groupItem : taskGroups)
+    {
+        bool manualStart = true;
+        int32_t watchdogTimeout = 0;
+        int32_t maxWatchdogTimeout = 0;
+
+        for (auto appPtr : groupItem.second)
+        {
+            if (appPtr->startTrigger != model::App_t::MANUAL)
+            {
+                manualStart = false;
+            }
+            if (appPtr->watchdogTimeout.IsSet() &&
+                ((watchdogTimeout == 0) || (appPtr->watchdogTimeout.Get() < watchdogTimeout)))
+            {
+                watchdogTimeout = appPtr->watchdogTimeout.Get();
+            }
+            if (appPtr->maxWatchdogTimeout.IsSet() &&
+                (appPtr->maxWatchdogTimeout.Get() > maxWatchdogTimeout))
+            {
+                maxWatchdogTimeout = appPtr->maxWatchdogTimeout.Get();
+            }
+        }
+
         outputFile <<
+            "    {\n"
+            "        .appNameStr = \"" << groupItem.first << "\",\n"
+            "        .manualStart = " << (manualStart ? "true" : "false") << ",\n"
+            "        .taskCount = 1,\n"
+            "        .taskList = _group_" << groupItem.first << "Tasks,\n"
+            "        .threadList = _group_" << groupItem.first << "TaskInfo,\n"
+            "        .watchdogTimeout = " << watchdogTimeout << ",\n"
+            "        .maxWatchdogTimeout = " << maxWatchdogTimeout << ",\n"
             "    },\n";
     }
 
@@ -434,6 +709,8 @@ void GenerateRtosSystemTasks
 
     outputFile << "    LE_RTOSCLI_END_RUNTIME();\n"
                   "}\n";
+
+    outputFile.Commit();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -451,11 +728,7 @@ void GenerateRtosCliCommandRegistration
 
     // Open the file as an output stream.
     file::MakeDir(path::GetContainingDir(sourceFile));
-    std::ofstream outputFile(sourceFile);
-    if (outputFile.is_open() == false)
-    {
-        throw mk::Exception_t(mk::format(LE_I18N("Could not open '%s' for writing."), sourceFile));
-    }
+    file::GeneratedFileStream_t outputFile(sourceFile);
 
     // Generate the file header comment and #include directives.
     outputFile << "// CLI command declarations for system '" << systemPtr->name << "'.\n"
@@ -481,6 +754,8 @@ void GenerateRtosCliCommandRegistration
     }
 
     outputFile << "LE_RTOSCLI_END_COMPILETIME()\n";
+
+    outputFile.Commit();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -504,13 +779,7 @@ void GenerateRtosRpcServices
 
     // Open the file as an output stream.
     file::MakeDir(path::GetContainingDir(sourceFile));
-    std::ofstream outputFile(sourceFile);
-    if (outputFile.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), sourceFile)
-        );
-    }
+    file::GeneratedFileStream_t outputFile(sourceFile);
 
     std::set<std::string> includedHeaders;
 
@@ -739,6 +1008,8 @@ void GenerateRtosRpcServices
                    << ", serverMsgPoolRef);\n"
         "}\n";
     }
+
+    outputFile.Commit();
 }
 
 
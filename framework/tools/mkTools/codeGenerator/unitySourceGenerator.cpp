@@ -0,0 +1,171 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file unitySourceGenerator.cpp  Generation of the sources for unity builds and precompiled
+ *                                 headers.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ **/
+//--------------------------------------------------------------------------------------------------
+
+#include "mkTools.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate a source file that includes all of a component's C or C++ source files, so they are
+ * compiled as one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GenerateUnitySource
+(
+    const model::Component_t* componentPtr,
+    const std::list<model::ObjectFile_t*>& objectFiles, ///< Object files built from the sources.
+    const std::string& filePath,                        ///< Path of the file to generate.
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (buildParams.beVerbose)
+    {
+        std::cout << mk::format(LE_I18N("Generating unity source for component '%s' in '%s'."),
+                                componentPtr->name, filePath)
+                  << std::endl;
+    }
+
+    file::GeneratedFileStream_t fileStream(filePath);
+
+    fileStream << "/*\n"
+                  " * AUTO-GENERATED " << path::GetLastNode(filePath) << " for the "
+               << componentPtr->name << " component.\n"
+                  "\n"
+                  " * Don't bother hand-editing this file.\n"
+                  " */\n";
+
+    for (auto objFilePtr : objectFiles)
+    {
+        // Keep the log messages pointing at the right source file.
+        fileStream << "\n"
+                      "#undef LE_FILENAME\n"
+                      "#define LE_FILENAME " << path::GetLastNode(objFilePtr->sourceFilePath) << "\n"
+                      "#include \"" << objFilePtr->sourceFilePath << "\"\n";
+    }
+
+    fileStream.Commit();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate the header that is precompiled for a component's C or C++ sources.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GeneratePrecompiledHeaderSource
+(
+    const std::string& filePath     ///< Path of the file to generate.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    file::GeneratedFileStream_t fileStream(filePath);
+
+    fileStream << "/*\n"
+                  " * AUTO-GENERATED header, precompiled and included ahead of each source file.\n"
+                  "\n"
+                  " * Don't bother hand-editing this file.\n"
+                  " */\n"
+                  "\n"
+                  "#include <legato.h>\n";
+
+    fileStream.Commit();
+}
+
+
+namespace code
+{
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a component's C (or C++) sources are compiled as one, through a unity source.
+ *
+ * @return true if the sources are built from a unity source.
+ */
+//--------------------------------------------------------------------------------------------------
+bool UsesUnitySource
+(
+    const std::list<model::ObjectFile_t*>& objectFiles, ///< Component's C or C++ object files.
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return buildParams.unityBuild && (objectFiles.size() > 1);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether a component's C (or C++) sources are compiled with a precompiled legato.h.
+ *
+ * Only worth it when the header is included by several compilations, and only supported by GCC.
+ *
+ * @return true if the sources use a precompiled header.
+ */
+//--------------------------------------------------------------------------------------------------
+bool UsesPrecompiledHeader
+(
+    const std::list<model::ObjectFile_t*>& objectFiles, ///< Component's C or C++ object files.
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return buildParams.precompileHeaders &&
+           (buildParams.compilerType == mk::BuildParams_t::COMPILER_GCC) &&
+           (objectFiles.size() > 1) &&
+           !UsesUnitySource(objectFiles, buildParams);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Generate the unity sources (_unity.c, _unity.cpp) and the headers to precompile (_pch.h,
+ * _pch.hpp) used to build a given component, if any.
+ */
+//--------------------------------------------------------------------------------------------------
+void GenerateComponentUnitySources
+(
+    const model::Component_t* componentPtr,
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::string outputDir = path::Minimize(buildParams.workingDir
+                                        + '/'
+                                        + componentPtr->workingDir
+                                        + "/src");
+
+    if (UsesUnitySource(componentPtr->cObjectFiles, buildParams))
+    {
+        file::MakeDir(outputDir);
+        GenerateUnitySource(componentPtr, componentPtr->cObjectFiles,
+                            outputDir + "/_unity.c", buildParams);
+    }
+    else if (UsesPrecompiledHeader(componentPtr->cObjectFiles, buildParams))
+    {
+        file::MakeDir(outputDir);
+        GeneratePrecompiledHeaderSource(outputDir + "/_pch.h");
+    }
+
+    if (UsesUnitySource(componentPtr->cxxObjectFiles, buildParams))
+    {
+        file::MakeDir(outputDir);
+        GenerateUnitySource(componentPtr, componentPtr->cxxObjectFiles,
+                            outputDir + "/_unity.cpp", buildParams);
+    }
+    else if (UsesPrecompiledHeader(componentPtr->cxxObjectFiles, buildParams))
+    {
+        file::MakeDir(outputDir);
+        GeneratePrecompiledHeaderSource(outputDir + "/_pch.hpp");
+    }
+}
+
+
+} // namespace code
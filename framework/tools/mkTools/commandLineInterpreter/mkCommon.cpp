@@ -273,6 +273,53 @@ std::list<std::string> GetCrossToolPaths
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start an ifgen server (see ifgenServer.py) for ninja to run ifgen through, to save starting
+ * Python and loading ifgen for every interface.  The server lasts until the calling process (which
+ * is about to become ninja) exits.
+ *
+ * If the server can't be started, ifgen-client runs ifgen itself, so errors are ignored.
+ */
+//--------------------------------------------------------------------------------------------------
+void StartIfgenServer
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    auto tempDir = envVars::Get("TMPDIR");
+    auto dirTemplate = path::Combine(tempDir.empty() ? "/tmp" : tempDir, "ifgen-XXXXXX");
+
+    std::vector<char> serverDir(dirTemplate.begin(), dirTemplate.end());
+    serverDir.push_back('\0');
+
+    if (mkdtemp(serverDir.data()) == NULL)
+    {
+        return;
+    }
+
+    auto buildPid = std::to_string(getpid());
+
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        execlp("ifgen", "ifgen", "--serve", serverDir.data(), buildPid.c_str(), (char*)NULL);
+
+        rmdir(serverDir.data());
+        _exit(EXIT_FAILURE);
+    }
+    else if (pid < 0)
+    {
+        rmdir(serverDir.data());
+        return;
+    }
+
+    envVars::Set("IFGEN_SERVER_DIR", serverDir.data());
+}
+
+
 } // anonymous namespace
 
 
@@ -309,6 +356,13 @@ void FindToolChain
     buildParams.objcopyPath = GetToolPath(buildParams.target, "OBJCOPY");
     buildParams.readelfPath = GetToolPath(buildParams.target, "READELF");
     buildParams.compilerCachePath = GetToolPath(buildParams.target, "CCACHE", false);
+    buildParams.ifgenCacheDir = envVars::Get("IFGEN_CACHE_DIR");
+    if (!buildParams.ifgenCacheDir.empty())
+    {
+        buildParams.ifgenCacheDir = path::MakeAbsolute(buildParams.ifgenCacheDir);
+    }
+    buildParams.unityBuild = envVars::GetConfigBool("LE_UNITY_BUILD");
+    buildParams.precompileHeaders = envVars::GetConfigBool("LE_PRECOMPILED_HEADERS");
     buildParams.crossToolPaths = GetCrossToolPaths(buildParams.target);
 
     if (path::ToolHasSuffix(buildParams.cCompilerPath, "armcc"))
@@ -335,6 +389,9 @@ void FindToolChain
         std::cout << "Object file copier/translator = " << buildParams.objcopyPath << std::endl;
         std::cout << "ELF file info extractor = " << buildParams.readelfPath << std::endl;
         std::cout << "Compiler cache = " << buildParams.compilerCachePath << std::endl;
+        std::cout << "ifgen cache = " << buildParams.ifgenCacheDir << std::endl;
+        std::cout << "Unity build = " << buildParams.unityBuild << std::endl;
+        std::cout << "Precompiled headers = " << buildParams.precompileHeaders << std::endl;
 
         std::cout << "Cross tool paths = ";
         for (const auto &crossToolPath : buildParams.crossToolPaths)
@@ -467,6 +524,8 @@ void RunNinja
             std::cout << std::endl;
         }
 
+        StartIfgenServer();
+
         // According to the execvp prototype, it takes a char* const array.
         //   int execvp(const char *file, char *const argv[]);
         // Using a const_cast here since in practice, the array is not being
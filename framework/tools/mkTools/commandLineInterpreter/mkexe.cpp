@@ -229,6 +229,21 @@ static void GetCommandLineArgs
                                   " This is useful for supporting context-sensitive auto-complete"
                                   " and related features in source code editors, for example."));
 
+    args::AddOptionalFlag(&BuildParams.fastLoad,
+                          'F',
+                          "fast-load",
+                          LE_I18N("Link libraries and executables for faster dynamic loading:"
+                                  " GNU hash tables, optimized symbol tables, and symbols of"
+                                  " static libraries linked into component libraries kept"
+                                  " hidden."));
+
+    args::AddOptionalFlag(&BuildParams.staticExes,
+                          'e',
+                          "static-exe",
+                          LE_I18N("Link each executable statically with its components and"
+                                  " liblegato, using link-time optimization, instead of loading"
+                                  " them as shared libraries."));
+
     args::AddOptionalFlag(&BuildParams.noPie,
                           'p',
                           "no-pie",
@@ -260,6 +260,29 @@ static void GetCommandLineArgs
                                   " regenerate itself and any other files that need to be"
                                   " regenerated when the build.ninja finds itself out of date."));
 
+    args::AddOptionalFlag(&BuildParams.fastLoad,
+                          'F',
+                          "fast-load",
+                          LE_I18N("Link libraries and executables for faster dynamic loading:"
+                                  " GNU hash tables, optimized symbol tables, and symbols of"
+                                  " static libraries linked into component libraries kept"
+                                  " hidden."));
+
+    args::AddOptionalFlag(&BuildParams.staticExes,
+                          'e',
+                          "static-exe",
+                          LE_I18N("Link each executable statically with its components and"
+                                  " liblegato, using link-time optimization, instead of loading"
+                                  " them as shared libraries."));
+
+    args::AddOptionalFlag(&BuildParams.binaryConfig,
+                          'B',
+                          "binary-config",
+                          LE_I18N("Generate the configuration data of the system and its apps as"
+                                  " Config Tree images, which are copied into the configuration"
+                                  " trees when the system is installed instead of being parsed."
+                                  " Requires a framework built with CFGTREE_BINARY_FORMAT."));
+
     args::AddOptionalFlag(&BuildParams.codeGenOnly,
                           'g',
                           "generate-code",
@@ -279,6 +302,14 @@ static void GetCommandLineArgs
     // Tell build params configuration is finished.
     BuildParams.FinishConfig();
 
+    // Tree images can only be imported by a Config Tree that knows the binary format.
+    if (   BuildParams.binaryConfig
+        && !envVars::GetConfigBool("LE_CONFIG_CFGTREE_BINARY_FORMAT"))
+    {
+        throw mk::Exception_t(LE_I18N("--binary-config requires a framework built with"
+                                      " CFGTREE_BINARY_FORMAT enabled."));
+    }
+
     // Were we given an system definition?
     if (SdefFilePath == "")
     {
@@ -7,6 +7,7 @@
 //--------------------------------------------------------------------------------------------------
 
 #include "mkTools.h"
+#include "configImage.h"
 
 namespace config
 {
@@ -883,6 +884,29 @@ static void GenerateAppWatchdogConfig
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the path of the file that an app's configuration is generated in, in the text format.  This
+ * is the app's "root.cfg", unless the configuration is being generated as tree images, in which
+ * case the text is kept out of the app's staging directory and "root.cfg" is generated from it.
+ **/
+//--------------------------------------------------------------------------------------------------
+static std::string AppConfigTextPath
+(
+    model::App_t* appPtr,
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (buildParams.binaryConfig)
+    {
+        return path::Combine(buildParams.workingDir, path::Combine(appPtr->workingDir, "root.cfg"));
+    }
+
+    return path::Combine(buildParams.workingDir, appPtr->ConfigFilePath());
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Generate the configuration that the framework needs for a given app.  This is the configuration
@@ -898,7 +922,7 @@ void Generate
 )
 //--------------------------------------------------------------------------------------------------
 {
-    std::string filePath = path::Combine(buildParams.workingDir, appPtr->ConfigFilePath());
+    std::string filePath = AppConfigTextPath(appPtr, buildParams);
 
     file::MakeDir(path::GetContainingDir(filePath));
 
@@ -909,14 +933,7 @@ void Generate
                   << std::endl;
     }
 
-    std::ofstream cfgStream(filePath, std::ofstream::trunc);
-
-    if (cfgStream.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), filePath)
-        );
-    }
+    file::GeneratedFileStream_t cfgStream(filePath);
 
     cfgStream << "{" << std::endl;
 
@@ -937,6 +954,13 @@ void Generate
     GenerateAppWatchdogConfig(cfgStream, appPtr);
 
     cfgStream << "}" << std::endl;
+
+    cfgStream.Commit();
+
+    if (buildParams.binaryConfig)
+    {
+        GenerateImage(filePath, path::Combine(buildParams.workingDir, appPtr->ConfigFilePath()));
+    }
 }
 
 
@@ -1319,6 +1343,51 @@ static void GenerateConfigEachSubModuleFile
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the path of the file that one of the system's configuration files is generated in, in the
+ * text format.  This is the file in the "config" directory of the system's staging directory,
+ * unless the configuration is being generated as tree images, in which case the text is kept out
+ * of the staging directory and the staged file is generated from it by GenerateSystemImage().
+ **/
+//--------------------------------------------------------------------------------------------------
+static std::string SystemConfigTextPath
+(
+    const std::string& fileName,    ///< Name of the file, e.g. "apps.cfg".
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (buildParams.binaryConfig)
+    {
+        return path::Combine(buildParams.workingDir, "config/" + fileName);
+    }
+
+    return path::Combine(buildParams.workingDir, "staging/config/" + fileName);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * If the configuration is being generated as tree images, generate the staged copy of one of the
+ * system's configuration files from the text generated at SystemConfigTextPath().
+ **/
+//--------------------------------------------------------------------------------------------------
+static void GenerateSystemImage
+(
+    const std::string& fileName,    ///< Name of the file, e.g. "apps.cfg".
+    const mk::BuildParams_t& buildParams
+)
+//--------------------------------------------------------------------------------------------------
+{
+    if (buildParams.binaryConfig)
+    {
+        GenerateImage(SystemConfigTextPath(fileName, buildParams),
+                      path::Combine(buildParams.workingDir, "staging/config/" + fileName));
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Generate kernel module configuration in a file called config/modules.cfg under
@@ -1332,7 +1401,7 @@ static void GenerateModulesConfig
 )
 //--------------------------------------------------------------------------------------------------
 {
-    std::string filePath = path::Combine(buildParams.workingDir, "staging/config/modules.cfg");
+    std::string filePath = SystemConfigTextPath("modules.cfg", buildParams);
 
     if (buildParams.beVerbose)
     {
@@ -1341,14 +1410,7 @@ static void GenerateModulesConfig
                   << std::endl;
     }
 
-    std::ofstream cfgStream(filePath, std::ofstream::trunc);
-
-    if (cfgStream.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), filePath)
-        );
-    }
+    file::GeneratedFileStream_t cfgStream(filePath);
 
     // Create a map to store the modules and its dependencies for detecting cycle.
     std::map<std::string, VectorPairStringToken_t> checkCycleMap;
@@ -1441,6 +1503,10 @@ static void GenerateModulesConfig
 
     // Check for cyclic dependencies in kernel modules
     hasCyclicDependency(checkCycleMap, visitedMap, recurStackMap);
+
+    cfgStream.Commit();
+
+    GenerateSystemImage("modules.cfg", buildParams);
 }
 
 
@@ -1457,7 +1523,7 @@ static void GenerateUsersConfig
 )
 //--------------------------------------------------------------------------------------------------
 {
-    std::string filePath = path::Combine(buildParams.workingDir, "staging/config/users.cfg");
+    std::string filePath = SystemConfigTextPath("users.cfg", buildParams);
 
     if (buildParams.beVerbose)
     {
@@ -1466,14 +1532,7 @@ static void GenerateUsersConfig
                   << std::endl;
     }
 
-    std::ofstream cfgStream(filePath, std::ofstream::trunc);
-
-    if (cfgStream.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), filePath)
-        );
-    }
+    file::GeneratedFileStream_t cfgStream(filePath);
 
     cfgStream << "{\n";
 
@@ -1498,6 +1557,10 @@ static void GenerateUsersConfig
     }
 
     cfgStream << "}\n";
+
+    cfgStream.Commit();
+
+    GenerateSystemImage("users.cfg", buildParams);
 }
 
 
@@ -1516,7 +1579,7 @@ static void AddAppConfig
 )
 //--------------------------------------------------------------------------------------------------
 {
-    std::string filePath = path::Combine(buildParams.workingDir, appPtr->ConfigFilePath());
+    std::string filePath = AppConfigTextPath(appPtr, buildParams);
 
     std::ifstream appCfgStream(filePath);
 
@@ -1550,7 +1613,7 @@ static void GenerateAppsConfig
 )
 //--------------------------------------------------------------------------------------------------
 {
-    std::string filePath = path::Combine(buildParams.workingDir, "staging/config/apps.cfg");
+    std::string filePath = SystemConfigTextPath("apps.cfg", buildParams);
 
     if (buildParams.beVerbose)
     {
@@ -1559,14 +1622,7 @@ static void GenerateAppsConfig
                   << std::endl;
     }
 
-    std::ofstream cfgStream(filePath, std::ofstream::trunc);
-
-    if (cfgStream.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), filePath)
-        );
-    }
+    file::GeneratedFileStream_t cfgStream(filePath);
 
     cfgStream << "{\n";
 
@@ -1580,6 +1636,10 @@ static void GenerateAppsConfig
     }
 
     cfgStream << "}\n";
+
+    cfgStream.Commit();
+
+    GenerateSystemImage("apps.cfg", buildParams);
 }
 
 
@@ -1688,14 +1748,7 @@ static void GenerateFrameworkConfig
     }
 
 
-    std::ofstream cfgStream(filePath, std::ofstream::trunc);
-
-    if (cfgStream.is_open() == false)
-    {
-        throw mk::Exception_t(
-            mk::format(LE_I18N("Could not open '%s' for writing."), filePath)
-        );
-    }
+    file::GeneratedFileStream_t cfgStream(filePath);
 
     cfgStream << "{" << std::endl;
 
@@ -1719,6 +1772,8 @@ static void GenerateFrameworkConfig
     }
 
     cfgStream << "}" << std::endl;
+
+    cfgStream.Commit();
 }
 
 
@@ -0,0 +1,493 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file configImage.cpp
+ *
+ * Converts generated configuration files to the Config Tree's binary tree image format.  The
+ * layout written here must match framework/daemons/configTree/treeImage.c:
+ *
+ * @verbatim
+
+    +--------+-------------------------+-------------------------+------------------+
+    | Header | Node Records            | String Table            | String Data      |
+    |        | (recordCount * 16 bytes) | (stringCount * 8 bytes) | (stringDataSize) |
+    +--------+-------------------------+-------------------------+------------------+
+
+@endverbatim
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "mkTools.h"
+#include "configImage.h"
+
+namespace config
+{
+
+
+/// Identifies a tree image file ("LCTG" when read as bytes).
+static const uint32_t ImageMagic = 0x4754434C;
+
+/// Version of the file layout.
+static const uint32_t ImageVersion = 1;
+
+/// String index used for "no value".
+static const uint32_t NoString = UINT32_MAX;
+
+/// Size of the file header: magic, version, fileSize, recordCount, stringCount, stringDataSize.
+static const size_t HeaderSize = 6 * sizeof(uint32_t);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Node types, as stored in the file.
+ **/
+//--------------------------------------------------------------------------------------------------
+enum RecordType_t
+{
+    RECORD_EMPTY  = 0,  ///< Node without any value.
+    RECORD_STRING = 1,  ///< UTF-8 text string.
+    RECORD_BOOL   = 2,  ///< Boolean value ("t" or "f").
+    RECORD_INT    = 3,  ///< Signed integer.
+    RECORD_FLOAT  = 4,  ///< Floating point number.
+    RECORD_STEM   = 5   ///< Node with children.
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A node of the configuration tree being converted.
+ **/
+//--------------------------------------------------------------------------------------------------
+struct Node_t
+{
+    std::string name;               ///< The node's name ("" for the root).
+    RecordType_t type;              ///< The node's type.
+    std::string value;              ///< The node's value, in string form.
+    std::list<Node_t> children;     ///< The node's children, in file order.
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of the text file being parsed.
+ **/
+//--------------------------------------------------------------------------------------------------
+struct Input_t
+{
+    const std::string& filePath;    ///< The file being parsed, for error messages.
+    const std::string& text;        ///< The contents of the file.
+    size_t pos;                     ///< The position of the next character to read.
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of the tree image being built.
+ **/
+//--------------------------------------------------------------------------------------------------
+struct Image_t
+{
+    std::vector<uint32_t> records;              ///< Four words per node record.
+    std::vector<uint32_t> strings;              ///< Two words (offset, length) per string.
+    std::string stringData;                     ///< The null-terminated strings.
+    std::map<std::string, uint32_t> stringMap;  ///< Index of each string already added.
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Throw an exception for a parse error at the current position in the text file.
+ *
+ * @throw mk::Exception_t always.
+ **/
+//--------------------------------------------------------------------------------------------------
+[[noreturn]] static void ThrowParseError
+(
+    const Input_t& input,
+    const std::string& message
+)
+//--------------------------------------------------------------------------------------------------
+{
+    throw mk::Exception_t(
+        mk::format(LE_I18N("%s: offset %zu: %s"), input.filePath, input.pos, message)
+    );
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Skip over any white space in the text file.
+ *
+ * @return true if there is more to read, false if the end of the file has been reached.
+ **/
+//--------------------------------------------------------------------------------------------------
+static bool SkipWhiteSpace
+(
+    Input_t& input
+)
+//--------------------------------------------------------------------------------------------------
+{
+    while (input.pos < input.text.size())
+    {
+        switch (input.text[input.pos])
+        {
+            case '\n':
+            case '\r':
+            case '\t':
+            case ' ':
+                input.pos++;
+                break;
+
+            default:
+                return true;
+        }
+    }
+
+    return false;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a literal up to its closing delimiter, removing any backslash escapes.  The opening
+ * delimiter must already have been read.
+ *
+ * @return The literal's text.
+ *
+ * @throw mk::Exception_t if the end of the file is reached first.
+ **/
+//--------------------------------------------------------------------------------------------------
+static std::string ReadLiteral
+(
+    Input_t& input,
+    char terminal
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::string result;
+
+    while (input.pos < input.text.size())
+    {
+        char next = input.text[input.pos++];
+
+        if (next == terminal)
+        {
+            return result;
+        }
+
+        if (next == '\\')
+        {
+            if (input.pos >= input.text.size())
+            {
+                break;
+            }
+
+            next = input.text[input.pos++];
+        }
+
+        result += next;
+    }
+
+    ThrowParseError(input, mk::format(LE_I18N("Missing closing '%c'."), terminal));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a node's value, and if it is a group, its children too.  Like the Config Tree, a later
+ * child with the same name as an earlier one replaces it, and an empty group is an empty node.
+ *
+ * @throw mk::Exception_t if the value can't be parsed.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void ReadValue
+(
+    Input_t& input,
+    Node_t& node
+)
+//--------------------------------------------------------------------------------------------------
+{
+    node.type = RECORD_EMPTY;
+    node.value.clear();
+    node.children.clear();
+
+    if (!SkipWhiteSpace(input))
+    {
+        ThrowParseError(input, LE_I18N("Unexpected end of file."));
+    }
+
+    switch (input.text[input.pos++])
+    {
+        case '~':
+            break;
+
+        case '!':
+            if (   (input.pos >= input.text.size())
+                || (   (input.text[input.pos] != 't')
+                    && (input.text[input.pos] != 'f')))
+            {
+                ThrowParseError(input, LE_I18N("Bad boolean value."));
+            }
+            node.type = RECORD_BOOL;
+            node.value = input.text[input.pos++];
+            break;
+
+        case '[':
+            node.type = RECORD_INT;
+            node.value = ReadLiteral(input, ']');
+            break;
+
+        case '(':
+            node.type = RECORD_FLOAT;
+            node.value = ReadLiteral(input, ')');
+            break;
+
+        case '"':
+            node.type = RECORD_STRING;
+            node.value = ReadLiteral(input, '"');
+            break;
+
+        case '{':
+            for (;;)
+            {
+                if (!SkipWhiteSpace(input))
+                {
+                    ThrowParseError(input, LE_I18N("Missing closing '}'."));
+                }
+
+                char next = input.text[input.pos++];
+
+                if (next == '}')
+                {
+                    break;
+                }
+
+                if (next != '"')
+                {
+                    ThrowParseError(input, LE_I18N("Expected a node name or '}'."));
+                }
+
+                std::string name = ReadLiteral(input, '"');
+
+                if (name.empty())
+                {
+                    ThrowParseError(input, LE_I18N("Empty node name."));
+                }
+
+                auto childIter = std::find_if(node.children.begin(),
+                                              node.children.end(),
+                                              [&name](const Node_t& child)
+                                              {
+                                                  return child.name == name;
+                                              });
+
+                if (childIter == node.children.end())
+                {
+                    node.children.emplace_back();
+                    childIter = std::prev(node.children.end());
+                    childIter->name = name;
+                }
+
+                ReadValue(input, *childIter);
+            }
+
+            if (!node.children.empty())
+            {
+                node.type = RECORD_STEM;
+            }
+            break;
+
+        default:
+            input.pos--;
+            ThrowParseError(input, LE_I18N("Unexpected character."));
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a string to the image's string table, if it isn't already there.
+ *
+ * @return The string's index.
+ **/
+//--------------------------------------------------------------------------------------------------
+static uint32_t AddString
+(
+    Image_t& image,
+    const std::string& string
+)
+//--------------------------------------------------------------------------------------------------
+{
+    auto iter = image.stringMap.find(string);
+
+    if (iter != image.stringMap.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t index = image.strings.size() / 2;
+
+    image.strings.push_back(image.stringData.size());
+    image.strings.push_back(string.size());
+    image.stringData.append(string);
+    image.stringData.push_back('\0');
+
+    image.stringMap[string] = index;
+
+    return index;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fill in a node's record, allocating a run of records for its children right after all of the
+ * records allocated so far, then fill in the children's records.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void AddRecord
+(
+    Image_t& image,
+    const Node_t& node,
+    size_t recordIndex
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint32_t name = AddString(image, node.name);
+    uint32_t value = NoString;
+    uint32_t count = 0;
+
+    if (node.type == RECORD_STEM)
+    {
+        value = image.records.size() / 4;
+        count = node.children.size();
+
+        image.records.resize(image.records.size() + (4 * count));
+    }
+    else if (node.type != RECORD_EMPTY)
+    {
+        value = AddString(image, node.value);
+    }
+
+    image.records[(recordIndex * 4) + 0] = name;
+    image.records[(recordIndex * 4) + 1] = node.type;
+    image.records[(recordIndex * 4) + 2] = value;
+    image.records[(recordIndex * 4) + 3] = count;
+
+    size_t childIndex = value;
+
+    for (auto& child : node.children)
+    {
+        AddRecord(image, child, childIndex);
+        childIndex++;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write 32-bit words to a file in little-endian byte order.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void WriteWords
+(
+    std::ostream& stream,
+    const std::vector<uint32_t>& words
+)
+//--------------------------------------------------------------------------------------------------
+{
+    for (auto word : words)
+    {
+        const char bytes[4] =
+        {
+            static_cast<char>(word & 0xFF),
+            static_cast<char>((word >> 8) & 0xFF),
+            static_cast<char>((word >> 16) & 0xFF),
+            static_cast<char>((word >> 24) & 0xFF)
+        };
+
+        stream.write(bytes, sizeof(bytes));
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a configuration file in the Config Tree's text format into a tree image, which the
+ * Config Tree can import by copying its records instead of parsing it.
+ *
+ * @throw mk::Exception_t if the text file can't be read or parsed, or the image can't be written.
+ **/
+//--------------------------------------------------------------------------------------------------
+void GenerateImage
+(
+    const std::string& textFilePath,    ///< The text configuration file to convert.
+    const std::string& imageFilePath    ///< The tree image file to generate.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    std::ifstream textStream(textFilePath);
+
+    if (textStream.is_open() == false)
+    {
+        throw mk::Exception_t(
+            mk::format(LE_I18N("Could not open '%s' for reading."), textFilePath)
+        );
+    }
+
+    std::stringstream textBuffer;
+    textBuffer << textStream.rdbuf();
+    const std::string text = textBuffer.str();
+
+    Input_t input = { textFilePath, text, 0 };
+    Node_t root;
+
+    root.type = RECORD_EMPTY;
+
+    ReadValue(input, root);
+
+    if (SkipWhiteSpace(input))
+    {
+        ThrowParseError(input, LE_I18N("Unexpected token after the end of the tree."));
+    }
+
+    Image_t image;
+
+    image.records.resize(4);
+    AddRecord(image, root, 0);
+
+    uint64_t fileSize =   HeaderSize
+                        + (image.records.size() * sizeof(uint32_t))
+                        + (image.strings.size() * sizeof(uint32_t))
+                        + image.stringData.size();
+
+    if (fileSize > UINT32_MAX)
+    {
+        throw mk::Exception_t(
+            mk::format(LE_I18N("Configuration in '%s' is too large for a tree image."),
+                       textFilePath)
+        );
+    }
+
+    file::MakeDir(path::GetContainingDir(imageFilePath));
+
+    file::GeneratedFileStream_t imageStream(imageFilePath);
+
+    WriteWords(imageStream,
+               {
+                   ImageMagic,
+                   ImageVersion,
+                   static_cast<uint32_t>(fileSize),
+                   static_cast<uint32_t>(image.records.size() / 4),
+                   static_cast<uint32_t>(image.strings.size() / 2),
+                   static_cast<uint32_t>(image.stringData.size())
+               });
+    WriteWords(imageStream, image.records);
+    WriteWords(imageStream, image.strings);
+    imageStream.write(image.stringData.data(), image.stringData.size());
+
+    imageStream.Commit();
+}
+
+
+} // namespace config
@@ -0,0 +1,38 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file configImage.h
+ *
+ * Converts generated configuration files to the Config Tree's binary tree image format.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_MKTOOLS_CONFIG_IMAGE_H_INCLUDE_GUARD
+#define LEGATO_MKTOOLS_CONFIG_IMAGE_H_INCLUDE_GUARD
+
+namespace config
+{
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a configuration file in the Config Tree's text format into a tree image, which the
+ * Config Tree can import by copying its records instead of parsing it.
+ *
+ * Images are written in little-endian byte order, which is the byte order of all of the targets
+ * supported by the framework.
+ *
+ * @throw mk::Exception_t if the text file can't be read or parsed, or the image can't be written.
+ **/
+//--------------------------------------------------------------------------------------------------
+void GenerateImage
+(
+    const std::string& textFilePath,    ///< The text configuration file to convert.
+    const std::string& imageFilePath    ///< The tree image file to generate.
+);
+
+
+} // namespace config
+
+#endif // LEGATO_MKTOOLS_CONFIG_IMAGE_H_INCLUDE_GUARD
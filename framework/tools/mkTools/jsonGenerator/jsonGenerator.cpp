@@ -406,7 +406,8 @@ static data::Value_t ModelApiClientIfInstance
             { "name", ifPtr->internalName },
             { "path", ifPtr->apiFilePtr->path },
             { "manualStart", ifPtr->manualStart },
-            { "optional", ifPtr->optional }
+            { "optional", ifPtr->optional },
+            { "pipelined", ifPtr->pipelined }
         };
 }
 
@@ -428,7 +429,8 @@ static data::Value_t ModelApiServerIfInstance
             { "name", ifPtr->internalName },
             { "path", ifPtr->apiFilePtr->path },
             { "manualStart", ifPtr->manualStart },
-            { "async", ifPtr->async }
+            { "async", ifPtr->async },
+            { "parallel", ifPtr->parallel }
         };
 }
 
@@ -684,6 +686,7 @@ static data::Value_t ModelApp
 
             { "isPreBuilt", appPtr->isPreBuilt },
             { "preloadedMd5", appPtr->preloadedMd5 },
+            { "taskGroup", appPtr->taskGroup },
 
             {
                 "processEnvs",
@@ -934,6 +937,9 @@ static data::Value_t ModelBuildParams
             { "isStandAloneComp", buildParams.isStandAloneComp },
             { "binPack", buildParams.binPack },
             { "noPie", buildParams.noPie },
+            { "fastLoad", buildParams.fastLoad },
+            { "staticExes", buildParams.staticExes },
+            { "binaryConfig", buildParams.binaryConfig },
 
             {
                 "args",
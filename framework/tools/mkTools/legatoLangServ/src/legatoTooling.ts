@@ -86,22 +86,37 @@ function findInPath(paths: string[], executable: string): string
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Run the mkinfo command line tool against a given definition file and return a JSON version of
- * that build model.
+ * Run the mkparse command line tool against a given definition file and return its raw output.
  *
  * @param profile  The profile to execute under.
- * @param defFilePath  Path to the Legato definition file to model..
+ * @param defFilePath  Path to the Legato definition file to model.
  */
 //--------------------------------------------------------------------------------------------------
-export function mkInfo(profile: lspCli.Profile, defFilePath: string): jdoc.Document | string
+export function mkParse(profile: lspCli.Profile, defFilePath: string): string
 {
-    let result: jdoc.Document | string = undefined;
     let [ , output ] = exec(path.dirname(defFilePath),
                             profile.environment,
                             findInPath(profile.path, 'mkparse'),
                             '-t', profile.legatoTarget,
                             defFilePath);
 
+    return output;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert the output of mkparse into a JSON version of the build model.
+ *
+ * @param output  The raw output of mkparse.
+ *
+ * @return The model document, or the output itself if it isn't a valid model (an error message.)
+ */
+//--------------------------------------------------------------------------------------------------
+export function parseModel(output: string): jdoc.Document | string
+{
+    let result: jdoc.Document | string = undefined;
+
     try
     {
         result = JSON.parse(output);
@@ -115,6 +130,21 @@ export function mkInfo(profile: lspCli.Profile, defFilePath: string): jdoc.Docum
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run the mkinfo command line tool against a given definition file and return a JSON version of
+ * that build model.
+ *
+ * @param profile  The profile to execute under.
+ * @param defFilePath  Path to the Legato definition file to model..
+ */
+//--------------------------------------------------------------------------------------------------
+export function mkInfo(profile: lspCli.Profile, defFilePath: string): jdoc.Document | string
+{
+    return parseModel(mkParse(profile, defFilePath));
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Enumeration of the types of search paths mkedit can update.
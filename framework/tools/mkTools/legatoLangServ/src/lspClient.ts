@@ -13,6 +13,7 @@ import * as lsp from 'vscode-languageserver';
 import Uri from 'vscode-uri';
 import * as path from 'path';
 import * as fs from 'fs';
+import * as crypto from 'crypto';
 import * as fs_watcher from 'chokidar';
 
 import * as model from './model/annotatedModel';
@@ -38,12 +39,18 @@ export class Profile
     /** The Json model as loaded from mkparse. */
     private jsonDocument: jdoc.Document;
 
+    /** The raw mkparse output the Json model was loaded from. */
+    private jsonOutput: string;
+
     /** A loaded version of that definition file. */
     public activeModel: model.System | model.Application;
 
     /** Watch the filesystem for any changes to any of the files that make up the active model. */
     private fileWatcher: fs_watcher.FSWatcher;
 
+    /** Digest of the contents of each watched file, as of when the watch was started. */
+    private fileDigests: Map<string, string>;
+
     /** Keep track of if the client is receiving model load updates. */
     private clientReceiveModelUpdates: boolean;
 
@@ -65,7 +72,9 @@ export class Profile
         this.workspaceFolders = [];
 
         this.activeModel = undefined;
+        this.jsonOutput = undefined;
         this.fileWatcher = undefined;
+        this.fileDigests = new Map<string, string>();
         this.clientReceiveModelUpdates = false;
 
         this.clientProps =
@@ -122,8 +131,10 @@ export class Profile
     {
         if (this.activeDefFile != "")
         {
-            this.reloadActiveModel();
-            this.notifyModelUpdate();
+            if (this.reloadActiveModel())
+            {
+                this.notifyModelUpdate();
+            }
         }
     }
 
@@ -137,21 +148,37 @@ export class Profile
         return typeof arg !== 'string';
     }
 
-    /** Reload the active module from definition files. */
-    public reloadActiveModel()
+    /**
+     * Reload the active module from definition files.
+     *
+     * @return false if mkparse produced exactly the same model as last time, so the loaded model
+     *         was kept as is, true otherwise.
+     */
+    public reloadActiveModel(): boolean
     {
         let watchPaths: string[] = [];
 
-        this.clearFileWatch();
-
         if (   (this.activeDefFile !== undefined)
             && (!fs.existsSync(this.activeDefFile)))
         {
+            this.clearFileWatch();
             console.log("No definition file has been set, can not load a model.");
-            return;
+            return true;
         }
 
-        let mkResponse = tooling.mkInfo(this, this.activeDefFile);
+        let mkOutput = tooling.mkParse(this, this.activeDefFile);
+
+        if (   (this.activeModel !== undefined)
+            && (mkOutput === this.jsonOutput))
+        {
+            // Nothing that makes up the model has changed, so keep the loaded model and the
+            // files being watched, and don't make the client redraw it.
+            return false;
+        }
+
+        this.clearFileWatch();
+
+        let mkResponse = tooling.parseModel(mkOutput);
 
         if (this.isDocument(mkResponse))
         {
@@ -185,6 +212,7 @@ export class Profile
                 }
 
                 this.jsonDocument = mkResponse;
+                this.jsonOutput = mkOutput;
                 this.activeModel = systemInfo;
             }
 
@@ -193,6 +221,7 @@ export class Profile
         else
         {
             this.activeModel = undefined;
+            this.jsonOutput = undefined;
             // Looks like we couldn't properly load the current model.  So search this directory for
             // all 'interesting' model files.
             console.log(`An error occurred during model load.`);
@@ -243,6 +272,8 @@ export class Profile
                 }
             }
         }
+
+        return true;
     }
 
     private attemptModelFixup(mkResponse: string, fileList: string[]): boolean
@@ -369,17 +400,35 @@ export class Profile
         {
             let theThis = this;
 
+            for (let watchPath of watchPaths)
+            {
+                this.fileDigests.set(watchPath, this.fileDigest(watchPath));
+            }
+
             this.fileWatcher = fs_watcher.watch(watchPaths);
 
             this.fileWatcher.on('change',
-                function (_path, _stats)
+                function (changedPath, _stats)
                 {
+                    // Editors often write out a file several times on save, or touch it without
+                    // changing it.  Only remodel when the contents really are different.
+                    let digest = theThis.fileDigest(changedPath);
+
+                    if (theThis.fileDigests.get(changedPath) === digest)
+                    {
+                        return;
+                    }
+
+                    theThis.fileDigests.set(changedPath, digest);
+
                     theThis.clearModifyTimeout();
                     theThis.reloadTimer = setTimeout(
                         function ()
                         {
-                            theThis.reloadActiveModel();
-                            theThis.notifyModelUpdate();
+                            if (theThis.reloadActiveModel())
+                            {
+                                theThis.notifyModelUpdate();
+                            }
                             theThis.reloadTimer = undefined;
                         },
                         400);
@@ -387,6 +436,25 @@ export class Profile
         }
     }
 
+    /**
+     * Compute a digest of a file's contents, to tell whether a change event really changed it.
+     *
+     * @param filePath  The file to digest.
+     *
+     * @return The digest, or an empty string if the file can't be read.
+     */
+    private fileDigest(filePath: string): string
+    {
+        try
+        {
+            return crypto.createHash('md5').update(fs.readFileSync(filePath)).digest('hex');
+        }
+        catch (e)
+        {
+            return '';
+        }
+    }
+
     private clearFileWatch()
     {
         if (this.fileWatcher !== undefined)
@@ -394,6 +462,8 @@ export class Profile
             this.fileWatcher.close();
             this.fileWatcher = undefined;
         }
+
+        this.fileDigests.clear();
     }
 
     private clearModifyTimeout()
@@ -83,6 +83,10 @@ class RtosExeInfo_t : public model::TargetInfo_t
 
         /// Initialization function -- called in main thread before *any* executables are started.
         std::string initFunc;
+
+        /// Start function -- initializes the executable's components in the calling task.  Called
+        /// by the entry point, or by the entry point of the task group the executable is in.
+        std::string startFunc;
 };
 
 }
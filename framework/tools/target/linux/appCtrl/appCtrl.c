@@ -184,6 +184,31 @@ static le_mem_PoolRef_t ProcNamePool;
 static le_hashmap_Ref_t ProcObjMap;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * An app's entry in the start-up timeline.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char        appName[LIMIT_MAX_APP_NAME_BYTES];  // Name of the app.
+    le_result_t result;                             // Result of le_appCtrl_GetStartTimes().
+    uint32_t    level;                              // Start level.
+    uint64_t    launchStart;                        // When the launch began (ms).
+    uint64_t    launchEnd;                          // When the launch finished (ms).
+}
+StartTime_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start-up timeline entries collected by the "startTimes" command.
+ */
+//--------------------------------------------------------------------------------------------------
+static StartTime_t* StartTimes = NULL;
+static size_t NumStartTimes = 0;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Prints help to stdout and exits.
@@ -210,6 +235,7 @@ static void PrintHelp
         "    app status [<appName>]\n"
         "    app version <appName>\n"
         "    app info [<appName>]\n"
+        "    app startTimes\n"
         "    app runProc <appName> <procName> [options]\n"
         "    app runProc <appName> [<procName>] --exe=<exePath> [options]\n"
         "\n"
@@ -260,6 +286,11 @@ static void PrintHelp
         "       If no name is given, prints the information of all installed applications.\n"
         "       If a name is given, prints the information of the specified application.\n"
         "\n"
+        "    app startTimes\n"
+        "       Prints when each auto-started application was launched at start-up, in launch\n"
+        "       order, with its start level (servers are launched at lower levels than their\n"
+        "       clients).  Times are in milliseconds, from the first launch.\n"
+        "\n"
         "    app runProc <appName> <procName> [options]\n"
         "       Runs a configured process inside an app using the process settings from the\n"
         "       configuration database.  If an exePath is provided as an option then the specified\n"
@@ -693,6 +724,116 @@ static void PrintStatus
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds an app to the start-up timeline, if it was auto-started.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetAppStartTimes
+(
+    const char* appNamePtr      ///< [IN] Application name.
+)
+{
+    StartTime_t entry;
+
+    entry.result = le_appCtrl_GetStartTimes(appNamePtr, &entry.level,
+                                            &entry.launchStart, &entry.launchEnd);
+    if (entry.result == LE_NOT_FOUND)
+    {
+        return;
+    }
+
+    INTERNAL_ERR_IF(le_utf8_Copy(entry.appName, appNamePtr, sizeof(entry.appName), NULL) != LE_OK,
+                    "App name '%s' is too long.", appNamePtr);
+
+    StartTimes = realloc(StartTimes, (NumStartTimes + 1) * sizeof(StartTime_t));
+    INTERNAL_ERR_IF(StartTimes == NULL, "Out of memory.");
+
+    StartTimes[NumStartTimes++] = entry;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Orders start-up timeline entries by launch time, with apps not launched yet last.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareStartTimes
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    const StartTime_t* a = aPtr;
+    const StartTime_t* b = bPtr;
+
+    if ((a->result == LE_BUSY) != (b->result == LE_BUSY))
+    {
+        return (a->result == LE_BUSY) ? 1 : -1;
+    }
+    if (a->launchStart != b->launchStart)
+    {
+        return (a->launchStart < b->launchStart) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Implements the "startTimes" command.
+ *
+ * @note This function does not return.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void PrintStartTimes
+(
+    void
+)
+{
+    le_appCtrl_ConnectService();
+
+    ListInstalledApps(GetAppStartTimes);
+
+    if (NumStartTimes == 0)
+    {
+        printf("No applications were auto-started.\n");
+        exit(EXIT_SUCCESS);
+    }
+
+    qsort(StartTimes, NumStartTimes, sizeof(StartTime_t), CompareStartTimes);
+
+    uint64_t firstStart = StartTimes[0].launchStart;
+    size_t i;
+
+    printf("%5s %10s %10s  %s\n", "LEVEL", "START", "LAUNCH", "APP");
+
+    for (i = 0; i < NumStartTimes; i++)
+    {
+        StartTime_t* entryPtr = &StartTimes[i];
+
+        if (entryPtr->result == LE_BUSY)
+        {
+            printf("%5" PRIu32 " %10s %10s  %s\n", entryPtr->level, "-", "-", entryPtr->appName);
+        }
+        else
+        {
+            printf("%5" PRIu32 " %10" PRIu64 " %10" PRIu64 "  %s%s\n",
+                   entryPtr->level,
+                   entryPtr->launchStart - firstStart,
+                   entryPtr->launchEnd - entryPtr->launchStart,
+                   entryPtr->appName,
+                   (entryPtr->result == LE_OK) ? "" : " [failed]");
+        }
+    }
+
+    free(StartTimes);
+
+    exit(EXIT_SUCCESS);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Parses a line of the APP_INFO_FILE for display.
@@ -1930,6 +2071,10 @@ static void CommandArgHandler
 
         le_arg_AddPositionalCallback(AppNameArgHandler);
     }
+    else if (strcmp(command, "startTimes") == 0)
+    {
+        CommandFunc = PrintStartTimes;
+    }
     else if (strcmp(command, "info") == 0)
     {
         CommandFunc = PrintInfo;
@@ -21,8 +21,11 @@
 #include "limit.h"
 #include "addr.h"
 #include "fileDescriptor.h"
+#include "statsSnapshot.h"
 #include "timer.h"
 
+#include <dirent.h>
+#include <sys/mman.h>
 #include <sys/ptrace.h>
 
 //--------------------------------------------------------------------------------------------------
@@ -96,7 +99,8 @@ typedef enum
     INSPECT_INSP_TYPE_IPC_SERVERS,
     INSPECT_INSP_TYPE_IPC_CLIENTS,
     INSPECT_INSP_TYPE_IPC_SERVERS_SESSIONS,
-    INSPECT_INSP_TYPE_IPC_CLIENTS_SESSIONS
+    INSPECT_INSP_TYPE_IPC_CLIENTS_SESSIONS,
+    INSPECT_INSP_TYPE_EVENT_LOOP
 }
 InspType_t;
 
@@ -165,6 +169,9 @@ typedef struct MemPoolIter
 {
     RemoteDlsListAccess_t memPoolList; ///< Memory pool list in the remote process.
     le_mem_Pool_t currMemPool;          ///< Current memory pool from the list.
+#if LE_CONFIG_MEM_POOL_PROFILE
+    mem_AllocProfile_t currProfile;     ///< Allocation samples of the current memory pool.
+#endif
 }
 MemPoolIter_t;
 
@@ -306,6 +313,69 @@ static le_mem_PoolRef_t TimerRecPool;
 #define DEFAULT_RETRY_INTERVAL              500000
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of call sites listed for each pool by "inspect pools --hot", and the length of the string
+ * listing them (each is "0x<address>:<samples> ").
+ */
+//--------------------------------------------------------------------------------------------------
+#define HOT_CALLERS         3
+#define HOT_CALLERS_STR_LEN (HOT_CALLERS * (2 + 2 * sizeof(void*) + 1 + 4 + 1))
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Length of the strings listing a thread's dispatch times by "inspect eventloop" (each bucket is
+ * "<label>:<count> "), and its slowest handlers (each is "0x<address>:<microseconds>us ").
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_EVENT_PROFILING
+#define DISPATCH_TIMES_STR_LEN      (EVENT_DISPATCH_TIME_BUCKETS * (6 + 1 + 10 + 1))
+#define SLOWEST_HANDLERS_STR_LEN    (EVENT_SLOWEST_HANDLERS * (2 + 2 * sizeof(void*) + 1 + 10 + 3))
+#else
+#define DISPATCH_TIMES_STR_LEN      0
+#define SLOWEST_HANDLERS_STR_LEN    0
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Length of the string listing a session's request-response latencies (each bucket is
+ * "<label>:<count> ").
+ */
+//--------------------------------------------------------------------------------------------------
+#if LE_CONFIG_IPC_SESSION_STATS
+#define LATENCIES_STR_LEN           (MSGSESSION_LATENCY_BUCKETS * (6 + 1 + 10 + 1))
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of times a statistics snapshot is copied again when it was refreshed while it was being
+ * copied, and the time between tries in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SNAPSHOT_READ_TRIES         20
+#define SNAPSHOT_READ_RETRY_USEC    1000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of refresh intervals after which a statistics snapshot is out of date, e.g. because the
+ * process' main thread is blocked.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SNAPSHOT_STALE_INTERVALS    3
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start of the target of the /proc/<pid>/fd link of a process' statistics snapshot memfd.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SNAPSHOT_LINK_PREFIX        "/memfd:" STATS_SNAPSHOT_MEMFD_NAME " "
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Variable storing the configurable refresh interval in seconds.
@@ -364,6 +434,31 @@ static bool IsFollowing = false;
 static bool IsVerbose = false;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * true = show the pools' allocation rates and busiest call sites instead of their usage.
+ **/
+//--------------------------------------------------------------------------------------------------
+static bool IsHot = false;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * true = the pools are read from the process' statistics snapshot, without stopping it.
+ **/
+//--------------------------------------------------------------------------------------------------
+static bool UseSnapshot = false;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Local copy of the process' statistics snapshot, and its size in bytes.
+ **/
+//--------------------------------------------------------------------------------------------------
+static statsSnapshot_Header_t* SnapshotCopyPtr;
+static size_t SnapshotCopySize;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * true = child process stopped
@@ -408,8 +503,9 @@ static int TimerTypeIndex = TIMER_NON_WAKEUP;
 //--------------------------------------------------------------------------------------------------
 typedef enum
 {
-    INSPECT_SUCCESS,    ///< inspection completed without interruption or error.
-    INSPECT_INTERRUPTED ///< inspection was interrupted due to list changes.
+    INSPECT_SUCCESS,                ///< inspection completed without interruption or error.
+    INSPECT_INTERRUPTED,            ///< inspection was interrupted due to list changes.
+    INSPECT_SNAPSHOT_UNAVAILABLE    ///< the statistics snapshot couldn't be read, or is stale.
 }
 InspectEndStatus_t;
 
@@ -641,6 +737,226 @@ static le_result_t TargetReadAddress
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a null-terminated string from the memory of an attached target process.
+ *
+ * @return
+ *      - LE_OK if the whole string was read.
+ *      - LE_OVERFLOW if the string was truncated to fit in the buffer.
+ *      - LE_FAULT if the memory couldn't be read.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t TargetReadString
+(
+    pid_t pid,              ///< [IN] Remote process to read address
+    uintptr_t remoteAddr,   ///< [IN] Remote address of the string
+    char* buffer,           ///< [OUT] Destination to read into
+    size_t size             ///< [IN] Size of the buffer, in bytes (including the terminator)
+)
+{
+    size_t len = 0;
+
+    // Read one word at most at a time, so as not to read past the end of the string's mapping.
+    while (len < size - 1)
+    {
+        char chunk[sizeof(long)];
+        size_t chunkSize = sizeof(long) - ((remoteAddr + len) % sizeof(long));
+        size_t i;
+
+        if (TargetReadAddress(pid, remoteAddr + len, chunk, chunkSize) != LE_OK)
+        {
+            buffer[len] = '\0';
+            return LE_FAULT;
+        }
+
+        for (i = 0; (i < chunkSize) && (len < size - 1); i++)
+        {
+            buffer[len] = chunk[i];
+            if (chunk[i] == '\0')
+            {
+                return LE_OK;
+            }
+            len++;
+        }
+    }
+
+    buffer[len] = '\0';
+    return LE_OVERFLOW;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the statistics snapshot memfd of a process, through the process' /proc/<pid>/fd links.
+ *
+ * @return
+ *      File descriptor of the memfd, or -1 if the process doesn't publish a snapshot.
+ */
+//--------------------------------------------------------------------------------------------------
+static int OpenSnapshot
+(
+    pid_t pid               ///< [IN] Process whose snapshot is to be opened.
+)
+{
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+
+    DIR* dirPtr = opendir(path);
+    if (dirPtr == NULL)
+    {
+        return -1;
+    }
+
+    int fd = -1;
+    struct dirent* entryPtr;
+
+    while ((fd < 0) && ((entryPtr = readdir(dirPtr)) != NULL))
+    {
+        char linkPath[PATH_MAX];
+        char target[PATH_MAX];
+
+        snprintf(linkPath, sizeof(linkPath), "%s/%s", path, entryPtr->d_name);
+
+        ssize_t len = readlink(linkPath, target, sizeof(target) - 1);
+        if (len <= 0)
+        {
+            continue;
+        }
+        target[len] = '\0';
+
+        if (strncmp(target, SNAPSHOT_LINK_PREFIX, sizeof(SNAPSHOT_LINK_PREFIX) - 1) == 0)
+        {
+            fd = open(linkPath, O_RDONLY | O_CLOEXEC);
+        }
+    }
+
+    closedir(dirPtr);
+
+    return fd;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy a statistics snapshot into SnapshotCopyPtr.
+ *
+ * @return
+ *      - LE_OK if a consistent copy was made.
+ *      - LE_BUSY if the snapshot was being refreshed or grown.
+ *      - LE_FAULT if the snapshot couldn't be mapped.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CopySnapshot
+(
+    int fd                  ///< [IN] Snapshot memfd.
+)
+{
+    struct stat st;
+    if ((fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(statsSnapshot_Header_t)))
+    {
+        return LE_FAULT;
+    }
+
+    const statsSnapshot_Header_t* sharedPtr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (sharedPtr == MAP_FAILED)
+    {
+        return LE_FAULT;
+    }
+
+    le_result_t result = LE_BUSY;
+    size_t maxPools = (st.st_size - sizeof(statsSnapshot_Header_t)) / sizeof(mem_PoolSnapshot_t);
+    uint32_t seq = __atomic_load_n(&sharedPtr->seq, __ATOMIC_ACQUIRE);
+
+    // An odd sequence number means the snapshot is being refreshed, and more pools than were
+    // mapped means it was grown after it was mapped.
+    if (((seq & 1) == 0) && (sharedPtr->numPools <= maxPools))
+    {
+        size_t size = sizeof(statsSnapshot_Header_t) +
+                      (sharedPtr->numPools * sizeof(mem_PoolSnapshot_t));
+
+        if (size > SnapshotCopySize)
+        {
+            SnapshotCopyPtr = realloc(SnapshotCopyPtr, size);
+            INTERNAL_ERR_IF(SnapshotCopyPtr == NULL, "Can't allocate %zu bytes.", size);
+            SnapshotCopySize = size;
+        }
+
+        memcpy(SnapshotCopyPtr, sharedPtr, size);
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if ((__atomic_load_n(&sharedPtr->seq, __ATOMIC_RELAXED) == seq) &&
+            (size >= sizeof(statsSnapshot_Header_t) +
+                     (SnapshotCopyPtr->numPools * sizeof(mem_PoolSnapshot_t))))
+        {
+            result = LE_OK;
+        }
+    }
+
+    munmap((void*)sharedPtr, st.st_size);
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the statistics snapshot of the process under inspection into SnapshotCopyPtr.
+ *
+ * @return
+ *      - LE_OK if the snapshot was read.
+ *      - LE_NOT_FOUND if the process doesn't publish a snapshot.
+ *      - LE_TIMEOUT if the snapshot is out of date.
+ *      - LE_FAULT if the snapshot couldn't be read.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadSnapshot
+(
+    void
+)
+{
+    int fd = OpenSnapshot(PidToInspect);
+    if (fd < 0)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    le_result_t result;
+    int tries = 0;
+
+    while (((result = CopySnapshot(fd)) == LE_BUSY) && (++tries < SNAPSHOT_READ_TRIES))
+    {
+        usleep(SNAPSHOT_READ_RETRY_USEC);
+    }
+
+    fd_Close(fd);
+
+    if (result != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    // A process forked without exec'ing shares its parent's snapshot.
+    if ((SnapshotCopyPtr->magic != STATS_SNAPSHOT_MAGIC) ||
+        (SnapshotCopyPtr->pid != PidToInspect))
+    {
+        return LE_FAULT;
+    }
+
+    struct timespec now;
+    LE_ASSERT(clock_gettime(CLOCK_MONOTONIC, &now) == 0);
+    uint64_t nowNs = ((uint64_t)now.tv_sec * 1000000000) + (uint64_t)now.tv_nsec;
+    uint64_t maxAgeNs = (uint64_t)SnapshotCopyPtr->intervalMs * SNAPSHOT_STALE_INTERVALS * 1000000;
+
+    if ((SnapshotCopyPtr->timeNs == 0) || (nowNs - SnapshotCopyPtr->timeNs > maxAgeNs))
+    {
+        return LE_TIMEOUT;
+    }
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initialize a RemoteDlsListAccess_t data struct.
@@ -1480,6 +1796,21 @@ static le_mem_Pool_t* GetNextMemPool
         INTERNAL_ERR(REMOTE_READ_ERR("mempool object"));
     }
 
+#if LE_CONFIG_MEM_POOL_PROFILE
+    // Read the pool's allocation samples too, and point our copy of the pool at them.
+    if (memPoolIterRef->currMemPool.profilePtr != NULL)
+    {
+        if (TargetReadAddress(PidToInspect, (uintptr_t)memPoolIterRef->currMemPool.profilePtr,
+                              &(memPoolIterRef->currProfile),
+                              sizeof(memPoolIterRef->currProfile)) != LE_OK)
+        {
+            INTERNAL_ERR(REMOTE_READ_ERR("mempool allocation samples"));
+        }
+
+        memPoolIterRef->currMemPool.profilePtr = &(memPoolIterRef->currProfile);
+    }
+#endif
+
     return &(memPoolIterRef->currMemPool);
 }
 
@@ -2061,7 +2392,7 @@ static void PrintHelp
         "              Legato process.\n"
         "\n"
         "SYNOPSIS:\n"
-        "    inspect <pools|saferefs|threads|timers|mutexes|semaphores> [OPTIONS] PID\n"
+        "    inspect <pools|saferefs|threads|timers|mutexes|semaphores|eventloop> [OPTIONS] PID\n"
         "    inspect ipc <servers|clients [sessions]> [OPTIONS] PID\n"
         "\n"
         "DESCRIPTION:\n"
@@ -2076,6 +2407,9 @@ static void PrintHelp
                                         " specified process.\n"
         "    inspect ipc                Prints the info of ipc in all threads for the"
                                         " specified process.\n"
+        "    inspect eventloop          Prints the event loop statistics of each thread: reports\n"
+        "                               dispatched and waiting, longest dispatch, dispatch times\n"
+        "                               and slowest handlers (needs LE_CONFIG_EVENT_PROFILING).\n"
         "\n"
         "OPTIONS:\n"
         "    -f\n"
@@ -2090,6 +2424,10 @@ static void PrintHelp
         "    --format=json\n"
         "        Outputs the inspection results in JSON format.\n"
         "\n"
+        "    --hot\n"
+        "        For pools, prints the recent allocation rate, peak usage, number of expansions\n"
+        "        and busiest call sites of each pool instead (needs LE_CONFIG_MEM_POOL_PROFILE).\n"
+        "\n"
         "    --help\n"
         "        Display this help and exit.\n"
         );
@@ -2164,12 +2502,23 @@ static ColumnInfo_t MemPoolTableInfo[] =
     {"OVERFLOWS",   "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"ALLOCS",      "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),            false, 0, true},
     {"BLK BYTES",   "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
+    {"FRAG %",      "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"USED BYTES",  "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"MEMORY POOL", "%-*s", NULL, "%-*s",       LIMIT_MAX_MEM_POOL_NAME_LEN, true,  0, true},
     {"SUB-POOL",    "%*s",  NULL, "%*s",        0,                           true,  0, true}
 };
 static size_t MemPoolTableInfoSize = NUM_ARRAY_MEMBERS(MemPoolTableInfo);
 
+static ColumnInfo_t MemPoolHotTableInfo[] =
+{
+    {"ALLOCS/SEC",  "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),            false, 0, true},
+    {"MAX USED",    "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
+    {"EXPANSIONS",  "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
+    {"TOP CALLERS", "%-*s", NULL, "%-*s",       HOT_CALLERS_STR_LEN,         true,  0, true},
+    {"MEMORY POOL", "%-*s", NULL, "%-*s",       LIMIT_MAX_MEM_POOL_NAME_LEN, true,  0, true}
+};
+static size_t MemPoolHotTableInfoSize = NUM_ARRAY_MEMBERS(MemPoolHotTableInfo);
+
 static ColumnInfo_t ThreadObjTableInfo[] =
 {
     {"NAME",             "%*s", NULL, "%*s",  MAX_THREAD_NAME_SIZE, true,  0, true},
@@ -2200,10 +2549,12 @@ static size_t TimerTableInfoSize = NUM_ARRAY_MEMBERS(TimerTableInfo);
 
 static ColumnInfo_t MutexTableInfo[] =
 {
-    {"NAME",         "%*s", NULL, "%*s", MAX_NAME_BYTES,       true,  0, true},
-    {"LOCK COUNT",   "%*s", NULL, "%*d", sizeof(int),          false, 0, true},
-    {"RECURSIVE",    "%*s", NULL, "%*u", sizeof(bool),         false, 0, true},
-    {"WAITING LIST", "%*s", NULL, "%*s", MAX_THREAD_NAME_SIZE, true,  0, true}
+    {"NAME",         "%*s", NULL, "%*s",        MAX_NAME_BYTES,       true,  0, true},
+    {"LOCK COUNT",   "%*s", NULL, "%*d",        sizeof(int),          false, 0, true},
+    {"RECURSIVE",    "%*s", NULL, "%*u",        sizeof(bool),         false, 0, true},
+    {"CONTENDED",    "%*s", NULL, "%*u",        sizeof(uint32_t),     false, 0, false},
+    {"WAIT US",      "%*s", NULL, "%*"PRIu64"", sizeof(uint64_t),     false, 0, false},
+    {"WAITING LIST", "%*s", NULL, "%*s",        MAX_THREAD_NAME_SIZE, true,  0, true}
 };
 static size_t MutexTableInfoSize = NUM_ARRAY_MEMBERS(MutexTableInfo);
 
@@ -2246,10 +2597,34 @@ static ColumnInfo_t SessionObjTableInfo[] =
     {"INTERFACE NAME", "%*s", NULL, "%*s", LIMIT_MAX_IPC_INTERFACE_NAME_BYTES, true,  0, true},
     {"STATE",          "%*s", NULL, "%*s", 0,                                  true,  0, true},
     {"THREAD NAME",    "%*s", NULL, "%*s", MAX_THREAD_NAME_SIZE,               true,  0, true},
-    {"FD",             "%*s", NULL, "%*d", sizeof(int),                        false, 0, false}
+    {"FD",             "%*s", NULL, "%*d", sizeof(int),                        false, 0, false},
+#if LE_CONFIG_IPC_SESSION_STATS
+    {"SENT",           "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),               false, 0, true},
+    {"RECEIVED",       "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),               false, 0, true},
+    {"TX BYTES",       "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),               false, 0, false},
+    {"RX BYTES",       "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),               false, 0, false},
+    {"TX QUEUE MAX",   "%*s",  NULL, "%*zu",       sizeof(size_t),                 false, 0, true},
+    {"LATENCIES",      "%-*s", NULL, "%-*s",       LATENCIES_STR_LEN,              true,  0, true}
+#endif
 };
 static size_t SessionObjTableInfoSize = NUM_ARRAY_MEMBERS(SessionObjTableInfo);
 
+static ColumnInfo_t EventLoopTableInfo[] =
+{
+    {"NAME",             "%*s",  NULL, "%*s",        MAX_THREAD_NAME_SIZE,     true,  0, true},
+    {"DISPATCHES",       "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),         false, 0, true},
+    {"QUEUED",           "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),         false, 0, true},
+    {"MAX BATCH",        "%*s",  NULL, "%*zu",       sizeof(size_t),           false, 0, true},
+    {"MAX US",           "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),         false, 0, true},
+    {"SLOW",             "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),         false, 0, false},
+    {"FD EVENTS",        "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),         false, 0, false},
+    {"COALESCED",        "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),         false, 0, false},
+    {"TIMER EXPIRIES",   "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),         false, 0, false},
+    {"DISPATCH TIMES",   "%-*s", NULL, "%-*s",       DISPATCH_TIMES_STR_LEN,   true,  0, true},
+    {"SLOWEST HANDLERS", "%-*s", NULL, "%-*s",       SLOWEST_HANDLERS_STR_LEN, true,  0, true}
+};
+static size_t EventLoopTableInfoSize = NUM_ARRAY_MEMBERS(EventLoopTableInfo);
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -2551,7 +2926,14 @@ static void InitDisplay
     {
         case INSPECT_INSP_TYPE_MEM_POOL:
             // Initialize the display tables with the optimal column widths.
-            InitDisplayTable(MemPoolTableInfo, MemPoolTableInfoSize);
+            if (IsHot)
+            {
+                InitDisplayTable(MemPoolHotTableInfo, MemPoolHotTableInfoSize);
+            }
+            else
+            {
+                InitDisplayTable(MemPoolTableInfo, MemPoolTableInfoSize);
+            }
             break;
 
         case INSPECT_INSP_TYPE_THREAD_OBJ:
@@ -2587,6 +2969,10 @@ static void InitDisplay
             InitDisplayTable(SessionObjTableInfo, SessionObjTableInfoSize);
             break;
 
+        case INSPECT_INSP_TYPE_EVENT_LOOP:
+            InitDisplayTable(EventLoopTableInfo, EventLoopTableInfoSize);
+            break;
+
         default:
             INTERNAL_ERR("Failed to initialize display table - unexpected inspect type %d.",
                          inspectType);
@@ -2741,8 +3127,8 @@ static int PrintInspectHeader
     {
         case INSPECT_INSP_TYPE_MEM_POOL:
             strncpy(inspectTypeString, "Memory Pools", inspectTypeStringSize);
-            table = MemPoolTableInfo;
-            tableSize = MemPoolTableInfoSize;
+            table = IsHot ? MemPoolHotTableInfo : MemPoolTableInfo;
+            tableSize = IsHot ? MemPoolHotTableInfoSize : MemPoolTableInfoSize;
             break;
 
         case INSPECT_INSP_TYPE_THREAD_OBJ:
@@ -2799,6 +3185,12 @@ static int PrintInspectHeader
             tableSize = SessionObjTableInfoSize;
             break;
 
+        case INSPECT_INSP_TYPE_EVENT_LOOP:
+            strncpy(inspectTypeString, "Event Loop", inspectTypeStringSize);
+            table = EventLoopTableInfo;
+            tableSize = EventLoopTableInfoSize;
+            break;
+
         default:
             INTERNAL_ERR("unexpected inspect type %d.", InspectType);
     }
@@ -2909,7 +3301,7 @@ static void ExportArrayToJson
 // double quotes are added per json standard.
 static void ExportStrToJson
 (
-    char*         field,     ///< [IN] the data to be exported to json.
+    const char*   field,     ///< [IN] the data to be exported to json.
     ColumnInfo_t* table,     ///< [IN] XXXTableInfo ref.
     size_t        tableSize, ///< [IN] XXXTableInfo size.
     int*          indexRef,  ///< [IN/OUT] iterator to parse the table.
@@ -3111,7 +3503,7 @@ static void ExportBoolToJson
 // string
 static void FillStrColField
 (
-    char*         field,     ///< [IN] the data to be printed to the ColField of the table.
+    const char*   field,     ///< [IN] the data to be printed to the ColField of the table.
     ColumnInfo_t* table,     ///< [IN] XXXTableInfo ref.
     size_t        tableSize, ///< [IN] XXXTableInfo size.
     int*          indexRef   ///< [IN/OUT] iterator to parse the table.
@@ -3240,29 +3632,35 @@ static bool IsPrintedNodeFirst = true;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Print memory pool information to stdout.
+ * Print memory pool information to stdout, from a pool's statistics.
  */
 //--------------------------------------------------------------------------------------------------
-static int PrintMemPoolInfo
+static int PrintMemPoolSnapshotInfo
 (
-    le_mem_PoolRef_t memPool    ///< [IN] ref to mem pool to be printed.
+    const mem_PoolSnapshot_t* poolPtr   ///< [IN] Statistics of the pool to be printed.
 )
 {
     int lineCount = 0;
 
-    // Get pool stats.
-    le_mem_PoolStats_t poolStats;
-    le_mem_GetStats(memPool, &poolStats);
+    size_t blockSize = poolPtr->blockSize;
+
+    // Percentage of the object space handed out by variable-size allocations that went unused.
+    // Pools that only serve fixed-size allocations show 0.
+    size_t fragPercent = 0;
+    if ((poolPtr->numAllocs > 0) && (poolPtr->numBytesRequested > 0))
+    {
+        uint64_t allocatedBytes = poolPtr->numAllocs * poolPtr->objectSize;
 
-    size_t blockSize = le_mem_GetObjectFullSize(memPool);
+        if (poolPtr->numBytesRequested < allocatedBytes)
+        {
+            fragPercent = 100 - (size_t)(poolPtr->numBytesRequested * 100 / allocatedBytes);
+        }
+    }
 
     // Determine if this pool is a sub-pool, and set the appropriate string to display it.
-    char* subPoolStr = le_mem_IsSubPool(memPool) ? SubPoolStr : SuperPoolStr;
+    char* subPoolStr = poolPtr->isSubPool ? SubPoolStr : SuperPoolStr;
 
-    // Get the pool name.
-    char name[LIMIT_MAX_COMPONENT_NAME_LEN + 1 + LIMIT_MAX_MEM_POOL_NAME_BYTES];
-    INTERNAL_ERR_IF(le_mem_GetName(memPool, name, sizeof(name)) != LE_OK,
-                    "Name buffer is too small.");
+    const char* name = poolPtr->name;
 
     // Output mem pool info
     int index = 0;
@@ -3272,19 +3670,21 @@ static int PrintMemPoolInfo
         // NOTE that the order has to correspond to the column orders in the corresponding table.
         // Since this order is "hardcoded" in a sense, one should avoid having multiple
         // copies of these. The same applies to other PrintXXXInfo functions.
-        FillSizeTColField (le_mem_GetObjectCount(memPool),       MemPoolTableInfo,
+        FillSizeTColField (poolPtr->totalBlocks,                 MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
-        FillSizeTColField (poolStats.numBlocksInUse,             MemPoolTableInfo,
+        FillSizeTColField (poolPtr->numBlocksInUse,              MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
-        FillSizeTColField (poolStats.maxNumBlocksUsed,           MemPoolTableInfo,
+        FillSizeTColField (poolPtr->maxNumBlocksUsed,            MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
-        FillSizeTColField (poolStats.numOverflows,               MemPoolTableInfo,
+        FillSizeTColField (poolPtr->numOverflows,                MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
-        FillUint64ColField(poolStats.numAllocs,                  MemPoolTableInfo,
+        FillUint64ColField(poolPtr->numAllocs,                   MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
         FillSizeTColField (blockSize,                            MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
-        FillSizeTColField (blockSize*(poolStats.numBlocksInUse), MemPoolTableInfo,
+        FillSizeTColField (fragPercent,                          MemPoolTableInfo,
+                                                                 MemPoolTableInfoSize, &index);
+        FillSizeTColField (blockSize*(poolPtr->numBlocksInUse),  MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
         FillStrColField   (name,                                 MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
@@ -3310,19 +3710,21 @@ static int PrintMemPoolInfo
 
         printf("[");
 
-        ExportSizeTToJson (le_mem_GetObjectCount(memPool),  MemPoolTableInfo,
+        ExportSizeTToJson (poolPtr->totalBlocks,            MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
-        ExportSizeTToJson (poolStats.numBlocksInUse,        MemPoolTableInfo,
+        ExportSizeTToJson (poolPtr->numBlocksInUse,         MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
-        ExportSizeTToJson (poolStats.maxNumBlocksUsed,      MemPoolTableInfo,
+        ExportSizeTToJson (poolPtr->maxNumBlocksUsed,       MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
-        ExportSizeTToJson (poolStats.numOverflows,          MemPoolTableInfo,
+        ExportSizeTToJson (poolPtr->numOverflows,           MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
-        ExportUint64ToJson(poolStats.numAllocs,             MemPoolTableInfo,
+        ExportUint64ToJson(poolPtr->numAllocs,              MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
         ExportSizeTToJson (blockSize,                       MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
-        ExportSizeTToJson (blockSize*(poolStats.numBlocksInUse), MemPoolTableInfo,
+        ExportSizeTToJson (fragPercent,                     MemPoolTableInfo,
+                                                            MemPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (blockSize*(poolPtr->numBlocksInUse), MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
         ExportStrToJson   (name,                            MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
@@ -3336,6 +3738,180 @@ static int PrintMemPoolInfo
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print memory pool information to stdout.
+ */
+//--------------------------------------------------------------------------------------------------
+static int PrintMemPoolInfo
+(
+    le_mem_PoolRef_t memPool    ///< [IN] ref to mem pool to be printed.
+)
+{
+    le_mem_PoolStats_t poolStats;
+    le_mem_GetStats(memPool, &poolStats);
+
+    mem_PoolSnapshot_t pool =
+    {
+        .numAllocs = poolStats.numAllocs,
+        .numBytesRequested = poolStats.numBytesRequested,
+        .totalBlocks = le_mem_GetObjectCount(memPool),
+        .numBlocksInUse = poolStats.numBlocksInUse,
+        .maxNumBlocksUsed = poolStats.maxNumBlocksUsed,
+        .numOverflows = poolStats.numOverflows,
+        .objectSize = le_mem_GetObjectSize(memPool),
+        .blockSize = le_mem_GetObjectFullSize(memPool),
+        .isSubPool = le_mem_IsSubPool(memPool)
+    };
+
+    INTERNAL_ERR_IF(le_mem_GetName(memPool, pool.name, sizeof(pool.name)) != LE_OK,
+                    "Name buffer is too small.");
+
+    return PrintMemPoolSnapshotInfo(&pool);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print a memory pool's allocation rate and busiest call sites to stdout.
+ */
+//--------------------------------------------------------------------------------------------------
+static int PrintMemPoolHotInfo
+(
+    le_mem_PoolRef_t memPool    ///< [IN] ref to mem pool to be printed.
+)
+{
+    int lineCount = 0;
+
+    le_mem_PoolStats_t poolStats;
+    le_mem_GetStats(memPool, &poolStats);
+
+    uint64_t allocRate = 0;
+    char callersStr[HOT_CALLERS_STR_LEN + 1] = "";
+
+#if LE_CONFIG_MEM_POOL_PROFILE
+    le_mem_AllocSample_t samples[LE_CONFIG_MEM_POOL_PROFILE_SAMPLES];
+    size_t numSamples = le_mem_GetAllocSamples(memPool, samples, NUM_ARRAY_MEMBERS(samples));
+
+    if (numSamples > 0)
+    {
+        // Each sample stands for LE_CONFIG_MEM_POOL_PROFILE_INTERVAL allocations.  Measuring up to
+        // now (rather than up to the newest sample) lets the rate fall off when the pool goes idle.
+        // The relative clock is system-wide, so it matches the inspected process's.
+        le_clk_Time_t now = le_clk_GetRelativeTime();
+        uint64_t nowUsec = (uint64_t)now.sec * 1000000 + now.usec;
+
+        if (nowUsec > samples[0].timestamp)
+        {
+            allocRate = (uint64_t)numSamples * LE_CONFIG_MEM_POOL_PROFILE_INTERVAL * 1000000 /
+                        (nowUsec - samples[0].timestamp);
+        }
+
+        // Count the samples from each call site, and list the busiest.
+        void* callers[LE_CONFIG_MEM_POOL_PROFILE_SAMPLES];
+        size_t counts[LE_CONFIG_MEM_POOL_PROFILE_SAMPLES];
+        size_t numCallers = 0;
+        size_t i, j;
+
+        for (i = 0; i < numSamples; i++)
+        {
+            for (j = 0; (j < numCallers) && (callers[j] != samples[i].callerPtr); j++)
+            {
+            }
+            if (j == numCallers)
+            {
+                callers[numCallers] = samples[i].callerPtr;
+                counts[numCallers] = 0;
+                numCallers++;
+            }
+            counts[j]++;
+        }
+
+        size_t strLen = 0;
+        for (i = 0; (i < HOT_CALLERS) && (i < numCallers); i++)
+        {
+            size_t busiest = i;
+
+            for (j = i + 1; j < numCallers; j++)
+            {
+                if (counts[j] > counts[busiest])
+                {
+                    busiest = j;
+                }
+            }
+
+            void* busiestCaller = callers[busiest];
+            size_t busiestCount = counts[busiest];
+            callers[busiest] = callers[i];
+            counts[busiest] = counts[i];
+
+            strLen += snprintf(callersStr + strLen, sizeof(callersStr) - strLen,
+                               "%s%p:%" PRIuS, (i > 0) ? " " : "", busiestCaller, busiestCount);
+            if (strLen >= sizeof(callersStr))
+            {
+                break;
+            }
+        }
+    }
+#endif
+
+    char name[LIMIT_MAX_COMPONENT_NAME_LEN + 1 + LIMIT_MAX_MEM_POOL_NAME_BYTES];
+    INTERNAL_ERR_IF(le_mem_GetName(memPool, name, sizeof(name)) != LE_OK,
+                    "Name buffer is too small.");
+
+    int index = 0;
+
+    if (!IsOutputJson)
+    {
+        // NOTE that the order has to correspond to the column orders in the corresponding table.
+        FillUint64ColField(allocRate,                  MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index);
+        FillSizeTColField (poolStats.maxNumBlocksUsed, MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index);
+        FillSizeTColField (poolStats.numOverflows,     MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index);
+        FillStrColField   (callersStr,                 MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index);
+        FillStrColField   (name,                       MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index);
+
+        PrintInfo(MemPoolHotTableInfo, MemPoolHotTableInfoSize);
+        lineCount++;
+    }
+    else
+    {
+        // If it's not the first time, print a comma.
+        if (!IsPrintedNodeFirst)
+        {
+            printf(",");
+        }
+        else
+        {
+            IsPrintedNodeFirst = false;
+        }
+
+        bool printed = false;
+
+        printf("[");
+
+        ExportUint64ToJson(allocRate,                  MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolStats.maxNumBlocksUsed, MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolStats.numOverflows,     MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index, &printed);
+        ExportStrToJson   (callersStr,                 MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index, &printed);
+        ExportStrToJson   (name,                       MemPoolHotTableInfo,
+                                                       MemPoolHotTableInfoSize, &index, &printed);
+
+        printf("]");
+    }
+
+    return lineCount;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Print thread obj information to stdout.
@@ -3544,6 +4120,164 @@ static int PrintTimerInfo
 }
 
 
+#if LE_CONFIG_EVENT_PROFILING
+//--------------------------------------------------------------------------------------------------
+/**
+ * Labels of the buckets of the dispatch time histograms.  Each bucket holds dispatches up to four
+ * times as long as the previous one, so the bounds past 256us are rounded.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* DispatchTimeLabels[EVENT_DISPATCH_TIME_BUCKETS] =
+{
+    "<4us", "<16us", "<64us", "<256us", "<1ms", "<4ms", "<16ms", "<65ms", "<262ms", "<1s", "<4s",
+    ">4s"
+};
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print the event loop statistics of a thread to stdout.
+ */
+//--------------------------------------------------------------------------------------------------
+static int PrintEventLoopInfo
+(
+    thread_Obj_t* threadObjRef   ///< [IN] ref to thread obj whose event loop is to be printed.
+)
+{
+    int lineCount = 0;
+
+    // The thread object only points to its event record, so read that from the process too.
+    event_PerThreadRec_t eventRec;
+    if ((threadObjRef->eventRecPtr == NULL) ||
+        (TargetReadAddress(PidToInspect, (uintptr_t)threadObjRef->eventRecPtr,
+                           &eventRec, sizeof(eventRec)) != LE_OK))
+    {
+        memset(&eventRec, 0, sizeof(eventRec));
+    }
+
+    uint64_t dispatchCount = 0;
+    uint64_t queuedCount = 0;
+    uint64_t fdEventCount = 0;
+    uint64_t fdCoalescedCount = 0;
+    uint64_t timerExpiryCount = 0;
+    uint64_t maxDispatchUs = (uint64_t)eventRec.maxDispatchTime.sec * 1000000 +
+                             eventRec.maxDispatchTime.usec;
+    char timesStr[DISPATCH_TIMES_STR_LEN + 1] = "";
+    char slowestStr[SLOWEST_HANDLERS_STR_LEN + 1] = "";
+
+#if LE_CONFIG_EVENT_PROFILING
+    dispatchCount = eventRec.dispatchCount;
+    queuedCount = eventRec.batchReportCount - eventRec.dispatchCount;
+    fdEventCount = eventRec.fdEventCount;
+    fdCoalescedCount = eventRec.fdCoalescedCount;
+    timerExpiryCount = eventRec.timerExpiryCount;
+
+    // Only list the buckets and handlers that have something in them.
+    size_t strLen = 0;
+    size_t i;
+    for (i = 0; (i < EVENT_DISPATCH_TIME_BUCKETS) && (strLen < sizeof(timesStr)); i++)
+    {
+        if (eventRec.dispatchTimeHistogram[i] != 0)
+        {
+            strLen += snprintf(timesStr + strLen, sizeof(timesStr) - strLen, "%s%s:%" PRIu32,
+                               (strLen > 0) ? " " : "", DispatchTimeLabels[i],
+                               eventRec.dispatchTimeHistogram[i]);
+        }
+    }
+
+    strLen = 0;
+    for (i = 0; (i < EVENT_SLOWEST_HANDLERS) && (strLen < sizeof(slowestStr)); i++)
+    {
+        event_HandlerTime_t* handlerTimePtr = &eventRec.slowestHandlers[i];
+
+        if (handlerTimePtr->funcPtr != NULL)
+        {
+            strLen += snprintf(slowestStr + strLen, sizeof(slowestStr) - strLen,
+                               "%s%p:%" PRIu64 "us", (strLen > 0) ? " " : "",
+                               handlerTimePtr->funcPtr,
+                               (uint64_t)handlerTimePtr->maxTime.sec * 1000000 +
+                               handlerTimePtr->maxTime.usec);
+        }
+    }
+#endif
+
+    int index = 0;
+
+    if (!IsOutputJson)
+    {
+        FillStrColField   (THREAD_NAME(threadObjRef->name), EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillUint64ColField(dispatchCount,                   EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillUint64ColField(queuedCount,                     EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillSizeTColField (eventRec.maxBatchLen,            EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillUint64ColField(maxDispatchUs,                   EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillUint64ColField(eventRec.slowDispatchCount,      EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillUint64ColField(fdEventCount,                    EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillUint64ColField(fdCoalescedCount,                EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillUint64ColField(timerExpiryCount,                EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillStrColField   (timesStr,                        EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+        FillStrColField   (slowestStr,                      EventLoopTableInfo,
+                                                            EventLoopTableInfoSize, &index);
+
+        PrintInfo(EventLoopTableInfo, EventLoopTableInfoSize);
+        lineCount++;
+    }
+    else
+    {
+        // If it's not the first time, print a comma.
+        if (!IsPrintedNodeFirst)
+        {
+            printf(",");
+        }
+        else
+        {
+            IsPrintedNodeFirst = false;
+        }
+
+        bool printed = false;
+
+        printf("[");
+
+        ExportStrToJson   (THREAD_NAME(threadObjRef->name), EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportUint64ToJson(dispatchCount,         EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportUint64ToJson(queuedCount,           EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportSizeTToJson (eventRec.maxBatchLen,  EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportUint64ToJson(maxDispatchUs,         EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportUint64ToJson(eventRec.slowDispatchCount, EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportUint64ToJson(fdEventCount,          EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportUint64ToJson(fdCoalescedCount,      EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportUint64ToJson(timerExpiryCount,      EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportStrToJson   (timesStr,              EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+        ExportStrToJson   (slowestStr,            EventLoopTableInfo,
+                                                  EventLoopTableInfoSize, &index, &printed);
+
+        printf("]");
+    }
+
+    return lineCount;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Helper functions for GetWaitingListThreadNames
@@ -3809,6 +4543,8 @@ static int PrintMutexInfo
         FillStrColField (MUTEX_NAME(mutexRef->name), MutexTableInfo, MutexTableInfoSize, &index);
         FillIntColField (mutexRef->lockCount,   MutexTableInfo, MutexTableInfoSize, &index);
         FillBoolColField(mutexRef->isRecursive, MutexTableInfo, MutexTableInfoSize, &index);
+        FillUint32ColField(mutexRef->contendedCount, MutexTableInfo, MutexTableInfoSize, &index);
+        FillUint64ColField(mutexRef->waitTimeUs, MutexTableInfo, MutexTableInfoSize, &index);
         FillStrColField (waitingThreadNames[0], MutexTableInfo, MutexTableInfoSize, &index);
 
         PrintInfo(MutexTableInfo, MutexTableInfoSize);
@@ -3849,6 +4585,10 @@ static int PrintMutexInfo
                                                   MutexTableInfoSize, &index, &printed);
         ExportBoolToJson (mutexRef->isRecursive,  MutexTableInfo,
                                                   MutexTableInfoSize, &index, &printed);
+        ExportUint32ToJson(mutexRef->contendedCount, MutexTableInfo,
+                                                  MutexTableInfoSize, &index, &printed);
+        ExportUint64ToJson(mutexRef->waitTimeUs,  MutexTableInfo,
+                                                  MutexTableInfoSize, &index, &printed);
         ExportArrayToJson(waitingThreadJsonArray, MutexTableInfo,
                                                   MutexTableInfoSize, &index, &printed);
 
@@ -4055,6 +4795,20 @@ static int PrintServiceObjInfo
         INTERNAL_ERR(REMOTE_READ_ERR("protocol object"));
     }
 
+    // Retrieve the interface name and the protocol identifier, which the objects only point to.
+    char interfaceName[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES];
+    char protocolId[LIMIT_MAX_PROTOCOL_ID_BYTES];
+    if (TargetReadString(PidToInspect, (uintptr_t)serviceObjRef->interface.id.name,
+                         interfaceName, sizeof(interfaceName)) == LE_FAULT)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("interface name"));
+    }
+    if (TargetReadString(PidToInspect, (uintptr_t)protocol.id,
+                         protocolId, sizeof(protocolId)) == LE_FAULT)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("protocol identifier"));
+    }
+
     // Convert the service state to a meaningful string.
     char* serviceStateStr = DefnToStr(serviceObjRef->state, ServiceStateTbl, ServiceStateTblSize);
 
@@ -4067,13 +4821,13 @@ static int PrintServiceObjInfo
 
     if (!IsOutputJson)
     {
-        FillStrColField  (serviceObjRef->interface.id.name, ServiceObjTableInfo,
+        FillStrColField  (interfaceName,                    ServiceObjTableInfo,
                                                             ServiceObjTableInfoSize, &index);
         FillStrColField  (serviceStateStr,                  ServiceObjTableInfo,
                                                             ServiceObjTableInfoSize, &index);
         FillStrColField  (threadName,                       ServiceObjTableInfo,
                                                             ServiceObjTableInfoSize, &index);
-        FillStrColField  (protocol.id,                      ServiceObjTableInfo,
+        FillStrColField  (protocolId,                       ServiceObjTableInfo,
                                                             ServiceObjTableInfoSize, &index);
         FillSizeTColField(protocol.maxPayloadSize,          ServiceObjTableInfo,
                                                             ServiceObjTableInfoSize, &index);
@@ -4099,13 +4853,13 @@ static int PrintServiceObjInfo
 
         printf("[");
 
-        ExportStrToJson  (serviceObjRef->interface.id.name, ServiceObjTableInfo,
+        ExportStrToJson  (interfaceName,                 ServiceObjTableInfo,
                                                          ServiceObjTableInfoSize, &index, &printed);
         ExportStrToJson  (serviceStateStr,               ServiceObjTableInfo,
                                                          ServiceObjTableInfoSize, &index, &printed);
         ExportStrToJson  (threadName,                    ServiceObjTableInfo,
                                                          ServiceObjTableInfoSize, &index, &printed);
-        ExportStrToJson  (protocol.id,                   ServiceObjTableInfo,
+        ExportStrToJson  (protocolId,                    ServiceObjTableInfo,
                                                          ServiceObjTableInfoSize, &index, &printed);
         ExportSizeTToJson(protocol.maxPayloadSize,       ServiceObjTableInfo,
                                                          ServiceObjTableInfoSize, &index, &printed);
@@ -4139,14 +4893,28 @@ static int PrintClientObjInfo
         INTERNAL_ERR(REMOTE_READ_ERR("protocol object"));
     }
 
+    // Retrieve the interface name and the protocol identifier, which the objects only point to.
+    char interfaceName[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES];
+    char protocolId[LIMIT_MAX_PROTOCOL_ID_BYTES];
+    if (TargetReadString(PidToInspect, (uintptr_t)clientObjRef->interface.id.name,
+                         interfaceName, sizeof(interfaceName)) == LE_FAULT)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("interface name"));
+    }
+    if (TargetReadString(PidToInspect, (uintptr_t)protocol.id,
+                         protocolId, sizeof(protocolId)) == LE_FAULT)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("protocol identifier"));
+    }
+
     // Output client object info
     int index = 0;
 
     if (!IsOutputJson)
     {
-        FillStrColField  (clientObjRef->interface.id.name, ClientObjTableInfo,
+        FillStrColField  (interfaceName,                   ClientObjTableInfo,
                                                            ClientObjTableInfoSize, &index);
-        FillStrColField  (protocol.id,                     ClientObjTableInfo,
+        FillStrColField  (protocolId,                      ClientObjTableInfo,
                                                            ClientObjTableInfoSize, &index);
         FillSizeTColField(protocol.maxPayloadSize,         ClientObjTableInfo,
                                                            ClientObjTableInfoSize, &index);
@@ -4170,9 +4938,9 @@ static int PrintClientObjInfo
 
         printf("[");
 
-        ExportStrToJson  (clientObjRef->interface.id.name, ClientObjTableInfo,
+        ExportStrToJson  (interfaceName,                  ClientObjTableInfo,
                                                           ClientObjTableInfoSize, &index, &printed);
-        ExportStrToJson  (protocol.id,                    ClientObjTableInfo,
+        ExportStrToJson  (protocolId,                     ClientObjTableInfo,
                                                           ClientObjTableInfoSize, &index, &printed);
         ExportSizeTToJson(protocol.maxPayloadSize,        ClientObjTableInfo,
                                                           ClientObjTableInfoSize, &index, &printed);
@@ -4207,16 +4975,46 @@ static int PrintSessionObjInfo
         INTERNAL_ERR(REMOTE_READ_ERR("interface object"));
     }
 
+    char interfaceName[LIMIT_MAX_IPC_INTERFACE_NAME_BYTES];
+    if (TargetReadString(PidToInspect, (uintptr_t)interface.id.name,
+                         interfaceName, sizeof(interfaceName)) == LE_FAULT)
+    {
+        INTERNAL_ERR(REMOTE_READ_ERR("interface name"));
+    }
+
     // Retrieve the thread name
     char threadName[MAX_THREAD_NAME_SIZE] = {0};
     LookupThreadName((size_t)sessionObjRef->threadRef, threadName, MAX_THREAD_NAME_SIZE);
 
+#if LE_CONFIG_IPC_SESSION_STATS
+    // List the request-response latencies, skipping the empty buckets.  Only client sessions
+    // have any.
+    static const char* latencyLabels[MSGSESSION_LATENCY_BUCKETS] =
+    {
+        "<16us", "<64us", "<256us", "<1ms", "<4ms", "<16ms", "<65ms", "<262ms", "<1s", ">1s"
+    };
+    const msgSession_Stats_t* statsPtr = &sessionObjRef->stats;
+    char latenciesStr[LATENCIES_STR_LEN + 1] = "";
+    size_t strLen = 0;
+    size_t i;
+
+    for (i = 0; (i < MSGSESSION_LATENCY_BUCKETS) && (strLen < sizeof(latenciesStr)); i++)
+    {
+        if (statsPtr->latencyHistogram[i] != 0)
+        {
+            strLen += snprintf(latenciesStr + strLen, sizeof(latenciesStr) - strLen,
+                               "%s%s:%" PRIu32, (strLen > 0) ? " " : "", latencyLabels[i],
+                               statsPtr->latencyHistogram[i]);
+        }
+    }
+#endif
+
     // Output session object info
     int index = 0;
 
     if (!IsOutputJson)
     {
-        FillStrColField(interface.id.name,       SessionObjTableInfo,
+        FillStrColField(interfaceName,           SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index);
         FillStrColField(sessionStateStr,         SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index);
@@ -4224,6 +5022,20 @@ static int PrintSessionObjInfo
                                                  SessionObjTableInfoSize, &index);
         FillIntColField(sessionObjRef->socketFd, SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index);
+#if LE_CONFIG_IPC_SESSION_STATS
+        FillUint64ColField(statsPtr->sentCount,     SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index);
+        FillUint64ColField(statsPtr->receivedCount, SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index);
+        FillUint64ColField(statsPtr->sentBytes,     SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index);
+        FillUint64ColField(statsPtr->receivedBytes, SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index);
+        FillSizeTColField (statsPtr->transmitQueueMax, SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index);
+        FillStrColField   (latenciesStr,            SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index);
+#endif
 
         PrintInfo(SessionObjTableInfo, SessionObjTableInfoSize);
         lineCount++;
@@ -4244,7 +5056,7 @@ static int PrintSessionObjInfo
 
         printf("[");
 
-        ExportStrToJson(interface.id.name,       SessionObjTableInfo,
+        ExportStrToJson(interfaceName,           SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index, &printed);
         ExportStrToJson(sessionStateStr,         SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index, &printed);
@@ -4252,6 +5064,20 @@ static int PrintSessionObjInfo
                                                  SessionObjTableInfoSize, &index, &printed);
         ExportIntToJson(sessionObjRef->socketFd, SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index, &printed);
+#if LE_CONFIG_IPC_SESSION_STATS
+        ExportUint64ToJson(statsPtr->sentCount,     SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index, &printed);
+        ExportUint64ToJson(statsPtr->receivedCount, SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index, &printed);
+        ExportUint64ToJson(statsPtr->sentBytes,     SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index, &printed);
+        ExportUint64ToJson(statsPtr->receivedBytes, SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index, &printed);
+        ExportSizeTToJson (statsPtr->transmitQueueMax, SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index, &printed);
+        ExportStrToJson   (latenciesStr,            SessionObjTableInfo,
+                                                    SessionObjTableInfoSize, &index, &printed);
+#endif
 
         printf("]");
     }
@@ -4290,13 +5116,18 @@ static int InspectEndHandling
             printf(">>> Detected list changes. Stopping inspection. <<<\n");
             lineCount++;
         }
+        else if (endStatus == INSPECT_SNAPSHOT_UNAVAILABLE)
+        {
+            printf(">>> Statistics snapshot is unavailable or out of date. <<<\n");
+            lineCount++;
+        }
     }
     else
     {
         // Print the end of "Data".
         printf("],");
 
-        if (endStatus == INSPECT_INTERRUPTED)
+        if (endStatus != INSPECT_SUCCESS)
         {
             printf("\"Interrupted\":true");
         }
@@ -4326,6 +5157,7 @@ static int InspectEndHandling
         switch (endStatus)
         {
             case INSPECT_SUCCESS:
+            case INSPECT_SNAPSHOT_UNAVAILABLE:
                 refreshInterval.sec = RefreshInterval;
                 refreshInterval.usec = 0;
                 break;
@@ -4357,6 +5189,35 @@ static int InspectEndHandling
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prints the memory pools of the process' statistics snapshot to stdout.
+ *
+ * @return Number of lines printed.
+ */
+//--------------------------------------------------------------------------------------------------
+static int InspectSnapshot
+(
+    void
+)
+{
+    int lineCount = 0;
+
+    if (ReadSnapshot() != LE_OK)
+    {
+        return InspectEndHandling(INSPECT_SNAPSHOT_UNAVAILABLE);
+    }
+
+    uint32_t i;
+    for (i = 0; i < SnapshotCopyPtr->numPools; i++)
+    {
+        lineCount += PrintMemPoolSnapshotInfo(&SnapshotCopyPtr->pools[i]);
+    }
+
+    return lineCount + InspectEndHandling(INSPECT_SUCCESS);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Performs the specified inspection for the specified process. Prints the results to stdout.
@@ -4388,7 +5249,8 @@ static void InspectFunc
             createIterFunc    = (CreateIterFunc_t)    CreateMemPoolIter;
             getListChgCntFunc = (GetListChgCntFunc_t) GetMemPoolListChgCnt;
             getNextNodeFunc   = (GetNextNodeFunc_t)   GetNextMemPool;
-            printNodeInfoFunc = (PrintNodeInfoFunc_t) PrintMemPoolInfo;
+            printNodeInfoFunc = IsHot ? (PrintNodeInfoFunc_t) PrintMemPoolHotInfo :
+                                        (PrintNodeInfoFunc_t) PrintMemPoolInfo;
             break;
 
         case INSPECT_INSP_TYPE_THREAD_OBJ:
@@ -4448,13 +5310,17 @@ static void InspectFunc
             printNodeInfoFunc = (PrintNodeInfoFunc_t) PrintSessionObjInfo;
             break;
 
+        case INSPECT_INSP_TYPE_EVENT_LOOP:
+            createIterFunc    = (CreateIterFunc_t)    CreateThreadObjIter;
+            getListChgCntFunc = (GetListChgCntFunc_t) GetThreadObjListChgCnt;
+            getNextNodeFunc   = (GetNextNodeFunc_t)   GetNextThreadObj;
+            printNodeInfoFunc = (PrintNodeInfoFunc_t) PrintEventLoopInfo;
+            break;
+
         default:
             INTERNAL_ERR("unexpected inspect type %d.", inspectType);
     }
 
-    // Create an iterator.
-    void* iterRef = createIterFunc();
-
     static int lineCount = 0;
 
     // Print header information.
@@ -4467,6 +5333,14 @@ static void InspectFunc
 
     lineCount += PrintInspectHeader();
 
+    if (UseSnapshot)
+    {
+        lineCount += InspectSnapshot();
+        return;
+    }
+
+    // Create an iterator.
+    void* iterRef = createIterFunc();
 
     // Iterate through the list of nodes.
     size_t initialChangeCount = getListChgCntFunc(iterRef);
@@ -4518,6 +5392,12 @@ static void RefreshTimerHandler
     le_timer_Ref_t timerRef
 )
 {
+    if (UseSnapshot)
+    {
+        InspectFunc(InspectType);
+        return;
+    }
+
     TargetStop(PidToInspect);
 
     // Perform the inspection.
@@ -4669,6 +5549,10 @@ static void CommandArgHandler
     {
         InspectType = INSPECT_INSP_TYPE_SAFE_REF;
     }
+    else if (strcmp(command, "eventloop") == 0)
+    {
+        InspectType = INSPECT_INSP_TYPE_EVENT_LOOP;
+    }
     else if (strcmp(command, "ipc") == 0)
     {
         le_arg_AddPositionalCallback(IpcInterfaceTypeHandler);
@@ -4753,6 +5637,7 @@ static void InitIteratorPool
             break;
 
         case INSPECT_INSP_TYPE_THREAD_OBJ:
+        case INSPECT_INSP_TYPE_EVENT_LOOP:
             size = sizeof(ThreadObjIter_t);
             break;
 
@@ -4819,11 +5704,50 @@ COMPONENT_INIT
     // --format=json option outputs data to the specified file in JSON format.
     le_arg_SetStringCallback(FormatOptionCallback, NULL, "format");
 
+    // --hot option shows the pools' allocation rates and call sites.
+    le_arg_SetFlagVar(&IsHot, NULL, "hot");
+
     le_arg_Scan();
 
+    if (IsHot && (InspectType != INSPECT_INSP_TYPE_MEM_POOL))
+    {
+        fprintf(stderr, "The --hot option only applies to pools.\n");
+        exit(EXIT_FAILURE);
+    }
+#if !LE_CONFIG_MEM_POOL_PROFILE
+    if (IsHot)
+    {
+        fprintf(stderr, "Allocation profiling is not enabled (LE_CONFIG_MEM_POOL_PROFILE).\n");
+        exit(EXIT_FAILURE);
+    }
+#endif
+#if !LE_CONFIG_EVENT_PROFILING
+    if (InspectType == INSPECT_INSP_TYPE_EVENT_LOOP)
+    {
+        fprintf(stderr, "Event loop profiling is not enabled (LE_CONFIG_EVENT_PROFILING).\n");
+        exit(EXIT_FAILURE);
+    }
+#endif
+
     // Create a memory pool for iterators.
     InitIteratorPool(InspectType);
 
+    // Pools are read from the process' statistics snapshot, if it publishes one, without stopping
+    // the process.
+    if ((InspectType == INSPECT_INSP_TYPE_MEM_POOL) && !IsHot && (ReadSnapshot() == LE_OK))
+    {
+        UseSnapshot = true;
+
+        InitDisplay(InspectType);
+        InspectFunc(InspectType);
+
+        if (!IsFollowing)
+        {
+            exit(EXIT_SUCCESS);
+        }
+        return;
+    }
+
     TargetAttach(PidToInspect);
 
     InitDisplay(InspectType);
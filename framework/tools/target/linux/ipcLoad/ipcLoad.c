@@ -0,0 +1,594 @@
+/** @file ipcLoad.c
+ *
+ * This file implements the @ref toolsTarget_ipcload.
+ *
+ * A number of client threads each open their own session to a service, and make synchronous
+ * requests built from raw payloads given on the command-line, so any service can be loaded the
+ * way its clients load it, without code generated for its API.  The time taken by each request
+ * is recorded, and the throughput and latency percentiles of all the clients are reported once
+ * they are done.
+ *
+ * <hr>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+#include <time.h>
+
+
+//--------------------------------------------------------------------------------------------------
+/// Maximum number of different requests in the mix.
+//--------------------------------------------------------------------------------------------------
+#define MAX_REQUESTS        32
+
+
+//--------------------------------------------------------------------------------------------------
+/// Maximum number of client threads.
+//--------------------------------------------------------------------------------------------------
+#define MAX_CLIENTS         256
+
+
+//--------------------------------------------------------------------------------------------------
+/// Maximum weight of a request in the mix.
+//--------------------------------------------------------------------------------------------------
+#define MAX_WEIGHT          100
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A request of the mix.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t*    payloadPtr;     ///< Payload: message ID followed by the packed parameters.
+    size_t      payloadSize;    ///< Size of the payload, in bytes.
+    int         weight;         ///< How many times it is sent for each time a weight 1 one is.
+}
+Request_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A client thread and the latencies of its requests.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_thread_Ref_t threadRef;      ///< The client's thread.
+    int             index;          ///< Client number, from 0.
+    uint64_t*       latenciesPtr;   ///< Latency of each completed request, in nanoseconds.
+    int             completed;      ///< Number of requests that got a response.
+    int             failed;         ///< Number of requests that got no response.
+    le_result_t     openResult;     ///< Result of opening the session.
+}
+Client_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Command-line options.
+//--------------------------------------------------------------------------------------------------
+static const char* InterfaceNamePtr = NULL;
+static const char* ProtocolIdPtr = NULL;
+static int MaxMsgSize = -1;
+static int ClientCount = 1;
+static int RequestCount = 1000;
+static const char* FormatPtr = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/// The request mix, and the order in which the clients cycle through it (each request appears as
+/// many times as its weight).
+//--------------------------------------------------------------------------------------------------
+static Request_t Requests[MAX_REQUESTS];
+static int NumRequests = 0;
+static int Schedule[MAX_REQUESTS * MAX_WEIGHT];
+static int ScheduleLength = 0;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Protocol of the service under load.
+//--------------------------------------------------------------------------------------------------
+static le_msg_ProtocolRef_t ProtocolRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Clients.
+//--------------------------------------------------------------------------------------------------
+static Client_t Clients[MAX_CLIENTS];
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prints help to stdout and exits with EXIT_SUCCESS.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrintHelpAndExit
+(
+    void
+)
+{
+    puts(
+        "NAME:\n"
+        "    ipcload - IPC load generator and latency benchmark.\n"
+        "\n"
+        "SYNOPSIS:\n"
+        "    ipcload [OPTIONS] INTERFACE PROTOCOL_ID MAX_MSG_SIZE REQUEST [REQUEST ...]\n"
+        "    ipcload -h\n"
+        "    ipcload --help\n"
+        "\n"
+        "DESCRIPTION:\n"
+        "    Opens a session to the service bound to client interface INTERFACE in\n"
+        "    each of a number of client threads, and has each client send requests\n"
+        "    synchronously, one after the other.  Then reports the throughput of\n"
+        "    all the clients together, and the latency percentiles of the requests.\n"
+        "\n"
+        "    The interface must be bound to the service first, for example with:\n"
+        "        sdir bind \"<root>.INTERFACE\" app.exe.component.service\n"
+        "    Services reached through RPC links are bound to in the same way.\n"
+        "\n"
+        "    PROTOCOL_ID and MAX_MSG_SIZE are those of the service, as shown by\n"
+        "    'sdir list'.\n"
+        "\n"
+        "    Each REQUEST is given as MSGID[:HEX][@WEIGHT], where MSGID is the\n"
+        "    message ID of the function to call (its _MSGID_ value in the\n"
+        "    <api>_messages.h file generated for the service's .api), HEX is the\n"
+        "    function's packed parameters, and WEIGHT (1 to 100, 1 by default) is how\n"
+        "    often the request is sent relative to the others.\n"
+        "\n"
+        "OPTIONS:\n"
+        "    -c N, --clients=N\n"
+        "            Number of concurrent clients (1 by default).\n"
+        "\n"
+        "    -n N, --requests=N\n"
+        "            Number of requests made by each client (1000 by default).\n"
+        "\n"
+        "    --format=json\n"
+        "            Print the results in json format.\n"
+        "\n"
+        "    -h, --help\n"
+        "            Print this help text and exit.\n"
+        "\n"
+        "EXAMPLE:\n"
+        "    ipcload -c 8 -n 10000 myClient 6a1e6ee64a5e6c8d1e5c73e5e6f9a3ab 1104 0 1:2a000000@4\n"
+        );
+
+    exit(EXIT_SUCCESS);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prints an error message to stderr and exits with EXIT_FAILURE.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ExitWithErrorMsg
+(
+    const char* errorMsg
+)
+{
+    fprintf(stderr, "ipcload: %s\nTry 'ipcload --help'.\n", errorMsg);
+
+    exit(EXIT_FAILURE);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a monotonic time stamp, in nanoseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetNs
+(
+    void
+)
+{
+    struct timespec now;
+
+    LE_FATAL_IF(clock_gettime(CLOCK_MONOTONIC, &now) != 0, "clock_gettime() failed (%m).");
+
+    return ((uint64_t)now.tv_sec * 1000000000) + now.tv_nsec;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parses a request given as MSGID[:HEX][@WEIGHT] and adds it to the mix.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AddRequest
+(
+    const char* argPtr
+)
+{
+    char errorMsg[255];
+    char* endPtr;
+
+    if (NumRequests >= MAX_REQUESTS)
+    {
+        snprintf(errorMsg, sizeof(errorMsg), "Too many requests (at most %d).", MAX_REQUESTS);
+        ExitWithErrorMsg(errorMsg);
+    }
+
+    Request_t* requestPtr = &Requests[NumRequests];
+
+    errno = 0;
+    unsigned long msgId = strtoul(argPtr, &endPtr, 0);
+    if ((errno != 0) || (endPtr == argPtr) || (msgId > UINT32_MAX))
+    {
+        snprintf(errorMsg, sizeof(errorMsg), "Invalid message ID in request '%s'.", argPtr);
+        ExitWithErrorMsg(errorMsg);
+    }
+
+    const char* hexPtr = "";
+    size_t hexLen = 0;
+
+    if (*endPtr == ':')
+    {
+        hexPtr = endPtr + 1;
+        endPtr = strchr(hexPtr, '@');
+        hexLen = (endPtr != NULL) ? (size_t)(endPtr - hexPtr) : strlen(hexPtr);
+        if (endPtr == NULL)
+        {
+            endPtr = (char*)hexPtr + hexLen;
+        }
+    }
+
+    requestPtr->weight = 1;
+    if (*endPtr == '@')
+    {
+        const char* weightPtr = endPtr + 1;
+
+        errno = 0;
+        long weight = strtol(weightPtr, &endPtr, 10);
+        if ((errno != 0) || (endPtr == weightPtr) || (weight < 1) || (weight > MAX_WEIGHT))
+        {
+            snprintf(errorMsg, sizeof(errorMsg), "Invalid weight in request '%s'.", argPtr);
+            ExitWithErrorMsg(errorMsg);
+        }
+        requestPtr->weight = (int)weight;
+    }
+
+    if ((*endPtr != '\0') || ((hexLen % 2) != 0))
+    {
+        snprintf(errorMsg, sizeof(errorMsg), "Malformed request '%s'.", argPtr);
+        ExitWithErrorMsg(errorMsg);
+    }
+
+    uint32_t id = (uint32_t)msgId;
+
+    requestPtr->payloadSize = sizeof(id) + (hexLen / 2);
+    requestPtr->payloadPtr = malloc(requestPtr->payloadSize);
+    LE_ASSERT(requestPtr->payloadPtr != NULL);
+
+    memcpy(requestPtr->payloadPtr, &id, sizeof(id));
+
+    // le_hex_StringToBinary() needs a terminated string of just the hex digits.
+    char hexStr[hexLen + 1];
+    memcpy(hexStr, hexPtr, hexLen);
+    hexStr[hexLen] = '\0';
+
+    if ((hexLen > 0) &&
+        (le_hex_StringToBinary(hexStr,
+                               hexLen,
+                               requestPtr->payloadPtr + sizeof(id),
+                               hexLen / 2) != (int32_t)(hexLen / 2)))
+    {
+        snprintf(errorMsg, sizeof(errorMsg), "Invalid parameters in request '%s'.", argPtr);
+        ExitWithErrorMsg(errorMsg);
+    }
+
+    int i;
+    for (i = 0; i < requestPtr->weight; i++)
+    {
+        Schedule[ScheduleLength++] = NumRequests;
+    }
+
+    NumRequests++;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the positional arguments: the interface, protocol, message size and requests.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PositionalArgHandler
+(
+    const char* argPtr
+)
+{
+    if (InterfaceNamePtr == NULL)
+    {
+        InterfaceNamePtr = argPtr;
+    }
+    else if (ProtocolIdPtr == NULL)
+    {
+        ProtocolIdPtr = argPtr;
+    }
+    else if (MaxMsgSize < 0)
+    {
+        char* endPtr;
+
+        errno = 0;
+        long size = strtol(argPtr, &endPtr, 10);
+        if ((errno != 0) || (endPtr == argPtr) || (*endPtr != '\0') || (size < 4)
+            || (size > INT_MAX))
+        {
+            char errorMsg[255];
+            snprintf(errorMsg, sizeof(errorMsg), "Invalid maximum message size '%s'.", argPtr);
+            ExitWithErrorMsg(errorMsg);
+        }
+        MaxMsgSize = (int)size;
+    }
+    else
+    {
+        AddRequest(argPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the --format= option.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FormatArgHandler
+(
+    const char* argPtr
+)
+{
+    if (strcmp(argPtr, "json") != 0)
+    {
+        char errorMsg[255];
+        snprintf(errorMsg, sizeof(errorMsg), "Bad format specifier, '%s'.", argPtr);
+        ExitWithErrorMsg(errorMsg);
+    }
+
+    FormatPtr = argPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Main function of the client threads.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* ClientThreadMain
+(
+    void* contextPtr
+)
+{
+    Client_t* clientPtr = contextPtr;
+    le_msg_SessionRef_t sessionRef = le_msg_CreateSession(ProtocolRef, InterfaceNamePtr);
+
+    clientPtr->openResult = le_msg_TryOpenSessionSync(sessionRef);
+    if (clientPtr->openResult != LE_OK)
+    {
+        le_msg_DeleteSession(sessionRef);
+        return NULL;
+    }
+
+    // Start each client at a different point of the schedule, so the mix is spread across the
+    // clients at any given time.
+    int i;
+    for (i = 0; i < RequestCount; i++)
+    {
+        const Request_t* requestPtr =
+            &Requests[Schedule[(clientPtr->index + i) % ScheduleLength]];
+        le_msg_MessageRef_t msgRef = le_msg_CreateMsg(sessionRef);
+
+        memcpy(le_msg_GetPayloadPtr(msgRef), requestPtr->payloadPtr, requestPtr->payloadSize);
+
+        uint64_t startNs = GetNs();
+        le_msg_MessageRef_t responseRef = le_msg_RequestSyncResponse(msgRef);
+        uint64_t endNs = GetNs();
+
+        if (responseRef == NULL)
+        {
+            // The session was closed by the server; there's no point carrying on.
+            clientPtr->failed = RequestCount - i;
+            break;
+        }
+
+        le_msg_ReleaseMsg(responseRef);
+        clientPtr->latenciesPtr[clientPtr->completed++] = endNs - startNs;
+    }
+
+    le_msg_CloseSession(sessionRef);
+    le_msg_DeleteSession(sessionRef);
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compares two latencies, for qsort().
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareLatencies
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    uint64_t a = *(const uint64_t*)aPtr;
+    uint64_t b = *(const uint64_t*)bPtr;
+
+    return (a > b) - (a < b);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a percentile from a sorted list of latencies.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t Percentile
+(
+    const uint64_t* latenciesPtr,
+    size_t          count,
+    unsigned int    perThousand
+)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    size_t index = (count * perThousand) / 1000;
+
+    return latenciesPtr[(index < count) ? index : count - 1];
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Runs the clients, and prints the results.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Run
+(
+    void
+)
+{
+    int i;
+
+    ProtocolRef = le_msg_GetProtocolRef(ProtocolIdPtr, MaxMsgSize);
+
+    for (i = 0; i < NumRequests; i++)
+    {
+        if (Requests[i].payloadSize > (size_t)MaxMsgSize)
+        {
+            ExitWithErrorMsg("A request is larger than the maximum message size.");
+        }
+    }
+
+    for (i = 0; i < ClientCount; i++)
+    {
+        char name[16];
+
+        snprintf(name, sizeof(name), "client%d", i);
+
+        Clients[i].index = i;
+        Clients[i].latenciesPtr = calloc(RequestCount, sizeof(uint64_t));
+        LE_ASSERT(Clients[i].latenciesPtr != NULL);
+
+        Clients[i].threadRef = le_thread_Create(name, ClientThreadMain, &Clients[i]);
+        le_thread_SetJoinable(Clients[i].threadRef);
+    }
+
+    uint64_t startNs = GetNs();
+
+    for (i = 0; i < ClientCount; i++)
+    {
+        le_thread_Start(Clients[i].threadRef);
+    }
+
+    for (i = 0; i < ClientCount; i++)
+    {
+        le_thread_Join(Clients[i].threadRef, NULL);
+    }
+
+    uint64_t elapsedNs = GetNs() - startNs;
+
+    // Gather the latencies of all the clients.
+    size_t completed = 0;
+    size_t failed = 0;
+    uint64_t* latenciesPtr = malloc(((size_t)ClientCount * RequestCount + 1) * sizeof(uint64_t));
+    LE_ASSERT(latenciesPtr != NULL);
+
+    for (i = 0; i < ClientCount; i++)
+    {
+        if (Clients[i].openResult != LE_OK)
+        {
+            fprintf(stderr,
+                    "ipcload: client %d could not open a session to '%s' (%s).\n",
+                    i,
+                    InterfaceNamePtr,
+                    LE_RESULT_TXT(Clients[i].openResult));
+            failed += RequestCount;
+            continue;
+        }
+
+        memcpy(latenciesPtr + completed,
+               Clients[i].latenciesPtr,
+               Clients[i].completed * sizeof(uint64_t));
+        completed += Clients[i].completed;
+        failed += Clients[i].failed;
+    }
+
+    qsort(latenciesPtr, completed, sizeof(uint64_t), CompareLatencies);
+
+    uint64_t requestsPerSec = (elapsedNs > 0) ? (completed * 1000000000ULL) / elapsedNs : 0;
+
+    if (FormatPtr != NULL)
+    {
+        printf("{\"clients\":%d,\"completed\":%zu,\"failed\":%zu,\"elapsedUs\":%" PRIu64 ","
+               "\"requestsPerSec\":%" PRIu64 ",\"latencyUs\":{\"min\":%" PRIu64 ","
+               "\"p50\":%" PRIu64 ",\"p99\":%" PRIu64 ",\"p999\":%" PRIu64 ","
+               "\"max\":%" PRIu64 "}}\n",
+               ClientCount, completed, failed, elapsedNs / 1000, requestsPerSec,
+               Percentile(latenciesPtr, completed, 0) / 1000,
+               Percentile(latenciesPtr, completed, 500) / 1000,
+               Percentile(latenciesPtr, completed, 990) / 1000,
+               Percentile(latenciesPtr, completed, 999) / 1000,
+               Percentile(latenciesPtr, completed, 1000) / 1000);
+    }
+    else
+    {
+        printf("Clients:      %d\n", ClientCount);
+        printf("Requests:     %zu completed, %zu failed\n", completed, failed);
+        printf("Elapsed:      %" PRIu64 " ms\n", elapsedNs / 1000000);
+        printf("Throughput:   %" PRIu64 " requests/s\n", requestsPerSec);
+        printf("Latency (us): min %" PRIu64 ", p50 %" PRIu64 ", p99 %" PRIu64
+               ", p99.9 %" PRIu64 ", max %" PRIu64 "\n",
+               Percentile(latenciesPtr, completed, 0) / 1000,
+               Percentile(latenciesPtr, completed, 500) / 1000,
+               Percentile(latenciesPtr, completed, 990) / 1000,
+               Percentile(latenciesPtr, completed, 999) / 1000,
+               Percentile(latenciesPtr, completed, 1000) / 1000);
+    }
+
+    exit((failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+COMPONENT_INIT
+{
+    le_arg_AddPositionalCallback(PositionalArgHandler);
+    le_arg_AllowMorePositionalArgsThanCallbacks();
+
+    // Print help and exit if the "-h" or "--help" options are given.
+    le_arg_SetFlagCallback(PrintHelpAndExit, "h", "help");
+
+    le_arg_SetIntVar(&ClientCount, "c", "clients");
+    le_arg_SetIntVar(&RequestCount, "n", "requests");
+
+    // --format=json option specifies to print the results in json format.
+    le_arg_SetStringCallback(FormatArgHandler, NULL, "format");
+
+    le_arg_Scan();
+
+    if (NumRequests == 0)
+    {
+        ExitWithErrorMsg("Missing arguments.");
+    }
+
+    if ((ClientCount < 1) || (ClientCount > MAX_CLIENTS))
+    {
+        char errorMsg[255];
+        snprintf(errorMsg, sizeof(errorMsg), "Number of clients must be 1 to %d.", MAX_CLIENTS);
+        ExitWithErrorMsg(errorMsg);
+    }
+
+    if (RequestCount < 1)
+    {
+        ExitWithErrorMsg("Number of requests must be at least 1.");
+    }
+
+    Run();
+}
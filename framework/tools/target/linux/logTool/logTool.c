@@ -26,6 +26,22 @@ $ log trace keyword processName/componentName
  * To disable a trace:
  * @verbatim
 $ log stoptrace keyword processName/componentName
+@endverbatim
+ *
+ * To limit a component to 10 messages per second, in bursts of up to 50, and keep only one message
+ * in every 4 of those:
+ * @verbatim
+$ log ratelimit 10 --burst=50 --sample=4 processName/componentName
+@endverbatim
+ *
+ * To show the messages kept in the log store from the last hour:
+ * @verbatim
+$ log query --from=-3600 processName/componentName
+@endverbatim
+ *
+ * To watch the warnings (or worse) that contain "timeout", as they are logged:
+ * @verbatim
+$ log stream --level=WARNING --keyword=timeout processName/componentName
 @endverbatim
  *
  *
@@ -99,6 +115,45 @@ static const char* SessionIdPtr = DEFAULT_SESSION_ID;
 static bool ErrorOccurred = false;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start and end of the time range of a query, as given on the command line.  NULL if not given.
+ **/
+//--------------------------------------------------------------------------------------------------
+static const char* QueryFromStr = NULL;
+static const char* QueryToStr = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of records that a query should return.
+ **/
+//--------------------------------------------------------------------------------------------------
+static int QueryMaxRecords = 1000;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Filter of a stream, as given on the command line: the least severe level, a keyword and a
+ * regular expression.  NULL if not given.
+ **/
+//--------------------------------------------------------------------------------------------------
+static const char* StreamLevelStr = NULL;
+static const char* StreamKeywordStr = NULL;
+static const char* StreamRegexStr = NULL;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rate limit settings given on the command line: the most messages per second (0 for no limit),
+ * the most messages in a burst (0 for one second's worth) and keep one message in how many.
+ **/
+//--------------------------------------------------------------------------------------------------
+static unsigned int RateLimitRate = 0;
+static int RateLimitBurst = 0;
+static int RateLimitSample = 1;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Prints help to stdout.
@@ -119,6 +174,10 @@ static void PrintHelpAndExit
         "    log trace KEYWORD_STR [DESTINATION]\n"
         "    log stoptrace KEYWORD_STR [DESTINATION]\n"
         "    log forget PROCESS_NAME\n"
+        "    log query [--from=TIME] [--to=TIME] [--max=COUNT] [DESTINATION]\n"
+        "    log ratelimit RATE [--burst=COUNT] [--sample=N] [DESTINATION]\n"
+        "    log stream [--level=FILTER_STR] [--keyword=TEXT] [--regex=REGEX]\n"
+        "               [DESTINATION]\n"
         "\n"
         "DESCRIPTION:\n"
         "    log list            Lists all processes/components registered with the\n"
@@ -146,6 +205,30 @@ static void PrintHelpAndExit
         "                        Future processes with that name will have default\n"
         "                        settings.\n"
         "\n"
+        "    log query           Shows the messages kept in the persistent log store\n"
+        "                        (if it is enabled) for the DESTINATION, oldest first.\n"
+        "                        TIME is in seconds since the Epoch, or if negative,\n"
+        "                        in seconds before now.  By default all stored\n"
+        "                        messages are matched, up to COUNT (default 1000).\n"
+        "\n"
+        "    log ratelimit       Limits the number of messages logged to RATE per\n"
+        "                        second, in bursts of up to COUNT (default RATE),\n"
+        "                        and keeps only one message in every N (default 1).\n"
+        "                        The messages dropped are counted and the count is\n"
+        "                        logged periodically.  Critical and emergency\n"
+        "                        messages are never dropped.  A RATE of 0 means no\n"
+        "                        limit, so \"log ratelimit 0\" removes the limits.\n"
+        "\n"
+        "    log stream          Shows the messages logged through the log daemon\n"
+        "                        (the standard output and standard error of app\n"
+        "                        processes) for the DESTINATION as they arrive,\n"
+        "                        until interrupted.  The log daemon only sends the\n"
+        "                        messages that are at least as severe as\n"
+        "                        FILTER_STR, contain TEXT and match the POSIX\n"
+        "                        extended regular expression REGEX (each is\n"
+        "                        optional).  For app output, the componentName is\n"
+        "                        the app name.\n"
+        "\n"
         "The [DESTINATION] is optional and specifies the process and component to\n"
         "send the command to.  The [DESTINATION] must be in this format:\n"
         "\n"
@@ -479,6 +562,74 @@ static void ProcessIdArgHandler
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function that gets called by le_arg_Scan() when the rate argument of a "ratelimit" command is
+ * seen on the command line.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void RateLimitArgHandler
+(
+    const char* rateStr
+)
+{
+    char* endPtr;
+
+    errno = 0;
+    unsigned long rate = strtoul(rateStr, &endPtr, 10);
+    if (   (!isdigit((unsigned char)rateStr[0]))
+        || (*endPtr != '\0')
+        || (errno != 0)
+        || (rate > UINT32_MAX))
+    {
+        ExitWithErrorMsg("Invalid rate.");
+    }
+
+    RateLimitRate = rate;
+
+    // Wait for an optional log session identifier next.
+    le_arg_AddPositionalCallback(SessionIdArgHandler);
+    le_arg_AllowLessPositionalArgsThanCallbacks();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parses a query time given on the command line.
+ *
+ * @return The time, in seconds since the Epoch.
+ **/
+//--------------------------------------------------------------------------------------------------
+static long long ParseQueryTime
+(
+    const char* timeStr,    ///< [IN] The time as given, or NULL if not given.
+    long long defaultTime   ///< [IN] Time to use if not given.
+)
+{
+    char* endPtr;
+
+    if (timeStr == NULL)
+    {
+        return defaultTime;
+    }
+
+    errno = 0;
+    long long t = strtoll(timeStr, &endPtr, 10);
+    if ((timeStr[0] == '\0') || (*endPtr != '\0') || (errno != 0))
+    {
+        ExitWithErrorMsg("Invalid time.");
+    }
+
+    // Negative times are relative to now.
+    if (t < 0)
+    {
+        t += time(NULL);
+    }
+
+    return t;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Function that gets called by le_arg_Scan() when it sees the first positional argument while
@@ -529,6 +680,29 @@ static void CommandArgHandler
         // This command has only a process name (or pid) as a parameter.
         le_arg_AddPositionalCallback(ProcessIdArgHandler);
     }
+    else if (strcmp(command, "ratelimit") == 0)
+    {
+        Command = LOG_CMD_SET_RATE_LIMIT;
+
+        // Expect a rate next.
+        le_arg_AddPositionalCallback(RateLimitArgHandler);
+    }
+    else if (strcmp(command, "stream") == 0)
+    {
+        Command = LOG_CMD_STREAM;
+
+        // The filter is given by options.  Wait for an optional log session identifier.
+        le_arg_AddPositionalCallback(SessionIdArgHandler);
+        le_arg_AllowLessPositionalArgsThanCallbacks();
+    }
+    else if (strcmp(command, "query") == 0)
+    {
+        Command = LOG_CMD_QUERY;
+
+        // The time range is given by options.  Wait for an optional log session identifier.
+        le_arg_AddPositionalCallback(SessionIdArgHandler);
+        le_arg_AllowLessPositionalArgsThanCallbacks();
+    }
     else
     {
         char errorMsg[100];
@@ -551,8 +725,40 @@ COMPONENT_INIT
     // Print help and exit if the "-h" or "--help" options are given.
     le_arg_SetFlagCallback(PrintHelpAndExit, "h", "help");
 
+    // Options for the "query" command.
+    le_arg_SetStringVar(&QueryFromStr, NULL, "from");
+    le_arg_SetStringVar(&QueryToStr, NULL, "to");
+    le_arg_SetIntVar(&QueryMaxRecords, NULL, "max");
+
+    // Options for the "ratelimit" command.
+    le_arg_SetIntVar(&RateLimitBurst, NULL, "burst");
+    le_arg_SetIntVar(&RateLimitSample, NULL, "sample");
+
+    // Options for the "stream" command.
+    le_arg_SetStringVar(&StreamLevelStr, NULL, "level");
+    le_arg_SetStringVar(&StreamKeywordStr, NULL, "keyword");
+    le_arg_SetStringVar(&StreamRegexStr, NULL, "regex");
+
     le_arg_Scan();
 
+    if ((Command != LOG_CMD_QUERY) &&
+        ((QueryFromStr != NULL) || (QueryToStr != NULL)))
+    {
+        ExitWithErrorMsg("--from and --to are only valid with the query command.");
+    }
+
+    if ((Command != LOG_CMD_SET_RATE_LIMIT) &&
+        ((RateLimitBurst != 0) || (RateLimitSample != 1)))
+    {
+        ExitWithErrorMsg("--burst and --sample are only valid with the ratelimit command.");
+    }
+
+    if ((Command != LOG_CMD_STREAM) &&
+        ((StreamLevelStr != NULL) || (StreamKeywordStr != NULL) || (StreamRegexStr != NULL)))
+    {
+        ExitWithErrorMsg("--level, --keyword and --regex are only valid with the stream command.");
+    }
+
     // Connect to the Log Control Daemon and allocate a message buffer to hold the command.
     le_msg_SessionRef_t sessionRef = ConnectToLogControlDaemon();
     le_msg_MessageRef_t msgRef = le_msg_CreateMsg(sessionRef);
@@ -584,10 +790,88 @@ COMPONENT_INIT
             AppendToCommand(msgRef, CommandParamPtr);
 
             break;
+
+        case LOG_CMD_QUERY:
+        {
+            char params[64];
+
+            if (QueryMaxRecords <= 0)
+            {
+                ExitWithErrorMsg("Invalid maximum record count.");
+            }
+
+            snprintf(params, sizeof(params), LOG_QUERY_PARAMS_FORMAT,
+                     ParseQueryTime(QueryFromStr, 0),
+                     ParseQueryTime(QueryToStr, LLONG_MAX),
+                     (size_t)QueryMaxRecords);
+
+            AppendToCommand(msgRef, SessionIdPtr);
+            AppendToCommand(msgRef, "/");
+            AppendToCommand(msgRef, params);
+
+            break;
+        }
+
+        case LOG_CMD_STREAM:
+        {
+            const char separator[] = { LOG_STREAM_PARAMS_SEPARATOR, '\0' };
+            const char* levelStr = "";
+
+            if (StreamLevelStr != NULL)
+            {
+                le_log_Level_t level = ParseSeverityLevel(StreamLevelStr);
+                if (level == (le_log_Level_t)(-1))
+                {
+                    ExitWithErrorMsg("Invalid log level.");
+                }
+                levelStr = log_SeverityLevelToStr(level);
+            }
+
+            if (   ((StreamKeywordStr != NULL) && (strchr(StreamKeywordStr, separator[0]) != NULL))
+                || ((StreamRegexStr != NULL) && (strchr(StreamRegexStr, separator[0]) != NULL)))
+            {
+                ExitWithErrorMsg("The keyword and regular expression must be on one line.");
+            }
+
+            AppendToCommand(msgRef, SessionIdPtr);
+            AppendToCommand(msgRef, "/");
+            AppendToCommand(msgRef, levelStr);
+            AppendToCommand(msgRef, separator);
+            AppendToCommand(msgRef, (StreamKeywordStr != NULL) ? StreamKeywordStr : "");
+            AppendToCommand(msgRef, separator);
+            AppendToCommand(msgRef, (StreamRegexStr != NULL) ? StreamRegexStr : "");
+
+            break;
+        }
+
+        case LOG_CMD_SET_RATE_LIMIT:
+        {
+            char params[64];
+
+            if (RateLimitBurst < 0)
+            {
+                ExitWithErrorMsg("Invalid burst size.");
+            }
+            if (RateLimitSample <= 0)
+            {
+                ExitWithErrorMsg("Invalid sample size.");
+            }
+
+            snprintf(params, sizeof(params), LOG_RATE_LIMIT_PARAMS_FORMAT,
+                     RateLimitRate,
+                     (unsigned int)RateLimitBurst,
+                     (unsigned int)RateLimitSample);
+
+            AppendToCommand(msgRef, SessionIdPtr);
+            AppendToCommand(msgRef, "/");
+            AppendToCommand(msgRef, params);
+
+            break;
+        }
     }
 
     // Send the command and wait for messages from the Log Control Daemon.  When the Log Control
     // Daemon has finished executing the command, it will close the IPC session, resulting in a
-    // call to SessionCloseHandler().
+    // call to SessionCloseHandler().  A stream goes on until the tool is interrupted.
     le_msg_Send(msgRef);
 }
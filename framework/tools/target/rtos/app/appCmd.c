@@ -32,6 +32,7 @@ static bool FoundArgSeparator = false;
 enum {
     CMD_UNKNOWN,
     CMD_STATUS,
+    CMD_POOLS,
     CMD_START_APP,
     CMD_START_PROC,
     CMD_ERROR
@@ -89,6 +90,7 @@ static void CommandHelpHandler
 )
 {
     printf("Usage: app status\n"
+           "       app pools\n"
            "       app start appName\n"
            "       app runProc appName procName [-- <args> ]\n");
 }
@@ -198,6 +200,10 @@ static void CommandArgHandler
     {
         Command = CMD_STATUS;
     }
+    else if (strcmp(command, "pools") == 0)
+    {
+        Command = CMD_POOLS;
+    }
     else if (strcmp(command, "start") == 0)
     {
         le_arg_AddPositionalCallback(StartAppHandler);
@@ -231,6 +237,9 @@ COMPONENT_INIT
         case CMD_STATUS:
             le_microSupervisor_DebugAppStatus();
             return;
+        case CMD_POOLS:
+            le_microSupervisor_DebugMemPools();
+            return;
         case CMD_START_APP:
             le_microSupervisor_StartApp(AppNameStr);
             return;
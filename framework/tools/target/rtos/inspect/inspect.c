@@ -615,6 +615,7 @@ static ColumnInfo_t MemPoolTableInfo[] =
     {"OVERFLOWS",   "%*s",  NULL, "%*" PRIuS,   sizeof(size_t),              false, 0, true},
     {"ALLOCS",      "%*s",  NULL, "%*" PRIu64,  sizeof(uint64_t),            false, 0, true},
     {"BLK BYTES",   "%*s",  NULL, "%*" PRIuS,   sizeof(size_t),              false, 0, true},
+    {"FRAG %",      "%*s",  NULL, "%*" PRIuS,   sizeof(size_t),              false, 0, true},
     {"USED BYTES",  "%*s",  NULL, "%*" PRIuS,   sizeof(size_t),              false, 0, true},
     {"MEMORY POOL", "%-*s", NULL, "%-*s",       LIMIT_MAX_MEM_POOL_NAME_LEN, true,  0, true},
     {"SUB-POOL",    "%*s",  NULL, "%*s",        0,                           true,  0, true}
@@ -983,6 +984,19 @@ static int PrintMemPoolInfo
 
     size_t blockSize = le_mem_GetObjectFullSize(memPool);
 
+    // Percentage of the object space handed out by variable-size allocations that went unused.
+    // Pools that only serve fixed-size allocations show 0.
+    size_t fragPercent = 0;
+    if ((poolStats.numAllocs > 0) && (poolStats.numBytesRequested > 0))
+    {
+        uint64_t allocatedBytes = poolStats.numAllocs * le_mem_GetObjectSize(memPool);
+
+        if (poolStats.numBytesRequested < allocatedBytes)
+        {
+            fragPercent = 100 - (size_t)(poolStats.numBytesRequested * 100 / allocatedBytes);
+        }
+    }
+
     // Determine if this pool is a sub-pool, and set the appropriate string to display it.
     char* subPoolStr = le_mem_IsSubPool(memPool) ? SubPoolStr : SuperPoolStr;
 
@@ -1009,6 +1023,8 @@ static int PrintMemPoolInfo
                                                              MemPoolTableInfoSize, &index);
     FillSizeTColField (blockSize,                            MemPoolTableInfo,
                                                              MemPoolTableInfoSize, &index);
+    FillSizeTColField (fragPercent,                          MemPoolTableInfo,
+                                                             MemPoolTableInfoSize, &index);
     FillSizeTColField (blockSize*(poolStats.numBlocksInUse), MemPoolTableInfo,
                                                              MemPoolTableInfoSize, &index);
     FillStrColField   (name,                                 MemPoolTableInfo,